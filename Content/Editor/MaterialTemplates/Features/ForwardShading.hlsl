@@ -14,6 +14,7 @@
 #include "./Flax/Lighting.hlsl"
 #include "./Flax/ShadowsSampling.hlsl"
 #include "./Flax/ExponentialHeightFog.hlsl"
+#include "./Flax/LightClusters.hlsl"
 @2// Forward Shading: Constants
 LightData DirectionalLight;
 LightData SkyLight;
@@ -22,11 +23,16 @@ ExponentialHeightFogData ExponentialHeightFog;
 float3 Dummy2;
 uint LocalLightsCount;
 LightData LocalLights[MAX_LOCAL_LIGHTS];
+float4 LightClustersParams;
 @3// Forward Shading: Resources
 TextureCube EnvProbe : register(t__SRV__);
 TextureCube SkyLightTexture : register(t__SRV__);
 Buffer<float4> ShadowsBuffer : register(t__SRV__);
 Texture2D<float> ShadowMap : register(t__SRV__);
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+StructuredBuffer<LightData> ClusterLights : register(t__SRV__);
+Buffer<uint> ClusterGrid : register(t__SRV__);
+#endif
 @4// Forward Shading: Utilities
 @5// Forward Shading: Shaders
 
@@ -85,12 +91,28 @@ void PS_Forward(
 	light += GetSkyLightLighting(SkyLight, gBuffer, SkyLightTexture);
 
 	// Calculate lighting from local lights
+	shadowMask = 1.0f;
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+	BRANCH
+	if (LightClustersParams.w > 0.0f)
+	{
+		// Use all lights from the cluster
+		uint clusterIndex = GetLightClusterIndex(materialInput.SvPosition.xy * ScreenSize.zw, gBuffer.ViewPos.z, LightClustersParams.xy);
+		uint clusterLightsCount = GetLightClusterLightsCount(ClusterGrid, clusterIndex);
+		LOOP
+		for (uint clusterLightIndex = 0; clusterLightIndex < clusterLightsCount; clusterLightIndex++)
+		{
+			const LightData localLight = ClusterLights[GetLightClusterLight(ClusterGrid, clusterIndex, clusterLightIndex)];
+			bool isSpotLight = localLight.SpotAngles.x > -2.0f;
+			light += GetLighting(ViewPos, localLight, gBuffer, shadowMask, true, isSpotLight);
+		}
+	}
+#endif
 	LOOP
 	for (uint localLightIndex = 0; localLightIndex < LocalLightsCount; localLightIndex++)
 	{
 		const LightData localLight = LocalLights[localLightIndex];
 		bool isSpotLight = localLight.SpotAngles.x > -2.0f;
-		shadowMask = 1.0f;
 		light += GetLighting(ViewPos, localLight, gBuffer, shadowMask, true, isSpotLight);
 	}
 
@@ -8,6 +8,9 @@
 // Enables/disables smooth terrain chunks LOD transitions (with morphing higher LOD near edges to the lower LOD in the neighbour)
 #define USE_SMOOTH_LOD_TRANSITION 1
 
+// The fraction of the LOD distance range at which chunk vertices start to morph into the next LOD (continuous LOD based on the distance to the view)
+#define TERRAIN_LOD_MORPH_START 0.5f
+
 // Switches between using 0, 4 or 8 heightmap layers (values: 0, 1, 2)
 #define TERRAIN_LAYERS_DATA_SIZE 2
 #define USE_TERRAIN_LAYERS (TERRAIN_LAYERS_DATA_SIZE > 0)
@@ -28,8 +31,10 @@ float TerrainChunkSizeLOD0;
 float4 HeightmapUVScaleBias;
 float4 NeighborLOD;
 float2 OffsetUV;
-float2 Dummy0;
+float2 LODMorph;
 float4 LightmapArea;
+float3 LODViewPosition;
+float Dummy0;
 @1META_CB_END
 
 // Terrain data
@@ -275,7 +280,7 @@ Material GetMaterialPS(MaterialInput input)
 }
 
 // Calculates LOD value (with fractional part for blending)
-float CalcLOD(float2 xy, float4 morph)
+float CalcLOD(float2 xy, float4 morph, out float edgeWeight)
 {
 #if USE_SMOOTH_LOD_TRANSITION
 	// Use LOD value based on Barycentric coordinates to morph to the lower LOD near chunk edges
@@ -286,24 +291,48 @@ float CalcLOD(float2 xy, float4 morph)
 	if ((xy.x + xy.y) > 1)
 	{
 		if (xy.x < xy.y)
+		{
 			lod = lodCalculated.w;
+			edgeWeight = morph.w;
+		}
 		else
+		{
 			lod = lodCalculated.z;
+			edgeWeight = morph.z;
+		}
 	}
 	else
 	{
 		if (xy.x < xy.y)
+		{
 			lod = lodCalculated.y;
+			edgeWeight = morph.y;
+		}
 		else
+		{
 			lod = lodCalculated.x;
+			edgeWeight = morph.x;
+		}
 	}
 
 	return lod;
 #else
+	edgeWeight = 1;
 	return CurrentLOD;
 #endif
 }
 
+// Calculates the morphing into the next LOD based on the vertex distance to the LOD view (continuous LOD within the chunk to prevent popping on LOD changes)
+float CalcDistanceMorph(float3 worldPosition)
+{
+	// LODMorph: x=LOD distribution (0 if disabled), y=LOD bias (matches TerrainChunk::PrepareDraw)
+	if (LODMorph.x <= 0.0f)
+		return 0.0f;
+	float distance = length(worldPosition - LODViewPosition);
+	float lod = pow(distance / TerrainChunkSizeLOD0, LODMorph.x) + LODMorph.y;
+	return saturate((lod - CurrentLOD - TERRAIN_LOD_MORPH_START) / (1.0f - TERRAIN_LOD_MORPH_START));
+}
+
 float3x3 CalcTangentToWorld(float4x4 world, float3x3 tangentToLocal)
 {
 	float3x3 localToWorld = RemoveScaleFromLocalToWorld((float3x3)world);
@@ -326,14 +355,22 @@ VertexOutput VS(TerrainVertexInput input)
 	VertexOutput output;
 
 	// Calculate terrain LOD for this chunk
-	float lodCalculated = CalcLOD(input.TexCoord, input.Morph);
+	float edgeWeight;
+	float lodCalculated = CalcLOD(input.TexCoord, input.Morph, edgeWeight);
 	float lodValue = CurrentLOD;
 	float morphAlpha = lodCalculated - CurrentLOD;
+	float4x4 worldMatrix = ToMatrix4x4(WorldMatrix);
 
 	// Sample heightmap
 	float2 heightmapUVs = input.TexCoord * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
 #if USE_SMOOTH_LOD_TRANSITION
 	float4 heightmapValueThisLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVs, lodValue);
+
+	// Morph interior vertices into the next LOD based on the distance (chunk edges are driven only by the neighbors LOD to prevent cracks)
+	float heightThisLOD = (float)((int)(heightmapValueThisLOD.x * 255.0) + ((int)(heightmapValueThisLOD.y * 255) << 8)) / 65535.0;
+	float3 positionThisLOD = mul(float4(input.TexCoord.x * TerrainChunkSizeLOD0, heightThisLOD, input.TexCoord.y * TerrainChunkSizeLOD0, 1), worldMatrix).xyz;
+	morphAlpha = max(morphAlpha, CalcDistanceMorph(positionThisLOD) * edgeWeight);
+
 	float2 nextLODPos = round(input.TexCoord * ChunkSizeNextLOD) / ChunkSizeNextLOD;
 	float2 heightmapUVsNextLOD = nextLODPos * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
 	float4 heightmapValueNextLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVsNextLOD, lodValue + 1);
@@ -382,7 +419,6 @@ VertexOutput VS(TerrainVertexInput input)
 	float3 position = float3(positionXZ.x, height, positionXZ.y);
 
 	// Compute world space vertex position
-	float4x4 worldMatrix = ToMatrix4x4(WorldMatrix);
 	output.Geometry.WorldPosition = mul(float4(position, 1), worldMatrix).xyz;
 
 	// Compute clip space position
@@ -20,6 +20,7 @@ partial struct Options
             private bool ShowSmoothingNormalsAngle => ShowGeometry && CalculateNormals;
             private bool ShowSmoothingTangentsAngle => ShowGeometry && CalculateTangents;
             private bool ShowFramesRange => ShowAnimation && Duration == AnimationDuration.Custom;
+            private bool ShowKeyframesReduction => ShowAnimation && OptimizeKeyframes;
             private bool ShowSplitting => Type != ModelType.Prefab;
         }
     }
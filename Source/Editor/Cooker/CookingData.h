@@ -284,6 +284,11 @@ DECLARE_SCRIPTING_TYPE(CookingData);
         /// </summary>
         uint64 ContentSize = 0;
 
+        /// <summary>
+        /// The total time spent on cooking the assets of that type (in seconds). Excludes the assets reused from the cache.
+        /// </summary>
+        double CookTime = 0;
+
         bool operator<(const AssetTypeStatistics& other) const;
     };
 
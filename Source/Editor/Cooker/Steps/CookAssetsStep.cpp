@@ -5,6 +5,8 @@
 #include "Engine/Core/DeleteMe.h"
 #include "Engine/Core/Utilities.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Asset.h"
@@ -16,9 +18,14 @@
 #include "Engine/Content/Assets/Texture.h"
 #include "Engine/Content/Assets/CubeTexture.h"
 #include "Engine/Render2D/SpriteAtlas.h"
+#include "Engine/Level/Prefabs/Prefab.h"
+#include "Engine/Level/Scene/SceneAsset.h"
 #include "Engine/Content/Storage/FlaxFile.h"
+#include "Engine/Content/Loading/ContentLoadOrder.h"
 #include "Engine/Particles/ParticleEmitter.h"
 #include "Engine/Utilities/Encryption.h"
+#include "Engine/Utilities/Crc.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
@@ -37,6 +44,8 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Tools/TextureTool/TextureTool.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/Scripting/Enums.h"
 #if PLATFORM_TOOLS_WINDOWS
 #include "Engine/Platform/Windows/WindowsPlatformSettings.h"
@@ -49,6 +58,15 @@
 #endif
 #include "FlaxEngine.Gen.h"
 
+// Version of the cooking cache header file format (stored as negative value to not collide with the entries count used by the older format)
+#define COOK_CACHE_VERSION 2
+
+// Version of the shared cache entry metadata file format
+#define COOK_SHARED_CACHE_VERSION 1
+
+// Maximum amount of assets cooked at once (limits the memory used by the loaded source assets and cooked data)
+#define COOK_ASSETS_BATCH_SIZE 16
+
 Dictionary<String, CookAssetsStep::ProcessAssetFunc> CookAssetsStep::AssetProcessors;
 
 void IBuildCache::InvalidateCacheShaders()
@@ -72,21 +90,9 @@ bool CookAssetsStep::CacheEntry::IsValid(bool withDependencies)
     {
         if (TypeName == assetInfo.TypeName)
         {
-            if (FileSystem::GetFileLastEditTime(assetInfo.Path) <= FileModified)
+            if (IsFileValid(assetInfo.Path, FileModified, FileHash))
             {
-                bool isValid = true;
-                if (withDependencies)
-                {
-                    for (auto& f : FileDependencies)
-                    {
-                        if (FileSystem::GetFileLastEditTime(f.First) > f.Second)
-                        {
-                            isValid = false;
-                            break;
-                        }
-                    }
-                }
-                if (isValid)
+                if (!withDependencies || IsDependenciesValid())
                     return true;
             }
         }
@@ -94,6 +100,63 @@ bool CookAssetsStep::CacheEntry::IsValid(bool withDependencies)
     return false;
 }
 
+bool CookAssetsStep::CacheEntry::IsDependenciesValid()
+{
+    for (int32 i = 0; i < FileDependencies.Count(); i++)
+    {
+        auto& f = FileDependencies[i];
+        if (!IsFileValid(f.First, f.Second, i < FileDependenciesHashes.Count() ? FileDependenciesHashes[i] : 0))
+            return false;
+    }
+    return true;
+}
+
+void CookAssetsStep::CacheEntry::UpdateHashes(const StringView& path)
+{
+    PROFILE_CPU();
+    FileHash = GetFileHash(path);
+    FileDependenciesHashes.Resize(FileDependencies.Count());
+    for (int32 i = 0; i < FileDependencies.Count(); i++)
+        FileDependenciesHashes[i] = GetFileHash(FileDependencies[i].First);
+}
+
+uint64 CookAssetsStep::CacheEntry::GetFileHash(const StringView& path)
+{
+    auto file = FileReadStream::Open(path);
+    if (file == nullptr)
+        return 0;
+    DeleteMe<FileReadStream> deleteFile(file);
+    const uint32 size = file->GetLength();
+    Array<byte> buffer;
+    buffer.Resize(Math::Min<uint32>(size, 64 * 1024));
+    uint32 crc = 0;
+    for (uint32 position = 0; position < size;)
+    {
+        const uint32 count = Math::Min<uint32>(size - position, buffer.Count());
+        file->ReadBytes(buffer.Get(), count);
+        if (file->HasError())
+            return 0;
+        crc = Crc::MemCrc32(buffer.Get(), (int32)count, crc);
+        position += count;
+    }
+    return (uint64)size << 32 | crc;
+}
+
+bool CookAssetsStep::CacheEntry::IsFileValid(const StringView& path, DateTime& modified, uint64 hash)
+{
+    const DateTime fileModified = FileSystem::GetFileLastEditTime(path);
+    if (fileModified <= modified)
+        return true;
+
+    // Compare the contents if file has been touched without modification (eg. by source control checkout or branch switch)
+    if (hash != 0 && GetFileHash(path) == hash)
+    {
+        modified = fileModified;
+        return true;
+    }
+    return false;
+}
+
 CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const JsonAssetBase* asset, String& cachedFilePath)
 {
     ASSERT(asset->DataTypeName.HasChars());
@@ -101,6 +164,8 @@ CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const JsonAss
     entry.ID = asset->GetID();
     entry.TypeName = asset->DataTypeName;
     entry.FileModified = FileSystem::GetFileLastEditTime(asset->GetPath());
+    entry.FileHash = 0;
+    entry.FileDependenciesHashes.Clear();
     cachedFilePath = CacheFolder / entry.ID.ToString(Guid::FormatType::N);
     return entry;
 }
@@ -111,6 +176,8 @@ CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const Asset*
     entry.ID = asset->GetID();
     entry.TypeName = asset->GetTypeName();
     entry.FileModified = FileSystem::GetFileLastEditTime(asset->GetPath());
+    entry.FileHash = 0;
+    entry.FileDependenciesHashes.Clear();
     cachedFilePath = CacheFolder / entry.ID.ToString(Guid::FormatType::N);
     return entry;
 }
@@ -151,6 +218,10 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
     file->ReadInt32(&buildNum);
     if (buildNum != FLAXENGINE_VERSION_BUILD)
         return;
+    int32 version;
+    file->ReadInt32(&version);
+    if (version != -COOK_CACHE_VERSION)
+        return;
     int32 entriesCount;
     file->ReadInt32(&entriesCount);
     if (Math::IsNotInRange(entriesCount, 0, 1000000))
@@ -161,6 +232,7 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
     Entries.EnsureCapacity(Math::RoundUpToPowerOf2(static_cast<int32>(entriesCount * 3.0f)));
 
     Array<Pair<String, DateTime>> fileDependencies;
+    Array<uint64> fileDependenciesHashes;
     for (int32 i = 0; i < entriesCount; i++)
     {
         Guid id;
@@ -169,15 +241,20 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
         file->ReadString(&typeName);
         DateTime fileModified;
         file->Read(fileModified);
+        uint64 fileHash;
+        file->ReadUint64(&fileHash);
         int32 fileDependenciesCount;
         file->ReadInt32(&fileDependenciesCount);
         fileDependencies.Clear();
         fileDependencies.Resize(fileDependenciesCount);
+        fileDependenciesHashes.Clear();
+        fileDependenciesHashes.Resize(fileDependenciesCount);
         for (int32 j = 0; j < fileDependenciesCount; j++)
         {
             Pair<String, DateTime>& f = fileDependencies[j];
             file->ReadString(&f.First, 10);
             file->Read(f.Second);
+            file->ReadUint64(&fileDependenciesHashes[j]);
         }
 
         // Skip missing entries
@@ -188,7 +265,9 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
         e.ID = id;
         e.TypeName = typeName;
         e.FileModified = fileModified;
+        e.FileHash = fileHash;
         e.FileDependencies = fileDependencies;
+        e.FileDependenciesHashes = fileDependenciesHashes;
     }
 
     Array<byte> platformCache;
@@ -235,6 +314,12 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
         LOG(Info, "{0} option has been modified.", TEXT("ShadersGenerateDebugData"));
         invalidateShaders = true;
     }
+    if (buildSettings->BinaryScenes != Settings.Global.BinaryScenes)
+    {
+        LOG(Info, "{0} option has been modified.", TEXT("BinaryScenes"));
+        InvalidateCachePerType<SceneAsset>();
+        InvalidateCachePerType<Prefab>();
+    }
 #if PLATFORM_TOOLS_WINDOWS
     if (data.Platform == BuildPlatform::Windows32 || data.Platform == BuildPlatform::Windows64)
     {
@@ -305,6 +390,7 @@ void CookAssetsStep::CacheData::Save(CookingData& data)
 
     // Serialize
     file->WriteInt32(FLAXENGINE_VERSION_BUILD);
+    file->WriteInt32(-COOK_CACHE_VERSION);
     file->WriteInt32(Entries.Count());
     file->WriteBytes(&Settings, sizeof(Settings));
     for (auto i = Entries.Begin(); i.IsNotEnd(); ++i)
@@ -313,17 +399,168 @@ void CookAssetsStep::CacheData::Save(CookingData& data)
         file->Write(e.ID);
         file->WriteString(e.TypeName);
         file->Write(e.FileModified);
+        file->WriteUint64(e.FileHash);
         file->WriteInt32(e.FileDependencies.Count());
-        for (auto& f : e.FileDependencies)
+        for (int32 j = 0; j < e.FileDependencies.Count(); j++)
         {
+            auto& f = e.FileDependencies[j];
             file->Write(f.First, 10);
             file->Write(f.Second);
+            file->WriteUint64(j < e.FileDependenciesHashes.Count() ? e.FileDependenciesHashes[j] : 0);
         }
     }
     file->Write(data.Tools->SaveCache(data, this));
     file->WriteInt32(13);
 }
 
+void CookAssetsStep::CacheData::InitShared(CookingData& data)
+{
+    SharedCacheFolder.Clear();
+    const String& sharedCookCache = BuildSettings::Get()->SharedCookCache;
+    if (sharedCookCache.IsEmpty())
+        return;
+    const String folder = FileSystem::ConvertRelativePathToAbsolute(Globals::ProjectFolder, sharedCookCache) / String::Format(TEXT("{0}_{1}"), ::ToString(data.Platform), FLAXENGINE_VERSION_BUILD);
+    if (!FileSystem::DirectoryExists(folder) && FileSystem::CreateDirectory(folder))
+    {
+        LOG(Warning, "Cannot create shared cooking cache folder '{0}'.", folder);
+        return;
+    }
+    SharedCacheFolder = folder;
+
+    // Hash all options that affect the cooked data so changing them uses the separate set of shared entries
+    MemoryWriteStream stream(1024);
+    stream.WriteInt32(FLAXENGINE_VERSION_BUILD);
+    stream.WriteInt32((int32)data.Platform);
+    stream.WriteBool(Settings.Windows.SupportDX12);
+    stream.WriteBool(Settings.Windows.SupportDX11);
+    stream.WriteBool(Settings.Windows.SupportDX10);
+    stream.WriteBool(Settings.Windows.SupportVulkan);
+    stream.WriteBool(Settings.UWP.SupportDX11);
+    stream.WriteBool(Settings.UWP.SupportDX10);
+    stream.WriteBool(Settings.Linux.SupportVulkan);
+    stream.WriteBool(Settings.Global.ShadersNoOptimize);
+    stream.WriteBool(Settings.Global.ShadersGenerateDebugData);
+    stream.WriteBool(Settings.Global.BinaryScenes);
+    stream.WriteInt32(Settings.Global.ShadersVersion);
+    stream.WriteInt32(Settings.Global.MaterialGraphVersion);
+    stream.WriteInt32(Settings.Global.ParticleGraphVersion);
+    AssetInfo streamingSettings;
+    if (Content::GetAssetInfo(Settings.Global.StreamingSettingsAssetId, streamingSettings))
+        stream.WriteUint64(CacheEntry::GetFileHash(streamingSettings.Path));
+    const Array<byte> platformCache = data.Tools->SaveCache(data, this);
+    stream.WriteBytes(platformCache.Get(), platformCache.Count());
+    SharedCacheSeed = Crc::MemCrc32(stream.GetHandle(), (int32)stream.GetPosition());
+    LOG(Info, "Using shared cooking cache '{0}'", SharedCacheFolder);
+}
+
+String CookAssetsStep::CacheData::GetSharedFilePath(const Guid& id, uint64 fileHash, const StringView& typeName) const
+{
+    uint32 key = Crc::MemCrc32(&fileHash, sizeof(fileHash), SharedCacheSeed);
+    key = Crc::MemCrc32(typeName.Get(), typeName.Length() * sizeof(Char), key);
+    return SharedCacheFolder / String::Format(TEXT("{0}_{1:08x}"), id.ToString(Guid::FormatType::N), key);
+}
+
+bool CookAssetsStep::CacheData::LoadShared(const AssetInfo& info)
+{
+    if (SharedCacheFolder.IsEmpty())
+        return false;
+    PROFILE_CPU();
+    const uint64 fileHash = CacheEntry::GetFileHash(info.Path);
+    if (fileHash == 0)
+        return false;
+    const String sharedFilePath = GetSharedFilePath(info.ID, fileHash, info.TypeName);
+    const String sharedMetaPath = sharedFilePath + TEXT(".meta");
+    if (!FileSystem::FileExists(sharedFilePath) || !FileSystem::FileExists(sharedMetaPath))
+        return false;
+    auto file = FileReadStream::Open(sharedMetaPath);
+    if (file == nullptr)
+        return false;
+    DeleteMe<FileReadStream> deleteFile(file);
+
+    // Validate the shared entry against the local files (including dependencies such as shader includes)
+    int32 version;
+    file->ReadInt32(&version);
+    uint64 cachedFileHash;
+    file->ReadUint64(&cachedFileHash);
+    String typeName;
+    file->ReadString(&typeName);
+    int32 fileDependenciesCount;
+    file->ReadInt32(&fileDependenciesCount);
+    if (file->HasError() || version != COOK_SHARED_CACHE_VERSION || cachedFileHash != fileHash || typeName != info.TypeName || Math::IsNotInRange(fileDependenciesCount, 0, 100000))
+        return false;
+    CacheEntry entry;
+    entry.ID = info.ID;
+    entry.TypeName = info.TypeName;
+    entry.FileModified = FileSystem::GetFileLastEditTime(info.Path);
+    entry.FileHash = fileHash;
+    entry.FileDependencies.Resize(fileDependenciesCount);
+    entry.FileDependenciesHashes.Resize(fileDependenciesCount);
+    for (int32 i = 0; i < fileDependenciesCount; i++)
+    {
+        auto& f = entry.FileDependencies[i];
+        uint64& hash = entry.FileDependenciesHashes[i];
+        file->ReadString(&f.First, 10);
+        file->ReadUint64(&hash);
+        if (file->HasError() || hash == 0 || CacheEntry::GetFileHash(f.First) != hash)
+            return false;
+        f.Second = FileSystem::GetFileLastEditTime(f.First);
+    }
+
+    // Use the shared cooked file
+    String cachedFilePath;
+    GetFilePath(info.ID, cachedFilePath);
+    if (FileSystem::CopyFile(cachedFilePath, sharedFilePath))
+    {
+        LOG(Warning, "Failed to copy cooked file from shared cache '{0}'.", sharedFilePath);
+        return false;
+    }
+    Entries[info.ID] = MoveTemp(entry);
+    return true;
+}
+
+void CookAssetsStep::CacheData::SaveShared(const CacheEntry& entry)
+{
+    if (SharedCacheFolder.IsEmpty() || entry.FileHash == 0)
+        return;
+    for (const uint64 hash : entry.FileDependenciesHashes)
+    {
+        // Skip entries that cannot be validated on load (eg. missing dependency file)
+        if (hash == 0)
+            return;
+    }
+    PROFILE_CPU();
+    const String sharedFilePath = GetSharedFilePath(entry.ID, entry.FileHash, entry.TypeName);
+    const String sharedMetaPath = sharedFilePath + TEXT(".meta");
+    if (FileSystem::FileExists(sharedFilePath) && FileSystem::FileExists(sharedMetaPath))
+        return;
+
+    // Write to the temporary files first to not expose partially written data to the other builds
+    String cachedFilePath;
+    GetFilePath(entry.ID, cachedFilePath);
+    const String tmpPath = sharedFilePath + TEXT(".") + Guid::New().ToString(Guid::FormatType::N);
+    if (FileSystem::CopyFile(tmpPath, cachedFilePath) || FileSystem::MoveFile(sharedFilePath, tmpPath, true))
+    {
+        LOG(Warning, "Failed to copy cooked file to shared cache '{0}'.", sharedFilePath);
+        FileSystem::DeleteFile(tmpPath);
+        return;
+    }
+    MemoryWriteStream stream(1024);
+    stream.WriteInt32(COOK_SHARED_CACHE_VERSION);
+    stream.WriteUint64(entry.FileHash);
+    stream.WriteString(entry.TypeName);
+    stream.WriteInt32(entry.FileDependencies.Count());
+    for (int32 i = 0; i < entry.FileDependencies.Count(); i++)
+    {
+        stream.WriteString(entry.FileDependencies[i].First, 10);
+        stream.WriteUint64(entry.FileDependenciesHashes[i]);
+    }
+    if (File::WriteAllBytes(tmpPath, stream.GetHandle(), (int32)stream.GetPosition()) || FileSystem::MoveFile(sharedMetaPath, tmpPath, true))
+    {
+        LOG(Warning, "Failed to write shared cache metadata '{0}'.", sharedMetaPath);
+        FileSystem::DeleteFile(tmpPath);
+    }
+}
+
 bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
 {
     const auto asBinaryAsset = dynamic_cast<BinaryAsset*>(options.Asset);
@@ -773,6 +1010,37 @@ bool ProcessTextureBase(CookAssetsStep::AssetCookData& data)
     return false;
 }
 
+bool ProcessSceneOrPrefab(CookAssetsStep::AssetCookData& data)
+{
+    if (!data.Cache.Settings.Global.BinaryScenes)
+        return CookAssetsStep::ProcessDefaultAsset(data);
+    const auto asset = static_cast<JsonAssetBase*>(data.Asset);
+
+    // Save json and convert it into the binary format
+    rapidjson_flax::StringBuffer buffer;
+    {
+        CompactJsonWriter writerObj(buffer);
+        asset->Save(writerObj);
+    }
+    rapidjson_flax::Document document;
+    document.Parse(buffer.GetString(), buffer.GetSize());
+    if (document.HasParseError())
+    {
+        LOG(Error, "Failed to convert {0} to binary format.", asset->ToString());
+        return true;
+    }
+    MemoryWriteStream stream(Math::Max((int32)buffer.GetSize() / 2, 1024));
+    JsonBinary::Write(document, stream);
+
+    // Store data in the first chunk (the same as json assets so it can be loaded by the JsonAssetBase)
+    auto chunk = New<FlaxChunk>();
+    chunk->Flags = FlaxChunkFlags::CompressedLZ4;
+    chunk->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    data.InitData.Header.Chunks[0] = chunk;
+
+    return false;
+}
+
 CookAssetsStep::CookAssetsStep()
     : AssetsRegistry(1024)
     , AssetPathsMapping(256)
@@ -783,6 +1051,8 @@ CookAssetsStep::CookAssetsStep()
     AssetProcessors.Add(Texture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(CubeTexture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(SpriteAtlas::TypeName, ProcessTextureBase);
+    AssetProcessors.Add(SceneAsset::TypeName, ProcessSceneOrPrefab);
+    AssetProcessors.Add(Prefab::TypeName, ProcessSceneOrPrefab);
 }
 
 bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* asset)
@@ -825,10 +1095,23 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* a
     if (assetProcessor(options))
         return true;
 
+    // Record the referenced assets to prefetch them when loading the cooked asset
+    Array<Guid> references;
+    Array<String> referencedFiles;
+    asset->GetReferences(references, referencedFiles);
+    for (const Guid& id : references)
+    {
+        if (data.Assets.Contains(id))
+            initData.Dependencies.Add(ToPair(id, DateTime::MinValue()));
+    }
+
     // Save cache
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
+    {
+        ScopeLock lock(cache.Locker);
+        auto& entry = cache.CreateEntry(asset, cachedFilePath);
+        entry.FileDependencies = MoveTemp(fileDependencies);
+    }
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
     // Cleanup allocated data chunks
@@ -871,8 +1154,11 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase*
 
     // Save cache
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
+    {
+        ScopeLock lock(cache.Locker);
+        auto& entry = cache.CreateEntry(asset, cachedFilePath);
+        entry.FileDependencies = MoveTemp(fileDependencies);
+    }
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
     // Cleanup allocated data chunks
@@ -896,6 +1182,7 @@ class PackageBuilder : public NonCopyable
     int32 MaxAssetsPerPackage;
     int32 MaxPackageSize;
     FlaxStorage::CustomData CustomData;
+    Array<String> CompressionDictionaryTypes;
 
     Array<FlaxFile*> files;
     Array<AssetsCache::Entry*> addedEntries;
@@ -910,10 +1197,12 @@ class PackageBuilder : public NonCopyable
     /// <param name="maxAssetsPerPackage">The maximum assets per package.</param>
     /// <param name="maxPackageSizeMB">The maximum package size in MB.</param>
     /// <param name="contentKey">The content keycode.</param>
-    PackageBuilder(int32 maxAssetsPerPackage, int32 maxPackageSizeMB, int32 contentKey)
+    /// <param name="compressionDictionaryTypes">The asset types to compress using dictionaries.</param>
+    PackageBuilder(int32 maxAssetsPerPackage, int32 maxPackageSizeMB, int32 contentKey, const Array<String>& compressionDictionaryTypes)
         : _packageIndex(0)
         , MaxAssetsPerPackage(maxAssetsPerPackage)
         , MaxPackageSize(maxPackageSizeMB * (1024 * 1024))
+        , CompressionDictionaryTypes(compressionDictionaryTypes)
         , files(maxAssetsPerPackage)
         , addedEntries(maxAssetsPerPackage)
         , bytesAdded(0)
@@ -1010,11 +1299,39 @@ class PackageBuilder : public NonCopyable
             }
         }
 
+        // Create compression dictionaries for the compressed chunks of the selected asset types
+        Array<FlaxChunk*> dictionaries;
+        for (const String& typeName : CompressionDictionaryTypes)
+        {
+            Array<FlaxChunk*> samples;
+            for (int32 i = 0; i < count; i++)
+            {
+                if (assetsData[i].Header.TypeName != typeName)
+                    continue;
+                for (const auto chunk : assetsData[i].Header.Chunks)
+                {
+                    if (chunk && EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+                        samples.Add(chunk);
+                }
+            }
+            FlaxChunk* dictionary = FlaxStorage::CreateDictionary(samples);
+            if (!dictionary)
+                continue;
+            dictionaries.Add(dictionary);
+            for (FlaxChunk* chunk : samples)
+            {
+                chunk->Flags |= FlaxChunkFlags::CompressedLZ4Dictionary;
+                chunk->Dictionary = dictionary;
+            }
+        }
+
         // Create package
         // Note: FlaxStorage::Create overrides chunks locations in file so don't use files anymore (only readonly)
         const String localPath = String::Format(TEXT("Content/Data_{0}.{1}"), _packageIndex, PACKAGE_FILES_EXTENSION);
         const String path = data.DataOutputPath / localPath;
-        if (FlaxStorage::Create(path, assetsData, false, &CustomData))
+        const bool failed = FlaxStorage::Create(path, assetsData, false, &CustomData);
+        dictionaries.ClearDelete();
+        if (failed)
         {
             data.Error(TEXT("Failed to create assets package."));
             return true;
@@ -1085,11 +1402,13 @@ bool CookAssetsStep::Perform(CookingData& data)
     {
         cache.Settings.Global.ShadersNoOptimize = buildSettings->ShadersNoOptimize;
         cache.Settings.Global.ShadersGenerateDebugData = buildSettings->ShadersGenerateDebugData;
+        cache.Settings.Global.BinaryScenes = buildSettings->BinaryScenes;
         cache.Settings.Global.StreamingSettingsAssetId = gameSettings->Streaming;
         cache.Settings.Global.ShadersVersion = GPU_SHADER_CACHE_VERSION;
         cache.Settings.Global.MaterialGraphVersion = MATERIAL_GRAPH_VERSION;
         cache.Settings.Global.ParticleGraphVersion = PARTICLE_GPU_GRAPH_VERSION;
     }
+    cache.InitShared(data);
 
     // Note: this step converts all the assets (even the json) into the binary files (FlaxStorage format).
     // Then files cooked files are packed into the packages.
@@ -1100,12 +1419,7 @@ bool CookAssetsStep::Perform(CookingData& data)
     auto minDateTime = DateTime::MinValue();
 #endif
     int32 subStepIndex = 0;
-    AssetReference<Asset> assetRef;
-    assetRef.Unload.Bind([]
-    {
-        LOG(Error, "Asset got unloaded while cooking it!");
-        Platform::Sleep(100);
-    });
+    Array<Guid> assetsToCook;
     for (auto i = data.Assets.Begin(); i.IsNotEnd(); ++i)
     {
         BUILD_STEP_CANCEL_CHECK;
@@ -1131,26 +1445,12 @@ bool CookAssetsStep::Perform(CookingData& data)
                 // Ensure that cached entry is valid
                 if (cachedEntry->TypeName == assetInfo.TypeName)
                 {
-                    // Check if file hasn't been modified
-                    if (FileSystem::GetFileLastEditTime(assetInfo.Path) <= cachedEntry->FileModified)
+                    // Check if file and all dependant files haven't been modified (contents are compared if file modification time has changed)
+                    if (CacheEntry::IsFileValid(assetInfo.Path, cachedEntry->FileModified, cachedEntry->FileHash) && cachedEntry->IsDependenciesValid())
                     {
-                        // Check all dependant files
-                        bool isValid = true;
-                        for (auto& f : cachedEntry->FileDependencies)
-                        {
-                            if (FileSystem::GetFileLastEditTime(f.First) > f.Second)
-                            {
-                                isValid = false;
-                                break;
-                            }
-                        }
-
-                        if (isValid)
-                        {
-                            // Cache hit!
-                            e.Info.TypeName = assetInfo.TypeName;
-                            continue;
-                        }
+                        // Cache hit!
+                        e.Info.TypeName = assetInfo.TypeName;
+                        continue;
                     }
                 }
                 else
@@ -1161,28 +1461,129 @@ bool CookAssetsStep::Perform(CookingData& data)
             }
         }
 
-        // Load asset (and keep ref)
-        assetRef = Content::LoadAsync<Asset>(assetId);
-        if (assetRef == nullptr)
+        // Check if asset has been already cooked by the other build from the same source data
+        if (cache.SharedCacheFolder.HasChars() && Content::GetAssetInfo(assetId, assetInfo) && cache.LoadShared(assetInfo))
         {
-            data.Error(TEXT("Failed to load asset included in build."));
-            return true;
+            e.Info.TypeName = assetInfo.TypeName;
+            continue;
         }
-        e.Info.TypeName = assetRef->GetTypeName();
 
-        // Cook asset
-        if (Process(data, cache, assetRef.Get()))
+        assetsToCook.Add(assetId);
+    }
+
+    // Cook modified assets in parallel (in batches to limit the memory used by the loaded assets and the cooked data)
+    const int32 batchSize = Math::Clamp(JobSystem::GetThreadsCount(), 1, COOK_ASSETS_BATCH_SIZE);
+    Array<AssetReference<Asset>> assetRefs;
+    assetRefs.Resize(batchSize);
+    for (auto& assetRef : assetRefs)
+    {
+        assetRef.Unload.Bind([]
+        {
+            LOG(Error, "Asset got unloaded while cooking it!");
+            Platform::Sleep(100);
+        });
+    }
+    Array<double> cookTimes;
+    cookTimes.Resize(assetsToCook.Count());
+    for (int32 batchStart = 0; batchStart < assetsToCook.Count(); batchStart += batchSize)
+    {
+        BUILD_STEP_CANCEL_CHECK;
+        data.StepProgress(Step1Info, Math::Lerp(Step1ProgressStart, Step1ProgressEnd, static_cast<float>(batchStart) / assetsToCook.Count()));
+        const int32 batchCount = Math::Min(batchSize, assetsToCook.Count() - batchStart);
+
+        // Load assets (and keep refs)
+        for (int32 i = 0; i < batchCount; i++)
+        {
+            const Guid& assetId = assetsToCook[batchStart + i];
+            auto& assetRef = assetRefs[i];
+            assetRef = Content::LoadAsync<Asset>(assetId);
+            if (assetRef == nullptr)
+            {
+                data.Error(TEXT("Failed to load asset included in build."));
+                cache.Save(data);
+                return true;
+            }
+            AssetsRegistry[assetId].Info.TypeName = assetRef->GetTypeName();
+        }
+
+        // Cook assets
+        int64 failed = 0;
+        Function<void(int32)> job = [&](int32 i)
+        {
+            Asset* asset = assetRefs[i].Get();
+            const double startTime = Platform::GetTimeSeconds();
+            if (Process(data, cache, asset))
+            {
+                Platform::InterlockedIncrement(&failed);
+                return;
+            }
+
+            // Store the source files contents hashes to detect unmodified files in the next builds
+            CacheEntry entry;
+            {
+                ScopeLock lock(cache.Locker);
+                const auto cookedEntry = cache.Entries.TryGet(asset->GetID());
+                if (cookedEntry)
+                    entry = *cookedEntry;
+            }
+            if (entry.ID.IsValid())
+            {
+                entry.UpdateHashes(asset->GetPath());
+                cache.SaveShared(entry);
+                ScopeLock lock(cache.Locker);
+                const auto cookedEntry = cache.Entries.TryGet(asset->GetID());
+                if (cookedEntry)
+                {
+                    cookedEntry->FileHash = entry.FileHash;
+                    cookedEntry->FileDependenciesHashes = MoveTemp(entry.FileDependenciesHashes);
+                }
+            }
+            cookTimes[batchStart + i] = Platform::GetTimeSeconds() - startTime;
+        };
+        JobSystem::Execute(job, batchCount);
+        for (auto& assetRef : assetRefs)
+            assetRef = nullptr;
+        if (failed != 0)
         {
             cache.Save(data);
             return true;
         }
-        data.Stats.CookedAssets++;
 
         // Auto save build cache after every few cooked assets (reduces next build time if cooking fails later)
-        if (data.Stats.CookedAssets % 50 == 0)
+        if (data.Stats.CookedAssets / 50 != (data.Stats.CookedAssets + batchCount) / 50)
         {
             cache.Save(data);
         }
+        data.Stats.CookedAssets += batchCount;
+    }
+
+    // Print the per-asset cooking time report
+    if (assetsToCook.HasItems())
+    {
+        struct AssetCookTime
+        {
+            Guid ID;
+            double Time;
+
+            bool operator<(const AssetCookTime& other) const
+            {
+                return Time > other.Time;
+            }
+        };
+        Array<AssetCookTime> times;
+        times.Resize(assetsToCook.Count());
+        for (int32 i = 0; i < assetsToCook.Count(); i++)
+        {
+            times[i] = { assetsToCook[i], cookTimes[i] };
+            data.Stats.AssetStats[AssetsRegistry[assetsToCook[i]].Info.TypeName].CookTime += cookTimes[i];
+        }
+        Sorting::QuickSort(times);
+        LOG(Info, "Slowest cooked assets:");
+        for (int32 i = 0; i < 10 && i < times.Count(); i++)
+        {
+            const auto& e = times[i];
+            LOG(Info, "{0:>6} ms: {1}", (int32)(e.Time * 1000.0), Content::GetAssetInfo(e.ID, assetInfo) ? assetInfo.Path : e.ID.ToString());
+        }
     }
 
     // Save build cache header
@@ -1256,14 +1657,49 @@ bool CookAssetsStep::Perform(CookingData& data)
 
     // Package all registered assets into packages
     {
-        PackageBuilder packageBuilder(buildSettings->MaxAssetsPerPackage, buildSettings->MaxPackageSizeMB, contentKey);
+        PackageBuilder packageBuilder(buildSettings->MaxAssetsPerPackage, buildSettings->MaxPackageSizeMB, contentKey, buildSettings->CompressionDictionaryTypes);
+
+        // Sort assets by the recorded first-use order (assets used together are placed next to each other in the packages)
+        Array<Guid> assetsOrder;
+        assetsOrder.EnsureCapacity(AssetsRegistry.Count());
+        if (buildSettings->LoadOrderFile.HasChars())
+        {
+            const String path = FileSystem::ConvertRelativePathToAbsolute(Globals::ProjectFolder, buildSettings->LoadOrderFile);
+            Array<Guid> loadOrder;
+            if (ContentLoadOrder::Load(path, loadOrder))
+            {
+                LOG(Warning, "Failed to load content load order file {0}", path);
+            }
+            for (const Guid& id : loadOrder)
+            {
+                if (AssetsRegistry.ContainsKey(id))
+                    assetsOrder.Add(id);
+            }
+            LOG(Info, "Using recorded load order for {0} assets", assetsOrder.Count());
+        }
+        if (assetsOrder.HasItems())
+        {
+            HashSet<Guid> ordered;
+            ordered.EnsureCapacity(assetsOrder.Count());
+            for (const Guid& id : assetsOrder)
+                ordered.Add(id);
+            for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+            {
+                if (!ordered.Contains(i->Key))
+                    assetsOrder.Add(i->Key);
+            }
+        }
+        else
+        {
+            AssetsRegistry.GetKeys(assetsOrder);
+        }
 
         subStepIndex = 0;
-        for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+        for (const Guid& assetId : assetsOrder)
         {
             BUILD_STEP_CANCEL_CHECK;
             data.StepProgress(Step3Info, Math::Lerp(Step3ProgressStart, Step3ProgressEnd, (float)subStepIndex++ / AssetsRegistry.Count()));
-            const auto assetId = i->Key;
+            auto& entry = AssetsRegistry[assetId];
 
             String cookedFilePath;
             cache.GetFilePath(assetId, cookedFilePath);
@@ -1273,11 +1709,11 @@ bool CookAssetsStep::Perform(CookingData& data)
                 continue;
             }
 
-            auto& assetStats = data.Stats.AssetStats[i->Value.Info.TypeName];
+            auto& assetStats = data.Stats.AssetStats[entry.Info.TypeName];
             assetStats.Count++;
             assetStats.ContentSize += FileSystem::GetFileSize(cookedFilePath);
 
-            if (packageBuilder.Add(data, i->Value, cookedFilePath))
+            if (packageBuilder.Add(data, entry, cookedFilePath))
                 return true;
         }
         if (packageBuilder.Package(data))
@@ -1348,7 +1784,7 @@ bool CookAssetsStep::Perform(CookingData& data)
             {
                 typeName = e.TypeName;
             }
-            LOG(Info, "{0}: {1:>4} assets of total size {2}", typeName, e.Count, Utilities::BytesToText(e.ContentSize));
+            LOG(Info, "{0}: {1:>4} assets of total size {2}, cooking time {3} ms", typeName, e.Count, Utilities::BytesToText(e.ContentSize), (int32)(e.CookTime * 1000.0));
         }
         LOG(Info, "");
     }
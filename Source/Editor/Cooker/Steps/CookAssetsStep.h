@@ -7,6 +7,7 @@
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Content/AssetInfo.h"
 #include "Engine/Content/Cache/AssetsCache.h"
 
@@ -51,7 +52,45 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// </summary>
         FileDependenciesList FileDependencies;
 
+        /// <summary>
+        /// The asset file contents hash. Used to keep the entry valid when only the file modification time has changed (eg. after source control checkout). Zero if unknown.
+        /// </summary>
+        uint64 FileHash = 0;
+
+        /// <summary>
+        /// The contents hashes of the files from the FileDependencies list (in the same order). Zero if unknown.
+        /// </summary>
+        Array<uint64> FileDependenciesHashes;
+
         bool IsValid(bool withDependencies = false);
+
+        /// <summary>
+        /// Checks if all files on which this entry depends on are unmodified.
+        /// </summary>
+        /// <returns>True if dependencies are valid, otherwise false.</returns>
+        bool IsDependenciesValid();
+
+        /// <summary>
+        /// Updates the contents hashes of the asset file and all of its dependencies.
+        /// </summary>
+        /// <param name="path">The asset file path.</param>
+        void UpdateHashes(const StringView& path);
+
+        /// <summary>
+        /// Calculates the hash of the file contents.
+        /// </summary>
+        /// <param name="path">The file path.</param>
+        /// <returns>The hash value or 0 if file cannot be read.</returns>
+        static uint64 GetFileHash(const StringView& path);
+
+        /// <summary>
+        /// Checks if the file is unmodified. Compares the file contents hash if the modification time is newer than the cached one (and updates the cached time on match).
+        /// </summary>
+        /// <param name="path">The file path.</param>
+        /// <param name="modified">The cached file modification time.</param>
+        /// <param name="hash">The cached file contents hash (0 if unknown).</param>
+        /// <returns>True if file is unmodified, otherwise false.</returns>
+        static bool IsFileValid(const StringView& path, DateTime& modified, uint64 hash);
     };
 
     /// <summary>
@@ -69,6 +108,16 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// </summary>
         String CacheFolder;
 
+        /// <summary>
+        /// The shared cooked files folder (eg. on the network drive used by the build machines). Empty if not used.
+        /// </summary>
+        String SharedCacheFolder;
+
+        /// <summary>
+        /// The hash of the build options used to key the entries in the shared cache.
+        /// </summary>
+        uint32 SharedCacheSeed = 0;
+
         /// <summary>
         /// The build options used to cook assets. Changing some options in game settings might trigger cached assets invalidation.
         /// </summary>
@@ -97,6 +146,7 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
             {
                 bool ShadersNoOptimize;
                 bool ShadersGenerateDebugData;
+                bool BinaryScenes;
                 Guid StreamingSettingsAssetId;
                 int32 ShadersVersion;
                 int32 MaterialGraphVersion;
@@ -109,6 +159,11 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// </summary>
         Dictionary<Guid, CacheEntry> Entries;
 
+        /// <summary>
+        /// The entries access locker. Assets are cooked in parallel, so it has to be taken when modifying the entries during cooking.
+        /// </summary>
+        CriticalSection Locker;
+
     public:
 
         /// <summary>
@@ -149,6 +204,34 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// <param name="data">The data.</param>
         void Save(CookingData& data);
 
+        /// <summary>
+        /// Initializes the shared cache. Has to be called after updating the build options.
+        /// </summary>
+        /// <param name="data">The data.</param>
+        void InitShared(CookingData& data);
+
+        /// <summary>
+        /// Tries to get the cooked asset file from the shared cache. Adds the new entry on success.
+        /// </summary>
+        /// <param name="info">The asset info.</param>
+        /// <returns>True if asset has been restored from the shared cache, otherwise false.</returns>
+        bool LoadShared(const AssetInfo& info);
+
+        /// <summary>
+        /// Uploads the cooked asset file to the shared cache.
+        /// </summary>
+        /// <param name="entry">The cooked entry (with updated hashes).</param>
+        void SaveShared(const CacheEntry& entry);
+
+        /// <summary>
+        /// Gets the path to the cooked asset file in the shared cache (metadata file uses the same path with .meta extension).
+        /// </summary>
+        /// <param name="id">The asset id.</param>
+        /// <param name="fileHash">The asset file contents hash.</param>
+        /// <param name="typeName">The asset typename.</param>
+        /// <returns>The shared file path.</returns>
+        String GetSharedFilePath(const Guid& id, uint64 fileHash, const StringView& typeName) const;
+
         using IBuildCache::InvalidateCachePerType;
         void InvalidateCachePerType(const StringView& typeName) override;
     };
@@ -367,6 +367,12 @@ bool DeployDataStep::Perform(CookingData& data)
     data.AddRootEngineAsset(TEXT("Shaders/PostProcessing"));
     data.AddRootEngineAsset(TEXT("Shaders/MotionBlur"));
     data.AddRootEngineAsset(TEXT("Shaders/BitonicSort"));
+    data.AddRootEngineAsset(TEXT("Shaders/ComputeSkinning"));
+    data.AddRootEngineAsset(TEXT("Shaders/InstanceCulling"));
+    data.AddRootEngineAsset(TEXT("Shaders/ObjectTable"));
+    data.AddRootEngineAsset(TEXT("Shaders/OcclusionCulling"));
+    data.AddRootEngineAsset(TEXT("Shaders/ShadingRate"));
+    data.AddRootEngineAsset(TEXT("Shaders/LightClusters"));
     data.AddRootEngineAsset(TEXT("Shaders/GPUParticlesSorting"));
     data.AddRootEngineAsset(TEXT("Shaders/GlobalSignDistanceField"));
     data.AddRootEngineAsset(TEXT("Shaders/GI/GlobalSurfaceAtlas"));
@@ -431,5 +437,16 @@ bool DeployDataStep::Perform(CookingData& data)
         files.Clear();
     }
 
+    // Deploy recorded materials usage (used to pre-warm materials pipeline states)
+    if (buildSettings.MaterialsUsageFile.HasChars())
+    {
+        const String path = FileSystem::ConvertRelativePathToAbsolute(Globals::ProjectFolder, buildSettings.MaterialsUsageFile);
+        if (FileSystem::CopyFile(contentDir / TEXT("MaterialsUsage.bin"), path))
+        {
+            data.Error(String::Format(TEXT("Failed to deploy materials usage file {0}."), path));
+            return true;
+        }
+    }
+
     return false;
 }
@@ -49,7 +49,8 @@ static Editor()
         }
 
         private readonly List<EditorModule> _modules = new List<EditorModule>(16);
-        private bool _isAfterInit, _areModulesInited, _areModulesAfterInitEnd, _isHeadlessMode, _autoExit;
+        private bool _isAfterInit, _areModulesInited, _areModulesAfterInitEnd, _isHeadlessMode, _autoExit, _autoBakeLightmaps;
+        private int _autoExitCode;
         private string _projectToOpen;
         private float _lastAutoSaveTimer, _autoExitTimeout = 0.1f;
         private Button _saveNowButton;
@@ -263,6 +264,7 @@ internal void Init(StartupFlags flags, Guid startupScene)
             Log("Setting up C# Editor...");
             _isHeadlessMode = flags.HasFlag(StartupFlags.Headless);
             _autoExit = flags.HasFlag(StartupFlags.Exit);
+            _autoBakeLightmaps = flags.HasFlag(StartupFlags.BakeLightmaps);
             _startupSceneCmdLine = startupScene;
 
             Profiler.BeginEvent("Projects");
@@ -487,13 +489,30 @@ internal void Update()
             {
                 StateMachine.Update();
                 UpdateAutoSave();
-                if (_autoExit && StateMachine.CurrentState == StateMachine.EditingSceneState)
+                if (_autoBakeLightmaps && _areModulesAfterInitEnd && StateMachine.CurrentState == StateMachine.EditingSceneState && !Level.IsAnyActionPending)
+                {
+                    // Bake lightmaps requested from the command line
+                    _autoBakeLightmaps = false;
+                    _autoExit = true;
+                    if (Level.IsAnySceneLoaded)
+                    {
+                        Log("Baking lightmaps (command line)");
+                        LightmapsBakeEnd += OnAutoBakeLightmapsEnd;
+                        StateMachine.GoToState<BuildingLightingState>();
+                    }
+                    else
+                    {
+                        LogError("No scene loaded to bake lightmaps.");
+                        _autoExitCode = 1;
+                    }
+                }
+                if (_autoExit && StateMachine.CurrentState == StateMachine.EditingSceneState && !Level.IsAnyActionPending)
                 {
                     _autoExitTimeout -= Time.UnscaledGameTime;
                     if (_autoExitTimeout < 0.0f)
                     {
                         Log("Auto exit");
-                        Engine.RequestExit(0);
+                        Engine.RequestExit(_autoExitCode);
                     }
                 }
 
@@ -1251,6 +1270,19 @@ public enum LightmapsBakeSteps
         /// </summary>
         public static event LightmapsBakeProgressDelegate LightmapsBakeProgress;
 
+        private void OnAutoBakeLightmapsEnd(bool failed)
+        {
+            LightmapsBakeEnd -= OnAutoBakeLightmapsEnd;
+            if (failed)
+            {
+                LogError("Lightmaps baking failed.");
+                _autoExitCode = 1;
+                return;
+            }
+            Log("Lightmaps baked, saving scenes");
+            Scene.SaveScenes();
+        }
+
         internal void Internal_StartLightingBake()
         {
             StateMachine.GoToState<BuildingLightingState>();
@@ -202,12 +202,19 @@ void ManagedEditor::Init()
         flags |= StartupFlags::NewProject;
     if (CommandLine::Options.Exit.IsTrue())
         flags |= StartupFlags::Exit;
+    if (CommandLine::Options.BakeLightmaps.HasValue())
+        flags |= StartupFlags::BakeLightmaps;
     args[0] = &flags;
     Guid sceneId;
     if (!CommandLine::Options.Play.HasValue() || (CommandLine::Options.Play.HasValue() && Guid::Parse(CommandLine::Options.Play.GetValue(), sceneId)))
     {
         sceneId = Guid::Empty;
     }
+    if (!sceneId.IsValid() && CommandLine::Options.BakeLightmaps.HasValue() && CommandLine::Options.BakeLightmaps.GetValue().HasChars() && Guid::Parse(CommandLine::Options.BakeLightmaps.GetValue(), sceneId))
+    {
+        LOG(Warning, "Invalid lightmaps baking scene ID '{0}'", CommandLine::Options.BakeLightmaps.GetValue());
+        sceneId = Guid::Empty;
+    }
     args[1] = &sceneId;
     initMethod->Invoke(instance, args, &exception);
     if (exception)
@@ -29,6 +29,7 @@ API_CLASS(Namespace="FlaxEditor", Name="Editor", NoSpawn, NoConstructor) class M
         SkipCompile = 2,
         NewProject = 4,
         Exit = 8,
+        BakeLightmaps = 16,
     };
 
     struct InternalOptions
@@ -1038,9 +1038,16 @@ private void LoadScripts(ContentTreeNode parent, string[] files)
 
         private void LoadAssets(ContentTreeNode parent, string[] files)
         {
+            // Read assets info of all files in parallel (registered in the assets cache so lookups below are fast)
+            var paths = new string[files.Length];
             for (int i = 0; i < files.Length; i++)
+                paths[i] = StringUtils.NormalizePath(files[i]);
+            if (paths.Length > 1)
+                FlaxEngine.Content.PrefetchAssetsInfo(paths);
+
+            for (int i = 0; i < paths.Length; i++)
             {
-                var path = StringUtils.NormalizePath(files[i]);
+                var path = paths[i];
 
                 // Check if node already has that element (skip during init when we want to walk project dir very fast)
                 if (_isDuringFastSetup || !parent.Folder.ContainsChild(path))
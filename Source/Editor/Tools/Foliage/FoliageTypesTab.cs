@@ -127,6 +127,13 @@ public float CullDistanceRandomRange
                 }
             }
 
+            [EditorOrder(115), EditorDisplay("Instance Options"), Limit(0.0f), Tooltip("The distance from the view at which the instances get drawn as impostors (octahedral billboards baked from the model). Value 0 disables impostors.")]
+            public float ImpostorDistance
+            {
+                get => _type.ImpostorDistance;
+                set => _type.ImpostorDistance = value;
+            }
+
             [EditorOrder(120), DefaultValue(DrawPass.Default), EditorDisplay("Instance Options"), Tooltip("The draw passes to use for rendering this foliage type.")]
             public DrawPass DrawModes
             {
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 using System;
+using System.Text;
 using FlaxEngine.GUI;
 
 namespace FlaxEditor.Windows.Profiler
@@ -13,6 +14,8 @@ internal sealed class Memory : ProfilerMode
     {
         private readonly SingleChart _nativeAllocationsChart;
         private readonly SingleChart _managedAllocationsChart;
+        private readonly Label _memoryGroupsLabel;
+        private readonly StringBuilder _memoryGroupsText = new StringBuilder();
 
         public Memory()
         : base("Memory")
@@ -47,6 +50,15 @@ public Memory()
                 Parent = layout,
             };
             _managedAllocationsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+
+            // Memory groups
+            _memoryGroupsLabel = new Label
+            {
+                AutoHeight = true,
+                HorizontalAlignment = TextAlignment.Near,
+                Margin = new Margin(4),
+                Parent = layout,
+            };
         }
 
         /// <inheritdoc />
@@ -81,6 +93,23 @@ public override void Update(ref SharedUpdateData sharedData)
 
             _nativeAllocationsChart.AddSample(nativeMemoryAllocation);
             _managedAllocationsChart.AddSample(managedMemoryAllocation);
+
+            // Native memory usage per group (tracked only when running with '-mem' command line switch)
+            var memoryGroups = ProfilingTools.MemoryGroups;
+            _memoryGroupsText.Clear();
+            if (memoryGroups != null && memoryGroups.Length != 0)
+            {
+                for (int i = 0; i < memoryGroups.Length; i++)
+                {
+                    ref var group = ref memoryGroups[i];
+                    _memoryGroupsText.AppendLine($"{group.Name}: {Utilities.Utils.FormatBytesCount((ulong)group.Size)} (peak: {Utilities.Utils.FormatBytesCount((ulong)group.Peak)}, allocations: {group.Count})");
+                }
+            }
+            else
+            {
+                _memoryGroupsText.Append("Native memory groups tracking is disabled (use '-mem' command line switch to enable it).");
+            }
+            _memoryGroupsLabel.Text = _memoryGroupsText.ToString();
         }
 
         /// <inheritdoc />
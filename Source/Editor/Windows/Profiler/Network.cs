@@ -40,6 +40,8 @@ internal sealed class Network : ProfilerMode
         private readonly SingleChart _dataReceivedChart;
         private readonly SingleChart _dataSentRateChart;
         private readonly SingleChart _dataReceivedRateChart;
+        private readonly SingleChart _deltaRateChart;
+        private readonly SingleChart _deferredChart;
         private readonly Table _tableRpc;
         private readonly Table _tableRep;
         private List<Row> _tableRowsCache;
@@ -94,6 +96,20 @@ public Network()
                 Parent = layout,
             };
             _dataReceivedRateChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _deltaRateChart = new SingleChart
+            {
+                Title = "Delta Replication Rate",
+                FormatSample = v => Mathf.RoundToInt(v * 100.0f) + "%",
+                Parent = layout,
+            };
+            _deltaRateChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _deferredChart = new SingleChart
+            {
+                Title = "Deferred Objects",
+                FormatSample = v => ((int)v).ToString(),
+                Parent = layout,
+            };
+            _deferredChart.SelectedSampleChanged += OnSelectedSampleChanged;
 
             // Tables
             _tableRpc = InitTable(layout, "RPC Name");
@@ -107,6 +123,8 @@ public override void Clear()
             _dataReceivedChart.Clear();
             _dataSentRateChart.Clear();
             _dataReceivedRateChart.Clear();
+            _deltaRateChart.Clear();
+            _deferredChart.Clear();
             _events?.Clear();
             _stats?.Clear();
             _prevStats = new NetworkDriverStats();
@@ -151,6 +169,12 @@ public override void Update(ref SharedUpdateData sharedData)
             _dataSentRateChart.AddSample(avgStats.TotalDataSent);
             _dataReceivedRateChart.AddSample(avgStats.TotalDataReceived);
 
+            // Gather replication stats (from the last network update)
+            var replicationStats = NetworkReplicator.GetStats();
+            var replicatedObjects = replicationStats.ObjectsSent + replicationStats.ObjectsSkipped;
+            _deltaRateChart.AddSample(replicatedObjects != 0 ? (float)(replicationStats.ObjectsDelta + replicationStats.ObjectsSkipped) / replicatedObjects : 0.0f);
+            _deferredChart.AddSample(replicationStats.ObjectsDeferred);
+
             // Gather network events
             var events = ProfilingTools.EventsNetwork;
             if (_events == null)
@@ -165,6 +189,8 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
             _dataReceivedChart.SelectedSampleIndex = selectedFrame;
             _dataSentRateChart.SelectedSampleIndex = selectedFrame;
             _dataReceivedRateChart.SelectedSampleIndex = selectedFrame;
+            _deltaRateChart.SelectedSampleIndex = selectedFrame;
+            _deferredChart.SelectedSampleIndex = selectedFrame;
 
             // Update events tables
             if (_events != null)
@@ -198,7 +224,7 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
                         {
                             row = new Row
                             {
-                                Values = new object[5],
+                                Values = new object[10],
                             };
                         }
                         {
@@ -215,7 +241,22 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
                             row.Values[3] = (int)e.MessageSize;
 
                             // Receivers
-                            row.Values[4] = (float)e.Receivers / (float)e.Count;
+                            row.Values[4] = e.Count != 0 ? (float)e.Receivers / (float)e.Count : 0.0f;
+
+                            // Delta
+                            row.Values[5] = (int)e.Delta;
+
+                            // Skipped
+                            row.Values[6] = (int)e.Skipped;
+
+                            // Deferred
+                            row.Values[7] = (int)e.Deferred;
+
+                            // Received Count
+                            row.Values[8] = (int)e.ReceivedCount;
+
+                            // Received Data Size
+                            row.Values[9] = (int)e.ReceivedDataSize;
                         }
 
                         var table = isRpc ? _tableRpc : _tableRep;
@@ -292,14 +333,50 @@ private static Table InitTable(ContainerControl parent, string name)
                         TitleBackgroundColor = headerColor,
                         TitleColor = textColor,
                     },
+                    new ColumnDefinition
+                    {
+                        Title = "Delta",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Skipped",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Deferred",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Received",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Received Size",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCellBytes,
+                    },
                 },
                 Splits = new[]
                 {
-                    0.40f,
-                    0.15f,
-                    0.15f,
-                    0.15f,
-                    0.15f,
+                    0.28f,
+                    0.08f,
+                    0.08f,
+                    0.08f,
+                    0.08f,
+                    0.08f,
+                    0.08f,
+                    0.08f,
+                    0.08f,
+                    0.08f,
                 },
                 Parent = parent,
             };
@@ -17,6 +17,8 @@ internal sealed class Physics : ProfilerMode
         private readonly SingleChart _staticBodiesChart;
         private readonly SingleChart _newPairsChart;
         private readonly SingleChart _newTouchesChart;
+        private readonly SingleChart _simulationTimeChart;
+        private readonly SingleChart _collectTimeChart;
 
         public Physics()
         : base("Physics")
@@ -73,6 +75,20 @@ public Physics()
                 Parent = layout,
             };
             _newTouchesChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _simulationTimeChart = new SingleChart
+            {
+                Title = "Simulation Time (slowest scene)",
+                FormatSample = v => (Mathf.RoundToInt(v * 10.0f) / 10.0f) + " ms",
+                Parent = layout,
+            };
+            _simulationTimeChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _collectTimeChart = new SingleChart
+            {
+                Title = "Collect Results Time (all scenes)",
+                FormatSample = v => (Mathf.RoundToInt(v * 10.0f) / 10.0f) + " ms",
+                Parent = layout,
+            };
+            _collectTimeChart.SelectedSampleChanged += OnSelectedSampleChanged;
         }
 
         /// <inheritdoc />
@@ -84,6 +100,8 @@ public override void Clear()
             _staticBodiesChart.Clear();
             _newPairsChart.Clear();
             _newTouchesChart.Clear();
+            _simulationTimeChart.Clear();
+            _collectTimeChart.Clear();
         }
 
         /// <inheritdoc />
@@ -97,6 +115,17 @@ public override void Update(ref SharedUpdateData sharedData)
             _staticBodiesChart.AddSample(statistics.StaticBodies);
             _newPairsChart.AddSample(statistics.NewPairs);
             _newTouchesChart.AddSample(statistics.NewTouches);
+
+            // Scenes are simulated concurrently so show the slowest one and the total time spent on collecting results
+            float simulationTime = 0.0f, collectTime = 0.0f;
+            foreach (var scene in FlaxEngine.Physics.Scenes)
+            {
+                var sceneStatistics = scene.Statistics;
+                simulationTime = Mathf.Max(simulationTime, sceneStatistics.SimulationTime);
+                collectTime += sceneStatistics.CollectTime;
+            }
+            _simulationTimeChart.AddSample(simulationTime);
+            _collectTimeChart.AddSample(collectTime);
         }
 
         /// <inheritdoc />
@@ -108,6 +137,8 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
             _staticBodiesChart.SelectedSampleIndex = selectedFrame;
             _newPairsChart.SelectedSampleIndex = selectedFrame;
             _newTouchesChart.SelectedSampleIndex = selectedFrame;
+            _simulationTimeChart.SelectedSampleIndex = selectedFrame;
+            _collectTimeChart.SelectedSampleIndex = selectedFrame;
         }
     }
 }
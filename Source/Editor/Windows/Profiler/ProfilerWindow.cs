@@ -213,6 +213,7 @@ public override void OnInit()
             AddMode(new Assets());
             AddMode(new Network());
             AddMode(new Physics());
+            AddMode(new Streaming());
 
             // Init view
             _frameIndex = -1;
@@ -0,0 +1,136 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System.Text;
+using FlaxEngine;
+using FlaxEngine.GUI;
+
+namespace FlaxEditor.Windows.Profiler
+{
+    /// <summary>
+    /// The content streaming profiling mode.
+    /// </summary>
+    /// <seealso cref="FlaxEditor.Windows.Profiler.ProfilerMode" />
+    internal sealed class Streaming : ProfilerMode
+    {
+        private readonly SingleChart _memoryUsageChart;
+        private readonly SingleChart _streamedBytesChart;
+        private readonly SingleChart _streamingResourcesChart;
+        private readonly SingleChart _evictionsChart;
+        private readonly Label _groupsLabel;
+        private readonly StringBuilder _groupsText = new StringBuilder();
+
+        public Streaming()
+        : base("Streaming")
+        {
+            // Layout
+            var panel = new Panel(ScrollBars.Vertical)
+            {
+                AnchorPreset = AnchorPresets.StretchAll,
+                Offsets = Margin.Zero,
+                Parent = this,
+            };
+            var layout = new VerticalPanel
+            {
+                AnchorPreset = AnchorPresets.HorizontalStretchTop,
+                Offsets = Margin.Zero,
+                IsScrollable = true,
+                Parent = panel,
+            };
+
+            // Charts
+            _memoryUsageChart = new SingleChart
+            {
+                Title = "Streamed Memory",
+                FormatSample = v => Utilities.Utils.FormatBytesCount((ulong)v),
+                Parent = layout,
+            };
+            _memoryUsageChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _streamedBytesChart = new SingleChart
+            {
+                Title = "Streamed In Per Second",
+                FormatSample = v => Utilities.Utils.FormatBytesCount((ulong)v),
+                Parent = layout,
+            };
+            _streamedBytesChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _streamingResourcesChart = new SingleChart
+            {
+                Title = "Streaming Resources",
+                Parent = layout,
+            };
+            _streamingResourcesChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _evictionsChart = new SingleChart
+            {
+                Title = "Evictions Per Second",
+                Parent = layout,
+            };
+            _evictionsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+
+            // Streaming groups
+            _groupsLabel = new Label
+            {
+                AutoHeight = true,
+                HorizontalAlignment = TextAlignment.Near,
+                Margin = new Margin(4),
+                Parent = layout,
+            };
+        }
+
+        /// <inheritdoc />
+        public override void Clear()
+        {
+            _memoryUsageChart.Clear();
+            _streamedBytesChart.Clear();
+            _streamingResourcesChart.Clear();
+            _evictionsChart.Clear();
+        }
+
+        /// <inheritdoc />
+        public override void Update(ref SharedUpdateData sharedData)
+        {
+            var stats = ProfilingTools.ContentStreaming;
+            ulong streamedBytes = 0;
+            int evictions = 0;
+            _groupsText.Clear();
+            _groupsText.AppendLine($"Resources: {stats.ResourcesCount}, streaming: {stats.StreamingResourcesCount}, limited by budget: {stats.BudgetLimitedResourcesCount}, quality scale: {stats.QualityScale:0.00}");
+            if (stats.Groups != null)
+            {
+                for (int i = 0; i < stats.Groups.Length; i++)
+                {
+                    ref var group = ref stats.Groups[i];
+                    streamedBytes += group.StreamedBytesPerSecond;
+                    evictions += group.EvictionsPerSecond;
+                    AppendGroup(ref group);
+                }
+            }
+            if (stats.TextureGroups != null && stats.TextureGroups.Length != 0)
+            {
+                _groupsText.AppendLine();
+                _groupsText.AppendLine("Texture Groups:");
+                for (int i = 0; i < stats.TextureGroups.Length; i++)
+                    AppendGroup(ref stats.TextureGroups[i]);
+            }
+            _groupsLabel.Text = _groupsText.ToString();
+
+            _memoryUsageChart.AddSample(stats.MemoryUsage);
+            _streamedBytesChart.AddSample(streamedBytes);
+            _streamingResourcesChart.AddSample(stats.StreamingResourcesCount);
+            _evictionsChart.AddSample(evictions);
+        }
+
+        private void AppendGroup(ref StreamingGroupStats group)
+        {
+            if (group.ResourcesCount == 0)
+                return;
+            _groupsText.AppendLine($"{group.Name}: {group.ResourcesCount} resources, resident: {Utilities.Utils.FormatBytesCount(group.ResidentMemory)}, target: {Utilities.Utils.FormatBytesCount(group.TargetMemory)}, in flight: {group.StreamingTasksCount}, streamed: {Utilities.Utils.FormatBytesCount(group.StreamedBytesPerSecond)}/s, evictions: {group.EvictionsPerSecond}/s");
+        }
+
+        /// <inheritdoc />
+        public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents)
+        {
+            _memoryUsageChart.SelectedSampleIndex = selectedFrame;
+            _streamedBytesChart.SelectedSampleIndex = selectedFrame;
+            _streamingResourcesChart.SelectedSampleIndex = selectedFrame;
+            _evictionsChart.SelectedSampleIndex = selectedFrame;
+        }
+    }
+}
@@ -21,7 +21,7 @@ class BehaviorSystem : public TaskGraphSystem
 class BehaviorService : public EngineService
 {
 public:
-    Array<Behavior*> UpdateList;
+    HandlePool<Behavior*> UpdateList;
 
     BehaviorService()
         : EngineService(TEXT("Behaviors"), 0)
@@ -47,7 +47,7 @@ void BehaviorSystem::Execute(TaskGraph* graph)
     if (BehaviorServiceInstance.UpdateList.Count() == 0)
         return;
     Behaviors.Clear();
-    Behaviors.Add(BehaviorServiceInstance.UpdateList);
+    Behaviors.Add(BehaviorServiceInstance.UpdateList.GetItems());
 
     // Schedule work to update all behaviors in async
     Function<void(int32)> job;
@@ -64,7 +64,7 @@ bool BehaviorService::Init()
 
 void BehaviorService::Dispose()
 {
-    BehaviorServiceInstance.UpdateList.Resize(0);
+    BehaviorServiceInstance.UpdateList.Clear();
     SAFE_DELETE(Behavior::System);
 }
 
@@ -162,14 +162,14 @@ void Behavior::ResetLogic()
 
 void Behavior::OnEnable()
 {
-    BehaviorServiceInstance.UpdateList.Add(this);
+    _updateHandle = BehaviorServiceInstance.UpdateList.Add(this);
     if (AutoStart)
         StartLogic();
 }
 
 void Behavior::OnDisable()
 {
-    BehaviorServiceInstance.UpdateList.Remove(this);
+    BehaviorServiceInstance.UpdateList.RemoveAndReset(_updateHandle);
 }
 
 #if USE_EDITOR
@@ -7,6 +7,7 @@
 #include "BehaviorTypes.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Content/AssetReference.h"
+#include "Engine/Core/Collections/HandlePool.h"
 
 /// <summary>
 /// Behavior instance script that runs Behavior Tree execution.
@@ -27,6 +28,7 @@ API_CLASS(Attributes="Category(\"Flax Engine\")") class FLAXENGINE_API Behavior
     float _accumulatedTime = 0.0f;
     float _totalTime = 0.0f;
     BehaviorUpdateResult _result = BehaviorUpdateResult::Success;
+    PoolHandle _updateHandle;
 
     void UpdateAsync();
 
@@ -14,58 +14,122 @@
 #include "Engine/Scripting/ManagedCLR/MUtils.h"
 #endif
 
-bool AccessVariant(Variant& instance, const StringAnsiView& member, Variant& value, bool set)
+// Knowledge path compiled into the accessor of the value (resolved once per knowledge instance and reused).
+struct BehaviorKnowledgePath
 {
-    if (member.IsEmpty())
+    enum class Kinds
     {
-        // Whole blackboard value
-        if (set)
+        Invalid,
+        Structure,
+        ScriptingField,
+#if USE_CSHARP
+        ManagedField,
+        ManagedProperty,
+#endif
+    };
+
+    // True if path points to the goal, otherwise to the blackboard.
+    bool IsGoal = false;
+    // The goal typename.
+    StringAnsi GoalType;
+    // The accessed member name (empty for the whole value access).
+    StringAnsi Member;
+    String MemberStr;
+    // The instance typename that accessor has been resolved for.
+    StringAnsi Type;
+    Kinds Kind = Kinds::Invalid;
+    bool IsResolved = false;
+    ScriptingTypeHandle TypeHandle;
+    void* Field = nullptr;
+
+    void Resolve(const Variant& instance)
+    {
+        // TODO: support further path for nested value types (eg. structure field access)
+        Type = instance.Type.TypeName;
+        IsResolved = true;
+        Kind = Kinds::Invalid;
+        Field = nullptr;
+        const StringAnsiView typeName(Type);
+        TypeHandle = Scripting::FindScriptingType(typeName);
+        if (TypeHandle)
         {
-            CHECK_RETURN(instance.Type == value.Type, false);
-            instance = value;
+            const ScriptingType& type = TypeHandle.GetType();
+            if (type.Type == ScriptingTypes::Structure)
+            {
+                Kind = Kinds::Structure;
+                return;
+            }
+            Field = TypeHandle.Module->FindField(TypeHandle, Member);
+            if (Field)
+            {
+                Kind = Kinds::ScriptingField;
+                return;
+            }
+        }
+#if USE_CSHARP
+        if (const auto mClass = Scripting::FindClass(typeName))
+        {
+            if (const auto mField = mClass->GetField(Member.Get()))
+            {
+                Kind = Kinds::ManagedField;
+                Field = mField;
+                return;
+            }
+            if (const auto mProperty = mClass->GetProperty(Member.Get()))
+            {
+                Kind = Kinds::ManagedProperty;
+                Field = mProperty;
+                return;
+            }
         }
         else
-            value = instance;
-        return true;
+#endif
+        if (typeName.HasChars() && !TypeHandle)
+        {
+            LOG(Warning, "Missing scripting type \'{0}\'", String(typeName));
+        }
     }
-    // TODO: support further path for nested value types (eg. structure field access)
 
-    const StringAnsiView typeName(instance.Type.TypeName);
-    const ScriptingTypeHandle typeHandle = Scripting::FindScriptingType(typeName);
-    if (typeHandle)
+    bool Access(Variant& instance, Variant& value, bool set)
     {
-        const ScriptingType& type = typeHandle.GetType();
-        switch (type.Type)
+        if (Member.IsEmpty())
         {
-        case ScriptingTypes::Structure:
-        {
-            const String memberStr(member);
-            // TODO: let SetField/GetField return boolean status of operation maybe?
+            // Whole blackboard value
             if (set)
-                type.Struct.SetField(instance.AsBlob.Data, memberStr, value);
+            {
+                CHECK_RETURN(instance.Type == value.Type, false);
+                instance = value;
+            }
             else
-                type.Struct.GetField(instance.AsBlob.Data, memberStr, value);
+                value = instance;
             return true;
         }
-        default:
+
+        // Resolve accessor for the current instance type
+        if (!IsResolved || Type != StringAnsiView(instance.Type.TypeName))
+            Resolve(instance);
+
+        switch (Kind)
         {
-            if (void* field = typeHandle.Module->FindField(typeHandle, member))
-            {
-                if (set)
-                    return !typeHandle.Module->SetFieldValue(field, instance, value);
-                else
-                    return !typeHandle.Module->GetFieldValue(field, instance, value);
-            }
-            break;
-        }
+        case Kinds::Structure:
+        {
+            // TODO: let SetField/GetField return boolean status of operation maybe?
+            const ScriptingType& type = TypeHandle.GetType();
+            if (set)
+                type.Struct.SetField(instance.AsBlob.Data, MemberStr, value);
+            else
+                type.Struct.GetField(instance.AsBlob.Data, MemberStr, value);
+            return true;
         }
-    }
+        case Kinds::ScriptingField:
+            if (set)
+                return !TypeHandle.Module->SetFieldValue(Field, instance, value);
+            return !TypeHandle.Module->GetFieldValue(Field, instance, value);
 #if USE_CSHARP
-    if (const auto mClass = Scripting::FindClass(typeName))
-    {
-        MObject* instanceObject = MUtils::BoxVariant(instance);
-        if (const auto mField = mClass->GetField(member.Get()))
+        case Kinds::ManagedField:
         {
+            const auto mField = (MField*)Field;
+            MObject* instanceObject = MUtils::BoxVariant(instance);
             bool failed;
             if (set)
                 mField->SetValue(instanceObject, MUtils::VariantToManagedArgPtr(value, mField->GetType(), failed));
@@ -73,47 +137,78 @@ bool AccessVariant(Variant& instance, const StringAnsiView& member, Variant& val
                 value = MUtils::UnboxVariant(mField->GetValueBoxed(instanceObject));
             return true;
         }
-        else if (const auto mProperty = mClass->GetProperty(member.Get()))
+        case Kinds::ManagedProperty:
         {
+            const auto mProperty = (MProperty*)Field;
+            MObject* instanceObject = MUtils::BoxVariant(instance);
             if (set)
                 mProperty->SetValue(instanceObject, MUtils::BoxVariant(value), nullptr);
             else
                 value = MUtils::UnboxVariant(mProperty->GetValue(instanceObject, nullptr));
             return true;
         }
-    }
 #endif
-    else if (typeName.HasChars())
-    {
-        LOG(Warning, "Missing scripting type \'{0}\'", String(typeName));
+        default:
+            return false;
+        }
     }
+};
 
-    return false;
-}
-
-bool AccessBehaviorKnowledge(BehaviorKnowledge* knowledge, const StringAnsiView& path, Variant& value, bool set)
+BehaviorKnowledgePath* CompileBehaviorKnowledgePath(const StringAnsiView& path)
 {
     const int32 typeEnd = path.Find('/');
     if (typeEnd == -1)
-        return false;
+        return nullptr;
     const StringAnsiView type(path.Get(), typeEnd);
     if (type == "Blackboard")
     {
-        const StringAnsiView member(path.Get() + typeEnd + 1, path.Length() - typeEnd - 1);
-        return AccessVariant(knowledge->Blackboard, member, value, set);
+        auto result = New<BehaviorKnowledgePath>();
+        result->Member = StringAnsiView(path.Get() + typeEnd + 1, path.Length() - typeEnd - 1);
+        result->MemberStr = result->Member.ToString();
+        return result;
     }
     if (type == "Goal")
     {
         const StringAnsiView subPath(path.Get() + typeEnd + 1, path.Length() - typeEnd - 1);
         const int32 goalTypeEnd = subPath.Find('/');
-        const StringAnsiView goalType(subPath.Get(), goalTypeEnd);
-        const StringAnsiView member(subPath.Get() + goalTypeEnd + 1, subPath.Length() - goalTypeEnd - 1);
-        for (Variant& goal : knowledge->Goals)
+        auto result = New<BehaviorKnowledgePath>();
+        result->IsGoal = true;
+        if (goalTypeEnd == -1)
         {
-            if (goalType == goal.Type.GetTypeName())
-            {
-                return AccessVariant(goal, member, value, set);
-            }
+            // Whole goal value
+            result->GoalType = subPath;
+        }
+        else
+        {
+            result->GoalType = StringAnsiView(subPath.Get(), goalTypeEnd);
+            result->Member = StringAnsiView(subPath.Get() + goalTypeEnd + 1, subPath.Length() - goalTypeEnd - 1);
+        }
+        result->MemberStr = result->Member.ToString();
+        return result;
+    }
+    return nullptr;
+}
+
+bool AccessBehaviorKnowledge(BehaviorKnowledge* knowledge, const StringAnsiView& path, Variant& value, bool set)
+{
+    // Get compiled path (parsed only once per knowledge)
+    BehaviorKnowledgePath* compiled;
+    if (!knowledge->Paths.TryGet(path, compiled))
+    {
+        compiled = CompileBehaviorKnowledgePath(path);
+        knowledge->Paths.Add(StringAnsi(path), compiled);
+    }
+    if (!compiled)
+        return false;
+
+    if (!compiled->IsGoal)
+        return compiled->Access(knowledge->Blackboard, value, set);
+    const StringAnsiView goalType(compiled->GoalType);
+    for (Variant& goal : knowledge->Goals)
+    {
+        if (goalType == goal.Type.GetTypeName())
+        {
+            return compiled->Access(goal, value, set);
         }
     }
     return false;
@@ -140,6 +235,7 @@ bool BehaviorKnowledgeSelectorAny::TryGet(const BehaviorKnowledge* knowledge, Va
 BehaviorKnowledge::~BehaviorKnowledge()
 {
     FreeMemory();
+    Paths.ClearDelete();
 }
 
 void BehaviorKnowledge::InitMemory(BehaviorTree* tree)
@@ -148,10 +244,15 @@ void BehaviorKnowledge::InitMemory(BehaviorTree* tree)
         FreeMemory();
     if (!tree)
         return;
+    Paths.ClearDelete();
     Tree = tree;
     Blackboard = Variant::NewValue(tree->Graph.Root->BlackboardType);
     RelevantNodes.Resize(tree->Graph.NodesCount, false);
     RelevantNodes.SetAll(false);
+    ConditionVersions.Resize(tree->Graph.NodesCount, false);
+    ConditionVersions.SetAll(0);
+    ConditionResults.Resize(tree->Graph.NodesCount, false);
+    Version++;
     if (!Memory && tree->Graph.NodesStatesSize)
     {
         Memory = Allocator::Allocate(tree->Graph.NodesStatesSize);
@@ -184,6 +285,9 @@ void BehaviorKnowledge::FreeMemory()
         Memory = nullptr;
     }
     RelevantNodes.Clear();
+    ConditionVersions.Clear();
+    ConditionResults.Clear();
+    Version++;
     Blackboard.DeleteValue();
     for (Variant& goal : Goals)
         goal.DeleteValue();
@@ -198,7 +302,26 @@ bool BehaviorKnowledge::Get(const StringAnsiView& path, Variant& value) const
 
 bool BehaviorKnowledge::Set(const StringAnsiView& path, const Variant& value)
 {
-    return AccessBehaviorKnowledge(this, path, const_cast<Variant&>(value), true);
+    if (!AccessBehaviorKnowledge(this, path, const_cast<Variant&>(value), true))
+        return false;
+    Version++;
+    return true;
+}
+
+bool BehaviorKnowledge::TryGetCondition(int32 executionIndex, bool& result) const
+{
+    if (executionIndex < 0 || executionIndex >= ConditionVersions.Count() || ConditionVersions.Get()[executionIndex] != Version)
+        return false;
+    result = ConditionResults.Get(executionIndex);
+    return true;
+}
+
+void BehaviorKnowledge::SetCondition(int32 executionIndex, bool result)
+{
+    if (executionIndex < 0 || executionIndex >= ConditionVersions.Count())
+        return;
+    ConditionVersions.Get()[executionIndex] = Version;
+    ConditionResults.Set(executionIndex, result);
 }
 
 bool BehaviorKnowledge::HasGoal(ScriptingTypeHandle type) const
@@ -234,6 +357,7 @@ void BehaviorKnowledge::AddGoal(Variant&& goal)
     if (i == Goals.Count())
         Goals.AddDefault();
     Goals.Get()[i] = MoveTemp(goal);
+    Version++;
 }
 
 void BehaviorKnowledge::RemoveGoal(ScriptingTypeHandle type)
@@ -244,6 +368,7 @@ void BehaviorKnowledge::RemoveGoal(ScriptingTypeHandle type)
         if (goalType == type)
         {
             Goals.RemoveAt(i);
+            Version++;
             break;
         }
     }
@@ -5,10 +5,12 @@
 #include "Engine/Core/Types/Variant.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/BitArray.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Scripting/ScriptingObject.h"
 
 class Behavior;
 class BehaviorTree;
+struct BehaviorKnowledgePath;
 enum class BehaviorValueComparison;
 
 /// <summary>
@@ -39,6 +41,26 @@ API_CLASS() class FLAXENGINE_API BehaviorKnowledge : public ScriptingObject
     /// </summary>
     BitArray<> RelevantNodes;
 
+    /// <summary>
+    /// Array with per-node knowledge version at which the cached decorator condition result was evaluated (see ConditionResults).
+    /// </summary>
+    Array<uint32> ConditionVersions;
+
+    /// <summary>
+    /// Array with per-node cached decorator condition result.
+    /// </summary>
+    BitArray<> ConditionResults;
+
+    /// <summary>
+    /// Cache of the compiled knowledge selector paths (parsed and resolved on the first access). Reset on memory init.
+    /// </summary>
+    Dictionary<StringAnsi, BehaviorKnowledgePath*> Paths;
+
+    /// <summary>
+    /// Knowledge modifications counter. Incremented on every change made via Set, AddGoal, RemoveGoal or MarkChanged. Used to skip evaluation of the knowledge-based decorators when the knowledge didn't change.
+    /// </summary>
+    API_FIELD(ReadOnly) uint32 Version = 1;
+
     /// <summary>
     /// Instance of the behaviour blackboard (structure or class).
     /// </summary>
@@ -78,6 +100,29 @@ API_CLASS() class FLAXENGINE_API BehaviorKnowledge : public ScriptingObject
     /// <returns>True if set value, otherwise false.</returns>
     API_FUNCTION() bool Set(const StringAnsiView& path, const Variant& value);
 
+    /// <summary>
+    /// Marks the knowledge as modified. Has to be called after modifying Blackboard or Goals directly (not via Set, AddGoal or RemoveGoal) when tree uses event-driven decorators.
+    /// </summary>
+    API_FUNCTION() void MarkChanged()
+    {
+        Version++;
+    }
+
+    /// <summary>
+    /// Gets the cached condition result of the node (valid only if the knowledge didn't change since the condition was evaluated).
+    /// </summary>
+    /// <param name="executionIndex">The node execution index.</param>
+    /// <param name="result">The cached condition result.</param>
+    /// <returns>True if got valid result, otherwise false.</returns>
+    bool TryGetCondition(int32 executionIndex, bool& result) const;
+
+    /// <summary>
+    /// Caches the condition result of the node for the current knowledge version.
+    /// </summary>
+    /// <param name="executionIndex">The node execution index.</param>
+    /// <param name="result">The condition result.</param>
+    void SetCondition(int32 executionIndex, bool result);
+
 public:
     /// <summary>
     /// Checks if knowledge has a given goal (exact type match without base class check).
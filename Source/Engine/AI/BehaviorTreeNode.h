@@ -29,6 +29,8 @@ API_CLASS(Abstract) class FLAXENGINE_API BehaviorTreeNode : public SerializableS
 private:
     Array<class BehaviorTreeDecorator*, InlinedAllocation<8>> _decorators;
 
+    static bool CheckDecorator(BehaviorTreeDecorator* decorator, const BehaviorUpdateContext& context, bool eventDriven);
+
 public:
     /// <summary>
     /// Node user name (eg. Follow Enemy, or Pick up Weapon).
@@ -135,4 +137,12 @@ API_CLASS(Abstract) class FLAXENGINE_API BehaviorTreeDecorator : public Behavior
     API_FUNCTION() virtual void PostUpdate(const BehaviorUpdateContext& context, API_PARAM(ref) BehaviorUpdateResult& result)
     {
     }
+
+    /// <summary>
+    /// Checks if the decorator condition (CanUpdate) depends only on the behavior knowledge. Such conditions are cached until knowledge changes and can abort the running node when using event-driven decorators.
+    /// </summary>
+    virtual bool IsKnowledgeCondition() const
+    {
+        return false;
+    }
 };
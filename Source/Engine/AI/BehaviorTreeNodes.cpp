@@ -3,6 +3,7 @@
 #include "BehaviorTreeNodes.h"
 #include "Behavior.h"
 #include "BehaviorKnowledge.h"
+#include "BehaviorTree.h"
 #include "Engine/Core/Random.h"
 #include "Engine/Scripting/Scripting.h"
 #if USE_CSHARP
@@ -48,10 +49,26 @@ bool IsAssignableFrom(const StringAnsiView& to, const StringAnsiView& from)
     return false;
 }
 
+bool BehaviorTreeNode::CheckDecorator(BehaviorTreeDecorator* decorator, const BehaviorUpdateContext& context, bool eventDriven)
+{
+    if (!eventDriven || !decorator->IsKnowledgeCondition())
+        return decorator->CanUpdate(context);
+
+    // Reuse the condition result until knowledge gets modified
+    bool result;
+    if (!context.Knowledge->TryGetCondition(decorator->_executionIndex, result))
+    {
+        result = decorator->CanUpdate(context);
+        context.Knowledge->SetCondition(decorator->_executionIndex, result);
+    }
+    return result;
+}
+
 BehaviorUpdateResult BehaviorTreeNode::InvokeUpdate(const BehaviorUpdateContext& context)
 {
     ASSERT_LOW_LAYER(_executionIndex != -1);
     const BitArray<>& relevantNodes = *(const BitArray<>*)context.RelevantNodes;
+    const bool eventDriven = _decorators.HasItems() && context.Knowledge && context.Knowledge->Tree && context.Knowledge->Tree->Graph.Root->EventDrivenDecorators;
 
     // If node is not yet relevant
     if (relevantNodes.Get(_executionIndex) == false)
@@ -62,7 +79,7 @@ BehaviorUpdateResult BehaviorTreeNode::InvokeUpdate(const BehaviorUpdateContext&
             ASSERT_LOW_LAYER(decorator->_executionIndex != -1);
             if (relevantNodes.Get(decorator->_executionIndex) == false)
                 decorator->BecomeRelevant(context);
-            if (!decorator->CanUpdate(context))
+            if (!CheckDecorator(decorator, context, eventDriven))
             {
                 return BehaviorUpdateResult::Failed;
             }
@@ -71,6 +88,18 @@ BehaviorUpdateResult BehaviorTreeNode::InvokeUpdate(const BehaviorUpdateContext&
         // Make node relevant
         BecomeRelevant(context);
     }
+    else if (eventDriven)
+    {
+        // Abort running node if any of the knowledge conditions doesn't pass anymore (cached unless knowledge changed)
+        for (BehaviorTreeDecorator* decorator : _decorators)
+        {
+            if (decorator->IsKnowledgeCondition() && !CheckDecorator(decorator, context, true))
+            {
+                BecomeIrrelevant(context);
+                return BehaviorUpdateResult::Failed;
+            }
+        }
+    }
 
     // Update decorators
     bool decoratorFailed = false;
@@ -96,6 +96,10 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeRootNode : public BehaviorTre
     // The target amount of the behavior logic updates per second.
     API_FIELD(Attributes="EditorOrder(100)")
     float UpdateFPS = 10.0f;
+
+    // If checked, the knowledge-based decorators are evaluated only when the behavior knowledge changes (via Set, AddGoal, RemoveGoal or MarkChanged) and they abort the running nodes once their condition stops passing.
+    API_FIELD(Attributes="EditorOrder(110)")
+    bool EventDrivenDecorators = false;
 };
 
 /// <summary>
@@ -418,6 +422,10 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeConditionalDecorator
 public:
     // [BehaviorTreeNode]
     bool CanUpdate(const BehaviorUpdateContext& context) override;
+    bool IsKnowledgeCondition() const override
+    {
+        return true;
+    }
 };
 
 /// <summary>
@@ -443,6 +451,10 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeValuesConditionalDec
 public:
     // [BehaviorTreeNode]
     bool CanUpdate(const BehaviorUpdateContext& context) override;
+    bool IsKnowledgeCondition() const override
+    {
+        return true;
+    }
 };
 
 /// <summary>
@@ -464,6 +476,10 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeBooleanDecorator : p
 public:
     // [BehaviorTreeNode]
     bool CanUpdate(const BehaviorUpdateContext& context) override;
+    bool IsKnowledgeCondition() const override
+    {
+        return true;
+    }
 };
 
 /// <summary>
@@ -506,4 +522,8 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeHasGoalDecorator : public Beh
 public:
     // [BehaviorTreeNode]
     bool CanUpdate(const BehaviorUpdateContext& context) override;
+    bool IsKnowledgeCondition() const override
+    {
+        return true;
+    }
 };
@@ -4,15 +4,41 @@
 #include "AnimEvent.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/TaskGraph.h"
+#include "Engine/Core/Collections/HandlePool.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
 
 class AnimationsService : public EngineService
 {
 public:
-    Array<AnimatedModel*> UpdateList;
+    struct SharedPoseKey
+    {
+        SkinnedModel* Model;
+        AnimationGraph* Graph;
+        int32 Group;
+
+        bool operator==(const SharedPoseKey& other) const
+        {
+            return Model == other.Model && Graph == other.Graph && Group == other.Group;
+        }
+
+        friend uint32 GetHash(const SharedPoseKey& key)
+        {
+            uint32 hash = GetHash(key.Model);
+            CombineHash(hash, key.Graph);
+            CombineHash(hash, (uint32)key.Group);
+            return hash;
+        }
+    };
+
+    HandlePool<AnimatedModel*> UpdateList;
+    Array<AnimatedModel*> Jobs;
+    Dictionary<SharedPoseKey, AnimatedModel*> SharedPoses;
 
     AnimationsService()
         : EngineService(TEXT("Animations"), -10)
@@ -28,6 +54,7 @@ class AnimationsSystem : public TaskGraphSystem
 public:
     float DeltaTime, UnscaledDeltaTime, Time, UnscaledTime;
 
+    static bool SortByUpdatePriority(AnimatedModel* const& a, AnimatedModel* const& b);
     void Job(int32 index);
     void Execute(TaskGraph* graph) override;
     void PostExecute(TaskGraph* graph) override;
@@ -51,6 +78,7 @@ namespace
 
 AnimationsService AnimationManagerInstance;
 TaskGraphSystem* Animations::System = nullptr;
+int32 Animations::UpdateBudget = 0;
 #if USE_EDITOR
 Delegate<Animations::DebugFlowInfo> Animations::DebugFlow;
 #endif
@@ -74,14 +102,36 @@ bool AnimationsService::Init()
 
 void AnimationsService::Dispose()
 {
-    UpdateList.Resize(0);
+    UpdateList.Clear();
+    Jobs.Clear();
+    SharedPoses.Clear();
     SAFE_DELETE(Animations::System);
 }
 
+bool AnimationsSystem::SortByUpdatePriority(AnimatedModel* const& a, AnimatedModel* const& b)
+{
+    // Pose interpolations go first (cheap and never delayed) and then the models sorted by the update priority
+    if (a->_interpolateOnly != b->_interpolateOnly)
+        return a->_interpolateOnly;
+    return a->_updatePriority > b->_updatePriority;
+}
+
 void AnimationsSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Animations.Job");
-    auto animatedModel = AnimationManagerInstance.UpdateList[index];
+    PROFILE_MEM(Animations);
+    auto animatedModel = AnimationManagerInstance.Jobs[index];
+    if (animatedModel->_interpolateOnly)
+    {
+        // Interpolate pose between the evaluated ones
+        if (CanUpdateModel(animatedModel))
+        {
+            animatedModel->SetupSkinningData();
+            animatedModel->UpdatePoseInterpolation();
+            animatedModel->OnAnimationUpdated_Async();
+        }
+        return;
+    }
     if (CanUpdateModel(animatedModel))
     {
         auto graph = animatedModel->AnimationGraph.Get();
@@ -106,6 +156,8 @@ void AnimationsSystem::Job(int32 index)
 
         // Evaluate animated nodes pose
         graph->GraphExecutor.Update(animatedModel->GraphInstance, dt);
+        animatedModel->_deferredUpdates = 0;
+        animatedModel->BeginPoseInterpolation();
 
         // Update gameplay
         animatedModel->OnAnimationUpdated_Async();
@@ -130,10 +182,38 @@ void AnimationsSystem::Execute(TaskGraph* graph)
         Animations::DebugFlow(Animations::DebugFlowInfo());
 #endif
 
+    // Pick the models to update
+    auto& jobs = AnimationManagerInstance.Jobs;
+    const auto& updateList = AnimationManagerInstance.UpdateList;
+    jobs.Clear();
+    jobs.EnsureCapacity(updateList.Count());
+    int32 interpolationsCount = 0;
+    for (int32 index = 0; index < updateList.Count(); index++)
+    {
+        AnimatedModel* animatedModel = updateList[index];
+        jobs.Add(animatedModel);
+        if (animatedModel->_interpolateOnly)
+            interpolationsCount++;
+    }
+    const int32 updatesLimit = interpolationsCount + Animations::UpdateBudget;
+    if (Animations::UpdateBudget > 0 && jobs.Count() > updatesLimit)
+    {
+        // Update the most important models within the budget and delay the others
+        PROFILE_CPU_NAMED("Budget");
+        Sorting::QuickSort(jobs.Get(), jobs.Count(), &SortByUpdatePriority);
+        for (int32 index = updatesLimit; index < jobs.Count(); index++)
+        {
+            AnimatedModel* animatedModel = jobs[index];
+            if (animatedModel->_deferredUpdates < MAX_uint16)
+                animatedModel->_deferredUpdates++;
+        }
+        jobs.Resize(updatesLimit);
+    }
+
     // Schedule work to update all animated models in async
     Function<void(int32)> job;
     job.Bind<AnimationsSystem, &AnimationsSystem::Job>(this);
-    graph->DispatchJob(job, AnimationManagerInstance.UpdateList.Count());
+    graph->DispatchJob(job, jobs.Count());
 }
 
 void AnimationsSystem::PostExecute(TaskGraph* graph)
@@ -141,9 +221,15 @@ void AnimationsSystem::PostExecute(TaskGraph* graph)
     PROFILE_CPU_NAMED("Animations.PostExecute");
 
     // Update gameplay
-    for (int32 index = 0; index < AnimationManagerInstance.UpdateList.Count(); index++)
+    for (int32 index = 0; index < AnimationManagerInstance.Jobs.Count(); index++)
     {
-        auto animatedModel = AnimationManagerInstance.UpdateList[index];
+        auto animatedModel = AnimationManagerInstance.Jobs[index];
+        if (animatedModel->_interpolateOnly)
+        {
+            animatedModel->UpdateSockets();
+            animatedModel->_sharedPoseUpdated();
+            continue;
+        }
         if (CanUpdateModel(animatedModel))
         {
             animatedModel->GraphInstance.InvokeAnimEvents();
@@ -152,15 +238,45 @@ void AnimationsSystem::PostExecute(TaskGraph* graph)
     }
 
     // Cleanup
+    for (int32 index = 0; index < AnimationManagerInstance.UpdateList.Count(); index++)
+        AnimationManagerInstance.UpdateList[index]->_interpolateOnly = false;
     AnimationManagerInstance.UpdateList.Clear();
+    AnimationManagerInstance.Jobs.Clear();
 }
 
 void Animations::AddToUpdate(AnimatedModel* obj)
 {
-    AnimationManagerInstance.UpdateList.Add(obj);
+    // Visible and close models go first, the ones delayed by the budget gain the priority with every frame they wait
+    const float distance = obj->_lastMinDstSqr < MAX_Real ? (float)Math::Sqrt(obj->_lastMinDstSqr) : 100000.0f;
+    obj->_updatePriority = (float)(obj->_deferredUpdates + 1) / (1.0f + distance * 0.001f);
+    obj->_updateHandle = AnimationManagerInstance.UpdateList.Add(obj);
 }
 
 void Animations::RemoveFromUpdate(AnimatedModel* obj)
 {
-    AnimationManagerInstance.UpdateList.Remove(obj);
+    AnimationManagerInstance.UpdateList.RemoveAndReset(obj->_updateHandle);
+}
+
+AnimatedModel* Animations::GetSharedPose(AnimatedModel* obj)
+{
+    const AnimationsService::SharedPoseKey key = { obj->SkinnedModel.Get(), obj->AnimationGraph.Get(), obj->SharedPoseGroup };
+    AnimatedModel*& source = AnimationManagerInstance.SharedPoses[key];
+    if (source != obj)
+    {
+        // Take over the pose evaluation if the current source model no longer matches
+        if (!source
+            || !source->SharePose
+            || !source->IsActiveInHierarchy()
+            || source->UpdateMode == AnimatedModel::AnimationUpdateMode::Never
+            || source->SkinnedModel.Get() != key.Model
+            || source->AnimationGraph.Get() != key.Graph
+            || source->SharedPoseGroup != key.Group)
+            source = obj;
+    }
+    return source;
+}
+
+void Animations::RemoveSharedPose(AnimatedModel* obj)
+{
+    AnimationManagerInstance.SharedPoses.RemoveValue(obj);
 }
@@ -21,6 +21,11 @@ API_CLASS(Static) class FLAXENGINE_API Animations
     /// </summary>
     API_FIELD(ReadOnly) static TaskGraphSystem* System;
 
+    /// <summary>
+    /// The maximum amount of animated models evaluated within a single frame (0 to disable the limit). If more models request the update, the visible and the closest ones are updated first and the others are delayed to the next frames. Can be used to keep the animations cost fixed in crowded scenes.
+    /// </summary>
+    API_FIELD() static int32 UpdateBudget;
+
 #if USE_EDITOR
     // Data wrapper for the debug flow information.
     API_STRUCT(NoDefault) struct DebugFlowInfo
@@ -54,4 +59,17 @@ API_CLASS(Static) class FLAXENGINE_API Animations
     /// </summary>
     /// <param name="obj">The object.</param>
     static void RemoveFromUpdate(AnimatedModel* obj);
+
+    /// <summary>
+    /// Gets the animated model that evaluates the shared pose for the given model (see AnimatedModel::SharePose). The first model registered for the skinned model, animation graph and shared pose group evaluates the pose for all of them.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <returns>The model that evaluates the shared pose (the given object if it should evaluate it).</returns>
+    static AnimatedModel* GetSharedPose(AnimatedModel* obj);
+
+    /// <summary>
+    /// Removes the animated model from evaluating the shared pose (another model will take it over).
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    static void RemoveSharedPose(AnimatedModel* obj);
 };
@@ -133,8 +133,20 @@ bool SortMultiBlend1D(const ANIM_GRAPH_MULTI_BLEND_INDEX& a, const ANIM_GRAPH_MU
 bool AnimGraphBase::onNodeLoaded(Node* n)
 {
     ((AnimGraphNode*)n)->Graph = _graph;
+    ((AnimGraphNode*)n)->ValueCacheStart = _graph->_valueCacheCounter;
+    _graph->_valueCacheCounter += n->Boxes.Count();
     switch (n->GroupID)
     {
+    // Parameters
+    case 6:
+        switch (n->TypeID)
+        {
+        // Get
+        case 1:
+            _graph->GetParameter((Guid)n->Values[0], n->Data.Parameter.ParameterIndex);
+            break;
+        }
+        break;
     // Tools
     case 7:
         switch (n->TypeID)
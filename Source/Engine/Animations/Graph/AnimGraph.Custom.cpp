@@ -90,7 +90,7 @@ void AnimGraphExecutor::ProcessGroupCustom(Box* boxBase, Node* nodeBase, Value&
 {
 #if USE_CSHARP
     auto& context = *Context.Get();
-    if (context.ValueCache.TryGet(boxBase, value))
+    if (context.TryGetCachedValue(boxBase, value))
         return;
     auto box = (AnimGraphBox*)boxBase;
     auto node = (AnimGraphNode*)nodeBase;
@@ -135,7 +135,7 @@ void AnimGraphExecutor::ProcessGroupCustom(Box* boxBase, Node* nodeBase, Value&
 
     // Extract result
     value = MUtils::UnboxVariant(result);
-    context.ValueCache.Add(boxBase, value);
+    context.SetCachedValue(boxBase, value);
 #endif
 }
 
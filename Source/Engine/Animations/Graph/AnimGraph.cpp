@@ -3,11 +3,12 @@
 #include "AnimGraph.h"
 #include "Engine/Animations/Animations.h"
 #include "Engine/Animations/AnimEvent.h"
+#include "Engine/Animations/PoseBlending.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Graphics/Models/SkeletonData.h"
 #include "Engine/Scripting/Scripting.h"
 
-extern void RetargetSkeletonNode(const SkeletonData& sourceSkeleton, const SkeletonData& targetSkeleton, const SkinnedModel::SkeletonMapping& sourceMapping, Transform& node, int32 i);
+extern void RetargetSkeletonNode(const Transform& sourceToTarget, Transform& node);
 
 ThreadLocal<AnimGraphContext*> AnimGraphExecutor::Context;
 
@@ -56,6 +57,7 @@ void AnimGraphInstanceData::ClearState()
     RootMotion = Transform::Identity;
     State.Resize(0);
     NodesPose.Resize(0);
+    NodesTransforms.Resize(0);
     TraceEvents.Clear();
 }
 
@@ -145,6 +147,7 @@ bool AnimGraph::Load(ReadStream* stream, bool loadMeta)
 {
     Version++;
     _bucketsCounter = 0;
+    _valueCacheCounter = 0;
     _customNodes.Clear();
 
     // Base
@@ -254,7 +257,10 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
         context.CallStack.Clear();
         context.Functions.Clear();
         context.PoseCacheSize = 0;
-        context.ValueCache.Clear();
+        context.SamplesCacheSize = 0;
+        context.ValueCacheFrame++;
+        if (context.ValueCache.Count() < _graph._valueCacheCounter)
+            context.ValueCache.Resize(_graph._valueCacheCounter);
 
         // Prepare instance data
         if (data.Version != _graph.Version)
@@ -349,9 +355,8 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
 
         // Use skeleton mapping
         const SkinnedModel::SkeletonMapping mapping = data.NodesSkeleton->GetSkeletonMapping(_graph.BaseModel);
-        if (mapping.NodesMapping.IsValid())
+        if (mapping.NodesMapping.IsValid() && mapping.RetargetTransforms.Length() == retargetNodes.Nodes.Count())
         {
-            const auto& sourceSkeleton = _graph.BaseModel->Skeleton;
             Transform* sourceNodes = animResult->Nodes.Get();
             for (int32 i = 0; i < retargetNodes.Nodes.Count(); i++)
             {
@@ -359,7 +364,7 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
                 if (nodeToNode != -1)
                 {
                     Transform node = sourceNodes[nodeToNode];
-                    RetargetSkeletonNode(sourceSkeleton, targetSkeleton, mapping, node, i);
+                    RetargetSkeletonNode(mapping.RetargetTransforms[i], node);
                     targetNodes[i] = node;
                 }
             }
@@ -381,15 +386,9 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
         Transform* nodesTransformations = animResult->Nodes.Get();
 
         // Note: this assumes that nodes are sorted (parents first)
-        for (int32 nodeIndex = 0; nodeIndex < animResultSkeleton->Nodes.Count(); nodeIndex++)
-        {
-            const int32 parentIndex = animResultSkeleton->Nodes[nodeIndex].ParentIndex;
-            if (parentIndex != -1)
-            {
-                nodesTransformations[parentIndex].LocalToWorld(nodesTransformations[nodeIndex], nodesTransformations[nodeIndex]);
-            }
-            nodesTransformations[nodeIndex].GetWorld(data.NodesPose[nodeIndex]);
-        }
+        PoseBlending::LocalToModel(nodesTransformations, animResultSkeleton->Nodes.Get(), animResultSkeleton->Nodes.Count(), data.NodesPose.Get());
+        if (data.CacheNodesTransforms)
+            data.NodesTransforms.Set(nodesTransformations, animResultSkeleton->Nodes.Count());
 
         // Process the root node transformation and the motion
         data.RootTransform = nodesTransformations[0];
@@ -339,6 +339,16 @@ class FLAXENGINE_API AnimGraphInstanceData
     /// </summary>
     Array<Matrix> NodesPose;
 
+    /// <summary>
+    /// The per-node final transformations in actor local-space (the same as NodesPose). Valid only if CacheNodesTransforms is set.
+    /// </summary>
+    Array<Transform> NodesTransforms;
+
+    /// <summary>
+    /// True if the final nodes transformations should be cached into NodesTransforms by the update (eg. for the poses interpolation).
+    /// </summary>
+    bool CacheNodesTransforms = false;
+
     /// <summary>
     /// The object that represents the instance data source (used by Custom Nodes and debug flows).
     /// </summary>
@@ -511,6 +521,14 @@ class AnimGraphNode : public VisjectGraphNode<AnimGraphBox>
         AnimSubGraph* Graph;
     };
 
+    struct ParameterData
+    {
+        /// <summary>
+        /// The index of the graph parameter (resolved on load), or -1 if missing.
+        /// </summary>
+        int32 ParameterIndex;
+    };
+
     struct TransformNodeData
     {
         int32 NodeIndex;
@@ -539,6 +557,7 @@ class AnimGraphNode : public VisjectGraphNode<AnimGraphBox>
             AnimationGraphFunctionData AnimationGraphFunction;
             TransformNodeData TransformNode;
             CopyNodeData CopyNode;
+            ParameterData Parameter;
         };
     };
 
@@ -553,6 +572,11 @@ class AnimGraphNode : public VisjectGraphNode<AnimGraphBox>
     /// </summary>
     int32 BucketIndex = -1;
 
+    /// <summary>
+    /// The index of the first evaluation value cache slot used by this node boxes (slot of the box is ValueCacheStart + box ID). See AnimGraphContext::ValueCache.
+    /// </summary>
+    int32 ValueCacheStart = -1;
+
     /// <summary>
     /// The custom data (depends on node type). Used to cache data for faster usage at runtime.
     /// </summary>
@@ -697,6 +721,7 @@ class AnimGraph : public AnimGraphBase
 
     bool _isFunction, _isRegisteredForScriptingEvents;
     int32 _bucketsCounter;
+    int32 _valueCacheCounter;
     Array<InitBucketHandler> _bucketInitializerList;
     Array<Node*> _customNodes;
     Asset* _owner;
@@ -771,9 +796,51 @@ struct AnimGraphContext
     Dictionary<VisjectExecutor::Node*, VisjectExecutor::Graph*> Functions;
     ChunkedArray<AnimGraphImpulse, 256> PoseCache;
     int32 PoseCacheSize;
-    Dictionary<VisjectExecutor::Box*, Variant> ValueCache;
+
+    struct CachedValue
+    {
+        uint64 Frame = 0;
+        Variant Value;
+    };
+
+    // The boxes values evaluated within the current update (indexed by slots precomputed on graph load, entries from the previous updates are invalidated by the frame stamp).
+    Array<CachedValue> ValueCache;
+    uint64 ValueCacheFrame = 0;
+
+    struct CachedSample
+    {
+        Animation* Anim;
+        float Position;
+        Array<Transform> Nodes;
+    };
+
+    // The animations sampled within the current update (sampled and retargeted skeleton nodes) to reuse when the same animation is evaluated at the same time by a few graph nodes.
+    Array<CachedSample> SamplesCache;
+    int32 SamplesCacheSize = 0;
 
     AnimGraphTraceEvent& AddTraceEvent(const AnimGraphNode* node);
+
+    FORCE_INLINE bool TryGetCachedValue(const VisjectExecutor::Box* box, Variant& value) const
+    {
+        const int32 start = box->GetParent<AnimGraphNode>()->ValueCacheStart;
+        if (start < 0 || start + box->ID >= ValueCache.Count())
+            return false;
+        const CachedValue& e = ValueCache.Get()[start + box->ID];
+        if (e.Frame != ValueCacheFrame)
+            return false;
+        value = e.Value;
+        return true;
+    }
+
+    FORCE_INLINE void SetCachedValue(const VisjectExecutor::Box* box, const Variant& value)
+    {
+        const int32 start = box->GetParent<AnimGraphNode>()->ValueCacheStart;
+        if (start < 0 || start + box->ID >= ValueCache.Count())
+            return;
+        CachedValue& e = ValueCache.Get()[start + box->ID];
+        e.Frame = ValueCacheFrame;
+        e.Value = value;
+    }
 };
 
 /// <summary>
@@ -860,6 +927,7 @@ class AnimGraphExecutor : public VisjectExecutor
 
     int32 GetRootNodeIndex(Animation* anim);
     void ProcessAnimEvents(AnimGraphNode* node, bool loop, float length, float animPos, float animPrevPos, Animation* anim, float speed);
+    const Transform* SampleAnimationNodes(AnimGraphContext& context, Animation* anim, float animPos, const Span<int32>& nodesMapping, const Span<Transform>& retargetTransforms);
     void ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode* node, bool loop, float length, float pos, float prevPos, Animation* anim, float speed, float weight = 1.0f, ProcessAnimationMode mode = ProcessAnimationMode::Override, BitArray<InlinedAllocation<8>>* usedNodes = nullptr);
     Variant SampleAnimation(AnimGraphNode* node, bool loop, float length, float startTimePos, float prevTimePos, float& newTimePos, Animation* anim, float speed);
     Variant SampleAnimationsWithBlend(AnimGraphNode* node, bool loop, float length, float startTimePos, float prevTimePos, float& newTimePos, Animation* animA, Animation* animB, float speedA, float speedB, float alpha);
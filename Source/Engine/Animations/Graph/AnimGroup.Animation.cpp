@@ -8,11 +8,12 @@
 #include "Engine/Animations/AlphaBlend.h"
 #include "Engine/Animations/AnimEvent.h"
 #include "Engine/Animations/InverseKinematics.h"
+#include "Engine/Animations/PoseBlending.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 
 namespace
 {
-    FORCE_INLINE void BlendAdditiveWeightedRotation(Quaternion& base, Quaternion& additive, float weight)
+    FORCE_INLINE void BlendAdditiveWeightedRotation(Quaternion& base, Quaternion additive, float weight)
     {
         // Pick a shortest path between rotation to fix blending artifacts
         additive *= weight;
@@ -23,10 +24,7 @@ namespace
 
     FORCE_INLINE void NormalizeRotations(AnimGraphImpulse* nodes, RootMotionExtraction rootMotionMode)
     {
-        for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-        {
-            nodes->Nodes.Get()[i].Orientation.Normalize();
-        }
+        PoseBlending::NormalizeRotations(nodes->Nodes.Get(), nodes->Nodes.Count());
         if (rootMotionMode != RootMotionExtraction::NoExtraction)
         {
             nodes->RootMotion.Orientation.Normalize();
@@ -34,22 +32,13 @@ namespace
     }
 }
 
-void RetargetSkeletonNode(const SkeletonData& sourceSkeleton, const SkeletonData& targetSkeleton, const SkinnedModel::SkeletonMapping& mapping, Transform& node, int32 i)
+void RetargetSkeletonNode(const Transform& sourceToTarget, Transform& node)
 {
-    const int32 nodeToNode = mapping.NodesMapping[i];
-    if (nodeToNode == -1)
-        return;
-
-    // Map source skeleton node to the target skeleton (use ref pose difference)
-    const auto& sourceNode = sourceSkeleton.Nodes[nodeToNode];
-    const auto& targetNode = targetSkeleton.Nodes[i];
-    Transform value = node;
-    const Transform sourceToTarget = targetNode.LocalTransform - sourceNode.LocalTransform;
-    value.Translation += sourceToTarget.Translation;
-    value.Scale *= sourceToTarget.Scale;
-    value.Orientation = sourceToTarget.Orientation * value.Orientation; // TODO: find out why this doesn't match referenced animation when played on that skeleton originally
-    value.Orientation.Normalize();
-    node = value;
+    // Map source skeleton node to the target skeleton (use ref pose difference precomputed in the skeleton mapping)
+    node.Translation += sourceToTarget.Translation;
+    node.Scale *= sourceToTarget.Scale;
+    node.Orientation = sourceToTarget.Orientation * node.Orientation; // TODO: find out why this doesn't match referenced animation when played on that skeleton originally
+    node.Orientation.Normalize();
 }
 
 AnimGraphTraceEvent& AnimGraphContext::AddTraceEvent(const AnimGraphNode* node)
@@ -222,6 +211,45 @@ FORCE_INLINE void GetAnimSamplePos(bool loop, float length, float startTimePos,
     prevPos = GetAnimPos(prevTimePos, startTimePos, loop, length);
 }
 
+const Transform* AnimGraphExecutor::SampleAnimationNodes(AnimGraphContext& context, Animation* anim, float animPos, const Span<int32>& nodesMapping, const Span<Transform>& retargetTransforms)
+{
+    // Reuse the nodes if the same animation was already sampled at the same time within this update (eg. by blend space or state machine nodes)
+    for (int32 i = 0; i < context.SamplesCacheSize; i++)
+    {
+        const auto& e = context.SamplesCache[i];
+        if (e.Anim == anim && e.Position == animPos)
+            return e.Nodes.Get();
+    }
+    if (context.SamplesCacheSize == context.SamplesCache.Count())
+        context.SamplesCache.AddOne();
+    auto& sample = context.SamplesCache[context.SamplesCacheSize++];
+    sample.Anim = anim;
+    sample.Position = animPos;
+
+    // Sample the animated nodes (nodes without animation channel use the reference pose)
+    const int32 nodesCount = nodesMapping.Length();
+    const auto emptyNodes = GetEmptyNodes();
+    const bool retarget = retargetTransforms.Length() == nodesCount;
+    sample.Nodes.Resize(nodesCount, false);
+    Transform* nodes = sample.Nodes.Get();
+    for (int32 nodeIndex = 0; nodeIndex < nodesCount; nodeIndex++)
+    {
+        const int32 nodeToChannel = nodesMapping[nodeIndex];
+        Transform& node = nodes[nodeIndex];
+        node = emptyNodes->Nodes[nodeIndex];
+        if (nodeToChannel != -1)
+        {
+            // Calculate the animated node transformation
+            anim->Data.Channels[nodeToChannel].Evaluate(animPos, &node, false);
+
+            // Optionally retarget animation into the skeleton used by the Anim Graph
+            if (retarget)
+                RetargetSkeletonNode(retargetTransforms[nodeIndex], node);
+        }
+    }
+    return nodes;
+}
+
 void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode* node, bool loop, float length, float pos, float prevPos, Animation* anim, float speed, float weight, ProcessAnimationMode mode, BitArray<InlinedAllocation<8>>* usedNodes)
 {
     PROFILE_CPU_ASSET(anim);
@@ -284,25 +312,14 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
     const bool weighted = weight < 1.0f;
     const bool retarget = mapping.SourceSkeleton && mapping.SourceSkeleton != mapping.TargetSkeleton;
     const auto emptyNodes = GetEmptyNodes();
-    SkinnedModel::SkeletonMapping sourceMapping;
-    if (retarget)
-        sourceMapping = _graph.BaseModel->GetSkeletonMapping(mapping.SourceSkeleton);
+    const Transform* srcNodes = SampleAnimationNodes(context, anim, animPos, mapping.NodesMapping, retarget ? mapping.RetargetTransforms : Span<Transform>());
     for (int32 nodeIndex = 0; nodeIndex < nodes->Nodes.Count(); nodeIndex++)
     {
         const int32 nodeToChannel = mapping.NodesMapping[nodeIndex];
         Transform& dstNode = nodes->Nodes[nodeIndex];
-        Transform srcNode = emptyNodes->Nodes[nodeIndex];
+        const Transform& srcNode = srcNodes[nodeIndex];
         if (nodeToChannel != -1)
         {
-            // Calculate the animated node transformation
-            anim->Data.Channels[nodeToChannel].Evaluate(animPos, &srcNode, false);
-
-            // Optionally retarget animation into the skeleton used by the Anim Graph
-            if (retarget)
-            {
-                RetargetSkeletonNode(mapping.SourceSkeleton->Skeleton, mapping.TargetSkeleton->Skeleton, sourceMapping, srcNode, nodeIndex);
-            }
-
             // Mark node as used
             if (usedNodes)
                 usedNodes->Set(nodeIndex, true);
@@ -526,10 +543,7 @@ Variant AnimGraphExecutor::Blend(AnimGraphNode* node, const Value& poseA, const
     if (!ANIM_GRAPH_IS_VALID_PTR(poseB))
         nodesB = GetEmptyNodes();
 
-    for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-    {
-        Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-    }
+    PoseBlending::Lerp(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
     Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
     nodes->Position = Math::Lerp(nodesA->Position, nodesB->Position, alpha);
     nodes->Length = Math::Lerp(nodesA->Length, nodesB->Length, alpha);
@@ -699,11 +713,11 @@ void AnimGraphExecutor::ProcessGroupParameters(Box* box, Node* node, Value& valu
     // Get
     case 1:
     {
-        // Get parameter
-        int32 paramIndex;
-        const auto param = _graph.GetParameter((Guid)node->Values[0], paramIndex);
-        if (param)
+        // Get parameter (index is resolved on graph load)
+        const int32 paramIndex = ((AnimGraphNode*)node)->Data.Parameter.ParameterIndex;
+        if (paramIndex >= 0 && paramIndex < _graph.Parameters.Count())
         {
+            const auto param = &_graph.Parameters[paramIndex];
             value = context.Data->Parameters[paramIndex].Value;
             switch (param->Type.Type)
             {
@@ -829,7 +843,7 @@ void AnimGraphExecutor::ProcessGroupTools(Box* box, Node* nodeBase, Value& value
 void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Value& value)
 {
     auto& context = *Context.Get();
-    if (context.ValueCache.TryGet(boxBase, value))
+    if (context.TryGetCachedValue(boxBase, value))
         return;
     auto box = (AnimGraphBox*)boxBase;
     auto node = (AnimGraphNode*)nodeBase;
@@ -929,7 +943,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             value = Value::Null;
             if (inputBox->HasConnection())
                 value = eatBox(nodeBase, inputBox->FirstConnection());
-            context.ValueCache.Add(boxBase, value);
+            context.SetCachedValue(boxBase, value);
             return;
         }
         const auto nodeIndex = _graph.BaseModel->Skeleton.Bones[boneIndex].NodeIndex;
@@ -1061,7 +1075,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
         {
             // Pass through the input
             value = input;
-            context.ValueCache.Add(boxBase, value);
+            context.SetCachedValue(boxBase, value);
             return;
         }
 
@@ -1122,10 +1136,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             if (!ANIM_GRAPH_IS_VALID_PTR(valueB))
                 nodesB = GetEmptyNodes();
 
-            for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-            {
-                Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-            }
+            PoseBlending::Lerp(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
             Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
             value = nodes;
         }
@@ -1162,22 +1173,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
                 const auto basePoseNodes = static_cast<AnimGraphImpulse*>(valueA.AsPointer);
                 const auto blendPoseNodes = static_cast<AnimGraphImpulse*>(valueB.AsPointer);
                 const auto& refNodes = _graph.BaseModel.Get()->GetNodes();
-                Transform t, basePoseTransform, blendPoseTransform, refTransform;
-                for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-                {
-                    basePoseTransform = basePoseNodes->Nodes[i];
-                    blendPoseTransform = blendPoseNodes->Nodes[i];
-                    refTransform = refNodes[i].LocalTransform;
-
-                    // base + (blend - reference)
-                    t.Translation = basePoseTransform.Translation + (blendPoseTransform.Translation - refTransform.Translation);
-                    auto diff = Quaternion::Invert(refTransform.Orientation) * blendPoseTransform.Orientation;
-                    t.Orientation = basePoseTransform.Orientation * diff;
-                    t.Scale = basePoseTransform.Scale + (blendPoseTransform.Scale - refTransform.Scale);
-
-                    // Lerp base and transform
-                    Transform::Lerp(basePoseTransform, t, alpha, nodes->Nodes[i]);
-                }
+                PoseBlending::BlendAdditive(basePoseNodes->Nodes.Get(), blendPoseNodes->Nodes.Get(), refNodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
                 Transform::Lerp(basePoseNodes->RootMotion, basePoseNodes->RootMotion + blendPoseNodes->RootMotion, alpha, nodes->RootMotion);
                 value = nodes;
             }
@@ -1220,21 +1216,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             const auto nodesB = static_cast<AnimGraphImpulse*>(valueB.AsPointer);
 
             // Blend all nodes masked by the user
-            Transform tA, tB;
-            auto& nodesMask = mask->GetNodesMask();
-            for (int32 nodeIndex = 0; nodeIndex < nodes->Nodes.Count(); nodeIndex++)
-            {
-                tA = nodesA->Nodes[nodeIndex];
-                if (nodesMask[nodeIndex])
-                {
-                    tB = nodesB->Nodes[nodeIndex];
-                    Transform::Lerp(tA, tB, alpha, nodes->Nodes[nodeIndex]);
-                }
-                else
-                {
-                    nodes->Nodes[nodeIndex] = tA;
-                }
-            }
+            PoseBlending::Lerp(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, mask->GetNodesMask(), nodes->Nodes.Get(), nodes->Nodes.Count());
             Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
 
             value = nodes;
@@ -1936,7 +1918,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
                 if (callFunc == function)
                 {
                     value = Value::Zero;
-                    context.ValueCache.Add(boxBase, value);
+                    context.SetCachedValue(boxBase, value);
                     return;
                 }
             }
@@ -1984,7 +1966,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             value = Value::Null;
             if (inputBox->HasConnection())
                 value = eatBox(nodeBase, inputBox->FirstConnection());
-            context.ValueCache.Add(boxBase, value);
+            context.SetCachedValue(boxBase, value);
             return;
         }
         const auto nodes = node->GetNodes(this);
@@ -2053,7 +2035,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
         {
             // Pass through the input
             value = input;
-            context.ValueCache.Add(boxBase, value);
+            context.SetCachedValue(boxBase, value);
             return;
         }
 
@@ -2364,13 +2346,13 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
     default:
         break;
     }
-    context.ValueCache[boxBase] = value;
+    context.SetCachedValue(boxBase, value);
 }
 
 void AnimGraphExecutor::ProcessGroupFunction(Box* boxBase, Node* node, Value& value)
 {
     auto& context = *Context.Get();
-    if (context.ValueCache.TryGet(boxBase, value))
+    if (context.TryGetCachedValue(boxBase, value))
         return;
     switch (node->TypeID)
     {
@@ -2432,7 +2414,7 @@ void AnimGraphExecutor::ProcessGroupFunction(Box* boxBase, Node* node, Value& va
             // Use the default value from the function graph
             value = tryGetValue(node->TryGetBox(1), Value::Zero);
         }
-        context.ValueCache.Add(boxBase, value);
+        context.SetCachedValue(boxBase, value);
         break;
     }
     default:
@@ -0,0 +1,212 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "PoseBlending.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Math/Matrix3x4.h"
+#include "Engine/Graphics/Models/SkeletonData.h"
+
+// Pose kernels process the transformation as 10 floats in SIMD registers (large worlds use double-precision translation so use the scalar version)
+#define POSE_BLENDING_SIMD (USE_SIMD_MATH && !USE_LARGE_WORLDS)
+
+namespace
+{
+    FORCE_INLINE void GetSlerpWeights(float dot, float amount, float& inverse, float& opposite)
+    {
+        // Matches Quaternion::Slerp
+        if (Math::Abs(dot) > 1.0f - ZeroTolerance)
+        {
+            inverse = 1.0f - amount;
+            opposite = amount * Math::Sign(dot);
+        }
+        else
+        {
+            const float acos1 = Math::Acos(Math::Abs(dot));
+            const float invSin = 1.0f / Math::Sin(acos1);
+            inverse = Math::Sin((1.0f - amount) * acos1) * invSin;
+            opposite = Math::Sin(amount * acos1) * invSin * Math::Sign(dot);
+        }
+    }
+
+    FORCE_INLINE float Dot(const float* a, const float* b)
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    }
+
+#if POSE_BLENDING_SIMD
+    static_assert(sizeof(Transform) == sizeof(float) * 10, "Invalid Transform layout for SIMD pose kernels.");
+
+    // Transform floats layout: [0-2] translation, [3-6] orientation, [7-9] scale
+    // Translation and scale are loaded with one extra lane (orientation X or W) that is overwritten by the orientation store at the end
+
+    FORCE_INLINE SimdVector4 LerpSimd(SimdVector4 a, SimdVector4 b, SimdVector4 alpha)
+    {
+        return SIMD::MulAdd(SIMD::Sub(b, a), alpha, a);
+    }
+
+    FORCE_INLINE SimdVector4 QuaternionMultiplySimd(SimdVector4 l, SimdVector4 r)
+    {
+        // Matches Quaternion::Multiply
+        const SimdVector4 rx = SIMD::Mul(SIMD::Shuffle<3, 2, 1, 0>(r), SIMD::Load(1.0f, -1.0f, 1.0f, -1.0f));
+        const SimdVector4 ry = SIMD::Mul(SIMD::Shuffle<2, 3, 0, 1>(r), SIMD::Load(1.0f, 1.0f, -1.0f, -1.0f));
+        const SimdVector4 rz = SIMD::Mul(SIMD::Shuffle<1, 0, 3, 2>(r), SIMD::Load(-1.0f, 1.0f, 1.0f, -1.0f));
+        SimdVector4 v = SIMD::Mul(SIMD::SplatLane<3>(l), r);
+        v = SIMD::MulAdd(SIMD::SplatLane<0>(l), rx, v);
+        v = SIMD::MulAdd(SIMD::SplatLane<1>(l), ry, v);
+        v = SIMD::MulAdd(SIMD::SplatLane<2>(l), rz, v);
+        return v;
+    }
+
+    FORCE_INLINE SimdVector4 QuaternionNormalizeSimd(SimdVector4 q)
+    {
+        SimdVector4 lengthSq = SIMD::Mul(q, q);
+        lengthSq = SIMD::Add(lengthSq, SIMD::Shuffle<1, 0, 3, 2>(lengthSq));
+        lengthSq = SIMD::Add(lengthSq, SIMD::Shuffle<2, 3, 0, 1>(lengthSq));
+        const SimdVector4 length = SIMD::Max(SIMD::Sqrt(lengthSq), SIMD::Splat(ZeroTolerance));
+        return SIMD::Div(q, length);
+    }
+
+    FORCE_INLINE SimdVector4 CrossSimd(SimdVector4 a, SimdVector4 b)
+    {
+        const SimdVector4 v = SIMD::Mul(SIMD::Shuffle<1, 2, 0, 3>(a), SIMD::Shuffle<2, 0, 1, 3>(b));
+        return SIMD::Sub(v, SIMD::Mul(SIMD::Shuffle<2, 0, 1, 3>(a), SIMD::Shuffle<1, 2, 0, 3>(b)));
+    }
+
+    FORCE_INLINE SimdVector4 RotateSimd(SimdVector4 q, SimdVector4 v)
+    {
+        // v' = v + w * t + cross(q, t), where t = 2 * cross(q, v)
+        const SimdVector4 t = SIMD::Mul(CrossSimd(q, v), SIMD::Splat(2.0f));
+        return SIMD::Add(SIMD::MulAdd(SIMD::SplatLane<3>(q), t, v), CrossSimd(q, t));
+    }
+
+    FORCE_INLINE void LerpNode(const float* a, const float* b, float alpha, float* result)
+    {
+        const SimdVector4 alphaV = SIMD::Splat(alpha);
+        const SimdVector4 translation = LerpSimd(SIMD::LoadUnaligned(a), SIMD::LoadUnaligned(b), alphaV);
+        const SimdVector4 scale = LerpSimd(SIMD::LoadUnaligned(a + 6), SIMD::LoadUnaligned(b + 6), alphaV);
+        float inverse, opposite;
+        GetSlerpWeights(Dot(a + 3, b + 3), alpha, inverse, opposite);
+        const SimdVector4 orientation = SIMD::MulAdd(SIMD::Splat(inverse), SIMD::LoadUnaligned(a + 3), SIMD::Mul(SIMD::Splat(opposite), SIMD::LoadUnaligned(b + 3)));
+        SIMD::StoreUnaligned(result, translation);
+        SIMD::StoreUnaligned(result + 6, scale);
+        SIMD::StoreUnaligned(result + 3, orientation);
+    }
+#endif
+}
+
+void PoseBlending::Lerp(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count)
+{
+#if POSE_BLENDING_SIMD
+    for (int32 i = 0; i < count; i++)
+        LerpNode((const float*)(a + i), (const float*)(b + i), alpha, (float*)(result + i));
+#else
+    for (int32 i = 0; i < count; i++)
+        Transform::Lerp(a[i], b[i], alpha, result[i]);
+#endif
+}
+
+void PoseBlending::Lerp(const Transform* a, const Transform* b, float alpha, const BitArray<>& mask, Transform* result, int32 count)
+{
+    for (int32 i = 0; i < count; i++)
+    {
+        if (mask.Get(i))
+        {
+#if POSE_BLENDING_SIMD
+            LerpNode((const float*)(a + i), (const float*)(b + i), alpha, (float*)(result + i));
+#else
+            Transform::Lerp(a[i], b[i], alpha, result[i]);
+#endif
+        }
+        else if (result != a)
+        {
+            result[i] = a[i];
+        }
+    }
+}
+
+void PoseBlending::BlendAdditive(const Transform* base, const Transform* additive, const SkeletonNode* reference, float alpha, Transform* result, int32 count)
+{
+    for (int32 i = 0; i < count; i++)
+    {
+        const Transform& refTransform = reference[i].LocalTransform;
+        const Quaternion diff = Quaternion::Invert(refTransform.Orientation) * additive[i].Orientation;
+#if POSE_BLENDING_SIMD
+        // lerp(base, base + delta, alpha) = base + delta * alpha
+        const float* b = (const float*)(base + i);
+        const float* add = (const float*)(additive + i);
+        const float* ref = (const float*)&refTransform;
+        float* r = (float*)(result + i);
+        const SimdVector4 alphaV = SIMD::Splat(alpha);
+        const SimdVector4 translation = SIMD::MulAdd(SIMD::Sub(SIMD::LoadUnaligned(add), SIMD::LoadUnaligned(ref)), alphaV, SIMD::LoadUnaligned(b));
+        const SimdVector4 scale = SIMD::MulAdd(SIMD::Sub(SIMD::LoadUnaligned(add + 6), SIMD::LoadUnaligned(ref + 6)), alphaV, SIMD::LoadUnaligned(b + 6));
+        const SimdVector4 baseOrientation = SIMD::LoadUnaligned(b + 3);
+        const SimdVector4 targetOrientation = QuaternionMultiplySimd(baseOrientation, SIMD::LoadUnaligned(&diff.X));
+        Quaternion target;
+        SIMD::StoreUnaligned(&target.X, targetOrientation);
+        float inverse, opposite;
+        GetSlerpWeights(Dot(b + 3, &target.X), alpha, inverse, opposite);
+        const SimdVector4 orientation = SIMD::MulAdd(SIMD::Splat(inverse), baseOrientation, SIMD::Mul(SIMD::Splat(opposite), targetOrientation));
+        SIMD::StoreUnaligned(r, translation);
+        SIMD::StoreUnaligned(r + 6, scale);
+        SIMD::StoreUnaligned(r + 3, orientation);
+#else
+        const Transform& baseTransform = base[i];
+        Transform t;
+        t.Translation = baseTransform.Translation + (additive[i].Translation - refTransform.Translation);
+        t.Orientation = baseTransform.Orientation * diff;
+        t.Scale = baseTransform.Scale + (additive[i].Scale - refTransform.Scale);
+        Transform::Lerp(baseTransform, t, alpha, result[i]);
+#endif
+    }
+}
+
+void PoseBlending::NormalizeRotations(Transform* nodes, int32 count)
+{
+#if POSE_BLENDING_SIMD
+    for (int32 i = 0; i < count; i++)
+    {
+        float* orientation = &nodes[i].Orientation.X;
+        SIMD::StoreUnaligned(orientation, QuaternionNormalizeSimd(SIMD::LoadUnaligned(orientation)));
+    }
+#else
+    for (int32 i = 0; i < count; i++)
+        nodes[i].Orientation.Normalize();
+#endif
+}
+
+void PoseBlending::LocalToModel(Transform* nodes, const SkeletonNode* skeleton, int32 count, Matrix* matrices)
+{
+    for (int32 i = 0; i < count; i++)
+    {
+        const int32 parentIndex = skeleton[i].ParentIndex;
+        if (parentIndex != -1)
+        {
+#if POSE_BLENDING_SIMD
+            const float* parent = (const float*)(nodes + parentIndex);
+            float* node = (float*)(nodes + i);
+            const SimdVector4 parentOrientation = SIMD::LoadUnaligned(parent + 3);
+            const SimdVector4 parentScale = SIMD::LoadUnaligned(parent + 6);
+            const SimdVector4 orientation = QuaternionNormalizeSimd(QuaternionMultiplySimd(parentOrientation, SIMD::LoadUnaligned(node + 3)));
+            const SimdVector4 scale = SIMD::Mul(parentScale, SIMD::LoadUnaligned(node + 6));
+            const SimdVector4 translation = SIMD::Mul(SIMD::LoadUnaligned(node), SIMD::Shuffle<1, 2, 3, 0>(parentScale));
+            SIMD::StoreUnaligned(node, SIMD::Add(RotateSimd(parentOrientation, translation), SIMD::LoadUnaligned(parent)));
+            SIMD::StoreUnaligned(node + 6, scale);
+            SIMD::StoreUnaligned(node + 3, orientation);
+#else
+            nodes[parentIndex].LocalToWorld(nodes[i], nodes[i]);
+#endif
+        }
+        if (matrices)
+            nodes[i].GetWorld(matrices[i]);
+    }
+}
+
+void PoseBlending::GetBoneMatrices(const SkeletonBone* bones, const Matrix* nodesPose, Matrix3x4* output, int32 count)
+{
+    Matrix matrix;
+    for (int32 i = 0; i < count; i++)
+    {
+        const SkeletonBone& bone = bones[i];
+        Matrix::Multiply(bone.OffsetMatrix, nodesPose[bone.NodeIndex], matrix);
+        output[i].SetMatrixTranspose(matrix);
+    }
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Collections/BitArray.h"
+
+struct Matrix3x4;
+struct SkeletonNode;
+struct SkeletonBone;
+
+/// <summary>
+/// The skeleton poses processing utility library. Batched kernels that process the whole pose at once (using SIMD when available) for the animation blending, global pose and skinning matrices calculation.
+/// </summary>
+class FLAXENGINE_API PoseBlending
+{
+public:
+    /// <summary>
+    /// Blends two poses (linear interpolation of the translation and scale, spherical interpolation of the rotation). Result can be the same buffer as any of the inputs.
+    /// </summary>
+    /// <param name="a">The first pose nodes.</param>
+    /// <param name="b">The second pose nodes.</param>
+    /// <param name="alpha">The blend weight (0 for the first pose, 1 for the second pose).</param>
+    /// <param name="result">The output pose nodes.</param>
+    /// <param name="count">The amount of nodes to process.</param>
+    static void Lerp(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count);
+
+    /// <summary>
+    /// Blends two poses only for the nodes enabled in the mask (other nodes use the first pose). Result can be the same buffer as any of the inputs.
+    /// </summary>
+    /// <param name="a">The first pose nodes.</param>
+    /// <param name="b">The second pose nodes.</param>
+    /// <param name="alpha">The blend weight (0 for the first pose, 1 for the second pose).</param>
+    /// <param name="mask">The nodes mask (true to blend the node).</param>
+    /// <param name="result">The output pose nodes.</param>
+    /// <param name="count">The amount of nodes to process.</param>
+    static void Lerp(const Transform* a, const Transform* b, float alpha, const BitArray<>& mask, Transform* result, int32 count);
+
+    /// <summary>
+    /// Applies the additive pose (relative to the reference pose) on top of the base pose: result = lerp(base, base + (additive - reference), alpha).
+    /// </summary>
+    /// <param name="base">The base pose nodes.</param>
+    /// <param name="additive">The additive pose nodes.</param>
+    /// <param name="reference">The skeleton nodes with the reference pose.</param>
+    /// <param name="alpha">The additive pose weight.</param>
+    /// <param name="result">The output pose nodes.</param>
+    /// <param name="count">The amount of nodes to process.</param>
+    static void BlendAdditive(const Transform* base, const Transform* additive, const SkeletonNode* reference, float alpha, Transform* result, int32 count);
+
+    /// <summary>
+    /// Normalizes the rotations of the pose nodes.
+    /// </summary>
+    /// <param name="nodes">The pose nodes.</param>
+    /// <param name="count">The amount of nodes to process.</param>
+    static void NormalizeRotations(Transform* nodes, int32 count);
+
+    /// <summary>
+    /// Converts the pose nodes from the local space (relative to the parent node) into the model space (in-place). Assumes that skeleton nodes are sorted (parents first).
+    /// </summary>
+    /// <param name="nodes">The pose nodes.</param>
+    /// <param name="skeleton">The skeleton nodes (for the hierarchy).</param>
+    /// <param name="count">The amount of nodes to process.</param>
+    /// <param name="matrices">The optional output nodes matrices (in model space).</param>
+    static void LocalToModel(Transform* nodes, const SkeletonNode* skeleton, int32 count, Matrix* matrices = nullptr);
+
+    /// <summary>
+    /// Calculates the skinning matrices for the bones (bone offset matrix combined with the node pose).
+    /// </summary>
+    /// <param name="bones">The skeleton bones.</param>
+    /// <param name="nodesPose">The skeleton nodes matrices (in model space).</param>
+    /// <param name="output">The output bone matrices (transposed, as used by the skinning shaders).</param>
+    /// <param name="count">The amount of bones to process.</param>
+    static void GetBoneMatrices(const SkeletonBone* bones, const Matrix* nodesPose, Matrix3x4* output, int32 count);
+};
@@ -75,7 +75,7 @@ void SceneAnimationPlayer::Play()
             _time = StartTime;
         }
 
-        GetSceneRendering()->AddPostFxProvider(this);
+        GetSceneRendering()->AddPostFxProvider(this, _postFxHandle);
     }
 
     _state = PlayState::Playing;
@@ -135,7 +135,7 @@ void SceneAnimationPlayer::Stop()
             audioSource->Stop();
     }
 
-    GetSceneRendering()->RemovePostFxProvider(this);
+    GetSceneRendering()->RemovePostFxProvider(_postFxHandle);
     _state = PlayState::Stopped;
     _time = _lastTime = 0.0f;
     _tracksDataStack.Resize(0);
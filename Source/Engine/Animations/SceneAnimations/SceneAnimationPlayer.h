@@ -58,6 +58,7 @@ class FLAXENGINE_API SceneAnimationPlayer : public Actor, public IPostFxSettings
     float _time = 0.0f;
     float _lastTime = 0.0f;
     PlayState _state = PlayState::Stopped;
+    PoolHandle _postFxHandle;
     Array<TrackInstance> _tracks;
     Array<byte> _tracksDataStack;
     Array<Actor*> _subActors;
@@ -3,11 +3,16 @@
 #include "Audio.h"
 #include "AudioBackend.h"
 #include "AudioSettings.h"
+#include "AudioClip.h"
+#include "AudioSource.h"
+#include "AudioListener.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "FlaxEngine.Gen.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/BinaryModule.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Core/Log.h"
@@ -36,6 +41,24 @@ float AudioDataInfo::GetLength() const
     return (float)NumSamples / (float)Math::Max(1U, SampleRate * NumChannels);
 }
 
+void AudioBackend::Source_UpdateBatch(const AudioSourcesUpdate& batch)
+{
+    // Fallback for backends without batched updates support
+    for (int32 i = 0; i < batch.Count(); i++)
+    {
+        const uint32 sourceID = batch.SourceIDs[i];
+        const byte dirtyFlags = batch.DirtyFlags[i];
+        if (dirtyFlags & AudioSourcesUpdate::Transform)
+            Source_TransformChanged(sourceID, batch.Positions[i], batch.Orientations[i]);
+        if (dirtyFlags & AudioSourcesUpdate::Velocity)
+            Source_VelocityChanged(sourceID, batch.Velocities[i]);
+        if (dirtyFlags & AudioSourcesUpdate::Volume)
+            Source_VolumeChanged(sourceID, batch.Volumes[i]);
+        if (dirtyFlags & AudioSourcesUpdate::Pitch)
+            Source_PitchChanged(sourceID, batch.Pitches[i]);
+    }
+}
+
 Array<AudioListener*> Audio::Listeners;
 Array<AudioSource*> Audio::Sources;
 Array<AudioDevice> Audio::Devices;
@@ -50,6 +73,26 @@ namespace
     int32 ActiveDeviceIndex = -1;
     bool MuteOnFocusLoss = true;
     bool EnableHRTF = true;
+    int32 MaxVoices = 0;
+    float VirtualVoiceVolume = 0.0f;
+    Array<int32> MaxCategoryVoices;
+
+    struct VoiceCandidate
+    {
+        AudioSource* Source;
+        float Audibility;
+        float Score;
+        bool Real;
+
+        bool operator<(const VoiceCandidate& other) const
+        {
+            // Sort from the most important
+            return Score > other.Score;
+        }
+    };
+
+    Array<VoiceCandidate> VoiceCandidates;
+    Array<int32> CategoryVoices;
 }
 
 class AudioService : public EngineService
@@ -59,11 +102,16 @@ class AudioService : public EngineService
     AudioService()
         : EngineService(TEXT("Audio"), -50)
     {
+        // Audio device setup can take a while so run it in parallel with the graphics and scripting init
+        InitAsync = true;
     }
 
     bool Init() override;
     void Update() override;
     void Dispose() override;
+
+private:
+    void UpdateVoices();
 };
 
 AudioService AudioServiceInstance;
@@ -79,11 +127,34 @@ namespace
     {
         AudioBackend::SetVolume(Volume);
     }
+
+    float GetAudibility(AudioSource* source)
+    {
+        float volume = source->GetVolume();
+        if (Audio::Listeners.HasItems() && source->Is3D())
+        {
+            // Match the inverse distance clamped attenuation model to the closest listener
+            const Vector3 position = source->GetPosition();
+            Real distance = MAX_Real;
+            for (const AudioListener* listener : Audio::Listeners)
+                distance = Math::Min(distance, Vector3::Distance(position, listener->GetPosition()));
+            const float minDistance = source->GetMinDistance();
+            if ((float)distance > minDistance)
+                volume *= minDistance / Math::Max(minDistance + source->GetAttenuation() * ((float)distance - minDistance), ZeroTolerance);
+        }
+        return volume;
+    }
 }
 
 void AudioSettings::Apply()
 {
     ::MuteOnFocusLoss = MuteOnFocusLoss;
+    AudioClip::StreamingLookahead = StreamingLookahead;
+    ::MaxVoices = MaxVoices;
+    ::VirtualVoiceVolume = VirtualVoiceVolume;
+    ::MaxCategoryVoices.Resize(VoiceCategories.Count());
+    for (int32 i = 0; i < VoiceCategories.Count(); i++)
+        ::MaxCategoryVoices[i] = VoiceCategories[i].MaxVoices;
     if (AudioBackend::Instance != nullptr)
     {
         Audio::SetDopplerFactor(DopplerFactor);
@@ -151,6 +222,7 @@ void Audio::SetEnableHRTF(bool value)
 bool AudioService::Init()
 {
     PROFILE_CPU_NAMED("Audio.Init");
+    PROFILE_MEM(Audio);
     const auto settings = AudioSettings::Get();
     const bool mute = CommandLine::Options.Mute.IsTrue() || settings->DisableAudio;
 
@@ -211,6 +283,7 @@ bool AudioService::Init()
 void AudioService::Update()
 {
     PROFILE_CPU_NAMED("Audio.Update");
+    PROFILE_MEM(Audio);
 
     // Update the master volume
     float masterVolume = MasterVolume;
@@ -225,9 +298,71 @@ void AudioService::Update()
         AudioBackend::SetVolume(masterVolume);
     }
 
+    UpdateVoices();
+    AudioSource::UpdateBackendBatch();
+
     AudioBackend::Update();
 }
 
+void AudioService::UpdateVoices()
+{
+    PROFILE_CPU_NAMED("Audio.UpdateVoices");
+    bool useCategories = false;
+    for (int32 maxVoices : MaxCategoryVoices)
+        useCategories |= maxVoices > 0;
+    const bool enabled = MaxVoices > 0 || VirtualVoiceVolume > 0.0f || useCategories;
+
+    // Gather playing sources
+    VoiceCandidates.Clear();
+    for (AudioSource* source : Audio::Sources)
+    {
+        if (source->GetState() != AudioSource::States::Playing)
+            continue;
+        if (!enabled)
+        {
+            // Voices limiting got disabled so restore all virtual sources
+            source->Devirtualize();
+            continue;
+        }
+        auto& e = VoiceCandidates.AddOne();
+        e.Source = source;
+        e.Audibility = GetAudibility(source);
+        e.Score = source->GetPriority() * e.Audibility;
+    }
+    if (VoiceCandidates.IsEmpty())
+        return;
+
+    // Assign real voices to the most important sources
+    Sorting::QuickSort(VoiceCandidates.Get(), VoiceCandidates.Count());
+    CategoryVoices.Resize(MaxCategoryVoices.Count());
+    CategoryVoices.SetAll(0);
+    int32 voices = 0;
+    for (auto& e : VoiceCandidates)
+    {
+        const int32 category = e.Source->GetVoiceCategory();
+        const int32 maxCategoryVoices = category < MaxCategoryVoices.Count() ? MaxCategoryVoices[category] : 0;
+        e.Real = e.Audibility >= VirtualVoiceVolume && (MaxVoices <= 0 || voices < MaxVoices) && (maxCategoryVoices <= 0 || CategoryVoices[category] < maxCategoryVoices);
+        if (e.Real)
+        {
+            voices++;
+            if (category < CategoryVoices.Count())
+                CategoryVoices[category]++;
+        }
+    }
+
+    // Release voices before acquiring the new ones to stay within the audio backend limits
+    for (const auto& e : VoiceCandidates)
+    {
+        if (!e.Real)
+            e.Source->Virtualize();
+    }
+    for (const auto& e : VoiceCandidates)
+    {
+        if (e.Real)
+            e.Source->Devirtualize();
+    }
+}
+
 void AudioService::Dispose()
 {
     ASSERT(Audio::Sources.IsEmpty() && Audio::Listeners.IsEmpty());
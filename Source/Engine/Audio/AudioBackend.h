@@ -5,6 +5,59 @@
 #include "Config.h"
 #include "Types.h"
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
+
+/// <summary>
+/// The batched update of the audio sources parameters (stored as structure of arrays). Used to submit changes of many sources to the audio backend at once.
+/// </summary>
+struct AudioSourcesUpdate
+{
+    enum Flags : byte
+    {
+        None = 0,
+        Transform = 1,
+        Velocity = 2,
+        Volume = 4,
+        Pitch = 8,
+    };
+
+    Array<uint32> SourceIDs;
+    Array<byte> DirtyFlags;
+    Array<Vector3> Positions;
+    Array<Quaternion> Orientations;
+    Array<Vector3> Velocities;
+    Array<float> Volumes;
+    Array<float> Pitches;
+
+    FORCE_INLINE int32 Count() const
+    {
+        return SourceIDs.Count();
+    }
+
+    void Clear()
+    {
+        SourceIDs.Clear();
+        DirtyFlags.Clear();
+        Positions.Clear();
+        Orientations.Clear();
+        Velocities.Clear();
+        Volumes.Clear();
+        Pitches.Clear();
+    }
+
+    void Add(uint32 sourceID, byte dirtyFlags, const Vector3& position, const Quaternion& orientation, const Vector3& velocity, float volume, float pitch)
+    {
+        SourceIDs.Add(sourceID);
+        DirtyFlags.Add(dirtyFlags);
+        Positions.Add(position);
+        Orientations.Add(orientation);
+        Velocities.Add(velocity);
+        Volumes.Add(volume);
+        Pitches.Add(pitch);
+    }
+};
 
 /// <summary>
 /// The helper class for that handles active audio backend operations.
@@ -51,6 +104,7 @@ class AudioBackend
     virtual void Source_GetQueuedBuffersCount(uint32 sourceID, int32& queuedBuffersCount) = 0;
     virtual void Source_QueueBuffer(uint32 sourceID, uint32 bufferID) = 0;
     virtual void Source_DequeueProcessedBuffers(uint32 sourceID) = 0;
+    virtual void Source_UpdateBatch(const AudioSourcesUpdate& batch);
 
     // Buffer
     virtual uint32 Buffer_Create() = 0;
@@ -194,6 +248,11 @@ class AudioBackend
         {
             Instance->Source_DequeueProcessedBuffers(sourceID);
         }
+
+        FORCE_INLINE static void UpdateBatch(const AudioSourcesUpdate& batch)
+        {
+            Instance->Source_UpdateBatch(batch);
+        }
     };
 
     class Buffer
@@ -13,9 +13,136 @@
 #include "Engine/Tools/AudioTool/OggVorbisDecoder.h"
 #include "Engine/Tools/AudioTool/AudioTool.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 REGISTER_BINARY_ASSET_WITH_UPGRADER(AudioClip, "FlaxEngine.AudioClip", AudioClipUpgrader, false);
 
+// The maximum amount of the pooled PCM buffers used for audio data decoding
+#define AUDIO_CLIP_MAX_POOLED_BUFFERS 16
+
+float AudioClip::StreamingLookahead = 2.0f;
+
+namespace
+{
+    // Pool of the PCM buffers reused between the audio chunks decoding (avoids allocations churn when streaming many voices)
+    CriticalSection DecodeBuffersLocker;
+    Array<Array<byte>*> DecodeBuffers;
+
+    Array<byte>* AcquireDecodeBuffer(int32 size)
+    {
+        Array<byte>* result = nullptr;
+        DecodeBuffersLocker.Lock();
+        int32 bestIndex = -1;
+        for (int32 i = 0; i < DecodeBuffers.Count(); i++)
+        {
+            // Pick the smallest buffer that fits the chunk or the largest one otherwise
+            const int32 capacity = DecodeBuffers[i]->Capacity();
+            const int32 bestCapacity = bestIndex != -1 ? DecodeBuffers[bestIndex]->Capacity() : -1;
+            const bool fits = capacity >= size, bestFits = bestCapacity >= size;
+            if (bestIndex == -1 || (fits ? !bestFits || capacity < bestCapacity : !bestFits && capacity > bestCapacity))
+                bestIndex = i;
+        }
+        if (bestIndex != -1)
+        {
+            result = DecodeBuffers[bestIndex];
+            DecodeBuffers.RemoveAt(bestIndex);
+        }
+        DecodeBuffersLocker.Unlock();
+        if (!result)
+            result = New<Array<byte>>();
+        result->EnsureCapacity(size, false);
+        return result;
+    }
+
+    void ReleaseDecodeBuffer(Array<byte>* buffer)
+    {
+        if (!buffer)
+            return;
+        buffer->Clear();
+        DecodeBuffersLocker.Lock();
+        if (DecodeBuffers.Count() < AUDIO_CLIP_MAX_POOLED_BUFFERS)
+        {
+            DecodeBuffers.Add(buffer);
+            buffer = nullptr;
+        }
+        DecodeBuffersLocker.Unlock();
+        Delete(buffer);
+    }
+
+    struct DecodedChunk
+    {
+        int32 ChunkIndex;
+        bool Failed;
+        Span<byte> Data;
+        AudioDataInfo Info;
+        Array<byte>* Buffer;
+        Array<byte>* MonoBuffer;
+    };
+
+    bool DecodeChunk(const AudioClip* clip, DecodedChunk& result)
+    {
+        PROFILE_CPU_NAMED("Audio.DecodeChunk");
+        const auto chunk = clip->GetChunk(result.ChunkIndex);
+        if (chunk == nullptr || chunk->IsMissing())
+        {
+            LOG(Warning, "Missing audio data.");
+            return true;
+        }
+        Span<byte> data;
+        AudioDataInfo info = clip->AudioHeader.Info;
+        const uint32 bytesPerSample = info.BitDepth / 8;
+
+        // Get raw data or decompress it
+        switch (clip->Format())
+        {
+        case AudioFormat::Vorbis:
+        {
+#if COMPILE_WITH_OGG_VORBIS
+            result.Buffer = AcquireDecodeBuffer(clip->AudioHeader.SamplesPerChunk[result.ChunkIndex] * bytesPerSample);
+            OggVorbisDecoder decoder;
+            MemoryReadStream stream(chunk->Get(), chunk->Size());
+            AudioDataInfo tmpInfo;
+            if (decoder.Convert(&stream, tmpInfo, *result.Buffer))
+            {
+                LOG(Warning, "Audio data decode failed (OggVorbisDecoder).");
+                return true;
+            }
+            // TODO: validate decompressed data header info?
+            data = Span<byte>(result.Buffer->Get(), result.Buffer->Count());
+#else
+            LOG(Warning, "OggVorbisDecoder is disabled.");
+            return true;
+#endif
+        }
+        break;
+        case AudioFormat::Raw:
+            data = Span<byte>(chunk->Get(), chunk->Size());
+            break;
+        default:
+            return true;
+        }
+        info.NumSamples = Math::AlignDown(data.Length() / bytesPerSample, info.NumChannels * bytesPerSample);
+
+        // Convert to Mono if used as 3D source and backend doesn't support it
+        if (clip->Is3D() && info.NumChannels > 1 && EnumHasNoneFlags(AudioBackend::Features(), AudioBackend::FeatureFlags::SpatialMultiChannel))
+        {
+            const uint32 samplesPerChannel = info.NumSamples / info.NumChannels;
+            const uint32 monoBufferSize = samplesPerChannel * bytesPerSample;
+            result.MonoBuffer = AcquireDecodeBuffer(monoBufferSize);
+            result.MonoBuffer->Resize(monoBufferSize, false);
+            AudioTool::ConvertToMono(data.Get(), result.MonoBuffer->Get(), info.BitDepth, samplesPerChannel, info.NumChannels);
+            info.NumChannels = 1;
+            info.NumSamples = samplesPerChannel;
+            data = Span<byte>(result.MonoBuffer->Get(), result.MonoBuffer->Count());
+        }
+
+        result.Data = data;
+        result.Info = info;
+        return false;
+    }
+}
+
 bool AudioClip::StreamingTask::Run()
 {
     AssetReference<AudioClip> ref = _asset.Get();
@@ -45,12 +172,9 @@ bool AudioClip::StreamingTask::Run()
     }
 
     // Load missing buffers data (from asset chunks)
-    for (int32 i = 0; i < queue.Count(); i++)
+    if (clip->WriteBuffers(ToSpan(queue.Get(), queue.Count())))
     {
-        if (clip->WriteBuffer(queue[i]))
-        {
-            return true;
-        }
+        return true;
     }
 
     // Update the sources
@@ -413,69 +537,55 @@ void AudioClip::unload(bool isReloading)
 
 bool AudioClip::WriteBuffer(int32 chunkIndex)
 {
-    // Ignore if buffer is not created
-    const uint32 bufferID = Buffers[chunkIndex];
-    if (bufferID == 0)
-        return false;
+    return WriteBuffers(ToSpan(&chunkIndex, 1));
+}
 
+bool AudioClip::WriteBuffers(const Span<int32>& chunkIndices)
+{
     // Ensure audio backend exists
     if (AudioBackend::Instance == nullptr)
         return true;
 
-    const auto chunk = GetChunk(chunkIndex);
-    if (chunk == nullptr || chunk->IsMissing())
+    // Ignore buffers that are not created
+    DecodedChunk chunks[ASSET_FILE_DATA_CHUNKS];
+    int32 chunksCount = 0;
+    for (const int32 chunkIndex : chunkIndices)
     {
-        LOG(Warning, "Missing audio data.");
-        return true;
+        if (Buffers[chunkIndex] == 0)
+            continue;
+        DecodedChunk& chunk = chunks[chunksCount++];
+        chunk.ChunkIndex = chunkIndex;
+        chunk.Failed = false;
+        chunk.Buffer = nullptr;
+        chunk.MonoBuffer = nullptr;
     }
-    Span<byte> data;
-    Array<byte> tmp1, tmp2;
-    AudioDataInfo info = AudioHeader.Info;
-    const uint32 bytesPerSample = info.BitDepth / 8;
 
-    // Get raw data or decompress it
-    switch (Format())
+    // Decode chunks (in parallel if there are many compressed ones)
+    if (chunksCount > 1 && Format() != AudioFormat::Raw)
     {
-    case AudioFormat::Vorbis:
-    {
-#if COMPILE_WITH_OGG_VORBIS
-        OggVorbisDecoder decoder;
-        MemoryReadStream stream(chunk->Get(), chunk->Size());
-        AudioDataInfo tmpInfo;
-        if (decoder.Convert(&stream, tmpInfo, tmp1))
+        const int64 label = JobSystem::Dispatch([this, &chunks](int32 i)
         {
-            LOG(Warning, "Audio data decode failed (OggVorbisDecoder).");
-            return true;
-        }
-        // TODO: validate decompressed data header info?
-        data = Span<byte>(tmp1.Get(), tmp1.Count());
-#else
-		LOG(Warning, "OggVorbisDecoder is disabled.");
-		return true;
-#endif
+            chunks[i].Failed = DecodeChunk(this, chunks[i]);
+        }, chunksCount);
+        JobSystem::Wait(label);
     }
-    break;
-    case AudioFormat::Raw:
-        data = Span<byte>(chunk->Get(), chunk->Size());
-        break;
-    default:
-        return true;
+    else
+    {
+        for (int32 i = 0; i < chunksCount; i++)
+            chunks[i].Failed = DecodeChunk(this, chunks[i]);
     }
-    info.NumSamples = Math::AlignDown(data.Length() / bytesPerSample, info.NumChannels * bytesPerSample);
 
-    // Convert to Mono if used as 3D source and backend doesn't support it
-    if (Is3D() && info.NumChannels > 1 && EnumHasNoneFlags(AudioBackend::Features(), AudioBackend::FeatureFlags::SpatialMultiChannel))
+    // Write samples to the audio buffers
+    bool failed = false;
+    for (int32 i = 0; i < chunksCount; i++)
     {
-        const uint32 samplesPerChannel = info.NumSamples / info.NumChannels;
-        const uint32 monoBufferSize = samplesPerChannel * bytesPerSample;
-        tmp2.Resize(monoBufferSize);
-        AudioTool::ConvertToMono(data.Get(), tmp2.Get(), info.BitDepth, samplesPerChannel, info.NumChannels);
-        info.NumChannels = 1;
-        info.NumSamples = samplesPerChannel;
-        data = Span<byte>(tmp2.Get(), tmp2.Count());
+        DecodedChunk& chunk = chunks[i];
+        if (chunk.Failed)
+            failed = true;
+        else
+            AudioBackend::Buffer::Write(Buffers[chunk.ChunkIndex], chunk.Data.Get(), chunk.Info);
+        ReleaseDecodeBuffer(chunk.Buffer);
+        ReleaseDecodeBuffer(chunk.MonoBuffer);
     }
-
-    // Write samples to the audio buffer
-    AudioBackend::Buffer::Write(bufferID, data.Get(), info);
-    return false;
+    return failed;
 }
@@ -73,6 +73,10 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     StreamingTask* _streamingTask;
     float _buffersStartTimes[ASSET_FILE_DATA_CHUNKS + 1];
 
+public:
+    // The time (in seconds) of the audio data streamed ahead of the playback position (applied by the AudioSettings).
+    static float StreamingLookahead;
+
 public:
     /// <summary>
     /// Finalizes an instance of the <see cref="AudioClip"/> class.
@@ -207,4 +211,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
 private:
     // Writes audio samples into Audio Backend buffer and handles automatic decompression or format conversion for runtime playback.
     bool WriteBuffer(int32 chunkIndex);
+
+    // Writes audio samples into Audio Backend buffers. Compressed chunks are decoded in parallel using Job System.
+    bool WriteBuffers(const Span<int32>& chunkIndices);
 };
@@ -3,6 +3,31 @@
 #pragma once
 
 #include "Engine/Core/Config/Settings.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The audio voice category properties container. Used to limit the amount of voices played by the audio sources of the same kind (eg. footsteps or ambience).
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API AudioVoiceCategory : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(AudioVoiceCategory);
+
+    /// <summary>
+    /// The category name.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0)")
+    String Name;
+
+    /// <summary>
+    /// The maximum amount of real voices played at once by the sources from this category. Use 0 for no limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(0)")
+    int32 MaxVoices = 0;
+};
 
 /// <summary>
 /// Audio settings container.
@@ -31,6 +56,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(200), DefaultValue(true), EditorDisplay(\"General\", \"Mute On Focus Loss\")")
     bool MuteOnFocusLoss = true;
 
+    /// <summary>
+    /// The time (in seconds) of the audio data streamed ahead of the playback position (for streamable audio clips). Higher values reduce the risk of playback stalls but use more memory.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(250), DefaultValue(2.0f), Limit(0, 60), EditorDisplay(\"General\")")
+    float StreamingLookahead = 2.0f;
+
     /// <summary>
     /// Enables or disables HRTF audio for in-engine processing of 3D audio (if supported by platform).
     /// If enabled, the user should be using two-channel/headphones audio output and have all other surround virtualization disabled (Atmos, DTS:X, vendor specific, etc.)
@@ -38,6 +69,24 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(300), DefaultValue(true), EditorDisplay(\"Spatial Audio\")")
     bool EnableHRTF = true;
 
+    /// <summary>
+    /// The maximum amount of real voices played at once. When exceeded, the sources with the lowest priority multiplied by audibility become virtual (they keep the playback time without using an audio backend voice). Use 0 for no limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(400), DefaultValue(0), Limit(0, 4096), EditorDisplay(\"Voices\")")
+    int32 MaxVoices = 0;
+
+    /// <summary>
+    /// The audibility (volume including distance attenuation) below which playing sources become virtual. Use 0 to disable.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(410), DefaultValue(0.0f), Limit(0, 1, 0.001f), EditorDisplay(\"Voices\")")
+    float VirtualVoiceVolume = 0.0f;
+
+    /// <summary>
+    /// The voice categories with the independent voices limits. Audio sources reference the category by its index.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(420), EditorDisplay(\"Voices\")")
+    Array<AudioVoiceCategory> VoiceCategories;
+
 public:
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
@@ -8,9 +8,17 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "AudioBackend.h"
 #include "Audio.h"
 
+namespace
+{
+    CriticalSection DirtyLocker;
+    Array<AudioSource*> DirtySources;
+    AudioSourcesUpdate DirtyBatch;
+}
+
 AudioSource::AudioSource(const SpawnParams& params)
     : Actor(params)
     , _velocity(Vector3::Zero)
@@ -32,8 +40,7 @@ void AudioSource::SetVolume(float value)
     if (Math::NearEqual(_volume, value))
         return;
     _volume = value;
-    if (SourceID)
-        AudioBackend::Source::VolumeChanged(SourceID, _volume);
+    MarkDirty(AudioSourcesUpdate::Volume);
 }
 
 void AudioSource::SetPitch(float value)
@@ -42,8 +49,7 @@ void AudioSource::SetPitch(float value)
     if (Math::NearEqual(_pitch, value))
         return;
     _pitch = value;
-    if (SourceID)
-        AudioBackend::Source::PitchChanged(SourceID, _pitch);
+    MarkDirty(AudioSourcesUpdate::Pitch);
 }
 
 void AudioSource::SetPan(float value)
@@ -116,6 +122,16 @@ void AudioSource::SetAllowSpatialization(bool value)
         AudioBackend::Source::SpatialSetupChanged(SourceID, Is3D(), _attenuation, _minDistance, _dopplerFactor);
 }
 
+void AudioSource::SetPriority(float value)
+{
+    _priority = Math::Max(0.0f, value);
+}
+
+void AudioSource::SetVoiceCategory(int32 value)
+{
+    _voiceCategory = Math::Max(0, value);
+}
+
 void AudioSource::Play()
 {
     auto state = _state;
@@ -126,6 +142,12 @@ void AudioSource::Play()
         LOG(Warning, "Cannot play audio source without a clip ({0})", GetNamePath());
         return;
     }
+    if (_isVirtual)
+    {
+        // Resume virtual playback (voice will be acquired by the audio service if needed)
+        _state = States::Playing;
+        return;
+    }
 
     if (SourceID == 0)
     {
@@ -192,6 +214,8 @@ void AudioSource::Stop()
 
     _state = States::Stopped;
     _isActuallyPlayingSth = false;
+    _isVirtual = false;
+    _virtualTime = 0.0f;
     _streamingFirstChunk = 0;
     if (SourceID)
         AudioBackend::Source::Stop(SourceID);
@@ -199,6 +223,8 @@ void AudioSource::Stop()
 
 float AudioSource::GetTime() const
 {
+    if (_isVirtual)
+        return _virtualTime;
     if (_state == States::Stopped || SourceID == 0 || !Clip->IsLoaded())
         return 0.0f;
 
@@ -221,6 +247,11 @@ void AudioSource::SetTime(float time)
 {
     if (_state == States::Stopped)
         return;
+    if (_isVirtual)
+    {
+        _virtualTime = Math::Clamp(time, 0.0f, Clip ? Clip->GetLength() : 0.0f);
+        return;
+    }
 
     const bool isActuallyPlayingSth = _isActuallyPlayingSth;
     const auto state = _state;
@@ -316,6 +347,76 @@ void AudioSource::PlayInternal()
     _startingToPlay = true;
 }
 
+void AudioSource::Virtualize()
+{
+    if (_isVirtual || _state == States::Stopped)
+        return;
+    _virtualTime = GetTime();
+    _isVirtual = true;
+    _isActuallyPlayingSth = false;
+    _startingToPlay = false;
+    _needToUpdateStreamingBuffers = false;
+    _streamingFirstChunk = 0;
+
+    // Release the voice
+    if (SourceID)
+    {
+        AudioBackend::Source::Stop(SourceID);
+        AudioBackend::Source::Remove(SourceID);
+        SourceID = 0;
+    }
+}
+
+void AudioSource::MarkDirty(byte flags)
+{
+    if (SourceID == 0)
+        return;
+    DirtyLocker.Lock();
+    if (_dirtyFlags == 0)
+        DirtySources.Add(this);
+    _dirtyFlags |= flags;
+    DirtyLocker.Unlock();
+}
+
+void AudioSource::UpdateBackendBatch()
+{
+    PROFILE_CPU();
+    DirtyLocker.Lock();
+    DirtyBatch.Clear();
+    for (AudioSource* source : DirtySources)
+    {
+        const byte dirtyFlags = source->_dirtyFlags;
+        source->_dirtyFlags = 0;
+        if (source->SourceID == 0)
+            continue;
+        DirtyBatch.Add(source->SourceID, dirtyFlags, source->_transform.Translation, source->_transform.Orientation, source->_velocity, source->_volume, source->_pitch);
+    }
+    DirtySources.Clear();
+    DirtyLocker.Unlock();
+    if (DirtyBatch.Count() != 0)
+        AudioBackend::Source::UpdateBatch(DirtyBatch);
+}
+
+void AudioSource::Devirtualize()
+{
+    if (!_isVirtual)
+        return;
+    const States state = _state;
+    const float time = _virtualTime;
+    _isVirtual = false;
+    _virtualTime = 0.0f;
+
+    // Restart playback from the tracked time
+    _state = States::Stopped;
+    Play();
+    if (_state == States::Stopped)
+        return;
+    if (time > 0.0f)
+        SetTime(time);
+    if (state == States::Paused)
+        Pause();
+}
+
 #if USE_EDITOR
 
 #include "Engine/Debug/DebugDraw.h"
@@ -350,6 +451,8 @@ void AudioSource::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     SERIALIZE_MEMBER(StartTime, _startTime);
     SERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    SERIALIZE_MEMBER(Priority, _priority);
+    SERIALIZE_MEMBER(VoiceCategory, _voiceCategory);
 }
 
 void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -367,6 +470,8 @@ void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     DESERIALIZE_MEMBER(StartTime, _startTime);
     DESERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    DESERIALIZE_MEMBER(Priority, _priority);
+    DESERIALIZE_MEMBER(VoiceCategory, _voiceCategory);
     DESERIALIZE(Clip);
 }
 
@@ -390,9 +495,27 @@ void AudioSource::Update()
     const auto prevVelocity = _velocity;
     _velocity = (pos - _prevPos) / dt;
     _prevPos = pos;
-    if (_velocity != prevVelocity && Is3D())
+    if (_velocity != prevVelocity && SourceID && Is3D())
     {
-        AudioBackend::Source::VelocityChanged(SourceID, _velocity);
+        MarkDirty(AudioSourcesUpdate::Velocity);
+    }
+
+    // Virtual source advances the playback time without the audio backend
+    if (_isVirtual)
+    {
+        if (_state == States::Playing)
+        {
+            const float length = Clip ? Clip->GetLength() : 0.0f;
+            _virtualTime += dt * _pitch;
+            if (_virtualTime >= length)
+            {
+                if (GetIsLooping() && length > ZeroTolerance)
+                    _virtualTime = Math::Mod(_virtualTime, length);
+                else
+                    Stop();
+            }
+        }
+        return;
     }
 
     // Reset starting to play value once time is greater than zero
@@ -542,6 +665,13 @@ void AudioSource::OnDisable()
     GetSceneRendering()->RemoveViewportIcon(this);
 #endif
     GetScene()->Ticking.Update.RemoveTick(this);
+    if (_dirtyFlags)
+    {
+        DirtyLocker.Lock();
+        DirtySources.Remove(this);
+        _dirtyFlags = 0;
+        DirtyLocker.Unlock();
+    }
     if (SourceID)
     {
         AudioBackend::Source::Remove(SourceID);
@@ -563,7 +693,7 @@ void AudioSource::OnTransformChanged()
 
     if (IsActiveInHierarchy() && SourceID && Is3D())
     {
-        AudioBackend::Source::TransformChanged(SourceID, _transform.Translation, _transform.Orientation);
+        MarkDirty(AudioSourcesUpdate::Transform);
     }
 }
 
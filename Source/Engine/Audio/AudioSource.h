@@ -18,6 +18,7 @@ class FLAXENGINE_API AudioSource : public Actor
     DECLARE_SCENE_OBJECT(AudioSource);
     friend class AudioStreamingHandler;
     friend class AudioClip;
+    friend class AudioService;
 
 public:
     /// <summary>
@@ -54,10 +55,15 @@ class FLAXENGINE_API AudioSource : public Actor
     bool _playOnStart;
     float _startTime;
     bool _allowSpatialization;
+    float _priority = 1.0f;
+    int32 _voiceCategory = 0;
 
     bool _isActuallyPlayingSth = false;
     bool _startingToPlay = false;
     bool _needToUpdateStreamingBuffers = false;
+    bool _isVirtual = false;
+    float _virtualTime = 0.0f;
+    byte _dirtyFlags = 0;
     States _state = States::Stopped;
 
     States _savedState = States::Stopped;
@@ -224,6 +230,34 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     API_PROPERTY() void SetAllowSpatialization(bool value);
 
+    /// <summary>
+    /// Gets the voice priority of the source. When the amount of playing sources exceeds the voices limit (see AudioSettings), the sources with the lowest priority multiplied by the audibility become virtual.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(90), DefaultValue(1.0f), Limit(0, float.MaxValue, 0.01f), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE float GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets the voice priority of the source. When the amount of playing sources exceeds the voices limit (see AudioSettings), the sources with the lowest priority multiplied by the audibility become virtual.
+    /// </summary>
+    API_PROPERTY() void SetPriority(float value);
+
+    /// <summary>
+    /// Gets the index of the voice category (from AudioSettings.VoiceCategories) used to limit the amount of voices played by the sources of the same kind.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(95), DefaultValue(0), Limit(0), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE int32 GetVoiceCategory() const
+    {
+        return _voiceCategory;
+    }
+
+    /// <summary>
+    /// Sets the index of the voice category (from AudioSettings.VoiceCategories) used to limit the amount of voices played by the sources of the same kind.
+    /// </summary>
+    API_PROPERTY() void SetVoiceCategory(int32 value);
+
 public:
     /// <summary>
     /// Starts playing the currently assigned audio clip.
@@ -287,6 +321,14 @@ class FLAXENGINE_API AudioSource : public Actor
         return _isActuallyPlayingSth;
     }
 
+    /// <summary>
+    /// Determines whether this audio source is virtual. Virtual sources keep tracking the playback time but don't use the audio backend voice (source is inaudible or has too low priority).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsVirtual() const
+    {
+        return _isVirtual;
+    }
+
     /// <summary>
     /// Requests the audio streaming buffers update. Rises tha flag to synchronize audio backend buffers of the emitter during next game logic update.
     /// </summary>
@@ -301,6 +343,18 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     void PlayInternal();
 
+    // Releases the audio backend voice and tracks the playback time manually.
+    void Virtualize();
+
+    // Acquires the audio backend voice and resumes playback from the tracked time.
+    void Devirtualize();
+
+    // Queues the audio backend parameters update (see AudioSourcesUpdate::Flags) to be submitted within a batch.
+    void MarkDirty(byte flags);
+
+    // Submits the batched parameters update of all dirty sources to the audio backend.
+    static void UpdateBackendBatch();
+
     void Update();
 
 public:
@@ -101,6 +101,10 @@ void AudioBackendNone::Source_DequeueProcessedBuffers(uint32 sourceID)
 {
 }
 
+void AudioBackendNone::Source_UpdateBatch(const AudioSourcesUpdate& batch)
+{
+}
+
 uint32 AudioBackendNone::Buffer_Create()
 {
     return 1;
@@ -36,6 +36,7 @@ class AudioBackendNone : public AudioBackend
     void Source_GetQueuedBuffersCount(uint32 sourceID, int32& queuedBuffersCount) override;
     void Source_QueueBuffer(uint32 sourceID, uint32 bufferID) override;
     void Source_DequeueProcessedBuffers(uint32 sourceID) override;
+    void Source_UpdateBatch(const AudioSourcesUpdate& batch) override;
     uint32 Buffer_Create() override;
     void Buffer_Delete(uint32 bufferID) override;
     void Buffer_Write(uint32 bufferID, byte* samples, const AudioDataInfo& info) override;
@@ -460,6 +460,26 @@ void AudioBackendOAL::Source_DequeueProcessedBuffers(uint32 sourceID)
     ALC_CHECK_ERROR(alSourceUnqueueBuffers);
 }
 
+void AudioBackendOAL::Source_UpdateBatch(const AudioSourcesUpdate& batch)
+{
+    // Suspend context processing to apply all changes at once
+    alcSuspendContext(ALC::Context);
+    for (int32 i = 0; i < batch.Count(); i++)
+    {
+        const uint32 sourceID = batch.SourceIDs[i];
+        const byte dirtyFlags = batch.DirtyFlags[i];
+        if (dirtyFlags & AudioSourcesUpdate::Transform)
+            alSource3f(sourceID, AL_POSITION, FLAX_POS_TO_OAL(batch.Positions[i]));
+        if (dirtyFlags & AudioSourcesUpdate::Velocity)
+            alSource3f(sourceID, AL_VELOCITY, FLAX_VEL_TO_OAL(batch.Velocities[i]));
+        if (dirtyFlags & AudioSourcesUpdate::Volume)
+            alSourcef(sourceID, AL_GAIN, batch.Volumes[i]);
+        if (dirtyFlags & AudioSourcesUpdate::Pitch)
+            alSourcef(sourceID, AL_PITCH, batch.Pitches[i]);
+    }
+    alcProcessContext(ALC::Context);
+}
+
 uint32 AudioBackendOAL::Buffer_Create()
 {
     uint32 bufferID;
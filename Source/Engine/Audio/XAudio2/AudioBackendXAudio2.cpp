@@ -24,6 +24,7 @@
 #define MAX_INPUT_CHANNELS 6
 #define MAX_OUTPUT_CHANNELS 2
 #define MAX_CHANNELS_MATRIX_SIZE (MAX_INPUT_CHANNELS*MAX_OUTPUT_CHANNELS)
+#define XAUDIO2_BATCH_OPERATION_SET 1
 #if ENABLE_ASSERTION
 #define XAUDIO2_CHECK_ERROR(method) \
     if (hr != 0) \
@@ -578,6 +579,46 @@ void AudioBackendXAudio2::Source_DequeueProcessedBuffers(uint32 sourceID)
     }
 }
 
+void AudioBackendXAudio2::Source_UpdateBatch(const AudioSourcesUpdate& batch)
+{
+    bool anyVolume = false;
+    for (int32 i = 0; i < batch.Count(); i++)
+    {
+        auto aSource = XAudio2::GetSource(batch.SourceIDs[i]);
+        if (!aSource)
+            continue;
+        const byte dirtyFlags = batch.DirtyFlags[i];
+        if (dirtyFlags & AudioSourcesUpdate::Transform)
+        {
+            aSource->Position = batch.Positions[i];
+            aSource->Orientation = batch.Orientations[i];
+            aSource->IsDirty = true;
+        }
+        if (dirtyFlags & AudioSourcesUpdate::Velocity)
+        {
+            aSource->Velocity = batch.Velocities[i];
+            aSource->IsDirty = true;
+        }
+        if (dirtyFlags & AudioSourcesUpdate::Pitch)
+        {
+            aSource->Pitch = batch.Pitches[i];
+            aSource->IsDirty = true;
+        }
+        if (dirtyFlags & AudioSourcesUpdate::Volume && aSource->Voice)
+        {
+            aSource->Volume = batch.Volumes[i];
+            const HRESULT hr = aSource->Voice->SetVolume(aSource->Volume, XAUDIO2_BATCH_OPERATION_SET);
+            XAUDIO2_CHECK_ERROR(SetVolume);
+            anyVolume = true;
+        }
+    }
+    if (anyVolume)
+    {
+        const HRESULT hr = XAudio2::Instance->CommitChanges(XAUDIO2_BATCH_OPERATION_SET);
+        XAUDIO2_CHECK_ERROR(CommitChanges);
+    }
+}
+
 uint32 AudioBackendXAudio2::Buffer_Create()
 {
     uint32 bufferID;
@@ -707,8 +748,9 @@ bool AudioBackendXAudio2::Base_Init()
 
 void AudioBackendXAudio2::Base_Update()
 {
-    // Update dirty voices
+    // Update dirty voices (changes are committed at once)
     float outputMatrix[MAX_CHANNELS_MATRIX_SIZE];
+    bool anyDirty = false;
     for (int32 i = 0; i < XAudio2::Sources.Count(); i++)
     {
         auto& source = XAudio2::Sources[i];
@@ -719,10 +761,16 @@ void AudioBackendXAudio2::Base_Update()
         mix.VolumeIntoChannels();
         AudioBackendTools::MapChannels(source.Channels, XAudio2::Channels, mix.Channels, outputMatrix);
 
-        source.Voice->SetFrequencyRatio(mix.Pitch);
-        source.Voice->SetOutputMatrix(XAudio2::MasteringVoice, source.Channels, XAudio2::Channels, outputMatrix);
+        source.Voice->SetFrequencyRatio(mix.Pitch, XAUDIO2_BATCH_OPERATION_SET);
+        source.Voice->SetOutputMatrix(XAudio2::MasteringVoice, source.Channels, XAudio2::Channels, outputMatrix, XAUDIO2_BATCH_OPERATION_SET);
 
         source.IsDirty = false;
+        anyDirty = true;
+    }
+    if (anyDirty)
+    {
+        const HRESULT hr = XAudio2::Instance->CommitChanges(XAUDIO2_BATCH_OPERATION_SET);
+        XAUDIO2_CHECK_ERROR(CommitChanges);
     }
 
     // Clear flag
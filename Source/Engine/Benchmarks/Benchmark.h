@@ -0,0 +1,113 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/Platform.h"
+
+// The amount of the benchmark body executions before measuring (warms up caches, allocators and branch predictors)
+#define BENCHMARK_WARMUP 10
+
+// The amount of the measured benchmark body executions
+#define BENCHMARK_REPETITIONS 100
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+#define BENCHMARK_CASE_IMPL(name, func) \
+    static void func(); \
+    static Benchmark::Registration BENCHMARK_CONCAT(func, Registration)(name, &func); \
+    static void func()
+
+// Declares the benchmark case (a group of measurements) that is automatically registered and run by the benchmarks runner.
+#define BENCHMARK_CASE(name) BENCHMARK_CASE_IMPL(name, BENCHMARK_CONCAT(BenchmarkCase, __LINE__))
+
+/// <summary>
+/// Micro-benchmarks utilities. Measures the benchmark body in multiple repetitions (after the warmup) and collects the timing statistics.
+/// </summary>
+class Benchmark
+{
+public:
+    typedef void (*CaseFunc)();
+
+    /// <summary>
+    /// The registered benchmark case.
+    /// </summary>
+    struct Case
+    {
+        const char* Name;
+        CaseFunc Func;
+    };
+
+    /// <summary>
+    /// The benchmark measurement results (timings are in nanoseconds per single operation).
+    /// </summary>
+    struct Result
+    {
+        const char* Case;
+        const char* Name;
+        int32 Operations;
+        double Min;
+        double Max;
+        double Average;
+        double P50;
+        double P90;
+        double P99;
+    };
+
+    /// <summary>
+    /// Helper for the static benchmark case registration.
+    /// </summary>
+    struct Registration
+    {
+        Registration(const char* name, CaseFunc func)
+        {
+            GetCases().Add({ name, func });
+        }
+    };
+
+public:
+    /// <summary>
+    /// Gets the registered benchmark cases.
+    /// </summary>
+    static Array<Case>& GetCases();
+
+    /// <summary>
+    /// The collected measurement results.
+    /// </summary>
+    static Array<Result> Results;
+
+    /// <summary>
+    /// The name of the currently running case.
+    /// </summary>
+    static const char* CurrentCase;
+
+    /// <summary>
+    /// Measures the benchmark body.
+    /// </summary>
+    /// <param name="name">The measurement name.</param>
+    /// <param name="operations">The amount of operations performed by a single body execution (used to report time per operation).</param>
+    /// <param name="func">The benchmark body.</param>
+    template<typename Func>
+    static void Run(const char* name, int32 operations, Func func)
+    {
+        for (int32 i = 0; i < BENCHMARK_WARMUP; i++)
+            func();
+        double samples[BENCHMARK_REPETITIONS];
+        for (int32 i = 0; i < BENCHMARK_REPETITIONS; i++)
+        {
+            const uint64 start = Platform::GetTimeCycles();
+            func();
+            samples[i] = (double)(Platform::GetTimeCycles() - start);
+        }
+        AddResult(name, operations, samples, BENCHMARK_REPETITIONS);
+    }
+
+    /// <summary>
+    /// Prevents compiler from optimizing out the computations that produce the given data.
+    /// </summary>
+    /// <param name="ptr">The result data.</param>
+    static void DoNotOptimize(const void* ptr);
+
+private:
+    static void AddResult(const char* name, int32 operations, double* samples, int32 count);
+};
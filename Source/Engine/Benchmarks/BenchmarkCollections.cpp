@@ -0,0 +1,90 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/ChunkedArray.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
+
+#define BENCHMARK_COLLECTIONS_SIZE 10000
+
+BENCHMARK_CASE("Collections")
+{
+    Benchmark::Run("Array.Add", BENCHMARK_COLLECTIONS_SIZE, []
+    {
+        Array<int32> array;
+        for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            array.Add(i);
+        Benchmark::DoNotOptimize(array.Get());
+    });
+    {
+        Array<int32> array;
+        for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            array.Add(i);
+        Benchmark::Run("Array.Iterate", BENCHMARK_COLLECTIONS_SIZE, [&array]
+        {
+            int32 sum = 0;
+            for (int32 value : array)
+                sum += value;
+            Benchmark::DoNotOptimize(&sum);
+        });
+        Benchmark::Run("Array.RemoveAtKeepOrder", 100, [&array]
+        {
+            Array<int32> copy(array);
+            for (int32 i = 0; i < 100; i++)
+                copy.RemoveAtKeepOrder(0);
+            Benchmark::DoNotOptimize(copy.Get());
+        });
+    }
+
+    Benchmark::Run("Dictionary.Add", BENCHMARK_COLLECTIONS_SIZE, []
+    {
+        Dictionary<int32, int32> dictionary;
+        for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            dictionary.Add(i, i);
+        Benchmark::DoNotOptimize(&dictionary);
+    });
+    {
+        Dictionary<int32, int32> dictionary;
+        for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            dictionary.Add(i * 7, i);
+        Benchmark::Run("Dictionary.TryGet", BENCHMARK_COLLECTIONS_SIZE, [&dictionary]
+        {
+            int32 sum = 0, value;
+            for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            {
+                if (dictionary.TryGet(i * 3, value))
+                    sum += value;
+            }
+            Benchmark::DoNotOptimize(&sum);
+        });
+    }
+
+    Benchmark::Run("HashSet.Add", BENCHMARK_COLLECTIONS_SIZE, []
+    {
+        HashSet<int32> set;
+        for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            set.Add(i);
+        Benchmark::DoNotOptimize(&set);
+    });
+    {
+        HashSet<int32> set;
+        for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            set.Add(i * 7);
+        Benchmark::Run("HashSet.Contains", BENCHMARK_COLLECTIONS_SIZE, [&set]
+        {
+            int32 count = 0;
+            for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+                count += set.Contains(i * 3) ? 1 : 0;
+            Benchmark::DoNotOptimize(&count);
+        });
+    }
+
+    Benchmark::Run("ChunkedArray.Add", BENCHMARK_COLLECTIONS_SIZE, []
+    {
+        ChunkedArray<int32, 1024> array;
+        for (int32 i = 0; i < BENCHMARK_COLLECTIONS_SIZE; i++)
+            array.Add(i);
+        Benchmark::DoNotOptimize(&array);
+    });
+}
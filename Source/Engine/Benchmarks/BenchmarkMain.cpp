@@ -0,0 +1,179 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX || PLATFORM_MAC
+
+#include "Benchmark.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Editor/Scripting/ScriptsBuilder.h"
+#include "FlaxEngine.Gen.h"
+
+Array<Benchmark::Result> Benchmark::Results;
+const char* Benchmark::CurrentCase = nullptr;
+
+namespace
+{
+    const void* volatile DoNotOptimizeSink = nullptr;
+
+    double GetPercentile(const double* sorted, int32 count, double percentile)
+    {
+        const int32 index = Math::Clamp((int32)Math::Ceil(percentile * (double)count) - 1, 0, count - 1);
+        return sorted[index];
+    }
+
+    void WriteDouble(JsonWriter& writer, const char* name, double value)
+    {
+        writer.JKEY(name);
+        writer.Double(value);
+    }
+
+    bool WriteReport(const StringView& path)
+    {
+        rapidjson_flax::StringBuffer buffer;
+        PrettyJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        writer.StartObject();
+        writer.JKEY("Date");
+        writer.String(DateTime::Now().ToString());
+        writer.JKEY("Platform");
+        writer.String(ToString(PLATFORM_TYPE));
+        writer.JKEY("EngineBuild");
+        writer.Int(FLAXENGINE_VERSION_BUILD);
+        writer.JKEY("Warmup");
+        writer.Int(BENCHMARK_WARMUP);
+        writer.JKEY("Repetitions");
+        writer.Int(BENCHMARK_REPETITIONS);
+        writer.JKEY("Results");
+        writer.StartArray();
+        for (const Benchmark::Result& e : Benchmark::Results)
+        {
+            writer.StartObject();
+            writer.JKEY("Case");
+            writer.String(e.Case);
+            writer.JKEY("Name");
+            writer.String(e.Name);
+            writer.JKEY("Operations");
+            writer.Int(e.Operations);
+            WriteDouble(writer, "MinNs", e.Min);
+            WriteDouble(writer, "MaxNs", e.Max);
+            WriteDouble(writer, "AverageNs", e.Average);
+            WriteDouble(writer, "P50Ns", e.P50);
+            WriteDouble(writer, "P90Ns", e.P90);
+            WriteDouble(writer, "P99Ns", e.P99);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+
+        const String folder = StringUtils::GetDirectoryName(path);
+        if (folder.HasChars() && !FileSystem::DirectoryExists(folder))
+            FileSystem::CreateDirectory(folder);
+        return File::WriteAllBytes(path, (const byte*)buffer.GetString(), (int32)buffer.GetSize());
+    }
+}
+
+Array<Benchmark::Case>& Benchmark::GetCases()
+{
+    static Array<Case> cases;
+    return cases;
+}
+
+void Benchmark::DoNotOptimize(const void* ptr)
+{
+    DoNotOptimizeSink = ptr;
+}
+
+void Benchmark::AddResult(const char* name, int32 operations, double* samples, int32 count)
+{
+    // Convert timer cycles into nanoseconds per operation
+    const double scale = 1000000000.0 / ((double)Platform::GetClockFrequency() * (double)Math::Max(operations, 1));
+    double sum = 0.0;
+    for (int32 i = 0; i < count; i++)
+    {
+        samples[i] *= scale;
+        sum += samples[i];
+    }
+    Sorting::QuickSort(samples, count);
+
+    auto& result = Results.AddOne();
+    result.Case = CurrentCase;
+    result.Name = name;
+    result.Operations = operations;
+    result.Min = samples[0];
+    result.Max = samples[count - 1];
+    result.Average = sum / (double)count;
+    result.P50 = GetPercentile(samples, count, 0.5);
+    result.P90 = GetPercentile(samples, count, 0.9);
+    result.P99 = GetPercentile(samples, count, 0.99);
+    LOG(Info, "{0}: {1} ns/op (min: {2}, p90: {3}, p99: {4})", String(name), (float)result.P50, (float)result.Min, (float)result.P90, (float)result.P99);
+}
+
+class BenchmarksRunnerService : public EngineService
+{
+public:
+    BenchmarksRunnerService()
+        : EngineService(TEXT("BenchmarksRunnerService"), 10000)
+    {
+    }
+
+    void Update() override;
+};
+
+BenchmarksRunnerService BenchmarksRunnerServiceInstance;
+
+void BenchmarksRunnerService::Update()
+{
+    // End if failed to perform a startup
+    if (ScriptsBuilder::LastCompilationFailed())
+    {
+        Engine::RequestExit(-1);
+        return;
+    }
+
+    // Wait for Editor to be ready (eg. scripting loaded) so the background work doesn't affect the timings
+    if (!ScriptsBuilder::IsReady() ||
+        !Scripting::IsEveryAssemblyLoaded() ||
+        !Scripting::HasGameModulesLoaded())
+        return;
+
+    // Run benchmarks
+    Log::Logger::WriteFloor();
+    LOG(Info, "Running Flax Benchmarks...");
+    for (const Benchmark::Case& e : Benchmark::GetCases())
+    {
+        LOG(Info, "Benchmark {0}", String(e.Name));
+        Benchmark::CurrentCase = e.Name;
+        e.Func();
+    }
+    Benchmark::CurrentCase = nullptr;
+
+    // Save results
+    String outputPath;
+    if (CommandLine::Options.BenchmarkOutput.HasValue() && CommandLine::Options.BenchmarkOutput.GetValue().HasChars())
+        outputPath = CommandLine::Options.BenchmarkOutput.GetValue();
+    else
+    {
+        String folder = StringUtils::GetDirectoryName(Log::Logger::LogFilePath);
+        if (folder.IsEmpty())
+            folder = Globals::ProductLocalFolder / TEXT("Logs");
+        outputPath = folder / TEXT("Benchmarks.json");
+    }
+    const bool failed = WriteReport(outputPath);
+    if (failed)
+        LOG(Error, "Failed to save benchmarks report to '{0}'", outputPath);
+    else
+        LOG(Info, "Benchmarks report saved to '{0}'", outputPath);
+    Log::Logger::WriteFloor();
+    Engine::RequestExit(failed ? 1 : 0);
+}
+
+#endif
@@ -0,0 +1,90 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+
+#define BENCHMARK_MATH_COUNT 10000
+
+namespace
+{
+    void GeneratePoints(Array<Float3>& points)
+    {
+        uint32 seed = 1;
+        points.Resize(BENCHMARK_MATH_COUNT);
+        for (Float3& e : points)
+        {
+            for (int32 i = 0; i < 3; i++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                e.Raw[i] = (float)(seed >> 8) / (float)(1 << 24) * 200.0f - 100.0f;
+            }
+        }
+    }
+}
+
+BENCHMARK_CASE("Math")
+{
+    Array<Float3> points;
+    GeneratePoints(points);
+    Matrix view, projection, viewProjection;
+    Matrix::LookAt(Float3(0, 10, -50), Float3::Zero, Float3::Up, view);
+    Matrix::PerspectiveFov(PI_OVER_2, 16.0f / 9.0f, 0.1f, 1000.0f, projection);
+    Matrix::Multiply(view, projection, viewProjection);
+
+    Benchmark::Run("Matrix.Multiply", BENCHMARK_MATH_COUNT, [&]
+    {
+        Matrix result = Matrix::Identity;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+        {
+            Matrix world;
+            Matrix::Translation(points[i], world);
+            Matrix::Multiply(world, viewProjection, result);
+        }
+        Benchmark::DoNotOptimize(&result);
+    });
+    Benchmark::Run("Matrix.Invert", BENCHMARK_MATH_COUNT, [&]
+    {
+        Matrix a = viewProjection, b;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i += 2)
+        {
+            Matrix::Invert(a, b);
+            Matrix::Invert(b, a);
+        }
+        Benchmark::DoNotOptimize(&a);
+    });
+    Benchmark::Run("Vector3.Transform", BENCHMARK_MATH_COUNT, [&]
+    {
+        Float4 sum = Float4::Zero;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+        {
+            Float4 result;
+            Float3::Transform(points[i], viewProjection, result);
+            sum += result;
+        }
+        Benchmark::DoNotOptimize(&sum);
+    });
+    Benchmark::Run("Transform.LocalToWorld", BENCHMARK_MATH_COUNT, [&]
+    {
+        const Transform parent(Vector3(10, 20, 30), Quaternion::Euler(10, 45, 0), Float3(2.0f));
+        Vector3 sum = Vector3::Zero;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            sum += parent.LocalToWorld((Vector3)points[i]);
+        Benchmark::DoNotOptimize(&sum);
+    });
+    Benchmark::Run("BoundingFrustum.Intersects", BENCHMARK_MATH_COUNT, [&]
+    {
+        const BoundingFrustum frustum(viewProjection);
+        int32 count = 0;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+        {
+            const BoundingBox box((Vector3)points[i] - 1.0f, (Vector3)points[i] + 1.0f);
+            count += frustum.Intersects(box) ? 1 : 0;
+        }
+        Benchmark::DoNotOptimize(&count);
+    });
+}
@@ -0,0 +1,46 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Renderer/RenderList.h"
+
+#define BENCHMARK_DRAW_CALLS_COUNT 10000
+
+BENCHMARK_CASE("Rendering")
+{
+    RenderContext renderContext;
+    renderContext.List = RenderList::GetFromPool();
+    RenderList* list = renderContext.List;
+
+    // Generate draw calls with random sort keys (no instancing to skip materials usage during batching)
+    uint64 seed = 0x9E3779B97F4A7C15ull;
+    for (int32 i = 0; i < BENCHMARK_DRAW_CALLS_COUNT; i++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        DrawCall drawCall;
+        drawCall.SortKey = seed;
+        list->DrawCalls.Add(drawCall);
+    }
+    DrawCallsList& drawCallsList = list->DrawCallsLists[(int32)DrawCallsListType::GBuffer];
+    Benchmark::Run("RenderList.SortDrawCalls", BENCHMARK_DRAW_CALLS_COUNT, [&]
+    {
+        drawCallsList.Indices.Clear();
+        for (int32 i = 0; i < BENCHMARK_DRAW_CALLS_COUNT; i++)
+            drawCallsList.Indices.Add(i);
+        list->SortDrawCalls(renderContext, false, DrawCallsListType::GBuffer, DrawPass::GBuffer);
+        Benchmark::DoNotOptimize(drawCallsList.Batches.Get());
+    });
+    Benchmark::Run("RenderList.SortDrawCallsStable", BENCHMARK_DRAW_CALLS_COUNT, [&]
+    {
+        DrawCallsList& forwardList = list->DrawCallsLists[(int32)DrawCallsListType::Forward];
+        forwardList.Indices.Clear();
+        for (int32 i = 0; i < BENCHMARK_DRAW_CALLS_COUNT; i++)
+            forwardList.Indices.Add(i);
+        list->SortDrawCalls(renderContext, true, DrawCallsListType::Forward, DrawPass::Forward);
+        Benchmark::DoNotOptimize(forwardList.Batches.Get());
+    });
+
+    RenderList::ReturnToPool(list);
+}
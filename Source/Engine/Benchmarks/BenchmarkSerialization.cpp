@@ -0,0 +1,94 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include <ThirdParty/LZ4/lz4.h>
+
+#define BENCHMARK_SERIALIZATION_OBJECTS 1000
+#define BENCHMARK_LZ4_DATA_SIZE (1024 * 1024)
+
+namespace
+{
+    void WriteObjects(rapidjson_flax::StringBuffer& buffer)
+    {
+        CompactJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        writer.StartArray();
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_OBJECTS; i++)
+        {
+            writer.StartObject();
+            writer.JKEY("ID");
+            writer.Guid(Guid((uint32)i, (uint32)i + 1, (uint32)i + 2, (uint32)i + 3));
+            writer.JKEY("Name");
+            writer.String("Actor");
+            writer.JKEY("Position");
+            writer.Float3(Float3((float)i, 1.0f, 2.0f));
+            writer.JKEY("Orientation");
+            writer.Quaternion(Quaternion::Identity);
+            writer.JKEY("Scale");
+            writer.Float3(Float3::One);
+            writer.JKEY("Flags");
+            writer.Int(i);
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+}
+
+BENCHMARK_CASE("Serialization")
+{
+    Benchmark::Run("JsonWriter.Write", BENCHMARK_SERIALIZATION_OBJECTS, []
+    {
+        rapidjson_flax::StringBuffer buffer;
+        WriteObjects(buffer);
+        Benchmark::DoNotOptimize(buffer.GetString());
+    });
+    {
+        rapidjson_flax::StringBuffer buffer;
+        WriteObjects(buffer);
+        Benchmark::Run("Json.Parse", BENCHMARK_SERIALIZATION_OBJECTS, [&buffer]
+        {
+            rapidjson_flax::Document document;
+            JsonTools::ParseDocument(document, buffer.GetString(), (int32)buffer.GetSize());
+            Benchmark::DoNotOptimize(&document);
+        });
+    }
+
+    Benchmark::Run("MemoryWriteStream.Write", BENCHMARK_SERIALIZATION_OBJECTS, []
+    {
+        MemoryWriteStream stream(1024);
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_OBJECTS; i++)
+        {
+            stream.WriteInt32(i);
+            stream.Write(Float3((float)i, 1.0f, 2.0f));
+            stream.Write(Quaternion::Identity);
+            stream.WriteString(TEXT("Actor"), 11);
+        }
+        Benchmark::DoNotOptimize(stream.GetHandle());
+    });
+
+    {
+        // Generate compressible data (similar to the asset chunks with mesh and texture data)
+        Array<byte> source, compressed, decompressed;
+        source.Resize(BENCHMARK_LZ4_DATA_SIZE);
+        uint32 seed = 1;
+        for (int32 i = 0; i < source.Count(); i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            source[i] = (byte)((i & 0xff) ^ ((seed >> 28) & 0x3));
+        }
+        compressed.Resize(LZ4_compressBound(source.Count()));
+        const int32 compressedSize = LZ4_compress_default((const char*)source.Get(), (char*)compressed.Get(), source.Count(), compressed.Count());
+        decompressed.Resize(source.Count());
+        Benchmark::Run("LZ4.Decompress", 1, [&]
+        {
+            const int32 result = LZ4_decompress_safe((const char*)compressed.Get(), (char*)decompressed.Get(), compressedSize, decompressed.Count());
+            Benchmark::DoNotOptimize(&result);
+        });
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Core/Math/Vector3.h"
+
+#define BENCHMARK_STRING_COUNT 1000
+
+BENCHMARK_CASE("String")
+{
+    Benchmark::Run("String.Format", BENCHMARK_STRING_COUNT, []
+    {
+        for (int32 i = 0; i < BENCHMARK_STRING_COUNT; i++)
+        {
+            const String result = String::Format(TEXT("Item {0} at {1} named '{2}'"), i, 1.5f * (float)i, TEXT("Actor"));
+            Benchmark::DoNotOptimize(result.Get());
+        }
+    });
+    Benchmark::Run("StringBuilder.Append", BENCHMARK_STRING_COUNT, []
+    {
+        StringBuilder builder;
+        for (int32 i = 0; i < BENCHMARK_STRING_COUNT; i++)
+            builder.Append(TEXT("Item ")).Append(i).Append(TEXT(';'));
+        Benchmark::DoNotOptimize(&builder);
+    });
+    {
+        const String text(TEXT("The quick brown fox jumps over the lazy dog"));
+        Benchmark::Run("String.Compare", BENCHMARK_STRING_COUNT, [&text]
+        {
+            int32 count = 0;
+            const String other(TEXT("The quick brown fox jumps over the lazy cat"));
+            for (int32 i = 0; i < BENCHMARK_STRING_COUNT; i++)
+                count += text.Compare(other, StringSearchCase::IgnoreCase) == 0 ? 1 : 0;
+            Benchmark::DoNotOptimize(&count);
+        });
+    }
+}
+
+BENCHMARK_CASE("Variant")
+{
+    Benchmark::Run("Variant.Int", BENCHMARK_STRING_COUNT, []
+    {
+        float sum = 0.0f;
+        for (int32 i = 0; i < BENCHMARK_STRING_COUNT; i++)
+        {
+            const Variant value(i);
+            sum += (float)value;
+        }
+        Benchmark::DoNotOptimize(&sum);
+    });
+    Benchmark::Run("Variant.Cast", BENCHMARK_STRING_COUNT, []
+    {
+        const VariantType type(VariantType::Float3);
+        for (int32 i = 0; i < BENCHMARK_STRING_COUNT; i++)
+        {
+            const Variant value(Float3((float)i));
+            const Variant result = Variant::Cast(value, type);
+            Benchmark::DoNotOptimize(&result);
+        }
+    });
+    Benchmark::Run("Variant.ToString", BENCHMARK_STRING_COUNT, []
+    {
+        for (int32 i = 0; i < BENCHMARK_STRING_COUNT; i++)
+        {
+            const Variant value(Float3((float)i, 1.0f, 2.0f));
+            const String result = value.ToString();
+            Benchmark::DoNotOptimize(result.Get());
+        }
+    });
+    Benchmark::Run("Variant.String", BENCHMARK_STRING_COUNT, []
+    {
+        const String text(TEXT("Variant string value"));
+        for (int32 i = 0; i < BENCHMARK_STRING_COUNT; i++)
+        {
+            Variant value((StringView)text);
+            const Variant copy(value);
+            Benchmark::DoNotOptimize(&copy);
+        }
+    });
+}
@@ -8,6 +8,7 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Graphics/Models/ModelData.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Assets/Model.h"
@@ -18,6 +19,8 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
@@ -33,7 +36,11 @@ struct BuildData;
 
 namespace CSGBuilderImpl
 {
+    // Triangulated geometry of the brush islands from the last scene build (key is an island hash)
+    typedef Dictionary<uint32, RawData*> IslandsCache;
+
     Array<Scene*> ScenesToRebuild;
+    Dictionary<Scene*, IslandsCache*> ScenesIslandsCache;
 
     void onSceneUnloading(Scene* scene, const Guid& sceneId);
     bool buildInner(Scene* scene, BuildData& data);
@@ -53,6 +60,7 @@ class CSGBuilderService : public EngineService
 
     bool Init() override;
     void Update() override;
+    void Dispose() override;
 };
 
 CSGBuilderService CSGBuilderServiceInstance;
@@ -63,6 +71,13 @@ void CSGBuilderImpl::onSceneUnloading(Scene* scene, const Guid& sceneId)
 {
     // Ensure to remove scene (prevent crashes)
     ScenesToRebuild.Remove(scene);
+    IslandsCache* cache;
+    if (ScenesIslandsCache.TryGet(scene, cache))
+    {
+        cache->ClearDelete();
+        Delete(cache);
+        ScenesIslandsCache.Remove(scene);
+    }
 }
 
 bool CSGBuilderService::Init()
@@ -72,6 +87,16 @@ bool CSGBuilderService::Init()
     return false;
 }
 
+void CSGBuilderService::Dispose()
+{
+    for (auto i = ScenesIslandsCache.Begin(); i.IsNotEnd(); ++i)
+    {
+        i->Value->ClearDelete();
+        Delete(i->Value);
+    }
+    ScenesIslandsCache.Clear();
+}
+
 void CSGBuilderService::Update()
 {
     // Check if build is pending
@@ -119,8 +144,37 @@ void Builder::Build(Scene* scene, float timeoutMs)
 namespace CSG
 {
     typedef Dictionary<Actor*, Mesh*> MeshesLookup;
+}
 
-    bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache)
+struct BuildData
+{
+    MeshesArray meshes;
+    Array<Actor*> actors;
+    Array<Brush*> brushes;
+    MeshesLookup cache;
+    Guid outputModelAssetId = Guid::Empty;
+    Guid outputRawDataAssetId = Guid::Empty;
+    Guid outputCollisionDataAssetId = Guid::Empty;
+
+    BuildData(int32 meshesCapacity = 32)
+        : meshes(meshesCapacity * 32)
+        , cache(meshesCapacity * 4)
+    {
+    }
+};
+
+struct BuildIsland
+{
+    // Island meshes (in scene tree order)
+    Array<int32> Meshes;
+    MeshesLookup Cache;
+    uint32 Hash = 0;
+    RawData* Data = nullptr;
+};
+
+namespace CSG
+{
+    bool walkTree(Actor* actor, BuildData& data)
     {
         // Check if actor is a brush
         auto brush = dynamic_cast<Brush*>(actor);
@@ -130,15 +184,17 @@ namespace CSG
             if (brush->CanUseCSG())
             {
                 // Skip subtract/common meshes from the beginning (they have no effect)
-                if (meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
+                if (data.meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
                 {
-                    // Create new mesh and build for given brush
+                    // Create new mesh for given brush (built later in parallel)
                     auto mesh = New<CSG::Mesh>();
-                    mesh->Build(brush);
+                    mesh->Index = data.meshes.Count();
 
                     // Save results
-                    meshes.Add(mesh);
-                    cache.Add(actor, mesh);
+                    data.meshes.Add(mesh);
+                    data.actors.Add(actor);
+                    data.brushes.Add(brush);
+                    data.cache.Add(actor, mesh);
                 }
                 else
                 {
@@ -233,49 +289,187 @@ namespace CSG
 
         return result;
     }
-}
 
-struct BuildData
-{
-    MeshesArray meshes;
-    MeshesLookup cache;
-    Guid outputModelAssetId = Guid::Empty;
-    Guid outputRawDataAssetId = Guid::Empty;
-    Guid outputCollisionDataAssetId = Guid::Empty;
+    int32 findIslandRoot(Array<int32>& parents, int32 index)
+    {
+        while (parents[index] != index)
+        {
+            parents[index] = parents[parents[index]];
+            index = parents[index];
+        }
+        return index;
+    }
 
-    BuildData(int32 meshesCapacity = 32)
-        : meshes(meshesCapacity * 32)
-        , cache(meshesCapacity * 4)
+    void buildIslands(BuildData& data, Array<BuildIsland>& islands)
     {
+        PROFILE_CPU();
+        const int32 count = data.meshes.Count();
+        Array<int32> parents;
+        parents.Resize(count);
+
+        // Merge brushes with overlapping bounds (sweep along X axis)
+        {
+            struct SortedMesh
+            {
+                int32 Index;
+                int32 MinX;
+
+                bool operator<(const SortedMesh& other) const
+                {
+                    return MinX < other.MinX;
+                }
+            };
+            Array<SortedMesh> sorted;
+            sorted.Resize(count);
+            for (int32 i = 0; i < count; i++)
+            {
+                parents[i] = i;
+                sorted[i] = { i, data.meshes[i]->GetBounds().MinX };
+            }
+            Sorting::QuickSort(sorted);
+            for (int32 i = 0; i < count; i++)
+            {
+                const AABB a = data.meshes[sorted[i].Index]->GetBounds();
+                for (int32 j = i + 1; j < count; j++)
+                {
+                    const AABB b = data.meshes[sorted[j].Index]->GetBounds();
+                    if (b.MinX > a.MaxX)
+                        break;
+                    if (a.MinY <= b.MaxY && a.MaxY >= b.MinY && a.MinZ <= b.MaxZ && a.MaxZ >= b.MinZ)
+                    {
+                        const int32 rootA = findIslandRoot(parents, sorted[i].Index);
+                        const int32 rootB = findIslandRoot(parents, sorted[j].Index);
+                        if (rootA != rootB)
+                            parents[Math::Max(rootA, rootB)] = Math::Min(rootA, rootB);
+                    }
+                }
+            }
+        }
+
+        // Gather islands meshes (keeps the scene tree order)
+        Dictionary<int32, int32> rootToIsland;
+        for (int32 i = 0; i < count; i++)
+        {
+            const int32 root = findIslandRoot(parents, i);
+            int32 islandIndex;
+            if (!rootToIsland.TryGet(root, islandIndex))
+            {
+                // Skip subtract/common meshes from the beginning (they have no effect)
+                if (data.brushes[i]->GetBrushMode() != Mode::Additive)
+                    continue;
+                islandIndex = islands.Count();
+                islands.AddOne();
+                rootToIsland.Add(root, islandIndex);
+            }
+            auto& island = islands[islandIndex];
+            island.Meshes.Add(i);
+            island.Cache.Add(data.actors[i], data.meshes[i]);
+        }
+
+        // Hash island inputs to detect the islands that didn't change since the last build
+        for (auto& island : islands)
+        {
+            uint32 hash = island.Meshes.Count();
+            for (const int32 i : island.Meshes)
+            {
+                const Actor* actor = data.actors[i];
+                CombineHash(hash, GetHash(data.brushes[i]->GetBrushID()));
+                CombineHash(hash, GetHash(actor->GetParent() ? actor->GetParent()->GetID() : Guid::Empty));
+                CombineHash(hash, GetHash((int32)data.brushes[i]->GetBrushMode()));
+                for (const Surface& surface : *data.meshes[i]->GetSurfaces())
+                {
+                    CombineHash(hash, GetHash(surface.Normal));
+                    CombineHash(hash, GetHash(surface.D));
+                    CombineHash(hash, GetHash(surface.Material));
+                    CombineHash(hash, GetHash(surface.TexCoordScale.X));
+                    CombineHash(hash, GetHash(surface.TexCoordScale.Y));
+                    CombineHash(hash, GetHash(surface.TexCoordOffset.X));
+                    CombineHash(hash, GetHash(surface.TexCoordOffset.Y));
+                    CombineHash(hash, GetHash(surface.TexCoordRotation));
+                    CombineHash(hash, GetHash(surface.ScaleInLightmap));
+                }
+            }
+            island.Hash = hash;
+        }
     }
-};
+
+    void mergeRawData(RawData& result, const RawData& other)
+    {
+        for (const RawData::Slot* slot : other.Slots)
+            result.GetOrAddSlot(slot->Material)->Surfaces.Add(slot->Surfaces);
+        for (auto i = other.Brushes.Begin(); i.IsNotEnd(); ++i)
+            result.Brushes[i->Key] = i->Value;
+    }
+}
 
 bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
 {
-    // Setup CSG meshes list and build them
+    // Setup CSG meshes list
     {
-        Function<bool(Actor*, MeshesArray&, MeshesLookup&)> treeWalkFunction(walkTree);
-        SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&>(treeWalkFunction, data.meshes, data.cache);
+        Function<bool(Actor*, BuildData&)> treeWalkFunction(walkTree);
+        SceneQuery::TreeExecute<BuildData&>(treeWalkFunction, data);
     }
     if (data.meshes.IsEmpty())
         return false;
 
-    // Process all meshes (performs actual CSG opterations on geometry in tree structure)
-    CSG::Mesh* combinedMesh = Combine(scene, data.cache);
-    if (combinedMesh == nullptr)
-        return false;
+    // Build brush meshes
+    JobSystem::Execute([&data](int32 i)
+    {
+        data.meshes[i]->Build(data.brushes[i]);
+    }, data.meshes.Count());
+
+    // Split brushes into spatially independent islands and reuse the geometry of the islands that didn't change since the last build
+    Array<BuildIsland> islands;
+    buildIslands(data, islands);
+    IslandsCache* prevCache = nullptr;
+    ScenesIslandsCache.TryGet(scene, prevCache);
+    Array<int32> islandsToBuild;
+    for (int32 i = 0; i < islands.Count(); i++)
+    {
+        auto& island = islands[i];
+        if (prevCache && prevCache->TryGet(island.Hash, island.Data))
+            prevCache->Remove(island.Hash);
+        else
+            islandsToBuild.Add(i);
+    }
 
-    // TODO: split too big meshes (too many verts, to far parts, etc.)
+    // Process modified islands (performs actual CSG operations on geometry in tree structure) and convert them into raw triangles data
+    JobSystem::Execute([&islands, &islandsToBuild, scene](int32 i)
+    {
+        auto& island = islands[islandsToBuild[i]];
+        island.Data = New<RawData>();
+        CSG::Mesh* combinedMesh = Combine(scene, island.Cache);
+        if (combinedMesh)
+        {
+            Array<RawModelVertex> vertexBuffer;
+            combinedMesh->Triangulate(*island.Data, vertexBuffer);
+            island.Data->RemoveEmptySlots();
+        }
+    }, islandsToBuild.Count());
+    if (islands.HasItems())
+        LOG(Info, "CSG islands: {0}, rebuilt: {1}", islands.Count(), islandsToBuild.Count());
+
+    // Update the islands cache (removes islands that are no longer used)
+    if (prevCache)
+        prevCache->ClearDelete();
+    else
+        prevCache = ScenesIslandsCache[scene] = New<IslandsCache>();
+    Array<RawData*> uncached;
+    for (auto& island : islands)
+    {
+        if (prevCache->ContainsKey(island.Hash))
+            uncached.Add(island.Data);
+        else
+            prevCache->Add(island.Hash, island.Data);
+    }
 
     // Triangulate meshes
     {
-        // TODO: setup valid loop for splited meshes
-
-        // Convert CSG meshes into raw triangles data
+        // Merge islands geometry
         RawData meshData;
-        Array<RawModelVertex> vertexBuffer;
-        combinedMesh->Triangulate(meshData, vertexBuffer);
-        meshData.RemoveEmptySlots();
+        for (auto& island : islands)
+            mergeRawData(meshData, *island.Data);
+        uncached.ClearDelete();
         if (meshData.Slots.HasItems())
         {
             const auto sceneDataFolderPath = scene->GetDataFolderPath();
@@ -5,6 +5,7 @@
 #include "SoftAssetReference.h"
 #include "Cache/AssetsCache.h"
 #include "Loading/ContentLoadingManager.h"
+#include "Loading/ContentLoadOrder.h"
 #include "Loading/Tasks/LoadAssetTask.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/LogContext.h"
@@ -115,7 +116,7 @@ SoftAssetReferenceBase::~SoftAssetReferenceBase()
     {
         _asset = nullptr;
         asset->OnUnloaded.Unbind<SoftAssetReferenceBase, &SoftAssetReferenceBase::OnUnloaded>(this);
-        asset->RemoveReference();
+        asset->RemoveSoftReference();
     }
 #if !BUILD_RELEASE
     _id = Guid::Empty;
@@ -134,13 +135,13 @@ void SoftAssetReferenceBase::OnSet(Asset* asset)
     if (_asset)
     {
         _asset->OnUnloaded.Unbind<SoftAssetReferenceBase, &SoftAssetReferenceBase::OnUnloaded>(this);
-        _asset->RemoveReference();
+        _asset->RemoveSoftReference();
     }
     _asset = asset;
     _id = asset ? asset->GetID() : Guid::Empty;
     if (asset)
     {
-        asset->AddReference();
+        asset->AddSoftReference();
         asset->OnUnloaded.Bind<SoftAssetReferenceBase, &SoftAssetReferenceBase::OnUnloaded>(this);
     }
     Changed();
@@ -153,7 +154,7 @@ void SoftAssetReferenceBase::OnSet(const Guid& id)
     if (_asset)
     {
         _asset->OnUnloaded.Unbind<SoftAssetReferenceBase, &SoftAssetReferenceBase::OnUnloaded>(this);
-        _asset->RemoveReference();
+        _asset->RemoveSoftReference();
     }
     _asset = nullptr;
     _id = id;
@@ -167,7 +168,7 @@ void SoftAssetReferenceBase::OnResolve(const ScriptingTypeHandle& type)
     if (_asset)
     {
         _asset->OnUnloaded.Bind<SoftAssetReferenceBase, &SoftAssetReferenceBase::OnUnloaded>(this);
-        _asset->AddReference();
+        _asset->AddSoftReference();
     }
 }
 
@@ -175,9 +176,14 @@ void SoftAssetReferenceBase::OnUnloaded(Asset* asset)
 {
     if (_asset != asset)
         return;
-    _asset->RemoveReference();
+    _asset->RemoveSoftReference();
     _asset->OnUnloaded.Unbind<SoftAssetReferenceBase, &SoftAssetReferenceBase::OnUnloaded>(this);
     _asset = nullptr;
+    if (asset->_isEvicted)
+    {
+        // Keep the asset ID to reload it on the next use
+        return;
+    }
     _id = Guid::Empty;
     Changed();
 }
@@ -185,10 +191,12 @@ void SoftAssetReferenceBase::OnUnloaded(Asset* asset)
 Asset::Asset(const SpawnParams& params, const AssetInfo* info)
     : ManagedScriptingObject(params)
     , _refCount(0)
+    , _softRefCount(0)
     , _loadState(0)
     , _loadingTask(0)
     , _deleteFileOnUnload(false)
     , _isVirtual(false)
+    , _isEvicted(false)
 {
 }
 
@@ -197,6 +205,11 @@ int32 Asset::GetReferencesCount() const
     return (int32)Platform::AtomicRead(const_cast<int64 volatile*>(&_refCount));
 }
 
+int32 Asset::GetSoftReferencesCount() const
+{
+    return (int32)Platform::AtomicRead(const_cast<int64 volatile*>(&_softRefCount));
+}
+
 String Asset::ToString() const
 {
     return String::Format(TEXT("{0}, {1}, {2}"), GetTypeName(), GetID(), GetPath());
@@ -576,12 +589,26 @@ ContentLoadTask* Asset::createLoadingTask()
     return New<LoadAssetTask>(this);
 }
 
-void Asset::startLoading()
+void Asset::startLoading(ContentLoadPriority priority)
 {
     ASSERT(!IsLoaded());
     ASSERT(Platform::AtomicRead(&_loadingTask) == 0);
     auto loadingTask = createLoadingTask();
     ASSERT(loadingTask != nullptr);
+    const bool recordTimings = Content::RecordLoadTimings;
+    if (recordTimings)
+        Content::onAssetLoadStart(this);
+    if (ContentLoadOrder::IsRecording())
+        ContentLoadOrder::Record(GetID());
+    for (Task* task = loadingTask; task; task = task->GetContinueWithTask())
+    {
+        if (auto contentLoadTask = dynamic_cast<ContentLoadTask*>(task))
+        {
+            contentLoadTask->Priority = priority;
+            if (recordTimings)
+                contentLoadTask->AssetID = GetID();
+        }
+    }
     Platform::AtomicStore(&_loadingTask, (intptr)loadingTask);
     loadingTask->Start();
 }
@@ -616,6 +643,8 @@ bool Asset::onLoad(LoadAssetTask* task)
     if (failed)
     {
         LOG(Error, "Loading asset \'{0}\' result: {1}.", ToString(), ToString(result));
+        if (Content::RecordLoadTimings)
+            Content::onAssetLoadEnd(this, 0.0, true);
     }
 
     // Unlink task
@@ -655,7 +684,10 @@ void Asset::onLoaded_MainThread()
     ASSERT(IsInMainThread());
 
     // Send event
+    const double startTime = Content::RecordLoadTimings ? Platform::GetTimeSeconds() : 0.0;
     OnLoaded(this);
+    if (Content::RecordLoadTimings)
+        Content::onAssetLoadEnd(this, Platform::GetTimeSeconds() - startTime, false);
 }
 
 void Asset::onUnload_MainThread()
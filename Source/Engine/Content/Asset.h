@@ -9,6 +9,7 @@
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Config.h"
 #include "Types.h"
+#include "Loading/ContentLoadPriority.h"
 
 #define DECLARE_ASSET_HEADER(type) \
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(type); \
@@ -27,6 +28,7 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API Asset : public ManagedScriptin
     friend Content;
     friend LoadAssetTask;
     friend class ContentService;
+    friend class SoftAssetReferenceBase;
 public:
     /// <summary>
     /// The asset loading result.
@@ -42,11 +44,13 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API Asset : public ManagedScriptin
     };
 
     volatile int64 _refCount;
+    volatile int64 _softRefCount;
     volatile int64 _loadState;
     volatile intptr _loadingTask;
 
     int8 _deleteFileOnUnload : 1; // Indicates that asset source file should be removed on asset unload
     int8 _isVirtual : 1; // Indicates that asset is pure virtual (generated or temporary, has no storage so won't be saved)
+    int8 _isEvicted : 1; // Indicates that asset has been unloaded to fit into the content memory budget (soft references will reload it on the next use)
 
 public:
     /// <summary>
@@ -101,6 +105,29 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API Asset : public ManagedScriptin
         Platform::InterlockedDecrement(&_refCount);
     }
 
+    /// <summary>
+    /// Gets asset's soft reference count (included in the reference count). Asset referenced only by the soft references can be evicted when exceeding the content memory budget (see Content::AssetsMemoryBudget).
+    /// </summary>
+    int32 GetSoftReferencesCount() const;
+
+    /// <summary>
+    /// Adds soft reference to that asset (eg. from SoftAssetReference).
+    /// </summary>
+    FORCE_INLINE void AddSoftReference()
+    {
+        Platform::InterlockedIncrement(&_refCount);
+        Platform::InterlockedIncrement(&_softRefCount);
+    }
+
+    /// <summary>
+    /// Removes soft reference from that asset.
+    /// </summary>
+    FORCE_INLINE void RemoveSoftReference()
+    {
+        Platform::InterlockedDecrement(&_softRefCount);
+        Platform::InterlockedDecrement(&_refCount);
+    }
+
 public:
     /// <summary>
     /// Gets the path to the asset storage file. In Editor, it reflects the actual file, in cooked Game, it fakes the Editor path to be informative for developers.
@@ -226,7 +253,8 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API Asset : public ManagedScriptin
     /// <summary>
     /// Starts the asset loading.
     /// </summary>
-    virtual void startLoading();
+    /// <param name="priority">The loading tasks priority.</param>
+    virtual void startLoading(ContentLoadPriority priority = ContentLoadPriority::Normal);
 
     /// <summary>
     /// Releases the storage file/container handle to prevent issues when renaming or moving the asset.
@@ -341,7 +341,7 @@ Asset::LoadResult Material::load()
 #else
         const StringView name;
 #endif
-        _materialShader = MaterialShader::Create(name, shaderCacheStream, _shaderHeader.Material.Info);
+        _materialShader = MaterialShader::Create(name, shaderCacheStream, _shaderHeader.Material.Info, GetID());
         if (_materialShader == nullptr)
         {
             LOG(Warning, "Cannot load material.");
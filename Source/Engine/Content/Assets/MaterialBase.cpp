@@ -46,6 +46,32 @@ MaterialInstance* MaterialBase::CreateVirtualInstance()
     return instance;
 }
 
+const MaterialParameter& MaterialBase::GetActualParam(int32 index) const
+{
+    // Use the base material parameter if it's not overriden by the material instance
+    const MaterialBase* material = this;
+    while (material->IsMaterialInstance() && !material->Params[index].IsOverride())
+    {
+        const MaterialBase* baseMaterial = ((const MaterialInstance*)material)->GetBaseMaterial();
+        if (!baseMaterial || baseMaterial->Params.Count() != Params.Count())
+            break;
+        material = baseMaterial;
+    }
+    return material->Params[index];
+}
+
+void MaterialBase::ReportTexturesResolution(int32 resolution) const
+{
+    for (int32 i = 0; i < Params.Count(); i++)
+        GetActualParam(i).ReportTextureResolution(resolution);
+}
+
+void MaterialBase::PrefetchTextures(double endTime) const
+{
+    for (int32 i = 0; i < Params.Count(); i++)
+        GetActualParam(i).PrefetchTexture(endTime);
+}
+
 #if USE_EDITOR
 
 void MaterialBase::GetReferences(Array<Guid>& assets, Array<String>& files) const
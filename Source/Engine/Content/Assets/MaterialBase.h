@@ -74,9 +74,30 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MaterialBase : public BinaryAs
     /// <returns>The created virtual material instance asset.</returns>
     API_FUNCTION() MaterialInstance* CreateVirtualInstance();
 
+    /// <summary>
+    /// Reports the texture resolution required to draw the geometry with this material to the streamed textures used by its parameters.
+    /// </summary>
+    /// <param name="resolution">The required texture resolution (in texels).</param>
+    void ReportTexturesResolution(int32 resolution) const;
+
+    /// <summary>
+    /// Prefetches the streamed textures used by the material parameters (eg. the material is going to be visible soon).
+    /// </summary>
+    /// <param name="endTime">The time (see Platform::GetTimeSeconds) until which the textures stay prefetched.</param>
+    void PrefetchTextures(double endTime) const;
+
+private:
+    const MaterialParameter& GetActualParam(int32 index) const;
+
 public:
     // [BinaryAsset]
 #if USE_EDITOR
     void GetReferences(Array<Guid>& assets, Array<String>& files) const override;
 #endif
+
+    // [IMaterial]
+    const MaterialBase* GetMaterialAsset() const override
+    {
+        return this;
+    }
 };
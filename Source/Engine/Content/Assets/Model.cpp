@@ -223,7 +223,7 @@ FORCE_INLINE void ModelDraw(Model* model, const RenderContext& renderContext, co
     }
     else
     {
-        lodIndex = RenderTools::ComputeModelLOD(model, info.Bounds.Center, (float)info.Bounds.Radius, renderContext);
+        lodIndex = RenderTools::ComputeModelLOD(model, info.Bounds.Center, (float)info.Bounds.Radius, renderContext, *info.DrawState);
         if (lodIndex == -1)
         {
             // Handling model fade-out transition
@@ -579,6 +579,10 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
             }
         }
 
+        // Meshlets are generated from the imported geometry so skip them (mesh data could be modified)
+        if (!IsVirtual())
+            ReleaseChunk(MODEL_MESHLETS_CHUNK_INDEX);
+
         // Download SDF data
         if (SDF.Texture)
         {
@@ -611,6 +615,9 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
                 return true;
         }
 
+        if (HasChunk(MODEL_MESHLETS_CHUNK_INDEX) && LoadChunk(MODEL_MESHLETS_CHUNK_INDEX))
+            return true;
+
         if (SDF.Texture)
         {
             // SDF data from file (only if has no cached texture data)
@@ -692,6 +699,17 @@ bool Model::GenerateSDF(float resolutionScale, int32 lodIndex, bool cacheData, f
     return false;
 }
 
+Task* Model::GenerateSDFAsync(float resolutionScale, int32 lodIndex, float backfacesThreshold, bool useGPU)
+{
+    if (EnableModelSDF == 2 || !HasAnyLODInitialized())
+        return nullptr;
+    Function<bool()> action = [this, resolutionScale, lodIndex, backfacesThreshold, useGPU]
+    {
+        return GenerateSDF(resolutionScale, lodIndex, false, backfacesThreshold, useGPU);
+    };
+    return Task::StartNew(action, this);
+}
+
 void Model::SetSDF(const SDFData& sdf)
 {
     ScopeLock lock(Locker);
@@ -970,6 +988,48 @@ Asset::LoadResult Model::load()
         }
     }
 
+    // Load meshlets
+    auto meshletsChunk = GetChunk(MODEL_MESHLETS_CHUNK_INDEX);
+    if (meshletsChunk && meshletsChunk->IsLoaded())
+    {
+        MemoryReadStream meshletsStream(meshletsChunk->Get(), meshletsChunk->Size());
+        int32 version, lodsCount;
+        meshletsStream.ReadInt32(&version);
+        meshletsStream.ReadInt32(&lodsCount);
+        if (version == 1 && lodsCount == LODs.Count())
+        {
+            for (int32 lodIndex = 0; lodIndex < lodsCount; lodIndex++)
+            {
+                auto& lod = LODs[lodIndex];
+                int32 meshesCount;
+                meshletsStream.ReadInt32(&meshesCount);
+                if (meshesCount != lod.Meshes.Count())
+                    return LoadResult::InvalidData;
+                for (int32 meshIndex = 0; meshIndex < meshesCount; meshIndex++)
+                {
+                    MeshletsData& data = lod.Meshes[meshIndex].Meshlets;
+                    int32 meshletsCount, verticesCount, trianglesSize;
+                    meshletsStream.ReadInt32(&meshletsCount);
+                    meshletsStream.ReadInt32(&verticesCount);
+                    meshletsStream.ReadInt32(&trianglesSize);
+                    const uint32 dataSize = meshletsCount * sizeof(Meshlet) + verticesCount * sizeof(uint32) + trianglesSize;
+                    if (meshletsCount < 0 || verticesCount < 0 || trianglesSize < 0 || meshletsStream.GetPosition() + dataSize > meshletsStream.GetLength())
+                        return LoadResult::InvalidData;
+                    data.Meshlets.Resize(meshletsCount, false);
+                    data.Vertices.Resize(verticesCount, false);
+                    data.Triangles.Resize(trianglesSize, false);
+                    meshletsStream.ReadBytes(data.Meshlets.Get(), meshletsCount * sizeof(Meshlet));
+                    meshletsStream.ReadBytes(data.Vertices.Get(), verticesCount * sizeof(uint32));
+                    meshletsStream.ReadBytes(data.Triangles.Get(), trianglesSize);
+                }
+            }
+        }
+        else
+        {
+            LOG(Warning, "Invalid meshlets data in model '{0}'", ToString());
+        }
+    }
+
     // Load SDF
     auto chunk15 = GetChunk(15);
     if (chunk15 && chunk15->IsLoaded() && EnableModelSDF == 1)
@@ -1070,7 +1130,7 @@ bool Model::init(AssetInitData& initData)
 AssetChunksFlag Model::getChunksToPreload() const
 {
     // Note: we don't preload any LODs here because it's done by the Streaming Manager
-    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(15);
+    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(MODEL_MESHLETS_CHUNK_INDEX) | GET_CHUNK_FLAG(15);
 }
 
 void ModelBase::SetupMaterialSlots(int32 slotsCount)
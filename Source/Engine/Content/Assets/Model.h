@@ -231,6 +231,16 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Model : public ModelBase
     /// <returns>True if failed, otherwise false.</returns>
     API_FUNCTION() bool GenerateSDF(float resolutionScale = 1.0f, int32 lodIndex = 6, bool cacheData = true, float backfacesThreshold = 0.6f, bool useGPU = true);
 
+    /// <summary>
+    /// Generates the Sign Distant Field for this model in async on a thread pool. Can be used on a main thread (eg. for the procedural virtual models) to build SDF via GPU without stalling the rendering. Global SDF gets updated once the new SDF texture is uploaded.
+    /// </summary>
+    /// <param name="resolutionScale">The SDF texture resolution scale. Use higher values for more precise data but with significant performance and memory overhead.</param>
+    /// <param name="lodIndex">The index of the LOD to use for the SDF building.</param>
+    /// <param name="backfacesThreshold">Custom threshold (in range 0-1) for adjusting mesh internals detection based on the percentage of test rays hit triangle backfaces. Use lower value for more dense mesh.</param>
+    /// <param name="useGPU">Enables using GPU for SDF generation, otherwise CPU will be used (async via Job System).</param>
+    /// <returns>The started task or null if failed to start SDF generation.</returns>
+    Task* GenerateSDFAsync(float resolutionScale = 1.0f, int32 lodIndex = 6, float backfacesThreshold = 0.6f, bool useGPU = true);
+
     /// <summary>
     /// Sets set SDF data (releases the current one).
     /// </summary>
@@ -194,6 +194,13 @@ SkinnedModel::SkeletonMapping SkinnedModel::GetSkeletonMapping(Asset* source)
                     mappingData.SourceSkeleton = skeleton;
                     if (skeletonMapping.NodesMapping.Length() == nodesCount)
                     {
+                        // Reuse the retargeting transformations from the skeleton mapping
+                        if (skeletonMapping.RetargetTransforms.Length() == nodesCount)
+                        {
+                            mappingData.RetargetTransforms = Span<Transform>((Transform*)Allocator::Allocate(nodesCount * sizeof(Transform)), nodesCount);
+                            Platform::MemoryCopy(mappingData.RetargetTransforms.Get(), skeletonMapping.RetargetTransforms.Get(), nodesCount * sizeof(Transform));
+                        }
+
                         const auto& nodes = skeleton->Skeleton.Nodes;
                         for (int32 j = 0; j < nodesCount; j++)
                         {
@@ -269,6 +276,14 @@ SkinnedModel::SkeletonMapping SkinnedModel::GetSkeletonMapping(Asset* source)
                     }
                 }
             }
+
+            // Precompute the retargeting transformations (use ref pose difference) to not calculate them for every sampled node
+            mappingData.RetargetTransforms = Span<Transform>((Transform*)Allocator::Allocate(nodesCount * sizeof(Transform)), nodesCount);
+            for (int32 j = 0; j < nodesCount; j++)
+            {
+                const int32 nodeToNode = mappingData.NodesMapping[j];
+                mappingData.RetargetTransforms[j] = nodeToNode != -1 ? Skeleton.Nodes[j].LocalTransform - sourceModel->Skeleton.Nodes[nodeToNode].LocalTransform : Transform::Identity;
+            }
         }
         else
         {
@@ -286,6 +301,7 @@ SkinnedModel::SkeletonMapping SkinnedModel::GetSkeletonMapping(Asset* source)
     }
     mapping.SourceSkeleton = mappingData.SourceSkeleton;
     mapping.NodesMapping = mappingData.NodesMapping;
+    mapping.RetargetTransforms = mappingData.RetargetTransforms;
     return mapping;
 }
 
@@ -335,7 +351,7 @@ FORCE_INLINE void SkinnedModelDraw(SkinnedModel* model, const RenderContext& ren
     }
     else
     {
-        lodIndex = RenderTools::ComputeSkinnedModelLOD(model, info.Bounds.Center, (float)info.Bounds.Radius, renderContext);
+        lodIndex = RenderTools::ComputeSkinnedModelLOD(model, info.Bounds.Center, (float)info.Bounds.Radius, renderContext, *info.DrawState);
         if (lodIndex == -1)
         {
             // Handling model fade-out transition
@@ -880,6 +896,7 @@ void SkinnedModel::ClearSkeletonMapping()
         e.Key->OnReloading.Unbind<SkinnedModel, &SkinnedModel::OnSkeletonMappingSourceAssetUnloaded>(this);
 #endif
         Allocator::Free(e.Value.NodesMapping.Get());
+        Allocator::Free(e.Value.RetargetTransforms.Get());
     }
     _skeletonMappingCache.Clear();
 }
@@ -898,6 +915,7 @@ void SkinnedModel::OnSkeletonMappingSourceAssetUnloaded(Asset* obj)
 
     // Clear cache
     Allocator::Free(i->Value.NodesMapping.Get());
+    Allocator::Free(i->Value.RetargetTransforms.Get());
     _skeletonMappingCache.Remove(i);
 }
 
@@ -909,7 +927,7 @@ uint64 SkinnedModel::GetMemoryUsage() const
     result += Skeleton.GetMemoryUsage();
     result += _skeletonMappingCache.Capacity() * sizeof(Dictionary<Asset*, Span<int32>>::Bucket);
     for (const auto& e : _skeletonMappingCache)
-        result += e.Value.NodesMapping.Length();
+        result += e.Value.NodesMapping.Length() * sizeof(int32) + e.Value.RetargetTransforms.Length() * sizeof(Transform);
     Locker.Unlock();
     return result;
 }
@@ -28,6 +28,8 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedModel : public ModelBase
         AssetReference<SkinnedModel> SourceSkeleton;
         // The node-to-node mapping for the fast animation sampling for the skinned model skeleton nodes. Each item is index of the source skeleton node into target skeleton node.
         Span<int32> NodesMapping;
+        // The precomputed retargeting transformations (reference pose difference between the source and target skeleton nodes) for the skinned model skeleton nodes. Empty if mapping doesn't use retargeting.
+        Span<Transform> RetargetTransforms;
     };
 
 private:
@@ -35,6 +37,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedModel : public ModelBase
     {
         AssetReference<SkinnedModel> SourceSkeleton;
         Span<int32> NodesMapping;
+        Span<Transform> RetargetTransforms;
     };
 
     bool _initialized = false;
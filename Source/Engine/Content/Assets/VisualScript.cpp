@@ -27,8 +27,41 @@ namespace
     {
         uint32 StackFramesCount;
         VisualScripting::StackFrame* Stack;
+        uint32 FoldingDepth;
+        bool FoldingFailed;
     };
 
+    bool CanFoldValue(VariantType::Types type)
+    {
+        switch (type)
+        {
+        case VariantType::Bool:
+        case VariantType::Int:
+        case VariantType::Uint:
+        case VariantType::Int64:
+        case VariantType::Uint64:
+        case VariantType::Float:
+        case VariantType::Double:
+        case VariantType::Enum:
+        case VariantType::Float2:
+        case VariantType::Float3:
+        case VariantType::Float4:
+        case VariantType::Color:
+        case VariantType::Quaternion:
+        case VariantType::Int2:
+        case VariantType::Int3:
+        case VariantType::Int4:
+        case VariantType::Int16:
+        case VariantType::Uint16:
+        case VariantType::Double2:
+        case VariantType::Double3:
+        case VariantType::Double4:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     ThreadLocal<VisualScriptThread> ThreadStacks;
     VisualScriptingBinaryModule VisualScriptingModule;
     VisualScriptExecutor VisualScriptingExecutor;
@@ -49,8 +82,43 @@ Action VisualScripting::DebugFlow;
 static_assert(TIsPODType<VisualScripting::StackFrame>::Value, "VisualScripting::StackFrame must be POD type.");
 static_assert(TIsPODType<VisualScriptThread>::Value, "VisualScriptThread must be POD type.");
 
+VisualScriptGraph::~VisualScriptGraph()
+{
+    Clear();
+}
+
+bool VisualScriptGraph::IsPureNode(const Node* n)
+{
+    switch (n->GroupID)
+    {
+    // Constants
+    case 2:
+        // Array and Dictionary constants create a new container on each use
+        return n->TypeID != 13 && n->TypeID != 14;
+    // Math
+    case 3:
+    // Packing
+    case 4:
+    // Boolean
+    case 10:
+    // Bitwise
+    case 11:
+    // Comparisons
+    case 12:
+        return true;
+    default:
+        return false;
+    }
+}
+
 bool VisualScriptGraph::onNodeLoaded(Node* n)
 {
+    if (IsPureNode(n))
+    {
+        n->Data.Folding.Value = nullptr;
+        n->Data.Folding.BoxID = 0;
+        n->Data.Folding.Failed = false;
+    }
     switch (n->GroupID)
     {
     // Function
@@ -73,6 +141,21 @@ bool VisualScriptGraph::onNodeLoaded(Node* n)
     return VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>::onNodeLoaded(n);
 }
 
+void VisualScriptGraph::Clear()
+{
+    for (Node& n : Nodes)
+    {
+        if (IsPureNode(&n) && n.Data.Folding.Value)
+        {
+            Delete(n.Data.Folding.Value);
+            n.Data.Folding.Value = nullptr;
+        }
+    }
+
+    // Base
+    VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>::Clear();
+}
+
 VisualScriptExecutor::VisualScriptExecutor()
 {
     _perGroupProcessCall[6] = (ProcessBoxHandler)&VisualScriptExecutor::ProcessGroupParameters;
@@ -140,6 +223,25 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
 #endif
     const auto parentNode = box->GetParent<Node>();
 
+    // Pure nodes with only constant inputs are evaluated once and the result is reused
+    auto& folding = parentNode->Data.Folding;
+    const bool isPure = VisualScriptGraph::IsPureNode(parentNode);
+    bool tryFolding = false;
+    if (isPure)
+    {
+        const Variant* folded = folding.Value;
+        Platform::MemoryBarrier();
+        if (folded && folding.BoxID == box->ID)
+            return *folded;
+        tryFolding = stack.FoldingDepth == 0 && !folding.Failed && !folded;
+    }
+    else if (stack.FoldingDepth != 0)
+    {
+        // Value depends on the runtime state so the folded node has to be evaluated normally
+        stack.FoldingFailed = true;
+        return Value::Zero;
+    }
+
     // Add to the calling stack
     VisualScripting::StackFrame frame = *stack.Stack;
     frame.Node = parentNode;
@@ -156,7 +258,39 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
     // Call per group custom processing event
     Value value;
     const ProcessBoxHandler func = _perGroupProcessCall[parentNode->GroupID];
-    (this->*func)(box, parentNode, value);
+    if (tryFolding)
+    {
+        stack.FoldingDepth++;
+        stack.FoldingFailed = false;
+        (this->*func)(box, parentNode, value);
+        stack.FoldingDepth--;
+        const bool failed = stack.FoldingFailed || !CanFoldValue(value.Type.Type);
+        stack.FoldingFailed = false;
+        {
+            ScopeLock lock(frame.Script->Locker);
+            if (failed)
+            {
+                folding.Failed = true;
+            }
+            else if (!folding.Value)
+            {
+                folding.BoxID = box->ID;
+                Variant* folded = New<Variant>(value);
+                Platform::MemoryBarrier();
+                folding.Value = folded;
+            }
+        }
+        if (failed)
+        {
+            // Evaluate again with the actual inputs
+            value = Value::Zero;
+            (this->*func)(box, parentNode, value);
+        }
+    }
+    else
+    {
+        (this->*func)(box, parentNode, value);
+    }
 
     // Remove from the calling stack
     stack.StackFramesCount--;
@@ -22,8 +22,17 @@ class VisualScriptingBinaryModule;
 /// </summary>
 class VisualScriptGraph : public VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>
 {
+public:
+    ~VisualScriptGraph();
+
+    /// <summary>
+    /// Checks if the node is pure (its outputs depend only on the node inputs) so its output value can be constant-folded when all inputs are constant.
+    /// </summary>
+    static bool IsPureNode(const Node* n);
+
 public:
     bool onNodeLoaded(Node* n) override;
+    void Clear() override;
 };
 
 /// <summary>
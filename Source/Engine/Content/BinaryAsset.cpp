@@ -244,6 +244,25 @@ ContentLoadTask* BinaryAsset::RequestChunkDataAsync(int32 index)
     return New<LoadAssetDataTask>(this, GET_CHUNK_FLAG(index));
 }
 
+ContentLoadTask* BinaryAsset::RequestChunksDataAsync(AssetChunksFlag chunks)
+{
+    // Skip already loaded chunks
+    for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
+    {
+        auto chunk = GetChunk(i);
+        if (chunks & GET_CHUNK_FLAG(i) && chunk != nullptr && chunk->IsLoaded())
+        {
+            chunk->RegisterUsage();
+            chunks &= ~GET_CHUNK_FLAG(i);
+        }
+    }
+    if (chunks == 0)
+        return nullptr;
+
+    // Spawn loading task
+    return New<LoadAssetDataTask>(this, chunks);
+}
+
 void BinaryAsset::GetChunkData(int32 index, BytesContainer& data) const
 {
     //ScopeLock lock(Locker);
@@ -285,7 +304,9 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
     if (chunks == 0)
         return false;
 
-    // Load all missing marked chunks
+    // Load all missing marked chunks (in a single batch)
+    FlaxChunk* toLoad[ASSET_FILE_DATA_CHUNKS];
+    int32 toLoadCount = 0;
     for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
     {
         auto chunk = _header.Chunks[i];
@@ -294,12 +315,11 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
             && chunk->IsMissing()
             && chunk->ExistsInFile())
         {
-            if (Storage->LoadAssetChunk(chunk))
-                return true;
+            toLoad[toLoadCount++] = chunk;
         }
     }
 
-    return false;
+    return toLoadCount != 0 && Storage->LoadAssetChunks(ToSpan(toLoad, toLoadCount));
 }
 
 #if USE_EDITOR
@@ -534,7 +554,7 @@ class InitAssetTask : public ContentLoadTask
         // This would also allow to convert/upgrade data
         if (!storage->IsLoaded() && storage->Load())
             return Result::AssetLoadError;
-        if (factory->Init(ref.Get()))
+        if (factory->Init(ref.Get(), Priority))
             return Result::AssetLoadError;
 
         return Result::Ok;
@@ -226,6 +226,13 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API BinaryAsset : public Asset
     /// <returns>Task that will gather chunk data or null if already here.</returns>
     ContentLoadTask* RequestChunkDataAsync(int32 index);
 
+    /// <summary>
+    /// Requests the chunks data asynchronously (creates a single task that will gather all chunks data or null if already here).
+    /// </summary>
+    /// <param name="chunks">The chunks to load (packed chunks indices).</param>
+    /// <returns>Task that will gather chunks data or null if already here.</returns>
+    ContentLoadTask* RequestChunksDataAsync(AssetChunksFlag chunks);
+
     /// <summary>
     /// Gets chunk data. May fail if not data requested. See RequestChunkDataAsync.
     /// </summary>
@@ -2,13 +2,15 @@
 
 #include "AssetsCache.h"
 #include "Engine/Core/Log.h"
-#include "Engine/Core/DeleteMe.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Types/Stopwatch.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
-#include "Engine/Serialization/FileWriteStream.h"
-#include "Engine/Serialization/FileReadStream.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Storage/ContentStorageManager.h"
 #include "Engine/Content/Storage/JsonStorageProxy.h"
@@ -17,131 +19,336 @@
 #include "Engine/Engine/Globals.h"
 #include "FlaxEngine.Gen.h"
 
+// Registry file format identifier (written after the engine build number)
+#define ASSETS_CACHE_MAGIC 0x32414346
+
+// Maximum amount of changes appended to the registry file before it gets fully rewritten
+#define ASSETS_CACHE_MAX_JOURNAL 4096
+
+// Registry table entry (sorted by ID). Strings are offsets (in characters) into the strings table.
+struct AssetsCache::TableEntry
+{
+    Guid ID;
+    uint32 TypeName;
+    uint32 TypeNameLength;
+    uint32 Path;
+    uint32 PathLength;
+    uint32 MappedPath;
+    uint32 MappedPathLength;
+    int64 FileModified;
+};
+
+// Registry path lookup entry (sorted by path hash).
+struct AssetsCache::TableIndex
+{
+    uint32 Hash;
+    int32 Index;
+    uint32 Path;
+    uint32 PathLength;
+};
+
+namespace
+{
+    enum class JournalRecord : byte
+    {
+        Set = 1,
+        Remove = 2,
+    };
+
+    FORCE_INLINE uint32 GetPathHash(const StringView& path)
+    {
+        return StringUtils::GetHashCode(path.Get(), path.Length());
+    }
+
+    FORCE_INLINE int32 CompareIds(const Guid& a, const Guid& b)
+    {
+        if (a.A != b.A)
+            return a.A < b.A ? -1 : 1;
+        if (a.B != b.B)
+            return a.B < b.B ? -1 : 1;
+        if (a.C != b.C)
+            return a.C < b.C ? -1 : 1;
+        if (a.D != b.D)
+            return a.D < b.D ? -1 : 1;
+        return 0;
+    }
+
+    bool SortEntries(const AssetsCache::Entry* const& a, const AssetsCache::Entry* const& b)
+    {
+        return CompareIds(a->Info.ID, b->Info.ID) < 0;
+    }
+
+    template<typename T>
+    bool SortIndices(const T& a, const T& b)
+    {
+        return a.Hash < b.Hash;
+    }
+
+    void WritePadding(MemoryWriteStream& stream)
+    {
+        while (stream.GetPosition() % 8 != 0)
+            stream.WriteByte(0);
+    }
+
+    bool ToTablePath(const StringView& path, bool relativePaths, StringView& result)
+    {
+        result = path;
+        if (relativePaths)
+        {
+            // Table stores paths relative to the startup folder
+            const String& root = Globals::StartupFolder;
+            if (path.Length() <= root.Length() || path[root.Length()] != '/' || StringUtils::Compare(path.Get(), root.Get(), root.Length()) != 0)
+                return false;
+            result = StringView(path.Get() + root.Length() + 1, path.Length() - root.Length() - 1);
+        }
+        return true;
+    }
+}
+
+AssetsCache::~AssetsCache()
+{
+    UnloadTable();
+}
+
+int32 AssetsCache::Size() const
+{
+    ScopeLock lock(_locker);
+    int32 result = _tableEntriesCount - _removed.Count();
+    for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (FindTableEntry(i->Key) == -1)
+            result++;
+    }
+    return result;
+}
+
 void AssetsCache::Init()
 {
-    Entry e;
-    int32 count;
-    Stopwatch stopwatch;
 #if USE_EDITOR
     _path = Globals::ProjectCacheFolder / TEXT("AssetsCache.dat");
 #else
     _path = Globals::ProjectContentFolder / TEXT("AssetsCache.dat");
 #endif
     LOG(Info, "Loading Asset Cache {0}...", _path);
+    Load();
+}
+
+void AssetsCache::Load()
+{
+    Stopwatch stopwatch;
+    ScopeLock lock(_locker);
+    UnloadTable();
+    _registry.Clear();
+    _removed.Clear();
+    _changed.Clear();
+    _isDirty = true;
 
     // Check if assets registry exists
     if (!FileSystem::FileExists(_path))
     {
-        _isDirty = true;
         LOG(Warning, "Cannot find assets cache file");
         return;
     }
 
-    // Open file
-    FileReadStream* stream = FileReadStream::Open(_path);
-    DeleteMe<FileReadStream> deleteStream(stream);
+    // Open file (registry is read-only in game so map it directly)
+    const byte* data = nullptr;
+    uint32 size = 0;
+#if !USE_EDITOR
+    if (ContentStorageManager::UseMemoryMapping)
+    {
+        auto file = File::Open(_path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+        if (file)
+        {
+            data = file->Map();
+            if (data)
+            {
+                _tableFile = file;
+                _tableMapping = data;
+                _tableMappingSize = size = file->GetSize();
+            }
+            else
+            {
+                Delete(file);
+            }
+        }
+    }
+#endif
+    if (data == nullptr)
+    {
+        if (File::ReadAllBytes(_path, _tableData))
+        {
+            LOG(Warning, "Cannot read assets cache file");
+            return;
+        }
+        data = _tableData.Get();
+        size = _tableData.Count();
+    }
+    MemoryReadStream stream(data, size);
 
     // Load version
-    int32 version;
-    stream->ReadInt32(&version);
-    if (version != FLAXENGINE_VERSION_BUILD)
+    int32 version = 0, magic = 0;
+    if (size >= sizeof(int32) * 2)
+    {
+        stream.ReadInt32(&version);
+        stream.ReadInt32(&magic);
+    }
+    if (version != FLAXENGINE_VERSION_BUILD || magic != ASSETS_CACHE_MAGIC)
     {
         LOG(Warning, "Corrupted or not supported Asset Cache file. Version: {0}", version);
+        UnloadTable();
         return;
     }
 
     // Load paths
     String enginePath, projectPath;
-    stream->ReadString(&enginePath, -410);
-    stream->ReadString(&projectPath, -410);
+    stream.ReadString(&enginePath, -410);
+    stream.ReadString(&projectPath, -410);
 
     // Flags
-    AssetsCacheFlags flags;
-    stream->ReadInt32((int32*)&flags);
+    AssetsCacheFlags flags = AssetsCacheFlags::None;
+    if (stream.GetLength() - stream.GetPosition() >= sizeof(int32))
+        stream.ReadInt32((int32*)&flags);
 
     // Check if other workspace instance used this cache
     if (EnumHasNoneFlags(flags, AssetsCacheFlags::RelativePaths) && enginePath != Globals::StartupFolder)
     {
         LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", enginePath, TEXT("engine"));
+        UnloadTable();
         return;
     }
     if (EnumHasNoneFlags(flags, AssetsCacheFlags::RelativePaths) && projectPath != Globals::ProjectFolder)
     {
         LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", projectPath, TEXT("project"));
+        UnloadTable();
         return;
     }
+    _tableRelativePaths = EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths);
 
-    ScopeLock lock(_locker);
+    // Load data
+    if (stream.HasError() || LoadTable(stream, data))
+    {
+        UnloadTable();
+        _registry.Clear();
+        _removed.Clear();
+        _changed.Clear();
+        LOG(Warning, "Asset Cache file has an error. Removing it.");
+        if (FileSystem::DeleteFile(_path))
+        {
+            LOG(Error, "Cannot delete registry file after reading error.");
+        }
+        return;
+    }
     _isDirty = false;
 
-    // Load elements count
-    stream->ReadInt32(&count);
-    _registry.Clear();
-    _registry.EnsureCapacity(count);
+    stopwatch.Stop();
+    LOG(Info, "Asset Cache loaded {0} entries in {1}ms ({2} changes)", _tableEntriesCount, stopwatch.GetMilliseconds(), _journalCount);
+}
 
-    // Load data
-    int32 rejectedCount = 0;
-    for (int32 i = 0; i < count; i++)
+bool AssetsCache::LoadTable(MemoryReadStream& stream, const byte* data)
+{
+#define CHECK_SIZE(size) if ((uint64)stream.GetLength() - stream.GetPosition() < (uint64)(size)) return true
+    CHECK_SIZE(sizeof(int32) * 3);
+    int32 entriesCount, mappingsCount, stringsLength;
+    stream.ReadInt32(&entriesCount);
+    stream.ReadInt32(&mappingsCount);
+    stream.ReadInt32(&stringsLength);
+    if (entriesCount < 0 || mappingsCount < 0 || stringsLength < 0)
+        return true;
+
+    // Link tables (data is used in-place)
+    stream.SetPosition(Math::AlignUp<uint32>(stream.GetPosition(), 8));
+    const uint64 tablesSize = (uint64)entriesCount * (sizeof(TableEntry) + sizeof(TableIndex)) + (uint64)mappingsCount * sizeof(TableIndex) + (uint64)stringsLength * sizeof(Char);
+    CHECK_SIZE(tablesSize);
+    uint32 position = stream.GetPosition();
+    _tableEntries = (const TableEntry*)(data + position);
+    position += entriesCount * sizeof(TableEntry);
+    _tablePaths = (const TableIndex*)(data + position);
+    position += entriesCount * sizeof(TableIndex);
+    _tableMappings = (const TableIndex*)(data + position);
+    position += mappingsCount * sizeof(TableIndex);
+    _tableStrings = (const Char*)(data + position);
+    position += stringsLength * sizeof(Char);
+    _tableEntriesCount = entriesCount;
+    _tableMappingsCount = mappingsCount;
+    _tableStringsLength = stringsLength;
+    _hasTable = true;
+    stream.SetPosition(Math::Min(Math::AlignUp<uint32>(position, 8), stream.GetLength()));
+
+    // Apply changes appended to the file
+    _journalCount = 0;
+    const auto readString = [&stream, data](String& result)
+    {
+        int32 length;
+        stream.ReadInt32(&length);
+        CHECK_SIZE((uint64)Math::Max(length, 0) * sizeof(Char));
+        if (length < 0)
+            return true;
+        result.Set((const Char*)(data + stream.GetPosition()), length);
+        stream.SetPosition(stream.GetPosition() + length * sizeof(Char));
+        return false;
+    };
+    while (stream.GetPosition() < stream.GetLength())
     {
-        stream->Read(e.Info.ID);
-        stream->ReadString(&e.Info.TypeName, i - 13);
-        stream->ReadString(&e.Info.Path, i);
+        CHECK_SIZE(sizeof(byte) + sizeof(Guid));
+        byte type;
+        Guid id;
+        stream.ReadByte(&type);
+        stream.Read(id);
+        if (type == (byte)JournalRecord::Set)
+        {
+            Entry e;
+            e.Info.ID = id;
+            CHECK_SIZE(sizeof(int32));
+            if (readString(e.Info.TypeName))
+                return true;
+            CHECK_SIZE(sizeof(int32));
+            if (readString(e.Info.Path))
+                return true;
+            CHECK_SIZE(sizeof(int64));
+            int64 fileModified;
+            stream.ReadInt64(&fileModified);
 #if ENABLE_ASSETS_DISCOVERY
-        stream->Read(e.FileModified);
-#else
-        DateTime tmp1;
-        stream->Read(tmp1);
+            e.FileModified = DateTime(fileModified);
 #endif
-
-        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths) && e.Info.Path.HasChars())
+            SetEntry(e);
+        }
+        else if (type == (byte)JournalRecord::Remove)
         {
-            // Convert to absolute path
-            e.Info.Path = Globals::StartupFolder / e.Info.Path;
+            RemoveEntry(id);
         }
-
-        // Use only valid entries
-        if (IsEntryValid(e))
-            _registry.Add(e.Info.ID, e);
         else
-            rejectedCount++;
-    }
-
-    // Paths mapping
-    stream->ReadInt32(&count);
-    _pathsMapping.Clear();
-    _pathsMapping.EnsureCapacity(count);
-    for (int32 i = 0; i < count; i++)
-    {
-        Guid id;
-        stream->Read(id);
-        String mappedPath;
-        stream->ReadString(&mappedPath, i + 73);
-
-        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths) && mappedPath.HasChars())
         {
-            // Convert to absolute path
-            mappedPath = Globals::StartupFolder / mappedPath;
+            return true;
         }
-
-        _pathsMapping.Add(mappedPath, id);
+        _journalCount++;
     }
+    _changed.Clear();
+#undef CHECK_SIZE
+    return false;
+}
 
-    // Check errors
-    const bool hasError = stream->HasError();
-    deleteStream.Delete();
-    if (hasError)
+void AssetsCache::UnloadTable()
+{
+    if (_tableFile)
     {
-        _isDirty = true;
-        _registry.Clear();
-        LOG(Warning, "Asset Cache file has an error. Removing it.");
-        if (FileSystem::DeleteFile(_path))
-        {
-            LOG(Error, "Cannot delete registry file after reading error.");
-        }
+        _tableFile->Unmap(_tableMapping, _tableMappingSize);
+        Delete(_tableFile);
+        _tableFile = nullptr;
+        _tableMapping = nullptr;
+        _tableMappingSize = 0;
     }
-
-    stopwatch.Stop();
-    LOG(Info, "Asset Cache loaded {0} entries in {1}ms ({2} rejected)", _registry.Count(), stopwatch.GetMilliseconds(), rejectedCount);
+    _tableData.Resize(0);
+    _tableEntries = nullptr;
+    _tablePaths = nullptr;
+    _tableMappings = nullptr;
+    _tableStrings = nullptr;
+    _tableEntriesCount = 0;
+    _tableMappingsCount = 0;
+    _tableStringsLength = 0;
+    _journalCount = 0;
+    _hasTable = false;
+    _tableRelativePaths = false;
+    _tablePathsCache.Resize(0);
 }
 
 bool AssetsCache::Save()
@@ -155,71 +362,327 @@ bool AssetsCache::Save()
 
     ScopeLock lock(_locker);
 
-    if (Save(_path, _registry, _pathsMapping))
+    // Append small changes to the existing file
+    if (_hasTable && _changed.Count() + _journalCount <= ASSETS_CACHE_MAX_JOURNAL && FileSystem::FileExists(_path))
+    {
+        if (!AppendChanges())
+        {
+            _isDirty = false;
+            return false;
+        }
+    }
+
+    // Rewrite the whole registry
+    Registry entries;
+    entries.EnsureCapacity(_tableEntriesCount + _registry.Count());
+    Entry e;
+    for (int32 i = 0; i < _tableEntriesCount; i++)
+    {
+        if (IsTableEntryVisible(_tableEntries[i].ID))
+        {
+            GetTableEntry(i, e);
+            entries.Add(e.Info.ID, e);
+        }
+    }
+    for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
+        entries.Add(i->Key, i->Value);
+    PathsMapping pathsMapping;
+    for (int32 i = 0; i < _tableMappingsCount; i++)
+    {
+        const TableIndex& mapping = _tableMappings[i];
+        String mappedPath;
+        GetTablePath(mapping.Path, mapping.PathLength, mappedPath);
+        pathsMapping[mappedPath] = _tableEntries[mapping.Index].ID;
+    }
+    if (Save(_path, entries, pathsMapping))
         return true;
 
-    _isDirty = false;
+    // Use the saved registry table
+    Load();
 
 #endif
 
     return false;
 }
 
+bool AssetsCache::AppendChanges()
+{
+    PROFILE_CPU();
+    LOG(Info, "Saving assets cache changes to \'{0}\', entries: {1}", _path, _changed.Count());
+
+    MemoryWriteStream stream(4096);
+    for (auto i = _changed.Begin(); i.IsNotEnd(); ++i)
+    {
+        const Guid& id = i->Item;
+        const Entry* e = _registry.TryGet(id);
+        if (e)
+        {
+            stream.WriteByte((byte)JournalRecord::Set);
+            stream.Write(id);
+            stream.WriteString(e->Info.TypeName);
+            stream.WriteString(e->Info.Path);
+#if ENABLE_ASSETS_DISCOVERY
+            stream.WriteInt64(e->FileModified.Ticks);
+#else
+            stream.WriteInt64(0);
+#endif
+        }
+        else
+        {
+            stream.WriteByte((byte)JournalRecord::Remove);
+            stream.Write(id);
+        }
+    }
+
+    auto file = File::Open(_path, FileMode::OpenExisting, FileAccess::Write, FileShare::Read);
+    if (file == nullptr)
+        return true;
+    file->SetPosition(file->GetSize());
+    const bool failed = file->Write(stream.GetHandle(), stream.GetPosition());
+    Delete(file);
+    if (failed)
+        return true;
+
+    _journalCount += _changed.Count();
+    _changed.Clear();
+    return false;
+}
+
 bool AssetsCache::Save(const StringView& path, const Registry& entries, const PathsMapping& pathsMapping, const AssetsCacheFlags flags)
 {
     PROFILE_CPU();
 
     LOG(Info, "Saving assets cache to \'{0}\', entries: {1}", path, entries.Count());
 
-    // Open file
-    auto stream = FileWriteStream::Open(path);
-    if (stream == nullptr)
-        return true;
+    // Sort entries by ID
+    Array<const Entry*> sortedEntries;
+    sortedEntries.EnsureCapacity(entries.Count());
+    for (auto i = entries.Begin(); i.IsNotEnd(); ++i)
+        sortedEntries.Add(&i->Value);
+    Sorting::QuickSort(sortedEntries.Get(), sortedEntries.Count(), &SortEntries);
+
+    // Build tables (strings are deduplicated, eg. packages path or type names)
+    Array<Char> strings;
+    Dictionary<StringView, uint32> stringsOffsets;
+    const auto addString = [&strings, &stringsOffsets](const StringView& str)
+    {
+        uint32 offset = 0;
+        if (str.HasChars() && !stringsOffsets.TryGet(str, offset))
+        {
+            offset = strings.Count();
+            strings.Add(str.Get(), str.Length());
+            stringsOffsets.Add(str, offset);
+        }
+        return offset;
+    };
+    Dictionary<Guid, int32> entriesIndices;
+    entriesIndices.EnsureCapacity(sortedEntries.Count());
+    Array<TableEntry> tableEntries;
+    Array<TableIndex> tablePaths;
+    tableEntries.Resize(sortedEntries.Count());
+    tablePaths.Resize(sortedEntries.Count());
+    for (int32 i = 0; i < sortedEntries.Count(); i++)
+    {
+        const Entry& e = *sortedEntries[i];
+        TableEntry& t = tableEntries[i];
+        t.ID = e.Info.ID;
+        t.TypeName = addString(e.Info.TypeName);
+        t.TypeNameLength = e.Info.TypeName.Length();
+        t.Path = addString(e.Info.Path);
+        t.PathLength = e.Info.Path.Length();
+        t.MappedPath = 0;
+        t.MappedPathLength = 0;
+#if ENABLE_ASSETS_DISCOVERY
+        t.FileModified = e.FileModified.Ticks;
+#else
+        t.FileModified = 0;
+#endif
+        tablePaths[i] = { GetPathHash(e.Info.Path), i, t.Path, t.PathLength };
+        entriesIndices[e.Info.ID] = i;
+    }
+    Sorting::QuickSort(tablePaths.Get(), tablePaths.Count(), &SortIndices<TableIndex>);
+    Array<TableIndex> tableMappings;
+    tableMappings.EnsureCapacity(pathsMapping.Count());
+    for (auto i = pathsMapping.Begin(); i.IsNotEnd(); ++i)
+    {
+        int32 index;
+        if (!entriesIndices.TryGet(i->Value, index))
+            continue;
+        const uint32 offset = addString(i->Key);
+        TableEntry& t = tableEntries[index];
+        if (t.MappedPathLength == 0)
+        {
+            t.MappedPath = offset;
+            t.MappedPathLength = i->Key.Length();
+        }
+        tableMappings.Add({ GetPathHash(i->Key), index, offset, (uint32)i->Key.Length() });
+    }
+    Sorting::QuickSort(tableMappings.Get(), tableMappings.Count(), &SortIndices<TableIndex>);
+
+    MemoryWriteStream stream(1024 + tableEntries.Count() * (sizeof(TableEntry) + sizeof(TableIndex)) + tableMappings.Count() * sizeof(TableIndex) + strings.Count() * sizeof(Char));
 
     // Version
-    stream->WriteInt32(FLAXENGINE_VERSION_BUILD);
+    stream.WriteInt32(FLAXENGINE_VERSION_BUILD);
+    stream.WriteInt32(ASSETS_CACHE_MAGIC);
 
     // Paths
-    stream->WriteString(Globals::StartupFolder, -410);
-    stream->WriteString(Globals::ProjectFolder, -410);
+    stream.WriteString(Globals::StartupFolder, -410);
+    stream.WriteString(Globals::ProjectFolder, -410);
 
     // Flags
-    stream->WriteInt32((int32)flags);
+    stream.WriteInt32((int32)flags);
+
+    // Tables
+    stream.WriteInt32(tableEntries.Count());
+    stream.WriteInt32(tableMappings.Count());
+    stream.WriteInt32(strings.Count());
+    WritePadding(stream);
+    stream.WriteBytes(tableEntries.Get(), tableEntries.Count() * sizeof(TableEntry));
+    stream.WriteBytes(tablePaths.Get(), tablePaths.Count() * sizeof(TableIndex));
+    stream.WriteBytes(tableMappings.Get(), tableMappings.Count() * sizeof(TableIndex));
+    stream.WriteBytes(strings.Get(), strings.Count() * sizeof(Char));
+    WritePadding(stream);
+
+    return File::WriteAllBytes(path, stream.GetHandle(), (int32)stream.GetPosition());
+}
 
-    // Items count
-    stream->WriteInt32(entries.Count());
+StringView AssetsCache::GetTableString(uint32 offset, uint32 length) const
+{
+    if ((uint64)offset + length > (uint64)_tableStringsLength)
+        return StringView::Empty;
+    return StringView(_tableStrings + offset, (int32)length);
+}
 
-    // Data
-    int32 index = 0;
-    for (auto i = entries.Begin(); i.IsNotEnd(); ++i)
+void AssetsCache::GetTablePath(uint32 offset, uint32 length, String& result) const
+{
+    const StringView path = GetTableString(offset, length);
+    if (_tableRelativePaths && path.HasChars())
     {
-        auto& e = i->Value;
-        stream->Write(e.Info.ID);
-        stream->WriteString(e.Info.TypeName, index - 13);
-        stream->WriteString(e.Info.Path, index);
+        // Convert to absolute path
+        result = Globals::StartupFolder;
+        result /= path;
+    }
+    else
+    {
+        result = path;
+    }
+}
+
+void AssetsCache::GetTableEntry(int32 index, Entry& e) const
+{
+    const TableEntry& t = _tableEntries[index];
+    e.Info.ID = t.ID;
+    e.Info.TypeName = GetTableString(t.TypeName, t.TypeNameLength);
+    GetTablePath(t.Path, t.PathLength, e.Info.Path);
 #if ENABLE_ASSETS_DISCOVERY
-        stream->Write(e.FileModified);
-#else
-        stream->WriteInt64(0);
+    e.FileModified = DateTime(t.FileModified);
 #endif
-        index++;
+}
+
+int32 AssetsCache::FindTableEntry(const Guid& id) const
+{
+    int32 left = 0, right = _tableEntriesCount - 1;
+    while (left <= right)
+    {
+        const int32 middle = left + (right - left) / 2;
+        const int32 compare = CompareIds(_tableEntries[middle].ID, id);
+        if (compare == 0)
+            return middle;
+        if (compare < 0)
+            left = middle + 1;
+        else
+            right = middle - 1;
     }
+    return -1;
+}
 
-    // Paths mapping
-    index = 0;
-    stream->WriteInt32(pathsMapping.Count());
-    for (auto i = pathsMapping.Begin(); i.IsNotEnd(); ++i)
+int32 AssetsCache::FindTableEntry(const TableIndex* table, int32 count, const StringView& path, bool visibleOnly) const
+{
+    StringView tablePath;
+    if (count == 0 || !ToTablePath(path, _tableRelativePaths, tablePath))
+        return -1;
+    const uint32 hash = GetPathHash(tablePath);
+
+    // Find the first item with the matching hash
+    int32 left = 0, right = count;
+    while (left < right)
+    {
+        const int32 middle = left + (right - left) / 2;
+        if (table[middle].Hash < hash)
+            left = middle + 1;
+        else
+            right = middle;
+    }
+    for (; left < count && table[left].Hash == hash; left++)
     {
-        stream->Write(i->Value);
-        stream->WriteString(i->Key, index + 73);
-        index++;
+        const TableIndex& e = table[left];
+        if (e.Index >= 0 && e.Index < _tableEntriesCount && GetTableString(e.Path, e.PathLength) == tablePath && (!visibleOnly || IsTableEntryVisible(_tableEntries[e.Index].ID)))
+            return e.Index;
     }
+    return -1;
+}
 
-    // Cleanup
-    stream->Flush();
-    Delete(stream);
+bool AssetsCache::IsTableEntryVisible(const Guid& id) const
+{
+    return !_registry.ContainsKey(id) && !_removed.Contains(id);
+}
 
-    return false;
+AssetsCache::Entry* AssetsCache::PromoteTableEntry(int32 index)
+{
+    Entry e;
+    GetTableEntry(index, e);
+    Entry& result = _registry[e.Info.ID];
+    result = e;
+    return &result;
+}
+
+void AssetsCache::SetEntry(const Entry& e)
+{
+    _removed.Remove(e.Info.ID);
+    _registry[e.Info.ID] = e;
+    _changed.Add(e.Info.ID);
+    _isDirty = true;
+}
+
+void AssetsCache::RemoveEntry(const Guid& id)
+{
+    _registry.Remove(id);
+    if (FindTableEntry(id) != -1)
+        _removed.Add(id);
+    _changed.Add(id);
+    _isDirty = true;
+}
+
+void AssetsCache::RemoveEntries(const StringView& path, bool ignoreCase)
+{
+    for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
+    {
+        const String& entryPath = i->Value.Info.Path;
+        if (ignoreCase ? entryPath.Length() == path.Length() && StringUtils::CompareIgnoreCase(entryPath.Get(), path.Get(), path.Length()) == 0 : entryPath == path)
+        {
+            const Guid id = i->Key;
+            _registry.Remove(i);
+            RemoveEntry(id);
+        }
+    }
+    if (ignoreCase)
+    {
+        StringView tablePath;
+        if (!ToTablePath(path, _tableRelativePaths, tablePath))
+            return;
+        for (int32 i = 0; i < _tableEntriesCount; i++)
+        {
+            const TableEntry& t = _tableEntries[i];
+            if (t.PathLength == tablePath.Length() && StringUtils::CompareIgnoreCase(GetTableString(t.Path, t.PathLength).Get(), tablePath.Get(), tablePath.Length()) == 0 && IsTableEntryVisible(t.ID))
+                RemoveEntry(t.ID);
+        }
+    }
+    else
+    {
+        int32 index;
+        while ((index = FindTableEntry(_tablePaths, _tableEntriesCount, path, true)) != -1)
+            RemoveEntry(_tableEntries[index].ID);
+    }
 }
 
 const String& AssetsCache::GetEditorAssetPath(const Guid& id) const
@@ -227,39 +690,49 @@ const String& AssetsCache::GetEditorAssetPath(const Guid& id) const
     ScopeLock lock(_locker);
 #if USE_EDITOR
     auto e = _registry.TryGet(id);
-    return e ? e->Info.Path : String::Empty;
-#else
-    for (auto& e : _pathsMapping)
+    if (e)
+        return e->Info.Path;
+    if (_removed.Contains(id))
+        return String::Empty;
+#endif
+    const int32 index = FindTableEntry(id);
+    if (index == -1)
+        return String::Empty;
+    if (_tablePathsCache.Count() != _tableEntriesCount)
+        _tablePathsCache.Resize(_tableEntriesCount);
+    String& result = _tablePathsCache[index];
+    if (result.IsEmpty())
     {
-        if (e.Value == id)
-            return e.Key;
-    }
-    return String::Empty;
+        const TableEntry& t = _tableEntries[index];
+#if USE_EDITOR
+        GetTablePath(t.Path, t.PathLength, result);
+#else
+        GetTablePath(t.MappedPath, t.MappedPathLength, result);
 #endif
+    }
+    return result;
 }
 
 bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
 {
     PROFILE_CPU();
-
-    bool result = false;
-
     ScopeLock lock(_locker);
 
     // Check if asset has direct mapping to id (used for some cooked assets)
-    Guid id;
-    if (_pathsMapping.TryGet(path, id))
+    int32 index = FindTableEntry(_tableMappings, _tableMappingsCount, path, false);
+    if (index != -1)
     {
-        return FindAsset(id, info);
+        return FindAsset(_tableEntries[index].ID, info);
     }
 #if !USE_EDITOR
     if (FileSystem::IsRelative(path))
     {
         // Additional check if user provides path relative to the project folder (eg. Content/SomeAssets/MyFile.json)
         const String absolutePath = Globals::ProjectFolder / *path;
-        if (_pathsMapping.TryGet(absolutePath, id))
+        index = FindTableEntry(_tableMappings, _tableMappingsCount, absolutePath, false);
+        if (index != -1)
         {
-            return FindAsset(id, info);
+            return FindAsset(_tableEntries[index].ID, info);
         }
     }
 #endif
@@ -267,62 +740,82 @@ bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
     // Find asset in registry
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
-        auto& e = i->Value;
-        if (e.Info.Path == path)
+        if (i->Value.Info.Path == path)
         {
-            if (!IsEntryValid(e))
-            {
-                LOG(Warning, "Missing file from registry: \'{0}\':{1}:{2}", e.Info.Path, e.Info.ID, e.Info.TypeName);
-                _registry.Remove(i);
-            }
-            else
-            {
-                // Found
-                result = true;
-                info = e.Info;
-            }
-
-            break;
+            const Guid id = i->Key;
+            return FindAsset(id, info);
         }
     }
+    index = FindTableEntry(_tablePaths, _tableEntriesCount, path, true);
+    if (index != -1)
+    {
+        return FindAsset(_tableEntries[index].ID, info);
+    }
 
-    return result;
+    return false;
 }
 
 bool AssetsCache::FindAsset(const Guid& id, AssetInfo& info)
 {
     PROFILE_CPU();
-    bool result = false;
     ScopeLock lock(_locker);
-    auto e = _registry.TryGet(id);
-    if (e != nullptr)
+    Entry tableEntry;
+    Entry* e = _registry.TryGet(id);
+    if (e == nullptr)
     {
-        if (!IsEntryValid(*e))
-        {
-            LOG(Warning, "Missing file from registry: \'{0}\':{1}:{2}", e->Info.Path, e->Info.ID, e->Info.TypeName);
-            _registry.Remove(id);
-        }
-        else
-        {
-            // Found
-            result = true;
-            info = e->Info;
-        }
+        const int32 index = _removed.Contains(id) ? -1 : FindTableEntry(id);
+        if (index == -1)
+            return false;
+        GetTableEntry(index, tableEntry);
+        e = &tableEntry;
     }
-    return result;
+#if ENABLE_ASSETS_DISCOVERY
+    const DateTime fileModified = e->FileModified;
+#endif
+    if (!IsEntryValid(*e))
+    {
+        LOG(Warning, "Missing file from registry: \'{0}\':{1}:{2}", e->Info.Path, e->Info.ID, e->Info.TypeName);
+        const Guid entryId = e->Info.ID;
+        RemoveEntry(entryId);
+        return false;
+    }
+#if ENABLE_ASSETS_DISCOVERY
+    if (fileModified != e->FileModified)
+    {
+        // Keep the updated file modification date
+        SetEntry(*e);
+    }
+#endif
+
+    // Found
+    info = e->Info;
+    return true;
 }
 
 void AssetsCache::GetAll(Array<Guid>& result) const
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
-    _registry.GetKeys(result);
+    result.EnsureCapacity(result.Count() + _tableEntriesCount + _registry.Count());
+    for (int32 i = 0; i < _tableEntriesCount; i++)
+    {
+        if (IsTableEntryVisible(_tableEntries[i].ID))
+            result.Add(_tableEntries[i].ID);
+    }
+    for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
+        result.Add(i->Key);
 }
 
 void AssetsCache::GetAllByTypeName(const StringView& typeName, Array<Guid>& result) const
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
+    for (int32 i = 0; i < _tableEntriesCount; i++)
+    {
+        const TableEntry& t = _tableEntries[i];
+        if (GetTableString(t.TypeName, t.TypeNameLength) == typeName && IsTableEntryVisible(t.ID))
+            result.Add(t.ID);
+    }
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
         if (i->Value.Info.TypeName == typeName)
@@ -345,11 +838,7 @@ void AssetsCache::RegisterAssets(FlaxStorage* storage)
     auto storagePath = storage->GetPath();
 
     // Remove all old entries from that location
-    for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
-    {
-        if (i->Value.Info.Path == storagePath)
-            _registry.Remove(i);
-    }
+    RemoveEntries(storagePath, false);
 
     // Find asset IDs collisions
     AssetInfo info;
@@ -372,11 +861,7 @@ void AssetsCache::RegisterAssets(FlaxStorage* storage)
             else
             {
                 // Remove from registry so we can add it again later with the original ID, so we don't loose relations
-                for (auto j = _registry.Begin(); j.IsNotEnd(); ++j)
-                {
-                    if (StringUtils::CompareIgnoreCase(j->Value.Info.Path.GetText(), storagePath.GetText()) == 0)
-                        _registry.Remove(j);
-                }
+                RemoveEntries(info.Path, true);
             }
 #else
             LOG(Warning, "Founded duplicated asset \'{0}\'. Locations: \'{1}\' and \'{2}\'", e.ID, storagePath, info.Path);
@@ -419,11 +904,8 @@ void AssetsCache::RegisterAssets(FlaxStorage* storage)
         LOG(Info, "Register asset {0}:{1} \'{2}\'", e.ID, e.TypeName, storagePath);
 
         // Add new asset entry
-        _registry.Add(e.ID, Entry(e.ID, e.TypeName, storagePath));
+        SetEntry(Entry(e.ID, e.TypeName, storagePath));
     }
-
-    // Mark registry as draft
-    _isDirty = true;
 }
 
 void AssetsCache::RegisterAsset(const AssetHeader& header, const StringView& path)
@@ -442,111 +924,138 @@ void AssetsCache::RegisterAsset(const Guid& id, const String& typeName, const St
     ScopeLock lock(_locker);
 
     // Check if asset has been already added to the registry
-    bool isMissing = true;
-    for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
+    Entry* e = _registry.TryGet(id);
+    int32 index = -1;
+    if (e == nullptr && !_removed.Contains(id))
+        index = FindTableEntry(id);
+    if (e == nullptr && index == -1)
     {
-        auto& e = i->Value;
-
-        if (e.Info.ID == id)
+        for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
         {
-            if (e.Info.Path != path)
-            {
-                e.Info.Path = path;
-                _isDirty = true;
-            }
-            if (e.Info.TypeName != typeName)
+            if (i->Value.Info.Path == path)
             {
-                e.Info.TypeName = typeName;
-                _isDirty = true;
+                e = &i->Value;
+                break;
             }
-            isMissing = false;
-            break;
         }
+        if (e == nullptr)
+            index = FindTableEntry(_tablePaths, _tableEntriesCount, path, true);
+    }
+    if (index != -1)
+    {
+        // Skip if table entry is up to date
+        const TableEntry& t = _tableEntries[index];
+        String tablePath;
+        GetTablePath(t.Path, t.PathLength, tablePath);
+        if (GetTableString(t.TypeName, t.TypeNameLength) == typeName && (t.ID != id || tablePath == path))
+            return;
+        e = PromoteTableEntry(index);
+    }
 
-        if (e.Info.Path == path)
+    if (e)
+    {
+        bool isDirty = false;
+        if (e->Info.ID == id && e->Info.Path != path)
         {
-            if (e.Info.ID != id)
-            {
-                e.Info.Path = path;
-                _isDirty = true;
-            }
-            if (e.Info.TypeName != typeName)
-            {
-                e.Info.TypeName = typeName;
-                _isDirty = true;
-            }
-            isMissing = false;
-            break;
+            e->Info.Path = path;
+            isDirty = true;
+        }
+        if (e->Info.TypeName != typeName)
+        {
+            e->Info.TypeName = typeName;
+            isDirty = true;
+        }
+        if (isDirty)
+        {
+            _changed.Add(e->Info.ID);
+            _isDirty = true;
         }
     }
-
-    if (isMissing)
+    else
     {
         LOG(Info, "Register asset {0}:{1} \'{2}\'", id, typeName, path);
-        _registry.Add(id, Entry(id, typeName, path));
-        _isDirty = true;
+        SetEntry(Entry(id, typeName, path));
     }
 }
 
 bool AssetsCache::DeleteAsset(const StringView& path, AssetInfo* info)
 {
-    bool result = false;
-    _locker.Lock();
-
+    ScopeLock lock(_locker);
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
         if (i->Value.Info.Path == path)
         {
             if (info)
                 *info = i->Value.Info;
-            _registry.Remove(i);
-            _isDirty = true;
-            result = true;
-            break;
+            const Guid id = i->Key;
+            RemoveEntry(id);
+            return true;
         }
     }
-
-    _locker.Unlock();
-    return result;
+    const int32 index = FindTableEntry(_tablePaths, _tableEntriesCount, path, true);
+    if (index != -1)
+    {
+        if (info)
+        {
+            Entry e;
+            GetTableEntry(index, e);
+            *info = e.Info;
+        }
+        RemoveEntry(_tableEntries[index].ID);
+        return true;
+    }
+    return false;
 }
 
 bool AssetsCache::DeleteAsset(const Guid& id, AssetInfo* info)
 {
-    bool result = false;
-    _locker.Lock();
-
+    ScopeLock lock(_locker);
     const auto e = _registry.TryGet(id);
     if (e != nullptr)
     {
         if (info)
             *info = e->Info;
-        _registry.Remove(id);
-        _isDirty = true;
-        result = true;
+        RemoveEntry(id);
+        return true;
     }
-
-    _locker.Unlock();
-    return result;
+    const int32 index = _removed.Contains(id) ? -1 : FindTableEntry(id);
+    if (index != -1)
+    {
+        if (info)
+        {
+            Entry tableEntry;
+            GetTableEntry(index, tableEntry);
+            *info = tableEntry.Info;
+        }
+        RemoveEntry(id);
+        return true;
+    }
+    return false;
 }
 
 bool AssetsCache::RenameAsset(const StringView& oldPath, const StringView& newPath)
 {
-    bool result = false;
-    _locker.Lock();
-
+    ScopeLock lock(_locker);
+    Entry* e = nullptr;
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
         if (i->Value.Info.Path == oldPath)
         {
-            i->Value.Info.Path = newPath;
-            _isDirty = true;
-            result = true;
+            e = &i->Value;
             break;
         }
     }
-
-    _locker.Unlock();
-    return result;
+    if (e == nullptr)
+    {
+        const int32 index = FindTableEntry(_tablePaths, _tableEntriesCount, oldPath, true);
+        if (index == -1)
+            return false;
+        e = PromoteTableEntry(index);
+    }
+    e->Info.Path = newPath;
+    _changed.Add(e->Info.ID);
+    _isDirty = true;
+    return true;
 }
 
 bool AssetsCache::IsEntryValid(Entry& e)
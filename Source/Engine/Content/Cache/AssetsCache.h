@@ -10,11 +10,16 @@
 #endif
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/CriticalSection.h"
 
 struct AssetHeader;
 struct FlaxStorageReference;
 class FlaxStorage;
+class MemoryReadStream;
 
 /// <summary>
 /// Assets cache flags.
@@ -35,7 +40,7 @@ enum class AssetsCacheFlags
 DECLARE_ENUM_OPERATORS(AssetsCacheFlags);
 
 /// <summary>
-/// Flax Game Engine assets cache container
+/// Flax Game Engine assets cache container. The registry file is a sorted binary table queried in-place (memory-mapped in cooked game) and the changes made in Editor are appended to it (file gets compacted once there are many changes).
 /// </summary>
 class FLAXENGINE_API AssetsCache
 {
@@ -70,27 +75,48 @@ class FLAXENGINE_API AssetsCache
         }
     };
 
-    typedef Dictionary<Guid, Entry> Registry;
+    typedef FlatDictionary<Guid, Entry> Registry;
     typedef Dictionary<String, Guid> PathsMapping;
 
 private:
+    struct TableEntry;
+    struct TableIndex;
+
     bool _isDirty = false;
     CriticalSection _locker;
-    Registry _registry;
-    PathsMapping _pathsMapping;
+    Registry _registry; // Entries added or modified since the registry table has been saved (override the table entries)
+    HashSet<Guid> _removed; // Table entries removed since the registry table has been saved
+    HashSet<Guid> _changed; // Entries modified since the last save (to append to the registry file)
     String _path;
 
+    // Registry table (loaded or memory-mapped file data)
+    File* _tableFile = nullptr;
+    const byte* _tableMapping = nullptr;
+    uint32 _tableMappingSize = 0;
+    Array<byte> _tableData;
+    const TableEntry* _tableEntries = nullptr;
+    const TableIndex* _tablePaths = nullptr;
+    const TableIndex* _tableMappings = nullptr;
+    const Char* _tableStrings = nullptr;
+    int32 _tableEntriesCount = 0;
+    int32 _tableMappingsCount = 0;
+    int32 _tableStringsLength = 0;
+    int32 _journalCount = 0;
+    bool _hasTable = false;
+    bool _tableRelativePaths = false;
+    mutable Array<String> _tablePathsCache;
+
+public:
+    /// <summary>
+    /// Finalizes an instance of the <see cref="AssetsCache"/> class.
+    /// </summary>
+    ~AssetsCache();
+
 public:
     /// <summary>
     /// Gets amount of registered assets.
     /// </summary>
-    int32 Size() const
-    {
-        _locker.Lock();
-        const int32 result = _registry.Count();
-        _locker.Unlock();
-        return result;
-    }
+    int32 Size() const;
 
 public:
     /// <summary>
@@ -230,4 +256,20 @@ class FLAXENGINE_API AssetsCache
     /// <param name="e">The asset entry.</param>
     /// <returns>True if is valid, otherwise false.</returns>
     bool IsEntryValid(Entry& e);
+
+private:
+    void Load();
+    bool LoadTable(MemoryReadStream& stream, const byte* data);
+    void UnloadTable();
+    bool AppendChanges();
+    StringView GetTableString(uint32 offset, uint32 length) const;
+    void GetTablePath(uint32 offset, uint32 length, String& result) const;
+    void GetTableEntry(int32 index, Entry& e) const;
+    int32 FindTableEntry(const Guid& id) const;
+    int32 FindTableEntry(const TableIndex* table, int32 count, const StringView& path, bool visibleOnly) const;
+    bool IsTableEntryVisible(const Guid& id) const;
+    Entry* PromoteTableEntry(int32 index);
+    void SetEntry(const Entry& e);
+    void RemoveEntry(const Guid& id);
+    void RemoveEntries(const StringView& path, bool ignoreCase);
 };
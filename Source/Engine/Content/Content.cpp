@@ -7,14 +7,18 @@
 #include "Cache/AssetsCache.h"
 #include "Storage/ContentStorageManager.h"
 #include "Storage/JsonStorageProxy.h"
+#include "Loading/ContentLoadingManager.h"
 #include "Factories/IAssetFactory.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/LogContext.h"
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Utilities.h"
 #include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/MainThreadTask.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Engine/Time.h"
@@ -31,8 +35,13 @@
 #include "Engine/Core/Collections/HashSet.h"
 #endif
 
+// The maximum amount of the slowest assets loading timings to keep
+#define CONTENT_LOAD_TIMINGS_MAX 256
+
 TimeSpan Content::AssetsUpdateInterval = TimeSpan::FromMilliseconds(500);
 TimeSpan Content::AssetsUnloadInterval = TimeSpan::FromSeconds(10);
+uint64 Content::AssetsMemoryBudget = 0;
+bool Content::RecordLoadTimings = !BUILD_RELEASE;
 Delegate<Asset*> Content::AssetDisposing;
 Delegate<Asset*> Content::AssetReloading;
 
@@ -69,6 +78,43 @@ namespace
     TimeSpan LastUnloadCheckTime(0);
     bool IsExiting = false;
 
+    // Evicting assets referenced only by soft references (with the time since when they are not used)
+    struct ColdAsset
+    {
+        Asset* Item;
+        TimeSpan Time;
+
+        bool operator<(const ColdAsset& other) const
+        {
+            return Time < other.Time;
+        }
+    };
+    Dictionary<Asset*, TimeSpan> ColdAssets;
+    Array<ColdAsset> ToEvict;
+    bool IsLowMemory = false;
+
+    // Assets loading timings
+    struct PendingLoadTiming
+    {
+        AssetLoadTiming Timing;
+        double StartTime;
+    };
+    CriticalSection LoadTimingsLocker;
+    Dictionary<Guid, PendingLoadTiming> PendingLoadTimings;
+    Array<AssetLoadTiming> LoadTimings; // The slowest assets (up to CONTENT_LOAD_TIMINGS_MAX)
+
+    bool SortLoadTimings(const AssetLoadTiming& a, const AssetLoadTiming& b)
+    {
+        return a.TotalTimeMs > b.TotalTimeMs;
+    }
+
+    void OnLowMemory()
+    {
+        // Release all unused assets on the next update
+        IsLowMemory = true;
+        LastUnloadCheckTime = TimeSpan::Zero();
+    }
+
 #if ENABLE_ASSETS_DISCOVERY
     DateTime LastWorkspaceDiscovery;
     CriticalSection WorkspaceDiscoveryLocker;
@@ -100,6 +146,8 @@ bool ContentService::Init()
     // Load assets registry
     Cache.Init();
 
+    Platform::LowMemory.Bind<OnLowMemory>();
+
     return false;
 }
 
@@ -126,27 +174,50 @@ void ContentService::LateUpdate()
     if (timeNow - LastUnloadCheckTime < Content::AssetsUpdateInterval)
         return;
     LastUnloadCheckTime = timeNow;
+    const bool isLowMemory = IsLowMemory;
+    const bool useBudget = Content::AssetsMemoryBudget != 0 || isLowMemory;
+    IsLowMemory = false;
+    uint64 memoryUsage = 0;
     AssetsLocker.Lock();
 
     // Verify all assets
     for (auto i = Assets.Begin(); i.IsNotEnd(); ++i)
     {
         Asset* asset = i->Value;
+        const int32 referencesCount = asset->GetReferencesCount();
 
         // Check if has no references and is not during unloading
-        if (asset->GetReferencesCount() <= 0 && !UnloadQueue.ContainsKey(asset))
+        if (referencesCount <= 0 && !UnloadQueue.ContainsKey(asset))
         {
             // Add to removes
             UnloadQueue.Add(asset, timeNow);
         }
+
+        // Track assets that are referenced only by soft references (candidates for eviction)
+        if (useBudget)
+        {
+            if (referencesCount > 0 && referencesCount <= asset->GetSoftReferencesCount() && asset->IsLoaded() && !asset->IsVirtual())
+            {
+                if (!ColdAssets.ContainsKey(asset))
+                    ColdAssets.Add(asset, timeNow);
+            }
+            else
+            {
+                ColdAssets.Remove(asset);
+            }
+            if (asset->IsLoaded())
+                memoryUsage += asset->GetMemoryUsage();
+        }
     }
+    if (!useBudget)
+        ColdAssets.Clear();
 
     // Find assets to unload in unload queue
     ToUnload.Clear();
     for (auto i = UnloadQueue.Begin(); i != UnloadQueue.End(); ++i)
     {
         // Check if asset gain any new reference or if need to unload it
-        if (i->Key->GetReferencesCount() > 0 || timeNow - i->Value >= Content::AssetsUnloadInterval)
+        if (i->Key->GetReferencesCount() > 0 || timeNow - i->Value >= Content::AssetsUnloadInterval || isLowMemory)
         {
             ToUnload.Add(i->Key);
         }
@@ -167,6 +238,28 @@ void ContentService::LateUpdate()
         UnloadQueue.Remove(asset);
     }
 
+    // Evict the least recently used assets when exceeding the memory budget (and all of them on low memory)
+    if (ColdAssets.HasItems() && (isLowMemory || memoryUsage > Content::AssetsMemoryBudget))
+    {
+        PROFILE_CPU_NAMED("Evict Assets");
+        ToEvict.Clear();
+        for (auto i = ColdAssets.Begin(); i.IsNotEnd(); ++i)
+            ToEvict.Add({ i->Key, i->Value });
+        Sorting::QuickSort(ToEvict.Get(), ToEvict.Count());
+        for (int32 i = 0; i < ToEvict.Count() && (isLowMemory || memoryUsage > Content::AssetsMemoryBudget); i++)
+        {
+            Asset* asset = ToEvict[i].Item;
+            if (asset->GetReferencesCount() > asset->GetSoftReferencesCount() || !asset->IsLoaded())
+                continue;
+            const uint64 assetMemoryUsage = asset->GetMemoryUsage();
+            memoryUsage -= Math::Min(memoryUsage, assetMemoryUsage);
+            LOG(Info, "Evicting asset {0} ({1})", asset->ToString(), Utilities::BytesToText(assetMemoryUsage));
+            asset->_isEvicted = true;
+            ColdAssets.Remove(asset);
+            Content::UnloadAsset(asset);
+        }
+    }
+
     AssetsLocker.Unlock();
 
     // Update cache (for longer sessions it will help to reduce cache misses)
@@ -176,6 +269,7 @@ void ContentService::LateUpdate()
 void ContentService::Dispose()
 {
     IsExiting = true;
+    Platform::LowMemory.Unbind<OnLowMemory>();
 
     // Save assets registry before engine closing
     Cache.Save();
@@ -334,6 +428,72 @@ bool Content::GetAssetInfo(const StringView& path, AssetInfo& info)
 #endif
 }
 
+void Content::PrefetchAssetsInfo(const Array<String, HeapAllocation>& paths)
+{
+#if ENABLE_ASSETS_DISCOVERY
+    PROFILE_CPU();
+
+    // Pick files that are not yet in the registry
+    Array<String> binaryFiles, jsonFiles;
+    AssetInfo info;
+    for (const String& path : paths)
+    {
+        if (Cache.FindAsset(path, info))
+            continue;
+        const auto extension = FileSystem::GetExtension(path).ToLower();
+        if (ContentStorageManager::IsFlaxStorageExtension(extension))
+        {
+            // Skip packages in editor (results in conflicts with build game packages if deployed inside project folder)
+#if USE_EDITOR
+            if (extension == PACKAGE_FILES_EXTENSION)
+                continue;
+#endif
+            binaryFiles.Add(path);
+        }
+        else if (JsonStorageProxy::IsValidExtension(extension))
+        {
+            jsonFiles.Add(path);
+        }
+    }
+
+    // Open binary storage containers (headers are loaded in parallel)
+    if (binaryFiles.HasItems())
+    {
+        Array<FlaxStorageReference> storages;
+        ContentStorageManager::GetStorages(ToSpan(binaryFiles), storages);
+        for (const FlaxStorageReference& storage : storages)
+        {
+            if (storage)
+                Cache.RegisterAssets(storage);
+        }
+    }
+
+    // Parse json assets in parallel
+    if (jsonFiles.HasItems())
+    {
+        struct JsonAssetHeader
+        {
+            Guid ID;
+            String TypeName;
+            bool Valid;
+        };
+        Array<JsonAssetHeader> headers;
+        headers.Resize(jsonFiles.Count());
+        JobSystem::Execute([&](int32 i)
+        {
+            auto& header = headers[i];
+            header.Valid = JsonStorageProxy::GetAssetInfo(jsonFiles[i], header.ID, header.TypeName);
+        }, jsonFiles.Count());
+        for (int32 i = 0; i < jsonFiles.Count(); i++)
+        {
+            const auto& header = headers[i];
+            if (header.Valid)
+                Cache.RegisterAsset(header.ID, header.TypeName, jsonFiles[i]);
+        }
+    }
+#endif
+}
+
 String Content::GetEditorAssetPath(const Guid& id)
 {
     return Cache.GetEditorAssetPath(id);
@@ -404,6 +564,23 @@ ContentStats Content::GetStats()
     return stats;
 }
 
+Array<AssetLoadTiming, HeapAllocation> Content::GetSlowestAssets(int32 count)
+{
+    LoadTimingsLocker.Lock();
+    Array<AssetLoadTiming> result(LoadTimings);
+    LoadTimingsLocker.Unlock();
+    Sorting::QuickSort(result.Get(), result.Count(), &SortLoadTimings);
+    if (result.Count() > count)
+        result.Resize(Math::Max(count, 0));
+    return result;
+}
+
+void Content::ClearLoadTimings()
+{
+    ScopeLock lock(LoadTimingsLocker);
+    LoadTimings.Clear();
+}
+
 Asset* Content::LoadAsyncInternal(const StringView& internalPath, const MClass* type)
 {
     CHECK_RETURN(type, nullptr);
@@ -446,17 +623,17 @@ FLAXENGINE_API Asset* LoadAsset(const Guid& id, const ScriptingTypeHandle& type)
     return Content::LoadAsync(id, type);
 }
 
-Asset* Content::LoadAsync(const StringView& path, const MClass* type)
+Asset* Content::LoadAsync(const StringView& path, const MClass* type, ContentLoadPriority priority)
 {
     CHECK_RETURN(type, nullptr);
     const auto scriptingType = Scripting::FindScriptingType(type->GetFullName());
     if (scriptingType)
-        return LoadAsync(path, scriptingType);
+        return LoadAsync(path, scriptingType, priority);
     LOG(Error, "Failed to find asset type '{0}'.", String(type->GetFullName()));
     return nullptr;
 }
 
-Asset* Content::LoadAsync(const StringView& path, const ScriptingTypeHandle& type)
+Asset* Content::LoadAsync(const StringView& path, const ScriptingTypeHandle& type, ContentLoadPriority priority)
 {
     // Ensure path is in a valid format
     String pathNorm(path);
@@ -474,7 +651,7 @@ Asset* Content::LoadAsync(const StringView& path, const ScriptingTypeHandle& typ
     AssetInfo assetInfo;
     if (GetAssetInfo(filePath, assetInfo))
     {
-        return LoadAsync(assetInfo.ID, type);
+        return LoadAsync(assetInfo.ID, type, priority);
     }
 
     return nullptr;
@@ -496,12 +673,12 @@ const Dictionary<Guid, Asset*>& Content::GetAssetsRaw()
     return Assets;
 }
 
-Asset* Content::LoadAsync(const Guid& id, const MClass* type)
+Asset* Content::LoadAsync(const Guid& id, const MClass* type, ContentLoadPriority priority)
 {
     CHECK_RETURN(type, nullptr);
     const auto scriptingType = Scripting::FindScriptingType(type->GetFullName());
     if (scriptingType)
-        return LoadAsync(id, scriptingType);
+        return LoadAsync(id, scriptingType, priority);
     LOG(Error, "Failed to find asset type '{0}'.", String(type->GetFullName()));
     return nullptr;
 }
@@ -916,9 +1093,66 @@ void Content::onAssetUnload(Asset* asset)
 
     Assets.Remove(asset->GetID());
     UnloadQueue.Remove(asset);
+    ColdAssets.Remove(asset);
+    if (RecordLoadTimings)
+    {
+        ScopeLock lock(LoadTimingsLocker);
+        PendingLoadTimings.Remove(asset->GetID());
+    }
     LoadedAssetsToInvoke.Remove(asset);
 }
 
+void Content::onAssetLoadStart(Asset* asset)
+{
+    PendingLoadTiming e;
+    e.Timing.ID = asset->GetID();
+    e.Timing.Path = asset->GetPath();
+    e.StartTime = Platform::GetTimeSeconds();
+    ScopeLock lock(LoadTimingsLocker);
+    PendingLoadTimings[e.Timing.ID] = MoveTemp(e);
+}
+
+void Content::onAssetLoadTask(const Guid& id, const ContentLoadingTimings& timings, double time)
+{
+    ScopeLock lock(LoadTimingsLocker);
+    auto e = PendingLoadTimings.TryGet(id);
+    if (!e)
+        return;
+    e->Timing.ReadTimeMs += (float)(timings.ReadTime * 1000.0);
+    e->Timing.DecompressTimeMs += (float)(timings.DecompressTime * 1000.0);
+    e->Timing.LoadTimeMs += (float)(Math::Max(time - timings.ReadTime - timings.DecompressTime, 0.0) * 1000.0);
+    e->Timing.BytesRead += timings.BytesRead;
+    e->Timing.ThreadID = Platform::GetCurrentThreadID();
+}
+
+void Content::onAssetLoadEnd(Asset* asset, double mainThreadTime, bool failed)
+{
+    ScopeLock lock(LoadTimingsLocker);
+    auto e = PendingLoadTimings.TryGet(asset->GetID());
+    if (!e)
+        return;
+    AssetLoadTiming timing = MoveTemp(e->Timing);
+    timing.TotalTimeMs = (float)((Platform::GetTimeSeconds() - e->StartTime) * 1000.0);
+    timing.MainThreadTimeMs = (float)(mainThreadTime * 1000.0);
+    timing.Failed = failed;
+    PendingLoadTimings.Remove(asset->GetID());
+
+    // Keep only the slowest assets
+    if (LoadTimings.Count() < CONTENT_LOAD_TIMINGS_MAX)
+    {
+        LoadTimings.Add(MoveTemp(timing));
+        return;
+    }
+    int32 fastest = 0;
+    for (int32 i = 1; i < LoadTimings.Count(); i++)
+    {
+        if (LoadTimings[i].TotalTimeMs < LoadTimings[fastest].TotalTimeMs)
+            fastest = i;
+    }
+    if (LoadTimings[fastest].TotalTimeMs < timing.TotalTimeMs)
+        LoadTimings[fastest] = MoveTemp(timing);
+}
+
 void Content::onAssetChangeId(Asset* asset, const Guid& oldId, const Guid& newId)
 {
     ScopeLock locker(AssetsLocker);
@@ -954,7 +1188,7 @@ bool Content::IsAssetTypeIdInvalid(const ScriptingTypeHandle& type, const Script
     return true;
 }
 
-Asset* Content::LoadAsync(const Guid& id, const ScriptingTypeHandle& type)
+Asset* Content::LoadAsync(const Guid& id, const ScriptingTypeHandle& type, ContentLoadPriority priority)
 {
     if (!id.IsValid())
         return nullptr;
@@ -1050,7 +1284,7 @@ Asset* Content::LoadAsync(const Guid& id, const ScriptingTypeHandle& type)
     Assets.Add(id, result);
 
     // Start asset loading
-    result->startLoading();
+    result->startLoading(priority);
 
     // Remove from the loading queue and release lock
     LoadCallAssets.Remove(id);
@@ -27,6 +27,33 @@ API_STRUCT() struct FLAXENGINE_API ContentStats
     API_FIELD() int32 VirtualAssetsCount = 0;
 };
 
+// Asset loading timings breakdown (see Content::GetSlowestAssets).
+API_STRUCT() struct FLAXENGINE_API AssetLoadTiming
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(AssetLoadTiming);
+
+    // The asset ID.
+    API_FIELD() Guid ID;
+    // The asset path.
+    API_FIELD() String Path;
+    // The total time (in milliseconds) from the loading start until the asset got loaded (includes waiting for the loading threads).
+    API_FIELD() float TotalTimeMs = 0;
+    // The time (in milliseconds) spent on reading the asset data from the storage.
+    API_FIELD() float ReadTimeMs = 0;
+    // The time (in milliseconds) spent on decompressing the asset data.
+    API_FIELD() float DecompressTimeMs = 0;
+    // The time (in milliseconds) spent by the loading tasks on the asset loading (excluding data reading and decompression).
+    API_FIELD() float LoadTimeMs = 0;
+    // The time (in milliseconds) spent on the main thread on the asset loaded event.
+    API_FIELD() float MainThreadTimeMs = 0;
+    // The amount of bytes read from the storage.
+    API_FIELD() uint64 BytesRead = 0;
+    // The ID of the thread that loaded the asset.
+    API_FIELD() uint64 ThreadID = 0;
+    // True if asset loading failed.
+    API_FIELD() bool Failed = false;
+};
+
 /// <summary>
 /// Loads and manages assets.
 /// </summary>
@@ -35,6 +62,7 @@ API_CLASS(Static) class FLAXENGINE_API Content
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(Content);
     friend Engine;
     friend Asset;
+    friend class ContentLoadTask;
 public:
     /// <summary>
     /// The time between content pool updates.
@@ -46,6 +74,16 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// </summary>
     static TimeSpan AssetsUnloadInterval;
 
+    /// <summary>
+    /// The memory budget (in bytes) for the loaded assets. When exceeded, the assets referenced only by the soft references (see SoftAssetReference) get evicted (least recently used first) and are reloaded on the next use. Use 0 to disable it.
+    /// </summary>
+    static uint64 AssetsMemoryBudget;
+
+    /// <summary>
+    /// Enables recording of the assets loading timings (see GetSlowestAssets). Enabled by default in the development builds.
+    /// </summary>
+    API_FIELD() static bool RecordLoadTimings;
+
 public:
     /// <summary>
     /// Gets the assets registry.
@@ -70,6 +108,12 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// <returns>True if found any asset, otherwise false.</returns>
     API_FUNCTION() static bool GetAssetInfo(const StringView& path, API_PARAM(Out) AssetInfo& info);
 
+    /// <summary>
+    /// Reads the assets info from the files at the given paths and registers them in the assets registry (binary files headers and json assets are processed in parallel on job system threads). Speeds up the following GetAssetInfo calls when scanning many files (eg. project folders in the Editor).
+    /// </summary>
+    /// <param name="paths">The assets paths.</param>
+    API_FUNCTION() static void PrefetchAssetsInfo(const Array<String, HeapAllocation>& paths);
+
     /// <summary>
     /// Finds the asset path by id. In editor it returns the actual asset path, at runtime it returns the mapped asset path.
     /// </summary>
@@ -118,6 +162,18 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// </summary>
     API_PROPERTY() static ContentStats GetStats();
 
+    /// <summary>
+    /// Gets the slowest loaded assets timings recorded since the startup (or the last ClearLoadTimings call). Requires RecordLoadTimings to be enabled.
+    /// </summary>
+    /// <param name="count">The maximum amount of assets to return.</param>
+    /// <returns>The assets loading timings, sorted from the slowest one.</returns>
+    API_FUNCTION() static Array<AssetLoadTiming, HeapAllocation> GetSlowestAssets(int32 count = 20);
+
+    /// <summary>
+    /// Clears the recorded assets loading timings.
+    /// </summary>
+    API_FUNCTION() static void ClearLoadTimings();
+
     /// <summary>
     /// Gets the assets (loaded or during load).
     /// </summary>
@@ -135,27 +191,30 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// </summary>
     /// <param name="id">Asset unique ID</param>
     /// <param name="type">The asset type. If loaded object has different type (excluding types derived from the given) the loading fails.</param>
+    /// <param name="priority">The loading priority (used only if asset is not yet loaded).</param>
     /// <returns>Loaded asset or null if cannot</returns>
-    API_FUNCTION() static Asset* LoadAsync(const Guid& id, API_PARAM(Attributes="TypeReference(typeof(Asset))") const MClass* type);
+    API_FUNCTION() static Asset* LoadAsync(const Guid& id, API_PARAM(Attributes="TypeReference(typeof(Asset))") const MClass* type, ContentLoadPriority priority = ContentLoadPriority::Normal);
 
     /// <summary>
     /// Loads asset and holds it until it won't be referenced by any object. Returns null if asset is missing. Actual asset data loading is performed on a other thread in async.
     /// </summary>
     /// <param name="id">Asset unique ID</param>
     /// <param name="type">The asset type. If loaded object has different type (excluding types derived from the given) the loading fails.</param>
+    /// <param name="priority">The loading priority (used only if asset is not yet loaded).</param>
     /// <returns>Loaded asset or null if cannot</returns>
-    static Asset* LoadAsync(const Guid& id, const ScriptingTypeHandle& type);
+    static Asset* LoadAsync(const Guid& id, const ScriptingTypeHandle& type, ContentLoadPriority priority = ContentLoadPriority::Normal);
 
     /// <summary>
     /// Loads asset and holds it until it won't be referenced by any object. Returns null if asset is missing. Actual asset data loading is performed on a other thread in async.
     /// </summary>
     /// <param name="id">Asset unique ID</param>
+    /// <param name="priority">The loading priority (used only if asset is not yet loaded).</param>
     /// <typeparam name="T">Type of the asset to load. Includes any asset types derived from the type.</typeparam>
     /// <returns>Loaded asset or null if cannot</returns>
     template<typename T>
-    FORCE_INLINE static T* LoadAsync(const Guid& id)
+    FORCE_INLINE static T* LoadAsync(const Guid& id, ContentLoadPriority priority = ContentLoadPriority::Normal)
     {
-        return static_cast<T*>(LoadAsync(id, T::TypeInitializer));
+        return static_cast<T*>(LoadAsync(id, T::TypeInitializer, priority));
     }
 
     /// <summary>
@@ -163,27 +222,30 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// </summary>
     /// <param name="path">The path of the asset (absolute or relative to the current workspace directory).</param>
     /// <param name="type">The asset type. If loaded object has different type (excluding types derived from the given) the loading fails.</param>
+    /// <param name="priority">The loading priority (used only if asset is not yet loaded).</param>
     /// <returns>Loaded asset or null if cannot</returns>
-    API_FUNCTION(Attributes="HideInEditor") static Asset* LoadAsync(const StringView& path, const MClass* type);
+    API_FUNCTION(Attributes="HideInEditor") static Asset* LoadAsync(const StringView& path, const MClass* type, ContentLoadPriority priority = ContentLoadPriority::Normal);
 
     /// <summary>
     /// Loads asset and holds it until it won't be referenced by any object. Returns null if asset is missing. Actual asset data loading is performed on a other thread in async.
     /// </summary>
     /// <param name="path">The path of the asset (absolute or relative to the current workspace directory).</param>
     /// <param name="type">The asset type. If loaded object has different type (excluding types derived from the given) the loading fails.</param>
+    /// <param name="priority">The loading priority (used only if asset is not yet loaded).</param>
     /// <returns>Loaded asset or null if cannot</returns>
-    static Asset* LoadAsync(const StringView& path, const ScriptingTypeHandle& type);
+    static Asset* LoadAsync(const StringView& path, const ScriptingTypeHandle& type, ContentLoadPriority priority = ContentLoadPriority::Normal);
 
     /// <summary>
     /// Loads asset and holds it until it won't be referenced by any object. Returns null if asset is missing. Actual asset data loading is performed on a other thread in async.
     /// </summary>
     /// <param name="path">The path of the asset (absolute or relative to the current workspace directory).</param>
+    /// <param name="priority">The loading priority (used only if asset is not yet loaded).</param>
     /// <typeparam name="T">Type of the asset to load. Includes any asset types derived from the type.</typeparam>
     /// <returns>Loaded asset or null if cannot</returns>
     template<typename T>
-    FORCE_INLINE static T* LoadAsync(const StringView& path)
+    FORCE_INLINE static T* LoadAsync(const StringView& path, ContentLoadPriority priority = ContentLoadPriority::Normal)
     {
-        return static_cast<T*>(LoadAsync(path, T::TypeInitializer));
+        return static_cast<T*>(LoadAsync(path, T::TypeInitializer, priority));
     }
 
     /// <summary>
@@ -366,6 +428,9 @@ API_CLASS(Static) class FLAXENGINE_API Content
     static void onAssetLoaded(Asset* asset);
     static void onAssetUnload(Asset* asset);
     static void onAssetChangeId(Asset* asset, const Guid& oldId, const Guid& newId);
+    static void onAssetLoadStart(Asset* asset);
+    static void onAssetLoadTask(const Guid& id, const struct ContentLoadingTimings& timings, double time);
+    static void onAssetLoadEnd(Asset* asset, double mainThreadTime, bool failed);
 
 private:
     static void deleteFileSafety(const StringView& path, const Guid& id);
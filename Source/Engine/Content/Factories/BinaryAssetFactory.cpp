@@ -2,6 +2,7 @@
 
 #include "BinaryAssetFactory.h"
 #include "../BinaryAsset.h"
+#include "../Content.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Types/TimeSpan.h"
@@ -12,7 +13,7 @@
 #endif
 #include "Engine/Content/Upgraders/BinaryAssetUpgrader.h"
 
-bool BinaryAssetFactoryBase::Init(BinaryAsset* asset)
+bool BinaryAssetFactoryBase::Init(BinaryAsset* asset, ContentLoadPriority priority)
 {
     ASSERT(asset && asset->Storage);
     auto storage = asset->Storage;
@@ -99,6 +100,13 @@ bool BinaryAssetFactoryBase::Init(BinaryAsset* asset)
         return true;
     }
 
+    // Prefetch the assets referenced by the cooked asset to load them in parallel with it (instead of discovering them later during asset loading)
+    if (!storage->AllowDataModifications())
+    {
+        for (const auto& e : initData.Dependencies)
+            Content::LoadAsync(e.First, Asset::TypeInitializer, priority);
+    }
+
     // Initialize asset
     if (asset->Init(initData))
     {
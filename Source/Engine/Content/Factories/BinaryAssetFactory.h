@@ -3,6 +3,7 @@
 #pragma once
 
 #include "IAssetFactory.h"
+#include "Engine/Content/Loading/ContentLoadPriority.h"
 #if USE_EDITOR
 #include "Engine/Content/Upgraders/BinaryAssetUpgrader.h"
 #endif
@@ -24,7 +25,7 @@ class FLAXENGINE_API BinaryAssetFactoryBase : public IAssetFactory
     /// </summary>
     /// <param name="asset">The asset.</param>
     /// <returns>True if failed, otherwise false.</returns>
-    bool Init(BinaryAsset* asset);
+    bool Init(BinaryAsset* asset, ContentLoadPriority priority = ContentLoadPriority::Normal);
 
 protected:
     virtual BinaryAsset* Create(const AssetInfo& info) = 0;
@@ -14,6 +14,7 @@
 #include "Cache/AssetsCache.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Config/Settings.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Content/Factories/JsonAssetFactory.h"
@@ -276,15 +277,20 @@ Asset::LoadResult JsonAssetBase::loadAsset()
     auto& data = chunk->Data;
 #endif
 
-    // Parse json document
+    if (JsonBinary::IsBinary(data.Get(), data.Length()))
     {
-        PROFILE_CPU_NAMED("Json.Parse");
-        Document.Parse(data.Get<char>(), data.Length());
+        // Decode binary json (eg. cooked scene or prefab)
+        if (JsonBinary::Read(data.Get(), data.Length(), Document))
+        {
+            LOG(Warning, "Invalid binary json data. {0}", ToString());
+            return LoadResult::CannotLoadData;
+        }
     }
-    if (Document.HasParseError())
+    else
     {
-        Log::JsonParseException(Document.GetParseError(), Document.GetErrorOffset());
-        return LoadResult::CannotLoadData;
+        // Parse json document
+        if (JsonTools::ParseDocument(Document, data.Get<char>(), data.Length()))
+            return LoadResult::CannotLoadData;
     }
 
     // Gather information from the header
@@ -0,0 +1,206 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ContentLoadOrder.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+
+// Increment to invalidate the recorded files (eg. when changing the file format)
+#define CONTENT_LOAD_ORDER_VERSION 1
+
+namespace
+{
+    struct SceneLoadOrder
+    {
+        Guid SceneId;
+        Array<Guid> Assets;
+        HashSet<Guid> AssetsSet;
+
+        void Add(const Guid& id)
+        {
+            if (!AssetsSet.Contains(id))
+            {
+                AssetsSet.Add(id);
+                Assets.Add(id);
+            }
+        }
+    };
+
+    CriticalSection Locker;
+    Array<SceneLoadOrder> Scenes; // The first entry is used for the assets loaded before any scene (eg. game settings)
+    int32 CurrentScene = 0;
+    bool IsRecordingEnabled = false;
+    bool IsModified = false;
+
+    String GetRecordingPath()
+    {
+#if USE_EDITOR
+        return Globals::ProjectCacheFolder / TEXT("LoadOrder.bin");
+#else
+        return Globals::ProductLocalFolder / TEXT("LoadOrder.bin");
+#endif
+    }
+
+    bool Load(const StringView& path, Array<SceneLoadOrder>& scenes)
+    {
+        Array<byte> data;
+        if (File::ReadAllBytes(path, data))
+            return true;
+        MemoryReadStream stream(data.Get(), data.Count());
+        int32 version, count;
+#define CHECK_SIZE(size) if (stream.GetLength() - stream.GetPosition() < (uint32)(size)) return true
+        CHECK_SIZE(sizeof(int32) * 2);
+        stream.ReadInt32(&version);
+        stream.ReadInt32(&count);
+        if (version != CONTENT_LOAD_ORDER_VERSION || count < 0)
+            return true;
+        scenes.Resize(count);
+        for (int32 i = 0; i < count; i++)
+        {
+            auto& scene = scenes[i];
+            int32 assetsCount;
+            CHECK_SIZE(sizeof(Guid) + sizeof(int32));
+            stream.Read(scene.SceneId);
+            stream.ReadInt32(&assetsCount);
+            CHECK_SIZE(assetsCount * sizeof(Guid));
+            scene.Assets.Resize(assetsCount, false);
+            stream.ReadBytes(scene.Assets.Get(), assetsCount * sizeof(Guid));
+            for (const Guid& id : scene.Assets)
+                scene.AssetsSet.Add(id);
+        }
+#undef CHECK_SIZE
+        return false;
+    }
+
+    void Save(const String& path)
+    {
+        MemoryWriteStream stream(1024);
+        stream.WriteInt32(CONTENT_LOAD_ORDER_VERSION);
+        stream.WriteInt32(Scenes.Count());
+        for (const auto& scene : Scenes)
+        {
+            stream.Write(scene.SceneId);
+            stream.WriteInt32(scene.Assets.Count());
+            stream.WriteBytes(scene.Assets.Get(), scene.Assets.Count() * sizeof(Guid));
+        }
+        if (File::WriteAllBytes(path, stream.GetHandle(), (int32)stream.GetPosition()))
+        {
+            LOG(Warning, "Failed to save content load order file {0}", path);
+        }
+    }
+}
+
+class ContentLoadOrderService : public EngineService
+{
+public:
+    ContentLoadOrderService()
+        : EngineService(TEXT("Content Load Order"), -30)
+    {
+    }
+
+    bool Init() override;
+    void Dispose() override;
+};
+
+ContentLoadOrderService ContentLoadOrderServiceInstance;
+
+bool ContentLoadOrderService::Init()
+{
+#if USE_EDITOR || !BUILD_RELEASE
+    IsRecordingEnabled = CommandLine::Options.RecordLoadOrder.IsTrue();
+#endif
+    if (!IsRecordingEnabled)
+        return false;
+
+    // Recording accumulates data from the previous sessions
+    const String path = GetRecordingPath();
+    if (FileSystem::FileExists(path) && Load(path, Scenes))
+    {
+        LOG(Warning, "Invalid content load order file {0}", path);
+        Scenes.Clear();
+    }
+    if (Scenes.IsEmpty())
+        Scenes.AddOne();
+    CurrentScene = 0;
+    LOG(Info, "Recording content load order to {0}", path);
+    return false;
+}
+
+void ContentLoadOrderService::Dispose()
+{
+    ScopeLock lock(Locker);
+    if (IsRecordingEnabled && IsModified)
+    {
+        Save(GetRecordingPath());
+        IsModified = false;
+    }
+    Scenes.Clear();
+}
+
+bool ContentLoadOrder::IsRecording()
+{
+    return IsRecordingEnabled;
+}
+
+void ContentLoadOrder::BeginScene(const Guid& sceneId)
+{
+    ScopeLock lock(Locker);
+    if (Scenes.IsEmpty())
+        return;
+    for (int32 i = 1; i < Scenes.Count(); i++)
+    {
+        if (Scenes[i].SceneId == sceneId)
+        {
+            CurrentScene = i;
+            return;
+        }
+    }
+    CurrentScene = Scenes.Count();
+    Scenes.AddOne().SceneId = sceneId;
+    IsModified = true;
+}
+
+void ContentLoadOrder::Record(const Guid& id)
+{
+    ScopeLock lock(Locker);
+    if (Scenes.IsEmpty())
+        return;
+
+    // Skip assets already used earlier by the other scenes (they are placed next to the first use in the packages)
+    for (int32 i = 0; i < Scenes.Count(); i++)
+    {
+        if (i != CurrentScene && Scenes[i].AssetsSet.Contains(id))
+            return;
+    }
+    const int32 count = Scenes[CurrentScene].Assets.Count();
+    Scenes[CurrentScene].Add(id);
+    IsModified |= count != Scenes[CurrentScene].Assets.Count();
+}
+
+bool ContentLoadOrder::Load(const StringView& path, Array<Guid>& result)
+{
+    Array<SceneLoadOrder> scenes;
+    if (::Load(path, scenes))
+        return true;
+    HashSet<Guid> added;
+    for (const auto& scene : scenes)
+    {
+        for (const Guid& id : scene.Assets)
+        {
+            if (!added.Contains(id))
+            {
+                added.Add(id);
+                result.Add(id);
+            }
+        }
+    }
+    return false;
+}
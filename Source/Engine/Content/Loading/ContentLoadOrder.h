@@ -0,0 +1,42 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+
+struct Guid;
+class StringView;
+
+/// <summary>
+/// Records the order in which the assets get loaded for the first time (grouped per loaded scene). Recording is enabled with -recordloadorder command line switch (eg. during playtests) and the results are merged into the file saved on exit.
+/// Game Cooker uses the recorded file to lay out the assets in the packages in the first-use order (see BuildSettings.LoadOrderFile) so the content loading reads the packages near-sequentially.
+/// </summary>
+class FLAXENGINE_API ContentLoadOrder
+{
+public:
+    /// <summary>
+    /// Checks if the load order recording is enabled.
+    /// </summary>
+    static bool IsRecording();
+
+    /// <summary>
+    /// Begins the scene loading. Assets loaded after this call are recorded for that scene.
+    /// </summary>
+    /// <param name="sceneId">The scene asset ID.</param>
+    static void BeginScene(const Guid& sceneId);
+
+    /// <summary>
+    /// Records the asset loading start.
+    /// </summary>
+    /// <param name="id">The asset ID.</param>
+    static void Record(const Guid& id);
+
+    /// <summary>
+    /// Loads the recorded load order file.
+    /// </summary>
+    /// <param name="path">The file path.</param>
+    /// <param name="result">The output assets list in the first-use order (startup assets first, then the assets of the scenes in the recorded order, each asset is listed once).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool Load(const StringView& path, Array<Guid>& result);
+};
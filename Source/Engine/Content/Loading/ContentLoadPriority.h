@@ -0,0 +1,34 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Config.h"
+
+/// <summary>
+/// The content loading priority. Loading threads pick up the queued tasks with higher priority first.
+/// </summary>
+API_ENUM() enum class ContentLoadPriority
+{
+    /// <summary>
+    /// The content needed right now (eg. UI or the assets that the game is waiting for).
+    /// </summary>
+    Immediate = 0,
+
+    /// <summary>
+    /// The content needed soon (eg. the nearby objects).
+    /// </summary>
+    High = 1,
+
+    /// <summary>
+    /// The default priority.
+    /// </summary>
+    Normal = 2,
+
+    /// <summary>
+    /// The content that can be loaded later (eg. background level loading or prefetching).
+    /// </summary>
+    Background = 3,
+
+    API_ENUM(Attributes="HideInEditor")
+    MAX
+};
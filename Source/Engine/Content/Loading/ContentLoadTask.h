@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Engine/Threading/Task.h"
+#include "Engine/Core/Types/Guid.h"
+#include "ContentLoadPriority.h"
 
 class Asset;
 class LoadingThread;
@@ -20,6 +22,16 @@ class ContentLoadTask : public Task
     /// </summary>
     DECLARE_ENUM_5(Result, Ok, AssetLoadError, MissingReferences, LoadDataError, TaskFailed);
 
+    /// <summary>
+    /// The loading priority (set before starting the task).
+    /// </summary>
+    ContentLoadPriority Priority = ContentLoadPriority::Normal;
+
+    /// <summary>
+    /// The ID of the loaded asset used to record the loading timings (set before starting the task, optional).
+    /// </summary>
+    Guid AssetID = Guid::Empty;
+
 protected:
     virtual Result run() = 0;
 
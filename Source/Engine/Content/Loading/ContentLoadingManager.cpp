@@ -9,22 +9,62 @@
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Content/Config.h"
+#include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/ConcurrentTaskQueue.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #if USE_EDITOR && PLATFORM_WINDOWS
 #include "Engine/Platform/Win32/IncludeWindowsHeaders.h"
 #include <propidlbase.h>
 #endif
 
+// The amount of idle iterations the loading thread spins (and yields) looking for a new task before going to sleep
+#define LOADING_THREAD_SPIN_COUNT 32
+
 namespace ContentLoadingManagerImpl
 {
     THREADLOCAL LoadingThread* ThisThread = nullptr;
+    THREADLOCAL ContentLoadingTimings* ThisTimings = nullptr;
     LoadingThread* MainThread = nullptr;
     Array<LoadingThread*> Threads;
-    ConcurrentTaskQueue<ContentLoadTask> Tasks;
+    ConcurrentTaskQueue<ContentLoadTask> Tasks[(int32)ContentLoadPriority::MAX];
     ConditionVariable TasksSignal;
     CriticalSection TasksMutex;
+    volatile int64 SleepingThreads = 0;
+
+    int32 GetTasksCount()
+    {
+        int32 count = 0;
+        for (const auto& tasks : Tasks)
+            count += tasks.Count();
+        return count;
+    }
+
+    bool DequeueTask(ContentLoadTask*& task)
+    {
+        // Pick the tasks with the highest priority first
+        for (auto& tasks : Tasks)
+        {
+            if (tasks.try_dequeue(task))
+                return true;
+        }
+        return false;
+    }
+
+    void NotifyTasks(bool all = false)
+    {
+        // Ensure that tasks added to the queue are visible before checking the sleeping threads (paired with thread going to sleep)
+        Platform::MemoryBarrier();
+        if (Platform::AtomicRead(&SleepingThreads) == 0 && !all)
+            return;
+        TasksMutex.Lock();
+        if (all)
+            TasksSignal.NotifyAll();
+        else
+            TasksSignal.NotifyOne();
+        TasksMutex.Unlock();
+    }
 };
 
 using namespace ContentLoadingManagerImpl;
@@ -122,18 +162,30 @@ int32 LoadingThread::Run()
 
     ContentLoadTask* task;
     ThisThread = this;
+    int32 spinCount = 0;
 
     while (HasExitFlagClear())
     {
-        if (Tasks.try_dequeue(task))
+        if (DequeueTask(task))
         {
             Run(task);
+            spinCount = 0;
+        }
+        else if (spinCount < LOADING_THREAD_SPIN_COUNT)
+        {
+            // Spin for a while to reduce latency of the tasks that come in bursts (eg. streaming)
+            spinCount++;
+            Platform::Sleep(0);
         }
         else
         {
             TasksMutex.Lock();
-            TasksSignal.Wait(TasksMutex);
+            Platform::InterlockedIncrement(&SleepingThreads);
+            if (ContentLoadingManagerImpl::GetTasksCount() == 0 && HasExitFlagClear())
+                TasksSignal.Wait(TasksMutex);
+            Platform::InterlockedDecrement(&SleepingThreads);
             TasksMutex.Unlock();
+            spinCount = 0;
         }
     }
 
@@ -148,6 +200,11 @@ void LoadingThread::Exit()
     LOG(Info, "Content thread '{0}' exited. Load calls: {1}", _thread->GetName(), _totalTasksDoneCount);
 }
 
+ContentLoadingTimings* ContentLoadingTimings::GetCurrent()
+{
+    return ThisTimings;
+}
+
 LoadingThread* ContentLoadingManager::GetCurrentLoadThread()
 {
     return ThisThread;
@@ -155,7 +212,7 @@ LoadingThread* ContentLoadingManager::GetCurrentLoadThread()
 
 int32 ContentLoadingManager::GetTasksCount()
 {
-    return Tasks.Count();
+    return ContentLoadingManagerImpl::GetTasksCount();
 }
 
 bool ContentLoadingManagerService::Init()
@@ -191,7 +248,7 @@ void ContentLoadingManagerService::BeforeExit()
     // Signal threads to end work soon
     for (int32 i = 0; i < Threads.Count(); i++)
         Threads[i]->NotifyExit();
-    TasksSignal.NotifyAll();
+    NotifyTasks(true);
 }
 
 void ContentLoadingManagerService::Dispose()
@@ -199,7 +256,7 @@ void ContentLoadingManagerService::Dispose()
     // Exit all threads
     for (int32 i = 0; i < Threads.Count(); i++)
         Threads[i]->NotifyExit();
-    TasksSignal.NotifyAll();
+    NotifyTasks(true);
     for (int32 i = 0; i < Threads.Count(); i++)
         Threads[i]->Join();
     Threads.ClearDelete();
@@ -208,7 +265,8 @@ void ContentLoadingManagerService::Dispose()
     ThisThread = nullptr;
 
     // Cancel all remaining tasks (no chance to execute them)
-    Tasks.CancelAll();
+    for (auto& tasks : Tasks)
+        tasks.CancelAll();
 }
 
 String ContentLoadTask::ToString() const
@@ -218,14 +276,27 @@ String ContentLoadTask::ToString() const
 
 void ContentLoadTask::Enqueue()
 {
-    Tasks.Add(this);
-    TasksSignal.NotifyOne();
+    Tasks[(int32)Priority].Add(this);
+    NotifyTasks();
 }
 
 bool ContentLoadTask::Run()
 {
+    PROFILE_MEM(Content);
+
     // Perform an operation
+    ContentLoadingTimings timings;
+    ContentLoadingTimings* prevTimings = ThisTimings;
+    const bool recordTimings = Content::RecordLoadTimings && AssetID.IsValid();
+    const double startTime = recordTimings ? Platform::GetTimeSeconds() : 0.0;
+    if (recordTimings)
+        ThisTimings = &timings;
     const auto result = run();
+    if (recordTimings)
+    {
+        ThisTimings = prevTimings;
+        Content::onAssetLoadTask(AssetID, timings, Platform::GetTimeSeconds() - startTime);
+    }
 
     // Process result
     const bool failed = result != Result::Ok;
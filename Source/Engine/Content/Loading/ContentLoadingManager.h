@@ -77,6 +77,21 @@ class LoadingThread : public IRunnable
     void Exit() override;
 };
 
+/// <summary>
+/// Content loading timings accumulated by the current thread (storage reads and data decompression). Used to record the assets loading timings (see Content::RecordLoadTimings).
+/// </summary>
+struct FLAXENGINE_API ContentLoadingTimings
+{
+    double ReadTime = 0;
+    double DecompressTime = 0;
+    uint64 BytesRead = 0;
+
+    /// <summary>
+    /// Gets the timings of the content loading task executed by the current thread (null if not recording).
+    /// </summary>
+    static ContentLoadingTimings* GetCurrent();
+};
+
 /// <summary>
 /// Content loading manager.
 /// </summary>
@@ -54,26 +54,31 @@ class LoadAssetDataTask : public ContentLoadTask
         const StringView name(ref->GetPath());
 #endif
 
-        // Load chunks
+        // Gather chunks
+        FlaxChunk* chunks[ASSET_FILE_DATA_CHUNKS];
+        int32 chunksCount = 0;
         for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
         {
             if (GET_CHUNK_FLAG(i) & _chunks)
             {
                 const auto chunk = ref->GetChunk(i);
                 if (chunk != nullptr)
-                {
-                    if (IsCancelRequested())
-                        return Result::Ok;
+                    chunks[chunksCount++] = chunk;
+            }
+        }
+        if (chunksCount == 0 || IsCancelRequested())
+            return Result::Ok;
+
+        // Load chunks (in a single batch to merge reads of the chunks placed next to each other in file)
+        {
 #if TRACY_ENABLE
-                    ZoneScoped;
-                    ZoneName(*name, name.Length());
+            ZoneScoped;
+            ZoneName(*name, name.Length());
 #endif
-                    if (ref->Storage->LoadAssetChunk(chunk))
-                    {
-                        LOG(Warning, "Cannot load asset \'{0}\' chunk {1}.", ref->ToString(), i);
-                        return Result::LoadDataError;
-                    }
-                }
+            if (ref->Storage->LoadAssetChunks(ToSpan(chunks, chunksCount)))
+            {
+                LOG(Warning, "Cannot load asset \'{0}\' chunks {1}.", ref->ToString(), (uint32)_chunks);
+                return Result::LoadDataError;
             }
         }
 
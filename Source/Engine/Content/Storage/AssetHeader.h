@@ -5,10 +5,8 @@
 #include "Engine/Core/Types/Guid.h"
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Types/String.h"
-#if USE_EDITOR
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Collections/Array.h"
-#endif
 #include "FlaxChunk.h"
 
 /// <summary>
@@ -126,12 +124,12 @@ struct FLAXENGINE_API AssetInitData
     /// The asset metadata information. Stored in a Json format.
     /// </summary>
     BytesContainer Metadata;
+#endif
 
     /// <summary>
-    /// Asset dependencies list used by the asset for tracking (eg. material functions used by material asset). The pair of asset ID and cached file edit time (for tracking modification).
+    /// Asset dependencies list used by the asset for tracking (eg. material functions used by material asset). The pair of asset ID and cached file edit time (for tracking modification). In cooked game it contains the assets referenced by this asset (prefetched during asset loading).
     /// </summary>
     Array<Pair<Guid, DateTime>> Dependencies;
-#endif
 
 public:
     /// <summary>
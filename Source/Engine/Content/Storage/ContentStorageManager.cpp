@@ -9,6 +9,7 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/TaskGraph.h"
 #include "Engine/Threading/Threading.h"
 
@@ -52,6 +53,7 @@ namespace
 ContentStorageService ContentStorageServiceInstance;
 
 TimeSpan ContentStorageManager::UnusedDataChunksLifetime = TimeSpan::FromSeconds(10);
+bool ContentStorageManager::UseMemoryMapping = PLATFORM_64BITS;
 
 FlaxStorageReference ContentStorageManager::GetStorage(const StringView& path, bool loadIt)
 {
@@ -109,6 +111,58 @@ FlaxStorageReference ContentStorageManager::GetStorage(const StringView& path, b
     return result;
 }
 
+void ContentStorageManager::GetStorages(const Span<String>& paths, Array<FlaxStorageReference>& result)
+{
+    PROFILE_CPU();
+    result.Clear();
+    result.EnsureCapacity(paths.Length());
+
+    // Create storage containers (without loading)
+    Array<int32> toLoad;
+    for (int32 i = 0; i < paths.Length(); i++)
+    {
+        result.Add(GetStorage(paths[i], false));
+        if (result[i] && !result[i]->IsLoaded())
+            toLoad.Add(i);
+    }
+    if (toLoad.IsEmpty())
+        return;
+
+    // Read headers in parallel (each storage has own loading lock so it's safe to load the same container from other threads)
+    Array<bool> loadFailed;
+    loadFailed.Resize(toLoad.Count());
+    const Function<void(int32)> job = [&](int32 index)
+    {
+        FlaxStorage* storage = result[toLoad[index]].Get();
+        storage->LockChunks();
+        loadFailed[index] = storage->Load();
+        storage->UnlockChunks();
+    };
+    if (toLoad.Count() == 1)
+        job(0);
+    else
+        JobSystem::Execute(job, toLoad.Count());
+
+    // Remove failed containers
+    for (int32 index = 0; index < toLoad.Count(); index++)
+    {
+        if (!loadFailed[index])
+            continue;
+        const int32 i = toLoad[index];
+        FlaxStorage* storage = result[i].Get();
+        LOG(Error, "Failed to load {0}.", paths[i]);
+        result[i] = nullptr;
+        Locker.Lock();
+        StorageMap.Remove(storage->GetPath());
+        if (storage->IsPackage())
+            Packages.Remove((FlaxPackage*)storage);
+        else
+            Files.Remove((FlaxFile*)storage);
+        Locker.Unlock();
+        Delete(storage);
+    }
+}
+
 FlaxStorageReference ContentStorageManager::TryGetStorage(const StringView& path)
 {
     ScopeLock lock(Locker);
@@ -19,6 +19,11 @@ class FLAXENGINE_API ContentStorageManager
     /// </summary>
     static TimeSpan UnusedDataChunksLifetime;
 
+    /// <summary>
+    /// Enables memory-mapping of the packages (read-only storage) files. Uncompressed chunks data is then accessed directly from the mapped file without copying it into the memory.
+    /// </summary>
+    static bool UseMemoryMapping;
+
 public:
     /// <summary>
     /// Gets the assets data storage container.
@@ -28,6 +33,13 @@ class FLAXENGINE_API ContentStorageManager
     /// <returns>Flax Storage or null if not package at that location</returns>
     static FlaxStorageReference GetStorage(const StringView& path, bool loadIt = true);
 
+    /// <summary>
+    /// Gets the assets data storage containers and loads them in parallel (file headers are read on multiple job system threads).
+    /// </summary>
+    /// <param name="paths">The paths.</param>
+    /// <param name="result">The output storage containers (matching the input paths). Null for files that failed to load.</param>
+    static void GetStorages(const Span<String>& paths, Array<FlaxStorageReference>& result);
+
     /// <summary>
     /// Tries the assets data storage container if it's created.
     /// </summary>
@@ -24,6 +24,16 @@ enum class FlaxChunkFlags
     /// Prevents chunk file data from being unloaded if unused for a certain amount of time. Runtime-only flag, not saved with the asset.
     /// </summary>
     KeepInMemory = 2,
+
+    /// <summary>
+    /// Compress chunk data using LZ4 algorithm with a shared dictionary (used together with CompressedLZ4). The dictionary is stored as a separate chunk within the same storage (see FlaxChunk::Dictionary). Improves compression ratio of the small chunks with similar contents (eg. json assets).
+    /// </summary>
+    CompressedLZ4Dictionary = 4,
+
+    /// <summary>
+    /// Compressed LZ4 data is split into independent blocks which are decompressed in parallel (used together with CompressedLZ4). Set automatically when creating storage with big compressed chunks.
+    /// </summary>
+    CompressedLZ4Blocks = 8,
 };
 
 DECLARE_ENUM_OPERATORS(FlaxChunkFlags);
@@ -92,6 +102,11 @@ class FLAXENGINE_API FlaxChunk
     /// </summary>
     BytesContainer Data;
 
+    /// <summary>
+    /// The compression dictionary chunk used when creating the storage with chunk compressed using CompressedLZ4Dictionary flag.
+    /// </summary>
+    FlaxChunk* Dictionary = nullptr;
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="FlaxChunk"/> class.
@@ -5,13 +5,18 @@
 #include "FlaxPackage.h"
 #include "ContentStorageManager.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Content/Loading/ContentLoadingManager.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #if USE_EDITOR
 #include "Engine/Serialization/JsonWriter.h"
 #include "Engine/Serialization/JsonWriters.h"
@@ -20,6 +25,31 @@
 #endif
 #include <ThirdParty/LZ4/lz4.h>
 
+// Maximum gap (in bytes) between the chunks in file to load them with a single read
+#define FLAX_STORAGE_CHUNKS_MERGE_GAP (16 * 1024)
+
+// Maximum size (in bytes) of the merged chunks range to load with a single read
+#define FLAX_STORAGE_CHUNKS_MERGE_SIZE (1024 * 1024)
+
+// Size (in bytes) of the independently compressed blocks of the big LZ4 chunks (decompressed in parallel)
+#define FLAX_STORAGE_LZ4_BLOCK_SIZE (1024 * 1024)
+
+#if USE_EDITOR
+// Size (in bytes) of the compression dictionary (LZ4 uses up to 64kB window)
+#define FLAX_STORAGE_DICTIONARY_SIZE (64 * 1024)
+
+// Minimum size (in bytes) of the compression dictionary samples data to create it
+#define FLAX_STORAGE_DICTIONARY_MIN_SAMPLES_SIZE (16 * 1024)
+#endif
+
+namespace
+{
+    bool SortChunksByAddress(FlaxChunk* const& a, FlaxChunk* const& b)
+    {
+        return a->LocationInFile.Address < b->LocationInFile.Address;
+    }
+}
+
 int32 AssetHeader::GetChunksCount() const
 {
     int32 result = 0;
@@ -220,6 +250,7 @@ const Char* TypeId2TypeName(const uint32 typeId)
 FlaxStorage::FlaxStorage(const StringView& path)
     : _path(path)
 {
+    PROFILE_LOCK(_loadLocker, "FlaxStorage::_loadLocker");
 }
 
 FlaxStorage::~FlaxStorage()
@@ -625,76 +656,148 @@ bool FlaxStorage::LoadAssetHeader(const Guid& id, AssetInitData& data)
 
 bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
 {
-    ASSERT(IsLoaded());
-    ASSERT(chunk != nullptr && _chunks.Contains(chunk));
+    return LoadAssetChunks(ToSpan(&chunk, 1));
+}
 
-    // Check if already loaded
-    if (chunk->IsLoaded())
-        return false;
+bool FlaxStorage::LoadAssetChunks(const Span<FlaxChunk*>& chunks)
+{
+    ASSERT(IsLoaded());
 
-    // Ensure that asset is in a file
-    if (chunk->ExistsInFile() == false)
+    // Gather the missing chunks in order of their location in file
+    Array<FlaxChunk*, InlinedAllocation<ASSET_FILE_DATA_CHUNKS>> toLoad;
+    for (FlaxChunk* chunk : chunks)
     {
-        LOG(Warning, "Cannot load chunk from {0}. It doesn't exist in storage.", ToString());
-        return true;
+        ASSERT(chunk != nullptr && _chunks.Contains(chunk));
+
+        // Check if already loaded
+        if (chunk->IsLoaded() || toLoad.Contains(chunk))
+            continue;
+
+        // Ensure that asset is in a file
+        if (chunk->ExistsInFile() == false)
+        {
+            LOG(Warning, "Cannot load chunk from {0}. It doesn't exist in storage.", ToString());
+            return true;
+        }
+
+        toLoad.Add(chunk);
     }
+    if (toLoad.IsEmpty())
+        return false;
+    Sorting::QuickSort(toLoad.Get(), toLoad.Count(), &SortChunksByAddress);
 
     LockChunks();
 
-    // Open file
-    auto stream = OpenFile();
-    bool failed = stream == nullptr;
-    if (!failed)
+    const auto loadChunkBlocks = [this](FlaxChunk* chunk, const byte* data, uint32 size, int32 originalSize)
     {
-        // Seek
-        stream->SetPosition(chunk->LocationInFile.Address);
-
-        if (stream->HasError())
+        // Read blocks table
+        int32 blockSize, blocksCount;
+        if (size < sizeof(int32) * 2)
+            blocksCount = 0;
+        else
         {
-            // Sometimes stream->HasError() from setposition. result in a crash or missing media in release (stream _file._handle = nullptr).
-            // When retrying, it looks like it works and we can continue. We need this to success.
-
-            for (int retry = 0; retry < 5; retry++)
-            {
-                Platform::Sleep(50);
-                stream = OpenFile();
-                failed = stream == nullptr;
-                if (!failed)
-                {
-                    stream->SetPosition(chunk->LocationInFile.Address);
-                    if (!stream->HasError())
-                        break;
-                }
-            }
+            Platform::MemoryCopy(&blockSize, data, sizeof(int32));
+            Platform::MemoryCopy(&blocksCount, data + sizeof(int32), sizeof(int32));
+            data += sizeof(int32) * 2;
+            size -= sizeof(int32) * 2;
         }
-
-        if (!stream || stream->HasError())
+        if (blocksCount <= 0 || blockSize <= 0 || blocksCount != Math::DivideAndRoundUp(originalSize, blockSize) || size < sizeof(int32) * blocksCount)
         {
-            failed = true;
-            UnlockChunks();
-            LOG(Warning, "SetPosition failed on chunk {0}.", ToString());
-            return failed;
+            LOG(Warning, "Cannot load chunk from {0}. Invalid compressed blocks.", ToString());
+            return true;
+        }
+        Array<int32, InlinedAllocation<64>> blockOffsets;
+        blockOffsets.Resize(blocksCount + 1);
+        blockOffsets[0] = sizeof(int32) * blocksCount;
+        for (int32 i = 0; i < blocksCount; i++)
+        {
+            int32 blockCompressedSize;
+            Platform::MemoryCopy(&blockCompressedSize, data + sizeof(int32) * i, sizeof(int32));
+            blockOffsets[i + 1] = blockOffsets[i] + blockCompressedSize;
+        }
+        if (blockOffsets[blocksCount] > (int32)size)
+        {
+            LOG(Warning, "Cannot load chunk from {0}. Invalid compressed blocks.", ToString());
+            return true;
         }
 
-        // Load data
+        // Decompress blocks in parallel
+        chunk->Data.Allocate(originalSize);
+        int64 failedBlocks = 0;
+        JobSystem::Execute([&](int32 i)
+        {
+            PROFILE_CPU_NAMED("DecompressLZ4");
+            const int32 blockStart = i * blockSize;
+            const int32 blockOriginalSize = Math::Min(blockSize, originalSize - blockStart);
+            const int32 res = LZ4_decompress_safe((const char*)data + blockOffsets[i], chunk->Data.Get<char>() + blockStart, blockOffsets[i + 1] - blockOffsets[i], blockOriginalSize);
+            if (res != blockOriginalSize)
+                Platform::InterlockedIncrement(&failedBlocks);
+        }, blocksCount);
+        if (failedBlocks != 0)
+        {
+            chunk->Data.Release();
+            LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data blocks.", ToString());
+            return true;
+        }
+        ASSERT(chunk->IsLoaded());
+        chunk->RegisterUsage();
+        return false;
+    };
+    const auto loadChunk = [this, &loadChunkBlocks](FlaxChunk* chunk, const byte* data)
+    {
         auto size = chunk->LocationInFile.Size;
         if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
         {
             // Compressed
             size -= sizeof(int32); // Don't count original size int
             int32 originalSize;
-            stream->ReadInt32(&originalSize);
-            Array<byte> tmpBuf;
-            tmpBuf.Resize(size); // TODO: maybe use thread local or content loading pool with sharable temp buffers for the decompression?
-            stream->ReadBytes(tmpBuf.Get(), size);
+            Platform::MemoryCopy(&originalSize, data, sizeof(int32));
+            data += sizeof(int32);
+
+            // Get compression dictionary
+            FlaxChunk* dictionary = nullptr;
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+            {
+                size -= sizeof(int32); // Don't count dictionary index int
+                int32 dictionaryIndex;
+                Platform::MemoryCopy(&dictionaryIndex, data, sizeof(int32));
+                data += sizeof(int32);
+                if (dictionaryIndex < 0 || dictionaryIndex >= _chunks.Count() || _chunks[dictionaryIndex] == chunk)
+                {
+                    LOG(Warning, "Cannot load chunk from {0}. Invalid compression dictionary.", ToString());
+                    return true;
+                }
+
+                // Dictionary is shared by many chunks so keep it loaded
+                dictionary = _chunks[dictionaryIndex];
+                ScopeLock lock(_loadLocker);
+                dictionary->Flags |= FlaxChunkFlags::KeepInMemory;
+                if (LoadAssetChunks(ToSpan(&dictionary, 1)))
+                    return true;
+            }
 
             // Decompress data
             PROFILE_CPU_NAMED("DecompressLZ4");
+            ContentLoadingTimings* timings = ContentLoadingTimings::GetCurrent();
+            const double decompressStart = timings ? Platform::GetTimeSeconds() : 0.0;
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Blocks))
+            {
+                const bool failed = loadChunkBlocks(chunk, data, size, originalSize);
+                if (timings)
+                    timings->DecompressTime += Platform::GetTimeSeconds() - decompressStart;
+                return failed;
+            }
             chunk->Data.Allocate(originalSize);
-            const int32 res = LZ4_decompress_safe((const char*)tmpBuf.Get(), chunk->Data.Get<char>(), size, originalSize);
+            int32 res;
+            if (dictionary)
+                res = LZ4_decompress_safe_usingDict((const char*)data, chunk->Data.Get<char>(), size, originalSize, dictionary->Data.Get<char>(), dictionary->Data.Length());
+            else
+                res = LZ4_decompress_safe((const char*)data, chunk->Data.Get<char>(), size, originalSize);
+            if (timings)
+                timings->DecompressTime += Platform::GetTimeSeconds() - decompressStart;
             if (res <= 0)
             {
-                UnlockChunks();
+                chunk->Data.Release();
                 LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data. Result: {1}.", ToString(), res);
                 return true;
             }
@@ -703,10 +806,120 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
         else
         {
             // Raw data
-            chunk->Data.Read(stream, size);
+            chunk->Data.Copy(data, size);
         }
         ASSERT(chunk->IsLoaded());
         chunk->RegisterUsage();
+        return false;
+    };
+
+    // Access chunks data directly from the memory-mapped file (if used)
+    ContentLoadingTimings* timings = ContentLoadingTimings::GetCurrent();
+    if (const byte* mapping = OpenMapping())
+    {
+        bool failed = false;
+        for (FlaxChunk* chunk : toLoad)
+        {
+            const auto& location = chunk->LocationInFile;
+            if (timings)
+                timings->BytesRead += location.Size;
+            if (location.Address + location.Size > _mappingSize)
+            {
+                LOG(Warning, "Cannot load chunk from {0}. Invalid location in file.", ToString());
+                failed = true;
+                break;
+            }
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+            {
+                failed = loadChunk(chunk, mapping + location.Address);
+                if (failed)
+                    break;
+            }
+            else
+            {
+                // Raw data (zero-copy)
+                chunk->Data.Link(mapping + location.Address, location.Size);
+                chunk->RegisterUsage();
+            }
+        }
+        UnlockChunks();
+        return failed;
+    }
+
+    // Open file
+    auto stream = OpenFile();
+    bool failed = stream == nullptr;
+    const auto readBytes = [this, &stream, timings](void* data, uint32 size, uint32 address)
+    {
+        PROFILE_CPU_NAMED("ReadData");
+        const double readStart = timings ? Platform::GetTimeSeconds() : 0.0;
+        const auto onRead = [&]()
+        {
+            if (timings)
+            {
+                timings->ReadTime += Platform::GetTimeSeconds() - readStart;
+                timings->BytesRead += size;
+            }
+            return false;
+        };
+        if (!stream->ReadBytesAt(data, size, address))
+            return onRead();
+
+        // Sometimes read fails which result in a crash or missing media in release (stream _file._handle = nullptr).
+        // When retrying, it looks like it works and we can continue. We need this to success.
+        for (int retry = 0; retry < 5; retry++)
+        {
+            Platform::Sleep(50);
+            stream = OpenFile();
+            if (stream && !stream->ReadBytesAt(data, size, address))
+                return onRead();
+        }
+        LOG(Warning, "Failed to read chunk data from {0}.", ToString());
+        return true;
+    };
+
+    // Read chunks in ranges (the ones that are close to each other in file are merged into a single read)
+    Array<byte> buffer;
+    for (int32 start = 0; start < toLoad.Count() && !failed;)
+    {
+        FlaxChunk* first = toLoad[start];
+        const uint32 rangeStart = first->LocationInFile.Address;
+        uint32 rangeEnd = rangeStart + first->LocationInFile.Size;
+        int32 end = start + 1;
+        for (; end < toLoad.Count(); end++)
+        {
+            const auto& location = toLoad[end]->LocationInFile;
+            if (location.Address > rangeEnd + FLAX_STORAGE_CHUNKS_MERGE_GAP || location.Address + location.Size - rangeStart > FLAX_STORAGE_CHUNKS_MERGE_SIZE)
+                break;
+            rangeEnd = Math::Max(rangeEnd, location.Address + location.Size);
+        }
+
+        if (end - start == 1 && !EnumHasAnyFlags(first->Flags, FlaxChunkFlags::CompressedLZ4))
+        {
+            // Read raw data directly into the chunk memory
+            const uint32 size = first->LocationInFile.Size;
+            first->Data.Allocate(size);
+            failed = readBytes(first->Data.Get(), size, rangeStart);
+            if (failed)
+            {
+                first->Data.Release();
+                break;
+            }
+            ASSERT(first->IsLoaded());
+            first->RegisterUsage();
+        }
+        else
+        {
+            // Read range into the temporary buffer and split it into chunks
+            buffer.Resize(rangeEnd - rangeStart, false);
+            failed = readBytes(buffer.Get(), buffer.Count(), rangeStart);
+            for (int32 i = start; i < end && !failed; i++)
+            {
+                FlaxChunk* chunk = toLoad[i];
+                failed = loadChunk(chunk, buffer.Get() + (chunk->LocationInFile.Address - rangeStart));
+            }
+        }
+        start = end;
     }
 
     UnlockChunks();
@@ -855,6 +1068,15 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     // Get all chunks
     for (int32 i = 0; i < dataCount; i++)
         data[i].Header.GetLoadedChunks(chunks);
+    for (int32 i = 0; i < chunks.Count(); i++)
+    {
+        // Include used compression dictionaries
+        FlaxChunk* chunk = chunks[i];
+        if (EnumHasAllFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4 | FlaxChunkFlags::CompressedLZ4Dictionary) && chunk->Dictionary && chunk->Dictionary->IsLoaded())
+            chunks.AddUnique(chunk->Dictionary);
+        else
+            chunk->Flags &= ~FlaxChunkFlags::CompressedLZ4Dictionary;
+    }
     int32 chunksCount = chunks.Count();
 
     // TODO: sort chunks by size? smaller ones first?
@@ -893,15 +1115,60 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     compressedChunks.Resize(chunksCount);
     for (int32 i = 0; i < chunksCount; i++)
     {
-        const FlaxChunk* chunk = chunks[i];
+        FlaxChunk* chunk = chunks[i];
+        chunk->Flags &= ~FlaxChunkFlags::CompressedLZ4Blocks;
         if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
         {
             PROFILE_CPU_NAMED("CompressLZ4");
             const int32 srcSize = chunk->Data.Length();
             const int32 maxSize = LZ4_compressBound(srcSize);
             auto& chunkCompressed = compressedChunks[i];
+            const int32 blocksCount = Math::DivideAndRoundUp(srcSize, FLAX_STORAGE_LZ4_BLOCK_SIZE);
+            if (blocksCount > 1 && EnumHasNoneFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+            {
+                // Big chunks are split into independent blocks to decompress them in parallel
+                Array<Array<byte>> blocks;
+                blocks.Resize(blocksCount);
+                JobSystem::Execute([&](int32 blockIndex)
+                {
+                    const int32 blockStart = blockIndex * FLAX_STORAGE_LZ4_BLOCK_SIZE;
+                    const int32 blockSize = Math::Min(FLAX_STORAGE_LZ4_BLOCK_SIZE, srcSize - blockStart);
+                    auto& block = blocks[blockIndex];
+                    block.Resize(LZ4_compressBound(blockSize));
+                    const int32 blockCompressedSize = LZ4_compress_default(chunk->Data.Get<char>() + blockStart, (char*)block.Get(), blockSize, block.Count());
+                    block.Resize(Math::Max(blockCompressedSize, 0));
+                }, blocksCount);
+
+                // Write blocks table followed by the blocks data
+                MemoryWriteStream blocksStream(maxSize + sizeof(int32) * (blocksCount + 2));
+                blocksStream.WriteInt32(FLAX_STORAGE_LZ4_BLOCK_SIZE);
+                blocksStream.WriteInt32(blocksCount);
+                for (const auto& block : blocks)
+                {
+                    if (block.IsEmpty())
+                    {
+                        LOG(Warning, "Chunk data LZ4 compression failed.");
+                        return true;
+                    }
+                    blocksStream.WriteInt32(block.Count());
+                }
+                for (const auto& block : blocks)
+                    blocksStream.WriteBytes(block.Get(), block.Count());
+                chunkCompressed.Set(blocksStream.GetHandle(), (int32)blocksStream.GetPosition());
+                chunk->Flags |= FlaxChunkFlags::CompressedLZ4Blocks;
+                continue;
+            }
             chunkCompressed.Resize(maxSize);
-            const int32 dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
+            int32 dstSize;
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+            {
+                LZ4_stream_t lz4Stream;
+                LZ4_resetStream(&lz4Stream);
+                LZ4_loadDict(&lz4Stream, chunk->Dictionary->Data.Get<char>(), chunk->Dictionary->Data.Length());
+                dstSize = LZ4_compress_fast_continue(&lz4Stream, chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize, 1);
+            }
+            else
+                dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
             if (dstSize <= 0)
             {
                 chunkCompressed.Resize(0);
@@ -917,7 +1184,11 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     {
         int32 size = chunks[i]->Size();
         if (compressedChunks[i].HasItems())
+        {
             size = compressedChunks[i].Count() + sizeof(int32); // Add original data size
+            if (EnumHasAnyFlags(chunks[i]->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+                size += sizeof(int32); // Add dictionary chunk index
+        }
         ASSERT(size > 0);
         chunks[i]->LocationInFile = FlaxChunk::Location(currentAddress, size);
         currentAddress += size;
@@ -1013,8 +1284,10 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     {
         if (compressedChunks[i].HasItems())
         {
-            // Compressed chunk data (write additional size of the original data)
+            // Compressed chunk data (write additional size of the original data and the dictionary chunk index)
             stream->WriteInt32(chunks[i]->Data.Length());
+            if (EnumHasAnyFlags(chunks[i]->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+                stream->WriteInt32(chunks.Find(chunks[i]->Dictionary));
             stream->WriteBytes(compressedChunks[i].Get(), compressedChunks[i].Count());
         }
         else
@@ -1033,6 +1306,34 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     return false;
 }
 
+FlaxChunk* FlaxStorage::CreateDictionary(const Array<FlaxChunk*>& samples)
+{
+    PROFILE_CPU();
+    int32 samplesSize = 0;
+    for (const FlaxChunk* sample : samples)
+        samplesSize += sample->Data.Length();
+    if (samples.Count() < 2 || samplesSize < FLAX_STORAGE_DICTIONARY_MIN_SAMPLES_SIZE)
+        return nullptr;
+
+    // LZ4 uses up to 64kB dictionary (the maximum offset of the match) so pick the same amount of data from the beginning of each sample (the most common part such as the header or json structure)
+    const int32 dictionarySize = Math::Min(samplesSize / 2, FLAX_STORAGE_DICTIONARY_SIZE);
+    const int32 sliceSize = Math::Max(dictionarySize / samples.Count(), 64);
+    Array<byte> dictionary;
+    dictionary.EnsureCapacity(dictionarySize);
+    for (int32 i = 0; i < samples.Count() && dictionary.Count() < dictionarySize; i++)
+    {
+        const FlaxChunk* sample = samples[i];
+        const int32 size = Math::Min(Math::Min(sliceSize, sample->Data.Length()), dictionarySize - dictionary.Count());
+        dictionary.Add(sample->Data.Get(), size);
+    }
+    if (dictionary.IsEmpty())
+        return nullptr;
+
+    auto chunk = New<FlaxChunk>();
+    chunk->Data.Copy(dictionary);
+    return chunk;
+}
+
 bool FlaxStorage::Save(AssetInitData& data, bool silentMode)
 {
     // Check if can modify the storage
@@ -1115,13 +1416,18 @@ bool FlaxStorage::LoadAssetHeader(const Entry& e, AssetInitData& data)
         int32 metadataSize;
         stream->ReadInt32(&metadataSize);
         data.Metadata.Read(stream, metadataSize);
+#else
+        // Skip metadata
+        int32 metadataSize;
+        stream->ReadInt32(&metadataSize);
+        stream->SetPosition(stream->GetPosition() + metadataSize);
+#endif
 
         // Asset Dependencies
         int32 dependencies;
         stream->ReadInt32(&dependencies);
         data.Dependencies.Resize(dependencies);
         stream->ReadBytes(data.Dependencies.Get(), dependencies * sizeof(Pair<Guid, DateTime>));
-#endif
         break;
     }
     case 8:
@@ -1334,9 +1640,34 @@ FileReadStream* FlaxStorage::OpenFile()
     return stream;
 }
 
+const byte* FlaxStorage::OpenMapping()
+{
+    // Only read-only storage can be mapped (file contents cannot change while in use)
+    if (!ContentStorageManager::UseMemoryMapping || AllowDataModifications())
+        return nullptr;
+    ScopeLock lock(_loadLocker);
+    if (_mappingFile == nullptr)
+    {
+        // Map file
+        auto file = File::Open(_path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+        if (file == nullptr)
+            return nullptr;
+        _mapping = file->Map();
+        if (_mapping == nullptr)
+        {
+            // Fallback to reading the file
+            Delete(file);
+            return nullptr;
+        }
+        _mappingFile = file;
+        _mappingSize = file->GetSize();
+    }
+    return _mapping;
+}
+
 bool FlaxStorage::CloseFileHandles()
 {
-    if (Platform::AtomicRead(&_chunksLock) == 0 && Platform::AtomicRead(&_files) == 0)
+    if (Platform::AtomicRead(&_chunksLock) == 0 && Platform::AtomicRead(&_files) == 0 && _mappingFile == nullptr)
     {
         return false;
     }
@@ -1380,6 +1711,26 @@ bool FlaxStorage::CloseFileHandles()
     }
     _file.Clear();
     Platform::AtomicStore(&_files, 0);
+
+    // Close memory-mapped file (chunks that point to its data are released)
+    if (_mappingFile)
+    {
+        for (FlaxChunk* chunk : _chunks)
+        {
+            if (chunk->IsLoaded() && !chunk->Data.IsAllocated())
+            {
+                if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::KeepInMemory))
+                    chunk->Data.Copy(chunk->Data.Get(), chunk->Data.Length());
+                else
+                    chunk->Unload();
+            }
+        }
+        _mappingFile->Unmap(_mapping, _mappingSize);
+        Delete(_mappingFile);
+        _mappingFile = nullptr;
+        _mapping = nullptr;
+        _mappingSize = 0;
+    }
     return false;
 }
 
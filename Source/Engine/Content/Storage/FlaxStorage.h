@@ -5,6 +5,7 @@
 #include "Engine/Core/Object.h"
 #include "Engine/Core/Delegate.h"
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Serialization/FileReadStream.h"
@@ -95,6 +96,9 @@ class FLAXENGINE_API FlaxStorage : public Object
 
     // Storage
     ThreadLocal<FileReadStream*> _file;
+    File* _mappingFile = nullptr;
+    const byte* _mapping = nullptr;
+    uint32 _mappingSize = 0;
     Array<FlaxChunk*> _chunks;
 
     // Metadata
@@ -384,6 +388,13 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <returns>True if cannot load data, otherwise false</returns>
     bool LoadAssetChunk(FlaxChunk* chunk);
 
+    /// <summary>
+    /// Loads the asset chunks. Chunks are read in order of their location in file and the ones placed next to each other are merged into a single read (eg. all mips of the texture).
+    /// </summary>
+    /// <param name="chunks">The chunks.</param>
+    /// <returns>True if cannot load data, otherwise false</returns>
+    bool LoadAssetChunks(const Span<FlaxChunk*>& chunks);
+
 #if USE_EDITOR
 
     /// <summary>
@@ -480,6 +491,13 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <returns>True if cannot create package, otherwise false</returns>
     static bool Create(WriteStream* stream, const AssetInitData* data, int32 dataCount, const CustomData* customData = nullptr);
 
+    /// <summary>
+    /// Creates the compression dictionary from the sample chunks (eg. the data of the assets of the same type). Can be used with CompressedLZ4Dictionary chunks flag.
+    /// </summary>
+    /// <param name="samples">The sample chunks with data.</param>
+    /// <returns>The created dictionary chunk or null if cannot create it. Has to be deleted by the caller after creating the storage.</returns>
+    static FlaxChunk* CreateDictionary(const Array<FlaxChunk*>& samples);
+
 #endif
 
 protected:
@@ -487,5 +505,6 @@ class FLAXENGINE_API FlaxStorage : public Object
     void AddChunk(FlaxChunk* chunk);
     virtual void AddEntry(Entry& e) = 0;
     FileReadStream* OpenFile();
+    const byte* OpenMapping();
     virtual bool GetEntry(const Guid& id, Entry& e) = 0;
 };
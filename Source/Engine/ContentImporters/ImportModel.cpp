@@ -25,6 +25,7 @@
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Utilities/RectPack.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include "AssetsImportingManager.h"
 
 bool ImportModel::TryGetImportOptions(const StringView& path, Options& options)
@@ -588,6 +589,45 @@ CreateAssetResult ImportModel::CreateModel(CreateAssetContext& context, ModelDat
         }
     }
 
+    // Generate meshlets
+    if (options && options->GenerateMeshlets)
+    {
+        PROFILE_CPU_NAMED("Meshlets");
+        Array<MeshData*> meshes;
+        for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
+            meshes.Add(modelData.LODs[lodIndex].Meshes);
+        Array<MeshletsData> meshlets;
+        meshlets.Resize(meshes.Count());
+        Function<void(int32)> job = [&meshes, &meshlets](int32 i)
+        {
+            ModelTool::GenerateMeshlets(*meshes[i], meshlets[i]);
+        };
+        JobSystem::Execute(job, meshes.Count(), JobPriority::Background);
+
+        // Pack meshlets for all LODs and meshes (empty for meshes that failed to generate them)
+        stream.SetPosition(0);
+        stream.WriteInt32(1); // Version
+        stream.WriteInt32(lodCount);
+        for (int32 lodIndex = 0, meshIndex = 0; lodIndex < lodCount; lodIndex++)
+        {
+            const int32 meshesCount = modelData.LODs[lodIndex].Meshes.Count();
+            stream.WriteInt32(meshesCount);
+            for (int32 i = 0; i < meshesCount; i++)
+            {
+                const MeshletsData& data = meshlets[meshIndex++];
+                stream.WriteInt32(data.Meshlets.Count());
+                stream.WriteInt32(data.Vertices.Count());
+                stream.WriteInt32(data.Triangles.Count());
+                stream.WriteBytes(data.Meshlets.Get(), data.Meshlets.Count() * sizeof(Meshlet));
+                stream.WriteBytes(data.Vertices.Get(), data.Vertices.Count() * sizeof(uint32));
+                stream.WriteBytes(data.Triangles.Get(), data.Triangles.Count() * sizeof(byte));
+            }
+        }
+        if (context.AllocateChunk(MODEL_MESHLETS_CHUNK_INDEX))
+            return CreateAssetResult::CannotAllocateChunk;
+        context.Data.Header.Chunks[MODEL_MESHLETS_CHUNK_INDEX]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    }
+
     return CreateAssetResult::Ok;
 }
 
@@ -2,8 +2,13 @@
 
 #include "Cache.h"
 #include "FlaxEngine.Gen.h"
+#include "Engine/Serialization/Json.h"
+
+// The maximum capacity of the json buffer to keep in the cache (larger buffers are released after use)
+#define CACHE_JSON_BUFFER_MAX_CAPACITY (32 * 1024 * 1024)
 
 CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback> Cache::ISerializeModifier;
+CollectionPoolCache<rapidjson_flax::StringBuffer, Cache::JsonBufferClearCallback> Cache::JsonBuffer;
 
 void Cache::ISerializeModifierClearCallback(::ISerializeModifier* obj)
 {
@@ -12,7 +17,15 @@ void Cache::ISerializeModifierClearCallback(::ISerializeModifier* obj)
     obj->IdsMapping.Clear();
 }
 
+void Cache::JsonBufferClearCallback(rapidjson_flax::StringBuffer* obj)
+{
+    obj->Clear();
+    if (obj->stack_.GetCapacity() > CACHE_JSON_BUFFER_MAX_CAPACITY)
+        obj->ShrinkToFit();
+}
+
 void Cache::Release()
 {
     ISerializeModifier.Release();
+    JsonBuffer.Release();
 }
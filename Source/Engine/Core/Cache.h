@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Serialization/ISerializeModifier.h"
+#include "Engine/Serialization/JsonFwd.h"
 #include "Engine/Core/Collections/CollectionPoolCache.h"
 
 /// <summary>
@@ -21,6 +22,13 @@ class Cache
     /// </summary>
     static CollectionPoolCache<ISerializeModifier, ISerializeModifierClearCallback> ISerializeModifier;
 
+    static void JsonBufferClearCallback(rapidjson_flax::StringBuffer* obj);
+
+    /// <summary>
+    /// Gets the json text buffers lookup cache (used as an output of the json writers to reuse the allocated memory when serializing data frequently). Safe allocation, per thread, uses caching.
+    /// </summary>
+    static CollectionPoolCache<rapidjson_flax::StringBuffer, JsonBufferClearCallback> JsonBuffer;
+
 public:
 
     /// <summary>
@@ -32,8 +32,7 @@ API_CLASS(InBuild) class Array
         else
         {
             to.Allocate(fromCapacity);
-            Memory::MoveItems(to.Get(), from.Get(), fromCount);
-            Memory::DestructItems(from.Get(), fromCount);
+            Memory::RelocateItems(to.Get(), from.Get(), fromCount);
             from.Free();
         }
     }
@@ -602,6 +601,14 @@ API_CLASS(InBuild) class Array
         ASSERT(index >= 0 && index <= _count);
         EnsureCapacity(_count + 1);
         T* data = _allocation.Get();
+        if IF_CONSTEXPR (TIsTriviallyRelocatable<T>::Value)
+        {
+            // Shift items memory and construct the new item in the gap
+            Platform::MemoryMove(data + index + 1, data + index, (_count - index) * sizeof(T));
+            Memory::MoveItems(data + index, &item, 1);
+            ++_count;
+            return;
+        }
         Memory::ConstructItems(data + _count, 1);
         for (int32 i = _count - 1; i >= index; i--)
             data[i + 1] = MoveTemp(data[i]);
@@ -681,6 +688,13 @@ API_CLASS(InBuild) class Array
         ASSERT(index < _count && index >= 0);
         --_count;
         T* data = _allocation.Get();
+        if IF_CONSTEXPR (TIsTriviallyRelocatable<T>::Value)
+        {
+            // Destroy the item and shift the remaining items memory over it
+            Memory::DestructItems(data + index, 1);
+            Platform::MemoryMove(data + index, data + index + 1, (_count - index) * sizeof(T));
+            return;
+        }
         if (index < _count)
         {
             T* dst = data + index;
@@ -1083,6 +1097,12 @@ API_CLASS(InBuild) class Array
     }
 };
 
+template<typename T>
+struct TIsTriviallyRelocatable<Array<T, HeapAllocation>>
+{
+    enum { Value = true };
+};
+
 template<typename T, typename AllocationType>
 void* operator new(const size_t size, Array<T, AllocationType>& array)
 {
@@ -119,11 +119,9 @@ API_CLASS(InBuild) class Dictionary
                 if (fromBucket.IsOccupied())
                 {
                     Bucket& toBucket = toData[i];
-                    Memory::MoveItems(&toBucket.Key, &fromBucket.Key, 1);
-                    Memory::MoveItems(&toBucket.Value, &fromBucket.Value, 1);
+                    Memory::RelocateItems(&toBucket.Key, &fromBucket.Key, 1);
+                    Memory::RelocateItems(&toBucket.Value, &fromBucket.Value, 1);
                     toBucket._state = BucketState::Occupied;
-                    Memory::DestructItem(&fromBucket.Key);
-                    Memory::DestructItem(&fromBucket.Value);
                     fromBucket._state = BucketState::Empty;
                 }
             }
@@ -575,9 +573,10 @@ API_CLASS(InBuild) class Dictionary
                     FindPosition(oldBucket.Key, pos);
                     ASSERT(pos.FreeSlotIndex != -1);
                     Bucket* bucket = &_allocation.Get()[pos.FreeSlotIndex];
-                    Memory::MoveItems(&bucket->Key, &oldBucket.Key, 1);
-                    Memory::MoveItems(&bucket->Value, &oldBucket.Value, 1);
+                    Memory::RelocateItems(&bucket->Key, &oldBucket.Key, 1);
+                    Memory::RelocateItems(&bucket->Value, &oldBucket.Value, 1);
                     bucket->_state = BucketState::Occupied;
+                    oldBucket._state = BucketState::Empty;
                     ++_elementsCount;
                 }
             }
@@ -982,9 +981,10 @@ API_CLASS(InBuild) class Dictionary
                     FindPosition(oldBucket.Key, pos);
                     ASSERT(pos.FreeSlotIndex != -1);
                     Bucket* bucket = &_allocation.Get()[pos.FreeSlotIndex];
-                    Memory::MoveItems(&bucket->Key, &oldBucket.Key, 1);
-                    Memory::MoveItems(&bucket->Value, &oldBucket.Value, 1);
+                    Memory::RelocateItems(&bucket->Key, &oldBucket.Key, 1);
+                    Memory::RelocateItems(&bucket->Value, &oldBucket.Value, 1);
                     bucket->_state = BucketState::Occupied;
+                    oldBucket._state = BucketState::Empty;
                 }
             }
             for (int32 i = 0; i < _size; i++)
@@ -993,3 +993,9 @@ API_CLASS(InBuild) class Dictionary
         _deletedCount = 0;
     }
 };
+
+template<typename KeyType, typename ValueType>
+struct TIsTriviallyRelocatable<Dictionary<KeyType, ValueType, HeapAllocation>>
+{
+    enum { Value = true };
+};
@@ -0,0 +1,919 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/FlatHashTable.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+
+/// <summary>
+/// Template for unordered dictionary with mapped key with value pairs. Uses open-addressing with separate control bytes (see FlatHashTable) which makes lookups faster than in Dictionary (probing doesn't touch keys and values of non-matching slots) and requires less memory due to higher load factor.
+/// Has the same API as Dictionary. Removing elements doesn't invalidate iterators, tombstones are reused on insertion and compacted automatically.
+/// </summary>
+/// <typeparam name="KeyType">The type of the keys in the dictionary.</typeparam>
+/// <typeparam name="ValueType">The type of the values in the dictionary.</typeparam>
+/// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
+template<typename KeyType, typename ValueType, typename AllocationType = HeapAllocation>
+class FlatDictionary
+{
+    friend FlatDictionary;
+public:
+    /// <summary>
+    /// Describes single portion of space for the key and value pair in a hash map.
+    /// </summary>
+    struct Bucket
+    {
+        friend FlatDictionary;
+
+        /// <summary>The key.</summary>
+        KeyType Key;
+        /// <summary>The value.</summary>
+        ValueType Value;
+
+    private:
+        FORCE_INLINE void Free()
+        {
+            Memory::DestructItem(&Key);
+            Memory::DestructItem(&Value);
+        }
+
+        template<typename KeyComparableType>
+        FORCE_INLINE void Occupy(const KeyComparableType& key)
+        {
+            Memory::ConstructItems(&Key, &key, 1);
+            Memory::ConstructItem(&Value);
+        }
+
+        template<typename KeyComparableType>
+        FORCE_INLINE void Occupy(const KeyComparableType& key, const ValueType& value)
+        {
+            Memory::ConstructItems(&Key, &key, 1);
+            Memory::ConstructItems(&Value, &value, 1);
+        }
+
+        template<typename KeyComparableType>
+        FORCE_INLINE void Occupy(const KeyComparableType& key, ValueType&& value)
+        {
+            Memory::ConstructItems(&Key, &key, 1);
+            Memory::MoveItems(&Value, &value, 1);
+        }
+
+        FORCE_INLINE void MoveTo(Bucket& other)
+        {
+            Memory::MoveItems(&other.Key, &Key, 1);
+            Memory::MoveItems(&other.Value, &Value, 1);
+            Free();
+        }
+    };
+
+    using AllocationData = typename AllocationType::template Data<Bucket>;
+    using ControlData = typename AllocationType::template Data<int8>;
+
+private:
+    int32 _elementsCount = 0;
+    int32 _deletedCount = 0;
+    int32 _size = 0;
+    AllocationData _allocation;
+    ControlData _control;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    FlatDictionary()
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity.</param>
+    explicit FlatDictionary(const int32 capacity)
+    {
+        SetCapacity(capacity);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    FlatDictionary(FlatDictionary&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">Other collection to copy</param>
+    FlatDictionary(const FlatDictionary& other)
+    {
+        Clone(other);
+    }
+
+    /// <summary>
+    /// Clones the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(const FlatDictionary& other)
+    {
+        if (this != &other)
+            Clone(other);
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(FlatDictionary&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            _allocation.Free();
+            _control.Free();
+            _size = 0;
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    ~FlatDictionary()
+    {
+        Clear();
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _elementsCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of the elements that can be contained by the collection.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _size;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _elementsCount == 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _elementsCount != 0;
+    }
+
+public:
+    /// <summary>
+    /// The FlatDictionary collection iterator.
+    /// </summary>
+    struct Iterator
+    {
+        friend FlatDictionary;
+    private:
+        FlatDictionary* _collection;
+        int32 _index;
+
+    public:
+        Iterator(FlatDictionary* collection, const int32 index)
+            : _collection(collection)
+            , _index(index)
+        {
+        }
+
+        Iterator(FlatDictionary const* collection, const int32 index)
+            : _collection(const_cast<FlatDictionary*>(collection))
+            , _index(index)
+        {
+        }
+
+        Iterator()
+            : _collection(nullptr)
+            , _index(-1)
+        {
+        }
+
+        Iterator(const Iterator& i)
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+        Iterator(Iterator&& i) noexcept
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+    public:
+        FORCE_INLINE int32 Index() const
+        {
+            return _index;
+        }
+
+        FORCE_INLINE bool IsEnd() const
+        {
+            return _index == _collection->_size;
+        }
+
+        FORCE_INLINE bool IsNotEnd() const
+        {
+            return _index != _collection->_size;
+        }
+
+        FORCE_INLINE Bucket& operator*() const
+        {
+            return _collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE Bucket* operator->() const
+        {
+            return &_collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE explicit operator bool() const
+        {
+            return _index >= 0 && _index < _collection->_size;
+        }
+
+        FORCE_INLINE bool operator!() const
+        {
+            return !(bool)*this;
+        }
+
+        FORCE_INLINE bool operator==(const Iterator& v) const
+        {
+            return _index == v._index && _collection == v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const Iterator& v) const
+        {
+            return _index != v._index || _collection != v._collection;
+        }
+
+        Iterator& operator=(const Iterator& v)
+        {
+            _collection = v._collection;
+            _index = v._index;
+            return *this;
+        }
+
+        Iterator& operator=(Iterator&& v) noexcept
+        {
+            _collection = v._collection;
+            _index = v._index;
+            return *this;
+        }
+
+        Iterator& operator++()
+        {
+            const int32 capacity = _collection->_size;
+            if (_index != capacity)
+            {
+                const int8* control = _collection->_control.Get();
+                do
+                {
+                    ++_index;
+                }
+                while (_index != capacity && !FlatHashTable::IsOccupied(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) const
+        {
+            Iterator i = *this;
+            ++i;
+            return i;
+        }
+
+        Iterator& operator--()
+        {
+            if (_index > 0)
+            {
+                const int8* control = _collection->_control.Get();
+                do
+                {
+                    --_index;
+                }
+                while (_index > 0 && !FlatHashTable::IsOccupied(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) const
+        {
+            Iterator i = *this;
+            --i;
+            return i;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Gets element by the key (will add default ValueType element if key not found).
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    ValueType& At(const KeyComparableType& key)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(key));
+        const int32 index = FindIndex(key, hash);
+        if (index != -1)
+            return _allocation.Get()[index].Value;
+        Bucket* bucket = OnAdd(hash);
+        bucket->Occupy(key);
+        return bucket->Value;
+    }
+
+    /// <summary>
+    /// Gets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    const ValueType& At(const KeyComparableType& key) const
+    {
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        ASSERT(index != -1);
+        return _allocation.Get()[index].Value;
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE ValueType& operator[](const KeyComparableType& key)
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE const ValueType& operator[](const KeyComparableType& key) const
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Tries to get element with given key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <param name="result">The result value.</param>
+    /// <returns>True if element of given key has been found, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool TryGet(const KeyComparableType& key, ValueType& result) const
+    {
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        if (index == -1)
+            return false;
+        result = _allocation.Get()[index].Value;
+        return true;
+    }
+
+    /// <summary>
+    /// Tries to get pointer to the element with given key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>Pointer to the element value or null if cannot find it.</returns>
+    template<typename KeyComparableType>
+    ValueType* TryGet(const KeyComparableType& key) const
+    {
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        if (index == -1)
+            return nullptr;
+        return const_cast<ValueType*>(&_allocation.Get()[index].Value);
+    }
+
+public:
+    /// <summary>
+    /// Clears the collection but without changing its capacity (all inserted elements: keys and values will be removed).
+    /// </summary>
+    void Clear()
+    {
+        if (_elementsCount + _deletedCount != 0)
+        {
+            Bucket* data = _allocation.Get();
+            int8* control = _control.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (FlatHashTable::IsOccupied(control[i]))
+                    data[i].Free();
+                control[i] = FlatHashTable::Empty;
+            }
+            _elementsCount = _deletedCount = 0;
+        }
+    }
+
+    /// <summary>
+    /// Clears the collection and delete value objects.
+    /// Note: collection must contain pointers to the objects that have public destructor and be allocated using New method.
+    /// </summary>
+#if defined(_MSC_VER)
+    template<typename = typename TEnableIf<TIsPointer<ValueType>::Value>::Type>
+#endif
+    void ClearDelete()
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value)
+                ::Delete(i->Value);
+        }
+        Clear();
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection.
+    /// </summary>
+    /// <param name="capacity">The new capacity (rounded up to the power of two, can be zero to release memory).</param>
+    /// <param name="preserveContents">Enables preserving collection contents during resizing.</param>
+    void SetCapacity(int32 capacity, const bool preserveContents = true)
+    {
+        ASSERT(capacity >= 0);
+        if (capacity != 0)
+        {
+            if (capacity < FlatHashTable::MinCapacity)
+                capacity = FlatHashTable::MinCapacity;
+            capacity = Math::RoundUpToPowerOf2(capacity);
+            if (preserveContents && FlatHashTable::GetMaxLoad(capacity) < _elementsCount)
+                capacity = FlatHashTable::GetCapacityForCount(_elementsCount);
+        }
+        if (capacity == _size)
+            return;
+        if (!preserveContents)
+            Clear();
+        Rehash(capacity);
+    }
+
+    /// <summary>
+    /// Ensures that collection has given capacity.
+    /// </summary>
+    /// <param name="minCapacity">The minimum required capacity (amount of elements that can be added without resizing the collection).</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, const bool preserveContents = true)
+    {
+        if (FlatHashTable::GetMaxLoad(_size) >= minCapacity)
+            return;
+        SetCapacity(FlatHashTable::GetCapacityForCount(minCapacity), preserveContents);
+    }
+
+    /// <summary>
+    /// Swaps the contents of collection with the other object without copy operation. Performs fast internal data exchange.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    void Swap(FlatDictionary& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            ::Swap(_elementsCount, other._elementsCount);
+            ::Swap(_deletedCount, other._deletedCount);
+            ::Swap(_size, other._size);
+            _allocation.Swap(other._allocation);
+            _control.Swap(other._control);
+        }
+        else
+        {
+            ::Swap(other, *this);
+        }
+    }
+
+public:
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE Bucket* Add(const KeyComparableType& key, const ValueType& value)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(key));
+        ASSERT(FindIndex(key, hash) == -1 && "That key has been already added to the dictionary.");
+        Bucket* bucket = OnAdd(hash);
+        bucket->Occupy(key, value);
+        return bucket;
+    }
+
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE Bucket* Add(const KeyComparableType& key, ValueType&& value)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(key));
+        ASSERT(FindIndex(key, hash) == -1 && "That key has been already added to the dictionary.");
+        Bucket* bucket = OnAdd(hash);
+        bucket->Occupy(key, MoveTemp(value));
+        return bucket;
+    }
+
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="i">Iterator with key and value.</param>
+    void Add(const Iterator& i)
+    {
+        ASSERT(i._collection != this && i);
+        const Bucket& bucket = *i;
+        Add(bucket.Key, bucket.Value);
+    }
+
+    /// <summary>
+    /// Removes element with a specified key.
+    /// </summary>
+    /// <param name="key">The element key to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool Remove(const KeyComparableType& key)
+    {
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        if (index == -1)
+            return false;
+        RemoveAt(index);
+        return true;
+    }
+
+    /// <summary>
+    /// Removes element at specified iterator.
+    /// </summary>
+    /// <param name="i">The element iterator to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    bool Remove(const Iterator& i)
+    {
+        ASSERT(i._collection == this);
+        if (i)
+        {
+            ASSERT(FlatHashTable::IsOccupied(_control.Get()[i._index]));
+            RemoveAt(i._index);
+            return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Removes elements with a specified value
+    /// </summary>
+    /// <param name="value">Element value to remove</param>
+    /// <returns>The amount of removed items. Zero if nothing changed.</returns>
+    int32 RemoveValue(const ValueType& value)
+    {
+        int32 result = 0;
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value == value)
+            {
+                Remove(i);
+                ++result;
+            }
+        }
+        return result;
+    }
+
+public:
+    /// <summary>
+    /// Finds the element with given key in the collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>The iterator for the found element or End if cannot find it.</returns>
+    template<typename KeyComparableType>
+    Iterator Find(const KeyComparableType& key) const
+    {
+        const int32 index = FindIndex(key, FlatHashTable::MixHash(GetHash(key)));
+        return index != -1 ? Iterator(this, index) : End();
+    }
+
+    /// <summary>
+    /// Checks if given key is in a collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>True if key has been found in a collection, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool ContainsKey(const KeyComparableType& key) const
+    {
+        return FindIndex(key, FlatHashTable::MixHash(GetHash(key))) != -1;
+    }
+
+    /// <summary>
+    /// Checks if given value is in a collection.
+    /// </summary>
+    /// <param name="value">The value to find.</param>
+    /// <returns>True if value has been found in a collection, otherwise false.</returns>
+    bool ContainsValue(const ValueType& value) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value == value)
+                return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Searches for the specified object and returns the zero-based index of the first occurrence within the entire dictionary.
+    /// </summary>
+    /// <param name="value">The value of the key to find.</param>
+    /// <param name="key">The output key.</param>
+    /// <returns>True if value has been found, otherwise false.</returns>
+    bool KeyOf(const ValueType& value, KeyType* key) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value == value)
+            {
+                if (key)
+                    *key = i->Key;
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    /// <summary>
+    /// Clones other collection into this.
+    /// </summary>
+    /// <param name="other">The other collection to clone.</param>
+    void Clone(const FlatDictionary& other)
+    {
+        Clear();
+        EnsureCapacity(other.Count(), false);
+        for (Iterator i = other.Begin(); i != other.End(); ++i)
+            Add(i);
+    }
+
+    /// <summary>
+    /// Gets the keys collection to the output array (will contain unique items).
+    /// </summary>
+    /// <param name="result">The result.</param>
+    template<typename ArrayAllocation>
+    void GetKeys(Array<KeyType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Key);
+    }
+
+    /// <summary>
+    /// Gets the values collection to the output array (may contain duplicates).
+    /// </summary>
+    /// <param name="result">The result.</param>
+    template<typename ArrayAllocation>
+    void GetValues(Array<ValueType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Value);
+    }
+
+public:
+    Iterator Begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    Iterator End() const
+    {
+        return Iterator(this, _size);
+    }
+
+    Iterator begin()
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end()
+    {
+        return Iterator(this, _size);
+    }
+
+    Iterator begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end() const
+    {
+        return Iterator(this, _size);
+    }
+
+private:
+    template<typename KeyComparableType>
+    int32 FindIndex(const KeyComparableType& key, const uint32 hash) const
+    {
+        if (_elementsCount == 0)
+            return -1;
+        const int32 groupMask = (_size / FlatHashTable::GroupSize) - 1;
+        const int8 tag = FlatHashTable::GetTag(hash);
+        const int8* control = _control.Get();
+        const Bucket* data = _allocation.Get();
+        int32 group = (int32)hash & groupMask;
+        for (int32 probe = 0; probe <= groupMask; probe++)
+        {
+            // Check all slots in a group with matching hash bits
+            const int32 groupStart = group * FlatHashTable::GroupSize;
+            uint32 mask = FlatHashTable::Match(control + groupStart, tag);
+            while (mask)
+            {
+                const int32 index = groupStart + FlatHashTable::LowestBit(mask);
+                if (data[index].Key == key)
+                    return index;
+                mask &= mask - 1;
+            }
+
+            // Stop at the first group with an empty slot (key would be inserted there)
+            if (FlatHashTable::Match(control + groupStart, FlatHashTable::Empty))
+                break;
+
+            // Triangular probing visits all groups for the power of two groups count
+            group = (group + probe + 1) & groupMask;
+        }
+        return -1;
+    }
+
+    int32 FindFreeIndex(const uint32 hash) const
+    {
+        const int32 groupMask = (_size / FlatHashTable::GroupSize) - 1;
+        const int8* control = _control.Get();
+        int32 group = (int32)hash & groupMask;
+        for (int32 probe = 0; probe <= groupMask; probe++)
+        {
+            const int32 groupStart = group * FlatHashTable::GroupSize;
+            const uint32 mask = FlatHashTable::MatchFree(control + groupStart);
+            if (mask)
+                return groupStart + FlatHashTable::LowestBit(mask);
+            group = (group + probe + 1) & groupMask;
+        }
+        return -1;
+    }
+
+    Bucket* OnAdd(const uint32 hash)
+    {
+        if (_elementsCount + _deletedCount >= FlatHashTable::GetMaxLoad(_size))
+        {
+            // Compact tombstones if there are a lot of them, otherwise grow
+            if (_size != 0 && _elementsCount < FlatHashTable::GetMaxLoad(_size) / 2)
+                Rehash(_size);
+            else
+                Rehash(_size == 0 ? FlatHashTable::MinCapacity : _size * 2);
+        }
+        const int32 index = FindFreeIndex(hash);
+        ASSERT(index != -1);
+        int8& control = _control.Get()[index];
+        if (control == FlatHashTable::Deleted)
+            _deletedCount--;
+        control = FlatHashTable::GetTag(hash);
+        _elementsCount++;
+        return &_allocation.Get()[index];
+    }
+
+    void RemoveAt(const int32 index)
+    {
+        _allocation.Get()[index].Free();
+        --_elementsCount;
+
+        // If group has any empty slot then no probe sequence went past it so slot can be marked as empty instead of leaving a tombstone
+        int8* control = _control.Get();
+        const int32 groupStart = index & ~(FlatHashTable::GroupSize - 1);
+        if (FlatHashTable::Match(control + groupStart, FlatHashTable::Empty))
+        {
+            control[index] = FlatHashTable::Empty;
+        }
+        else
+        {
+            control[index] = FlatHashTable::Deleted;
+            ++_deletedCount;
+        }
+    }
+
+    void Rehash(const int32 capacity)
+    {
+        AllocationData oldAllocation;
+        ControlData oldControl;
+        const int32 oldSize = _size;
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            oldAllocation.Swap(_allocation);
+            oldControl.Swap(_control);
+        }
+        else if (oldSize != 0)
+        {
+            // Move elements into the temporary storage (allocation cannot be swapped)
+            oldAllocation.Allocate(oldSize);
+            oldControl.Allocate(oldSize);
+            Bucket* fromData = _allocation.Get();
+            Bucket* toData = oldAllocation.Get();
+            const int8* fromControl = _control.Get();
+            int8* toControl = oldControl.Get();
+            for (int32 i = 0; i < oldSize; i++)
+            {
+                toControl[i] = fromControl[i];
+                if (FlatHashTable::IsOccupied(fromControl[i]))
+                    fromData[i].MoveTo(toData[i]);
+            }
+            _allocation.Free();
+            _control.Free();
+        }
+        _size = capacity;
+        _elementsCount = _deletedCount = 0;
+        if (capacity != 0)
+        {
+            _allocation.Allocate(capacity);
+            _control.Allocate(capacity);
+            int8* control = _control.Get();
+            for (int32 i = 0; i < capacity; i++)
+                control[i] = FlatHashTable::Empty;
+        }
+        if (oldSize != 0)
+        {
+            Bucket* oldData = oldAllocation.Get();
+            const int8* oldControlData = oldControl.Get();
+            for (int32 i = 0; i < oldSize; i++)
+            {
+                if (FlatHashTable::IsOccupied(oldControlData[i]))
+                {
+                    if (capacity != 0)
+                    {
+                        const uint32 hash = FlatHashTable::MixHash(GetHash(oldData[i].Key));
+                        const int32 index = FindFreeIndex(hash);
+                        _control.Get()[index] = FlatHashTable::GetTag(hash);
+                        oldData[i].MoveTo(_allocation.Get()[index]);
+                        _elementsCount++;
+                    }
+                    else
+                    {
+                        oldData[i].Free();
+                    }
+                }
+            }
+            oldAllocation.Free();
+            oldControl.Free();
+        }
+    }
+
+    void MoveFrom(FlatDictionary& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            _elementsCount = other._elementsCount;
+            _deletedCount = other._deletedCount;
+            _size = other._size;
+            _allocation.Swap(other._allocation);
+            _control.Swap(other._control);
+            other._elementsCount = other._deletedCount = other._size = 0;
+        }
+        else
+        {
+            EnsureCapacity(other.Count(), false);
+            Bucket* data = other._allocation.Get();
+            const int8* control = other._control.Get();
+            for (int32 i = 0; i < other._size; i++)
+            {
+                if (FlatHashTable::IsOccupied(control[i]))
+                {
+                    Bucket& bucket = data[i];
+                    Bucket* newBucket = OnAdd(FlatHashTable::MixHash(GetHash(bucket.Key)));
+                    bucket.MoveTo(*newBucket);
+                }
+            }
+            other._elementsCount = other._deletedCount = 0;
+            other._allocation.Free();
+            other._control.Free();
+            other._size = 0;
+        }
+    }
+};
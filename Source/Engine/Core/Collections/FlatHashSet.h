@@ -0,0 +1,741 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/FlatHashTable.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+
+/// <summary>
+/// Template for unordered set of values (without duplicates with O(1) lookup access). Uses open-addressing with separate control bytes (see FlatHashTable) which makes lookups faster than in HashSet and requires less memory due to higher load factor.
+/// Has the same API as HashSet. Removing elements doesn't invalidate iterators, tombstones are reused on insertion and compacted automatically.
+/// </summary>
+/// <typeparam name="T">The type of elements in the set.</typeparam>
+/// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
+template<typename T, typename AllocationType = HeapAllocation>
+class FlatHashSet
+{
+    friend FlatHashSet;
+public:
+    /// <summary>
+    /// Describes single portion of space for the item in a hash set.
+    /// </summary>
+    struct Bucket
+    {
+        friend FlatHashSet;
+
+        /// <summary>The item.</summary>
+        T Item;
+
+    private:
+        FORCE_INLINE void Free()
+        {
+            Memory::DestructItem(&Item);
+        }
+
+        template<typename ItemType>
+        FORCE_INLINE void Occupy(const ItemType& item)
+        {
+            Memory::ConstructItems(&Item, &item, 1);
+        }
+
+        FORCE_INLINE void Occupy(T&& item)
+        {
+            Memory::MoveItems(&Item, &item, 1);
+        }
+
+        FORCE_INLINE void MoveTo(Bucket& other)
+        {
+            Memory::MoveItems(&other.Item, &Item, 1);
+            Free();
+        }
+    };
+
+    using AllocationData = typename AllocationType::template Data<Bucket>;
+    using ControlData = typename AllocationType::template Data<int8>;
+
+private:
+    int32 _elementsCount = 0;
+    int32 _deletedCount = 0;
+    int32 _size = 0;
+    AllocationData _allocation;
+    ControlData _control;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    FlatHashSet()
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity.</param>
+    explicit FlatHashSet(const int32 capacity)
+    {
+        SetCapacity(capacity);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    FlatHashSet(FlatHashSet&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    /// <param name="other">Other collection to copy</param>
+    FlatHashSet(const FlatHashSet& other)
+    {
+        Clone(other);
+    }
+
+    /// <summary>
+    /// Clones the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    /// <returns>The reference to this.</returns>
+    FlatHashSet& operator=(const FlatHashSet& other)
+    {
+        if (this != &other)
+            Clone(other);
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    /// <returns>The reference to this.</returns>
+    FlatHashSet& operator=(FlatHashSet&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            _allocation.Free();
+            _control.Free();
+            _size = 0;
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="FlatHashSet"/> class.
+    /// </summary>
+    ~FlatHashSet()
+    {
+        Clear();
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _elementsCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of the elements that can be contained by the collection.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _size;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _elementsCount == 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _elementsCount != 0;
+    }
+
+    /// <summary>
+    /// The FlatHashSet collection iterator.
+    /// </summary>
+    struct Iterator
+    {
+        friend FlatHashSet;
+    private:
+        FlatHashSet* _collection;
+        int32 _index;
+
+    public:
+        Iterator(FlatHashSet* collection, const int32 index)
+            : _collection(collection)
+            , _index(index)
+        {
+        }
+
+        Iterator(FlatHashSet const* collection, const int32 index)
+            : _collection(const_cast<FlatHashSet*>(collection))
+            , _index(index)
+        {
+        }
+
+        Iterator()
+            : _collection(nullptr)
+            , _index(-1)
+        {
+        }
+
+        Iterator(const Iterator& i)
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+        Iterator(Iterator&& i) noexcept
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+    public:
+        FORCE_INLINE int32 Index() const
+        {
+            return _index;
+        }
+
+        FORCE_INLINE bool IsEnd() const
+        {
+            return _index == _collection->_size;
+        }
+
+        FORCE_INLINE bool IsNotEnd() const
+        {
+            return _index != _collection->_size;
+        }
+
+        FORCE_INLINE Bucket& operator*() const
+        {
+            return _collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE Bucket* operator->() const
+        {
+            return &_collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE explicit operator bool() const
+        {
+            return _index >= 0 && _index < _collection->_size;
+        }
+
+        FORCE_INLINE bool operator!() const
+        {
+            return !(bool)*this;
+        }
+
+        FORCE_INLINE bool operator==(const Iterator& v) const
+        {
+            return _index == v._index && _collection == v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const Iterator& v) const
+        {
+            return _index != v._index || _collection != v._collection;
+        }
+
+        Iterator& operator=(const Iterator& v)
+        {
+            _collection = v._collection;
+            _index = v._index;
+            return *this;
+        }
+
+        Iterator& operator=(Iterator&& v) noexcept
+        {
+            _collection = v._collection;
+            _index = v._index;
+            return *this;
+        }
+
+        Iterator& operator++()
+        {
+            const int32 capacity = _collection->_size;
+            if (_index != capacity)
+            {
+                const int8* control = _collection->_control.Get();
+                do
+                {
+                    ++_index;
+                }
+                while (_index != capacity && !FlatHashTable::IsOccupied(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) const
+        {
+            Iterator i = *this;
+            ++i;
+            return i;
+        }
+
+        Iterator& operator--()
+        {
+            if (_index > 0)
+            {
+                const int8* control = _collection->_control.Get();
+                do
+                {
+                    --_index;
+                }
+                while (_index > 0 && !FlatHashTable::IsOccupied(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) const
+        {
+            Iterator i = *this;
+            --i;
+            return i;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Removes all elements from the collection.
+    /// </summary>
+    void Clear()
+    {
+        if (_elementsCount + _deletedCount != 0)
+        {
+            Bucket* data = _allocation.Get();
+            int8* control = _control.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (FlatHashTable::IsOccupied(control[i]))
+                    data[i].Free();
+                control[i] = FlatHashTable::Empty;
+            }
+            _elementsCount = _deletedCount = 0;
+        }
+    }
+
+    /// <summary>
+    /// Clears the collection and delete value objects.
+    /// Note: collection must contain pointers to the objects that have public destructor and be allocated using New method.
+    /// </summary>
+#if defined(_MSC_VER)
+    template<typename = typename TEnableIf<TIsPointer<T>::Value>::Type>
+#endif
+    void ClearDelete()
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Item)
+                ::Delete(i->Item);
+        }
+        Clear();
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection.
+    /// </summary>
+    /// <param name="capacity">The new capacity (rounded up to the power of two, can be zero to release memory).</param>
+    /// <param name="preserveContents">Enables preserving collection contents during resizing.</param>
+    void SetCapacity(int32 capacity, const bool preserveContents = true)
+    {
+        ASSERT(capacity >= 0);
+        if (capacity != 0)
+        {
+            if (capacity < FlatHashTable::MinCapacity)
+                capacity = FlatHashTable::MinCapacity;
+            capacity = Math::RoundUpToPowerOf2(capacity);
+            if (preserveContents && FlatHashTable::GetMaxLoad(capacity) < _elementsCount)
+                capacity = FlatHashTable::GetCapacityForCount(_elementsCount);
+        }
+        if (capacity == _size)
+            return;
+        if (!preserveContents)
+            Clear();
+        Rehash(capacity);
+    }
+
+    /// <summary>
+    /// Ensures that collection has given capacity.
+    /// </summary>
+    /// <param name="minCapacity">The minimum required capacity (amount of elements that can be added without resizing the collection).</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, const bool preserveContents = true)
+    {
+        if (FlatHashTable::GetMaxLoad(_size) >= minCapacity)
+            return;
+        SetCapacity(FlatHashTable::GetCapacityForCount(minCapacity), preserveContents);
+    }
+
+    /// <summary>
+    /// Swaps the contents of collection with the other object without copy operation. Performs fast internal data exchange.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    void Swap(FlatHashSet& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            ::Swap(_elementsCount, other._elementsCount);
+            ::Swap(_deletedCount, other._deletedCount);
+            ::Swap(_size, other._size);
+            _allocation.Swap(other._allocation);
+            _control.Swap(other._control);
+        }
+        else
+        {
+            ::Swap(other, *this);
+        }
+    }
+
+public:
+    /// <summary>
+    /// Add element to the collection.
+    /// </summary>
+    /// <param name="item">The element to add to the set.</param>
+    /// <returns>True if element has been added to the collection, otherwise false if the element is already present.</returns>
+    template<typename ItemType>
+    bool Add(const ItemType& item)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(item));
+        if (FindIndex(item, hash) != -1)
+            return false;
+        OnAdd(hash)->Occupy(item);
+        return true;
+    }
+
+    /// <summary>
+    /// Add element to the collection.
+    /// </summary>
+    /// <param name="item">The element to add to the set.</param>
+    /// <returns>True if element has been added to the collection, otherwise false if the element is already present.</returns>
+    bool Add(T&& item)
+    {
+        const uint32 hash = FlatHashTable::MixHash(GetHash(item));
+        if (FindIndex(item, hash) != -1)
+            return false;
+        OnAdd(hash)->Occupy(MoveTemp(item));
+        return true;
+    }
+
+    /// <summary>
+    /// Add element at iterator to the collection
+    /// </summary>
+    /// <param name="i">Iterator with item to add</param>
+    void Add(const Iterator& i)
+    {
+        ASSERT(i._collection != this && i);
+        const Bucket& bucket = *i;
+        Add(bucket.Item);
+    }
+
+    /// <summary>
+    /// Removes the specified element from the collection.
+    /// </summary>
+    /// <param name="item">The element to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    template<typename ItemType>
+    bool Remove(const ItemType& item)
+    {
+        const int32 index = FindIndex(item, FlatHashTable::MixHash(GetHash(item)));
+        if (index == -1)
+            return false;
+        RemoveAt(index);
+        return true;
+    }
+
+    /// <summary>
+    /// Removes an element at specified iterator position.
+    /// </summary>
+    /// <param name="i">The element iterator to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    bool Remove(const Iterator& i)
+    {
+        ASSERT(i._collection == this);
+        if (i)
+        {
+            ASSERT(FlatHashTable::IsOccupied(_control.Get()[i._index]));
+            RemoveAt(i._index);
+            return true;
+        }
+        return false;
+    }
+
+public:
+    /// <summary>
+    /// Find element with given item in the collection
+    /// </summary>
+    /// <param name="item">Item to find</param>
+    /// <returns>Iterator for the found element or End if cannot find it</returns>
+    template<typename ItemType>
+    Iterator Find(const ItemType& item) const
+    {
+        const int32 index = FindIndex(item, FlatHashTable::MixHash(GetHash(item)));
+        return index != -1 ? Iterator(this, index) : End();
+    }
+
+    /// <summary>
+    /// Determines whether a collection contains the specified element.
+    /// </summary>
+    /// <param name="item">The item to locate.</param>
+    /// <returns>True if value has been found in a collection, otherwise false</returns>
+    template<typename ItemType>
+    bool Contains(const ItemType& item) const
+    {
+        return FindIndex(item, FlatHashTable::MixHash(GetHash(item))) != -1;
+    }
+
+public:
+    /// <summary>
+    /// Clones other collection into this
+    /// </summary>
+    /// <param name="other">Other collection to clone</param>
+    void Clone(const FlatHashSet& other)
+    {
+        Clear();
+        EnsureCapacity(other.Count(), false);
+        for (Iterator i = other.Begin(); i != other.End(); ++i)
+            Add(i);
+    }
+
+public:
+    Iterator Begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    Iterator End() const
+    {
+        return Iterator(this, _size);
+    }
+
+    Iterator begin()
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end()
+    {
+        return Iterator(this, _size);
+    }
+
+    Iterator begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end() const
+    {
+        return Iterator(this, _size);
+    }
+
+private:
+    template<typename ItemType>
+    int32 FindIndex(const ItemType& item, const uint32 hash) const
+    {
+        if (_elementsCount == 0)
+            return -1;
+        const int32 groupMask = (_size / FlatHashTable::GroupSize) - 1;
+        const int8 tag = FlatHashTable::GetTag(hash);
+        const int8* control = _control.Get();
+        const Bucket* data = _allocation.Get();
+        int32 group = (int32)hash & groupMask;
+        for (int32 probe = 0; probe <= groupMask; probe++)
+        {
+            // Check all slots in a group with matching hash bits
+            const int32 groupStart = group * FlatHashTable::GroupSize;
+            uint32 mask = FlatHashTable::Match(control + groupStart, tag);
+            while (mask)
+            {
+                const int32 index = groupStart + FlatHashTable::LowestBit(mask);
+                if (data[index].Item == item)
+                    return index;
+                mask &= mask - 1;
+            }
+
+            // Stop at the first group with an empty slot (key would be inserted there)
+            if (FlatHashTable::Match(control + groupStart, FlatHashTable::Empty))
+                break;
+
+            // Triangular probing visits all groups for the power of two groups count
+            group = (group + probe + 1) & groupMask;
+        }
+        return -1;
+    }
+
+    int32 FindFreeIndex(const uint32 hash) const
+    {
+        const int32 groupMask = (_size / FlatHashTable::GroupSize) - 1;
+        const int8* control = _control.Get();
+        int32 group = (int32)hash & groupMask;
+        for (int32 probe = 0; probe <= groupMask; probe++)
+        {
+            const int32 groupStart = group * FlatHashTable::GroupSize;
+            const uint32 mask = FlatHashTable::MatchFree(control + groupStart);
+            if (mask)
+                return groupStart + FlatHashTable::LowestBit(mask);
+            group = (group + probe + 1) & groupMask;
+        }
+        return -1;
+    }
+
+    Bucket* OnAdd(const uint32 hash)
+    {
+        if (_elementsCount + _deletedCount >= FlatHashTable::GetMaxLoad(_size))
+        {
+            // Compact tombstones if there are a lot of them, otherwise grow
+            if (_size != 0 && _elementsCount < FlatHashTable::GetMaxLoad(_size) / 2)
+                Rehash(_size);
+            else
+                Rehash(_size == 0 ? FlatHashTable::MinCapacity : _size * 2);
+        }
+        const int32 index = FindFreeIndex(hash);
+        ASSERT(index != -1);
+        int8& control = _control.Get()[index];
+        if (control == FlatHashTable::Deleted)
+            _deletedCount--;
+        control = FlatHashTable::GetTag(hash);
+        _elementsCount++;
+        return &_allocation.Get()[index];
+    }
+
+    void RemoveAt(const int32 index)
+    {
+        _allocation.Get()[index].Free();
+        --_elementsCount;
+
+        // If group has any empty slot then no probe sequence went past it so slot can be marked as empty instead of leaving a tombstone
+        int8* control = _control.Get();
+        const int32 groupStart = index & ~(FlatHashTable::GroupSize - 1);
+        if (FlatHashTable::Match(control + groupStart, FlatHashTable::Empty))
+        {
+            control[index] = FlatHashTable::Empty;
+        }
+        else
+        {
+            control[index] = FlatHashTable::Deleted;
+            ++_deletedCount;
+        }
+    }
+
+    void Rehash(const int32 capacity)
+    {
+        AllocationData oldAllocation;
+        ControlData oldControl;
+        const int32 oldSize = _size;
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            oldAllocation.Swap(_allocation);
+            oldControl.Swap(_control);
+        }
+        else if (oldSize != 0)
+        {
+            // Move elements into the temporary storage (allocation cannot be swapped)
+            oldAllocation.Allocate(oldSize);
+            oldControl.Allocate(oldSize);
+            Bucket* fromData = _allocation.Get();
+            Bucket* toData = oldAllocation.Get();
+            const int8* fromControl = _control.Get();
+            int8* toControl = oldControl.Get();
+            for (int32 i = 0; i < oldSize; i++)
+            {
+                toControl[i] = fromControl[i];
+                if (FlatHashTable::IsOccupied(fromControl[i]))
+                    fromData[i].MoveTo(toData[i]);
+            }
+            _allocation.Free();
+            _control.Free();
+        }
+        _size = capacity;
+        _elementsCount = _deletedCount = 0;
+        if (capacity != 0)
+        {
+            _allocation.Allocate(capacity);
+            _control.Allocate(capacity);
+            int8* control = _control.Get();
+            for (int32 i = 0; i < capacity; i++)
+                control[i] = FlatHashTable::Empty;
+        }
+        if (oldSize != 0)
+        {
+            Bucket* oldData = oldAllocation.Get();
+            const int8* oldControlData = oldControl.Get();
+            for (int32 i = 0; i < oldSize; i++)
+            {
+                if (FlatHashTable::IsOccupied(oldControlData[i]))
+                {
+                    if (capacity != 0)
+                    {
+                        const uint32 hash = FlatHashTable::MixHash(GetHash(oldData[i].Item));
+                        const int32 index = FindFreeIndex(hash);
+                        _control.Get()[index] = FlatHashTable::GetTag(hash);
+                        oldData[i].MoveTo(_allocation.Get()[index]);
+                        _elementsCount++;
+                    }
+                    else
+                    {
+                        oldData[i].Free();
+                    }
+                }
+            }
+            oldAllocation.Free();
+            oldControl.Free();
+        }
+    }
+
+    void MoveFrom(FlatHashSet& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            _elementsCount = other._elementsCount;
+            _deletedCount = other._deletedCount;
+            _size = other._size;
+            _allocation.Swap(other._allocation);
+            _control.Swap(other._control);
+            other._elementsCount = other._deletedCount = other._size = 0;
+        }
+        else
+        {
+            EnsureCapacity(other.Count(), false);
+            Bucket* data = other._allocation.Get();
+            const int8* control = other._control.Get();
+            for (int32 i = 0; i < other._size; i++)
+            {
+                if (FlatHashTable::IsOccupied(control[i]))
+                {
+                    Bucket& bucket = data[i];
+                    Bucket* newBucket = OnAdd(FlatHashTable::MixHash(GetHash(bucket.Item)));
+                    bucket.MoveTo(*newBucket);
+                }
+            }
+            other._elementsCount = other._deletedCount = 0;
+            other._allocation.Free();
+            other._control.Free();
+            other._size = 0;
+        }
+    }
+};
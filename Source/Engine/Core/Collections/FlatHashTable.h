@@ -0,0 +1,133 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Platform/Defines.h"
+#if PLATFORM_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Utilities for open-addressing hash tables with separate control bytes (used by FlatDictionary and FlatHashSet).
+/// Each slot has a single control byte that is either Empty, Deleted or contains 7 bits of the key hash (for occupied slots). Slots are organized into groups of 16 that are scanned at once (with SIMD when available) so lookups touch only the control bytes and the buckets with matching hash bits.
+/// </summary>
+namespace FlatHashTable
+{
+    /// <summary>
+    /// The amount of slots in a single group (scanned at once).
+    /// </summary>
+    constexpr int32 GroupSize = 16;
+
+    /// <summary>
+    /// The minimum capacity of the table (single group).
+    /// </summary>
+    constexpr int32 MinCapacity = GroupSize;
+
+    /// <summary>
+    /// Control byte of the empty slot.
+    /// </summary>
+    constexpr int8 Empty = -128;
+
+    /// <summary>
+    /// Control byte of the removed slot (tombstone).
+    /// </summary>
+    constexpr int8 Deleted = -2;
+
+    /// <summary>
+    /// Mixes the key hash to spread bits before selecting the group (low bits) and the control byte (high bits). Uses full avalanche finalizer (MurmurHash3 fmix32) so every input bit affects the group index (plain multiplicative hash leaves low bits dependent only on the low input bits).
+    /// </summary>
+    FORCE_INLINE uint32 MixHash(uint32 hash)
+    {
+        hash ^= hash >> 16;
+        hash *= 0x85EBCA6Bu;
+        hash ^= hash >> 13;
+        hash *= 0xC2B2AE35u;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    /// <summary>
+    /// Gets the control byte for the occupied slot (top 7 bits of the mixed hash).
+    /// </summary>
+    FORCE_INLINE int8 GetTag(uint32 mixedHash)
+    {
+        return (int8)(mixedHash >> 25);
+    }
+
+    /// <summary>
+    /// Checks if the given control byte describes occupied slot.
+    /// </summary>
+    FORCE_INLINE bool IsOccupied(int8 control)
+    {
+        return control >= 0;
+    }
+
+    /// <summary>
+    /// Gets the index of the lowest set bit in the mask (mask cannot be zero).
+    /// </summary>
+    FORCE_INLINE int32 LowestBit(uint32 mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (int32)index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    /// <summary>
+    /// Gets the bitmask of the group slots with control byte matching the given value.
+    /// </summary>
+    FORCE_INLINE uint32 Match(const int8* group, int8 value)
+    {
+#if PLATFORM_SIMD_SSE2
+        const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+        return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+        uint32 mask = 0;
+        for (int32 i = 0; i < GroupSize; i++)
+            mask |= (group[i] == value ? 1u : 0u) << i;
+        return mask;
+#endif
+    }
+
+    /// <summary>
+    /// Gets the bitmask of the group slots that are empty or deleted (free to insert).
+    /// </summary>
+    FORCE_INLINE uint32 MatchFree(const int8* group)
+    {
+#if PLATFORM_SIMD_SSE2
+        // Both Empty and Deleted have the sign bit set
+        return (uint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+        uint32 mask = 0;
+        for (int32 i = 0; i < GroupSize; i++)
+            mask |= (group[i] < 0 ? 1u : 0u) << i;
+        return mask;
+#endif
+    }
+
+    /// <summary>
+    /// Gets the maximum amount of slots that can be used (by elements and tombstones) before table needs to be resized or rehashed (7/8 load factor).
+    /// </summary>
+    FORCE_INLINE int32 GetMaxLoad(int32 capacity)
+    {
+        return capacity - (capacity >> 3);
+    }
+
+    /// <summary>
+    /// Calculates the table capacity (power of two) required to store the given amount of elements.
+    /// </summary>
+    FORCE_INLINE int32 GetCapacityForCount(int32 count)
+    {
+        int32 capacity = MinCapacity;
+        while (GetMaxLoad(capacity) < count)
+            capacity <<= 1;
+        return capacity;
+    }
+}
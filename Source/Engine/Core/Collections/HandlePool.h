@@ -0,0 +1,335 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Array.h"
+
+/// <summary>
+/// Handle to the item stored in the HandlePool. Contains the slot index and its generation that is used to detect usage of the removed items.
+/// </summary>
+struct PoolHandle
+{
+    /// <summary>
+    /// The slot index (or MAX_uint32 for invalid handle).
+    /// </summary>
+    uint32 Index = MAX_uint32;
+
+    /// <summary>
+    /// The slot generation (incremented each time the slot gets released).
+    /// </summary>
+    uint32 Generation = 0;
+
+    /// <summary>
+    /// Checks if handle has been assigned to any item (it still can be outdated).
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return Index != MAX_uint32;
+    }
+
+    FORCE_INLINE bool operator==(const PoolHandle& other) const
+    {
+        return Index == other.Index && Generation == other.Generation;
+    }
+
+    FORCE_INLINE bool operator!=(const PoolHandle& other) const
+    {
+        return Index != other.Index || Generation != other.Generation;
+    }
+};
+
+template<>
+struct TIsPODType<PoolHandle>
+{
+    enum { Value = true };
+};
+
+/// <summary>
+/// Template for the sparse set container that stores items in a linear array (for fast iteration) and gives out generation-checked handles that can be used to remove items in constant time.
+/// </summary>
+/// <remarks>
+/// Removing an item moves the last item into its place, so items order is not preserved. Handles remain valid until the item gets removed (or collection cleared), outdated handles are safely ignored.
+/// </remarks>
+/// <typeparam name="T">The type of elements in the collection.</typeparam>
+/// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
+template<typename T, typename AllocationType = HeapAllocation>
+class HandlePool
+{
+private:
+    struct Slot
+    {
+        // Index of the item (or -1 if slot is free)
+        int32 ItemIndex;
+        // Index of the next free slot (or -1 if slot is the last free slot)
+        int32 NextFree;
+        uint32 Generation;
+    };
+
+    Array<T, AllocationType> _items;
+    Array<int32, AllocationType> _itemSlots;
+    Array<Slot, AllocationType> _slots;
+    int32 _freeSlot = -1;
+
+    FORCE_INLINE int32 GetSlotItem(const PoolHandle& handle) const
+    {
+        if (handle.Index >= (uint32)_slots.Count())
+            return -1;
+        const Slot& slot = _slots.Get()[handle.Index];
+        return slot.Generation == handle.Generation ? slot.ItemIndex : -1;
+    }
+
+    PoolHandle AllocateSlot()
+    {
+        int32 slotIndex = _freeSlot;
+        if (slotIndex != -1)
+        {
+            _freeSlot = _slots[slotIndex].NextFree;
+        }
+        else
+        {
+            slotIndex = _slots.Count();
+            Slot& slot = _slots.AddOne();
+            slot.Generation = 0;
+        }
+        Slot& slot = _slots[slotIndex];
+        slot.ItemIndex = _items.Count();
+        slot.NextFree = -1;
+        _itemSlots.Add(slotIndex);
+        PoolHandle handle;
+        handle.Index = (uint32)slotIndex;
+        handle.Generation = slot.Generation;
+        return handle;
+    }
+
+    FORCE_INLINE void ReleaseSlot(int32 slotIndex)
+    {
+        Slot& slot = _slots[slotIndex];
+        slot.ItemIndex = -1;
+        slot.NextFree = _freeSlot;
+        slot.Generation++;
+        _freeSlot = slotIndex;
+    }
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="HandlePool"/> class.
+    /// </summary>
+    HandlePool()
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="HandlePool"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity.</param>
+    explicit HandlePool(const int32 capacity)
+        : _items(capacity)
+        , _itemSlots(capacity)
+        , _slots(capacity)
+    {
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the items in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _items.Count();
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _items.IsEmpty();
+    }
+
+    /// <summary>
+    /// Returns true if collection isn't empty.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _items.HasItems();
+    }
+
+    /// <summary>
+    /// Gets the pointer to the first item in the collection (linear allocation).
+    /// </summary>
+    FORCE_INLINE T* Get()
+    {
+        return _items.Get();
+    }
+
+    /// <summary>
+    /// Gets the pointer to the first item in the collection (linear allocation).
+    /// </summary>
+    FORCE_INLINE const T* Get() const
+    {
+        return _items.Get();
+    }
+
+    /// <summary>
+    /// Gets the items array (linear allocation). Items order changes when removing them.
+    /// </summary>
+    FORCE_INLINE const Array<T, AllocationType>& GetItems() const
+    {
+        return _items;
+    }
+
+    /// <summary>
+    /// Gets or sets the item at the specified index.
+    /// </summary>
+    /// <param name="index">The index of the item.</param>
+    /// <returns>The reference to the item.</returns>
+    FORCE_INLINE T& operator[](const int32 index)
+    {
+        return _items[index];
+    }
+
+    /// <summary>
+    /// Gets the item at the specified index.
+    /// </summary>
+    /// <param name="index">The index of the item.</param>
+    /// <returns>The reference to the item.</returns>
+    FORCE_INLINE const T& operator[](const int32 index) const
+    {
+        return _items[index];
+    }
+
+    /// <summary>
+    /// Checks if the handle points to the item that exists in the collection.
+    /// </summary>
+    /// <param name="handle">The item handle.</param>
+    /// <returns>True if handle is valid, otherwise false.</returns>
+    FORCE_INLINE bool Contains(const PoolHandle& handle) const
+    {
+        return GetSlotItem(handle) != -1;
+    }
+
+    /// <summary>
+    /// Gets the item pointed by the handle.
+    /// </summary>
+    /// <param name="handle">The item handle.</param>
+    /// <returns>The pointer to the item or null if handle is invalid or outdated.</returns>
+    T* TryGet(const PoolHandle& handle)
+    {
+        const int32 index = GetSlotItem(handle);
+        return index != -1 ? _items.Get() + index : nullptr;
+    }
+
+    /// <summary>
+    /// Gets the item pointed by the handle.
+    /// </summary>
+    /// <param name="handle">The item handle.</param>
+    /// <returns>The pointer to the item or null if handle is invalid or outdated.</returns>
+    const T* TryGet(const PoolHandle& handle) const
+    {
+        const int32 index = GetSlotItem(handle);
+        return index != -1 ? _items.Get() + index : nullptr;
+    }
+
+public:
+    /// <summary>
+    /// Adds the specified item to the collection.
+    /// </summary>
+    /// <param name="item">The item to add.</param>
+    /// <returns>The handle to the added item.</returns>
+    PoolHandle Add(const T& item)
+    {
+        const PoolHandle handle = AllocateSlot();
+        _items.Add(item);
+        return handle;
+    }
+
+    /// <summary>
+    /// Adds the specified item to the collection.
+    /// </summary>
+    /// <param name="item">The item to add.</param>
+    /// <returns>The handle to the added item.</returns>
+    PoolHandle Add(T&& item)
+    {
+        const PoolHandle handle = AllocateSlot();
+        _items.Add(MoveTemp(item));
+        return handle;
+    }
+
+    /// <summary>
+    /// Removes the item pointed by the handle. The last item is moved into its place.
+    /// </summary>
+    /// <param name="handle">The item handle.</param>
+    /// <returns>True if cannot remove item from the collection because handle is invalid or outdated, otherwise false.</returns>
+    bool Remove(const PoolHandle& handle)
+    {
+        const int32 index = GetSlotItem(handle);
+        if (index == -1)
+            return true;
+        const int32 lastIndex = _items.Count() - 1;
+        if (index != lastIndex)
+        {
+            const int32 lastSlot = _itemSlots.Get()[lastIndex];
+            _itemSlots.Get()[index] = lastSlot;
+            _slots.Get()[lastSlot].ItemIndex = index;
+        }
+        _items.RemoveAt(index);
+        _itemSlots.RemoveAt(index);
+        ReleaseSlot((int32)handle.Index);
+        return false;
+    }
+
+    /// <summary>
+    /// Removes the item pointed by the handle and resets the handle.
+    /// </summary>
+    /// <param name="handle">The item handle.</param>
+    /// <returns>True if cannot remove item from the collection because handle is invalid or outdated, otherwise false.</returns>
+    FORCE_INLINE bool RemoveAndReset(PoolHandle& handle)
+    {
+        const bool result = Remove(handle);
+        handle = PoolHandle();
+        return result;
+    }
+
+    /// <summary>
+    /// Clears the collection. All existing handles become outdated.
+    /// </summary>
+    void Clear()
+    {
+        for (int32 i = _itemSlots.Count() - 1; i >= 0; i--)
+            ReleaseSlot(_itemSlots.Get()[i]);
+        _items.Clear();
+        _itemSlots.Clear();
+    }
+
+    /// <summary>
+    /// Ensures the collection has given capacity (or more).
+    /// </summary>
+    /// <param name="minCapacity">The minimum capacity.</param>
+    void EnsureCapacity(const int32 minCapacity)
+    {
+        _items.EnsureCapacity(minCapacity);
+        _itemSlots.EnsureCapacity(minCapacity);
+        _slots.EnsureCapacity(minCapacity);
+    }
+
+public:
+    FORCE_INLINE T* begin()
+    {
+        return _items.Get();
+    }
+
+    FORCE_INLINE T* end()
+    {
+        return _items.Get() + _items.Count();
+    }
+
+    FORCE_INLINE const T* begin() const
+    {
+        return _items.Get();
+    }
+
+    FORCE_INLINE const T* end() const
+    {
+        return _items.Get() + _items.Count();
+    }
+};
@@ -102,9 +102,8 @@ API_CLASS(InBuild) class HashSet
                 if (fromBucket.IsOccupied())
                 {
                     Bucket& toBucket = toData[i];
-                    Memory::MoveItems(&toBucket.Item, &fromBucket.Item, 1);
+                    Memory::RelocateItems(&toBucket.Item, &fromBucket.Item, 1);
                     toBucket._state = BucketState::Occupied;
-                    Memory::DestructItem(&fromBucket.Item);
                     fromBucket._state = BucketState::Empty;
                 }
             }
@@ -452,8 +451,9 @@ API_CLASS(InBuild) class HashSet
                     FindPosition(oldBucket.Item, pos);
                     ASSERT(pos.FreeSlotIndex != -1);
                     Bucket* bucket = &_allocation.Get()[pos.FreeSlotIndex];
-                    Memory::MoveItems(&bucket->Item, &oldBucket.Item, 1);
+                    Memory::RelocateItems(&bucket->Item, &oldBucket.Item, 1);
                     bucket->_state = BucketState::Occupied;
+                    oldBucket._state = BucketState::Empty;
                     _elementsCount++;
                 }
             }
@@ -778,8 +778,9 @@ API_CLASS(InBuild) class HashSet
                     FindPosition(oldBucket.Item, pos);
                     ASSERT(pos.FreeSlotIndex != -1);
                     Bucket* bucket = &_allocation.Get()[pos.FreeSlotIndex];
-                    Memory::MoveItems(&bucket->Item, &oldBucket.Item, 1);
+                    Memory::RelocateItems(&bucket->Item, &oldBucket.Item, 1);
                     bucket->_state = BucketState::Occupied;
+                    oldBucket._state = BucketState::Empty;
                 }
             }
             for (int32 i = 0; i < _size; ++i)
@@ -788,3 +789,9 @@ API_CLASS(InBuild) class HashSet
         _deletedCount = 0;
     }
 };
+
+template<typename T>
+struct TIsTriviallyRelocatable<HashSet<T, HeapAllocation>>
+{
+    enum { Value = true };
+};
@@ -3,6 +3,10 @@
 #include "Sorting.h"
 #include "Engine/Core/Memory/Memory.h"
 #include "Engine/Threading/ThreadLocal.h"
+#include "Engine/Threading/JobSystem.h"
+
+// Minimum amount of elements processed by a single job in the parallel Radix Sort
+#define RADIX_SORT_PARALLEL_CHUNK_SIZE (16 * 1024)
 
 // Use a cached storage for the sorting (one per thread to reduce locking)
 ThreadLocal<Sorting::SortingStack*> SortingStacks;
@@ -53,3 +57,16 @@ void Sorting::SortingStack::EnsureCapacity(int32 minCapacity)
         num = minCapacity;
     SetCapacity(num);
 }
+
+int32 Sorting::GetRadixSortJobsCount(int32 count)
+{
+    return Math::Min(count / RADIX_SORT_PARALLEL_CHUNK_SIZE, JobSystem::GetThreadsCount());
+}
+
+void Sorting::ExecuteParallel(void (*job)(int32, void*), void* userData, int32 jobCount)
+{
+    JobSystem::Execute([job, userData](int32 index)
+    {
+        job(index, userData);
+    }, jobCount);
+}
@@ -4,6 +4,8 @@
 
 #include "Engine/Core/Types/BaseTypes.h"
 #include "Engine/Platform/Platform.h"
+#include "Engine/Core/Templates.h"
+#include "Engine/Core/Math/Math.h"
 
 /// <summary>
 /// Helper utility used for sorting data collections.
@@ -334,7 +336,7 @@ class FLAXENGINE_API Sorting
     }
 
     /// <summary>
-    /// Sorts the linear data array using Radix Sort algorithm (uses temporary keys collection).
+    /// Sorts the linear data array using Radix Sort algorithm (uses temporary keys collection). Sorting is stable (preserves the order of the elements with equal keys).
     /// </summary>
     /// <param name="inputKeys">The data pointer to the input sorting keys array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
     /// <param name="inputValues">The data pointer to the input values array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
@@ -349,7 +351,8 @@ class FLAXENGINE_API Sorting
         {
             RADIXSORT_BITS = 11,
             RADIXSORT_HISTOGRAM_SIZE = 1 << RADIXSORT_BITS,
-            RADIXSORT_BIT_MASK = RADIXSORT_HISTOGRAM_SIZE - 1
+            RADIXSORT_BIT_MASK = RADIXSORT_HISTOGRAM_SIZE - 1,
+            RADIXSORT_PASSES = (sizeof(T) * 8 + RADIXSORT_BITS - 1) / RADIXSORT_BITS,
         };
         if (count < 2)
             return;
@@ -361,8 +364,8 @@ class FLAXENGINE_API Sorting
 
         uint32 histogram[RADIXSORT_HISTOGRAM_SIZE];
         uint16 shift = 0;
-        int32 pass = 0;
-        for (; pass < 6; pass++)
+        int32 swaps = 0;
+        for (int32 pass = 0; pass < RADIXSORT_PASSES; pass++, shift += RADIXSORT_BITS)
         {
             Platform::MemoryClear(histogram, sizeof(uint32) * RADIXSORT_HISTOGRAM_SIZE);
 
@@ -379,9 +382,11 @@ class FLAXENGINE_API Sorting
             }
 
             if (sorted)
-            {
-                goto end;
-            }
+                break;
+
+            // Skip the pass if all keys have the same digit (eg. unused high bits of the key)
+            if (histogram[(keys[0] >> shift) & RADIXSORT_BIT_MASK] == (uint32)count)
+                continue;
 
             uint32 offset = 0;
             for (int32 i = 0; i < RADIXSORT_HISTOGRAM_SIZE; ++i)
@@ -408,15 +413,242 @@ class FLAXENGINE_API Sorting
             tempValues = values;
             values = swapValues;
 
-            shift += RADIXSORT_BITS;
+            swaps++;
         }
 
-    end:
-        if (pass & 1)
+        if (swaps & 1)
         {
             // Use temporary keys and values as a result
             inputKeys = tmpKeys;
             inputValues = tmpValues;
         }
     }
+
+    /// <summary>
+    /// Sorts the linear data array using Radix Sort algorithm (uses temporary keys collection). Each pass is split into chunks processed in parallel on Job System threads (for small arrays it fallbacks to the single-threaded version). Sorting is stable (preserves the order of the elements with equal keys).
+    /// </summary>
+    /// <param name="inputKeys">The data pointer to the input sorting keys array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
+    /// <param name="inputValues">The data pointer to the input values array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
+    /// <param name="tmpKeys">The data pointer to the temporary sorting keys array.</param>
+    /// <param name="tmpValues">The data pointer to the temporary values array.</param>
+    /// <param name="count">The elements count.</param>
+    template<typename T, typename U>
+    static void RadixSortParallel(T*& inputKeys, U*& inputValues, T* tmpKeys, U* tmpValues, int32 count)
+    {
+        const int32 jobCount = GetRadixSortJobsCount(count);
+        if (jobCount <= 1)
+        {
+            RadixSort(inputKeys, inputValues, tmpKeys, tmpValues, count);
+            return;
+        }
+
+        RadixSortContext<T, U> context;
+        context.Keys = inputKeys;
+        context.TempKeys = tmpKeys;
+        context.Values = inputValues;
+        context.TempValues = tmpValues;
+        context.Count = count;
+        context.ChunkSize = (count + jobCount - 1) / jobCount;
+        context.Histograms = (uint32*)Platform::Allocate(sizeof(uint32) * RadixSortContext<T, U>::HistogramSize * jobCount, 16);
+        context.Sorted = (bool*)Platform::Allocate(sizeof(bool) * jobCount, 16);
+        int32 swaps = 0;
+        for (int32 pass = 0; pass < RadixSortContext<T, U>::Passes; pass++)
+        {
+            context.Shift = pass * RadixSortContext<T, U>::Bits;
+
+            // Count digits within each chunk
+            ExecuteParallel(&RadixSortContext<T, U>::BuildHistogram, &context, jobCount);
+            bool sorted = true;
+            for (int32 job = 0; job < jobCount; job++)
+            {
+                const int32 start = job * context.ChunkSize;
+                sorted &= context.Sorted[job] && (start == 0 || start >= count || context.Keys[start - 1] <= context.Keys[start]);
+            }
+            if (sorted)
+                break;
+
+            // Convert histograms into scatter offsets (chunks of the same digit are placed in order to keep sorting stable)
+            uint32 offset = 0;
+            bool trivial = false;
+            for (int32 i = 0; i < RadixSortContext<T, U>::HistogramSize; i++)
+            {
+                const uint32 start = offset;
+                for (int32 job = 0; job < jobCount; job++)
+                {
+                    uint32& histogram = context.Histograms[job * RadixSortContext<T, U>::HistogramSize + i];
+                    const uint32 cnt = histogram;
+                    histogram = offset;
+                    offset += cnt;
+                }
+                if (offset - start == (uint32)count)
+                {
+                    // Skip the pass if all keys have the same digit (eg. unused high bits of the key)
+                    trivial = true;
+                    break;
+                }
+            }
+            if (trivial)
+                continue;
+
+            // Move elements
+            ExecuteParallel(&RadixSortContext<T, U>::Scatter, &context, jobCount);
+            Swap(context.Keys, context.TempKeys);
+            Swap(context.Values, context.TempValues);
+            swaps++;
+        }
+        Platform::Free(context.Histograms);
+        Platform::Free(context.Sorted);
+
+        if (swaps & 1)
+        {
+            // Use temporary keys and values as a result
+            inputKeys = tmpKeys;
+            inputValues = tmpValues;
+        }
+    }
+
+    /// <summary>
+    /// Sorts the linear data array using in-place Radix Sort algorithm (most significant digit first, no temporary memory). Sorting is unstable (order of the elements with equal keys is not preserved).
+    /// </summary>
+    /// <param name="keys">The data pointer to the sorting keys array.</param>
+    /// <param name="values">The data pointer to the values array.</param>
+    /// <param name="count">The elements count.</param>
+    template<typename T, typename U>
+    FORCE_INLINE static void RadixSortUnstable(T* keys, U* values, int32 count)
+    {
+        RadixSortInPlace(keys, values, count, (int32)(sizeof(T) * 8 - 8));
+    }
+
+private:
+    template<typename T, typename U>
+    struct RadixSortContext
+    {
+        enum
+        {
+            Bits = 11,
+            HistogramSize = 1 << Bits,
+            BitMask = HistogramSize - 1,
+            Passes = (sizeof(T) * 8 + Bits - 1) / Bits,
+        };
+
+        T* Keys;
+        T* TempKeys;
+        U* Values;
+        U* TempValues;
+        uint32* Histograms;
+        bool* Sorted;
+        int32 Count;
+        int32 ChunkSize;
+        int32 Shift;
+
+        static void BuildHistogram(int32 job, void* userData)
+        {
+            auto& context = *(RadixSortContext*)userData;
+            uint32* histogram = context.Histograms + job * HistogramSize;
+            Platform::MemoryClear(histogram, sizeof(uint32) * HistogramSize);
+            const int32 start = job * context.ChunkSize;
+            const int32 end = Math::Min(start + context.ChunkSize, context.Count);
+            const T* keys = context.Keys;
+            const int32 shift = context.Shift;
+            bool sorted = true;
+            for (int32 i = start; i < end; i++)
+            {
+                const T key = keys[i];
+                ++histogram[(key >> shift) & BitMask];
+                sorted &= i == start || keys[i - 1] <= key;
+            }
+            context.Sorted[job] = sorted;
+        }
+
+        static void Scatter(int32 job, void* userData)
+        {
+            auto& context = *(RadixSortContext*)userData;
+            uint32* histogram = context.Histograms + job * HistogramSize;
+            const int32 start = job * context.ChunkSize;
+            const int32 end = Math::Min(start + context.ChunkSize, context.Count);
+            const T* keys = context.Keys;
+            const U* values = context.Values;
+            T* tempKeys = context.TempKeys;
+            U* tempValues = context.TempValues;
+            const int32 shift = context.Shift;
+            for (int32 i = start; i < end; i++)
+            {
+                const T key = keys[i];
+                const uint32 dest = histogram[(key >> shift) & BitMask]++;
+                tempKeys[dest] = key;
+                tempValues[dest] = values[i];
+            }
+        }
+    };
+
+    template<typename T, typename U>
+    static void RadixSortInPlace(T* keys, U* values, int32 count, int32 shift)
+    {
+        if (count <= 32)
+        {
+            // Insertion sort for small buckets
+            for (int32 i = 1; i < count; i++)
+            {
+                const T key = keys[i];
+                const U value = values[i];
+                int32 j = i - 1;
+                for (; j >= 0 && keys[j] > key; j--)
+                {
+                    keys[j + 1] = keys[j];
+                    values[j + 1] = values[j];
+                }
+                keys[j + 1] = key;
+                values[j + 1] = value;
+            }
+            return;
+        }
+
+        // Count digits
+        int32 bucketStart[256], bucketEnd[256];
+        Platform::MemoryClear(bucketEnd, sizeof(bucketEnd));
+        for (int32 i = 0; i < count; i++)
+            bucketEnd[(keys[i] >> shift) & 0xff]++;
+        int32 offset = 0;
+        for (int32 i = 0; i < 256; i++)
+        {
+            bucketStart[i] = offset;
+            offset += bucketEnd[i];
+            bucketEnd[i] = bucketStart[i];
+        }
+
+        // Swap elements into their buckets (bucketEnd is the current fill position of the bucket)
+        for (int32 bucket = 0; bucket < 256; bucket++)
+        {
+            const int32 bucketLimit = bucket == 255 ? count : bucketStart[bucket + 1];
+            while (bucketEnd[bucket] < bucketLimit)
+            {
+                const int32 i = bucketEnd[bucket];
+                const int32 digit = (keys[i] >> shift) & 0xff;
+                if (digit == bucket)
+                {
+                    bucketEnd[bucket]++;
+                }
+                else
+                {
+                    const int32 dest = bucketEnd[digit]++;
+                    Swap(keys[i], keys[dest]);
+                    Swap(values[i], values[dest]);
+                }
+            }
+        }
+
+        // Sort buckets by the next digit
+        if (shift == 0)
+            return;
+        for (int32 bucket = 0; bucket < 256; bucket++)
+        {
+            const int32 start = bucketStart[bucket];
+            const int32 end = bucket == 255 ? count : bucketStart[bucket + 1];
+            if (end - start > 1)
+                RadixSortInPlace(keys + start, values + start, end - start, shift - 8);
+        }
+    }
+
+    static int32 GetRadixSortJobsCount(int32 count);
+    static void ExecuteParallel(void (*job)(int32, void*), void* userData, int32 jobCount);
 };
@@ -89,6 +89,36 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(2100), EditorDisplay(\"Content\")")
     bool SkipDefaultFonts = false;
 
+    /// <summary>
+    /// If checked, scenes and prefabs are cooked into the compact binary format instead of JSON. Reduces the build size and the scenes loading time.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2110), EditorDisplay(\"Content\")")
+    bool BinaryScenes = false;
+
+    /// <summary>
+    /// The materials usage file recorded with -recordmaterials command line switch (eg. Cache/MaterialsUsage.bin). Shipped with the game to create the used materials pipeline states right after loading to reduce hitches during gameplay. Path is relative to the project folder.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2120), EditorDisplay(\"Content\")")
+    String MaterialsUsageFile;
+
+    /// <summary>
+    /// The asset types (full type names, eg. FlaxEngine.SceneAsset) which compressed data is packaged using LZ4 compression dictionary trained for each type within the package. Improves the compression ratio of many small assets of the same type (eg. json assets, scenes and prefabs).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2130), EditorDisplay(\"Content\")")
+    Array<String> CompressionDictionaryTypes;
+
+    /// <summary>
+    /// The path to the folder with the shared cooked assets cache (eg. on a network drive used by the build machines). Cooked assets are stored there by the source files contents hash and reused by the other builds with the same engine version and build options. Relative paths are resolved against the project folder. Leave empty to disable.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2140), EditorDisplay(\"Content\")")
+    String SharedCookCache;
+
+    /// <summary>
+    /// The content load order file recorded with -recordloadorder command line switch (eg. Cache/LoadOrder.bin). Used to lay out the assets in the packages in the first-use order (per scene) so loading reads the content files near-sequentially (faster loading from HDD, optical discs or streaming installs). Path is relative to the project folder.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2150), EditorDisplay(\"Content\")")
+    String LoadOrderFile;
+
     /// <summary>
     /// If checked, .NET Runtime won't be packaged with a game and will be required by user to be installed on system upon running game build. Available only on supported platforms such as Windows, Linux and macOS.
     /// </summary>
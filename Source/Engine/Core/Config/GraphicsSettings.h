@@ -23,6 +23,78 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(20), DefaultValue(false), EditorDisplay(\"General\", \"Use V-Sync\")")
     bool UseVSync = false;
 
+    /// <summary>
+    /// Enables GPU-driven culling of the large instanced draws (eg. foliage). Reduces the CPU cost of rendering many instances.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), DefaultValue(false), EditorDisplay(\"General\", \"GPU Instance Culling\")")
+    bool GPUInstanceCulling = false;
+
+    /// <summary>
+    /// Enables GPU-driven foliage culling. CPU culls only the foliage clusters and the instances are culled on GPU. Requires GPU Instance Culling. Disables the per-instance LOD transitions of the foliage.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(35), DefaultValue(false), EditorDisplay(\"General\", \"GPU Foliage Culling\"), VisibleIf(nameof(GPUInstanceCulling))")
+    bool GPUFoliageCulling = false;
+
+    /// <summary>
+    /// Enables persistent objects buffer that keeps objects data on GPU between frames and uploads only the changed objects. Reduces the upload bandwidth in mostly static scenes.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), DefaultValue(false), EditorDisplay(\"General\", \"Persistent Objects Buffer\")")
+    bool PersistentObjectsBuffer = false;
+
+    /// <summary>
+    /// Enables recording of the large draw calls lists on multiple threads. Reduces the CPU time of the rendering in scenes with many draw calls.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50), DefaultValue(false), EditorDisplay(\"General\", \"Parallel Command Recording\")")
+    bool ParallelCommandRecording = false;
+
+    /// <summary>
+    /// Enables clustered lighting that culls local lights in a compute shader. Reduces the cost of many overlapping local lights and allows transparent materials to receive all of them.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(60), DefaultValue(false), EditorDisplay(\"General\", \"Clustered Lighting\")")
+    bool ClusteredLighting = false;
+
+    /// <summary>
+    /// Enables using async compute queue for the compute-only rendering passes (eg. Global SDF update) to overlap them with the graphics work. Supported on DirectX 12.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(70), DefaultValue(false), EditorDisplay(\"General\", \"Async Compute\")")
+    bool AsyncCompute = false;
+
+    /// <summary>
+    /// The size (in megabytes) of the persistent staging memory used by the textures and buffers uploads (eg. streaming). Bigger value helps with streaming bursts but uses more system memory. Use 0 to disable it. Supported on DirectX 12.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(80), DefaultValue(32), Limit(0, 1024), EditorDisplay(\"General\", \"Upload Ring Size (MB)\")")
+    int32 UploadRingSize = 32;
+
+    /// <summary>
+    /// Enables using copy queue for the streaming uploads (textures and meshes data) to run them in parallel to the frame rendering. Supported on DirectX 12.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(90), DefaultValue(false), EditorDisplay(\"General\", \"Copy Queue Uploads\")")
+    bool CopyQueueUploads = false;
+
+    /// <summary>
+    /// The rendering passes that use the variable rate shading to reduce pixel shading cost in the areas with low contrast or fast motion. Supported on DirectX 12 (Tier 2).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(100), DefaultValue(VariableRateShadingPasses.None), EditorDisplay(\"General\", \"Variable Rate Shading\")")
+    VariableRateShadingPasses VariableRateShading = VariableRateShadingPasses::None;
+
+    /// <summary>
+    /// Enables the GPU feedback for the textures streaming. Visible meshes are periodically rendered into a low-resolution buffer that records the sampled textures resolution so only the mips that are actually visible get streamed.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(110), DefaultValue(false), EditorDisplay(\"General\", \"Texture Streaming Feedback\")")
+    bool TextureStreamingFeedback = false;
+
+    /// <summary>
+    /// Enables the compute shader skinning. Animated meshes are skinned once per frame into the vertex buffers that are drawn as static geometry by all rendering passes (eg. shadow maps) instead of skinning vertices in each pass.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(120), DefaultValue(false), EditorDisplay(\"General\", \"Compute Skinning\")")
+    bool ComputeSkinning = false;
+
+    /// <summary>
+    /// The amount of tiles in the terrain virtual texture cache with the pre-blended terrain materials (each tile covers a single terrain chunk and uses about 1MB of GPU memory). Distant terrain chunks are drawn with a single cache lookup instead of evaluating all their material layers. Use 0 to disable it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(130), DefaultValue(0), Limit(0, 1024), EditorDisplay(\"General\", \"Terrain Virtual Texture Tiles\")")
+    int32 TerrainVirtualTextureTiles = 0;
+
     /// <summary>
     /// Anti Aliasing quality setting.
     /// </summary>
@@ -128,6 +200,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(2130), Limit(256, 8192), EditorDisplay(\"Global Illumination\")")
     int32 GlobalSurfaceAtlasResolution = 2048;
 
+    /// <summary>
+    /// The GPU time budget (in milliseconds) for the Global Illumination updates per frame (surface atlas objects redraws and DDGI probes updates). Updates over the budget are prioritized (eg. nearby and recently changed first) and deferred to the next frames. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2140), Limit(0, 100, 0.1f), EditorDisplay(\"Global Illumination\", \"GI Update Budget\")")
+    float GIUpdateBudget = 0.0f;
+
     /// <summary>
     /// The default Post Process settings. Can be overriden by PostFxVolume on a level locally, per camera or for a whole map.
     /// </summary>
@@ -266,6 +266,12 @@ class Function<ReturnType(Params...)>
     }
 };
 
+template<typename ReturnType, typename... Params>
+struct TIsTriviallyRelocatable<Function<ReturnType(Params...)>>
+{
+    enum { Value = true };
+};
+
 /// <summary>
 /// Delegate object that can be used to bind and call multiply functions. Thread-safe to register/unregister during the call. Execution order of bound functions is not stable.
 /// </summary>
@@ -8,7 +8,10 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Platform/CriticalSection.h"
-#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include "Engine/Serialization/AsyncFileWriteStream.h"
 #include "Engine/Debug/Exceptions/Exceptions.h"
 #if USE_EDITOR
 #include "Engine/Core/Collections/Sorting.h"
@@ -17,6 +20,10 @@
 
 #define LOG_ENABLE_FILE (!PLATFORM_SWITCH)
 #define LOG_ENABLE_WINDOWS_SINGLE_NEW_LINE_CHAR (PLATFORM_WINDOWS && PLATFORM_DESKTOP && (USE_EDITOR || !BUILD_RELEASE))
+// Capacity of the queue with log messages to process by the log writer thread (power of two)
+#define LOG_QUEUE_SIZE 1024
+// Max length of the log message (in characters) stored inside the queue, longer messages are allocated on a heap
+#define LOG_MESSAGE_INLINE_LENGTH 120
 
 namespace
 {
@@ -26,14 +33,175 @@ namespace
 #endif
     int LogTotalErrorsCnt = 0;
     int32 LogTotalWriteSize = 0;
-    FileWriteStream* LogFile = nullptr;
+    AsyncFileWriteStream* LogFile = nullptr;
     CriticalSection LogLocker;
     DateTime LogStartTime;
+
+    // Log message inside the queue. Callers only copy the message into the free slot and the writer thread does the formatting and outputs it to the sinks.
+    struct LogMessage
+    {
+        volatile int64 Sequence;
+        int64 Ticks;
+        LogType Type; // 0 for raw messages (without a type and events)
+        int32 Length;
+        Char* Heap;
+        Char Inline[LOG_MESSAGE_INLINE_LENGTH];
+    };
+
+    // Bounded lock-free multiple-producer single-consumer queue (based on Dmitry Vyukov's bounded queue)
+    LogMessage LogQueue[LOG_QUEUE_SIZE];
+    volatile int64 LogEnqueuePos = 0;
+    volatile int64 LogDequeuePos = 0;
+    volatile int64 LogDroppedCount = 0;
+    volatile int64 LogWriterSleeping = 0;
+    volatile int64 LogWriterExit = 0;
+    Thread* LogWriterThread = nullptr;
+    CriticalSection LogWriterLocker;
+    ConditionVariable LogWriterSignal;
+
+    FORCE_INLINE bool IsSinkEnabled(int32 mask, LogType type)
+    {
+        // Raw messages (without a type) go to all sinks
+        return type == (LogType)0 || ((int32)type & (mask | (int32)LogType::Fatal)) != 0;
+    }
+
+    FORCE_INLINE bool IsLogWriterThread()
+    {
+        return LogWriterThread && Platform::GetCurrentThreadID() == LogWriterThread->GetID();
+    }
+
+    void WakeLogWriter()
+    {
+        if (Platform::AtomicRead(&LogWriterSleeping))
+        {
+            LogWriterLocker.Lock();
+            LogWriterSignal.NotifyOne();
+            LogWriterLocker.Unlock();
+        }
+    }
+
+    bool EnqueueLogMessage(LogType type, const StringView& msg)
+    {
+        // Claim the free slot
+        LogMessage* slot;
+        int64 pos = Platform::AtomicRead(&LogEnqueuePos);
+        while (true)
+        {
+            slot = &LogQueue[pos & (LOG_QUEUE_SIZE - 1)];
+            const int64 diff = Platform::AtomicRead(&slot->Sequence) - pos;
+            if (diff == 0)
+            {
+                const int64 prev = Platform::InterlockedCompareExchange(&LogEnqueuePos, pos + 1, pos);
+                if (prev == pos)
+                    break;
+                pos = prev;
+            }
+            else if (diff < 0)
+            {
+                // Queue is full
+                return false;
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&LogEnqueuePos);
+            }
+        }
+
+        // Copy message
+        slot->Ticks = DateTime::Now().Ticks;
+        slot->Type = type;
+        slot->Length = msg.Length();
+        Char* data = slot->Inline;
+        if (msg.Length() > LOG_MESSAGE_INLINE_LENGTH)
+            data = slot->Heap = (Char*)Allocator::Allocate(msg.Length() * sizeof(Char));
+        Platform::MemoryCopy(data, msg.Get(), msg.Length() * sizeof(Char));
+        Platform::AtomicStore(&slot->Sequence, pos + 1);
+        WakeLogWriter();
+        return true;
+    }
+
+    bool PushLogMessage(LogType type, const StringView& msg)
+    {
+        if (EnqueueLogMessage(type, msg))
+            return true;
+
+        // Drop policy: info and warning messages are discarded when queue is full, errors wait for the free space
+        if ((type == LogType::Info || type == LogType::Warning) || IsLogWriterThread())
+        {
+            Platform::InterlockedIncrement(&LogDroppedCount);
+            return true;
+        }
+        do
+        {
+            WakeLogWriter();
+            Platform::Sleep(0);
+        } while (!EnqueueLogMessage(type, msg));
+        return true;
+    }
+
+    void WriteSinks(LogType type, const StringView& msg)
+    {
+        const auto ptr = msg.Get();
+        const auto length = msg.Length();
+        LogLocker.Lock();
+        if (IsDuringLog)
+        {
+            LogLocker.Unlock();
+            return;
+        }
+        IsDuringLog = true;
+
+        // Send message to standard process output
+        if (CommandLine::Options.Std && IsSinkEnabled(Log::Logger::ConsoleTypesMask, type))
+        {
+#if PLATFORM_TEXT_IS_CHAR16
+            StringAnsi ansi(msg);
+            ansi += PLATFORM_LINE_TERMINATOR;
+            printf("%s", ansi.Get());
+#else
+            std::wcout.write(ptr, length);
+#if LOG_ENABLE_WINDOWS_SINGLE_NEW_LINE_CHAR
+            if (IsWindowsSingleNewLineChar)
+                std::wcout.write(TEXT("\n"), 1); // Github Actions show logs with duplicated new-line characters so skip \r
+            else
+#endif
+            std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+#endif
+        }
+
+        // Send message to platform logging
+        if (IsSinkEnabled(Log::Logger::ConsoleTypesMask, type))
+            Platform::Log(msg);
+
+        // Write message to log file
+        constexpr int32 LogMaxWriteSize = 1 * 1024 * 1024; // 1GB
+        if (LogAfterInit && LogTotalWriteSize < LogMaxWriteSize && IsSinkEnabled(Log::Logger::FileTypesMask, type))
+        {
+            LogTotalWriteSize += length;
+            LogFile->WriteBytes(ptr, length * sizeof(Char));
+            LogFile->WriteBytes(TEXT(PLATFORM_LINE_TERMINATOR), (ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1) * sizeof(Char));
+            if (LogTotalWriteSize >= LogMaxWriteSize)
+            {
+                StringView endMessage(TEXT("Trimming log file.\n\n"));
+                LogFile->WriteBytes(endMessage.Get(), endMessage.Length() * sizeof(Char));
+            }
+#if LOG_ENABLE_AUTO_FLUSH
+            LogFile->Flush();
+#endif
+        }
+
+        IsDuringLog = false;
+        LogLocker.Unlock();
+    }
 }
 
 String Log::Logger::LogFilePath;
 Delegate<LogType, const StringView&> Log::Logger::OnMessage;
 Delegate<LogType, const StringView&> Log::Logger::OnError;
+int32 Log::Logger::TypesMask = (int32)LogType::Info | (int32)LogType::Warning | (int32)LogType::Error | (int32)LogType::Fatal;
+int32 Log::Logger::FileTypesMask = (int32)LogType::Info | (int32)LogType::Warning | (int32)LogType::Error | (int32)LogType::Fatal;
+int32 Log::Logger::ConsoleTypesMask = (int32)LogType::Info | (int32)LogType::Warning | (int32)LogType::Error | (int32)LogType::Fatal;
+int32 Log::Logger::EventsTypesMask = (int32)LogType::Info | (int32)LogType::Warning | (int32)LogType::Error | (int32)LogType::Fatal;
 
 bool Log::Logger::Init()
 {
@@ -84,7 +252,7 @@ bool Log::Logger::Init()
     LogFilePath = logsDirectory / filename;
 
     // Open file
-    LogFile = FileWriteStream::Open(LogFilePath);
+    LogFile = AsyncFileWriteStream::Open(LogFilePath);
     if (LogFile == nullptr)
     {
         return true;
@@ -110,64 +278,69 @@ bool Log::Logger::Init()
 #endif
     WriteFloor();
 
+    // Start the writer thread to process log messages in the background
+    for (int32 i = 0; i < LOG_QUEUE_SIZE; i++)
+        LogQueue[i].Sequence = i;
+    LogEnqueuePos = LogDequeuePos = LogWriterExit = 0;
+    Function<int32()> f = &WriterMain;
+    LogWriterThread = ThreadSpawner::Start(f, TEXT("Log Writer"));
+
     return false;
 }
 
-void Log::Logger::Write(const StringView& msg)
+int32 Log::Logger::WriterMain()
 {
-    const auto ptr = msg.Get();
-    const auto length = msg.Length();
-    if (length <= 0)
-        return;
-
-    LogLocker.Lock();
-    if (IsDuringLog)
+    while (true)
     {
-        LogLocker.Unlock();
-        return;
-    }
-    IsDuringLog = true;
-
-    // Send message to standard process output
-    if (CommandLine::Options.Std)
-    {
-#if PLATFORM_TEXT_IS_CHAR16
-        StringAnsi ansi(msg);
-        ansi += PLATFORM_LINE_TERMINATOR;
-        printf("%s", ansi.Get());
-#else
-        std::wcout.write(ptr, length);
-#if LOG_ENABLE_WINDOWS_SINGLE_NEW_LINE_CHAR
-        if (IsWindowsSingleNewLineChar)
-            std::wcout.write(TEXT("\n"), 1); // Github Actions show logs with duplicated new-line characters so skip \r
-        else
-#endif
-        std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
-#endif
-    }
-
-    // Send message to platform logging
-    Platform::Log(msg);
+        // Process queued messages
+        int64 pos = LogDequeuePos;
+        LogMessage* slot = &LogQueue[pos & (LOG_QUEUE_SIZE - 1)];
+        if (Platform::AtomicRead(&slot->Sequence) == pos + 1)
+        {
+            const StringView msg(slot->Heap ? slot->Heap : slot->Inline, slot->Length);
+            if (slot->Type == (LogType)0)
+                WriteSinks(slot->Type, msg);
+            else
+                ProcessMessage(slot->Type, DateTime(slot->Ticks), msg);
+            if (slot->Heap)
+            {
+                Allocator::Free(slot->Heap);
+                slot->Heap = nullptr;
+            }
+            Platform::AtomicStore(&slot->Sequence, pos + LOG_QUEUE_SIZE);
+            Platform::AtomicStore(&LogDequeuePos, pos + 1);
+            continue;
+        }
 
-    // Write message to log file
-    constexpr int32 LogMaxWriteSize = 1 * 1024 * 1024; // 1GB
-    if (LogAfterInit && LogTotalWriteSize < LogMaxWriteSize)
-    {
-        LogTotalWriteSize += length;
-        LogFile->WriteBytes(ptr, length * sizeof(Char));
-        LogFile->WriteBytes(TEXT(PLATFORM_LINE_TERMINATOR), (ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1) * sizeof(Char));
-        if (LogTotalWriteSize >= LogMaxWriteSize)
+        // Report dropped messages once the queue gets emptied
+        const int64 dropped = Platform::InterlockedExchange(&LogDroppedCount, 0);
+        if (dropped != 0)
         {
-            StringView endMessage(TEXT("Trimming log file.\n\n"));
-            LogFile->WriteBytes(endMessage.Get(), endMessage.Length() * sizeof(Char));
+            ProcessMessage(LogType::Warning, DateTime::Now(), String::Format(TEXT("Dropped {0} log messages (log queue was full)."), dropped));
+            continue;
         }
-#if LOG_ENABLE_AUTO_FLUSH
-        LogFile->Flush();
-#endif
+        if (Platform::AtomicRead(&LogWriterExit))
+            break;
+
+        // Wait for more messages
+        LogWriterLocker.Lock();
+        Platform::AtomicStore(&LogWriterSleeping, 1);
+        if (Platform::AtomicRead(&LogQueue[LogDequeuePos & (LOG_QUEUE_SIZE - 1)].Sequence) != LogDequeuePos + 1 && !Platform::AtomicRead(&LogWriterExit))
+            LogWriterSignal.Wait(LogWriterLocker, 100);
+        Platform::AtomicStore(&LogWriterSleeping, 0);
+        LogWriterLocker.Unlock();
     }
+    return 0;
+}
 
-    IsDuringLog = false;
-    LogLocker.Unlock();
+void Log::Logger::Write(const StringView& msg)
+{
+    if (msg.Length() <= 0)
+        return;
+    if (LogWriterThread)
+        PushLogMessage((LogType)0, msg);
+    else
+        WriteSinks((LogType)0, msg);
 }
 
 void Log::Logger::Write(const Exception& exception)
@@ -177,23 +350,41 @@ void Log::Logger::Write(const Exception& exception)
 
 void Log::Logger::Dispose()
 {
-    LogLocker.Lock();
-
     // Write ending info
     WriteFloor();
     Write(String::Format(TEXT(" Total errors: {0}\n Closing file"), LogTotalErrorsCnt, DateTime::Now().ToString()));
     WriteFloor();
 
-    // Close
+    // Stop the writer thread (processes all remaining messages before exit)
+    if (LogWriterThread)
+    {
+        Platform::AtomicStore(&LogWriterExit, 1);
+        LogWriterLocker.Lock();
+        LogWriterSignal.NotifyOne();
+        LogWriterLocker.Unlock();
+        LogWriterThread->Join();
+        Delete(LogWriterThread);
+        LogWriterThread = nullptr;
+    }
+
+    LogLocker.Lock();
+
+    // Close (outside the lock because the file writer thread logs on exit)
+    AsyncFileWriteStream* logFile = nullptr;
     if (LogAfterInit)
     {
         LogAfterInit = false;
-        LogFile->Close();
-        Delete(LogFile);
+        logFile = LogFile;
         LogFile = nullptr;
     }
 
     LogLocker.Unlock();
+
+    if (logFile)
+    {
+        logFile->Close();
+        Delete(logFile);
+    }
 }
 
 bool Log::Logger::IsLogEnabled()
@@ -207,21 +398,37 @@ bool Log::Logger::IsLogEnabled()
 
 void Log::Logger::Flush()
 {
+    // Wait for the queued messages to be processed
+    if (LogWriterThread && !IsLogWriterThread())
+    {
+        const int64 pos = Platform::AtomicRead(&LogEnqueuePos);
+        while (Platform::AtomicRead(&LogDequeuePos) < pos && !Platform::AtomicRead(&LogWriterExit))
+        {
+            WakeLogWriter();
+            Platform::Sleep(0);
+        }
+    }
+
     LogLocker.Lock();
     if (LogFile)
-        LogFile->Flush();
+        LogFile->Wait();
     LogLocker.Unlock();
 }
 
+int64 Log::Logger::GetDroppedCount()
+{
+    return Platform::AtomicRead(&LogDroppedCount);
+}
+
 void Log::Logger::WriteFloor()
 {
     Write(TEXT("================================================================"));
 }
 
-void Log::Logger::ProcessLogMessage(LogType type, const StringView& msg, fmt_flax::memory_buffer& w)
+void Log::Logger::ProcessLogMessage(LogType type, const DateTime& time, const StringView& msg, fmt_flax::memory_buffer& w)
 {
-    const TimeSpan time = DateTime::Now() - LogStartTime;
-    fmt_flax::format(w, TEXT("[ {0} ]: [{1}] "), *time.ToString('a'), ToString(type));
+    const TimeSpan timeSinceStart = time - LogStartTime;
+    fmt_flax::format(w, TEXT("[ {0} ]: [{1}] "), *timeSinceStart.ToString('a'), ToString(type));
 
     // On Windows convert all '\n' into '\r\n'
 #if PLATFORM_WINDOWS
@@ -252,21 +459,20 @@ void Log::Logger::ProcessLogMessage(LogType type, const StringView& msg, fmt_fla
     //fmt_flax::format(w, TEXT("{}"), msg);
 }
 
-void Log::Logger::Write(LogType type, const StringView& msg)
+void Log::Logger::ProcessMessage(LogType type, const DateTime& time, const StringView& msg)
 {
-    if (msg.Length() <= 0)
-        return;
     const bool isError = IsError(type);
 
     // Create message for the log file
     fmt_flax::memory_buffer w;
-    ProcessLogMessage(type, msg, w);
+    ProcessLogMessage(type, time, msg, w);
 
     // Log formatted message
-    Write(StringView(w.data(), (int32)w.size()));
+    WriteSinks(type, StringView(w.data(), (int32)w.size()));
 
     // Fire events
-    OnMessage(type, msg);
+    if (IsSinkEnabled(EventsTypesMask, type))
+        OnMessage(type, msg);
     if (isError)
     {
         LogTotalErrorsCnt++;
@@ -274,12 +480,34 @@ void Log::Logger::Write(LogType type, const StringView& msg)
     }
 
     // Ensure the error gets written to the disk
-    if (type == LogType::Fatal || type == LogType::Error)
-        Flush();
+    if (isError)
+    {
+        LogLocker.Lock();
+        if (LogFile)
+            LogFile->Flush();
+        LogLocker.Unlock();
+    }
+}
+
+void Log::Logger::Write(LogType type, const StringView& msg)
+{
+    if (msg.Length() <= 0 || !IsEnabled(type))
+        return;
+
+    // Pass message to the writer thread (if running) or process it on the calling thread
+    if (LogWriterThread)
+        PushLogMessage(type, msg);
+    else
+        ProcessMessage(type, DateTime::Now(), msg);
 
-    // Check if need to show message box with that log message
     if (type == LogType::Fatal)
+    {
+        // Ensure the error gets written to the disk
+        Flush();
+
+        // Show message box with that log message
         Platform::Fatal(msg);
+    }
 }
 
 const Char* ToString(LogType e)
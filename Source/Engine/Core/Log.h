@@ -7,13 +7,15 @@
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
 
+struct DateTime;
+
 // Enable/disable auto flush function
 #define LOG_ENABLE_AUTO_FLUSH 1
 
 /// <summary>
-/// Sends a formatted message to the log file (message type - describes level of the log (see LogType enum))
+/// Sends a formatted message to the log file (message type - describes level of the log (see LogType enum)). Format string is validated at compile-time against the provided arguments.
 /// </summary>
-#define LOG(messageType, format, ...) Log::Logger::Write(LogType::messageType, ::String::Format(TEXT(format), ##__VA_ARGS__))
+#define LOG(messageType, format, ...) Log::Logger::WriteFormat<Log::GetFormatArgsCount(TEXT(format))>(LogType::messageType, TEXT(format), ##__VA_ARGS__)
 
 /// <summary>
 /// Sends a string message to the log file (message type - describes level of the log (see LogType enum))
@@ -59,6 +61,43 @@ namespace Log
 {
     class Exception;
 
+    /// <summary>
+    /// Gets the amount of arguments required by the format string (eg. 2 for "{0} and {1}" or "{} and {}"). Used to validate log messages at compile-time.
+    /// </summary>
+    /// <param name="format">The format string.</param>
+    /// <returns>The required arguments count.</returns>
+    constexpr int32 GetFormatArgsCount(const Char* format)
+    {
+        int32 result = 0, autoIndex = 0;
+        for (; *format; format++)
+        {
+            if (*format != '{')
+                continue;
+            format++;
+            if (*format == '{')
+                continue; // Escaped brace
+            if (*format >= '0' && *format <= '9')
+            {
+                // Explicit argument index
+                int32 index = 0;
+                for (; *format >= '0' && *format <= '9'; format++)
+                    index = index * 10 + (*format - '0');
+                result = index + 1 > result ? index + 1 : result;
+            }
+            else
+            {
+                // Automatic argument index
+                autoIndex++;
+                result = autoIndex > result ? autoIndex : result;
+            }
+            while (*format && *format != '}')
+                format++;
+            if (!*format)
+                break;
+        }
+        return result;
+    }
+
     /// <summary>
     /// Singleton logger class
     /// </summary>
@@ -82,6 +121,26 @@ namespace Log
         /// </summary>
         static Delegate<LogType, const StringView&> OnError;
 
+        /// <summary>
+        /// The mask of the enabled log message types (see LogType). Messages of disabled types are discarded without formatting them. Fatal errors are always logged.
+        /// </summary>
+        static int32 TypesMask;
+
+        /// <summary>
+        /// The mask of the log message types written to the log file (see LogType).
+        /// </summary>
+        static int32 FileTypesMask;
+
+        /// <summary>
+        /// The mask of the log message types written to the standard output and the platform log (see LogType).
+        /// </summary>
+        static int32 ConsoleTypesMask;
+
+        /// <summary>
+        /// The mask of the log message types for which OnMessage event is fired (see LogType).
+        /// </summary>
+        static int32 EventsTypesMask;
+
     public:
 
         /// <summary>
@@ -102,6 +161,14 @@ namespace Log
             return type == LogType::Fatal || type == LogType::Error;
         }
 
+        /// <summary>
+        /// Checks if the messages of the given type are processed by the logger.
+        /// </summary>
+        FORCE_INLINE static bool IsEnabled(const LogType type)
+        {
+            return ((int32)type & (TypesMask | (int32)LogType::Fatal)) != 0;
+        }
+
     public:
 
         /// <summary>
@@ -111,10 +178,15 @@ namespace Log
         static bool IsLogEnabled();
 
         /// <summary>
-        /// Flushes log file with a memory buffer.
+        /// Waits for the queued log messages to be processed and flushes log file with a memory buffer.
         /// </summary>
         static void Flush();
 
+        /// <summary>
+        /// Gets the amount of log messages dropped because the log messages queue was full.
+        /// </summary>
+        static int64 GetDroppedCount();
+
         /// <summary>
         /// Writes a series of '=' chars to the log to end a section.
         /// </summary>
@@ -140,7 +212,22 @@ namespace Log
         template<typename... Args>
         FORCE_INLINE static void Write(LogType type, const Char* format, const Args& ... args)
         {
-            Write(type, String::Format(format, args...));
+            if (IsEnabled(type))
+                WriteFormatted(type, format, args...);
+        }
+
+        /// <summary>
+        /// Writes a formatted message to the log file. Validates the amount of arguments at compile-time (used by LOG macro).
+        /// </summary>
+        /// <param name="type">The message type.</param>
+        /// <param name="format">The message format string.</param>
+        /// <param name="args">The format arguments.</param>
+        template<int32 FormatArgsCount, typename... Args>
+        FORCE_INLINE static void WriteFormat(LogType type, const Char* format, const Args& ... args)
+        {
+            static_assert(FormatArgsCount <= sizeof...(Args), "Log message format uses more arguments than provided.");
+            if (IsEnabled(type))
+                WriteFormatted(type, format, args...);
         }
 
         /// <summary>
@@ -182,6 +269,18 @@ namespace Log
 
     private:
 
-        static void ProcessLogMessage(LogType type, const StringView& msg, fmt_flax::memory_buffer& w);
+        template<typename... Args>
+        static void WriteFormatted(LogType type, const Char* format, const Args& ... args)
+        {
+            // Format message into the stack buffer (uses heap only for very long messages)
+            fmt_flax::allocator allocator;
+            fmt_flax::memory_buffer buffer(allocator);
+            fmt_flax::format(buffer, format, args...);
+            Write(type, StringView(buffer.data(), (int32)buffer.size()));
+        }
+
+        static void ProcessLogMessage(LogType type, const DateTime& time, const StringView& msg, fmt_flax::memory_buffer& w);
+        static void ProcessMessage(LogType type, const DateTime& time, const StringView& msg);
+        static int32 WriterMain();
     };
 }
@@ -4,6 +4,7 @@
 #include "BoundingBox.h"
 #include "BoundingSphere.h"
 #include "../Types/String.h"
+#include "../SIMD.h"
 
 String BoundingFrustum::ToString() const
 {
@@ -189,3 +190,82 @@ bool BoundingFrustum::Intersects(const BoundingSphere& sphere) const
     }
     return true;
 }
+
+void BoundingFrustum::Intersects(const float* centerX, const float* centerY, const float* centerZ, const float* radius, int32 count, uint32* visibility) const
+{
+    for (int32 i = 0; i < (count + 31) / 32; i++)
+        visibility[i] = 0;
+    SimdVector4 planeX[6], planeY[6], planeZ[6], planeD[6];
+    for (int32 p = 0; p < 6; p++)
+    {
+        planeX[p] = SIMD::Splat((float)_planes[p].Normal.X);
+        planeY[p] = SIMD::Splat((float)_planes[p].Normal.Y);
+        planeZ[p] = SIMD::Splat((float)_planes[p].Normal.Z);
+        planeD[p] = SIMD::Splat((float)_planes[p].D);
+    }
+
+    // Test 4 spheres at once (the smallest signed distance to the planes is negative if sphere lays behind any of them)
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const SimdVector4 x = SIMD::LoadUnaligned(centerX + i);
+        const SimdVector4 y = SIMD::LoadUnaligned(centerY + i);
+        const SimdVector4 z = SIMD::LoadUnaligned(centerZ + i);
+        const SimdVector4 r = SIMD::LoadUnaligned(radius + i);
+        SimdVector4 distance = SIMD::MulAdd(planeX[0], x, SIMD::MulAdd(planeY[0], y, SIMD::MulAdd(planeZ[0], z, SIMD::Add(planeD[0], r))));
+        for (int32 p = 1; p < 6; p++)
+            distance = SIMD::Min(distance, SIMD::MulAdd(planeX[p], x, SIMD::MulAdd(planeY[p], y, SIMD::MulAdd(planeZ[p], z, SIMD::Add(planeD[p], r)))));
+        const uint32 culled = (uint32)SIMD::MoveMask(distance);
+        visibility[i >> 5] |= (~culled & 0xf) << (i & 31);
+    }
+    for (; i < count; i++)
+    {
+        bool visible = true;
+        for (int32 p = 0; p < 6 && visible; p++)
+            visible = (float)_planes[p].Normal.X * centerX[i] + (float)_planes[p].Normal.Y * centerY[i] + (float)_planes[p].Normal.Z * centerZ[i] + (float)_planes[p].D >= -radius[i];
+        if (visible)
+            visibility[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+void BoundingFrustum::Intersects(const float* minX, const float* minY, const float* minZ, const float* maxX, const float* maxY, const float* maxZ, int32 count, uint32* visibility) const
+{
+    for (int32 i = 0; i < (count + 31) / 32; i++)
+        visibility[i] = 0;
+
+    // Pick the box corner that is the most in front of each plane (positive vertex)
+    SimdVector4 planeX[6], planeY[6], planeZ[6], planeD[6];
+    const float* cornerX[6];
+    const float* cornerY[6];
+    const float* cornerZ[6];
+    for (int32 p = 0; p < 6; p++)
+    {
+        const Plane& plane = _planes[p];
+        planeX[p] = SIMD::Splat((float)plane.Normal.X);
+        planeY[p] = SIMD::Splat((float)plane.Normal.Y);
+        planeZ[p] = SIMD::Splat((float)plane.Normal.Z);
+        planeD[p] = SIMD::Splat((float)(plane.D - Plane::DistanceEpsilon));
+        cornerX[p] = plane.Normal.X >= 0 ? maxX : minX;
+        cornerY[p] = plane.Normal.Y >= 0 ? maxY : minY;
+        cornerZ[p] = plane.Normal.Z >= 0 ? maxZ : minZ;
+    }
+
+    // Test 4 boxes at once (the smallest signed distance of the positive vertex to the planes is negative if box lays behind any of them)
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        SimdVector4 distance = SIMD::MulAdd(planeX[0], SIMD::LoadUnaligned(cornerX[0] + i), SIMD::MulAdd(planeY[0], SIMD::LoadUnaligned(cornerY[0] + i), SIMD::MulAdd(planeZ[0], SIMD::LoadUnaligned(cornerZ[0] + i), planeD[0])));
+        for (int32 p = 1; p < 6; p++)
+            distance = SIMD::Min(distance, SIMD::MulAdd(planeX[p], SIMD::LoadUnaligned(cornerX[p] + i), SIMD::MulAdd(planeY[p], SIMD::LoadUnaligned(cornerY[p] + i), SIMD::MulAdd(planeZ[p], SIMD::LoadUnaligned(cornerZ[p] + i), planeD[p]))));
+        const uint32 culled = (uint32)SIMD::MoveMask(distance);
+        visibility[i >> 5] |= (~culled & 0xf) << (i & 31);
+    }
+    for (; i < count; i++)
+    {
+        bool visible = true;
+        for (int32 p = 0; p < 6 && visible; p++)
+            visible = (float)_planes[p].Normal.X * cornerX[p][i] + (float)_planes[p].Normal.Y * cornerY[p][i] + (float)_planes[p].Normal.Z * cornerZ[p][i] + (float)(_planes[p].D - Plane::DistanceEpsilon) >= 0.0f;
+        if (visible)
+            visibility[i >> 5] |= 1u << (i & 31);
+    }
+}
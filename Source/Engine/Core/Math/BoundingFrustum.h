@@ -245,6 +245,30 @@ API_STRUCT(InBuild) struct FLAXENGINE_API BoundingFrustum
     {
         return CollisionsHelper::FrustumContainsBox(*this, box) != ContainmentType::Disjoint;
     }
+
+    /// <summary>
+    /// Checks whether the current BoundingFrustum intersects a batch of bounding spheres. Spheres are provided in SoA layout (separate array for each component) which allows to test multiple spheres at once with SIMD.
+    /// </summary>
+    /// <param name="centerX">The array with X components of the spheres centers.</param>
+    /// <param name="centerY">The array with Y components of the spheres centers.</param>
+    /// <param name="centerZ">The array with Z components of the spheres centers.</param>
+    /// <param name="radius">The array with the spheres radii.</param>
+    /// <param name="count">The amount of spheres to test.</param>
+    /// <param name="visibility">The output visibility bitmask (bit is set for each sphere that intersects the frustum). Needs to have at least (count + 31) / 32 elements.</param>
+    void Intersects(const float* centerX, const float* centerY, const float* centerZ, const float* radius, int32 count, uint32* visibility) const;
+
+    /// <summary>
+    /// Checks whether the current BoundingFrustum intersects a batch of bounding boxes. Boxes are provided in SoA layout (separate array for each component) which allows to test multiple boxes at once with SIMD.
+    /// </summary>
+    /// <param name="minX">The array with X components of the boxes minimum points.</param>
+    /// <param name="minY">The array with Y components of the boxes minimum points.</param>
+    /// <param name="minZ">The array with Z components of the boxes minimum points.</param>
+    /// <param name="maxX">The array with X components of the boxes maximum points.</param>
+    /// <param name="maxY">The array with Y components of the boxes maximum points.</param>
+    /// <param name="maxZ">The array with Z components of the boxes maximum points.</param>
+    /// <param name="count">The amount of boxes to test.</param>
+    /// <param name="visibility">The output visibility bitmask (bit is set for each box that intersects the frustum). Needs to have at least (count + 31) / 32 elements.</param>
+    void Intersects(const float* minX, const float* minY, const float* minZ, const float* maxX, const float* maxY, const float* maxZ, int32 count, uint32* visibility) const;
 };
 
 template<>
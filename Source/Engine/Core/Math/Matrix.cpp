@@ -7,6 +7,7 @@
 #include "Quaternion.h"
 #include "Transform.h"
 #include "../Types/String.h"
+#include "../SIMD.h"
 
 static_assert(sizeof(Matrix) == 4 * 4 * 4, "Invalid Matrix type size.");
 
@@ -224,6 +225,22 @@ void Matrix::Multiply(const Matrix& left, float right, Matrix& result)
 
 void Matrix::Multiply(const Matrix& left, const Matrix& right, Matrix& result)
 {
+#if USE_SIMD_MATH
+    // Load all rows of the right matrix first (result can alias with any of the inputs)
+    const SimdVector4 r1 = SIMD::LoadUnaligned(&right.M11);
+    const SimdVector4 r2 = SIMD::LoadUnaligned(&right.M21);
+    const SimdVector4 r3 = SIMD::LoadUnaligned(&right.M31);
+    const SimdVector4 r4 = SIMD::LoadUnaligned(&right.M41);
+    for (int32 row = 0; row < 4; row++)
+    {
+        const float* l = left.Raw + row * 4;
+        SimdVector4 v = SIMD::Mul(SIMD::Splat(l[0]), r1);
+        v = SIMD::MulAdd(SIMD::Splat(l[1]), r2, v);
+        v = SIMD::MulAdd(SIMD::Splat(l[2]), r3, v);
+        v = SIMD::MulAdd(SIMD::Splat(l[3]), r4, v);
+        SIMD::StoreUnaligned(result.Raw + row * 4, v);
+    }
+#else
     result.M11 = left.M11 * right.M11 + left.M12 * right.M21 + left.M13 * right.M31 + left.M14 * right.M41;
     result.M12 = left.M11 * right.M12 + left.M12 * right.M22 + left.M13 * right.M32 + left.M14 * right.M42;
     result.M13 = left.M11 * right.M13 + left.M12 * right.M23 + left.M13 * right.M33 + left.M14 * right.M43;
@@ -240,6 +257,7 @@ void Matrix::Multiply(const Matrix& left, const Matrix& right, Matrix& result)
     result.M42 = left.M41 * right.M12 + left.M42 * right.M22 + left.M43 * right.M32 + left.M44 * right.M42;
     result.M43 = left.M41 * right.M13 + left.M42 * right.M23 + left.M43 * right.M33 + left.M44 * right.M43;
     result.M44 = left.M41 * right.M14 + left.M42 * right.M24 + left.M43 * right.M34 + left.M44 * right.M44;
+#endif
 }
 
 void Matrix::Divide(const Matrix& left, float right, Matrix& result)
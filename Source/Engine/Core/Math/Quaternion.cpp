@@ -8,6 +8,28 @@
 #include "Math.h"
 #include "../Types/String.h"
 #include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/SIMD.h"
+
+#if USE_SIMD_MATH
+
+namespace
+{
+    FORCE_INLINE void MultiplySimd(const Quaternion& left, const Quaternion& right, Quaternion& result)
+    {
+        // result = left.W * right + left.X * (rW, -rZ, rY, -rX) + left.Y * (rZ, rW, -rX, -rY) + left.Z * (-rY, rX, rW, -rZ)
+        const SimdVector4 r = SIMD::LoadUnaligned(&right.X);
+        const SimdVector4 rx = SIMD::Mul(SIMD::Shuffle<3, 2, 1, 0>(r), SIMD::Load(1.0f, -1.0f, 1.0f, -1.0f));
+        const SimdVector4 ry = SIMD::Mul(SIMD::Shuffle<2, 3, 0, 1>(r), SIMD::Load(1.0f, 1.0f, -1.0f, -1.0f));
+        const SimdVector4 rz = SIMD::Mul(SIMD::Shuffle<1, 0, 3, 2>(r), SIMD::Load(-1.0f, 1.0f, 1.0f, -1.0f));
+        SimdVector4 v = SIMD::Mul(SIMD::Splat(left.W), r);
+        v = SIMD::MulAdd(SIMD::Splat(left.X), rx, v);
+        v = SIMD::MulAdd(SIMD::Splat(left.Y), ry, v);
+        v = SIMD::MulAdd(SIMD::Splat(left.Z), rz, v);
+        SIMD::StoreUnaligned(&result.X, v);
+    }
+}
+
+#endif
 
 Quaternion Quaternion::Zero(0, 0, 0, 0);
 Quaternion Quaternion::One(1, 1, 1, 1);
@@ -85,6 +107,9 @@ Float3 Quaternion::GetEuler() const
 
 void Quaternion::Multiply(const Quaternion& other)
 {
+#if USE_SIMD_MATH
+    MultiplySimd(*this, other, *this);
+#else
     const float a = Y * other.Z - Z * other.Y;
     const float b = Z * other.X - X * other.Z;
     const float c = X * other.Y - Y * other.X;
@@ -93,6 +118,7 @@ void Quaternion::Multiply(const Quaternion& other)
     Y = Y * other.W + other.Y * W + b;
     Z = Z * other.W + other.Z * W + c;
     W = W * other.W - d;
+#endif
 }
 
 Float3 Quaternion::operator*(const Float3& vector) const
@@ -118,6 +144,9 @@ void Quaternion::Subtract(const Quaternion& left, const Quaternion& right, Quate
 
 void Quaternion::Multiply(const Quaternion& left, const Quaternion& right, Quaternion& result)
 {
+#if USE_SIMD_MATH
+    MultiplySimd(left, right, result);
+#else
     const float a = left.Y * right.Z - left.Z * right.Y;
     const float b = left.Z * right.X - left.X * right.Z;
     const float c = left.X * right.Y - left.Y * right.X;
@@ -126,6 +155,7 @@ void Quaternion::Multiply(const Quaternion& left, const Quaternion& right, Quate
     result.Y = left.Y * right.W + right.Y * left.W + b;
     result.Z = left.Z * right.W + right.Z * left.W + c;
     result.W = left.W * right.W - d;
+#endif
 }
 
 void Quaternion::Negate(const Quaternion& value, Quaternion& result)
@@ -9,11 +9,27 @@
 #include "Matrix3x3.h"
 #include "Transform.h"
 #include "../Types/String.h"
+#include "../SIMD.h"
 
 // Float
 
 static_assert(sizeof(Float3) == 12, "Invalid Float3 type size.");
 
+#if USE_SIMD_MATH
+
+namespace
+{
+    FORCE_INLINE SimdVector4 TransformSimd(const Float3& vector, const Matrix& transform)
+    {
+        SimdVector4 v = SIMD::MulAdd(SIMD::Splat(vector.X), SIMD::LoadUnaligned(&transform.M11), SIMD::LoadUnaligned(&transform.M41));
+        v = SIMD::MulAdd(SIMD::Splat(vector.Y), SIMD::LoadUnaligned(&transform.M21), v);
+        v = SIMD::MulAdd(SIMD::Splat(vector.Z), SIMD::LoadUnaligned(&transform.M31), v);
+        return v;
+    }
+}
+
+#endif
+
 template<>
 const Float3 Float3::Zero(0.0f);
 template<>
@@ -181,11 +197,15 @@ Float3 Float3::Transform(const Float3& vector, const Quaternion& rotation)
 template<>
 void Float3::Transform(const Float3& vector, const Matrix& transform, Float4& result)
 {
+#if USE_SIMD_MATH
+    SIMD::StoreUnaligned(&result.X, TransformSimd(vector, transform));
+#else
     result = Float4(
         vector.X * transform.M11 + vector.Y * transform.M21 + vector.Z * transform.M31 + transform.M41,
         vector.X * transform.M12 + vector.Y * transform.M22 + vector.Z * transform.M32 + transform.M42,
         vector.X * transform.M13 + vector.Y * transform.M23 + vector.Z * transform.M33 + transform.M43,
         vector.X * transform.M14 + vector.Y * transform.M24 + vector.Z * transform.M34 + transform.M44);
+#endif
 }
 
 template<>
@@ -239,10 +259,15 @@ template<>
 void Float3::TransformCoordinate(const Float3& coordinate, const Matrix& transform, Float3& result)
 {
     Float4 v;
+#if USE_SIMD_MATH
+    SIMD::StoreUnaligned(&v.X, TransformSimd(coordinate, transform));
+    v.W = 1.0f / v.W;
+#else
     v.X = coordinate.X * transform.M11 + coordinate.Y * transform.M21 + coordinate.Z * transform.M31 + transform.M41;
     v.Y = coordinate.X * transform.M12 + coordinate.Y * transform.M22 + coordinate.Z * transform.M32 + transform.M42;
     v.Z = coordinate.X * transform.M13 + coordinate.Y * transform.M23 + coordinate.Z * transform.M33 + transform.M43;
     v.W = 1.0f / (coordinate.X * transform.M14 + coordinate.Y * transform.M24 + coordinate.Z * transform.M34 + transform.M44);
+#endif
     result = Float3(v.X * v.W, v.Y * v.W, v.Z * v.W);
 }
 
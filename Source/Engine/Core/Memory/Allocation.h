@@ -152,8 +152,9 @@ class HeapAllocation
             if (oldCount)
             {
                 if (newCount > 0)
-                    Memory::MoveItems(newData, _data, newCount);
-                Memory::DestructItems(_data, oldCount);
+                    Memory::RelocateItems(newData, _data, newCount);
+                if (oldCount > newCount)
+                    Memory::DestructItems(_data + newCount, oldCount - newCount);
             }
 
             Allocator::Free(_data);
@@ -235,10 +236,10 @@ class InlinedAllocation
                 if (_useOther)
                 {
                     // Move the items from other allocation to the inlined storage
-                    Memory::MoveItems(data, _other.Get(), newCount);
+                    Memory::RelocateItems(data, _other.Get(), newCount);
 
                     // Free the other allocation
-                    Memory::DestructItems(_other.Get(), oldCount);
+                    Memory::DestructItems(_other.Get() + newCount, oldCount - newCount);
                     _other.Free();
                     _useOther = false;
                 }
@@ -257,8 +258,8 @@ class InlinedAllocation
                     _useOther = true;
 
                     // Move the items from the inlined storage to the other allocation
-                    Memory::MoveItems(_other.Get(), data, newCount);
-                    Memory::DestructItems(data, oldCount);
+                    Memory::RelocateItems(_other.Get(), data, newCount);
+                    Memory::DestructItems(data + newCount, oldCount - newCount);
                 }
             }
         }
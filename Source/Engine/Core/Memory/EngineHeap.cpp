@@ -0,0 +1,230 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "EngineHeap.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CriticalSection.h"
+
+namespace
+{
+    struct FreeBlock
+    {
+        uint64 Offset;
+        uint64 Size;
+    };
+
+    CriticalSection Locker;
+    byte* HeapMemory = nullptr;
+    uint64 MemorySize = 0;
+    uint64 UsedSize = 0;
+    uint64 PeakUsedSize = 0;
+    int32 Allocations = 0;
+    bool UseLargePages = false;
+
+    // Free memory blocks sorted by the offset (adjacent blocks are always merged)
+    Array<FreeBlock> FreeBlocks;
+}
+
+class EngineHeapService : public EngineService
+{
+public:
+    EngineHeapService()
+        : EngineService(TEXT("Engine Heap"), -1100)
+    {
+    }
+
+    bool Init() override;
+    void Dispose() override;
+};
+
+EngineHeapService EngineHeapServiceInstance;
+
+bool EngineHeapService::Init()
+{
+    const auto& heapArg = CommandLine::Options.Heap;
+    int32 sizeMB;
+    if (!heapArg.HasValue() || StringUtils::Parse(heapArg.GetValue().Get(), &sizeMB) || sizeMB <= 0)
+        return false;
+    uint64 size = (uint64)sizeMB * 1024 * 1024;
+
+    // Reserve the whole memory region upfront
+    const uint64 largePageSize = CommandLine::Options.LargePages.IsTrue() ? Platform::GetLargePageSize() : 0;
+    if (largePageSize != 0)
+    {
+        size = Math::AlignUp(size, largePageSize);
+        HeapMemory = (byte*)Platform::AllocateLargePages(size);
+    }
+    else
+    {
+        const uint64 pageSize = Platform::GetCPUInfo().PageSize;
+        size = Math::AlignUp(size, Math::Max(pageSize, EngineHeap::BlockSize));
+        HeapMemory = (byte*)Platform::AllocatePages(size / pageSize, pageSize);
+    }
+    if (!HeapMemory)
+    {
+        LOG(Warning, "Failed to reserve engine heap of size {0} MB", size / (1024 * 1024));
+        return false;
+    }
+    MemorySize = size;
+    UseLargePages = largePageSize != 0;
+    FreeBlocks.Add({ 0, size });
+    LOG(Info, "Engine heap reserved {0} MB{1}", size / (1024 * 1024), UseLargePages ? TEXT(" (large pages)") : TEXT(""));
+    if (CommandLine::Options.LargePages.IsTrue() && !UseLargePages)
+        LOG(Warning, "Large pages are not available (on Windows the 'Lock pages in memory' privilege is required)");
+    return false;
+}
+
+void EngineHeapService::Dispose()
+{
+    if (!HeapMemory)
+        return;
+    EngineHeap::Stats stats;
+    EngineHeap::GetStats(stats);
+    LOG(Info, "Engine heap stats: used {0} MB (peak {1} MB) of {2} MB, {3} free blocks, largest free block {4} MB, fragmentation {5}%",
+        stats.UsedSize / (1024 * 1024), stats.PeakUsedSize / (1024 * 1024), stats.ReservedSize / (1024 * 1024),
+        stats.FreeBlocks, stats.LargestFreeBlock / (1024 * 1024), (int32)(stats.GetFragmentation() * 100.0f));
+
+    // Memory pools return pages lazily so keep the heap memory mapped until the process exit if anything is still in use
+    if (stats.Allocations == 0)
+    {
+        if (UseLargePages)
+            Platform::FreeLargePages(HeapMemory, MemorySize);
+        else
+            Platform::FreePages(HeapMemory);
+        HeapMemory = nullptr;
+        MemorySize = 0;
+    }
+}
+
+void* EngineHeapAllocation::Allocate(uintptr size)
+{
+    void* result = size >= EngineHeap::BlockSize ? EngineHeap::Allocate(size) : nullptr;
+    if (!result)
+        result = Platform::Allocate(size, 16);
+    return result;
+}
+
+void EngineHeapAllocation::Free(void* ptr, uintptr size)
+{
+    if (EngineHeap::Contains(ptr))
+        EngineHeap::Free(ptr, size);
+    else
+        Platform::Free(ptr);
+}
+
+bool EngineHeap::IsEnabled()
+{
+    return HeapMemory != nullptr;
+}
+
+void* EngineHeap::Allocate(uint64 size)
+{
+    if (!HeapMemory || size == 0)
+        return nullptr;
+    size = Math::AlignUp(size, BlockSize);
+    ScopeLock lock(Locker);
+
+    // Best-fit to keep the large blocks available for the large allocations
+    int32 bestIndex = -1;
+    for (int32 i = 0; i < FreeBlocks.Count(); i++)
+    {
+        const FreeBlock& block = FreeBlocks[i];
+        if (block.Size >= size && (bestIndex == -1 || block.Size < FreeBlocks[bestIndex].Size))
+        {
+            bestIndex = i;
+            if (block.Size == size)
+                break;
+        }
+    }
+    if (bestIndex == -1)
+        return nullptr;
+    FreeBlock& block = FreeBlocks[bestIndex];
+    byte* result = HeapMemory + block.Offset;
+    if (block.Size == size)
+    {
+        FreeBlocks.RemoveAtKeepOrder(bestIndex);
+    }
+    else
+    {
+        block.Offset += size;
+        block.Size -= size;
+    }
+    UsedSize += size;
+    PeakUsedSize = Math::Max(PeakUsedSize, UsedSize);
+    Allocations++;
+    return result;
+}
+
+void EngineHeap::Free(void* ptr, uint64 size)
+{
+    if (!ptr)
+        return;
+    ASSERT(Contains(ptr));
+    size = Math::AlignUp(size, BlockSize);
+    const uint64 offset = (uint64)((byte*)ptr - HeapMemory);
+    ScopeLock lock(Locker);
+    UsedSize -= size;
+    Allocations--;
+
+    // Find the insert location
+    int32 index = 0;
+    int32 count = FreeBlocks.Count();
+    while (count > 0)
+    {
+        const int32 step = count / 2;
+        if (FreeBlocks[index + step].Offset < offset)
+        {
+            index += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    // Merge with the neighbours
+    const bool mergePrev = index > 0 && FreeBlocks[index - 1].Offset + FreeBlocks[index - 1].Size == offset;
+    const bool mergeNext = index < FreeBlocks.Count() && offset + size == FreeBlocks[index].Offset;
+    if (mergePrev && mergeNext)
+    {
+        FreeBlocks[index - 1].Size += size + FreeBlocks[index].Size;
+        FreeBlocks.RemoveAtKeepOrder(index);
+    }
+    else if (mergePrev)
+    {
+        FreeBlocks[index - 1].Size += size;
+    }
+    else if (mergeNext)
+    {
+        FreeBlocks[index].Offset = offset;
+        FreeBlocks[index].Size += size;
+    }
+    else
+    {
+        FreeBlocks.Insert(index, { offset, size });
+    }
+}
+
+bool EngineHeap::Contains(const void* ptr)
+{
+    return HeapMemory && (const byte*)ptr >= HeapMemory && (const byte*)ptr < HeapMemory + MemorySize;
+}
+
+void EngineHeap::GetStats(Stats& result)
+{
+    ScopeLock lock(Locker);
+    result.ReservedSize = MemorySize;
+    result.UsedSize = UsedSize;
+    result.PeakUsedSize = PeakUsedSize;
+    result.LargestFreeBlock = 0;
+    for (const FreeBlock& block : FreeBlocks)
+        result.LargestFreeBlock = Math::Max(result.LargestFreeBlock, block.Size);
+    result.FreeBlocks = FreeBlocks.Count();
+    result.Allocations = Allocations;
+    result.LargePages = UseLargePages;
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Memory/SimpleHeapAllocation.h"
+
+/// <summary>
+/// The optional engine memory heap that reserves a single memory region at startup (backed by the large pages if possible) and serves the page-sized blocks for the long-living, hot memory pools (eg. frame allocator pages, render list buffers or particle buffers). Reduces TLB misses and memory fragmentation during long sessions (eg. dedicated servers).
+/// </summary>
+/// <remarks>Enabled via -heap !sizeMB! command line argument (use -largepages to back it with large/huge pages). When disabled or full, callers should fallback to the regular allocation.</remarks>
+class FLAXENGINE_API EngineHeap
+{
+public:
+    /// <summary>
+    /// The size of the smallest memory block that heap can allocate (in bytes). Allocations are rounded up to it.
+    /// </summary>
+    static constexpr uint64 BlockSize = 64 * 1024;
+
+    /// <summary>
+    /// The engine heap statistics.
+    /// </summary>
+    struct Stats
+    {
+        /// <summary>
+        /// Total size of the heap memory region (in bytes).
+        /// </summary>
+        uint64 ReservedSize;
+
+        /// <summary>
+        /// Size of the allocated memory (in bytes).
+        /// </summary>
+        uint64 UsedSize;
+
+        /// <summary>
+        /// Peak size of the allocated memory (in bytes).
+        /// </summary>
+        uint64 PeakUsedSize;
+
+        /// <summary>
+        /// Size of the largest free memory block (in bytes).
+        /// </summary>
+        uint64 LargestFreeBlock;
+
+        /// <summary>
+        /// Amount of free memory blocks (holes between the allocations).
+        /// </summary>
+        int32 FreeBlocks;
+
+        /// <summary>
+        /// Amount of active allocations.
+        /// </summary>
+        int32 Allocations;
+
+        /// <summary>
+        /// True if heap memory uses large pages.
+        /// </summary>
+        bool LargePages;
+
+        /// <summary>
+        /// Gets the free memory fragmentation (0 if all free memory is a single block, close to 1 if free memory is split into many small blocks).
+        /// </summary>
+        float GetFragmentation() const
+        {
+            const uint64 freeSize = ReservedSize - UsedSize;
+            return freeSize != 0 ? 1.0f - (float)((double)LargestFreeBlock / (double)freeSize) : 0.0f;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Checks if engine heap is in use.
+    /// </summary>
+    static bool IsEnabled();
+
+    /// <summary>
+    /// Allocates the memory block from the heap.
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes). Rounded up to the BlockSize.</param>
+    /// <returns>The pointer to the allocated memory (aligned to the BlockSize) or null if heap is disabled or has no free space left.</returns>
+    static void* Allocate(uint64 size);
+
+    /// <summary>
+    /// Frees the memory block allocated from the heap.
+    /// </summary>
+    /// <param name="ptr">The pointer to the memory block.</param>
+    /// <param name="size">The size of the allocation (in bytes), the same as passed to Allocate.</param>
+    static void Free(void* ptr, uint64 size);
+
+    /// <summary>
+    /// Checks if the memory pointer belongs to the heap.
+    /// </summary>
+    static bool Contains(const void* ptr);
+
+    /// <summary>
+    /// Gets the heap statistics.
+    /// </summary>
+    static void GetStats(Stats& result);
+};
+
+/// <summary>
+/// The memory allocation policy that places large allocations (at least EngineHeap::BlockSize) in the engine heap (if enabled) and the rest in the regular memory. Use it for the long-living, pooled containers.
+/// </summary>
+class EngineHeapAllocation : public SimpleHeapAllocation<EngineHeapAllocation, 64>
+{
+public:
+    static FLAXENGINE_API void* Allocate(uintptr size);
+    static FLAXENGINE_API void Free(void* ptr, uintptr size);
+};
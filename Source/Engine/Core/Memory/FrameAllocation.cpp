@@ -0,0 +1,162 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "FrameAllocation.h"
+#include "EngineHeap.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/CriticalSection.h"
+
+#define FRAME_ALLOCATION_PAGE_SIZE (64 * 1024)
+
+namespace
+{
+    struct FrameAllocationPage
+    {
+        FrameAllocationPage* Next;
+        uintptr Size;
+        uintptr Used;
+    };
+
+    // Per-thread linear allocator. Uses separate pages list for odd and even frames so memory allocated in the previous frame stays valid.
+    struct FrameAllocator
+    {
+        uint64 Frames[2] = {};
+        FrameAllocationPage* Pages[2] = {};
+        FrameAllocationPage* FreePages = nullptr;
+        FrameAllocator* NextAllocator = nullptr;
+
+        static void FreePagesList(FrameAllocationPage* page)
+        {
+            while (page)
+            {
+                FrameAllocationPage* next = page->Next;
+                if (EngineHeap::Contains(page))
+                    EngineHeap::Free(page, page->Size);
+                else
+                    Platform::Free(page);
+                page = next;
+            }
+        }
+
+        void Release()
+        {
+            FreePagesList(Pages[0]);
+            FreePagesList(Pages[1]);
+            FreePagesList(FreePages);
+            Pages[0] = Pages[1] = FreePages = nullptr;
+        }
+
+        void Reset(int32 index)
+        {
+            // Move pages to the free list to reuse them later
+            FrameAllocationPage* page = Pages[index];
+            while (page)
+            {
+                FrameAllocationPage* next = page->Next;
+                page->Next = FreePages;
+                FreePages = page;
+                page = next;
+            }
+            Pages[index] = nullptr;
+        }
+    };
+
+    constexpr uintptr PageHeaderSize = (sizeof(FrameAllocationPage) + 15) & ~(uintptr)15;
+    THREADLOCAL FrameAllocator* ThreadAllocator = nullptr;
+    THREADLOCAL int64 ThreadAllocatorGeneration = 0;
+
+    // List of all threads allocators (released on engine exit)
+    CriticalSection AllocatorsLocker;
+    FrameAllocator* Allocators = nullptr;
+    volatile int64 AllocatorsGeneration = 1;
+}
+
+class FrameAllocationService : public EngineService
+{
+public:
+    FrameAllocationService()
+        : EngineService(TEXT("Frame Allocation"), -1050)
+    {
+    }
+
+    void Dispose() override
+    {
+        AllocatorsLocker.Lock();
+        Platform::InterlockedIncrement(&AllocatorsGeneration);
+        FrameAllocator* allocator = Allocators;
+        Allocators = nullptr;
+        while (allocator)
+        {
+            FrameAllocator* next = allocator->NextAllocator;
+            allocator->Release();
+            Delete(allocator);
+            allocator = next;
+        }
+        AllocatorsLocker.Unlock();
+    }
+};
+
+FrameAllocationService FrameAllocationServiceInstance;
+
+void* FrameAllocation::Allocate(uintptr size)
+{
+    FrameAllocator* allocator = ThreadAllocator;
+    const int64 generation = Platform::AtomicRead(&AllocatorsGeneration);
+    if (!allocator || ThreadAllocatorGeneration != generation)
+    {
+        // Create allocator for this thread (or a new one if the old one has been released)
+        allocator = New<FrameAllocator>();
+        AllocatorsLocker.Lock();
+        allocator->NextAllocator = Allocators;
+        Allocators = allocator;
+        AllocatorsLocker.Unlock();
+        ThreadAllocator = allocator;
+        ThreadAllocatorGeneration = generation;
+    }
+
+    // Reset memory allocated two frames ago
+    const uint64 frame = Engine::FrameCount;
+    const int32 index = (int32)(frame & 1);
+    if (allocator->Frames[index] != frame)
+    {
+        allocator->Reset(index);
+        allocator->Frames[index] = frame;
+    }
+
+    // Allocate from the current page or get a new one
+    size = Math::AlignUp<uintptr>(size, 16);
+    FrameAllocationPage* page = allocator->Pages[index];
+    if (!page || page->Used + size > page->Size)
+    {
+        const uintptr pageSize = Math::AlignUp<uintptr>(PageHeaderSize + size, FRAME_ALLOCATION_PAGE_SIZE);
+        FrameAllocationPage** freePage = &allocator->FreePages;
+        while (*freePage && (*freePage)->Size < pageSize)
+            freePage = &(*freePage)->Next;
+        if (*freePage)
+        {
+            page = *freePage;
+            *freePage = page->Next;
+        }
+        else
+        {
+            // Pages are reused for the whole app lifetime so prefer the engine heap (if enabled)
+            page = (FrameAllocationPage*)EngineHeap::Allocate(pageSize);
+            if (!page)
+                page = (FrameAllocationPage*)Platform::Allocate(pageSize, 16);
+            page->Size = pageSize;
+        }
+        page->Used = PageHeaderSize;
+        page->Next = allocator->Pages[index];
+        allocator->Pages[index] = page;
+    }
+    void* result = (byte*)page + page->Used;
+    page->Used += size;
+    return result;
+}
+
+void FrameAllocation::Free(void* ptr, uintptr size)
+{
+    // Memory is released when allocator gets reset
+}
@@ -0,0 +1,16 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/SimpleHeapAllocation.h"
+
+/// <summary>
+/// The memory allocation policy that uses per-thread linear allocator which is reset every frame. Allocations are lock-free and freeing is a no-op so it can be used for temporary containers in hot code executed on job threads (eg. rendering, animations or particles).
+/// </summary>
+/// <remarks>Allocated memory is valid until the end of the next frame. Don't use it for data that lives longer or within long-running background work.</remarks>
+class FrameAllocation : public SimpleHeapAllocation<FrameAllocation, 32>
+{
+public:
+    static FLAXENGINE_API void* Allocate(uintptr size);
+    static FLAXENGINE_API void Free(void* ptr, uintptr size);
+};
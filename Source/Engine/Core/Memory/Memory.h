@@ -285,6 +285,33 @@ namespace Memory
     {
         Platform::MemoryCopy(dst, src, count * sizeof(U));
     }
+
+    /// <summary>
+    /// Relocates the range of items to the new memory location (moves items and destructs the source ones). Memory ranges cannot overlap.
+    /// </summary>
+    /// <remarks>The optimized version (for trivially relocatable types) uses low-level memory copy.</remarks>
+    /// <param name="dst">The address of the first memory location to move to.</param>
+    /// <param name="src">The address of the first memory location to move from.</param>
+    /// <param name="count">The number of element to relocate. Can be equal 0.</param>
+    template<typename T>
+    FORCE_INLINE typename TEnableIf<!TIsTriviallyRelocatable<T>::Value>::Type RelocateItems(T* dst, T* src, int32 count)
+    {
+        MoveItems(dst, src, count);
+        DestructItems(src, count);
+    }
+
+    /// <summary>
+    /// Relocates the range of items to the new memory location (moves items and destructs the source ones). Memory ranges cannot overlap.
+    /// </summary>
+    /// <remarks>The optimized version (for trivially relocatable types) uses low-level memory copy.</remarks>
+    /// <param name="dst">The address of the first memory location to move to.</param>
+    /// <param name="src">The address of the first memory location to move from.</param>
+    /// <param name="count">The number of element to relocate. Can be equal 0.</param>
+    template<typename T>
+    FORCE_INLINE typename TEnableIf<TIsTriviallyRelocatable<T>::Value>::Type RelocateItems(T* dst, T* src, int32 count)
+    {
+        Platform::MemoryCopy(dst, src, count * sizeof(T));
+    }
 }
 
 /// <summary>
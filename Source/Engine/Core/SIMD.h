@@ -4,13 +4,18 @@
 
 #include "Engine/Platform/Platform.h"
 #if PLATFORM_SIMD_SSE2
-#ifdef _WIN32
 #include <xmmintrin.h>
-#endif
+#elif PLATFORM_SIMD_NEON
+#include <arm_neon.h>
 #else
 #include <math.h>
 #endif
 
+// Enables using SIMD code paths in the math types hot paths (eg. matrix or quaternion multiplication). Can be set to 0 to build with the scalar fallback.
+#ifndef USE_SIMD_MATH
+#define USE_SIMD_MATH (PLATFORM_SIMD_SSE2 || PLATFORM_SIMD_NEON)
+#endif
+
 #if PLATFORM_SIMD_SSE2
 
 // Vector of four floating point values stored in vector register.
@@ -33,16 +38,38 @@ namespace SIMD
         return _mm_load_ps((const float*)(src));
     }
 
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        return _mm_loadu_ps((const float*)(src));
+    }
+
     FORCE_INLINE SimdVector4 Splat(float value)
     {
         return _mm_set_ps1(value);
     }
 
+    template<int32 Lane>
+    FORCE_INLINE SimdVector4 SplatLane(SimdVector4 a)
+    {
+        return _mm_shuffle_ps(a, a, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+    }
+
+    template<int32 X, int32 Y, int32 Z, int32 W>
+    FORCE_INLINE SimdVector4 Shuffle(SimdVector4 a)
+    {
+        return _mm_shuffle_ps(a, a, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
     FORCE_INLINE void Store(void* dst, SimdVector4 src)
     {
         _mm_store_ps((float*)dst, src);
     }
 
+    FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+    {
+        _mm_storeu_ps((float*)dst, src);
+    }
+
     FORCE_INLINE int MoveMask(SimdVector4 a)
     {
         return _mm_movemask_ps(a);
@@ -63,6 +90,12 @@ namespace SIMD
         return _mm_mul_ps(a, b);
     }
 
+    // Computes a * b + c.
+    FORCE_INLINE SimdVector4 MulAdd(SimdVector4 a, SimdVector4 b, SimdVector4 c)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+
     FORCE_INLINE SimdVector4 Div(SimdVector4 a, SimdVector4 b)
     {
         return _mm_div_ps(a, b);
@@ -94,146 +127,320 @@ namespace SIMD
     }
 }
 
+#elif PLATFORM_SIMD_NEON
+
+// Vector of four floating point values stored in vector register.
+typedef float32x4_t SimdVector4;
+
+namespace SIMD
+{
+    FORCE_INLINE SimdVector4 Load(float xyzw)
+    {
+        return vdupq_n_f32(xyzw);
+    }
+
+    FORCE_INLINE SimdVector4 Load(float x, float y, float z, float w)
+    {
+        alignas(16) const float data[4] = { x, y, z, w };
+        return vld1q_f32(data);
+    }
+
+    FORCE_INLINE SimdVector4 Load(const void* src)
+    {
+        return vld1q_f32((const float*)src);
+    }
+
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        return vld1q_f32((const float*)src);
+    }
+
+    FORCE_INLINE SimdVector4 Splat(float value)
+    {
+        return vdupq_n_f32(value);
+    }
+
+    template<int32 Lane>
+    FORCE_INLINE SimdVector4 SplatLane(SimdVector4 a)
+    {
+        return vdupq_n_f32(vgetq_lane_f32(a, Lane));
+    }
+
+    template<int32 X, int32 Y, int32 Z, int32 W>
+    FORCE_INLINE SimdVector4 Shuffle(SimdVector4 a)
+    {
+#if defined(__clang__)
+        return __builtin_shufflevector(a, a, X, Y, Z, W);
+#else
+        alignas(16) const float data[4] = { vgetq_lane_f32(a, X), vgetq_lane_f32(a, Y), vgetq_lane_f32(a, Z), vgetq_lane_f32(a, W) };
+        return vld1q_f32(data);
+#endif
+    }
+
+    FORCE_INLINE void Store(void* dst, SimdVector4 src)
+    {
+        vst1q_f32((float*)dst, src);
+    }
+
+    FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+    {
+        vst1q_f32((float*)dst, src);
+    }
+
+    FORCE_INLINE int MoveMask(SimdVector4 a)
+    {
+        const uint32x4_t sign = vshrq_n_u32(vreinterpretq_u32_f32(a), 31);
+        return (int)(vgetq_lane_u32(sign, 0) | (vgetq_lane_u32(sign, 1) << 1) | (vgetq_lane_u32(sign, 2) << 2) | (vgetq_lane_u32(sign, 3) << 3));
+    }
+
+    FORCE_INLINE SimdVector4 Add(SimdVector4 a, SimdVector4 b)
+    {
+        return vaddq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Sub(SimdVector4 a, SimdVector4 b)
+    {
+        return vsubq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Mul(SimdVector4 a, SimdVector4 b)
+    {
+        return vmulq_f32(a, b);
+    }
+
+    // Computes a * b + c.
+    FORCE_INLINE SimdVector4 MulAdd(SimdVector4 a, SimdVector4 b, SimdVector4 c)
+    {
+        return vmlaq_f32(c, a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Rcp(SimdVector4 a)
+    {
+        // Estimate refined with a single Newton-Raphson step
+        const SimdVector4 e = vrecpeq_f32(a);
+        return vmulq_f32(vrecpsq_f32(a, e), e);
+    }
+
+    FORCE_INLINE SimdVector4 Div(SimdVector4 a, SimdVector4 b)
+    {
+#if PLATFORM_ARCH_ARM64
+        return vdivq_f32(a, b);
+#else
+        return vmulq_f32(a, Rcp(b));
+#endif
+    }
+
+    FORCE_INLINE SimdVector4 Rsqrt(SimdVector4 a)
+    {
+        // Estimate refined with a single Newton-Raphson step
+        const SimdVector4 e = vrsqrteq_f32(a);
+        return vmulq_f32(vrsqrtsq_f32(vmulq_f32(a, e), e), e);
+    }
+
+    FORCE_INLINE SimdVector4 Sqrt(SimdVector4 a)
+    {
+#if PLATFORM_ARCH_ARM64
+        return vsqrtq_f32(a);
+#else
+        return vmulq_f32(a, Rsqrt(a));
+#endif
+    }
+
+    FORCE_INLINE SimdVector4 Min(SimdVector4 a, SimdVector4 b)
+    {
+        return vminq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Max(SimdVector4 a, SimdVector4 b)
+    {
+        return vmaxq_f32(a, b);
+    }
+}
+
 #else
 
 struct SimdVector4
 {
-	float X, Y, Z, W;
+    float X, Y, Z, W;
+
+    FORCE_INLINE float operator[](int32 index) const
+    {
+        return (&X)[index];
+    }
 };
 
 namespace SIMD
 {
     FORCE_INLINE SimdVector4 Load(float xyzw)
     {
-		return { xyzw, xyzw, xyzw, xyzw };
+        return { xyzw, xyzw, xyzw, xyzw };
     }
 
     FORCE_INLINE SimdVector4 Load(float x, float y, float z, float w)
     {
-		return { x, y, z, w };
-    }
-
-	FORCE_INLINE SimdVector4 Load(const void* src)
-	{
-		return *(const SimdVector4*)src;
-	}
-
-	FORCE_INLINE SimdVector4 Splat(float value)
-	{
-		return { value, value, value, value };
-	}
-
-	FORCE_INLINE void Store(void* dst, SimdVector4 src)
-	{
-		(*(SimdVector4*)dst) = src;
-	}
-
-	FORCE_INLINE int MoveMask(SimdVector4 a)
-	{
-		return (a.W < 0 ? (1 << 3) : 0) |
-				(a.Z < 0 ? (1 << 2) : 0) |
-				(a.Y < 0 ? (1 << 1) : 0) |
-				(a.X < 0 ? 1 : 0);
-	}
-
-	FORCE_INLINE SimdVector4 Add(SimdVector4 a, SimdVector4 b)
-	{
-		return
-		{
-			a.X + b.X,
-			a.Y + b.Y,
-			a.Z + b.Z,
-			a.W + b.W
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Sub(SimdVector4 a, SimdVector4 b)
-	{
-		return
-		{
-			a.X - b.X,
-			a.Y - b.Y,
-			a.Z - b.Z,
-			a.W - b.W
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Mul(SimdVector4 a, SimdVector4 b)
-	{
-		return
-		{
-			a.X * b.X,
-			a.Y * b.Y,
-			a.Z * b.Z,
-			a.W * b.W
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Div(SimdVector4 a, SimdVector4 b)
-	{
-		return
-		{
-			a.X / b.X,
-			a.Y / b.Y,
-			a.Z / b.Z,
-			a.W / b.W
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Rcp(SimdVector4 a)
-	{
-		return
-		{
-			1 / a.X,
-			1 / a.Y,
-			1 / a.Z,
-			1 / a.W
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Sqrt(SimdVector4 a)
-	{
-		return
-		{
-			(float)sqrt(a.X),
-			(float)sqrt(a.Y),
-			(float)sqrt(a.Z),
-			(float)sqrt(a.W)
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Rsqrt(SimdVector4 a)
-	{
-		return
-		{
-			1 / (float)sqrt(a.X),
-			1 / (float)sqrt(a.Y),
-			1 / (float)sqrt(a.Z),
-			1 / (float)sqrt(a.W)
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Min(SimdVector4 a, SimdVector4 b)
-	{
-		return
-		{
-			a.X < b.X ? a.X : b.X,
-			a.Y < b.Y ? a.Y : b.Y,
-			a.Z < b.Z ? a.Z : b.Z,
-			a.W < b.W ? a.W : b.W
-		};
-	}
-
-	FORCE_INLINE SimdVector4 Max(SimdVector4 a, SimdVector4 b)
-	{
-		return
-		{
-			a.X > b.X ? a.X : b.X,
-			a.Y > b.Y ? a.Y : b.Y,
-			a.Z > b.Z ? a.Z : b.Z,
-			a.W > b.W ? a.W : b.W
-		};
-	}
+        return { x, y, z, w };
+    }
+
+    FORCE_INLINE SimdVector4 Load(const void* src)
+    {
+        return *(const SimdVector4*)src;
+    }
+
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        const float* data = (const float*)src;
+        return { data[0], data[1], data[2], data[3] };
+    }
+
+    FORCE_INLINE SimdVector4 Splat(float value)
+    {
+        return { value, value, value, value };
+    }
+
+    template<int32 Lane>
+    FORCE_INLINE SimdVector4 SplatLane(SimdVector4 a)
+    {
+        return Splat(a[Lane]);
+    }
+
+    template<int32 X, int32 Y, int32 Z, int32 W>
+    FORCE_INLINE SimdVector4 Shuffle(SimdVector4 a)
+    {
+        return { a[X], a[Y], a[Z], a[W] };
+    }
+
+    FORCE_INLINE void Store(void* dst, SimdVector4 src)
+    {
+        (*(SimdVector4*)dst) = src;
+    }
+
+    FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+    {
+        float* data = (float*)dst;
+        data[0] = src.X;
+        data[1] = src.Y;
+        data[2] = src.Z;
+        data[3] = src.W;
+    }
+
+    FORCE_INLINE int MoveMask(SimdVector4 a)
+    {
+        return (a.W < 0 ? (1 << 3) : 0) |
+                (a.Z < 0 ? (1 << 2) : 0) |
+                (a.Y < 0 ? (1 << 1) : 0) |
+                (a.X < 0 ? 1 : 0);
+    }
+
+    FORCE_INLINE SimdVector4 Add(SimdVector4 a, SimdVector4 b)
+    {
+        return
+        {
+            a.X + b.X,
+            a.Y + b.Y,
+            a.Z + b.Z,
+            a.W + b.W
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Sub(SimdVector4 a, SimdVector4 b)
+    {
+        return
+        {
+            a.X - b.X,
+            a.Y - b.Y,
+            a.Z - b.Z,
+            a.W - b.W
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Mul(SimdVector4 a, SimdVector4 b)
+    {
+        return
+        {
+            a.X * b.X,
+            a.Y * b.Y,
+            a.Z * b.Z,
+            a.W * b.W
+        };
+    }
+
+    // Computes a * b + c.
+    FORCE_INLINE SimdVector4 MulAdd(SimdVector4 a, SimdVector4 b, SimdVector4 c)
+    {
+        return
+        {
+            a.X * b.X + c.X,
+            a.Y * b.Y + c.Y,
+            a.Z * b.Z + c.Z,
+            a.W * b.W + c.W
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Div(SimdVector4 a, SimdVector4 b)
+    {
+        return
+        {
+            a.X / b.X,
+            a.Y / b.Y,
+            a.Z / b.Z,
+            a.W / b.W
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Rcp(SimdVector4 a)
+    {
+        return
+        {
+            1 / a.X,
+            1 / a.Y,
+            1 / a.Z,
+            1 / a.W
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Sqrt(SimdVector4 a)
+    {
+        return
+        {
+            (float)sqrt(a.X),
+            (float)sqrt(a.Y),
+            (float)sqrt(a.Z),
+            (float)sqrt(a.W)
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Rsqrt(SimdVector4 a)
+    {
+        return
+        {
+            1 / (float)sqrt(a.X),
+            1 / (float)sqrt(a.Y),
+            1 / (float)sqrt(a.Z),
+            1 / (float)sqrt(a.W)
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Min(SimdVector4 a, SimdVector4 b)
+    {
+        return
+        {
+            a.X < b.X ? a.X : b.X,
+            a.Y < b.Y ? a.Y : b.Y,
+            a.Z < b.Z ? a.Z : b.Z,
+            a.W < b.W ? a.W : b.W
+        };
+    }
+
+    FORCE_INLINE SimdVector4 Max(SimdVector4 a, SimdVector4 b)
+    {
+        return
+        {
+            a.X > b.X ? a.X : b.X,
+            a.Y > b.Y ? a.Y : b.Y,
+            a.Z > b.Z ? a.Z : b.Z,
+            a.W > b.W ? a.W : b.W
+        };
+    }
 }
 
 #endif
@@ -282,6 +282,17 @@ struct TIsTriviallyCopyAssignable
 
 ////////////////////////////////////////////////////////////////////////////////////
 
+// Checks if a type can be relocated in memory with a low-level memory copy (moved to the new location with the old object released without calling its destructor).
+// Can be specialized for types that have non-trivial copy or destructor but don't store pointers to themselves (eg. collections using heap allocation).
+
+template<typename T>
+struct TIsTriviallyRelocatable
+{
+    enum { Value = TOrValue<TIsPODType<T>::Value, TAnd<TIsTriviallyCopyConstructible<T>, TIsTriviallyDestructible<T>>>::Value };
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>                           struct TIsFunction                     { enum { Value = false }; };
 template<typename RetType, typename... Params> struct TIsFunction<RetType(Params...)> { enum { Value = true }; };
 
@@ -13,17 +13,14 @@ String::String(const StringAnsi& str)
 
 String::String(const StringView& str)
 {
-    _length = str.Length();
-    if (_length != 0)
+    const int32 length = str.Length();
+    if (length != 0)
     {
-        ASSERT(_length > 0);
-        _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
-        _data[_length] = 0;
-        Platform::MemoryCopy(_data, str.Get(), _length * sizeof(Char));
-    }
-    else
-    {
-        _data = nullptr;
+        ASSERT(length > 0);
+        Char* data = AllocateData(length);
+        data[length] = 0;
+        Platform::MemoryCopy(data, str.Get(), length * sizeof(Char));
+        SetData(data, length);
     }
 }
 
@@ -35,51 +32,52 @@ String::String(const StringAnsiView& str)
 void String::Set(const Char* chars, int32 length)
 {
     ASSERT(length >= 0);
-    if (length == _length)
+    Char* oldData = Get();
+    if (length == Length())
     {
-        if (_data == chars)
+        if (oldData == chars)
             return;
-        Platform::MemoryCopy(_data, chars, length * sizeof(Char));
+        Platform::MemoryCopy(oldData, chars, length * sizeof(Char));
+    }
+    else if (IsInline() && CanSetInline(chars, length))
+    {
+        // Reuse inline storage
+        Platform::MemoryCopy(_inline.Chars, chars, length * sizeof(Char));
+        _inline.Chars[length] = 0;
+        _inline.Length = (uint8)length;
     }
     else
     {
         Char* data = nullptr;
         if (length != 0)
         {
-            data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+            data = AllocateData(length, oldData);
             Platform::MemoryCopy(data, chars, length * sizeof(Char));
             data[length] = 0;
         }
-        Platform::Free(_data);
-        _data = data;
-        _length = length;
+        FreeData(oldData);
+        SetData(data, length);
     }
 }
 
 void String::Set(const char* chars, int32 length)
 {
-    if (length != _length)
+    ReserveSpace(length);
+    if (chars && length)
     {
-        Platform::Free(_data);
-        if (length != 0)
-        {
-            _data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
-            _data[length] = 0;
-        }
-        else
-        {
-            _data = nullptr;
-        }
-        _length = length;
+        int32 resultLength;
+        StringUtils::ConvertANSI2UTF16(chars, Get(), length, resultLength);
+        if (resultLength != length)
+            Resize(resultLength);
     }
-    if (chars && length)
-        StringUtils::ConvertANSI2UTF16(chars, _data, length, _length);
 }
 
 void String::SetUTF8(const char* chars, int32 length)
 {
-    Platform::Free(_data);
-    _data = StringUtils::ConvertUTF82UTF16(chars, length, _length);
+    FreeData(Get());
+    int32 resultLength;
+    Char* data = StringUtils::ConvertUTF82UTF16(chars, length, resultLength);
+    SetData(data, resultLength);
 }
 
 void String::Append(const Char* chars, int32 count)
@@ -87,17 +85,27 @@ void String::Append(const Char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    if (IsInline() && _inline.Length + count < InlineCapacity)
+    {
+        // Append within the inline storage
+        Platform::MemoryCopy(_inline.Chars + _inline.Length, chars, count * sizeof(Char));
+        _inline.Length += (uint8)count;
+        _inline.Chars[_inline.Length] = 0;
+        return;
+    }
 
-    _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    Char* oldData = Get();
+    const int32 oldLength = Length();
 
-    Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
-    Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(Char));
-    _data[_length] = 0;
+    const int32 length = oldLength + count;
+    Char* data = AllocateData(length, oldData);
 
-    Platform::Free(oldData);
+    Platform::MemoryCopy(data, oldData, oldLength * sizeof(Char));
+    Platform::MemoryCopy(data + oldLength, chars, count * sizeof(Char));
+    data[length] = 0;
+
+    FreeData(oldData);
+    SetData(data, length);
 }
 
 void String::Append(const char* chars, int32 count)
@@ -105,18 +113,29 @@ void String::Append(const char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    if (IsInline() && _inline.Length + count < InlineCapacity)
+    {
+        // Append within the inline storage
+        int32 length;
+        StringUtils::ConvertANSI2UTF16(chars, _inline.Chars + _inline.Length, count, length);
+        _inline.Length += (uint8)length;
+        _inline.Chars[_inline.Length] = 0;
+        return;
+    }
+
+    Char* oldData = Get();
+    const int32 oldLength = Length();
 
-    _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    Char* data = AllocateData(oldLength + count, oldData);
 
-    Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
-    StringUtils::ConvertANSI2UTF16(chars, _data + oldLength, count, _length);
-    _length += oldLength;
-    _data[_length] = 0;
+    Platform::MemoryCopy(data, oldData, oldLength * sizeof(Char));
+    int32 length;
+    StringUtils::ConvertANSI2UTF16(chars, data + oldLength, count, length);
+    length += oldLength;
+    data[length] = 0;
 
-    Platform::Free(oldData);
+    FreeData(oldData);
+    SetData(data, length);
 }
 
 String& String::operator+=(const StringView& str)
@@ -133,7 +152,7 @@ String& String::operator=(const StringView& s)
 
 void String::Insert(int32 startIndex, const String& other)
 {
-    ASSERT(other._data != _data);
+    ASSERT(other.Get() != Get());
     const int32 myLength = Length();
     const int32 otherLength = other.Length();
     ASSERT(startIndex >= 0 && startIndex <= myLength);
@@ -147,24 +166,25 @@ void String::Insert(int32 startIndex, const String& other)
         return;
     }
 
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    Char* oldData = Get();
+    const int32 oldLength = Length();
 
-    _length = oldLength + otherLength;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    const int32 length = oldLength + otherLength;
+    Char* data = AllocateData(length, oldData);
 
-    Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
-    Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(Char));
-    Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(Char));
-    _data[_length] = 0;
+    Platform::MemoryCopy(data, oldData, startIndex * sizeof(Char));
+    Platform::MemoryCopy(data + startIndex, other.Get(), otherLength * sizeof(Char));
+    Platform::MemoryCopy(data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(Char));
+    data[length] = 0;
 
-    Platform::Free(oldData);
+    FreeData(oldData);
+    SetData(data, length);
 }
 
 void String::Remove(int32 startIndex, int32 length)
 {
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    Char* oldData = Get();
+    const int32 oldLength = Length();
     ASSERT(startIndex >= 0 && startIndex + length <= oldLength);
 
     if (startIndex == 0 && oldLength == length)
@@ -173,14 +193,15 @@ void String::Remove(int32 startIndex, int32 length)
         return;
     }
 
-    _length = oldLength - length;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    const int32 newLength = oldLength - length;
+    Char* data = AllocateData(newLength, oldData);
 
-    Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
-    Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, (_length - startIndex) * sizeof(Char));
-    _data[_length] = 0;
+    Platform::MemoryCopy(data, oldData, startIndex * sizeof(Char));
+    Platform::MemoryCopy(data + startIndex, oldData + startIndex + length, (newLength - startIndex) * sizeof(Char));
+    data[newLength] = 0;
 
-    Platform::Free(oldData);
+    FreeData(oldData);
+    SetData(data, newLength);
 }
 
 void String::Split(Char c, Array<String>& results) const
@@ -188,10 +209,11 @@ void String::Split(Char c, Array<String>& results) const
     results.Clear();
     int32 start = 0;
     int32 length = Length();
+    const auto data = Get();
 
     for (int32 i = 0; i < length; i++)
     {
-        if (_data[i] == c)
+        if (data[i] == c)
         {
             int32 count = i - start;
             if (count > 0)
@@ -218,9 +240,10 @@ String String::GetFirstLine() const
 bool String::IsANSI() const
 {
     bool result = true;
-    for (int32 i = 0; i < _length; i++)
+    const Char* data = Get();
+    for (int32 i = 0, length = Length(); i < length; i++)
     {
-        if (_data[i] > 127)
+        if (data[i] > 127)
         {
             result = false;
             break;
@@ -269,8 +292,8 @@ String String::ToUpper() const
 
 void String::TrimToNullTerminator()
 {
-    const int32 length = _length;
-    const int32 newLength = StringUtils::Length(_data);
+    const int32 length = Length();
+    const int32 newLength = StringUtils::Length(Get());
     if (length != 0 && length != newLength)
     {
         Resize(newLength);
@@ -300,14 +323,15 @@ String String::TrimTrailing() const
 
     const int32 count = end - start + 1;
     if (start >= 0 && start + count <= Length() && count >= 0)
-        return String(_data + start, count);
+        return String(Get() + start, count);
     return Empty;
 }
 
 String& String::operator/=(const Char* str)
 {
-    const int32 length = _length;
-    if (length > 0 && _data[length - 1] != TEXT('/') && _data[length - 1] != TEXT('\\')
+    const int32 length = Length();
+    const Char* data = Get();
+    if (length > 0 && data[length - 1] != TEXT('/') && data[length - 1] != TEXT('\\')
         && (str == nullptr || (str[0] != TEXT('/') && str[0] != TEXT('\\'))))
     {
         *this += TEXT('/');
@@ -317,8 +341,9 @@ String& String::operator/=(const Char* str)
 
 String& String::operator/=(const char* str)
 {
-    const int32 length = _length;
-    if (length > 0 && _data[length - 1] != TEXT('/') && _data[length - 1] != TEXT('\\')
+    const int32 length = Length();
+    const Char* data = Get();
+    if (length > 0 && data[length - 1] != TEXT('/') && data[length - 1] != TEXT('\\')
         && (str == nullptr || (str[0] != TEXT('/') && str[0] != TEXT('\\'))))
     {
         *this += TEXT('/');
@@ -328,8 +353,9 @@ String& String::operator/=(const char* str)
 
 String& String::operator/=(const Char c)
 {
-    const int32 length = _length;
-    if (length > 0 && _data[length - 1] != TEXT('/') && _data[length - 1] != TEXT('\\'))
+    const int32 length = Length();
+    const Char* data = Get();
+    if (length > 0 && data[length - 1] != TEXT('/') && data[length - 1] != TEXT('\\'))
     {
         *this += TEXT('/');
     }
@@ -338,8 +364,9 @@ String& String::operator/=(const Char c)
 
 String& String::operator/=(const StringView& str)
 {
-    const int32 length = _length;
-    if (length > 1 && _data[length - 1] != TEXT('/') && _data[length - 1] != TEXT('\\')
+    const int32 length = Length();
+    const Char* data = Get();
+    if (length > 1 && data[length - 1] != TEXT('/') && data[length - 1] != TEXT('\\')
         && (str == nullptr || (str[0] != TEXT('/') && str[0] != TEXT('\\'))))
     {
         *this += TEXT('/');
@@ -367,46 +394,39 @@ StringAnsi::StringAnsi(const StringAnsiView& str)
 void StringAnsi::Set(const char* chars, int32 length)
 {
     ASSERT(length >= 0);
-    if (length == _length)
+    char* oldData = Get();
+    if (length == Length())
     {
-        if (_data == chars)
+        if (oldData == chars)
             return;
-        Platform::MemoryCopy(_data, chars, length * sizeof(char));
+        Platform::MemoryCopy(oldData, chars, length * sizeof(char));
+    }
+    else if (IsInline() && CanSetInline(chars, length))
+    {
+        // Reuse inline storage
+        Platform::MemoryCopy(_inline.Chars, chars, length * sizeof(char));
+        _inline.Chars[length] = 0;
+        _inline.Length = (uint8)length;
     }
     else
     {
         char* data = nullptr;
         if (length != 0)
         {
-            data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
+            data = AllocateData(length, oldData);
             Platform::MemoryCopy(data, chars, length * sizeof(char));
             data[length] = 0;
         }
-        Platform::Free(_data);
-        _data = data;
-        _length = length;
+        FreeData(oldData);
+        SetData(data, length);
     }
 }
 
 void StringAnsi::Set(const Char* chars, int32 length)
 {
-    if (length != _length)
-    {
-        Platform::Free(_data);
-        if (length != 0)
-        {
-            _data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
-            _data[length] = 0;
-        }
-        else
-        {
-            _data = nullptr;
-        }
-        _length = length;
-    }
-
-    if (_data)
-        StringUtils::ConvertUTF162ANSI(chars, _data, length);
+    ReserveSpace(length);
+    if (char* data = Get())
+        StringUtils::ConvertUTF162ANSI(chars, data, length);
 }
 
 void StringAnsi::Append(const char* chars, int32 count)
@@ -414,17 +434,27 @@ void StringAnsi::Append(const char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    if (IsInline() && _inline.Length + count < InlineCapacity)
+    {
+        // Append within the inline storage
+        Platform::MemoryCopy(_inline.Chars + _inline.Length, chars, count * sizeof(char));
+        _inline.Length += (uint8)count;
+        _inline.Chars[_inline.Length] = 0;
+        return;
+    }
+
+    char* oldData = Get();
+    const int32 oldLength = Length();
 
-    _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    const int32 length = oldLength + count;
+    char* data = AllocateData(length, oldData);
 
-    Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
-    Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(char));
-    _data[_length] = 0;
+    Platform::MemoryCopy(data, oldData, oldLength * sizeof(char));
+    Platform::MemoryCopy(data + oldLength, chars, count * sizeof(char));
+    data[length] = 0;
 
-    Platform::Free(oldData);
+    FreeData(oldData);
+    SetData(data, length);
 }
 
 void StringAnsi::Append(const Char* chars, int32 count)
@@ -432,17 +462,27 @@ void StringAnsi::Append(const Char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    if (IsInline() && _inline.Length + count < InlineCapacity)
+    {
+        // Append within the inline storage
+        StringUtils::ConvertUTF162ANSI(chars, _inline.Chars + _inline.Length, count);
+        _inline.Length += (uint8)count;
+        _inline.Chars[_inline.Length] = 0;
+        return;
+    }
+
+    char* oldData = Get();
+    const int32 oldLength = Length();
 
-    _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    const int32 length = oldLength + count;
+    char* data = AllocateData(length, oldData);
 
-    Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
-    StringUtils::ConvertUTF162ANSI(chars, _data + oldLength, count * sizeof(char));
-    _data[_length] = 0;
+    Platform::MemoryCopy(data, oldData, oldLength * sizeof(char));
+    StringUtils::ConvertUTF162ANSI(chars, data + oldLength, count * sizeof(char));
+    data[length] = 0;
 
-    Platform::Free(oldData);
+    FreeData(oldData);
+    SetData(data, length);
 }
 
 StringAnsi& StringAnsi::operator+=(const StringAnsiView& str)
@@ -493,10 +533,10 @@ StringAnsi StringAnsi::ToUpper() const
 
 void StringAnsi::Insert(int32 startIndex, const StringAnsi& other)
 {
-    ASSERT(other._data != _data);
+    ASSERT(other.Get() != Get());
     const int32 myLength = Length();
     const int32 otherLength = other.Length();
-    ASSERT(startIndex >= 0 && startIndex < _length);
+    ASSERT(startIndex >= 0 && startIndex < Length());
 
     if (otherLength == 0)
         return;
@@ -507,24 +547,25 @@ void StringAnsi::Insert(int32 startIndex, const StringAnsi& other)
         return;
     }
 
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    char* oldData = Get();
+    const int32 oldLength = Length();
 
-    _length = oldLength + otherLength;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    const int32 length = oldLength + otherLength;
+    char* data = AllocateData(length, oldData);
 
-    Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
-    Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(char));
-    Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(char));
-    _data[_length] = 0;
+    Platform::MemoryCopy(data, oldData, startIndex * sizeof(char));
+    Platform::MemoryCopy(data + startIndex, other.Get(), otherLength * sizeof(char));
+    Platform::MemoryCopy(data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(char));
+    data[length] = 0;
 
-    Platform::Free(oldData);
+    FreeData(oldData);
+    SetData(data, length);
 }
 
 void StringAnsi::Remove(int32 startIndex, int32 length)
 {
-    const auto oldData = _data;
-    const auto oldLength = _length;
+    char* oldData = Get();
+    const int32 oldLength = Length();
     ASSERT(startIndex >= 0 && startIndex + length <= oldLength);
 
     if (startIndex == 0 && oldLength == length)
@@ -533,14 +574,15 @@ void StringAnsi::Remove(int32 startIndex, int32 length)
         return;
     }
 
-    _length = oldLength - length;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    const int32 newLength = oldLength - length;
+    char* data = AllocateData(newLength, oldData);
 
-    Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
-    Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, length * sizeof(char));
-    _data[_length] = 0;
+    Platform::MemoryCopy(data, oldData, startIndex * sizeof(char));
+    Platform::MemoryCopy(data + startIndex, oldData + startIndex + length, length * sizeof(char));
+    data[newLength] = 0;
 
-    Platform::Free(oldData);
+    FreeData(oldData);
+    SetData(data, newLength);
 }
 
 void StringAnsi::Split(char c, Array<StringAnsi>& results) const
@@ -548,10 +590,11 @@ void StringAnsi::Split(char c, Array<StringAnsi>& results) const
     results.Clear();
     int32 start = 0;
     int32 length = Length();
+    const auto data = Get();
 
     for (int32 i = 0; i < length; i++)
     {
-        if (_data[i] == c)
+        if (data[i] == c)
         {
             int32 count = i - start;
             if (count > 0)
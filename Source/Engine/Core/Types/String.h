@@ -7,24 +7,51 @@
 #include "Engine/Core/Formatting.h"
 
 /// <summary>
-/// Represents text as a sequence of characters. Container uses a single dynamic memory allocation to store the characters data. Characters sequence is always null-terminated.
+/// Represents text as a sequence of characters. Short texts are stored inline within the container, longer use a single dynamic memory allocation to store the characters data. Characters sequence is always null-terminated.
 /// </summary>
+/// <remarks>Moving a short string copies its characters, so views of the moved string become invalid (similar to the other containers with inline storage).</remarks>
 template<typename T>
 class StringBase
 {
 protected:
-    T* _data = nullptr;
-    int32 _length = 0;
+    // The maximum amount of characters (including null-terminator) stored inline (uses the space of the heap data pointer and length).
+    enum { InlineCapacity = (sizeof(T*) + sizeof(int32) * 2 - 2) / sizeof(T) };
+
+    // Characters storage of the long texts (heap allocation) and the short texts (inline), the inline storage tag (last byte) tells which one is used.
+    union
+    {
+        struct
+        {
+            T* Data;
+            int32 Length;
+            int32 Padding; // Overlaps with the inline storage tag so it's always zero
+        } _heap;
+
+        struct
+        {
+            T Chars[InlineCapacity];
+            uint8 Length;
+            uint8 Tag;
+        } _inline;
+    };
 
 public:
     typedef T CharType;
 
+    /// <summary>
+    /// Initializes a new instance of the <see cref="StringBase"/> class.
+    /// </summary>
+    StringBase()
+    {
+        SetData(nullptr, 0);
+    }
+
     /// <summary>
     /// Finalizes an instance of the <see cref="StringBase"/> class.
     /// </summary>
     ~StringBase()
     {
-        Platform::Free(_data);
+        FreeData(Get());
     }
 
 public:
@@ -33,9 +60,58 @@ class StringBase
     /// </summary>
     void Clear()
     {
-        Platform::Free(_data);
-        _data = nullptr;
-        _length = 0;
+        FreeData(Get());
+        SetData(nullptr, 0);
+    }
+
+protected:
+    FORCE_INLINE bool IsInline() const
+    {
+        return _inline.Tag != 0;
+    }
+
+    // Gets the storage for the characters of the given length (excluding null-terminator). Uses inline storage if text fits in it and it's not used by the old data (that is still needed by the caller).
+    // Writing to the inline storage overwrites the heap data pointer and length, thus the caller has to keep the old data and length before and call SetData after.
+    FORCE_INLINE T* AllocateData(int32 length, const T* oldData = nullptr)
+    {
+        if (length < InlineCapacity && oldData != _inline.Chars)
+            return _inline.Chars;
+        return (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+    }
+
+    FORCE_INLINE void FreeData(T* data)
+    {
+        if (data != _inline.Chars)
+            Platform::Free(data);
+    }
+
+    // Sets the characters storage (returned by AllocateData, or null for empty text) and the text length.
+    FORCE_INLINE void SetData(T* data, int32 length)
+    {
+        if (data == _inline.Chars)
+        {
+            _inline.Length = (uint8)length;
+            _inline.Tag = 1;
+        }
+        else
+        {
+            _heap.Data = data;
+            _heap.Length = length;
+            _heap.Padding = 0;
+        }
+    }
+
+    // Checks if the given characters can be written to the inline storage (text fits and it's not overlapping with the storage).
+    FORCE_INLINE bool CanSetInline(const void* chars, int32 length) const
+    {
+        return length != 0 && length < InlineCapacity && ((const T*)chars + length <= _inline.Chars || (const T*)chars >= _inline.Chars + InlineCapacity);
+    }
+
+    // Moves the contents of the other string into this one (which has to be empty).
+    void MoveFrom(StringBase& other)
+    {
+        Platform::MemoryCopy(&_heap, &other._heap, sizeof(_heap));
+        other.SetData(nullptr, 0);
     }
 
 public:
@@ -46,8 +122,8 @@ class StringBase
     /// <returns>The character</returns>
     FORCE_INLINE T& operator[](int32 index)
     {
-        ASSERT(index >= 0 && index < _length);
-        return _data[index];
+        ASSERT(index >= 0 && index < Length());
+        return Get()[index];
     }
 
     /// <summary>
@@ -57,8 +133,8 @@ class StringBase
     /// <returns>The character</returns>
     FORCE_INLINE const T& operator[](int32 index) const
     {
-        ASSERT(index >= 0 && index < _length);
-        return _data[index];
+        ASSERT(index >= 0 && index < Length());
+        return Get()[index];
     }
 
 public:
@@ -83,7 +159,7 @@ class StringBase
     /// <returns>True if string is empty, otherwise false.</returns>
     FORCE_INLINE bool IsEmpty() const
     {
-        return _length == 0;
+        return Length() == 0;
     }
 
     /// <summary>
@@ -92,7 +168,7 @@ class StringBase
     /// <returns>True if string has characters, otherwise false.</returns>
     FORCE_INLINE bool HasChars() const
     {
-        return _length != 0;
+        return Length() != 0;
     }
 
     /// <summary>
@@ -101,7 +177,7 @@ class StringBase
     /// <returns>The text length.</returns>
     FORCE_INLINE int32 Length() const
     {
-        return _length;
+        return IsInline() ? _inline.Length : _heap.Length;
     }
 
     /// <summary>
@@ -110,7 +186,7 @@ class StringBase
     /// <returns>The string handle.</returns>
     FORCE_INLINE const T* operator*() const
     {
-        return _data;
+        return Get();
     }
 
     /// <summary>
@@ -119,7 +195,7 @@ class StringBase
     /// <returns>The string handle.</returns>
     FORCE_INLINE T* operator*()
     {
-        return _data;
+        return Get();
     }
 
     /// <summary>
@@ -128,7 +204,7 @@ class StringBase
     /// <returns>The string handle.</returns>
     FORCE_INLINE T* Get()
     {
-        return _data;
+        return IsInline() ? _inline.Chars : _heap.Data;
     }
 
     /// <summary>
@@ -137,7 +213,7 @@ class StringBase
     /// <returns>The string handle.</returns>
     FORCE_INLINE const T* Get() const
     {
-        return _data;
+        return IsInline() ? _inline.Chars : _heap.Data;
     }
 
     /// <summary>
@@ -146,7 +222,8 @@ class StringBase
     /// <returns>The string handle.</returns>
     FORCE_INLINE const T* GetText() const
     {
-        return _data ? _data : (const T*)TEXT("");
+        const T* data = Get();
+        return data ? data : (const T*)TEXT("");
     }
 
 public:
@@ -180,7 +257,7 @@ class StringBase
     int32 Find(T c) const
     {
         const T* RESTRICT start = Get();
-        for (const T * RESTRICT data = start, *RESTRICT dataEnd = data + _length; data != dataEnd; ++data)
+        for (const T * RESTRICT data = start, *RESTRICT dataEnd = data + Length(); data != dataEnd; ++data)
         {
             if (*data == c)
             {
@@ -197,8 +274,8 @@ class StringBase
     /// <returns>The index of the character position in the string or -1 if not found.</returns>
     int32 FindLast(T c) const
     {
-        const T* RESTRICT end = Get() + _length;
-        for (const T * RESTRICT data = end, *RESTRICT dataStart = data - _length; data != dataStart;)
+        const T* RESTRICT end = Get() + Length();
+        for (const T * RESTRICT data = end, *RESTRICT dataStart = data - Length(); data != dataStart;)
         {
             --data;
             if (*data == c)
@@ -218,9 +295,9 @@ class StringBase
     /// <returns>The index of the found substring or -1 if not found.</returns>
     int32 Find(const T* subStr, StringSearchCase searchCase = StringSearchCase::CaseSensitive, int32 startPosition = -1) const
     {
-        if (subStr == nullptr || !_data)
+        if (subStr == nullptr || !Get())
             return -1;
-        const T* start = _data;
+        const T* start = Get();
         if (startPosition != -1)
             start += startPosition < Length() ? startPosition : Length();
         const T* tmp = searchCase == StringSearchCase::IgnoreCase ? StringUtils::FindIgnoreCase(start, subStr) : StringUtils::Find(start, subStr);
@@ -237,11 +314,11 @@ class StringBase
     int32 FindLast(const T* subStr, StringSearchCase searchCase = StringSearchCase::CaseSensitive, int32 startPosition = -1) const
     {
         const int32 subStrLen = StringUtils::Length(subStr);
-        if (subStrLen == 0 || !_data)
+        if (subStrLen == 0 || !Get())
             return -1;
         if (startPosition == -1)
             startPosition = Length();
-        const T* start = _data;
+        const T* start = Get();
         if (searchCase == StringSearchCase::IgnoreCase)
         {
             for (int32 i = startPosition - subStrLen; i >= 0; i--)
@@ -293,9 +370,10 @@ class StringBase
     /// <returns>The position of the first character that matches. If no matches are found, the function returns -1.</returns>
     int32 FindFirstOf(T c, int32 startPos = 0) const
     {
-        for (int32 i = startPos; i < Length(); i++)
+        const T* data = Get();
+        for (int32 i = startPos, length = Length(); i < length; i++)
         {
-            if (_data[i] == c)
+            if (data[i] == c)
                 return i;
         }
         return -1;
@@ -311,9 +389,10 @@ class StringBase
     {
         if (!str)
             return -1;
-        for (int32 i = startPos; i < _length; i++)
+        const T* data = Get();
+        for (int32 i = startPos, length = Length(); i < length; i++)
         {
-            const T c = _data[i];
+            const T c = data[i];
             const T* s = str;
             while (*s)
             {
@@ -332,19 +411,16 @@ class StringBase
     void ReserveSpace(int32 length)
     {
         ASSERT(length >= 0);
-        if (length == _length)
+        if (length == Length())
             return;
-        Platform::Free(_data);
+        FreeData(Get());
+        T* data = nullptr;
         if (length != 0)
         {
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
-            _data[length] = 0;
+            data = AllocateData(length);
+            data[length] = 0;
         }
-        else
-        {
-            _data = nullptr;
-        }
-        _length = length;
+        SetData(data, length);
     }
 
 public:
@@ -352,16 +428,16 @@ class StringBase
     {
         const int32 length = Length();
         if (searchCase == StringSearchCase::CaseSensitive)
-            return length > 0 && _data[0] == c;
-        return length > 0 && StringUtils::ToLower(_data[0]) == StringUtils::ToLower(c);
+            return length > 0 && Get()[0] == c;
+        return length > 0 && StringUtils::ToLower(Get()[0]) == StringUtils::ToLower(c);
     }
 
     bool EndsWith(T c, StringSearchCase searchCase = StringSearchCase::CaseSensitive) const
     {
         const int32 length = Length();
         if (searchCase == StringSearchCase::CaseSensitive)
-            return length > 0 && _data[length - 1] == c;
-        return length > 0 && StringUtils::ToLower(_data[length - 1]) == StringUtils::ToLower(c);
+            return length > 0 && Get()[length - 1] == c;
+        return length > 0 && StringUtils::ToLower(Get()[length - 1]) == StringUtils::ToLower(c);
     }
 
     bool StartsWith(const StringBase& prefix, StringSearchCase searchCase = StringSearchCase::CaseSensitive) const
@@ -390,14 +466,15 @@ class StringBase
     {
         int32 replacedChars = 0;
         const int32 length = Length();
+        T* data = Get();
         if (searchCase == StringSearchCase::IgnoreCase)
         {
             const T toCompare = StringUtils::ToLower(searchChar);
             for (int32 i = 0; i < length; i++)
             {
-                if (StringUtils::ToLower(_data[i]) == toCompare)
+                if (StringUtils::ToLower(data[i]) == toCompare)
                 {
-                    _data[i] = replacementChar;
+                    data[i] = replacementChar;
                     replacedChars++;
                 }
             }
@@ -406,9 +483,9 @@ class StringBase
         {
             for (int32 i = 0; i < length; i++)
             {
-                if (_data[i] == searchChar)
+                if (data[i] == searchChar)
                 {
-                    _data[i] = replacementChar;
+                    data[i] = replacementChar;
                     replacedChars++;
                 }
             }
@@ -446,7 +523,7 @@ class StringBase
 
         if (searchTextLength == replacementTextLength)
         {
-            T* pos = (T*)(searchCase == StringSearchCase::IgnoreCase ? StringUtils::FindIgnoreCase(_data, searchText) : StringUtils::Find(_data, searchText));
+            T* pos = (T*)(searchCase == StringSearchCase::IgnoreCase ? StringUtils::FindIgnoreCase(Get(), searchText) : StringUtils::Find(Get(), searchText));
             while (pos != nullptr)
             {
                 replacedCount++;
@@ -462,7 +539,7 @@ class StringBase
         }
         else if (Contains(searchText, searchCase))
         {
-            T* readPosition = _data;
+            T* readPosition = Get();
             T* searchPosition = (T*)(searchCase == StringSearchCase::IgnoreCase ? StringUtils::FindIgnoreCase(readPosition, searchText) : StringUtils::Find(readPosition, searchText));
             while (searchPosition != nullptr)
             {
@@ -471,12 +548,12 @@ class StringBase
                 searchPosition = (T*)(searchCase == StringSearchCase::IgnoreCase ? StringUtils::FindIgnoreCase(readPosition, searchText) : StringUtils::Find(readPosition, searchText));
             }
 
-            const auto oldLength = _length;
-            const auto oldData = _data;
-            _length += replacedCount * (replacementTextLength - searchTextLength);
-            _data = (T*)Platform::Allocate((_length + 1) * sizeof(T), 16);
+            const int32 oldLength = Length();
+            T* oldData = Get();
+            const int32 length = oldLength + replacedCount * (replacementTextLength - searchTextLength);
+            T* data = AllocateData(length, oldData);
 
-            T* writePosition = _data;
+            T* writePosition = data;
             readPosition = oldData;
             searchPosition = (T*)(searchCase == StringSearchCase::IgnoreCase ? StringUtils::FindIgnoreCase(readPosition, searchText) : StringUtils::Find(readPosition, searchText));
             while (searchPosition != nullptr)
@@ -496,8 +573,9 @@ class StringBase
             const int32 writeOffset = (int32)(oldData - readPosition) + oldLength;
             Platform::MemoryCopy(writePosition, readPosition, writeOffset * sizeof(T));
 
-            _data[_length] = 0;
-            Platform::Free(oldData);
+            data[length] = 0;
+            FreeData(oldData);
+            SetData(data, length);
         }
 
         return replacedCount;
@@ -509,13 +587,14 @@ class StringBase
     void Reverse()
     {
         T c;
-        int32 tmp, count = _length, end = count / 2;
+        T* data = Get();
+        int32 tmp, count = Length(), end = count / 2;
         for (int32 i = 0; i < end; i++)
         {
             tmp = count - i - 2;
-            c = _data[i];
-            _data[i] = _data[tmp];
-            _data[tmp] = c;
+            c = data[i];
+            data[i] = data[tmp];
+            data[tmp] = c;
         }
     }
 
@@ -526,15 +605,23 @@ class StringBase
     void Resize(int32 length)
     {
         ASSERT(length >= 0);
-        if (_length != length)
+        const int32 oldLength = Length();
+        if (oldLength != length)
         {
-            const auto oldData = _data;
-            const auto minLength = _length < length ? _length : length;
-            _length = length;
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
-            Platform::MemoryCopy(_data, oldData, minLength * sizeof(T));
-            _data[length] = 0;
-            Platform::Free(oldData);
+            if (IsInline() && length < InlineCapacity && length != 0)
+            {
+                // Resize within the inline storage
+                _inline.Chars[length] = 0;
+                _inline.Length = (uint8)length;
+                return;
+            }
+            T* oldData = Get();
+            const int32 minLength = oldLength < length ? oldLength : length;
+            T* data = AllocateData(length, oldData);
+            Platform::MemoryCopy(data, oldData, minLength * sizeof(T));
+            data[length] = 0;
+            FreeData(oldData);
+            SetData(data, length);
         }
     }
 };
@@ -572,10 +659,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     /// <param name="str">The double reference to the string.</param>
     String(String&& str) noexcept
     {
-        _data = str._data;
-        _length = str._length;
-        str._data = nullptr;
-        str._length = 0;
+        MoveFrom(str);
     }
 
     /// <summary>
@@ -757,11 +841,12 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     friend String operator+(const String& a, const Char b)
     {
         String result;
-        result._length = a.Length() + 1;
-        result._data = (Char*)Platform::Allocate((result._length + 1) * sizeof(Char), 16);
-        Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(Char));
-        result._data[a.Length()] = b;
-        result._data[result._length] = 0;
+        const int32 length = a.Length() + 1;
+        Char* data = result.AllocateData(length);
+        Platform::MemoryCopy(data, a.Get(), a.Length() * sizeof(Char));
+        data[a.Length()] = b;
+        data[length] = 0;
+        result.SetData(data, length);
         return result;
     }
 
@@ -775,11 +860,8 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     {
         if (this != &s)
         {
-            Platform::Free(_data);
-            _data = s._data;
-            _length = s._length;
-            s._data = nullptr;
-            s._length = 0;
+            FreeData(Get());
+            MoveFrom(s);
         }
         return *this;
     }
@@ -810,7 +892,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     /// <returns>The reference to this.</returns>
     String& operator=(const Char* str)
     {
-        if (_data != str)
+        if (Get() != str)
             Set(str, StringUtils::Length(str));
         return *this;
     }
@@ -909,7 +991,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     }
     FORCE_INLINE bool operator==(const String& other) const
     {
-        return StringUtils::Compare(this->GetText(), other.GetText()) == 0;
+        return Length() == other.Length() && StringUtils::Compare(this->GetText(), other.GetText()) == 0;
     }
     FORCE_INLINE bool operator!=(const Char* other) const
     {
@@ -985,7 +1067,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     String Substring(int32 startIndex) const
     {
         ASSERT(startIndex >= 0 && startIndex < Length());
-        return String(_data + startIndex, _length - startIndex);
+        return String(Get() + startIndex, Length() - startIndex);
     }
 
     /// <summary>
@@ -997,7 +1079,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     String Substring(int32 startIndex, int32 count) const
     {
         ASSERT(startIndex >= 0 && startIndex + count <= Length() && count >= 0);
-        return String(_data + startIndex, count);
+        return String(Get() + startIndex, count);
     }
 
     /// <summary>
@@ -1013,7 +1095,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     /// <param name="startIndex">The index of the first character to remove.</param>
     void Remove(int32 startIndex)
     {
-        Remove(startIndex, _length - startIndex);
+        Remove(startIndex, Length() - startIndex);
     }
 
     /// <summary>
@@ -1276,10 +1358,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     /// <param name="str">The double reference to the string.</param>
     StringAnsi(StringAnsi&& str) noexcept
     {
-        _data = str._data;
-        _length = str._length;
-        str._data = nullptr;
-        str._length = 0;
+        MoveFrom(str);
     }
 
     /// <summary>
@@ -1454,11 +1533,12 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     friend StringAnsi operator+(const StringAnsi& a, const char b)
     {
         StringAnsi result;
-        result._length = a.Length() + 1;
-        result._data = (char*)Platform::Allocate((result._length + 1) * sizeof(char), 16);
-        Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(char));
-        result._data[a.Length()] = b;
-        result._data[result._length] = 0;
+        const int32 length = a.Length() + 1;
+        char* data = result.AllocateData(length);
+        Platform::MemoryCopy(data, a.Get(), a.Length() * sizeof(char));
+        data[a.Length()] = b;
+        data[length] = 0;
+        result.SetData(data, length);
         return result;
     }
 
@@ -1472,11 +1552,8 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     {
         if (this != &s)
         {
-            Platform::Free(_data);
-            _data = s._data;
-            _length = s._length;
-            s._data = nullptr;
-            s._length = 0;
+            FreeData(Get());
+            MoveFrom(s);
         }
         return *this;
     }
@@ -1507,7 +1584,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     /// <returns>The reference to this.</returns>
     StringAnsi& operator=(const char* str)
     {
-        if (_data != str)
+        if (Get() != str)
             Set(str, StringUtils::Length(str));
         return *this;
     }
@@ -1598,7 +1675,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     }
     FORCE_INLINE bool operator==(const StringAnsi& other) const
     {
-        return StringUtils::Compare(this->GetText(), other.GetText()) == 0;
+        return Length() == other.Length() && StringUtils::Compare(this->GetText(), other.GetText()) == 0;
     }
     FORCE_INLINE bool operator!=(const char* other) const
     {
@@ -1667,7 +1744,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     StringAnsi Substring(int32 startIndex) const
     {
         ASSERT(startIndex >= 0 && startIndex < Length());
-        return StringAnsi(_data + startIndex, _length - startIndex);
+        return StringAnsi(Get() + startIndex, Length() - startIndex);
     }
 
     /// <summary>
@@ -1679,7 +1756,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     StringAnsi Substring(int32 startIndex, int32 count) const
     {
         ASSERT(startIndex >= 0 && startIndex + count <= Length() && count >= 0);
-        return StringAnsi(_data + startIndex, count);
+        return StringAnsi(Get() + startIndex, count);
     }
 
     /// <summary>
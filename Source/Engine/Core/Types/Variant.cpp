@@ -25,6 +25,7 @@
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #include "Engine/Scripting/ManagedCLR/MUtils.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/Utilities/Crc.h"
 #include "Engine/Utilities/StringConverter.h"
 
@@ -34,6 +35,13 @@
 #define MANAGED_GC_HANDLE AsUint
 #endif
 
+// Maximum size of the blob data (in bytes) served from the Variant blobs pool (larger blobs use the default allocator)
+#define VARIANT_BLOB_POOL_MAX_SIZE 128
+// Size of the memory chunk (in bytes) allocated by the Variant blobs pool when it runs out of free blocks
+#define VARIANT_BLOB_POOL_CHUNK_SIZE (16 * 1024)
+// Maximum amount of free blocks (per size class) cached by a single thread before they are returned to the shared pool
+#define VARIANT_BLOB_POOL_THREAD_CACHE 64
+
 namespace
 {
     const char* InBuiltTypesTypeNames[40] =
@@ -83,6 +91,100 @@ namespace
     };
 }
 
+namespace
+{
+    constexpr int32 BlobPoolGranularity = 16;
+    constexpr int32 BlobPoolClasses = VARIANT_BLOB_POOL_MAX_SIZE / BlobPoolGranularity;
+
+    struct BlobPoolBlock
+    {
+        BlobPoolBlock* Next;
+    };
+
+    // Free blocks shared by all threads (accessed in batches only when thread cache is empty or full)
+    struct BlobPoolShared
+    {
+        CriticalSection Locker;
+        BlobPoolBlock* Free[BlobPoolClasses] = {};
+    };
+
+    // Free blocks cached by the thread (accessed without locking, returned to the shared pool when thread exits)
+    struct BlobPoolCache
+    {
+        BlobPoolBlock* Free[BlobPoolClasses] = {};
+        int32 Count[BlobPoolClasses] = {};
+
+        ~BlobPoolCache();
+    };
+
+    // C++ thread_local (instead of THREADLOCAL) to get the destructor called on thread exit
+    thread_local BlobPoolCache ThreadBlobPool;
+
+    BlobPoolShared& GetBlobPool()
+    {
+        // Lazy-init to support static Variant constants (chunks are never released)
+        static BlobPoolShared pool;
+        return pool;
+    }
+
+    FORCE_INLINE int32 GetBlobPoolClass(int32 length)
+    {
+        return (length - 1) / BlobPoolGranularity;
+    }
+
+    void RefillBlobPool(BlobPoolCache& cache, int32 index)
+    {
+        BlobPoolShared& pool = GetBlobPool();
+        ScopeLock lock(pool.Locker);
+        BlobPoolBlock*& free = pool.Free[index];
+        if (!free)
+        {
+            // Split a new chunk into blocks
+            const int32 blockSize = (index + 1) * BlobPoolGranularity;
+            byte* chunk = (byte*)Allocator::Allocate(VARIANT_BLOB_POOL_CHUNK_SIZE);
+            for (int32 i = VARIANT_BLOB_POOL_CHUNK_SIZE / blockSize - 1; i >= 0; i--)
+            {
+                auto block = (BlobPoolBlock*)(chunk + i * blockSize);
+                block->Next = free;
+                free = block;
+            }
+        }
+        int32 count = 0;
+        while (free && count < VARIANT_BLOB_POOL_THREAD_CACHE / 2)
+        {
+            BlobPoolBlock* block = free;
+            free = block->Next;
+            block->Next = cache.Free[index];
+            cache.Free[index] = block;
+            count++;
+        }
+        cache.Count[index] += count;
+    }
+
+    void ReleaseBlobPool(BlobPoolCache& cache, int32 index, int32 keepCount = VARIANT_BLOB_POOL_THREAD_CACHE / 2)
+    {
+        BlobPoolShared& pool = GetBlobPool();
+        ScopeLock lock(pool.Locker);
+        while (cache.Count[index] > keepCount)
+        {
+            BlobPoolBlock* block = cache.Free[index];
+            cache.Free[index] = block->Next;
+            block->Next = pool.Free[index];
+            pool.Free[index] = block;
+            cache.Count[index]--;
+        }
+    }
+
+    BlobPoolCache::~BlobPoolCache()
+    {
+        for (int32 index = 0; index < BlobPoolClasses; index++)
+        {
+            if (Count[index] > 0)
+                ReleaseBlobPool(*this, index, 0);
+        }
+    }
+}
+
 static_assert(sizeof(VariantType) <= 16, "Invalid VariantType size!");
 static_assert((int32)VariantType::Types::MAX == ARRAY_COUNT(InBuiltTypesTypeNames), "Invalid amount of in-built types infos!");
 
@@ -674,7 +776,7 @@ Variant::Variant(const StringView& v)
     if (v.Length() > 0)
     {
         const int32 length = v.Length() * sizeof(Char) + 2;
-        AsBlob.Data = Allocator::Allocate(length);
+        AsBlob.Data = AllocateBlob(length);
         AsBlob.Length = length;
         Platform::MemoryCopy(AsBlob.Data, v.Get(), length);
         ((Char*)AsBlob.Data)[v.Length()] = 0;
@@ -692,7 +794,7 @@ Variant::Variant(const StringAnsiView& v)
     if (v.Length() > 0)
     {
         const int32 length = v.Length() * sizeof(Char) + 2;
-        AsBlob.Data = Allocator::Allocate(length);
+        AsBlob.Data = AllocateBlob(length);
         AsBlob.Length = length;
         int32 tmp;
         StringUtils::ConvertANSI2UTF16(v.Get(), (Char*)AsBlob.Data, v.Length(), tmp);
@@ -755,7 +857,7 @@ Variant::Variant(const Double4& v)
     : Type(VariantType::Double4)
 {
     AsBlob.Length = sizeof(Double4);
-    AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+    AsBlob.Data = AllocateBlob(AsBlob.Length);
     *(Double4*)AsBlob.Data = v;
 }
 
@@ -794,7 +896,7 @@ Variant::Variant(const BoundingSphere& v)
 {
 #if USE_LARGE_WORLDS
     AsBlob.Length = sizeof(BoundingSphere);
-    AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+    AsBlob.Data = AllocateBlob(AsBlob.Length);
     *(BoundingSphere*)AsBlob.Data = v;
 #else
     *(BoundingSphere*)AsData = v;
@@ -812,7 +914,7 @@ Variant::Variant(const BoundingBox& v)
 {
 #if USE_LARGE_WORLDS
     AsBlob.Length = sizeof(BoundingBox);
-    AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+    AsBlob.Data = AllocateBlob(AsBlob.Length);
     *(BoundingBox*)AsBlob.Data = v;
 #else
     *(BoundingBox*)AsData = v;
@@ -823,7 +925,7 @@ Variant::Variant(const Transform& v)
     : Type(VariantType::Transform)
 {
     AsBlob.Length = sizeof(Transform);
-    AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+    AsBlob.Data = AllocateBlob(AsBlob.Length);
     *(Transform*)AsBlob.Data = v;
 }
 
@@ -832,7 +934,7 @@ Variant::Variant(const Ray& v)
 {
 #if USE_LARGE_WORLDS
     AsBlob.Length = sizeof(Ray);
-    AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+    AsBlob.Data = AllocateBlob(AsBlob.Length);
     *(Ray*)AsBlob.Data = v;
 #else
     *(Ray*)AsData = v;
@@ -843,7 +945,7 @@ Variant::Variant(const Matrix& v)
     : Type(VariantType::Matrix)
 {
     AsBlob.Length = sizeof(Matrix);
-    AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+    AsBlob.Data = AllocateBlob(AsBlob.Length);
     *(Matrix*)AsBlob.Data = v;
 }
 
@@ -879,7 +981,7 @@ Variant::Variant(const Span<byte>& v)
     AsBlob.Length = v.Length();
     if (AsBlob.Length > 0)
     {
-        AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+        AsBlob.Data = AllocateBlob(AsBlob.Length);
         Platform::MemoryCopy(AsBlob.Data, v.Get(), AsBlob.Length);
     }
     else
@@ -985,7 +1087,7 @@ Variant::~Variant()
     case VariantType::BoundingBox:
     case VariantType::Ray:
 #endif
-        Allocator::Free(AsBlob.Data);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
         break;
     case VariantType::Array:
         reinterpret_cast<Array<Variant, HeapAllocation>*>(AsData)->~Array<Variant, HeapAllocation>();
@@ -1086,14 +1188,14 @@ Variant& Variant::operator=(const Variant& other)
         {
             if (!AsBlob.Data || AsBlob.Length != other.AsBlob.Length)
             {
-                Allocator::Free(AsBlob.Data);
-                AsBlob.Data = Allocator::Allocate(other.AsBlob.Length);
+                FreeBlob(AsBlob.Data, AsBlob.Length);
+                AsBlob.Data = AllocateBlob(other.AsBlob.Length);
             }
             Platform::MemoryCopy(AsBlob.Data, other.AsBlob.Data, other.AsBlob.Length);
         }
         else if (AsBlob.Data)
         {
-            Allocator::Free(AsBlob.Data);
+            FreeBlob(AsBlob.Data, AsBlob.Length);
             AsBlob.Data = nullptr;
         }
         AsBlob.Length = other.AsBlob.Length;
@@ -2376,7 +2478,7 @@ void Variant::SetType(const VariantType& type)
     case VariantType::BoundingBox:
     case VariantType::Ray:
 #endif
-        Allocator::Free(AsBlob.Data);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
         break;
     case VariantType::Array:
         reinterpret_cast<Array<Variant, HeapAllocation>*>(AsData)->~Array<Variant, HeapAllocation>();
@@ -2411,29 +2513,29 @@ void Variant::SetType(const VariantType& type)
         AsAsset = nullptr;
         break;
     case VariantType::Double4:
-        AsBlob.Data = Allocator::Allocate(sizeof(Double4));
+        AsBlob.Data = AllocateBlob(sizeof(Double4));
         AsBlob.Length = sizeof(Double4);
         break;
 #if USE_LARGE_WORLDS
     case VariantType::BoundingSphere:
-        AsBlob.Data = Allocator::Allocate(sizeof(BoundingSphere));
+        AsBlob.Data = AllocateBlob(sizeof(BoundingSphere));
         AsBlob.Length = sizeof(BoundingSphere);
         break;
     case VariantType::BoundingBox:
-        AsBlob.Data = Allocator::Allocate(sizeof(BoundingBox));
+        AsBlob.Data = AllocateBlob(sizeof(BoundingBox));
         AsBlob.Length = sizeof(BoundingBox);
         break;
     case VariantType::Ray:
-        AsBlob.Data = Allocator::Allocate(sizeof(Ray));
+        AsBlob.Data = AllocateBlob(sizeof(Ray));
         AsBlob.Length = sizeof(Ray);
         break;
 #endif
     case VariantType::Transform:
-        AsBlob.Data = Allocator::Allocate(sizeof(Transform));
+        AsBlob.Data = AllocateBlob(sizeof(Transform));
         AsBlob.Length = sizeof(Transform);
         break;
     case VariantType::Matrix:
-        AsBlob.Data = Allocator::Allocate(sizeof(Matrix));
+        AsBlob.Data = AllocateBlob(sizeof(Matrix));
         AsBlob.Length = sizeof(Matrix);
         break;
     case VariantType::Array:
@@ -2490,7 +2592,7 @@ void Variant::SetType(VariantType&& type)
     case VariantType::BoundingBox:
     case VariantType::Ray:
 #endif
-        Allocator::Free(AsBlob.Data);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
         break;
     case VariantType::Array:
         reinterpret_cast<Array<Variant, HeapAllocation>*>(AsData)->~Array<Variant, HeapAllocation>();
@@ -2525,29 +2627,29 @@ void Variant::SetType(VariantType&& type)
         AsAsset = nullptr;
         break;
     case VariantType::Double4:
-        AsBlob.Data = Allocator::Allocate(sizeof(Double4));
+        AsBlob.Data = AllocateBlob(sizeof(Double4));
         AsBlob.Length = sizeof(Double4);
         break;
 #if USE_LARGE_WORLDS
     case VariantType::BoundingSphere:
-        AsBlob.Data = Allocator::Allocate(sizeof(BoundingSphere));
+        AsBlob.Data = AllocateBlob(sizeof(BoundingSphere));
         AsBlob.Length = sizeof(BoundingSphere);
         break;
     case VariantType::BoundingBox:
-        AsBlob.Data = Allocator::Allocate(sizeof(BoundingBox));
+        AsBlob.Data = AllocateBlob(sizeof(BoundingBox));
         AsBlob.Length = sizeof(BoundingBox);
         break;
     case VariantType::Ray:
-        AsBlob.Data = Allocator::Allocate(sizeof(Ray));
+        AsBlob.Data = AllocateBlob(sizeof(Ray));
         AsBlob.Length = sizeof(Ray);
         break;
 #endif
     case VariantType::Transform:
-        AsBlob.Data = Allocator::Allocate(sizeof(Transform));
+        AsBlob.Data = AllocateBlob(sizeof(Transform));
         AsBlob.Length = sizeof(Transform);
         break;
     case VariantType::Matrix:
-        AsBlob.Data = Allocator::Allocate(sizeof(Matrix));
+        AsBlob.Data = AllocateBlob(sizeof(Matrix));
         AsBlob.Length = sizeof(Matrix);
         break;
     case VariantType::Array:
@@ -2573,7 +2675,7 @@ void Variant::SetString(const StringView& str)
     SetType(VariantType(VariantType::String));
     if (str.Length() <= 0)
     {
-        Allocator::Free(AsBlob.Data);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
         AsBlob.Data = nullptr;
         AsBlob.Length = 0;
         return;
@@ -2581,8 +2683,8 @@ void Variant::SetString(const StringView& str)
     const int32 length = str.Length() * sizeof(Char) + 2;
     if (AsBlob.Length != length)
     {
-        Allocator::Free(AsBlob.Data);
-        AsBlob.Data = Allocator::Allocate(length);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
+        AsBlob.Data = AllocateBlob(length);
         AsBlob.Length = length;
     }
     Platform::MemoryCopy(AsBlob.Data, str.Get(), length);
@@ -2594,7 +2696,7 @@ void Variant::SetString(const StringAnsiView& str)
     SetType(VariantType(VariantType::String));
     if (str.Length() <= 0)
     {
-        Allocator::Free(AsBlob.Data);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
         AsBlob.Data = nullptr;
         AsBlob.Length = 0;
         return;
@@ -2602,8 +2704,8 @@ void Variant::SetString(const StringAnsiView& str)
     const int32 length = str.Length() * sizeof(Char) + 2;
     if (AsBlob.Length != length)
     {
-        Allocator::Free(AsBlob.Data);
-        AsBlob.Data = Allocator::Allocate(length);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
+        AsBlob.Data = AllocateBlob(length);
         AsBlob.Length = length;
     }
     int32 tmp;
@@ -2616,7 +2718,7 @@ void Variant::SetTypename(const StringView& typeName)
     SetType(VariantType(VariantType::Typename));
     if (typeName.Length() <= 0)
     {
-        Allocator::Free(AsBlob.Data);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
         AsBlob.Data = nullptr;
         AsBlob.Length = 0;
         return;
@@ -2624,8 +2726,8 @@ void Variant::SetTypename(const StringView& typeName)
     const int32 length = typeName.Length() + 1;
     if (AsBlob.Length != length)
     {
-        Allocator::Free(AsBlob.Data);
-        AsBlob.Data = Allocator::Allocate(length);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
+        AsBlob.Data = AllocateBlob(length);
         AsBlob.Length = length;
     }
     StringUtils::ConvertUTF162ANSI(typeName.Get(), (char*)AsBlob.Data, typeName.Length());
@@ -2637,7 +2739,7 @@ void Variant::SetTypename(const StringAnsiView& typeName)
     SetType(VariantType(VariantType::Typename));
     if (typeName.Length() <= 0)
     {
-        Allocator::Free(AsBlob.Data);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
         AsBlob.Data = nullptr;
         AsBlob.Length = 0;
         return;
@@ -2645,8 +2747,8 @@ void Variant::SetTypename(const StringAnsiView& typeName)
     const int32 length = typeName.Length() + 1;
     if (AsBlob.Length != length)
     {
-        Allocator::Free(AsBlob.Data);
-        AsBlob.Data = Allocator::Allocate(length);
+        FreeBlob(AsBlob.Data, AsBlob.Length);
+        AsBlob.Data = AllocateBlob(length);
         AsBlob.Length = length;
     }
     Platform::MemoryCopy(AsBlob.Data, typeName.Get(), length);
@@ -2658,8 +2760,8 @@ void Variant::SetBlob(int32 length)
     SetType(VariantType(VariantType::Blob));
     if (AsBlob.Length != length)
     {
-        Allocator::Free(AsBlob.Data);
-        AsBlob.Data = length > 0 ? Allocator::Allocate(length) : nullptr;
+        FreeBlob(AsBlob.Data, AsBlob.Length);
+        AsBlob.Data = AllocateBlob(length);
         AsBlob.Length = length;
     }
 }
@@ -4028,6 +4130,40 @@ void Variant::OnAssetUnloaded(Asset* obj)
     AsAsset = nullptr;
 }
 
+void* Variant::AllocateBlob(int32 length)
+{
+    if (length <= 0)
+        return nullptr;
+    if (length > VARIANT_BLOB_POOL_MAX_SIZE)
+        return Allocator::Allocate(length);
+    const int32 index = GetBlobPoolClass(length);
+    BlobPoolCache& cache = ThreadBlobPool;
+    if (!cache.Free[index])
+        RefillBlobPool(cache, index);
+    BlobPoolBlock* block = cache.Free[index];
+    cache.Free[index] = block->Next;
+    cache.Count[index]--;
+    return block;
+}
+
+void Variant::FreeBlob(void* data, int32 length)
+{
+    if (!data)
+        return;
+    if (length <= 0 || length > VARIANT_BLOB_POOL_MAX_SIZE)
+    {
+        Allocator::Free(data);
+        return;
+    }
+    const int32 index = GetBlobPoolClass(length);
+    BlobPoolCache& cache = ThreadBlobPool;
+    auto block = (BlobPoolBlock*)data;
+    block->Next = cache.Free[index];
+    cache.Free[index] = block;
+    if (++cache.Count[index] > VARIANT_BLOB_POOL_THREAD_CACHE)
+        ReleaseBlobPool(cache, index);
+}
+
 void Variant::AllocStructure()
 {
     const StringAnsiView typeName(Type.TypeName);
@@ -4036,7 +4172,7 @@ void Variant::AllocStructure()
     {
         const ScriptingType& type = typeHandle.GetType();
         AsBlob.Length = type.Size;
-        AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+        AsBlob.Data = AllocateBlob(AsBlob.Length);
         Platform::MemoryClear(AsBlob.Data, AsBlob.Length);
         type.Struct.Ctor(AsBlob.Data);
     }
@@ -4045,7 +4181,7 @@ void Variant::AllocStructure()
         // [Deprecated on 10.05.2021, expires on 10.05.2023]
         // Hack for 16bit int
         AsBlob.Length = 2;
-        AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+        AsBlob.Data = AllocateBlob(AsBlob.Length);
         *((int16*)AsBlob.Data) = 0;
     }
 #if USE_CSHARP
@@ -4060,7 +4196,7 @@ void Variant::AllocStructure()
             void* data = MCore::Object::Unbox(instance);
             int32 instanceSize = mclass->GetInstanceSize();
             AsBlob.Length = instanceSize - (int32)((uintptr)data - (uintptr)instance);
-            AsBlob.Data = Allocator::Allocate(AsBlob.Length);
+            AsBlob.Data = AllocateBlob(AsBlob.Length);
             Platform::MemoryCopy(AsBlob.Data, data, AsBlob.Length);
 #else
             Type.Type = VariantType::ManagedObject;
@@ -4129,7 +4265,7 @@ void Variant::FreeStructure()
         const ScriptingType& type = typeHandle.GetType();
         type.Struct.Dtor(AsBlob.Data);
     }
-    Allocator::Free(AsBlob.Data);
+    FreeBlob(AsBlob.Data, AsBlob.Length);
 }
 
 uint32 GetHash(const Variant& key)
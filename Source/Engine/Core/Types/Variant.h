@@ -410,6 +410,20 @@ API_STRUCT(InBuild) struct FLAXENGINE_API Variant
         return MoveTemp(v);
     }
 
+    /// <summary>
+    /// Allocates the memory for the blob data (AsBlob). Small blocks are served from the pool to avoid heap allocations for boxed values (eg. short strings, matrices or small structures).
+    /// </summary>
+    /// <param name="length">The size of the data (in bytes).</param>
+    /// <returns>The allocated memory or null if length is zero.</returns>
+    static void* AllocateBlob(int32 length);
+
+    /// <summary>
+    /// Frees the memory allocated via AllocateBlob.
+    /// </summary>
+    /// <param name="data">The allocated memory.</param>
+    /// <param name="length">The size of the data (in bytes), must match the size used to allocate it.</param>
+    static void FreeBlob(void* data, int32 length);
+
     static bool CanCast(const Variant& v, const VariantType& to);
     static Variant Cast(const Variant& v, const VariantType& to);
     static bool NearEqual(const Variant& a, const Variant& b, float epsilon = 1e-6f);
@@ -9,6 +9,7 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Core/Math/OrientedBoundingBox.h"
+#include "Engine/Core/Math/Matrix3x4.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Graphics/GPUContext.h"
@@ -22,6 +23,8 @@
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Animations/AnimationUtils.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadLocal.h"
 #include "Engine/Debug/DebugLog.h"
 #include "Engine/Render2D/Render2D.h"
 #include "Engine/Render2D/FontAsset.h"
@@ -33,6 +36,7 @@
 
 // Debug draw service configuration
 #define DEBUG_DRAW_INITIAL_VB_CAPACITY (4 * 1024)
+#define DEBUG_DRAW_INITIAL_SHAPES_VB_CAPACITY (256)
 //
 #define DEBUG_DRAW_SPHERE_LOD0_RESOLUTION 64
 #define DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE 0.2f
@@ -101,6 +105,26 @@ struct DebugGeometryBuffer
     Matrix Transform;
 };
 
+enum class DebugShapeType
+{
+    WireBox,
+    WireSphereLOD0,
+    WireSphereLOD1,
+    WireSphereLOD2,
+    MAX
+};
+
+// Debug shape drawn with instancing (unit shape geometry is shared by all instances)
+struct DebugShape
+{
+    Matrix3x4 Transform;
+    Color32 Color;
+    float TimeLeft;
+};
+
+// Size of the shape instance data in the vertex buffer (transformation and color)
+#define DEBUG_DRAW_SHAPE_INSTANCE_STRIDE (sizeof(Matrix3x4) + sizeof(Color32))
+
 struct DebugTriangle
 {
     Float3 V0;
@@ -185,17 +209,20 @@ struct PsData
 };
 
 template<typename T>
-void UpdateList(float dt, Array<T>& list)
+bool UpdateList(float dt, Array<T>& list)
 {
+    bool removed = false;
     for (int32 i = 0; i < list.Count() && list.HasItems(); i++)
     {
         list[i].TimeLeft -= dt;
         if (list[i].TimeLeft <= 0)
         {
             list.RemoveAt(i);
+            removed = true;
             i--;
         }
     }
+    return removed;
 }
 
 void TeleportList(const Float3& delta, Array<DebugLine>& list)
@@ -233,6 +260,16 @@ void TeleportList(const Float3& delta, Array<DebugText3D>& list)
     }
 }
 
+void TeleportList(const Float3& delta, Array<DebugShape>& list)
+{
+    for (auto& v : list)
+    {
+        v.Transform.Values[0][3] += delta.X;
+        v.Transform.Values[1][3] += delta.Y;
+        v.Transform.Values[2][3] += delta.Z;
+    }
+}
+
 struct DebugDrawData
 {
     Array<DebugGeometryBuffer> GeometryBuffers;
@@ -246,10 +283,16 @@ struct DebugDrawData
     Array<DebugText2D> OneFrameText2D;
     Array<DebugText3D> DefaultText3D;
     Array<DebugText3D> OneFrameText3D;
+    Array<DebugShape> DefaultShapes[(int32)DebugShapeType::MAX];
+    Array<DebugShape> OneFrameShapes[(int32)DebugShapeType::MAX];
+
+    // Shapes with duration are kept in the persistent GPU buffers that are updated only after those lists get modified
+    bool PersistentDirty = true;
+    int32 PersistentCount = 0;
 
     inline int32 Count() const
     {
-        return LinesCount() + TrianglesCount() + TextCount() + GeometryBuffers.Count();
+        return LinesCount() + TrianglesCount() + TextCount() + ShapesCount() + GeometryBuffers.Count();
     }
 
     inline int32 LinesCount() const
@@ -267,6 +310,36 @@ struct DebugDrawData
         return DefaultText2D.Count() + OneFrameText2D.Count() + DefaultText3D.Count() + OneFrameText3D.Count();
     }
 
+    inline int32 ShapesCount() const
+    {
+        int32 result = 0;
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+            result += DefaultShapes[i].Count() + OneFrameShapes[i].Count();
+        return result;
+    }
+
+    inline int32 PersistentItemsCount() const
+    {
+        int32 result = DefaultLines.Count() + DefaultTriangles.Count() + DefaultWireTriangles.Count();
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+            result += DefaultShapes[i].Count();
+        return result;
+    }
+
+    FORCE_INLINE bool IsPersistentDirty() const
+    {
+        // Items are only appended to the lists so the count change detects the new items (removal is tracked with a flag)
+        return PersistentDirty || PersistentCount != PersistentItemsCount();
+    }
+
+    inline void AddShape(DebugShapeType type, const Matrix& transform, const Color& color, float duration)
+    {
+        DebugShape& shape = (duration > 0 ? DefaultShapes : OneFrameShapes)[(int32)type].AddOne();
+        shape.Transform.SetMatrixTranspose(transform);
+        shape.Color = Color32(color);
+        shape.TimeLeft = duration;
+    }
+
     inline void Add(const DebugTriangle& t)
     {
         if (t.TimeLeft > 0)
@@ -286,9 +359,11 @@ struct DebugDrawData
     inline void Update(float deltaTime)
     {
         UpdateList(deltaTime, GeometryBuffers);
-        UpdateList(deltaTime, DefaultLines);
-        UpdateList(deltaTime, DefaultTriangles);
-        UpdateList(deltaTime, DefaultWireTriangles);
+        PersistentDirty |= UpdateList(deltaTime, DefaultLines);
+        PersistentDirty |= UpdateList(deltaTime, DefaultTriangles);
+        PersistentDirty |= UpdateList(deltaTime, DefaultWireTriangles);
+        for (auto& shapes : DefaultShapes)
+            PersistentDirty |= UpdateList(deltaTime, shapes);
         UpdateList(deltaTime, DefaultText2D);
         UpdateList(deltaTime, DefaultText3D);
 
@@ -297,6 +372,30 @@ struct DebugDrawData
         OneFrameWireTriangles.Clear();
         OneFrameText2D.Clear();
         OneFrameText3D.Clear();
+        for (auto& shapes : OneFrameShapes)
+            shapes.Clear();
+    }
+
+    void Append(DebugDrawData& other)
+    {
+        GeometryBuffers.Add(other.GeometryBuffers);
+        DefaultLines.Add(other.DefaultLines);
+        OneFrameLines.Add(other.OneFrameLines);
+        DefaultTriangles.Add(other.DefaultTriangles);
+        OneFrameTriangles.Add(other.OneFrameTriangles);
+        DefaultWireTriangles.Add(other.DefaultWireTriangles);
+        OneFrameWireTriangles.Add(other.OneFrameWireTriangles);
+        DefaultText2D.Add(other.DefaultText2D);
+        OneFrameText2D.Add(other.OneFrameText2D);
+        DefaultText3D.Add(other.DefaultText3D);
+        OneFrameText3D.Add(other.OneFrameText3D);
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+        {
+            DefaultShapes[i].Add(other.DefaultShapes[i]);
+            OneFrameShapes[i].Add(other.OneFrameShapes[i]);
+        }
+        other.GeometryBuffers.Clear();
+        other.Clear();
     }
 
     void Teleport(const Float3& delta)
@@ -309,6 +408,12 @@ struct DebugDrawData
         TeleportList(delta, OneFrameWireTriangles);
         TeleportList(delta, DefaultText3D);
         TeleportList(delta, OneFrameText3D);
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+        {
+            TeleportList(delta, DefaultShapes[i]);
+            TeleportList(delta, OneFrameShapes[i]);
+        }
+        PersistentDirty = true;
     }
 
     inline void Clear()
@@ -323,6 +428,12 @@ struct DebugDrawData
         OneFrameText2D.Clear();
         DefaultText3D.Clear();
         OneFrameText3D.Clear();
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+        {
+            DefaultShapes[i].Clear();
+            OneFrameShapes[i].Clear();
+        }
+        PersistentDirty = true;
     }
 
     inline void Release()
@@ -337,6 +448,34 @@ struct DebugDrawData
         OneFrameText2D.Resize(0);
         DefaultText3D.Resize(0);
         OneFrameText3D.Resize(0);
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+        {
+            DefaultShapes[i].Resize(0);
+            OneFrameShapes[i].Resize(0);
+        }
+        PersistentDirty = true;
+    }
+};
+
+struct DebugDrawCall
+{
+    int32 StartVertex;
+    int32 VertexCount;
+};
+
+struct DebugDrawPass
+{
+    DebugDrawCall Lines;
+    DebugDrawCall Triangles;
+    DebugDrawCall WireTriangles;
+    DebugDrawCall Shapes[(int32)DebugShapeType::MAX]; // Range of instances in the shapes buffer
+
+    inline int32 Count() const
+    {
+        int32 result = Lines.VertexCount + Triangles.VertexCount + WireTriangles.VertexCount;
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+            result += Shapes[i].VertexCount;
+        return result;
     }
 };
 
@@ -347,6 +486,32 @@ struct DebugDrawContext
     DebugDrawData DebugDrawDepthTest;
     Float3 LastViewPos = Float3::Zero;
     Matrix LastViewProj = Matrix::Identity;
+
+    // Persistent buffers with shapes that have duration (for depth test and default passes)
+    DynamicVertexBuffer* PersistentVB = nullptr;
+    DynamicVertexBuffer* PersistentShapesVB = nullptr;
+    DebugDrawPass PersistentDepthTest = {};
+    DebugDrawPass PersistentDefault = {};
+
+    ~DebugDrawContext()
+    {
+        ReleaseBuffers();
+    }
+
+    void ReleaseBuffers()
+    {
+        SAFE_DELETE(PersistentVB);
+        SAFE_DELETE(PersistentShapesVB);
+        DebugDrawDefault.PersistentDirty = true;
+        DebugDrawDepthTest.PersistentDirty = true;
+    }
+};
+
+// Context used to record debug shapes by the non-main threads (eg. jobs) which gets merged into the global context on the main thread
+struct DebugDrawThreadContext
+{
+    CriticalSection Locker;
+    DebugDrawContext Context;
 };
 
 namespace
@@ -361,10 +526,19 @@ namespace
     PsData DebugDrawPsWireTrianglesDepthTest;
     PsData DebugDrawPsTrianglesDefault;
     PsData DebugDrawPsTrianglesDepthTest;
+    PsData DebugDrawPsShapesDefault;
+    PsData DebugDrawPsShapesDepthTest;
     DynamicVertexBuffer* DebugDrawVB = nullptr;
+    DynamicVertexBuffer* DebugDrawShapesVB = nullptr;
+    GPUBuffer* DebugDrawShapesGeometryVB = nullptr;
+    int32 ShapeStartVertex[(int32)DebugShapeType::MAX];
+    int32 ShapeVertexCount[(int32)DebugShapeType::MAX];
     Float3 CircleCache[DEBUG_DRAW_CIRCLE_VERTICES];
     Array<Float3> SphereTriangleCache;
     DebugSphereCache SphereCache[3];
+    CriticalSection ThreadContextsLocker;
+    Array<DebugDrawThreadContext*> ThreadContexts;
+    ThreadLocal<DebugDrawThreadContext*> CurrentThreadContext;
 
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj)
@@ -375,11 +549,78 @@ namespace
         DebugDrawPsWireTrianglesDepthTest.Release();
         DebugDrawPsTrianglesDefault.Release();
         DebugDrawPsTrianglesDepthTest.Release();
+        DebugDrawPsShapesDefault.Release();
+        DebugDrawPsShapesDepthTest.Release();
     }
 
 #endif
+
+    DebugDrawThreadContext* GetThreadContext()
+    {
+        DebugDrawThreadContext*& result = CurrentThreadContext.Get();
+        if (!result)
+        {
+            result = New<DebugDrawThreadContext>();
+            ScopeLock lock(ThreadContextsLocker);
+            result->Context.Origin = GlobalContext.Origin;
+            ThreadContexts.Add(result);
+        }
+        return result;
+    }
+
+    void MergeThreadContexts()
+    {
+        PROFILE_CPU();
+        ScopeLock lock(ThreadContextsLocker);
+        for (DebugDrawThreadContext* threadContext : ThreadContexts)
+        {
+            ScopeLock threadLock(threadContext->Locker);
+            DebugDrawContext& context = threadContext->Context;
+            if (context.Origin != GlobalContext.Origin)
+            {
+                const Float3 delta = context.Origin - GlobalContext.Origin;
+                context.DebugDrawDefault.Teleport(delta);
+                context.DebugDrawDepthTest.Teleport(delta);
+                context.Origin = GlobalContext.Origin;
+            }
+            context.LastViewPos = GlobalContext.LastViewPos;
+            context.LastViewProj = GlobalContext.LastViewProj;
+            GlobalContext.DebugDrawDefault.Append(context.DebugDrawDefault);
+            GlobalContext.DebugDrawDepthTest.Append(context.DebugDrawDepthTest);
+        }
+    }
+};
+
+// Provides the context to record debug shapes into. Main thread uses the current context while other threads write into own buffers to not block each other.
+struct DebugDrawScope
+{
+    DebugDrawContext* Target;
+    CriticalSection* Locker = nullptr;
+
+    DebugDrawScope()
+    {
+        if (IsInMainThread())
+        {
+            Target = Context;
+            return;
+        }
+        DebugDrawThreadContext* threadContext = GetThreadContext();
+        Locker = &threadContext->Locker;
+        Locker->Lock();
+        Target = &threadContext->Context;
+    }
+
+    ~DebugDrawScope()
+    {
+        if (Locker)
+            Locker->Unlock();
+    }
 };
 
+#define DEBUG_DRAW_CONTEXT() \
+    const DebugDrawScope debugDrawScope; \
+    DebugDrawContext* context = debugDrawScope.Target
+
 extern int32 BoxTrianglesIndicesCache[];
 
 int32 BoxLineIndicesCache[] =
@@ -400,29 +641,23 @@ int32 BoxLineIndicesCache[] =
     // @formatter:on
 };
 
-struct DebugDrawCall
-{
-    int32 StartVertex;
-    int32 VertexCount;
-};
-
-DebugDrawCall WriteList(int32& vertexCounter, const Array<Vertex>& list)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& vertexCounter, const Array<Vertex>& list)
 {
     DebugDrawCall drawCall;
     drawCall.StartVertex = vertexCounter;
     drawCall.VertexCount = list.Count();
-    DebugDrawVB->Write(list.Get(), sizeof(Vertex) * drawCall.VertexCount);
+    vb->Write(list.Get(), sizeof(Vertex) * drawCall.VertexCount);
     vertexCounter += drawCall.VertexCount;
     return drawCall;
 }
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugLine>& list)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& vertexCounter, const Array<DebugLine>& list)
 {
     DebugDrawCall drawCall;
     drawCall.StartVertex = vertexCounter;
     drawCall.VertexCount = list.Count() * 2;
     vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(list.Count() * 2);
+    Vertex* dst = vb->WriteReserve<Vertex>(list.Count() * 2);
     for (int32 i = 0, j = 0; i < list.Count(); i++)
     {
         const DebugLine& l = list.Get()[i];
@@ -432,13 +667,13 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugLine>& list)
     return drawCall;
 }
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& vertexCounter, const Array<DebugTriangle>& list)
 {
     DebugDrawCall drawCall;
     drawCall.StartVertex = vertexCounter;
     drawCall.VertexCount = list.Count() * 3;
     vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(list.Count() * 3);
+    Vertex* dst = vb->WriteReserve<Vertex>(list.Count() * 3);
     for (int32 i = 0, j = 0; i < list.Count(); i++)
     {
         const DebugTriangle& l = list.Get()[i];
@@ -449,24 +684,88 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
     return drawCall;
 }
 
-template<typename T, typename U>
-DebugDrawCall WriteLists(int32& vertexCounter, const Array<T>& listA, const Array<U>& listB)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& instanceCounter, const Array<DebugShape>& list)
 {
-    const DebugDrawCall drawCallA = WriteList(vertexCounter, listA);
-    const DebugDrawCall drawCallB = WriteList(vertexCounter, listB);
     DebugDrawCall drawCall;
-    drawCall.StartVertex = drawCallA.StartVertex;
-    drawCall.VertexCount = drawCallA.VertexCount + drawCallB.VertexCount;
+    drawCall.StartVertex = instanceCounter;
+    drawCall.VertexCount = list.Count();
+    instanceCounter += drawCall.VertexCount;
+    byte* dst = (byte*)vb->WriteReserve(list.Count() * DEBUG_DRAW_SHAPE_INSTANCE_STRIDE);
+    for (int32 i = 0; i < list.Count(); i++)
+    {
+        Platform::MemoryCopy(dst, &list.Get()[i], DEBUG_DRAW_SHAPE_INSTANCE_STRIDE);
+        dst += DEBUG_DRAW_SHAPE_INSTANCE_STRIDE;
+    }
     return drawCall;
 }
 
-FORCE_INLINE DebugTriangle* AppendTriangles(int32 count, float duration, bool depthTest)
+template<typename LineType>
+DebugDrawPass WritePass(DynamicVertexBuffer* vb, DynamicVertexBuffer* shapesVB, int32& vertexCounter, int32& instanceCounter, const Array<LineType>& lines, const Array<DebugTriangle>& triangles, const Array<DebugTriangle>& wireTriangles, const Array<DebugShape>* shapes)
+{
+    DebugDrawPass pass;
+    pass.Lines = WriteList(vb, vertexCounter, lines);
+    pass.Triangles = WriteList(vb, vertexCounter, triangles);
+    pass.WireTriangles = WriteList(vb, vertexCounter, wireTriangles);
+    for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+        pass.Shapes[i] = WriteList(shapesVB, instanceCounter, shapes[i]);
+    return pass;
+}
+
+void DrawPass(GPUContext* context, const DebugDrawPass& pass, GPUBuffer* vb, GPUBuffer* shapesVB, bool depthTestPs, bool depthWrite, bool depthTest)
+{
+    // Lines
+    if (pass.Lines.VertexCount)
+    {
+        auto state = depthTestPs ? &DebugDrawPsLinesDepthTest : &DebugDrawPsLinesDefault;
+        context->SetState(state->Get(depthWrite, depthTest));
+        context->BindVB(ToSpan(&vb, 1));
+        context->Draw(pass.Lines.StartVertex, pass.Lines.VertexCount);
+    }
+
+    // Wire Triangles
+    if (pass.WireTriangles.VertexCount)
+    {
+        auto state = depthTestPs ? &DebugDrawPsWireTrianglesDepthTest : &DebugDrawPsWireTrianglesDefault;
+        context->SetState(state->Get(depthWrite, depthTest));
+        context->BindVB(ToSpan(&vb, 1));
+        context->Draw(pass.WireTriangles.StartVertex, pass.WireTriangles.VertexCount);
+    }
+
+    // Triangles
+    if (pass.Triangles.VertexCount)
+    {
+        auto state = depthTestPs ? &DebugDrawPsTrianglesDepthTest : &DebugDrawPsTrianglesDefault;
+        context->SetState(state->Get(depthWrite, depthTest));
+        context->BindVB(ToSpan(&vb, 1));
+        context->Draw(pass.Triangles.StartVertex, pass.Triangles.VertexCount);
+    }
+
+    // Shapes (instanced)
+    bool shapesBound = false;
+    for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+    {
+        const DebugDrawCall& drawCall = pass.Shapes[i];
+        if (drawCall.VertexCount == 0)
+            continue;
+        if (!shapesBound)
+        {
+            shapesBound = true;
+            auto state = depthTestPs ? &DebugDrawPsShapesDepthTest : &DebugDrawPsShapesDefault;
+            context->SetState(state->Get(depthWrite, depthTest));
+            GPUBuffer* vbs[2] = { DebugDrawShapesGeometryVB, shapesVB };
+            context->BindVB(ToSpan(vbs, 2));
+        }
+        context->DrawInstanced(ShapeVertexCount[i], drawCall.VertexCount, drawCall.StartVertex, ShapeStartVertex[i]);
+    }
+}
+
+FORCE_INLINE DebugTriangle* AppendTriangles(DebugDrawContext* context, int32 count, float duration, bool depthTest)
 {
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     const int32 startIndex = list->Count();
     list->AddUninitialized(count);
     return list->Get() + startIndex;
@@ -621,6 +920,7 @@ void DebugDrawService::Update()
     // Special case for Null renderer
     if (GPUDevice::Instance->GetRendererType() == RendererType::Null)
     {
+        MergeThreadContexts();
         GlobalContext.DebugDrawDefault.Clear();
         GlobalContext.DebugDrawDepthTest.Clear();
         return;
@@ -636,6 +936,7 @@ void DebugDrawService::Update()
 #endif
     GlobalContext.DebugDrawDefault.Update(deltaTime);
     GlobalContext.DebugDrawDepthTest.Update(deltaTime);
+    MergeThreadContexts();
 
     // Lazy-init resources
     if (DebugDrawShader == nullptr)
@@ -681,15 +982,50 @@ void DebugDrawService::Update()
         desc.Wireframe = true;
         failed |= DebugDrawPsWireTrianglesDepthTest.Create(desc);
 
+        // Instanced shapes
+        desc.Wireframe = false;
+        desc.VS = shader->GetVS("VS_Instanced");
+        desc.PrimitiveTopology = PrimitiveTopologyType::Line;
+        desc.PS = shader->GetPS("PS", 0);
+        failed |= DebugDrawPsShapesDefault.Create(desc);
+        desc.PS = shader->GetPS("PS", 2);
+        failed |= DebugDrawPsShapesDepthTest.Create(desc);
+
         if (failed)
         {
             LOG(Fatal, "Cannot setup DebugDraw service!");
         }
     }
 
-    // Vertex buffer
+    // Vertex buffers
     if (DebugDrawVB == nullptr)
         DebugDrawVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(Vertex)), (uint32)sizeof(Vertex), TEXT("DebugDraw.VB"));
+    if (DebugDrawShapesVB == nullptr)
+        DebugDrawShapesVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_SHAPES_VB_CAPACITY * DEBUG_DRAW_SHAPE_INSTANCE_STRIDE), (uint32)DEBUG_DRAW_SHAPE_INSTANCE_STRIDE, TEXT("DebugDraw.ShapesVB"));
+    if (DebugDrawShapesGeometryVB == nullptr)
+    {
+        // Unit shapes geometry used by the instanced shapes
+        Array<Vertex> vertices;
+        const Color32 white = Color32::White;
+        Vector3 corners[8];
+        BoundingBox(Vector3(-0.5f), Vector3(0.5f)).GetCorners(corners);
+        ShapeStartVertex[(int32)DebugShapeType::WireBox] = vertices.Count();
+        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache); i++)
+            vertices.Add({ corners[BoxLineIndicesCache[i]], white });
+        for (int32 lod = 0; lod < ARRAY_COUNT(SphereCache); lod++)
+        {
+            ShapeStartVertex[(int32)DebugShapeType::WireSphereLOD0 + lod] = vertices.Count();
+            for (const Float3& v : SphereCache[lod].Vertices)
+                vertices.Add({ v, white });
+        }
+        for (int32 i = 0; i < (int32)DebugShapeType::MAX; i++)
+            ShapeVertexCount[i] = (i + 1 < (int32)DebugShapeType::MAX ? ShapeStartVertex[i + 1] : vertices.Count()) - ShapeStartVertex[i];
+        DebugDrawShapesGeometryVB = GPUDevice::Instance->CreateBuffer(TEXT("DebugDraw.ShapesGeometryVB"));
+        if (DebugDrawShapesGeometryVB->Init(GPUBufferDescription::Vertex(sizeof(Vertex), vertices.Count(), vertices.Get())))
+        {
+            LOG(Fatal, "Cannot setup DebugDraw service!");
+        }
+    }
 }
 
 void DebugDrawService::Dispose()
@@ -697,6 +1033,11 @@ void DebugDrawService::Dispose()
     // Clear lists
     GlobalContext.DebugDrawDefault.Release();
     GlobalContext.DebugDrawDepthTest.Release();
+    GlobalContext.ReleaseBuffers();
+    ThreadContextsLocker.Lock();
+    ThreadContexts.ClearDelete();
+    CurrentThreadContext.Clear();
+    ThreadContextsLocker.Unlock();
 
     // Release resources
     SphereTriangleCache.Resize(0);
@@ -706,7 +1047,11 @@ void DebugDrawService::Dispose()
     DebugDrawPsWireTrianglesDepthTest.Release();
     DebugDrawPsTrianglesDefault.Release();
     DebugDrawPsTrianglesDepthTest.Release();
+    DebugDrawPsShapesDefault.Release();
+    DebugDrawPsShapesDepthTest.Release();
     SAFE_DELETE(DebugDrawVB);
+    SAFE_DELETE(DebugDrawShapesVB);
+    SAFE_DELETE_GPU_RESOURCE(DebugDrawShapesGeometryVB);
     DebugDrawShader = nullptr;
 }
 
@@ -744,13 +1089,15 @@ void DebugDraw::SetContext(void* context)
 void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTextureView* depthBuffer, bool enableDepthTest)
 {
     PROFILE_GPU_CPU("Debug Draw");
+    if (Context == &GlobalContext)
+        MergeThreadContexts();
 
     // Ensure to have shader loaded and any lines to render
     const int32 debugDrawDepthTestCount = Context->DebugDrawDepthTest.Count();
     const int32 debugDrawDefaultCount = Context->DebugDrawDefault.Count();
     if (DebugDrawShader == nullptr || !DebugDrawShader->IsLoaded() || debugDrawDepthTestCount + debugDrawDefaultCount == 0 || DebugDrawPsWireTrianglesDepthTest.Depth == nullptr)
         return;
-    if (renderContext.Buffers == nullptr || !DebugDrawVB)
+    if (renderContext.Buffers == nullptr || !DebugDrawVB || !DebugDrawShapesGeometryVB)
         return;
     auto context = GPUDevice::Instance->GetMainContext();
     const RenderView& view = renderContext.View;
@@ -770,21 +1117,47 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     if (target == nullptr && renderContext.Task)
         target = renderContext.Task->GetOutputView();
 
+    // Upload shapes with duration only after they change (kept in the persistent buffers)
+    if (Context->DebugDrawDepthTest.IsPersistentDirty() || Context->DebugDrawDefault.IsPersistentDirty())
+    {
+        PROFILE_CPU_NAMED("Update Persistent Buffer");
+        if (!Context->PersistentVB)
+        {
+            Context->PersistentVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(Vertex)), (uint32)sizeof(Vertex), TEXT("DebugDraw.PersistentVB"));
+            Context->PersistentVB->Usage = GPUResourceUsage::Default;
+            Context->PersistentShapesVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_SHAPES_VB_CAPACITY * DEBUG_DRAW_SHAPE_INSTANCE_STRIDE), (uint32)DEBUG_DRAW_SHAPE_INSTANCE_STRIDE, TEXT("DebugDraw.PersistentShapesVB"));
+            Context->PersistentShapesVB->Usage = GPUResourceUsage::Default;
+        }
+        Context->PersistentVB->Clear();
+        Context->PersistentShapesVB->Clear();
+        int32 vertexCounter = 0, instanceCounter = 0;
+        const DebugDrawData& depthTestData = Context->DebugDrawDepthTest;
+        const DebugDrawData& defaultData = Context->DebugDrawDefault;
+        Context->PersistentDepthTest = WritePass(Context->PersistentVB, Context->PersistentShapesVB, vertexCounter, instanceCounter, depthTestData.DefaultLines, depthTestData.DefaultTriangles, depthTestData.DefaultWireTriangles, depthTestData.DefaultShapes);
+        Context->PersistentDefault = WritePass(Context->PersistentVB, Context->PersistentShapesVB, vertexCounter, instanceCounter, defaultData.DefaultLines, defaultData.DefaultTriangles, defaultData.DefaultWireTriangles, defaultData.DefaultShapes);
+        Context->PersistentVB->Flush(context);
+        Context->PersistentShapesVB->Flush(context);
+        Context->DebugDrawDepthTest.PersistentDirty = false;
+        Context->DebugDrawDepthTest.PersistentCount = depthTestData.PersistentItemsCount();
+        Context->DebugDrawDefault.PersistentDirty = false;
+        Context->DebugDrawDefault.PersistentCount = defaultData.PersistentItemsCount();
+    }
+
     // Fill vertex buffer and upload data
-    DebugDrawCall depthTestLines, defaultLines, depthTestTriangles, defaultTriangles, depthTestWireTriangles, defaultWireTriangles;
+    DebugDrawPass depthTestPass, defaultPass;
     {
         PROFILE_CPU_NAMED("Update Buffer");
         DebugDrawVB->Clear();
-        int32 vertexCounter = 0;
-        depthTestLines = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultLines, Context->DebugDrawDepthTest.OneFrameLines);
-        defaultLines = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultLines, Context->DebugDrawDefault.OneFrameLines);
-        depthTestTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultTriangles, Context->DebugDrawDepthTest.OneFrameTriangles);
-        defaultTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.OneFrameTriangles);
-        depthTestWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.OneFrameWireTriangles);
-        defaultWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.OneFrameWireTriangles);
+        DebugDrawShapesVB->Clear();
+        int32 vertexCounter = 0, instanceCounter = 0;
+        const DebugDrawData& depthTestData = Context->DebugDrawDepthTest;
+        const DebugDrawData& defaultData = Context->DebugDrawDefault;
+        depthTestPass = WritePass(DebugDrawVB, DebugDrawShapesVB, vertexCounter, instanceCounter, depthTestData.OneFrameLines, depthTestData.OneFrameTriangles, depthTestData.OneFrameWireTriangles, depthTestData.OneFrameShapes);
+        defaultPass = WritePass(DebugDrawVB, DebugDrawShapesVB, vertexCounter, instanceCounter, defaultData.OneFrameLines, defaultData.OneFrameTriangles, defaultData.OneFrameWireTriangles, defaultData.OneFrameShapes);
         {
             PROFILE_CPU_NAMED("Flush");
             DebugDrawVB->Flush(context);
+            DebugDrawShapesVB->Flush(context);
         }
     }
 
@@ -799,9 +1172,12 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     context->UpdateCB(cb, &data);
     context->BindCB(0, cb);
     auto vb = DebugDrawVB->GetBuffer();
+    auto shapesVB = DebugDrawShapesVB->GetBuffer();
+    auto persistentVB = Context->PersistentVB->GetBuffer();
+    auto persistentShapesVB = Context->PersistentShapesVB->GetBuffer();
 
     // Draw with depth test
-    if (depthTestLines.VertexCount + depthTestTriangles.VertexCount + depthTestWireTriangles.VertexCount > 0)
+    if (depthTestPass.Count() + Context->PersistentDepthTest.Count() > 0)
     {
         if (data.EnableDepthTest)
             context->BindSR(0, renderContext.Buffers->DepthBuffer);
@@ -809,32 +1185,8 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
 
         context->SetRenderTarget(depthBuffer ? depthBuffer : (data.EnableDepthTest ? nullptr : renderContext.Buffers->DepthBuffer->View()), target);
 
-        // Lines
-        if (depthTestLines.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsLinesDepthTest : &DebugDrawPsLinesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestLines.StartVertex, depthTestLines.VertexCount);
-        }
-
-        // Wire Triangles
-        if (depthTestWireTriangles.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsWireTrianglesDepthTest : &DebugDrawPsWireTrianglesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestWireTriangles.StartVertex, depthTestWireTriangles.VertexCount);
-        }
-
-        // Triangles
-        if (depthTestTriangles.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsTrianglesDepthTest : &DebugDrawPsTrianglesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestTriangles.StartVertex, depthTestTriangles.VertexCount);
-        }
+        DrawPass(context, Context->PersistentDepthTest, persistentVB, persistentShapesVB, data.EnableDepthTest, enableDepthWrite, true);
+        DrawPass(context, depthTestPass, vb, shapesVB, data.EnableDepthTest, enableDepthWrite, true);
 
         // Geometries
         for (auto& geometry : Context->DebugDrawDepthTest.GeometryBuffers)
@@ -857,33 +1209,12 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     }
 
     // Draw without depth
-    if (defaultLines.VertexCount + defaultTriangles.VertexCount + defaultWireTriangles.VertexCount > 0)
+    if (defaultPass.Count() + Context->PersistentDefault.Count() > 0)
     {
         context->SetRenderTarget(target);
 
-        // Lines
-        if (defaultLines.VertexCount)
-        {
-            context->SetState(DebugDrawPsLinesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultLines.StartVertex, defaultLines.VertexCount);
-        }
-
-        // Wire Triangles
-        if (defaultWireTriangles.VertexCount)
-        {
-            context->SetState(DebugDrawPsWireTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultWireTriangles.StartVertex, defaultWireTriangles.VertexCount);
-        }
-
-        // Triangles
-        if (defaultTriangles.VertexCount)
-        {
-            context->SetState(DebugDrawPsTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultTriangles.StartVertex, defaultTriangles.VertexCount);
-        }
+        DrawPass(context, Context->PersistentDefault, persistentVB, persistentShapesVB, false, false, false);
+        DrawPass(context, defaultPass, vb, shapesVB, false, false, false);
 
         // Geometries
         for (auto& geometry : Context->DebugDrawDefault.GeometryBuffers)
@@ -1048,8 +1379,9 @@ void DebugDraw::DrawRay(const Ray& ray, const Color& color, float length, float
 
 void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color& color, float duration, bool depthTest)
 {
-    const Float3 startF = start - Context->Origin, endF = end - Context->Origin;
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DEBUG_DRAW_CONTEXT();
+    const Float3 startF = start - context->Origin, endF = end - context->Origin;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { startF, endF, Color32(color), duration };
@@ -1066,8 +1398,9 @@ void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color&
 
 void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color& startColor, const Color& endColor, float duration, bool depthTest)
 {
-    const Float3 startF = start - Context->Origin, endF = end - Context->Origin;
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    DEBUG_DRAW_CONTEXT();
+    const Float3 startF = start - context->Origin, endF = end - context->Origin;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         // TODO: separate start/end colors for persistent lines
@@ -1086,6 +1419,7 @@ void DebugDraw::DrawLine(const Vector3& start, const Vector3& end, const Color&
 
 void DebugDraw::DrawLines(const Span<Float3>& lines, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     if (lines.Length() == 0)
         return;
     if (lines.Length() % 2 != 0)
@@ -1096,8 +1430,8 @@ void DebugDraw::DrawLines(const Span<Float3>& lines, const Matrix& transform, co
 
     // Draw lines
     const Float3* p = lines.Get();
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1125,6 +1459,7 @@ void DebugDraw::DrawLines(const Span<Float3>& lines, const Matrix& transform, co
 
 void DebugDraw::DrawLines(GPUBuffer* lines, const Matrix& transform, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     if (lines == nullptr || lines->GetSize() == 0)
         return;
     if (lines->GetSize() % (sizeof(Vertex) * 2) != 0)
@@ -1134,11 +1469,11 @@ void DebugDraw::DrawLines(GPUBuffer* lines, const Matrix& transform, float durat
     }
 
     // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     auto& geometry = debugDrawData.GeometryBuffers.AddOne();
     geometry.Buffer = lines;
     geometry.TimeLeft = duration;
-    geometry.Transform = transform * Matrix::Translation(-Context->Origin);
+    geometry.Transform = transform * Matrix::Translation(-context->Origin);
 }
 
 void DebugDraw::DrawLines(const Array<Float3>& lines, const Matrix& transform, const Color& color, float duration, bool depthTest)
@@ -1148,6 +1483,7 @@ void DebugDraw::DrawLines(const Array<Float3>& lines, const Matrix& transform, c
 
 void DebugDraw::DrawLines(const Span<Double3>& lines, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     if (lines.Length() == 0)
         return;
     if (lines.Length() % 2 != 0)
@@ -1158,8 +1494,8 @@ void DebugDraw::DrawLines(const Span<Double3>& lines, const Matrix& transform, c
 
     // Draw lines
     const Double3* p = lines.Get();
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1192,7 +1528,8 @@ void DebugDraw::DrawLines(const Array<Double3, HeapAllocation>& lines, const Mat
 
 void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3& p3, const Vector3& p4, const Color& color, float duration, bool depthTest)
 {
-    const Float3 p1F = p1 - Context->Origin, p2F = p2 - Context->Origin, p3F = p3 - Context->Origin, p4F = p4 - Context->Origin;
+    DEBUG_DRAW_CONTEXT();
+    const Float3 p1F = p1 - context->Origin, p2F = p2 - context->Origin, p3F = p3 - context->Origin, p4F = p4 - context->Origin;
 
     // Find amount of segments to use
     const Float3 d1 = p2F - p1F;
@@ -1203,7 +1540,7 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
     const float segmentCountInv = 1.0f / (float)segmentCount;
 
     // Draw segmented curve from lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { p1F, Float3::Zero, Color32(color), duration };
@@ -1236,48 +1573,27 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
 
 void DebugDraw::DrawWireBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
+    DEBUG_DRAW_CONTEXT();
+    const Float3 centerF = box.GetCenter() - context->Origin;
+    const Float3 sizeF = box.GetSize();
+    const Matrix world = Matrix::Scaling(sizeF) * Matrix::Translation(centerF);
 
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw instanced unit box
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
+    debugDrawData.AddShape(DebugShapeType::WireBox, world, color, duration);
 }
 
 void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     // Get corners
     Vector3 corners[8];
     frustum.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     if (duration > 0)
     {
         DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
@@ -1304,92 +1620,54 @@ void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& col
 
 void DebugDraw::DrawWireBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
+    DEBUG_DRAW_CONTEXT();
+    Transform transform = box.Transformation;
+    transform.Translation -= context->Origin;
+    Matrix world;
+    transform.GetWorld(world);
+    world = Matrix::Scaling(Float3(box.Extents * 2.0f)) * world;
 
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw instanced unit box
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
+    debugDrawData.AddShape(DebugShapeType::WireBox, world, color, duration);
 }
 
 void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     // Select LOD
     int32 index;
-    const Float3 centerF = sphere.Center - Context->Origin;
+    const Float3 centerF = sphere.Center - context->Origin;
     const float radiusF = (float)sphere.Radius;
-    const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(centerF, radiusF, Context->LastViewPos, Context->LastViewProj);
+    const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(centerF, radiusF, context->LastViewPos, context->LastViewProj);
     if (screenRadiusSquared > DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE * DEBUG_DRAW_SPHERE_LOD0_SCREEN_SIZE * 0.25f)
         index = 0;
     else if (screenRadiusSquared > DEBUG_DRAW_SPHERE_LOD1_SCREEN_SIZE * DEBUG_DRAW_SPHERE_LOD1_SCREEN_SIZE * 0.25f)
         index = 1;
     else
         index = 2;
-    auto& cache = SphereCache[index];
 
-    // Draw lines of the unit sphere after linear transform
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Start = centerF + cache.Vertices.Get()[i++] * radiusF;
-            l.End = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw instanced unit sphere
+    const Matrix world = Matrix::Scaling(radiusF) * Matrix::Translation(centerF);
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
+    debugDrawData.AddShape((DebugShapeType)((int32)DebugShapeType::WireSphereLOD0 + index), world, color, duration);
 }
 
 void DebugDraw::DrawSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
 
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     list->EnsureCapacity(list->Count() + SphereTriangleCache.Count());
 
-    const Float3 centerF = sphere.Center - Context->Origin;
+    const Float3 centerF = sphere.Center - context->Origin;
     const float radiusF = (float)sphere.Radius;
     for (int32 i = 0; i < SphereTriangleCache.Count();)
     {
@@ -1402,6 +1680,7 @@ void DebugDraw::DrawSphere(const BoundingSphere& sphere, const Color& color, flo
 
 void DebugDraw::DrawCircle(const Vector3& position, const Float3& normal, float radius, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     // Create matrix transform for unit circle points
     Matrix world, scale, matrix;
     Float3 right, up;
@@ -1413,13 +1692,13 @@ void DebugDraw::DrawCircle(const Vector3& position, const Float3& normal, float
         Float3::Cross(normal, Float3::Up, right);
     Float3::Cross(right, normal, up);
     Matrix::Scaling(radius, scale);
-    const Float3 positionF = position - Context->Origin;
+    const Float3 positionF = position - context->Origin;
     Matrix::CreateWorld(positionF, normal, up, world);
     Matrix::Multiply(scale, world, matrix);
 
     // Draw lines of the unit circle after linear transform
     Float3 prev = Float3::Transform(CircleCache[0], matrix);
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
     for (int32 i = 1; i < DEBUG_DRAW_CIRCLE_VERTICES;)
     {
         Float3 cur = Float3::Transform(CircleCache[i++], matrix);
@@ -1448,26 +1727,28 @@ void DebugDraw::DrawWireTriangle(const Vector3& v0, const Vector3& v1, const Vec
 
 void DebugDraw::DrawTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    t.V0 = v0 - Context->Origin;
-    t.V1 = v1 - Context->Origin;
-    t.V2 = v2 - Context->Origin;
+    t.V0 = v0 - context->Origin;
+    t.V1 = v1 - context->Origin;
+    t.V2 = v2 - context->Origin;
     if (depthTest)
-        Context->DebugDrawDepthTest.Add(t);
+        context->DebugDrawDepthTest.Add(t);
     else
-        Context->DebugDrawDefault.Add(t);
+        context->DebugDrawDefault.Add(t);
 }
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, vertices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1479,12 +1760,13 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Color& color,
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context, vertices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < vertices.Length();)
     {
         Float3::Transform(vertices.Get()[i++], transformF, t.V0);
@@ -1506,12 +1788,13 @@ void DebugDraw::DrawTriangles(const Array<Float3>& vertices, const Matrix& trans
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, indices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1523,12 +1806,13 @@ void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& i
 
 void DebugDraw::DrawTriangles(const Span<Float3>& vertices, const Span<int32>& indices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context, indices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < indices.Length();)
     {
         Float3::Transform(vertices[indices.Get()[i++]], transformF, t.V0);
@@ -1550,12 +1834,13 @@ void DebugDraw::DrawTriangles(const Array<Float3>& vertices, const Array<int32,
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, vertices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1567,12 +1852,13 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Color& color,
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context, vertices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < vertices.Length();)
     {
         Float3::Transform(vertices.Get()[i++], transformF, t.V0);
@@ -1594,12 +1880,13 @@ void DebugDraw::DrawTriangles(const Array<Double3>& vertices, const Matrix& tran
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, indices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1611,12 +1898,13 @@ void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>&
 
 void DebugDraw::DrawTriangles(const Span<Double3>& vertices, const Span<int32>& indices, const Matrix& transform, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Matrix transformF = transform * Matrix::Translation(-Context->Origin);
+    auto dst = AppendTriangles(context, indices.Length() / 3, duration, depthTest);
+    const Matrix transformF = transform * Matrix::Translation(-context->Origin);
     for (int32 i = 0; i < indices.Length();)
     {
         Float3::Transform(vertices[indices.Get()[i++]], transformF, t.V0);
@@ -1638,12 +1926,13 @@ void DebugDraw::DrawTriangles(const Array<Double3>& vertices, const Array<int32,
 
 void DebugDraw::DrawWireTriangles(const Span<Float3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, vertices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1660,12 +1949,13 @@ void DebugDraw::DrawWireTriangles(const Array<Float3>& vertices, const Color& co
 
 void DebugDraw::DrawWireTriangles(const Span<Float3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Float3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, indices.Length() / 3, duration, depthTest);
+    const Float3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1682,12 +1972,13 @@ void DebugDraw::DrawWireTriangles(const Array<Float3>& vertices, const Array<int
 
 void DebugDraw::DrawWireTriangles(const Span<Double3>& vertices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(vertices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(vertices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, vertices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < vertices.Length();)
     {
         t.V0 = vertices.Get()[i++] - origin;
@@ -1704,12 +1995,13 @@ void DebugDraw::DrawWireTriangles(const Array<Double3>& vertices, const Color& c
 
 void DebugDraw::DrawWireTriangles(const Span<Double3>& vertices, const Span<int32>& indices, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     CHECK(indices.Length() % 3 == 0);
     DebugTriangle t;
     t.Color = Color32(color);
     t.TimeLeft = duration;
-    auto dst = AppendTriangles(indices.Length() / 3, duration, depthTest);
-    const Double3 origin = Context->Origin;
+    auto dst = AppendTriangles(context, indices.Length() / 3, duration, depthTest);
+    const Double3 origin = context->Origin;
     for (int32 i = 0; i < indices.Length();)
     {
         t.V0 = vertices[indices.Get()[i++]] - origin;
@@ -1745,6 +2037,7 @@ void DebugDraw::DrawTube(const Vector3& position, const Quaternion& orientation,
 
 void DebugDraw::DrawWireTube(const Vector3& position, const Quaternion& orientation, float radius, float length, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     // Check if has no length (just sphere)
     if (length < ZeroTolerance)
     {
@@ -1760,12 +2053,12 @@ void DebugDraw::DrawWireTube(const Vector3& position, const Quaternion& orientat
         const float halfLength = length / 2.0f;
         Matrix rotation, translation, world;
         Matrix::RotationQuaternion(orientation, rotation);
-        const Float3 positionF = position - Context->Origin;
+        const Float3 positionF = position - context->Origin;
         Matrix::Translation(positionF, translation);
         Matrix::Multiply(rotation, translation, world);
 
         // Write vertices
-        auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+        auto& debugDrawData = depthTest ? context->DebugDrawDepthTest : context->DebugDrawDefault;
         Color32 color32(color);
         if (duration > 0)
         {
@@ -1856,7 +2149,7 @@ void DebugDraw::DrawWireTube(const Vector3& position, const Quaternion& orientat
 
 namespace
 {
-    void DrawCylinder(Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration)
+    void DrawCylinder(DebugDrawContext* context, Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration)
     {
         // Setup cache
         Float3 CylinderCache[DEBUG_DRAW_CYLINDER_VERTICES];
@@ -1885,7 +2178,7 @@ namespace
         DebugTriangle t;
         t.Color = Color32(color);
         t.TimeLeft = duration;
-        const Float3 positionF = position - Context->Origin;
+        const Float3 positionF = position - context->Origin;
         const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
 
         // Write triangles
@@ -1928,7 +2221,7 @@ namespace
         }
     }
 
-    void DrawCone(Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration)
+    void DrawCone(DebugDrawContext* context, Array<DebugTriangle>* list, const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration)
     {
         const float tolerance = 0.001f;
         const float angle1 = Math::Clamp(angleXY, tolerance, PI - tolerance);
@@ -1942,7 +2235,7 @@ namespace
         DebugTriangle t;
         t.Color = Color32(color);
         t.TimeLeft = duration;
-        const Float3 positionF = position - Context->Origin;
+        const Float3 positionF = position - context->Origin;
         const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
         t.V0 = world.GetTranslation();
 
@@ -1977,58 +2270,63 @@ namespace
 
 void DebugDraw::DrawCylinder(const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    ::DrawCylinder(list, position, orientation, radius, height, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
+    ::DrawCylinder(context, list, position, orientation, radius, height, color, duration);
 }
 
 void DebugDraw::DrawWireCylinder(const Vector3& position, const Quaternion& orientation, float radius, float height, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultWireTriangles : &Context->DebugDrawDepthTest.OneFrameWireTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultWireTriangles : &context->DebugDrawDepthTest.OneFrameWireTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultWireTriangles : &Context->DebugDrawDefault.OneFrameWireTriangles;
-    ::DrawCylinder(list, position, orientation, radius, height, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultWireTriangles : &context->DebugDrawDefault.OneFrameWireTriangles;
+    ::DrawCylinder(context, list, position, orientation, radius, height, color, duration);
 }
 
 void DebugDraw::DrawCone(const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    ::DrawCone(list, position, orientation, radius, angleXY, angleXZ, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
+    ::DrawCone(context, list, position, orientation, radius, angleXY, angleXZ, color, duration);
 }
 
 void DebugDraw::DrawWireCone(const Vector3& position, const Quaternion& orientation, float radius, float angleXY, float angleXZ, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultWireTriangles : &Context->DebugDrawDepthTest.OneFrameWireTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultWireTriangles : &context->DebugDrawDepthTest.OneFrameWireTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultWireTriangles : &Context->DebugDrawDefault.OneFrameWireTriangles;
-    ::DrawCone(list, position, orientation, radius, angleXY, angleXZ, color, duration);
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultWireTriangles : &context->DebugDrawDefault.OneFrameWireTriangles;
+    ::DrawCone(context, list, position, orientation, radius, angleXY, angleXZ, color, duration);
 }
 
 void DebugDraw::DrawArc(const Vector3& position, const Quaternion& orientation, float radius, float angle, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     if (angle <= 0)
         return;
     if (angle > TWO_PI)
         angle = TWO_PI;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     const int32 resolution = Math::CeilToInt((float)DEBUG_DRAW_CONE_RESOLUTION / TWO_PI * angle);
     const float angleStep = angle / (float)resolution;
-    const Float3 positionF = position - Context->Origin;
+    const Float3 positionF = position - context->Origin;
     const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
     float currentAngle = 0.0f;
     DebugTriangle t;
@@ -2049,13 +2347,14 @@ void DebugDraw::DrawArc(const Vector3& position, const Quaternion& orientation,
 
 void DebugDraw::DrawWireArc(const Vector3& position, const Quaternion& orientation, float radius, float angle, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     if (angle <= 0)
         return;
     if (angle > TWO_PI)
         angle = TWO_PI;
     const int32 resolution = Math::CeilToInt((float)DEBUG_DRAW_CONE_RESOLUTION / TWO_PI * angle);
     const float angleStep = angle / (float)resolution;
-    const Float3 positionF = position - Context->Origin;
+    const Float3 positionF = position - context->Origin;
     const Matrix world = Matrix::RotationQuaternion(orientation) * Matrix::Translation(positionF);
     float currentAngle = 0.0f;
     Float3 prevPos(world.GetTranslation());
@@ -2095,11 +2394,12 @@ void DebugDraw::DrawWireArrow(const Vector3& position, const Quaternion& orienta
 
 void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     // Get corners
     Vector3 corners[8];
     box.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw triangles
     DebugTriangle t;
@@ -2107,9 +2407,9 @@ void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float durati
     t.TimeLeft = duration;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     list->EnsureCapacity(list->Count() + 36);
     for (int i0 = 0; i0 < 36;)
     {
@@ -2123,11 +2423,12 @@ void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float durati
 
 void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
+    DEBUG_DRAW_CONTEXT();
     // Get corners
     Vector3 corners[8];
     box.GetCorners(corners);
     for (Vector3& c : corners)
-        c -= Context->Origin;
+        c -= context->Origin;
 
     // Draw triangles
     DebugTriangle t;
@@ -2135,9 +2436,9 @@ void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, floa
     t.TimeLeft = duration;
     Array<DebugTriangle>* list;
     if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDepthTest.DefaultTriangles : &context->DebugDrawDepthTest.OneFrameTriangles;
     else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
+        list = duration > 0 ? &context->DebugDrawDefault.DefaultTriangles : &context->DebugDrawDefault.OneFrameTriangles;
     list->EnsureCapacity(list->Count() + 36);
     for (int i0 = 0; i0 < 36;)
     {
@@ -2151,9 +2452,10 @@ void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, floa
 
 void DebugDraw::DrawText(const StringView& text, const Float2& position, const Color& color, int32 size, float duration)
 {
+    DEBUG_DRAW_CONTEXT();
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText2D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText2D : &Context->DebugDrawDefault.OneFrameText2D;
+    Array<DebugText2D>* list = duration > 0 ? &context->DebugDrawDefault.DefaultText2D : &context->DebugDrawDefault.OneFrameText2D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
@@ -2166,14 +2468,15 @@ void DebugDraw::DrawText(const StringView& text, const Float2& position, const C
 
 void DebugDraw::DrawText(const StringView& text, const Vector3& position, const Color& color, int32 size, float duration, float scale)
 {
+    DEBUG_DRAW_CONTEXT();
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText3D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText3D : &Context->DebugDrawDefault.OneFrameText3D;
+    Array<DebugText3D>* list = duration > 0 ? &context->DebugDrawDefault.DefaultText3D : &context->DebugDrawDefault.OneFrameText3D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
     t.Text[text.Length()] = 0;
-    t.Transform = position - Context->Origin;
+    t.Transform = position - context->Origin;
     t.Transform.Scale.X = scale;
     t.FaceCamera = true;
     t.Size = size;
@@ -2183,15 +2486,16 @@ void DebugDraw::DrawText(const StringView& text, const Vector3& position, const
 
 void DebugDraw::DrawText(const StringView& text, const Transform& transform, const Color& color, int32 size, float duration)
 {
+    DEBUG_DRAW_CONTEXT();
     if (text.Length() == 0 || size < 4)
         return;
-    Array<DebugText3D>* list = duration > 0 ? &Context->DebugDrawDefault.DefaultText3D : &Context->DebugDrawDefault.OneFrameText3D;
+    Array<DebugText3D>* list = duration > 0 ? &context->DebugDrawDefault.DefaultText3D : &context->DebugDrawDefault.OneFrameText3D;
     auto& t = list->AddOne();
     t.Text.Resize(text.Length() + 1);
     Platform::MemoryCopy(t.Text.Get(), text.Get(), text.Length() * sizeof(Char));
     t.Text[text.Length()] = 0;
     t.Transform = transform;
-    t.Transform.Translation -= Context->Origin;
+    t.Transform.Translation -= context->Origin;
     t.FaceCamera = false;
     t.Size = size;
     t.Color = color;
@@ -23,7 +23,7 @@ class Actor;
 struct Transform;
 
 /// <summary>
-/// The debug shapes rendering service. Not available in final game. For use only in the editor.
+/// The debug shapes rendering service. Not available in final game. For use only in the editor. Shapes can be drawn from any thread (eg. from jobs) - non-main threads record them into own buffers which are merged on the main thread.
 /// </summary>
 API_CLASS(Static) class FLAXENGINE_API DebugDraw
 {
@@ -0,0 +1,319 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if !USE_EDITOR
+
+#include "CommandLine.h"
+#include "Globals.h"
+#include "Engine.h"
+#include "EngineService.h"
+#include "Time.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUAdapter.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Level/Actors/Spline.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/MemoryStats.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "FlaxEngine.Gen.h"
+#if COMPILE_WITH_PROFILER
+#include "Engine/Profiler/ProfilingTools.h"
+#endif
+
+// Name of the spline actor used to drive the main camera during the benchmark
+#define BENCHMARK_PATH_NAME TEXT("BenchmarkPath")
+
+// Timeout for the scene loading (in seconds)
+#define BENCHMARK_LOAD_TIMEOUT 120.0
+
+namespace
+{
+    enum class BenchmarkState
+    {
+        Disabled,
+        Loading,
+        Running,
+        Done,
+    };
+
+    struct BenchmarkFrame
+    {
+        float FrameTimeMs;
+        float UpdateTimeMs;
+        float PhysicsTimeMs;
+        float DrawTimeMs;
+        float GPUTimeMs;
+    };
+
+    BenchmarkState State = BenchmarkState::Disabled;
+    Guid SceneId;
+    int32 WarmupFrames = 100;
+    int32 RecordFrames = 1000;
+    int32 FrameIndex = 0;
+    String OutputPath;
+    double StartTime = 0;
+    double LastFrameTime = 0;
+    double RecordStartTime = 0;
+    uint64 PeakProcessMemory = 0;
+    uint64 PeakGPUMemory = 0;
+    Array<BenchmarkFrame> Frames;
+    Array<String> Errors;
+
+    int32 ParseCount(const Nullable<String>& arg, int32 defaultValue)
+    {
+        int32 result;
+        if (arg.HasValue() && !StringUtils::Parse(arg.GetValue().Get(), &result) && result >= 0)
+            return result;
+        return defaultValue;
+    }
+
+    float GetPercentile(const Array<float>& sorted, float percentile)
+    {
+        if (sorted.IsEmpty())
+            return 0.0f;
+        const int32 index = Math::Clamp((int32)Math::Ceil(percentile * (float)sorted.Count()) - 1, 0, sorted.Count() - 1);
+        return sorted[index];
+    }
+
+    void WriteFloat(JsonWriter& writer, const char* name, float value)
+    {
+        writer.JKEY(name);
+        writer.Float(value);
+    }
+
+    void WriteTimings(JsonWriter& writer, const char* name, Array<float>& values)
+    {
+        float min = MAX_float, max = 0.0f, sum = 0.0f;
+        for (const float value : values)
+        {
+            min = Math::Min(min, value);
+            max = Math::Max(max, value);
+            sum += value;
+        }
+        Sorting::QuickSort(values);
+        writer.JKEY(name);
+        writer.StartObject();
+        WriteFloat(writer, "Average", values.HasItems() ? sum / (float)values.Count() : 0.0f);
+        WriteFloat(writer, "Min", values.HasItems() ? min : 0.0f);
+        WriteFloat(writer, "Max", max);
+        WriteFloat(writer, "P50", GetPercentile(values, 0.5f));
+        WriteFloat(writer, "P90", GetPercentile(values, 0.9f));
+        WriteFloat(writer, "P95", GetPercentile(values, 0.95f));
+        WriteFloat(writer, "P99", GetPercentile(values, 0.99f));
+        writer.EndObject();
+    }
+
+    bool WriteReport(const StringView& path)
+    {
+        rapidjson_flax::StringBuffer buffer;
+        CompactJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        writer.StartObject();
+        writer.JKEY("Success");
+        writer.Bool(Errors.IsEmpty() && Frames.HasItems());
+        writer.JKEY("Errors");
+        writer.StartArray();
+        for (const String& e : Errors)
+            writer.String(e);
+        writer.EndArray();
+        writer.JKEY("Date");
+        writer.String(DateTime::Now().ToString());
+        writer.JKEY("Platform");
+        writer.String(ToString(PLATFORM_TYPE));
+        writer.JKEY("EngineBuild");
+        writer.Int(FLAXENGINE_VERSION_BUILD);
+        writer.JKEY("GPU");
+        writer.String(GPUDevice::Instance && GPUDevice::Instance->GetAdapter() ? GPUDevice::Instance->GetAdapter()->GetDescription() : String::Empty);
+        writer.JKEY("Scene");
+        writer.Guid(SceneId);
+        writer.JKEY("WarmupFrames");
+        writer.Int(WarmupFrames);
+        writer.JKEY("Frames");
+        writer.Int(Frames.Count());
+        WriteFloat(writer, "Duration", (float)(LastFrameTime - RecordStartTime));
+        const int32 count = Frames.Count();
+        Array<float> values;
+        values.Resize(count);
+#define WRITE_TIMINGS(name, field) \
+        for (int32 i = 0; i < count; i++) \
+            values[i] = Frames[i].field; \
+        WriteTimings(writer, name, values)
+        WRITE_TIMINGS("FrameTimeMs", FrameTimeMs);
+        WRITE_TIMINGS("UpdateTimeMs", UpdateTimeMs);
+        WRITE_TIMINGS("PhysicsTimeMs", PhysicsTimeMs);
+        WRITE_TIMINGS("DrawCPUTimeMs", DrawTimeMs);
+#if COMPILE_WITH_PROFILER
+        WRITE_TIMINGS("DrawGPUTimeMs", GPUTimeMs);
+#endif
+#undef WRITE_TIMINGS
+        float totalTime = 0.0f;
+        for (const auto& frame : Frames)
+            totalTime += frame.FrameTimeMs;
+        WriteFloat(writer, "AverageFPS", totalTime > 0.0f ? (float)count * 1000.0f / totalTime : 0.0f);
+        writer.JKEY("PeakProcessMemory");
+        writer.Uint64(PeakProcessMemory);
+        writer.JKEY("PeakGPUMemory");
+        writer.Uint64(PeakGPUMemory);
+        writer.EndObject();
+
+        const String folder = StringUtils::GetDirectoryName(path);
+        if (folder.HasChars() && !FileSystem::DirectoryExists(folder))
+            FileSystem::CreateDirectory(folder);
+        return File::WriteAllBytes(path, (const byte*)buffer.GetString(), (int32)buffer.GetSize());
+    }
+
+    void Finish()
+    {
+        State = BenchmarkState::Done;
+        if (WriteReport(OutputPath))
+        {
+            LOG(Error, "Failed to save benchmark report to '{0}'", OutputPath);
+            Engine::RequestExit(1);
+            return;
+        }
+        LOG(Info, "Benchmark report saved to '{0}'", OutputPath);
+        Engine::RequestExit(Errors.IsEmpty() && Frames.HasItems() ? 0 : 1);
+    }
+
+    void Fail(const String& error)
+    {
+        LOG_STR(Error, error);
+        Errors.Add(error);
+        Finish();
+    }
+}
+
+class BenchmarkService : public EngineService
+{
+public:
+    BenchmarkService()
+        : EngineService(TEXT("Benchmark"), 1000)
+    {
+    }
+
+    bool Init() override;
+    void Update() override;
+};
+
+BenchmarkService BenchmarkServiceInstance;
+
+bool BenchmarkService::Init()
+{
+    const auto& options = CommandLine::Options;
+    if (!options.Benchmark.HasValue())
+        return false;
+    State = BenchmarkState::Loading;
+    if (options.Benchmark.GetValue().HasChars() && Guid::Parse(options.Benchmark.GetValue(), SceneId))
+    {
+        LOG(Error, "Invalid benchmark scene ID '{0}'", options.Benchmark.GetValue());
+        return true;
+    }
+    WarmupFrames = ParseCount(options.BenchmarkWarmup, WarmupFrames);
+    RecordFrames = Math::Max(ParseCount(options.BenchmarkFrames, RecordFrames), 1);
+    if (options.BenchmarkOutput.HasValue() && options.BenchmarkOutput.GetValue().HasChars())
+        OutputPath = options.BenchmarkOutput.GetValue();
+    else
+    {
+        String folder = StringUtils::GetDirectoryName(Log::Logger::LogFilePath);
+        if (folder.IsEmpty())
+            folder = Globals::ProductLocalFolder / TEXT("Logs");
+        OutputPath = folder / TEXT("Benchmark.json");
+    }
+    LOG(Info, "Running benchmark (warmup: {0} frames, record: {1} frames)", WarmupFrames, RecordFrames);
+
+    // Measure the raw performance without frame-rate limits
+    if (!CommandLine::Options.VSync.HasValue() && !CommandLine::Options.NoVSync.HasValue())
+        CommandLine::Options.NoVSync = true;
+    Time::UpdateFPS = 0.0f;
+    Time::DrawFPS = 0.0f;
+#if COMPILE_WITH_PROFILER
+    ProfilingTools::SetEnabled(true);
+#endif
+    Frames.EnsureCapacity(RecordFrames);
+    StartTime = Platform::GetTimeSeconds();
+    return false;
+}
+
+void BenchmarkService::Update()
+{
+    if (State == BenchmarkState::Disabled || State == BenchmarkState::Done)
+        return;
+    const double now = Platform::GetTimeSeconds();
+
+    if (State == BenchmarkState::Loading)
+    {
+        if (now - StartTime > BENCHMARK_LOAD_TIMEOUT)
+        {
+            Fail(TEXT("Benchmark scene loading timeout."));
+            return;
+        }
+        if (SceneId.IsValid() && !Level::FindScene(SceneId))
+        {
+            // Load the benchmark scene (replaces the startup scene)
+            if (!Level::IsAnyActionPending())
+            {
+                Level::UnloadAllScenesAsync();
+                if (Level::LoadSceneAsync(SceneId))
+                {
+                    Fail(String::Format(TEXT("Failed to load benchmark scene {0}."), SceneId));
+                }
+            }
+            return;
+        }
+        if (Level::GetScenesCount() == 0 || Level::IsAnyActionPending())
+            return;
+        if (!SceneId.IsValid())
+            SceneId = Level::GetScene(0)->GetID();
+        State = BenchmarkState::Running;
+        FrameIndex = 0;
+        LastFrameTime = now;
+        LOG(Info, "Benchmark scene loaded in {0}s", Math::RoundToInt((float)(now - StartTime)));
+    }
+
+    // Move the camera along the path (progress based on the frame index to keep the visited locations consistent between runs)
+    const int32 totalFrames = WarmupFrames + RecordFrames;
+    const auto path = Level::FindActor<Spline>(BENCHMARK_PATH_NAME);
+    const auto camera = Camera::GetMainCamera();
+    if (path && camera && path->GetSplinePointsCount() > 1)
+    {
+        const float time = path->GetSplineDuration() * Math::Saturate((float)FrameIndex / (float)totalFrames);
+        camera->SetTransform(path->GetSplineTransform(time));
+    }
+
+    // Record the previous frame stats
+    const float frameTimeMs = (float)((now - LastFrameTime) * 1000.0);
+    LastFrameTime = now;
+    if (FrameIndex == WarmupFrames)
+        RecordStartTime = now;
+    if (FrameIndex > WarmupFrames)
+    {
+        auto& frame = Frames.AddOne();
+        frame.FrameTimeMs = frameTimeMs;
+        frame.UpdateTimeMs = (float)(Time::Update.LastLength * 1000.0);
+        frame.PhysicsTimeMs = (float)(Time::Physics.LastLength * 1000.0);
+        frame.DrawTimeMs = (float)(Time::Draw.LastLength * 1000.0);
+#if COMPILE_WITH_PROFILER
+        frame.GPUTimeMs = ProfilingTools::Stats.DrawGPUTimeMs;
+#else
+        frame.GPUTimeMs = 0.0f;
+#endif
+        PeakProcessMemory = Math::Max(PeakProcessMemory, Platform::GetProcessMemoryStats().UsedPhysicalMemory);
+        if (GPUDevice::Instance)
+            PeakGPUMemory = Math::Max(PeakGPUMemory, GPUDevice::Instance->GetMemoryUsage());
+    }
+    if (Frames.Count() >= RecordFrames)
+    {
+        Finish();
+        return;
+    }
+    FrameIndex++;
+}
+
+#endif
@@ -145,6 +145,8 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-monolog ", MonoLog);
     PARSE_BOOL_SWITCH("-mute ", Mute);
     PARSE_BOOL_SWITCH("-lowdpi ", LowDPI);
+    PARSE_ARG_SWITCH("-heap ", Heap);
+    PARSE_BOOL_SWITCH("-largepages ", LargePages);
 #if USE_EDITOR
     PARSE_BOOL_SWITCH("-clearcache ", ClearCache);
     PARSE_BOOL_SWITCH("-clearcooker ", ClearCookerCache);
@@ -154,11 +156,26 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_ARG_SWITCH("-build ", Build);
     PARSE_BOOL_SWITCH("-skipcompile ", SkipCompile);
     PARSE_BOOL_SWITCH("-shaderdebug ", ShaderDebug);
+    PARSE_ARG_SWITCH("-shadercache ", ShaderCache);
     PARSE_BOOL_SWITCH("-exit ", Exit);
     PARSE_ARG_OPT_SWITCH("-play ", Play);
+    PARSE_ARG_OPT_SWITCH("-bakelightmaps ", BakeLightmaps);
 #endif
 #if USE_EDITOR || !BUILD_RELEASE
     PARSE_BOOL_SWITCH("-shaderprofile ", ShaderProfile);
+    PARSE_BOOL_SWITCH("-recordmaterials ", RecordMaterials);
+    PARSE_BOOL_SWITCH("-recordloadorder ", RecordLoadOrder);
+#endif
+#if COMPILE_WITH_PROFILER
+    PARSE_BOOL_SWITCH("-mem ", Mem);
+#endif
+#if !USE_EDITOR
+    PARSE_ARG_SWITCH("-benchmarkframes ", BenchmarkFrames);
+    PARSE_ARG_SWITCH("-benchmarkwarmup ", BenchmarkWarmup);
+    PARSE_ARG_OPT_SWITCH("-benchmark ", Benchmark);
+#endif
+#if !USE_EDITOR || FLAX_BENCHMARKS
+    PARSE_ARG_SWITCH("-benchmarkout ", BenchmarkOutput);
 #endif
 
     return false;
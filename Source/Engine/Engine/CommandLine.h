@@ -127,6 +127,16 @@ class CommandLine
         /// </summary>
         Nullable<bool> LowDPI;
 
+        /// <summary>
+        /// -heap !sizeMB! (reserves the engine memory heap of the given size at startup for the long-living memory pools)
+        /// </summary>
+        Nullable<String> Heap;
+
+        /// <summary>
+        /// -largepages (uses large/huge memory pages for the engine memory heap)
+        /// </summary>
+        Nullable<bool> LargePages;
+
 #if USE_EDITOR
         /// <summary>
         /// -project !path! (Startup project path)
@@ -168,6 +178,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> ShaderDebug;
 
+        /// <summary>
+        /// -shadercache !path! (folder for the compiled shaders cache shared between projects and machines, eg. on a network drive)
+        /// </summary>
+        Nullable<String> ShaderCache;
+
         /// <summary>
         /// -exit (exits the editor after startup and performing all queued actions). Usefull when invoking editor from CL/CD.
         /// </summary>
@@ -177,6 +192,11 @@ class CommandLine
         /// -play !guid! ( Scene to play, can be empty to use default )
         /// </summary>
         Nullable<String> Play;
+
+        /// <summary>
+        /// -bakelightmaps !guid! (bakes lightmaps of the scene (or startup scenes if ID is empty) after the editor startup, saves the scenes and exits the editor). Use with -headless for bakes on build servers.
+        /// </summary>
+        Nullable<String> BakeLightmaps;
 #endif
 
 #if USE_EDITOR || !BUILD_RELEASE
@@ -184,6 +204,47 @@ class CommandLine
         /// -shaderprofile (enables debugging data generation for shaders but leaves shader compiler optimizations active for performance profiling)
         /// </summary>
         Nullable<bool> ShaderProfile;
+
+        /// <summary>
+        /// -recordmaterials (enables recording of the used materials pipeline state permutations, see MaterialsUsage)
+        /// </summary>
+        Nullable<bool> RecordMaterials;
+
+        /// <summary>
+        /// -recordloadorder (enables recording of the assets first-use order, see ContentLoadOrder)
+        /// </summary>
+        Nullable<bool> RecordLoadOrder;
+#endif
+
+#if COMPILE_WITH_PROFILER
+        /// <summary>
+        /// -mem (enables native memory allocations tracking per memory group)
+        /// </summary>
+        Nullable<bool> Mem;
+#endif
+
+#if !USE_EDITOR
+        /// <summary>
+        /// -benchmark !guid! (runs the automated performance benchmark on the scene (or the first game scene if empty) and exits the app with the report written)
+        /// </summary>
+        Nullable<String> Benchmark;
+
+        /// <summary>
+        /// -benchmarkframes !count! (amount of frames to record during the benchmark, 1000 by default)
+        /// </summary>
+        Nullable<String> BenchmarkFrames;
+
+        /// <summary>
+        /// -benchmarkwarmup !count! (amount of frames to skip before recording the benchmark, 100 by default)
+        /// </summary>
+        Nullable<String> BenchmarkWarmup;
+#endif
+
+#if !USE_EDITOR || FLAX_BENCHMARKS
+        /// <summary>
+        /// -benchmarkout !path! (output path for the benchmark report file, Benchmark.json (or Benchmarks.json for micro-benchmarks) in the logs folder by default)
+        /// </summary>
+        Nullable<String> BenchmarkOutput;
 #endif
     };
 
@@ -27,6 +27,7 @@
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Threading/TaskGraph.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
@@ -95,6 +96,11 @@ int32 Engine::Main(const Char* cmdLine)
     CommandLine::Options.Std = true;
 #endif
 
+#if COMPILE_WITH_PROFILER
+    if (CommandLine::Options.Mem.IsTrue())
+        ProfilerMemory::Enabled = true;
+#endif
+
     if (Platform::Init())
     {
         Platform::Fatal(TEXT("Cannot init platform."));
@@ -4,6 +4,8 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/tracy/tracy/Tracy.hpp>
 
 static bool CompareEngineServices(EngineService* const& a, EngineService* const& b)
@@ -11,6 +13,13 @@ static bool CompareEngineServices(EngineService* const& a, EngineService* const&
     return a->Order < b->Order;
 }
 
+static bool CompareEngineServicesInitTime(EngineService* const& a, EngineService* const& b)
+{
+    return a->GetInitTime() > b->GetInitTime();
+}
+
+static CriticalSection InitLocker;
+
 #define DEFINE_ENGINE_SERVICE_EVENT(name) \
     void EngineService::name() { } \
     void EngineService::On##name() \
@@ -18,7 +27,11 @@ static bool CompareEngineServices(EngineService* const& a, EngineService* const&
         ZoneScoped; \
         auto& services = GetServices(); \
         for (int32 i = 0; i < services.Count(); i++) \
-            services[i]->name(); \
+        { \
+            const auto service = services[i]; \
+            if (!service->InitDeferred || service->IsInitialized) \
+                service->name(); \
+        } \
     }
 #define DEFINE_ENGINE_SERVICE_EVENT_INVERTED(name) \
     void EngineService::name() { } \
@@ -27,7 +40,11 @@ static bool CompareEngineServices(EngineService* const& a, EngineService* const&
         ZoneScoped; \
         auto& services = GetServices(); \
         for (int32 i = 0; i < services.Count(); i++) \
-            services[i]->name(); \
+        { \
+            const auto service = services[i]; \
+            if (!service->InitDeferred || service->IsInitialized) \
+                service->name(); \
+        } \
     }
 
 DEFINE_ENGINE_SERVICE_EVENT(FixedUpdate);
@@ -65,37 +82,123 @@ bool EngineService::Init()
     return false;
 }
 
+void EngineService::InvokeInit()
+{
+    const StringView name(Name);
+#if TRACY_ENABLE
+    ZoneScoped;
+    int32 nameBufferLength = 0;
+    Char nameBuffer[100];
+    for (int32 j = 0; j < name.Length(); j++)
+        if (name[j] != ' ')
+            nameBuffer[nameBufferLength++] = name[j];
+    Platform::MemoryCopy(nameBuffer + nameBufferLength, TEXT("::Init"), 7 * sizeof(Char));
+    nameBufferLength += 7;
+    ZoneName(nameBuffer, nameBufferLength);
+#endif
+    LOG(Info, "Initialize {0}...", name);
+    const double startTime = Platform::GetTimeSeconds();
+    InitFailed = Init();
+    InitTime = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+}
+
+bool EngineService::WaitForInit()
+{
+    if (InitJob != 0)
+    {
+        JobSystem::Wait(InitJob);
+        InitJob = 0;
+        if (InitFailed)
+        {
+            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), Name));
+        }
+    }
+    return InitFailed;
+}
+
+bool EngineService::EnsureInitialized()
+{
+    ScopeLock lock(InitLocker);
+    if (!IsInitialized)
+    {
+        IsInitialized = true;
+        InvokeInit();
+        LOG(Info, "Deferred {0} initialization took {1} ms", Name, (int32)InitTime);
+        if (InitFailed)
+            LOG(Error, "Failed to initialize {0}.", Name);
+    }
+    return WaitForInit();
+}
+
 void EngineService::OnInit()
 {
     ZoneScoped;
     Sort();
+    const double startTime = Platform::GetTimeSeconds();
 
     // Init services from front to back
     auto& services = GetServices();
     for (int32 i = 0; i < services.Count(); i++)
     {
         const auto service = services[i];
-        const StringView name(service->Name);
-#if TRACY_ENABLE
-        ZoneScoped;
-        int32 nameBufferLength = 0;
-        Char nameBuffer[100];
-        for (int32 j = 0; j < name.Length(); j++)
-            if (name[j] != ' ')
-                nameBuffer[nameBufferLength++] = name[j];
-        Platform::MemoryCopy(nameBuffer + nameBufferLength, TEXT("::Init"), 7 * sizeof(Char));
-        nameBufferLength += 7;
-        ZoneName(nameBuffer, nameBufferLength);
-#endif
-        LOG(Info, "Initialize {0}...", name);
+        if (service->InitDeferred)
+        {
+            LOG(Info, "Deferring {0} initialization", service->Name);
+            continue;
+        }
+
+        // Wait for the services that have to be ready before this one
+        for (const Char* dependency : service->Dependencies)
+        {
+            for (int32 j = 0; j < i; j++)
+            {
+                if (StringUtils::Compare(services[j]->Name, dependency) == 0)
+                {
+                    ScopeLock lock(InitLocker);
+                    services[j]->WaitForInit();
+                    break;
+                }
+            }
+        }
+
         service->IsInitialized = true;
-        if (service->Init())
+        if (service->InitAsync)
         {
-            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), name));
+            service->InitJob = JobSystem::Dispatch([service](int32)
+            {
+                service->InvokeInit();
+            });
+            continue;
         }
+        service->InvokeInit();
+        if (service->InitFailed)
+        {
+            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), service->Name));
+        }
+    }
+
+    // Join the services initialized asynchronously
+    {
+        ScopeLock lock(InitLocker);
+        for (int32 i = 0; i < services.Count(); i++)
+            services[i]->WaitForInit();
     }
 
-    LOG(Info, "Engine services are ready!");
+    // Startup timing report (slowest services first)
+    const float totalTime = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+    LOG(Info, "Engine services are ready! ({0} ms)", (int32)totalTime);
+    EngineServicesArray timings;
+    for (int32 i = 0; i < services.Count(); i++)
+    {
+        if (services[i]->IsInitialized)
+            timings.Add(services[i]);
+    }
+    Sorting::QuickSort(timings.Get(), timings.Count(), &CompareEngineServicesInitTime);
+    for (int32 i = 0; i < timings.Count() && i < 10; i++)
+    {
+        const auto service = timings[i];
+        LOG(Info, " - {0}: {1} ms{2}", service->Name, service->InitTime, service->InitAsync ? TEXT(" (async)") : TEXT(""));
+    }
 }
 
 void EngineService::Dispose()
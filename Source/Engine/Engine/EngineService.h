@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
 
 /// <summary>
 /// Engine service object.
@@ -27,6 +28,12 @@ class EngineService
 private:
 
     bool IsInitialized = false;
+    bool InitFailed = false;
+    int64 InitJob = 0;
+    float InitTime = 0.0f;
+
+    void InvokeInit();
+    bool WaitForInit();
 
 protected:
 
@@ -39,6 +46,37 @@ class EngineService
     const Char* Name;
     int32 Order;
 
+    /// <summary>
+    /// True if the service initialization can run on a worker thread, concurrently with the services initialized after it. Init is joined before any service that lists this one in its dependencies and before the engine startup ends, thus it must not touch the main-thread-only systems.
+    /// </summary>
+    bool InitAsync = false;
+
+    /// <summary>
+    /// True if the service initialization is skipped on the engine startup and performed on the first use (see EnsureInitialized). Service events are not invoked until then.
+    /// </summary>
+    bool InitDeferred = false;
+
+    /// <summary>
+    /// The names of the services that have to be initialized before this one. Used to wait for the services initialized asynchronously.
+    /// </summary>
+    Array<const Char*, FixedAllocation<4>> Dependencies;
+
+public:
+
+    /// <summary>
+    /// Ensures that service is initialized. Initializes the deferred service or waits for the asynchronous initialization to end.
+    /// </summary>
+    /// <returns>True if service failed to initialize, otherwise false.</returns>
+    bool EnsureInitialized();
+
+    /// <summary>
+    /// Gets the time spent on the service initialization (in milliseconds).
+    /// </summary>
+    float GetInitTime() const
+    {
+        return InitTime;
+    }
+
 #define DECLARE_ENGINE_SERVICE_EVENT(result, name) virtual result name(); static void On##name();
     DECLARE_ENGINE_SERVICE_EVENT(bool, Init);
     DECLARE_ENGINE_SERVICE_EVENT(void, FixedUpdate);
@@ -24,3 +24,6 @@ struct FoliageInstance;
 
 // Size of the cluster container for instances
 #define FOLIAGE_CLUSTER_CAPACITY (64)
+
+// The amount of foliage type clusters per async drawing job. Large foliage types are split into multiple jobs over the quad-tree subtrees.
+#define FOLIAGE_DRAW_JOB_CLUSTERS (256)
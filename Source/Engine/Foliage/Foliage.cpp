@@ -13,6 +13,10 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/ImpostorsPass.h"
+#include "Engine/Renderer/Utils/OcclusionCulling.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPULimits.h"
 #endif
 #endif
 #include "Engine/Level/SceneQuery.h"
@@ -38,6 +42,21 @@ Foliage::Foliage(const SpawnParams& params)
 #endif
 }
 
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+
+struct Foliage::DrawTypeContext
+{
+    DrawPass DrawModes = DrawPass::None;
+    const ModelImpostor* Impostor = nullptr;
+    DrawCallsList DrawCallsLists[MODEL_MAX_LODS];
+};
+
+#endif
+
+Foliage::~Foliage()
+{
+}
+
 void Foliage::AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_SIZE>& clusters, FoliageCluster* cluster, FoliageInstance& instance)
 {
     ASSERT(instance.Bounds.Radius > ZeroTolerance);
@@ -130,7 +149,52 @@ void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instan
     }
 }
 
-void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
+void Foliage::DrawImpostor(RenderContext& renderContext, const FoliageInstance& instance, const ModelImpostor* impostor) const
+{
+    const Transform transform = _transform.LocalToWorld(instance.Transform);
+    ImpostorDrawCall drawCall;
+    drawCall.Impostor = impostor;
+    drawCall.Position = transform.LocalToWorld(impostor->Bounds.Center) - renderContext.View.Origin;
+    drawCall.Radius = (float)impostor->Bounds.Radius * transform.Scale.GetAbsolute().MaxValue();
+    drawCall.Orientation = transform.Orientation;
+    renderContext.List->Impostors.Add(drawCall);
+}
+
+// Gets the impostor to draw the distant instances of the foliage type (null if not used or not baked yet)
+FORCE_INLINE const ModelImpostor* GetImpostor(const FoliageType& type, DrawPass drawModes)
+{
+    if (type.ImpostorDistance <= 0.0f || EnumHasNoneFlags(drawModes, DrawPass::GBuffer | DrawPass::Depth))
+        return nullptr;
+    return ImpostorsPass::Instance()->GetImpostor(type.Model);
+}
+
+// Checks if use GPU-driven culling of the foliage instances (CPU culls clusters only)
+FORCE_INLINE bool UseGPUCulling()
+{
+    const auto& limits = GPUDevice::Instance->Limits;
+    return Graphics::GPUFoliageCulling && Graphics::GPUInstanceCulling && limits.HasCompute && limits.HasDrawIndirect;
+}
+
+// Culls all 4 children of the cluster at once against the view frustum (returns visibility bitmask)
+FORCE_INLINE uint32 CullClusterChildren(const RenderContext& renderContext, const FoliageCluster* cluster, const Vector3& viewOrigin)
+{
+    float minX[4], minY[4], minZ[4], maxX[4], maxY[4], maxZ[4];
+    for (int32 i = 0; i < 4; i++)
+    {
+        const BoundingBox& box = cluster->Children[i]->TotalBounds;
+        minX[i] = (float)(box.Minimum.X - viewOrigin.X);
+        minY[i] = (float)(box.Minimum.Y - viewOrigin.Y);
+        minZ[i] = (float)(box.Minimum.Z - viewOrigin.Z);
+        maxX[i] = (float)(box.Maximum.X - viewOrigin.X);
+        maxY[i] = (float)(box.Maximum.Y - viewOrigin.Y);
+        maxZ[i] = (float)(box.Maximum.Z - viewOrigin.Z);
+    }
+    uint32 visibility;
+    renderContext.View.CullingFrustum.Intersects(minX, minY, minZ, maxX, maxY, maxZ, 4, &visibility);
+    return visibility;
+}
+
+void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, const ModelImpostor* impostor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
 {
     // Skip clusters that around too far from view
     const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
@@ -146,18 +210,34 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         // Don't store instances in non-leaf nodes
         ASSERT_LOW_LAYER(cluster->Instances.IsEmpty());
 
-        BoundingBox box;
-#define DRAW_CLUSTER(idx) \
-        box = cluster->Children[idx]->TotalBounds; \
-        box.Minimum -= viewOrigin; \
-        box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
-			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result)
-        DRAW_CLUSTER(0);
-        DRAW_CLUSTER(1);
-        DRAW_CLUSTER(2);
-        DRAW_CLUSTER(3);
-#undef 	DRAW_CLUSTER
+        const uint32 visibility = CullClusterChildren(renderContext, cluster, viewOrigin);
+        const OcclusionBuffer* occlusion = renderContext.List->Occlusion;
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (visibility & (1u << i) && !(occlusion && occlusion->IsOccluded(cluster->Children[i]->TotalBoundsSphere)))
+                DrawCluster(renderContext, cluster->Children[i], type, impostor, drawCallsLists, result);
+        }
+    }
+    else if (impostor && Float3::Distance(lodView->Position, cluster->TotalBoundsSphere.Center - lodView->Origin) - (float)cluster->TotalBoundsSphere.Radius > type.ImpostorDistance)
+    {
+        // Draw the whole cluster with impostors
+        for (int32 i = 0; i < cluster->Instances.Count(); i++)
+        {
+            const auto& instance = *cluster->Instances.Get()[i];
+            if (Float3::Distance(lodView->Position, instance.Bounds.Center - lodView->Origin) - (float)instance.Bounds.Radius < instance.CullDistance)
+                DrawImpostor(renderContext, instance, impostor);
+        }
+    }
+    else if (UseGPUCulling())
+    {
+        // Select a LOD for the whole cluster and draw all instances (culled later on GPU)
+        const auto model = type.Model.Get();
+        int32 lodIndex = RenderTools::ComputeModelLOD(model, cluster->TotalBoundsSphere.Center - viewOrigin, (float)cluster->TotalBoundsSphere.Radius, renderContext);
+        if (lodIndex == -1)
+            return;
+        lodIndex = model->ClampLODIndex(lodIndex + renderContext.View.ModelLODBias);
+        for (int32 i = 0; i < cluster->Instances.Count(); i++)
+            DrawInstance(renderContext, *cluster->Instances.Get()[i], type, model, lodIndex, 0.0f, drawCallsLists, result);
     }
     else
     {
@@ -172,6 +252,11 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
             if (Float3::Distance(lodView->Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance &&
                 renderContext.View.CullingFrustum.Intersects(sphere))
             {
+                if (impostor && Float3::Distance(lodView->Position, sphere.Center) > type.ImpostorDistance)
+                {
+                    DrawImpostor(renderContext, instance, impostor);
+                    continue;
+                }
                 const auto modelFrame = instance.DrawState.PrevFrame + 1;
 
                 // Select a proper LOD index (model may be culled)
@@ -276,18 +361,12 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         // Don't store instances in non-leaf nodes
         ASSERT_LOW_LAYER(cluster->Instances.IsEmpty());
 
-        BoundingBox box;
-#define DRAW_CLUSTER(idx) \
-        box = cluster->Children[idx]->TotalBounds; \
-        box.Minimum -= viewOrigin; \
-        box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
-			DrawCluster(renderContext, cluster->Children[idx], draw)
-        DRAW_CLUSTER(0);
-        DRAW_CLUSTER(1);
-        DRAW_CLUSTER(2);
-        DRAW_CLUSTER(3);
-#undef 	DRAW_CLUSTER
+        const uint32 visibility = CullClusterChildren(renderContext, cluster, viewOrigin);
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (visibility & (1u << i))
+                DrawCluster(renderContext, cluster->Children[i], draw);
+        }
     }
     else
     {
@@ -408,15 +487,81 @@ void Foliage::DrawFoliageJob(int32 i)
     }
 }
 
-#endif
+#if FOLIAGE_USE_DRAW_CALLS_BATCHING
 
-void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, DrawCallsList* drawCallsLists)
+void Foliage::DrawSubtreeJob(int32 i)
 {
-    if (!type.Root || !FOLIAGE_CAN_DRAW(renderContext, type))
+    PROFILE_CPU();
+    const DrawJob& job = _drawJobs[i];
+    const FoliageType& type = FoliageTypes[job.TypeIndex];
+    const int32 contextsCount = _renderContextBatch->Contexts.Count();
+
+    // Render contexts are processed in order within a single job so instances LOD transition state is updated by a single thread
+    for (int32 contextIndex = 0; contextIndex < contextsCount; contextIndex++)
+    {
+        BatchedDrawCalls& result = _drawResults[i * contextsCount + contextIndex];
+        result.Clear();
+        DrawTypeContext& typeContext = _drawTypeContexts[job.TypeIndex * contextsCount + contextIndex];
+        if (typeContext.DrawModes == DrawPass::None)
+            continue;
+        RenderContext& renderContext = _renderContextBatch->Contexts[contextIndex];
+        if (job.Cluster != type.Root)
+        {
+            // Cull subtree (parent clusters culling is skipped)
+            BoundingBox box = job.Cluster->TotalBounds;
+            box.Minimum -= renderContext.View.Origin;
+            box.Maximum -= renderContext.View.Origin;
+            const OcclusionBuffer* occlusion = renderContext.List->Occlusion;
+            if (!renderContext.View.CullingFrustum.Intersects(box) || (occlusion && occlusion->IsOccluded(job.Cluster->TotalBoundsSphere)))
+                continue;
+        }
+        DrawCluster(renderContext, job.Cluster, type, typeContext.Impostor, typeContext.DrawCallsLists, result);
+    }
+}
+
+void Foliage::SubmitTypeJob(int32 i)
+{
+    const int32 jobsStart = _drawTypeJobs[i];
+    const int32 jobsEnd = _drawTypeJobs[i + 1];
+    if (jobsStart == jobsEnd)
         return;
-    const DrawPass typeDrawModes = FOLIAGE_GET_DRAW_MODES(renderContext, type);
-    PROFILE_CPU_ASSET(type.Model);
+    PROFILE_CPU();
+    const FoliageType& type = FoliageTypes[i];
+    const int32 contextsCount = _renderContextBatch->Contexts.Count();
+    for (int32 contextIndex = 0; contextIndex < contextsCount; contextIndex++)
+    {
+        const DrawTypeContext& typeContext = _drawTypeContexts[i * contextsCount + contextIndex];
+        if (typeContext.DrawModes == DrawPass::None)
+            continue;
+
+        // Merge batches from all subtrees of the foliage type
+        BatchedDrawCalls& result = _drawResults[jobsStart * contextsCount + contextIndex];
+        for (int32 jobIndex = jobsStart + 1; jobIndex < jobsEnd; jobIndex++)
+        {
+            for (auto& e : _drawResults[jobIndex * contextsCount + contextIndex])
+            {
+                if (e.Value.Instances.IsEmpty())
+                    continue;
+                auto* batch = result.TryGet(e.Key);
+                if (batch)
+                    batch->Instances.Add(e.Value.Instances);
+                else
+                    result.Add(e.Key, MoveTemp(e.Value));
+            }
+        }
+
+        SubmitDrawCalls(_renderContextBatch->Contexts[contextIndex], type, typeContext.DrawModes, result);
+    }
+}
+
+#endif
+
+#endif
+
 #if FOLIAGE_USE_DRAW_CALLS_BATCHING
+
+void Foliage::InitDrawCalls(RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, DrawCallsList* drawCallsLists) const
+{
     // Initialize draw calls for foliage type all LODs meshes
     for (int32 lod = 0; lod < type.Model->LODs.Count(); lod++)
     {
@@ -457,12 +602,12 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
             drawCall.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
         }
     }
+}
 
-    // Draw instances of the foliage type
-    BatchedDrawCalls result;
-    DrawCluster(renderContext, type.Root, type, drawCallsLists, result);
-
+void Foliage::SubmitDrawCalls(RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, BatchedDrawCalls& result) const
+{
     // Submit draw calls with valid instances added
+    const bool useGPUCulling = UseGPUCulling();
     for (auto& e : result)
     {
         auto& batch = e.Value;
@@ -476,6 +621,12 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
 
         // Setup draw call
         mesh.GetDrawCallGeometry(batch.DrawCall);
+        if (useGPUCulling)
+        {
+            // Instances culling by distance happens on GPU
+            batch.CullDistance = Math::Max(type.CullDistance, ZeroTolerance);
+            batch.CullDistanceRandomRange = type.CullDistanceRandomRange;
+        }
         batch.DrawCall.InstanceCount = 1;
         auto& firstInstance = batch.Instances[0];
         firstInstance.Load(batch.DrawCall);
@@ -521,6 +672,21 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
             renderContext.List->DrawCallsLists[(int32)DrawCallsListType::MotionVectors].PreBatchedDrawCalls.Add(batchIndex);
         }
     }
+}
+
+#endif
+
+void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, DrawCallsList* drawCallsLists)
+{
+    if (!type.Root || !FOLIAGE_CAN_DRAW(renderContext, type))
+        return;
+    const DrawPass typeDrawModes = FOLIAGE_GET_DRAW_MODES(renderContext, type);
+    PROFILE_CPU_ASSET(type.Model);
+#if FOLIAGE_USE_DRAW_CALLS_BATCHING
+    InitDrawCalls(renderContext, type, typeDrawModes, drawCallsLists);
+    BatchedDrawCalls result;
+    DrawCluster(renderContext, type.Root, type, GetImpostor(type, typeDrawModes), drawCallsLists, result);
+    SubmitDrawCalls(renderContext, type, typeDrawModes, result);
 #else
     DrawCluster(renderContext, type.Root, draw);
 #endif
@@ -633,54 +799,56 @@ void Foliage::AddInstance(const FoliageInstance& instance)
 
     // Add instance
     auto data = Instances.Add(instance);
-    data->Bounds = BoundingSphere::Empty;
     data->Random = Random::Rand();
     data->CullDistance = type->CullDistance + type->CullDistanceRandomRange * data->Random;
+    UpdateInstanceBounds(*data);
+    if (IsInClusters(*data))
+        InsertToClusters(*data);
+}
 
-    // Validate foliage type model
-    if (!type->IsReady())
-        return;
+void Foliage::RemoveInstance(ChunkedArray<FoliageInstance, FOLIAGE_INSTANCE_CHUNKS_SIZE>::Iterator i)
+{
+    FoliageInstance& instance = *i;
+    if (IsInClusters(instance))
+        RemoveFromClusters(instance);
 
-    // Update bounds
-    Vector3 corners[8];
-    auto& meshes = type->Model->LODs[0].Meshes;
-    const Transform transform = _transform.LocalToWorld(data->Transform);
-    for (int32 j = 0; j < meshes.Count(); j++)
+    // Last instance is moved into the removed slot so fix its pointer in the cluster
+    FoliageInstance& last = Instances[Instances.Count() - 1];
+    if (&last != &instance && IsInClusters(last))
     {
-        meshes[j].GetBox().GetCorners(corners);
-
-        for (int32 k = 0; k < 8; k++)
-        {
-            Vector3::Transform(corners[k], transform, corners[k]);
-        }
-        BoundingSphere meshBounds;
-        BoundingSphere::FromPoints(corners, 8, meshBounds);
-        ASSERT(meshBounds.Radius > ZeroTolerance);
-
-        BoundingSphere::Merge(data->Bounds, meshBounds, data->Bounds);
+        FoliageCluster* cluster = FindCluster(last, false);
+        const int32 index = cluster ? cluster->Instances.Find(&last) : -1;
+        if (index != -1)
+            cluster->Instances[index] = &instance;
+        else
+            _clustersRebuild = true;
     }
-    data->Bounds.Radius += ZeroTolerance;
-}
 
-void Foliage::RemoveInstance(ChunkedArray<FoliageInstance, FOLIAGE_INSTANCE_CHUNKS_SIZE>::Iterator i)
-{
     Instances.Remove(i);
 }
 
 void Foliage::SetInstanceTransform(int32 index, const Transform& value)
 {
     auto& instance = Instances[index];
-    auto type = &FoliageTypes[instance.Type];
 
     // Change transform
+    const bool inClusters = IsInClusters(instance);
+    if (inClusters)
+        RemoveFromClusters(instance);
     instance.Transform = value;
+    UpdateInstanceBounds(instance);
+    if (inClusters)
+        InsertToClusters(instance);
+}
 
-    // Update bounds
+void Foliage::UpdateInstanceBounds(FoliageInstance& instance) const
+{
+    const FoliageType& type = FoliageTypes[instance.Type];
     instance.Bounds = BoundingSphere::Empty;
-    if (!type->IsReady())
+    if (!type.IsReady())
         return;
     Vector3 corners[8];
-    auto& meshes = type->Model->LODs[0].Meshes;
+    auto& meshes = type.Model->LODs[0].Meshes;
     const Transform transform = _transform.LocalToWorld(instance.Transform);
     for (int32 j = 0; j < meshes.Count(); j++)
     {
@@ -699,6 +867,101 @@ void Foliage::SetInstanceTransform(int32 index, const Transform& value)
     instance.Bounds.Radius += ZeroTolerance;
 }
 
+bool Foliage::IsInClusters(const FoliageInstance& instance) const
+{
+    // Matches the instances filtering in RebuildClusters
+    const FoliageType& type = FoliageTypes[instance.Type];
+    const float densityScale = type.UseDensityScaling ? GetGlobalDensityScale() * type.DensityScalingScale : 1.0f;
+    return type.IsReady() && instance.Random < densityScale;
+}
+
+FoliageCluster* Foliage::FindCluster(const FoliageInstance& instance, bool markDirty)
+{
+#if FOLIAGE_USE_SINGLE_QUAD_TREE
+    FoliageCluster* cluster = Root;
+#else
+    FoliageCluster* cluster = FoliageTypes[instance.Type].Root;
+#endif
+    if (!cluster || !cluster->Bounds.Intersects(instance.Bounds))
+        return nullptr;
+
+    // Follow the same path as AddToCluster
+    while (true)
+    {
+        if (markDirty)
+            cluster->IsDirty = true;
+        if (!cluster->Children[0])
+            break;
+        int32 childIndex = 0;
+        while (childIndex < 3 && !cluster->Children[childIndex]->Bounds.Intersects(instance.Bounds))
+            childIndex++;
+        cluster = cluster->Children[childIndex];
+    }
+    return cluster;
+}
+
+void Foliage::InsertToClusters(FoliageInstance& instance)
+{
+    if (_clustersRebuild)
+        return;
+#if FOLIAGE_USE_SINGLE_QUAD_TREE
+    FoliageCluster* root = Root;
+    auto& clusters = Clusters;
+#else
+    FoliageType& type = FoliageTypes[instance.Type];
+    FoliageCluster* root = type.Root;
+    auto& clusters = type.Clusters;
+#endif
+    if (!FindCluster(instance, true))
+    {
+        // Instance is outside the quad-tree so grow the actor bounds to keep it visible until the clusters get rebuilt
+        _clustersRebuild = true;
+        BoundingBox box;
+        BoundingBox::FromSphere(instance.Bounds, box);
+        BoundingBox::Merge(_box, box, _box);
+        BoundingSphere::FromBox(_box, _sphere);
+        if (_sceneRenderingKey != -1)
+            GetSceneRendering()->UpdateActor(this, _sceneRenderingKey, ISceneRenderingListener::Bounds);
+        return;
+    }
+    AddToCluster(clusters, root, instance);
+    _clustersDirty = true;
+}
+
+void Foliage::RemoveFromClusters(FoliageInstance& instance)
+{
+    if (_clustersRebuild)
+        return;
+    FoliageCluster* cluster = FindCluster(instance, true);
+    if (cluster && cluster->Instances.Remove(&instance))
+        _clustersDirty = true;
+    else
+        _clustersRebuild = true;
+}
+
+void Foliage::FlushClusters()
+{
+    if (_clustersRebuild)
+    {
+        RebuildClusters();
+        return;
+    }
+    if (!_clustersDirty)
+        return;
+    PROFILE_CPU();
+    _clustersDirty = false;
+#if FOLIAGE_USE_SINGLE_QUAD_TREE
+    if (Root)
+        Root->RefitTotalBoundsAndCullDistance();
+#else
+    for (auto& type : FoliageTypes)
+    {
+        if (type.Root)
+            type.Root->RefitTotalBoundsAndCullDistance();
+    }
+#endif
+}
+
 void Foliage::OnFoliageTypeModelLoaded(int32 index)
 {
     if (_disableFoliageTypeEvents)
@@ -802,6 +1065,8 @@ void Foliage::OnFoliageTypeModelLoaded(int32 index)
 void Foliage::RebuildClusters()
 {
     PROFILE_CPU();
+    _clustersRebuild = false;
+    _clustersDirty = false;
 
     // Faster path if foliage is empty or no types is ready
     bool anyTypeReady = false;
@@ -1026,6 +1291,7 @@ void Foliage::SetGlobalDensityScale(float value)
 bool Foliage::Intersects(const Ray& ray, Real& distance, Vector3& normal, int32& instanceIndex)
 {
     PROFILE_CPU();
+    FlushClusters();
 
     instanceIndex = -1;
     normal = Vector3::Up;
@@ -1069,6 +1335,7 @@ void Foliage::Draw(RenderContext& renderContext)
 {
     if (Instances.IsEmpty())
         return;
+    FlushClusters();
     PROFILE_CPU();
     const RenderView& view = renderContext.View;
 
@@ -1200,6 +1467,7 @@ void Foliage::Draw(RenderContextBatch& renderContextBatch)
 {
     if (Instances.IsEmpty())
         return;
+    FlushClusters();
 
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE
     // Run async job for each foliage type
@@ -1217,11 +1485,70 @@ void Foliage::Draw(RenderContextBatch& renderContextBatch)
             }
         }
 
-        // Run async job for each foliage type
         _renderContextBatch = &renderContextBatch;
+#if FOLIAGE_USE_DRAW_CALLS_BATCHING
+        // Setup draw calls for each foliage type and render context and split the foliage types quad-trees into subtrees to draw in async
+        const int32 contextsCount = renderContextBatch.Contexts.Count();
+        const int32 maxJobsPerType = Math::Max(JobSystem::GetThreadsCount() * 2, 1);
+        _drawJobs.Clear();
+        _drawTypeJobs.Clear();
+        _drawTypeContexts.Resize(FoliageTypes.Count() * contextsCount);
+        Array<FoliageCluster*, InlinedAllocation<64>> subtrees;
+        for (int32 typeIndex = 0; typeIndex < FoliageTypes.Count(); typeIndex++)
+        {
+            _drawTypeJobs.Add(_drawJobs.Count());
+            const FoliageType& type = FoliageTypes[typeIndex];
+            bool anyContext = false;
+            for (int32 contextIndex = 0; contextIndex < contextsCount; contextIndex++)
+            {
+                RenderContext& renderContext = renderContextBatch.Contexts[contextIndex];
+                DrawTypeContext& typeContext = _drawTypeContexts[typeIndex * contextsCount + contextIndex];
+                typeContext.DrawModes = DrawPass::None;
+                if (!type.Root || !FOLIAGE_CAN_DRAW(renderContext, type))
+                    continue;
+                typeContext.DrawModes = FOLIAGE_GET_DRAW_MODES(renderContext, type);
+                typeContext.Impostor = GetImpostor(type, typeContext.DrawModes);
+                InitDrawCalls(renderContext, type, typeContext.DrawModes, typeContext.DrawCallsLists);
+                anyContext = true;
+            }
+            if (!anyContext)
+                continue;
+
+            // Expand quad-tree breadth-first until there are enough subtrees
+            const int32 jobsCount = Math::Clamp(type.Clusters.Count() / FOLIAGE_DRAW_JOB_CLUSTERS, 1, maxJobsPerType);
+            const int32 jobsStart = _drawJobs.Count();
+            subtrees.Clear();
+            subtrees.Add(type.Root);
+            int32 head = 0;
+            while (head < subtrees.Count() && _drawJobs.Count() - jobsStart + subtrees.Count() - head < jobsCount)
+            {
+                FoliageCluster* cluster = subtrees[head++];
+                if (cluster->Children[0])
+                    subtrees.Add(cluster->Children, 4);
+                else
+                    _drawJobs.Add({ typeIndex, cluster });
+            }
+            for (; head < subtrees.Count(); head++)
+                _drawJobs.Add({ typeIndex, subtrees[head] });
+        }
+        _drawTypeJobs.Add(_drawJobs.Count());
+        if (_drawJobs.IsEmpty())
+            return;
+        _drawResults.Resize(_drawJobs.Count() * contextsCount);
+
+        // Run async job for each subtree and then merge and submit draw calls for each foliage type
+        Function<void(int32)> drawFunc;
+        drawFunc.Bind<Foliage, &Foliage::DrawSubtreeJob>(this);
+        const int64 drawLabel = JobSystem::Dispatch(drawFunc, _drawJobs.Count());
+        Function<void(int32)> submitFunc;
+        submitFunc.Bind<Foliage, &Foliage::SubmitTypeJob>(this);
+        const int64 waitLabel = JobSystem::Dispatch(submitFunc, ToSpan(&drawLabel, 1), FoliageTypes.Count());
+#else
+        // Run async job for each foliage type
         Function<void(int32)> func;
         func.Bind<Foliage, &Foliage::DrawFoliageJob>(this);
         const uint64 waitLabel = JobSystem::Dispatch(func, FoliageTypes.Count());
+#endif
         renderContextBatch.WaitLabels.Add(waitLabel);
         return;
     }
@@ -17,8 +17,16 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     DECLARE_SCENE_OBJECT(Foliage);
 private:
     bool _disableFoliageTypeEvents;
+    bool _clustersDirty = false; // Clusters got modified by the incremental instance changes and need bounds refit
+    bool _clustersRebuild = false; // Clusters cannot be updated incrementally (eg. instance outside the quad-tree bounds) and need a full rebuild
     int32 _sceneRenderingKey = -1;
 
+public:
+    /// <summary>
+    /// Finalizes an instance of the <see cref="Foliage"/> class.
+    /// </summary>
+    ~Foliage();
+
 public:
     /// <summary>
     /// The allocated foliage instances. It's read-only.
@@ -90,14 +98,14 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     API_FUNCTION() int32 GetFoliageTypeInstancesCount(int32 index) const;
 
     /// <summary>
-    /// Adds the new foliage instance. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Adds the new foliage instance. Clusters are updated incrementally (bounds refit is batched until the next foliage draw).
     /// </summary>
     /// <remarks>Input instance bounds, instance random and world matrix are ignored (recalculated).</remarks>
     /// <param name="instance">The instance.</param>
     API_FUNCTION() void AddInstance(API_PARAM(Ref) const FoliageInstance& instance);
 
     /// <summary>
-    /// Removes the foliage instance. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Removes the foliage instance. Clusters are updated incrementally (bounds refit is batched until the next foliage draw).
     /// </summary>
     /// <param name="index">The zero-based index of the instance to remove.</param>
     API_FUNCTION() void RemoveInstance(int32 index)
@@ -106,13 +114,13 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     }
 
     /// <summary>
-    /// Removes the foliage instance. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Removes the foliage instance. Clusters are updated incrementally (bounds refit is batched until the next foliage draw).
     /// </summary>
     /// <param name="i">The iterator from foliage instances that points to the instance to remove.</param>
     void RemoveInstance(ChunkedArray<FoliageInstance, FOLIAGE_INSTANCE_CHUNKS_SIZE>::Iterator i);
 
     /// <summary>
-    /// Sets the foliage instance transformation. Ensure to always call <see cref="RebuildClusters"/> after editing foliage to sync cached data (call it once after editing one or more instances).
+    /// Sets the foliage instance transformation. Clusters are updated incrementally (bounds refit is batched until the next foliage draw).
     /// </summary>
     /// <param name="index">The zero-based index of the foliage instance.</param>
     /// <param name="value">The value.</param>
@@ -152,6 +160,12 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
 
 private:
     void AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_SIZE>& clusters, FoliageCluster* cluster, FoliageInstance& instance);
+    void UpdateInstanceBounds(FoliageInstance& instance) const;
+    bool IsInClusters(const FoliageInstance& instance) const;
+    FoliageCluster* FindCluster(const FoliageInstance& instance, bool markDirty);
+    void InsertToClusters(FoliageInstance& instance);
+    void RemoveFromClusters(FoliageInstance& instance);
+    void FlushClusters();
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
     struct DrawKey
     {
@@ -176,7 +190,22 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     typedef Array<struct BatchedDrawCall, InlinedAllocation<8>> DrawCallsList;
     typedef Dictionary<DrawKey, struct BatchedDrawCall, class RendererAllocation> BatchedDrawCalls;
     void DrawInstance(RenderContext& renderContext, FoliageInstance& instance, const FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
-    void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
+    void DrawImpostor(RenderContext& renderContext, const FoliageInstance& instance, const struct ModelImpostor* impostor) const;
+    void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, const struct ModelImpostor* impostor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
+    void InitDrawCalls(RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, DrawCallsList* drawCallsLists) const;
+    void SubmitDrawCalls(RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, BatchedDrawCalls& result) const;
+    struct DrawJob
+    {
+        int32 TypeIndex;
+        FoliageCluster* Cluster;
+    };
+    struct DrawTypeContext;
+    Array<DrawJob> _drawJobs; // Async drawing jobs (quad-tree subtrees of the foliage types, grouped by type)
+    Array<int32> _drawTypeJobs; // Index of the first drawing job for each foliage type (with an extra end index)
+    Array<DrawTypeContext> _drawTypeContexts; // Draw calls setup for each foliage type and render context pair
+    Array<BatchedDrawCalls> _drawResults; // Batched draw calls for each drawing job and render context pair
+    void DrawSubtreeJob(int32 i);
+    void SubmitTypeJob(int32 i);
 #else
     void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw);
 #endif
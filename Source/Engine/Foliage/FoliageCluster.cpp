@@ -9,6 +9,7 @@ void FoliageCluster::Init(const BoundingBox& bounds)
     Bounds = bounds;
     TotalBounds = bounds;
     MaxCullDistance = 0.0f;
+    IsDirty = true;
 
     Children[0] = nullptr;
     Children[1] = nullptr;
@@ -22,12 +23,33 @@ void FoliageCluster::UpdateTotalBoundsAndCullDistance()
 {
     if (Children[0])
     {
-        ASSERT(Instances.IsEmpty());
-
         Children[0]->UpdateTotalBoundsAndCullDistance();
         Children[1]->UpdateTotalBoundsAndCullDistance();
         Children[2]->UpdateTotalBoundsAndCullDistance();
         Children[3]->UpdateTotalBoundsAndCullDistance();
+    }
+    UpdateCache();
+}
+
+void FoliageCluster::RefitTotalBoundsAndCullDistance()
+{
+    if (!IsDirty)
+        return;
+    if (Children[0])
+    {
+        Children[0]->RefitTotalBoundsAndCullDistance();
+        Children[1]->RefitTotalBoundsAndCullDistance();
+        Children[2]->RefitTotalBoundsAndCullDistance();
+        Children[3]->RefitTotalBoundsAndCullDistance();
+    }
+    UpdateCache();
+}
+
+void FoliageCluster::UpdateCache()
+{
+    if (Children[0])
+    {
+        ASSERT(Instances.IsEmpty());
 
         TotalBounds = Children[0]->TotalBounds;
         BoundingBox::Merge(TotalBounds, Children[1]->TotalBounds, TotalBounds);
@@ -58,6 +80,7 @@ void FoliageCluster::UpdateTotalBoundsAndCullDistance()
     }
 
     BoundingSphere::FromBox(TotalBounds, TotalBoundsSphere);
+    IsDirty = false;
 }
 
 void FoliageCluster::UpdateCullDistance()
@@ -33,6 +33,11 @@ class FLAXENGINE_API FoliageCluster
     /// </summary>
     float MaxCullDistance;
 
+    /// <summary>
+    /// True if the cluster (or any of its children) has been modified and the cached total bounds and cull distance need to be refit.
+    /// </summary>
+    bool IsDirty;
+
     /// <summary>
     /// The child clusters. If any element is valid then all are created.
     /// </summary>
@@ -55,6 +60,11 @@ class FLAXENGINE_API FoliageCluster
     /// </summary>
     void UpdateTotalBoundsAndCullDistance();
 
+    /// <summary>
+    /// Updates the total bounds and cull distance of the dirty clusters only (skips unmodified subtrees).
+    /// </summary>
+    void RefitTotalBoundsAndCullDistance();
+
     /// <summary>
     /// Updates the cull distance for all foliage instances added to the cluster and its children.
     /// </summary>
@@ -70,4 +80,7 @@ class FLAXENGINE_API FoliageCluster
     /// <param name="instance">When the method completes, contains pointer of the foliage instance that is the closest to the ray.</param>
     /// <returns>True whether the two objects intersected, otherwise false.</returns>
     bool Intersects(Foliage* foliage, const Ray& ray, Real& distance, Vector3& normal, FoliageInstance*& instance);
+
+private:
+    void UpdateCache();
 };
@@ -30,6 +30,7 @@ FoliageType& FoliageType::operator=(const FoliageType& other)
     Entries = other.Entries;
     CullDistance = other.CullDistance;
     CullDistanceRandomRange = other.CullDistanceRandomRange;
+    ImpostorDistance = other.ImpostorDistance;
     ScaleInLightmap = other.ScaleInLightmap;
     DrawModes = other.DrawModes;
     ShadowsMode = other.ShadowsMode;
@@ -145,6 +146,7 @@ void FoliageType::Serialize(SerializeStream& stream, const void* otherObj)
 
     SERIALIZE(CullDistance);
     SERIALIZE(CullDistanceRandomRange);
+    SERIALIZE(ImpostorDistance);
     SERIALIZE(ScaleInLightmap);
     SERIALIZE(DrawModes);
     SERIALIZE(ShadowsMode);
@@ -185,6 +187,7 @@ void FoliageType::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
 
     DESERIALIZE(CullDistance);
     DESERIALIZE(CullDistanceRandomRange);
+    DESERIALIZE(ImpostorDistance);
     DESERIALIZE(ScaleInLightmap);
     DESERIALIZE(DrawModes);
     DESERIALIZE(ShadowsMode);
@@ -117,6 +117,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     /// </summary>
     API_FIELD() float CullDistanceRandomRange = 1000.0f;
 
+    /// <summary>
+    /// The distance from the view at which the instances get drawn as impostors (octahedral billboards baked from the model). Value 0 disables impostors.
+    /// </summary>
+    API_FIELD() float ImpostorDistance = 0.0f;
+
     /// <summary>
     /// The scale in lightmap (for instances of this foliage type). Can be used to adjust static lighting quality for the foliage instances.
     /// </summary>
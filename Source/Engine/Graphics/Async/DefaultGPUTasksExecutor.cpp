@@ -34,6 +34,7 @@ void DefaultGPUTasksExecutor::FrameBegin()
     {
         _context->Run(buffer[i]);
     }
+    _context->SubmitCopy();
 }
 
 void DefaultGPUTasksExecutor::FrameEnd()
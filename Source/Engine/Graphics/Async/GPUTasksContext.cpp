@@ -4,6 +4,7 @@
 #include "GPUTask.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/Globals.h"
 
@@ -56,6 +57,25 @@ void GPUTasksContext::Run(GPUTask* task)
     task->Execute(this);
 }
 
+GPUContext* GPUTasksContext::GetCopyContext()
+{
+    if (_copy == nullptr)
+    {
+        if (Graphics::CopyQueueUploads && GetDevice()->Limits.HasCopyQueue)
+            _copy = GetDevice()->GetCopyContext();
+        if (_copy == nullptr)
+            _copy = GPU;
+    }
+    return _copy;
+}
+
+void GPUTasksContext::SubmitCopy()
+{
+    if (_copy && _copy != GPU)
+        GetDevice()->SubmitCopy();
+    _copy = nullptr;
+}
+
 void GPUTasksContext::OnCancelSync(GPUTask* task)
 {
     ASSERT(task != nullptr);
@@ -19,6 +19,7 @@ class GPUTasksContext
     GPUSyncPoint _currentSyncPoint;
     Array<GPUTask*> _tasksDone;
     int32 _totalTasksDoneCount;
+    GPUContext* _copy = nullptr;
 
 public:
     /// <summary>
@@ -39,6 +40,16 @@ class GPUTasksContext
     GPUContext* GPU;
 
 public:
+    /// <summary>
+    /// Gets the GPU commands context for the data transfers (copy and update commands only). Uses the device copy queue if enabled (see Graphics::CopyQueueUploads), otherwise the main tasks context.
+    /// </summary>
+    GPUContext* GetCopyContext();
+
+    /// <summary>
+    /// Submits the data transfers recorded on the copy context (if used).
+    /// </summary>
+    void SubmitCopy();
+
     /// <summary>
     /// Gets graphics device handle
     /// </summary>
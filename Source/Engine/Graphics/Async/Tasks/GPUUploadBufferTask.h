@@ -58,7 +58,7 @@ class GPUUploadBufferTask : public GPUTask
     {
         if (!_buffer)
             return Result::MissingResources;
-        context->GPU->UpdateBuffer(_buffer, _data.Get(), _data.Length(), _offset);
+        context->GetCopyContext()->UpdateBuffer(_buffer, _data.Get(), _data.Length(), _offset);
         return Result::Ok;
     }
     void OnEnd() override
@@ -69,9 +69,10 @@ class GPUUploadTextureMipTask : public GPUTask
         const byte* dataSource = _data.Get();
         const int32 arraySize = texture->ArraySize();
         ASSERT(_data.Length() >= _slicePitch * arraySize);
+        GPUContext* copyContext = context->GetCopyContext();
         for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
         {
-            context->GPU->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, _rowPitch, _slicePitch);
+            copyContext->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, _rowPitch, _slicePitch);
             dataSource += _slicePitch;
         }
 
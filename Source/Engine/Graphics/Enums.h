@@ -1151,3 +1151,62 @@ API_ENUM() enum class ProbeCubemapResolution
     // Cubemap with 2048x2048.
     _2048 = 2048,
 };
+
+/// <summary>
+/// The pixel shading rate used by the variable rate shading (the size of the pixels block that shares a single pixel shader invocation). Values match the encoding used by the shading rate images (log2 of width in bits 2-3 and log2 of height in bits 0-1).
+/// </summary>
+API_ENUM() enum class ShadingRate : byte
+{
+    // Pixel shader invoked for every pixel.
+    _1x1 = 0x0,
+    // Pixel shader invoked once per 1x2 pixels block.
+    _1x2 = 0x1,
+    // Pixel shader invoked once per 2x1 pixels block.
+    _2x1 = 0x4,
+    // Pixel shader invoked once per 2x2 pixels block.
+    _2x2 = 0x5,
+    // Pixel shader invoked once per 2x4 pixels block.
+    _2x4 = 0x6,
+    // Pixel shader invoked once per 4x2 pixels block.
+    _4x2 = 0x9,
+    // Pixel shader invoked once per 4x4 pixels block.
+    _4x4 = 0xA,
+};
+
+/// <summary>
+/// The rendering passes that can use the variable rate shading with the engine-generated shading rate image (based on the scene luminance contrast and motion).
+/// </summary>
+API_ENUM(Attributes="Flags") enum class VariableRateShadingPasses
+{
+    /// <summary>
+    /// Variable rate shading is not used.
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    /// The height fog (including volumetric fog) composite pass.
+    /// </summary>
+    Fog = 1 << 0,
+
+    /// <summary>
+    /// The forward pass (transparent materials).
+    /// </summary>
+    Forward = 1 << 1,
+
+    /// <summary>
+    /// The depth of field full-resolution passes.
+    /// </summary>
+    DepthOfField = 1 << 2,
+
+    /// <summary>
+    /// The motion blur pass.
+    /// </summary>
+    MotionBlur = 1 << 3,
+
+    /// <summary>
+    /// All supported passes.
+    /// </summary>
+    All = Fog | Forward | DepthOfField | MotionBlur,
+};
+
+DECLARE_ENUM_OPERATORS(VariableRateShadingPasses);
@@ -68,6 +68,10 @@ void GPUContext::SetResourceState(GPUResource* resource, uint64 state, int32 sub
 {
 }
 
+void GPUContext::SetShadingRate(ShadingRate rate, GPUTexture* rateImage)
+{
+}
+
 void GPUContext::ForceRebindDescriptors()
 {
 }
@@ -7,6 +7,7 @@
 #include "Engine/Core/Math/Rectangle.h"
 #include "Engine/Core/Math/Viewport.h"
 #include "PixelFormat.h"
+#include "Enums.h"
 #include "Config.h"
 
 class GPUConstantBuffer;
@@ -328,6 +329,13 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     /// <param name="value">Reference value to perform against when doing a depth-stencil test.</param>
     API_FUNCTION() virtual void SetStencilRef(uint32 value) = 0;
 
+    /// <summary>
+    /// Sets the variable rate shading for the next draw calls. Does nothing if not supported by the device (see GPULimits::HasVariableRateShading).
+    /// </summary>
+    /// <param name="rate">The base shading rate.</param>
+    /// <param name="rateImage">The optional shading rate image (texture with R8_UInt format and ShadingRate value per screen tile of GPULimits::ShadingRateImageTileSize pixels). The coarser of the base and the image rates is used. Ignored if not supported (see GPULimits::HasVariableRateShadingImage).</param>
+    API_FUNCTION() virtual void SetShadingRate(ShadingRate rate, GPUTexture* rateImage = nullptr);
+
 public:
     /// <summary>
     /// Unbinds all shader resource slots and flushes the change with the driver (used to prevent driver detection of resource hazards, eg. when down-scaling the texture).
@@ -0,0 +1,849 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "GPUDeferredContext.h"
+#include "GPUDevice.h"
+#include "Engine/Core/Math/Color.h"
+#include "Engine/Core/Math/Rectangle.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Core/Math/Viewport.h"
+#include "Shaders/GPUConstantBuffer.h"
+
+namespace
+{
+    namespace CommandType
+    {
+        enum Types
+        {
+            EventBegin,
+            EventEnd,
+            Clear,
+            ClearDepth,
+            ClearUABufferFloat,
+            ClearUABufferUInt,
+            ClearUATextureUInt,
+            ClearUATextureFloat,
+            ResetRenderTarget,
+            SetRenderTarget,
+            SetBlendFactor,
+            SetStencilRef,
+            ResetSR,
+            ResetUA,
+            ResetCB,
+            BindCB,
+            BindSR,
+            BindUA,
+            BindVB,
+            BindIB,
+            BindSampler,
+            UpdateCB,
+            Dispatch,
+            DispatchIndirect,
+            ResolveMultisample,
+            DrawInstanced,
+            DrawIndexedInstanced,
+            DrawInstancedIndirect,
+            DrawIndexedInstancedIndirect,
+            SetViewport,
+            SetScissor,
+            SetState,
+            ClearState,
+            FlushState,
+            Flush,
+            UpdateBuffer,
+            CopyBuffer,
+            UpdateTexture,
+            CopyTexture,
+            ResetCounter,
+            CopyCounter,
+            CopyResource,
+            CopySubresource,
+            SetResourceState,
+            ForceRebindDescriptors,
+        };
+    }
+
+    struct CommandHeader
+    {
+        int32 Type;
+        // The size of the command data (including header and payload, aligned).
+        int32 Size;
+    };
+
+    struct CommandClear
+    {
+        GPUTextureView* View;
+        Color Value;
+    };
+
+    struct CommandClearDepth
+    {
+        GPUTextureView* View;
+        float Depth;
+        uint8 Stencil;
+    };
+
+    struct CommandClearUA
+    {
+        GPUResource* Resource;
+        union
+        {
+            Float4 Float;
+            uint32 UInt[4];
+        };
+    };
+
+    struct CommandSetRenderTarget
+    {
+        GPUTextureView* DepthBuffer;
+        int32 Count;
+        GPUTextureView* RTs[GPU_MAX_RT_BINDED];
+    };
+
+    struct CommandBind
+    {
+        int32 Slot;
+        void* Object;
+    };
+
+    struct CommandBindVB
+    {
+        int32 Count;
+        bool HasOffsets;
+        GPUBuffer* Buffers[GPU_MAX_VB_BINDED];
+        uint32 Offsets[GPU_MAX_VB_BINDED];
+    };
+
+    struct CommandUpdateCB
+    {
+        GPUConstantBuffer* CB;
+        // Followed by the constant buffer data.
+    };
+
+    struct CommandDispatch
+    {
+        GPUShaderProgramCS* Shader;
+        uint32 X, Y, Z;
+    };
+
+    struct CommandDispatchIndirect
+    {
+        GPUShaderProgramCS* Shader;
+        GPUBuffer* Args;
+        uint32 Offset;
+    };
+
+    struct CommandResolveMultisample
+    {
+        GPUTexture* Source;
+        GPUTexture* Destination;
+        int32 SourceSubResource;
+        int32 DestinationSubResource;
+        PixelFormat Format;
+    };
+
+    struct CommandDraw
+    {
+        uint32 Count;
+        uint32 InstanceCount;
+        int32 StartInstance;
+        int32 StartVertex;
+        int32 StartIndex;
+    };
+
+    struct CommandDrawIndirect
+    {
+        GPUBuffer* Args;
+        uint32 Offset;
+    };
+
+    struct CommandUpdateBuffer
+    {
+        GPUBuffer* Buffer;
+        uint32 Size;
+        uint32 Offset;
+        // Followed by the buffer data.
+    };
+
+    struct CommandCopyBuffer
+    {
+        GPUBuffer* Dst;
+        GPUBuffer* Src;
+        uint32 Size;
+        uint32 DstOffset;
+        uint32 SrcOffset;
+    };
+
+    struct CommandUpdateTexture
+    {
+        GPUTexture* Texture;
+        int32 ArrayIndex;
+        int32 MipIndex;
+        uint32 RowPitch;
+        uint32 SlicePitch;
+        // Followed by the texture data.
+    };
+
+    struct CommandCopyTexture
+    {
+        GPUTexture* Dst;
+        uint32 DstSubresource;
+        uint32 DstX, DstY, DstZ;
+        GPUTexture* Src;
+        uint32 SrcSubresource;
+    };
+
+    struct CommandCopyCounter
+    {
+        GPUBuffer* Dst;
+        uint32 DstOffset;
+        GPUBuffer* Src;
+    };
+
+    struct CommandCopyResource
+    {
+        GPUResource* Dst;
+        uint32 DstSubresource;
+        GPUResource* Src;
+        uint32 SrcSubresource;
+    };
+
+    struct CommandSetResourceState
+    {
+        GPUResource* Resource;
+        uint64 State;
+        int32 Subresource;
+    };
+}
+
+GPUDeferredContext::GPUDeferredContext(GPUDevice* device)
+    : GPUContext(device)
+{
+}
+
+void GPUDeferredContext::Reset()
+{
+    _commands.Clear();
+    _state = nullptr;
+    _hasDepthBuffer = false;
+    _count = 0;
+}
+
+void GPUDeferredContext::Execute(GPUContext* context) const
+{
+    ASSERT(context && context != this);
+    const byte* ptr = _commands.Get();
+    const byte* end = ptr + _commands.Count();
+    while (ptr < end)
+    {
+        const CommandHeader* header = (const CommandHeader*)ptr;
+        const void* cmd = ptr + sizeof(CommandHeader);
+        switch (header->Type)
+        {
+#if GPU_ALLOW_PROFILE_EVENTS
+        case CommandType::EventBegin:
+            context->EventBegin((const Char*)cmd);
+            break;
+        case CommandType::EventEnd:
+            context->EventEnd();
+            break;
+#endif
+        case CommandType::Clear:
+        {
+            auto& c = *(const CommandClear*)cmd;
+            context->Clear(c.View, c.Value);
+            break;
+        }
+        case CommandType::ClearDepth:
+        {
+            auto& c = *(const CommandClearDepth*)cmd;
+            context->ClearDepth(c.View, c.Depth, c.Stencil);
+            break;
+        }
+        case CommandType::ClearUABufferFloat:
+        {
+            auto& c = *(const CommandClearUA*)cmd;
+            context->ClearUA((GPUBuffer*)c.Resource, c.Float);
+            break;
+        }
+        case CommandType::ClearUABufferUInt:
+        {
+            auto& c = *(const CommandClearUA*)cmd;
+            context->ClearUA((GPUBuffer*)c.Resource, c.UInt);
+            break;
+        }
+        case CommandType::ClearUATextureUInt:
+        {
+            auto& c = *(const CommandClearUA*)cmd;
+            context->ClearUA((GPUTexture*)c.Resource, c.UInt);
+            break;
+        }
+        case CommandType::ClearUATextureFloat:
+        {
+            auto& c = *(const CommandClearUA*)cmd;
+            context->ClearUA((GPUTexture*)c.Resource, c.Float);
+            break;
+        }
+        case CommandType::ResetRenderTarget:
+            context->ResetRenderTarget();
+            break;
+        case CommandType::SetRenderTarget:
+        {
+            auto& c = *(const CommandSetRenderTarget*)cmd;
+            context->SetRenderTarget(c.DepthBuffer, ToSpan((GPUTextureView**)c.RTs, c.Count));
+            break;
+        }
+        case CommandType::SetBlendFactor:
+            context->SetBlendFactor(*(const Float4*)cmd);
+            break;
+        case CommandType::SetStencilRef:
+            context->SetStencilRef(*(const uint32*)cmd);
+            break;
+        case CommandType::ResetSR:
+            context->ResetSR();
+            break;
+        case CommandType::ResetUA:
+            context->ResetUA();
+            break;
+        case CommandType::ResetCB:
+            context->ResetCB();
+            break;
+        case CommandType::BindCB:
+        {
+            auto& c = *(const CommandBind*)cmd;
+            context->BindCB(c.Slot, (GPUConstantBuffer*)c.Object);
+            break;
+        }
+        case CommandType::BindSR:
+        {
+            auto& c = *(const CommandBind*)cmd;
+            context->BindSR(c.Slot, (GPUResourceView*)c.Object);
+            break;
+        }
+        case CommandType::BindUA:
+        {
+            auto& c = *(const CommandBind*)cmd;
+            context->BindUA(c.Slot, (GPUResourceView*)c.Object);
+            break;
+        }
+        case CommandType::BindVB:
+        {
+            auto& c = *(const CommandBindVB*)cmd;
+            context->BindVB(ToSpan((GPUBuffer**)c.Buffers, c.Count), c.HasOffsets ? c.Offsets : nullptr);
+            break;
+        }
+        case CommandType::BindIB:
+            context->BindIB((GPUBuffer*)((const CommandBind*)cmd)->Object);
+            break;
+        case CommandType::BindSampler:
+        {
+            auto& c = *(const CommandBind*)cmd;
+            context->BindSampler(c.Slot, (GPUSampler*)c.Object);
+            break;
+        }
+        case CommandType::UpdateCB:
+        {
+            auto& c = *(const CommandUpdateCB*)cmd;
+            context->UpdateCB(c.CB, &c + 1);
+            break;
+        }
+        case CommandType::Dispatch:
+        {
+            auto& c = *(const CommandDispatch*)cmd;
+            context->Dispatch(c.Shader, c.X, c.Y, c.Z);
+            break;
+        }
+        case CommandType::DispatchIndirect:
+        {
+            auto& c = *(const CommandDispatchIndirect*)cmd;
+            context->DispatchIndirect(c.Shader, c.Args, c.Offset);
+            break;
+        }
+        case CommandType::ResolveMultisample:
+        {
+            auto& c = *(const CommandResolveMultisample*)cmd;
+            context->ResolveMultisample(c.Source, c.Destination, c.SourceSubResource, c.DestinationSubResource, c.Format);
+            break;
+        }
+        case CommandType::DrawInstanced:
+        {
+            auto& c = *(const CommandDraw*)cmd;
+            context->DrawInstanced(c.Count, c.InstanceCount, c.StartInstance, c.StartVertex);
+            break;
+        }
+        case CommandType::DrawIndexedInstanced:
+        {
+            auto& c = *(const CommandDraw*)cmd;
+            context->DrawIndexedInstanced(c.Count, c.InstanceCount, c.StartInstance, c.StartVertex, c.StartIndex);
+            break;
+        }
+        case CommandType::DrawInstancedIndirect:
+        {
+            auto& c = *(const CommandDrawIndirect*)cmd;
+            context->DrawInstancedIndirect(c.Args, c.Offset);
+            break;
+        }
+        case CommandType::DrawIndexedInstancedIndirect:
+        {
+            auto& c = *(const CommandDrawIndirect*)cmd;
+            context->DrawIndexedInstancedIndirect(c.Args, c.Offset);
+            break;
+        }
+        case CommandType::SetViewport:
+            context->SetViewport(*(const Viewport*)cmd);
+            break;
+        case CommandType::SetScissor:
+            context->SetScissor(*(const Rectangle*)cmd);
+            break;
+        case CommandType::SetState:
+            context->SetState((GPUPipelineState*)((const CommandBind*)cmd)->Object);
+            break;
+        case CommandType::ClearState:
+            context->ClearState();
+            break;
+        case CommandType::FlushState:
+            context->FlushState();
+            break;
+        case CommandType::Flush:
+            context->Flush();
+            break;
+        case CommandType::UpdateBuffer:
+        {
+            auto& c = *(const CommandUpdateBuffer*)cmd;
+            context->UpdateBuffer(c.Buffer, &c + 1, c.Size, c.Offset);
+            break;
+        }
+        case CommandType::CopyBuffer:
+        {
+            auto& c = *(const CommandCopyBuffer*)cmd;
+            context->CopyBuffer(c.Dst, c.Src, c.Size, c.DstOffset, c.SrcOffset);
+            break;
+        }
+        case CommandType::UpdateTexture:
+        {
+            auto& c = *(const CommandUpdateTexture*)cmd;
+            context->UpdateTexture(c.Texture, c.ArrayIndex, c.MipIndex, &c + 1, c.RowPitch, c.SlicePitch);
+            break;
+        }
+        case CommandType::CopyTexture:
+        {
+            auto& c = *(const CommandCopyTexture*)cmd;
+            context->CopyTexture(c.Dst, c.DstSubresource, c.DstX, c.DstY, c.DstZ, c.Src, c.SrcSubresource);
+            break;
+        }
+        case CommandType::ResetCounter:
+            context->ResetCounter((GPUBuffer*)((const CommandBind*)cmd)->Object);
+            break;
+        case CommandType::CopyCounter:
+        {
+            auto& c = *(const CommandCopyCounter*)cmd;
+            context->CopyCounter(c.Dst, c.DstOffset, c.Src);
+            break;
+        }
+        case CommandType::CopyResource:
+        {
+            auto& c = *(const CommandCopyResource*)cmd;
+            context->CopyResource(c.Dst, c.Src);
+            break;
+        }
+        case CommandType::CopySubresource:
+        {
+            auto& c = *(const CommandCopyResource*)cmd;
+            context->CopySubresource(c.Dst, c.DstSubresource, c.Src, c.SrcSubresource);
+            break;
+        }
+        case CommandType::SetResourceState:
+        {
+            auto& c = *(const CommandSetResourceState*)cmd;
+            context->SetResourceState(c.Resource, c.State, c.Subresource);
+            break;
+        }
+        case CommandType::ForceRebindDescriptors:
+            context->ForceRebindDescriptors();
+            break;
+        default:
+            CRASH;
+        }
+        ptr += header->Size;
+    }
+}
+
+void* GPUDeferredContext::Write(int32 type, int32 size, int32 dataSize)
+{
+    // Keep all commands aligned to the pointer size
+    const int32 commandSize = Math::AlignUp<int32>(sizeof(CommandHeader) + size + dataSize, sizeof(void*));
+    const int32 position = _commands.Count();
+    _commands.AddUninitialized(commandSize);
+    auto header = (CommandHeader*)(_commands.Get() + position);
+    header->Type = type;
+    header->Size = commandSize;
+    _count++;
+    return header + 1;
+}
+
+void GPUDeferredContext::Write(int32 type)
+{
+    Write(type, 0, 0);
+}
+
+#if GPU_ALLOW_PROFILE_EVENTS
+
+void GPUDeferredContext::EventBegin(const Char* name)
+{
+    const int32 length = StringUtils::Length(name);
+    auto dst = (Char*)Write(CommandType::EventBegin, 0, (length + 1) * sizeof(Char));
+    Platform::MemoryCopy(dst, name, (length + 1) * sizeof(Char));
+}
+
+void GPUDeferredContext::EventEnd()
+{
+    Write(CommandType::EventEnd);
+}
+
+#endif
+
+void* GPUDeferredContext::GetNativePtr() const
+{
+    return nullptr;
+}
+
+bool GPUDeferredContext::IsDepthBufferBinded()
+{
+    return _hasDepthBuffer;
+}
+
+void GPUDeferredContext::Clear(GPUTextureView* rt, const Color& color)
+{
+    auto c = Write<CommandClear>(CommandType::Clear);
+    c->View = rt;
+    c->Value = color;
+}
+
+void GPUDeferredContext::ClearDepth(GPUTextureView* depthBuffer, float depthValue, uint8 stencilValue)
+{
+    auto c = Write<CommandClearDepth>(CommandType::ClearDepth);
+    c->View = depthBuffer;
+    c->Depth = depthValue;
+    c->Stencil = stencilValue;
+}
+
+void GPUDeferredContext::ClearUA(GPUBuffer* buf, const Float4& value)
+{
+    auto c = Write<CommandClearUA>(CommandType::ClearUABufferFloat);
+    c->Resource = (GPUResource*)buf;
+    c->Float = value;
+}
+
+void GPUDeferredContext::ClearUA(GPUBuffer* buf, const uint32 value[4])
+{
+    auto c = Write<CommandClearUA>(CommandType::ClearUABufferUInt);
+    c->Resource = (GPUResource*)buf;
+    Platform::MemoryCopy(c->UInt, value, sizeof(c->UInt));
+}
+
+void GPUDeferredContext::ClearUA(GPUTexture* texture, const uint32 value[4])
+{
+    auto c = Write<CommandClearUA>(CommandType::ClearUATextureUInt);
+    c->Resource = (GPUResource*)texture;
+    Platform::MemoryCopy(c->UInt, value, sizeof(c->UInt));
+}
+
+void GPUDeferredContext::ClearUA(GPUTexture* texture, const Float4& value)
+{
+    auto c = Write<CommandClearUA>(CommandType::ClearUATextureFloat);
+    c->Resource = (GPUResource*)texture;
+    c->Float = value;
+}
+
+void GPUDeferredContext::ResetRenderTarget()
+{
+    _hasDepthBuffer = false;
+    Write(CommandType::ResetRenderTarget);
+}
+
+void GPUDeferredContext::SetRenderTarget(GPUTextureView* rt)
+{
+    SetRenderTarget(nullptr, ToSpan(&rt, 1));
+}
+
+void GPUDeferredContext::SetRenderTarget(GPUTextureView* depthBuffer, GPUTextureView* rt)
+{
+    SetRenderTarget(depthBuffer, ToSpan(&rt, rt ? 1 : 0));
+}
+
+void GPUDeferredContext::SetRenderTarget(GPUTextureView* depthBuffer, const Span<GPUTextureView*>& rts)
+{
+    ASSERT(rts.Length() <= GPU_MAX_RT_BINDED);
+    _hasDepthBuffer = depthBuffer != nullptr;
+    auto c = Write<CommandSetRenderTarget>(CommandType::SetRenderTarget);
+    c->DepthBuffer = depthBuffer;
+    c->Count = rts.Length();
+    Platform::MemoryCopy(c->RTs, rts.Get(), rts.Length() * sizeof(GPUTextureView*));
+}
+
+void GPUDeferredContext::SetBlendFactor(const Float4& value)
+{
+    *Write<Float4>(CommandType::SetBlendFactor) = value;
+}
+
+void GPUDeferredContext::SetStencilRef(uint32 value)
+{
+    *Write<uint32>(CommandType::SetStencilRef) = value;
+}
+
+void GPUDeferredContext::ResetSR()
+{
+    Write(CommandType::ResetSR);
+}
+
+void GPUDeferredContext::ResetUA()
+{
+    Write(CommandType::ResetUA);
+}
+
+void GPUDeferredContext::ResetCB()
+{
+    Write(CommandType::ResetCB);
+}
+
+void GPUDeferredContext::BindCB(int32 slot, GPUConstantBuffer* cb)
+{
+    auto c = Write<CommandBind>(CommandType::BindCB);
+    c->Slot = slot;
+    c->Object = cb;
+}
+
+void GPUDeferredContext::BindSR(int32 slot, GPUResourceView* view)
+{
+    auto c = Write<CommandBind>(CommandType::BindSR);
+    c->Slot = slot;
+    c->Object = view;
+}
+
+void GPUDeferredContext::BindUA(int32 slot, GPUResourceView* view)
+{
+    auto c = Write<CommandBind>(CommandType::BindUA);
+    c->Slot = slot;
+    c->Object = view;
+}
+
+void GPUDeferredContext::BindVB(const Span<GPUBuffer*>& vertexBuffers, const uint32* vertexBuffersOffsets)
+{
+    ASSERT(vertexBuffers.Length() <= GPU_MAX_VB_BINDED);
+    auto c = Write<CommandBindVB>(CommandType::BindVB);
+    c->Count = vertexBuffers.Length();
+    c->HasOffsets = vertexBuffersOffsets != nullptr;
+    Platform::MemoryCopy(c->Buffers, vertexBuffers.Get(), vertexBuffers.Length() * sizeof(GPUBuffer*));
+    if (vertexBuffersOffsets)
+        Platform::MemoryCopy(c->Offsets, vertexBuffersOffsets, vertexBuffers.Length() * sizeof(uint32));
+}
+
+void GPUDeferredContext::BindIB(GPUBuffer* indexBuffer)
+{
+    auto c = Write<CommandBind>(CommandType::BindIB);
+    c->Object = indexBuffer;
+}
+
+void GPUDeferredContext::BindSampler(int32 slot, GPUSampler* sampler)
+{
+    auto c = Write<CommandBind>(CommandType::BindSampler);
+    c->Slot = slot;
+    c->Object = sampler;
+}
+
+void GPUDeferredContext::UpdateCB(GPUConstantBuffer* cb, const void* data)
+{
+    ASSERT(cb && data);
+    const uint32 size = cb->GetSize();
+    auto c = Write<CommandUpdateCB>(CommandType::UpdateCB, size);
+    c->CB = cb;
+    Platform::MemoryCopy(c + 1, data, size);
+}
+
+void GPUDeferredContext::Dispatch(GPUShaderProgramCS* shader, uint32 threadGroupCountX, uint32 threadGroupCountY, uint32 threadGroupCountZ)
+{
+    auto c = Write<CommandDispatch>(CommandType::Dispatch);
+    c->Shader = shader;
+    c->X = threadGroupCountX;
+    c->Y = threadGroupCountY;
+    c->Z = threadGroupCountZ;
+}
+
+void GPUDeferredContext::DispatchIndirect(GPUShaderProgramCS* shader, GPUBuffer* bufferForArgs, uint32 offsetForArgs)
+{
+    auto c = Write<CommandDispatchIndirect>(CommandType::DispatchIndirect);
+    c->Shader = shader;
+    c->Args = bufferForArgs;
+    c->Offset = offsetForArgs;
+}
+
+void GPUDeferredContext::ResolveMultisample(GPUTexture* sourceMultisampleTexture, GPUTexture* destTexture, int32 sourceSubResource, int32 destSubResource, PixelFormat format)
+{
+    auto c = Write<CommandResolveMultisample>(CommandType::ResolveMultisample);
+    c->Source = sourceMultisampleTexture;
+    c->Destination = destTexture;
+    c->SourceSubResource = sourceSubResource;
+    c->DestinationSubResource = destSubResource;
+    c->Format = format;
+}
+
+void GPUDeferredContext::DrawInstanced(uint32 verticesCount, uint32 instanceCount, int32 startInstance, int32 startVertex)
+{
+    auto c = Write<CommandDraw>(CommandType::DrawInstanced);
+    c->Count = verticesCount;
+    c->InstanceCount = instanceCount;
+    c->StartInstance = startInstance;
+    c->StartVertex = startVertex;
+    c->StartIndex = 0;
+}
+
+void GPUDeferredContext::DrawIndexedInstanced(uint32 indicesCount, uint32 instanceCount, int32 startInstance, int32 startVertex, int32 startIndex)
+{
+    auto c = Write<CommandDraw>(CommandType::DrawIndexedInstanced);
+    c->Count = indicesCount;
+    c->InstanceCount = instanceCount;
+    c->StartInstance = startInstance;
+    c->StartVertex = startVertex;
+    c->StartIndex = startIndex;
+}
+
+void GPUDeferredContext::DrawInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs)
+{
+    auto c = Write<CommandDrawIndirect>(CommandType::DrawInstancedIndirect);
+    c->Args = bufferForArgs;
+    c->Offset = offsetForArgs;
+}
+
+void GPUDeferredContext::DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs)
+{
+    auto c = Write<CommandDrawIndirect>(CommandType::DrawIndexedInstancedIndirect);
+    c->Args = bufferForArgs;
+    c->Offset = offsetForArgs;
+}
+
+void GPUDeferredContext::SetViewport(const Viewport& viewport)
+{
+    *Write<Viewport>(CommandType::SetViewport) = viewport;
+}
+
+void GPUDeferredContext::SetScissor(const Rectangle& scissorRect)
+{
+    *Write<Rectangle>(CommandType::SetScissor) = scissorRect;
+}
+
+GPUPipelineState* GPUDeferredContext::GetState() const
+{
+    return _state;
+}
+
+void GPUDeferredContext::SetState(GPUPipelineState* state)
+{
+    _state = state;
+    auto c = Write<CommandBind>(CommandType::SetState);
+    c->Object = state;
+}
+
+void GPUDeferredContext::ClearState()
+{
+    _state = nullptr;
+    _hasDepthBuffer = false;
+    Write(CommandType::ClearState);
+}
+
+void GPUDeferredContext::FlushState()
+{
+    Write(CommandType::FlushState);
+}
+
+void GPUDeferredContext::Flush()
+{
+    Write(CommandType::Flush);
+}
+
+void GPUDeferredContext::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset)
+{
+    ASSERT(data);
+    auto c = Write<CommandUpdateBuffer>(CommandType::UpdateBuffer, size);
+    c->Buffer = buffer;
+    c->Size = size;
+    c->Offset = offset;
+    Platform::MemoryCopy(c + 1, data, size);
+}
+
+void GPUDeferredContext::CopyBuffer(GPUBuffer* dstBuffer, GPUBuffer* srcBuffer, uint32 size, uint32 dstOffset, uint32 srcOffset)
+{
+    auto c = Write<CommandCopyBuffer>(CommandType::CopyBuffer);
+    c->Dst = dstBuffer;
+    c->Src = srcBuffer;
+    c->Size = size;
+    c->DstOffset = dstOffset;
+    c->SrcOffset = srcOffset;
+}
+
+void GPUDeferredContext::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch)
+{
+    ASSERT(data);
+    auto c = Write<CommandUpdateTexture>(CommandType::UpdateTexture, slicePitch);
+    c->Texture = texture;
+    c->ArrayIndex = arrayIndex;
+    c->MipIndex = mipIndex;
+    c->RowPitch = rowPitch;
+    c->SlicePitch = slicePitch;
+    Platform::MemoryCopy(c + 1, data, slicePitch);
+}
+
+void GPUDeferredContext::CopyTexture(GPUTexture* dstResource, uint32 dstSubresource, uint32 dstX, uint32 dstY, uint32 dstZ, GPUTexture* srcResource, uint32 srcSubresource)
+{
+    auto c = Write<CommandCopyTexture>(CommandType::CopyTexture);
+    c->Dst = dstResource;
+    c->DstSubresource = dstSubresource;
+    c->DstX = dstX;
+    c->DstY = dstY;
+    c->DstZ = dstZ;
+    c->Src = srcResource;
+    c->SrcSubresource = srcSubresource;
+}
+
+void GPUDeferredContext::ResetCounter(GPUBuffer* buffer)
+{
+    auto c = Write<CommandBind>(CommandType::ResetCounter);
+    c->Object = buffer;
+}
+
+void GPUDeferredContext::CopyCounter(GPUBuffer* dstBuffer, uint32 dstOffset, GPUBuffer* srcBuffer)
+{
+    auto c = Write<CommandCopyCounter>(CommandType::CopyCounter);
+    c->Dst = dstBuffer;
+    c->DstOffset = dstOffset;
+    c->Src = srcBuffer;
+}
+
+void GPUDeferredContext::CopyResource(GPUResource* dstResource, GPUResource* srcResource)
+{
+    auto c = Write<CommandCopyResource>(CommandType::CopyResource);
+    c->Dst = dstResource;
+    c->DstSubresource = 0;
+    c->Src = srcResource;
+    c->SrcSubresource = 0;
+}
+
+void GPUDeferredContext::CopySubresource(GPUResource* dstResource, uint32 dstSubresource, GPUResource* srcResource, uint32 srcSubresource)
+{
+    auto c = Write<CommandCopyResource>(CommandType::CopySubresource);
+    c->Dst = dstResource;
+    c->DstSubresource = dstSubresource;
+    c->Src = srcResource;
+    c->SrcSubresource = srcSubresource;
+}
+
+void GPUDeferredContext::SetResourceState(GPUResource* resource, uint64 state, int32 subresource)
+{
+    auto c = Write<CommandSetResourceState>(CommandType::SetResourceState);
+    c->Resource = resource;
+    c->State = state;
+    c->Subresource = subresource;
+}
+
+void GPUDeferredContext::ForceRebindDescriptors()
+{
+    Write(CommandType::ForceRebindDescriptors);
+}
@@ -657,6 +657,43 @@ uint64 GPUDevice::GetMemoryUsage() const
     return result;
 }
 
+GPUMemoryStats GPUDevice::GetMemoryStats() const
+{
+    GPUMemoryStats result;
+    uint64 total = 0;
+    _resourcesLock.Lock();
+    for (int32 i = 0; i < _resources.Count(); i++)
+    {
+        const GPUResource* resource = _resources[i];
+        const uint64 memory = resource->GetMemoryUsage();
+        switch (resource->GetResourceType())
+        {
+        case GPUResourceType::RenderTarget:
+            result.RenderTargets += memory;
+            break;
+        case GPUResourceType::Texture:
+        case GPUResourceType::CubeTexture:
+        case GPUResourceType::VolumeTexture:
+            result.Textures += memory;
+            break;
+        case GPUResourceType::Buffer:
+            result.Buffers += memory;
+            break;
+        default:
+            result.Other += memory;
+            break;
+        }
+        total += memory;
+    }
+    _resourcesLock.Unlock();
+    if (QueryMemoryBudget(result.Budget, result.Usage))
+    {
+        result.Budget = 0;
+        result.Usage = total;
+    }
+    return result;
+}
+
 Array<GPUResource*> GPUDevice::GetResources() const
 {
     _resourcesLock.Lock();
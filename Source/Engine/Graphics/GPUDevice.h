@@ -32,6 +32,26 @@ class Model;
 class Material;
 class MaterialBase;
 
+/// <summary>
+/// GPU memory usage statistics.
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API GPUMemoryStats
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(GPUMemoryStats);
+    // The video memory budget for the application provided by the OS or driver (in bytes). Zero if unknown.
+    API_FIELD() uint64 Budget = 0;
+    // The video memory usage of the application (in bytes). Reported by the OS or driver if supported (including driver internal allocations), otherwise a sum of the GPU resources memory.
+    API_FIELD() uint64 Usage = 0;
+    // The memory used by the render targets (in bytes).
+    API_FIELD() uint64 RenderTargets = 0;
+    // The memory used by the textures, cube textures and volume textures (in bytes). Includes streamed textures.
+    API_FIELD() uint64 Textures = 0;
+    // The memory used by the buffers (in bytes).
+    API_FIELD() uint64 Buffers = 0;
+    // The memory used by the other GPU resources (in bytes).
+    API_FIELD() uint64 Other = 0;
+};
+
 /// <summary>
 /// Graphics device object for rendering on GPU.
 /// </summary>
@@ -215,6 +235,49 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() virtual GPUContext* GetMainContext() = 0;
 
+    /// <summary>
+    /// Gets the GPU context for the async compute queue that executes in parallel to the main context. Supports only compute and copy commands. Returns null if not supported (see GPULimits::HasAsyncCompute).
+    /// </summary>
+    virtual GPUContext* GetAsyncComputeContext()
+    {
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Submits the commands recorded on the async compute context to the GPU. The main context commands recorded so far are submitted before so async work starts after them.
+    /// </summary>
+    /// <returns>The sync point value to use with WaitForAsyncCompute (0 if nothing was submitted).</returns>
+    virtual uint64 SubmitAsyncCompute()
+    {
+        return 0;
+    }
+
+    /// <summary>
+    /// Makes the main context wait on the GPU for the async compute work to complete (doesn't block CPU).
+    /// </summary>
+    /// <param name="syncPoint">The sync point value returned by SubmitAsyncCompute.</param>
+    /// <param name="submit">True if submit the commands recorded so far on the main context before the wait so they can overlap with the async work (resets the main context state so use it only between the rendering passes), otherwise all not yet submitted main context commands will wait.</param>
+    virtual void WaitForAsyncCompute(uint64 syncPoint, bool submit = true)
+    {
+    }
+
+    /// <summary>
+    /// Gets the GPU context for the copy queue that executes data transfers in parallel to the main context. Supports only copy and update commands. Returns null if not supported (see GPULimits::HasCopyQueue).
+    /// </summary>
+    virtual GPUContext* GetCopyContext()
+    {
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Submits the commands recorded on the copy context to the GPU. The main context commands submitted afterwards wait on the GPU for the copies to complete (doesn't block CPU).
+    /// </summary>
+    /// <returns>The sync point value of the copy queue (0 if nothing was submitted).</returns>
+    virtual uint64 SubmitCopy()
+    {
+        return 0;
+    }
+
     /// <summary>
     /// Gets the adapter device.
     /// </summary>
@@ -225,11 +288,27 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() virtual void* GetNativePtr() const = 0;
 
+    /// <summary>
+    /// Queries the video memory budget and usage of the application from the OS or driver.
+    /// </summary>
+    /// <param name="budget">The video memory budget (in bytes).</param>
+    /// <param name="usage">The video memory usage (in bytes).</param>
+    /// <returns>True if failed or not supported, otherwise false.</returns>
+    virtual bool QueryMemoryBudget(uint64& budget, uint64& usage) const
+    {
+        return true;
+    }
+
     /// <summary>
     /// Gets the amount of memory usage by all the GPU resources (in bytes).
     /// </summary>
     API_PROPERTY() uint64 GetMemoryUsage() const;
 
+    /// <summary>
+    /// Gets the GPU memory usage statistics per resources category and the video memory budget. Can be used to detect memory pressure (eg. by content streaming).
+    /// </summary>
+    API_PROPERTY() GPUMemoryStats GetMemoryStats() const;
+
     /// <summary>
     /// Gets the list with all active GPU resources.
     /// </summary>
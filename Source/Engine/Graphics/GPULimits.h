@@ -279,6 +279,41 @@ API_STRUCT() struct GPULimits
     /// </summary>
     API_FIELD() bool HasTypedUAVLoad;
 
+    /// <summary>
+    /// True if device supports async compute queue that executes compute work in parallel to the graphics work (see GPUDevice::GetAsyncComputeContext).
+    /// </summary>
+    API_FIELD() bool HasAsyncCompute;
+
+    /// <summary>
+    /// True if device supports copy queue that executes data transfers in parallel to the graphics work (see GPUDevice::GetCopyContext).
+    /// </summary>
+    API_FIELD() bool HasCopyQueue;
+
+    /// <summary>
+    /// True if device supports bindless resources access in shaders (via global descriptors table indexed with GPUResourceView::GetBindlessIndex).
+    /// </summary>
+    API_FIELD() bool HasBindlessResources;
+
+    /// <summary>
+    /// True if device supports variable rate shading with a per-draw shading rate (see GPUContext::SetShadingRate).
+    /// </summary>
+    API_FIELD() bool HasVariableRateShading;
+
+    /// <summary>
+    /// True if device supports variable rate shading with a screen-space shading rate image (see GPUContext::SetShadingRate).
+    /// </summary>
+    API_FIELD() bool HasVariableRateShadingImage;
+
+    /// <summary>
+    /// True if device supports the coarse shading rates (2x4, 4x2 and 4x4 pixels). Otherwise rates up to 2x2 are supported.
+    /// </summary>
+    API_FIELD() bool HasVariableRateShadingCoarseRates;
+
+    /// <summary>
+    /// The size (in pixels) of the screen-space tile that is covered by a single texel of the shading rate image. Zero if shading rate image is not supported.
+    /// </summary>
+    API_FIELD() int32 ShadingRateImageTileSize;
+
     /// <summary>
     /// The maximum amount of texture mip levels.
     /// </summary>
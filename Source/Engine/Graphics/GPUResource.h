@@ -205,4 +205,12 @@ API_CLASS(Abstract, NoSpawn, Attributes="HideInEditor") class FLAXENGINE_API GPU
     /// Gets the native pointer to the underlying view. It's a platform-specific handle.
     /// </summary>
     virtual void* GetNativePtr() const = 0;
+
+    /// <summary>
+    /// Gets the index of the view in the bindless resources table (see GPULimits::HasBindlessResources). Allocates the table entry on the first use. Returns -1 if not supported.
+    /// </summary>
+    virtual int32 GetBindlessIndex() const
+    {
+        return -1;
+    }
 };
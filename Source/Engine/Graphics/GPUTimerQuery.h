@@ -3,6 +3,7 @@
 #pragma once
 
 #include "GPUResource.h"
+#include "Engine/Profiler/RenderStats.h"
 
 /// <summary>
 /// Represents a GPU query that measures execution time of GPU operations.
@@ -42,6 +43,23 @@ class FLAXENGINE_API GPUTimerQuery : public GPUResource
     /// <returns>The time in milliseconds.</returns>
     virtual float GetResult() = 0;
 
+#if COMPILE_WITH_PROFILER
+    /// <summary>
+    /// Enables collecting the GPU pipeline statistics (shader invocations, primitives) between Begin/End calls. Has to be set before Begin. Supported only by some graphics backends.
+    /// </summary>
+    bool CollectPipelineStats = false;
+
+    /// <summary>
+    /// Gets the query result pipeline statistics. Valid only if query has result (see HasResult).
+    /// </summary>
+    /// <param name="result">The result statistics.</param>
+    /// <returns>True if got valid statistics, otherwise false (eg. collecting was disabled or it's not supported).</returns>
+    virtual bool GetPipelineStats(GPUPipelineStats& result)
+    {
+        return false;
+    }
+#endif
+
 public:
     // [GPUResource]
     String ToString() const override
@@ -3,12 +3,14 @@
 #include "Graphics.h"
 #include "GPUDevice.h"
 #include "PixelFormatExtensions.h"
+#include "RenderTask.h"
 #include "Async/GPUTasksManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Config/GraphicsSettings.h"
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerGPU.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include "Engine/Render2D/Font.h"
 
 bool Graphics::UseVSync = false;
@@ -23,6 +25,18 @@ bool Graphics::AllowCSMBlending = false;
 Quality Graphics::GlobalSDFQuality = Quality::High;
 Quality Graphics::GIQuality = Quality::High;
 bool Graphics::GICascadesBlending = false;
+bool Graphics::GPUInstanceCulling = false;
+bool Graphics::GPUFoliageCulling = false;
+bool Graphics::PersistentObjectsBuffer = false;
+bool Graphics::ParallelCommandRecording = false;
+bool Graphics::ClusteredLighting = false;
+bool Graphics::AsyncCompute = false;
+int32 Graphics::UploadRingSize = 32;
+bool Graphics::CopyQueueUploads = false;
+VariableRateShadingPasses Graphics::VariableRateShading = VariableRateShadingPasses::None;
+bool Graphics::TextureStreamingFeedback = false;
+bool Graphics::ComputeSkinning = false;
+int32 Graphics::TerrainVirtualTextureTiles = 0;
 PostProcessSettings Graphics::PostProcessSettings;
 bool Graphics::SpreadWorkload = true;
 
@@ -72,6 +86,18 @@ void GraphicsSettings::Apply()
     Graphics::GlobalSDFQuality = GlobalSDFQuality;
     Graphics::GIQuality = GIQuality;
     Graphics::GICascadesBlending = GICascadesBlending;
+    Graphics::GPUInstanceCulling = GPUInstanceCulling;
+    Graphics::GPUFoliageCulling = GPUFoliageCulling;
+    Graphics::PersistentObjectsBuffer = PersistentObjectsBuffer;
+    Graphics::ParallelCommandRecording = ParallelCommandRecording;
+    Graphics::ClusteredLighting = ClusteredLighting;
+    Graphics::AsyncCompute = AsyncCompute;
+    Graphics::UploadRingSize = UploadRingSize;
+    Graphics::CopyQueueUploads = CopyQueueUploads;
+    Graphics::VariableRateShading = VariableRateShading;
+    Graphics::TextureStreamingFeedback = TextureStreamingFeedback;
+    Graphics::ComputeSkinning = ComputeSkinning;
+    Graphics::TerrainVirtualTextureTiles = TerrainVirtualTextureTiles;
     Graphics::PostProcessSettings = ::PostProcessSettings();
     Graphics::PostProcessSettings.BlendWith(PostProcessSettings, 1.0f);
 #if !USE_EDITOR // OptionsModule handles fallback fonts in Editor
@@ -96,6 +122,7 @@ void Graphics::DisposeDevice()
 bool GraphicsService::Init()
 {
     ASSERT(GPUDevice::Instance == nullptr);
+    PROFILE_LOCK(RenderTask::TasksLocker, "RenderTask::TasksLocker");
 
     // Create and initialize graphics device
     Log::Logger::WriteFloor();
@@ -74,6 +74,66 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static bool GICascadesBlending;
 
+    /// <summary>
+    /// Enables GPU-driven culling of the large instanced draws (eg. foliage). Instances are culled by the compute shader against every rendered view and submitted via indirect draws which reduces the CPU cost of the instanced draws.
+    /// </summary>
+    API_FIELD() static bool GPUInstanceCulling;
+
+    /// <summary>
+    /// Enables GPU-driven foliage culling. CPU culls only the foliage clusters (including occlusion) and selects the LOD per cluster, while the instances are culled (frustum and cull distance) by the compute shader. Requires GPUInstanceCulling to be enabled.
+    /// </summary>
+    API_FIELD() static bool GPUFoliageCulling;
+
+    /// <summary>
+    /// Enables persistent objects buffer for the scene rendering. Objects data stays on GPU between frames and only the changed objects are uploaded which reduces the upload bandwidth for mostly static scenes (at additional CPU cost of matching objects with the previous frames).
+    /// </summary>
+    API_FIELD() static bool PersistentObjectsBuffer;
+
+    /// <summary>
+    /// Enables recording of the large draw calls lists on multiple job system threads. Commands are recorded into deferred contexts and executed on the main GPU context in the original order.
+    /// </summary>
+    API_FIELD() static bool ParallelCommandRecording;
+
+    /// <summary>
+    /// Enables clustered lighting. Local lights are culled per view froxel in a compute shader, then all unshadowed local lights are rendered in a single deferred pass and forward shading materials get all the local lights.
+    /// </summary>
+    API_FIELD() static bool ClusteredLighting;
+
+    /// <summary>
+    /// Enables using async compute queue (if supported by the device) for the compute-only rendering passes such as Global SDF update, so they can run in parallel to the shadows and GBuffer rendering.
+    /// </summary>
+    API_FIELD() static bool AsyncCompute;
+
+    /// <summary>
+    /// The size (in megabytes) of the persistent staging memory ring used by the texture and buffer data uploads (eg. streaming). Memory is reused once GPU is done with the copy commands which avoids staging allocations spikes during streaming bursts. Uploads that don't fit use temporary staging memory. Use 0 to disable it.
+    /// </summary>
+    API_FIELD() static int32 UploadRingSize;
+
+    /// <summary>
+    /// Enables executing the GPU tasks data transfers (eg. textures and meshes streaming uploads) on the copy queue (if supported by the device) so they don't compete with the frame rendering on the graphics queue.
+    /// </summary>
+    API_FIELD() static bool CopyQueueUploads;
+
+    /// <summary>
+    /// The rendering passes that use the variable rate shading to reduce pixel shading cost in the areas with low contrast or fast motion (if supported by the device, see GPULimits::HasVariableRateShadingImage).
+    /// </summary>
+    API_FIELD() static VariableRateShadingPasses VariableRateShading;
+
+    /// <summary>
+    /// Enables the GPU feedback for the textures streaming. The main view meshes are rendered periodically into a low-resolution buffer that records the resolution actually sampled by the visible pixels, which is read back a few frames later to pick the mips to stream (instead of the CPU estimation from the meshes screen size).
+    /// </summary>
+    API_FIELD() static bool TextureStreamingFeedback;
+
+    /// <summary>
+    /// Enables the compute shader skinning. Animated meshes are skinned once per frame (before rendering) into the per-instance vertex buffers that are drawn as static geometry by all the passes (eg. each shadow map view) instead of skinning vertices in the vertex shader of every pass.
+    /// </summary>
+    API_FIELD() static bool ComputeSkinning;
+
+    /// <summary>
+    /// The amount of tiles in the terrain virtual texture cache. Distant terrain chunks (see Terrain::VirtualTextureLOD) have their material baked on demand into the cache tiles (albedo, normal and material properties) and are drawn into GBuffer with a single lookup instead of evaluating all of their material layers. Least recently used tiles are reused for the newly requested chunks. Use 0 to disable it.
+    /// </summary>
+    API_FIELD() static int32 TerrainVirtualTextureTiles;
+
     /// <summary>
     /// The default Post Process settings. Can be overriden by PostFxVolume on a level locally, per camera or for a whole map.
     /// </summary>
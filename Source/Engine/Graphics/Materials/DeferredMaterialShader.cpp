@@ -136,24 +136,24 @@ bool DeferredMaterialShader::Load()
     psDesc.VS = _shader->GetVS("VS");
     failed |= psDesc.VS == nullptr;
     psDesc.PS = _shader->GetPS("PS_GBuffer");
-    _cache.Default.Init(psDesc);
+    _cache.Default.Init(psDesc, this);
     psDesc.VS = _shader->GetVS("VS", 1);
     failed |= psDesc.VS == nullptr;
-    _cacheInstanced.Default.Init(psDesc);
+    _cacheInstanced.Default.Init(psDesc, this);
 
     // GBuffer Pass with lightmap (pixel shader permutation for USE_LIGHTMAP=1)
     psDesc.VS = _shader->GetVS("VS");
     failed |= psDesc.VS == nullptr;
     psDesc.PS = _shader->GetPS("PS_GBuffer", 1);
-    _cache.DefaultLightmap.Init(psDesc);
+    _cache.DefaultLightmap.Init(psDesc, this);
     psDesc.VS = _shader->GetVS("VS", 1);
     failed |= psDesc.VS == nullptr;
-    _cacheInstanced.DefaultLightmap.Init(psDesc);
+    _cacheInstanced.DefaultLightmap.Init(psDesc, this);
 
     // GBuffer Pass with skinning
     psDesc.VS = _shader->GetVS("VS_Skinned");
     psDesc.PS = _shader->GetPS("PS_GBuffer");
-    _cache.DefaultSkinned.Init(psDesc);
+    _cache.DefaultSkinned.Init(psDesc, this);
 
 #if USE_EDITOR
     if (_shader->HasShader("PS_QuadOverdraw"))
@@ -161,11 +161,11 @@ bool DeferredMaterialShader::Load()
         // Quad Overdraw
         psDesc.VS = _shader->GetVS("VS");
         psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
-        _cache.QuadOverdraw.Init(psDesc);
+        _cache.QuadOverdraw.Init(psDesc, this);
         psDesc.VS = _shader->GetVS("VS", 1);
-        _cacheInstanced.Depth.Init(psDesc);
+        _cacheInstanced.Depth.Init(psDesc, this);
         psDesc.VS = _shader->GetVS("VS_Skinned");
-        _cache.QuadOverdrawSkinned.Init(psDesc);
+        _cache.QuadOverdrawSkinned.Init(psDesc, this);
     }
 #endif
 
@@ -175,15 +175,15 @@ bool DeferredMaterialShader::Load()
     psDesc.DepthFunc = ComparisonFunc::LessEqual;
     psDesc.VS = _shader->GetVS("VS");
     psDesc.PS = _shader->GetPS("PS_MotionVectors");
-    _cache.MotionVectors.Init(psDesc);
+    _cache.MotionVectors.Init(psDesc, this);
 
     // Motion Vectors pass with skinning
     psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.MotionVectorsSkinned.Init(psDesc);
+    _cache.MotionVectorsSkinned.Init(psDesc, this);
 
     // Motion Vectors pass with skinning (with per-bone motion blur)
     psDesc.VS = _shader->GetVS("VS_Skinned", 1);
-    _cache.MotionVectorsSkinnedPerBone.Init(psDesc);
+    _cache.MotionVectorsSkinnedPerBone.Init(psDesc, this);
 
     // Depth Pass
     psDesc.CullMode = CullMode::TwoSided;
@@ -208,13 +208,13 @@ bool DeferredMaterialShader::Load()
         instancedDepthPassVS = _shader->GetVS("VS_Depth", 1);
         psDesc.PS = nullptr;
     }
-    _cache.Depth.Init(psDesc);
+    _cache.Depth.Init(psDesc, this);
     psDesc.VS = instancedDepthPassVS;
-    _cacheInstanced.Depth.Init(psDesc);
+    _cacheInstanced.Depth.Init(psDesc, this);
 
     // Depth Pass with skinning
     psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.DepthSkinned.Init(psDesc);
+    _cache.DepthSkinned.Init(psDesc, this);
 
     return failed;
 }
@@ -131,7 +131,7 @@ bool DeformableMaterialShader::Load()
         // Quad Overdraw
         psDesc.VS = _shader->GetVS("VS_SplineModel");
         psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
-        _cache.QuadOverdraw.Init(psDesc);
+        _cache.QuadOverdraw.Init(psDesc, this);
     }
 #endif
 
@@ -142,7 +142,7 @@ bool DeformableMaterialShader::Load()
         // GBuffer Pass
         psDesc.VS = _shader->GetVS("VS_SplineModel");
         psDesc.PS = _shader->GetPS("PS_GBuffer");
-        _cache.Default.Init(psDesc);
+        _cache.Default.Init(psDesc, this);
     }
     else
     {
@@ -165,7 +165,7 @@ bool DeformableMaterialShader::Load()
             psDesc.BlendMode = BlendingMode::Multiply;
             break;
         }
-        _cache.Default.Init(psDesc);
+        _cache.Default.Init(psDesc, this);
     }
 
     // Depth Pass
@@ -176,7 +176,7 @@ bool DeformableMaterialShader::Load()
     psDesc.DepthFunc = ComparisonFunc::Less;
     psDesc.HS = nullptr;
     psDesc.DS = nullptr;
-    _cache.Depth.Init(psDesc);
+    _cache.Depth.Init(psDesc, this);
 
     return false;
 }
@@ -131,11 +131,11 @@ bool ForwardMaterialShader::Load()
         // Quad Overdraw
         psDesc.VS = _shader->GetVS("VS");
         psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
-        _cache.QuadOverdraw.Init(psDesc);
+        _cache.QuadOverdraw.Init(psDesc, this);
         psDesc.VS = _shader->GetVS("VS", 1);
-        _cacheInstanced.Depth.Init(psDesc);
+        _cacheInstanced.Depth.Init(psDesc, this);
         psDesc.VS = _shader->GetVS("VS_Skinned");
-        _cache.QuadOverdrawSkinned.Init(psDesc);
+        _cache.QuadOverdrawSkinned.Init(psDesc, this);
     }
 #endif
 
@@ -149,11 +149,11 @@ bool ForwardMaterialShader::Load()
         psDesc.PS = _shader->GetPS("PS_Distortion");
         psDesc.BlendMode = BlendingMode::Add;
         psDesc.DepthWriteEnable = false;
-        _cache.Distortion.Init(psDesc);
+        _cache.Distortion.Init(psDesc, this);
         //psDesc.VS = _shader->GetVS("VS", 1);
-        //_cacheInstanced.Distortion.Init(psDesc);
+        //_cacheInstanced.Distortion.Init(psDesc, this);
         psDesc.VS = _shader->GetVS("VS_Skinned");
-        _cache.DistortionSkinned.Init(psDesc);
+        _cache.DistortionSkinned.Init(psDesc, this);
     }
 
     // Forward Pass
@@ -175,11 +175,11 @@ bool ForwardMaterialShader::Load()
         psDesc.BlendMode = BlendingMode::Multiply;
         break;
     }
-    _cache.Default.Init(psDesc);
+    _cache.Default.Init(psDesc, this);
     //psDesc.VS = _shader->GetVS("VS", 1);
-    //_cacheInstanced.Default.Init(psDesc);
+    //_cacheInstanced.Default.Init(psDesc, this);
     psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.DefaultSkinned.Init(psDesc);
+    _cache.DefaultSkinned.Init(psDesc, this);
 
     // Depth Pass
     psDesc = GPUPipelineState::Description::Default;
@@ -192,11 +192,11 @@ bool ForwardMaterialShader::Load()
     psDesc.DS = nullptr;
     psDesc.VS = _shader->GetVS("VS");
     psDesc.PS = _shader->GetPS("PS_Depth");
-    _cache.Depth.Init(psDesc);
+    _cache.Depth.Init(psDesc, this);
     psDesc.VS = _shader->GetVS("VS", 1);
-    _cacheInstanced.Depth.Init(psDesc);
+    _cacheInstanced.Depth.Init(psDesc, this);
     psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.DepthSkinned.Init(psDesc);
+    _cache.DepthSkinned.Init(psDesc, this);
 
     return false;
 }
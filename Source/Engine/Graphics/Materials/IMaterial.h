@@ -15,6 +15,7 @@ class SceneRenderTask;
 struct RenderView;
 struct RenderContext;
 struct DrawCall;
+class MaterialBase;
 
 /// <summary>
 /// Interface for material objects.
@@ -114,6 +115,15 @@ class FLAXENGINE_API IMaterial
         return false;
     }
 
+    /// <summary>
+    /// Gets the material asset that implements this material (null for the engine internal materials such as debug shaders).
+    /// </summary>
+    /// <returns>The material asset or null.</returns>
+    virtual const MaterialBase* GetMaterialAsset() const
+    {
+        return nullptr;
+    }
+
     /// <summary>
     /// The instancing handling used to hash, batch and write draw calls.
     /// </summary>
@@ -472,6 +472,42 @@ void MaterialParameter::Bind(BindMeta& meta) const
     }
 }
 
+void MaterialParameter::ReportTextureResolution(int32 resolution) const
+{
+    switch (_type)
+    {
+    case MaterialParameterType::NormalMap:
+    case MaterialParameterType::Texture:
+    case MaterialParameterType::CubeTexture:
+    {
+        const auto texture = (TextureBase*)_asAsset.Get();
+        if (texture && texture->IsLoaded())
+            texture->StreamingTexture()->ReportRequiredResolution(resolution);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void MaterialParameter::PrefetchTexture(double endTime) const
+{
+    switch (_type)
+    {
+    case MaterialParameterType::NormalMap:
+    case MaterialParameterType::Texture:
+    case MaterialParameterType::CubeTexture:
+    {
+        const auto texture = (TextureBase*)_asAsset.Get();
+        if (texture && texture->IsLoaded())
+            texture->StreamingTexture()->Prefetch(endTime);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
 bool MaterialParameter::HasContentLoaded() const
 {
     return _asAsset == nullptr || _asAsset->IsLoaded();
@@ -336,6 +336,18 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
     /// <param name="meta">The bind meta.</param>
     void Bind(BindMeta& meta) const;
 
+    /// <summary>
+    /// Reports the texture resolution required by the rendered geometry to the streamed texture used by the parameter (if any).
+    /// </summary>
+    /// <param name="resolution">The required texture resolution (in texels).</param>
+    void ReportTextureResolution(int32 resolution) const;
+
+    /// <summary>
+    /// Prefetches the streamed texture used by the parameter (if any).
+    /// </summary>
+    /// <param name="endTime">The time (see Platform::GetTimeSeconds) until which the texture stays prefetched.</param>
+    void PrefetchTexture(double endTime) const;
+
     bool HasContentLoaded() const;
 
 private:
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "MaterialShader.h"
+#include "MaterialsUsage.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Renderer/RenderList.h"
@@ -112,6 +113,8 @@ GPUPipelineState* MaterialShader::PipelineStateCache::InitPS(CullMode mode, bool
     Desc.Wireframe = wireframe;
     auto ps = GPUDevice::Instance->CreatePipelineState();
     ps->Init(Desc);
+    if (Owner && Owner->_id.IsValid() && MaterialsUsage::IsRecording())
+        MaterialsUsage::Record(Owner->_id, Owner->_psCaches.Count(), Index * 6 + static_cast<int32>(mode) + (wireframe ? 3 : 0));
     return ps;
 }
 
@@ -129,7 +132,7 @@ MaterialShader::~MaterialShader()
     SAFE_DELETE_GPU_RESOURCE(_shader);
 }
 
-MaterialShader* MaterialShader::Create(const StringView& name, MemoryReadStream& shaderCacheStream, const MaterialInfo& info)
+MaterialShader* MaterialShader::Create(const StringView& name, MemoryReadStream& shaderCacheStream, const MaterialInfo& info, const Guid& id)
 {
     MaterialShader* material;
     switch (info.Domain)
@@ -162,6 +165,7 @@ MaterialShader* MaterialShader::Create(const StringView& name, MemoryReadStream&
         LOG(Error, "Unknown material type.");
         return nullptr;
     }
+    material->_id = id;
     if (material->Load(shaderCacheStream, info))
     {
         Delete(material);
@@ -253,6 +257,20 @@ bool MaterialShader::Load(MemoryReadStream& shaderCacheStream, const MaterialInf
         return true;
     }
 
+    // Create pipeline states used by this material in the recorded sessions (instead of on the first draw)
+    if (_id.IsValid() && !MaterialsUsage::IsRecording())
+    {
+        Array<int32> permutations;
+        MaterialsUsage::GetUsed(_id, _psCaches.Count(), permutations);
+        for (const int32 permutation : permutations)
+        {
+            const int32 cacheIndex = permutation / 6;
+            const int32 psIndex = permutation % 6;
+            if (cacheIndex < _psCaches.Count())
+                _psCaches[cacheIndex]->GetPS(static_cast<CullMode>(psIndex % 3), psIndex >= 3);
+        }
+    }
+
     _isLoaded = true;
     return false;
 }
@@ -262,5 +280,6 @@ void MaterialShader::Unload()
     _isLoaded = false;
     _cb = nullptr;
     _cbData.Resize(0, false);
+    _psCaches.Clear();
     _shader->ReleaseGPU();
 }
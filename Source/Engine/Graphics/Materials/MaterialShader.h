@@ -10,7 +10,7 @@
 /// <summary>
 /// Current materials shader version.
 /// </summary>
-#define MATERIAL_GRAPH_VERSION 169
+#define MATERIAL_GRAPH_VERSION 171
 
 class Material;
 class GPUShader;
@@ -33,15 +33,20 @@ class MaterialShader : public IMaterial
     {
         GPUPipelineState* PS[6];
         GPUPipelineState::Description Desc;
+        MaterialShader* Owner = nullptr;
+        int32 Index = -1;
 
         PipelineStateCache()
         {
             Platform::MemoryClear(PS, sizeof(PS));
         }
 
-        void Init(GPUPipelineState::Description& desc)
+        void Init(GPUPipelineState::Description& desc, MaterialShader* owner)
         {
             Desc = desc;
+            Owner = owner;
+            Index = owner->_psCaches.Count();
+            owner->_psCaches.Add(this);
         }
 
         GPUPipelineState* GetPS(CullMode mode, bool wireframe)
@@ -67,6 +72,8 @@ class MaterialShader : public IMaterial
     GPUConstantBuffer* _cb;
     Array<byte> _cbData;
     MaterialInfo _info;
+    Guid _id;
+    Array<PipelineStateCache*> _psCaches;
 
 protected:
     /// <summary>
@@ -88,8 +95,9 @@ class MaterialShader : public IMaterial
     /// <param name="name">Material resource name</param>
     /// <param name="shaderCacheStream">Stream with compiled shader data</param>
     /// <param name="info">Loaded material info structure</param>
+    /// <param name="id">Material asset ID (used to track the pipeline states usage)</param>
     /// <returns>The created and loaded material or null if failed.</returns>
-    static MaterialShader* Create(const StringView& name, MemoryReadStream& shaderCacheStream, const MaterialInfo& info);
+    static MaterialShader* Create(const StringView& name, MemoryReadStream& shaderCacheStream, const MaterialInfo& info, const Guid& id = Guid::Empty);
 
     /// <summary>
     /// Creates the dummy material used by the Null rendering backend to mock object but not perform any rendering.
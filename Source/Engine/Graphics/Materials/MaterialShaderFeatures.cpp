@@ -6,6 +6,7 @@
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Renderer/ShadowsPass.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Renderer/Utils/LightClusters.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Lightmaps.h"
 #endif
@@ -24,6 +25,8 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
     const int32 skyLightShaderRegisterIndex = srv + 1;
     const int32 shadowsBufferRegisterIndex = srv + 2;
     const int32 shadowMapShaderRegisterIndex = srv + 3;
+    const int32 clusterLightsRegisterIndex = srv + 4;
+    const int32 clusterGridRegisterIndex = srv + 5;
     const bool canUseShadow = view.Pass != DrawPass::Depth;
 
     // Set fog input
@@ -93,8 +96,21 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
 
     // Set local lights
     data.LocalLightsCount = 0;
+    if (cache->LightClusters)
+    {
+        // Use all local lights from clusters
+        data.LightClustersParams = cache->LightClusters->Params;
+        params.GPUContext->BindSR(clusterLightsRegisterIndex, cache->LightClusters->Lights);
+        params.GPUContext->BindSR(clusterGridRegisterIndex, cache->LightClusters->Grid);
+    }
+    else
+    {
+        data.LightClustersParams = Float4::Zero;
+        params.GPUContext->UnBindSR(clusterLightsRegisterIndex);
+        params.GPUContext->UnBindSR(clusterGridRegisterIndex);
+    }
     // TODO: optimize lights searching for a transparent material - use spatial cache for renderer to find it
-    for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights && !cache->LightClusters; i++)
     {
         const auto& light = cache->PointLights[i];
         if (objectBounds.Intersects(BoundingSphere(light.Position, light.Radius)))
@@ -103,7 +119,7 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
             data.LocalLightsCount++;
         }
     }
-    for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights && !cache->LightClusters; i++)
     {
         const auto& light = cache->SpotLights[i];
         if (objectBounds.Intersects(BoundingSphere(light.Position, light.Radius)))
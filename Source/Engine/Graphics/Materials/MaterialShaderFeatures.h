@@ -25,7 +25,7 @@ struct ForwardShadingFeature : MaterialShaderFeature
 {
     enum { MaxLocalLights = 4 };
 
-    enum { SRVs = 4 };
+    enum { SRVs = 6 };
 
     PACK_STRUCT(struct Data
         {
@@ -36,6 +36,7 @@ struct ForwardShadingFeature : MaterialShaderFeature
         Float3 Dummy2;
         uint32 LocalLightsCount;
         ShaderLightData LocalLights[MaxLocalLights];
+        Float4 LightClustersParams;
         });
 
     static void Bind(MaterialShader::BindParameters& params, Span<byte>& cb, int32& srv);
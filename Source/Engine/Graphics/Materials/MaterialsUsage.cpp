@@ -0,0 +1,178 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "MaterialsUsage.h"
+#include "MaterialShader.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "FlaxEngine.Gen.h"
+
+// Increment to invalidate the recorded files (eg. when changing the file format)
+#define MATERIALS_USAGE_VERSION 1
+
+namespace
+{
+    struct MaterialUsage
+    {
+        int32 CachesCount = 0;
+        Array<uint16> Permutations;
+    };
+
+    CriticalSection Locker;
+    Dictionary<Guid, MaterialUsage> Materials;
+    bool IsRecordingEnabled = false;
+    bool IsModified = false;
+
+    String GetRecordingPath()
+    {
+#if USE_EDITOR
+        return Globals::ProjectCacheFolder / TEXT("MaterialsUsage.bin");
+#else
+        return Globals::ProductLocalFolder / TEXT("MaterialsUsage.bin");
+#endif
+    }
+
+    bool Load(const String& path)
+    {
+        Array<byte> data;
+        if (File::ReadAllBytes(path, data))
+            return true;
+        MemoryReadStream stream(data.Get(), data.Count());
+        int32 version, engineBuild, materialGraph, count;
+#define CHECK_SIZE(size) if (stream.GetLength() - stream.GetPosition() < (uint32)(size)) return true
+        CHECK_SIZE(sizeof(int32) * 4);
+        stream.ReadInt32(&version);
+        stream.ReadInt32(&engineBuild);
+        stream.ReadInt32(&materialGraph);
+        stream.ReadInt32(&count);
+        if (version != MATERIALS_USAGE_VERSION || engineBuild != FLAXENGINE_VERSION_BUILD || materialGraph != MATERIAL_GRAPH_VERSION)
+            return true;
+        for (int32 i = 0; i < count; i++)
+        {
+            Guid id;
+            int32 cachesCount, permutationsCount;
+            CHECK_SIZE(sizeof(Guid) + sizeof(int32) * 2);
+            stream.Read(id);
+            stream.ReadInt32(&cachesCount);
+            stream.ReadInt32(&permutationsCount);
+            CHECK_SIZE(permutationsCount * sizeof(uint16));
+            auto& e = Materials[id];
+            e.CachesCount = cachesCount;
+            e.Permutations.Resize(permutationsCount, false);
+            stream.ReadBytes(e.Permutations.Get(), permutationsCount * sizeof(uint16));
+        }
+#undef CHECK_SIZE
+        return false;
+    }
+
+    void Save(const String& path)
+    {
+        MemoryWriteStream stream(1024);
+        stream.WriteInt32(MATERIALS_USAGE_VERSION);
+        stream.WriteInt32(FLAXENGINE_VERSION_BUILD);
+        stream.WriteInt32(MATERIAL_GRAPH_VERSION);
+        stream.WriteInt32(Materials.Count());
+        for (const auto& e : Materials)
+        {
+            stream.Write(e.Key);
+            stream.WriteInt32(e.Value.CachesCount);
+            stream.WriteInt32(e.Value.Permutations.Count());
+            stream.WriteBytes(e.Value.Permutations.Get(), e.Value.Permutations.Count() * sizeof(uint16));
+        }
+        if (File::WriteAllBytes(path, stream.GetHandle(), (int32)stream.GetPosition()))
+        {
+            LOG(Warning, "Failed to save materials usage file {0}", path);
+        }
+    }
+}
+
+class MaterialsUsageService : public EngineService
+{
+public:
+    MaterialsUsageService()
+        : EngineService(TEXT("Materials Usage"), -30)
+    {
+    }
+
+    bool Init() override;
+    void Dispose() override;
+};
+
+MaterialsUsageService MaterialsUsageServiceInstance;
+
+bool MaterialsUsageService::Init()
+{
+#if USE_EDITOR || !BUILD_RELEASE
+    IsRecordingEnabled = CommandLine::Options.RecordMaterials.IsTrue();
+#endif
+
+    // Recording accumulates data from the previous sessions, otherwise use the file shipped with the game
+#if USE_EDITOR
+    const String path = GetRecordingPath();
+#else
+    const String path = IsRecordingEnabled ? GetRecordingPath() : Globals::ProjectContentFolder / TEXT("MaterialsUsage.bin");
+#endif
+    if (FileSystem::FileExists(path) && Load(path))
+    {
+        LOG(Warning, "Invalid materials usage file {0}", path);
+        Materials.Clear();
+    }
+    if (IsRecordingEnabled)
+    {
+        LOG(Info, "Recording materials usage to {0}", GetRecordingPath());
+    }
+    return false;
+}
+
+void MaterialsUsageService::Dispose()
+{
+    ScopeLock lock(Locker);
+    if (IsRecordingEnabled && IsModified)
+    {
+        Save(GetRecordingPath());
+        IsModified = false;
+    }
+    Materials.Clear();
+}
+
+bool MaterialsUsage::IsRecording()
+{
+    return IsRecordingEnabled;
+}
+
+void MaterialsUsage::Record(const Guid& id, int32 cachesCount, int32 permutation)
+{
+    ScopeLock lock(Locker);
+    auto& e = Materials[id];
+    if (e.CachesCount != cachesCount)
+    {
+        // Material layout has changed so remove outdated data
+        e.CachesCount = cachesCount;
+        e.Permutations.Clear();
+    }
+    if (!e.Permutations.Contains((uint16)permutation))
+    {
+        e.Permutations.Add((uint16)permutation);
+        IsModified = true;
+    }
+}
+
+void MaterialsUsage::GetUsed(const Guid& id, int32 cachesCount, Array<int32>& result)
+{
+    result.Clear();
+    ScopeLock lock(Locker);
+    const MaterialUsage* e = Materials.TryGet(id);
+    if (e && e->CachesCount == cachesCount)
+    {
+        for (const uint16 permutation : e->Permutations)
+            result.Add(permutation);
+    }
+}
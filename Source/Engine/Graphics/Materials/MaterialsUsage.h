@@ -0,0 +1,37 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+
+struct Guid;
+
+/// <summary>
+/// Records which material pipeline state permutations (per draw pass, skinning, lightmap, instancing, cull mode and wireframe) are actually used by the game. Recording is enabled with -recordmaterials command line switch (eg. during playtests) and the results are merged into the file saved on exit.
+/// Recorded usage is used to create the pipeline states of the material right after it gets loaded (instead of on the first draw) to reduce hitches. Game Cooker can ship the recorded file with the game (see BuildSettings.MaterialsUsageFile).
+/// </summary>
+class FLAXENGINE_API MaterialsUsage
+{
+public:
+    /// <summary>
+    /// Checks if the usage recording is enabled.
+    /// </summary>
+    static bool IsRecording();
+
+    /// <summary>
+    /// Records the material pipeline state permutation usage.
+    /// </summary>
+    /// <param name="id">The material asset ID.</param>
+    /// <param name="cachesCount">The amount of pipeline state caches in the material (used to validate data).</param>
+    /// <param name="permutation">The pipeline state permutation index.</param>
+    static void Record(const Guid& id, int32 cachesCount, int32 permutation);
+
+    /// <summary>
+    /// Gets the pipeline state permutations used by the material.
+    /// </summary>
+    /// <param name="id">The material asset ID.</param>
+    /// <param name="cachesCount">The amount of pipeline state caches in the material (used to validate data).</param>
+    /// <param name="result">The output permutation indices.</param>
+    static void GetUsed(const Guid& id, int32 cachesCount, Array<int32>& result);
+};
@@ -202,11 +202,11 @@ bool ParticleMaterialShader::Load()
         // Quad Overdraw
         psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
         psDesc.VS = vsSprite;
-        _cacheSprite.QuadOverdraw.Init(psDesc);
+        _cacheSprite.QuadOverdraw.Init(psDesc, this);
         psDesc.VS = vsMesh;
-        _cacheModel.QuadOverdraw.Init(psDesc);
+        _cacheModel.QuadOverdraw.Init(psDesc, this);
         psDesc.VS = vsRibbon;
-        _cacheRibbon.QuadOverdraw.Init(psDesc);
+        _cacheRibbon.QuadOverdraw.Init(psDesc, this);
     }
 #endif
 
@@ -220,11 +220,11 @@ bool ParticleMaterialShader::Load()
         psDesc.BlendMode = BlendingMode::Add;
         psDesc.DepthWriteEnable = false;
         psDesc.VS = vsSprite;
-        _cacheSprite.Distortion.Init(psDesc);
+        _cacheSprite.Distortion.Init(psDesc, this);
         psDesc.VS = vsMesh;
-        _cacheModel.Distortion.Init(psDesc);
+        _cacheModel.Distortion.Init(psDesc, this);
         psDesc.VS = vsRibbon;
-        _cacheRibbon.Distortion.Init(psDesc);
+        _cacheRibbon.Distortion.Init(psDesc, this);
     }
 
     // Forward Pass
@@ -244,11 +244,11 @@ bool ParticleMaterialShader::Load()
         break;
     }
     psDesc.VS = vsSprite;
-    _cacheSprite.Default.Init(psDesc);
+    _cacheSprite.Default.Init(psDesc, this);
     psDesc.VS = vsMesh;
-    _cacheModel.Default.Init(psDesc);
+    _cacheModel.Default.Init(psDesc, this);
     psDesc.VS = vsRibbon;
-    _cacheRibbon.Default.Init(psDesc);
+    _cacheRibbon.Default.Init(psDesc, this);
 
     // Depth Pass
     psDesc = GPUPipelineState::Description::Default;
@@ -256,11 +256,11 @@ bool ParticleMaterialShader::Load()
     psDesc.DepthClipEnable = false;
     psDesc.PS = _shader->GetPS("PS_Depth");
     psDesc.VS = vsSprite;
-    _cacheSprite.Depth.Init(psDesc);
+    _cacheSprite.Depth.Init(psDesc, this);
     psDesc.VS = vsMesh;
-    _cacheModel.Depth.Init(psDesc);
+    _cacheModel.Depth.Init(psDesc, this);
     psDesc.VS = vsRibbon;
-    _cacheRibbon.Depth.Init(psDesc);
+    _cacheRibbon.Depth.Init(psDesc, this);
 
     // Lazy initialization
     _cacheVolumetricFog.Desc.PS = nullptr;
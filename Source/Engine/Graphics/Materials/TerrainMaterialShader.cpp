@@ -27,8 +27,10 @@ PACK_STRUCT(struct TerrainMaterialShaderData {
     Float4 HeightmapUVScaleBias; // xy-scale, zw-offset for chunk geometry UVs into heightmap UVs (as single MAD instruction)
     Float4 NeighborLOD; // Per component LOD index for chunk neighbors ordered: top, left, right, bottom
     Float2 OffsetUV; // Offset applied to the texture coordinates (used to implement seamless UVs based on chunk location relative to terrain root)
-    Float2 Dummy0;
+    Float2 LODMorph; // x-LOD distribution (0 if distance-based morphing is disabled), y-LOD bias
     Float4 LightmapArea;
+    Float3 LODViewPosition; // Position of the view used for the LOD selection (relative to the current view origin)
+    float Dummy0;
     });
 
 DrawPass TerrainMaterialShader::GetDrawModes() const
@@ -84,6 +86,8 @@ void TerrainMaterialShader::Bind(BindParameters& params)
         materialData->HeightmapUVScaleBias = drawCall.Terrain.HeightmapUVScaleBias;
         materialData->NeighborLOD = drawCall.Terrain.NeighborLOD;
         materialData->OffsetUV = drawCall.Terrain.OffsetUV;
+        materialData->LODMorph = drawCall.Terrain.LODMorph;
+        materialData->LODViewPosition = drawCall.Terrain.LODViewPosition;
         materialData->LightmapArea = *(Float4*)&drawCall.Terrain.LightmapUVsArea;
     }
 
@@ -167,18 +171,18 @@ bool TerrainMaterialShader::Load()
     // GBuffer Pass
     psDesc.VS = _shader->GetVS("VS");
     psDesc.PS = _shader->GetPS("PS_GBuffer");
-    _cache.Default.Init(psDesc);
+    _cache.Default.Init(psDesc, this);
 
     // GBuffer Pass with lightmap (use pixel shader permutation for USE_LIGHTMAP=1)
     psDesc.PS = _shader->GetPS("PS_GBuffer", 1);
-    _cache.DefaultLightmap.Init(psDesc);
+    _cache.DefaultLightmap.Init(psDesc, this);
 
 #if USE_EDITOR
     if (_shader->HasShader("PS_QuadOverdraw"))
     {
         // Quad Overdraw
         psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
-        _cache.QuadOverdraw.Init(psDesc);
+        _cache.QuadOverdraw.Init(psDesc, this);
     }
 #endif
 
@@ -193,7 +197,7 @@ bool TerrainMaterialShader::Load()
     psDesc.DS = nullptr;
     // TODO: masked terrain materials (depth pass should clip holes)
     psDesc.PS = nullptr;
-    _cache.Depth.Init(psDesc);
+    _cache.Depth.Init(psDesc, this);
 
     return false;
 }
@@ -259,6 +259,10 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
     }
 #endif
 
+    // Calculate texture coordinates density (used by the textures streaming)
+    if (vb0 && vb1 && ib)
+        CalculateUVDensity(triangles, (const Float3*)vb0, sizeof(VB0ElementType), &((const VB1ElementType*)vb1)->TexCoord, sizeof(VB1ElementType), ib, use16BitIndexBuffer);
+
     // Initialize
     _vertexBuffers[0] = vertexBuffer0;
     _vertexBuffers[1] = vertexBuffer1;
@@ -416,6 +420,9 @@ void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, cons
 #endif
 
     // Push draw call to the render list
+    BoundingSphere bounds;
+    BoundingSphere::Transform(_sphere, world, bounds);
+    ReportTexturesResolution(renderContext, material, bounds);
     renderContext.List->AddDrawCall(renderContext, drawModes, flags, drawCall, receiveDecals, sortOrder);
 }
 
@@ -485,6 +492,7 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
 #endif
 
     // Push draw call to the render list
+    ReportTexturesResolution(renderContext, material, info.Bounds);
     renderContext.List->AddDrawCall(renderContext, drawModes, info.Flags, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
@@ -548,6 +556,7 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
 #endif
 
     // Push draw call to the render lists
+    ReportTexturesResolution(renderContextBatch.GetMainContext(), material, info.Bounds);
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
     const auto drawModes = info.DrawModes & material->GetDrawModes();
     if (drawModes != DrawPass::None)
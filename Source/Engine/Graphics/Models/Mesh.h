@@ -3,6 +3,7 @@
 #pragma once
 
 #include "MeshBase.h"
+#include "Engine/Core/Collections/Array.h"
 #include "ModelInstanceEntry.h"
 #include "Config.h"
 #include "Types.h"
@@ -12,6 +13,19 @@
 
 class Lightmap;
 
+/// <summary>
+/// The mesh geometry split into meshlets (clusters of triangles).
+/// </summary>
+struct MeshletsData
+{
+    // The meshlets.
+    Array<Meshlet> Meshlets;
+    // The indices of the mesh vertices referenced by the meshlets.
+    Array<uint32> Vertices;
+    // The triangles of the meshlets (3 bytes per triangle with the indices into the meshlet vertices).
+    Array<byte> Triangles;
+};
+
 /// <summary>
 /// Represents part of the model that is made of vertices and can be rendered using custom material and transformation.
 /// </summary>
@@ -29,6 +43,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     mutable Array<byte> _cachedIndexBuffer;
     mutable int32 _cachedIndexBufferCount;
 
+public:
+    /// <summary>
+    /// The mesh geometry clusters (meshlets) with bounds and normal cones for the per-cluster culling. Empty if not generated during model importing.
+    /// </summary>
+    MeshletsData Meshlets;
+
 public:
     Mesh(const Mesh& other)
         : Mesh()
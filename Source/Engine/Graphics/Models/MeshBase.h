@@ -19,6 +19,7 @@ class Lightmap;
 class GPUBuffer;
 class SkinnedMeshDrawData;
 class BlendShapesInstance;
+class MaterialBase;
 
 /// <summary>
 /// Base class for model resources meshes.
@@ -36,6 +37,7 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MeshBase : public ScriptingObj
     uint32 _triangles;
     int32 _materialSlotIndex;
     bool _use16BitIndexBuffer;
+    float _uvDensity = 0.0f;
 
     explicit MeshBase(const SpawnParams& params)
         : ScriptingObject(params)
@@ -126,6 +128,25 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MeshBase : public ScriptingObj
     /// <param name="box">The bounding box.</param>
     void SetBounds(const BoundingBox& box);
 
+    /// <summary>
+    /// Gets the average density of the texture coordinates over the mesh surface (UV units per local space unit). Zero if unknown.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE float GetUVDensity() const
+    {
+        return _uvDensity;
+    }
+
+    /// <summary>
+    /// Reports the texture resolution required to draw this mesh (based on its screen size and UVs density) to the streamed textures used by the material.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="material">The material used to draw the mesh.</param>
+    /// <param name="bounds">The mesh bounds (in world space).</param>
+    void ReportTexturesResolution(const RenderContext& renderContext, const MaterialBase* material, const BoundingSphere& bounds) const;
+
+protected:
+    void CalculateUVDensity(uint32 triangles, const Float3* positions, int32 positionsStride, const Half2* uvs, int32 uvsStride, const void* ib, bool use16BitIndexBuffer);
+
 public:
     /// <summary>
     /// Extract mesh buffer data from GPU. Cannot be called from the main thread.
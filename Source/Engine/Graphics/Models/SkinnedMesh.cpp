@@ -2,6 +2,7 @@
 
 #include "SkinnedMesh.h"
 #include "MeshDeformation.h"
+#include "SkinnedMeshDrawData.h"
 #include "ModelInstanceEntry.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
@@ -12,6 +13,7 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/ComputeSkinningPass.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
@@ -103,6 +105,22 @@ SkinnedMesh::~SkinnedMesh()
 {
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_vertexBufferRaw);
+}
+
+GPUBuffer* SkinnedMesh::GetVertexBufferRaw(GPUContext* context) const
+{
+    if (!_vertexBufferRaw && _vertexBuffer)
+    {
+        _vertexBufferRaw = GPUDevice::Instance->CreateBuffer(TEXT("SkinnedMesh.VBRaw"));
+        if (_vertexBufferRaw->Init(GPUBufferDescription::Raw(_vertexBuffer->GetSize(), GPUBufferFlags::ShaderResource)))
+        {
+            SAFE_DELETE_GPU_RESOURCE(_vertexBufferRaw);
+            return nullptr;
+        }
+        context->CopyBuffer(_vertexBufferRaw, _vertexBuffer, _vertexBuffer->GetSize());
+    }
+    return _vertexBufferRaw;
 }
 
 bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void* ib, bool use16BitIndexBuffer)
@@ -132,7 +150,12 @@ bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const
     if (indexBuffer->Init(GPUBufferDescription::Index(ibStride, indicesCount, ib)))
         goto ERROR_LOAD_END;
 
+    // Calculate texture coordinates density (used by the textures streaming)
+    if (vb0 && ib)
+        CalculateUVDensity(triangles, &((const VB0SkinnedElementType*)vb0)->Position, sizeof(VB0SkinnedElementType), &((const VB0SkinnedElementType*)vb0)->TexCoord, sizeof(VB0SkinnedElementType), ib, use16BitIndexBuffer);
+
     // Initialize
+    SAFE_DELETE_GPU_RESOURCE(_vertexBufferRaw);
     _vertexBuffer = vertexBuffer;
     _indexBuffer = indexBuffer;
     _triangles = triangles;
@@ -152,6 +175,7 @@ void SkinnedMesh::Unload()
 {
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_vertexBufferRaw);
     _cachedIndexBuffer.Clear();
     _cachedVertexBuffer.Clear();
     _triangles = 0;
@@ -230,7 +254,7 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
 
     // Check if skip rendering
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
-    const auto drawModes = info.DrawModes & renderContext.View.Pass & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & material->GetDrawModes();
+    auto drawModes = info.DrawModes & renderContext.View.Pass & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & material->GetDrawModes();
     if (drawModes == DrawPass::None)
         return;
 
@@ -254,8 +278,26 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     drawCall.WorldDeterminantSign = RenderTools::GetWorldDeterminantSign(drawCall.World);
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
 
+    // Use the vertices skinned by the compute shader (drawn as a static geometry)
+    GPUBuffer* skinnedPositions;
+    GPUBuffer* skinnedAttributes;
+    if (info.Skinning && drawCall.Geometry.VertexBuffers[0] == _vertexBuffer && ComputeSkinningPass::Instance()->GetVertices(info.Skinning, this, skinnedPositions, skinnedAttributes))
+    {
+        if (EnumHasAnyFlags(drawModes, DrawPass::MotionVectors) && info.Skinning->PrevBoneMatrices)
+        {
+            // Per-bone motion vectors need the previous bones so use the vertex shader skinning for them
+            renderContext.List->AddDrawCall(renderContext, DrawPass::MotionVectors, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
+            drawModes &= ~DrawPass::MotionVectors;
+        }
+        drawCall.Geometry.VertexBuffers[0] = skinnedPositions;
+        drawCall.Geometry.VertexBuffers[1] = skinnedAttributes;
+        drawCall.Surface.Skinning = nullptr;
+    }
+
     // Push draw call to the render list
-    renderContext.List->AddDrawCall(renderContext, drawModes, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
+    ReportTexturesResolution(renderContext, material, info.Bounds);
+    if (drawModes != DrawPass::None)
+        renderContext.List->AddDrawCall(renderContext, drawModes, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
 void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& info, float lodDitherFactor) const
@@ -294,10 +336,29 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
     drawCall.Surface.LODDitherFactor = lodDitherFactor;
     drawCall.WorldDeterminantSign = RenderTools::GetWorldDeterminantSign(drawCall.World);
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
+    auto drawModes = info.DrawModes & material->GetDrawModes();
+
+    // Use the vertices skinned by the compute shader (drawn as a static geometry)
+    GPUBuffer* skinnedPositions;
+    GPUBuffer* skinnedAttributes;
+    if (info.Skinning && drawCall.Geometry.VertexBuffers[0] == _vertexBuffer && ComputeSkinningPass::Instance()->GetVertices(info.Skinning, this, skinnedPositions, skinnedAttributes))
+    {
+        const RenderContext& renderContext = renderContextBatch.GetMainContext();
+        if (EnumHasAnyFlags(drawModes, DrawPass::MotionVectors) && info.Skinning->PrevBoneMatrices)
+        {
+            // Per-bone motion vectors need the previous bones so use the vertex shader skinning for them
+            if (EnumHasAnyFlags(renderContext.View.Pass, DrawPass::MotionVectors))
+                renderContext.List->AddDrawCall(renderContext, DrawPass::MotionVectors, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
+            drawModes &= ~DrawPass::MotionVectors;
+        }
+        drawCall.Geometry.VertexBuffers[0] = skinnedPositions;
+        drawCall.Geometry.VertexBuffers[1] = skinnedAttributes;
+        drawCall.Surface.Skinning = nullptr;
+    }
 
     // Push draw call to the render lists
+    ReportTexturesResolution(renderContextBatch.GetMainContext(), material, info.Bounds);
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
-    const auto drawModes = info.DrawModes & material->GetDrawModes();
     if (drawModes != DrawPass::None)
         renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
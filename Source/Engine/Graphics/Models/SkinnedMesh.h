@@ -15,6 +15,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedMesh : public MeshBase
 protected:
     GPUBuffer* _vertexBuffer = nullptr;
     GPUBuffer* _indexBuffer = nullptr;
+    mutable GPUBuffer* _vertexBufferRaw = nullptr;
     mutable Array<byte> _cachedIndexBuffer;
     mutable Array<byte> _cachedVertexBuffer;
     mutable int32 _cachedIndexBufferCount;
@@ -50,6 +51,29 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedMesh : public MeshBase
         return _vertexBuffer != nullptr;
     }
 
+    /// <summary>
+    /// Gets the vertex buffer.
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetVertexBuffer() const
+    {
+        return _vertexBuffer;
+    }
+
+    /// <summary>
+    /// Gets the index buffer.
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetIndexBuffer() const
+    {
+        return _indexBuffer;
+    }
+
+    /// <summary>
+    /// Gets the copy of the vertex buffer that can be read as a raw buffer by the compute shaders (eg. for the compute shader skinning). Created on the first use.
+    /// </summary>
+    /// <param name="context">The GPU context used to copy the vertices.</param>
+    /// <returns>The raw vertex buffer or null if failed to create it.</returns>
+    GPUBuffer* GetVertexBufferRaw(GPUContext* context) const;
+
     /// <summary>
     /// Blend shapes used by this mesh.
     /// </summary>
@@ -6,6 +6,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Matrix.h"
 #include "Engine/Core/Math/Matrix3x4.h"
+#include "Engine/Renderer/ComputeSkinningPass.h"
 
 SkinnedMeshDrawData::SkinnedMeshDrawData()
 {
@@ -13,6 +14,8 @@ SkinnedMeshDrawData::SkinnedMeshDrawData()
 
 SkinnedMeshDrawData::~SkinnedMeshDrawData()
 {
+    if (ComputeSkinning.HasItems())
+        ComputeSkinningPass::Instance()->Remove(this);
     SAFE_DELETE_GPU_RESOURCE(BoneMatrices);
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
 }
@@ -84,4 +87,5 @@ void SkinnedMeshDrawData::OnDataChanged(bool dropHistory)
 
     _isDirty = true;
     _hasValidData = true;
+    _version++;
 }
@@ -13,8 +13,28 @@ class FLAXENGINE_API SkinnedMeshDrawData
 private:
     bool _hasValidData = false;
     bool _isDirty = false;
+    uint32 _version = 0;
 
 public:
+    /// <summary>
+    /// The mesh vertices skinned by the compute shader (see Graphics::ComputeSkinning).
+    /// </summary>
+    struct SkinnedVertices
+    {
+        // The skinned mesh.
+        const class SkinnedMesh* Mesh;
+        // The mesh vertex buffer used as a source (to detect mesh reloads).
+        const GPUBuffer* Source;
+        // The skinned positions (in VB0ElementType layout).
+        GPUBuffer* Positions;
+        // The skinned vertex attributes (in VB1ElementType layout).
+        GPUBuffer* Attributes;
+        // The bones data version used to skin the vertices.
+        uint32 Version;
+        // The last frame index when the vertices were requested for drawing.
+        uint64 LastFrameUsed;
+    };
+
     /// <summary>
     /// The bones count.
     /// </summary>
@@ -35,6 +55,11 @@ class FLAXENGINE_API SkinnedMeshDrawData
     /// </summary>
     Array<byte> Data;
 
+    /// <summary>
+    /// The meshes skinned by the compute shader. Managed by the ComputeSkinningPass.
+    /// </summary>
+    Array<SkinnedVertices> ComputeSkinning;
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="SkinnedMeshDrawData"/> class.
@@ -63,6 +88,14 @@ class FLAXENGINE_API SkinnedMeshDrawData
         return _isDirty;
     }
 
+    /// <summary>
+    /// Gets the version of the bones data (incremented on every change).
+    /// </summary>
+    FORCE_INLINE uint32 GetVersion() const
+    {
+        return _version;
+    }
+
     /// <summary>
     /// Setups the data container for the specified bones amount.
     /// </summary>
@@ -193,3 +193,28 @@ PACK_STRUCT(struct VB0SkinnedElementType2
 
 typedef VB0SkinnedElementType2 VB0SkinnedElementType;
 //
+
+/// <summary>
+/// The cluster of the mesh triangles (meshlet) with bounds and normal cone used for the per-cluster culling. Generated during model importing.
+/// </summary>
+PACK_STRUCT(struct Meshlet
+    {
+    // The offset of the first vertex index in the meshlet vertices list.
+    uint32 VertexOffset;
+    // The offset of the first triangle in the meshlet triangles list (in bytes, each triangle uses 3 local vertex indices).
+    uint32 TriangleOffset;
+    // The amount of the unique vertices used by the meshlet.
+    uint32 VertexCount;
+    // The amount of the triangles in the meshlet.
+    uint32 TriangleCount;
+    // The bounding sphere center (in mesh local-space).
+    Float3 Center;
+    // The bounding sphere radius.
+    float Radius;
+    // The normal cone apex (in mesh local-space). Used for the perspective back-face culling: cluster is back-facing if dot(normalize(ConeApex - cameraPosition), ConeAxis) >= ConeCutoff.
+    Float3 ConeApex;
+    // The normal cone axis.
+    Float3 ConeAxis;
+    // The normal cone cutoff (cosine of the cone angle).
+    float ConeCutoff;
+    });
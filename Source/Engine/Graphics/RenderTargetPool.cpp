@@ -20,6 +20,22 @@ struct Entry
 namespace
 {
     Array<Entry> TemporaryRTs;
+
+    bool IsCompatible(const GPUTextureDescription& pooled, const GPUTextureDescription& desc)
+    {
+        // Pooled texture can have more usage flags (eg. UAV) as long as the memory layout matches
+        return pooled.Dimensions == desc.Dimensions &&
+               pooled.Width == desc.Width &&
+               pooled.Height == desc.Height &&
+               pooled.Depth == desc.Depth &&
+               pooled.ArraySize == desc.ArraySize &&
+               pooled.MipLevels == desc.MipLevels &&
+               pooled.Format == desc.Format &&
+               pooled.MultiSampleLevel == desc.MultiSampleLevel &&
+               pooled.Usage == desc.Usage &&
+               pooled.DefaultClearColor == desc.DefaultClearColor &&
+               EnumHasAllFlags(pooled.Flags, desc.Flags);
+    }
 }
 
 void RenderTargetPool::Flush(bool force, int32 framesOffset)
@@ -68,6 +84,19 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
             return e.RT;
         }
     }
+
+    // Find free render target that can be used instead to reduce memory usage
+    for (int32 i = 0; i < TemporaryRTs.Count(); i++)
+    {
+        auto& e = TemporaryRTs[i];
+        if (!e.IsOccupied && IsCompatible(e.RT->GetDescription(), desc))
+        {
+            // Mark as used
+            e.IsOccupied = true;
+            RENDER_TARGET_POOL_CLEAR();
+            return e.RT;
+        }
+    }
 #if !BUILD_RELEASE
     if (TemporaryRTs.Count() > 2000)
     {
@@ -17,12 +17,22 @@
 #include "Engine/Profiler/Profiler.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Renderer/Utils/GPUWorkBudget.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Lightmaps.h"
 #else
 #include "Engine/Engine/Screen.h"
 #endif
 
+// Dynamic resolution percentage quantization step (limits the amount of render buffers sizes)
+#define DYNAMIC_RESOLUTION_STEP 0.05f
+// Dynamic resolution maximum percentage change per adjustment
+#define DYNAMIC_RESOLUTION_MAX_CHANGE 0.1f
+// Dynamic resolution relative GPU time tolerance around the target
+#define DYNAMIC_RESOLUTION_HYSTERESIS 0.1f
+// Minimum amount of frames between dynamic resolution adjustments (GPU timer results come with a few frames latency)
+#define DYNAMIC_RESOLUTION_COOLDOWN 8
+
 Array<RenderTask*> RenderTask::Tasks;
 CriticalSection RenderTask::TasksLocker;
 int32 RenderTask::TasksDoneLastFrame;
@@ -156,6 +166,8 @@ SceneRenderTask::~SceneRenderTask()
         Buffers->DeleteObjectNow();
     if (_customActorsScene)
         Delete(_customActorsScene);
+    if (_renderTimer)
+        Delete(_renderTimer);
 }
 
 void SceneRenderTask::CameraCut()
@@ -368,9 +380,38 @@ GPUTextureView* SceneRenderTask::GetOutputView() const
     return nullptr;
 }
 
+void SceneRenderTask::UpdateDynamicResolution()
+{
+    if (!DynamicResolution || _dynamicResolutionFrame == Engine::FrameCount)
+        return;
+    _dynamicResolutionFrame = Engine::FrameCount;
+    const float gpuTime = _renderTimer ? _renderTimer->GetItemCost() : 0.0f;
+    const float minPercentage = Math::Clamp(DynamicResolutionMin, DYNAMIC_RESOLUTION_STEP, 1.0f);
+    const float maxPercentage = Math::Clamp(DynamicResolutionMax, minPercentage, 1.0f);
+    float percentage = Math::Clamp(RenderingPercentage, minPercentage, maxPercentage);
+    if (gpuTime > ZeroTolerance && DynamicResolutionTargetTime > ZeroTolerance && Engine::FrameCount - _dynamicResolutionChangeFrame >= DYNAMIC_RESOLUTION_COOLDOWN)
+    {
+        // GPU time scales with the amount of pixels (square of the percentage), hysteresis prevents oscillations around the target
+        const float ratio = DynamicResolutionTargetTime / gpuTime;
+        if (ratio < 1.0f - DYNAMIC_RESOLUTION_HYSTERESIS || ratio > 1.0f + DYNAMIC_RESOLUTION_HYSTERESIS)
+        {
+            // Limit the change and quantize it to reduce render buffers reallocations
+            float target = Math::Clamp(percentage * Math::Sqrt(ratio), percentage - DYNAMIC_RESOLUTION_MAX_CHANGE, percentage + DYNAMIC_RESOLUTION_MAX_CHANGE);
+            target = Math::Floor(target / DYNAMIC_RESOLUTION_STEP + 0.001f) * DYNAMIC_RESOLUTION_STEP;
+            percentage = Math::Clamp(target, minPercentage, maxPercentage);
+        }
+    }
+    if (Math::NotNearEqual(percentage, RenderingPercentage))
+    {
+        RenderingPercentage = percentage;
+        _dynamicResolutionChangeFrame = Engine::FrameCount;
+    }
+}
+
 void SceneRenderTask::OnBegin(GPUContext* context)
 {
     RenderTask::OnBegin(context);
+    UpdateDynamicResolution();
 
     // Copy view info if camera is specified
     if (Camera)
@@ -393,7 +434,21 @@ void SceneRenderTask::OnBegin(GPUContext* context)
 void SceneRenderTask::OnRender(GPUContext* context)
 {
     if (!IsCustomRendering && Buffers && Buffers->GetWidth() > 0)
-        Renderer::Render(this);
+    {
+        if (DynamicResolution)
+        {
+            // Measure the scene rendering GPU time
+            if (!_renderTimer)
+                _renderTimer = New<GPUWorkBudget>();
+            _renderTimer->Begin();
+            Renderer::Render(this);
+            _renderTimer->End(1);
+        }
+        else
+        {
+            Renderer::Render(this);
+        }
+    }
 
     RenderTask::OnRender(context);
 }
@@ -464,6 +519,7 @@ void MainRenderTask::OnBegin(GPUContext* context)
 
 #if !USE_EDITOR
     // Sync render buffers size with the backbuffer
+    UpdateDynamicResolution();
     const auto size = Screen::GetSize();
     Buffers->Init((int32)(size.X * RenderingPercentage), (int32)(size.Y * RenderingPercentage));
 #endif
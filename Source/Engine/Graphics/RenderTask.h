@@ -18,6 +18,7 @@ class GPUTextureView;
 class GPUSwapChain;
 class RenderBuffers;
 class PostProcessEffect;
+class GPUWorkBudget;
 struct RenderContext;
 class Camera;
 class Actor;
@@ -218,6 +219,9 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     DECLARE_SCRIPTING_TYPE(SceneRenderTask);
 protected:
     class SceneRendering* _customActorsScene = nullptr;
+    GPUWorkBudget* _renderTimer = nullptr;
+    uint64 _dynamicResolutionFrame = 0;
+    uint64 _dynamicResolutionChangeFrame = 0;
 
 public:
     /// <summary>
@@ -276,6 +280,26 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     /// </summary>
     API_FIELD() RenderingUpscaleLocation UpscaleLocation = RenderingUpscaleLocation::AfterAntiAliasingPass;
 
+    /// <summary>
+    /// If checked, the RenderingPercentage will be adjusted automatically every frame (within DynamicResolutionMin and DynamicResolutionMax range) based on the measured GPU time of the scene rendering to fit into DynamicResolutionTargetTime.
+    /// </summary>
+    API_FIELD() bool DynamicResolution = false;
+
+    /// <summary>
+    /// The target GPU time of the scene rendering (in milliseconds) used by the dynamic resolution.
+    /// </summary>
+    API_FIELD() float DynamicResolutionTargetTime = 14.0f;
+
+    /// <summary>
+    /// The minimum rendering percentage used by the dynamic resolution.
+    /// </summary>
+    API_FIELD() float DynamicResolutionMin = 0.5f;
+
+    /// <summary>
+    /// The maximum rendering percentage used by the dynamic resolution.
+    /// </summary>
+    API_FIELD() float DynamicResolutionMax = 1.0f;
+
 public:
     /// <summary>
     /// The custom set of actors to render. Used when ActorsSources::CustomActors flag is active.
@@ -408,6 +432,10 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     /// </summary>
     API_PROPERTY() GPUTextureView* GetOutputView() const;
 
+protected:
+    // Updates RenderingPercentage when using dynamic resolution (once per frame, before render buffers setup).
+    void UpdateDynamicResolution();
+
 public:
     // [RenderTask]
     bool Resize(int32 width, int32 height) override;
@@ -9,8 +9,12 @@
 #include "RenderTask.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Renderer/DrawCall.h"
+#include "Engine/Renderer/TextureFeedbackPass.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Packed.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
 
 const Char* ToString(RendererType value)
@@ -409,54 +413,87 @@ float RenderTools::ComputeBoundsScreenRadiusSquared(const Float3& origin, float
     return Math::Square(screenMultiple * radius) / Math::Max(1.0f, distSqr);
 }
 
-int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, float radius, const RenderContext& renderContext)
+// The relative screen size margin around the LOD switch threshold to keep the previous LOD (prevents flickering)
+#define RENDER_TOOLS_LOD_HYSTERESIS 0.1f
+
+namespace
 {
-    const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
-    const float screenRadiusSquared = ComputeBoundsScreenRadiusSquared(origin, radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+    template<typename ModelType>
+    int32 ComputeLOD(const ModelType* model, float screenRadiusSquared)
+    {
+        // Check if model is being culled
+        if (Math::Square(model->MinScreenSize * 0.5f) > screenRadiusSquared)
+            return -1;
+
+        // Skip if no need to calculate LOD
+        if (model->LODs.Count() <= 1)
+            return 0;
 
-    // Check if model is being culled
-    if (Math::Square(model->MinScreenSize * 0.5f) > screenRadiusSquared)
-        return -1;
+        // Iterate backwards and return the first matching LOD
+        for (int32 lodIndex = model->LODs.Count() - 1; lodIndex >= 0; lodIndex--)
+        {
+            if (Math::Square(model->LODs[lodIndex].ScreenSize * 0.5f) >= screenRadiusSquared)
+            {
+                return lodIndex;
+            }
+        }
 
-    // Skip if no need to calculate LOD
-    if (model->LODs.Count() <= 1)
         return 0;
+    }
 
-    // Iterate backwards and return the first matching LOD
-    for (int32 lodIndex = model->LODs.Count() - 1; lodIndex >= 0; lodIndex--)
+    template<typename ModelType>
+    int32 ComputeLOD(const ModelType* model, const Float3& origin, float radius, const RenderContext& renderContext, GeometryDrawStateData& drawState)
     {
-        if (Math::Square(model->LODs[lodIndex].ScreenSize * 0.5f) >= screenRadiusSquared)
+        const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
+        if (renderContext.View.IsSingleFrame)
+            return ComputeLOD(model, RenderTools::ComputeBoundsScreenRadiusSquared(origin, radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt);
+
+        // Reuse LOD computed for this view in this frame (eg. main view LOD used by shadow maps)
+        const uint64 frame = Engine::FrameCount;
+        if (drawState.LODFrame == frame && drawState.LODView == lodView)
+            return drawState.LOD;
+
+        const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(origin, radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+        int32 lodIndex = ComputeLOD(model, screenRadiusSquared);
+
+        // Keep the previous LOD if screen size is still close to the switch threshold to prevent LOD flickering
+        const int32 prevLOD = drawState.LODFrame + 1 >= frame ? drawState.LOD : -1;
+        if (lodIndex != -1 && prevLOD != -1 && Math::Abs(lodIndex - prevLOD) == 1 && prevLOD < model->LODs.Count())
         {
-            return lodIndex;
+            const float threshold = Math::Square(model->LODs[Math::Max(lodIndex, prevLOD)].ScreenSize * 0.5f);
+            if (lodIndex > prevLOD ? screenRadiusSquared > threshold * Math::Square(1.0f - RENDER_TOOLS_LOD_HYSTERESIS) : screenRadiusSquared < threshold * Math::Square(1.0f + RENDER_TOOLS_LOD_HYSTERESIS))
+                lodIndex = prevLOD;
         }
-    }
 
-    return 0;
+        drawState.LOD = (char)lodIndex;
+        drawState.LODFrame = frame;
+        drawState.LODView = lodView;
+        return lodIndex;
+    }
 }
 
-int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float3& origin, float radius, const RenderContext& renderContext)
+int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, float radius, const RenderContext& renderContext)
 {
     const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
     const float screenRadiusSquared = ComputeBoundsScreenRadiusSquared(origin, radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+    return ComputeLOD(model, screenRadiusSquared);
+}
 
-    // Check if model is being culled
-    if (Math::Square(model->MinScreenSize * 0.5f) > screenRadiusSquared)
-        return -1;
-
-    // Skip if no need to calculate LOD
-    if (model->LODs.Count() <= 1)
-        return 0;
+int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, float radius, const RenderContext& renderContext, GeometryDrawStateData& drawState)
+{
+    return ComputeLOD(model, origin, radius, renderContext, drawState);
+}
 
-    // Iterate backwards and return the first matching LOD
-    for (int32 lodIndex = model->LODs.Count() - 1; lodIndex >= 0; lodIndex--)
-    {
-        if (Math::Square(model->LODs[lodIndex].ScreenSize * 0.5f) >= screenRadiusSquared)
-        {
-            return lodIndex;
-        }
-    }
+int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float3& origin, float radius, const RenderContext& renderContext)
+{
+    const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
+    const float screenRadiusSquared = ComputeBoundsScreenRadiusSquared(origin, radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+    return ComputeLOD(model, screenRadiusSquared);
+}
 
-    return 0;
+int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float3& origin, float radius, const RenderContext& renderContext, GeometryDrawStateData& drawState)
+{
+    return ComputeLOD(model, origin, radius, renderContext, drawState);
 }
 
 void RenderTools::ComputeCascadeUpdateFrequency(int32 cascadeIndex, int32 cascadeCount, int32& updateFrequency, int32& updatePhrase, int32 updateMaxCountPerFrame)
@@ -657,3 +694,44 @@ void MeshBase::SetBounds(const BoundingBox& box)
     _box = box;
     BoundingSphere::FromBox(box, _sphere);
 }
+
+void MeshBase::ReportTexturesResolution(const RenderContext& renderContext, const MaterialBase* material, const BoundingSphere& bounds) const
+{
+    // Only the main views rendering (not shadows or offline passes) drives the textures streaming
+    const RenderView& view = renderContext.View;
+    if (_uvDensity <= ZeroTolerance || view.IsOfflinePass || EnumHasNoneFlags(view.Pass, DrawPass::GBuffer | DrawPass::Forward))
+        return;
+
+    // Static meshes are covered by the GPU feedback (if used)
+    if (GetModelBase()->Is<Model>() && TextureFeedbackPass::Instance()->IsActive())
+        return;
+
+    // Required resolution is the amount of screen pixels per the UVs range covered by the mesh
+    const float screenRadius = Math::Sqrt(RenderTools::ComputeBoundsScreenRadiusSquared(bounds.Center, (float)bounds.Radius, view));
+    const float screenSize = screenRadius * 2.0f * Math::Max(view.ScreenSize.X, view.ScreenSize.Y);
+    const float uvSize = (float)_sphere.Radius * 2.0f * _uvDensity;
+    const float resolution = Math::Min(screenSize / Math::Max(uvSize, ZeroTolerance), (float)GPU_MAX_TEXTURE_SIZE);
+    material->ReportTexturesResolution(Math::Max((int32)resolution, 1));
+}
+
+void MeshBase::CalculateUVDensity(uint32 triangles, const Float3* positions, int32 positionsStride, const Half2* uvs, int32 uvsStride, const void* ib, bool use16BitIndexBuffer)
+{
+    // Sample a subset of triangles on large meshes
+    const uint32 step = Math::Max(triangles / 1024, 1u);
+    double worldArea = 0.0, uvArea = 0.0;
+    for (uint32 triangle = 0; triangle < triangles; triangle += step)
+    {
+        uint32 indices[3];
+        for (int32 i = 0; i < 3; i++)
+            indices[i] = use16BitIndexBuffer ? ((const uint16*)ib)[triangle * 3 + i] : ((const uint32*)ib)[triangle * 3 + i];
+        const Float3& p0 = *(const Float3*)((const byte*)positions + indices[0] * positionsStride);
+        const Float3& p1 = *(const Float3*)((const byte*)positions + indices[1] * positionsStride);
+        const Float3& p2 = *(const Float3*)((const byte*)positions + indices[2] * positionsStride);
+        const Float2 uv0 = ((const Half2*)((const byte*)uvs + indices[0] * uvsStride))->ToFloat2();
+        const Float2 uv1 = ((const Half2*)((const byte*)uvs + indices[1] * uvsStride))->ToFloat2();
+        const Float2 uv2 = ((const Half2*)((const byte*)uvs + indices[2] * uvsStride))->ToFloat2();
+        worldArea += Float3::Cross(p1 - p0, p2 - p0).Length() * 0.5f;
+        uvArea += Math::Abs((uv1.X - uv0.X) * (uv2.Y - uv0.Y) - (uv2.X - uv0.X) * (uv1.Y - uv0.Y)) * 0.5f;
+    }
+    _uvDensity = worldArea > ZeroTolerance ? (float)Math::Sqrt(uvArea / worldArea) : 0.0f;
+}
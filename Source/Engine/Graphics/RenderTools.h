@@ -10,6 +10,7 @@
 class Model;
 class SkinnedModel;
 struct RenderContext;
+struct GeometryDrawStateData;
 struct FloatR10G10B10A2;
 
 GPU_CB_STRUCT(QuadShaderData {
@@ -95,6 +96,17 @@ API_CLASS(Static) class FLAXENGINE_API RenderTools
     /// <returns>The zero-based LOD index. Returns -1 if model should not be rendered.</returns>
     API_FUNCTION() static int32 ComputeModelLOD(const Model* model, API_PARAM(Ref) const Float3& origin, float radius, API_PARAM(Ref) const RenderContext& renderContext);
 
+    /// <summary>
+    /// Computes the model LOD index to use during rendering. Caches the result in the draw state to reuse it by other render contexts with the same LOD view in this frame (eg. shadow maps use the main view) and applies hysteresis to prevent LOD flickering near the switch threshold.
+    /// </summary>
+    /// <param name="model">The model.</param>
+    /// <param name="origin">The bounds origin.</param>
+    /// <param name="radius">The bounds radius.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="drawState">The model instance draw state.</param>
+    /// <returns>The zero-based LOD index. Returns -1 if model should not be rendered.</returns>
+    static int32 ComputeModelLOD(const Model* model, const Float3& origin, float radius, const RenderContext& renderContext, GeometryDrawStateData& drawState);
+
     /// <summary>
     /// Computes the skinned model LOD index to use during rendering.
     /// </summary>
@@ -105,6 +117,17 @@ API_CLASS(Static) class FLAXENGINE_API RenderTools
     /// <returns>The zero-based LOD index. Returns -1 if model should not be rendered.</returns>
     API_FUNCTION() static int32 ComputeSkinnedModelLOD(const SkinnedModel* model, API_PARAM(Ref) const Float3& origin, float radius, API_PARAM(Ref) const RenderContext& renderContext);
 
+    /// <summary>
+    /// Computes the skinned model LOD index to use during rendering. Caches the result in the draw state to reuse it by other render contexts with the same LOD view in this frame and applies hysteresis to prevent LOD flickering.
+    /// </summary>
+    /// <param name="model">The skinned model.</param>
+    /// <param name="origin">The bounds origin.</param>
+    /// <param name="radius">The bounds radius.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="drawState">The model instance draw state.</param>
+    /// <returns>The zero-based LOD index. Returns -1 if model should not be rendered.</returns>
+    static int32 ComputeSkinnedModelLOD(const SkinnedModel* model, const Float3& origin, float radius, const RenderContext& renderContext, GeometryDrawStateData& drawState);
+
     /// <summary>
     /// Computes the sorting key for depth value (quantized)
     /// Reference: http://aras-p.info/blog/2014/01/16/rough-sorting-by-depth/
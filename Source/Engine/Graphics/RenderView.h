@@ -117,6 +117,11 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API RenderView
     /// </summary>
     API_FIELD() bool IsCullingDisabled = false;
 
+    /// <summary>
+    /// Enables occlusion culling that skips drawing objects hidden behind the scene depth from the previous frames (reprojected Hi-Z). Reduces draw calls in dense scenes but occluded objects can pop-in for a few frames when getting revealed quickly.
+    /// </summary>
+    API_FIELD() bool IsOcclusionCullingEnabled = false;
+
     /// <summary>
     /// True if TAA has been resolved when rendering view and frame doesn't contain jitter anymore. Rendering geometry after this point should not use jitter anymore (eg. editor gizmos or custom geometry as overlay).
     /// </summary>
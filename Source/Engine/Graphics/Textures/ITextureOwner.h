@@ -26,6 +26,14 @@ class FLAXENGINE_API ITextureOwner
     /// <returns>Task that will get asset data (may be null if data already loaded).</returns>
     virtual Task* RequestMipDataAsync(int32 mipIndex) = 0;
 
+    /// <summary>
+    /// Get texture mip maps data (using a single task to batch data reads).
+    /// </summary>
+    /// <param name="mipIndexStart">The first mip map index.</param>
+    /// <param name="mipIndexEnd">The last mip map index (inclusive).</param>
+    /// <returns>Task that will get asset data (may be null if data already loaded).</returns>
+    virtual Task* RequestMipsDataAsync(int32 mipIndexStart, int32 mipIndexEnd) = 0;
+
     /// <summary>
     /// Prepares texture data. May lock data chunks to be keep in cache for a while.
     /// </summary>
@@ -48,6 +48,7 @@ StreamingTexture::StreamingTexture(ITextureOwner* parent, const String& name)
     , _owner(parent)
     , _texture(nullptr)
     , _isBlockCompressed(false)
+    , _requiredResolution(0)
 {
     ASSERT(parent != nullptr);
 
@@ -146,6 +147,18 @@ uint64 StreamingTexture::GetTotalMemoryUsage() const
     return RenderTools::CalculateTextureMemoryUsage(_header.Format, _header.Width, _header.Height, _header.MipLevels) * arraySize;
 }
 
+void StreamingTexture::ReportRequiredResolution(int32 resolution) const
+{
+    int32 current = Platform::AtomicRead(&_requiredResolution);
+    while (resolution > current)
+    {
+        const int32 prev = Platform::InterlockedCompareExchange(&_requiredResolution, resolution, current);
+        if (prev == current)
+            break;
+        current = prev;
+    }
+}
+
 String StreamingTexture::ToString() const
 {
     return _texture->ToString();
@@ -215,9 +228,10 @@ class StreamTextureResizeTask : public GPUTask
         const int32 srcMips = srcTexture->MipLevels();
         const int32 srcMissingMips = srcMips - srcTexture->ResidentMipLevels();
         const int32 mipCount = Math::Min(dstMips, srcMips);
+        GPUContext* copyContext = context->GetCopyContext();
         for (int32 mipIndex = srcMissingMips; mipIndex < mipCount; mipIndex++)
         {
-            context->GPU->CopySubresource(dstTexture, dstMips - mipIndex - 1, srcTexture, srcMips - mipIndex - 1);
+            copyContext->CopySubresource(dstTexture, dstMips - mipIndex - 1, srcTexture, srcMips - mipIndex - 1);
         }
         _uploadedMipCount = mipCount - srcMissingMips;
 
@@ -379,9 +393,10 @@ class StreamTextureMipTask : public GPUUploadTextureMipTask
 
         // Update all array slices
         const byte* dataSource = data.Get();
+        GPUContext* copyContext = context->GetCopyContext();
         for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
         {
-            context->GPU->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, rowPitch, slicePitch);
+            copyContext->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, rowPitch, slicePitch);
             dataSource += slicePitch;
         }
 
@@ -428,23 +443,17 @@ Task* StreamingTexture::CreateStreamingTask(int32 residency)
         // Create tasks collection
         const auto startMipIndex = TotalMipLevels() - _texture->ResidentMipLevels() - 1;
         const auto endMipIndex = startMipIndex - mipsCount;
+
+        // Request all texture mip maps data at once (reads of the mips placed next to each other in file get merged and the uploads don't wait for the loading of each mip)
+        result = _owner->RequestMipsDataAsync(endMipIndex + 1, startMipIndex);
+
         for (int32 mipIndex = startMipIndex; mipIndex > endMipIndex; mipIndex--)
         {
             ASSERT(mipIndex >= 0 && mipIndex < _header.MipLevels);
 
-            // Request texture mip map data
-            auto task = _owner->RequestMipDataAsync(mipIndex);
-            if (task)
-            {
-                if (result)
-                    result->ContinueWith(task);
-                else
-                    result = task;
-            }
-
             // Add upload data task
             const int32 allocatedMipIndex = TotalIndexToTextureMipIndex(mipIndex);
-            task = New<StreamTextureMipTask>(this, allocatedMipIndex);
+            Task* task = New<StreamTextureMipTask>(this, allocatedMipIndex);
             if (result)
                 result->ContinueWith(task);
             else
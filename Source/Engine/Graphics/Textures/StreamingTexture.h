@@ -21,6 +21,7 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     TextureHeader _header;
     int32 _minMipCountBlockCompressed;
     bool _isBlockCompressed;
+    mutable volatile int32 _requiredResolution;
     Array<Task*, FixedAllocation<16>> _streamingTasks;
 
 public:
@@ -156,6 +157,12 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     /// <returns>The amount of bytes.</returns>
     uint64 GetTotalMemoryUsage() const;
 
+    /// <summary>
+    /// Reports the texture resolution required by the rendered geometry (eg. based on the mesh screen size and UVs density). Used by the streaming to skip loading mips that are too detailed to be visible. Can be called from multiple threads.
+    /// </summary>
+    /// <param name="resolution">The required texture resolution (in texels).</param>
+    void ReportRequiredResolution(int32 resolution) const;
+
 public:
     FORCE_INLINE GPUTexture* operator->() const
     {
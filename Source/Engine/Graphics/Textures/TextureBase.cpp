@@ -731,6 +731,17 @@ Task* TextureBase::RequestMipDataAsync(int32 mipIndex)
     return (Task*)_parent->RequestChunkDataAsync(chunkIndex);
 }
 
+Task* TextureBase::RequestMipsDataAsync(int32 mipIndexStart, int32 mipIndexEnd)
+{
+    if (_customData)
+        return nullptr;
+
+    AssetChunksFlag chunks = 0;
+    for (int32 mipIndex = mipIndexStart; mipIndex <= mipIndexEnd; mipIndex++)
+        chunks |= GET_CHUNK_FLAG(CalculateChunkIndex(mipIndex));
+    return (Task*)_parent->RequestChunksDataAsync(chunks);
+}
+
 FlaxStorage::LockData TextureBase::LockData()
 {
     return _parent->Storage ? _parent->Storage->Lock() : FlaxStorage::LockData::Invalid;
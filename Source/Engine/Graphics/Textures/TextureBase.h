@@ -257,6 +257,7 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API TextureBase : public BinaryAss
     // [ITextureOwner]
     CriticalSection& GetOwnerLocker() const override;
     Task* RequestMipDataAsync(int32 mipIndex) override;
+    Task* RequestMipsDataAsync(int32 mipIndexStart, int32 mipIndexEnd) override;
     FlaxStorage::LockData LockData() override;
     void GetMipData(int32 mipIndex, BytesContainer& data) const override;
     void GetMipDataWithLoading(int32 mipIndex, BytesContainer& data) const override;
@@ -408,6 +408,10 @@ bool GPUDeviceDX11::Init()
     // Create DirectX device
     D3D_FEATURE_LEVEL createdFeatureLevel = static_cast<D3D_FEATURE_LEVEL>(0);
     auto targetFeatureLevel = GetD3DFeatureLevel();
+#if PLATFORM_WINDOWS
+    // Try to enable video support for hardware video decoding into textures (fallback to the regular device if it's not supported)
+    if (FAILED(D3D11CreateDevice(adapter, D3D_DRIVER_TYPE_UNKNOWN, NULL, flags | D3D11_CREATE_DEVICE_VIDEO_SUPPORT, &targetFeatureLevel, 1, D3D11_SDK_VERSION, &_device, &createdFeatureLevel, &_imContext)))
+#endif
     VALIDATE_DIRECTX_CALL(D3D11CreateDevice(adapter, D3D_DRIVER_TYPE_UNKNOWN, NULL, flags, &targetFeatureLevel, 1, D3D11_SDK_VERSION, &_device, &createdFeatureLevel, &_imContext));
     ASSERT(_device);
     ASSERT(_imContext);
@@ -469,6 +473,13 @@ bool GPUDeviceDX11::Init()
             limits.HasReadOnlyDepth = true;
             limits.HasMultisampleDepthAsSRV = true;
             limits.HasTypedUAVLoad = featureDataD3D11Options2.TypedUAVLoadAdditionalFormats != 0;
+            limits.HasAsyncCompute = false;
+            limits.HasCopyQueue = false;
+            limits.HasBindlessResources = false;
+            limits.HasVariableRateShading = false;
+            limits.HasVariableRateShadingImage = false;
+            limits.HasVariableRateShadingCoarseRates = false;
+            limits.ShadingRateImageTileSize = 0;
             limits.MaximumMipLevelsCount = D3D11_REQ_MIP_LEVELS;
             limits.MaximumTexture1DSize = D3D11_REQ_TEXTURE1D_U_DIMENSION;
             limits.MaximumTexture1DArraySize = D3D11_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -493,6 +504,13 @@ bool GPUDeviceDX11::Init()
             limits.HasReadOnlyDepth = createdFeatureLevel == D3D_FEATURE_LEVEL_10_1;
             limits.HasMultisampleDepthAsSRV = false;
             limits.HasTypedUAVLoad = false;
+            limits.HasAsyncCompute = false;
+            limits.HasCopyQueue = false;
+            limits.HasBindlessResources = false;
+            limits.HasVariableRateShading = false;
+            limits.HasVariableRateShadingImage = false;
+            limits.HasVariableRateShadingCoarseRates = false;
+            limits.ShadingRateImageTileSize = 0;
             limits.MaximumMipLevelsCount = D3D10_REQ_MIP_LEVELS;
             limits.MaximumTexture1DSize = D3D10_REQ_TEXTURE1D_U_DIMENSION;
             limits.MaximumTexture1DArraySize = D3D10_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -4,6 +4,7 @@
 
 #include "DescriptorHeapDX12.h"
 #include "GPUDeviceDX12.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 
 D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeapWithSlotsDX12::Slot::CPU() const
@@ -183,12 +184,14 @@ DescriptorHeapRingBufferDX12::DescriptorHeapRingBufferDX12(GPUDeviceDX12* device
     , _heap(nullptr)
     , _type(type)
     , _descriptorsCount(descriptorsCount)
+    , _reservedCount(0)
     , _shaderVisible(shaderVisible)
 {
 }
 
-bool DescriptorHeapRingBufferDX12::Init()
+bool DescriptorHeapRingBufferDX12::Init(uint32 reservedCount)
 {
+    ASSERT(reservedCount < _descriptorsCount);
     // Create heap
     D3D12_DESCRIPTOR_HEAP_DESC desc;
     desc.Type = _type;
@@ -199,7 +202,8 @@ bool DescriptorHeapRingBufferDX12::Init()
     LOG_DIRECTX_RESULT_WITH_RETURN(result, true);
 
     // Setup
-    _firstFree = 0;
+    _reservedCount = reservedCount;
+    _firstFree = reservedCount;
     _beginCPU = _heap->GetCPUDescriptorHandleForHeapStart();
     if (_shaderVisible)
         _beginGPU = _heap->GetGPUDescriptorHandleForHeapStart();
@@ -223,8 +227,8 @@ DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateT
     if (_firstFree >= _descriptorsCount)
     {
         // Move to the begin
-        index = 0;
-        _firstFree = numDesc;
+        index = _reservedCount;
+        _firstFree = _reservedCount + numDesc;
     }
 
     // Set pointers
@@ -238,6 +242,78 @@ void DescriptorHeapRingBufferDX12::OnReleaseGPU()
 {
     DX_SAFE_RELEASE_CHECK(_heap, 0);
     _firstFree = 0;
+    _reservedCount = 0;
+}
+
+BindlessDescriptorsDX12::BindlessDescriptorsDX12(GPUDeviceDX12* device)
+    : _device(device)
+{
+}
+
+void BindlessDescriptorsDX12::Init(int32 capacity)
+{
+    _capacity = capacity;
+    _count = 0;
+
+    // Unused descriptors point to null views so out-of-date indices won't crash the GPU
+    auto& heap = _device->RingHeap_CBV_SRV_UAV;
+    const D3D12_CPU_DESCRIPTOR_HANDLE nullSrv = _device->NullSRV(D3D12_SRV_DIMENSION_TEXTURE2D);
+    for (int32 i = 0; i < capacity; i++)
+        _device->GetDevice()->CopyDescriptorsSimple(1, heap.CPU(i), nullSrv, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+int32 BindlessDescriptorsDX12::Allocate(D3D12_CPU_DESCRIPTOR_HANDLE srv)
+{
+    ScopeLock lock(_locker);
+    if (_capacity == 0)
+        return -1;
+
+    // Recycle descriptors no longer used by the GPU
+    const uint64 frame = Engine::FrameCount;
+    for (int32 i = _pending.Count() - 1; i >= 0; i--)
+    {
+        if (_pending[i].Frame <= frame)
+        {
+            _free.Add(_pending[i].Index);
+            _pending.RemoveAt(i);
+        }
+    }
+
+    int32 index;
+    if (_free.HasItems())
+    {
+        index = _free.Last();
+        _free.RemoveLast();
+    }
+    else if (_count < _capacity)
+    {
+        index = _count++;
+    }
+    else
+    {
+        LOG(Warning, "Bindless resources table overflow ({0} descriptors).", _capacity);
+        return -1;
+    }
+
+    _device->GetDevice()->CopyDescriptorsSimple(1, _device->RingHeap_CBV_SRV_UAV.CPU(index), srv, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    return index;
+}
+
+void BindlessDescriptorsDX12::Release(int32 index)
+{
+    ScopeLock lock(_locker);
+    if (_capacity == 0 || index < 0)
+        return;
+    _pending.Add({ index, Engine::FrameCount + DX12_BACK_BUFFER_COUNT + 1 });
+}
+
+void BindlessDescriptorsDX12::Dispose()
+{
+    ScopeLock lock(_locker);
+    _free.Resize(0);
+    _pending.Resize(0);
+    _count = 0;
+    _capacity = 0;
 }
 
 #endif
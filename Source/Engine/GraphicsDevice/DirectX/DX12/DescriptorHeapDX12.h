@@ -6,6 +6,7 @@
 
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Graphics/GPUResource.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "../IncludeDirectXHeaders.h"
 
 class DescriptorHeapPoolDX12;
@@ -150,6 +151,7 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
     D3D12_DESCRIPTOR_HEAP_TYPE _type;
     uint32 _incrementSize;
     uint32 _descriptorsCount;
+    uint32 _reservedCount;
     uint32 _firstFree;
     bool _shaderVisible;
 
@@ -164,7 +166,26 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
         return _heap;
     }
 
-    bool Init();
+    FORCE_INLINE D3D12_CPU_DESCRIPTOR_HANDLE CPU(uint32 index) const
+    {
+        D3D12_CPU_DESCRIPTOR_HANDLE handle;
+        handle.ptr = _beginCPU.ptr + (SIZE_T)(index * _incrementSize);
+        return handle;
+    }
+
+    FORCE_INLINE D3D12_GPU_DESCRIPTOR_HANDLE GPU(uint32 index) const
+    {
+        D3D12_GPU_DESCRIPTOR_HANDLE handle;
+        handle.ptr = _beginGPU.ptr + index * _incrementSize;
+        return handle;
+    }
+
+    /// <summary>
+    /// Creates the heap.
+    /// </summary>
+    /// <param name="reservedCount">The amount of descriptors at the begin of the heap excluded from the ring buffer (eg. for persistent bindless descriptors).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Init(uint32 reservedCount = 0);
     Allocation AllocateTable(uint32 numDesc);
 
 public:
@@ -181,4 +202,63 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
     void OnReleaseGPU() override;
 };
 
+/// <summary>
+/// Persistent shader resource views table for the bindless resources access on DirectX 12. Descriptors are stored in the reserved region at the begin of the shader-visible ring heap (always bound) and indexed in shaders via unbounded arrays (see Bindless.hlsl).
+/// </summary>
+class BindlessDescriptorsDX12
+{
+private:
+
+    struct PendingFree
+    {
+        int32 Index;
+        uint64 Frame;
+    };
+
+    GPUDeviceDX12* _device;
+    CriticalSection _locker;
+    Array<int32> _free;
+    Array<PendingFree> _pending;
+    int32 _count = 0;
+    int32 _capacity = 0;
+
+public:
+
+    BindlessDescriptorsDX12(GPUDeviceDX12* device);
+
+public:
+
+    /// <summary>
+    /// Checks if bindless resources are supported and initialized.
+    /// </summary>
+    FORCE_INLINE bool IsEnabled() const
+    {
+        return _capacity != 0;
+    }
+
+    /// <summary>
+    /// Initializes the descriptors table (fills it with null views). Has to be called after the ring heap creation.
+    /// </summary>
+    /// <param name="capacity">The maximum amount of descriptors (reserved in the ring heap).</param>
+    void Init(int32 capacity);
+
+    /// <summary>
+    /// Allocates the descriptor and copies the shader resource view into it. Can be called from any thread.
+    /// </summary>
+    /// <param name="srv">The source shader resource view (from non-shader-visible heap).</param>
+    /// <returns>The descriptor index or -1 if failed.</returns>
+    int32 Allocate(D3D12_CPU_DESCRIPTOR_HANDLE srv);
+
+    /// <summary>
+    /// Frees the descriptor. Index is reused after the frames in flight are done with it. Can be called from any thread.
+    /// </summary>
+    /// <param name="index">The descriptor index.</param>
+    void Release(int32 index);
+
+    /// <summary>
+    /// Releases the table.
+    /// </summary>
+    void Dispose();
+};
+
 #endif
@@ -9,9 +9,33 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Async/Tasks/GPUUploadBufferTask.h"
 
+void GPUBufferViewDX12::Release()
+{
+    if (_bindlessIndex != -1)
+    {
+        _device->BindlessDescriptors.Release(_bindlessIndex);
+        _bindlessIndex = -1;
+    }
+    _srv.Release();
+    _uav.Release();
+}
+
 void GPUBufferViewDX12::SetSRV(D3D12_SHADER_RESOURCE_VIEW_DESC& srvDesc)
 {
     _srv.CreateSRV(_device, _owner->GetResource(), &srvDesc);
+    if (_bindlessIndex != -1)
+    {
+        // Bindless descriptor could be still in use by GPU so allocate a new one on the next use
+        _device->BindlessDescriptors.Release(_bindlessIndex);
+        _bindlessIndex = -1;
+    }
+}
+
+int32 GPUBufferViewDX12::GetBindlessIndex() const
+{
+    if (_bindlessIndex == -1 && _srv.IsValid())
+        _bindlessIndex = _device->BindlessDescriptors.Allocate(_srv.CPU());
+    return _bindlessIndex;
 }
 
 void GPUBufferViewDX12::SetUAV(D3D12_UNORDERED_ACCESS_VIEW_DESC& uavDesc, ID3D12Resource* counterResource)
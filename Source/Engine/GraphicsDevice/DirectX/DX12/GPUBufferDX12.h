@@ -19,6 +19,7 @@ class GPUBufferViewDX12 : public GPUBufferView, public IShaderResourceDX12
     GPUDeviceDX12* _device = nullptr;
     ResourceOwnerDX12* _owner = nullptr;
     DescriptorHeapWithSlotsDX12::Slot _srv, _uav;
+    mutable int32 _bindlessIndex = -1;
 
 public:
 
@@ -55,11 +56,7 @@ class GPUBufferViewDX12 : public GPUBufferView, public IShaderResourceDX12
     /// <summary>
     /// Releases the view.
     /// </summary>
-    void Release()
-    {
-        _srv.Release();
-        _uav.Release();
-    }
+    void Release();
 
 public:
 
@@ -83,6 +80,7 @@ class GPUBufferViewDX12 : public GPUBufferView, public IShaderResourceDX12
     {
         return (void*)(IShaderResourceDX12*)this;
     }
+    int32 GetBindlessIndex() const override;
 
     // [IShaderResourceDX12]
     bool IsDepthStencilResource() const override
@@ -40,6 +40,9 @@
 #define DX12_ENABLE_RESOURCE_BARRIERS_BATCHING 1
 #define DX12_ENABLE_RESOURCE_BARRIERS_DEBUGGING 0
 
+// Resource states that cannot be used on compute command lists
+#define DX12_GRAPHICS_ONLY_STATES (D3D12_RESOURCE_STATE_INDEX_BUFFER | D3D12_RESOURCE_STATE_RENDER_TARGET | D3D12_RESOURCE_STATE_DEPTH_WRITE | D3D12_RESOURCE_STATE_DEPTH_READ | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_STREAM_OUT | D3D12_RESOURCE_STATE_RESOLVE_DEST | D3D12_RESOURCE_STATE_RESOLVE_SOURCE)
+
 inline bool operator!=(const D3D12_VERTEX_BUFFER_VIEW& l, const D3D12_VERTEX_BUFFER_VIEW& r)
 {
     return l.SizeInBytes != r.SizeInBytes || l.StrideInBytes != r.StrideInBytes || l.BufferLocation != r.BufferLocation;
@@ -72,7 +75,12 @@ static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartInstance) == OFFSET_OF(
 GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type)
     : GPUContext(device)
     , _device(device)
+    , _queue(type == D3D12_COMMAND_LIST_TYPE_COMPUTE ? device->GetComputeQueue() : type == D3D12_COMMAND_LIST_TYPE_COPY ? device->GetCopyQueue() : device->GetCommandQueue())
+    , _type(type)
     , _commandList(nullptr)
+#if PLATFORM_WINDOWS
+    , _commandList5(nullptr)
+#endif
     , _currentAllocator(nullptr)
     , _currentState(nullptr)
     , _currentCompute(nullptr)
@@ -88,25 +96,64 @@ GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE ty
     , _cbGraphicsDirtyFlag(0)
     , _cbComputeDirtyFlag(0)
     , _samplersDirtyFlag(0)
+    , _shadingRate(ShadingRate::_1x1)
+    , _shadingRateImage(nullptr)
     , _rtDepth(nullptr)
     , _ibHandle(nullptr)
 {
     FrameFenceValues[0] = 0;
     FrameFenceValues[1] = 0;
-    _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+    _currentAllocator = _queue->RequestAllocator();
     VALIDATE_DIRECTX_CALL(device->GetDevice()->CreateCommandList(0, type, _currentAllocator, nullptr, IID_PPV_ARGS(&_commandList)));
 #if GPU_ENABLE_RESOURCE_NAMING
     _commandList->SetName(TEXT("GPUContextDX12::CommandList"));
 #endif
+#if PLATFORM_WINDOWS
+    if (type == D3D12_COMMAND_LIST_TYPE_DIRECT && device->Limits.HasVariableRateShading && FAILED(_commandList->QueryInterface(IID_PPV_ARGS(&_commandList5))))
+        _commandList5 = nullptr;
+#endif
 }
 
 GPUContextDX12::~GPUContextDX12()
 {
+#if PLATFORM_WINDOWS
+    SAFE_RELEASE(_commandList5);
+#endif
     DX_SAFE_RELEASE_CHECK(_commandList, 0);
 }
 
 void GPUContextDX12::AddTransitionBarrier(ResourceOwnerDX12* resource, const D3D12_RESOURCE_STATES before, const D3D12_RESOURCE_STATES after, const int32 subresourceIndex)
 {
+    if (IsAsyncCompute() && (before & DX12_GRAPHICS_ONLY_STATES) != 0)
+    {
+        // Transition from graphics-only state has to be done on the main context (submitted before the async compute work)
+        _device->GetMainContextDX12()->AddTransitionBarrier(resource, before, after, subresourceIndex);
+        return;
+    }
+
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    // Merge with the pending transition of the same subresource (no GPU work is recorded between them)
+    const auto nativeResource = resource->GetResource();
+    for (int32 i = _rbBufferSize - 1; i >= 0; i--)
+    {
+        auto& e = _rbBuffer[i];
+        if (e.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION && e.Transition.pResource == nativeResource && e.Transition.Subresource == (UINT)subresourceIndex && e.Transition.StateAfter == before)
+        {
+            if (e.Transition.StateBefore == after)
+            {
+                // Transition back to the original state so remove it
+                for (int32 j = i + 1; j < _rbBufferSize; j++)
+                    _rbBuffer[j - 1] = _rbBuffer[j];
+                _rbBufferSize--;
+            }
+            else
+            {
+                e.Transition.StateAfter = after;
+            }
+            return;
+        }
+    }
+#endif
     if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
         flushRBs();
 
@@ -137,6 +184,14 @@ void GPUContextDX12::AddTransitionBarrier(ResourceOwnerDX12* resource, const D3D
 
 void GPUContextDX12::AddUAVBarrier()
 {
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    // Global UAV barrier is already pending
+    for (int32 i = 0; i < _rbBufferSize; i++)
+    {
+        if (_rbBuffer[i].Type == D3D12_RESOURCE_BARRIER_TYPE_UAV && _rbBuffer[i].UAV.pResource == nullptr)
+            return;
+    }
+#endif
     if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
         flushRBs();
 
@@ -161,6 +216,28 @@ void GPUContextDX12::SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURC
     auto nativeResource = resource->GetResource();
     if (nativeResource == nullptr)
         return;
+    if (IsCopy())
+    {
+        // Copy queue promotes resources from the common state on first use (and they decay back to it after the copy work is done) so transition them on the main context submitted before
+        // CPU-accessible resources stay in the heap-specific state all the time
+        const auto& state = resource->State;
+        const auto buffer = dynamic_cast<GPUBufferDX12*>(resource);
+        const auto texture = dynamic_cast<GPUTextureDX12*>(resource);
+        const bool cpuAccess = (buffer && (buffer->IsStaging() || buffer->IsDynamic())) || (texture && texture->IsStaging());
+        if (!cpuAccess && (!state.AreAllSubresourcesSame() || state.GetSubresourceState(-1) != D3D12_RESOURCE_STATE_COMMON))
+        {
+            _device->GetMainContextDX12()->SetResourceState(resource, D3D12_RESOURCE_STATE_COMMON);
+            _device->_copyWaitForMain = true;
+        }
+        return;
+    }
+    if (IsAsyncCompute())
+    {
+        // Compute queue can access shader resources only from non-pixel shaders
+        after &= ~DX12_GRAPHICS_ONLY_STATES;
+        if (after == 0)
+            after = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+    }
     auto& state = resource->State;
     if (subresourceIndex == -1)
     {
@@ -219,7 +296,7 @@ void GPUContextDX12::Reset()
     ASSERT(_commandList != nullptr);
     if (_currentAllocator == nullptr)
     {
-        _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+        _currentAllocator = _queue->RequestAllocator();
         _commandList->Reset(_currentAllocator, nullptr);
     }
 
@@ -235,6 +312,8 @@ void GPUContextDX12::Reset()
     _srMaskDirtyCompute = 0;
     _stencilRef = 0;
     _primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+    _shadingRate = ShadingRate::_1x1;
+    _shadingRateImage = nullptr;
     _psDirtyFlag = false;
     _isCompute = false;
     _currentCompute = nullptr;
@@ -255,7 +334,7 @@ void GPUContextDX12::Reset()
 uint64 GPUContextDX12::Execute(bool waitForCompletion)
 {
     ASSERT(_currentAllocator != nullptr);
-    auto queue = _device->GetCommandQueue();
+    auto queue = _queue;
 
     // Flush remaining and buffered commands
     FlushState();
@@ -878,6 +957,29 @@ void GPUContextDX12::SetStencilRef(uint32 value)
     }
 }
 
+void GPUContextDX12::SetShadingRate(ShadingRate rate, GPUTexture* rateImage)
+{
+#if PLATFORM_WINDOWS
+    if (!_commandList5)
+        return;
+    const bool useImage = _device->Limits.HasVariableRateShadingImage;
+    GPUTextureDX12* rateImageDX12 = useImage ? static_cast<GPUTextureDX12*>(rateImage) : nullptr;
+    if (rateImageDX12)
+        SetResourceState(rateImageDX12, D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE);
+    if (_shadingRate != rate || _shadingRateImage != rateImageDX12)
+    {
+        _shadingRate = rate;
+        _shadingRateImage = rateImageDX12;
+
+        // Use the coarser of the base and the image shading rates
+        const D3D12_SHADING_RATE_COMBINER combiners[D3D12_RS_SET_SHADING_RATE_COMBINER_COUNT] = { D3D12_SHADING_RATE_COMBINER_PASSTHROUGH, D3D12_SHADING_RATE_COMBINER_MAX };
+        _commandList5->RSSetShadingRate((D3D12_SHADING_RATE)rate, useImage ? combiners : nullptr);
+        if (useImage)
+            _commandList5->RSSetShadingRateImage(rateImageDX12 ? rateImageDX12->GetResource() : nullptr);
+    }
+#endif
+}
+
 void GPUContextDX12::ResetSR()
 {
     for (int32 slot = 0; slot < GPU_MAX_SR_BINDED; slot++)
@@ -1480,13 +1582,26 @@ void GPUContextDX12::SetResourceState(GPUResource* resource, uint64 state, int32
 
 void GPUContextDX12::ForceRebindDescriptors()
 {
+    if (IsCopy())
+        return;
+
     // Bind Root Signature
-    _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
+    if (!IsAsyncCompute())
+        _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
     _commandList->SetComputeRootSignature(_device->GetRootSignature());
 
     // Bind heaps
     ID3D12DescriptorHeap* ppHeaps[] = { _device->RingHeap_CBV_SRV_UAV.GetHeap(), _device->RingHeap_Sampler.GetHeap() };
     _commandList->SetDescriptorHeaps(ARRAY_COUNT(ppHeaps), ppHeaps);
+
+    // Bind bindless resources table (persistent, stored at the begin of the ring heap)
+    if (_device->BindlessDescriptors.IsEnabled())
+    {
+        const D3D12_GPU_DESCRIPTOR_HANDLE bindless = _device->RingHeap_CBV_SRV_UAV.GPU(0);
+        if (!IsAsyncCompute())
+            _commandList->SetGraphicsRootDescriptorTable(DX12_ROOT_SIGNATURE_BINDLESS, bindless);
+        _commandList->SetComputeRootDescriptorTable(DX12_ROOT_SIGNATURE_BINDLESS, bindless);
+    }
 }
 
 #endif
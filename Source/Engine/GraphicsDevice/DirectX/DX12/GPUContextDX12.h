@@ -10,6 +10,7 @@
 #if GRAPHICS_API_DIRECTX12
 
 class GPUDeviceDX12;
+class CommandQueueDX12;
 class GPUPipelineStateDX12;
 class GPUBufferDX12;
 class GPUSamplerDX12;
@@ -19,7 +20,7 @@ class GPUTextureViewDX12;
 /// <summary>
 /// Size of the resource barriers buffer size (will be flushed on overflow)
 /// </summary>
-#define DX12_RB_BUFFER_SIZE 16
+#define DX12_RB_BUFFER_SIZE 64
 
 /// <summary>
 /// GPU Commands Context implementation for DirectX 12
@@ -35,7 +36,12 @@ class GPUContextDX12 : public GPUContext
 private:
 
     GPUDeviceDX12* _device;
+    CommandQueueDX12* _queue;
+    D3D12_COMMAND_LIST_TYPE _type;
     ID3D12GraphicsCommandList* _commandList;
+#if PLATFORM_WINDOWS
+    ID3D12GraphicsCommandList5* _commandList5;
+#endif
     ID3D12CommandAllocator* _currentAllocator;
     GPUPipelineStateDX12* _currentState;
     GPUShaderProgramCS* _currentCompute;
@@ -49,6 +55,8 @@ class GPUContextDX12 : public GPUContext
     uint32 _srMaskDirtyCompute;
     uint32 _stencilRef;
     D3D_PRIMITIVE_TOPOLOGY _primitiveTopology;
+    ShadingRate _shadingRate;
+    GPUTextureDX12* _shadingRateImage;
 
     int32 _isCompute : 1;
     int32 _rtDirtyFlag : 1;
@@ -81,12 +89,36 @@ class GPUContextDX12 : public GPUContext
         return _commandList;
     }
 
+    /// <summary>
+    /// True if context records commands for the async compute queue (graphics-only resource states are not allowed).
+    /// </summary>
+    FORCE_INLINE bool IsAsyncCompute() const
+    {
+        return _type == D3D12_COMMAND_LIST_TYPE_COMPUTE;
+    }
+
+    /// <summary>
+    /// True if context records commands for the copy queue (only copy commands are allowed, resources are used via implicit promotion from the common state).
+    /// </summary>
+    FORCE_INLINE bool IsCopy() const
+    {
+        return _type == D3D12_COMMAND_LIST_TYPE_COPY;
+    }
+
+    /// <summary>
+    /// Gets the command queue used to execute the recorded commands.
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetQueue() const
+    {
+        return _queue;
+    }
+
     uint64 FrameFenceValues[2];
 
 public:
 
     /// <summary>
-    /// Adds the transition barrier for the given resource (or subresource). Supports batching barriers.
+    /// Adds the transition barrier for the given resource (or subresource). Supports batching barriers (merges with the pending transition of the same subresource).
     /// </summary>
     /// <param name="resource">The resource.</param>
     /// <param name="before">The 'before' state.</param>
@@ -95,7 +127,7 @@ class GPUContextDX12 : public GPUContext
     void AddTransitionBarrier(ResourceOwnerDX12* resource, const D3D12_RESOURCE_STATES before, const D3D12_RESOURCE_STATES after, const int32 subresourceIndex);
 
     /// <summary>
-    /// Adds the UAV barrier. Supports batching barriers.
+    /// Adds the UAV barrier. Supports batching barriers (skipped if there is already a pending UAV barrier).
     /// </summary>
     void AddUAVBarrier();
 
@@ -170,6 +202,7 @@ class GPUContextDX12 : public GPUContext
     void SetRenderTarget(GPUTextureView* depthBuffer, const Span<GPUTextureView*>& rts) override;
     void SetBlendFactor(const Float4& value) override;
     void SetStencilRef(uint32 value) override;
+    void SetShadingRate(ShadingRate rate, GPUTexture* rateImage) override;
     void ResetSR() override;
     void ResetUA() override;
     void ResetCB() override;
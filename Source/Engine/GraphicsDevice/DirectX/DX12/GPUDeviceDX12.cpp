@@ -23,6 +23,7 @@
 #include "Engine/Core/Utilities.h"
 #include "Engine/Threading/Threading.h"
 #include "CommandSignatureDX12.h"
+#include "PipelineLibraryDX12.h"
 
 static bool CheckDX12Support(IDXGIAdapter* adapter)
 {
@@ -226,14 +227,27 @@ GPUDeviceDX12::GPUDeviceDX12(IDXGIFactory4* dxgiFactory, GPUAdapterDX* adapter)
     , _rootSignature(nullptr)
     , _commandQueue(nullptr)
     , _mainContext(nullptr)
+    , _computeQueue(nullptr)
+    , _asyncComputeContext(nullptr)
+    , _asyncComputeRecording(false)
+    , _asyncComputeSubmitted(0)
+    , _asyncComputeWaited(0)
+    , _copyQueue(nullptr)
+    , _copyContext(nullptr)
+    , _copyRecording(false)
+    , _copyWaitForMain(false)
     , UploadBuffer(nullptr)
     , TimestampQueryHeap(this, D3D12_QUERY_HEAP_TYPE_TIMESTAMP, DX12_BACK_BUFFER_COUNT * 1024)
+#if COMPILE_WITH_PROFILER
+    , PipelineStatsQueryHeap(this, D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS, DX12_BACK_BUFFER_COUNT * 256)
+#endif
     , Heap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 4 * 1024, false)
     , Heap_RTV(this, D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 1 * 1024, false)
     , Heap_DSV(this, D3D12_DESCRIPTOR_HEAP_TYPE_DSV, 64, false)
     , Heap_Sampler(this, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, 128, false)
     , RingHeap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 512 * 1024, true)
     , RingHeap_Sampler(this, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, 1 * 1024, true)
+    , BindlessDescriptors(this)
 {
 }
 
@@ -308,6 +322,10 @@ bool GPUDeviceDX12::Init()
     VALIDATE_DIRECTX_CALL(D3D12CreateDevice(adapter, D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&_device)));
 
 #if PLATFORM_WINDOWS
+    // Used to query video memory budget (requires Windows 10)
+    if (FAILED(adapter->QueryInterface(IID_PPV_ARGS(&_adapterDXGI))))
+        _adapterDXGI = nullptr;
+
     // Detect RenderDoc usage (UUID {A7AA6116-9C8D-4BBA-9083-B4D816B71B78})
     IUnknown* unknown = nullptr;
     const GUID uuidRenderDoc = { 0xa7aa6116, 0x9c8d, 0x4bba, { 0x90, 0x83, 0xb4, 0xd8, 0x16, 0xb7, 0x1b, 0x78 } };
@@ -385,6 +403,12 @@ bool GPUDeviceDX12::Init()
     LOG(Info, "Resource Binding Tier: {0}", (int32)options.ResourceBindingTier);
     LOG(Info, "Conservative Rasterization Tier: {0}", (int32)options.ConservativeRasterizationTier);
     LOG(Info, "Resource Heap Tier: {0}", (int32)options.ResourceHeapTier);
+#if PLATFORM_WINDOWS
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    if (FAILED(_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6))))
+        options6.VariableShadingRateTier = D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED;
+    LOG(Info, "Variable Shading Rate Tier: {0}", (int32)options6.VariableShadingRateTier);
+#endif
 
     // Init device limits
     {
@@ -402,6 +426,20 @@ bool GPUDeviceDX12::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = true;
         limits.HasTypedUAVLoad = options.TypedUAVLoadAdditionalFormats != 0;
+        limits.HasAsyncCompute = true;
+        limits.HasCopyQueue = true;
+        limits.HasBindlessResources = options.ResourceBindingTier >= D3D12_RESOURCE_BINDING_TIER_2;
+#if PLATFORM_WINDOWS
+        limits.HasVariableRateShading = options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_1;
+        limits.HasVariableRateShadingImage = options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2;
+        limits.HasVariableRateShadingCoarseRates = limits.HasVariableRateShading && options6.AdditionalShadingRatesSupported;
+        limits.ShadingRateImageTileSize = limits.HasVariableRateShadingImage ? (int32)options6.ShadingRateImageTileSize : 0;
+#else
+        limits.HasVariableRateShading = false;
+        limits.HasVariableRateShadingImage = false;
+        limits.HasVariableRateShadingCoarseRates = false;
+        limits.ShadingRateImageTileSize = 0;
+#endif
         limits.MaximumMipLevelsCount = D3D12_REQ_MIP_LEVELS;
         limits.MaximumTexture1DSize = D3D12_REQ_TEXTURE1D_U_DIMENSION;
         limits.MaximumTexture1DArraySize = D3D12_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -436,7 +474,15 @@ bool GPUDeviceDX12::Init()
     if (_commandQueue->Init())
         return true;
     _mainContext = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_DIRECT);
-    if (RingHeap_CBV_SRV_UAV.Init())
+    _computeQueue = New<CommandQueueDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    if (_computeQueue->Init())
+        return true;
+    _asyncComputeContext = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    _copyQueue = New<CommandQueueDX12>(this, D3D12_COMMAND_LIST_TYPE_COPY);
+    if (_copyQueue->Init())
+        return true;
+    _copyContext = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_COPY);
+    if (RingHeap_CBV_SRV_UAV.Init(Limits.HasBindlessResources ? DX12_BINDLESS_SRV_COUNT : 0))
         return true;
     if (RingHeap_Sampler.Init())
         return true;
@@ -514,6 +560,8 @@ bool GPUDeviceDX12::Init()
         uavDesc.Texture2D.PlaneSlice = 0;
         _nullUav.CreateUAV(this, nullptr, &uavDesc);
     }
+    if (Limits.HasBindlessResources)
+        BindlessDescriptors.Init(DX12_BINDLESS_SRV_COUNT);
 
     // Create root signature
     // TODO: maybe create set of different root signatures? for UAVs, for compute, for simple drawing, for post fx?
@@ -545,8 +593,20 @@ bool GPUDeviceDX12::Init()
             range.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
         }
 
+        // Bindless resources table (the same descriptors aliased as Texture2D, Texture3D, TextureCube and Buffer arrays in separate register spaces, see Bindless.hlsl)
+        D3D12_DESCRIPTOR_RANGE bindlessRanges[4];
+        for (int32 i = 0; i < ARRAY_COUNT(bindlessRanges); i++)
+        {
+            D3D12_DESCRIPTOR_RANGE& range = bindlessRanges[i];
+            range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+            range.NumDescriptors = DX12_BINDLESS_SRV_COUNT;
+            range.BaseShaderRegister = 0;
+            range.RegisterSpace = i + 1;
+            range.OffsetInDescriptorsFromTableStart = 0;
+        }
+
         // Root parameters
-        D3D12_ROOT_PARAMETER rootParameters[GPU_MAX_CB_BINDED + 3];
+        D3D12_ROOT_PARAMETER rootParameters[GPU_MAX_CB_BINDED + 4];
         for (int32 i = 0; i < GPU_MAX_CB_BINDED; i++)
         {
             // CB
@@ -580,6 +640,14 @@ bool GPUDeviceDX12::Init()
             rootParam.DescriptorTable.NumDescriptorRanges = 1;
             rootParam.DescriptorTable.pDescriptorRanges = &r[2];
         }
+        {
+            // Bindless SRVs
+            D3D12_ROOT_PARAMETER& rootParam = rootParameters[DX12_ROOT_SIGNATURE_BINDLESS];
+            rootParam.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+            rootParam.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+            rootParam.DescriptorTable.NumDescriptorRanges = ARRAY_COUNT(bindlessRanges);
+            rootParam.DescriptorTable.pDescriptorRanges = bindlessRanges;
+        }
 
         // Static samplers
         D3D12_STATIC_SAMPLER_DESC staticSamplers[6];
@@ -667,7 +735,7 @@ bool GPUDeviceDX12::Init()
 
         // Init
         D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc;
-        rootSignatureDesc.NumParameters = ARRAY_COUNT(rootParameters);
+        rootSignatureDesc.NumParameters = BindlessDescriptors.IsEnabled() ? ARRAY_COUNT(rootParameters) : ARRAY_COUNT(rootParameters) - 1;
         rootSignatureDesc.pParameters = rootParameters;
         rootSignatureDesc.NumStaticSamplers = ARRAY_COUNT(staticSamplers);
         rootSignatureDesc.pStaticSamplers = staticSamplers;
@@ -685,6 +753,10 @@ bool GPUDeviceDX12::Init()
     // Upload buffer
     UploadBuffer = New<UploadBufferDX12>(this);
 
+    // Pipeline states cache
+    PipelineLibrary = New<PipelineLibraryDX12>(this);
+    PipelineLibrary->Init();
+
     if (TimestampQueryHeap.Init())
         return true;
 
@@ -729,8 +801,16 @@ void GPUDeviceDX12::RenderEnd()
     // Base
     GPUDeviceDX::RenderEnd();
 
+    // Ensure that frame end waits for all async compute work (resources used by it are released based on the main context frame fence)
+    SubmitAsyncCompute();
+    WaitForAsyncCompute(_asyncComputeSubmitted, false);
+
     // Resolve the timestamp queries
     TimestampQueryHeap.EndQueryBatchAndResolveQueryData(_mainContext);
+#if COMPILE_WITH_PROFILER
+    if (PipelineStatsQueryHeapReady)
+        PipelineStatsQueryHeap.EndQueryBatchAndResolveQueryData(_mainContext);
+#endif
 }
 
 GPUDeviceDX12::~GPUDeviceDX12()
@@ -759,6 +839,93 @@ ID3D12CommandQueue* GPUDeviceDX12::GetCommandQueueDX12() const
     return _commandQueue->GetCommandQueue();
 }
 
+bool GPUDeviceDX12::QueryMemoryBudget(uint64& budget, uint64& usage) const
+{
+#if PLATFORM_WINDOWS
+    DXGI_QUERY_VIDEO_MEMORY_INFO info;
+    if (_adapterDXGI && SUCCEEDED(_adapterDXGI->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &info)))
+    {
+        budget = info.Budget;
+        usage = info.CurrentUsage;
+        return false;
+    }
+#endif
+    return true;
+}
+
+GPUContext* GPUDeviceDX12::GetAsyncComputeContext()
+{
+    if (!_asyncComputeRecording)
+    {
+        _asyncComputeRecording = true;
+        _asyncComputeContext->Reset();
+    }
+    return _asyncComputeContext;
+}
+
+uint64 GPUDeviceDX12::SubmitAsyncCompute()
+{
+    if (!_asyncComputeRecording)
+        return 0;
+    _asyncComputeRecording = false;
+    PROFILE_CPU();
+
+    // Submit the main context work recorded so far (including transitions of the resources used by compute from graphics-only states)
+    const uint64 mainFenceValue = _mainContext->Execute(false);
+    _mainContext->Reset();
+
+    // Execute async compute after it
+    _commandQueue->_fence.WaitGPU(_computeQueue, mainFenceValue);
+    _asyncComputeSubmitted = _asyncComputeContext->Execute(false);
+    return _asyncComputeSubmitted;
+}
+
+void GPUDeviceDX12::WaitForAsyncCompute(uint64 syncPoint, bool submit)
+{
+    if (syncPoint <= _asyncComputeWaited)
+        return;
+    if (submit)
+    {
+        // Submit work recorded so far to let it overlap with the async compute
+        _mainContext->Execute(false);
+        _mainContext->Reset();
+    }
+    _computeQueue->_fence.WaitGPU(_commandQueue, syncPoint);
+    _asyncComputeWaited = syncPoint;
+}
+
+GPUContext* GPUDeviceDX12::GetCopyContext()
+{
+    if (!_copyRecording)
+    {
+        _copyRecording = true;
+        _copyContext->Reset();
+    }
+    return _copyContext;
+}
+
+uint64 GPUDeviceDX12::SubmitCopy()
+{
+    if (!_copyRecording)
+        return 0;
+    _copyRecording = false;
+    PROFILE_CPU();
+
+    if (_copyWaitForMain)
+    {
+        // Submit the main context transitions of the copied resources into the common state
+        _copyWaitForMain = false;
+        const uint64 mainFenceValue = _mainContext->Execute(false);
+        _mainContext->Reset();
+        _commandQueue->_fence.WaitGPU(_copyQueue, mainFenceValue);
+    }
+
+    // Execute copies and make the graphics work submitted from now on wait for them (doesn't block the work submitted so far)
+    const uint64 copyFenceValue = _copyContext->Execute(false);
+    _copyQueue->_fence.WaitGPU(_commandQueue, copyFenceValue);
+    return copyFenceValue;
+}
+
 void GPUDeviceDX12::Dispose()
 {
     GPUDeviceLock lock(this);
@@ -784,20 +951,34 @@ void GPUDeviceDX12::Dispose()
         srv.Release();
     _nullUav.Release();
     TimestampQueryHeap.Destroy();
+#if COMPILE_WITH_PROFILER
+    PipelineStatsQueryHeap.Destroy();
+#endif
     DX_SAFE_RELEASE_CHECK(_rootSignature, 0);
     Heap_CBV_SRV_UAV.ReleaseGPU();
     Heap_RTV.ReleaseGPU();
     Heap_DSV.ReleaseGPU();
     Heap_Sampler.ReleaseGPU();
+    BindlessDescriptors.Dispose();
     RingHeap_CBV_SRV_UAV.ReleaseGPU();
     RingHeap_Sampler.ReleaseGPU();
     SAFE_DELETE(UploadBuffer);
     SAFE_DELETE(DrawIndirectCommandSignature);
+    if (PipelineLibrary)
+        PipelineLibrary->Dispose();
+    SAFE_DELETE(PipelineLibrary);
+    SAFE_DELETE(_asyncComputeContext);
+    SAFE_DELETE(_computeQueue);
+    SAFE_DELETE(_copyContext);
+    SAFE_DELETE(_copyQueue);
     SAFE_DELETE(_mainContext);
     SAFE_DELETE(_commandQueue);
 
     // Clear DirectX stuff
     SAFE_DELETE(_adapter);
+#if PLATFORM_WINDOWS
+    SAFE_RELEASE(_adapterDXGI);
+#endif
     SAFE_RELEASE(_device);
     SAFE_RELEASE(_factoryDXGI);
 
@@ -810,6 +991,10 @@ void GPUDeviceDX12::Dispose()
 
 void GPUDeviceDX12::WaitForGPU()
 {
+    if (_computeQueue)
+        _computeQueue->WaitForGPU();
+    if (_copyQueue)
+        _copyQueue->WaitForGPU();
     _commandQueue->WaitForGPU();
 }
 
@@ -21,6 +21,10 @@
 #define DX12_ROOT_SIGNATURE_SR (GPU_MAX_CB_BINDED+0)
 #define DX12_ROOT_SIGNATURE_UA (GPU_MAX_CB_BINDED+1)
 #define DX12_ROOT_SIGNATURE_SAMPLER (GPU_MAX_CB_BINDED+2)
+#define DX12_ROOT_SIGNATURE_BINDLESS (GPU_MAX_CB_BINDED+3)
+
+// Maximum amount of the shader resource views accessible via bindless resources tables
+#define DX12_BINDLESS_SRV_COUNT (64 * 1024)
 
 class Engine;
 class WindowsWindow;
@@ -29,6 +33,7 @@ class GPUSwapChainDX12;
 class UploadBufferDX12;
 class CommandQueueDX12;
 class CommandSignatureDX12;
+class PipelineLibraryDX12;
 
 /// <summary>
 /// Implementation of Graphics Device for DirectX 12 rendering system
@@ -51,6 +56,9 @@ class GPUDeviceDX12 : public GPUDeviceDX
     // Private Stuff
     ID3D12Device* _device;
     IDXGIFactory4* _factoryDXGI;
+#if PLATFORM_WINDOWS
+    IDXGIAdapter3* _adapterDXGI = nullptr;
+#endif
     CriticalSection _res2DisposeLock;
     Array<DisposeResourceEntry> _res2Dispose;
 
@@ -58,6 +66,15 @@ class GPUDeviceDX12 : public GPUDeviceDX
     ID3D12RootSignature* _rootSignature;
     CommandQueueDX12* _commandQueue;
     GPUContextDX12* _mainContext;
+    CommandQueueDX12* _computeQueue;
+    GPUContextDX12* _asyncComputeContext;
+    bool _asyncComputeRecording;
+    uint64 _asyncComputeSubmitted;
+    uint64 _asyncComputeWaited;
+    CommandQueueDX12* _copyQueue;
+    GPUContextDX12* _copyContext;
+    bool _copyRecording;
+    bool _copyWaitForMain;
 
     // Heaps
     DescriptorHeapWithSlotsDX12::Slot _nullSrv[D3D12_SRV_DIMENSION_TEXTURECUBEARRAY + 1];
@@ -81,11 +98,24 @@ class GPUDeviceDX12 : public GPUDeviceDX
     /// </summary>
     QueryHeapDX12 TimestampQueryHeap;
 
+#if COMPILE_WITH_PROFILER
+    /// <summary>
+    /// The pipeline statistics queries heap (initialized on first use).
+    /// </summary>
+    QueryHeapDX12 PipelineStatsQueryHeap;
+    bool PipelineStatsQueryHeapReady = false;
+#endif
+
     bool AllowTearing = false;
     CommandSignatureDX12* DispatchIndirectCommandSignature = nullptr;
     CommandSignatureDX12* DrawIndexedIndirectCommandSignature = nullptr;
     CommandSignatureDX12* DrawIndirectCommandSignature = nullptr;
 
+    /// <summary>
+    /// The persistent cache of the compiled graphics pipeline states.
+    /// </summary>
+    PipelineLibraryDX12* PipelineLibrary = nullptr;
+
     D3D12_CPU_DESCRIPTOR_HANDLE NullSRV(D3D12_SRV_DIMENSION dimension) const;
     D3D12_CPU_DESCRIPTOR_HANDLE NullUAV() const;
 
@@ -125,6 +155,22 @@ class GPUDeviceDX12 : public GPUDeviceDX
     /// </summary>
     ID3D12CommandQueue* GetCommandQueueDX12() const;
 
+    /// <summary>
+    /// Gets async compute command queue.
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetComputeQueue() const
+    {
+        return _computeQueue;
+    }
+
+    /// <summary>
+    /// Gets copy command queue.
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetCopyQueue() const
+    {
+        return _copyQueue;
+    }
+
     /// <summary>
     /// Gets root signature of the graphics pipeline.
     /// </summary>
@@ -149,6 +195,7 @@ class GPUDeviceDX12 : public GPUDeviceDX
     DescriptorHeapPoolDX12 Heap_Sampler;
     DescriptorHeapRingBufferDX12 RingHeap_CBV_SRV_UAV;
     DescriptorHeapRingBufferDX12 RingHeap_Sampler;
+    BindlessDescriptorsDX12 BindlessDescriptors;
 
 public:
 
@@ -181,10 +228,16 @@ class GPUDeviceDX12 : public GPUDeviceDX
     {
         return reinterpret_cast<GPUContext*>(_mainContext);
     }
+    GPUContext* GetAsyncComputeContext() override;
+    uint64 SubmitAsyncCompute() override;
+    void WaitForAsyncCompute(uint64 syncPoint, bool submit = true) override;
+    GPUContext* GetCopyContext() override;
+    uint64 SubmitCopy() override;
     void* GetNativePtr() const override
     {
         return _device;
     }
+    bool QueryMemoryBudget(uint64& budget, uint64& usage) const override;
     bool Init() override;
     void DrawBegin() override;
     void RenderEnd() override;
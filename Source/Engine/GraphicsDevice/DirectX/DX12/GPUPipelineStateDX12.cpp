@@ -5,7 +5,10 @@
 #include "GPUPipelineStateDX12.h"
 #include "GPUShaderProgramDX12.h"
 #include "GPUTextureDX12.h"
+#include "PipelineLibraryDX12.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 
@@ -34,6 +37,40 @@ static D3D12_STENCIL_OP ToStencilOp(StencilOperation value)
     };
 }
 
+static void SetupDesc(D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const GPUPipelineStateKeyDX12& key)
+{
+    desc.NumRenderTargets = key.RTsCount;
+    for (int32 i = 0; i < GPU_MAX_RT_BINDED; i++)
+        desc.RTVFormats[i] = RenderToolsDX::ToDxgiFormat(key.RTVsFormats[i]);
+    desc.SampleDesc.Count = static_cast<UINT>(key.MSAA);
+    desc.SampleDesc.Quality = key.MSAA == MSAALevel::None ? 0 : GPUDeviceDX12::GetMaxMSAAQuality((int32)key.MSAA);
+    desc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
+    desc.DSVFormat = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(key.DepthFormat));
+}
+
+static uint32 HashDesc(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+{
+    uint32 hash = 0;
+#define HASH_SHADER(stage) if (desc.stage.pShaderBytecode) hash = Crc::MemCrc32(desc.stage.pShaderBytecode, (int32)desc.stage.BytecodeLength, hash)
+    HASH_SHADER(VS);
+    HASH_SHADER(PS);
+    HASH_SHADER(HS);
+    HASH_SHADER(DS);
+    HASH_SHADER(GS);
+#undef HASH_SHADER
+    for (UINT i = 0; i < desc.InputLayout.NumElements; i++)
+    {
+        const D3D12_INPUT_ELEMENT_DESC& e = desc.InputLayout.pInputElementDescs[i];
+        hash = Crc::MemCrc32(e.SemanticName, StringUtils::Length(e.SemanticName), hash);
+        hash = Crc::MemCrc32(&e.SemanticIndex, sizeof(D3D12_INPUT_ELEMENT_DESC) - offsetof(D3D12_INPUT_ELEMENT_DESC, SemanticIndex), hash);
+    }
+    hash = Crc::MemCrc32(&desc.BlendState, sizeof(desc.BlendState), hash);
+    hash = Crc::MemCrc32(&desc.RasterizerState, sizeof(desc.RasterizerState), hash);
+    hash = Crc::MemCrc32(&desc.DepthStencilState, sizeof(desc.DepthStencilState), hash);
+    hash = Crc::MemCrc32(&desc.PrimitiveTopologyType, sizeof(desc.PrimitiveTopologyType), hash);
+    return hash;
+}
+
 GPUPipelineStateDX12::GPUPipelineStateDX12(GPUDeviceDX12* device)
     : GPUResourceDX12(device, StringView::Empty)
     , _states(16)
@@ -50,6 +87,10 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     // Validate
     ASSERT(depth || rtCount);
 
+    // Pick pipelines precompiled in the background
+    if (_precompileKeys.HasItems() && Platform::AtomicRead(&_precompileRemaining) == 0)
+        FlushPrecompiled();
+
     // Prepare key
     GPUPipelineStateKeyDX12 key;
     key.RTsCount = rtCount;
@@ -75,19 +116,13 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
 
     PROFILE_CPU_NAMED("Create Pipeline State");
 
-    // Update description to match the pipeline
-    _desc.NumRenderTargets = key.RTsCount;
-    for (int32 i = 0; i < GPU_MAX_RT_BINDED; i++)
-        _desc.RTVFormats[i] = RenderToolsDX::ToDxgiFormat(key.RTVsFormats[i]);
-    _desc.SampleDesc.Count = static_cast<UINT>(key.MSAA);
-    _desc.SampleDesc.Quality = key.MSAA == MSAALevel::None ? 0 : GPUDeviceDX12::GetMaxMSAAQuality((int32)key.MSAA);
-    _desc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
-    _desc.DSVFormat = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(key.DepthFormat));
+    // Update description to match the pipeline (copy since background jobs can read the description)
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = _desc;
+    SetupDesc(desc, key);
 
-    // Create object
-    const HRESULT result = _device->GetDevice()->CreateGraphicsPipelineState(&_desc, IID_PPV_ARGS(&state));
-    LOG_DIRECTX_RESULT(result);
-    if (FAILED(result))
+    // Create object (load from pipeline library or compile)
+    state = _device->PipelineLibrary->GetState(_descHash, key, desc);
+    if (!state)
         return nullptr;
 #if GPU_ENABLE_RESOURCE_NAMING && BUILD_DEBUG
     Array<char, InlinedAllocation<200>> name;
@@ -128,8 +163,39 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     return state;
 }
 
+void GPUPipelineStateDX12::PrecompileJob(int32 index)
+{
+    PROFILE_CPU_NAMED("Precompile Pipeline State");
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = _desc;
+    SetupDesc(desc, _precompileKeys[index]);
+    _precompileStates[index] = _device->PipelineLibrary->GetState(_descHash, _precompileKeys[index], desc);
+    Platform::InterlockedDecrement(&_precompileRemaining);
+}
+
+void GPUPipelineStateDX12::FlushPrecompiled()
+{
+    for (int32 i = 0; i < _precompileKeys.Count(); i++)
+    {
+        ID3D12PipelineState* state = _precompileStates[i];
+        if (!state)
+            continue;
+        if (_states.ContainsKey(_precompileKeys[i]))
+            _device->AddResourceToLateRelease(state); // Already created on demand
+        else
+            _states.Add(_precompileKeys[i], state);
+    }
+    _precompileKeys.Clear();
+    _precompileStates.Clear();
+}
+
 void GPUPipelineStateDX12::OnReleaseGPU()
 {
+    if (_precompileKeys.HasItems())
+    {
+        if (Platform::AtomicRead(&_precompileRemaining) != 0)
+            JobSystem::Wait(_precompileLabel);
+        FlushPrecompiled();
+    }
     for (auto i = _states.Begin(); i.IsNotEnd(); ++i)
     {
         _device->AddResourceToLateRelease(i->Value);
@@ -253,6 +319,19 @@ bool GPUPipelineStateDX12::Init(const Description& desc)
 
     // Cache description
     _desc = psDesc;
+    _descHash = HashDesc(psDesc);
+
+    // Compile pipeline variants used in the previous sessions to reduce hitches on first use
+    _device->PipelineLibrary->GetKeys(_descHash, _precompileKeys);
+    if (_precompileKeys.HasItems())
+    {
+        _precompileStates.Resize(_precompileKeys.Count());
+        _precompileStates.SetAll(nullptr);
+        _precompileRemaining = _precompileKeys.Count();
+        Function<void(int32)> func;
+        func.Bind<GPUPipelineStateDX12, &GPUPipelineStateDX12::PrecompileJob>(this);
+        _precompileLabel = JobSystem::Dispatch(func, _precompileKeys.Count(), JobPriority::Background);
+    }
 
     // Set non-zero memory usage
     _memoryUsage = sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC);
@@ -49,6 +49,13 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
 
     Dictionary<GPUPipelineStateKeyDX12, ID3D12PipelineState*> _states;
     D3D12_GRAPHICS_PIPELINE_STATE_DESC _desc;
+    uint32 _descHash = 0;
+
+    // Background compilation of the pipeline variants used in the previous sessions
+    Array<GPUPipelineStateKeyDX12> _precompileKeys;
+    Array<ID3D12PipelineState*> _precompileStates;
+    int64 _precompileLabel = 0;
+    volatile int64 _precompileRemaining = 0;
 
 public:
 
@@ -74,6 +81,11 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
     bool IsValid() const override;
     bool Init(const Description& desc) override;
 
+private:
+
+    void PrecompileJob(int32 index);
+    void FlushPrecompiled();
+
 protected:
 
     // [GPUResourceDX12]
@@ -236,6 +236,11 @@ void GPUTextureDX12::OnReleaseGPU()
 
 void GPUTextureViewDX12::Release()
 {
+    if (_bindlessIndex != -1)
+    {
+        _device->BindlessDescriptors.Release(_bindlessIndex);
+        _bindlessIndex = -1;
+    }
     _rtv.Release();
     _srv.Release();
     _dsv.Release();
@@ -251,6 +256,12 @@ void GPUTextureViewDX12::SetSRV(D3D12_SHADER_RESOURCE_VIEW_DESC& srvDesc)
 {
     SrvDimension = srvDesc.ViewDimension;
     _srv.CreateSRV(_device, _owner->GetResource(), &srvDesc);
+    if (_bindlessIndex != -1)
+    {
+        // Bindless descriptor could be still in use by GPU so allocate a new one on the next use
+        _device->BindlessDescriptors.Release(_bindlessIndex);
+        _bindlessIndex = -1;
+    }
 }
 
 void GPUTextureViewDX12::SetDSV(D3D12_DEPTH_STENCIL_VIEW_DESC& dsvDesc)
@@ -258,6 +269,13 @@ void GPUTextureViewDX12::SetDSV(D3D12_DEPTH_STENCIL_VIEW_DESC& dsvDesc)
     _dsv.CreateDSV(_device, _owner->GetResource(), &dsvDesc);
 }
 
+int32 GPUTextureViewDX12::GetBindlessIndex() const
+{
+    if (_bindlessIndex == -1 && _srv.IsValid())
+        _bindlessIndex = _device->BindlessDescriptors.Allocate(_srv.CPU());
+    return _bindlessIndex;
+}
+
 void GPUTextureViewDX12::SetUAV(D3D12_UNORDERED_ACCESS_VIEW_DESC& uavDesc, ID3D12Resource* counterResource)
 {
     UavDimension = uavDesc.ViewDimension;
@@ -19,6 +19,7 @@ class GPUTextureViewDX12 : public GPUTextureView, public IShaderResourceDX12
     GPUDeviceDX12* _device = nullptr;
     ResourceOwnerDX12* _owner = nullptr;
     DescriptorHeapWithSlotsDX12::Slot _rtv, _srv, _dsv, _uav;
+    mutable int32 _bindlessIndex = -1;
 
 public:
 
@@ -104,6 +105,7 @@ class GPUTextureViewDX12 : public GPUTextureView, public IShaderResourceDX12
     {
         return (void*)(IShaderResourceDX12*)this;
     }
+    int32 GetBindlessIndex() const override;
 
     // [IShaderResourceDX12]
     bool IsDepthStencilResource() const override
@@ -14,6 +14,7 @@ void GPUTimerQueryDX12::OnReleaseGPU()
 {
     _hasResult = false;
     _endCalled = false;
+    _statsActive = false;
     _timeDelta = 0.0f;
 }
 
@@ -23,6 +24,21 @@ void GPUTimerQueryDX12::Begin()
     auto& heap = _device->TimestampQueryHeap;
     heap.EndQuery(context, _begin);
 
+    // Pipeline statistics heap is created on demand
+    _statsActive = false;
+#if COMPILE_WITH_PROFILER
+    if (CollectPipelineStats)
+    {
+        if (!_device->PipelineStatsQueryHeapReady)
+            _device->PipelineStatsQueryHeapReady = !_device->PipelineStatsQueryHeap.Init();
+        if (_device->PipelineStatsQueryHeapReady)
+        {
+            _device->PipelineStatsQueryHeap.BeginQuery(context, _stats);
+            _statsActive = true;
+        }
+    }
+#endif
+
     _hasResult = false;
     _endCalled = false;
 }
@@ -34,6 +50,10 @@ void GPUTimerQueryDX12::End()
 
     const auto context = _device->GetMainContextDX12();
     auto& heap = _device->TimestampQueryHeap;
+#if COMPILE_WITH_PROFILER
+    if (_statsActive)
+        _device->PipelineStatsQueryHeap.EndBegunQuery(context, _stats);
+#endif
     heap.EndQuery(context, _end);
 
     const auto queue = _device->GetCommandQueue()->GetCommandQueue();
@@ -50,6 +70,10 @@ bool GPUTimerQueryDX12::HasResult()
         return true;
 
     auto& heap = _device->TimestampQueryHeap;
+#if COMPILE_WITH_PROFILER
+    if (_statsActive && !_device->PipelineStatsQueryHeap.IsReady(_stats))
+        return false;
+#endif
     return heap.IsReady(_end) && heap.IsReady(_begin);
 }
 
@@ -79,4 +103,22 @@ float GPUTimerQueryDX12::GetResult()
     return _timeDelta;
 }
 
+#if COMPILE_WITH_PROFILER
+
+bool GPUTimerQueryDX12::GetPipelineStats(GPUPipelineStats& result)
+{
+    if (!_statsActive || !_endCalled)
+        return false;
+    const auto& data = *(const D3D12_QUERY_DATA_PIPELINE_STATISTICS*)_device->PipelineStatsQueryHeap.ResolveQuery(_stats);
+    result.InputVertices = data.IAVertices;
+    result.InputPrimitives = data.IAPrimitives;
+    result.VertexShaderInvocations = data.VSInvocations;
+    result.RasterizedPrimitives = data.CPrimitives;
+    result.PixelShaderInvocations = data.PSInvocations;
+    result.ComputeShaderInvocations = data.CSInvocations;
+    return true;
+}
+
+#endif
+
 #endif
@@ -16,10 +16,12 @@ class GPUTimerQueryDX12 : public GPUResourceDX12<GPUTimerQuery>
 
     bool _hasResult = false;
     bool _endCalled = false;
+    bool _statsActive = false;
     float _timeDelta = 0.0f;
     uint64 _gpuFrequency = 0;
     QueryHeapDX12::ElementHandle _begin;
     QueryHeapDX12::ElementHandle _end;
+    QueryHeapDX12::ElementHandle _stats;
 
 public:
 
@@ -36,6 +38,9 @@ class GPUTimerQueryDX12 : public GPUResourceDX12<GPUTimerQuery>
     void End() override;
     bool HasResult() override;
     float GetResult() override;
+#if COMPILE_WITH_PROFILER
+    bool GetPipelineStats(GPUPipelineStats& result) override;
+#endif
 
 protected:
 
@@ -0,0 +1,203 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "PipelineLibraryDX12.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Utilities/Crc.h"
+
+// Increment to invalidate the cache files (eg. when changing the file format or the pipeline state key layout)
+#define DX12_PIPELINE_LIBRARY_VERSION 1
+
+namespace
+{
+    void GetCachePath(String& path)
+    {
+#if USE_EDITOR
+        path = Globals::ProjectCacheFolder / TEXT("DirectX12Pipeline.cache");
+#else
+        path = Globals::ProductLocalFolder / TEXT("DirectX12Pipeline.cache");
+#endif
+    }
+
+    bool ReadCache(const Array<byte>& fileData, Dictionary<uint32, Array<GPUPipelineStateKeyDX12>>& keys, Array<byte>& data)
+    {
+        MemoryReadStream stream(fileData);
+#define CHECK_SIZE(size) if (stream.GetLength() - stream.GetPosition() < (uint32)(size)) return true
+        uint32 version, crc;
+        int32 count;
+        CHECK_SIZE(sizeof(uint32) * 2 + sizeof(int32));
+        stream.ReadUint32(&version);
+        stream.ReadUint32(&crc);
+        if (version != DX12_PIPELINE_LIBRARY_VERSION || crc != Crc::MemCrc32(stream.GetPositionHandle(), stream.GetLength() - stream.GetPosition()))
+            return true;
+        stream.ReadInt32(&count);
+        for (int32 i = 0; i < count; i++)
+        {
+            uint32 descHash;
+            int32 keysCount;
+            CHECK_SIZE(sizeof(uint32) + sizeof(int32));
+            stream.ReadUint32(&descHash);
+            stream.ReadInt32(&keysCount);
+            CHECK_SIZE(keysCount * sizeof(GPUPipelineStateKeyDX12));
+            auto& e = keys[descHash];
+            e.Resize(keysCount, false);
+            stream.ReadBytes(e.Get(), keysCount * sizeof(GPUPipelineStateKeyDX12));
+        }
+        CHECK_SIZE(sizeof(int32));
+        stream.ReadInt32(&count);
+        CHECK_SIZE(count);
+        data.Resize(count, false);
+        stream.ReadBytes(data.Get(), count);
+#undef CHECK_SIZE
+        return false;
+    }
+}
+
+PipelineLibraryDX12::PipelineLibraryDX12(GPUDeviceDX12* device)
+    : _device(device)
+{
+}
+
+void PipelineLibraryDX12::Init()
+{
+    String path;
+    GetCachePath(path);
+    if (FileSystem::FileExists(path))
+    {
+        LOG(Info, "Trying to load DirectX 12 pipeline cache file {0}", path);
+        Array<byte> fileData;
+        if (File::ReadAllBytes(path, fileData) || ReadCache(fileData, _keys, _data))
+        {
+            LOG(Warning, "Invalid DirectX 12 pipeline cache file.");
+            _keys.Clear();
+            _data.Clear();
+        }
+    }
+
+#if PLATFORM_WINDOWS
+    // Pipeline library requires Windows 10 Anniversary Update
+    ComPtr<ID3D12Device1> device1;
+    if (SUCCEEDED(_device->GetDevice()->QueryInterface(IID_PPV_ARGS(&device1))))
+    {
+        HRESULT result = device1->CreatePipelineLibrary(_data.Get(), _data.Count(), IID_PPV_ARGS(&_library));
+        if (FAILED(result) && _data.HasItems())
+        {
+            // Library created with a different driver or adapter so start from scratch
+            LOG(Info, "DirectX 12 pipeline cache is outdated ({0}).", RenderToolsDX::GetD3DErrorString(result));
+            _data.Clear();
+            result = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&_library));
+        }
+        if (FAILED(result))
+        {
+            LOG(Warning, "Failed to create DirectX 12 pipeline library ({0}).", RenderToolsDX::GetD3DErrorString(result));
+            _library = nullptr;
+        }
+    }
+#endif
+}
+
+void PipelineLibraryDX12::Dispose()
+{
+    ScopeLock lock(_locker);
+    if (_modified)
+    {
+        PROFILE_CPU_NAMED("Save Pipeline Cache");
+        MemoryWriteStream stream(1024);
+        stream.WriteUint32(DX12_PIPELINE_LIBRARY_VERSION);
+        stream.WriteUint32(0); // CRC
+        stream.WriteInt32(_keys.Count());
+        for (const auto& e : _keys)
+        {
+            stream.WriteUint32(e.Key);
+            stream.WriteInt32(e.Value.Count());
+            stream.WriteBytes(e.Value.Get(), e.Value.Count() * sizeof(GPUPipelineStateKeyDX12));
+        }
+        Array<byte> library;
+#if PLATFORM_WINDOWS
+        if (_library)
+        {
+            library.Resize((int32)_library->GetSerializedSize());
+            if (FAILED(_library->Serialize(library.Get(), library.Count())))
+                library.Clear();
+        }
+#endif
+        stream.WriteInt32(library.Count());
+        stream.WriteBytes(library.Get(), library.Count());
+        const uint32 headerSize = sizeof(uint32) * 2;
+        *(uint32*)(stream.GetHandle() + sizeof(uint32)) = Crc::MemCrc32(stream.GetHandle() + headerSize, stream.GetPosition() - headerSize);
+        String path;
+        GetCachePath(path);
+        if (File::WriteAllBytes(path, stream.GetHandle(), stream.GetPosition()))
+        {
+            LOG(Warning, "Failed to save DirectX 12 pipeline cache file {0}", path);
+        }
+        _modified = false;
+    }
+#if PLATFORM_WINDOWS
+    SAFE_RELEASE(_library);
+#endif
+    _keys.Clear();
+    _data.Resize(0);
+}
+
+void PipelineLibraryDX12::GetKeys(uint32 descHash, Array<GPUPipelineStateKeyDX12>& result)
+{
+    ScopeLock lock(_locker);
+    const auto* keys = _keys.TryGet(descHash);
+    if (keys)
+        result = *keys;
+    else
+        result.Clear();
+}
+
+ID3D12PipelineState* PipelineLibraryDX12::GetState(uint32 descHash, const GPUPipelineStateKeyDX12& key, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+{
+    ID3D12PipelineState* state = nullptr;
+#if PLATFORM_WINDOWS
+    Char name[20];
+    if (_library)
+    {
+        // Unique name of the pipeline in the library
+        const String nameStr = String::Format(TEXT("{0:x}{1:x}"), descHash, Crc::MemCrc32(&key, sizeof(key)));
+        Platform::MemoryCopy(name, nameStr.Get(), (nameStr.Length() + 1) * sizeof(Char));
+
+        // Try to load precompiled pipeline (concurrent loads of the same pipeline need to be synchronized)
+        ScopeLock lock(_locker);
+        if (SUCCEEDED(_library->LoadGraphicsPipeline(name, &desc, IID_PPV_ARGS(&state))))
+            return state;
+    }
+#endif
+
+    // Compile pipeline
+    const HRESULT result = _device->GetDevice()->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&state));
+    LOG_DIRECTX_RESULT(result);
+    if (FAILED(result))
+        return nullptr;
+
+    ScopeLock lock(_locker);
+#if PLATFORM_WINDOWS
+    // Store in the library (fails if other thread compiled it in the meantime)
+    if (_library && SUCCEEDED(_library->StorePipeline(name, state)))
+        _modified = true;
+#endif
+
+    // Record the pipeline variant to precompile it in the next sessions
+    auto& keys = _keys[descHash];
+    if (!keys.Contains(key))
+    {
+        keys.Add(key);
+        _modified = true;
+    }
+
+    return state;
+}
+
+#endif
@@ -0,0 +1,61 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "GPUPipelineStateDX12.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+
+/// <summary>
+/// Persistent cache of the compiled graphics pipeline states for DirectX 12 backend. Uses ID3D12PipelineLibrary (if supported) to skip PSO compilation in the next sessions and records pipeline state variants (render targets setup) used by each pipeline description so they can be precompiled in the background when pipeline gets created.
+/// </summary>
+class PipelineLibraryDX12
+{
+private:
+
+    GPUDeviceDX12* _device;
+#if PLATFORM_WINDOWS
+    ID3D12PipelineLibrary* _library = nullptr;
+#endif
+    Array<byte> _data;
+    CriticalSection _locker;
+    Dictionary<uint32, Array<GPUPipelineStateKeyDX12>> _keys;
+    bool _modified = false;
+
+public:
+
+    PipelineLibraryDX12(GPUDeviceDX12* device);
+
+public:
+
+    /// <summary>
+    /// Loads the cache from the file.
+    /// </summary>
+    void Init();
+
+    /// <summary>
+    /// Saves the cache to the file (if modified) and releases the library.
+    /// </summary>
+    void Dispose();
+
+    /// <summary>
+    /// Gets the pipeline state variants recorded for a given pipeline description (from the previous sessions and the current one).
+    /// </summary>
+    /// <param name="descHash">The pipeline description hash.</param>
+    /// <param name="result">The output keys.</param>
+    void GetKeys(uint32 descHash, Array<GPUPipelineStateKeyDX12>& result);
+
+    /// <summary>
+    /// Loads the pipeline state from the library or compiles it (and stores in the library). Records the used variant. Can be called from any thread.
+    /// </summary>
+    /// <param name="descHash">The pipeline description hash.</param>
+    /// <param name="key">The pipeline state variant.</param>
+    /// <param name="desc">The pipeline description (setup for the given variant).</param>
+    /// <returns>The pipeline state object or null if failed.</returns>
+    ID3D12PipelineState* GetState(uint32 descHash, const GPUPipelineStateKeyDX12& key, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+};
+
+#endif
@@ -6,17 +6,22 @@
 #include "GPUTextureDX12.h"
 #include "GPUContextDX12.h"
 #include "../RenderToolsDX.h"
+#include "Engine/Graphics/Graphics.h"
 
 UploadBufferDX12::UploadBufferDX12(GPUDeviceDX12* device)
     : _device(device)
     , _currentPage(nullptr)
     , _currentOffset(0)
     , _currentGeneration(0)
+    , _ringPage(nullptr)
+    , _ringHead(0)
+    , _ringTail(0)
 {
 }
 
 UploadBufferDX12::~UploadBufferDX12()
 {
+    releaseRing();
     _freePages.Add(_usedPages);
     for (auto page : _freePages)
     {
@@ -64,10 +69,18 @@ DynamicAllocation UploadBufferDX12::Allocate(uint64 size, uint64 align)
     return result;
 }
 
+DynamicAllocation UploadBufferDX12::AllocateUpload(GPUContextDX12* context, uint64 size, uint64 align)
+{
+    DynamicAllocation result;
+    if (allocateRing(context, size, align, result))
+        result = Allocate(size, align);
+    return result;
+}
+
 bool UploadBufferDX12::UploadBuffer(GPUContextDX12* context, ID3D12Resource* buffer, uint32 bufferOffset, const void* data, uint64 size)
 {
     // Allocate data
-    const DynamicAllocation allocation = Allocate(size, 4);
+    const DynamicAllocation allocation = AllocateUpload(context, size, 4);
     if (allocation.IsInvalid())
         return true;
 
@@ -94,7 +107,7 @@ bool UploadBufferDX12::UploadTexture(GPUContextDX12* context, ID3D12Resource* te
     const uint64 sliceSizeAligned = numSlices * mipSizeAligned;
 
     // Allocate data
-    const DynamicAllocation allocation = Allocate(sliceSizeAligned, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+    const DynamicAllocation allocation = AllocateUpload(context, sliceSizeAligned, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
     if (allocation.Size != sliceSizeAligned)
         return true;
 
@@ -169,6 +182,65 @@ void UploadBufferDX12::BeginGeneration(uint64 generation)
     _currentGeneration = generation;
 }
 
+bool UploadBufferDX12::allocateRing(GPUContextDX12* context, uint64 size, uint64 align, DynamicAllocation& result)
+{
+    // Reclaim memory used by the already executed copy commands
+    while (_ringFences.Count() != 0 && _ringFences.PeekFront().SyncPoint.IsComplete())
+    {
+        _ringTail = _ringFences.PeekFront().End;
+        _ringFences.PopFront();
+    }
+
+    // Sync ring size with the settings (resize only when GPU is done with it)
+    const uint64 ringSize = (uint64)Math::Max(Graphics::UploadRingSize, 0) * 1024 * 1024;
+    if (_ringFences.Count() == 0)
+    {
+        _ringHead = _ringTail = 0;
+        if (_ringPage && _ringPage->Size != ringSize)
+            releaseRing();
+        if (_ringPage == nullptr && ringSize != 0)
+            _ringPage = New<UploadBufferPageDX12>(_device, ringSize);
+    }
+    if (_ringPage == nullptr)
+        return true;
+
+    // Find space for the data (ring head stays ahead of the tail, equal positions mean empty ring)
+    const uint64 alignmentMask = align - 1;
+    uint64 offset = Math::AlignUpWithMask(_ringHead, alignmentMask);
+    if (_ringHead >= _ringTail)
+    {
+        if (offset + size > _ringPage->Size)
+        {
+            // Wrap around to the begin
+            offset = 0;
+            if (size >= _ringTail)
+                return true;
+        }
+    }
+    else if (offset + size >= _ringTail)
+    {
+        return true;
+    }
+
+    // Track the used range until the context queue passes the commands recorded right now
+    _ringHead = offset + size;
+    _ringFences.PushBack({ _ringHead, context->GetQueue()->GetSyncPoint() });
+    result = DynamicAllocation(static_cast<byte*>(_ringPage->CPUAddress) + offset, offset, size, _ringPage->GPUAddress + offset, _ringPage, _currentGeneration);
+    return false;
+}
+
+void UploadBufferDX12::releaseRing()
+{
+    if (_ringPage)
+    {
+        _ringPage->ReleaseGPU();
+        Delete(_ringPage);
+        _ringPage = nullptr;
+    }
+    _ringFences.Clear();
+    _ringHead = _ringTail = 0;
+}
+
 UploadBufferPageDX12* UploadBufferDX12::requestPage(uint64 size)
 {
     // Try to find valid page
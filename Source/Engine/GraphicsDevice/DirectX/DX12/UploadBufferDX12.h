@@ -4,6 +4,8 @@
 
 #include "GPUDeviceDX12.h"
 #include "ResourceOwnerDX12.h"
+#include "CommandQueueDX12.h"
+#include "Engine/Core/Collections/RingBuffer.h"
 
 #if GRAPHICS_API_DIRECTX12
 
@@ -164,6 +166,18 @@ class UploadBufferDX12
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _freePages;
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _usedPages;
 
+    // Persistent staging memory ring for textures and buffers uploads (reclaimed when the queue fence passes the copy commands)
+    struct RingFence
+    {
+        uint64 End;
+        SyncPointDX12 SyncPoint;
+    };
+
+    UploadBufferPageDX12* _ringPage;
+    uint64 _ringHead;
+    uint64 _ringTail;
+    RingBuffer<RingFence> _ringFences;
+
 public:
 
     /// <summary>
@@ -197,6 +211,15 @@ class UploadBufferDX12
     /// <returns>Dynamic location</returns>
     DynamicAllocation Allocate(uint64 size, uint64 align);
 
+    /// <summary>
+    /// Allocates memory for the copy commands source data. Uses the persistent staging ring (see Graphics::UploadRingSize) and fallbacks to the per-frame pages if the ring is full.
+    /// </summary>
+    /// <param name="context">GPU context that records the copy commands using this allocation.</param>
+    /// <param name="size">Size of the data in bytes</param>
+    /// <param name="align">Data alignment in buffer in bytes</param>
+    /// <returns>Dynamic location</returns>
+    DynamicAllocation AllocateUpload(GPUContextDX12* context, uint64 size, uint64 align);
+
     /// <summary>
     /// Uploads data to the buffer.
     /// </summary>
@@ -232,6 +255,8 @@ class UploadBufferDX12
 private:
 
     UploadBufferPageDX12* requestPage(uint64 size);
+    bool allocateRing(GPUContextDX12* context, uint64 size, uint64 align, DynamicAllocation& result);
+    void releaseRing();
 };
 
 #endif
@@ -41,6 +41,14 @@
 #endif
 #endif
 
+#ifndef VULKAN_USE_FRAGMENT_SHADING_RATE
+#ifdef VK_KHR_fragment_shading_rate
+#define VULKAN_USE_FRAGMENT_SHADING_RATE VK_KHR_fragment_shading_rate
+#else
+#define VULKAN_USE_FRAGMENT_SHADING_RATE 0
+#endif
+#endif
+
 #ifndef VULKAN_USE_QUERIES
 #define VULKAN_USE_QUERIES 1
 #endif
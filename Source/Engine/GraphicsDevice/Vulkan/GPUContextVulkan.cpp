@@ -72,6 +72,20 @@ const Char* ToString(VkImageLayout layout)
 
 #endif
 
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+
+static void SetFragmentShadingRate(GPUDeviceVulkan* device, VkCommandBuffer cmdBuffer, ShadingRate rate)
+{
+    // ShadingRate encodes log2 of the fragment size (width in bits 2-3, height in bits 0-1)
+    VkExtent2D fragmentSize;
+    fragmentSize.width = 1u << (((uint32)rate >> 2) & 0x3);
+    fragmentSize.height = 1u << ((uint32)rate & 0x3);
+    const VkFragmentShadingRateCombinerOpKHR combinerOps[2] = { VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR, VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR };
+    device->CmdSetFragmentShadingRate(cmdBuffer, &fragmentSize, combinerOps);
+}
+
+#endif
+
 void PipelineBarrierVulkan::Execute(const CmdBufferVulkan* cmdBuffer)
 {
     ASSERT(cmdBuffer->IsOutsideRenderPass());
@@ -121,6 +135,18 @@ GPUContextVulkan::~GPUContextVulkan()
 void GPUContextVulkan::AddImageBarrier(VkImage image, VkImageLayout srcLayout, VkImageLayout dstLayout, const VkImageSubresourceRange& subresourceRange, GPUTextureViewVulkan* handle)
 {
 #if VK_ENABLE_BARRIERS_BATCHING
+    // Merge with the pending transition of the same subresources (no GPU work is recorded between them)
+    for (int32 i = _barriers.ImageBarriers.Count() - 1; i >= 0; i--)
+    {
+        VkImageMemoryBarrier& e = _barriers.ImageBarriers[i];
+        if (e.image == image && e.newLayout == srcLayout && Platform::MemoryCompare(&e.subresourceRange, &subresourceRange, sizeof(subresourceRange)) == 0)
+        {
+            e.newLayout = dstLayout;
+            _barriers.DestStage |= RenderToolsVulkan::GetImageBarrierFlags(dstLayout, e.dstAccessMask);
+            return;
+        }
+    }
+
     // Auto-flush on overflow
     if (_barriers.IsFull())
     {
@@ -713,6 +739,7 @@ void GPUContextVulkan::FrameBegin()
     _rtCount = 0;
     _vbCount = 0;
     _stencilRef = 0;
+    _shadingRate = ShadingRate::_1x1;
     _renderPass = nullptr;
     _currentState = nullptr;
     _rtDepth = nullptr;
@@ -726,6 +753,10 @@ void GPUContextVulkan::FrameBegin()
     // Init command buffer
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
     vkCmdSetStencilReference(cmdBuffer->GetHandle(), VK_STENCIL_FRONT_AND_BACK, _stencilRef);
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    if (_device->CmdSetFragmentShadingRate)
+        SetFragmentShadingRate(_device, cmdBuffer->GetHandle(), _shadingRate);
+#endif
 
 #if VULKAN_RESET_QUERY_POOLS
     // Reset pending queries
@@ -970,6 +1001,18 @@ void GPUContextVulkan::SetStencilRef(uint32 value)
     }
 }
 
+void GPUContextVulkan::SetShadingRate(ShadingRate rate, GPUTexture* rateImage)
+{
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    if (_shadingRate != rate && _device->CmdSetFragmentShadingRate)
+    {
+        _shadingRate = rate;
+        const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
+        SetFragmentShadingRate(_device, cmdBuffer->GetHandle(), rate);
+    }
+#endif
+}
+
 void GPUContextVulkan::ResetSR()
 {
     Platform::MemoryClear(_srHandles, sizeof(_srHandles));
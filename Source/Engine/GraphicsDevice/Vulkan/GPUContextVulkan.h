@@ -33,7 +33,7 @@ class DescriptorSetLayoutVulkan;
 /// <summary>
 /// Size of the pipeline barriers buffer size (will be auto-flushed on overflow).
 /// </summary>
-#define VK_BARRIER_BUFFER_SIZE 16
+#define VK_BARRIER_BUFFER_SIZE 64
 
 /// <summary>
 /// The Vulkan pipeline resources layout barrier batching structure.
@@ -79,6 +79,7 @@ class GPUContextVulkan : public GPUContext
     int32 _rtCount;
     int32 _vbCount;
     uint32 _stencilRef;
+    ShadingRate _shadingRate;
 
     RenderPassVulkan* _renderPass;
     GPUPipelineStateVulkan* _currentState;
@@ -162,6 +163,7 @@ class GPUContextVulkan : public GPUContext
     void SetRenderTarget(GPUTextureView* depthBuffer, const Span<GPUTextureView*>& rts) override;
     void SetBlendFactor(const Float4& value) override;
     void SetStencilRef(uint32 value) override;
+    void SetShadingRate(ShadingRate rate, GPUTexture* rateImage) override;
     void ResetSR() override;
     void ResetUA() override;
     void ResetCB() override;
@@ -42,6 +42,9 @@ static const char* GInstanceExtensions[] =
 #if VULKAN_USE_VALIDATION_CACHE
     VK_EXT_VALIDATION_CACHE_EXTENSION_NAME,
 #endif
+#if VULKAN_USE_FRAGMENT_SHADING_RATE && !(PLATFORM_APPLE_FAMILY && defined(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME))
+    VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
+#endif
 #if defined(VK_KHR_display) && 0
     VK_KHR_DISPLAY_EXTENSION_NAME,
 #endif
@@ -62,6 +65,13 @@ static const char* GDeviceExtensions[] =
 #endif
 #if VK_KHR_sampler_mirror_clamp_to_edge
     VK_KHR_SAMPLER_MIRROR_CLAMP_TO_EDGE_EXTENSION_NAME,
+#endif
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    // Fragment shading rate with its dependencies (core in Vulkan 1.2)
+    VK_KHR_MULTIVIEW_EXTENSION_NAME,
+    VK_KHR_MAINTENANCE2_EXTENSION_NAME,
+    VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+    VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME,
 #endif
     nullptr
 };
@@ -599,6 +609,12 @@ void GPUDeviceVulkan::ParseOptionalDeviceExtensions(const Array<const char*>& de
 #if VULKAN_USE_VALIDATION_CACHE
     OptionalDeviceExtensions.HasEXTValidationCache = RenderToolsVulkan::HasExtension(deviceExtensions, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
 #endif
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    OptionalDeviceExtensions.HasKHRFragmentShadingRate = RenderToolsVulkan::HasExtension(deviceExtensions, VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME) &&
+            RenderToolsVulkan::HasExtension(deviceExtensions, VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME) &&
+            RenderToolsVulkan::HasExtension(deviceExtensions, VK_KHR_MULTIVIEW_EXTENSION_NAME) &&
+            RenderToolsVulkan::HasExtension(deviceExtensions, VK_KHR_MAINTENANCE2_EXTENSION_NAME);
+#endif
 }
 
 #endif
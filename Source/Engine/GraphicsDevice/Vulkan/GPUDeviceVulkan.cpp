@@ -1510,6 +1510,28 @@ void* GPUDeviceVulkan::GetNativePtr() const
     return _nativePtr;
 }
 
+bool GPUDeviceVulkan::QueryMemoryBudget(uint64& budget, uint64& usage) const
+{
+    if (Allocator == VK_NULL_HANDLE)
+        return true;
+
+    // Sum the device local heaps (budget is estimated by VMA if VK_EXT_memory_budget is not used)
+    const VkPhysicalDeviceMemoryProperties* memoryProperties;
+    vmaGetMemoryProperties(Allocator, &memoryProperties);
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+    vmaGetHeapBudgets(Allocator, budgets);
+    budget = usage = 0;
+    for (uint32 i = 0; i < memoryProperties->memoryHeapCount; i++)
+    {
+        if (memoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+        {
+            budget += budgets[i].budget;
+            usage += budgets[i].usage;
+        }
+    }
+    return false;
+}
+
 static int32 GetMaxSampleCount(VkSampleCountFlags counts)
 {
     if (counts & VK_SAMPLE_COUNT_64_BIT)
@@ -1656,6 +1678,17 @@ bool GPUDeviceVulkan::Init()
     VkPhysicalDeviceFeatures enabledFeatures;
     VulkanPlatform::RestrictEnabledPhysicalDeviceFeatures(PhysicalDeviceFeatures, enabledFeatures);
     deviceInfo.pEnabledFeatures = &enabledFeatures;
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR fragmentShadingRateFeatures;
+    RenderToolsVulkan::ZeroStruct(fragmentShadingRateFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR);
+    if (OptionalDeviceExtensions.HasKHRFragmentShadingRate)
+    {
+        // Pipeline (per-draw) shading rate is always supported by the extension
+        fragmentShadingRateFeatures.pipelineFragmentShadingRate = VK_TRUE;
+        fragmentShadingRateFeatures.pNext = (void*)deviceInfo.pNext;
+        deviceInfo.pNext = &fragmentShadingRateFeatures;
+    }
+#endif
 
     // Create the device
     VALIDATE_VULKAN_RESULT(vkCreateDevice(gpu, &deviceInfo, nullptr, &Device));
@@ -1664,6 +1697,10 @@ bool GPUDeviceVulkan::Init()
     // Optimize bindings
     volkLoadDevice(Device);
 #endif
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    if (OptionalDeviceExtensions.HasKHRFragmentShadingRate)
+        CmdSetFragmentShadingRate = (PFN_vkCmdSetFragmentShadingRateKHR)vkGetDeviceProcAddr(Device, "vkCmdSetFragmentShadingRateKHR");
+#endif
 
     // Create queues
     if (graphicsQueueFamilyIndex == -1)
@@ -1708,6 +1745,18 @@ bool GPUDeviceVulkan::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = !!PhysicalDeviceFeatures.sampleRateShading;
         limits.HasTypedUAVLoad = true;
+        limits.HasAsyncCompute = false; // TODO: add async compute queue support for Vulkan
+        limits.HasCopyQueue = false; // TODO: add transfer queue support for Vulkan (with queue family ownership transfers)
+        limits.HasBindlessResources = false; // TODO: add bindless resources support for Vulkan (VK_EXT_descriptor_indexing)
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+        limits.HasVariableRateShading = CmdSetFragmentShadingRate != nullptr;
+        limits.HasVariableRateShadingCoarseRates = limits.HasVariableRateShading;
+#else
+        limits.HasVariableRateShading = false;
+        limits.HasVariableRateShadingCoarseRates = false;
+#endif
+        limits.HasVariableRateShadingImage = false; // TODO: add shading rate attachment support for Vulkan (requires render passes created with vkCreateRenderPass2)
+        limits.ShadingRateImageTileSize = 0;
         limits.MaximumMipLevelsCount = Math::Min(static_cast<int32>(log2(PhysicalDeviceLimits.maxImageDimension2D)), GPU_MAX_TEXTURE_MIP_LEVELS);
         limits.MaximumTexture1DSize = PhysicalDeviceLimits.maxImageDimension1D;
         limits.MaximumTexture1DArraySize = PhysicalDeviceLimits.maxImageArrayLayers;
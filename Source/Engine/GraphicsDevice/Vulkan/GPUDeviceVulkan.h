@@ -403,6 +403,9 @@ class GPUDeviceVulkan : public GPUDevice
         uint32 HasMirrorClampToEdge : 1;
 #if VULKAN_USE_VALIDATION_CACHE
         uint32 HasEXTValidationCache : 1;
+#endif
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+        uint32 HasKHRFragmentShadingRate : 1;
 #endif
     };
 
@@ -527,6 +530,13 @@ class GPUDeviceVulkan : public GPUDevice
     /// </summary>
     VkPhysicalDeviceFeatures PhysicalDeviceFeatures;
 
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    /// <summary>
+    /// The vkCmdSetFragmentShadingRateKHR function (loaded manually if VK_KHR_fragment_shading_rate is enabled). Used for the per-draw variable rate shading.
+    /// </summary>
+    PFN_vkCmdSetFragmentShadingRateKHR CmdSetFragmentShadingRate = nullptr;
+#endif
+
     Array<BufferedQueryPoolVulkan*> TimestampQueryPools;
 
 #if VULKAN_RESET_QUERY_POOLS
@@ -600,6 +610,7 @@ class GPUDeviceVulkan : public GPUDevice
     GPUContext* GetMainContext() override;
     GPUAdapter* GetAdapter() const override;
     void* GetNativePtr() const override;
+    bool QueryMemoryBudget(uint64& budget, uint64& usage) const override;
     bool Init() override;
     void DrawBegin() override;
     void Dispose() override;
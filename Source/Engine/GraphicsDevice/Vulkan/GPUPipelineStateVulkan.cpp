@@ -365,7 +365,11 @@ bool GPUPipelineStateVulkan::Init(const Description& desc)
         IsBlendUsingBlendFactor(desc.BlendMode.DestBlend) || IsBlendUsingBlendFactor(desc.BlendMode.DestBlendAlpha)))
         _dynamicStates[_descDynamic.dynamicStateCount++] = VK_DYNAMIC_STATE_BLEND_CONSTANTS;
 #undef IsBlendUsingBlendFactor
-    static_assert(ARRAY_COUNT(_dynamicStates) <= 4, "Invalid dynamic states array.");
+#if VULKAN_USE_FRAGMENT_SHADING_RATE
+    if (_device->CmdSetFragmentShadingRate)
+        _dynamicStates[_descDynamic.dynamicStateCount++] = VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR;
+#endif
+    static_assert(ARRAY_COUNT(_dynamicStates) <= 5, "Invalid dynamic states array.");
     _desc.pDynamicState = &_descDynamic;
 
     // Multisample
@@ -98,7 +98,7 @@ class GPUPipelineStateVulkan : public GPUResourceVulkan<GPUPipelineState>
 #endif
     VkPipelineViewportStateCreateInfo _descViewport;
     VkPipelineDynamicStateCreateInfo _descDynamic;
-    VkDynamicState _dynamicStates[4];
+    VkDynamicState _dynamicStates[5];
     VkPipelineMultisampleStateCreateInfo _descMultisample;
     VkPipelineDepthStencilStateCreateInfo _descDepthStencil;
     VkPipelineRasterizationStateCreateInfo _descRasterization;
@@ -11,6 +11,8 @@
 #include "Engine/Scripting/Script.h"
 #include "Engine/Scripting/ManagedCLR/MClass.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadLocal.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Core/Cache.h"
 #include "Engine/Core/Collections/CollectionPoolCache.h"
@@ -22,6 +24,7 @@
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/Serialization/ISerializeModifier.h"
 #include "Engine/Serialization/Serialization.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
@@ -35,8 +38,77 @@
 
 #define ACTOR_ORIENTATION_EPSILON 0.000000001f
 
+// Minimum amount of actors at the same hierarchy depth to compute their world transforms in parallel
+#define ACTOR_TRANSFORMS_PARALLEL_MIN 4096
+
 namespace
 {
+    // Flattened actors subtree (SoA, sorted by hierarchy depth) used to compute world transforms in a single pass before sending change notifications
+    struct TransformsBatch
+    {
+        Array<Actor*> Actors;
+        // Index of the parent actor in the batch (or -1 for the subtree root)
+        Array<int32> Parents;
+        // Index of the first child of each actor in the batch (children are stored next to each other, with the total count as the last item)
+        Array<int32> ChildrenStart;
+        Array<Transform> Locals;
+        Array<Transform> Worlds;
+        // Start index of each hierarchy depth level (with the total count as the last item)
+        Array<int32> Levels;
+
+        void Compute(const Transform& root, int32 start, int32 end)
+        {
+            const int32* parents = Parents.Get();
+            const Transform* locals = Locals.Get();
+            Transform* worlds = Worlds.Get();
+            for (int32 i = start; i < end; i++)
+            {
+                const int32 parent = parents[i];
+                (parent == -1 ? root : worlds[parent]).LocalToWorld(locals[i], worlds[i]);
+            }
+        }
+
+        void Clear()
+        {
+            Actors.Clear();
+            Parents.Clear();
+            ChildrenStart.Clear();
+            Locals.Clear();
+            Worlds.Clear();
+            Levels.Clear();
+        }
+    };
+
+    // Per-thread batches stack (transform change notifications can modify other hierarchies recursively)
+    struct TransformsBatchStack
+    {
+        Array<TransformsBatch*> Batches;
+        int32 Depth = 0;
+    };
+
+    ThreadLocal<TransformsBatchStack*> TransformsBatches;
+
+    // Actor that is notified about the transform change already computed within a batch (with its index in that batch)
+    THREADLOCAL Actor* TransformsBatchActor = nullptr;
+    THREADLOCAL TransformsBatch* TransformsBatchCurrent = nullptr;
+    THREADLOCAL int32 TransformsBatchIndex = -1;
+
+    // Sends transform change notifications to the batched children of the parent (each child notifies its own children from the base method, so overrides continue once the whole subtree got updated like in regular transform propagation)
+    void NotifyTransformsBatch(TransformsBatch& batch, const Actor* parent, int32 start, int32 end)
+    {
+        for (int32 i = start; i < end; i++)
+        {
+            Actor* actor = batch.Actors[i];
+            if (actor->GetParent() != parent)
+                continue; // Hierarchy modified by the other notification
+            TransformsBatchActor = actor;
+            TransformsBatchCurrent = &batch;
+            TransformsBatchIndex = i;
+            actor->OnTransformChanged();
+            TransformsBatchActor = nullptr;
+        }
+    }
+
     Actor* GetChildByPrefabObjectId(Actor* a, const Guid& prefabObjectId)
     {
         Actor* result = nullptr;
@@ -529,6 +601,7 @@ void Actor::SetLayer(int32 layerIndex)
     if (layerIndex == _layer)
         return;
     _layer = layerIndex;
+    MarkDirty();
     OnLayerChanged();
 }
 
@@ -540,6 +613,7 @@ void Actor::SetLayerRecursive(int32 layerIndex)
     if (layerIndex == _layer)
         return;
     _layer = layerIndex;
+    MarkDirty();
     OnLayerChanged();
 }
 
@@ -548,6 +622,9 @@ void Actor::SetName(String&& value)
     if (_name == value)
         return;
     _name = MoveTemp(value);
+    MarkDirty();
+    if (IsDuringPlay())
+        Level::reindexActorName(this);
     if (GetScene())
         Level::callActorEvent(Level::ActorEventType::OnActorNameChanged, this, nullptr);
 }
@@ -557,6 +634,9 @@ void Actor::SetName(const StringView& value)
     if (_name == value)
         return;
     _name = value;
+    MarkDirty();
+    if (IsDuringPlay())
+        Level::reindexActorName(this);
     if (GetScene())
         Level::callActorEvent(Level::ActorEventType::OnActorNameChanged, this, nullptr);
 }
@@ -612,6 +692,7 @@ void Actor::SetIsActive(bool value)
     if (value != GetIsActive())
     {
         _isActive = value;
+        MarkDirty();
         OnActiveChanged();
     }
 }
@@ -621,6 +702,7 @@ void Actor::SetStaticFlags(StaticFlags value)
     if (_staticFlags == value)
         return;
     _staticFlags = value;
+    MarkDirty();
     OnStaticFlagsChanged();
 }
 
@@ -873,6 +955,7 @@ void Actor::BeginPlay(SceneBeginData* data)
 
     // Set flag
     Flags |= ObjectFlags::IsDuringPlay;
+    Level::indexActor(this);
 
     OnBeginPlay();
 
@@ -928,6 +1011,7 @@ void Actor::EndPlay()
 
     // Clear flag
     Flags &= ~ObjectFlags::IsDuringPlay;
+    Level::unindexActor(this);
 
     // Call event deeper
     for (int32 i = 0; i < Children.Count(); i++)
@@ -1036,6 +1120,8 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
     DESERIALIZE(HideFlags);
     DESERIALIZE_MEMBER(Layer, _layer);
     DESERIALIZE_MEMBER(Name, _name);
+    if (IsDuringPlay())
+        Level::reindexActorName(this);
     DESERIALIZE_MEMBER(Transform, _localTransform);
 
     {
@@ -1178,11 +1264,26 @@ void Actor::OnDisable()
 
 void Actor::OnParentChanged()
 {
+    MarkDirty();
 }
 
 void Actor::OnTransformChanged()
 {
     ASSERT_LOW_LAYER(!_localTransform.IsNanOrInfinity());
+    MarkDirty();
+
+    if (TransformsBatchActor == this)
+    {
+        // World transform has been already computed by the parent (unless actor modified its local transform before calling base method)
+        TransformsBatchActor = nullptr;
+        TransformsBatch& batch = *TransformsBatchCurrent;
+        const int32 index = TransformsBatchIndex;
+        if (_localTransform == batch.Locals[index])
+        {
+            NotifyTransformsBatch(batch, this, batch.ChildrenStart[index], batch.ChildrenStart[index + 1]);
+            return;
+        }
+    }
 
     if (_parent)
     {
@@ -1193,10 +1294,76 @@ void Actor::OnTransformChanged()
         _transform = _localTransform;
     }
 
-    for (auto child : Children)
+    if (Children.HasItems())
+        UpdateChildrenTransforms();
+}
+
+void Actor::UpdateChildrenTransforms()
+{
+    TransformsBatchStack*& stack = TransformsBatches.Get();
+    if (!stack)
+        stack = New<TransformsBatchStack>();
+    if (stack->Depth == stack->Batches.Count())
+        stack->Batches.Add(New<TransformsBatch>());
+    TransformsBatch& batch = *stack->Batches[stack->Depth++];
+
+    // Flatten the subtree (breadth-first so parents are always before their children)
+    for (Actor* child : Children)
     {
-        child->OnTransformChanged();
+        batch.Actors.Add(child);
+        batch.Parents.Add(-1);
     }
+    int32 levelStart = 0;
+    while (levelStart < batch.Actors.Count())
+    {
+        const int32 levelEnd = batch.Actors.Count();
+        batch.Levels.Add(levelStart);
+        for (int32 i = levelStart; i < levelEnd; i++)
+        {
+            batch.ChildrenStart.Add(batch.Actors.Count());
+            for (Actor* child : batch.Actors[i]->Children)
+            {
+                batch.Actors.Add(child);
+                batch.Parents.Add(i);
+            }
+        }
+        levelStart = levelEnd;
+    }
+    const int32 count = batch.Actors.Count();
+    batch.Levels.Add(count);
+    batch.ChildrenStart.Add(count);
+    batch.Locals.Resize(count, false);
+    batch.Worlds.Resize(count, false);
+    for (int32 i = 0; i < count; i++)
+        batch.Locals[i] = batch.Actors[i]->_localTransform;
+
+    // Compute world transforms level by level (actors at the same depth are independent)
+    for (int32 level = 0; level < batch.Levels.Count() - 1; level++)
+    {
+        const int32 start = batch.Levels[level];
+        const int32 end = batch.Levels[level + 1];
+        if (end - start >= ACTOR_TRANSFORMS_PARALLEL_MIN)
+        {
+            PROFILE_CPU_NAMED("Update Transforms");
+            const Transform& root = _transform;
+            JobSystem::ParallelFor(start, end, 0, [&batch, &root](int32 chunkStart, int32 chunkEnd)
+            {
+                batch.Compute(root, chunkStart, chunkEnd);
+            });
+        }
+        else
+        {
+            batch.Compute(_transform, start, end);
+        }
+    }
+    for (int32 i = 0; i < count; i++)
+        batch.Actors[i]->_transform = batch.Worlds[i];
+
+    // Send change notifications once the whole subtree is up to date (depth-first, starting from the direct children)
+    NotifyTransformsBatch(batch, this, 0, batch.Levels.Count() > 1 ? batch.Levels[1] : count);
+
+    batch.Clear();
+    stack->Depth--;
 }
 
 void Actor::OnActiveChanged()
@@ -1237,6 +1404,7 @@ void Actor::OnActiveInTreeChanged()
 
 void Actor::OnOrderInParentChanged()
 {
+    MarkDirty();
     //if (GetScene())
     Level::callActorEvent(Level::ActorEventType::OnActorOrderInParentChanged, this, nullptr);
 }
@@ -1590,23 +1758,47 @@ Quaternion Actor::LookingAt(const Vector3& worldPos, const Vector3& worldUp) con
     return orientation;
 }
 
-void WriteObjectToBytes(SceneObject* obj, rapidjson_flax::StringBuffer& buffer, MemoryWriteStream& output)
+void WriteObjectToBytes(SceneObject* obj, MemoryWriteStream& output)
 {
-    // Create JSON
-    CompactJsonWriter writer(buffer);
-
+    // Build JSON document (skip text encoding)
+    rapidjson_flax::Document document;
+    DocumentJsonWriter writer(document);
     writer.SceneObject(obj);
 
-    // Write json to output
-    // TODO: maybe compress json or use binary serialization
-    output.WriteInt32((int32)buffer.GetSize());
-    output.WriteBytes((byte*)buffer.GetString(), (int32)buffer.GetSize());
+    // Write binary json to output
+    const uint32 sizePosition = output.GetPosition();
+    output.WriteInt32(0);
+    JsonBinary::Write(document, output);
+    const uint32 endPosition = output.GetPosition();
+    *(int32*)(output.GetHandle() + sizePosition) = (int32)(endPosition - sizePosition - sizeof(int32));
 
     // Store order in parent. Makes life easier for editor to sync objects order on undo/redo actions.
     output.WriteInt32(obj->GetOrderInParent());
+}
 
-    // Reuse string buffer
-    buffer.Clear();
+bool ReadObjectFromBytes(const char* buffer, int32 bufferSize, rapidjson_flax::Document& document)
+{
+    if (JsonBinary::IsBinary(buffer, bufferSize))
+    {
+        if (JsonBinary::Read(buffer, bufferSize, document))
+        {
+            LOG(Warning, "Invalid binary json data.");
+            return true;
+        }
+        return false;
+    }
+
+    // Data saved with older engine versions uses json text
+    {
+        PROFILE_CPU_NAMED("Json.Parse");
+        document.Parse(buffer, bufferSize);
+    }
+    if (document.HasParseError())
+    {
+        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+        return true;
+    }
+    return false;
 }
 
 bool Actor::ToBytes(const Array<Actor*>& actors, MemoryWriteStream& output)
@@ -1642,20 +1834,19 @@ bool Actor::ToBytes(const Array<Actor*>& actors, MemoryWriteStream& output)
     output.WriteArray(ids);
 
     // Objects data
-    rapidjson_flax::StringBuffer buffer;
     for (int32 i = 0; i < actors.Count(); i++)
     {
         Actor* actor = actors[i];
         if (!actor)
             continue;
 
-        WriteObjectToBytes(actor, buffer, output);
+        WriteObjectToBytes(actor, output);
 
         for (int32 j = 0; j < actor->Scripts.Count(); j++)
         {
             Script* script = actor->Scripts[j];
 
-            WriteObjectToBytes(script, buffer, output);
+            WriteObjectToBytes(script, output);
         }
     }
 
@@ -1725,15 +1916,8 @@ bool Actor::FromBytes(const Span<byte>& data, Array<Actor*>& output, ISerializeM
 
         // Load JSON 
         rapidjson_flax::Document document;
-        {
-            PROFILE_CPU_NAMED("Json.Parse");
-            document.Parse(buffer, bufferSize);
-        }
-        if (document.HasParseError())
-        {
-            Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+        if (ReadObjectFromBytes(buffer, bufferSize, document))
             return true;
-        }
 
         // Create object
         auto obj = SceneObjectsFactory::Spawn(context, document);
@@ -1768,15 +1952,8 @@ bool Actor::FromBytes(const Span<byte>& data, Array<Actor*>& output, ISerializeM
 
         // Load JSON
         rapidjson_flax::Document document;
-        {
-            PROFILE_CPU_NAMED("Json.Parse");
-            document.Parse(buffer, bufferSize);
-        }
-        if (document.HasParseError())
-        {
-            Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+        if (ReadObjectFromBytes(buffer, bufferSize, document))
             return true;
-        }
 
         // Deserialize object
         auto obj = sceneObjects->At(i);
@@ -1876,12 +2053,12 @@ Array<Guid> Actor::TryGetSerializedObjectsIds(const Span<byte>& data)
 String Actor::ToJson()
 {
     PROFILE_CPU();
-    rapidjson_flax::StringBuffer buffer;
-    CompactJsonWriter writer(buffer);
+    auto buffer = Cache::JsonBuffer.Get();
+    CompactJsonWriter writer(*buffer.Value);
     writer.SceneObject(this);
     String result;
-    const char* c = buffer.GetString();
-    result.SetUTF8(c, (int32)buffer.GetSize());
+    const char* c = buffer->GetString();
+    result.SetUTF8(c, (int32)buffer->GetSize());
     return result;
 }
 
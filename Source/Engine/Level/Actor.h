@@ -5,6 +5,7 @@
 #include "SceneObject.h"
 #include "Tags.h"
 #include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/HandlePool.h"
 #include "Engine/Core/Math/Transform.h"
 #include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Core/Math/BoundingSphere.h"
@@ -50,6 +51,11 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     PhysicsScene* _physicsScene;
 
 private:
+    // Level actors index data (valid only during play)
+    PoolHandle _typeIndexHandle;
+    PoolHandle _nameIndexHandle;
+    uint32 _nameIndexHash = 0;
+
     // Disable copying
     Actor(Actor const&) = delete;
     Actor& operator=(Actor const&) = delete;
@@ -1068,6 +1074,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     void SetSceneInHierarchy(Scene* scene);
     void OnEnableInHierarchy();
     void OnDisableInHierarchy();
+    void UpdateChildrenTransforms();
 
     // Helper methods used by templates GetChildren/GetScripts to prevent including MClass/Script here
     static bool IsSubClassOf(const Actor* object, const MClass* klass);
@@ -0,0 +1,171 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ActorPool.h"
+#include "Actor.h"
+#include "Level.h"
+#include "Prefabs/PrefabManager.h"
+#include "Scene/Scene.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Debug/Exceptions/ArgumentException.h"
+#include "Engine/Debug/Exceptions/ArgumentNullException.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Scripting/ManagedCLR/MClass.h"
+
+int32 ActorPool::CapacityPerType = 256;
+Delegate<Actor*> ActorPool::ActorReset;
+
+namespace
+{
+    CriticalSection PoolLocker;
+    Dictionary<ScriptingTypeHandle, Array<Actor*>> Pools;
+    ActorPool::Stats PoolStats = {};
+
+    void OnPooledActorDeleted(ScriptingObject* obj)
+    {
+        // Pooled actor has been deleted from outside (eg. via Object.Destroy)
+        ScopeLock lock(PoolLocker);
+        Array<Actor*>* pool = Pools.TryGet(obj->GetTypeHandle());
+        if (pool && pool->Remove((Actor*)obj))
+            PoolStats.Pooled--;
+    }
+}
+
+class ActorPoolService : public EngineService
+{
+public:
+    ActorPoolService()
+        : EngineService(TEXT("Actor Pool"))
+    {
+    }
+
+    bool Init() override
+    {
+        // Pooled actors can use the game scripts types
+        Scripting::ScriptsUnload.Bind<&ActorPool::Clear>();
+        return false;
+    }
+
+    void Dispose() override
+    {
+        Scripting::ScriptsUnload.Unbind<&ActorPool::Clear>();
+        ActorPool::Clear();
+    }
+};
+
+ActorPoolService ActorPoolServiceInstance;
+
+Actor* ActorPool::Spawn(const ScriptingTypeHandle& type, const Transform& transform, Actor* parent)
+{
+    PROFILE_CPU_NAMED("ActorPool.Spawn");
+    if (!type || !Actor::TypeInitializer.IsAssignableFrom(type))
+    {
+        Log::ArgumentException(TEXT("Invalid actor type."));
+        return nullptr;
+    }
+
+    // Pick the pooled actor
+    Actor* actor = nullptr;
+    PoolLocker.Lock();
+    Array<Actor*>* pool = Pools.TryGet(type);
+    if (pool && pool->HasItems())
+    {
+        actor = pool->Pop();
+        PoolStats.Pooled--;
+        PoolStats.Reused++;
+    }
+    ZoneValue(PoolStats.Pooled);
+    PoolLocker.Unlock();
+
+    if (actor)
+    {
+        actor->Deleted.Unbind<OnPooledActorDeleted>();
+        ActorReset(actor);
+    }
+    else
+    {
+        actor = ScriptingObject::NewObject<Actor>(type);
+        if (!actor)
+            return nullptr;
+        PoolStats.Created++;
+    }
+
+    // Add to the game
+    actor->SetTransform(transform);
+    if (Level::SpawnActor(actor, parent))
+    {
+        actor->DeleteObject();
+        return nullptr;
+    }
+    return actor;
+}
+
+Actor* ActorPool::Spawn(const MClass* type, const Transform& transform, Actor* parent)
+{
+    CHECK_RETURN(type, nullptr);
+    const ScriptingTypeHandle scriptingType = Scripting::FindScriptingType(type->GetFullName());
+    if (!scriptingType)
+    {
+        LOG(Error, "Failed to find actor type '{0}'.", String(type->GetFullName()));
+        return nullptr;
+    }
+    return Spawn(scriptingType, transform, parent);
+}
+
+void ActorPool::Release(Actor* actor)
+{
+    PROFILE_CPU_NAMED("ActorPool.Release");
+    if (actor == nullptr)
+    {
+        Log::ArgumentNullException();
+        return;
+    }
+    if (actor->HasPrefabLink() && actor->IsPrefabRoot())
+    {
+        // Prefab instances are restored from the prefab data so let prefab handle it
+        PrefabManager::DespawnPrefab(actor);
+        return;
+    }
+
+    ScopeLock lock(PoolLocker);
+    PoolStats.Released++;
+    Array<Actor*>& pool = Pools[actor->GetTypeHandle()];
+    if (pool.Count() >= CapacityPerType || actor->Children.HasItems() || actor->Is<Scene>())
+    {
+        PoolStats.Deleted++;
+        actor->DeleteObject();
+        return;
+    }
+
+    // Remove from the game (actor stays registered)
+    Level::despawnActor(actor);
+    actor->Deleted.Bind<OnPooledActorDeleted>();
+    pool.Add(actor);
+    PoolStats.Pooled++;
+    ZoneValue(PoolStats.Pooled);
+}
+
+void ActorPool::Clear()
+{
+    PROFILE_CPU();
+    ScopeLock lock(PoolLocker);
+    for (auto& e : Pools)
+    {
+        for (Actor* actor : e.Value)
+        {
+            actor->Deleted.Unbind<OnPooledActorDeleted>();
+            actor->DeleteObject();
+        }
+    }
+    Pools.Clear();
+    PoolStats.Pooled = 0;
+}
+
+ActorPool::Stats ActorPool::GetStats()
+{
+    ScopeLock lock(PoolLocker);
+    return PoolStats;
+}
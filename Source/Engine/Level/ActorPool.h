@@ -0,0 +1,110 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Scripting/ScriptingType.h"
+#include "Types.h"
+
+/// <summary>
+/// The pool of actors removed from the game and kept for reuse. Released actors leave the play and get unlinked from the scene but stay allocated and registered (including their scripts), so spawning them again skips the object creation and registration.
+/// </summary>
+/// <remarks>
+/// Actors are pooled per type. Only actors without children can be pooled (use Prefab pooling for the actor hierarchies). Released prefab instances are passed to PrefabManager::DespawnPrefab.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API ActorPool
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ActorPool);
+
+    /// <summary>
+    /// The actors pooling statistics.
+    /// </summary>
+    API_STRUCT(NoDefault) struct Stats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(Stats);
+
+        /// <summary>
+        /// The amount of actors in the pool (ready to reuse).
+        /// </summary>
+        API_FIELD() int32 Pooled;
+
+        /// <summary>
+        /// The total amount of actors created by the pool (spawn with no pooled actor to reuse).
+        /// </summary>
+        API_FIELD() int32 Created;
+
+        /// <summary>
+        /// The total amount of spawns that reused the pooled actor.
+        /// </summary>
+        API_FIELD() int32 Reused;
+
+        /// <summary>
+        /// The total amount of actors released to the pool.
+        /// </summary>
+        API_FIELD() int32 Released;
+
+        /// <summary>
+        /// The total amount of released actors that got deleted (eg. pool was full or actor had children).
+        /// </summary>
+        API_FIELD() int32 Deleted;
+    };
+
+public:
+    /// <summary>
+    /// The maximum amount of pooled actors of a single type. Released actors above this limit are deleted.
+    /// </summary>
+    API_FIELD() static int32 CapacityPerType;
+
+    /// <summary>
+    /// Action fired when pooled actor is reused, before it's added back to the game. Can be used to reset the custom actor or scripts state left from the previous use.
+    /// </summary>
+    API_EVENT() static Delegate<Actor*> ActorReset;
+
+public:
+    /// <summary>
+    /// Spawns the actor of the given type. Reuses the pooled actor if available, otherwise creates a new one.
+    /// </summary>
+    /// <param name="type">The actor type.</param>
+    /// <param name="transform">The actor world-space transform.</param>
+    /// <param name="parent">The parent actor. Null to spawn in the first loaded scene.</param>
+    /// <returns>The spawned actor or null if failed.</returns>
+    static Actor* Spawn(const ScriptingTypeHandle& type, const Transform& transform, Actor* parent = nullptr);
+
+    /// <summary>
+    /// Spawns the actor of the given type. Reuses the pooled actor if available, otherwise creates a new one.
+    /// </summary>
+    /// <param name="type">The actor type.</param>
+    /// <param name="transform">The actor world-space transform.</param>
+    /// <param name="parent">The parent actor. Null to spawn in the first loaded scene.</param>
+    /// <returns>The spawned actor or null if failed.</returns>
+    API_FUNCTION() static Actor* Spawn(API_PARAM(Attributes="TypeReference(typeof(Actor))") const MClass* type, const Transform& transform, Actor* parent = nullptr);
+
+    /// <summary>
+    /// Spawns the actor of the given type. Reuses the pooled actor if available, otherwise creates a new one.
+    /// </summary>
+    /// <param name="transform">The actor world-space transform.</param>
+    /// <param name="parent">The parent actor. Null to spawn in the first loaded scene.</param>
+    /// <returns>The spawned actor or null if failed.</returns>
+    template<typename T>
+    FORCE_INLINE static T* Spawn(const Transform& transform, Actor* parent = nullptr)
+    {
+        return (T*)Spawn(T::TypeInitializer, transform, parent);
+    }
+
+    /// <summary>
+    /// Removes the actor from the game and keeps it in the pool for reuse. Deletes the actor if it cannot be pooled.
+    /// </summary>
+    /// <param name="actor">The actor to release.</param>
+    API_FUNCTION() static void Release(Actor* actor);
+
+    /// <summary>
+    /// Deletes all the pooled actors.
+    /// </summary>
+    API_FUNCTION() static void Clear();
+
+    /// <summary>
+    /// Gets the pooling statistics.
+    /// </summary>
+    API_FUNCTION() static Stats GetStats();
+};
@@ -5,6 +5,7 @@
 #include "Engine/Core/Math/Matrix3x4.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Animations/Animations.h"
+#include "Engine/Animations/PoseBlending.h"
 #include "Engine/Engine/Engine.h"
 #if USE_EDITOR
 #include "Engine/Core/Math/OrientedBoundingBox.h"
@@ -14,6 +15,7 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Models/MeshDeformation.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/SceneObjectsFactory.h"
@@ -56,14 +58,18 @@ void AnimatedModel::UpdateAnimation()
         || SkinnedModel == nullptr
         || !SkinnedModel->IsLoaded()
         || _lastUpdateFrame == Engine::UpdateCount
-        || _masterPose)
+        || _masterPose
+        || _sharedPose)
         return;
     _lastUpdateFrame = Engine::UpdateCount;
 
     if (AnimationGraph && AnimationGraph->IsLoaded() && AnimationGraph->Graph.IsReady())
     {
-        // Request an animation update
-        Animations::AddToUpdate(this);
+        // Request an animation update (or upgrade the already requested pose interpolation)
+        if (_interpolateOnly)
+            _interpolateOnly = false;
+        else
+            Animations::AddToUpdate(this);
     }
 }
 
@@ -141,6 +147,7 @@ void AnimatedModel::SetCurrentPose(const Array<Matrix>& nodesTransformation, boo
         const_cast<AnimatedModel*>(this)->PreInitSkinningData(); // Ensure to have valid nodes pose to return
     CHECK(nodesTransformation.Count() == GraphInstance.NodesPose.Count());
     GraphInstance.NodesPose = nodesTransformation;
+    _interpolationAlpha = 1.0f;
     if (worldSpace)
     {
         Matrix world;
@@ -180,6 +187,7 @@ void AnimatedModel::SetNodeTransformation(int32 nodeIndex, const Matrix& nodeTra
         const_cast<AnimatedModel*>(this)->PreInitSkinningData(); // Ensure to have valid nodes pose to return
     CHECK(nodeIndex >= 0 && nodeIndex < GraphInstance.NodesPose.Count());
     GraphInstance.NodesPose[nodeIndex] = nodeTransformation;
+    _interpolationAlpha = 1.0f;
     if (worldSpace)
     {
         Matrix world;
@@ -227,6 +235,17 @@ void AnimatedModel::SetMasterPoseModel(AnimatedModel* masterPose)
         _masterPose->AnimationUpdated.Bind<AnimatedModel, &AnimatedModel::OnAnimationUpdated>(this);
 }
 
+void AnimatedModel::SetSharedPose(AnimatedModel* source)
+{
+    if (source == _sharedPose)
+        return;
+    if (_sharedPose)
+        _sharedPose->_sharedPoseUpdated.Unbind<AnimatedModel, &AnimatedModel::OnSharedPoseUpdated>(this);
+    _sharedPose = source;
+    if (_sharedPose)
+        _sharedPose->_sharedPoseUpdated.Bind<AnimatedModel, &AnimatedModel::OnSharedPoseUpdated>(this);
+}
+
 const Array<AnimGraphTraceEvent>& AnimatedModel::GetTraceEvents() const
 {
 #if !BUILD_RELEASE
@@ -694,7 +713,9 @@ void AnimatedModel::BeginPlay(SceneBeginData* data)
 void AnimatedModel::EndPlay()
 {
     Animations::RemoveFromUpdate(this);
+    Animations::RemoveSharedPose(this);
     SetMasterPoseModel(nullptr);
+    SetSharedPose(nullptr);
 
     // Base
     ModelInstanceActor::EndPlay();
@@ -771,6 +792,46 @@ void AnimatedModel::UpdateSockets()
     }
 }
 
+void AnimatedModel::BeginPoseInterpolation()
+{
+    // Interpolate from the currently visible pose to the evaluated one during the updates skipped until the next evaluation
+    const int32 interval = _actualMode == AnimationUpdateMode::EveryFourthUpdate ? 4 : _actualMode == AnimationUpdateMode::EverySecondUpdate ? 2 : 1;
+    const auto& pose = GraphInstance.NodesTransforms;
+    if (!InterpolateSkippedUpdates || pose.Count() != GraphInstance.NodesPose.Count())
+    {
+        _interpolationPose.Resize(0);
+        _interpolationAlpha = 1.0f;
+        return;
+    }
+    if (interval == 1 || _interpolationPose.Count() != pose.Count())
+    {
+        _interpolationPose = pose;
+        _interpolationAlpha = 1.0f;
+        return;
+    }
+    _interpolationStart = _interpolationPose;
+    _interpolationAlpha = 0.0f;
+    _interpolationStep = 1.0f / (float)interval;
+    UpdatePoseInterpolation();
+}
+
+void AnimatedModel::UpdatePoseInterpolation()
+{
+    ANIM_GRAPH_PROFILE_EVENT("Pose Interpolation");
+    const auto& pose = GraphInstance.NodesTransforms;
+    const int32 nodesCount = pose.Count();
+    if (_interpolationStart.Count() != nodesCount || _interpolationPose.Count() != nodesCount || GraphInstance.NodesPose.Count() != nodesCount)
+    {
+        _interpolationAlpha = 1.0f;
+        return;
+    }
+    _interpolationAlpha = Math::Min(_interpolationAlpha + _interpolationStep, 1.0f);
+    PoseBlending::Lerp(_interpolationStart.Get(), pose.Get(), _interpolationAlpha, _interpolationPose.Get(), nodesCount);
+    Matrix* nodesPose = GraphInstance.NodesPose.Get();
+    for (int32 nodeIndex = 0; nodeIndex < nodesCount; nodeIndex++)
+        _interpolationPose.Get()[nodeIndex].GetWorld(nodesPose[nodeIndex]);
+}
+
 void AnimatedModel::OnAnimationUpdated_Async()
 {
     // Update asynchronous stuff
@@ -794,13 +855,7 @@ void AnimatedModel::OnAnimationUpdated_Async()
         Matrix3x4* output = (Matrix3x4*)_skinningData.Data.Get();
         ASSERT(GraphInstance.NodesPose.Count() == skeleton.Nodes.Count());
         ASSERT(_skinningData.Data.Count() == bonesCount * sizeof(Matrix3x4));
-        for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
-        {
-            const SkeletonBone& bone = skeleton.Bones[boneIndex];
-            Matrix matrix;
-            Matrix::Multiply(bone.OffsetMatrix, GraphInstance.NodesPose.Get()[bone.NodeIndex], matrix);
-            output[boneIndex].SetMatrixTranspose(matrix);
-        }
+        PoseBlending::GetBoneMatrices(skeleton.Bones.Get(), GraphInstance.NodesPose.Get(), output, bonesCount);
         _skinningData.OnDataChanged(!PerBoneMotionBlur);
     }
 
@@ -812,6 +867,7 @@ void AnimatedModel::OnAnimationUpdated_Sync()
     // Update synchronous stuff
     UpdateSockets();
     ApplyRootMotion(GraphInstance.RootMotion);
+    _sharedPoseUpdated();
     if (!_isDuringUpdateEvent)
     {
         // Prevent stack-overflow when gameplay modifies the pose within the event
@@ -828,6 +884,28 @@ void AnimatedModel::OnAnimationUpdated()
     OnAnimationUpdated_Sync();
 }
 
+void AnimatedModel::OnSharedPoseUpdated()
+{
+    ANIM_GRAPH_PROFILE_EVENT("Copy Shared Pose");
+    const auto& sourceInstance = _sharedPose->GraphInstance;
+    if (!SkinnedModel || sourceInstance.NodesPose.Count() != SkinnedModel->Skeleton.Nodes.Count())
+        return;
+
+    // Use the pose evaluated by the source model (skinning buffer is shared too, see GetSkinningData)
+    GraphInstance.NodesPose = sourceInstance.NodesPose;
+    GraphInstance.RootTransform = sourceInstance.RootTransform;
+    GraphInstance.RootMotion = sourceInstance.RootMotion;
+    UpdateBounds();
+    UpdateSockets();
+    ApplyRootMotion(GraphInstance.RootMotion);
+    if (!_isDuringUpdateEvent)
+    {
+        _isDuringUpdateEvent = true;
+        AnimationUpdated();
+        _isDuringUpdateEvent = false;
+    }
+}
+
 void AnimatedModel::OnSkinnedModelChanged()
 {
     Entries.Release();
@@ -868,17 +946,37 @@ bool AnimatedModel::HasContentLoaded() const
 
 void AnimatedModel::Update()
 {
+    // Pick the model that evaluates the shared pose
+    AnimatedModel* sharedPose = nullptr;
+    if (SharePose && !_masterPose && SkinnedModel && AnimationGraph)
+    {
+        sharedPose = Animations::GetSharedPose(this);
+        if (sharedPose == this)
+            sharedPose = nullptr;
+    }
+    SetSharedPose(sharedPose);
+    if (sharedPose)
+    {
+        // Keep the source model updated as long as any model that shares its pose is visible
+        sharedPose->_lastMinDstSqr = Math::Min(sharedPose->_lastMinDstSqr, _lastMinDstSqr);
+        sharedPose->_lastMaxScreenSizeSqr = Math::Max(sharedPose->_lastMaxScreenSizeSqr, _lastMaxScreenSizeSqr);
+        _lastMinDstSqr = MAX_Real;
+        _lastMaxScreenSizeSqr = 0.0f;
+        return;
+    }
+
     // Update the mode
     _actualMode = UpdateMode;
     if (_actualMode == AnimationUpdateMode::Auto)
     {
         // TODO: handle low performance platforms
 
-        if (_lastMinDstSqr < 3000.0f * 3000.0f)
+        // Use the more frequent updates for the models that are close or big on the screen
+        if (_lastMinDstSqr < 3000.0f * 3000.0f || _lastMaxScreenSizeSqr > 0.25f * 0.25f)
             _actualMode = AnimationUpdateMode::EveryUpdate;
-        else if (_lastMinDstSqr < 6000.0f * 6000.0f)
+        else if (_lastMinDstSqr < 6000.0f * 6000.0f || _lastMaxScreenSizeSqr > 0.1f * 0.1f)
             _actualMode = AnimationUpdateMode::EverySecondUpdate;
-        else if (_lastMinDstSqr < 10000.0f * 10000.0f)
+        else if (_lastMinDstSqr < 10000.0f * 10000.0f || _lastMaxScreenSizeSqr > 0.04f * 0.04f)
             _actualMode = AnimationUpdateMode::EveryFourthUpdate;
         else
             _actualMode = AnimationUpdateMode::Manual;
@@ -900,10 +998,25 @@ void AnimatedModel::Update()
     default:
         break;
     }
+    if (_deferredUpdates != 0 && _actualMode != AnimationUpdateMode::Manual)
+    {
+        // Catch up the update delayed by the animations budget
+        updateAnim = true;
+    }
+    GraphInstance.CacheNodesTransforms = InterpolateSkippedUpdates;
     if (updateAnim && (UpdateWhenOffscreen || _lastMinDstSqr < MAX_Real))
+    {
         UpdateAnimation();
+    }
+    else if (_interpolationAlpha < 1.0f && _lastMinDstSqr < MAX_Real && !_masterPose && _lastUpdateFrame != Engine::UpdateCount)
+    {
+        // Interpolate the visible pose between the evaluated ones
+        _interpolateOnly = true;
+        Animations::AddToUpdate(this);
+    }
 
     _lastMinDstSqr = MAX_Real;
+    _lastMaxScreenSizeSqr = 0.0f;
 }
 
 void AnimatedModel::Draw(RenderContext& renderContext)
@@ -920,19 +1033,26 @@ void AnimatedModel::Draw(RenderContext& renderContext)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.WorldPosition));
-    if (_skinningData.IsReady())
+    if (EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer))
+        _lastMaxScreenSizeSqr = Math::Max(_lastMaxScreenSizeSqr, RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, renderContext.View));
+    SkinnedMeshDrawData& skinningData = GetSkinningData();
+    if (skinningData.IsReady())
     {
-        // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        // Flush skinning data with GPU (once, the buffer can be shared by many models drawn from multiple threads)
+        if (skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
-            GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
+            if (skinningData.IsDirty())
+            {
+                GPUDevice::Instance->GetMainContext()->UpdateBuffer(skinningData.BoneMatrices, skinningData.Data.Get(), skinningData.Data.Count());
+                skinningData.OnFlush();
+            }
             RenderContext::GPULocker.Unlock();
         }
 
         SkinnedMesh::DrawInfo draw;
         draw.Buffer = &Entries;
-        draw.Skinning = &_skinningData;
+        draw.Skinning = &skinningData;
         draw.World = &world;
         draw.DrawState = &_drawState;
         draw.Deformation = _deformation;
@@ -963,19 +1083,26 @@ void AnimatedModel::Draw(RenderContextBatch& renderContextBatch)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.WorldPosition));
-    if (_skinningData.IsReady())
+    if (EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer))
+        _lastMaxScreenSizeSqr = Math::Max(_lastMaxScreenSizeSqr, RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - renderContext.View.Origin, (float)_sphere.Radius, renderContext.View));
+    SkinnedMeshDrawData& skinningData = GetSkinningData();
+    if (skinningData.IsReady())
     {
-        // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        // Flush skinning data with GPU (once, the buffer can be shared by many models drawn from multiple threads)
+        if (skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
-            GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
+            if (skinningData.IsDirty())
+            {
+                GPUDevice::Instance->GetMainContext()->UpdateBuffer(skinningData.BoneMatrices, skinningData.Data.Get(), skinningData.Data.Count());
+                skinningData.OnFlush();
+            }
             RenderContext::GPULocker.Unlock();
         }
 
         SkinnedMesh::DrawInfo draw;
         draw.Buffer = &Entries;
-        draw.Skinning = &_skinningData;
+        draw.Skinning = &skinningData;
         draw.World = &world;
         draw.DrawState = &_drawState;
         draw.Deformation = _deformation;
@@ -1095,6 +1222,9 @@ void AnimatedModel::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(UpdateWhenOffscreen);
     SERIALIZE(UpdateSpeed);
     SERIALIZE(UpdateMode);
+    SERIALIZE(InterpolateSkippedUpdates);
+    SERIALIZE(SharePose);
+    SERIALIZE(SharedPoseGroup);
     SERIALIZE(BoundsScale);
     SERIALIZE(CustomBounds);
     SERIALIZE(LODBias);
@@ -1122,6 +1252,9 @@ void AnimatedModel::Deserialize(DeserializeStream& stream, ISerializeModifier* m
     DESERIALIZE(UpdateWhenOffscreen);
     DESERIALIZE(UpdateSpeed);
     DESERIALIZE(UpdateMode);
+    DESERIALIZE(InterpolateSkippedUpdates);
+    DESERIALIZE(SharePose);
+    DESERIALIZE(SharedPoseGroup);
     DESERIALIZE(BoundsScale);
     DESERIALIZE(CustomBounds);
     DESERIALIZE(LODBias);
@@ -1248,6 +1381,11 @@ void AnimatedModel::OnDeleteObject()
     ModelInstanceActor::OnDeleteObject();
 }
 
+void AnimatedModel::PrefetchStreaming(double endTime) const
+{
+    PrefetchModel(SkinnedModel.Get(), endTime);
+}
+
 void AnimatedModel::WaitForModelLoad()
 {
     if (SkinnedModel)
@@ -8,6 +8,7 @@
 #include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Core/Delegate.h"
+#include "Engine/Core/Collections/HandlePool.h"
 
 /// <summary>
 /// Performs an animation and renders a skinned model.
@@ -17,6 +18,7 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
 {
     DECLARE_SCENE_OBJECT(AnimatedModel);
     friend class AnimationsSystem;
+    friend class Animations;
 
     /// <summary>
     /// Describes the animation graph updates frequency for the animated model.
@@ -67,10 +69,21 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     AnimationUpdateMode _actualMode;
     uint32 _counter;
     Real _lastMinDstSqr;
+    float _lastMaxScreenSizeSqr = 0.0f;
     bool _isDuringUpdateEvent = false;
+    bool _interpolateOnly = false;
+    uint16 _deferredUpdates = 0;
+    float _updatePriority = 0.0f;
+    float _interpolationAlpha = 1.0f;
+    float _interpolationStep = 1.0f;
+    Array<Transform> _interpolationStart;
+    Array<Transform> _interpolationPose;
     uint64 _lastUpdateFrame;
+    PoolHandle _updateHandle;
     mutable MeshDeformation* _deformation = nullptr;
     ScriptingObjectReference<AnimatedModel> _masterPose;
+    ScriptingObjectReference<AnimatedModel> _sharedPose;
+    Delegate<> _sharedPoseUpdated;
     Array<Pair<String, float>> _blendShapeWeights;
     Array<BlendShapeMesh> _blendShapeMeshes;
 
@@ -119,6 +132,24 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     API_FIELD(Attributes="EditorOrder(50), DefaultValue(AnimationUpdateMode.Auto), EditorDisplay(\"Skinned Model\")")
     AnimationUpdateMode UpdateMode = AnimationUpdateMode::Auto;
 
+    /// <summary>
+    /// If checked, the updates skipped by the update mode (eg. every second update) will smoothly interpolate the skeleton between the evaluated poses instead of holding the last one. Adds a latency of a single animation update.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(55), DefaultValue(false), EditorDisplay(\"Skinned Model\")")
+    bool InterpolateSkippedUpdates = false;
+
+    /// <summary>
+    /// If checked, the model will share the evaluated skeleton pose with the other models that use the same skinned model, animation graph and shared pose group (eg. crowds). Only one of them evaluates the animation graph (using its own parameters) and the others reuse its pose and skinning buffer.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(56), DefaultValue(false), EditorDisplay(\"Skinned Model\")")
+    bool SharePose = false;
+
+    /// <summary>
+    /// The group of the shared pose (see SharePose). Only the models within the same group share the pose, can be used to split the crowd into a few variations (eg. with the different animation time offset).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(57), DefaultValue(0), VisibleIf(nameof(SharePose)), EditorDisplay(\"Skinned Model\")")
+    int32 SharedPoseGroup = 0;
+
     /// <summary>
     /// The master scale parameter for the actor bounding box. Helps reducing mesh flickering effect on screen edges.
     /// </summary>
@@ -406,9 +437,17 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
 
     void Update();
     void UpdateSockets();
+    void BeginPoseInterpolation();
+    void UpdatePoseInterpolation();
     void OnAnimationUpdated_Async();
     void OnAnimationUpdated_Sync();
     void OnAnimationUpdated();
+    void SetSharedPose(AnimatedModel* source);
+    void OnSharedPoseUpdated();
+    FORCE_INLINE SkinnedMeshDrawData& GetSkinningData()
+    {
+        return _sharedPose && _sharedPose->_skinningData.IsReady() ? _sharedPose->_skinningData : _skinningData;
+    }
 
     void OnSkinnedModelChanged();
     void OnSkinnedModelLoaded();
@@ -436,6 +475,7 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     bool GetMeshData(const MeshReference& mesh, MeshBufferType type, BytesContainer& result, int32& count) const override;
     void UpdateBounds() override;
     MeshDeformation* GetMeshDeformation() const override;
+    void PrefetchStreaming(double endTime) const override;
     void OnDeleteObject() override;
 
 protected:
@@ -2,6 +2,7 @@
 
 #include "ModelInstanceActor.h"
 #include "Engine/Content/Assets/MaterialInstance.h"
+#include "Engine/Content/Assets/ModelBase.h"
 #include "Engine/Level/Scene/SceneRendering.h"
 
 ModelInstanceActor::ModelInstanceActor(const SpawnParams& params)
@@ -52,6 +53,19 @@ void ModelInstanceActor::WaitForModelLoad()
 {
 }
 
+void ModelInstanceActor::PrefetchModel(const ModelBase* model, double endTime) const
+{
+    if (!model || !model->IsLoaded())
+        return;
+    model->Prefetch(endTime);
+    for (int32 i = 0; i < model->MaterialSlots.Count(); i++)
+    {
+        const MaterialBase* material = i < Entries.Count() && Entries[i].Material ? Entries[i].Material.Get() : model->MaterialSlots[i].Material.Get();
+        if (material && material->IsLoaded())
+            material->PrefetchTextures(endTime);
+    }
+}
+
 void ModelInstanceActor::OnLayerChanged()
 {
     if (_sceneRenderingKey != -1)
@@ -5,6 +5,8 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Graphics/Models/ModelInstanceEntry.h"
 
+class ModelBase;
+
 /// <summary>
 /// Base class for actor types that use ModelInstanceEntries for mesh rendering.
 /// </summary>
@@ -136,8 +138,17 @@ API_CLASS(Abstract) class FLAXENGINE_API ModelInstanceActor : public Actor
     /// </summary>
     virtual void UpdateBounds() = 0;
 
+    /// <summary>
+    /// Prefetches the streamed content used by this model instance (model LODs and material textures) so it gets streamed in before being visible (eg. on the predicted camera path).
+    /// </summary>
+    /// <param name="endTime">The time (see Platform::GetTimeSeconds) until which the content stays prefetched.</param>
+    virtual void PrefetchStreaming(double endTime) const
+    {
+    }
+
 protected:
     virtual void WaitForModelLoad();
+    void PrefetchModel(const ModelBase* model, double endTime) const;
 
 public:
     // [Actor]
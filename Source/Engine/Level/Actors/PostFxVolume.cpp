@@ -190,7 +190,7 @@ void PostFxVolume::Deserialize(DeserializeStream& stream, ISerializeModifier* mo
 
 void PostFxVolume::OnEnable()
 {
-    GetSceneRendering()->AddPostFxProvider(this);
+    GetSceneRendering()->AddPostFxProvider(this, _postFxHandle);
 
     // Base
     Actor::OnEnable();
@@ -198,7 +198,7 @@ void PostFxVolume::OnEnable()
 
 void PostFxVolume::OnDisable()
 {
-    GetSceneRendering()->RemovePostFxProvider(this);
+    GetSceneRendering()->RemovePostFxProvider(_postFxHandle);
 
     // Base
     Actor::OnDisable();
@@ -18,6 +18,7 @@ class FLAXENGINE_API PostFxVolume : public BoxVolume, public IPostFxSettingsProv
     float _blendRadius;
     float _blendWeight;
     bool _isBounded;
+    PoolHandle _postFxHandle;
 
 public:
     /// <summary>
@@ -12,6 +12,8 @@
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Renderer/ImpostorsPass.h"
+#include "Engine/Renderer/RenderList.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
 #include "Engine/Utilities/Encryption.h"
 #if USE_EDITOR
@@ -334,6 +336,8 @@ void StaticModel::Draw(RenderContext& renderContext)
             GlobalSurfaceAtlasPass::Instance()->RasterizeActor(this, this, _sphere, _transform, Model->LODs.Last().GetBox());
         return;
     }
+    if (ImpostorDistance > 0.0f && DrawImpostor(renderContext, &renderContext, 1))
+        return;
     Matrix world;
     GetLocalToWorldMatrix(world);
     renderContext.View.GetWorldMatrix(world);
@@ -372,6 +376,8 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
     if (!Model || !Model->IsLoaded())
         return;
     const RenderContext& renderContext = renderContextBatch.GetMainContext();
+    if (ImpostorDistance > 0.0f && DrawImpostor(renderContext, renderContextBatch.Contexts.Get(), renderContextBatch.Contexts.Count()))
+        return;
     Matrix world;
     GetLocalToWorldMatrix(world);
     renderContext.View.GetWorldMatrix(world);
@@ -405,6 +411,33 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
     GEOMETRY_DRAW_STATE_EVENT_END(_drawState, world);
 }
 
+bool StaticModel::DrawImpostor(const RenderContext& mainContext, const RenderContext* contexts, int32 contextsCount)
+{
+    // Switch to the impostor beyond the distance (main view decides for all contexts, like with model LOD selection)
+    const RenderView& lodView = mainContext.LodProxyView ? *mainContext.LodProxyView : mainContext.View;
+    if (Float3::Distance(lodView.Position, _sphere.Center - lodView.Origin) < ImpostorDistance || !Model->CanBeRendered())
+        return false;
+    const ModelImpostor* impostor = ImpostorsPass::Instance()->GetImpostor(Model);
+    if (!impostor)
+        return false;
+    ImpostorDrawCall drawCall;
+    drawCall.Impostor = impostor;
+    drawCall.Radius = (float)impostor->Bounds.Radius * _transform.Scale.GetAbsolute().MaxValue();
+    drawCall.Orientation = _transform.Orientation;
+    const Vector3 position = _transform.LocalToWorld(impostor->Bounds.Center);
+    for (int32 i = 0; i < contextsCount; i++)
+    {
+        const RenderContext& renderContext = contexts[i];
+        const RenderView& view = renderContext.View;
+        if (EnumHasNoneFlags(DrawModes & view.Pass, DrawPass::GBuffer | DrawPass::Depth) || (_staticFlags & view.StaticFlagsMask) != view.StaticFlagsCompare)
+            continue;
+        drawCall.Position = position - view.Origin;
+        if (view.CullingFrustum.Intersects(BoundingSphere(drawCall.Position, drawCall.Radius)))
+            renderContext.List->Impostors.Add(drawCall);
+    }
+    return true;
+}
+
 bool StaticModel::IntersectsItself(const Ray& ray, Real& distance, Vector3& normal)
 {
     bool result = false;
@@ -432,6 +465,7 @@ void StaticModel::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(ForcedLOD, _forcedLod);
     SERIALIZE_MEMBER(SortOrder, _sortOrder);
     SERIALIZE(DrawModes);
+    SERIALIZE(ImpostorDistance);
 
     if (HasLightmap()
 #if USE_EDITOR
@@ -484,6 +518,7 @@ void StaticModel::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_MEMBER(ForcedLOD, _forcedLod);
     DESERIALIZE_MEMBER(SortOrder, _sortOrder);
     DESERIALIZE(DrawModes);
+    DESERIALIZE(ImpostorDistance);
     DESERIALIZE_MEMBER(LightmapIndex, Lightmap.TextureIndex);
     DESERIALIZE_MEMBER(LightmapArea, Lightmap.UVsArea);
 
@@ -683,6 +718,11 @@ void StaticModel::OnDisable()
     }
 }
 
+void StaticModel::PrefetchStreaming(double endTime) const
+{
+    PrefetchModel(Model.Get(), endTime);
+}
+
 void StaticModel::WaitForModelLoad()
 {
     if (Model)
@@ -46,6 +46,12 @@ class FLAXENGINE_API StaticModel : public ModelInstanceActor
     API_FIELD(Attributes="EditorOrder(15), DefaultValue(DrawPass.Default), EditorDisplay(\"Model\")")
     DrawPass DrawModes = DrawPass::Default;
 
+    /// <summary>
+    /// The distance from the view (in world units) at which the model gets drawn as an impostor (octahedral billboard baked from the model). Value 0 disables impostor.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(55), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Model\")")
+    float ImpostorDistance = 0.0f;
+
     /// <summary>
     /// The baked lightmap entry.
     /// </summary>
@@ -158,6 +164,7 @@ class FLAXENGINE_API StaticModel : public ModelInstanceActor
     void OnModelLoaded();
     void OnModelResidencyChanged();
     void FlushVertexColors();
+    bool DrawImpostor(const RenderContext& mainContext, const RenderContext* contexts, int32 contextsCount);
 
 public:
     // [ModelInstanceActor]
@@ -174,6 +181,7 @@ class FLAXENGINE_API StaticModel : public ModelInstanceActor
     bool GetMeshData(const MeshReference& mesh, MeshBufferType type, BytesContainer& result, int32& count) const override;
     MeshDeformation* GetMeshDeformation() const override;
     void UpdateBounds() override;
+    void PrefetchStreaming(double endTime) const override;
 
 protected:
     // [ModelInstanceActor]
@@ -7,8 +7,11 @@
 #include "SceneObjectsFactory.h"
 #include "Scene/Scene.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Content/Loading/ContentLoadOrder.h"
 #include "Engine/Core/Cache.h"
 #include "Engine/Core/Collections/CollectionPoolCache.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HandlePool.h"
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Core/Config/LayersTagsSettings.h"
 #include "Engine/Core/Types/LayersMask.h"
@@ -23,6 +26,7 @@
 #include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Scripting/ManagedCLR/MAssembly.h"
@@ -92,6 +96,12 @@ class SceneAction
     {
         return true;
     }
+
+    // Returns false if action needs to continue in the next frame (Do gets called again).
+    virtual bool IsDone() const
+    {
+        return true;
+    }
 };
 
 #if USE_EDITOR
@@ -110,10 +120,17 @@ namespace LevelImpl
     Array<SceneAction*> _sceneActions;
     CriticalSection _sceneActionsLocker;
     DateTime _lastSceneLoadTime(0);
+    // The time limit for the scene loading work in the current frame
+    double _loadingEndTime = MAX_double;
 #if USE_EDITOR
     Array<ScriptsReloadObject> ScriptsReloadObjects;
 #endif
 
+    // Index of the actors during play (by type and name hash) used to find actors without walking the scenes hierarchy
+    CriticalSection _actorsIndexLocker;
+    Dictionary<const MClass*, HandlePool<Actor*>> _actorsByType;
+    Dictionary<uint32, HandlePool<Actor*>> _actorsByName;
+
     void CallSceneEvent(SceneEventType eventType, Scene* scene, Guid sceneId);
 
     void flushActions();
@@ -149,6 +166,7 @@ LevelService LevelServiceInstanceService;
 CriticalSection Level::ScenesLock;
 Array<Scene*> Level::Scenes;
 bool Level::TickEnabled = true;
+float Level::SceneLoadingTimeBudget = 0.0f;
 Delegate<Actor*> Level::ActorSpawned;
 Delegate<Actor*> Level::ActorDeleted;
 Delegate<Actor*, Actor*> Level::ActorParentChanged;
@@ -247,6 +265,7 @@ void LayersAndTagsSettings::Apply()
 
 #define TICK_LEVEL(tickingStage, name) \
     PROFILE_CPU_NAMED(name); \
+    PROFILE_MEM(Level); \
     ScopeLock lock(Level::ScenesLock); \
     auto& scenes = Level::Scenes; \
     if (!Time::GetGamePaused() && Level::TickEnabled) \
@@ -303,6 +322,9 @@ void LevelService::Dispose()
 {
     ScopeLock lock(_sceneActionsLocker);
 
+    // Cancel pending actions (eg. partially loaded scene)
+    _sceneActions.ClearDelete();
+
     // Unload scenes
     unloadScenes();
 
@@ -386,11 +408,414 @@ void Level::CollectPostFxVolumes(RenderContext& renderContext)
     }
 }
 
+// Scene loading split into resumable stages. Objects are spawned on job threads and the main thread work can be spread over many frames with a time budget (eg. to prevent hitches when streaming scenes during play).
+class SceneLoader
+{
+public:
+    enum class Stages
+    {
+        Begin,
+        Spawn,
+        SpawnWait,
+        SetupPrefabs,
+        Deserialize,
+        SyncPrefabs,
+        Initialize,
+        BeginPlay,
+        BeginPlayChildren,
+        Done,
+    };
+
+private:
+    rapidjson_flax::Value& _data;
+    ISerializeModifier _modifier;
+    SceneObjectsFactory::Context _context;
+    SceneObjectsFactory::PrefabSyncData* _prefabSyncData = nullptr;
+    SceneBeginData _beginData;
+    Array<SceneObject*> _objects;
+    Array<Actor*> _injectedSceneChildren;
+    Scene* _scene = nullptr;
+    Guid _sceneId;
+    bool _timeSliced;
+    int32 _dataCount = 0;
+    int32 _progress = 0;
+    int64 _spawnLabel = 0;
+    int64 volatile _spawnJobsLeft = 0;
+    int32 _framesCount = 0;
+    double _mainThreadTime = 0.0;
+    double _tickStartTime = 0.0;
+    Stopwatch _stopwatch;
+
+public:
+    Stages Stage = Stages::Begin;
+
+    SceneLoader(rapidjson_flax::Value& data, int32 engineBuild, bool timeSliced)
+        : _data(data)
+        , _context(&_modifier)
+        , _timeSliced(timeSliced)
+    {
+        _modifier.EngineBuild = engineBuild;
+    }
+
+    ~SceneLoader()
+    {
+        if (Stage == Stages::SpawnWait)
+            JobSystem::Wait(_spawnLabel);
+        if (Stage != Stages::Done && _scene)
+        {
+            // Loading has been canceled so remove partially loaded scene
+            ScopeLock lock(Level::ScenesLock);
+            if (_scene->IsDuringPlay())
+                _scene->EndPlay();
+            Level::Scenes.Remove(_scene);
+            for (int32 i = 1; i < _objects.Count(); i++)
+            {
+                SceneObject* obj = _objects[i];
+                if (obj && obj->GetParent() == nullptr)
+                    obj->DeleteObject();
+            }
+            _scene->DeleteObject();
+        }
+        if (_prefabSyncData)
+            Delete(_prefabSyncData);
+    }
+
+    Scene* GetScene() const
+    {
+        return _scene;
+    }
+
+    // Runs the loading stages until it's done or the time runs out. Returns true if failed.
+    bool Tick(double endTime)
+    {
+        PROFILE_CPU_NAMED("Level.LoadScene");
+        _tickStartTime = Platform::GetTimeSeconds();
+        _framesCount++;
+        bool failed = false;
+        while (Stage != Stages::Done && !failed)
+        {
+            bool wait = false;
+            failed = TickStage(endTime, wait);
+            if (wait || Platform::GetTimeSeconds() >= endTime)
+                break;
+        }
+        _mainThreadTime += Platform::GetTimeSeconds() - _tickStartTime;
+        return failed;
+    }
+
+private:
+    void SpawnObjects(int32 start, int32 end)
+    {
+        SceneObject** objects = _objects.Get();
+        for (int32 i = start; i < end; i++)
+        {
+            auto& stream = _data[i];
+            auto obj = SceneObjectsFactory::Spawn(_context, stream);
+            objects[i] = obj;
+            if (obj)
+            {
+                obj->RegisterObject();
+#if USE_EDITOR
+                // Auto-create C# objects for all actors in Editor during scene load when running in async (so main thread already has all of them)
+                if (_context.Async)
+                    obj->CreateManaged();
+#endif
+            }
+            else
+                SceneObjectsFactory::HandleObjectDeserializationError(stream);
+        }
+    }
+
+    bool TickStage(double endTime, bool& wait)
+    {
+        switch (Stage)
+        {
+        case Stages::Begin:
+        {
+            LOG(Info, "Loading scene...");
+            _stopwatch.Start();
+            _lastSceneLoadTime = DateTime::Now();
+            Stage = Stages::Done;
+
+            // Here whole scripting backend should be loaded for current project
+            // Later scripts will setup attached scripts and restore initial vars
+            if (!Scripting::HasGameModulesLoaded())
+            {
+                LOG(Error, "Cannot load scene without game modules loaded.");
+#if USE_EDITOR
+                if (!CommandLine::Options.Headless.IsTrue())
+                {
+                    if (ScriptsBuilder::LastCompilationFailed())
+                        MessageBox::Show(TEXT("Scripts compilation failed. Cannot load scene without game script modules. Please fix the compilation issues. See logs for more info."), TEXT("Failed to compile scripts"), MessageBoxButtons::OK, MessageBoxIcon::Error);
+                    else
+                        MessageBox::Show(TEXT("Failed to load scripts. Cannot load scene without game script modules. See logs for more info."), TEXT("Missing game modules"), MessageBoxButtons::OK, MessageBoxIcon::Error);
+                }
+#endif
+                return true;
+            }
+
+            // Peek meta
+            if (_modifier.EngineBuild < 6000)
+            {
+                LOG(Error, "Invalid serialized engine build.");
+                return true;
+            }
+            if (!_data.IsArray())
+            {
+                LOG(Error, "Invalid Data member.");
+                return true;
+            }
+
+            // Peek scene node value (it's the first actor serialized)
+            _sceneId = JsonTools::GetGuid(_data[0], "ID");
+            if (!_sceneId.IsValid())
+            {
+                LOG(Error, "Invalid scene id.");
+                return true;
+            }
+
+            // Skip is that scene is already loaded
+            if (Level::FindScene(_sceneId) != nullptr)
+            {
+                LOG(Info, "Scene {0} is already loaded.", _sceneId);
+                return false;
+            }
+
+            // Create scene actor
+            // Note: the first object in the scene file data is a Scene Actor
+            _scene = New<Scene>(ScriptingObjectSpawnParams(_sceneId, Scene::TypeInitializer));
+            _scene->RegisterObject();
+            _scene->Deserialize(_data[0], &_modifier);
+
+            // Fire event
+            CallSceneEvent(SceneEventType::OnSceneLoading, _scene, _sceneId);
+
+            // Get any injected children of the scene.
+            _injectedSceneChildren = _scene->Children;
+
+            _dataCount = (int32)_data.Size();
+            _objects.Resize(_dataCount);
+            _objects[0] = _scene;
+            _context.Async = JobSystem::GetThreadsCount() > 1 && _dataCount > 10;
+            Stage = Stages::Spawn;
+            break;
+        }
+        case Stages::Spawn:
+        {
+            PROFILE_CPU_NAMED("Spawn");
+            if (_context.Async)
+            {
+                // Spawn all scene objects on job threads (start from 1. at index [0] was scene)
+                const int32 jobCount = Math::Min(JobSystem::GetThreadsCount(), _dataCount - 1);
+                _spawnJobsLeft = jobCount;
+                Function<void(int32)> job = [this, jobCount](int32 jobIndex)
+                {
+                    const int32 count = _dataCount - 1;
+                    const int32 start = 1 + (int32)((int64)count * jobIndex / jobCount);
+                    const int32 end = 1 + (int32)((int64)count * (jobIndex + 1) / jobCount);
+                    SpawnObjects(start, end);
+                    Platform::InterlockedDecrement(&_spawnJobsLeft);
+                };
+                _spawnLabel = JobSystem::Dispatch(job, jobCount);
+                Stage = Stages::SpawnWait;
+                if (!_timeSliced)
+                {
+                    Level::ScenesLock.Unlock(); // Unlock scenes from Main Thread so Job Threads can use it to safely setup actors hierarchy (see Actor::Deserialize)
+                    JobSystem::Wait(_spawnLabel);
+                    Level::ScenesLock.Lock();
+                }
+            }
+            else
+            {
+                SpawnObjects(1, _dataCount);
+                Stage = Stages::SetupPrefabs;
+            }
+            break;
+        }
+        case Stages::SpawnWait:
+            if (Platform::AtomicRead(&_spawnJobsLeft) > 0)
+            {
+                // Check again in the next frame
+                wait = true;
+                break;
+            }
+            Stage = Stages::SetupPrefabs;
+            break;
+        case Stages::SetupPrefabs:
+            // Capture prefab instances in a scene to restore any missing objects (eg. newly added objects to prefab that are missing in scene file)
+            _prefabSyncData = New<SceneObjectsFactory::PrefabSyncData>(_objects, _data, &_modifier);
+            SceneObjectsFactory::SetupPrefabInstances(_context, *_prefabSyncData);
+            // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
+            SceneObjectsFactory::SynchronizeNewPrefabInstances(_context, *_prefabSyncData);
+            _progress = 1; // Start from 1. at index [0] was scene
+            Stage = Stages::Deserialize;
+            break;
+        case Stages::Deserialize:
+        {
+            // Load all scene objects
+            // TODO: before doing full async for scene objects fix:
+            // TODO: - fix Actor's Scripts and Children order when loading objects data out of order via async jobs
+            // TODO: - add _loadNoAsync flag to SceneObject or Actor to handle non-async loading for those types (eg. UIControl/UICanvas)
+            PROFILE_CPU_NAMED("Deserialize");
+            const bool wasAsync = _context.Async;
+            _context.Async = false;
+            Scripting::ObjectsLookupIdMapping.Set(&_modifier.IdsMapping);
+            SceneObject** objects = _objects.Get();
+            while (_progress < _dataCount)
+            {
+                auto& objData = _data[_progress];
+                auto obj = objects[_progress++];
+                if (obj)
+                    SceneObjectsFactory::Deserialize(_context, obj, objData);
+                if (Platform::GetTimeSeconds() >= endTime)
+                    break;
+            }
+            Scripting::ObjectsLookupIdMapping.Set(nullptr);
+            _context.Async = wasAsync;
+            ZoneValue(_progress);
+            if (_progress == _dataCount)
+                Stage = Stages::SyncPrefabs;
+            break;
+        }
+        case Stages::SyncPrefabs:
+            // Add injected children of scene (via OnSceneLoading) into sceneObjects to be initialized
+            for (auto child : _injectedSceneChildren)
+            {
+                Array<SceneObject*> injectedSceneObjects;
+                injectedSceneObjects.Add(child);
+                SceneQuery::GetAllSceneObjects(child, injectedSceneObjects);
+                for (auto o : injectedSceneObjects)
+                {
+                    if (!o->IsRegistered())
+                        o->RegisterObject();
+                    _objects.Add(o);
+                }
+            }
+
+            // Synchronize prefab instances (prefab may have objects removed or reordered so deserialized instances need to synchronize with it)
+            // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
+            SceneObjectsFactory::SynchronizePrefabInstances(_context, *_prefabSyncData);
+
+            // Cache transformations
+            {
+                PROFILE_CPU_NAMED("Cache Transform");
+
+                _scene->OnTransformChanged();
+            }
+            _progress = 0;
+            Stage = Stages::Initialize;
+            break;
+        case Stages::Initialize:
+        {
+            // Initialize scene objects
+            PROFILE_CPU_NAMED("Initialize");
+            while (_progress < _objects.Count())
+            {
+                const int32 i = _progress++;
+                SceneObject* obj = _objects[i];
+                if (obj)
+                {
+                    obj->Initialize();
+                    obj->Flags &= ~ObjectFlags::IsDirty;
+                    _scene->_baselineObjects.Add(obj->GetID());
+
+                    // Delete objects without parent
+                    if (i != 0 && obj->GetParent() == nullptr)
+                    {
+                        LOG(Warning, "Scene object {0} {1} has missing parent object after load. Removing it.", obj->GetID(), obj->ToString());
+                        obj->DeleteObject();
+                    }
+                }
+                if (Platform::GetTimeSeconds() >= endTime)
+                    break;
+            }
+            ZoneValue(_progress);
+            if (_progress == _objects.Count())
+            {
+                _prefabSyncData->InitNewObjects();
+                Stage = Stages::BeginPlay;
+            }
+            break;
+        }
+        case Stages::BeginPlay:
+        {
+            // Link scene and call init
+            PROFILE_CPU_NAMED("BeginPlay");
+            ScopeLock lock(Level::ScenesLock);
+            Level::Scenes.Add(_scene);
+            if (_timeSliced)
+            {
+                // Begin play only the scene actor, its children are started one-by-one
+                Array<Actor*> children = MoveTemp(_scene->Children);
+                _scene->BeginPlay(&_beginData);
+                children.Add(_scene->Children); // Actors added during scene begin play (eg. CSG collider)
+                _scene->Children = MoveTemp(children);
+            }
+            else
+            {
+                _scene->BeginPlay(&_beginData);
+            }
+            _progress = 0;
+            Stage = Stages::BeginPlayChildren;
+            break;
+        }
+        case Stages::BeginPlayChildren:
+        {
+            PROFILE_CPU_NAMED("BeginPlay");
+            ScopeLock lock(Level::ScenesLock);
+            if (!Level::Scenes.Contains(_scene))
+            {
+                // Scene has been unloaded during loading
+                _scene = nullptr;
+                Stage = Stages::Done;
+                break;
+            }
+            const auto& children = _scene->Children;
+            while (_progress < children.Count())
+            {
+                Actor* child = children.Get()[_progress++];
+                if (!child->IsDuringPlay())
+                    child->BeginPlay(&_beginData);
+                if (Platform::GetTimeSeconds() >= endTime)
+                    break;
+            }
+            ZoneValue(_progress);
+            if (_progress < children.Count())
+                break;
+
+            // Scene children could be modified in between the frames so ensure none is missed
+            for (int32 i = 0; i < children.Count(); i++)
+            {
+                Actor* child = children.Get()[i];
+                if (!child->IsDuringPlay())
+                    child->BeginPlay(&_beginData);
+            }
+            _beginData.OnDone();
+            Stage = Stages::Done;
+
+            // Fire event
+            CallSceneEvent(SceneEventType::OnSceneLoaded, _scene, _sceneId);
+
+            _stopwatch.Stop();
+            if (_framesCount > 1)
+                LOG(Info, "Scene loaded in {0}ms ({1} frames, {2}ms on main thread)", _stopwatch.GetMilliseconds(), _framesCount, (int32)((_mainThreadTime + Platform::GetTimeSeconds() - _tickStartTime) * 1000.0));
+            else
+                LOG(Info, "Scene loaded in {0}ms", _stopwatch.GetMilliseconds());
+            break;
+        }
+        default:
+            break;
+        }
+        return false;
+    }
+};
+
 class LoadSceneAction : public SceneAction
 {
 public:
     Guid SceneId;
     AssetReference<JsonAsset> SceneAsset;
+    mutable SceneLoader* Loader = nullptr;
 
     LoadSceneAction(const Guid& sceneId, JsonAsset* sceneAsset)
     {
@@ -398,26 +823,49 @@ class LoadSceneAction : public SceneAction
         SceneAsset = sceneAsset;
     }
 
+    ~LoadSceneAction()
+    {
+        if (Loader)
+            Delete(Loader);
+    }
+
     bool CanDo() const override
     {
         return SceneAsset == nullptr || SceneAsset->IsLoaded();
     }
 
+    bool IsDone() const override
+    {
+        return Loader == nullptr || Loader->Stage == SceneLoader::Stages::Done;
+    }
+
     bool Do() const override
     {
-        // Now to deserialize scene in a proper way we need to load scripting
-        if (!Scripting::IsEveryAssemblyLoaded())
+        if (Loader == nullptr)
         {
-            LOG(Error, "Scripts must be compiled without any errors in order to load a scene.");
+            // Now to deserialize scene in a proper way we need to load scripting
+            if (!Scripting::IsEveryAssemblyLoaded())
+            {
+                LOG(Error, "Scripts must be compiled without any errors in order to load a scene.");
 #if USE_EDITOR
-            Platform::Error(TEXT("Scripts must be compiled without any errors in order to load a scene. Please fix it."));
+                Platform::Error(TEXT("Scripts must be compiled without any errors in order to load a scene. Please fix it."));
 #endif
-            CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
-            return true;
+                CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
+                return true;
+            }
+
+            if (SceneAsset == nullptr || SceneAsset->WaitForLoaded())
+            {
+                LOG(Error, "Cannot load scene asset.");
+                CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
+                return true;
+            }
+            Loader = New<SceneLoader>(*SceneAsset->Data, SceneAsset->DataEngineBuild, Level::SceneLoadingTimeBudget > 0.0f);
         }
 
-        // Load scene
-        if (Level::loadScene(SceneAsset))
+        // Load scene (can take multiple frames)
+        ScopeLock lock(Level::ScenesLock);
+        if (Loader->Tick(_loadingEndTime))
         {
             LOG(Error, "Failed to deserialize scene {0}", SceneId);
             CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
@@ -761,14 +1209,71 @@ void Level::callActorEvent(ActorEventType eventType, Actor* a, Actor* b)
     }
 }
 
+void Level::despawnActor(Actor* a)
+{
+    // Leave the play the same way as when deleting actor (see Actor::OnDeleteObject)
+    if (a->IsDuringPlay())
+    {
+        if (a->_parent && a->_parent->IsDuringPlay())
+            callActorEvent(ActorEventType::OnActorDeleted, a, nullptr);
+        a->EndPlay();
+    }
+
+    // Unlink from the parent and scene
+    ScopeLock lock(ScenesLock);
+    if (a->_parent)
+    {
+        a->_parent->Children.RemoveKeepOrder(a);
+        a->_parent = nullptr;
+    }
+    a->SetSceneInHierarchy(nullptr);
+}
+
+void Level::indexActor(Actor* a)
+{
+    ScopeLock lock(_actorsIndexLocker);
+    a->_typeIndexHandle = _actorsByType[a->GetClass()].Add(a);
+    a->_nameIndexHash = GetHash(a->_name);
+    a->_nameIndexHandle = _actorsByName[a->_nameIndexHash].Add(a);
+}
+
+void Level::unindexActor(Actor* a)
+{
+    ScopeLock lock(_actorsIndexLocker);
+    auto* actors = _actorsByType.TryGet(a->GetClass());
+    if (actors && !actors->RemoveAndReset(a->_typeIndexHandle) && actors->IsEmpty())
+        _actorsByType.Remove(a->GetClass());
+    actors = _actorsByName.TryGet(a->_nameIndexHash);
+    if (actors && !actors->RemoveAndReset(a->_nameIndexHandle) && actors->IsEmpty())
+        _actorsByName.Remove(a->_nameIndexHash);
+}
+
+void Level::reindexActorName(Actor* a)
+{
+    const uint32 nameHash = GetHash(a->_name);
+    ScopeLock lock(_actorsIndexLocker);
+    if (!a->_nameIndexHandle.IsValid() || a->_nameIndexHash == nameHash)
+        return;
+    auto* actors = _actorsByName.TryGet(a->_nameIndexHash);
+    if (actors && !actors->RemoveAndReset(a->_nameIndexHandle) && actors->IsEmpty())
+        _actorsByName.Remove(a->_nameIndexHash);
+    a->_nameIndexHash = nameHash;
+    a->_nameIndexHandle = _actorsByName[nameHash].Add(a);
+}
+
 void LevelImpl::flushActions()
 {
     ScopeLock lock(_sceneActionsLocker);
 
+    const float loadingTimeBudget = Level::SceneLoadingTimeBudget;
+    _loadingEndTime = loadingTimeBudget > 0.0f ? Platform::GetTimeSeconds() + loadingTimeBudget * 0.001 : MAX_double;
     while (_sceneActions.HasItems() && _sceneActions.First()->CanDo())
     {
-        const auto action = _sceneActions.Dequeue();
+        const auto action = _sceneActions.First();
         action->Do();
+        if (!action->IsDone())
+            break; // Continue in the next frame
+        _sceneActions.Dequeue();
         Delete(action);
     }
 }
@@ -840,15 +1345,8 @@ bool Level::loadScene(const BytesContainer& sceneData, Scene** outScene)
 
     // Parse scene JSON file
     rapidjson_flax::Document document;
-    {
-        PROFILE_CPU_NAMED("Json.Parse");
-        document.Parse(sceneData.Get<char>(), sceneData.Length());
-    }
-    if (document.HasParseError())
-    {
-        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+    if (JsonTools::ParseDocument(document, sceneData.Get<char>(), sceneData.Length()))
         return true;
-    }
 
     ScopeLock lock(ScenesLock);
     return loadScene(document, outScene);
@@ -868,241 +1366,13 @@ bool Level::loadScene(rapidjson_flax::Document& document, Scene** outScene)
 
 bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** outScene)
 {
-    PROFILE_CPU_NAMED("Level.LoadScene");
     if (outScene)
         *outScene = nullptr;
-    LOG(Info, "Loading scene...");
-    Stopwatch stopwatch;
-    _lastSceneLoadTime = DateTime::Now();
-
-    // Here whole scripting backend should be loaded for current project
-    // Later scripts will setup attached scripts and restore initial vars
-    if (!Scripting::HasGameModulesLoaded())
-    {
-        LOG(Error, "Cannot load scene without game modules loaded.");
-#if USE_EDITOR
-        if (!CommandLine::Options.Headless.IsTrue())
-        {
-            if (ScriptsBuilder::LastCompilationFailed())
-                MessageBox::Show(TEXT("Scripts compilation failed. Cannot load scene without game script modules. Please fix the compilation issues. See logs for more info."), TEXT("Failed to compile scripts"), MessageBoxButtons::OK, MessageBoxIcon::Error);
-            else
-                MessageBox::Show(TEXT("Failed to load scripts. Cannot load scene without game script modules. See logs for more info."), TEXT("Missing game modules"), MessageBoxButtons::OK, MessageBoxIcon::Error);
-        }
-#endif
-        return true;
-    }
-
-    // Peek meta
-    if (engineBuild < 6000)
-    {
-        LOG(Error, "Invalid serialized engine build.");
+    SceneLoader loader(data, engineBuild, false);
+    if (loader.Tick(MAX_double))
         return true;
-    }
-    if (!data.IsArray())
-    {
-        LOG(Error, "Invalid Data member.");
-        return true;
-    }
-
-    // Peek scene node value (it's the first actor serialized)
-    auto sceneId = JsonTools::GetGuid(data[0], "ID");
-    if (!sceneId.IsValid())
-    {
-        LOG(Error, "Invalid scene id.");
-        return true;
-    }
-    auto modifier = Cache::ISerializeModifier.Get();
-    modifier->EngineBuild = engineBuild;
-
-    // Skip is that scene is already loaded
-    if (FindScene(sceneId) != nullptr)
-    {
-        LOG(Info, "Scene {0} is already loaded.", sceneId);
-        return false;
-    }
-
-    // Create scene actor
-    // Note: the first object in the scene file data is a Scene Actor
-    auto scene = New<Scene>(ScriptingObjectSpawnParams(sceneId, Scene::TypeInitializer));
-    scene->RegisterObject();
-    scene->Deserialize(data[0], modifier.Value);
-
-    // Fire event
-    CallSceneEvent(SceneEventType::OnSceneLoading, scene, sceneId);
-
-    // Get any injected children of the scene.
-    Array<Actor*> injectedSceneChildren = scene->Children;
-
-    // Loaded scene objects list
-    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
-    const int32 dataCount = (int32)data.Size();
-    sceneObjects->Resize(dataCount);
-    sceneObjects->At(0) = scene;
-
-    // Spawn all scene objects
-    SceneObjectsFactory::Context context(modifier.Value);
-    context.Async = JobSystem::GetThreadsCount() > 1 && dataCount > 10;
-    {
-        PROFILE_CPU_NAMED("Spawn");
-        SceneObject** objects = sceneObjects->Get();
-        if (context.Async)
-        {
-            ScenesLock.Unlock(); // Unlock scenes from Main Thread so Job Threads can use it to safely setup actors hierarchy (see Actor::Deserialize)
-            JobSystem::Execute([&](int32 i)
-            {
-                i++; // Start from 1. at index [0] was scene
-                auto& stream = data[i];
-                auto obj = SceneObjectsFactory::Spawn(context, stream);
-                objects[i] = obj;
-                if (obj)
-                {
-                    obj->RegisterObject();
-#if USE_EDITOR
-                    // Auto-create C# objects for all actors in Editor during scene load when running in async (so main thread already has all of them)
-                    obj->CreateManaged();
-#endif
-                }
-                else
-                    SceneObjectsFactory::HandleObjectDeserializationError(stream);
-            }, dataCount - 1);
-            ScenesLock.Lock();
-        }
-        else
-        {
-            for (int32 i = 1; i < dataCount; i++) // start from 1. at index [0] was scene
-            {
-                auto& stream = data[i];
-                auto obj = SceneObjectsFactory::Spawn(context, stream);
-                sceneObjects->At(i) = obj;
-                if (obj)
-                    obj->RegisterObject();
-                else
-                    SceneObjectsFactory::HandleObjectDeserializationError(stream);
-            }
-        }
-    }
-
-    // Capture prefab instances in a scene to restore any missing objects (eg. newly added objects to prefab that are missing in scene file)
-    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
-    SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
-    // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
-    SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
-
-    // /\ all above this has to be done on an any thread
-    // \/ all below this has to be done on multiple threads at once
-
-    // Load all scene objects
-    {
-        PROFILE_CPU_NAMED("Deserialize");
-        SceneObject** objects = sceneObjects->Get();
-        bool wasAsync = context.Async;
-        context.Async = false; // TODO: before doing full async for scene objects fix:
-        // TODO: - fix Actor's Scripts and Children order when loading objects data out of order via async jobs
-        // TODO: - add _loadNoAsync flag to SceneObject or Actor to handle non-async loading for those types (eg. UIControl/UICanvas)
-        if (context.Async)
-        {
-            ScenesLock.Unlock(); // Unlock scenes from Main Thread so Job Threads can use it to safely setup actors hierarchy (see Actor::Deserialize)
-            JobSystem::Execute([&](int32 i)
-            {
-                i++; // Start from 1. at index [0] was scene
-                auto obj = objects[i];
-                if (obj)
-                {
-                    auto& idMapping = Scripting::ObjectsLookupIdMapping.Get();
-                    idMapping = &context.GetModifier()->IdsMapping;
-                    SceneObjectsFactory::Deserialize(context, obj, data[i]);
-                    idMapping = nullptr;
-                }
-            }, dataCount - 1);
-            ScenesLock.Lock();
-        }
-        else
-        {
-            Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
-            for (int32 i = 1; i < dataCount; i++) // start from 1. at index [0] was scene
-            {
-                auto& objData = data[i];
-                auto obj = objects[i];
-                if (obj)
-                    SceneObjectsFactory::Deserialize(context, obj, objData);
-            }
-            Scripting::ObjectsLookupIdMapping.Set(nullptr);
-        }
-        context.Async = wasAsync;
-    }
-
-    // /\ all above this has to be done on multiple threads at once
-    // \/ all below this has to be done on an any thread
-
-    // Add injected children of scene (via OnSceneLoading) into sceneObjects to be initialized
-    for (auto child : injectedSceneChildren)
-    {
-        Array<SceneObject*> injectedSceneObjects;
-        injectedSceneObjects.Add(child);
-        SceneQuery::GetAllSceneObjects(child, injectedSceneObjects);
-        for (auto o : injectedSceneObjects)
-        {
-            if (!o->IsRegistered())
-                o->RegisterObject();
-            sceneObjects->Add(o);
-        }
-    }
-
-    // Synchronize prefab instances (prefab may have objects removed or reordered so deserialized instances need to synchronize with it)
-    // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
-    SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
-
-    // Cache transformations
-    {
-        PROFILE_CPU_NAMED("Cache Transform");
-
-        scene->OnTransformChanged();
-    }
-
-    // Initialize scene objects
-    {
-        PROFILE_CPU_NAMED("Initialize");
-
-        SceneObject** objects = sceneObjects->Get();
-        for (int32 i = 0; i < sceneObjects->Count(); i++)
-        {
-            SceneObject* obj = objects[i];
-            if (obj)
-            {
-                obj->Initialize();
-
-                // Delete objects without parent
-                if (i != 0 && obj->GetParent() == nullptr)
-                {
-                    LOG(Warning, "Scene object {0} {1} has missing parent object after load. Removing it.", obj->GetID(), obj->ToString());
-                    obj->DeleteObject();
-                }
-            }
-        }
-        prefabSyncData.InitNewObjects();
-    }
-
-    // /\ all above this has to be done on an any thread
-    // \/ all below this has to be done on a main thread
-
-    // Link scene and call init
-    {
-        PROFILE_CPU_NAMED("BeginPlay");
-
-        ScopeLock lock(ScenesLock);
-        Scenes.Add(scene);
-        SceneBeginData beginData;
-        scene->BeginPlay(&beginData);
-        beginData.OnDone();
-    }
-
-    // Fire event
-    CallSceneEvent(SceneEventType::OnSceneLoaded, scene, sceneId);
-
-    stopwatch.Stop();
-    LOG(Info, "Scene loaded in {0}ms", stopwatch.GetMilliseconds());
     if (outScene)
-        *outScene = scene;
+        *outScene = loader.GetScene();
     return false;
 }
 
@@ -1132,21 +1402,24 @@ bool LevelImpl::saveScene(Scene* scene, const String& path)
     Stopwatch stopwatch;
 
     // Serialize to json
-    rapidjson_flax::StringBuffer buffer;
-    if (saveScene(scene, buffer, true) && buffer.GetSize() > 0)
+    auto buffer = Cache::JsonBuffer.Get();
+    if (saveScene(scene, *buffer.Value, true) && buffer->GetSize() > 0)
     {
         CallSceneEvent(SceneEventType::OnSceneSaveError, scene, sceneId);
         return true;
     }
 
     // Save json to file
-    if (File::WriteAllBytes(path, (byte*)buffer.GetString(), (int32)buffer.GetSize()))
+    if (File::WriteAllBytes(path, (byte*)buffer->GetString(), (int32)buffer->GetSize()))
     {
         LOG(Error, "Cannot save scene file");
         CallSceneEvent(SceneEventType::OnSceneSaveError, scene, sceneId);
         return true;
     }
 
+    // Saved asset is the new baseline for the scene delta
+    scene->ResetDeltaBaseline();
+
     stopwatch.Stop();
     LOG(Info, "Scene saved! Time {0}ms", stopwatch.GetMilliseconds());
 
@@ -1191,6 +1464,7 @@ bool LevelImpl::saveScene(Scene* scene, rapidjson_flax::StringBuffer& outBuffer,
     // Get all objects in the scene
     Array<SceneObject*> allObjects;
     SceneQuery::GetAllSerializableSceneObjects(scene, allObjects);
+    outBuffer.Reserve(allObjects.Count() * 512);
 
     // Serialize to json
     writer.StartObject();
@@ -1250,14 +1524,159 @@ bool Level::SaveSceneToBytes(Scene* scene, rapidjson_flax::StringBuffer& outData
 Array<byte> Level::SaveSceneToBytes(Scene* scene, bool prettyJson)
 {
     Array<byte> data;
-    rapidjson_flax::StringBuffer sceneData;
-    if (!SaveSceneToBytes(scene, sceneData, prettyJson))
+    auto sceneData = Cache::JsonBuffer.Get();
+    if (!SaveSceneToBytes(scene, *sceneData.Value, prettyJson))
     {
-        data.Set((const byte*)sceneData.GetString(), (int32)sceneData.GetSize() * sizeof(rapidjson_flax::StringBuffer::Ch));
+        data.Set((const byte*)sceneData->GetString(), (int32)sceneData->GetSize() * sizeof(rapidjson_flax::StringBuffer::Ch));
     }
     return data;
 }
 
+bool IsSceneDeltaObject(SceneObject* obj, Scene* scene)
+{
+    if (!obj || EnumHasAnyFlags(obj->Flags, ObjectFlags::WasMarkedToDelete))
+        return false;
+    if (obj == scene)
+        return true;
+    const Actor* parent = obj->GetParent();
+    return parent && parent->GetScene() == scene;
+}
+
+Array<byte> Level::SaveSceneDeltaToBytes(Scene* scene)
+{
+    Array<byte> data;
+    CHECK_RETURN(scene, data);
+    PROFILE_CPU_NAMED("Level.SaveSceneDelta");
+    ScopeLock lock(_sceneActionsLocker);
+
+    // Get all objects in the scene
+    Array<SceneObject*> allObjects;
+    SceneQuery::GetAllSerializableSceneObjects(scene, allObjects);
+
+    // Serialize to json
+    auto buffer = Cache::JsonBuffer.Get();
+    CompactJsonWriter writerObj(*buffer.Value);
+    JsonWriter& writer = writerObj;
+    writer.StartObject();
+    {
+        // Header
+        writer.JKEY("ID");
+        writer.Guid(scene->GetID());
+        writer.JKEY("TypeName");
+        writer.String("FlaxEngine.SceneDelta");
+        writer.JKEY("EngineBuild");
+        writer.Int(FLAXENGINE_VERSION_BUILD);
+
+        // Objects modified or added since load
+        writer.JKEY("Data");
+        writer.StartArray();
+        for (SceneObject* obj : allObjects)
+        {
+            if (obj->IsDirty() || !scene->_baselineObjects.Contains(obj->GetID()))
+                writer.SceneObject(obj);
+        }
+        writer.EndArray();
+
+        // Objects removed since load
+        writer.JKEY("Removed");
+        writer.StartArray();
+        for (const auto& e : scene->_baselineObjects)
+        {
+            if (!IsSceneDeltaObject(Scripting::TryFindObject<SceneObject>(e.Item), scene))
+                writer.Guid(e.Item);
+        }
+        writer.EndArray();
+    }
+    writer.EndObject();
+
+    data.Set((const byte*)buffer->GetString(), (int32)buffer->GetSize());
+    return data;
+}
+
+Scene* Level::LoadSceneDeltaFromBytes(const BytesContainer& data)
+{
+    PROFILE_CPU_NAMED("Level.LoadSceneDelta");
+    if (data.IsInvalid())
+    {
+        LOG(Error, "Missing scene delta data.");
+        return nullptr;
+    }
+    rapidjson_flax::Document delta;
+    if (JsonTools::ParseDocument(delta, data.Get<char>(), data.Length()))
+        return nullptr;
+    const Guid sceneId = JsonTools::GetGuid(delta, "ID");
+    auto deltaData = delta.FindMember("Data");
+    if (!sceneId.IsValid() || deltaData == delta.MemberEnd() || !deltaData->value.IsArray())
+    {
+        LOG(Error, "Invalid scene delta data.");
+        return nullptr;
+    }
+
+    // Load the scene asset used as a baseline
+    AssetReference<JsonAsset> sceneAsset = Content::LoadAsync<JsonAsset>(sceneId);
+    if (sceneAsset == nullptr || sceneAsset->WaitForLoaded())
+    {
+        LOG(Error, "Cannot load scene asset.");
+        return nullptr;
+    }
+
+    // Merge the delta with the scene asset data (modified objects are replaced, removed are skipped and added are placed at the end)
+    Dictionary<Guid, rapidjson_flax::Value*> modified;
+    for (auto& e : deltaData->value.GetArray())
+        modified[JsonTools::GetGuid(e, "ID")] = &e;
+    HashSet<Guid> removed;
+    auto deltaRemoved = delta.FindMember("Removed");
+    if (deltaRemoved != delta.MemberEnd() && deltaRemoved->value.IsArray())
+    {
+        for (auto& e : deltaRemoved->value.GetArray())
+            removed.Add(JsonTools::GetGuid(e));
+    }
+    HashSet<Guid> baseline;
+    rapidjson_flax::Document merged;
+    merged.SetArray();
+    auto& allocator = merged.GetAllocator();
+    for (auto& e : sceneAsset->Data->GetArray())
+    {
+        const Guid id = JsonTools::GetGuid(e, "ID");
+        baseline.Add(id);
+        if (removed.Contains(id))
+            continue;
+        rapidjson_flax::Value* value;
+        if (modified.TryGet(id, value))
+            merged.PushBack(*value, allocator); // Moves the value (leaves null)
+        else
+            merged.PushBack(rapidjson_flax::Value(e, allocator), allocator);
+    }
+    for (auto& e : deltaData->value.GetArray())
+    {
+        if (!e.IsNull())
+            merged.PushBack(e, allocator);
+    }
+
+    // Load scene
+    Scene* scene = nullptr;
+    {
+        ScopeLock lock(ScenesLock);
+        if (loadScene(merged, sceneAsset->DataEngineBuild, &scene))
+            scene = nullptr;
+    }
+    if (!scene)
+    {
+        LOG(Error, "Failed to load scene delta");
+        CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, sceneId);
+        return nullptr;
+    }
+
+    // Keep the scene asset as a baseline so the next delta includes the changes loaded from this one
+    scene->_baselineObjects = MoveTemp(baseline);
+    for (const auto& e : modified)
+    {
+        if (SceneObject* obj = Scripting::TryFindObject<SceneObject>(e.Key))
+            obj->MarkDirty();
+    }
+    return scene;
+}
+
 void Level::SaveSceneAsync(Scene* scene)
 {
     ScopeLock lock(_sceneActionsLocker);
@@ -1310,6 +1729,8 @@ bool Level::LoadScene(const Guid& id)
     }
 
     // Preload scene asset
+    if (ContentLoadOrder::IsRecording())
+        ContentLoadOrder::BeginScene(id);
     const auto sceneAsset = Content::LoadAsync<JsonAsset>(id);
     if (sceneAsset == nullptr)
     {
@@ -1349,6 +1770,8 @@ bool Level::LoadSceneAsync(const Guid& id)
     }
 
     // Preload scene asset
+    if (ContentLoadOrder::IsRecording())
+        ContentLoadOrder::BeginScene(id);
     const auto sceneAsset = Content::LoadAsync<JsonAsset>(id);
     if (sceneAsset == nullptr)
     {
@@ -1403,31 +1826,50 @@ Actor* Level::FindActor(const Guid& id)
 
 Actor* Level::FindActor(const StringView& name)
 {
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(name);
-    return result;
+    ScopeLock lock(_actorsIndexLocker);
+    const auto* actors = _actorsByName.TryGet(GetHash(name));
+    if (actors)
+    {
+        for (Actor* actor : *actors)
+        {
+            if (actor->GetScene() && actor->_name == name)
+                return actor;
+        }
+    }
+    return nullptr;
 }
 
 Actor* Level::FindActor(const MClass* type, bool activeOnly)
 {
     CHECK_RETURN(type, nullptr);
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, activeOnly);
-    return result;
+    ScopeLock lock(_actorsIndexLocker);
+    for (const auto& e : _actorsByType)
+    {
+        if (!e.Key || !e.Key->IsSubClassOf(type))
+            continue;
+        for (Actor* actor : e.Value)
+        {
+            if (actor->GetScene() && (!activeOnly || actor->IsActiveInHierarchy()))
+                return actor;
+        }
+    }
+    return nullptr;
 }
 
 Actor* Level::FindActor(const MClass* type, const StringView& name)
 {
     CHECK_RETURN(type, nullptr);
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, name);
-    return result;
+    ScopeLock lock(_actorsIndexLocker);
+    const auto* actors = _actorsByName.TryGet(GetHash(name));
+    if (actors)
+    {
+        for (Actor* actor : *actors)
+        {
+            if (actor->GetScene() && actor->_name == name && actor->GetClass()->IsSubClassOf(type))
+                return actor;
+        }
+    }
+    return nullptr;
 }
 
 Actor* FindActorRecursive(Actor* node, const Tag& tag, bool activeOnly)
@@ -1509,11 +1951,18 @@ Actor* Level::FindActor(const MClass* type, const Tag& tag, bool activeOnly, Act
     CHECK_RETURN(type, nullptr);
     if (root)
         return FindActorRecursiveByType(root, type, tag, activeOnly);
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, tag, activeOnly);
-    return result;
+    ScopeLock lock(_actorsIndexLocker);
+    for (const auto& e : _actorsByType)
+    {
+        if (!e.Key || !e.Key->IsSubClassOf(type))
+            continue;
+        for (Actor* actor : e.Value)
+        {
+            if (actor->GetScene() && (!activeOnly || actor->IsActiveInHierarchy()) && actor->HasTag(tag))
+                return actor;
+        }
+    }
+    return nullptr;
 }
 
 void FindActorRecursive(Actor* node, const Tag& tag, Array<Actor*>& result)
@@ -1583,16 +2032,6 @@ Script* Level::FindScript(const MClass* type)
 
 namespace
 {
-    void GetActors(const MClass* type, Actor* actor, bool activeOnly, Array<Actor*>& result)
-    {
-        if (activeOnly && !actor->GetIsActive())
-            return;
-        if (actor->GetClass()->IsSubClassOf(type))
-            result.Add(actor);
-        for (auto child : actor->Children)
-            GetActors(type, child, activeOnly, result);
-    }
-
     void GetScripts(const MClass* type, Actor* actor, Array<Script*>& result)
     {
         for (auto script : actor->Scripts)
@@ -1607,9 +2046,17 @@ Array<Actor*> Level::GetActors(const MClass* type, bool activeOnly)
 {
     Array<Actor*> result;
     CHECK_RETURN(type, result);
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; i < Scenes.Count(); i++)
-        ::GetActors(type, Scenes[i], activeOnly, result);
+    ScopeLock lock(_actorsIndexLocker);
+    for (const auto& e : _actorsByType)
+    {
+        if (!e.Key || !e.Key->IsSubClassOf(type))
+            continue;
+        for (Actor* actor : e.Value)
+        {
+            if (actor->GetScene() && (!activeOnly || actor->IsActiveInHierarchy()))
+                result.Add(actor);
+        }
+    }
     return result;
 }
 
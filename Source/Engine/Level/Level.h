@@ -28,6 +28,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     friend Actor;
     friend PrefabManager;
     friend Prefab;
+    friend ActorPool;
     friend PrefabInstanceData;
     friend class LoadSceneAction;
 #if USE_EDITOR
@@ -50,6 +51,12 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// </summary>
     API_FIELD() static bool TickEnabled;
 
+    /// <summary>
+    /// The time budget (in milliseconds) for the main thread work of the asynchronous scene loading in a single frame. When exceeded, scene loading continues in the next frame (objects are deserialized, initialized and started in parts). Use 0 to load the whole scene within a single frame.
+    /// </summary>
+    /// <remarks>Scene is added to the loaded scenes before all of its actors begin play (OnSceneLoaded event is called once all actors have been started).</remarks>
+    API_FIELD() static float SceneLoadingTimeBudget;
+
 public:
     /// <summary>
     /// Occurs when new actor gets spawned to the game.
@@ -273,6 +280,20 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <returns>The result data or empty if failed.</returns>
     API_FUNCTION() static Array<byte> SaveSceneToBytes(Scene* scene, bool prettyJson = true);
 
+    /// <summary>
+    /// Saves the changes made to the scene since it was loaded (or saved to the asset) to the bytes. Only the modified objects (see SceneObject.IsDirty), added objects and the identifiers of the removed objects are stored, so the cost depends on the amount of changes rather than the scene size (eg. for save games).
+    /// </summary>
+    /// <param name="scene">Scene to serialize.</param>
+    /// <returns>The result data or empty if failed.</returns>
+    API_FUNCTION() static Array<byte> SaveSceneDeltaToBytes(Scene* scene);
+
+    /// <summary>
+    /// Loads scene from the asset and applies the changes saved with SaveSceneDeltaToBytes.
+    /// </summary>
+    /// <param name="data">The scene delta data to load.</param>
+    /// <returns>Loaded scene object, otherwise null if cannot load data (then see log for more information).</returns>
+    API_FUNCTION() static Scene* LoadSceneDeltaFromBytes(const BytesContainer& data);
+
     /// <summary>
     /// Saves scene to the asset. Done in the background.
     /// </summary>
@@ -353,6 +374,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <summary>
     /// Tries to find the actor with the given name.
     /// </summary>
+    /// <remarks>Uses the index of the actors during play so it doesn't walk the scenes hierarchy. If many actors match, the found one is not necessarily the first one in the hierarchy.</remarks>
     /// <param name="name">The name of the actor.</param>
     /// <returns>Found actor or null.</returns>
     API_FUNCTION() static Actor* FindActor(const StringView& name);
@@ -360,6 +382,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <summary>
     /// Tries to find the actor of the given type in all the loaded scenes.
     /// </summary>
+    /// <remarks>If many actors match, any of them can be returned.</remarks>
     /// <param name="type">Type of the actor to search for. Includes any actors derived from the type.</param>
     /// <param name="activeOnly">Finds only an active actor.</param>
     /// <returns>Found actor or null.</returns>
@@ -368,6 +391,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <summary>
     /// Tries to find the actor of the given type and name in all the loaded scenes.
     /// </summary>
+    /// <remarks>If many actors match, any of them can be returned.</remarks>
     /// <param name="type">Type of the actor to search for. Includes any actors derived from the type.</param>
     /// <param name="name">The name of the actor.</param>
     /// <returns>Actor instance if found, null otherwise.</returns>
@@ -463,6 +487,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <summary>
     /// Finds all the actors of the given type in all the loaded scenes.
     /// </summary>
+    /// <remarks>The order of the actors doesn't follow the scenes hierarchy.</remarks>
     /// <param name="type">Type of the actor to search for. Includes any actors derived from the type.</param>
     /// <param name="activeOnly">Finds only active actors in the scene.</param>
     /// <returns>Found actors list.</returns>
@@ -547,6 +572,14 @@ API_CLASS(Static) class FLAXENGINE_API Level
 
     static void callActorEvent(ActorEventType eventType, Actor* a, Actor* b);
 
+    // Removes actor from the game without deleting it (used by the pooling)
+    static void despawnActor(Actor* a);
+
+    // Actors index API (maintained for actors during play)
+    static void indexActor(Actor* a);
+    static void unindexActor(Actor* a);
+    static void reindexActorName(Actor* a);
+
     // All loadScene assume that ScenesLock has been taken by the calling thread
     static bool loadScene(JsonAsset* sceneAsset);
     static bool loadScene(const BytesContainer& sceneData, Scene** outScene = nullptr);
@@ -9,6 +9,7 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Scripting/Scripting.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 REGISTER_JSON_ASSET(Prefab, "FlaxEngine.Prefab", true);
 
@@ -16,6 +17,9 @@ Prefab::Prefab(const SpawnParams& params, const AssetInfo* info)
     : JsonAssetBase(params, info)
     , _isCreatingDefaultInstance(false)
     , _defaultInstance(nullptr)
+    , _hasSpawnCache(false)
+    , _rootObjectIndex(-1)
+    , _poolCapacity(0)
     , ObjectsCount(0)
 {
 }
@@ -50,6 +54,25 @@ Guid Prefab::GetRootObjectId() const
     return ObjectsIds[objectIndex];
 }
 
+void Prefab::SetPoolCapacity(int32 value)
+{
+    ScopeLock lock(Locker);
+    _poolCapacity = Math::Max(value, 0);
+    TrimPool(_poolCapacity);
+}
+
+int32 Prefab::GetPooledCount() const
+{
+    ScopeLock lock(Locker);
+    return _pool.Count();
+}
+
+void Prefab::ClearPool()
+{
+    ScopeLock lock(Locker);
+    TrimPool(0);
+}
+
 Actor* Prefab::GetDefaultInstance()
 {
     ScopeLock lock(Locker);
@@ -105,6 +128,58 @@ void Prefab::DeleteDefaultInstance()
     }
 }
 
+void Prefab::CacheSpawnData()
+{
+    ScopeLock lock(Locker);
+    if (_hasSpawnCache || !IsLoaded())
+        return;
+    PROFILE_CPU();
+
+    // Resolve objects types to skip the type lookup on every spawn (nested prefab objects use the factory path)
+    const auto& data = *Data;
+    _objectsTypes.Resize(ObjectsCount);
+    for (int32 i = 0; i < ObjectsCount; i++)
+    {
+        auto& objData = data[i];
+        ScriptingTypeHandle type;
+        Guid prefabObjectId;
+        const auto typeNameMember = objData.FindMember("TypeName");
+        if (!JsonTools::GetGuidIfValid(prefabObjectId, objData, "PrefabObjectID") && typeNameMember != objData.MemberEnd() && typeNameMember->value.IsString())
+        {
+            type = Scripting::FindScriptingType(typeNameMember->value.GetStringAnsiView());
+            if (type && !SceneObject::TypeInitializer.IsAssignableFrom(type))
+                type = ScriptingTypeHandle();
+        }
+        _objectsTypes[i] = type;
+    }
+
+    _rootObjectIndex = ObjectsIds.Find(GetRootObjectId());
+    _hasSpawnCache = true;
+}
+
+void Prefab::ClearSpawnCache()
+{
+    ScopeLock lock(Locker);
+    _hasSpawnCache = false;
+    _rootObjectIndex = -1;
+    _objectsTypes.Resize(0);
+
+    // Pooled objects can use types from the reloaded scripts
+    TrimPool(0);
+}
+
+void Prefab::TrimPool(int32 capacity)
+{
+    while (_pool.Count() > capacity)
+    {
+        // Deleting root removes the whole hierarchy
+        const auto& entry = _pool.Last();
+        if (auto root = Scripting::TryFindObject<Actor>(entry[0]))
+            root->DeleteObject();
+        _pool.RemoveLast();
+    }
+}
+
 Asset::LoadResult Prefab::loadAsset()
 {
     // Base
@@ -167,8 +242,10 @@ Asset::LoadResult Prefab::loadAsset()
 
     // Register for scripts reload and unload (need to cleanup all user objects including scripts that may be attached to the default instance - it can be always restored)
     Scripting::ScriptsUnload.Bind<Prefab, &Prefab::DeleteDefaultInstance>(this);
+    Scripting::ScriptsUnload.Bind<Prefab, &Prefab::ClearSpawnCache>(this);
 #if USE_EDITOR
     Scripting::ScriptsReloading.Bind<Prefab, &Prefab::DeleteDefaultInstance>(this);
+    Scripting::ScriptsReloading.Bind<Prefab, &Prefab::ClearSpawnCache>(this);
 #endif
 
     return LoadResult::Ok;
@@ -178,9 +255,12 @@ void Prefab::unload(bool isReloading)
 {
     // Unlink
     Scripting::ScriptsUnload.Unbind<Prefab, &Prefab::DeleteDefaultInstance>(this);
+    Scripting::ScriptsUnload.Unbind<Prefab, &Prefab::ClearSpawnCache>(this);
 #if USE_EDITOR
     Scripting::ScriptsReloading.Unbind<Prefab, &Prefab::DeleteDefaultInstance>(this);
+    Scripting::ScriptsReloading.Unbind<Prefab, &Prefab::ClearSpawnCache>(this);
 #endif
+    ClearSpawnCache();
 
     // Base
     JsonAssetBase::unload(isReloading);
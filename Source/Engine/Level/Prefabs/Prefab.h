@@ -16,10 +16,20 @@ class SceneObject;
 API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
 {
     DECLARE_ASSET_HEADER(Prefab);
+    friend class PrefabManager;
 private:
     bool _isCreatingDefaultInstance;
     Actor* _defaultInstance;
 
+    // Spawn cache (built on the first spawn)
+    bool _hasSpawnCache;
+    int32 _rootObjectIndex;
+    Array<ScriptingTypeHandle> _objectsTypes;
+
+    // Pool of the despawned instances (each entry contains ids of the instance objects, root is first)
+    int32 _poolCapacity;
+    Array<Array<Guid>> _pool;
+
 public:
     /// <summary>
     /// The serialized scene objects amount (actors and scripts).
@@ -70,6 +80,29 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     /// <returns>The object of the prefab loaded from the prefab. Contains the default values. It's not added to gameplay but deserialized with postLoad and init event fired.</returns>
     API_FUNCTION() SceneObject* GetDefaultInstance(API_PARAM(Ref) const Guid& objectId);
 
+    /// <summary>
+    /// Gets the maximum amount of the despawned prefab instances kept for reuse. Instances returned via PrefabManager::DespawnPrefab are reset to the prefab defaults and reused by the next spawns instead of creating the new objects. Use it for frequently spawned prefabs (eg. projectiles). Default is 0 (pooling disabled).
+    /// </summary>
+    API_PROPERTY() int32 GetPoolCapacity() const
+    {
+        return _poolCapacity;
+    }
+
+    /// <summary>
+    /// Sets the maximum amount of the despawned prefab instances kept for reuse. Excess pooled instances get deleted.
+    /// </summary>
+    API_PROPERTY() void SetPoolCapacity(int32 value);
+
+    /// <summary>
+    /// Gets the amount of the despawned prefab instances ready to be reused.
+    /// </summary>
+    API_PROPERTY() int32 GetPooledCount() const;
+
+    /// <summary>
+    /// Deletes all the pooled prefab instances.
+    /// </summary>
+    API_FUNCTION() void ClearPool();
+
 #if USE_EDITOR
     /// <summary>
     /// Applies the difference from the prefab object instance, saves the changes and synchronizes them with the active instances of the prefab asset.
@@ -91,6 +124,9 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     void SyncNestedPrefabs(const NestedPrefabsList& allPrefabs, Array<PrefabInstancesData>& allPrefabsInstancesData) const;
 #endif
     void DeleteDefaultInstance();
+    void CacheSpawnData();
+    void ClearSpawnCache();
+    void TrimPool(int32 capacity);
 
 protected:
     // [JsonAssetBase]
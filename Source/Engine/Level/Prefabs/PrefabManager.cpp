@@ -103,6 +103,14 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     }
     const Guid prefabId = prefab->GetID();
 
+    // Reuse the pooled instance if available
+    if (prefab->_pool.HasItems())
+    {
+        if (Actor* pooled = SpawnPooledPrefab(prefab, transform, parent, objectsCache))
+            return pooled;
+    }
+    prefab->CacheSpawnData();
+
     // Note: we need to generate unique Ids for the deserialized objects (actors and scripts) to prevent Ids collisions
     // Prefab asset during loading caches the object Ids stored inside the file
 
@@ -131,13 +139,26 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     for (int32 i = 0; i < dataCount; i++)
     {
         auto& stream = data[i];
-        SceneObject* obj = SceneObjectsFactory::Spawn(context, stream);
+        SceneObject* obj;
+        const ScriptingTypeHandle type = prefab->_objectsTypes[i];
+        if (type)
+        {
+            // Skip type lookup for objects of the already resolved type
+            const ScriptingObjectSpawnParams params(modifier->IdsMapping[prefab->ObjectsIds[i]], type);
+            obj = (SceneObject*)type.GetType().Script.Spawn(params);
+        }
+        else
+        {
+            obj = SceneObjectsFactory::Spawn(context, stream);
+        }
         sceneObjects->At(i) = obj;
         if (obj)
             obj->RegisterObject();
         else
             SceneObjectsFactory::HandleObjectDeserializationError(stream);
     }
+    // Note: prefab instances can exist only in nested prefabs
+    withSynchronization &= prefab->NestedPrefabs.HasItems();
     SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
     if (withSynchronization)
     {
@@ -165,12 +186,8 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
 
     // Pick prefab root object
     Actor* root = nullptr;
-    const Guid prefabRootObjectId = prefab->GetRootObjectId();
-    for (int32 i = 0; i < dataCount && !root; i++)
-    {
-        if (JsonTools::GetGuid(data[i], "ID") == prefabRootObjectId)
-            root = dynamic_cast<Actor*>(sceneObjects->At(i));
-    }
+    if (prefab->_rootObjectIndex != -1)
+        root = dynamic_cast<Actor*>(sceneObjects->At(prefab->_rootObjectIndex));
     if (!root)
     {
         // Fallback to the first actor that has no parent
@@ -270,12 +287,11 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     // Link objects to prefab (only deserialized from prefab data)
     for (int32 i = 0; i < dataCount; i++)
     {
-        auto& stream = data[i];
         SceneObject* obj = sceneObjects->At(i);
         if (!obj)
             continue;
 
-        const Guid prefabObjectId = JsonTools::GetGuid(stream, "ID");
+        const Guid prefabObjectId = prefab->ObjectsIds[i];
         if (objectsCache)
             objectsCache->Add(prefabObjectId, obj);
         obj->LinkPrefab(prefabId, prefabObjectId);
@@ -299,6 +315,156 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     return root;
 }
 
+Actor* PrefabManager::SpawnPooledPrefab(Prefab* prefab, const Transform& transform, Actor* parent, Dictionary<Guid, SceneObject*>* objectsCache)
+{
+    // Pick the pooled instance (skip the ones with objects deleted in the meantime)
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+    {
+        ScopeLock lock(prefab->Locker);
+        while (prefab->_pool.HasItems() && sceneObjects->IsEmpty())
+        {
+            const auto& entry = prefab->_pool.Last();
+            for (const Guid& id : entry)
+            {
+                SceneObject* obj = Scripting::TryFindObject<SceneObject>(id);
+                if (!obj || obj->IsDuringPlay())
+                {
+                    sceneObjects->Clear();
+                    if (auto root = Scripting::TryFindObject<Actor>(entry[0]))
+                        root->DeleteObject();
+                    break;
+                }
+                sceneObjects->Add(obj);
+            }
+            prefab->_pool.RemoveLast();
+        }
+    }
+    if (sceneObjects->IsEmpty())
+        return nullptr;
+    Actor* root = (Actor*)sceneObjects->At(0);
+    LogContextScope logContext(prefab->GetID());
+
+    // Map prefab objects (including objects from nested prefabs) to the instance objects
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+    modifier->EngineBuild = prefab->DataEngineBuild;
+    modifier->IdsMapping.EnsureCapacity(sceneObjects->Count() * 4);
+    for (SceneObject* obj : *sceneObjects.Value)
+    {
+        const Guid id = obj->GetID();
+        Guid prefabObjectId = obj->GetPrefabObjectID();
+        modifier->IdsMapping[prefabObjectId] = id;
+        const ISerializable::DeserializeStream* stream = prefab->ObjectsDataCache[prefabObjectId];
+        while (stream && JsonTools::GetGuidIfValid(prefabObjectId, *stream, "PrefabObjectID"))
+        {
+            modifier->IdsMapping[prefabObjectId] = id;
+            const auto nestedPrefab = Content::LoadAsync<Prefab>(JsonTools::GetGuid(*stream, "PrefabID"));
+            stream = nullptr;
+            if (nestedPrefab && nestedPrefab->IsLoaded())
+                nestedPrefab->ObjectsDataCache.TryGet(prefabObjectId, stream);
+        }
+    }
+
+    // Restore the prefab defaults
+    SceneObjectsFactory::Context context(modifier.Value);
+    auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
+    Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+    for (SceneObject* obj : *sceneObjects.Value)
+    {
+        auto stream = (ISerializable::DeserializeStream*)prefab->ObjectsDataCache[obj->GetPrefabObjectID()];
+        SceneObjectsFactory::Deserialize(context, obj, *stream);
+    }
+    Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
+
+    // Prepare parent linkage for prefab root actor
+    root->_parent = parent;
+    if (parent)
+        parent->Children.Add(root);
+
+    // Move root to the right location
+    if (transform.Translation != Vector3::Minimum)
+        root->SetTransform(transform);
+
+    // Link actors hierarchy
+    for (SceneObject* obj : *sceneObjects.Value)
+        obj->Initialize();
+
+    if (objectsCache)
+    {
+        objectsCache->Clear();
+        for (SceneObject* obj : *sceneObjects.Value)
+            objectsCache->Add(obj->GetPrefabObjectID(), obj);
+    }
+
+    // Update transformations
+    root->OnTransformChanged();
+
+    // Spawn if need to
+    if (parent && parent->IsDuringPlay())
+    {
+        // Begin play
+        SceneBeginData beginData;
+        root->BeginPlay(&beginData);
+        beginData.OnDone();
+
+        // Send event
+        Level::callActorEvent(Level::ActorEventType::OnActorSpawned, root, nullptr);
+    }
+
+    return root;
+}
+
+void PrefabManager::DespawnPrefab(Actor* instance)
+{
+    PROFILE_CPU_NAMED("Prefab.Despawn");
+    if (instance == nullptr)
+    {
+        Log::ArgumentNullException();
+        return;
+    }
+
+    // Check if instance can be pooled (only unmodified instances of prefabs with pooling enabled)
+    Prefab* prefab = nullptr;
+    if (instance->HasPrefabLink())
+    {
+        Asset* asset = Content::GetAsset(instance->GetPrefabID());
+        if (asset && asset->Is<Prefab>() && asset->IsLoaded())
+            prefab = (Prefab*)asset;
+    }
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+    if (prefab && prefab->_pool.Count() < prefab->_poolCapacity && instance->GetPrefabObjectID() == prefab->GetRootObjectId())
+    {
+        SceneQuery::GetAllSceneObjects(instance, *sceneObjects.Value);
+        bool canPool = sceneObjects->Count() == prefab->ObjectsCount;
+        for (int32 i = 0; i < sceneObjects->Count() && canPool; i++)
+        {
+            SceneObject* obj = sceneObjects->At(i);
+            canPool = obj->GetPrefabID() == prefab->GetID() && prefab->ObjectsDataCache.ContainsKey(obj->GetPrefabObjectID());
+        }
+        if (!canPool)
+            sceneObjects->Clear();
+    }
+    if (sceneObjects->IsEmpty())
+    {
+        instance->DeleteObject();
+        return;
+    }
+
+    // Remove from the game
+    Level::despawnActor(instance);
+
+    // Add to the pool
+    ScopeLock lock(prefab->Locker);
+    if (prefab->_pool.Count() >= prefab->_poolCapacity || !prefab->IsLoaded())
+    {
+        instance->DeleteObject();
+        return;
+    }
+    auto& entry = prefab->_pool.AddOne();
+    entry.Resize(sceneObjects->Count());
+    for (int32 i = 0; i < sceneObjects->Count(); i++)
+        entry[i] = sceneObjects->At(i)->GetID();
+}
+
 #if USE_EDITOR
 
 bool PrefabManager::CreatePrefab(Actor* targetActor, const StringView& outputPath, bool autoLink)
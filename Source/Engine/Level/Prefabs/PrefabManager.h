@@ -102,6 +102,15 @@ API_CLASS(Static) class FLAXENGINE_API PrefabManager
     /// <returns>The created actor (root) or null if failed.</returns>
     static Actor* SpawnPrefab(Prefab* prefab, const Transform& transform, Actor* parent, Dictionary<Guid, SceneObject*, HeapAllocation>* objectsCache, bool withSynchronization = true);
 
+    /// <summary>
+    /// Removes the prefab instance from the game. If the prefab has pooling enabled (see Prefab::SetPoolCapacity) the instance is kept for reuse by the next spawns, otherwise it gets deleted.
+    /// </summary>
+    /// <remarks>
+    /// Only unmodified instances can be pooled (instance root and all of its objects must come from the prefab). On reuse, the objects get restored to the prefab defaults. Instance pooled objects keep their ids.
+    /// </remarks>
+    /// <param name="instance">The prefab instance root actor.</param>
+    API_FUNCTION() static void DespawnPrefab(Actor* instance);
+
 #if USE_EDITOR
 
     /// <summary>
@@ -148,4 +157,7 @@ API_CLASS(Static) class FLAXENGINE_API PrefabManager
     API_FUNCTION() static bool ApplyAll(Actor* instance);
 
 #endif
+
+private:
+    static Actor* SpawnPooledPrefab(Prefab* prefab, const Transform& transform, Actor* parent, Dictionary<Guid, SceneObject*, HeapAllocation>* objectsCache);
 };
@@ -27,6 +27,7 @@ void LightmapSettings::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(CompressLightmaps);
     SERIALIZE(UseGeometryWithNoMaterials);
     SERIALIZE(Quality);
+    SERIALIZE(IncrementalBaking);
 }
 
 void LightmapSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -39,11 +40,13 @@ void LightmapSettings::Deserialize(DeserializeStream& stream, ISerializeModifier
     DESERIALIZE(CompressLightmaps);
     DESERIALIZE(UseGeometryWithNoMaterials);
     DESERIALIZE(Quality);
+    DESERIALIZE(IncrementalBaking);
 }
 
 Lightmap::Lightmap(SceneLightmapsData* manager, int32 index, const SavedLightmapInfo& info)
     : _manager(manager)
     , _index(index)
+    , _bakeHash(info.BakeHash)
 {
     // Try to load textures with given IDs
     _textures[0] = Content::LoadAsync<Texture>(info.Lightmap0);
@@ -91,6 +94,7 @@ void Lightmap::EnsureSize(int32 size)
                     // Unlink texture and import new with valid size
                     LOG(Info, "Changing lightmap {0}:{1} size from {2} to {3}", _index, textureIndex, texture->GetTexture()->Size(), size);
                     texture = nullptr;
+                    _bakeHash = 0;
                 }
             }
         }
@@ -102,6 +106,7 @@ void Lightmap::EnsureSize(int32 size)
 
 #if COMPILE_WITH_ASSETS_IMPORTER
 
+            _bakeHash = 0;
             Guid id = Guid::New();
             LOG(Info, "Cannot load lightmap ({1}:{2}). Creating new one with ID={0}.", id, _index, textureIndex);
             String assetPath;
@@ -20,6 +20,7 @@ class Lightmap
     int32 _size;
 #endif
     AssetReference<Texture> _textures[3];
+    uint32 _bakeHash;
 
 public:
     /// <summary>
@@ -75,6 +76,24 @@ class Lightmap
         info.Lightmap0 = _textures[0].GetID();
         info.Lightmap1 = _textures[1].GetID();
         info.Lightmap2 = _textures[2].GetID();
+        info.BakeHash = _bakeHash;
+    }
+
+    /// <summary>
+    /// Gets the hash of the baking inputs used to generate this lightmap (zero if unknown).
+    /// </summary>
+    FORCE_INLINE uint32 GetBakeHash() const
+    {
+        return _bakeHash;
+    }
+
+    /// <summary>
+    /// Sets the hash of the baking inputs used to generate this lightmap.
+    /// </summary>
+    /// <param name="hash">The baking inputs hash.</param>
+    FORCE_INLINE void SetBakeHash(uint32 hash)
+    {
+        _bakeHash = hash;
     }
 
     /// <summary>
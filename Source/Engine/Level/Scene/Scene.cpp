@@ -9,6 +9,7 @@
 #include "Engine/Physics/Colliders/MeshCollider.h"
 #include "Engine/Level/Actors/StaticModel.h"
 #include "Engine/Level/ActorsCache.h"
+#include "Engine/Level/SceneQuery.h"
 #include "Engine/Navigation/NavigationSettings.h"
 #include "Engine/Navigation/NavMeshBoundsVolume.h"
 #include "Engine/Navigation/NavMesh.h"
@@ -66,6 +67,7 @@ NavMeshBoundsVolume* SceneNavigation::FindNavigationBoundsOverlap(const Bounding
 
 Scene::Scene(const SpawnParams& params)
     : Actor(params)
+    , Partition(this)
     , LightmapsData(this)
     , CSGData(this)
 {
@@ -99,6 +101,18 @@ void Scene::ClearLightmaps()
     LightmapsData.ClearLightmaps();
 }
 
+void Scene::ResetDeltaBaseline()
+{
+    Array<SceneObject*> allObjects;
+    SceneQuery::GetAllSerializableSceneObjects(this, allObjects);
+    _baselineObjects.Clear();
+    for (SceneObject* obj : allObjects)
+    {
+        obj->Flags &= ~ObjectFlags::IsDirty;
+        _baselineObjects.Add(obj->GetID());
+    }
+}
+
 void Scene::BuildCSG(float timeoutMs)
 {
     CSGData.BuildCSG(timeoutMs);
@@ -288,6 +302,12 @@ void Scene::Serialize(SerializeStream& stream, const void* otherObj)
         stream.JKEY("CSG");
         stream.Object(&CSGData, other ? &other->CSGData : nullptr);
     }
+
+    if (Partition.HasData())
+    {
+        stream.JKEY("Partition");
+        stream.Object(&Partition, other ? &other->Partition : nullptr);
+    }
 }
 
 void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -298,6 +318,7 @@ void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
     Info.Deserialize(stream, modifier);
     LightmapsData.LoadLightmaps(Info.Lightmaps);
     CSGData.DeserializeIfExists(stream, "CSG", modifier);
+    Partition.DeserializeIfExists(stream, "Partition", modifier);
 
     // [Deprecated on 13.01.2021, expires on 13.01.2023]
     if (modifier->EngineBuild <= 6215 && Navigation.Meshes.IsEmpty())
@@ -372,10 +393,17 @@ void Scene::BeginPlay(SceneBeginData* data)
         if (model == nullptr)
             CreateCsgModel();
     }
+
+    // Start world partition streaming
+    if (Partition.HasData())
+        Ticking.Update.AddTick<ScenePartition, &ScenePartition::Update>(&Partition);
 }
 
 void Scene::EndPlay()
 {
+    // Remove streamed actors before the scene hierarchy ends play
+    Partition.UnloadAll();
+
     // Improve scene cleanup performance by removing all data from scene rendering and ticking containers
     Ticking.Clear();
     Rendering.Clear();
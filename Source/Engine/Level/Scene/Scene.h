@@ -9,6 +9,8 @@
 #include "SceneRendering.h"
 #include "SceneTicking.h"
 #include "SceneNavigation.h"
+#include "ScenePartition.h"
+#include "Engine/Core/Collections/HashSet.h"
 
 class MeshCollider;
 
@@ -19,6 +21,7 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
 {
     friend class Level;
     friend class ReloadScriptsAction;
+    friend class SceneLoader;
     DECLARE_SCENE_OBJECT(Scene);
 
     /// <summary>
@@ -47,6 +50,11 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     SceneNavigation Navigation;
 
+    /// <summary>
+    /// The world partition data (actors streamed in and out during play).
+    /// </summary>
+    ScenePartition Partition;
+
     /// <summary>
     /// The static light manager for this scene.
     /// </summary>
@@ -81,6 +89,11 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// <param name="timeoutMs">The timeout to wait before building CSG (in milliseconds).</param>
     API_FUNCTION() void BuildCSG(float timeoutMs = 50);
 
+    /// <summary>
+    /// Clears the modification state of the scene objects and uses the current objects as a baseline for the scene delta (eg. after saving scene to the asset).
+    /// </summary>
+    void ResetDeltaBaseline();
+
 #if USE_EDITOR
 
     /// <summary>
@@ -108,6 +121,9 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
 #endif
 
 private:
+    // The identifiers of the objects saved in the scene asset (used to detect added and removed objects for the scene delta)
+    HashSet<Guid> _baselineObjects;
+
     MeshCollider* TryGetCsgCollider();
     StaticModel* TryGetCsgModel();
     void CreateCsgCollider();
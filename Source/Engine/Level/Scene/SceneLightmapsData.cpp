@@ -102,6 +102,7 @@ void SceneLightmapsData::UpdateLightmapsCollection(int32 count, int32 size)
             info.Lightmap0 = Guid::Empty;
             info.Lightmap1 = Guid::Empty;
             info.Lightmap2 = Guid::Empty;
+            info.BakeHash = 0;
             auto lightmap = New<Lightmap>(this, _lightmaps.Count(), info);
 
             _lightmaps.Add(lightmap);
@@ -0,0 +1,483 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ScenePartition.h"
+#include "Scene.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Cache.h"
+#include "Engine/Debug/Exceptions/JsonParseException.h"
+#include "Engine/Level/SceneQuery.h"
+#include "Engine/Level/SceneObjectsFactory.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Serialization/Serialization.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/Task.h"
+
+// Loading job state values
+#define CELL_LOADING_RUNNING 0
+#define CELL_LOADING_DONE 1
+#define CELL_LOADING_CANCELED 2
+
+// Cell objects loading data shared between the partition and the loading job (released by the job if loading gets canceled before it ends)
+struct ScenePartition::CellLoading
+{
+    int64 volatile State = CELL_LOADING_RUNNING;
+    StringAnsi Data;
+    int32 EngineBuild;
+    Array<SceneObject*> Objects;
+    // The spawned root actors (not linked to the scene yet)
+    Array<Actor*> Actors;
+};
+
+namespace
+{
+    // Spawns and deserializes cell objects (can run on any thread), the same way as the scene loading does
+    void LoadCellObjects(ScenePartition::CellLoading* loading)
+    {
+        PROFILE_CPU_NAMED("ScenePartition.LoadCell");
+
+        rapidjson_flax::Document document;
+        {
+            PROFILE_CPU_NAMED("Json.Parse");
+            document.Parse(loading->Data.Get(), loading->Data.Length());
+        }
+        if (document.HasParseError())
+        {
+            Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+            return;
+        }
+        if (!document.IsArray())
+            return;
+        auto modifier = Cache::ISerializeModifier.Get();
+        modifier->EngineBuild = loading->EngineBuild;
+        const int32 dataCount = (int32)document.Size();
+        Array<SceneObject*>& sceneObjects = loading->Objects;
+        sceneObjects.Resize(dataCount);
+
+        // Spawn all objects
+        SceneObjectsFactory::Context context(modifier.Value);
+        context.Async = JobSystem::GetThreadsCount() > 1 && dataCount > 10;
+        {
+            PROFILE_CPU_NAMED("Spawn");
+            SceneObject** objects = sceneObjects.Get();
+            const auto spawn = [&](int32 start, int32 end)
+            {
+                for (int32 i = start; i < end; i++)
+                {
+                    auto& stream = document[i];
+                    auto obj = SceneObjectsFactory::Spawn(context, stream);
+                    objects[i] = obj;
+                    if (obj)
+                    {
+                        obj->RegisterObject();
+#if USE_EDITOR
+                        if (context.Async)
+                            obj->CreateManaged();
+#endif
+                    }
+                    else
+                        SceneObjectsFactory::HandleObjectDeserializationError(stream);
+                }
+            };
+            if (context.Async)
+                JobSystem::ParallelFor(0, dataCount, 0, spawn);
+            else
+                spawn(0, dataCount);
+        }
+        SceneObjectsFactory::PrefabSyncData prefabSyncData(sceneObjects, document, modifier.Value);
+        SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
+        SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
+
+        // Load all objects
+        {
+            PROFILE_CPU_NAMED("Deserialize");
+            Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+            for (int32 i = 0; i < dataCount; i++)
+            {
+                auto obj = sceneObjects[i];
+                if (obj)
+                    SceneObjectsFactory::Deserialize(context, obj, document[i]);
+            }
+            Scripting::ObjectsLookupIdMapping.Set(nullptr);
+        }
+        SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
+
+        // Cell root actors have no parent (they are linked to the scene on activation)
+        for (SceneObject* obj : sceneObjects)
+        {
+            Actor* actor = dynamic_cast<Actor*>(obj);
+            if (actor && actor->GetParent() == nullptr)
+                loading->Actors.Add(actor);
+        }
+    }
+
+    void DeleteCellObjects(ScenePartition::CellLoading* loading, int32 start)
+    {
+        for (int32 i = start; i < loading->Actors.Count(); i++)
+            loading->Actors[i]->DeleteObject();
+    }
+
+    FORCE_INLINE Real GetDistance(Real min, Real max, Real value)
+    {
+        return Math::Max(Math::Max(min - value, value - max), (Real)0);
+    }
+}
+
+ScenePartition::ScenePartition(Scene* scene)
+    : _scene(scene)
+    , _engineBuild(FLAXENGINE_VERSION_BUILD)
+{
+}
+
+ScenePartition::~ScenePartition()
+{
+    // Scene actors are already removed so just release the pending loading jobs data
+    for (auto& e : Cells)
+    {
+        if (e.Value.Loading)
+            CancelLoading(e.Value);
+    }
+}
+
+Int2 ScenePartition::GetCellCoord(const Vector3& location) const
+{
+    return Int2((int32)Math::Floor(location.X / CellSize), (int32)Math::Floor(location.Z / CellSize));
+}
+
+bool ScenePartition::Build(const Array<Actor*>& actors)
+{
+    PROFILE_CPU();
+    if (!IsInMainThread())
+    {
+        LOG(Error, "Scene partition can be built only on a main thread.");
+        return true;
+    }
+
+    // Group actors into cells
+    Dictionary<Int2, Array<Actor*>> cellsActors;
+    for (Actor* actor : actors)
+    {
+        if (!actor || actor->GetParent() != _scene)
+        {
+            LOG(Warning, "Only scene children can be added to the scene partition.");
+            continue;
+        }
+        cellsActors[GetCellCoord(actor->GetBoxWithChildren().GetCenter())].Add(actor);
+    }
+
+    const bool hadData = HasData();
+    const Guid sceneId = _scene->GetID();
+    Array<SceneObject*> objects;
+    rapidjson_flax::StringBuffer buffer;
+    for (auto& e : cellsActors)
+    {
+        // Serialize cell objects
+        objects.Clear();
+        for (Actor* actor : e.Value)
+            SceneQuery::GetAllSerializableSceneObjects(actor, objects);
+        buffer.Clear();
+        {
+            CompactJsonWriter writer(buffer);
+            writer.StartArray();
+            for (SceneObject* obj : objects)
+                writer.SceneObject(obj);
+            writer.EndArray();
+        }
+
+        // Unlink root actors from the scene so cell can be deserialized on a job thread without modifying the scene hierarchy
+        rapidjson_flax::Document document;
+        document.Parse(buffer.GetString(), buffer.GetSize());
+        if (document.HasParseError() || !document.IsArray())
+            return true;
+        for (rapidjson::SizeType i = 0; i < document.Size(); i++)
+        {
+            auto& value = document[i];
+            const auto parentId = value.FindMember("ParentID");
+            if (parentId != value.MemberEnd() && JsonTools::GetGuid(parentId->value) == sceneId)
+                value.RemoveMember(parentId);
+        }
+        buffer.Clear();
+        {
+            rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(buffer);
+            document.Accept(writer);
+        }
+
+        // Append to the cell
+        Cell& cell = Cells[e.Key];
+        if (cell.Data.Length() > 2)
+        {
+            cell.Data = StringAnsi(cell.Data.Get(), cell.Data.Length() - 1);
+            cell.Data.Append(',');
+            cell.Data.Append(buffer.GetString() + 1, (int32)buffer.GetSize() - 1);
+        }
+        else
+            cell.Data = StringAnsi(buffer.GetString(), (int32)buffer.GetSize());
+
+        // Remove actors from the scene (they get loaded by the partition streaming)
+        for (Actor* actor : e.Value)
+            actor->DeleteObjectNow();
+    }
+    _engineBuild = FLAXENGINE_VERSION_BUILD;
+
+    if (!hadData && HasData() && _scene->IsDuringPlay())
+        _scene->Ticking.Update.AddTick<ScenePartition, &ScenePartition::Update>(this);
+    return false;
+}
+
+void ScenePartition::Restore()
+{
+    PROFILE_CPU();
+    UnloadAll();
+    for (auto& e : Cells)
+    {
+        CellLoading loading;
+        loading.Data = e.Value.Data;
+        loading.EngineBuild = _engineBuild;
+        LoadCellObjects(&loading);
+        for (Actor* actor : loading.Actors)
+            actor->SetParent(_scene, false, false);
+    }
+    Clear();
+}
+
+void ScenePartition::Update()
+{
+    PROFILE_CPU();
+
+    // Get streaming sources
+    const Vector3* sources = Sources.Get();
+    int32 sourcesCount = Sources.Count();
+    Vector3 cameraPosition;
+    if (sourcesCount == 0)
+    {
+        const Camera* camera = Camera::GetMainCamera();
+        if (!camera)
+            return;
+        cameraPosition = camera->GetPosition();
+        sources = &cameraPosition;
+        sourcesCount = 1;
+    }
+
+    // Update cells (main thread work is limited by the time budget)
+    const double endTime = Platform::GetTimeSeconds() + TimeBudget * 0.001;
+    bool hasTime = true;
+    for (auto& e : Cells)
+    {
+        Cell& cell = e.Value;
+
+        // Get distance from the closest source to the cell bounds (on XZ plane)
+        const Real minX = e.Key.X * CellSize, maxX = minX + CellSize;
+        const Real minZ = e.Key.Y * CellSize, maxZ = minZ + CellSize;
+        Real distanceSqr = MAX_Real;
+        for (int32 i = 0; i < sourcesCount; i++)
+        {
+            const Real x = GetDistance(minX, maxX, sources[i].X);
+            const Real z = GetDistance(minZ, maxZ, sources[i].Z);
+            distanceSqr = Math::Min(distanceSqr, x * x + z * z);
+        }
+        const bool load = distanceSqr <= (Real)LoadingRange * LoadingRange;
+        const bool keep = distanceSqr <= (Real)UnloadingRange * UnloadingRange;
+
+        switch (cell.State)
+        {
+        case CellState::Unloaded:
+            if (load)
+                StartLoading(cell);
+            break;
+        case CellState::Loading:
+            if (!keep)
+            {
+                CancelLoading(cell);
+                cell.State = CellState::Unloaded;
+            }
+            else if (Platform::AtomicRead(&cell.Loading->State) == CELL_LOADING_DONE)
+            {
+                cell.State = CellState::Activating;
+            }
+            break;
+        case CellState::Activating:
+            if (!keep)
+            {
+                // Remove already activated actors
+                CancelLoading(cell);
+                cell.State = CellState::Unloading;
+                cell.Progress = 0;
+            }
+            else if (hasTime)
+            {
+                if (Activate(cell, endTime))
+                    cell.State = CellState::Loaded;
+                hasTime = Platform::GetTimeSeconds() < endTime;
+            }
+            break;
+        case CellState::Loaded:
+            if (!keep)
+            {
+                cell.State = CellState::Unloading;
+                cell.Progress = 0;
+            }
+            break;
+        case CellState::Unloading:
+            if (hasTime)
+            {
+                if (Unload(cell, endTime))
+                    cell.State = CellState::Unloaded;
+                hasTime = Platform::GetTimeSeconds() < endTime;
+            }
+            break;
+        }
+    }
+}
+
+void ScenePartition::UnloadAll()
+{
+    for (auto& e : Cells)
+    {
+        Cell& cell = e.Value;
+        if (cell.Loading)
+            CancelLoading(cell);
+        cell.Progress = 0;
+        Unload(cell, MAX_double);
+        cell.State = CellState::Unloaded;
+    }
+}
+
+void ScenePartition::Clear()
+{
+    UnloadAll();
+    Cells.Clear();
+    if (_scene->IsDuringPlay())
+        _scene->Ticking.Update.RemoveTick(this);
+}
+
+void ScenePartition::StartLoading(Cell& cell)
+{
+    auto loading = New<CellLoading>();
+    loading->Data = cell.Data;
+    loading->EngineBuild = _engineBuild;
+    cell.Loading = loading;
+    cell.State = CellState::Loading;
+    cell.Progress = 0;
+    Function<void()> action = [loading]
+    {
+        LoadCellObjects(loading);
+        if (Platform::InterlockedCompareExchange(&loading->State, CELL_LOADING_DONE, CELL_LOADING_RUNNING) == CELL_LOADING_CANCELED)
+        {
+            // Partition doesn't need the results anymore
+            DeleteCellObjects(loading, 0);
+            Delete(loading);
+        }
+    };
+    Task::StartNew(action);
+}
+
+void ScenePartition::CancelLoading(Cell& cell)
+{
+    CellLoading* loading = cell.Loading;
+    cell.Loading = nullptr;
+    if (cell.State == CellState::Loading && Platform::InterlockedCompareExchange(&loading->State, CELL_LOADING_CANCELED, CELL_LOADING_RUNNING) == CELL_LOADING_RUNNING)
+        return; // Job will release the data
+
+    // Delete actors that were not added to the scene
+    DeleteCellObjects(loading, cell.State == CellState::Activating ? cell.Progress : 0);
+    Delete(loading);
+}
+
+bool ScenePartition::Activate(Cell& cell, double endTime)
+{
+    PROFILE_CPU();
+    CellLoading* loading = cell.Loading;
+    while (cell.Progress < loading->Actors.Count())
+    {
+        // Link actor to the scene (initializes it and begins play)
+        Actor* actor = loading->Actors[cell.Progress++];
+        actor->SetParent(_scene, false, false);
+        cell.Actors.Add(actor->GetID());
+        if (Platform::GetTimeSeconds() >= endTime)
+            break;
+    }
+    if (cell.Progress < loading->Actors.Count())
+        return false;
+    Delete(loading);
+    cell.Loading = nullptr;
+    cell.Progress = 0;
+    return true;
+}
+
+bool ScenePartition::Unload(Cell& cell, double endTime)
+{
+    PROFILE_CPU();
+    while (cell.Progress < cell.Actors.Count())
+    {
+        Actor* actor = Scripting::TryFindObject<Actor>(cell.Actors[cell.Progress++]);
+        if (actor && actor->GetScene() == _scene)
+            actor->DeleteObjectNow();
+        if (Platform::GetTimeSeconds() >= endTime)
+            break;
+    }
+    if (cell.Progress < cell.Actors.Count())
+        return false;
+    cell.Actors.Clear();
+    cell.Progress = 0;
+    return true;
+}
+
+void ScenePartition::Serialize(SerializeStream& stream, const void* otherObj)
+{
+    SERIALIZE_GET_OTHER_OBJ(ScenePartition);
+
+    SERIALIZE(CellSize);
+    SERIALIZE(LoadingRange);
+    SERIALIZE(UnloadingRange);
+    SERIALIZE(TimeBudget);
+
+    stream.JKEY("Cells");
+    stream.StartArray();
+    for (const auto& e : Cells)
+    {
+        stream.StartObject();
+        stream.JKEY("X");
+        stream.Int(e.Key.X);
+        stream.JKEY("Y");
+        stream.Int(e.Key.Y);
+        stream.JKEY("Data");
+        stream.RawValue(e.Value.Data);
+        stream.EndObject();
+    }
+    stream.EndArray();
+}
+
+void ScenePartition::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    DESERIALIZE(CellSize);
+    DESERIALIZE(LoadingRange);
+    DESERIALIZE(UnloadingRange);
+    DESERIALIZE(TimeBudget);
+
+    UnloadAll();
+    Cells.Clear();
+    _engineBuild = modifier->EngineBuild;
+    const auto cells = SERIALIZE_FIND_MEMBER(stream, "Cells");
+    if (cells != stream.MemberEnd() && cells->value.IsArray())
+    {
+        rapidjson_flax::StringBuffer buffer;
+        for (rapidjson::SizeType i = 0; i < cells->value.Size(); i++)
+        {
+            auto& value = cells->value[i];
+            const auto data = value.FindMember("Data");
+            if (data == value.MemberEnd() || !data->value.IsArray())
+                continue;
+            const Int2 coord(JsonTools::GetInt(value, "X", 0), JsonTools::GetInt(value, "Y", 0));
+
+            // Keep cell data serialized until it gets loaded
+            buffer.Clear();
+            rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(buffer);
+            data->value.Accept(writer);
+            Cells[coord].Data = StringAnsi(buffer.GetString(), (int32)buffer.GetSize());
+        }
+    }
+}
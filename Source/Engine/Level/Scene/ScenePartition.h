@@ -0,0 +1,161 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+
+class Scene;
+class Actor;
+
+/// <summary>
+/// The grid-based world partition of the scene. Actors are stored in per-cell chunks that are loaded and unloaded around the streaming sources over many frames (with a time budget), so memory usage and loading time depend on the area around the player rather than the world size.
+/// </summary>
+/// <remarks>
+/// Cells are laid out on the XZ plane. Cell contents are deserialized on job threads and activated on the main thread. References between actors from different cells (or between cell actors and the rest of the scene) are not restored.
+/// </remarks>
+class FLAXENGINE_API ScenePartition : public ISerializable
+{
+public:
+    struct CellLoading;
+
+    /// <summary>
+    /// The cell streaming state.
+    /// </summary>
+    enum class CellState
+    {
+        // Cell actors are not loaded.
+        Unloaded,
+        // Cell objects are being deserialized on a job thread.
+        Loading,
+        // Cell actors are being added to the scene.
+        Activating,
+        // Cell actors are in the scene.
+        Loaded,
+        // Cell actors are being removed from the scene.
+        Unloading,
+    };
+
+    /// <summary>
+    /// The partition cell.
+    /// </summary>
+    struct Cell
+    {
+        // The serialized cell objects (JSON array, the same format as scene objects data).
+        StringAnsi Data;
+        CellState State = CellState::Unloaded;
+        // The in-flight loading job data (valid only when loading or activating).
+        CellLoading* Loading = nullptr;
+        // The loaded root actors.
+        Array<Guid> Actors;
+        // The activation or unloading progress (index of the next actor to process).
+        int32 Progress = 0;
+    };
+
+private:
+    Scene* _scene;
+    int32 _engineBuild;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="ScenePartition"/> class.
+    /// </summary>
+    /// <param name="scene">The parent scene.</param>
+    ScenePartition(Scene* scene);
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="ScenePartition"/> class.
+    /// </summary>
+    ~ScenePartition();
+
+public:
+    /// <summary>
+    /// The size of the single cell (in world units).
+    /// </summary>
+    float CellSize = 20000.0f;
+
+    /// <summary>
+    /// The distance from the streaming source to the cell bounds at which the cell gets loaded.
+    /// </summary>
+    float LoadingRange = 30000.0f;
+
+    /// <summary>
+    /// The distance from the streaming source to the cell bounds at which the cell gets unloaded. Should be larger than LoadingRange to prevent loading and unloading cell on the borders.
+    /// </summary>
+    float UnloadingRange = 40000.0f;
+
+    /// <summary>
+    /// The time budget (in milliseconds) for adding and removing cell actors on the main thread in a single frame. At least one actor is processed every frame.
+    /// </summary>
+    float TimeBudget = 2.0f;
+
+    /// <summary>
+    /// The streaming sources locations (eg. players). Updated by the game. If empty, the main camera position is used.
+    /// </summary>
+    Array<Vector3> Sources;
+
+    /// <summary>
+    /// The partition cells (by coordinates on the grid).
+    /// </summary>
+    Dictionary<Int2, Cell> Cells;
+
+public:
+    /// <summary>
+    /// Determines whether this container has any cells.
+    /// </summary>
+    FORCE_INLINE bool HasData() const
+    {
+        return Cells.HasItems();
+    }
+
+    /// <summary>
+    /// Gets the coordinates of the cell that contains the given location.
+    /// </summary>
+    /// <param name="location">The world location.</param>
+    /// <returns>The cell coordinates.</returns>
+    Int2 GetCellCoord(const Vector3& location) const;
+
+    /// <summary>
+    /// Moves the given actors (scene children) into the partition cells based on their bounds center. Actors are serialized to the cells data and deleted from the scene.
+    /// </summary>
+    /// <remarks>Used by the tools (eg. editor or game cooking) to partition the world. Actors get loaded again by streaming during play.</remarks>
+    /// <param name="actors">The actors to partition.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Build(const Array<Actor*>& actors);
+
+    /// <summary>
+    /// Loads the actors from all the cells into the scene (synchronously) and clears the partition data. Used by the tools to restore the scene for editing.
+    /// </summary>
+    void Restore();
+
+    /// <summary>
+    /// Updates the cells streaming around the streaming sources. Called every frame during play.
+    /// </summary>
+    void Update();
+
+    /// <summary>
+    /// Unloads all the cells (immediately) and cancels the pending loading jobs.
+    /// </summary>
+    void UnloadAll();
+
+    /// <summary>
+    /// Unloads all cells and removes the partition data.
+    /// </summary>
+    void Clear();
+
+private:
+    void StartLoading(Cell& cell);
+    void CancelLoading(Cell& cell);
+    bool Activate(Cell& cell, double endTime);
+    bool Unload(Cell& cell, double endTime);
+
+public:
+    // [ISerializable]
+    void Serialize(SerializeStream& stream, const void* otherObj) override;
+    void Deserialize(DeserializeStream& stream, ISerializeModifier* modifier) override;
+};
@@ -2,13 +2,29 @@
 
 #define SCENE_RENDERING_USE_PROFILER_PER_ACTOR 0
 
+// The minimum amount of actors in the draw category to use culling trees (smaller lists are culled linearly)
+#define SCENE_RENDERING_TREE_MIN_ACTORS 256
+
+// The dynamic actors bounds enlargement (relative to the actor bounds radius) used by the culling tree to reduce its updates when objects move
+#define SCENE_RENDERING_TREE_DYNAMIC_MARGIN 0.2f
+
 #include "SceneRendering.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/Utils/OcclusionCulling.h"
 #include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
+
+namespace
+{
+    FORCE_INLINE bool IsListening(const ISceneRenderingListener* listener, const Actor* a)
+    {
+        return !listener->StaticActorsOnly || EnumHasAnyFlags(a->GetStaticFlags(), StaticFlags::Transform);
+    }
+}
 
 ISceneRenderingListener::~ISceneRenderingListener()
 {
@@ -27,16 +43,10 @@ void ISceneRenderingListener::ListenSceneRendering(SceneRendering* scene)
     }
 }
 
-FORCE_INLINE bool FrustumsListCull(const BoundingSphere& bounds, const Array<BoundingFrustum>& frustums)
+SceneRendering::SceneRendering()
 {
-    const int32 count = frustums.Count();
-    const BoundingFrustum* data = frustums.Get();
-    for (int32 i = 0; i < count; i++)
-    {
-        if (data[i].Intersects(bounds))
-            return true;
-    }
-    return false;
+    for (auto& tree : _dynamicTrees)
+        tree.SetMargin(SCENE_RENDERING_TREE_DYNAMIC_MARGIN);
 }
 
 void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory category)
@@ -61,6 +71,7 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
     _drawListData = list.Get();
     _drawListSize = list.Count();
     _drawBatch = &renderContextBatch;
+    _drawOcclusion = category == SceneDraw || category == SceneDrawAsync ? renderContextBatch.GetMainContext().List->Occlusion : nullptr;
 
     // Setup frustum data
     const int32 frustumsCount = renderContextBatch.Contexts.Count();
@@ -68,6 +79,19 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
     for (int32 i = 0; i < frustumsCount; i++)
         _drawFrustumsData.Get()[i] = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
 
+    // Gather visible actors from culling trees (hierarchical test against all frustums in a batch)
+    _drawKeysData = nullptr;
+    if (_drawListSize >= SCENE_RENDERING_TREE_MIN_ACTORS)
+    {
+        PROFILE_CPU_NAMED("Query");
+        _drawKeys.Clear();
+        _staticTrees[(int32)category].Query(_drawFrustumsData.Get(), frustumsCount, view.Origin, _drawKeys);
+        _dynamicTrees[(int32)category].Query(_drawFrustumsData.Get(), frustumsCount, view.Origin, _drawKeys);
+        _drawKeys.Add(_noCullingActors[(int32)category]);
+        _drawKeysData = _drawKeys.Get();
+        _drawListSize = _drawKeys.Count();
+    }
+
     // Draw all visual components
     _drawListIndex = -1;
     if (_drawListSize >= 64 && category == SceneDrawAsync && renderContextBatch.EnableAsync)
@@ -75,7 +99,7 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
         // Run in async via Job System
         Function<void(int32)> func;
         func.Bind<SceneRendering, &SceneRendering::DrawActorsJob>(this);
-        const uint64 waitLabel = JobSystem::Dispatch(func, JobSystem::GetThreadsCount());
+        const uint64 waitLabel = JobSystem::Dispatch(func, JobSystem::GetThreadsCount(), JobPriority::High);
         renderContextBatch.WaitLabels.Add(waitLabel);
     }
     else
@@ -112,6 +136,30 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
 #endif
 }
 
+void SceneRendering::QueryActors(DrawCategory category, const BoundingBox& box, Array<int32>& result) const
+{
+    const auto& list = Actors[(int32)category];
+    if (list.Count() >= SCENE_RENDERING_TREE_MIN_ACTORS)
+    {
+        _staticTrees[(int32)category].Query(box, result);
+        _dynamicTrees[(int32)category].Query(box, result);
+        for (int32 key : _noCullingActors[(int32)category])
+        {
+            if (CollisionsHelper::BoxIntersectsSphere(box, list.Get()[key].Bounds))
+                result.Add(key);
+        }
+    }
+    else
+    {
+        for (int32 key = 0; key < list.Count(); key++)
+        {
+            const DrawActor& e = list.Get()[key];
+            if (e.Actor && CollisionsHelper::BoxIntersectsSphere(box, e.Bounds))
+                result.Add(key);
+        }
+    }
+}
+
 void SceneRendering::CollectPostFxVolumes(RenderContext& renderContext)
 {
 #if SCENE_RENDERING_USE_PROFILER
@@ -134,6 +182,12 @@ void SceneRendering::Clear()
     _listeners.Clear();
     for (auto& e : Actors)
         e.Clear();
+    for (auto& e : _staticTrees)
+        e.Clear();
+    for (auto& e : _dynamicTrees)
+        e.Clear();
+    for (auto& e : _noCullingActors)
+        e.Clear();
 #if USE_EDITOR
     PhysicsDebug.Clear();
 #endif
@@ -160,8 +214,12 @@ void SceneRendering::AddActor(Actor* a, int32& key)
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
     e.NoCulling = a->_drawNoCulling;
+    AddToTree(category, key);
     for (auto* listener : _listeners)
-        listener->OnSceneRenderingAddActor(a);
+    {
+        if (IsListening(listener, a))
+            listener->OnSceneRenderingAddActor(a);
+    }
 }
 
 void SceneRendering::UpdateActor(Actor* a, int32& key, ISceneRenderingListener::UpdateFlags flags)
@@ -175,11 +233,24 @@ void SceneRendering::UpdateActor(Actor* a, int32& key, ISceneRenderingListener::
     if (e.Actor == a)
     {
         for (auto* listener : _listeners)
-            listener->OnSceneRenderingUpdateActor(a, e.Bounds, flags);
+        {
+            if (flags & ISceneRenderingListener::StaticFlags || IsListening(listener, a))
+                listener->OnSceneRenderingUpdateActor(a, e.Bounds, flags);
+        }
         if (flags & ISceneRenderingListener::Layer)
             e.LayerMask = a->GetLayerMask();
         if (flags & ISceneRenderingListener::Bounds)
+        {
             e.Bounds = a->GetSphere();
+            if (e.TreeLeaf != -1)
+                (e.StaticTree ? _staticTrees : _dynamicTrees)[category].Update(e.TreeLeaf, e.Bounds);
+        }
+        if (flags & ISceneRenderingListener::StaticFlags && e.TreeLeaf != -1 && EnumHasAnyFlags(a->GetStaticFlags(), StaticFlags::Transform) != (e.StaticTree != 0))
+        {
+            // Move actor to the other tree
+            RemoveFromTree(category, key);
+            AddToTree(category, key);
+        }
     }
 }
 
@@ -194,7 +265,11 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
         if (e.Actor == a)
         {
             for (auto* listener : _listeners)
-                listener->OnSceneRenderingRemoveActor(a);
+            {
+                if (IsListening(listener, a))
+                    listener->OnSceneRenderingRemoveActor(a);
+            }
+            RemoveFromTree(category, key);
             e.Actor = nullptr;
             e.LayerMask = 0;
         }
@@ -202,9 +277,39 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
     key = -1;
 }
 
-#define FOR_EACH_BATCH_ACTOR const int64 count = _drawListSize; while (true) { const int64 index = Platform::InterlockedIncrement(&_drawListIndex); if (index >= count) break; auto e = _drawListData[index];
-#define CHECK_ACTOR ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || FrustumsListCull(e.Bounds, _drawFrustumsData)))
-#define CHECK_ACTOR_SINGLE_FRUSTUM ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || view.CullingFrustum.Intersects(e.Bounds)))
+void SceneRendering::AddToTree(int32 category, int32 key)
+{
+    auto& e = Actors[category].Get()[key];
+    e.StaticTree = 0;
+    if (e.NoCulling)
+    {
+        e.TreeLeaf = -1;
+        _noCullingActors[category].Add(key);
+    }
+    else if (EnumHasAnyFlags(e.Actor->GetStaticFlags(), StaticFlags::Transform))
+    {
+        e.StaticTree = 1;
+        e.TreeLeaf = _staticTrees[category].Add(e.Bounds, key);
+    }
+    else
+    {
+        e.TreeLeaf = _dynamicTrees[category].Add(e.Bounds, key);
+    }
+}
+
+void SceneRendering::RemoveFromTree(int32 category, int32 key)
+{
+    auto& e = Actors[category].Get()[key];
+    if (e.TreeLeaf != -1)
+        (e.StaticTree ? _staticTrees : _dynamicTrees)[category].Remove(e.TreeLeaf);
+    else
+        _noCullingActors[category].Remove(key);
+    e.TreeLeaf = -1;
+}
+
+// The amount of actors claimed by a single draw job at once (culled together with a batched frustum test)
+#define SCENE_RENDERING_CULLING_BATCH 64
+
 #if SCENE_RENDERING_USE_PROFILER_PER_ACTOR
 #define DRAW_ACTOR(mode) PROFILE_CPU_ACTOR(e.Actor); e.Actor->Draw(mode)
 #else
@@ -216,43 +321,80 @@ void SceneRendering::DrawActorsJob(int32)
     PROFILE_CPU();
     auto& mainContext = _drawBatch->GetMainContext();
     const auto& view = mainContext.View;
-    if (view.StaticFlagsMask != StaticFlags::None)
+    const Vector3 origin = view.Origin;
+    const bool useStaticFlags = view.StaticFlagsMask != StaticFlags::None;
+    const bool singleFrustum = !useStaticFlags && _drawFrustumsData.Count() == 1;
+    const int32 frustumsCount = _drawFrustumsData.Count();
+    const BoundingFrustum* frustums = _drawFrustumsData.Get();
+    float centerX[SCENE_RENDERING_CULLING_BATCH], centerY[SCENE_RENDERING_CULLING_BATCH], centerZ[SCENE_RENDERING_CULLING_BATCH], radius[SCENE_RENDERING_CULLING_BATCH];
+    uint32 visibility[SCENE_RENDERING_CULLING_BATCH / 32], frustumVisibility[SCENE_RENDERING_CULLING_BATCH / 32];
+    const int64 count = _drawListSize;
+    const int32* keys = _drawKeysData;
+    const DrawActor* batch[SCENE_RENDERING_CULLING_BATCH];
+    while (true)
     {
-        // Static-flags culling
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR && (e.Actor->GetStaticFlags() & view.StaticFlagsMask) == view.StaticFlagsCompare)
+        // Claim the next batch of actors
+        const int64 start = Platform::InterlockedAdd(&_drawListIndex, SCENE_RENDERING_CULLING_BATCH) + 1;
+        if (start >= count)
+            break;
+        const int32 batchSize = (int32)Math::Min<int64>(count - start, SCENE_RENDERING_CULLING_BATCH);
+        if (keys)
+        {
+            // Actors from the culling trees query are already culled
+            for (int32 i = 0; i < batchSize; i++)
+                batch[i] = _drawListData + keys[start + i];
+            for (int32 i = 0; i < (batchSize + 31) / 32; i++)
+                visibility[i] = MAX_uint32;
+        }
+        else
+        {
+            for (int32 i = 0; i < batchSize; i++)
+                batch[i] = _drawListData + start + i;
+
+            // Cull bounds (relative to the view origin) against all frustums
+            for (int32 i = 0; i < batchSize; i++)
             {
-                DRAW_ACTOR(*_drawBatch);
+                const BoundingSphere& bounds = batch[i]->Bounds;
+                centerX[i] = (float)(bounds.Center.X - origin.X);
+                centerY[i] = (float)(bounds.Center.Y - origin.Y);
+                centerZ[i] = (float)(bounds.Center.Z - origin.Z);
+                radius[i] = (float)bounds.Radius;
             }
-        }
-    }
-    else if (view.Origin.IsZero() && _drawFrustumsData.Count() == 1)
-    {
-        // Fast path for no origin shifting with a single context
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR_SINGLE_FRUSTUM)
+            frustums[0].Intersects(centerX, centerY, centerZ, radius, batchSize, visibility);
+            for (int32 frustumIndex = 1; frustumIndex < frustumsCount; frustumIndex++)
             {
-                DRAW_ACTOR(mainContext);
+                frustums[frustumIndex].Intersects(centerX, centerY, centerZ, radius, batchSize, frustumVisibility);
+                for (int32 i = 0; i < (batchSize + 31) / 32; i++)
+                    visibility[i] |= frustumVisibility[i];
             }
         }
-    }
-    else if (view.Origin.IsZero())
-    {
-        // Fast path for no origin shifting
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR)
+
+        // Draw visible actors
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            const DrawActor& e = *batch[i];
+            if ((view.RenderLayersMask.Mask & e.LayerMask) == 0 ||
+                (!e.NoCulling && (visibility[i >> 5] & (1u << (i & 31))) == 0) ||
+                (useStaticFlags && (e.Actor->GetStaticFlags() & view.StaticFlagsMask) != view.StaticFlagsCompare))
+                continue;
+            if (_drawOcclusion && !e.NoCulling && _drawOcclusion->IsOccluded(e.Bounds))
             {
-                DRAW_ACTOR(*_drawBatch);
+                // Skip actors hidden in the main view unless they can draw into any other view (eg. cast shadows)
+                bool visible = false;
+                if (!singleFrustum)
+                {
+                    const BoundingSphere bounds(e.Bounds.Center - origin, e.Bounds.Radius);
+                    for (int32 frustumIndex = 1; frustumIndex < frustumsCount && !visible; frustumIndex++)
+                        visible = frustums[frustumIndex].Intersects(bounds);
+                }
+                if (!visible)
+                    continue;
             }
-        }
-    }
-    else
-    {
-        // Generic case
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR)
+            if (singleFrustum)
+            {
+                DRAW_ACTOR(mainContext);
+            }
+            else
             {
                 DRAW_ACTOR(*_drawBatch);
             }
@@ -260,6 +402,4 @@ void SceneRendering::DrawActorsJob(int32)
     }
 }
 
-#undef FOR_EACH_BATCH_ACTOR
-#undef CHECK_ACTOR
 #undef DRAW_ACTOR
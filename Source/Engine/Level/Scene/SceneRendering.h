@@ -4,10 +4,12 @@
 
 #include "Engine/Core/Delegate.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/HandlePool.h"
 #include "Engine/Core/Math/BoundingSphere.h"
 #include "Engine/Core/Math/BoundingFrustum.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "SceneRenderingBVH.h"
 
 class SceneRenderTask;
 class SceneRendering;
@@ -15,6 +17,7 @@ struct PostProcessSettings;
 struct RenderContext;
 struct RenderContextBatch;
 struct RenderView;
+struct OcclusionBuffer;
 
 /// <summary>
 /// Interface for actors that can override the default rendering settings (eg. PostFxVolume actor).
@@ -48,6 +51,9 @@ class FLAXENGINE_API ISceneRenderingListener
 public:
     ~ISceneRenderingListener();
 
+    // True if listener needs events only for static actors (with StaticFlags::Transform), then dynamic actors changes are skipped (except static flags changes).
+    bool StaticActorsOnly = false;
+
     // Actor properties that were modified.
     enum UpdateFlags
     {
@@ -84,6 +90,10 @@ class FLAXENGINE_API SceneRendering
         Actor* Actor;
         uint32 LayerMask;
         int8 NoCulling : 1;
+        // True if actor is stored in the static actors tree (has static transformation), otherwise it uses dynamic actors tree
+        int8 StaticTree : 1;
+        // Index of the leaf in the culling tree (or -1 if not used)
+        int32 TreeLeaf;
         BoundingSphere Bounds;
     };
 
@@ -100,7 +110,7 @@ class FLAXENGINE_API SceneRendering
     };
 
     Array<DrawActor> Actors[MAX];
-    Array<IPostFxSettingsProvider*> PostFxProviders;
+    HandlePool<IPostFxSettingsProvider*> PostFxProviders;
     CriticalSection Locker;
 
 private:
@@ -110,11 +120,18 @@ class FLAXENGINE_API SceneRendering
     Array<Actor*> ViewportIcons;
 #endif
 
+    // Culling acceleration structures - separate trees for static (tight bounds) and dynamic actors (enlarged bounds to reduce updates), actors without culling are kept in a list
+    SceneRenderingBVH _staticTrees[MAX];
+    SceneRenderingBVH _dynamicTrees[MAX];
+    Array<int32> _noCullingActors[MAX];
+
     // Listener - some rendering systems cache state of the scene (eg. in RenderBuffers::CustomBuffer), this extensions allows those systems to invalidate cache and handle scene changes
     friend ISceneRenderingListener;
     Array<ISceneRenderingListener*, InlinedAllocation<8>> _listeners;
 
 public:
+    SceneRendering();
+
     /// <summary>
     /// Draws the scene. Performs the optimized actors culling and draw calls submission for the current render pass (defined by the render view).
     /// </summary>
@@ -122,6 +139,14 @@ class FLAXENGINE_API SceneRendering
     /// <param name="category">The actors category to draw.</param>
     void Draw(RenderContextBatch& renderContextBatch, DrawCategory category = SceneDraw);
 
+    /// <summary>
+    /// Gathers the actors from the given category which bounds intersect the box. Uses culling trees for the large lists.
+    /// </summary>
+    /// <param name="category">The actors category.</param>
+    /// <param name="box">The bounds to test.</param>
+    /// <param name="result">The output list with keys of the actors in the Actors list for the given category (results are appended).</param>
+    void QueryActors(DrawCategory category, const BoundingBox& box, Array<int32>& result) const;
+
     /// <summary>
     /// Collects the post fx volumes for the given rendering view.
     /// </summary>
@@ -138,14 +163,14 @@ class FLAXENGINE_API SceneRendering
     void UpdateActor(Actor* a, int32& key, ISceneRenderingListener::UpdateFlags flags = ISceneRenderingListener::Auto);
     void RemoveActor(Actor* a, int32& key);
 
-    FORCE_INLINE void AddPostFxProvider(IPostFxSettingsProvider* obj)
+    FORCE_INLINE void AddPostFxProvider(IPostFxSettingsProvider* obj, PoolHandle& handle)
     {
-        PostFxProviders.Add(obj);
+        handle = PostFxProviders.Add(obj);
     }
 
-    FORCE_INLINE void RemovePostFxProvider(IPostFxSettingsProvider* obj)
+    FORCE_INLINE void RemovePostFxProvider(PoolHandle& handle)
     {
-        PostFxProviders.Remove(obj);
+        PostFxProviders.RemoveAndReset(handle);
     }
 
 #if USE_EDITOR
@@ -194,10 +219,15 @@ class FLAXENGINE_API SceneRendering
 
 private:
     Array<BoundingFrustum> _drawFrustumsData;
+    Array<int32> _drawKeys;
     DrawActor* _drawListData;
+    const int32* _drawKeysData;
     int64 _drawListSize;
     volatile int64 _drawListIndex;
     RenderContextBatch* _drawBatch;
+    const OcclusionBuffer* _drawOcclusion;
 
     void DrawActorsJob(int32);
+    void AddToTree(int32 category, int32 key);
+    void RemoveFromTree(int32 category, int32 key);
 };
@@ -0,0 +1,466 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SceneRenderingBVH.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
+
+namespace
+{
+    struct CullPlane
+    {
+        Float3 Normal;
+        float D;
+    };
+
+    FORCE_INLINE BoundingBox Combine(const BoundingBox& a, const BoundingBox& b)
+    {
+        return BoundingBox(Vector3::Min(a.Minimum, b.Minimum), Vector3::Max(a.Maximum, b.Maximum));
+    }
+
+    FORCE_INLINE Real GetArea(const BoundingBox& box)
+    {
+        const Vector3 size = box.Maximum - box.Minimum;
+        return size.X * size.Y + size.Y * size.Z + size.Z * size.X;
+    }
+
+    FORCE_INLINE bool ContainsBox(const BoundingBox& a, const BoundingBox& b)
+    {
+        return a.Minimum.X <= b.Minimum.X && a.Minimum.Y <= b.Minimum.Y && a.Minimum.Z <= b.Minimum.Z &&
+                a.Maximum.X >= b.Maximum.X && a.Maximum.Y >= b.Maximum.Y && a.Maximum.Z >= b.Maximum.Z;
+    }
+
+    FORCE_INLINE BoundingBox GetBox(const BoundingSphere& sphere, Real margin)
+    {
+        const Vector3 extents(sphere.Radius + margin);
+        return BoundingBox(sphere.Center - extents, sphere.Center + extents);
+    }
+
+    enum class Visibility
+    {
+        Outside,
+        Intersecting,
+        Inside,
+    };
+
+    // Tests the box (relative to the origin) against the set of frustums (6 planes each)
+    Visibility TestBox(const CullPlane* planes, int32 frustumsCount, const Float3& center, const Float3& extents)
+    {
+        Visibility result = Visibility::Outside;
+        for (int32 frustumIndex = 0; frustumIndex < frustumsCount; frustumIndex++)
+        {
+            const CullPlane* frustumPlanes = planes + frustumIndex * 6;
+            bool inside = true, outside = false;
+            for (int32 p = 0; p < 6; p++)
+            {
+                const CullPlane& plane = frustumPlanes[p];
+                const float distance = Float3::Dot(plane.Normal, center) + plane.D;
+                const float radius = Math::Abs(plane.Normal.X) * extents.X + Math::Abs(plane.Normal.Y) * extents.Y + Math::Abs(plane.Normal.Z) * extents.Z;
+                if (distance < -radius)
+                {
+                    outside = true;
+                    break;
+                }
+                if (distance < radius)
+                    inside = false;
+            }
+            if (outside)
+                continue;
+            if (inside)
+                return Visibility::Inside;
+            result = Visibility::Intersecting;
+        }
+        return result;
+    }
+
+    // Tests the sphere (relative to the origin) against the set of frustums (6 planes each)
+    bool TestSphere(const CullPlane* planes, int32 frustumsCount, const Float3& center, float radius)
+    {
+        for (int32 frustumIndex = 0; frustumIndex < frustumsCount; frustumIndex++)
+        {
+            const CullPlane* frustumPlanes = planes + frustumIndex * 6;
+            bool visible = true;
+            for (int32 p = 0; p < 6 && visible; p++)
+                visible = Float3::Dot(frustumPlanes[p].Normal, center) + frustumPlanes[p].D >= -radius;
+            if (visible)
+                return true;
+        }
+        return false;
+    }
+
+    FORCE_INLINE bool BoxesIntersect(const BoundingBox& a, const BoundingBox& b)
+    {
+        return a.Minimum.X <= b.Maximum.X && a.Maximum.X >= b.Minimum.X &&
+                a.Minimum.Y <= b.Maximum.Y && a.Maximum.Y >= b.Minimum.Y &&
+                a.Minimum.Z <= b.Maximum.Z && a.Maximum.Z >= b.Minimum.Z;
+    }
+}
+
+int32 SceneRenderingBVH::Add(const BoundingSphere& bounds, int32 key)
+{
+    const int32 leaf = AllocateNode();
+    Node& node = _nodes[leaf];
+    node.Bounds = GetBox(bounds, bounds.Radius * _margin);
+    node.Sphere = bounds;
+    node.Height = 0;
+    node.Key = key;
+    InsertLeaf(leaf);
+    _leavesCount++;
+    return leaf;
+}
+
+bool SceneRenderingBVH::Update(int32 leaf, const BoundingSphere& bounds)
+{
+    ASSERT_LOW_LAYER(leaf >= 0 && leaf < _nodes.Count() && _nodes[leaf].IsLeaf());
+    _nodes[leaf].Sphere = bounds;
+    const BoundingBox box = GetBox(bounds, 0);
+    if (ContainsBox(_nodes[leaf].Bounds, box))
+        return false;
+    RemoveLeaf(leaf);
+    _nodes[leaf].Bounds = GetBox(bounds, bounds.Radius * _margin);
+    InsertLeaf(leaf);
+    return true;
+}
+
+void SceneRenderingBVH::Remove(int32 leaf)
+{
+    ASSERT_LOW_LAYER(leaf >= 0 && leaf < _nodes.Count() && _nodes[leaf].IsLeaf());
+    RemoveLeaf(leaf);
+    FreeNode(leaf);
+    _leavesCount--;
+}
+
+void SceneRenderingBVH::Clear()
+{
+    _nodes.Clear();
+    _root = -1;
+    _freeNode = -1;
+    _leavesCount = 0;
+}
+
+void SceneRenderingBVH::Query(const BoundingFrustum* frustums, int32 frustumsCount, const Vector3& origin, Array<int32>& result) const
+{
+    if (_root == -1 || frustumsCount == 0)
+        return;
+    Array<CullPlane, InlinedAllocation<6 * 8>> planes;
+    planes.Resize(frustumsCount * 6);
+    for (int32 i = 0; i < frustumsCount; i++)
+    {
+        for (int32 p = 0; p < 6; p++)
+        {
+            const Plane plane = frustums[i].GetPlane(p);
+            CullPlane& e = planes[i * 6 + p];
+            e.Normal = Float3(plane.Normal);
+            e.D = (float)plane.D;
+        }
+    }
+    Array<int32, InlinedAllocation<64>> stack;
+    stack.Add(_root);
+    const Node* nodes = _nodes.Get();
+    while (stack.HasItems())
+    {
+        const int32 index = stack.Pop();
+        const Node& node = nodes[index];
+        const Float3 center(node.Bounds.GetCenter() - origin);
+        const Float3 extents((node.Bounds.Maximum - node.Bounds.Minimum) * 0.5f);
+        const Visibility visibility = TestBox(planes.Get(), frustumsCount, center, extents);
+        if (visibility == Visibility::Outside)
+            continue;
+        if (node.IsLeaf())
+        {
+            if (visibility == Visibility::Inside || TestSphere(planes.Get(), frustumsCount, Float3(node.Sphere.Center - origin), (float)node.Sphere.Radius))
+                result.Add(node.Key);
+        }
+        else if (visibility == Visibility::Inside)
+            GatherLeaves(index, result);
+        else
+        {
+            stack.Add(node.Child1);
+            stack.Add(node.Child2);
+        }
+    }
+}
+
+void SceneRenderingBVH::Query(const BoundingBox& box, Array<int32>& result) const
+{
+    if (_root == -1)
+        return;
+    Array<int32, InlinedAllocation<64>> stack;
+    stack.Add(_root);
+    const Node* nodes = _nodes.Get();
+    while (stack.HasItems())
+    {
+        const Node& node = nodes[stack.Pop()];
+        if (!BoxesIntersect(node.Bounds, box))
+            continue;
+        if (node.IsLeaf())
+        {
+            if (CollisionsHelper::BoxIntersectsSphere(box, node.Sphere))
+                result.Add(node.Key);
+        }
+        else
+        {
+            stack.Add(node.Child1);
+            stack.Add(node.Child2);
+        }
+    }
+}
+
+int32 SceneRenderingBVH::AllocateNode()
+{
+    int32 index = _freeNode;
+    if (index != -1)
+    {
+        _freeNode = _nodes[index].Parent;
+    }
+    else
+    {
+        index = _nodes.Count();
+        _nodes.AddUninitialized(1);
+    }
+    Node& node = _nodes[index];
+    node.Parent = -1;
+    node.Child1 = -1;
+    node.Child2 = -1;
+    node.Height = 0;
+    node.Key = -1;
+    return index;
+}
+
+void SceneRenderingBVH::FreeNode(int32 index)
+{
+    Node& node = _nodes[index];
+    node.Parent = _freeNode;
+    node.Height = -1;
+    _freeNode = index;
+}
+
+void SceneRenderingBVH::InsertLeaf(int32 leaf)
+{
+    if (_root == -1)
+    {
+        _root = leaf;
+        _nodes[leaf].Parent = -1;
+        return;
+    }
+
+    // Find the best sibling for the new leaf (the smallest area increase)
+    const BoundingBox leafBounds = _nodes[leaf].Bounds;
+    int32 index = _root;
+    while (!_nodes[index].IsLeaf())
+    {
+        const Node& node = _nodes[index];
+        const Real area = GetArea(node.Bounds);
+        const Real combinedArea = GetArea(Combine(node.Bounds, leafBounds));
+        const Real cost = 2 * combinedArea;
+        const Real inheritanceCost = 2 * (combinedArea - area);
+        const Node& child1 = _nodes[node.Child1];
+        const Node& child2 = _nodes[node.Child2];
+        Real cost1 = GetArea(Combine(leafBounds, child1.Bounds)) + inheritanceCost;
+        if (!child1.IsLeaf())
+            cost1 -= GetArea(child1.Bounds);
+        Real cost2 = GetArea(Combine(leafBounds, child2.Bounds)) + inheritanceCost;
+        if (!child2.IsLeaf())
+            cost2 -= GetArea(child2.Bounds);
+        if (cost < cost1 && cost < cost2)
+            break;
+        index = cost1 < cost2 ? node.Child1 : node.Child2;
+    }
+    const int32 sibling = index;
+
+    // Create a new parent for the leaf and its sibling
+    const int32 newParent = AllocateNode();
+    const int32 oldParent = _nodes[sibling].Parent;
+    {
+        Node& node = _nodes[newParent];
+        node.Parent = oldParent;
+        node.Bounds = Combine(leafBounds, _nodes[sibling].Bounds);
+        node.Height = _nodes[sibling].Height + 1;
+        node.Child1 = sibling;
+        node.Child2 = leaf;
+    }
+    if (oldParent != -1)
+    {
+        if (_nodes[oldParent].Child1 == sibling)
+            _nodes[oldParent].Child1 = newParent;
+        else
+            _nodes[oldParent].Child2 = newParent;
+    }
+    else
+    {
+        _root = newParent;
+    }
+    _nodes[sibling].Parent = newParent;
+    _nodes[leaf].Parent = newParent;
+
+    // Refit and balance the ancestors
+    index = newParent;
+    while (index != -1)
+    {
+        index = Balance(index);
+        Node& node = _nodes[index];
+        node.Height = 1 + Math::Max(_nodes[node.Child1].Height, _nodes[node.Child2].Height);
+        node.Bounds = Combine(_nodes[node.Child1].Bounds, _nodes[node.Child2].Bounds);
+        index = node.Parent;
+    }
+}
+
+void SceneRenderingBVH::RemoveLeaf(int32 leaf)
+{
+    if (leaf == _root)
+    {
+        _root = -1;
+        return;
+    }
+    const int32 parent = _nodes[leaf].Parent;
+    const int32 grandParent = _nodes[parent].Parent;
+    const int32 sibling = _nodes[parent].Child1 == leaf ? _nodes[parent].Child2 : _nodes[parent].Child1;
+    if (grandParent != -1)
+    {
+        // Replace parent with the sibling
+        if (_nodes[grandParent].Child1 == parent)
+            _nodes[grandParent].Child1 = sibling;
+        else
+            _nodes[grandParent].Child2 = sibling;
+        _nodes[sibling].Parent = grandParent;
+        FreeNode(parent);
+
+        // Refit and balance the ancestors
+        int32 index = grandParent;
+        while (index != -1)
+        {
+            index = Balance(index);
+            Node& node = _nodes[index];
+            node.Height = 1 + Math::Max(_nodes[node.Child1].Height, _nodes[node.Child2].Height);
+            node.Bounds = Combine(_nodes[node.Child1].Bounds, _nodes[node.Child2].Bounds);
+            index = node.Parent;
+        }
+    }
+    else
+    {
+        _root = sibling;
+        _nodes[sibling].Parent = -1;
+        FreeNode(parent);
+    }
+}
+
+int32 SceneRenderingBVH::Balance(int32 iA)
+{
+    Node& a = _nodes[iA];
+    if (a.IsLeaf() || a.Height < 2)
+        return iA;
+    const int32 iB = a.Child1;
+    const int32 iC = a.Child2;
+    Node& b = _nodes[iB];
+    Node& c = _nodes[iC];
+    const int32 balance = c.Height - b.Height;
+
+    if (balance > 1)
+    {
+        // Rotate C up
+        const int32 iF = c.Child1;
+        const int32 iG = c.Child2;
+        Node& f = _nodes[iF];
+        Node& g = _nodes[iG];
+        c.Child1 = iA;
+        c.Parent = a.Parent;
+        a.Parent = iC;
+        if (c.Parent != -1)
+        {
+            if (_nodes[c.Parent].Child1 == iA)
+                _nodes[c.Parent].Child1 = iC;
+            else
+                _nodes[c.Parent].Child2 = iC;
+        }
+        else
+        {
+            _root = iC;
+        }
+        if (f.Height > g.Height)
+        {
+            c.Child2 = iF;
+            a.Child2 = iG;
+            g.Parent = iA;
+            a.Bounds = Combine(b.Bounds, g.Bounds);
+            c.Bounds = Combine(a.Bounds, f.Bounds);
+            a.Height = 1 + Math::Max(b.Height, g.Height);
+            c.Height = 1 + Math::Max(a.Height, f.Height);
+        }
+        else
+        {
+            c.Child2 = iG;
+            a.Child2 = iF;
+            f.Parent = iA;
+            a.Bounds = Combine(b.Bounds, f.Bounds);
+            c.Bounds = Combine(a.Bounds, g.Bounds);
+            a.Height = 1 + Math::Max(b.Height, f.Height);
+            c.Height = 1 + Math::Max(a.Height, g.Height);
+        }
+        return iC;
+    }
+
+    if (balance < -1)
+    {
+        // Rotate B up
+        const int32 iD = b.Child1;
+        const int32 iE = b.Child2;
+        Node& d = _nodes[iD];
+        Node& e = _nodes[iE];
+        b.Child1 = iA;
+        b.Parent = a.Parent;
+        a.Parent = iB;
+        if (b.Parent != -1)
+        {
+            if (_nodes[b.Parent].Child1 == iA)
+                _nodes[b.Parent].Child1 = iB;
+            else
+                _nodes[b.Parent].Child2 = iB;
+        }
+        else
+        {
+            _root = iB;
+        }
+        if (d.Height > e.Height)
+        {
+            b.Child2 = iD;
+            a.Child1 = iE;
+            e.Parent = iA;
+            a.Bounds = Combine(c.Bounds, e.Bounds);
+            b.Bounds = Combine(a.Bounds, d.Bounds);
+            a.Height = 1 + Math::Max(c.Height, e.Height);
+            b.Height = 1 + Math::Max(a.Height, d.Height);
+        }
+        else
+        {
+            b.Child2 = iE;
+            a.Child1 = iD;
+            d.Parent = iA;
+            a.Bounds = Combine(c.Bounds, d.Bounds);
+            b.Bounds = Combine(a.Bounds, e.Bounds);
+            a.Height = 1 + Math::Max(c.Height, d.Height);
+            b.Height = 1 + Math::Max(a.Height, e.Height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+void SceneRenderingBVH::GatherLeaves(int32 index, Array<int32>& result) const
+{
+    Array<int32, InlinedAllocation<64>> stack;
+    stack.Add(index);
+    const Node* nodes = _nodes.Get();
+    while (stack.HasItems())
+    {
+        const Node& node = nodes[stack.Pop()];
+        if (node.IsLeaf())
+        {
+            result.Add(node.Key);
+        }
+        else
+        {
+            stack.Add(node.Child1);
+            stack.Add(node.Child2);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+
+struct BoundingFrustum;
+
+/// <summary>
+/// Incrementally maintained bounding volume hierarchy (dynamic AABB tree) used by the Scene Rendering to accelerate actors culling. Leaves store the scene rendering actor keys.
+/// </summary>
+/// <remarks>
+/// Leaf bounds can be enlarged by a margin (relative to the object size) so small movements don't modify the tree. Tree is kept balanced with rotations after each insertion and removal.
+/// </remarks>
+class FLAXENGINE_API SceneRenderingBVH
+{
+private:
+    struct Node
+    {
+        BoundingBox Bounds;
+        // Leaf object bounds (precomputed culling data to skip testing objects)
+        BoundingSphere Sphere;
+        // Parent node index (or next free node index for unused nodes)
+        int32 Parent;
+        int32 Child1;
+        int32 Child2;
+        // Node height (0 for leaves, -1 for unused nodes)
+        int32 Height;
+        // Leaf object key
+        int32 Key;
+
+        FORCE_INLINE bool IsLeaf() const
+        {
+            return Child1 == -1;
+        }
+    };
+
+    Array<Node> _nodes;
+    int32 _root = -1;
+    int32 _freeNode = -1;
+    int32 _leavesCount = 0;
+    float _margin = 0.0f;
+
+public:
+    /// <summary>
+    /// Gets the amount of objects in the tree.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _leavesCount;
+    }
+
+    /// <summary>
+    /// Gets the leaf bounds enlargement (relative to the object bounds radius).
+    /// </summary>
+    FORCE_INLINE float GetMargin() const
+    {
+        return _margin;
+    }
+
+    /// <summary>
+    /// Sets the leaf bounds enlargement (relative to the object bounds radius). Affects only objects added or updated later. Use 0 for static objects that don't move.
+    /// </summary>
+    FORCE_INLINE void SetMargin(float value)
+    {
+        _margin = value;
+    }
+
+    /// <summary>
+    /// Gets the tree height (0 for empty tree).
+    /// </summary>
+    FORCE_INLINE int32 GetHeight() const
+    {
+        return _root != -1 ? _nodes[_root].Height + 1 : 0;
+    }
+
+    /// <summary>
+    /// Adds the object to the tree.
+    /// </summary>
+    /// <param name="bounds">The object bounds.</param>
+    /// <param name="key">The object key.</param>
+    /// <returns>The tree leaf index (used to update or remove object).</returns>
+    int32 Add(const BoundingSphere& bounds, int32 key);
+
+    /// <summary>
+    /// Updates the object bounds. Tree gets modified only if new bounds doesn't fit into leaf bounds.
+    /// </summary>
+    /// <param name="leaf">The tree leaf index.</param>
+    /// <param name="bounds">The object bounds.</param>
+    /// <returns>True if leaf has been reinserted, otherwise false.</returns>
+    bool Update(int32 leaf, const BoundingSphere& bounds);
+
+    /// <summary>
+    /// Removes the object from the tree.
+    /// </summary>
+    /// <param name="leaf">The tree leaf index.</param>
+    void Remove(int32 leaf);
+
+    /// <summary>
+    /// Removes all objects from the tree.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Queries the tree for all objects which bounds intersect any of the given frustums. Subtrees that are fully inside the frustum are gathered without further tests, objects bounds are tested within the partially visible nodes.
+    /// </summary>
+    /// <param name="frustums">The frustums to test (relative to the origin).</param>
+    /// <param name="frustumsCount">The amount of frustums.</param>
+    /// <param name="origin">The frustums origin (used with large worlds).</param>
+    /// <param name="result">The output list with keys of the visible objects (results are appended).</param>
+    void Query(const BoundingFrustum* frustums, int32 frustumsCount, const Vector3& origin, Array<int32>& result) const;
+
+    /// <summary>
+    /// Queries the tree for all objects which bounds intersect the given box.
+    /// </summary>
+    /// <param name="box">The box to test.</param>
+    /// <param name="result">The output list with keys of the objects (results are appended).</param>
+    void Query(const BoundingBox& box, Array<int32>& result) const;
+
+private:
+    int32 AllocateNode();
+    void FreeNode(int32 index);
+    void InsertLeaf(int32 leaf);
+    void RemoveLeaf(int32 leaf);
+    int32 Balance(int32 index);
+    void GatherLeaves(int32 index, Array<int32>& result) const;
+};
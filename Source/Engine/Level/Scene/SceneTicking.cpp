@@ -3,6 +3,80 @@
 #include "SceneTicking.h"
 #include "Scene.h"
 #include "Engine/Scripting/Script.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#if !COMPILE_WITHOUT_CSHARP
+#include "Engine/Scripting/ManagedCLR/MCore.h"
+#include "Engine/Scripting/ManagedCLR/MClass.h"
+#include "Engine/Scripting/ManagedCLR/MMethod.h"
+#include "Engine/Debug/DebugLog.h"
+#endif
+
+// Minimum amount of async scripts ticked by a single job
+#define SCENE_TICKING_ASYNC_CHUNK_SIZE 64
+
+// Minimum amount of subsequent C# scripts ticked with a single call to the managed code (shorter sequences are called one by one)
+#define SCENE_TICKING_MANAGED_BATCH_MIN 8
+
+// Indices of the Script tick methods in the scripting type vtable (see Script::SetupType)
+#define SCENE_TICKING_VTABLE_UPDATE 8
+#define SCENE_TICKING_VTABLE_LATE_UPDATE 9
+#define SCENE_TICKING_VTABLE_FIXED_UPDATE 10
+#define SCENE_TICKING_VTABLE_LATE_FIXED_UPDATE 11
+
+namespace
+{
+#if !COMPILE_WITHOUT_CSHARP
+    // Cached method (FlaxEngine.CSharp.dll is loaded only once)
+    MMethod* TickScriptsMethod = nullptr;
+
+    // Managed array with scripts passed to the managed code (reused by each thread)
+    THREADLOCAL MGCHandle TickScriptsArrayHandle = 0;
+    THREADLOCAL int32 TickScriptsArraySize = 0;
+
+    void TickManagedScripts(Span<Script*> scripts, int32 scriptVTableIndex)
+    {
+        PROFILE_CPU();
+        if (TickScriptsMethod == nullptr)
+        {
+            TickScriptsMethod = Script::GetStaticClass()->GetMethod("Internal_TickScripts", 4);
+            ASSERT(TickScriptsMethod);
+        }
+
+        // Gather managed objects
+        Array<MObject*, InlinedAllocation<SCENE_TICKING_ASYNC_CHUNK_SIZE>> instances;
+        instances.Resize(scripts.Length());
+        for (int32 i = 0; i < scripts.Length(); i++)
+            instances.Get()[i] = scripts[i]->GetOrCreateManagedInstance();
+        MArray* array = TickScriptsArrayHandle ? (MArray*)MCore::GCHandle::GetTarget(TickScriptsArrayHandle) : nullptr;
+        if (array == nullptr || TickScriptsArraySize < scripts.Length())
+        {
+            if (TickScriptsArrayHandle)
+                MCore::GCHandle::Free(TickScriptsArrayHandle);
+            TickScriptsArraySize = Math::RoundUpToPowerOf2(Math::Max(scripts.Length(), SCENE_TICKING_ASYNC_CHUNK_SIZE));
+            array = MCore::Array::New(Script::GetStaticClass(), TickScriptsArraySize);
+            TickScriptsArrayHandle = MCore::GCHandle::New((MObject*)array);
+        }
+        MCore::GC::WriteArrayRef(array, ToSpan(instances));
+
+        // Call all scripts within a single managed method (it updates the direct call state for each script, preserve the state in case of nested tick)
+        Scripting::ManagedDirectCall* directCall = Scripting::GetManagedDirectCall();
+        const Scripting::ManagedDirectCall prevDirectCall = *directCall;
+        int32 count = scripts.Length();
+        void* params[4];
+        params[0] = array;
+        params[1] = &count;
+        params[2] = &scriptVTableIndex;
+        params[3] = &directCall;
+        MObject* exception = nullptr;
+        TickScriptsMethod->Invoke(nullptr, params, &exception);
+        *directCall = prevDirectCall;
+        if (exception)
+            DebugLog::LogException(exception);
+    }
+#endif
+}
 
 SceneTicking::TickData::TickData(int32 capacity)
     : Scripts(capacity)
@@ -10,21 +84,21 @@ SceneTicking::TickData::TickData(int32 capacity)
 {
 }
 
-void SceneTicking::TickData::AddScript(Script* script)
+void SceneTicking::TickData::AddScript(Script* script, bool async)
 {
-    Scripts.Add(script);
+    (async ? ScriptsAsync : Scripts).Add(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
-        ScriptsExecuteInEditor.Add(script);
+        (async ? ScriptsAsyncExecuteInEditor : ScriptsExecuteInEditor).Add(script);
 #endif
 }
 
-void SceneTicking::TickData::RemoveScript(Script* script)
+void SceneTicking::TickData::RemoveScript(Script* script, bool async)
 {
-    Scripts.Remove(script);
+    (async ? ScriptsAsync : Scripts).Remove(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
-        ScriptsExecuteInEditor.Remove(script);
+        (async ? ScriptsAsyncExecuteInEditor : ScriptsExecuteInEditor).Remove(script);
 #endif
 }
 
@@ -42,7 +116,9 @@ void SceneTicking::TickData::RemoveTick(void* callee)
 
 void SceneTicking::TickData::Tick()
 {
-    TickScripts(Scripts);
+    TickScripts(ToSpan(Scripts));
+    if (ScriptsAsync.HasItems())
+        TickScriptsAsync(ScriptsAsync);
 
     for (int32 i = 0; i < Ticks.Count(); i++)
         Ticks.Get()[i].Call();
@@ -64,7 +140,9 @@ void SceneTicking::TickData::RemoveTickExecuteInEditor(void* callee)
 
 void SceneTicking::TickData::TickExecuteInEditor()
 {
-    TickScripts(ScriptsExecuteInEditor);
+    TickScripts(ToSpan(ScriptsExecuteInEditor));
+    if (ScriptsAsyncExecuteInEditor.HasItems())
+        TickScriptsAsync(ScriptsAsyncExecuteInEditor);
 
     for (int32 i = 0; i < TicksExecuteInEditor.Count(); i++)
         TicksExecuteInEditor.Get()[i].Call();
@@ -75,24 +153,69 @@ void SceneTicking::TickData::TickExecuteInEditor()
 void SceneTicking::TickData::Clear()
 {
     Scripts.Clear();
+    ScriptsAsync.Clear();
     Ticks.Clear();
 #if USE_EDITOR
     ScriptsExecuteInEditor.Clear();
+    ScriptsAsyncExecuteInEditor.Clear();
     TicksExecuteInEditor.Clear();
 #endif
 }
 
-SceneTicking::FixedUpdateTickData::FixedUpdateTickData()
-    : TickData(512)
+void SceneTicking::TickData::TickScriptsAsync(const Array<Script*>& scripts)
 {
+    PROFILE_CPU_NAMED("Async Scripts");
+
+    // Split scripts into chunks executed by the job system threads (waits for all of them to end before returning)
+    JobSystem::ParallelFor(0, scripts.Count(), SCENE_TICKING_ASYNC_CHUNK_SIZE, [this, &scripts](int32 start, int32 end)
+    {
+        TickScripts(Span<Script*>(scripts.Get() + start, end - start));
+    });
 }
 
-void SceneTicking::FixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::TickData::CallScripts(Span<Script*> scripts, void (Script::*method)(), int32 scriptVTableIndex)
 {
+#if !COMPILE_WITHOUT_CSHARP
+    // Call subsequent C# scripts in batches to reduce the native-to-managed transitions count (keeps the original order of the scripts)
+    int32 batchStart = 0;
+    for (int32 i = 0; i < scripts.Length(); i++)
+    {
+        Script* script = scripts[i];
+        if (script->_tickManaged)
+            continue;
+        if (i - batchStart >= SCENE_TICKING_MANAGED_BATCH_MIN)
+            TickManagedScripts(Span<Script*>(scripts.Get() + batchStart, i - batchStart), scriptVTableIndex);
+        else
+        {
+            for (int32 j = batchStart; j < i; j++)
+                (scripts[j]->*method)();
+        }
+        (script->*method)();
+        batchStart = i + 1;
+    }
+    if (scripts.Length() - batchStart >= SCENE_TICKING_MANAGED_BATCH_MIN)
+        TickManagedScripts(Span<Script*>(scripts.Get() + batchStart, scripts.Length() - batchStart), scriptVTableIndex);
+    else
+    {
+        for (int32 j = batchStart; j < scripts.Length(); j++)
+            (scripts[j]->*method)();
+    }
+#else
     for (auto* script : scripts)
     {
-        script->OnFixedUpdate();
+        (script->*method)();
     }
+#endif
+}
+
+SceneTicking::FixedUpdateTickData::FixedUpdateTickData()
+    : TickData(512)
+{
+}
+
+void SceneTicking::FixedUpdateTickData::TickScripts(Span<Script*> scripts)
+{
+    CallScripts(scripts, &Script::OnFixedUpdate, SCENE_TICKING_VTABLE_FIXED_UPDATE);
 }
 
 SceneTicking::UpdateTickData::UpdateTickData()
@@ -100,12 +223,9 @@ SceneTicking::UpdateTickData::UpdateTickData()
 {
 }
 
-void SceneTicking::UpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::UpdateTickData::TickScripts(Span<Script*> scripts)
 {
-    for (auto* script : scripts)
-    {
-        script->OnUpdate();
-    }
+    CallScripts(scripts, &Script::OnUpdate, SCENE_TICKING_VTABLE_UPDATE);
 }
 
 SceneTicking::LateUpdateTickData::LateUpdateTickData()
@@ -113,12 +233,9 @@ SceneTicking::LateUpdateTickData::LateUpdateTickData()
 {
 }
 
-void SceneTicking::LateUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateUpdateTickData::TickScripts(Span<Script*> scripts)
 {
-    for (auto* script : scripts)
-    {
-        script->OnLateUpdate();
-    }
+    CallScripts(scripts, &Script::OnLateUpdate, SCENE_TICKING_VTABLE_LATE_UPDATE);
 }
 
 SceneTicking::LateFixedUpdateTickData::LateFixedUpdateTickData()
@@ -126,12 +243,9 @@ SceneTicking::LateFixedUpdateTickData::LateFixedUpdateTickData()
 {
 }
 
-void SceneTicking::LateFixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateFixedUpdateTickData::TickScripts(Span<Script*> scripts)
 {
-    for (auto* script : scripts)
-    {
-        script->OnLateFixedUpdate();
-    }
+    CallScripts(scripts, &Script::OnLateFixedUpdate, SCENE_TICKING_VTABLE_LATE_FIXED_UPDATE);
 }
 
 void SceneTicking::AddScript(Script* obj)
@@ -140,7 +254,7 @@ void SceneTicking::AddScript(Script* obj)
     if (obj->_tickFixedUpdate)
         FixedUpdate.AddScript(obj);
     if (obj->_tickUpdate)
-        Update.AddScript(obj);
+        Update.AddScript(obj, obj->_tickUpdateAsync);
     if (obj->_tickLateUpdate)
         LateUpdate.AddScript(obj);
     if (obj->_tickLateFixedUpdate)
@@ -153,7 +267,7 @@ void SceneTicking::RemoveScript(Script* obj)
     if (obj->_tickFixedUpdate)
         FixedUpdate.RemoveScript(obj);
     if (obj->_tickUpdate)
-        Update.RemoveScript(obj);
+        Update.RemoveScript(obj, obj->_tickUpdateAsync);
     if (obj->_tickLateUpdate)
         LateUpdate.RemoveScript(obj);
     if (obj->_tickLateFixedUpdate)
@@ -4,6 +4,7 @@
 
 #include "Engine/Level/Types.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 
 /// <summary>
 /// Scene gameplay updating helper subsystem that boosts the level ticking by providing efficient objects cache.
@@ -48,18 +49,21 @@ class FLAXENGINE_API SceneTicking
     {
     public:
         Array<Script*> Scripts;
+        // Scripts that are thread-safe and can be ticked in parallel (after the other scripts)
+        Array<Script*> ScriptsAsync;
         Array<Tick> Ticks;
 #if USE_EDITOR
         Array<Script*> ScriptsExecuteInEditor;
+        Array<Script*> ScriptsAsyncExecuteInEditor;
         Array<Tick> TicksExecuteInEditor;
 #endif
 
         TickData(int32 capacity);
 
-        virtual void TickScripts(const Array<Script*>& scripts) = 0;
+        virtual void TickScripts(Span<Script*> scripts) = 0;
 
-        void AddScript(Script* script);
-        void RemoveScript(Script* script);
+        void AddScript(Script* script, bool async = false);
+        void RemoveScript(Script* script, bool async = false);
 
         template<class T, void(T::*Method)()>
         void AddTick(T* callee)
@@ -86,34 +90,40 @@ class FLAXENGINE_API SceneTicking
 #endif
 
         void Clear();
+
+    protected:
+        static void CallScripts(Span<Script*> scripts, void (Script::*method)(), int32 scriptVTableIndex);
+
+    private:
+        void TickScriptsAsync(const Array<Script*>& scripts);
     };
 
     class FLAXENGINE_API FixedUpdateTickData : public TickData
     {
     public:
         FixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
     class FLAXENGINE_API UpdateTickData : public TickData
     {
     public:
         UpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
     class FLAXENGINE_API LateUpdateTickData : public TickData
     {
     public:
         LateUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
     class FLAXENGINE_API LateFixedUpdateTickData : public TickData
     {
     public:
         LateFixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(Span<Script*> scripts) override;
     };
 
 public:
@@ -39,6 +39,12 @@ void SceneInfo::Serialize(SerializeStream& stream, const void* otherObj)
             stream.JKEY("Lightmap2");
             stream.Guid(info.Lightmap2);
 
+            if (info.BakeHash != 0)
+            {
+                stream.JKEY("BakeHash");
+                stream.Uint(info.BakeHash);
+            }
+
             stream.EndObject();
         }
         stream.EndArray(lightmapsCount);
@@ -68,6 +74,7 @@ void SceneInfo::Deserialize(DeserializeStream& stream, ISerializeModifier* modif
             lightmap.Lightmap0 = JsonTools::GetGuid(lightmapsData, "Lightmap0");
             lightmap.Lightmap1 = JsonTools::GetGuid(lightmapsData, "Lightmap1");
             lightmap.Lightmap2 = JsonTools::GetGuid(lightmapsData, "Lightmap2");
+            lightmap.BakeHash = JsonTools::GetUint(lightmapsData, "BakeHash", 0);
         }
     }
 
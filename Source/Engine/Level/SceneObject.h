@@ -103,6 +103,23 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API SceneObject : public Scripting
         return (Flags & ObjectFlags::IsDuringPlay) == ObjectFlags::IsDuringPlay;
     }
 
+    /// <summary>
+    /// Determines whether object has been modified since the scene was loaded or saved to the asset. Used to save only the changed objects with the scene delta (see Level.SaveSceneDeltaToBytes).
+    /// </summary>
+    /// <remarks>Transform, hierarchy, name and activity changes mark the object automatically. Other modifications (eg. custom properties changed by the gameplay code) should call MarkDirty.</remarks>
+    API_PROPERTY() FORCE_INLINE bool IsDirty() const
+    {
+        return (Flags & ObjectFlags::IsDirty) == ObjectFlags::IsDirty;
+    }
+
+    /// <summary>
+    /// Marks the object as modified so it will be included in the next scene delta.
+    /// </summary>
+    API_FUNCTION() FORCE_INLINE void MarkDirty()
+    {
+        Flags |= ObjectFlags::IsDirty;
+    }
+
     /// <summary>
     /// Returns true if object has a parent assigned.
     /// </summary>
@@ -14,6 +14,7 @@ class JsonAsset;
 class Level;
 class PrefabManager;
 class PrefabInstanceData;
+class ActorPool;
 class Script;
 class ManagedScript;
 class SceneInfo;
@@ -8,10 +8,19 @@
 #include "Engine/Core/Config/GameSettings.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/Serialization.h"
 #include <locale>
 
+// Localized message resolved from all active tables (in priority order) for every plural form
+struct CompiledMessage
+{
+    // Points to the entry key in the source table (valid as long as the lookup version doesn't change)
+    StringView Id;
+    Array<const String*, InlinedAllocation<4>> Values;
+};
+
 class LocalizationService : public EngineService
 {
 public:
@@ -20,6 +29,14 @@ class LocalizationService : public EngineService
     Array<AssetReference<LocalizedStringTable>> LocalizedStringTables;
     Array<AssetReference<LocalizedStringTable>> FallbackStringTables;
 
+    // Compiled lookup of all active tables (rebuilt when tables or language change) so strings resolve with a single hashed lookup
+    // Tables, versions and the compiled lookup are guarded by the CompileLocker (lookup values point into the tables data thus must be read under the lock)
+    CriticalSection CompileLocker;
+    int32 Version = 1;
+    int32 CompiledVersion = 0;
+    Array<CompiledMessage> Messages;
+    Dictionary<StringView, int32> Lookup;
+
     LocalizationService()
         : EngineService(TEXT("Localization"), -500)
         , CurrentCulture(0)
@@ -29,39 +46,66 @@ class LocalizationService : public EngineService
 
     void OnLocalizationChanged();
 
-    const String& Get(const String& id, int32 index, const String& fallback) const
+    void Compile(const LocalizedStringTable* table)
     {
-        if (id.IsEmpty())
-            return fallback;
-
-        // Try current tables
-        for (auto& e : LocalizedStringTables)
+        if (!table)
+            return;
+        for (const auto& e : table->Entries)
         {
-            const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
-        }
+            int32 messageIndex;
+            if (!Lookup.TryGet(e.Key, messageIndex))
+            {
+                messageIndex = Messages.Count();
+                Messages.AddOne().Id = e.Key;
+                Lookup.Add(e.Key, messageIndex);
+            }
 
-        // Try fallback tables for current tables
-        for (auto& e : LocalizedStringTables)
-        {
-            const auto table = e.Get();
-            const auto fallbackTable = table ? table->FallbackTable.Get() : nullptr;
-            const auto messages = fallbackTable ? fallbackTable->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            // Higher priority tables were already processed so only missing plural forms get added
+            auto& values = Messages[messageIndex].Values;
+            for (int32 i = values.Count(); i < e.Value.Count(); i++)
+                values.Add(&e.Value[i]);
         }
+    }
 
-        // Try fallback language tables
+    // Rebuilds the lookup if tables were modified (call only with CompileLocker taken)
+    void EnsureCompiled()
+    {
+        const int32 version = Version;
+        if (CompiledVersion == version)
+            return;
+        PROFILE_CPU_NAMED("Localization.Compile");
+        Messages.Clear();
+        Lookup.Clear();
+
+        // Use the same priority as tables lookup: current tables, fallback tables of the current tables, fallback language tables
+        for (auto& e : LocalizedStringTables)
+            Compile(e.Get());
+        for (auto& e : LocalizedStringTables)
+            Compile(e.Get() ? e.Get()->FallbackTable.Get() : nullptr);
         for (auto& e : FallbackStringTables)
+            Compile(e.Get());
+        CompiledVersion = version;
+    }
+
+    // Finds the message in the compiled lookup (call only with CompileLocker taken)
+    int32 Find(const StringView& id)
+    {
+        if (id.IsEmpty())
+            return -1;
+        EnsureCompiled();
+        int32 messageIndex;
+        return Lookup.TryGet(id, messageIndex) ? messageIndex : -1;
+    }
+
+    // Gets the message value (call only with CompileLocker taken, the returned reference is valid as long as the lock is held)
+    const String& Get(int32 messageIndex, int32 index, const String& fallback) const
+    {
+        if (messageIndex != -1)
         {
-            const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            const auto& values = Messages[messageIndex].Values;
+            if (index < values.Count())
+                return *values[index];
         }
-
         return fallback;
     }
 
@@ -142,22 +186,45 @@ LocalizedString& LocalizedString::operator=(String&& value) noexcept
     return *this;
 }
 
+int32 LocalizedString::Resolve() const
+{
+    // Called with Instance.CompileLocker taken
+    if (Id.IsEmpty())
+        return -1;
+    Instance.EnsureCompiled();
+
+    // Reuse the message resolved previously if lookup didn't change
+    if (_cachedVersion == Instance.CompiledVersion && _cachedIndex < Instance.Messages.Count() && Instance.Messages[_cachedIndex].Id == Id)
+        return _cachedIndex;
+    const int32 messageIndex = Instance.Find(Id);
+    if (messageIndex != -1)
+    {
+        _cachedIndex = messageIndex;
+        _cachedVersion = Instance.CompiledVersion;
+    }
+    return messageIndex;
+}
+
 String LocalizedString::ToString() const
 {
-    return Localization::GetString(Id, Value);
+    ScopeLock lock(Instance.CompileLocker);
+    return Instance.Get(Resolve(), 0, Value);
 }
 
 String LocalizedString::ToStringPlural(int32 n) const
 {
-    return Localization::GetPluralString(Id, n, Value);
+    CHECK_RETURN(n >= 1, String::Format(Value.GetText(), n));
+    ScopeLock lock(Instance.CompileLocker);
+    const String& format = Instance.Get(Resolve(), n - 1, Value);
+    return String::Format(format.GetText(), n);
 }
 
 void LocalizationService::OnLocalizationChanged()
 {
     PROFILE_CPU();
 
-    Instance.LocalizedStringTables.Clear();
-    Instance.FallbackStringTables.Clear();
+    Array<AssetReference<LocalizedStringTable>> localizedStringTables;
+    Array<AssetReference<LocalizedStringTable>> fallbackStringTables;
     const StringView en(TEXT("en"));
 
     // Collect all localization tables into mapping locale -> tables
@@ -205,7 +272,7 @@ void LocalizationService::OnLocalizationChanged()
             }
         }
         LOG(Info, "Using localization for {0}", locale);
-        Instance.LocalizedStringTables.Add(table->Get(), table->Count());
+        localizedStringTables.Add(table->Get(), table->Count());
         if (locale != settings.DefaultFallbackLanguage || locale != en)
         {
             // Cache fallback language tables to support additional text resolving in case of missing entries in the current language
@@ -214,7 +281,7 @@ void LocalizationService::OnLocalizationChanged()
                 table = tables.TryGet(en);
             if (table)
             {
-                Instance.FallbackStringTables.Add(table->Get(), table->Count());
+                fallbackStringTables.Add(table->Get(), table->Count());
             }
         }
     }
@@ -257,6 +324,15 @@ void LocalizationService::OnLocalizationChanged()
     }
 #endif
 
+    // Apply the new tables and build the lookup for them
+    {
+        ScopeLock lock(Instance.CompileLocker);
+        Instance.LocalizedStringTables = MoveTemp(localizedStringTables);
+        Instance.FallbackStringTables = MoveTemp(fallbackStringTables);
+        Instance.Version++;
+        Instance.EnsureCompiled();
+    }
+
     // Send event
     Localization::LocalizationChanged();
 }
@@ -317,12 +393,25 @@ void Localization::SetCurrentLanguageCulture(const CultureInfo& value)
 
 String Localization::GetString(const String& id, const String& fallback)
 {
-    return Instance.Get(id, 0, fallback);
+    ScopeLock lock(Instance.CompileLocker);
+    return Instance.Get(Instance.Find(id), 0, fallback);
 }
 
 String Localization::GetPluralString(const String& id, int32 n, const String& fallback)
 {
     CHECK_RETURN(n >= 1, String::Format(fallback.GetText(), n));
-    const String& format = Instance.Get(id, n - 1, fallback);
+    ScopeLock lock(Instance.CompileLocker);
+    const String& format = Instance.Get(Instance.Find(id), n - 1, fallback);
     return String::Format(format.GetText(), n);
 }
+
+CriticalSection& Localization::GetLocker()
+{
+    return Instance.CompileLocker;
+}
+
+void Localization::OnTablesChanged()
+{
+    ScopeLock lock(Instance.CompileLocker);
+    Instance.Version++;
+}
@@ -4,6 +4,7 @@
 
 #include "CultureInfo.h"
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Platform/CriticalSection.h"
 
 /// <summary>
 /// The language and culture localization manager.
@@ -59,4 +60,14 @@ API_CLASS(Static) class FLAXENGINE_API Localization
     /// <param name="fallback">The optional fallback string value to use if localized string is missing.</param>
     /// <returns>The localized text.</returns>
     API_FUNCTION() static String GetPluralString(const String& id, int32 n, const String& fallback = String::Empty);
+
+    /// <summary>
+    /// Gets the lock that guards the compiled strings lookup. Localized string tables modify their entries with it taken so the lookup never points to the released strings.
+    /// </summary>
+    static CriticalSection& GetLocker();
+
+    /// <summary>
+    /// Invalidates the compiled strings lookup. Called when any of the localized string tables gets modified or reloaded.
+    /// </summary>
+    static void OnTablesChanged();
 };
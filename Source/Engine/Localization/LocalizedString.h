@@ -57,6 +57,13 @@ API_CLASS(Sealed) class FLAXENGINE_API LocalizedString
 public:
     String ToString() const;
     String ToStringPlural(int32 n) const;
+
+private:
+    // Cached index of the resolved message in the compiled localization lookup (valid for a specific lookup version)
+    mutable int32 _cachedIndex = -1;
+    mutable int32 _cachedVersion = 0;
+
+    int32 Resolve() const;
 };
 
 inline uint32 GetHash(const LocalizedString& key)
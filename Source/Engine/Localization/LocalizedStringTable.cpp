@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "LocalizedStringTable.h"
+#include "Localization.h"
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Serialization/SerializationFwd.h"
@@ -20,17 +21,21 @@ LocalizedStringTable::LocalizedStringTable(const SpawnParams& params, const Asse
 
 void LocalizedStringTable::AddString(const StringView& id, const StringView& value)
 {
+    ScopeLock lock(Localization::GetLocker());
     auto& values = Entries[id];
     values.Resize(1);
     values[0] = value;
+    Localization::OnTablesChanged();
 }
 
 void LocalizedStringTable::AddPluralString(const StringView& id, const StringView& value, int32 n)
 {
     CHECK(n >= 0 && n < 1024);
+    ScopeLock lock(Localization::GetLocker());
     auto& values = Entries[id];
     values.Resize(Math::Max(values.Count(), n + 1));
     values[n] = value;
+    Localization::OnTablesChanged();
 }
 
 String LocalizedStringTable::GetString(const String& id) const
@@ -62,6 +67,7 @@ Asset::LoadResult LocalizedStringTable::loadAsset()
     if (result != LoadResult::Ok || IsInternalType())
         return result;
 
+    ScopeLock lock(Localization::GetLocker());
     JsonTools::GetString(Locale, *Data, "Locale");
     JsonTools::GetReference(FallbackTable, *Data, "FallbackTable");
     const auto entriesMember = SERIALIZE_FIND_MEMBER((*Data), "Entries");
@@ -86,6 +92,7 @@ Asset::LoadResult LocalizedStringTable::loadAsset()
             }
         }
     }
+    Localization::OnTablesChanged();
 
     return result;
 }
@@ -95,9 +102,11 @@ void LocalizedStringTable::unload(bool isReloading)
     // Base
     JsonAssetBase::unload(isReloading);
 
+    ScopeLock lock(Localization::GetLocker());
     Locale.Clear();
     FallbackTable = nullptr;
     Entries.Clear();
+    Localization::OnTablesChanged();
 }
 
 void LocalizedStringTable::OnGetData(rapidjson_flax::StringBuffer& buffer) const
@@ -8,8 +8,25 @@
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/recastnavigation/DetourCrowd.h>
 
+// The minimum amount of active agents to update within a single job (smaller crowds are updated on a calling thread)
+#define NAV_CROWD_MIN_AGENTS_PER_JOB 64
+
+namespace
+{
+    void CrowdParallelFor(void* context, void (*func)(void* data, int index), void* data, int count)
+    {
+        const int64 label = JobSystem::Dispatch([func, data](int32 index)
+        {
+            PROFILE_CPU_NAMED("NavCrowd.Job");
+            func(data, index);
+        }, count);
+        JobSystem::Wait(label);
+    }
+}
+
 NavCrowd::NavCrowd(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -82,7 +99,17 @@ bool NavCrowd::Init(float maxAgentRadius, int32 maxAgents, NavMeshRuntime* navMe
         }
     }
 
-    return !_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh());
+    if (!_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh()))
+        return true;
+
+    // Use parallel update for large crowds
+    const int32 maxJobs = Math::Min(JobSystem::GetThreadsCount(), maxAgents / NAV_CROWD_MIN_AGENTS_PER_JOB);
+    if (maxJobs > 1 && !_crowd->setParallelUpdate(maxJobs, NAV_CROWD_MIN_AGENTS_PER_JOB, CrowdParallelFor, nullptr))
+    {
+        LOG(Warning, "Failed to setup parallel crowd update.");
+        _crowd->setParallelUpdate(1, 1, nullptr, nullptr);
+    }
+    return false;
 }
 
 int32 NavCrowd::AddAgent(const Vector3& position, const NavAgentProperties& properties)
@@ -133,6 +160,32 @@ void NavCrowd::SetAgentVelocity(int32 id, const Vector3& velocity)
     }
 }
 
+void NavCrowd::GetAgentStates(const Span<int32>& ids, Span<Vector3> positions, Span<Vector3> velocities) const
+{
+    ASSERT(positions.Length() == 0 || positions.Length() == ids.Length());
+    ASSERT(velocities.Length() == 0 || velocities.Length() == ids.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        const dtCrowdAgent* agent = _crowd->getAgent(ids[i]);
+        if (positions.Length() != 0)
+            positions[i] = agent ? Vector3(Float3(agent->npos)) : Vector3::Zero;
+        if (velocities.Length() != 0)
+            velocities[i] = agent ? Vector3(Float3(agent->vel)) : Vector3::Zero;
+    }
+}
+
+void NavCrowd::GetAgentPositions(const Span<int32>& ids, Array<Vector3>& positions) const
+{
+    positions.Resize(ids.Length());
+    GetAgentStates(ids, ToSpan(positions), Span<Vector3>());
+}
+
+void NavCrowd::GetAgentVelocities(const Span<int32>& ids, Array<Vector3>& velocities) const
+{
+    velocities.Resize(ids.Length());
+    GetAgentStates(ids, Span<Vector3>(), ToSpan(velocities));
+}
+
 void NavCrowd::SetAgentProperties(int32 id, const NavAgentProperties& properties)
 {
     dtCrowdAgentParams agentParams;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Core/Collections/Array.h"
 #include "NavigationTypes.h"
 
 class NavMesh;
@@ -84,6 +85,28 @@ API_CLASS() class FLAXENGINE_API NavCrowd : public ScriptingObject
     /// <param name="velocity">The agent velocity (direction * speed).</param>
     API_FUNCTION() void SetAgentVelocity(int32 id, const Vector3& velocity);
 
+    /// <summary>
+    /// Gets the current positions and velocities of the agents. Batched version of GetAgentPosition and GetAgentVelocity.
+    /// </summary>
+    /// <param name="ids">The agent IDs.</param>
+    /// <param name="positions">The output agent positions (matching ids). Can be empty to skip it.</param>
+    /// <param name="velocities">The output agent velocities (matching ids). Can be empty to skip it.</param>
+    void GetAgentStates(const Span<int32>& ids, Span<Vector3> positions, Span<Vector3> velocities) const;
+
+    /// <summary>
+    /// Gets the current positions of the agents. Batched version of GetAgentPosition.
+    /// </summary>
+    /// <param name="ids">The agent IDs.</param>
+    /// <param name="positions">The output agent positions (matching ids).</param>
+    API_FUNCTION() void GetAgentPositions(const Span<int32>& ids, API_PARAM(Out) Array<Vector3>& positions) const;
+
+    /// <summary>
+    /// Gets the current velocities of the agents (direction * speed). Batched version of GetAgentVelocity.
+    /// </summary>
+    /// <param name="ids">The agent IDs.</param>
+    /// <param name="velocities">The output agent velocities (matching ids).</param>
+    API_FUNCTION() void GetAgentVelocities(const Span<int32>& ids, API_PARAM(Out) Array<Vector3>& velocities) const;
+
     /// <summary>
     /// Updates the agent properties.
     /// </summary>
@@ -117,7 +140,7 @@ API_CLASS() class FLAXENGINE_API NavCrowd : public ScriptingObject
     API_FUNCTION() void RemoveAgent(int32 id);
 
     /// <summary>
-    /// Updates the steering and positions of all agents.
+    /// Updates the steering and positions of all agents. Large crowds are updated in parallel using Job System (agents are split into ranges per update stage).
     /// </summary>
     /// <param name="dt">The simulation update delta time (in seconds).</param>
     API_FUNCTION() void Update(float dt);
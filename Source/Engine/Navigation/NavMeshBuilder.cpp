@@ -9,20 +9,24 @@
 #include "NavLink.h"
 #include "NavModifierVolume.h"
 #include "NavMeshRuntime.h"
+#include "NavMeshTileCache.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Physics/Colliders/BoxCollider.h"
 #include "Engine/Physics/Colliders/SphereCollider.h"
 #include "Engine/Physics/Colliders/CapsuleCollider.h"
 #include "Engine/Physics/Colliders/MeshCollider.h"
 #include "Engine/Physics/Colliders/SplineCollider.h"
-#include "Engine/Threading/ThreadPoolTask.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Terrain/TerrainPatch.h"
 #include "Engine/Terrain/Terrain.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
+#include "Engine/Level/Actors/Camera.h"
 #include <ThirdParty/recastnavigation/Recast.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
@@ -59,6 +63,7 @@ struct OffMeshLink
     float Radius;
     bool BiDir;
     int32 Id;
+    BoundingBox Bounds;
 };
 
 struct Modifier
@@ -67,83 +72,97 @@ struct Modifier
     NavAreaProperties* NavArea;
 };
 
-struct NavSceneRasterizer
+// The navigation geometry mesh (in navmesh space) with cached per-triangle areas
+struct NavBuildMesh
 {
-    NavMesh* NavMesh;
-    BoundingBox TileBoundsNavMesh;
+    BoundingBox BoundsNavMesh;
+    Array<Float3> Vertices;
+    Array<int32> Indices;
+    Array<unsigned char> Areas;
+};
+
+// The navigation geometry gathered once for the whole dirty region and shared by all tiles built within it
+struct NavBuildGeometry
+{
+    NavMeshProperties Properties;
+    BoundingBox BoundsNavMesh;
     Matrix WorldToNavMesh;
-    rcContext* Context;
-    rcConfig* Config;
-    rcHeightfield* Heightfield;
+    bool IsWorldToNavMeshIdentity;
+    bool BuildCacheLayers;
     float WalkableThreshold;
+    Array<NavBuildMesh> Meshes;
+    Array<OffMeshLink> OffMeshLinks;
+    Array<Modifier> Modifiers;
     Array<Float3> VertexBuffer;
     Array<int32> IndexBuffer;
-    Array<OffMeshLink>* OffMeshLinks;
-    Array<Modifier>* Modifiers;
-    const bool IsWorldToNavMeshIdentity;
-
-    NavSceneRasterizer(::NavMesh* navMesh, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, rcContext* context, rcConfig* config, rcHeightfield* heightfield, Array<OffMeshLink>* offMeshLinks, Array<Modifier>* modifiers)
-        : TileBoundsNavMesh(tileBoundsNavMesh)
-        , WorldToNavMesh(worldToNavMesh)
-        , IsWorldToNavMeshIdentity(worldToNavMesh.IsIdentity())
+    bool Ready = false;
+    int32 RefCount = 0;
+
+    void Gather()
     {
-        NavMesh = navMesh;
-        Context = context;
-        Config = config;
-        Heightfield = heightfield;
-        WalkableThreshold = Math::Cos(config->walkableSlopeAngle * DegreesToRadians);
-        OffMeshLinks = offMeshLinks;
-        Modifiers = modifiers;
+        PROFILE_CPU_NAMED("GatherGeometry");
+        ScopeLock lock(Level::ScenesLock);
+        for (Scene* scene : Level::Scenes)
+        {
+            for (Actor* actor : scene->Navigation.Actors)
+            {
+                BoundingBox actorBoxNavMesh;
+                BoundingBox::Transform(actor->GetBox(), WorldToNavMesh, actorBoxNavMesh);
+                if (actorBoxNavMesh.Intersects(BoundsNavMesh) &&
+                    actor->IsActiveInHierarchy() &&
+                    EnumHasAllFlags(actor->GetStaticFlags(), StaticFlags::Navigation))
+                {
+                    Gather(actor);
+                }
+            }
+        }
+        VertexBuffer.Resize(0);
+        IndexBuffer.Resize(0);
     }
 
-    void RasterizeTriangles()
+    void AddTriangles()
     {
         auto& vb = VertexBuffer;
         auto& ib = IndexBuffer;
-        if (vb.IsEmpty() || ib.IsEmpty())
+        if (vb.IsEmpty() || ib.Count() < 3)
+        {
+            vb.Clear();
+            ib.Clear();
             return;
+        }
         PROFILE_CPU();
 
-        // Rasterize triangles
-        const Float3* vbData = vb.Get();
-        const int32* ibData = ib.Get();
-        Float3 v0, v1, v2;
-        if (IsWorldToNavMeshIdentity)
+        // Transform vertices from world space into the navmesh space
+        if (!IsWorldToNavMeshIdentity)
         {
-            // Faster path
-            for (int32 i0 = 0; i0 < ib.Count();)
-            {
-                v0 = vbData[ibData[i0++]];
-                v1 = vbData[ibData[i0++]];
-                v2 = vbData[ibData[i0++]];
-#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
-                DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
-#endif
-
-                auto n = Float3::Cross(v0 - v1, v0 - v2);
-                n.Normalize();
-                const char area = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
-                rcRasterizeTriangle(Context, &v0.X, &v1.X, &v2.X, area, *Heightfield);
-            }
+            const Matrix worldToNavMesh = WorldToNavMesh;
+            for (auto& v : vb)
+                Float3::Transform(v, worldToNavMesh, v);
         }
-        else
+
+        BoundingBox bounds;
+        BoundingBox::FromPoints(vb.Get(), vb.Count(), bounds);
+        if (bounds.Intersects(BoundsNavMesh))
         {
-            // Transform vertices from world space into the navmesh space
-            const Matrix worldToNavMesh = WorldToNavMesh;
-            for (int32 i0 = 0; i0 < ib.Count();)
+            // Detect walkable triangles once so tiles can rasterize the whole mesh at once
+            const int32 trianglesCount = ib.Count() / 3;
+            auto& mesh = Meshes.AddOne();
+            mesh.BoundsNavMesh = bounds;
+            mesh.Areas.Resize(trianglesCount);
+            const Float3* vbData = vb.Get();
+            const int32* ibData = ib.Get();
+            for (int32 i = 0; i < trianglesCount; i++)
             {
-                Float3::Transform(vbData[ibData[i0++]], worldToNavMesh, v0);
-                Float3::Transform(vbData[ibData[i0++]], worldToNavMesh, v1);
-                Float3::Transform(vbData[ibData[i0++]], worldToNavMesh, v2);
-#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
-                DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
-#endif
-
+                const Float3& v0 = vbData[ibData[i * 3 + 0]];
+                const Float3& v1 = vbData[ibData[i * 3 + 1]];
+                const Float3& v2 = vbData[ibData[i * 3 + 2]];
                 auto n = Float3::Cross(v0 - v1, v0 - v2);
                 n.Normalize();
-                const char area = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
-                rcRasterizeTriangle(Context, &v0.X, &v1.X, &v2.X, area, *Heightfield);
+                mesh.Areas[i] = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
             }
+            ib.Resize(trianglesCount * 3);
+            mesh.Vertices = MoveTemp(vb);
+            mesh.Indices = MoveTemp(ib);
         }
 
         // Clear after use
@@ -222,7 +241,7 @@ struct NavSceneRasterizer
         }
     }
 
-    void Rasterize(Actor* actor)
+    void Gather(Actor* actor)
     {
         if (const auto* boxCollider = dynamic_cast<BoxCollider*>(actor))
         {
@@ -232,7 +251,7 @@ struct NavSceneRasterizer
 
             const OrientedBoundingBox box = boxCollider->GetOrientedBox();
             TriangulateBox(VertexBuffer, IndexBuffer, box);
-            RasterizeTriangles();
+            AddTriangles();
         }
         else if (const auto* sphereCollider = dynamic_cast<SphereCollider*>(actor))
         {
@@ -242,7 +261,7 @@ struct NavSceneRasterizer
 
             const BoundingSphere sphere = sphereCollider->GetSphere();
             TriangulateSphere(VertexBuffer, IndexBuffer, sphere);
-            RasterizeTriangles();
+            AddTriangles();
         }
         else if (const auto* capsuleCollider = dynamic_cast<CapsuleCollider*>(actor))
         {
@@ -252,7 +271,7 @@ struct NavSceneRasterizer
 
             const BoundingBox box = capsuleCollider->GetBox();
             TriangulateBox(VertexBuffer, IndexBuffer, box);
-            RasterizeTriangles();
+            AddTriangles();
         }
         else if (const auto* meshCollider = dynamic_cast<MeshCollider*>(actor))
         {
@@ -269,7 +288,7 @@ struct NavSceneRasterizer
             meshCollider->GetLocalToWorldMatrix(meshColliderToWorld);
             for (auto& v : VertexBuffer)
                 Float3::Transform(v, meshColliderToWorld, v);
-            RasterizeTriangles();
+            AddTriangles();
         }
         else if (const auto* splineCollider = dynamic_cast<SplineCollider*>(actor))
         {
@@ -282,7 +301,7 @@ struct NavSceneRasterizer
                 return;
 
             splineCollider->ExtractGeometry(VertexBuffer, IndexBuffer);
-            RasterizeTriangles();
+            AddTriangles();
         }
         else if (const auto* terrain = dynamic_cast<Terrain*>(actor))
         {
@@ -293,12 +312,12 @@ struct NavSceneRasterizer
                 const auto patch = terrain->GetPatch(patchIndex);
                 BoundingBox patchBoundsNavMesh;
                 BoundingBox::Transform(patch->GetBounds(), WorldToNavMesh, patchBoundsNavMesh);
-                if (!patchBoundsNavMesh.Intersects(TileBoundsNavMesh))
+                if (!patchBoundsNavMesh.Intersects(BoundsNavMesh))
                     continue;
 
                 // TODO: get collision only from tile area
                 patch->ExtractCollisionGeometry(VertexBuffer, IndexBuffer);
-                RasterizeTriangles();
+                AddTriangles();
             }
         }
         else if (const auto* navLink = dynamic_cast<NavLink*>(actor))
@@ -313,12 +332,13 @@ struct NavSceneRasterizer
             link.Radius = navLink->Radius;
             link.BiDir = navLink->BiDirectional;
             link.Id = GetHash(navLink->GetID());
+            link.Bounds = BoundingBox(Float3::Min(link.Start, link.End) - link.Radius, Float3::Max(link.Start, link.End) + link.Radius);
 
-            OffMeshLinks->Add(link);
+            OffMeshLinks.Add(link);
         }
         else if (const auto* navModifierVolume = dynamic_cast<NavModifierVolume*>(actor))
         {
-            if (navModifierVolume->AgentsMask.IsNavMeshSupported(NavMesh->Properties))
+            if (navModifierVolume->AgentsMask.IsNavMeshSupported(Properties))
             {
                 PROFILE_CPU_NAMED("NavModifierVolume");
 
@@ -328,7 +348,7 @@ struct NavSceneRasterizer
                 bounds.GetBoundingBox(modifier.Bounds);
                 modifier.NavArea = navModifierVolume->GetNavArea();
 
-                Modifiers->Add(modifier);
+                Modifiers.Add(modifier);
             }
         }
     }
@@ -403,15 +423,41 @@ void RemoveTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, int
     runtime->RemoveTile(x, y, layer);
 }
 
-bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize, rcConfig& config)
+struct NavBuildTile
 {
-    rcContext context;
-    int32 layer = 0;
+    enum class States
+    {
+        Queued,
+        Building,
+        Done,
+    };
 
-    // Expand tile bounds by a certain margin
-    const float tileBorderSize = (1.0f + (float)config.borderSize) * config.cs;
-    tileBoundsNavMesh.Minimum -= tileBorderSize;
-    tileBoundsNavMesh.Maximum += tileBorderSize;
+    Scene* Scene;
+    ScriptingObjectReference<NavMesh> NavMesh;
+    NavMeshRuntime* Runtime;
+    NavBuildGeometry* Geometry;
+    BoundingBox TileBoundsNavMesh;
+    int32 X;
+    int32 Y;
+    rcConfig Config;
+    float Priority = 0.0f;
+    States State = States::Queued;
+    bool Canceled = false;
+    bool Failed = false;
+    bool IsEmpty = false;
+    Array<byte> Data;
+    Array<byte> CacheData;
+};
+
+// Builds the navmesh tile data from the shared geometry (doesn't modify the navmesh so it can run in parallel to the navigation queries)
+bool GenerateTile(NavBuildTile& tile)
+{
+    rcContext context;
+    const int32 x = tile.X;
+    const int32 y = tile.Y;
+    const int32 layer = 0;
+    rcConfig& config = tile.Config;
+    const BoundingBox& tileBoundsNavMesh = tile.TileBoundsNavMesh;
 
     *(Float3*)&config.bmin = tileBoundsNavMesh.Minimum;
     *(Float3*)&config.bmax = tileBoundsNavMesh.Maximum;
@@ -432,33 +478,30 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
     Array<Modifier> modifiers;
     {
         PROFILE_CPU_NAMED("RasterizeGeometry");
-        NavSceneRasterizer rasterizer(navMesh, tileBoundsNavMesh, worldToNavMesh, &context, &config, heightfield, &offMeshLinks, &modifiers);
+        const NavBuildGeometry& geometry = *tile.Geometry;
 
-        // Collect actors to rasterize
-        Array<Actor*> actors;
+        // Rasterize meshes overlapping the tile
+        for (const NavBuildMesh& mesh : geometry.Meshes)
         {
-            PROFILE_CPU_NAMED("CollectActors");
-            ScopeLock lock(Level::ScenesLock);
-            for (Scene* scene : Level::Scenes)
-            {
-                for (Actor* actor : scene->Navigation.Actors)
-                {
-                    BoundingBox actorBoxNavMesh;
-                    BoundingBox::Transform(actor->GetBox(), rasterizer.WorldToNavMesh, actorBoxNavMesh);
-                    if (actorBoxNavMesh.Intersects(rasterizer.TileBoundsNavMesh) &&
-                        actor->IsActiveInHierarchy() &&
-                        EnumHasAllFlags(actor->GetStaticFlags(), StaticFlags::Navigation))
-                    {
-                        actors.Add(actor);
-                    }
-                }
-            }
+            if (!mesh.BoundsNavMesh.Intersects(tileBoundsNavMesh))
+                continue;
+#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
+            for (int32 i = 0; i < mesh.Indices.Count(); i += 3)
+                DEBUG_DRAW_TRIANGLE(mesh.Vertices[mesh.Indices[i]], mesh.Vertices[mesh.Indices[i + 1]], mesh.Vertices[mesh.Indices[i + 2]], Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
+#endif
+            rcRasterizeTriangles(&context, &mesh.Vertices.Get()->X, mesh.Vertices.Count(), mesh.Indices.Get(), mesh.Areas.Get(), mesh.Areas.Count(), *heightfield);
         }
 
-        // Rasterize actors
-        for (Actor* actor : actors)
+        // Collect links and modifiers overlapping the tile
+        for (const OffMeshLink& link : geometry.OffMeshLinks)
+        {
+            if (link.Bounds.Intersects(tileBoundsNavMesh))
+                offMeshLinks.Add(link);
+        }
+        for (const Modifier& modifier : geometry.Modifiers)
         {
-            rasterizer.Rasterize(actor);
+            if (modifier.Bounds.Intersects(tileBoundsNavMesh))
+                modifiers.Add(modifier);
         }
     }
 
@@ -505,6 +548,57 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
         }
     }
 
+    // Build compressed heightfield layers for the tile cache (used to rebuild tile with dynamic obstacles at runtime)
+    if (tile.Geometry->BuildCacheLayers)
+    {
+        PROFILE_CPU_NAMED("BuildCacheLayers");
+        rcHeightfieldLayerSet* layerSet = rcAllocHeightfieldLayerSet();
+        if (!layerSet)
+        {
+            LOG(Warning, "Could not generate navmesh: Out of memory for heightfield layers.");
+            return true;
+        }
+        if (!rcBuildHeightfieldLayers(&context, *compactHeightfield, config.borderSize, config.walkableHeight, *layerSet))
+        {
+            LOG(Warning, "Could not generate navmesh: Could not build heightfield layers.");
+            rcFreeHeightfieldLayerSet(layerSet);
+            return true;
+        }
+        NavMeshTileCacheCompressor compressor;
+        for (int32 i = 0; i < layerSet->nlayers; i++)
+        {
+            const rcHeightfieldLayer& layer = layerSet->layers[i];
+            dtTileCacheLayerHeader header;
+            header.magic = DT_TILECACHE_MAGIC;
+            header.version = DT_TILECACHE_VERSION;
+            header.tx = x;
+            header.ty = y;
+            header.tlayer = i;
+            rcVcopy(header.bmin, layer.bmin);
+            rcVcopy(header.bmax, layer.bmax);
+            header.width = (unsigned char)layer.width;
+            header.height = (unsigned char)layer.height;
+            header.minx = (unsigned char)layer.minx;
+            header.maxx = (unsigned char)layer.maxx;
+            header.miny = (unsigned char)layer.miny;
+            header.maxy = (unsigned char)layer.maxy;
+            header.hmin = (unsigned short)layer.hmin;
+            header.hmax = (unsigned short)layer.hmax;
+            unsigned char* layerData = nullptr;
+            int layerDataSize = 0;
+            if (dtStatusFailed(dtBuildTileCacheLayer(&compressor, &header, layer.heights, layer.areas, layer.cons, &layerData, &layerDataSize)))
+            {
+                LOG(Warning, "Could not generate navmesh: Could not build tile cache layer.");
+                rcFreeHeightfieldLayerSet(layerSet);
+                return true;
+            }
+            tile.CacheData.Add((const byte*)&layerDataSize, sizeof(int32));
+            tile.CacheData.Add(layerData, layerDataSize);
+            dtFree(layerData);
+        }
+        rcFreeHeightfieldLayerSet(layerSet);
+    }
+
     {
         PROFILE_CPU_NAMED("BuildDistanceField");
         if (!rcBuildDistanceField(&context, *compactHeightfield))
@@ -575,7 +669,9 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
     if (polyMesh->nverts == 0)
     {
         // Empty tile
-        RemoveTile(navMesh, runtime, x, y, layer);
+        rcFreePolyMesh(polyMesh);
+        rcFreePolyMeshDetail(detailMesh);
+        tile.IsEmpty = true;
         return false;
     }
 
@@ -651,7 +747,10 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
     int navDataSize = 0;
     {
         PROFILE_CPU_NAMED("CreateNavMeshData");
-        if (!dtCreateNavMeshData(&params, &navData, &navDataSize))
+        const bool failed = !dtCreateNavMeshData(&params, &navData, &navDataSize);
+        rcFreePolyMesh(polyMesh);
+        rcFreePolyMeshDetail(detailMesh);
+        if (failed)
         {
             LOG(Warning, "Could not build Detour navmesh.");
             return true;
@@ -659,6 +758,25 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
     }
     ASSERT_LOW_LAYER(navDataSize > 4 && *(uint32*)navData == DT_NAVMESH_MAGIC); // Sanity check for Detour header
 
+    tile.Data.Set(navData, navDataSize);
+    dtFree(navData);
+
+    return false;
+}
+
+// Swaps the built tile data into the navmesh (called on the main thread, in between the navigation queries processing)
+void SwapTile(NavBuildTile& buildTile, NavMesh* navMesh)
+{
+    NavMeshRuntime* runtime = buildTile.Runtime;
+    const int32 x = buildTile.X;
+    const int32 y = buildTile.Y;
+    const int32 layer = 0;
+    if (buildTile.IsEmpty)
+    {
+        RemoveTile(navMesh, runtime, x, y, layer);
+        return;
+    }
+
     {
         PROFILE_CPU_NAMED("CreateTiles");
 
@@ -685,15 +803,15 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
         }
 
         // Copy data to the tile
-        tile->Data.Copy(navData, navDataSize);
+        tile->Data.Copy(buildTile.Data.Get(), buildTile.Data.Count());
+        if (buildTile.CacheData.HasItems())
+            tile->CacheData.Copy(buildTile.CacheData.Get(), buildTile.CacheData.Count());
+        else
+            tile->CacheData.Release();
 
         // Add tile to navmesh
         runtime->AddTile(navMesh, *tile);
     }
-
-    dtFree(navData);
-
-    return false;
 }
 
 float GetTileSize()
@@ -738,45 +856,178 @@ Array<BuildRequest> NavBuildQueue;
 
 CriticalSection NavBuildTasksLocker;
 int32 NavBuildTasksMaxCount = 0;
-Array<class NavMeshTileBuildTask*> NavBuildTasks;
+int32 NavBuildJobsActive = 0;
+int32 NavBuildGatherJobsPending = 0;
+int32 NavBuildTileJobsPending = 0;
+int64 NavBuildJobsLabel = 0;
+Array<NavBuildTile*> NavBuildTasks;
+Array<NavBuildTile*> NavBuildTilesActive;
+Array<NavBuildGeometry*> NavBuildGeometryQueue;
+Array<Vector3> NavBuildPriorityLocations;
+
+void ReleaseGeometry(NavBuildGeometry* geometry)
+{
+    if (--geometry->RefCount == 0)
+        Delete(geometry);
+}
 
-class NavMeshTileBuildTask : public ThreadPoolTask
+void DeleteTile(NavBuildTile* tile)
 {
-public:
-    Scene* Scene;
-    ScriptingObjectReference<NavMesh> NavMesh;
-    NavMeshRuntime* Runtime;
-    BoundingBox TileBoundsNavMesh;
-    Matrix WorldToNavMesh;
-    int32 X;
-    int32 Y;
-    float TileSize;
-    rcConfig Config;
+    ReleaseGeometry(tile->Geometry);
+    Delete(tile);
+}
 
-public:
-    // [ThreadPoolTask]
-    bool Run() override
+bool IsTileBuilding(const NavBuildTile* tile)
+{
+    for (const NavBuildTile* e : NavBuildTilesActive)
+    {
+        if (e->X == tile->X && e->Y == tile->Y && e->Runtime == tile->Runtime)
+            return true;
+    }
+    return false;
+}
+
+void GatherGeometryJob(int32 index)
+{
+    NavBuildTasksLocker.Lock();
+    NavBuildGatherJobsPending--;
+    NavBuildGeometry* geometry = nullptr;
+    if (NavBuildGeometryQueue.HasItems())
+    {
+        geometry = NavBuildGeometryQueue[0];
+        NavBuildGeometryQueue.RemoveAtKeepOrder(0);
+    }
+    NavBuildTasksLocker.Unlock();
+
+    if (geometry)
+        geometry->Gather();
+
+    NavBuildTasksLocker.Lock();
+    if (geometry)
+    {
+        geometry->Ready = true;
+        ReleaseGeometry(geometry);
+    }
+    NavBuildJobsActive--;
+    NavBuildTasksLocker.Unlock();
+}
+
+void BuildTileJob(int32 index)
+{
+    PROFILE_CPU_NAMED("BuildNavMeshTile");
+
+    // Pick the most important tile to build (skip tiles that are during building by other job)
+    NavBuildTasksLocker.Lock();
+    NavBuildTileJobsPending--;
+    NavBuildTile* tile = nullptr;
+    for (NavBuildTile* e : NavBuildTasks)
     {
-        PROFILE_CPU_NAMED("BuildNavMeshTile");
-        const auto navMesh = NavMesh.Get();
-        if (!navMesh)
-            return false;
-        if (GenerateTile(NavMesh, Runtime, X, Y, TileBoundsNavMesh, WorldToNavMesh, TileSize, Config))
+        if (e->State == NavBuildTile::States::Queued && e->Geometry->Ready && (!tile || e->Priority < tile->Priority) && !IsTileBuilding(e))
+            tile = e;
+    }
+    if (tile)
+    {
+        tile->State = NavBuildTile::States::Building;
+        NavBuildTilesActive.Add(tile);
+    }
+    NavBuildTasksLocker.Unlock();
+
+    if (tile && GenerateTile(*tile))
+    {
+        LOG(Warning, "Failed to generate navmesh tile at {0}x{1}.", tile->X, tile->Y);
+        tile->Failed = true;
+    }
+
+    NavBuildTasksLocker.Lock();
+    if (tile)
+    {
+        tile->State = NavBuildTile::States::Done;
+        NavBuildTilesActive.Remove(tile);
+    }
+    NavBuildJobsActive--;
+    NavBuildTasksLocker.Unlock();
+}
+
+void UpdateTasks()
+{
+    ScopeLock lock(NavBuildTasksLocker);
+    if (NavBuildTasks.IsEmpty() && NavBuildGeometryQueue.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("UpdateTasks");
+
+    // Skip gathering geometry not used by any tile (eg. tiles got canceled or reused by a newer request)
+    for (int32 i = NavBuildGatherJobsPending; i < NavBuildGeometryQueue.Count(); i++)
+    {
+        NavBuildGeometry* geometry = NavBuildGeometryQueue[i];
+        if (geometry->RefCount == 1)
         {
-            LOG(Warning, "Failed to generate navmesh tile at {0}x{1}.", X, Y);
+            NavBuildGeometryQueue.RemoveAtKeepOrder(i--);
+            ReleaseGeometry(geometry);
         }
-        return false;
     }
 
-    void OnEnd() override
+    // Swap in the built tiles (on the main thread, navigation queries don't wait for the tiles building)
+    for (int32 i = 0; i < NavBuildTasks.Count(); i++)
     {
-        // Remove from tasks list
-        ScopeLock lock(NavBuildTasksLocker);
-        NavBuildTasks.Remove(this);
-        if (NavBuildTasks.IsEmpty())
-            NavBuildTasksMaxCount = 0;
+        NavBuildTile* tile = NavBuildTasks[i];
+        if (tile->State != NavBuildTile::States::Done)
+            continue;
+        NavMesh* navMesh = tile->NavMesh.Get();
+        if (navMesh && !tile->Canceled && !tile->Failed)
+            SwapTile(*tile, navMesh);
+        NavBuildTasks.RemoveAtKeepOrder(i--);
+        DeleteTile(tile);
+    }
+    if (NavBuildTasks.IsEmpty())
+    {
+        NavBuildTasksMaxCount = 0;
+        return;
+    }
+
+    // Prioritize tiles closer to the players (or the main camera by default)
+    const Array<Vector3>* locations = &NavBuildPriorityLocations;
+    Array<Vector3> cameraLocation;
+    if (locations->IsEmpty())
+    {
+        if (const Camera* camera = Camera::GetMainCamera())
+            cameraLocation.Add(camera->GetPosition());
+        locations = &cameraLocation;
+    }
+    int32 queuedCount = 0;
+    for (NavBuildTile* tile : NavBuildTasks)
+    {
+        if (tile->State != NavBuildTile::States::Queued || !tile->Geometry->Ready)
+            continue;
+        queuedCount++;
+        if (locations->IsEmpty())
+            continue;
+        Vector3 tileCenter = tile->TileBoundsNavMesh.GetCenter();
+        Vector3::Transform(tileCenter, tile->Runtime->Properties.Rotation.Conjugated(), tileCenter);
+        float priority = MAX_float;
+        for (const Vector3& location : *locations)
+            priority = Math::Min(priority, (float)Vector3::DistanceSquared(tileCenter, location));
+        tile->Priority = priority;
     }
-};
+
+    // Kick the jobs within the budget of the Job System threads
+    int32 maxJobs = NavigationSettings::Get()->MaxTileBuildJobs;
+    if (maxJobs <= 0)
+        maxJobs = Math::Max(JobSystem::GetThreadsCount() / 2, 1);
+    const int32 gatherJobs = Math::Min(NavBuildGeometryQueue.Count() - NavBuildGatherJobsPending, maxJobs - NavBuildJobsActive);
+    if (gatherJobs > 0)
+    {
+        NavBuildJobsActive += gatherJobs;
+        NavBuildGatherJobsPending += gatherJobs;
+        NavBuildJobsLabel = JobSystem::Dispatch(GatherGeometryJob, gatherJobs, JobPriority::Background);
+    }
+    const int32 buildJobs = Math::Min(queuedCount - NavBuildTileJobsPending, maxJobs - NavBuildJobsActive);
+    if (buildJobs > 0)
+    {
+        NavBuildJobsActive += buildJobs;
+        NavBuildTileJobsPending += buildJobs;
+        NavBuildJobsLabel = JobSystem::Dispatch(BuildTileJob, buildJobs, JobPriority::Background);
+    }
+}
 
 void OnSceneUnloading(Scene* scene, const Guid& sceneId)
 {
@@ -792,22 +1043,21 @@ void OnSceneUnloading(Scene* scene, const Guid& sceneId)
     }
     NavBuildQueueLocker.Unlock();
 
-    // Cancel active build tasks
+    // Cancel build tasks (tiles during building are discarded once done)
     NavBuildTasksLocker.Lock();
     for (int32 i = 0; i < NavBuildTasks.Count(); i++)
     {
-        auto task = NavBuildTasks[i];
-        if (task->Scene == scene)
+        NavBuildTile* tile = NavBuildTasks[i];
+        if (tile->Scene != scene)
+            continue;
+        if (tile->State == NavBuildTile::States::Queued)
         {
-            NavBuildTasksLocker.Unlock();
-
-            // Cancel task but without locking queue from this thread to prevent deadlocks
-            task->Cancel();
-
-            NavBuildTasksLocker.Lock();
-            i--;
-            if (NavBuildTasks.IsEmpty())
-                break;
+            NavBuildTasks.RemoveAtKeepOrder(i--);
+            DeleteTile(tile);
+        }
+        else
+        {
+            tile->Canceled = true;
         }
     }
     NavBuildTasksLocker.Unlock();
@@ -818,6 +1068,20 @@ void NavMeshBuilder::Init()
     Level::SceneUnloading.Bind<OnSceneUnloading>();
 }
 
+void NavMeshBuilder::Dispose()
+{
+    // Wait for the active jobs and discard the results
+    JobSystem::Wait(NavBuildJobsLabel);
+    ScopeLock lock(NavBuildTasksLocker);
+    for (NavBuildTile* tile : NavBuildTasks)
+        DeleteTile(tile);
+    NavBuildTasks.Clear();
+    NavBuildTasksMaxCount = 0;
+    for (NavBuildGeometry* geometry : NavBuildGeometryQueue)
+        ReleaseGeometry(geometry);
+    NavBuildGeometryQueue.Clear();
+}
+
 bool NavMeshBuilder::IsBuildingNavMesh()
 {
     NavBuildTasksLocker.Lock();
@@ -840,40 +1104,42 @@ float NavMeshBuilder::GetNavMeshBuildingProgress()
     return result;
 }
 
-void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConfig& config, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize)
+void NavMeshBuilder::SetPriorityLocations(const Array<Vector3>& locations)
+{
+    ScopeLock lock(NavBuildTasksLocker);
+    NavBuildPriorityLocations = locations;
+}
+
+void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConfig& config, const BoundingBox& tileBoundsNavMesh, NavBuildGeometry* geometry)
 {
     NavMeshRuntime* runtime = navMesh->GetRuntime();
-    NavBuildTasksLocker.Lock();
+    geometry->RefCount++;
 
-    // Skip if this tile is already during cooking
-    for (int32 i = 0; i < NavBuildTasks.Count(); i++)
+    // Reuse tile that is waiting for the build (with the latest geometry)
+    for (NavBuildTile* tile : NavBuildTasks)
     {
-        const auto task = NavBuildTasks[i];
-        if (task->X == x && task->Y == y && task->Runtime == runtime)
+        if (tile->X == x && tile->Y == y && tile->Runtime == runtime && tile->State == NavBuildTile::States::Queued)
         {
-            NavBuildTasksLocker.Unlock();
+            ReleaseGeometry(tile->Geometry);
+            tile->Geometry = geometry;
+            tile->TileBoundsNavMesh = tileBoundsNavMesh;
+            tile->Config = config;
             return;
         }
     }
 
     // Create task
-    auto task = New<NavMeshTileBuildTask>();
-    task->Scene = navMesh->GetScene();
-    task->NavMesh = navMesh;
-    task->Runtime = runtime;
-    task->X = x;
-    task->Y = y;
-    task->TileBoundsNavMesh = tileBoundsNavMesh;
-    task->WorldToNavMesh = worldToNavMesh;
-    task->TileSize = tileSize;
-    task->Config = config;
-    NavBuildTasks.Add(task);
+    auto tile = New<NavBuildTile>();
+    tile->Scene = navMesh->GetScene();
+    tile->NavMesh = navMesh;
+    tile->Runtime = runtime;
+    tile->Geometry = geometry;
+    tile->X = x;
+    tile->Y = y;
+    tile->TileBoundsNavMesh = tileBoundsNavMesh;
+    tile->Config = config;
+    NavBuildTasks.Add(tile);
     NavBuildTasksMaxCount++;
-
-    NavBuildTasksLocker.Unlock();
-
-    // Invoke job
-    task->Start();
 }
 
 void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBounds, bool rebuild)
@@ -930,6 +1196,15 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
     {
         PROFILE_CPU_NAMED("StartBuildingTiles");
 
+        // Collect tiles to build (expanded by a certain margin)
+        struct TileToBuild
+        {
+            int32 X, Y;
+            BoundingBox BoundsNavMesh;
+        };
+        Array<TileToBuild> tiles;
+        BoundingBox geometryBoundsNavMesh;
+        const float tileBorderSize = (1.0f + (float)config.borderSize) * config.cs;
         for (int32 y = tilesMin.Z; y < tilesMax.Z; y++)
         {
             for (int32 x = tilesMin.X; x < tilesMax.X; x++)
@@ -937,7 +1212,13 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
                 BoundingBox tileBoundsNavMesh;
                 if (GetNavMeshTileBounds(scene, navMesh, x, y, tileSize, tileBoundsNavMesh, worldToNavMesh))
                 {
-                    BuildTileAsync(navMesh, x, y, config, tileBoundsNavMesh, worldToNavMesh, tileSize);
+                    tileBoundsNavMesh.Minimum -= tileBorderSize;
+                    tileBoundsNavMesh.Maximum += tileBorderSize;
+                    if (tiles.IsEmpty())
+                        geometryBoundsNavMesh = tileBoundsNavMesh;
+                    else
+                        BoundingBox::Merge(geometryBoundsNavMesh, tileBoundsNavMesh, geometryBoundsNavMesh);
+                    tiles.Add({ x, y, tileBoundsNavMesh });
                 }
                 else
                 {
@@ -945,6 +1226,27 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
                 }
             }
         }
+        if (tiles.IsEmpty())
+            return;
+
+        // Gather the geometry once for the whole dirty region and share it between the tiles
+        auto geometry = New<NavBuildGeometry>();
+        geometry->Properties = navMesh->Properties;
+        geometry->BoundsNavMesh = geometryBoundsNavMesh;
+        geometry->WorldToNavMesh = worldToNavMesh;
+        geometry->IsWorldToNavMeshIdentity = worldToNavMesh.IsIdentity();
+        geometry->WalkableThreshold = Math::Cos(config.walkableSlopeAngle * DegreesToRadians);
+        geometry->BuildCacheLayers = NavigationSettings::Get()->EnableDynamicObstacles;
+        if (geometry->BuildCacheLayers && config.width > NAV_MESH_TILE_CACHE_MAX_LAYER_SIZE)
+        {
+            LOG(Warning, "Cannot use dynamic obstacles with navmesh {0}. Tile size with border ({1}) exceeds the tile cache limit ({2}).", navMesh->Properties.Name, config.width, NAV_MESH_TILE_CACHE_MAX_LAYER_SIZE);
+            geometry->BuildCacheLayers = false;
+        }
+        geometry->RefCount = 1;
+        ScopeLock lock(NavBuildTasksLocker);
+        NavBuildGeometryQueue.Add(geometry);
+        for (const TileToBuild& tile : tiles)
+            BuildTileAsync(navMesh, tile.X, tile.Y, config, tile.BoundsNavMesh, geometry);
     }
 }
 
@@ -1057,6 +1359,7 @@ void ClearNavigation(Scene* scene)
 
 void NavMeshBuilder::Update()
 {
+    PROFILE_MEM(Navigation);
     ScopeLock lock(NavBuildQueueLocker);
 
     // Process nav mesh building requests and kick the tasks
@@ -1089,6 +1392,9 @@ void NavMeshBuilder::Update()
             }
         }
     }
+
+    // Swap in the built tiles and kick the next ones
+    UpdateTasks();
 }
 
 void NavMeshBuilder::Build(Scene* scene, float timeoutMs)
@@ -5,6 +5,8 @@
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
 
 class Scene;
 
@@ -15,9 +17,11 @@ class FLAXENGINE_API NavMeshBuilder
 {
 public:
     static void Init();
+    static void Dispose();
     static bool IsBuildingNavMesh();
     static float GetNavMeshBuildingProgress();
     static void Update();
+    static void SetPriorityLocations(const Array<Vector3, HeapAllocation>& locations);
     static void Build(Scene* scene, float timeoutMs);
     static void Build(Scene* scene, const BoundingBox& dirtyBounds, float timeoutMs);
 };
@@ -9,7 +9,7 @@ void NavMeshData::Save(WriteStream& stream)
 {
     // Write header
     NavMeshDataHeader header;
-    header.Version = 1;
+    header.Version = 2;
     header.TileSize = TileSize;
     header.TilesCount = Tiles.Count();
     stream.Write(header);
@@ -36,6 +36,12 @@ void NavMeshData::Save(WriteStream& stream)
         {
             LOG(Warning, "Empty navmesh tile data.");
         }
+
+        // Write tile cache data
+        const int32 cacheDataSize = tile.CacheData.Length();
+        stream.Write(cacheDataSize);
+        if (cacheDataSize)
+            stream.WriteBytes(tile.CacheData.Get(), cacheDataSize);
     }
 }
 
@@ -50,7 +56,7 @@ bool NavMeshData::Load(BytesContainer& data, bool copyData)
 
     // Read header
     const auto header = stream.Move<NavMeshDataHeader>();
-    if (header->Version != 1)
+    if (header->Version != 1 && header->Version != 2)
     {
         LOG(Warning, "Invalid valid navmesh data version {0}.", header->Version);
         return true;
@@ -85,6 +91,27 @@ bool NavMeshData::Load(BytesContainer& data, bool copyData)
             tile.Data.Copy(tileData, tileHeader->DataSize);
         else
             tile.Data.Link(tileData, tileHeader->DataSize);
+
+        // Read tile cache data
+        tile.CacheData.Release();
+        if (header->Version >= 2)
+        {
+            int32 cacheDataSize;
+            stream.ReadInt32(&cacheDataSize);
+            if (cacheDataSize < 0 || cacheDataSize > (int32)stream.GetLength() - (int32)stream.GetPosition())
+            {
+                LOG(Warning, "Invalid navmesh tile data.");
+                return true;
+            }
+            if (cacheDataSize)
+            {
+                const auto cacheData = stream.Move<byte>(cacheDataSize);
+                if (copyData)
+                    tile.CacheData.Copy(cacheData, cacheDataSize);
+                else
+                    tile.CacheData.Link(cacheData, cacheDataSize);
+            }
+        }
     }
 
     return false;
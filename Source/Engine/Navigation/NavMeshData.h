@@ -21,6 +21,9 @@ struct NavMeshTileData
     int32 PosY;
     int32 Layer;
     BytesContainer Data;
+
+    // The compressed heightfield layers of the tile used by the tile cache for dynamic obstacles (optional). Stored as a sequence of the layer size (int32) and the layer data.
+    BytesContainer CacheData;
 };
 
 struct NavMeshDataHeader
@@ -3,26 +3,319 @@
 #include "NavMeshRuntime.h"
 #include "NavigationSettings.h"
 #include "NavMesh.h"
+#include "NavMeshTileCache.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Random.h"
+#include "Engine/Core/Math/Vector2.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Utilities/Crc.h"
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshQuery.h>
+#include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
+#include <ThirdParty/recastnavigation/DetourTileCache.h>
 #include <ThirdParty/recastnavigation/RecastAlloc.h>
 
 #define MAX_NODES 2048
+#define FLOW_FIELD_MAX_NODES 16384
 #define USE_DATA_LINK 0
 #define USE_NAV_MESH_ALLOC 1
 // TODO: try not using USE_NAV_MESH_ALLOC
 
+struct NavMeshPathQuery
+{
+    uint32 ID;
+    NavMeshPathQueryState State = NavMeshPathQueryState::Pending;
+    bool Canceled = false;
+    Vector3 StartPosition;
+    Vector3 EndPosition;
+    NavMeshRuntime::PathQueryCallback Callback;
+    Array<Vector3, HeapAllocation> Path;
+    NavMeshPathFlags Flags = NavMeshPathFlags::None;
+};
+
+struct NavMeshPathCacheKey
+{
+    dtPolyRef StartPoly;
+    dtPolyRef EndPoly;
+    uint32 FilterHash;
+
+    bool operator==(const NavMeshPathCacheKey& other) const
+    {
+        return StartPoly == other.StartPoly && EndPoly == other.EndPoly && FilterHash == other.FilterHash;
+    }
+};
+
+inline uint32 GetHash(const NavMeshPathCacheKey& key)
+{
+    uint32 hash = GetHash(key.StartPoly);
+    CombineHash(hash, GetHash(key.EndPoly));
+    CombineHash(hash, key.FilterHash);
+    return hash;
+}
+
+struct NavMeshPathCacheEntry
+{
+    Array<dtPolyRef> Path;
+    uint32 TilesVersion;
+    uint64 LastUsed;
+};
+
+// Cache of the path corridors between the start and end polygons (used by the path query workers in parallel)
+struct NavMeshPathCache
+{
+    CriticalSection Locker;
+    Dictionary<NavMeshPathCacheKey, NavMeshPathCacheEntry> Entries;
+    uint64 UseCounter = 0;
+
+    bool TryGet(const dtNavMesh* navMesh, uint32 tilesVersion, const NavMeshPathCacheKey& key, dtPolyRef* path, int32& pathSize)
+    {
+        ScopeLock lock(Locker);
+        NavMeshPathCacheEntry* entry = Entries.TryGet(key);
+        if (!entry)
+            return false;
+        if (entry->TilesVersion != tilesVersion)
+        {
+            // Validate the corridor after navmesh tiles modification (rebuilt or removed tiles invalidate polygon references)
+            for (const dtPolyRef poly : entry->Path)
+            {
+                if (!navMesh->isValidPolyRef(poly))
+                {
+                    Entries.Remove(key);
+                    return false;
+                }
+            }
+            entry->TilesVersion = tilesVersion;
+        }
+        entry->LastUsed = ++UseCounter;
+        pathSize = entry->Path.Count();
+        Platform::MemoryCopy(path, entry->Path.Get(), pathSize * sizeof(dtPolyRef));
+        return true;
+    }
+
+    void Add(uint32 tilesVersion, const NavMeshPathCacheKey& key, const dtPolyRef* path, int32 pathSize, int32 capacity)
+    {
+        ScopeLock lock(Locker);
+        if (!Entries.ContainsKey(key))
+        {
+            // Evict the least recently used entries
+            while (Entries.Count() >= capacity)
+            {
+                auto oldest = Entries.Begin();
+                for (auto it = Entries.Begin(); it.IsNotEnd(); ++it)
+                {
+                    if (it->Value.LastUsed < oldest->Value.LastUsed)
+                        oldest = it;
+                }
+                Entries.Remove(oldest);
+            }
+        }
+        NavMeshPathCacheEntry& entry = Entries[key];
+        entry.Path.Set(path, pathSize);
+        entry.TilesVersion = tilesVersion;
+        entry.LastUsed = ++UseCounter;
+    }
+
+    void Clear()
+    {
+        ScopeLock lock(Locker);
+        Entries.Clear();
+    }
+};
+
+struct NavMeshFlowField
+{
+    Vector3 GoalPosition;
+    Float3 GoalPositionNavMesh;
+    float MaxDistance;
+    dtPolyRef GoalPoly = 0;
+    uint32 TilesVersion = 0;
+    bool Built = false;
+    // Maps the polygon to the next polygon on the way to the goal
+    Dictionary<dtPolyRef, dtPolyRef> Parents;
+};
+
+struct NavMeshPathWorker
+{
+    // Sliced path finding keeps the search state inside the query object so each worker uses own query (reused for the in-progress path over the next frames)
+    dtNavMeshQuery* Query;
+    const dtNavMesh* NavMesh = nullptr;
+    dtQueryFilter Filter;
+    NavMeshPathQuery* Current = nullptr;
+    bool Started = false;
+    uint32 TilesVersion = 0;
+    dtPolyRef StartPoly = 0;
+    NavMeshPathCacheKey CacheKey;
+    Float3 StartPositionNavMesh;
+    Float3 EndPositionNavMesh;
+};
+
+struct NavMeshTileCacheLink
+{
+    Float3 Start;
+    Float3 End;
+    float Radius;
+    unsigned short Flags;
+    unsigned char Area;
+    unsigned char Direction;
+    unsigned int UserId;
+};
+
+// Restores the polygon flags and the off-mesh links of the tiles built from the tile cache layers (layers don't contain navlinks)
+struct NavMeshTileCacheProcess : dtTileCacheMeshProcess
+{
+    NavMeshTileCache* Cache;
+    Array<Float3> OffMeshStartEnd;
+    Array<float> OffMeshRadius;
+    Array<unsigned char> OffMeshDir;
+    Array<unsigned char> OffMeshArea;
+    Array<unsigned short> OffMeshFlags;
+    Array<unsigned int> OffMeshId;
+
+    void process(dtNavMeshCreateParams* params, unsigned char* polyAreas, unsigned short* polyFlags) override;
+};
+
+struct NavMeshTileCache
+{
+    dtTileCache* TileCache = nullptr;
+    dtTileCacheAlloc Alloc;
+    NavMeshTileCacheCompressor Compressor;
+    NavMeshTileCacheProcess Process;
+    float WalkableClimb;
+    Dictionary<uint64, Array<NavMeshTileCacheLink>> Links;
+    Dictionary<uint32, dtObstacleRef> Obstacles;
+    Array<uint32> DirtyObstacles;
+};
+
 namespace
 {
+    int64 NextPathQueryId = 0;
+    uint32 NextFlowFieldId = 1;
+
+    FORCE_INLINE uint64 GetTileKey(int32 x, int32 y)
+    {
+        return ((uint64)(uint32)x << 32) | (uint64)(uint32)y;
+    }
+
+    bool AddObstacle(dtTileCache* tileCache, const NavMeshProperties& properties, const NavMeshObstacle& obstacle, dtObstacleRef& result)
+    {
+        // Transform obstacle into the navmesh space and expand it by the agent radius (tile cache layers are built from the eroded heightfield)
+        const float agentRadius = properties.Agent.Radius;
+        const Float3 position = Vector3::Transform(obstacle.Position, properties.Rotation);
+        dtStatus status;
+        if (obstacle.Shape == NavMeshObstacleShape::Box)
+        {
+            const Float3 halfExtents(obstacle.Extents.X + agentRadius, obstacle.Extents.Y, obstacle.Extents.Z + agentRadius);
+            const float yaw = (properties.Rotation * obstacle.Orientation).GetEuler().Y * DegreesToRadians;
+            status = tileCache->addBoxObstacle(&position.X, &halfExtents.X, yaw, &result);
+        }
+        else
+        {
+            status = tileCache->addObstacle(&position.X, obstacle.Radius + agentRadius, obstacle.Height, &result);
+        }
+        if (dtStatusFailed(status))
+        {
+            LOG(Warning, "Failed to add obstacle to navmesh {0} (error: {1})", properties.Name, status & ~DT_FAILURE);
+            return false;
+        }
+        return true;
+    }
+
     FORCE_INLINE void InitFilter(dtQueryFilter& filter)
     {
         Platform::MemoryCopy(filter.m_areaCost, NavMeshRuntime::NavAreasCosts, sizeof(NavMeshRuntime::NavAreasCosts));
         static_assert(sizeof(dtQueryFilter::m_areaCost) == sizeof(NavMeshRuntime::NavAreasCosts), "Invalid navmesh area cost list.");
     }
+
+    FORCE_INLINE uint32 GetFilterHash(const dtQueryFilter& filter)
+    {
+        return Crc::MemCrc32(filter.m_areaCost, sizeof(filter.m_areaCost));
+    }
+
+    bool GetPathPoints(const dtNavMeshQuery* query, dtStatus findPathStatus, const dtPolyRef* path, int32 pathSize, dtPolyRef startPoly, const Vector3& startPosition, const Float3& startPositionNavMesh, Float3 endPositionNavMesh, const Quaternion& rotation, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags)
+    {
+        Quaternion invRotation;
+        Quaternion::Invert(rotation, invRotation);
+
+        if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
+        {
+            resultFlags |= NavMeshPathFlags::PartialPath;
+            // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
+            resultPath.Resize(2);
+            resultPath[0] = startPosition;
+            query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
+            resultPath[1] = endPositionNavMesh;
+            Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
+        }
+        else
+        {
+            int pathPointsCount = 0;
+            Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
+            const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
+            if (dtStatusFailed(findStraightPathStatus))
+            {
+                return false;
+            }
+            resultPath.Resize(pathPointsCount);
+            for (int32 i = 0; i < pathPointsCount; i++)
+            {
+                Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
+            }
+        }
+
+        return true;
+    }
+}
+
+void NavMeshTileCacheProcess::process(dtNavMeshCreateParams* params, unsigned char* polyAreas, unsigned short* polyFlags)
+{
+    for (int32 i = 0; i < params->polyCount; i++)
+        polyFlags[i] = polyAreas[i] != DT_TILECACHE_NULL_AREA ? 1 : 0;
+
+    // Restore the off-mesh links starting within this tile layer
+    const Array<NavMeshTileCacheLink>* links = Cache->Links.TryGet(GetTileKey(params->tileX, params->tileY));
+    if (!links)
+        return;
+    const int32 maxLayers = 32;
+    dtCompressedTileRef layers[maxLayers];
+    const int32 layersCount = Cache->TileCache->getTilesAt(params->tileX, params->tileY, layers, maxLayers);
+    OffMeshStartEnd.Clear();
+    OffMeshRadius.Clear();
+    OffMeshDir.Clear();
+    OffMeshArea.Clear();
+    OffMeshFlags.Clear();
+    OffMeshId.Clear();
+    for (const NavMeshTileCacheLink& link : *links)
+    {
+        // Pick the lowest layer that contains the link start point
+        int32 linkLayer = -1;
+        for (int32 i = 0; i < layersCount; i++)
+        {
+            const dtTileCacheLayerHeader* header = Cache->TileCache->getTileByRef(layers[i])->header;
+            if (link.Start.Y >= header->bmin[1] - Cache->WalkableClimb && link.Start.Y <= header->bmax[1] + Cache->WalkableClimb && (linkLayer == -1 || header->tlayer < linkLayer))
+                linkLayer = header->tlayer;
+        }
+        if (linkLayer != params->tileLayer)
+            continue;
+        OffMeshStartEnd.Add(link.Start);
+        OffMeshStartEnd.Add(link.End);
+        OffMeshRadius.Add(link.Radius);
+        OffMeshDir.Add(link.Direction);
+        OffMeshArea.Add(link.Area);
+        OffMeshFlags.Add(link.Flags);
+        OffMeshId.Add(link.UserId);
+    }
+    if (OffMeshId.HasItems())
+    {
+        params->offMeshConCount = OffMeshId.Count();
+        params->offMeshConVerts = (const float*)OffMeshStartEnd.Get();
+        params->offMeshConRad = OffMeshRadius.Get();
+        params->offMeshConDir = OffMeshDir.Get();
+        params->offMeshConAreas = OffMeshArea.Get();
+        params->offMeshConFlags = OffMeshFlags.Get();
+        params->offMeshConUserID = OffMeshId.Get();
+    }
 }
 
 NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
@@ -32,12 +325,24 @@ NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
     _navMesh = nullptr;
     _navMeshQuery = dtAllocNavMeshQuery();
     _tileSize = 0;
+    _pathCache = New<NavMeshPathCache>();
 }
 
 NavMeshRuntime::~NavMeshRuntime()
 {
     Dispose();
     dtFreeNavMeshQuery(_navMeshQuery);
+    for (NavMeshPathWorker* worker : _pathWorkers)
+    {
+        if (worker->Current && worker->Current->Canceled)
+            Delete(worker->Current);
+        dtFreeNavMeshQuery(worker->Query);
+        Delete(worker);
+    }
+    _pathQueries.ClearDelete();
+    _flowFields.ClearDelete();
+    dtFreeNavMeshQuery(_flowFieldQuery);
+    Delete(_pathCache);
 }
 
 int32 NavMeshRuntime::GetTilesCapacity() const
@@ -101,42 +406,206 @@ bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPo
 
     dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
     int32 pathSize;
-    const auto findPathStatus = query->findPath(startPoly, endPoly, &startPositionNavMesh.X, &endPositionNavMesh.X, &filter, path, &pathSize, NAV_MESH_PATH_MAX_SIZE);
-    if (dtStatusFailed(findPathStatus))
+    dtStatus findPathStatus = DT_SUCCESS;
+    const NavMeshPathCacheKey cacheKey = { startPoly, endPoly, GetFilterHash(filter) };
+    if (PathCacheSize <= 0 || !_pathCache->TryGet(_navMesh, _tilesVersion, cacheKey, path, pathSize))
     {
-        return false;
+        findPathStatus = query->findPath(startPoly, endPoly, &startPositionNavMesh.X, &endPositionNavMesh.X, &filter, path, &pathSize, NAV_MESH_PATH_MAX_SIZE);
+        if (dtStatusFailed(findPathStatus))
+        {
+            return false;
+        }
+        if (PathCacheSize > 0 && !dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
+            _pathCache->Add(_tilesVersion, cacheKey, path, pathSize, PathCacheSize);
     }
 
-    Quaternion invRotation;
-    Quaternion::Invert(Properties.Rotation, invRotation);
+    return GetPathPoints(query, findPathStatus, path, pathSize, startPoly, startPosition, startPositionNavMesh, endPositionNavMesh, Properties.Rotation, resultPath, resultFlags);
+}
 
-    if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
+bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPosition, Vector3* resultPath, int32 resultPathCapacity, int32& resultPathLength) const
+{
+    Array<Vector3, HeapAllocation> path;
+    NavMeshPathFlags flags;
+    const bool result = FindPath(startPosition, endPosition, path, flags);
+    resultPathLength = Math::Min(path.Count(), Math::Max(resultPathCapacity, 0));
+    Platform::MemoryCopy(resultPath, path.Get(), resultPathLength * sizeof(Vector3));
+    return result;
+}
+
+uint32 NavMeshRuntime::CreateFlowField(const Vector3& goalPosition, float maxDistance)
+{
+    ScopeLock lock(Locker);
+    auto field = New<NavMeshFlowField>();
+    field->GoalPosition = goalPosition;
+    field->MaxDistance = maxDistance;
+    if (_navMesh && BuildFlowField(field))
     {
-        resultFlags |= NavMeshPathFlags::PartialPath;
-        // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
-        resultPath.Resize(2);
-        resultPath[0] = startPosition;
-        query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
-        resultPath[1] = endPositionNavMesh;
-        Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
+        Delete(field);
+        return 0;
     }
-    else
+    const uint32 id = NextFlowFieldId++;
+    _flowFields.Add(id, field);
+    return id;
+}
+
+bool NavMeshRuntime::FindFlowFieldPath(uint32 flowFieldId, const Vector3& startPosition, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags)
+{
+    resultPath.Clear();
+    resultFlags = NavMeshPathFlags::None;
+    ScopeLock lock(Locker);
+    NavMeshFlowField* field;
+    const auto query = GetNavMeshQuery();
+    if (!_flowFields.TryGet(flowFieldId, field) || !query || !_navMesh)
+        return false;
+    if ((!field->Built || field->TilesVersion != _tilesVersion) && BuildFlowField(field))
+        return false;
+
+    dtQueryFilter filter;
+    InitFilter(filter);
+    Float3 extent = Properties.DefaultQueryExtent;
+
+    Float3 startPositionNavMesh;
+    Float3::Transform(startPosition, Properties.Rotation, startPositionNavMesh);
+
+    dtPolyRef startPoly = 0;
+    if (!dtStatusSucceed(query->findNearestPoly(&startPositionNavMesh.X, &extent.X, &filter, &startPoly, nullptr)))
+        return false;
+
+    // Follow the field from the start polygon to the goal
+    dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
+    int32 pathSize = 0;
+    dtPolyRef poly = startPoly;
+    while (true)
     {
-        int pathPointsCount = 0;
-        Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
-        const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
-        if (dtStatusFailed(findStraightPathStatus))
+        if (pathSize == NAV_MESH_PATH_MAX_SIZE)
         {
-            return false;
-        }
-        resultPath.Resize(pathPointsCount);
-        for (int32 i = 0; i < pathPointsCount; i++)
-        {
-            Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
+            resultFlags |= NavMeshPathFlags::PartialPath;
+            break;
         }
+        path[pathSize++] = poly;
+        if (poly == field->GoalPoly)
+            break;
+        const dtPolyRef* next = field->Parents.TryGet(poly);
+        if (!next || *next == 0)
+            return false;
+        poly = *next;
     }
 
-    return true;
+    return GetPathPoints(query, DT_SUCCESS, path, pathSize, startPoly, startPosition, startPositionNavMesh, field->GoalPositionNavMesh, Properties.Rotation, resultPath, resultFlags);
+}
+
+void NavMeshRuntime::RemoveFlowField(uint32 flowFieldId)
+{
+    ScopeLock lock(Locker);
+    NavMeshFlowField* field;
+    if (_flowFields.TryGet(flowFieldId, field))
+    {
+        _flowFields.Remove(flowFieldId);
+        Delete(field);
+    }
+}
+
+bool NavMeshRuntime::BuildFlowField(NavMeshFlowField* field)
+{
+    PROFILE_CPU();
+    field->Parents.Clear();
+    field->GoalPoly = 0;
+    field->TilesVersion = _tilesVersion;
+    field->Built = true;
+
+    // Use a dedicated query with a larger nodes pool (the whole field area is searched at once)
+    if (!_flowFieldQuery)
+        _flowFieldQuery = dtAllocNavMeshQuery();
+    if (dtStatusFailed(_flowFieldQuery->init(_navMesh, FLOW_FIELD_MAX_NODES)))
+    {
+        LOG(Error, "Navmesh query {0} init failed", Properties.Name);
+        return true;
+    }
+
+    dtQueryFilter filter;
+    InitFilter(filter);
+    Float3 extent = Properties.DefaultQueryExtent;
+    Float3::Transform(field->GoalPosition, Properties.Rotation, field->GoalPositionNavMesh);
+    if (!dtStatusSucceed(_flowFieldQuery->findNearestPoly(&field->GoalPositionNavMesh.X, &extent.X, &filter, &field->GoalPoly, nullptr)) || field->GoalPoly == 0)
+        return true;
+
+    // Dijkstra search from the goal (parent of each polygon is the next polygon towards the goal)
+    Array<dtPolyRef> polys, parents;
+    polys.Resize(FLOW_FIELD_MAX_NODES);
+    parents.Resize(FLOW_FIELD_MAX_NODES);
+    int32 count = 0;
+    const dtStatus status = _flowFieldQuery->findPolysAroundCircle(field->GoalPoly, &field->GoalPositionNavMesh.X, field->MaxDistance, &filter, polys.Get(), parents.Get(), nullptr, &count, FLOW_FIELD_MAX_NODES);
+    if (dtStatusFailed(status))
+        return true;
+    if (dtStatusDetail(status, DT_BUFFER_TOO_SMALL) || dtStatusDetail(status, DT_OUT_OF_NODES))
+        LOG(Warning, "Navmesh {0} flow field exceeds the polygons limit ({1}). Use smaller max distance.", Properties.Name, FLOW_FIELD_MAX_NODES);
+    field->Parents.EnsureCapacity(count);
+    for (int32 i = 0; i < count; i++)
+        field->Parents[polys[i]] = parents[i];
+    return false;
+}
+
+uint32 NavMeshRuntime::FindPathAsync(const Vector3& startPosition, const Vector3& endPosition)
+{
+    return FindPathAsync(startPosition, endPosition, PathQueryCallback());
+}
+
+uint32 NavMeshRuntime::FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, const PathQueryCallback& callback)
+{
+    auto query = New<NavMeshPathQuery>();
+    query->ID = (uint32)Platform::InterlockedIncrement(&NextPathQueryId);
+    query->StartPosition = startPosition;
+    query->EndPosition = endPosition;
+    query->Callback = callback;
+    ScopeLock lock(_pathQueriesLocker);
+    _pathQueries.Add(query->ID, query);
+    _pathQueue.Add(query);
+    return query->ID;
+}
+
+NavMeshPathQueryState NavMeshRuntime::GetPathQueryState(uint32 queryId)
+{
+    ScopeLock lock(_pathQueriesLocker);
+    NavMeshPathQuery* query;
+    if (!_pathQueries.TryGet(queryId, query))
+        return NavMeshPathQueryState::Invalid;
+    return query->State;
+}
+
+bool NavMeshRuntime::GetPathQueryResult(uint32 queryId, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags)
+{
+    resultPath.Clear();
+    resultFlags = NavMeshPathFlags::None;
+    ScopeLock lock(_pathQueriesLocker);
+    NavMeshPathQuery* query;
+    if (!_pathQueries.TryGet(queryId, query) || query->State == NavMeshPathQueryState::Pending)
+        return false;
+    const bool result = query->State == NavMeshPathQueryState::Completed;
+    resultPath = MoveTemp(query->Path);
+    resultFlags = query->Flags;
+    if (query->Callback.IsBinded())
+        _pathCallbacksCount--;
+    _pathQueries.Remove(queryId);
+    Delete(query);
+    return result;
+}
+
+void NavMeshRuntime::CancelPathQuery(uint32 queryId)
+{
+    ScopeLock lock(_pathQueriesLocker);
+    NavMeshPathQuery* query;
+    if (!_pathQueries.TryGet(queryId, query))
+        return;
+    _pathQueries.Remove(queryId);
+    if (query->State == NavMeshPathQueryState::Pending && !_pathQueue.Remove(query))
+    {
+        // Query is during processing so let the worker release it
+        query->Canceled = true;
+        return;
+    }
+    if (query->State != NavMeshPathQueryState::Pending && query->Callback.IsBinded())
+        _pathCallbacksCount--;
+    Delete(query);
 }
 
 bool NavMeshRuntime::TestPath(const Vector3& startPosition, const Vector3& endPosition) const
@@ -288,6 +757,202 @@ bool NavMeshRuntime::RayCast(const Vector3& startPosition, const Vector3& endPos
     return result;
 }
 
+void NavMeshRuntime::UpdatePathQueries()
+{
+    // Skip if there is nothing to process
+    {
+        ScopeLock lock(_pathQueriesLocker);
+        bool anyPending = _pathQueue.HasItems();
+        for (int32 i = 0; i < _pathWorkers.Count() && !anyPending; i++)
+            anyPending = _pathWorkers[i]->Current != nullptr;
+        if (!anyPending && _pathCallbacksCount == 0)
+            return;
+    }
+    PROFILE_CPU();
+
+    // Process path queries within the time budget (the navmesh can't be modified in the meantime)
+    {
+        ScopeLock lock(Locker);
+        if (_navMesh)
+        {
+            int32 workersCount;
+            {
+                ScopeLock pathLock(_pathQueriesLocker);
+                workersCount = _pathQueue.Count();
+                for (NavMeshPathWorker* worker : _pathWorkers)
+                    workersCount += worker->Current ? 1 : 0;
+            }
+            workersCount = Math::Clamp(workersCount, 1, Math::Max(JobSystem::GetThreadsCount(), 1));
+            while (_pathWorkers.Count() < workersCount)
+            {
+                auto worker = New<NavMeshPathWorker>();
+                worker->Query = dtAllocNavMeshQuery();
+                _pathWorkers.Add(worker);
+            }
+            _pathQueriesDeadline = Platform::GetTimeSeconds() + PathQueriesTimeBudget * 0.001;
+            if (_pathWorkers.Count() == 1)
+            {
+                ProcessPathQueries(0);
+            }
+            else
+            {
+                Function<void(int32)> job;
+                job.Bind<NavMeshRuntime, &NavMeshRuntime::ProcessPathQueries>(this);
+                JobSystem::Wait(JobSystem::Dispatch(job, _pathWorkers.Count()));
+            }
+        }
+        else
+        {
+            // Navmesh is not yet created (or has been disposed)
+            ScopeLock pathLock(_pathQueriesLocker);
+            for (NavMeshPathWorker* worker : _pathWorkers)
+            {
+                if (worker->Current)
+                {
+                    EndPathQuery(worker->Current, false);
+                    worker->Current = nullptr;
+                }
+            }
+            for (NavMeshPathQuery* query : _pathQueue)
+                EndPathQuery(query, false);
+            _pathQueue.Clear();
+        }
+    }
+
+    // Send results of the ended queries
+    if (_pathCallbacksCount != 0)
+    {
+        Array<NavMeshPathQuery*, InlinedAllocation<32>> ended;
+        {
+            ScopeLock lock(_pathQueriesLocker);
+            for (auto it = _pathQueries.Begin(); it.IsNotEnd(); ++it)
+            {
+                NavMeshPathQuery* query = it->Value;
+                if (query->State != NavMeshPathQueryState::Pending && query->Callback.IsBinded())
+                {
+                    ended.Add(query);
+                    _pathQueries.Remove(it);
+                }
+            }
+            _pathCallbacksCount = 0;
+        }
+        for (NavMeshPathQuery* query : ended)
+        {
+            query->Callback(query->ID, query->State == NavMeshPathQueryState::Completed, query->Path, query->Flags);
+            Delete(query);
+        }
+    }
+}
+
+void NavMeshRuntime::ProcessPathQueries(int32 workerIndex)
+{
+    NavMeshPathWorker* worker = _pathWorkers[workerIndex];
+    dtNavMeshQuery* query = worker->Query;
+    if (worker->NavMesh != _navMesh)
+    {
+        if (dtStatusFailed(query->init(_navMesh, MAX_NODES)))
+        {
+            LOG(Error, "Navmesh query {0} init failed", Properties.Name);
+            return;
+        }
+        worker->NavMesh = _navMesh;
+        worker->Started = false;
+    }
+    if (worker->Started && worker->TilesVersion != _tilesVersion)
+    {
+        // Restart the path search after navmesh tiles modification (polygons might be invalid)
+        worker->Started = false;
+    }
+    const Float3 extent = Properties.DefaultQueryExtent;
+    do
+    {
+        NavMeshPathQuery* e = worker->Current;
+        if (!e)
+        {
+            // Pick the next query from the queue
+            _pathQueriesLocker.Lock();
+            if (_pathQueue.HasItems())
+            {
+                e = _pathQueue[0];
+                _pathQueue.RemoveAtKeepOrder(0);
+            }
+            _pathQueriesLocker.Unlock();
+            if (!e)
+                break;
+            worker->Current = e;
+            worker->Started = false;
+        }
+        if (!worker->Started)
+        {
+            // Start the path search
+            InitFilter(worker->Filter);
+            Float3::Transform(e->StartPosition, Properties.Rotation, worker->StartPositionNavMesh);
+            Float3::Transform(e->EndPosition, Properties.Rotation, worker->EndPositionNavMesh);
+            dtPolyRef endPoly = 0;
+            if (!dtStatusSucceed(query->findNearestPoly(&worker->StartPositionNavMesh.X, &extent.X, &worker->Filter, &worker->StartPoly, nullptr)) ||
+                !dtStatusSucceed(query->findNearestPoly(&worker->EndPositionNavMesh.X, &extent.X, &worker->Filter, &endPoly, nullptr)))
+            {
+                EndPathQuery(e, false);
+                worker->Current = nullptr;
+                continue;
+            }
+            worker->CacheKey = { worker->StartPoly, endPoly, GetFilterHash(worker->Filter) };
+            if (PathCacheSize > 0)
+            {
+                // Reuse the cached path corridor
+                dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
+                int32 pathSize;
+                if (_pathCache->TryGet(_navMesh, _tilesVersion, worker->CacheKey, path, pathSize))
+                {
+                    const bool success = GetPathPoints(query, DT_SUCCESS, path, pathSize, worker->StartPoly, e->StartPosition, worker->StartPositionNavMesh, worker->EndPositionNavMesh, Properties.Rotation, e->Path, e->Flags);
+                    EndPathQuery(e, success);
+                    worker->Current = nullptr;
+                    continue;
+                }
+            }
+            if (dtStatusFailed(query->initSlicedFindPath(worker->StartPoly, endPoly, &worker->StartPositionNavMesh.X, &worker->EndPositionNavMesh.X, &worker->Filter)))
+            {
+                EndPathQuery(e, false);
+                worker->Current = nullptr;
+                continue;
+            }
+            worker->Started = true;
+            worker->TilesVersion = _tilesVersion;
+        }
+
+        // Continue the path search
+        const dtStatus status = query->updateSlicedFindPath(PathQueriesSliceIterations, nullptr);
+        if (dtStatusInProgress(status))
+            continue;
+        bool success = false;
+        if (dtStatusSucceed(status))
+        {
+            dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
+            int32 pathSize;
+            const dtStatus findPathStatus = query->finalizeSlicedFindPath(path, &pathSize, NAV_MESH_PATH_MAX_SIZE);
+            if (PathCacheSize > 0 && dtStatusSucceed(findPathStatus) && !dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
+                _pathCache->Add(_tilesVersion, worker->CacheKey, path, pathSize, PathCacheSize);
+            success = dtStatusSucceed(findPathStatus) && GetPathPoints(query, findPathStatus, path, pathSize, worker->StartPoly, e->StartPosition, worker->StartPositionNavMesh, worker->EndPositionNavMesh, Properties.Rotation, e->Path, e->Flags);
+        }
+        EndPathQuery(e, success);
+        worker->Current = nullptr;
+        worker->Started = false;
+    } while (Platform::GetTimeSeconds() < _pathQueriesDeadline);
+}
+
+void NavMeshRuntime::EndPathQuery(NavMeshPathQuery* query, bool success)
+{
+    ScopeLock lock(_pathQueriesLocker);
+    if (query->Canceled)
+    {
+        Delete(query);
+        return;
+    }
+    query->State = success ? NavMeshPathQueryState::Completed : NavMeshPathQueryState::Failed;
+    if (query->Callback.IsBinded())
+        _pathCallbacksCount++;
+}
+
 void NavMeshRuntime::SetTileSize(float tileSize)
 {
     ScopeLock lock(Locker);
@@ -347,6 +1012,8 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
     {
         LOG(Error, "Navmesh query {0} init failed", Properties.Name);
     }
+    _pathCache->Clear();
+    _tilesVersion++;
 
     // Prepare tiles container
     _tiles.EnsureCapacity(newCapacity);
@@ -369,6 +1036,10 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
             LOG(Warning, "Could not add tile ({2}x{3}, layer {4}) to navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE, tile.X, tile.Y, tile.Layer);
         }
     }
+
+    // Restore tiles built from the tile cache layers
+    if (_tileCache)
+        InitTileCache();
 }
 
 void NavMeshRuntime::AddTiles(NavMesh* navMesh)
@@ -449,13 +1120,22 @@ void NavMeshRuntime::RemoveTile(int32 x, int32 y, int32 layer)
         return;
     PROFILE_CPU_NAMED("NavMeshRuntime.RemoveTile");
 
-    const auto tileRef = _navMesh->getTileRefAt(x, y, layer);
-    if (tileRef == 0)
-        return;
-
-    if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+    if (_tileCache)
     {
-        LOG(Warning, "Failed to remove tile ({1}x{2}, layer {3}) from navmesh {0}", Properties.Name, x, y, layer);
+        // Remove tile cache layers and all tiles built from them
+        RemoveTileCacheLayers(x, y);
+        RemoveNavMeshTiles(x, y);
+    }
+    else
+    {
+        const auto tileRef = _navMesh->getTileRefAt(x, y, layer);
+        if (tileRef == 0)
+            return;
+
+        if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+        {
+            LOG(Warning, "Failed to remove tile ({1}x{2}, layer {3}) from navmesh {0}", Properties.Name, x, y, layer);
+        }
     }
 
     for (int32 i = 0; i < _tiles.Count(); i++)
@@ -467,6 +1147,7 @@ void NavMeshRuntime::RemoveTile(int32 x, int32 y, int32 layer)
             break;
         }
     }
+    _tilesVersion++;
 }
 
 void NavMeshRuntime::RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMesh, const NavMeshTile& tile, void* customData), void* userData)
@@ -482,6 +1163,14 @@ void NavMeshRuntime::RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMes
         auto& tile = _tiles[i];
         if (prediction(this, tile, userData))
         {
+            if (_tileCache)
+            {
+                RemoveTileCacheLayers(tile.X, tile.Y);
+                RemoveNavMeshTiles(tile.X, tile.Y);
+                _tiles.RemoveAt(i--);
+                _tilesVersion++;
+                continue;
+            }
             const auto tileRef = _navMesh->getTileRefAt(tile.X, tile.Y, tile.Layer);
             if (tileRef == 0)
             {
@@ -496,6 +1185,7 @@ void NavMeshRuntime::RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMes
             }
 
             _tiles.RemoveAt(i--);
+            _tilesVersion++;
         }
     }
 }
@@ -609,23 +1299,31 @@ void NavMeshRuntime::DebugDraw()
 
 void NavMeshRuntime::Dispose()
 {
+    FreeTileCache();
     if (_navMesh)
     {
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
     }
     _tiles.Resize(0);
+    _pathCache->Clear();
+    _tilesVersion++;
 }
 
 void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData)
 {
     // Check if that tile has been added to navmesh
     NavMeshTile* tile = nullptr;
+    if (_tileCache)
+    {
+        // Remove tiles built from the tile cache layers
+        RemoveNavMeshTiles(tileData.PosX, tileData.PosY);
+    }
     const auto tileRef = _navMesh->getTileRefAt(tileData.PosX, tileData.PosY, tileData.Layer);
-    if (tileRef)
+    if (tileRef || _tileCache)
     {
         // Remove any existing tile at that location
-        if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+        if (tileRef && dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
         {
             LOG(Warning, "Failed to remove tile from navmesh {0}", Properties.Name);
         }
@@ -654,8 +1352,10 @@ void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData
     tile->Layer = tileData.Layer;
 #if USE_DATA_LINK
 	tile->Data.Link(tileData.Data);
+	tile->CacheData.Link(tileData.CacheData);
 #else
     tile->Data.Copy(tileData.Data);
+    tile->CacheData.Copy(tileData.CacheData);
 #endif
 
     // Add tile to navmesh
@@ -673,4 +1373,215 @@ void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData
     {
         LOG(Warning, "Could not add tile ({2}x{3}, layer {4}) to navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE, tileData.PosX, tileData.PosY, tileData.Layer);
     }
+    _tilesVersion++;
+
+    // Build tile from the tile cache layers to support dynamic obstacles
+    if (tile->CacheData.Length() != 0 && NavigationSettings::Get()->EnableDynamicObstacles)
+    {
+        if (_tileCache)
+            AddTileCacheLayers(*tile);
+        else
+            InitTileCache();
+    }
+}
+
+void NavMeshRuntime::SetObstacle(uint32 id, const NavMeshObstacle& obstacle)
+{
+    ScopeLock lock(Locker);
+    _obstacles[id] = obstacle;
+    if (_tileCache)
+        _tileCache->DirtyObstacles.AddUnique(id);
+}
+
+void NavMeshRuntime::RemoveObstacle(uint32 id)
+{
+    ScopeLock lock(Locker);
+    if (_obstacles.Remove(id) && _tileCache)
+        _tileCache->DirtyObstacles.AddUnique(id);
+}
+
+void NavMeshRuntime::UpdateObstacles()
+{
+    ScopeLock lock(Locker);
+    if (!_tileCache || _tileCache->DirtyObstacles.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("NavMeshRuntime.UpdateObstacles");
+    auto& cache = *_tileCache;
+    dtTileCache* tileCache = cache.TileCache;
+    int32 processed = 0;
+    while (processed < cache.DirtyObstacles.Count())
+    {
+        // Issue obstacle requests in small batches (tile cache handles a limited amount of requests and touched tiles per update)
+        const int32 batchEnd = Math::Min(processed + 4, cache.DirtyObstacles.Count());
+        for (; processed < batchEnd; processed++)
+        {
+            const uint32 id = cache.DirtyObstacles[processed];
+            dtObstacleRef ref;
+            if (cache.Obstacles.TryGet(id, ref))
+            {
+                tileCache->removeObstacle(ref);
+                cache.Obstacles.Remove(id);
+            }
+            const NavMeshObstacle* obstacle = _obstacles.TryGet(id);
+            if (obstacle && AddObstacle(tileCache, Properties, *obstacle, ref))
+                cache.Obstacles.Add(id, ref);
+        }
+
+        // Rebuild touched tiles from the compressed layers
+        bool upToDate = false;
+        for (int32 i = 0; i < 1024 && !upToDate; i++)
+            tileCache->update(0.0f, _navMesh, &upToDate);
+    }
+    cache.DirtyObstacles.Clear();
+    _tilesVersion++;
+}
+
+void NavMeshRuntime::InitTileCache()
+{
+    FreeTileCache();
+    auto& settings = *NavigationSettings::Get();
+    if (Math::NotNearEqual(settings.CellSize * (float)settings.TileSize, _tileSize))
+    {
+        LOG(Warning, "Cannot use dynamic obstacles with navmesh {0}. Navmesh tiles size doesn't match the navigation settings.", Properties.Name);
+        return;
+    }
+    PROFILE_CPU_NAMED("NavMeshRuntime.InitTileCache");
+
+    // Prepare parameters
+    dtTileCacheParams params;
+    Platform::MemoryClear(&params, sizeof(params));
+    params.cs = settings.CellSize;
+    params.ch = settings.CellHeight;
+    params.width = settings.TileSize;
+    params.height = settings.TileSize;
+    params.walkableHeight = Properties.Agent.Height;
+    params.walkableRadius = Properties.Agent.Radius;
+    params.walkableClimb = Properties.Agent.StepHeight;
+    params.maxSimplificationError = settings.MaxEdgeError;
+    params.maxTiles = Math::RoundUpToPowerOf2(Math::Max(GetTilesCapacity(), 32) * 4);
+    params.maxObstacles = settings.MaxObstacles;
+
+    // Initialize tile cache
+    auto cache = New<NavMeshTileCache>();
+    cache->TileCache = dtAllocTileCache();
+    cache->Process.Cache = cache;
+    cache->WalkableClimb = params.walkableClimb;
+    if (!cache->TileCache || dtStatusFailed(cache->TileCache->init(&params, &cache->Alloc, &cache->Compressor, &cache->Process)))
+    {
+        LOG(Error, "Navmesh {0} tile cache init failed", Properties.Name);
+        dtFreeTileCache(cache->TileCache);
+        Delete(cache);
+        return;
+    }
+    _tileCache = cache;
+
+    // Build tiles from the layers and apply the obstacles
+    for (const NavMeshTile& tile : _tiles)
+    {
+        if (tile.CacheData.Length() != 0)
+            AddTileCacheLayers(tile);
+    }
+    for (auto& e : _obstacles)
+        cache->DirtyObstacles.AddUnique(e.Key);
+    _tilesVersion++;
+}
+
+void NavMeshRuntime::FreeTileCache()
+{
+    if (_tileCache)
+    {
+        dtFreeTileCache(_tileCache->TileCache);
+        Delete(_tileCache);
+        _tileCache = nullptr;
+    }
+}
+
+void NavMeshRuntime::AddTileCacheLayers(const NavMeshTile& tile)
+{
+    auto& cache = *_tileCache;
+    RemoveTileCacheLayers(tile.X, tile.Y);
+
+    // Cache the off-mesh links of the tile (built from the scene geometry)
+    const dtMeshTile* meshTile = _navMesh->getTileAt(tile.X, tile.Y, tile.Layer);
+    if (meshTile && meshTile->header && meshTile->header->offMeshConCount != 0)
+    {
+        auto& links = cache.Links[GetTileKey(tile.X, tile.Y)];
+        links.Resize(meshTile->header->offMeshConCount);
+        for (int32 i = 0; i < links.Count(); i++)
+        {
+            const dtOffMeshConnection& con = meshTile->offMeshCons[i];
+            const dtPoly& poly = meshTile->polys[con.poly];
+            auto& link = links[i];
+            link.Start = *(const Float3*)&con.pos[0];
+            link.End = *(const Float3*)&con.pos[3];
+            link.Radius = con.rad;
+            link.Flags = poly.flags;
+            link.Area = poly.getArea();
+            link.Direction = con.flags & DT_OFFMESH_CON_BIDIR;
+            link.UserId = con.userId;
+        }
+    }
+
+    // Add compressed layers
+    const byte* data = tile.CacheData.Get();
+    const byte* dataEnd = data + tile.CacheData.Length();
+    while (data + sizeof(int32) <= dataEnd)
+    {
+        int32 layerSize;
+        Platform::MemoryCopy(&layerSize, data, sizeof(int32));
+        data += sizeof(int32);
+        if (layerSize <= 0 || data + layerSize > dataEnd)
+        {
+            LOG(Warning, "Invalid tile ({1}x{2}) cache data in navmesh {0}", Properties.Name, tile.X, tile.Y);
+            break;
+        }
+        const auto layerData = (byte*)dtAlloc(layerSize, DT_ALLOC_PERM);
+        Platform::MemoryCopy(layerData, data, layerSize);
+        const dtStatus result = cache.TileCache->addTile(layerData, layerSize, DT_COMPRESSEDTILE_FREE_DATA, nullptr);
+        if (dtStatusFailed(result))
+        {
+            LOG(Warning, "Could not add tile ({2}x{3}) layer to navmesh {0} tile cache (error: {1})", Properties.Name, result & ~DT_FAILURE, tile.X, tile.Y);
+            dtFree(layerData);
+        }
+        data += layerSize;
+    }
+
+    // Build navmesh tiles from the layers
+    cache.TileCache->buildNavMeshTilesAt(tile.X, tile.Y, _navMesh);
+    _tilesVersion++;
+
+    // Re-apply obstacles overlapping the tile (touched tiles list of the obstacle has to be updated)
+    const float agentRadius = Properties.Agent.Radius;
+    const Float2 tileMin((float)tile.X * _tileSize, (float)tile.Y * _tileSize);
+    const Float2 tileMax = tileMin + _tileSize;
+    for (auto& e : cache.Obstacles)
+    {
+        const NavMeshObstacle* obstacle = _obstacles.TryGet(e.Key);
+        if (!obstacle)
+            continue;
+        const Float3 position = Vector3::Transform(obstacle->Position, Properties.Rotation);
+        const float radius = (obstacle->Shape == NavMeshObstacleShape::Box ? obstacle->Extents.Length() : obstacle->Radius) + agentRadius;
+        if (position.X + radius >= tileMin.X && position.X - radius <= tileMax.X && position.Z + radius >= tileMin.Y && position.Z - radius <= tileMax.Y)
+            cache.DirtyObstacles.AddUnique(e.Key);
+    }
+}
+
+void NavMeshRuntime::RemoveTileCacheLayers(int32 x, int32 y)
+{
+    const int32 maxLayers = 32;
+    dtCompressedTileRef layers[maxLayers];
+    const int32 layersCount = _tileCache->TileCache->getTilesAt(x, y, layers, maxLayers);
+    for (int32 i = 0; i < layersCount; i++)
+        _tileCache->TileCache->removeTile(layers[i], nullptr, nullptr);
+    _tileCache->Links.Remove(GetTileKey(x, y));
+}
+
+void NavMeshRuntime::RemoveNavMeshTiles(int32 x, int32 y)
+{
+    const int32 maxTiles = 32;
+    const dtMeshTile* tiles[maxTiles];
+    const int32 tilesCount = _navMesh->getTilesAt(x, y, tiles, maxTiles);
+    for (int32 i = 0; i < tilesCount; i++)
+        _navMesh->removeTile(_navMesh->getTileRef(tiles[i]), nullptr, nullptr);
+    _tilesVersion++;
 }
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "NavMeshData.h"
@@ -11,6 +13,11 @@
 class dtNavMesh;
 class dtNavMeshQuery;
 class NavMesh;
+struct NavMeshPathQuery;
+struct NavMeshPathWorker;
+struct NavMeshPathCache;
+struct NavMeshFlowField;
+struct NavMeshTileCache;
 
 /// <summary>
 /// The navigation mesh tile data.
@@ -23,6 +30,7 @@ class FLAXENGINE_API NavMeshTile
     int32 Layer;
     NavMesh* NavMesh;
     BytesContainer Data;
+    BytesContainer CacheData;
 };
 
 /// <summary>
@@ -45,6 +53,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
 {
     DECLARE_SCRIPTING_TYPE_MINIMAL(NavMeshRuntime);
 public:
+    /// <summary>
+    /// The asynchronous path query completion callback. Called on the main thread with query identifier, query result (true if found valid path) and the result path with its flags.
+    /// </summary>
+    typedef Function<void(uint32, bool, const Array<Vector3, HeapAllocation>&, NavMeshPathFlags)> PathQueryCallback;
+
     // Gets the first valid navigation mesh runtime. Return null if none created.
     API_FUNCTION() static NavMeshRuntime* Get();
 
@@ -63,11 +76,32 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     static Color NavAreasColors[64];
 #endif
 
+    // The time budget (in milliseconds) for processing asynchronous path queries in a single frame (applied by the NavigationSettings).
+    static float PathQueriesTimeBudget;
+
+    // The maximum amount of search iterations of a single path query slice (applied by the NavigationSettings).
+    static int32 PathQueriesSliceIterations;
+
+    // The maximum amount of cached path corridors (applied by the NavigationSettings). Use 0 to disable path caching.
+    static int32 PathCacheSize;
+
 private:
     dtNavMesh* _navMesh;
     dtNavMeshQuery* _navMeshQuery;
     float _tileSize;
     Array<NavMeshTile> _tiles;
+    uint32 _tilesVersion = 0;
+    CriticalSection _pathQueriesLocker;
+    Dictionary<uint32, NavMeshPathQuery*> _pathQueries;
+    Array<NavMeshPathQuery*> _pathQueue;
+    Array<NavMeshPathWorker*> _pathWorkers;
+    int32 _pathCallbacksCount = 0;
+    double _pathQueriesDeadline = 0.0;
+    NavMeshTileCache* _tileCache = nullptr;
+    Dictionary<uint32, NavMeshObstacle> _obstacles;
+    NavMeshPathCache* _pathCache;
+    Dictionary<uint32, NavMeshFlowField*> _flowFields;
+    dtNavMeshQuery* _flowFieldQuery = nullptr;
 
 public:
     NavMeshRuntime(const NavMeshProperties& properties);
@@ -137,6 +171,106 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
     bool FindPath(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags) const;
 
+    /// <summary>
+    /// Finds the path between the two positions presented as a list of waypoints written into the caller-provided buffer (doesn't allocate the result array in scripting).
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <param name="resultPath">The output buffer for the path waypoints.</param>
+    /// <param name="resultPathCapacity">The size of the output buffer (in elements). Longer paths are truncated.</param>
+    /// <param name="resultPathLength">The amount of waypoints written into the output buffer.</param>
+    /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
+    API_FUNCTION() bool FindPath(const Vector3& startPosition, const Vector3& endPosition, Vector3* resultPath, int32 resultPathCapacity, API_PARAM(Out) int32& resultPathLength) const;
+
+    /// <summary>
+    /// Creates the flow field towards the goal position used by the path queries of many agents converging on the same point (single search from the goal for all agents, see FindFlowFieldPath). The field is automatically rebuilt after navmesh tiles modification.
+    /// </summary>
+    /// <remarks>One-directional navmesh links are traversed in reverse by the flow field search so they should not be used within the field area.</remarks>
+    /// <param name="goalPosition">The goal position.</param>
+    /// <param name="maxDistance">The maximum distance from the goal (search radius). Agents further away won't find the path.</param>
+    /// <returns>The flow field identifier or 0 if failed.</returns>
+    API_FUNCTION() uint32 CreateFlowField(const Vector3& goalPosition, float maxDistance = 10000.0f);
+
+    /// <summary>
+    /// Finds the path from the specified position to the goal of the flow field (see CreateFlowField).
+    /// </summary>
+    /// <param name="flowFieldId">The flow field identifier.</param>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="resultPath">The result path.</param>
+    /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed (eg. start point is outside the flow field).</returns>
+    API_FUNCTION() bool FindFlowFieldPath(uint32 flowFieldId, const Vector3& startPosition, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath)
+    {
+        NavMeshPathFlags flags;
+        return FindFlowFieldPath(flowFieldId, startPosition, resultPath, flags);
+    }
+
+    /// <summary>
+    /// Finds the path from the specified position to the goal of the flow field (see CreateFlowField).
+    /// </summary>
+    /// <param name="flowFieldId">The flow field identifier.</param>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="resultPath">The result path.</param>
+    /// <param name="resultFlags">The result path flags.</param>
+    /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed (eg. start point is outside the flow field).</returns>
+    bool FindFlowFieldPath(uint32 flowFieldId, const Vector3& startPosition, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags);
+
+    /// <summary>
+    /// Removes the flow field.
+    /// </summary>
+    /// <param name="flowFieldId">The flow field identifier.</param>
+    API_FUNCTION() void RemoveFlowField(uint32 flowFieldId);
+
+    /// <summary>
+    /// Requests the asynchronous path finding between the two positions. Queries are processed in the background by Job System within a time budget per frame (long paths are searched over multiple frames). Use GetPathQueryState to check the progress and GetPathQueryResult to get the path.
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <returns>The path query identifier.</returns>
+    API_FUNCTION() uint32 FindPathAsync(const Vector3& startPosition, const Vector3& endPosition);
+
+    /// <summary>
+    /// Requests the asynchronous path finding between the two positions. Queries are processed in the background by Job System within a time budget per frame (long paths are searched over multiple frames).
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <param name="callback">The callback invoked on the main thread when query ends. Query is released after the callback.</param>
+    /// <returns>The path query identifier.</returns>
+    uint32 FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, const PathQueryCallback& callback);
+
+    /// <summary>
+    /// Gets the state of the asynchronous path query.
+    /// </summary>
+    /// <param name="queryId">The path query identifier.</param>
+    /// <returns>The query state.</returns>
+    API_FUNCTION() NavMeshPathQueryState GetPathQueryState(uint32 queryId);
+
+    /// <summary>
+    /// Gets the result of the completed asynchronous path query and releases it.
+    /// </summary>
+    /// <param name="queryId">The path query identifier.</param>
+    /// <param name="resultPath">The result path.</param>
+    /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed or query is still pending.</returns>
+    API_FUNCTION() bool GetPathQueryResult(uint32 queryId, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath)
+    {
+        NavMeshPathFlags flags;
+        return GetPathQueryResult(queryId, resultPath, flags);
+    }
+
+    /// <summary>
+    /// Gets the result of the completed asynchronous path query and releases it.
+    /// </summary>
+    /// <param name="queryId">The path query identifier.</param>
+    /// <param name="resultPath">The result path.</param>
+    /// <param name="resultFlags">The result path flags.</param>
+    /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed or query is still pending.</returns>
+    bool GetPathQueryResult(uint32 queryId, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags);
+
+    /// <summary>
+    /// Cancels the asynchronous path query (pending or completed) and releases it.
+    /// </summary>
+    /// <param name="queryId">The path query identifier.</param>
+    API_FUNCTION() void CancelPathQuery(uint32 queryId);
+
     /// <summary>
     /// Tests the path between the two positions (non-partial).
     /// </summary>
@@ -190,6 +324,19 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool RayCast(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) NavMeshHit& hitInfo) const;
 
+    /// <summary>
+    /// Adds or updates the dynamic obstacle that carves the navmesh (without rebuilding tiles from the scene geometry). Obstacle gets applied during the next navigation update. Requires tiles built with NavigationSettings.EnableDynamicObstacles.
+    /// </summary>
+    /// <param name="id">The obstacle identifier (unique within the navmesh, see Navigation.AddObstacle).</param>
+    /// <param name="obstacle">The obstacle description.</param>
+    API_FUNCTION() void SetObstacle(uint32 id, API_PARAM(Ref) const NavMeshObstacle& obstacle);
+
+    /// <summary>
+    /// Removes the dynamic obstacle.
+    /// </summary>
+    /// <param name="id">The obstacle identifier.</param>
+    API_FUNCTION() void RemoveObstacle(uint32 id);
+
 public:
     /// <summary>
     /// Sets the size of the tile (if not assigned). Disposes the mesh if added tiles have different size.
@@ -237,6 +384,16 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     /// <param name="userData">The user data passed to the callback method.</param>
     void RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMesh, const NavMeshTile& tile, void* customData), void* userData);
 
+    /// <summary>
+    /// Processes the asynchronous path queries (within a time budget) and invokes completion callbacks. Called by the navigation service every frame.
+    /// </summary>
+    void UpdatePathQueries();
+
+    /// <summary>
+    /// Applies the dynamic obstacles changes and rebuilds the affected tiles from the tile cache layers. Called by the navigation service every frame.
+    /// </summary>
+    void UpdateObstacles();
+
 #if COMPILE_WITH_DEBUG_DRAW
     void DebugDraw();
 #endif
@@ -248,4 +405,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
 
 private:
     void AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData);
+    void InitTileCache();
+    void FreeTileCache();
+    void AddTileCacheLayers(const NavMeshTile& tile);
+    void RemoveTileCacheLayers(int32 x, int32 y);
+    void RemoveNavMeshTiles(int32 x, int32 y);
+    void ProcessPathQueries(int32 workerIndex);
+    void EndPathQuery(NavMeshPathQuery* query, bool success);
+    bool BuildFlowField(NavMeshFlowField* field);
 };
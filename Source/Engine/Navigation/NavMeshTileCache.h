@@ -0,0 +1,39 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include <ThirdParty/recastnavigation/DetourTileCacheBuilder.h>
+#include <ThirdParty/LZ4/lz4.h>
+
+// The maximum size of the tile cache layer (in cells, including the border) - layer header uses 8-bit dimensions.
+#define NAV_MESH_TILE_CACHE_MAX_LAYER_SIZE 255
+
+/// <summary>
+/// The Detour tile cache layers compression (LZ4).
+/// </summary>
+struct NavMeshTileCacheCompressor : dtTileCacheCompressor
+{
+    int maxCompressedSize(const int bufferSize) override
+    {
+        return LZ4_compressBound(bufferSize);
+    }
+
+    dtStatus compress(const unsigned char* buffer, const int bufferSize, unsigned char* compressed, const int maxCompressedSize, int* compressedSize) override
+    {
+        const int size = LZ4_compress_default((const char*)buffer, (char*)compressed, bufferSize, maxCompressedSize);
+        if (size <= 0)
+            return DT_FAILURE;
+        *compressedSize = size;
+        return DT_SUCCESS;
+    }
+
+    dtStatus decompress(const unsigned char* compressed, const int compressedSize, unsigned char* buffer, const int maxBufferSize, int* bufferSize) override
+    {
+        const int size = LZ4_decompress_safe((const char*)compressed, (char*)buffer, compressedSize, maxBufferSize);
+        if (size < 0)
+            return DT_FAILURE;
+        *bufferSize = size;
+        return DT_SUCCESS;
+    }
+};
@@ -25,6 +25,8 @@
 namespace
 {
     Array<NavMeshRuntime*, InlinedAllocation<16>> NavMeshes;
+    Dictionary<uint32, NavMeshObstacle> Obstacles;
+    uint32 NextObstacleId = 0;
 }
 
 NavMeshRuntime* NavMeshRuntime::Get()
@@ -95,6 +97,8 @@ NavMeshRuntime* NavMeshRuntime::Get(const NavMeshProperties& navMeshProperties,
         // Create a new navmesh
         result = New<NavMeshRuntime>(navMeshProperties);
         NavMeshes.Add(result);
+        for (auto& e : Obstacles)
+            result->SetObstacle(e.Key, e.Value);
     }
     return result;
 }
@@ -104,6 +108,9 @@ float NavMeshRuntime::NavAreasCosts[64];
 #if COMPILE_WITH_DEBUG_DRAW
 Color NavMeshRuntime::NavAreasColors[64];
 #endif
+float NavMeshRuntime::PathQueriesTimeBudget = 2.0f;
+int32 NavMeshRuntime::PathQueriesSliceIterations = 64;
+int32 NavMeshRuntime::PathCacheSize = 0;
 
 bool NavAgentProperties::operator==(const NavAgentProperties& other) const
 {
@@ -168,9 +175,7 @@ class NavigationService : public EngineService
     }
 
     bool Init() override;
-#if COMPILE_WITH_NAV_MESH_BUILDER
     void Update() override;
-#endif
     void Dispose() override;
 };
 
@@ -211,6 +216,10 @@ IMPLEMENT_ENGINE_SETTINGS_GETTER(NavigationSettings, Navigation);
 
 void NavigationSettings::Apply()
 {
+    NavMeshRuntime::PathQueriesTimeBudget = PathQueriesTimeBudget;
+    NavMeshRuntime::PathQueriesSliceIterations = PathQueriesSliceIterations;
+    NavMeshRuntime::PathCacheSize = PathCacheSize;
+
     // Cache areas properties
     for (auto& area : NavAreas)
     {
@@ -239,6 +248,12 @@ void NavigationSettings::Deserialize(DeserializeStream& stream, ISerializeModifi
 {
     DESERIALIZE(AutoAddMissingNavMeshes);
     DESERIALIZE(AutoRemoveMissingNavMeshes);
+    DESERIALIZE(PathQueriesTimeBudget);
+    DESERIALIZE(PathQueriesSliceIterations);
+    DESERIALIZE(PathCacheSize);
+    DESERIALIZE(MaxTileBuildJobs);
+    DESERIALIZE(EnableDynamicObstacles);
+    DESERIALIZE(MaxObstacles);
     DESERIALIZE(CellHeight);
     DESERIALIZE(CellSize);
     DESERIALIZE(TileSize);
@@ -283,17 +298,26 @@ bool NavigationService::Init()
     return false;
 }
 
-#if COMPILE_WITH_NAV_MESH_BUILDER
-
 void NavigationService::Update()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
     NavMeshBuilder::Update();
-}
-
 #endif
 
+    // Apply dynamic obstacles and process async path queries
+    for (auto navMesh : NavMeshes)
+    {
+        navMesh->UpdateObstacles();
+        navMesh->UpdatePathQueries();
+    }
+}
+
 void NavigationService::Dispose()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
+    NavMeshBuilder::Dispose();
+#endif
+
     // Release nav meshes
     for (auto navMesh : NavMeshes)
     {
@@ -302,6 +326,7 @@ void NavigationService::Dispose()
     }
     NavMeshes.Clear();
     NavMeshes.ClearDelete();
+    Obstacles.Clear();
 }
 
 bool Navigation::FindDistanceToWall(const Vector3& startPosition, NavMeshHit& hitInfo, float maxDistance)
@@ -318,6 +343,41 @@ bool Navigation::FindPath(const Vector3& startPosition, const Vector3& endPositi
     return NavMeshes.First()->FindPath(startPosition, endPosition, resultPath);
 }
 
+bool Navigation::FindPath(const Vector3& startPosition, const Vector3& endPosition, Vector3* resultPath, int32 resultPathCapacity, int32& resultPathLength)
+{
+    resultPathLength = 0;
+    if (NavMeshes.IsEmpty())
+        return false;
+    return NavMeshes.First()->FindPath(startPosition, endPosition, resultPath, resultPathCapacity, resultPathLength);
+}
+
+uint32 Navigation::FindPathAsync(const Vector3& startPosition, const Vector3& endPosition)
+{
+    if (NavMeshes.IsEmpty())
+        return 0;
+    return NavMeshes.First()->FindPathAsync(startPosition, endPosition);
+}
+
+NavMeshPathQueryState Navigation::GetPathQueryState(uint32 queryId)
+{
+    if (NavMeshes.IsEmpty())
+        return NavMeshPathQueryState::Invalid;
+    return NavMeshes.First()->GetPathQueryState(queryId);
+}
+
+bool Navigation::GetPathQueryResult(uint32 queryId, Array<Vector3, HeapAllocation>& resultPath)
+{
+    if (NavMeshes.IsEmpty())
+        return false;
+    return NavMeshes.First()->GetPathQueryResult(queryId, resultPath);
+}
+
+void Navigation::CancelPathQuery(uint32 queryId)
+{
+    if (NavMeshes.HasItems())
+        NavMeshes.First()->CancelPathQuery(queryId);
+}
+
 bool Navigation::TestPath(const Vector3& startPosition, const Vector3& endPosition)
 {
     if (NavMeshes.IsEmpty())
@@ -353,6 +413,28 @@ bool Navigation::RayCast(const Vector3& startPosition, const Vector3& endPositio
     return NavMeshes.First()->RayCast(startPosition, endPosition, hitInfo);
 }
 
+uint32 Navigation::AddObstacle(const NavMeshObstacle& obstacle)
+{
+    const uint32 id = ++NextObstacleId;
+    UpdateObstacle(id, obstacle);
+    return id;
+}
+
+void Navigation::UpdateObstacle(uint32 id, const NavMeshObstacle& obstacle)
+{
+    Obstacles[id] = obstacle;
+    for (auto navMesh : NavMeshes)
+        navMesh->SetObstacle(id, obstacle);
+}
+
+void Navigation::RemoveObstacle(uint32 id)
+{
+    if (!Obstacles.Remove(id))
+        return;
+    for (auto navMesh : NavMeshes)
+        navMesh->RemoveObstacle(id);
+}
+
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
 bool Navigation::IsBuildingNavMesh()
@@ -365,6 +447,11 @@ float Navigation::GetNavMeshBuildingProgress()
     return NavMeshBuilder::GetNavMeshBuildingProgress();
 }
 
+void Navigation::SetNavMeshBuildPriorityLocations(const Array<Vector3, HeapAllocation>& locations)
+{
+    NavMeshBuilder::SetPriorityLocations(locations);
+}
+
 void Navigation::BuildNavMesh(Scene* scene, float timeoutMs)
 {
     NavMeshBuilder::Build(scene, timeoutMs);
@@ -0,0 +1,44 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System;
+
+namespace FlaxEngine
+{
+    partial class Navigation
+    {
+        /// <summary>
+        /// Finds the path between the two positions presented as a list of waypoints written into the caller-provided buffer. Doesn't allocate memory for the result (buffer is passed to the native code without copying).
+        /// </summary>
+        /// <param name="startPosition">The start position.</param>
+        /// <param name="endPosition">The end position.</param>
+        /// <param name="resultPath">The output buffer for the path waypoints. Longer paths are truncated.</param>
+        /// <param name="resultPathLength">The amount of waypoints written into the output buffer.</param>
+        /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
+        public static unsafe bool FindPath(Vector3 startPosition, Vector3 endPosition, Span<Vector3> resultPath, out int resultPathLength)
+        {
+            fixed (Vector3* resultPathPtr = resultPath)
+            {
+                return FindPath(startPosition, endPosition, resultPathPtr, resultPath.Length, out resultPathLength);
+            }
+        }
+    }
+
+    partial class NavMeshRuntime
+    {
+        /// <summary>
+        /// Finds the path between the two positions presented as a list of waypoints written into the caller-provided buffer. Doesn't allocate memory for the result (buffer is passed to the native code without copying).
+        /// </summary>
+        /// <param name="startPosition">The start position.</param>
+        /// <param name="endPosition">The end position.</param>
+        /// <param name="resultPath">The output buffer for the path waypoints. Longer paths are truncated.</param>
+        /// <param name="resultPathLength">The amount of waypoints written into the output buffer.</param>
+        /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
+        public unsafe bool FindPath(Vector3 startPosition, Vector3 endPosition, Span<Vector3> resultPath, out int resultPathLength)
+        {
+            fixed (Vector3* resultPathPtr = resultPath)
+            {
+                return FindPath(startPosition, endPosition, resultPathPtr, resultPath.Length, out resultPathLength);
+            }
+        }
+    }
+}
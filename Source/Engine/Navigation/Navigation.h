@@ -31,6 +31,46 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
     /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
     API_FUNCTION() static bool FindPath(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath);
 
+    /// <summary>
+    /// Finds the path between the two positions presented as a list of waypoints written into the caller-provided buffer (doesn't allocate the result array in scripting).
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <param name="resultPath">The output buffer for the path waypoints.</param>
+    /// <param name="resultPathCapacity">The size of the output buffer (in elements). Longer paths are truncated.</param>
+    /// <param name="resultPathLength">The amount of waypoints written into the output buffer.</param>
+    /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
+    API_FUNCTION() static bool FindPath(const Vector3& startPosition, const Vector3& endPosition, Vector3* resultPath, int32 resultPathCapacity, API_PARAM(Out) int32& resultPathLength);
+
+    /// <summary>
+    /// Requests the asynchronous path finding between the two positions. Queries are processed in the background by Job System within a time budget per frame (long paths are searched over multiple frames). Use GetPathQueryState to check the progress and GetPathQueryResult to get the path.
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <returns>The path query identifier, or 0 if failed.</returns>
+    API_FUNCTION() static uint32 FindPathAsync(const Vector3& startPosition, const Vector3& endPosition);
+
+    /// <summary>
+    /// Gets the state of the asynchronous path query.
+    /// </summary>
+    /// <param name="queryId">The path query identifier.</param>
+    /// <returns>The query state.</returns>
+    API_FUNCTION() static NavMeshPathQueryState GetPathQueryState(uint32 queryId);
+
+    /// <summary>
+    /// Gets the result of the completed asynchronous path query and releases it.
+    /// </summary>
+    /// <param name="queryId">The path query identifier.</param>
+    /// <param name="resultPath">The result path.</param>
+    /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed or query is still pending.</returns>
+    API_FUNCTION() static bool GetPathQueryResult(uint32 queryId, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath);
+
+    /// <summary>
+    /// Cancels the asynchronous path query (pending or completed) and releases it.
+    /// </summary>
+    /// <param name="queryId">The path query identifier.</param>
+    API_FUNCTION() static void CancelPathQuery(uint32 queryId);
+
     /// <summary>
     /// Tests the path between the two positions (non-partial).
     /// </summary>
@@ -84,6 +124,27 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool RayCast(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) NavMeshHit& hitInfo);
 
+public:
+    /// <summary>
+    /// Adds the dynamic obstacle to all navmeshes. Obstacles carve the navmesh at runtime by rebuilding only the affected tiles from the compressed heightfield layers (requires NavigationSettings.EnableDynamicObstacles).
+    /// </summary>
+    /// <param name="obstacle">The obstacle description.</param>
+    /// <returns>The obstacle identifier.</returns>
+    API_FUNCTION() static uint32 AddObstacle(API_PARAM(Ref) const NavMeshObstacle& obstacle);
+
+    /// <summary>
+    /// Updates the dynamic obstacle (eg. to move it).
+    /// </summary>
+    /// <param name="id">The obstacle identifier.</param>
+    /// <param name="obstacle">The obstacle description.</param>
+    API_FUNCTION() static void UpdateObstacle(uint32 id, API_PARAM(Ref) const NavMeshObstacle& obstacle);
+
+    /// <summary>
+    /// Removes the dynamic obstacle.
+    /// </summary>
+    /// <param name="id">The obstacle identifier.</param>
+    API_FUNCTION() static void RemoveObstacle(uint32 id);
+
 public:
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
@@ -97,6 +158,12 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
     /// </summary>
     API_PROPERTY() static float GetNavMeshBuildingProgress();
 
+    /// <summary>
+    /// Sets the locations (eg. players or agents positions in the world) used to prioritize the navmesh tiles building - tiles closer to any of the locations are built first. If empty, the main camera position is used.
+    /// </summary>
+    /// <param name="locations">The priority locations.</param>
+    API_FUNCTION() static void SetNavMeshBuildPriorityLocations(const Array<Vector3, HeapAllocation>& locations);
+
     /// <summary>
     /// Builds the Nav Mesh for the given scene (discards all its tiles).
     /// </summary>
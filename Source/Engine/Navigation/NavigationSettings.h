@@ -26,6 +26,42 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(110), EditorDisplay(\"Navigation\")")
     bool AutoRemoveMissingNavMeshes = true;
 
+    /// <summary>
+    /// The time budget (in milliseconds) for processing asynchronous path queries (see NavMeshRuntime.FindPathAsync) in a single frame. Queries not finished within the budget are continued in the next frames.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0.01f, 100), EditorOrder(120), EditorDisplay(\"Navigation\")")
+    float PathQueriesTimeBudget = 2.0f;
+
+    /// <summary>
+    /// The amount of search iterations of the asynchronous path query done at once (before checking the time budget). Lower values improve the time budget accuracy but add overhead.
+    /// </summary>
+    API_FIELD(Attributes="Limit(1, 4096), EditorOrder(130), EditorDisplay(\"Navigation\")")
+    int32 PathQueriesSliceIterations = 64;
+
+    /// <summary>
+    /// The maximum amount of path corridors cached per navmesh and reused by the path queries between the same start and end polygons (see NavMeshRuntime.FindPath). Cached corridors are invalidated when any of the tiles they pass through gets rebuilt. Use 0 to disable caching.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0, 65536), EditorOrder(135), EditorDisplay(\"Navigation\")")
+    int32 PathCacheSize = 0;
+
+    /// <summary>
+    /// The maximum amount of navmesh tiles built in parallel on the Job System threads (during navmesh building at runtime or in Editor). Use 0 to use half of the Job System threads.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0, 256), EditorOrder(140), EditorDisplay(\"Navigation\")")
+    int32 MaxTileBuildJobs = 0;
+
+    /// <summary>
+    /// If checked, navmesh building stores the compressed heightfield layers of the tiles (Detour tile cache) which allows to use dynamic obstacles (see Navigation.AddObstacle) that carve the navmesh at runtime without rebuilding tiles from the scene geometry. Tiles are built from the layers without the detail mesh (less accurate height). Requires TileSize below 250 (minus agent radius border).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(150), EditorDisplay(\"Navigation\")")
+    bool EnableDynamicObstacles = false;
+
+    /// <summary>
+    /// The maximum amount of dynamic obstacles per navmesh (moving obstacle uses an additional slot until its previous location update gets processed).
+    /// </summary>
+    API_FIELD(Attributes="Limit(1, 16384), EditorOrder(160), EditorDisplay(\"Navigation\")")
+    int32 MaxObstacles = 256;
+
 public:
     /// <summary>
     /// The height of a grid cell in the navigation mesh building steps using heightfields. A lower number means higher precision on the vertical axis but longer build times.
@@ -195,3 +195,67 @@ API_STRUCT() struct FLAXENGINE_API NavAreaProperties : ISerializable
         return !operator==(other);
     }
 };
+
+/// <summary>
+/// The asynchronous navigation mesh path query state.
+/// </summary>
+API_ENUM() enum class NavMeshPathQueryState
+{
+    // Unknown query or its result has been already taken.
+    Invalid,
+    // Query is waiting for processing or during processing.
+    Pending,
+    // Query found a valid path (it may be partial).
+    Completed,
+    // Query failed to find a path.
+    Failed,
+};
+
+/// <summary>
+/// The dynamic navigation obstacle shape types.
+/// </summary>
+API_ENUM() enum class NavMeshObstacleShape
+{
+    // Vertical cylinder (defined by the radius and height).
+    Cylinder,
+    // Box (defined by the extents, can be rotated around the up axis).
+    Box,
+};
+
+/// <summary>
+/// The dynamic navigation obstacle descriptor. Obstacles carve the navmesh at runtime without rebuilding tiles from the scene geometry (requires NavigationSettings.EnableDynamicObstacles).
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API NavMeshObstacle
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NavMeshObstacle);
+
+    /// <summary>
+    /// The obstacle shape.
+    /// </summary>
+    API_FIELD() NavMeshObstacleShape Shape = NavMeshObstacleShape::Cylinder;
+
+    /// <summary>
+    /// The obstacle position (in world space). Bottom center for the cylinder shape, center for the box shape.
+    /// </summary>
+    API_FIELD() Vector3 Position = Vector3::Zero;
+
+    /// <summary>
+    /// The obstacle orientation (in world space). Only rotation around the up axis is used (box shape only).
+    /// </summary>
+    API_FIELD() Quaternion Orientation = Quaternion::Identity;
+
+    /// <summary>
+    /// The cylinder radius.
+    /// </summary>
+    API_FIELD() float Radius = 50.0f;
+
+    /// <summary>
+    /// The cylinder height.
+    /// </summary>
+    API_FIELD() float Height = 200.0f;
+
+    /// <summary>
+    /// The box half-size.
+    /// </summary>
+    API_FIELD() Float3 Extents = Float3(50.0f);
+};
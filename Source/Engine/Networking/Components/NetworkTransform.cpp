@@ -4,20 +4,17 @@
 
 #include "NetworkTransform.h"
 #include "Engine/Core/Math/Transform.h"
-#include "Engine/Engine/Time.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Networking/NetworkManager.h"
-#include "Engine/Networking/NetworkPeer.h"
 #include "Engine/Networking/NetworkReplicator.h"
 #include "Engine/Networking/NetworkStream.h"
-#include "Engine/Networking/NetworkStats.h"
-#include "Engine/Networking/INetworkDriver.h"
 #include "Engine/Networking/NetworkRpc.h"
 
 PACK_STRUCT(struct Data
     {
     uint8 LocalSpace : 1;
     uint8 HasSequenceIndex : 1;
+    uint8 Quantized : 1;
     NetworkTransform::ReplicationComponents Components : 9;
     });
 
@@ -34,6 +31,95 @@ namespace
         const T targetDeltaMax = targetDelta.GetAbsolute().MaxValue();
         return targetDeltaMax > (T)ZeroTolerance && currentDelta.GetAbsolute().MaxValue() < targetDeltaMax * (T)Precision;
     }
+
+    // Bits per component of the quantized rotation (smallest-three) and euler angles (when replicating only some of rotation axes)
+    constexpr int32 RotationBits = 12;
+    constexpr int32 EulerBits = 16;
+
+    // Quantized position and scale precision is sent along the data as a multiple of this unit (so peers don't need to use the same settings)
+    constexpr float PrecisionUnit = 0.0001f;
+
+    float WritePrecision(NetworkStream* stream, float precision)
+    {
+        const uint32 steps = (uint32)Math::Max(Math::RoundToInt(precision / PrecisionUnit), 1);
+        stream->WriteVarUInt32(steps);
+        return (float)steps * PrecisionUnit;
+    }
+
+    float ReadPrecision(NetworkStream* stream)
+    {
+        return (float)Math::Max(stream->ReadVarUInt32(), 1u) * PrecisionUnit;
+    }
+
+    void WriteQuantized(NetworkStream* stream, NetworkTransform::ReplicationComponents components, const Transform& transform, float positionPrecision, float scalePrecision)
+    {
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::Position))
+            positionPrecision = WritePrecision(stream, positionPrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::Scale))
+            scalePrecision = WritePrecision(stream, scalePrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::PositionX))
+            stream->WriteFloatPrecision((float)transform.Translation.X, positionPrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::PositionY))
+            stream->WriteFloatPrecision((float)transform.Translation.Y, positionPrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::PositionZ))
+            stream->WriteFloatPrecision((float)transform.Translation.Z, positionPrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::ScaleX))
+            stream->WriteFloatPrecision(transform.Scale.X, scalePrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::ScaleY))
+            stream->WriteFloatPrecision(transform.Scale.Y, scalePrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::ScaleZ))
+            stream->WriteFloatPrecision(transform.Scale.Z, scalePrecision);
+        if (EnumHasAllFlags(components, NetworkTransform::ReplicationComponents::Rotation))
+        {
+            stream->WriteQuaternionQuantized(transform.Orientation, RotationBits);
+        }
+        else if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::Rotation))
+        {
+            const Float3 rotation = transform.Orientation.GetEuler();
+            if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::RotationX))
+                stream->WriteFloatQuantized(rotation.X, -360.0f, 360.0f, EulerBits);
+            if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::RotationY))
+                stream->WriteFloatQuantized(rotation.Y, -360.0f, 360.0f, EulerBits);
+            if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::RotationZ))
+                stream->WriteFloatQuantized(rotation.Z, -360.0f, 360.0f, EulerBits);
+        }
+    }
+
+    void ReadQuantized(NetworkStream* stream, NetworkTransform::ReplicationComponents components, Transform& transform)
+    {
+        float positionPrecision = PrecisionUnit, scalePrecision = PrecisionUnit;
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::Position))
+            positionPrecision = ReadPrecision(stream);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::Scale))
+            scalePrecision = ReadPrecision(stream);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::PositionX))
+            transform.Translation.X = stream->ReadFloatPrecision(positionPrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::PositionY))
+            transform.Translation.Y = stream->ReadFloatPrecision(positionPrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::PositionZ))
+            transform.Translation.Z = stream->ReadFloatPrecision(positionPrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::ScaleX))
+            transform.Scale.X = stream->ReadFloatPrecision(scalePrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::ScaleY))
+            transform.Scale.Y = stream->ReadFloatPrecision(scalePrecision);
+        if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::ScaleZ))
+            transform.Scale.Z = stream->ReadFloatPrecision(scalePrecision);
+        if (EnumHasAllFlags(components, NetworkTransform::ReplicationComponents::Rotation))
+        {
+            transform.Orientation = stream->ReadQuaternionQuantized(RotationBits);
+        }
+        else if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::Rotation))
+        {
+            Float3 rotation = transform.Orientation.GetEuler();
+            if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::RotationX))
+                rotation.X = stream->ReadFloatQuantized(-360.0f, 360.0f, EulerBits);
+            if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::RotationY))
+                rotation.Y = stream->ReadFloatQuantized(-360.0f, 360.0f, EulerBits);
+            if (EnumHasAnyFlags(components, NetworkTransform::ReplicationComponents::RotationZ))
+                rotation.Z = stream->ReadFloatQuantized(-360.0f, 360.0f, EulerBits);
+            transform.Orientation = Quaternion::Euler(rotation);
+        }
+    }
 }
 
 NetworkTransform::NetworkTransform(const SpawnParams& params)
@@ -56,6 +142,7 @@ void NetworkTransform::OnEnable()
     _currentSequenceIndex = 0;
     _lastFrameTransform = GetActor() ? GetActor()->GetTransform() : Transform::Identity;
     _buffer.Clear();
+    _snapshots.Clear();
 
     // Register for replication
     NetworkReplicator::AddObject(this);
@@ -67,6 +154,7 @@ void NetworkTransform::OnDisable()
     NetworkReplicator::RemoveObject(this);
 
     _buffer.Resize(0);
+    _snapshots.Clear();
 }
 
 void NetworkTransform::OnUpdate()
@@ -106,43 +194,10 @@ void NetworkTransform::OnUpdate()
     }
     else
     {
-        float lag = 0.0f;
-        // TODO: use lag from last used NetworkStream context
-        if (NetworkManager::Peer && NetworkManager::Peer->NetworkDriver)
-        {
-            // Use lag from the RTT between server and the client
-            const auto stats = NetworkManager::Peer->NetworkDriver->GetStats();
-            lag = stats.RTT / 2000.0f;
-        }
-        else
-        {
-            // Default lag is based on the network manager update rate
-            const float fps = NetworkManager::NetworkFPS;
-            lag = 1.0f / fps;
-        }
-
-        // Find the two authoritative positions surrounding the rendering timestamp
-        const float now = Time::Update.UnscaledTime.GetTotalSeconds();
-        const float gameTime = now - lag;
-
-        // Drop older positions
-        while (_buffer.Count() >= 2 && _buffer[1].Timestamp <= gameTime)
-            _buffer.RemoveAtKeepOrder(0);
-
-        // Interpolate between the two surrounding authoritative positions
-        if (_buffer.Count() >= 2 && _buffer[0].Timestamp <= gameTime && gameTime <= _buffer[1].Timestamp)
-        {
-            const auto& b0 = _buffer[0];
-            const auto& b1 = _buffer[1];
-            Transform transform;
-            const float alpha = (gameTime - b0.Timestamp) / (b1.Timestamp - b0.Timestamp);
-            Transform::Lerp(b0.Value, b1.Value, alpha, transform);
+        // Interpolate between the authoritative transforms surrounding the delayed playback time
+        Transform transform;
+        if (_snapshots.Sample(NetworkReplicator::GetInterpolationTime(), NetworkReplicator::ExtrapolationLimit, Transform::Lerp, transform))
             Set(transform);
-        }
-        else if (_buffer.Count() == 1 && _buffer[0].Timestamp <= gameTime)
-        {
-            Set(_buffer[0].Value);
-        }
     }
 }
 
@@ -159,9 +214,14 @@ void NetworkTransform::Serialize(NetworkStream* stream)
     Data data;
     data.LocalSpace = LocalSpace;
     data.HasSequenceIndex = Mode == ReplicationModes::Prediction;
+    data.Quantized = Quantize;
     data.Components = Components;
     stream->Write(data);
-    if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
+    if (data.Quantized)
+    {
+        WriteQuantized(stream, data.Components, transform, PositionPrecision, ScalePrecision);
+    }
+    else if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
     {
         stream->Write(transform);
     }
@@ -226,7 +286,11 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
     // Decode data
     Data data;
     stream->Read(data);
-    if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
+    if (data.Quantized)
+    {
+        ReadQuantized(stream, data.Components, transform);
+    }
+    else if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
     {
         stream->Read(transform);
     }
@@ -328,9 +392,8 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
     }
     else
     {
-        // Add to the interpolation buffer
-        const float now = Time::Update.UnscaledTime.GetTotalSeconds();
-        _buffer.Add({ now, 0, transform });
+        // Add to the interpolation buffer (timestamped with the owner frame to be evenly spaced regardless of the network jitter)
+        _snapshots.Add(NetworkReplicator::GetObjectSnapshotTime(this), transform);
         if (_bufferHasDeltas)
         {
             _buffer.Clear();
@@ -5,6 +5,7 @@
 #include "Engine/Scripting/Script.h"
 #include "Engine/Core/Math/Transform.h"
 #include "Engine/Networking/INetworkSerializable.h"
+#include "Engine/Networking/NetworkSnapshotBuffer.h"
 
 /// <summary>
 /// Actor script component that synchronizes the Transform over the network.
@@ -61,7 +62,7 @@ API_CLASS(Namespace="FlaxEngine.Networking", Attributes="Category(\"Flax Engine\
     {
         // The transform replicated from the owner (raw replication data messages that might result in sudden object jumps when moving).
         Default,
-        // The transform replicated from the owner with local interpolation between received data to provide smoother movement.
+        // The transform replicated from the owner with local interpolation between received data to provide smoother movement (see NetworkReplicator.InterpolationDelay and NetworkReplicator.ExtrapolationLimit).
         Interpolation,
         // The transform replicated from the owner but with local prediction (eg. player character that has local simulation but is validated against authoritative server).
         Prediction,
@@ -79,6 +80,7 @@ API_CLASS(Namespace="FlaxEngine.Networking", Attributes="Category(\"Flax Engine\
     uint16 _currentSequenceIndex = 0;
     Transform _lastFrameTransform;
     Array<BufferedItem> _buffer;
+    NetworkSnapshotBuffer<Transform> _snapshots;
 
 public:
     /// <summary>
@@ -99,6 +101,24 @@ API_CLASS(Namespace="FlaxEngine.Networking", Attributes="Category(\"Flax Engine\
     API_FIELD(Attributes="EditorOrder(30)")
     ReplicationModes Mode = ReplicationModes::Default;
 
+    /// <summary>
+    /// If checked, actor transform will be quantized and bit-packed for the replication (position and scale with a fixed precision, rotation as compressed quaternion). Reduces the bandwidth at cost of the precision. Precision values used by the sender are replicated along the data (rounded to 0.0001).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40)")
+    bool Quantize = true;
+
+    /// <summary>
+    /// The precision of the quantized position (in units). Used only when Quantize is enabled.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(41), Limit(0.0001f), VisibleIf(nameof(Quantize))")
+    float PositionPrecision = 0.1f;
+
+    /// <summary>
+    /// The precision of the quantized scale. Used only when Quantize is enabled.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(42), Limit(0.0001f), VisibleIf(nameof(Quantize))")
+    float ScalePrecision = 0.001f;
+
 private:
     API_FUNCTION(Hidden, NetworkRpc=Server) void SetSequenceIndex(uint16 value);
     
@@ -16,38 +16,48 @@
 #undef _WINSOCK_DEPRECATED_NO_WARNINGS
 #undef SendMessage
 
-ENetPacketFlag ChannelTypeToPacketFlag(const NetworkChannelType channel)
+namespace
 {
-    int flag = 0; // Maybe use ENET_PACKET_FLAG_NO_ALLOCATE?
-
-    // Add reliable flag when it is "reliable" channel
-    if (channel == NetworkChannelType::Reliable || channel == NetworkChannelType::ReliableOrdered)
-        flag |= ENET_PACKET_FLAG_RELIABLE;
-
-    // Use unsequenced flag when the flag is unreliable. We have to sequence all other packets.
-    if (channel == NetworkChannelType::Unreliable)
-        flag |= ENET_PACKET_FLAG_UNSEQUENCED;
+    // Type of the packet stored in the first byte of the packet data
+    enum class PacketType : uint8
+    {
+        // Single message
+        Message = 0,
+        // Multiple coalesced messages, each prefixed with uint16 size
+        Batch = 1,
+    };
 
-    // Note that all reliable channels are exactly the same. TODO: How to handle unordered reliable packets...?
+    // Maximum size of the coalesced messages packet (fits into a single datagram with ENet protocol headers)
+    constexpr uint32 BatchSize = ENET_HOST_DEFAULT_MTU - 64;
 
-    return static_cast<ENetPacketFlag>(flag);
+    // Packet flags of the batches per channel type
+    constexpr int BatchFlags[3] = { ENET_PACKET_FLAG_RELIABLE, ENET_PACKET_FLAG_UNSEQUENCED, 0 };
 }
 
-void SendPacketToPeer(ENetPeer* peer, const NetworkChannelType channelType, const NetworkMessage& message)
+int32 ChannelTypeToBatchIndex(const NetworkChannelType channel)
 {
-    // Covert our channel type to the internal ENet packet flags
-    const ENetPacketFlag flag = ChannelTypeToPacketFlag(channelType);
-
-    // This will copy the data into the packet when ENET_PACKET_FLAG_NO_ALLOCATE is not set.
-    // Tho, we cannot use it, because we're releasing the message right after the send - and the packet might not
-    // be sent, yet. To avoid data corruption, we're just using the copy method. We might fix that later, but I'll take
-    // the smaller risk.
-    ENetPacket* packet = enet_packet_create(message.Buffer, message.Length, flag);
+    // Note that all reliable channels are exactly the same
+    if (channel == NetworkChannelType::Reliable || channel == NetworkChannelType::ReliableOrdered)
+        return 0;
+    if (channel == NetworkChannelType::Unreliable)
+        return 1;
+    return 2;
+}
 
-    // And send it!
-    enet_peer_send(peer, 0, packet);
+ENetPacketFlag ChannelTypeToPacketFlag(const NetworkChannelType channel)
+{
+    // Reliable channels use reliable flag, unreliable channel uses unsequenced flag (all other packets are sequenced)
+    return static_cast<ENetPacketFlag>(BatchFlags[ChannelTypeToBatchIndex(channel)]);
+}
 
-    // TODO: To reduce latency, we can use `enet_host_flush` to flush all packets. Maybe some API, like NetworkManager::FlushQueues()?
+void SendBatch(ENetPeer* peer, int32 batchIndex, Array<byte>& batch)
+{
+    if (batch.IsEmpty())
+        return;
+    ENetPacket* packet = enet_packet_create(batch.Get(), batch.Count(), static_cast<ENetPacketFlag>(BatchFlags[batchIndex]));
+    if (enet_peer_send(peer, 0, packet) != 0)
+        enet_packet_destroy(packet);
+    batch.Clear();
 }
 
 ENetDriver::ENetDriver(const SpawnParams& params)
@@ -73,6 +83,12 @@ bool ENetDriver::Initialize(NetworkPeer* host, const NetworkConfig& config)
 
 void ENetDriver::Dispose()
 {
+    if (_receivedBatch)
+    {
+        enet_packet_destroy(_receivedBatch);
+        _receivedBatch = nullptr;
+    }
+    _batches.Clear();
     if (_peer)
         enet_peer_disconnect_now(_peer, 0);
     enet_host_destroy(_host);
@@ -143,6 +159,7 @@ void ENetDriver::Disconnect()
     {
         enet_peer_disconnect_now(_peer, 0);
         _peer = nullptr;
+        _batches.Clear();
         LOG(Info, "Disconnected");
     }
 }
@@ -155,6 +172,7 @@ void ENetDriver::Disconnect(const NetworkConnection& connection)
     {
         enet_peer_disconnect_now(peer, 0);
         _peerMap.Remove(connectionId);
+        _batches.Remove(peer);
     }
     else
     {
@@ -165,12 +183,23 @@ void ENetDriver::Disconnect(const NetworkConnection& connection)
 bool ENetDriver::PopEvent(NetworkEvent& eventPtr)
 {
     ASSERT(_host);
+
+    // Pop the remaining messages from the last received batch
+    if (PopBatchedMessage(eventPtr))
+        return true;
+
+    // Queue coalesced messages to be sent (ENet transmits queued packets when servicing the host)
+    FlushBatches();
+
     ENetEvent event;
-    const int result = enet_host_service(_host, &event, 0);
-    if (result < 0)
-        LOG(Error, "Failed to check ENet events!");
-    if (result > 0)
+    while (true)
     {
+        const int result = enet_host_service(_host, &event, 0);
+        if (result < 0)
+            LOG(Error, "Failed to check ENet events!");
+        if (result <= 0)
+            break;
+
         // Copy sender data
         const uint32 connectionId = enet_peer_get_id(event.peer);
         eventPtr.Sender.ConnectionId = connectionId;
@@ -186,18 +215,40 @@ bool ENetDriver::PopEvent(NetworkEvent& eventPtr)
             eventPtr.EventType = NetworkEventType::Disconnected;
             if (IsServer())
                 _peerMap.Remove(connectionId);
+            _batches.Remove(event.peer);
             break;
         case ENET_EVENT_TYPE_DISCONNECT_TIMEOUT:
             eventPtr.EventType = NetworkEventType::Timeout;
             if (IsServer())
                 _peerMap.Remove(connectionId);
+            _batches.Remove(event.peer);
             break;
         case ENET_EVENT_TYPE_RECEIVE:
+        {
+            ENetPacket* packet = event.packet;
+            if (packet->dataLength > 1 && packet->data[0] == (uint8)PacketType::Batch)
+            {
+                // Split batch into messages
+                _receivedBatch = packet;
+                _receivedBatchPosition = 1;
+                _receivedBatchSender = connectionId;
+                if (PopBatchedMessage(eventPtr))
+                    return true;
+                continue;
+            }
+            if (packet->dataLength < 1 || packet->data[0] != (uint8)PacketType::Message || packet->dataLength - 1 > _config.MessageSize)
+            {
+                LOG(Warning, "Invalid ENet packet of size {0} received from connection {1}.", (uint32)packet->dataLength, connectionId);
+                enet_packet_destroy(packet);
+                continue;
+            }
             eventPtr.EventType = NetworkEventType::Message;
             eventPtr.Message = _networkHost->CreateMessage();
-            eventPtr.Message.Length = event.packet->dataLength;
-            Platform::MemoryCopy(eventPtr.Message.Buffer, event.packet->data, event.packet->dataLength);
+            eventPtr.Message.Length = (uint32)packet->dataLength - 1;
+            Platform::MemoryCopy(eventPtr.Message.Buffer, packet->data + 1, eventPtr.Message.Length);
+            enet_packet_destroy(packet);
             break;
+        }
         default:
             break;
         }
@@ -213,7 +264,10 @@ bool ENetDriver::PopEvent(NetworkEvent& eventPtr)
 void ENetDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message)
 {
     ASSERT(!IsServer());
-    SendPacketToPeer(_peer, channelType, message);
+    ENetPacket* packet = nullptr;
+    Send(_peer, channelType, message, packet);
+    if (packet && packet->referenceCount == 0)
+        enet_packet_destroy(packet);
 }
 
 void ENetDriver::SendMessage(NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target)
@@ -222,7 +276,10 @@ void ENetDriver::SendMessage(NetworkChannelType channelType, const NetworkMessag
     ENetPeer* peer;
     if (_peerMap.TryGet(target.ConnectionId, peer) && peer && peer->state == ENET_PEER_STATE_CONNECTED)
     {
-        SendPacketToPeer(peer, channelType, message);
+        ENetPacket* packet = nullptr;
+        Send(peer, channelType, message, packet);
+        if (packet && packet->referenceCount == 0)
+            enet_packet_destroy(packet);
     }
 }
 
@@ -230,15 +287,95 @@ void ENetDriver::SendMessage(const NetworkChannelType channelType, const Network
 {
     ASSERT(IsServer());
     ENetPeer* peer;
+    ENetPacket* packet = nullptr; // Shared by all targets (ENet packets are reference-counted)
     for (NetworkConnection target : targets)
     {
         if (_peerMap.TryGet(target.ConnectionId, peer) && peer && peer->state == ENET_PEER_STATE_CONNECTED)
         {
-            SendPacketToPeer(peer, channelType, message);
+            Send(peer, channelType, message, packet);
+        }
+    }
+    if (packet && packet->referenceCount == 0)
+        enet_packet_destroy(packet);
+}
+
+void ENetDriver::Send(ENetPeer* peer, const NetworkChannelType channelType, const NetworkMessage& message, ENetPacket*& packet)
+{
+    const int32 batchIndex = ChannelTypeToBatchIndex(channelType);
+    if (Coalescing)
+    {
+        if (1 + sizeof(uint16) + message.Length <= BatchSize)
+        {
+            // Append small message to the batch
+            Array<byte>& batch = _batches[peer].Data[batchIndex];
+            if (batch.Count() + sizeof(uint16) + message.Length > BatchSize)
+                SendBatch(peer, batchIndex, batch);
+            if (batch.IsEmpty())
+                batch.Add((byte)PacketType::Batch);
+            const uint16 length = (uint16)message.Length;
+            batch.Add((const byte*)&length, sizeof(length));
+            batch.Add(message.Buffer, message.Length);
+            return;
         }
+
+        // Send batched messages before to keep the order
+        if (PeerBatches* batches = _batches.TryGet(peer))
+            SendBatch(peer, batchIndex, batches->Data[batchIndex]);
+    }
+
+    // Copy message data into the packet once and share it between all targets
+    if (!packet)
+    {
+        packet = enet_packet_create(nullptr, message.Length + 1, ChannelTypeToPacketFlag(channelType));
+        packet->data[0] = (uint8)PacketType::Message;
+        Platform::MemoryCopy(packet->data + 1, message.Buffer, message.Length);
+    }
+    enet_peer_send(peer, 0, packet);
+}
+
+void ENetDriver::FlushBatches()
+{
+    for (auto& e : _batches)
+    {
+        ENetPeer* peer = e.Key;
+        if (peer->state != ENET_PEER_STATE_CONNECTED)
+            continue;
+        for (int32 batchIndex = 0; batchIndex < ARRAY_COUNT(e.Value.Data); batchIndex++)
+            SendBatch(peer, batchIndex, e.Value.Data[batchIndex]);
     }
 }
 
+bool ENetDriver::PopBatchedMessage(NetworkEvent& eventPtr)
+{
+    if (!_receivedBatch)
+        return false;
+    const uint32 size = (uint32)_receivedBatch->dataLength;
+    const byte* data = _receivedBatch->data;
+    uint16 length = 0;
+    if (_receivedBatchPosition + sizeof(uint16) <= size)
+        Platform::MemoryCopy(&length, data + _receivedBatchPosition, sizeof(uint16));
+    if (_receivedBatchPosition + sizeof(uint16) + length > size || length > _config.MessageSize)
+    {
+        LOG(Warning, "Invalid ENet batch packet of size {0} received from connection {1}.", size, _receivedBatchSender);
+        enet_packet_destroy(_receivedBatch);
+        _receivedBatch = nullptr;
+        return false;
+    }
+    _receivedBatchPosition += sizeof(uint16);
+    eventPtr.EventType = NetworkEventType::Message;
+    eventPtr.Sender.ConnectionId = _receivedBatchSender;
+    eventPtr.Message = _networkHost->CreateMessage();
+    eventPtr.Message.Length = length;
+    Platform::MemoryCopy(eventPtr.Message.Buffer, data + _receivedBatchPosition, length);
+    _receivedBatchPosition += length;
+    if (_receivedBatchPosition >= size)
+    {
+        enet_packet_destroy(_receivedBatch);
+        _receivedBatch = nullptr;
+    }
+    return true;
+}
+
 NetworkDriverStats ENetDriver::GetStats()
 {
     return GetStats({ 0 });
@@ -6,6 +6,7 @@
 #include "Engine/Networking/INetworkDriver.h"
 #include "Engine/Networking/NetworkConnection.h"
 #include "Engine/Networking/NetworkConfig.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Scripting/ScriptingType.h"
@@ -16,6 +17,12 @@
 API_CLASS(Namespace="FlaxEngine.Networking", Sealed) class FLAXENGINE_API ENetDriver : public ScriptingObject, public INetworkDriver
 {
     DECLARE_SCRIPTING_TYPE(ENetDriver);
+public:
+    /// <summary>
+    /// Enables coalescing of the small messages sent to the same peer over the same channel type into a single packet (up to the MTU size). Reduces the amount of the packets and their headers overhead. Batched messages are sent within the next events update (together with the other queued packets).
+    /// </summary>
+    API_FIELD() bool Coalescing = true;
+
 public:
     // [INetworkDriver]
     String DriverName() override
@@ -42,10 +49,25 @@ API_CLASS(Namespace="FlaxEngine.Networking", Sealed) class FLAXENGINE_API ENetDr
         return _host != nullptr && _peer == nullptr;
     }
 
+    void Send(struct _ENetPeer* peer, NetworkChannelType channelType, const NetworkMessage& message, struct _ENetPacket*& packet);
+    void FlushBatches();
+    bool PopBatchedMessage(NetworkEvent& eventPtr);
+
 private:
     NetworkConfig _config;
     NetworkPeer* _networkHost;
     struct _ENetHost* _host = nullptr;
     struct _ENetPeer* _peer = nullptr;
     Dictionary<uint32, struct _ENetPeer*> _peerMap;
+
+    struct PeerBatches
+    {
+        // Batched messages data per channel type (reliable, unsequenced, sequenced)
+        Array<byte> Data[3];
+    };
+
+    Dictionary<struct _ENetPeer*, PeerBatches> _batches;
+    struct _ENetPacket* _receivedBatch = nullptr;
+    uint32 _receivedBatchPosition = 0;
+    uint32 _receivedBatchSender = 0;
 };
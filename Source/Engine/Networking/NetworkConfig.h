@@ -82,6 +82,13 @@ API_STRUCT(Namespace="FlaxEngine.Networking") struct FLAXENGINE_API NetworkConfi
     API_FIELD()
     uint16 MessagePoolSize = 2048;
 
+    /// <summary>
+    /// Enables the dedicated network thread that services the network driver (sends messages and polls events) continuously, independently of the game frame rate. Messages are exchanged with the game thread via lock-free queues.
+    /// </summary>
+    /// <remarks>Network driver methods are called from the network thread (except GetStats).</remarks>
+    API_FIELD()
+    bool UseThread = false;
+
     // Ignore deprecation warnings in defaults
     PRAGMA_DISABLE_DEPRECATION_WARNINGS
     NetworkConfig()
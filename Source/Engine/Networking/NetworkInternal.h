@@ -3,8 +3,11 @@
 #pragma once
 
 #include "Types.h"
+#include "Engine/Core/Collections/Array.h"
 #if COMPILE_WITH_PROFILER
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Scripting/ScriptingType.h"
 #endif
 
 enum class NetworkMessageIDs : uint8
@@ -19,6 +22,7 @@ enum class NetworkMessageIDs : uint8
     ObjectDespawn,
     ObjectRole,
     ObjectRpc,
+    ObjectReplicateAck,
 
     MAX,
 };
@@ -38,19 +42,31 @@ class NetworkInternal
     static void OnNetworkMessageObjectDespawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRole(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+    static void OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+
+    // Encodes the state as XOR against the baseline (of the same size) packed into a sequence of: zeros count, literals count, literal bytes. Returns true if state is the same as baseline.
+    static FLAXENGINE_API bool EncodeDelta(const byte* state, const byte* baseline, uint32 size, Array<byte>& output);
+
+    // Decodes the state encoded with EncodeDelta (output has the baseline size). Returns true if failed (eg. corrupted data).
+    static FLAXENGINE_API bool DecodeDelta(const byte* data, uint32 dataSize, const byte* baseline, uint32 baselineSize, Array<byte>& output);
 
 #if COMPILE_WITH_PROFILER
 
     struct ProfilerEvent
     {
-        uint16 Count = 0;
-        uint16 DataSize = 0;
-        uint16 MessageSize = 0;
-        uint16 Receivers = 0;
+        uint32 Count = 0;
+        uint32 DataSize = 0;
+        uint32 MessageSize = 0;
+        uint32 Receivers = 0;
+        uint32 Delta = 0;
+        uint32 Skipped = 0;
+        uint32 Deferred = 0;
+        uint32 ReceivedCount = 0;
+        uint32 ReceivedDataSize = 0;
     };
 
     /// <summary>
-    /// Enables network usage profiling tools. Captures network objects replication and RPCs send statistics.
+    /// Enables network usage profiling tools. Captures network objects replication and RPCs send and receive statistics (per type).
     /// </summary>
     static bool EnableProfiling;
 
@@ -13,11 +13,13 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Scripting/Scripting.h"
 
 #define NETWORK_PROTOCOL_VERSION 3
 
 float NetworkManager::NetworkFPS = 60.0f;
+uint32 NetworkManager::ClientBandwidth = 0;
 NetworkPeer* NetworkManager::Peer = nullptr;
 NetworkManagerMode NetworkManager::Mode = NetworkManagerMode::Offline;
 NetworkConnectionState NetworkManager::State = NetworkConnectionState::Offline;
@@ -135,6 +137,7 @@ namespace
         NetworkInternal::OnNetworkMessageObjectDespawn,
         NetworkInternal::OnNetworkMessageObjectRole,
         NetworkInternal::OnNetworkMessageObjectRpc,
+        NetworkInternal::OnNetworkMessageObjectReplicateAck,
     };
 }
 
@@ -188,6 +191,7 @@ bool StartPeer()
         return true;
     }
     networkConfig.NetworkDriver = ScriptingObject::NewObject(networkDriverType);
+    networkConfig.UseThread = settings.UseNetworkThread;
     NetworkManager::Peer = NetworkPeer::CreatePeer(networkConfig);
     if (!NetworkManager::Peer)
     {
@@ -214,6 +218,7 @@ void StopPeer()
 void NetworkSettings::Apply()
 {
     NetworkManager::NetworkFPS = NetworkFPS;
+    NetworkManager::ClientBandwidth = ClientBandwidth;
     GameProtocolVersion = ProtocolVersion;
 }
 
@@ -371,6 +376,7 @@ void NetworkManager::Stop()
 
 void NetworkManagerService::Update()
 {
+    PROFILE_MEM(Networking);
     const double currentTime = Time::Update.UnscaledTime.GetTotalSeconds();
     const float minDeltaTime = NetworkManager::NetworkFPS > 0 ? 1.0f / NetworkManager::NetworkFPS : 0.0f;
     auto peer = NetworkManager::Peer;
@@ -54,6 +54,11 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     /// </summary>
     API_FIELD() static float NetworkFPS;
 
+    /// <summary>
+    /// The maximum amount of bytes per second sent to a single client (or to the server when running as a client) by the objects replication. Objects with higher priority are sent first and the rest is deferred. Use 0 for unlimited bandwidth.
+    /// </summary>
+    API_FIELD() static uint32 ClientBandwidth;
+
     /// <summary>
     /// Current network peer (low-level).
     /// </summary>
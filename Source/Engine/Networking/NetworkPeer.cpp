@@ -7,6 +7,11 @@
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/ConcurrentQueue.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#if USE_CSHARP
+#include "Engine/Scripting/ManagedCLR/MCore.h"
+#endif
 
 Array<NetworkPeer*> NetworkPeer::Peers;
 
@@ -15,6 +20,31 @@ namespace
     uint32 LastHostId = 0;
 }
 
+struct NetworkPeerThread
+{
+    enum class CommandType
+    {
+        Send,
+        SendTarget,
+        SendTargets,
+        Disconnect,
+    };
+
+    struct Command
+    {
+        CommandType Type;
+        NetworkChannelType Channel;
+        NetworkMessage Message;
+        NetworkConnection Target;
+        Array<NetworkConnection> Targets;
+    };
+
+    Thread* IOThread = nullptr;
+    volatile int64 ExitFlag = 0;
+    ConcurrentQueue<Command> SendQueue; // Game thread -> network thread
+    ConcurrentQueue<NetworkEvent> ReceiveQueue; // Network thread -> game thread
+};
+
 bool NetworkPeer::Initialize(const NetworkConfig& config)
 {
     if (NetworkDriver)
@@ -75,6 +105,19 @@ bool NetworkPeer::Initialize(const NetworkConfig& config)
 
 void NetworkPeer::Shutdown()
 {
+    StopThread();
+    if (_thread)
+    {
+        // Release messages of the events that were not processed
+        NetworkEvent event;
+        while (_thread->ReceiveQueue.try_dequeue(event))
+        {
+            if (event.EventType == NetworkEventType::Message)
+                RecycleMessage(event.Message);
+        }
+        Delete(_thread);
+        _thread = nullptr;
+    }
     NetworkDriver->Dispose();
     Delete(Config.NetworkDriver);
     DisposeMessageBuffers();
@@ -110,36 +153,61 @@ void NetworkPeer::DisposeMessageBuffers()
 bool NetworkPeer::Listen()
 {
     LOG(Info, "Starting to listen on address = {0}:{1}", Config.Address, Config.Port);
-    return NetworkDriver->Listen();
+    const bool result = NetworkDriver->Listen();
+    if (result && Config.UseThread)
+        StartThread();
+    return result;
 }
 
 bool NetworkPeer::Connect()
 {
     LOG(Info, "Connecting to {0}:{1}...", Config.Address, Config.Port);
-    return NetworkDriver->Connect();
+    const bool result = NetworkDriver->Connect();
+    if (result && Config.UseThread)
+        StartThread();
+    return result;
 }
 
 void NetworkPeer::Disconnect()
 {
     LOG(Info, "Disconnecting...");
+    StopThread();
     NetworkDriver->Disconnect();
 }
 
 void NetworkPeer::Disconnect(const NetworkConnection& connection)
 {
     LOG(Info, "Disconnecting connection with id = {0}...", connection.ConnectionId);
+    if (_thread && _thread->IOThread)
+    {
+        NetworkPeerThread::Command command;
+        command.Type = NetworkPeerThread::CommandType::Disconnect;
+        command.Target = connection;
+        _thread->SendQueue.enqueue(MoveTemp(command));
+        return;
+    }
     NetworkDriver->Disconnect(connection);
 }
 
 bool NetworkPeer::PopEvent(NetworkEvent& eventRef)
 {
     PROFILE_CPU();
+    if (_thread)
+    {
+        // Pop events received by the network thread
+        if (_thread->ReceiveQueue.try_dequeue(eventRef))
+            return true;
+        if (_thread->IOThread)
+            return false;
+    }
     return NetworkDriver->PopEvent(eventRef);
 }
 
 NetworkMessage NetworkPeer::CreateMessage()
 {
+    MessagePoolLocker.Lock();
     const uint32 messageId = MessagePool.Pop();
+    MessagePoolLocker.Unlock();
     uint8* messageBuffer = GetMessageBuffer(messageId);
     return NetworkMessage(messageBuffer, messageId, Config.MessageSize, 0, 0);
 }
@@ -147,6 +215,7 @@ NetworkMessage NetworkPeer::CreateMessage()
 void NetworkPeer::RecycleMessage(const NetworkMessage& message)
 {
     ASSERT(message.IsValid());
+    ScopeLock lock(MessagePoolLocker);
 #ifdef BUILD_DEBUG
     ASSERT(MessagePool.Contains(message.MessageId) == false);
 #endif
@@ -170,6 +239,17 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
+    if (_thread && _thread->IOThread)
+    {
+        // Send on the network thread (message gets recycled after sending)
+        NetworkPeerThread::Command command;
+        command.Type = NetworkPeerThread::CommandType::Send;
+        command.Channel = channelType;
+        command.Message = message;
+        _thread->SendQueue.enqueue(MoveTemp(command));
+        return false;
+    }
+
     NetworkDriver->SendMessage(channelType, message);
 
     RecycleMessage(message);
@@ -180,6 +260,18 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
+    if (_thread && _thread->IOThread)
+    {
+        // Send on the network thread (message gets recycled after sending)
+        NetworkPeerThread::Command command;
+        command.Type = NetworkPeerThread::CommandType::SendTarget;
+        command.Channel = channelType;
+        command.Message = message;
+        command.Target = target;
+        _thread->SendQueue.enqueue(MoveTemp(command));
+        return false;
+    }
+
     NetworkDriver->SendMessage(channelType, message, target);
 
     RecycleMessage(message);
@@ -190,12 +282,91 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
+    if (_thread && _thread->IOThread)
+    {
+        // Send on the network thread (message gets recycled after sending)
+        NetworkPeerThread::Command command;
+        command.Type = NetworkPeerThread::CommandType::SendTargets;
+        command.Channel = channelType;
+        command.Message = message;
+        command.Targets = targets;
+        _thread->SendQueue.enqueue(MoveTemp(command));
+        return false;
+    }
+
     NetworkDriver->SendMessage(channelType, message, targets);
 
     RecycleMessage(message);
     return false;
 }
 
+void NetworkPeer::StartThread()
+{
+    if (!_thread)
+        _thread = New<NetworkPeerThread>();
+    if (_thread->IOThread)
+        return;
+    _thread->ExitFlag = 0;
+    Function<int32()> f;
+    f.Bind<NetworkPeer, &NetworkPeer::RunThread>(this);
+    _thread->IOThread = ThreadSpawner::Start(f, String::Format(TEXT("Network Peer {0}"), HostId), ThreadPriority::AboveNormal);
+    if (!_thread->IOThread)
+        LOG(Error, "Failed to start network thread");
+}
+
+void NetworkPeer::StopThread()
+{
+    if (!_thread || !_thread->IOThread)
+        return;
+    Platform::AtomicStore(&_thread->ExitFlag, 1);
+    _thread->IOThread->Join();
+    Delete(_thread->IOThread);
+    _thread->IOThread = nullptr;
+}
+
+int32 NetworkPeer::RunThread()
+{
+#if USE_CSHARP
+    MCore::Thread::Attach();
+#endif
+    NetworkEvent event;
+    while (Platform::AtomicRead(&_thread->ExitFlag) == 0)
+    {
+        ProcessThreadCommands();
+        while (NetworkDriver->PopEvent(event))
+            _thread->ReceiveQueue.enqueue(event);
+        Platform::Sleep(1);
+    }
+
+    // Send the remaining messages
+    ProcessThreadCommands();
+    return 0;
+}
+
+void NetworkPeer::ProcessThreadCommands()
+{
+    NetworkPeerThread::Command command;
+    while (_thread->SendQueue.try_dequeue(command))
+    {
+        switch (command.Type)
+        {
+        case NetworkPeerThread::CommandType::Send:
+            NetworkDriver->SendMessage(command.Channel, command.Message);
+            break;
+        case NetworkPeerThread::CommandType::SendTarget:
+            NetworkDriver->SendMessage(command.Channel, command.Message, command.Target);
+            break;
+        case NetworkPeerThread::CommandType::SendTargets:
+            NetworkDriver->SendMessage(command.Channel, command.Message, command.Targets);
+            break;
+        case NetworkPeerThread::CommandType::Disconnect:
+            NetworkDriver->Disconnect(command.Target);
+            continue;
+        }
+        RecycleMessage(command.Message);
+    }
+}
+
 NetworkPeer* NetworkPeer::CreatePeer(const NetworkConfig& config)
 {
     // Validate the address for listen/connect
@@ -5,6 +5,7 @@
 #include "Types.h"
 #include "NetworkConfig.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 
@@ -24,6 +25,7 @@ API_CLASS(sealed, NoSpawn, Namespace = "FlaxEngine.Networking") class FLAXENGINE
 
     uint8* MessageBuffer = nullptr;
     Array<uint32, HeapAllocation> MessagePool;
+    CriticalSection MessagePoolLocker;
 
 public:
     /// <summary>
@@ -168,8 +170,14 @@ API_CLASS(sealed, NoSpawn, Namespace = "FlaxEngine.Networking") class FLAXENGINE
     }
 
 private:
+    struct NetworkPeerThread* _thread = nullptr;
+
     bool Initialize(const NetworkConfig& config);
     void Shutdown();
     void CreateMessageBuffers();
     void DisposeMessageBuffers();
+    void StartThread();
+    void StopThread();
+    int32 RunThread();
+    void ProcessThreadCommands();
 };
@@ -117,14 +117,14 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
             {
                 // Marked as dirty to sync manually
                 obj.ReplicationUpdatesLeft = 0;
-                result->AddObject(obj.Object);
+                result->AddObject(obj.Object, NetworkClientsMask::All, obj.Priority);
             }
             continue;
         }
         else if (obj.ReplicationFPS < ZeroTolerance) // == 0
         {
             // Always relevant
-            result->AddObject(obj.Object);
+            result->AddObject(obj.Object, NetworkClientsMask::All, obj.Priority);
         }
         else if (obj.ReplicationUpdatesLeft > 0)
         {
@@ -160,7 +160,7 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
             if (targetClients && obj.Object)
             {
                 // Replicate this frame
-                result->AddObject(obj.Object, targetClients);
+                result->AddObject(obj.Object, targetClients, obj.Priority);
             }
 
             // Calculate frames until next replication
@@ -24,6 +24,8 @@ API_STRUCT(NoDefault, Namespace = "FlaxEngine.Networking") struct FLAXENGINE_API
     API_FIELD() float ReplicationFPS = 60;
     // The minimum distance from the player to the object at which it can process replication. For example, players further away won't receive object data. Use 0 if unused.
     API_FIELD() float CullDistance = 15000;
+    // The replication priority of the object. Used when the bandwidth per client is limited (see NetworkManager::ClientBandwidth) to send more important objects first. Priority is accumulated over time until the object gets sent so low-priority objects are not starved.
+    API_FIELD() float Priority = 1.0f;
     // Runtime value for update frames left for the next replication of this object. Matches NetworkManager::NetworkFPS calculated from ReplicationFPS. Set to 1 if ReplicationFPS less than 0 to indicate dirty object.
     API_FIELD(Attributes="HideInEditor") uint16 ReplicationUpdatesLeft = 0;
 
@@ -127,6 +129,8 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     {
         ScriptingObject* Object;
         NetworkClientsMask TargetClients;
+        float Priority;
+        float Score;
     };
 
     bool _clientsHaveLocation;
@@ -146,14 +150,16 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = NetworkClientsMask::All;
+        e.Priority = 1.0f;
     }
 
-    // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client). Mask matches NetworkManager::Clients.
-    API_FUNCTION() void AddObject(ScriptingObject* obj, NetworkClientsMask targetClients)
+    // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client). Mask matches NetworkManager::Clients. Priority is used to order objects when the bandwidth is limited.
+    API_FUNCTION() void AddObject(ScriptingObject* obj, NetworkClientsMask targetClients, float priority = 1.0f)
     {
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = targetClients;
+        e.Priority = priority;
     }
 
     // Gets amount of the clients to use. Matches NetworkManager::Clients.
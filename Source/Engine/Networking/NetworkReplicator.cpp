@@ -9,24 +9,30 @@
 #include "NetworkPeer.h"
 #include "NetworkChannelType.h"
 #include "NetworkEvent.h"
+#include "NetworkStats.h"
 #include "NetworkRpc.h"
 #include "INetworkSerializable.h"
 #include "INetworkObject.h"
 #include "NetworkReplicationHierarchy.h"
-#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/FlatHashSet.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Collections/ChunkedArray.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/SceneObject.h"
 #include "Engine/Level/Prefabs/Prefab.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerCounters.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/ThreadLocal.h"
 #if USE_EDITOR
@@ -43,6 +49,18 @@ bool NetworkReplicator::EnableLog = false;
 #define NETWORK_REPLICATOR_LOG(messageType, format, ...)
 #endif
 
+bool NetworkReplicator::EnableDeltaReplication = true;
+bool NetworkReplicator::EnableParallelSerialization = true;
+float NetworkReplicator::InterpolationDelay = 0.1f;
+float NetworkReplicator::ExtrapolationLimit = 0.25f;
+bool NetworkReplicator::EnableStats = false;
+
+// Amount of the recently replicated states kept per object to be used as a delta compression baseline (has to cover the acknowledgement round-trip)
+#define NETWORK_REPLICATOR_BASELINES 16
+
+// Minimum amount of objects with thread-safe serializers to replicate within a single update to serialize them in parallel
+#define NETWORK_REPLICATOR_PARALLEL_MIN_OBJECTS 32
+
 #if COMPILE_WITH_PROFILER
 bool NetworkInternal::EnableProfiling = false;
 Dictionary<Pair<ScriptingTypeHandle, StringAnsiView>, NetworkInternal::ProfilerEvent> NetworkInternal::ProfilerEvents;
@@ -52,6 +70,7 @@ PACK_STRUCT(struct NetworkMessageObjectReplicate
     {
     NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicate;
     uint32 OwnerFrame;
+    uint32 BaselineFrame; // Frame of the state (acknowledged by receiver) used as a base for the delta-encoded data, 0 if data contains the full state
     Guid ObjectId; // TODO: introduce networked-ids to synchronize unique ids as ushort (less data over network)
     Guid ParentId;
     char ObjectTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
@@ -63,6 +82,7 @@ PACK_STRUCT(struct NetworkMessageObjectReplicatePart
     {
     NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicatePart;
     uint32 OwnerFrame;
+    uint32 BaselineFrame;
     uint16 DataSize;
     uint16 PartsCount;
     uint16 PartStart;
@@ -119,6 +139,120 @@ PACK_STRUCT(struct NetworkMessageObjectRpc
     uint16 ArgsSize;
     });
 
+PACK_STRUCT(struct NetworkMessageObjectReplicateAck
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicateAck;
+    uint16 ItemsCount;
+    });
+
+PACK_STRUCT(struct NetworkMessageObjectReplicateAckItem
+    {
+    Guid ObjectId;
+    uint32 OwnerFrame;
+    });
+
+struct ReplicationBaseline
+{
+    uint32 Frame = 0;
+    Array<byte> Data;
+};
+
+struct ReplicationClientBaseline
+{
+    uint32 ClientId;
+    uint32 AckedFrame;
+    uint32 SentFrame;
+};
+
+struct ReplicationStates
+{
+    int32 Next = 0;
+    ReplicationBaseline States[NETWORK_REPLICATOR_BASELINES];
+
+    void Reset()
+    {
+        Next = 0;
+        for (auto& e : States)
+            e.Frame = 0;
+    }
+
+    const ReplicationBaseline* Find(uint32 frame) const
+    {
+        if (frame == 0)
+            return nullptr;
+        for (const auto& e : States)
+        {
+            if (e.Frame == frame)
+                return &e;
+        }
+        return nullptr;
+    }
+
+    void Add(uint32 frame, const byte* data, uint32 size)
+    {
+        // Reuse the oldest slot (and its memory)
+        ReplicationBaseline* state = (ReplicationBaseline*)Find(frame);
+        if (!state)
+        {
+            state = &States[Next];
+            Next = (Next + 1) % NETWORK_REPLICATOR_BASELINES;
+        }
+        state->Frame = frame;
+        state->Data.Set(data, (int32)size);
+    }
+};
+
+// Recently replicated states of the object used for delta compression. Sent states are referenced by the receivers via the acknowledged frame, received states are used to decode incoming deltas (server can do both when relaying client-owned objects).
+struct ReplicationBaselines
+{
+    uint32 OwnerClientId = MAX_uint32;
+    ReplicationStates Sent;
+    ReplicationStates Received;
+    Array<ReplicationClientBaseline, InlinedAllocation<4>> Clients;
+
+    void Reset(uint32 ownerClientId)
+    {
+        OwnerClientId = ownerClientId;
+        Sent.Reset();
+        Received.Reset();
+        Clients.Clear();
+    }
+
+    ReplicationClientBaseline& GetClient(uint32 clientId)
+    {
+        for (auto& e : Clients)
+        {
+            if (e.ClientId == clientId)
+                return e;
+        }
+        auto& e = Clients.AddOne();
+        e.ClientId = clientId;
+        e.AckedFrame = 0;
+        e.SentFrame = 0;
+        return e;
+    }
+};
+
+struct ReplicationTarget
+{
+    NetworkConnection Connection;
+    uint32 BaselineFrame;
+};
+
+struct ReplicationAck
+{
+    uint32 ClientId;
+    Guid ObjectId;
+    uint32 OwnerFrame;
+};
+
+struct ReplicationDeferred
+{
+    Guid ObjectId;
+    NetworkClientsMask TargetClients;
+    float Priority;
+};
+
 struct NetworkReplicatedObject
 {
     ScriptingObjectReference<ScriptingObject> Object;
@@ -131,6 +265,9 @@ struct NetworkReplicatedObject
     uint8 Synced : 1;
     DataContainer<uint32> TargetClientIds;
     INetworkObject* AsNetworkObject;
+    ReplicationBaselines* Baselines = nullptr;
+    float PriorityAccumulator = 0.0f;
+    float SnapshotTime = 0.0f;
 
     NetworkReplicatedObject()
     {
@@ -168,6 +305,20 @@ struct Serializer
 {
     NetworkReplicator::SerializeFunc Methods[2];
     void* Tags[2];
+    bool ThreadSafe;
+};
+
+struct ReplicationJob
+{
+    ScriptingObject* Object;
+    Guid ObjectId;
+    NetworkReplicator::SerializeFunc Serialize;
+    void* Tag;
+    NetworkStream* Stream;
+    uint32 DataStart;
+    uint32 DataSize;
+    int32 TargetsStart;
+    int32 TargetsCount;
 };
 
 struct ReplicateItem
@@ -176,6 +327,7 @@ struct ReplicateItem
     Guid ObjectId;
     uint16 PartsLeft;
     uint32 OwnerFrame;
+    uint32 BaselineFrame;
     uint32 OwnerClientId;
     Array<byte> Data;
 };
@@ -219,7 +371,7 @@ struct RpcItem
 namespace
 {
     CriticalSection ObjectsLock;
-    HashSet<NetworkReplicatedObject> Objects;
+    FlatHashSet<NetworkReplicatedObject> Objects;
     Array<ReplicateItem> ReplicationParts;
     Array<SpawnItemParts> SpawnParts;
     Array<SpawnItem> SpawnQueue;
@@ -232,12 +384,29 @@ namespace
     NetworkReplicationHierarchy* Hierarchy = nullptr;
     Array<NetworkClient*> NewClients;
     Array<NetworkConnection> CachedTargets;
+    CriticalSection SerializersLock;
     Dictionary<ScriptingTypeHandle, Serializer> SerializersTable;
 #if !COMPILE_WITHOUT_CSHARP
     Dictionary<StringAnsiView, StringAnsi*> CSharpCachedNames;
 #endif
     Array<Guid> DespawnedObjects;
     uint32 SpawnId = 0;
+    Array<ReplicationBaselines*> BaselinesPool;
+    Array<ReplicationAck> PendingAcks;
+    Array<ReplicationTarget, InlinedAllocation<8>> CachedReplicationTargets;
+    Array<byte> CachedDeltaBuffer;
+    Dictionary<uint32, float> ClientBandwidthBudgets;
+    Array<ReplicationDeferred> DeferredReplication;
+    double LastBandwidthUpdateTime = 0.0;
+    Array<ReplicationJob> ReplicationJobs;
+    Array<NetworkConnection> ReplicationJobsTargets;
+    Array<int32> ReplicationJobsParallel;
+    int32 ReplicationJobsBatchSize = 1;
+    ThreadLocal<NetworkStream*> ReplicationStreams;
+    Dictionary<uint32, double> SnapshotClocks;
+    bool StatsActive = false;
+    NetworkReplicationStats ReplicationStats, LastReplicationStats;
+    Dictionary<uint32, NetworkReplicationStats> ClientStats, LastClientStats;
 
 #if USE_EDITOR
     void OnScriptsReloading()
@@ -253,11 +422,13 @@ namespace
 
         // Clear any references to non-engine scripts before code hot-reload
         BinaryModule* flaxModule = GetBinaryModuleFlaxEngine();
+        SerializersLock.Lock();
         for (auto i = SerializersTable.Begin(); i.IsNotEnd(); ++i)
         {
             if (i->Key.Module != flaxModule)
                 SerializersTable.Remove(i);
         }
+        SerializersLock.Unlock();
         for (auto i = NetworkRpcInfo::RPCsTable.Begin(); i.IsNotEnd(); ++i)
         {
             if (i->Key.First.Module != flaxModule)
@@ -281,6 +452,7 @@ class NetworkReplicationService : public EngineService
 
 bool NetworkReplicationService::Init()
 {
+    PROFILE_LOCK(ObjectsLock, "NetworkReplicator::ObjectsLock");
 #if USE_EDITOR
     Scripting::ScriptsReloading.Bind(OnScriptsReloading);
 #endif
@@ -473,6 +645,62 @@ FORCE_INLINE void GetNetworkName(char buffer[128], const StringAnsiView& name)
     buffer[name.Length()] = 0;
 }
 
+void ConsumeBandwidth(bool isClient, uint32 bytes)
+{
+    // Budget is allowed to go negative (single message can exceed it) and the debt is repaid by the deferred replication in the next updates
+    if (NetworkManager::ClientBandwidth == 0 || bytes == 0)
+        return;
+    if (isClient)
+    {
+        ClientBandwidthBudgets[NetworkManager::ServerClientId] -= (float)bytes;
+        return;
+    }
+    for (const NetworkConnection& connection : CachedTargets)
+    {
+        if (const NetworkClient* client = NetworkManager::GetClient(connection))
+            ClientBandwidthBudgets[client->ClientId] -= (float)bytes;
+    }
+}
+
+FORCE_INLINE void RecordStats(uint32 clientId, uint32 NetworkReplicationStats::* counter, uint32 value)
+{
+    if (!StatsActive)
+        return;
+    ReplicationStats.*counter += value;
+    ClientStats[clientId].*counter += value;
+}
+
+void RecordStatsSent(bool isClient, uint32 NetworkReplicationStats::* counter, uint32 value)
+{
+    // Counted for each receiver from CachedTargets
+    if (!StatsActive)
+        return;
+    if (isClient)
+    {
+        RecordStats(NetworkManager::ServerClientId, counter, value);
+        return;
+    }
+    for (const NetworkConnection& connection : CachedTargets)
+    {
+        if (const NetworkClient* client = NetworkManager::GetClient(connection))
+            RecordStats(client->ClientId, counter, value);
+    }
+}
+
+void RecordDataSent(bool isClient, uint32 bytes, NetworkChannelType channel)
+{
+    ConsumeBandwidth(isClient, bytes);
+    const bool reliable = channel == NetworkChannelType::Reliable || channel == NetworkChannelType::ReliableOrdered;
+    RecordStatsSent(isClient, reliable ? &NetworkReplicationStats::DataSentReliable : &NetworkReplicationStats::DataSentUnreliable, bytes);
+}
+
+FORCE_INLINE void RecordMessageReceived(const NetworkEvent& event, const NetworkClient* client)
+{
+    const uint32 clientId = client ? client->ClientId : NetworkManager::ServerClientId;
+    RecordStats(clientId, &NetworkReplicationStats::DataReceived, event.Message.Length);
+    RecordStats(clientId, &NetworkReplicationStats::MessagesReceived, 1);
+}
+
 void SetupObjectSpawnMessageItem(SpawnItem* e, NetworkMessage& msg)
 {
     ScriptingObject* obj = e->Object.Get();
@@ -522,8 +750,10 @@ void SendObjectSpawnMessage(const SpawnGroup& group, const Array<NetworkClient*>
     msgData.OwnerSpawnId = ++SpawnId;
     msgData.UseParts = msg.BufferSize - msg.Position < group.Items.Count() * sizeof(NetworkMessageObjectSpawnItem);
     msg.WriteStructure(msgData);
+    uint32 messageSize = 0;
     if (msgData.UseParts)
     {
+        messageSize += msg.Length;
         if (isClient)
             peer->EndSendMessage(NetworkChannelType::Reliable, msg);
         else
@@ -548,6 +778,7 @@ void SendObjectSpawnMessage(const SpawnGroup& group, const Array<NetworkClient*>
                 itemIndex++;
             }
 
+            messageSize += msg.Length;
             if (isClient)
                 peer->EndSendMessage(NetworkChannelType::Reliable, msg);
             else
@@ -559,11 +790,13 @@ void SendObjectSpawnMessage(const SpawnGroup& group, const Array<NetworkClient*>
         // Send all spawn items within the spawn message
         for (SpawnItem* e : group.Items)
             SetupObjectSpawnMessageItem(e, msg);
+        messageSize += msg.Length;
         if (isClient)
             peer->EndSendMessage(NetworkChannelType::Reliable, msg);
         else
             peer->EndSendMessage(NetworkChannelType::Reliable, msg, CachedTargets);
     }
+    RecordDataSent(isClient, messageSize, NetworkChannelType::Reliable);
 }
 
 void SendObjectRoleMessage(const NetworkReplicatedObject& item, const NetworkClient* excludedClient = nullptr)
@@ -695,6 +928,132 @@ FORCE_INLINE void DirtyObjectImpl(NetworkReplicatedObject& item, ScriptingObject
         Hierarchy->DirtyObject(obj);
 }
 
+ReplicationBaselines* GetBaselines(NetworkReplicatedObject& item)
+{
+    if (!item.Baselines)
+    {
+        item.Baselines = BaselinesPool.HasItems() ? BaselinesPool.Pop() : New<ReplicationBaselines>();
+        item.Baselines->Reset(item.OwnerClientId);
+    }
+    else if (item.Baselines->OwnerClientId != item.OwnerClientId)
+    {
+        // Ownership changed so old states are no longer valid
+        item.Baselines->Reset(item.OwnerClientId);
+    }
+    return item.Baselines;
+}
+
+FORCE_INLINE void FreeBaselines(NetworkReplicatedObject& item)
+{
+    if (item.Baselines)
+    {
+        BaselinesPool.Add(item.Baselines);
+        item.Baselines = nullptr;
+    }
+}
+
+FORCE_INLINE void WriteVarUInt(Array<byte>& output, uint32 value)
+{
+    while (value >= 0x80)
+    {
+        output.Add((byte)(value | 0x80));
+        value >>= 7;
+    }
+    output.Add((byte)value);
+}
+
+FORCE_INLINE bool ReadVarUInt(const byte*& ptr, const byte* end, uint32& value)
+{
+    value = 0;
+    for (int32 shift = 0; shift < 35; shift += 7)
+    {
+        if (ptr >= end)
+            return true;
+        const byte b = *ptr++;
+        value |= (uint32)(b & 0x7f) << shift;
+        if ((b & 0x80) == 0)
+            return false;
+    }
+    return true;
+}
+
+bool NetworkInternal::EncodeDelta(const byte* state, const byte* baseline, uint32 size, Array<byte>& output)
+{
+    output.Clear();
+    uint32 pos = 0;
+    bool same = true;
+    while (pos < size)
+    {
+        // Unchanged bytes
+        uint32 zeros = 0;
+        while (pos + zeros < size && state[pos + zeros] == baseline[pos + zeros])
+            zeros++;
+        pos += zeros;
+        if (pos == size)
+        {
+            if (!same)
+                WriteVarUInt(output, zeros);
+            break;
+        }
+        same = false;
+
+        // Changed bytes (short runs of unchanged bytes are included to reduce the amount of tokens)
+        uint32 literals = 0;
+        while (pos + literals < size)
+        {
+            if (state[pos + literals] == baseline[pos + literals] &&
+                (pos + literals + 1 >= size || state[pos + literals + 1] == baseline[pos + literals + 1]) &&
+                (pos + literals + 2 >= size || state[pos + literals + 2] == baseline[pos + literals + 2]))
+                break;
+            literals++;
+        }
+        WriteVarUInt(output, zeros);
+        WriteVarUInt(output, literals);
+        const int32 start = output.Count();
+        output.AddUninitialized((int32)literals);
+        byte* dst = output.Get() + start;
+        for (uint32 i = 0; i < literals; i++)
+            dst[i] = state[pos + i] ^ baseline[pos + i];
+        pos += literals;
+    }
+    return same;
+}
+
+bool NetworkInternal::DecodeDelta(const byte* data, uint32 dataSize, const byte* baseline, uint32 baselineSize, Array<byte>& output)
+{
+    const byte* ptr = data;
+    const byte* end = data + dataSize;
+    const uint32 size = baselineSize;
+    const byte* base = baseline;
+    output.Resize((int32)size, false);
+    byte* dst = output.Get();
+    if (dataSize == 0)
+    {
+        // State is the same as baseline
+        Platform::MemoryCopy(dst, base, size);
+        return false;
+    }
+    uint32 pos = 0;
+    while (pos < size)
+    {
+        uint32 zeros;
+        if (ReadVarUInt(ptr, end, zeros) || zeros > size - pos)
+            return true;
+        Platform::MemoryCopy(dst + pos, base + pos, zeros);
+        pos += zeros;
+        if (pos == size)
+            break;
+        uint32 literals;
+        if (ReadVarUInt(ptr, end, literals) || literals > size - pos || literals > (uint32)(end - ptr))
+            return true;
+        for (uint32 i = 0; i < literals; i++)
+            dst[pos + i] = base[pos + i] ^ ptr[i];
+        ptr += literals;
+        pos += literals;
+    }
+    return ptr != end;
+}
+
 template<typename MessageType>
 ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& msgData, uint16 partStart, uint16 partSize, uint32 senderClientId)
 {
@@ -716,6 +1075,7 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
         replicateItem->ObjectId = msgData.ObjectId;
         replicateItem->PartsLeft = msgData.PartsCount;
         replicateItem->OwnerFrame = msgData.OwnerFrame;
+        replicateItem->BaselineFrame = msgData.BaselineFrame;
         replicateItem->OwnerClientId = senderClientId;
         replicateItem->Data.Resize(msgData.DataSize);
     }
@@ -730,11 +1090,40 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
     return replicateItem;
 }
 
-void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, byte* data, uint32 dataSize, uint32 senderClientId)
+float GetSnapshotTime(uint32 ownerFrame, uint32 senderClientId)
+{
+    const double now = Time::Update.UnscaledTime.GetTotalSeconds();
+    const float fps = NetworkManager::NetworkFPS;
+    if (fps <= ZeroTolerance)
+        return (float)now; // Frame rate of the sender is unknown so use the arrival time
+    const double remoteTime = (double)ownerFrame / fps;
+
+    // Map the sender timeline into the local time by tracking the lowest latency with a slow drift towards the current one (eg. after lag spike)
+    const double offset = now - remoteTime;
+    double* clock = SnapshotClocks.TryGet(senderClientId);
+    if (!clock)
+        clock = &SnapshotClocks.Add(senderClientId, offset)->Value;
+    else if (offset < *clock || offset - *clock > 1.0)
+        *clock = offset;
+    else
+        *clock += (offset - *clock) * 0.05;
+    return (float)(remoteTime + *clock);
+}
+
+void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, uint32 baselineFrame, byte* data, uint32 dataSize, uint32 senderClientId)
 {
     ScriptingObject* obj = item.Object.Get();
     if (!obj)
         return;
+    RecordStats(senderClientId, &NetworkReplicationStats::ObjectsReceived, 1);
+#if COMPILE_WITH_PROFILER
+    if (NetworkInternal::EnableProfiling)
+    {
+        auto& profileEvent = NetworkInternal::ProfilerEvents[Pair<ScriptingTypeHandle, StringAnsiView>(obj->GetTypeHandle(), StringAnsiView::Empty)];
+        profileEvent.ReceivedCount++;
+        profileEvent.ReceivedDataSize += dataSize;
+    }
+#endif
 
     // Skip replication if we own the object (eg. late replication message after ownership change)
     if (item.Role == NetworkObjectRole::OwnedAuthoritative)
@@ -743,7 +1132,28 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
     // Drop object replication if it has old data (eg. newer message was already processed due to unordered channel usage)
     if (item.LastOwnerFrame >= ownerFrame)
         return;
+
+    // Reconstruct the full state from the delta against the previously received state
+    ReplicationBaselines* baselines = GetBaselines(item);
+    if (baselineFrame != 0)
+    {
+        const ReplicationBaseline* baseline = baselines->Received.Find(baselineFrame);
+        if (!baseline || NetworkInternal::DecodeDelta(data, dataSize, baseline->Data.Get(), (uint32)baseline->Data.Count(), CachedDeltaBuffer))
+        {
+            // Missing baseline (eg. evicted after too many lost acknowledgements), owner will fallback to the full state
+            NETWORK_REPLICATOR_LOG(Warning, "[NetworkReplicator] Cannot decode delta replication of object {} (baseline frame {})", item.ToString(), baselineFrame);
+            return;
+        }
+        data = CachedDeltaBuffer.Get();
+        dataSize = CachedDeltaBuffer.Count();
+    }
     item.LastOwnerFrame = ownerFrame;
+    item.SnapshotTime = GetSnapshotTime(ownerFrame, senderClientId);
+    baselines->Received.Add(ownerFrame, data, dataSize);
+    auto& ack = PendingAcks.AddOne();
+    ack.ClientId = senderClientId;
+    ack.ObjectId = item.ObjectId;
+    ack.OwnerFrame = ownerFrame;
 
     // Setup message reading stream
     if (CachedReadStream == nullptr)
@@ -775,6 +1185,166 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
         DirtyObjectImpl(item, obj);
 }
 
+bool FindSerializer(ScriptingTypeHandle typeHandle, Serializer& serializer)
+{
+    ScopeLock lock(SerializersLock);
+    while (typeHandle)
+    {
+        if (SerializersTable.TryGet(typeHandle, serializer))
+            return false;
+
+        // Fallback to INetworkSerializable interface (if type implements it)
+        const ScriptingType& type = typeHandle.GetType();
+        const ScriptingType::InterfaceImplementation* interface = type.GetInterface(INetworkSerializable::TypeInitializer);
+        if (interface)
+        {
+            if (interface->IsNative)
+            {
+                // Native interface (implemented in C++)
+                serializer.Methods[0] = INetworkSerializable_Native_Serialize;
+                serializer.Methods[1] = INetworkSerializable_Native_Deserialize;
+                serializer.Tags[0] = serializer.Tags[1] = (void*)(intptr)interface->VTableOffset; // Pass VTableOffset to the callback
+            }
+            else
+            {
+                // Generic interface (implemented in C# or elsewhere)
+                ASSERT(type.Type == ScriptingTypes::Script);
+                serializer.Methods[0] = INetworkSerializable_Script_Serialize;
+                serializer.Methods[1] = INetworkSerializable_Script_Deserialize;
+                serializer.Tags[0] = serializer.Tags[1] = nullptr;
+            }
+            serializer.ThreadSafe = false;
+            SerializersTable.Add(typeHandle, serializer);
+            return false;
+        }
+
+        // Fallback to base type
+        typeHandle = type.GetBaseType();
+    }
+    return true;
+}
+
+void SerializeReplicationJob(ReplicationJob& job)
+{
+    // Each thread writes objects one after another into its own stream
+    NetworkStream*& stream = ReplicationStreams.Get();
+    if (!stream)
+    {
+        stream = New<NetworkStream>();
+        stream->Initialize();
+    }
+    stream->SenderId = NetworkManager::LocalClientId;
+    job.Stream = stream;
+    job.DataStart = stream->GetPosition();
+    job.Serialize(job.Object, stream, job.Tag);
+    job.DataSize = stream->GetPosition() - job.DataStart;
+    stream->SetPosition(job.DataStart + job.DataSize); // Align next object to the byte boundary
+}
+
+void SerializeReplicationJobs(int32 batchIndex)
+{
+    // Inject ObjectsLookupIdMapping for the serializers (remaps local client object ids into server ids)
+    auto& idsMapping = Scripting::ObjectsLookupIdMapping.Get();
+    auto* prevIdsMapping = idsMapping;
+    idsMapping = &IdsRemappingTable;
+    const int32 start = batchIndex * ReplicationJobsBatchSize;
+    const int32 end = Math::Min(start + ReplicationJobsBatchSize, ReplicationJobsParallel.Count());
+    for (int32 i = start; i < end; i++)
+        SerializeReplicationJob(ReplicationJobs[ReplicationJobsParallel[i]]);
+    idsMapping = prevIdsMapping;
+}
+
+void SendObjectReplicateMessage(NetworkPeer* peer, const NetworkReplicatedObject& item, ScriptingObject* obj, uint32 baselineFrame, const byte* data, uint32 size, bool isClient, uint32& dataSize, uint32& messageSize)
+{
+    ASSERT(size <= MAX_uint16);
+    NetworkMessageObjectReplicate msgData;
+    msgData.OwnerFrame = NetworkManager::Frame;
+    msgData.BaselineFrame = baselineFrame;
+    msgData.ObjectId = item.ObjectId;
+    msgData.ParentId = item.ParentId;
+    {
+        // Remap local client object ids into server ids
+        IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
+        IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
+    }
+    GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
+    msgData.DataSize = size;
+    const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
+    const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
+    uint32 partsCount = 1;
+    uint32 dataStart = 0;
+    uint32 msgDataSize = size;
+    if (size > msgMaxData)
+    {
+        // Send msgMaxData within first message
+        msgDataSize = msgMaxData;
+        dataStart += msgMaxData;
+
+        // Send rest of the data in separate parts
+        partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
+    }
+    else
+        dataStart += size;
+    ASSERT(partsCount <= MAX_uint8);
+    msgData.PartsCount = partsCount;
+    NetworkMessage msg = peer->BeginSendMessage();
+    msg.WriteStructure(msgData);
+    msg.WriteBytes((uint8*)data, msgDataSize);
+    dataSize += msgDataSize;
+    uint32 sentSize = msg.Length;
+    if (isClient)
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+    else
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+
+    // Send all other parts
+    for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
+    {
+        NetworkMessageObjectReplicatePart msgDataPart;
+        msgDataPart.OwnerFrame = msgData.OwnerFrame;
+        msgDataPart.BaselineFrame = baselineFrame;
+        msgDataPart.ObjectId = msgData.ObjectId;
+        msgDataPart.DataSize = msgData.DataSize;
+        msgDataPart.PartsCount = msgData.PartsCount;
+        msgDataPart.PartStart = dataStart;
+        msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
+        msg = peer->BeginSendMessage();
+        msg.WriteStructure(msgDataPart);
+        msg.WriteBytes((uint8*)data + msgDataPart.PartStart, msgDataPart.PartSize);
+        sentSize += msg.Length;
+        dataSize += msgDataPart.PartSize;
+        dataStart += msgDataPart.PartSize;
+        if (isClient)
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+        else
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+    }
+    ASSERT_LOW_LAYER(dataStart == size);
+    messageSize += sentSize;
+    RecordDataSent(isClient, sentSize, NetworkChannelType::Unreliable);
+    RecordStatsSent(isClient, &NetworkReplicationStats::ObjectsSent, 1);
+    if (baselineFrame != 0)
+        RecordStatsSent(isClient, &NetworkReplicationStats::ObjectsDelta, 1);
+}
+
+void AddReplicationTarget(ReplicationBaselines* baselines, const NetworkConnection& connection, uint32 clientId, const byte* data, uint32 size)
+{
+    ReplicationClientBaseline& client = baselines->GetClient(clientId);
+    const ReplicationBaseline* baseline = baselines->Sent.Find(client.AckedFrame);
+    if (baseline && baseline->Data.Count() != (int32)size)
+        baseline = nullptr; // Delta encoding requires the same size of the state
+    if (baseline && client.SentFrame == client.AckedFrame && Platform::MemoryCompare(baseline->Data.Get(), data, size) == 0)
+    {
+        // Receiver already has the current state
+        RecordStats(clientId, &NetworkReplicationStats::ObjectsSkipped, 1);
+        return;
+    }
+    client.SentFrame = NetworkManager::Frame;
+    auto& target = CachedReplicationTargets.AddOne();
+    target.Connection = connection;
+    target.BaselineFrame = baseline ? baseline->Frame : 0;
+}
+
 void InvokeObjectSpawn(const NetworkMessageObjectSpawn& msgData, const NetworkMessageObjectSpawnItem* msgDataItems)
 {
     ScopeLock lock(ObjectsLock);
@@ -1096,11 +1666,12 @@ void NetworkReplicator::SetHierarchy(NetworkReplicationHierarchy* value)
     }
 }
 
-void NetworkReplicator::AddSerializer(const ScriptingTypeHandle& typeHandle, SerializeFunc serialize, SerializeFunc deserialize, void* serializeTag, void* deserializeTag)
+void NetworkReplicator::AddSerializer(const ScriptingTypeHandle& typeHandle, SerializeFunc serialize, SerializeFunc deserialize, void* serializeTag, void* deserializeTag, bool threadSafe)
 {
     if (!typeHandle)
         return;
-    const Serializer serializer{ { serialize, deserialize }, { serializeTag, deserializeTag } };
+    const Serializer serializer{ { serialize, deserialize }, { serializeTag, deserializeTag }, threadSafe };
+    ScopeLock lock(SerializersLock);
     SerializersTable[typeHandle] = serializer;
 }
 
@@ -1111,38 +1682,8 @@ bool NetworkReplicator::InvokeSerializer(const ScriptingTypeHandle& typeHandle,
 
     // Get serializers pair from table
     Serializer serializer;
-    if (!SerializersTable.TryGet(typeHandle, serializer))
-    {
-        // Fallback to INetworkSerializable interface (if type implements it)
-        const ScriptingType& type = typeHandle.GetType();
-        const ScriptingType::InterfaceImplementation* interface = type.GetInterface(INetworkSerializable::TypeInitializer);
-        if (interface)
-        {
-            if (interface->IsNative)
-            {
-                // Native interface (implemented in C++)
-                serializer.Methods[0] = INetworkSerializable_Native_Serialize;
-                serializer.Methods[1] = INetworkSerializable_Native_Deserialize;
-                serializer.Tags[0] = serializer.Tags[1] = (void*)(intptr)interface->VTableOffset; // Pass VTableOffset to the callback
-            }
-            else
-            {
-                // Generic interface (implemented in C# or elsewhere)
-                ASSERT(type.Type == ScriptingTypes::Script);
-                serializer.Methods[0] = INetworkSerializable_Script_Serialize;
-                serializer.Methods[1] = INetworkSerializable_Script_Deserialize;
-                serializer.Tags[0] = serializer.Tags[1] = nullptr;
-            }
-            SerializersTable.Add(typeHandle, serializer);
-        }
-        else if (const ScriptingTypeHandle baseTypeHandle = typeHandle.GetType().GetBaseType())
-        {
-            // Fallback to base type
-            return InvokeSerializer(baseTypeHandle, instance, stream, serialize);
-        }
-        else
-            return true;
-    }
+    if (FindSerializer(typeHandle, serializer))
+        return true;
 
     // Invoke serializer
     const byte idx = serialize ? 0 : 1;
@@ -1210,6 +1751,7 @@ void NetworkReplicator::RemoveObject(ScriptingObject* obj)
     NETWORK_REPLICATOR_LOG(Info, "[NetworkReplicator] Remove object {}, owned by {}", obj->GetID().ToString(), it->Item.ParentId.ToString());
     if (Hierarchy && it->Item.Role == NetworkObjectRole::OwnedAuthoritative)
         Hierarchy->RemoveObject(obj);
+    FreeBaselines(it->Item);
     Objects.Remove(it);
 }
 
@@ -1281,6 +1823,7 @@ void NetworkReplicator::DespawnObject(ScriptingObject* obj)
         item.AsNetworkObject->OnNetworkDespawn();
     if (Hierarchy && item.Role == NetworkObjectRole::OwnedAuthoritative)
         Hierarchy->RemoveObject(obj);
+    FreeBaselines(item);
     Objects.Remove(it);
     DeleteNetworkObject(obj);
 }
@@ -1359,6 +1902,38 @@ uint32 NetworkReplicator::GetObjectOwnerClientId(const ScriptingObject* obj)
     return id;
 }
 
+float NetworkReplicator::GetObjectSnapshotTime(const ScriptingObject* obj)
+{
+    float result = 0.0f;
+    if (obj)
+    {
+        ScopeLock lock(ObjectsLock);
+        const auto it = Objects.Find(obj->GetID());
+        if (it != Objects.End())
+            result = it->Item.SnapshotTime;
+    }
+    return result;
+}
+
+float NetworkReplicator::GetInterpolationTime()
+{
+    return (float)Time::Update.UnscaledTime.GetTotalSeconds() - InterpolationDelay;
+}
+
+NetworkReplicationStats NetworkReplicator::GetStats()
+{
+    ScopeLock lock(ObjectsLock);
+    return LastReplicationStats;
+}
+
+NetworkReplicationStats NetworkReplicator::GetClientStats(const NetworkClient* client)
+{
+    ScopeLock lock(ObjectsLock);
+    NetworkReplicationStats result;
+    LastClientStats.TryGet(client ? client->ClientId : NetworkManager::ServerClientId, result);
+    return result;
+}
+
 NetworkObjectRole NetworkReplicator::GetObjectRole(const ScriptingObject* obj)
 {
     NetworkObjectRole role = NetworkObjectRole::None;
@@ -1559,6 +2134,10 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
 {
     ScopeLock lock(ObjectsLock);
     NewClients.Remove(client);
+    ClientBandwidthBudgets.Remove(client->ClientId);
+    SnapshotClocks.Remove(client->ClientId);
+    ClientStats.Remove(client->ClientId);
+    LastClientStats.Remove(client->ClientId);
 
     // Remove any objects owned by that client
     const uint32 clientId = client->ClientId;
@@ -1566,6 +2145,19 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
     {
         auto& item = it->Item;
         ScriptingObject* obj = item.Object.Get();
+        if (item.Baselines)
+        {
+            // Release delta compression baseline of that client
+            auto& clients = item.Baselines->Clients;
+            for (int32 i = 0; i < clients.Count(); i++)
+            {
+                if (clients[i].ClientId == clientId)
+                {
+                    clients.RemoveAtKeepOrder(i);
+                    break;
+                }
+            }
+        }
         if (obj && item.Spawned && item.OwnerClientId == clientId)
         {
             // Register for despawning (batched during update)
@@ -1580,6 +2172,7 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
             if (item.AsNetworkObject)
                 item.AsNetworkObject->OnNetworkDespawn();
             DeleteNetworkObject(obj);
+            FreeBaselines(item);
             Objects.Remove(it);
         }
     }
@@ -1596,6 +2189,7 @@ void NetworkInternal::NetworkReplicatorClear()
     {
         auto& item = it->Item;
         ScriptingObject* obj = item.Object.Get();
+        FreeBaselines(item);
         if (obj && item.Spawned)
         {
             // Cleanup any spawned objects
@@ -1616,10 +2210,45 @@ void NetworkInternal::NetworkReplicatorClear()
     NewClients.Clear();
     CachedTargets.Clear();
     DespawnedObjects.Clear();
+    BaselinesPool.ClearDelete();
+    PendingAcks.Clear();
+    CachedReplicationTargets.Clear();
+    CachedDeltaBuffer.Resize(0);
+    ClientBandwidthBudgets.Clear();
+    DeferredReplication.Clear();
+    LastBandwidthUpdateTime = 0.0;
+    SnapshotClocks.Clear();
+    ReplicationStats = LastReplicationStats = NetworkReplicationStats();
+    ClientStats.Clear();
+    LastClientStats.Clear();
+    ReplicationJobs.Resize(0);
+    ReplicationJobsTargets.Resize(0);
+    ReplicationJobsParallel.Resize(0);
+    Array<NetworkStream*, InlinedAllocation<64>> streams;
+    ReplicationStreams.GetValues(streams);
+    for (NetworkStream* stream : streams)
+    {
+        if (stream)
+            Delete(stream);
+    }
+    ReplicationStreams.Clear();
 }
 
 void NetworkInternal::NetworkReplicatorPreUpdate()
 {
+    // Begin gathering of the replication stats for this update
+    {
+        ScopeLock lock(ObjectsLock);
+        LastReplicationStats = ReplicationStats;
+        ReplicationStats = NetworkReplicationStats();
+        LastClientStats.Swap(ClientStats);
+        ClientStats.Clear();
+        StatsActive = NetworkReplicator::EnableStats;
+#if COMPILE_WITH_PROFILER
+        StatsActive |= EnableProfiling;
+#endif
+    }
+
     // Inject ObjectsLookupIdMapping to properly map networked object ids into local object ids (deserialization with Scripting::TryFindObject will remap objects)
     Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
 }
@@ -1628,6 +2257,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
 {
     PROFILE_CPU();
     ScopeLock lock(ObjectsLock);
+    PROFILE_COUNTER("Network Replicated Objects", Objects.Count());
     if (Objects.Count() == 0)
         return;
     const bool isClient = NetworkManager::IsClient();
@@ -1800,7 +2430,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     auto& item = it->Item;
 
                     // Replicate from all collected parts data
-                    InvokeObjectReplication(item, e.OwnerFrame, e.Data.Get(), e.Data.Count(), e.OwnerClientId);
+                    InvokeObjectReplication(item, e.OwnerFrame, e.BaselineFrame, e.Data.Get(), e.Data.Count(), e.OwnerClientId);
                 }
             }
 
@@ -1836,6 +2466,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
             {
                 // Object got deleted
                 NETWORK_REPLICATOR_LOG(Info, "[NetworkReplicator] Remove object {}, owned by {}", item.ToString(), item.ParentId.ToString());
+                FreeBaselines(item);
                 Objects.Remove(it);
                 continue;
             }
@@ -1844,14 +2475,92 @@ void NetworkInternal::NetworkReplicatorUpdate()
             CachedReplicationResult->AddObject(obj);
         }
     }
+    const bool limitBandwidth = NetworkManager::ClientBandwidth != 0;
+    if (limitBandwidth)
+    {
+        PROFILE_CPU_NAMED("ReplicationPriority");
+        auto& entries = CachedReplicationResult->_entries;
+
+        // Refill bandwidth budgets (capped to prevent bursts after idle periods)
+        const double time = Platform::GetTimeSeconds();
+        const float deltaTime = LastBandwidthUpdateTime > 0.0 ? Math::Min((float)(time - LastBandwidthUpdateTime), 1.0f) : 0.0f;
+        LastBandwidthUpdateTime = time;
+        const float refill = (float)NetworkManager::ClientBandwidth * deltaTime;
+        const float budgetMax = Math::Max(refill * 2.0f, (float)peer->Config.MessageSize);
+        if (isClient)
+        {
+            float& budget = ClientBandwidthBudgets[NetworkManager::ServerClientId];
+            budget = Math::Min(budget + refill, budgetMax);
+        }
+        else
+        {
+            for (const NetworkClient* client : NetworkManager::Clients)
+            {
+                float& budget = ClientBandwidthBudgets[client->ClientId];
+                budget = Math::Min(budget + refill, budgetMax);
+            }
+        }
+
+        // Merge objects deferred in the previous updates due to the exceeded bandwidth
+        if (DeferredReplication.HasItems())
+        {
+            Dictionary<ScriptingObject*, int32> entriesLookup;
+            entriesLookup.EnsureCapacity(entries.Count());
+            for (int32 i = 0; i < entries.Count(); i++)
+                entriesLookup[entries[i].Object] = i;
+            for (const ReplicationDeferred& e : DeferredReplication)
+            {
+                auto it = Objects.Find(e.ObjectId);
+                if (it.IsEnd())
+                    continue;
+                ScriptingObject* obj = it->Item.Object.Get();
+                if (!obj)
+                    continue;
+                int32 index;
+                if (entriesLookup.TryGet(obj, index))
+                {
+                    auto& entry = entries[index];
+                    entry.TargetClients.Word0 |= e.TargetClients.Word0;
+                    entry.TargetClients.Word1 |= e.TargetClients.Word1;
+                    entry.Priority = Math::Max(entry.Priority, e.Priority);
+                }
+                else
+                {
+                    entriesLookup[obj] = entries.Count();
+                    CachedReplicationResult->AddObject(obj, e.TargetClients, e.Priority);
+                }
+            }
+            DeferredReplication.Clear();
+        }
+
+        // Accumulate priority of objects over time (until they get sent) and sort them to send the most important ones first
+        const float priorityScale = Math::Max(deltaTime, ZeroTolerance);
+        for (auto& e : entries)
+        {
+            auto it = Objects.Find(e.Object->GetID());
+            if (it.IsEnd())
+            {
+                e.Score = 0.0f;
+                continue;
+            }
+            auto& item = it->Item;
+            item.PriorityAccumulator += e.Priority * priorityScale;
+            e.Score = item.PriorityAccumulator;
+        }
+        using Entry = NetworkReplicationHierarchyUpdateResult::Entry;
+        Sorting::QuickSort<Entry>(entries.Get(), entries.Count(), [](const Entry& a, const Entry& b)
+        {
+            return a.Score > b.Score;
+        });
+    }
     if (CachedReplicationResult->_entries.HasItems())
     {
         PROFILE_CPU_NAMED("Replication");
-        if (CachedWriteStream == nullptr)
-            CachedWriteStream = New<NetworkStream>();
-        NetworkStream* stream = CachedWriteStream;
-        stream->SenderId = NetworkManager::LocalClientId;
-        // TODO: use Job System when replicated objects count is large
+
+        // Gather objects to replicate (with their receivers) and resolve serializers
+        ReplicationJobs.Clear();
+        ReplicationJobsTargets.Clear();
+        ReplicationJobsParallel.Clear();
         for (auto& e : CachedReplicationResult->_entries)
         {
             ScriptingObject* obj = e.Object;
@@ -1868,81 +2577,178 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     continue;
             }
 
-            if (item.AsNetworkObject)
-                item.AsNetworkObject->OnNetworkSerialize();
+            // Defer replication to the receivers that exceeded their bandwidth budget
+            if (limitBandwidth)
+            {
+                NetworkClientsMask deferredClients;
+                uint32 deferredCount = 0;
+                if (isClient)
+                {
+                    if (ClientBandwidthBudgets[NetworkManager::ServerClientId] <= 0.0f)
+                    {
+                        deferredClients = NetworkClientsMask::All;
+                        deferredCount = 1;
+                        RecordStats(NetworkManager::ServerClientId, &NetworkReplicationStats::ObjectsDeferred, 1);
+                    }
+                }
+                else
+                {
+                    for (int32 i = CachedTargets.Count() - 1; i >= 0; i--)
+                    {
+                        NetworkClient* client = NetworkManager::GetClient(CachedTargets[i]);
+                        if (client && ClientBandwidthBudgets[client->ClientId] <= 0.0f)
+                        {
+                            deferredClients.SetBit(NetworkManager::Clients.Find(client));
+                            CachedTargets.RemoveAt(i);
+                            deferredCount++;
+                            RecordStats(client->ClientId, &NetworkReplicationStats::ObjectsDeferred, 1);
+                        }
+                    }
+                }
+#if COMPILE_WITH_PROFILER
+                if (EnableProfiling && deferredCount)
+                    ProfilerEvents[Pair<ScriptingTypeHandle, StringAnsiView>(obj->GetTypeHandle(), StringAnsiView::Empty)].Deferred += deferredCount;
+#endif
+                if (deferredClients)
+                {
+                    auto& deferred = DeferredReplication.AddOne();
+                    deferred.ObjectId = item.ObjectId;
+                    deferred.TargetClients = deferredClients;
+                    deferred.Priority = e.Priority;
+                }
+                else
+                {
+                    item.PriorityAccumulator = 0.0f;
+                }
+                if (isClient ? (bool)deferredClients : CachedTargets.Count() == 0)
+                    continue;
+            }
 
-            // Serialize object
-            stream->Initialize();
-            const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, true);
-            if (failed)
+            Serializer serializer;
+            if (FindSerializer(obj->GetTypeHandle(), serializer))
             {
                 //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
                 continue;
             }
 
-            // Send object to clients
-            const uint32 size = stream->GetPosition();
-            ASSERT(size <= MAX_uint16);
-            NetworkMessageObjectReplicate msgData;
-            msgData.OwnerFrame = NetworkManager::Frame;
-            msgData.ObjectId = item.ObjectId;
-            msgData.ParentId = item.ParentId;
+            if (item.AsNetworkObject)
+                item.AsNetworkObject->OnNetworkSerialize();
+
+            auto& job = ReplicationJobs.AddOne();
+            job.Object = obj;
+            job.ObjectId = item.ObjectId;
+            job.Serialize = serializer.Methods[0];
+            job.Tag = serializer.Tags[0];
+            job.Stream = nullptr;
+            job.DataStart = job.DataSize = 0;
+            job.TargetsStart = ReplicationJobsTargets.Count();
+            job.TargetsCount = CachedTargets.Count();
+            ReplicationJobsTargets.Add(CachedTargets);
+            if (serializer.ThreadSafe && NetworkReplicator::EnableParallelSerialization)
+                ReplicationJobsParallel.Add(ReplicationJobs.Count() - 1);
+        }
+
+        // Serialize objects (thread-safe serializers run on the Job System while the main thread handles the rest)
+        {
+            PROFILE_CPU_NAMED("ReplicationSerialize");
+            Array<NetworkStream*, InlinedAllocation<64>> streams;
+            ReplicationStreams.GetValues(streams);
+            for (NetworkStream* stream : streams)
             {
-                // Remap local client object ids into server ids
-                IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
-                IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
+                if (stream)
+                    stream->Initialize();
             }
-            GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
-            msgData.DataSize = size;
-            const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
-            const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
-            uint32 partsCount = 1;
-            uint32 dataStart = 0;
-            uint32 msgDataSize = size;
-            if (size > msgMaxData)
+            int64 parallelLabel = 0;
+            if (ReplicationJobsParallel.Count() >= NETWORK_REPLICATOR_PARALLEL_MIN_OBJECTS)
             {
-                // Send msgMaxData within first message
-                msgDataSize = msgMaxData;
-                dataStart += msgMaxData;
-
-                // Send rest of the data in separate parts
-                partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
+                ReplicationJobsBatchSize = Math::Max(ReplicationJobsParallel.Count() / (JobSystem::GetThreadsCount() * 4), NETWORK_REPLICATOR_PARALLEL_MIN_OBJECTS / 4);
+                parallelLabel = JobSystem::Dispatch(SerializeReplicationJobs, Math::DivideAndRoundUp(ReplicationJobsParallel.Count(), ReplicationJobsBatchSize));
             }
             else
-                dataStart += size;
-            ASSERT(partsCount <= MAX_uint8);
-            msgData.PartsCount = partsCount;
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(stream->GetBuffer(), msgDataSize);
-            uint32 dataSize = msgDataSize, messageSize = msg.Length;
-            if (isClient)
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
-            else
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+            {
+                ReplicationJobsParallel.Clear();
+            }
+            for (int32 i = 0, j = 0; i < ReplicationJobs.Count(); i++)
+            {
+                if (j < ReplicationJobsParallel.Count() && ReplicationJobsParallel[j] == i)
+                {
+                    j++;
+                    continue;
+                }
+                SerializeReplicationJob(ReplicationJobs[i]);
+            }
+            if (parallelLabel)
+                JobSystem::Wait(parallelLabel);
+        }
 
-            // Send all other parts
-            for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
+        // Send objects to clients
+        for (const ReplicationJob& job : ReplicationJobs)
+        {
+            auto it = Objects.Find(job.ObjectId);
+            if (it.IsEnd())
+                continue;
+            auto& item = it->Item;
+            ScriptingObject* obj = job.Object;
+            CachedTargets.Clear();
+            CachedTargets.Add(ReplicationJobsTargets.Get() + job.TargetsStart, job.TargetsCount);
+            const byte* data = job.Stream->GetBuffer() + job.DataStart;
+            const uint32 size = job.DataSize;
+            uint32 dataSize = 0, messageSize = 0, receivers = 0, deltaReceivers = 0, skipped = 0;
+            if (NetworkReplicator::EnableDeltaReplication)
             {
-                NetworkMessageObjectReplicatePart msgDataPart;
-                msgDataPart.OwnerFrame = msgData.OwnerFrame;
-                msgDataPart.ObjectId = msgData.ObjectId;
-                msgDataPart.DataSize = msgData.DataSize;
-                msgDataPart.PartsCount = msgData.PartsCount;
-                msgDataPart.PartStart = dataStart;
-                msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
-                msg = peer->BeginSendMessage();
-                msg.WriteStructure(msgDataPart);
-                msg.WriteBytes(stream->GetBuffer() + msgDataPart.PartStart, msgDataPart.PartSize);
-                messageSize += msg.Length;
-                dataSize += msgDataPart.PartSize;
-                dataStart += msgDataPart.PartSize;
+                // Pick baseline for each receiver (the last acknowledged state) and skip receivers that already have the current state
+                ReplicationBaselines* baselines = GetBaselines(item);
+                CachedReplicationTargets.Clear();
                 if (isClient)
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+                {
+                    AddReplicationTarget(baselines, NetworkConnection(), NetworkManager::ServerClientId, data, size);
+                }
                 else
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+                {
+                    for (const NetworkConnection& connection : CachedTargets)
+                    {
+                        if (const NetworkClient* client = NetworkManager::GetClient(connection))
+                            AddReplicationTarget(baselines, connection, client->ClientId, data, size);
+                    }
+                }
+                const int32 targetsCount = isClient ? 1 : CachedTargets.Count();
+                skipped = targetsCount - CachedReplicationTargets.Count();
+
+                // Send to the groups of receivers that share the same baseline
+                const bool anyTargets = CachedReplicationTargets.HasItems();
+                while (CachedReplicationTargets.HasItems())
+                {
+                    const uint32 baselineFrame = CachedReplicationTargets.Last().BaselineFrame;
+                    CachedTargets.Clear();
+                    for (int32 i = CachedReplicationTargets.Count() - 1; i >= 0; i--)
+                    {
+                        if (CachedReplicationTargets[i].BaselineFrame == baselineFrame)
+                        {
+                            CachedTargets.Add(CachedReplicationTargets[i].Connection);
+                            CachedReplicationTargets.RemoveAt(i);
+                        }
+                    }
+                    const ReplicationBaseline* baseline = baselines->Sent.Find(baselineFrame);
+                    if (baseline)
+                    {
+                        NetworkInternal::EncodeDelta(data, baseline->Data.Get(), size, CachedDeltaBuffer);
+                        SendObjectReplicateMessage(peer, item, obj, baselineFrame, CachedDeltaBuffer.Get(), CachedDeltaBuffer.Count(), isClient, dataSize, messageSize);
+                        deltaReceivers += isClient ? 1 : CachedTargets.Count();
+                    }
+                    else
+                    {
+                        SendObjectReplicateMessage(peer, item, obj, 0, data, size, isClient, dataSize, messageSize);
+                    }
+                    receivers += isClient ? 1 : CachedTargets.Count();
+                }
+                if (anyTargets)
+                    baselines->Sent.Add(NetworkManager::Frame, data, size);
+            }
+            else
+            {
+                SendObjectReplicateMessage(peer, item, obj, 0, data, size, isClient, dataSize, messageSize);
+                receivers = isClient ? 1 : CachedTargets.Count();
             }
-            ASSERT_LOW_LAYER(dataStart == size);
 
 #if COMPILE_WITH_PROFILER
             // Network stats recording
@@ -1950,10 +2756,13 @@ void NetworkInternal::NetworkReplicatorUpdate()
             {
                 const Pair<ScriptingTypeHandle, StringAnsiView> name(obj->GetTypeHandle(), StringAnsiView::Empty);
                 auto& profileEvent = ProfilerEvents[name];
-                profileEvent.Count++;
+                if (receivers)
+                    profileEvent.Count++;
                 profileEvent.DataSize += dataSize;
                 profileEvent.MessageSize += messageSize;
-                profileEvent.Receivers += isClient ? 1 : CachedTargets.Count();
+                profileEvent.Receivers += receivers;
+                profileEvent.Delta += deltaReceivers;
+                profileEvent.Skipped += skipped;
             }
 #endif
         }
@@ -2005,6 +2814,8 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Server RPC '{}::{}' called with non-empty list of targets is not supported (only server will receive it)", e.Name.First.ToString(), e.Name.Second.ToString());
 #endif
                 peer->EndSendMessage(channel, msg);
+                RecordDataSent(true, messageSize, channel);
+                RecordStatsSent(true, &NetworkReplicationStats::RpcsSent, 1);
                 receivers = 1;
             }
             else if (e.Info.Client && (isServer || isHost))
@@ -2012,6 +2823,8 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 // Server -> Client(s)
                 BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, e.Targets, NetworkManager::LocalClientId);
                 peer->EndSendMessage(channel, msg, CachedTargets);
+                RecordDataSent(false, messageSize, channel);
+                RecordStatsSent(false, &NetworkReplicationStats::RpcsSent, 1);
                 receivers = CachedTargets.Count();
             }
 
@@ -2030,6 +2843,57 @@ void NetworkInternal::NetworkReplicatorUpdate()
         RpcQueue.Clear();
     }
 
+    // Acknowledge received objects states (owners use them as baselines for delta compression)
+    if (PendingAcks.HasItems())
+    {
+        PROFILE_CPU_NAMED("ReplicationAcks");
+        const int32 maxItems = (int32)((peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicateAck)) / sizeof(NetworkMessageObjectReplicateAckItem));
+        Array<NetworkMessageObjectReplicateAckItem, InlinedAllocation<64>> items;
+        while (PendingAcks.HasItems())
+        {
+            // Batch acknowledgements sent to the same client
+            const uint32 clientId = PendingAcks.Last().ClientId;
+            items.Clear();
+            for (int32 i = PendingAcks.Count() - 1; i >= 0 && items.Count() < maxItems; i--)
+            {
+                const ReplicationAck& ack = PendingAcks[i];
+                if (ack.ClientId != clientId)
+                    continue;
+                auto& item = items.AddOne();
+                item.ObjectId = ack.ObjectId;
+                item.OwnerFrame = ack.OwnerFrame;
+                {
+                    // Remap local client object ids into server ids
+                    IdsRemappingTable.KeyOf(item.ObjectId, &item.ObjectId);
+                }
+                PendingAcks.RemoveAt(i);
+            }
+            NetworkMessageObjectReplicateAck msgData;
+            msgData.ItemsCount = (uint16)items.Count();
+            NetworkMessage msg = peer->BeginSendMessage();
+            msg.WriteStructure(msgData);
+            msg.WriteBytes((uint8*)items.Get(), items.Count() * sizeof(NetworkMessageObjectReplicateAckItem));
+            if (isClient)
+            {
+                peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+            }
+            else
+            {
+                const NetworkClient* client = NetworkManager::GetClient(clientId);
+                if (client && client->State == NetworkConnectionState::Connected)
+                {
+                    CachedTargets.Clear();
+                    CachedTargets.Add(client->Connection);
+                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+                }
+                else
+                {
+                    peer->AbortSendMessage(msg);
+                }
+            }
+        }
+    }
+
     // Clear networked objects mapping table
     Scripting::ObjectsLookupIdMapping.Set(nullptr);
 }
@@ -2037,6 +2901,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
 void NetworkInternal::OnNetworkMessageObjectReplicate(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
+    RecordMessageReceived(event, client);
     NetworkMessageObjectReplicate msgData;
     event.Message.ReadStructure(msgData);
     ScopeLock lock(ObjectsLock);
@@ -2055,7 +2920,7 @@ void NetworkInternal::OnNetworkMessageObjectReplicate(NetworkEvent& event, Netwo
     if (msgData.PartsCount == 1)
     {
         // Replicate
-        InvokeObjectReplication(item, msgData.OwnerFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, senderClientId);
+        InvokeObjectReplication(item, msgData.OwnerFrame, msgData.BaselineFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, senderClientId);
     }
     else
     {
@@ -2069,6 +2934,7 @@ void NetworkInternal::OnNetworkMessageObjectReplicate(NetworkEvent& event, Netwo
 void NetworkInternal::OnNetworkMessageObjectReplicatePart(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
+    RecordMessageReceived(event, client);
     NetworkMessageObjectReplicatePart msgData;
     event.Message.ReadStructure(msgData);
     ScopeLock lock(ObjectsLock);
@@ -2082,6 +2948,7 @@ void NetworkInternal::OnNetworkMessageObjectReplicatePart(NetworkEvent& event, N
 void NetworkInternal::OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
+    RecordMessageReceived(event, client);
     NetworkMessageObjectSpawn msgData;
     event.Message.ReadStructure(msgData);
     if (msgData.ItemsCount == 0)
@@ -2105,6 +2972,7 @@ void NetworkInternal::OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkCl
 void NetworkInternal::OnNetworkMessageObjectSpawnPart(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
+    RecordMessageReceived(event, client);
     NetworkMessageObjectSpawnPart msgData;
     event.Message.ReadStructure(msgData);
     int32 spawnPartsIndex;
@@ -2143,6 +3011,7 @@ void NetworkInternal::OnNetworkMessageObjectSpawnPart(NetworkEvent& event, Netwo
 void NetworkInternal::OnNetworkMessageObjectDespawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
+    RecordMessageReceived(event, client);
     NetworkMessageObjectDespawn msgData;
     event.Message.ReadStructure(msgData);
     ScopeLock lock(ObjectsLock);
@@ -2165,6 +3034,7 @@ void NetworkInternal::OnNetworkMessageObjectDespawn(NetworkEvent& event, Network
         DespawnedObjects.Add(msgData.ObjectId);
         if (item.AsNetworkObject)
             item.AsNetworkObject->OnNetworkDespawn();
+        FreeBaselines(item);
         Objects.Remove(obj);
         DeleteNetworkObject(obj);
     }
@@ -2177,6 +3047,7 @@ void NetworkInternal::OnNetworkMessageObjectDespawn(NetworkEvent& event, Network
 void NetworkInternal::OnNetworkMessageObjectRole(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
+    RecordMessageReceived(event, client);
     NetworkMessageObjectRole msgData;
     event.Message.ReadStructure(msgData);
     ScopeLock lock(ObjectsLock);
@@ -2225,6 +3096,7 @@ void NetworkInternal::OnNetworkMessageObjectRole(NetworkEvent& event, NetworkCli
 void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
+    RecordMessageReceived(event, client);
     NetworkMessageObjectRpc msgData;
     event.Message.ReadStructure(msgData);
     ScopeLock lock(ObjectsLock);
@@ -2233,12 +3105,22 @@ void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClie
     NetworkRpcName name;
     name.First = Scripting::FindScriptingType(msgData.RpcTypeName);
     name.Second = msgData.RpcName;
-    const NetworkRpcInfo* info = NetworkRpcInfo::RPCsTable.TryGet(name);
-    if (!info)
+    const auto rpcIt = NetworkRpcInfo::RPCsTable.Find(name);
+    if (rpcIt.IsEnd())
     {
         NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown RPC {}::{} for object {}", String(msgData.RpcTypeName), String(msgData.RpcName), msgData.ObjectId);
         return;
     }
+    const NetworkRpcInfo* info = &rpcIt->Value;
+    RecordStats(client ? client->ClientId : NetworkManager::ServerClientId, &NetworkReplicationStats::RpcsReceived, 1);
+#if COMPILE_WITH_PROFILER
+    if (EnableProfiling)
+    {
+        auto& profileEvent = ProfilerEvents[rpcIt->Key];
+        profileEvent.ReceivedCount++;
+        profileEvent.ReceivedDataSize += msgData.ArgsSize;
+    }
+#endif
 
     NetworkReplicatedObject* e = ResolveObject(msgData.ObjectId, msgData.ParentId, msgData.ObjectTypeName);
     if (e)
@@ -2275,3 +3157,26 @@ void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClie
         NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}::{}", msgData.ObjectId, String(msgData.RpcTypeName), String(msgData.RpcName));
     }
 }
+
+void NetworkInternal::OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    PROFILE_CPU();
+    RecordMessageReceived(event, client);
+    NetworkMessageObjectReplicateAck msgData;
+    event.Message.ReadStructure(msgData);
+    ScopeLock lock(ObjectsLock);
+    const uint32 senderClientId = client ? client->ClientId : NetworkManager::ServerClientId;
+    for (int32 i = 0; i < msgData.ItemsCount; i++)
+    {
+        NetworkMessageObjectReplicateAckItem msgDataItem;
+        event.Message.ReadStructure(msgDataItem);
+        NetworkReplicatedObject* e = ResolveObject(msgDataItem.ObjectId);
+        if (!e || !e->Baselines || e->Baselines->OwnerClientId != e->OwnerClientId)
+            continue;
+
+        // Use the newest acknowledged state as a baseline for that client (ignore frames that were never sent)
+        auto& baseline = e->Baselines->GetClient(senderClientId);
+        if (msgDataItem.OwnerFrame > baseline.AckedFrame && msgDataItem.OwnerFrame <= baseline.SentFrame)
+            baseline.AckedFrame = msgDataItem.OwnerFrame;
+    }
+}
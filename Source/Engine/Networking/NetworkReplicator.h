@@ -42,6 +42,31 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     API_FIELD() static bool EnableLog;
 #endif
 
+    /// <summary>
+    /// Enables delta compression of the objects replication. Each object state is encoded against the last state acknowledged by the receiver (per-connection baseline) and objects that didn't change since then are not sent at all.
+    /// </summary>
+    API_FIELD() static bool EnableDeltaReplication;
+
+    /// <summary>
+    /// Enables parallel serialization of the replicated objects on the Job System. Applies only to objects with thread-safe serializers (eg. generated for types with NetworkReplicated fields), other objects are serialized on the main thread.
+    /// </summary>
+    API_FIELD() static bool EnableParallelSerialization;
+
+    /// <summary>
+    /// The delay (in seconds) of the replicated objects state playback on the receiving side. States are sampled from the snapshots buffer with this delay to hide the network jitter (has to be higher than the owner send interval to interpolate between snapshots).
+    /// </summary>
+    API_FIELD() static float InterpolationDelay;
+
+    /// <summary>
+    /// The maximum time (in seconds) of the replicated objects state extrapolation when newer snapshot didn't arrive in time (eg. due to packet loss). Use 0 to disable extrapolation.
+    /// </summary>
+    API_FIELD() static float ExtrapolationLimit;
+
+    /// <summary>
+    /// Enables gathering of the replication statistics (per update and per client, see GetStats and GetClientStats). Always gathered when network profiler is active.
+    /// </summary>
+    API_FIELD() static bool EnableStats;
+
     /// <summary>
     /// Gets the network replication hierarchy.
     /// </summary>
@@ -61,7 +86,8 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     /// <param name="deserialize">Deserialization callback method.</param>
     /// <param name="serializeTag">Serialization callback method tag value.</param>
     /// <param name="deserializeTag">Deserialization callback method tag value.</param>
-    static void AddSerializer(const ScriptingTypeHandle& typeHandle, SerializeFunc serialize, SerializeFunc deserialize, void* serializeTag = nullptr, void* deserializeTag = nullptr);
+    /// <param name="threadSafe">True if serialization callback can be called from multiple threads at once (it only reads the object state and writes to the stream). Thread-safe serializers are invoked in parallel on the Job System during replication.</param>
+    static void AddSerializer(const ScriptingTypeHandle& typeHandle, SerializeFunc serialize, SerializeFunc deserialize, void* serializeTag = nullptr, void* deserializeTag = nullptr, bool threadSafe = false);
 
     /// <summary>
     /// Invokes the network replication serializer for a given type.
@@ -151,6 +177,33 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     /// <returns>The object role.</returns>
     API_FUNCTION() static NetworkObjectRole GetObjectRole(const ScriptingObject* obj);
 
+    /// <summary>
+    /// Gets the snapshot time of the last replicated state of the network object. Based on the owner frame number mapped into the local time (see Time.UnscaledGameTime) so the snapshots are evenly spaced regardless of the network jitter. Can be used during deserialization to add the state to the snapshots buffer.
+    /// </summary>
+    /// <param name="obj">The network object.</param>
+    /// <returns>The snapshot time (in seconds), or 0 if object is not replicated.</returns>
+    API_FUNCTION() static float GetObjectSnapshotTime(const ScriptingObject* obj);
+
+    /// <summary>
+    /// Gets the current time at which the replicated state snapshots should be sampled (current local time minus the interpolation delay).
+    /// </summary>
+    /// <returns>The interpolation time (in seconds).</returns>
+    API_FUNCTION() static float GetInterpolationTime();
+
+    /// <summary>
+    /// Gets the replication statistics of the last network update. Requires EnableStats to be set.
+    /// </summary>
+    /// <returns>The replication stats.</returns>
+    API_FUNCTION() static NetworkReplicationStats GetStats();
+
+    /// <summary>
+    /// Gets the replication statistics of the last network update for a given client connection (data sent to and received from it). Requires EnableStats to be set.
+    /// </summary>
+    /// <remarks>On client, use the server connection client (or null) to get stats of the data exchanged with the server.</remarks>
+    /// <param name="client">The network client.</param>
+    /// <returns>The replication stats.</returns>
+    API_FUNCTION() static NetworkReplicationStats GetClientStats(const NetworkClient* client);
+
     /// <summary>
     /// Checks if the network object is owned locally (thus current client has authority to manage it).
     /// </summary>
@@ -32,6 +32,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(100), Limit(0, 1000), EditorDisplay(\"General\", \"Network FPS\")")
     float NetworkFPS = 60.0f;
 
+    /// <summary>
+    /// The maximum amount of bytes per second sent to a single client (or to the server when running as a client) by the objects replication. Objects with the highest priority (accumulated over time while not sent) are sent first and the rest is deferred to the next updates. Spawns and RPCs are always sent but consume the budget. Use 0 for unlimited bandwidth.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(110), Limit(0), EditorDisplay(\"General\")")
+    uint32 ClientBandwidth = 0;
+
     /// <summary>
     /// Address of the server (server/host always runs on localhost). Only IPv4 is supported.
     /// </summary>
@@ -50,6 +56,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(1100), EditorDisplay(\"Transport\"), TypeReference(typeof(INetworkDriver)), CustomEditorAlias(\"FlaxEditor.CustomEditors.Editors.TypeNameEditor\")")
     StringAnsi NetworkDriver = "FlaxEngine.Networking.ENetDriver";
 
+    /// <summary>
+    /// If checked, the network driver will be serviced on a dedicated network thread which reduces the latency of the messages and acknowledgements (independent of the game frame rate).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1110), EditorDisplay(\"Transport\")")
+    bool UseNetworkThread = false;
+
 public:
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
@@ -0,0 +1,119 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Math.h"
+
+/// <summary>
+/// Time-stamped buffer of the replicated state snapshots used to smooth the replication on the receiving side. Sampled at the interpolation time (see NetworkReplicator::GetInterpolationTime) between the two surrounding snapshots and extrapolated for a limited time when newer snapshot didn't arrive yet.
+/// </summary>
+/// <remarks>Use NetworkReplicator::GetObjectSnapshotTime during deserialization to get the snapshot time (based on the owner frame number, not the arrival time).</remarks>
+template<typename T, int32 Capacity = 32>
+class NetworkSnapshotBuffer
+{
+public:
+    typedef void (*LerpFunc)(const T& a, const T& b, float alpha, T& result);
+
+    struct Snapshot
+    {
+        float Time;
+        T Value;
+    };
+
+private:
+    Array<Snapshot> _snapshots;
+    Snapshot _previous;
+    bool _hasPrevious = false;
+
+public:
+    /// <summary>
+    /// Gets the amount of buffered snapshots.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _snapshots.Count();
+    }
+
+    /// <summary>
+    /// Clears the buffer.
+    /// </summary>
+    void Clear()
+    {
+        _snapshots.Clear();
+        _hasPrevious = false;
+    }
+
+    /// <summary>
+    /// Adds the snapshot to the buffer (in time order). Snapshots older than the already sampled ones are ignored (eg. out of order arrival).
+    /// </summary>
+    /// <param name="time">The snapshot time.</param>
+    /// <param name="value">The snapshot value.</param>
+    void Add(float time, const T& value)
+    {
+        if (_hasPrevious && time <= _previous.Time)
+            return;
+        int32 index = _snapshots.Count();
+        while (index > 0 && _snapshots[index - 1].Time >= time)
+            index--;
+        if (index < _snapshots.Count() && Math::NearEqual(_snapshots[index].Time, time))
+        {
+            _snapshots[index].Value = value;
+            return;
+        }
+        if (_snapshots.Count() >= Capacity)
+        {
+            if (index == 0)
+                return;
+            PopFirst();
+            index--;
+        }
+        _snapshots.Insert(index, { time, value });
+    }
+
+    /// <summary>
+    /// Samples the buffered snapshots at the given time.
+    /// </summary>
+    /// <param name="time">The sampling time (eg. NetworkReplicator::GetInterpolationTime).</param>
+    /// <param name="extrapolationLimit">The maximum amount of time (in seconds) to extrapolate past the last snapshot. Use 0 to disable extrapolation.</param>
+    /// <param name="lerp">The values interpolation function.</param>
+    /// <param name="result">The sampled value.</param>
+    /// <returns>True if got a value, otherwise false if buffer is empty.</returns>
+    bool Sample(float time, float extrapolationLimit, LerpFunc lerp, T& result)
+    {
+        if (_snapshots.IsEmpty())
+            return false;
+
+        // Drop snapshots older than the sampling time (keep the previous one for extrapolation)
+        while (_snapshots.Count() >= 2 && _snapshots[1].Time <= time)
+            PopFirst();
+
+        const Snapshot& s0 = _snapshots[0];
+        if (_snapshots.Count() >= 2 && s0.Time <= time)
+        {
+            // Interpolate between the two surrounding snapshots
+            const Snapshot& s1 = _snapshots[1];
+            lerp(s0.Value, s1.Value, (time - s0.Time) / (s1.Time - s0.Time), result);
+        }
+        else if (_snapshots.Count() == 1 && s0.Time < time && _hasPrevious && extrapolationLimit > 0.0f)
+        {
+            // Extrapolate from the last two snapshots (limited to prevent overshooting after packet loss)
+            time = Math::Min(time, s0.Time + extrapolationLimit);
+            lerp(_previous.Value, s0.Value, (time - _previous.Time) / (s0.Time - _previous.Time), result);
+        }
+        else
+        {
+            // Hold the closest snapshot
+            result = s0.Value;
+        }
+        return true;
+    }
+
+private:
+    void PopFirst()
+    {
+        _previous = _snapshots[0];
+        _hasPrevious = true;
+        _snapshots.RemoveAtKeepOrder(0);
+    }
+};
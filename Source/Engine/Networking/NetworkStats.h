@@ -33,3 +33,72 @@ struct TIsPODType<NetworkDriverStats>
 {
     enum { Value = true };
 };
+
+/// <summary>
+/// The network objects replication statistics container. Contains information about NetworkReplicator usage within a single network update (objects replication, RPCs and bandwidth usage).
+/// </summary>
+API_STRUCT(Namespace="FlaxEngine.Networking", NoDefault) struct FLAXENGINE_API NetworkReplicationStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkReplicationStats);
+
+    /// <summary>
+    /// Amount of data bytes (including messages headers) sent over the reliable channels. Counted for each receiver.
+    /// </summary>
+    API_FIELD() uint32 DataSentReliable = 0;
+
+    /// <summary>
+    /// Amount of data bytes (including messages headers) sent over the unreliable channels. Counted for each receiver.
+    /// </summary>
+    API_FIELD() uint32 DataSentUnreliable = 0;
+
+    /// <summary>
+    /// Amount of data bytes (including messages headers) received by the replication system.
+    /// </summary>
+    API_FIELD() uint32 DataReceived = 0;
+
+    /// <summary>
+    /// Amount of messages received by the replication system.
+    /// </summary>
+    API_FIELD() uint32 MessagesReceived = 0;
+
+    /// <summary>
+    /// Amount of objects states sent. Counted for each receiver.
+    /// </summary>
+    API_FIELD() uint32 ObjectsSent = 0;
+
+    /// <summary>
+    /// Amount of objects states sent with delta compression (against the state acknowledged by the receiver). Counted for each receiver.
+    /// </summary>
+    API_FIELD() uint32 ObjectsDelta = 0;
+
+    /// <summary>
+    /// Amount of objects states not sent because receiver already has the current state (see NetworkReplicator.EnableDeltaReplication). Counted for each receiver.
+    /// </summary>
+    API_FIELD() uint32 ObjectsSkipped = 0;
+
+    /// <summary>
+    /// Amount of objects states deferred to the next updates because receiver exceeded its bandwidth budget (see NetworkSettings.ClientBandwidth). Counted for each receiver.
+    /// </summary>
+    API_FIELD() uint32 ObjectsDeferred = 0;
+
+    /// <summary>
+    /// Amount of objects states received.
+    /// </summary>
+    API_FIELD() uint32 ObjectsReceived = 0;
+
+    /// <summary>
+    /// Amount of RPCs sent. Counted for each receiver.
+    /// </summary>
+    API_FIELD() uint32 RpcsSent = 0;
+
+    /// <summary>
+    /// Amount of RPCs received.
+    /// </summary>
+    API_FIELD() uint32 RpcsReceived = 0;
+};
+
+template<>
+struct TIsPODType<NetworkReplicationStats>
+{
+    enum { Value = true };
+};
@@ -2,6 +2,7 @@
 
 #include "NetworkStream.h"
 #include "INetworkSerializable.h"
+#include "Engine/Core/Math/Math.h"
 
 NetworkStream::NetworkStream(const SpawnParams& params)
     : ScriptingObject(params)
@@ -37,6 +38,7 @@ void NetworkStream::Initialize(uint32 minCapacity)
 
     // Reset pointer to the start
     _position = _buffer;
+    _bitPosition = 0;
 }
 
 void NetworkStream::Initialize(byte* buffer, uint32 length)
@@ -46,8 +48,200 @@ void NetworkStream::Initialize(byte* buffer, uint32 length)
     _position = _buffer = buffer;
     _length = length;
     _allocated = false;
+    _bitPosition = 0;
 }
 
+void NetworkStream::WriteBits(uint32 value, int32 bits)
+{
+    ASSERT_LOW_LAYER(bits >= 0 && bits <= 32);
+    if (bits < 32)
+        value &= (1u << bits) - 1;
+    while (bits > 0)
+    {
+        if (_bitPosition == 0)
+        {
+            // Start a new byte
+            const byte zero = 0;
+            WriteBytes(&zero, 1);
+        }
+        const int32 count = Math::Min(8 - (int32)_bitPosition, bits);
+        _position[-1] |= (byte)((value & ((1u << count) - 1)) << _bitPosition);
+        value >>= count;
+        bits -= count;
+        _bitPosition = (_bitPosition + count) & 7;
+    }
+}
+
+uint32 NetworkStream::ReadBits(int32 bits)
+{
+    ASSERT_LOW_LAYER(bits >= 0 && bits <= 32);
+    uint32 value = 0;
+    int32 shift = 0;
+    while (bits > 0)
+    {
+        if (_bitPosition == 0)
+        {
+            // Start a new byte
+            ASSERT(GetLength() - GetPosition() >= 1);
+            _position++;
+        }
+        const int32 count = Math::Min(8 - (int32)_bitPosition, bits);
+        value |= (uint32)((_position[-1] >> _bitPosition) & ((1u << count) - 1)) << shift;
+        shift += count;
+        bits -= count;
+        _bitPosition = (_bitPosition + count) & 7;
+    }
+    return value;
+}
+
+void NetworkStream::WriteVarUInt32(uint32 value)
+{
+    while (value >= 0x80)
+    {
+        WriteBits((value & 0x7f) | 0x80, 8);
+        value >>= 7;
+    }
+    WriteBits(value, 8);
+}
+
+uint32 NetworkStream::ReadVarUInt32()
+{
+    uint32 value = 0;
+    for (int32 shift = 0; shift < 35; shift += 7)
+    {
+        const uint32 b = ReadBits(8);
+        value |= (b & 0x7f) << shift;
+        if ((b & 0x80) == 0)
+            break;
+    }
+    return value;
+}
+
+void NetworkStream::WriteVarInt32(int32 value)
+{
+    WriteVarUInt32(((uint32)value << 1) ^ (uint32)(value >> 31));
+}
+
+int32 NetworkStream::ReadVarInt32()
+{
+    const uint32 value = ReadVarUInt32();
+    return (int32)(value >> 1) ^ -(int32)(value & 1);
+}
+
+namespace
+{
+    FORCE_INLINE int32 GetRangeBits(int32 min, int32 max)
+    {
+        const uint32 range = (uint32)((int64)max - (int64)min);
+        return range != 0 ? (int32)Math::FloorLog2(range) + 1 : 0;
+    }
+}
+
+void NetworkStream::WriteIntRanged(int32 value, int32 min, int32 max)
+{
+    ASSERT_LOW_LAYER(min <= max);
+    value = Math::Clamp(value, min, max);
+    WriteBits((uint32)((int64)value - (int64)min), GetRangeBits(min, max));
+}
+
+int32 NetworkStream::ReadIntRanged(int32 min, int32 max)
+{
+    ASSERT_LOW_LAYER(min <= max);
+    const int64 value = (int64)min + (int64)ReadBits(GetRangeBits(min, max));
+    return (int32)Math::Min<int64>(value, max);
+}
+
+void NetworkStream::WriteFloatQuantized(float value, float min, float max, int32 bits)
+{
+    ASSERT_LOW_LAYER(bits > 0 && bits <= 24 && max > min);
+    const uint32 steps = (1u << bits) - 1;
+    const float alpha = Math::Saturate((value - min) / (max - min));
+    WriteBits((uint32)(alpha * (float)steps + 0.5f), bits);
+}
+
+float NetworkStream::ReadFloatQuantized(float min, float max, int32 bits)
+{
+    ASSERT_LOW_LAYER(bits > 0 && bits <= 24 && max > min);
+    const uint32 steps = (1u << bits) - 1;
+    return min + (max - min) * ((float)ReadBits(bits) / (float)steps);
+}
+
+void NetworkStream::WriteFloatPrecision(float value, float precision)
+{
+    ASSERT_LOW_LAYER(precision > 0.0f);
+    // Clamp to the range that safely converts into int32
+    const float steps = Math::Clamp(Math::Round(value / precision), -1000000000.0f, 1000000000.0f);
+    WriteVarInt32((int32)steps);
+}
+
+float NetworkStream::ReadFloatPrecision(float precision)
+{
+    return (float)ReadVarInt32() * precision;
+}
+
+void NetworkStream::WriteFloat3Precision(const Float3& value, float precision)
+{
+    WriteFloatPrecision(value.X, precision);
+    WriteFloatPrecision(value.Y, precision);
+    WriteFloatPrecision(value.Z, precision);
+}
+
+Float3 NetworkStream::ReadFloat3Precision(float precision)
+{
+    Float3 value;
+    value.X = ReadFloatPrecision(precision);
+    value.Y = ReadFloatPrecision(precision);
+    value.Z = ReadFloatPrecision(precision);
+    return value;
+}
+
+// Range of the smallest three components of the normalized quaternion (largest one is at least 1/2 so others are within +-1/sqrt(2))
+#define QUATERNION_COMPONENT_RANGE 0.707107f
+
+void NetworkStream::WriteQuaternionQuantized(const Quaternion& value, int32 bits)
+{
+    Quaternion q = value;
+    q.Normalize();
+
+    // Find the largest component (it's skipped and reconstructed on read)
+    int32 largest = 0;
+    for (int32 i = 1; i < 4; i++)
+    {
+        if (Math::Abs(q.Raw[i]) > Math::Abs(q.Raw[largest]))
+            largest = i;
+    }
+
+    // Ensure the largest component is positive (q and -q represent the same rotation)
+    const float sign = q.Raw[largest] < 0.0f ? -1.0f : 1.0f;
+    WriteBits(largest, 2);
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+            WriteFloatQuantized(q.Raw[i] * sign, -QUATERNION_COMPONENT_RANGE, QUATERNION_COMPONENT_RANGE, bits);
+    }
+}
+
+Quaternion NetworkStream::ReadQuaternionQuantized(int32 bits)
+{
+    Quaternion q;
+    const int32 largest = (int32)ReadBits(2);
+    float sum = 0.0f;
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+        {
+            const float v = ReadFloatQuantized(-QUATERNION_COMPONENT_RANGE, QUATERNION_COMPONENT_RANGE, bits);
+            q.Raw[i] = v;
+            sum += v * v;
+        }
+    }
+    q.Raw[largest] = Math::Sqrt(Math::Max(1.0f - sum, 0.0f));
+    q.Normalize();
+    return q;
+}
+
+#undef QUATERNION_COMPONENT_RANGE
+
 void NetworkStream::Read(INetworkSerializable& obj)
 {
     obj.Deserialize(this);
@@ -80,6 +274,7 @@ void NetworkStream::Close()
     _position = _buffer = nullptr;
     _length = 0;
     _allocated = false;
+    _bitPosition = 0;
 }
 
 uint32 NetworkStream::GetLength()
@@ -96,10 +291,12 @@ void NetworkStream::SetPosition(uint32 seek)
 {
     ASSERT(_length > 0);
     _position = _buffer + seek;
+    _bitPosition = 0;
 }
 
 void NetworkStream::ReadBytes(void* data, uint32 bytes)
 {
+    _bitPosition = 0;
     if (bytes > 0)
     {
         ASSERT(data && GetLength() - GetPosition() >= bytes);
@@ -110,6 +307,8 @@ void NetworkStream::ReadBytes(void* data, uint32 bytes)
 
 void NetworkStream::WriteBytes(const void* data, uint32 bytes)
 {
+    _bitPosition = 0;
+
     // Calculate current position
     const uint32 position = GetPosition();
 
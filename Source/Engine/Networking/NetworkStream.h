@@ -5,6 +5,8 @@
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Serialization/ReadStream.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
 
 class INetworkSerializable;
 
@@ -19,6 +21,7 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     byte* _position = nullptr;
     uint32 _length = 0;
     bool _allocated = false;
+    uint8 _bitPosition = 0; // Amount of bits read/written from the last byte (0 if byte-aligned)
 
 public:
     ~NetworkStream();
@@ -69,6 +72,121 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
         ReadBytes(data, bytes);
     }
 
+public:
+    /// <summary>
+    /// Writes the lowest bits of the value to the stream (bit-packed with the following bit writes). Any byte-level write aligns the stream to the next byte.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="bits">The amount of bits to write (0-32).</param>
+    API_FUNCTION() void WriteBits(uint32 value, int32 bits);
+
+    /// <summary>
+    /// Reads the bits written with WriteBits.
+    /// </summary>
+    /// <param name="bits">The amount of bits to read (0-32).</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() uint32 ReadBits(int32 bits);
+
+    /// <summary>
+    /// Writes a single bit to the stream.
+    /// </summary>
+    API_FUNCTION() FORCE_INLINE void WriteBit(bool value)
+    {
+        WriteBits(value ? 1 : 0, 1);
+    }
+
+    /// <summary>
+    /// Reads a single bit from the stream.
+    /// </summary>
+    API_FUNCTION() FORCE_INLINE bool ReadBit()
+    {
+        return ReadBits(1) != 0;
+    }
+
+    /// <summary>
+    /// Writes the unsigned integer using variable-length encoding (7 bits per byte, small values use less space).
+    /// </summary>
+    API_FUNCTION() void WriteVarUInt32(uint32 value);
+
+    /// <summary>
+    /// Reads the unsigned integer written with WriteVarUInt32.
+    /// </summary>
+    API_FUNCTION() uint32 ReadVarUInt32();
+
+    /// <summary>
+    /// Writes the signed integer using variable-length zig-zag encoding (small absolute values use less space).
+    /// </summary>
+    API_FUNCTION() void WriteVarInt32(int32 value);
+
+    /// <summary>
+    /// Reads the signed integer written with WriteVarInt32.
+    /// </summary>
+    API_FUNCTION() int32 ReadVarInt32();
+
+    /// <summary>
+    /// Writes the integer from the given range using the minimal amount of bits. Value is clamped into the range.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="min">The minimum value (inclusive).</param>
+    /// <param name="max">The maximum value (inclusive).</param>
+    API_FUNCTION() void WriteIntRanged(int32 value, int32 min, int32 max);
+
+    /// <summary>
+    /// Reads the integer written with WriteIntRanged (using the same range).
+    /// </summary>
+    /// <param name="min">The minimum value (inclusive).</param>
+    /// <param name="max">The maximum value (inclusive).</param>
+    API_FUNCTION() int32 ReadIntRanged(int32 min, int32 max);
+
+    /// <summary>
+    /// Writes the float quantized into the given range with fixed amount of bits. Value is clamped into the range.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="min">The minimum value.</param>
+    /// <param name="max">The maximum value.</param>
+    /// <param name="bits">The amount of bits to use (1-24). The precision is (max - min) / (2^bits - 1).</param>
+    API_FUNCTION() void WriteFloatQuantized(float value, float min, float max, int32 bits);
+
+    /// <summary>
+    /// Reads the float written with WriteFloatQuantized (using the same range and bits).
+    /// </summary>
+    API_FUNCTION() float ReadFloatQuantized(float min, float max, int32 bits);
+
+    /// <summary>
+    /// Writes the unbounded float with a fixed precision (value is rounded to the multiple of precision and written as variable-length integer).
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="precision">The quantization step (eg. 0.1 for position in centimeters to have 1 millimeter precision).</param>
+    API_FUNCTION() void WriteFloatPrecision(float value, float precision);
+
+    /// <summary>
+    /// Reads the float written with WriteFloatPrecision (using the same precision).
+    /// </summary>
+    API_FUNCTION() float ReadFloatPrecision(float precision);
+
+    /// <summary>
+    /// Writes the vector with a fixed precision for each component (see WriteFloatPrecision).
+    /// </summary>
+    API_FUNCTION() void WriteFloat3Precision(const Float3& value, float precision);
+
+    /// <summary>
+    /// Reads the vector written with WriteFloat3Precision (using the same precision).
+    /// </summary>
+    API_FUNCTION() Float3 ReadFloat3Precision(float precision);
+
+    /// <summary>
+    /// Writes the rotation using smallest-three compression (index of the largest component and the other three components quantized).
+    /// </summary>
+    /// <param name="value">The rotation to write (normalized).</param>
+    /// <param name="bits">The amount of bits per component (1-24). 10 bits give ~0.1 degree precision.</param>
+    API_FUNCTION() void WriteQuaternionQuantized(const Quaternion& value, int32 bits = 10);
+
+    /// <summary>
+    /// Reads the rotation written with WriteQuaternionQuantized (using the same bits).
+    /// </summary>
+    API_FUNCTION() Quaternion ReadQuaternionQuantized(int32 bits = 10);
+
+public:
     using ReadStream::Read;
     void Read(INetworkSerializable& obj);
     void Read(INetworkSerializable* obj);
@@ -4,6 +4,9 @@
 #include "Engine/Core/Random.h"
 #include "Engine/Utilities/Noise.h"
 #include "Engine/Core/Types/CommonValue.h"
+#include "Engine/Particles/ParticleKernels.h"
+#include "Engine/Particles/ParticleEffect.h"
+#include "Engine/Physics/PhysicsScene.h"
 
 // ReSharper disable CppCStyleCast
 // ReSharper disable CppClangTidyClangDiagnosticCastAlign
@@ -47,6 +50,23 @@ namespace
             return VariantType::Pointer;
         }
     }
+
+    int32 GetFloatComponents(ParticleAttribute::ValueTypes type)
+    {
+        switch (type)
+        {
+        case ParticleAttribute::ValueTypes::Float:
+            return 1;
+        case ParticleAttribute::ValueTypes::Float2:
+            return 2;
+        case ParticleAttribute::ValueTypes::Float3:
+            return 3;
+        case ParticleAttribute::ValueTypes::Float4:
+            return 4;
+        default:
+            return 0;
+        }
+    }
 }
 
 int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
@@ -55,8 +75,7 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     auto& context = *Context.Get();
     auto& data = context.Data->SpawnModulesData[index];
 
-    // Accumulate the previous frame fraction
-    float spawnCount = data.SpawnCounter;
+    float spawnCount = 0.0f;
 
     // Calculate particles to spawn during this frame
     switch (node->TypeID)
@@ -109,8 +128,10 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     }
     }
 
+    // Scale the spawn rate (from the effect significance) and accumulate the previous frame fraction
+    spawnCount = Math::Max(data.SpawnCounter + spawnCount * context.Data->SpawnScale, 0.0f);
+
     // Calculate actual spawn amount
-    spawnCount = Math::Max(spawnCount, 0.0f);
     const int32 result = Math::FloorToInt(spawnCount);
     spawnCount -= (float)result;
     data.SpawnCounter = spawnCount;
@@ -118,6 +139,23 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     return result;
 }
 
+bool ParticleEmitterGraphCPUExecutor::CanProcessModuleAsync(const ParticleEmitterGraphCPUNode* node) const
+{
+    switch (node->TypeID)
+    {
+    // Kill (sphere)
+    case 306:
+    // Kill (box)
+    case 307:
+    // Kill (custom)
+    case 308:
+        // Removes particles (moves the last particle in place of the killed one)
+        return false;
+    default:
+        return true;
+    }
+}
+
 void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode* node, int32 particlesStart, int32 particlesEnd)
 {
     auto& context = *Context.Get();
@@ -134,12 +172,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         auto spriteFacingMode = node->Values[2].AsInt;
         {
             auto& attribute = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
-            byte* spriteFacingModePtr = start + attribute.Offset;
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                *((int32*)spriteFacingModePtr) = spriteFacingMode;
-                spriteFacingModePtr += stride;
-            }
+            ParticleKernels::Set(start + attribute.Offset, stride, &spriteFacingMode, sizeof(int32), particlesEnd - particlesStart);
         }
         if ((ParticleSpriteFacingMode)spriteFacingMode == ParticleSpriteFacingMode::CustomFacingVector ||
             (ParticleSpriteFacingMode)spriteFacingMode == ParticleSpriteFacingMode::FixedAxis)
@@ -160,11 +193,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
             else
             {
                 const Float3 vector = (Float3)GetValue(box, 3);
-                for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-                {
-                    *((Float3*)customFacingVectorPtr) = vector;
-                    customFacingVectorPtr += stride;
-                }
+                ParticleKernels::Set(customFacingVectorPtr, stride, &vector, sizeof(Float3), particlesEnd - particlesStart);
             }
         }
         break;
@@ -177,12 +206,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         auto modelFacingMode = node->Values[2].AsInt;
         {
             auto& attribute = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
-            byte* modelFacingModePtr = start + attribute.Offset;
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                *((int32*)modelFacingModePtr) = modelFacingMode;
-                modelFacingModePtr += stride;
-            }
+            ParticleKernels::Set(start + attribute.Offset, stride, &modelFacingMode, sizeof(int32), particlesEnd - particlesStart);
         }
         break;
     }
@@ -191,12 +215,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     {
         PARTICLE_EMITTER_MODULE("Update Age");
         auto& attribute = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
-        byte* agePtr = start + attribute.Offset;
-        for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-        {
-            *((float*)agePtr) += context.DeltaTime;
-            agePtr += stride;
-        }
+        ParticleKernels::Add(start + attribute.Offset, stride, context.DeltaTime, particlesEnd - particlesStart);
         break;
     }
     // Gravity/Force
@@ -209,6 +228,21 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         auto box = node->GetBox(0);
         if (node->UsePerParticleDataResolve())
         {
+            if (const auto program = GetProgram(node, box, 2, 3))
+            {
+                InitProgram(*program);
+                for (int32 batchStart = particlesStart; batchStart < particlesEnd; batchStart += PARTICLE_EMITTER_PROGRAM_BATCH_SIZE)
+                {
+                    const int32 batchCount = Math::Min(particlesEnd - batchStart, PARTICLE_EMITTER_PROGRAM_BATCH_SIZE);
+                    const Float4* forces = ExecuteProgram(*program, batchStart, batchCount);
+                    for (int32 i = 0; i < batchCount; i++)
+                    {
+                        *((Float3*)velocityPtr) += Float3(forces[i]) * context.DeltaTime;
+                        velocityPtr += stride;
+                    }
+                }
+                break;
+            }
             for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
             {
                 context.ParticleIndex = particleIndex;
@@ -220,11 +254,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             const Float3 force = (Float3)GetValue(box, 2);
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                *((Float3*)velocityPtr) += force * context.DeltaTime;
-                velocityPtr += stride;
-            }
+            ParticleKernels::Add(velocityPtr, stride, force * context.DeltaTime, particlesEnd - particlesStart);
         }
         break;
     }
@@ -469,10 +499,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             INPUTS_FETCH();
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                LOGIC();
-            }
+            ParticleKernels::LinearDrag(velocityPtr, massPtr, spriteSizePtr, stride, drag * context.DeltaTime, particlesEnd - particlesStart);
         }
 #undef INPUTS_FETCH
 #undef LOGIC
@@ -550,6 +577,21 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         ValueType type(GetVariantType(attribute.ValueType));
         if (node->UsePerParticleDataResolve())
         {
+            if (const auto program = GetProgram(node, box, 4, GetFloatComponents(attribute.ValueType)))
+            {
+                InitProgram(*program);
+                for (int32 batchStart = particlesStart; batchStart < particlesEnd; batchStart += PARTICLE_EMITTER_PROGRAM_BATCH_SIZE)
+                {
+                    const int32 batchCount = Math::Min(particlesEnd - batchStart, PARTICLE_EMITTER_PROGRAM_BATCH_SIZE);
+                    const Float4* values = ExecuteProgram(*program, batchStart, batchCount);
+                    for (int32 i = 0; i < batchCount; i++)
+                    {
+                        Platform::MemoryCopy(dataPtr, &values[i], dataSize);
+                        dataPtr += stride;
+                    }
+                }
+                break;
+            }
             Value value;
             for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
             {
@@ -562,11 +604,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             const Value value = GetValue(box, 4).Cast(type);
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                Platform::MemoryCopy(dataPtr, &value.AsPointer, dataSize);
-                dataPtr += stride;
-            }
+            ParticleKernels::Set(dataPtr, stride, &value.AsPointer, dataSize, particlesEnd - particlesStart);
         }
         break;
     }
@@ -608,6 +646,21 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         ValueType type(GetVariantType(attribute.ValueType));
         if (node->UsePerParticleDataResolve())
         {
+            if (const auto program = GetProgram(node, box, 2, GetFloatComponents(attribute.ValueType)))
+            {
+                InitProgram(*program);
+                for (int32 batchStart = particlesStart; batchStart < particlesEnd; batchStart += PARTICLE_EMITTER_PROGRAM_BATCH_SIZE)
+                {
+                    const int32 batchCount = Math::Min(particlesEnd - batchStart, PARTICLE_EMITTER_PROGRAM_BATCH_SIZE);
+                    const Float4* values = ExecuteProgram(*program, batchStart, batchCount);
+                    for (int32 i = 0; i < batchCount; i++)
+                    {
+                        Platform::MemoryCopy(dataPtr, &values[i], dataSize);
+                        dataPtr += stride;
+                    }
+                }
+                break;
+            }
             Value value;
             for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
             {
@@ -620,11 +673,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             const Value value = GetValue(box, 2).Cast(type);
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                Platform::MemoryCopy(dataPtr, &value.AsPointer, dataSize);
-                dataPtr += stride;
-            }
+            ParticleKernels::Set(dataPtr, stride, &value.AsPointer, dataSize, particlesEnd - particlesStart);
         }
         break;
     }
@@ -1418,7 +1467,81 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     // Collision (Global SDF)
     case 336:
     {
-        // Not supported
+        // Global SDF is not available on a CPU so collide particles with the physics scene instead (using a single batched query for all particles)
+        COLLISION_BEGIN();
+        PhysicsScene* physicsScene = context.Effect->GetPhysicsScene();
+        if (!physicsScene)
+            break;
+        const bool isLocal = context.Emitter->SimulationSpace == ParticlesSimulationSpace::Local;
+        const Transform& transform = context.Effect->GetTransform();
+        const int32 count = particlesEnd - particlesStart;
+        const bool perParticle = node->UsePerParticleDataResolve();
+        auto& queries = context.CollisionQueries;
+        auto& hits = context.CollisionHits;
+        queries.Resize(count, false);
+        hits.Resize(count, false);
+
+        // Build queries (sweep from the current position along the movement during this update)
+        float queryRadius = (float)GetValue(radiusBox, 3);
+        for (int32 i = 0; i < count; i++)
+        {
+            if (perParticle)
+            {
+                context.ParticleIndex = particlesStart + i;
+                queryRadius = (float)GetValue(radiusBox, 3);
+            }
+            Vector3 position = *(Float3*)(positionPtr + i * stride);
+            Vector3 delta = *(Float3*)(velocityPtr + i * stride) * context.DeltaTime;
+            if (isLocal)
+            {
+                position = transform.LocalToWorld(position);
+                delta = transform.LocalToWorldVector(delta);
+            }
+            const float distance = (float)delta.Length();
+            RayCastQuery& query = queries.Get()[i];
+            query.Origin = position;
+            query.Direction = distance > ZeroTolerance ? delta / distance : Vector3::Down;
+            query.MaxDistance = distance + queryRadius;
+        }
+        physicsScene->RayCastBatch(ToSpan(queries), ToSpan(hits), MAX_uint32, false);
+
+        // Resolve collisions
+#define INPUTS_FETCH() \
+	COLLISION_INPUTS_FETCH()
+#define LOGIC() \
+	const RayCastHit& hit = hits.Get()[particleIndex - particlesStart]; \
+	if (hit.Collider) \
+	{ \
+		Float3 velocity = *(Float3*)velocityPtr; \
+		Vector3 hitPosition = hit.Point + hit.Normal * radius; \
+		Float3 n = (Float3)hit.Normal; \
+		if (isLocal) \
+		{ \
+			hitPosition = transform.WorldToLocal(hitPosition); \
+			n = Float3::Normalize((Float3)transform.WorldToLocalVector(hit.Normal)); \
+		} \
+		*(Float3*)positionPtr = (Float3)hitPosition; \
+	COLLISION_LOGIC()
+
+        if (perParticle)
+        {
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                context.ParticleIndex = particleIndex;
+                INPUTS_FETCH();
+                LOGIC();
+            }
+        }
+        else
+        {
+            INPUTS_FETCH();
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                LOGIC();
+            }
+        }
+#undef INPUTS_FETCH
+#undef LOGIC
         break;
     }
 
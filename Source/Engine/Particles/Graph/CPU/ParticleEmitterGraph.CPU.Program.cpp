@@ -0,0 +1,985 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ParticleEmitterGraph.CPU.h"
+#include "Engine/Core/Random.h"
+#include "Engine/Particles/ParticleEmitter.h"
+
+// ReSharper disable CppCStyleCast
+// ReSharper disable CppClangTidyClangDiagnosticOldStyleCast
+
+#define BATCH_SIZE PARTICLE_EMITTER_PROGRAM_BATCH_SIZE
+
+namespace
+{
+    typedef ParticleEmitterGraphCPUProgram Program;
+    typedef ParticleEmitterGraphCPUProgram::OpCode OpCode;
+
+    int32 GetComponents(VariantType::Types type)
+    {
+        switch (type)
+        {
+        case VariantType::Float:
+            return 1;
+        case VariantType::Float2:
+            return 2;
+        case VariantType::Float3:
+            return 3;
+        case VariantType::Float4:
+        case VariantType::Color:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+
+    VariantType::Types GetFloatType(int32 components)
+    {
+        switch (components)
+        {
+        case 1:
+            return VariantType::Float;
+        case 2:
+            return VariantType::Float2;
+        case 3:
+            return VariantType::Float3;
+        default:
+            return VariantType::Float4;
+        }
+    }
+
+    int32 GetComponents(ParticleAttribute::ValueTypes type)
+    {
+        switch (type)
+        {
+        case ParticleAttribute::ValueTypes::Float:
+            return 1;
+        case ParticleAttribute::ValueTypes::Float2:
+            return 2;
+        case ParticleAttribute::ValueTypes::Float3:
+            return 3;
+        case ParticleAttribute::ValueTypes::Float4:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+
+    // Matches the Variant::Cast between the float types (scalar gets broadcast, vector gets truncated or padded with zeros)
+    FORCE_INLINE Float4 CastValue(const Float4& value, int32 from, int32 to)
+    {
+        if (from == 1)
+            return Float4(value.X);
+        Float4 result = Float4::Zero;
+        for (int32 c = 0; c < to && c < from; c++)
+            result.Raw[c] = value.Raw[c];
+        return result;
+    }
+
+    template<typename Op>
+    FORCE_INLINE void Unary(Float4* dst, const Float4* a, int32 aStride, int32 components, int32 count, Op op)
+    {
+        for (int32 i = 0; i < count; i++)
+        {
+            const Float4& va = a[i * aStride];
+            for (int32 c = 0; c < components; c++)
+                dst[i].Raw[c] = op(va.Raw[c]);
+        }
+    }
+
+    template<typename Op>
+    FORCE_INLINE void Binary(Float4* dst, const Float4* a, int32 aStride, const Float4* b, int32 bStride, int32 components, int32 count, Op op)
+    {
+        for (int32 i = 0; i < count; i++)
+        {
+            const Float4& va = a[i * aStride];
+            const Float4& vb = b[i * bStride];
+            for (int32 c = 0; c < components; c++)
+                dst[i].Raw[c] = op(va.Raw[c], vb.Raw[c]);
+        }
+    }
+
+    template<typename Op>
+    FORCE_INLINE void Ternary(Float4* dst, const Float4* a, int32 aStride, const Float4* b, int32 bStride, const Float4* c, int32 cStride, int32 components, int32 count, Op op)
+    {
+        for (int32 i = 0; i < count; i++)
+        {
+            const Float4& va = a[i * aStride];
+            const Float4& vb = b[i * bStride];
+            const Float4& vc = c[i * cStride];
+            for (int32 j = 0; j < components; j++)
+                dst[i].Raw[j] = op(va.Raw[j], vb.Raw[j], vc.Raw[j]);
+        }
+    }
+
+    // Matches VisjectExecutor::ProcessGroupTools for the Color Gradient (at least 2 stops)
+    Float4 SampleGradient(const float* stops, int32 count, float time)
+    {
+        const float* last = stops + (count - 1) * 5;
+        if (time >= last[0])
+            return *(const Float4*)(last + 1);
+        const float* prev = stops;
+        for (int32 i = 1; i < count; i++)
+        {
+            const float* cur = stops + i * 5;
+            if (time <= cur[0])
+                return Float4::Lerp(*(const Float4*)(prev + 1), *(const Float4*)(cur + 1), Math::Saturate((time - prev[0]) / (cur[0] - prev[0])));
+            prev = cur;
+        }
+        return *(const Float4*)(last + 1);
+    }
+}
+
+/// <summary>
+/// The particle graph compiler that converts the per-particle graph expressions into the programs (see ParticleEmitterGraphCPUProgram).
+/// </summary>
+class ParticleEmitterGraphCPUProgramCompiler
+{
+public:
+    typedef ParticleEmitterGraphCPUNode Node;
+    typedef VisjectExecutor::Box Box;
+    typedef VisjectExecutor::Value Value;
+
+    struct Register
+    {
+        int32 Index;
+        int32 Components;
+        bool Uniform;
+
+        Register()
+            : Index(-1)
+            , Components(0)
+            , Uniform(false)
+        {
+        }
+
+        bool IsValid() const
+        {
+            return Index != -1;
+        }
+    };
+
+private:
+    ParticleEmitterGraphCPUExecutor& _executor;
+    ParticleEmitterGraphCPUContext& _context;
+    Program& _program;
+    Dictionary<Box*, Register> _outputs;
+
+public:
+    ParticleEmitterGraphCPUProgramCompiler(ParticleEmitterGraphCPUExecutor& executor, ParticleEmitterGraphCPUContext& context, Program& program)
+        : _executor(executor)
+        , _context(context)
+        , _program(program)
+    {
+    }
+
+    bool Compile(Node* node, Box* box, int32 defaultValueBoxIndex, int32 components)
+    {
+        Register result = box->HasConnection() ? CompileOutput(node, box->FirstConnection()) : AddConstant(node->Values[defaultValueBoxIndex]);
+        if (!result.IsValid() || result.Uniform)
+            return true;
+        result = Cast(result, components);
+        if (!result.IsValid())
+            return true;
+        _program.Result = (byte)result.Index;
+        return false;
+    }
+
+private:
+#define CHECK(reg) if (!reg.IsValid()) return Register()
+
+    Register AddUniform(Node* caller, Box* box, const Value& value, VariantType::Types type, int32 source = -1)
+    {
+        Register result;
+        const int32 components = GetComponents(type);
+        if (components == 0 || _program.Uniforms.Count() >= PARTICLE_EMITTER_PROGRAM_MAX_REGISTERS)
+            return result;
+        result.Index = _program.Uniforms.Count();
+        result.Components = components;
+        result.Uniform = true;
+        auto& uniform = _program.Uniforms.AddOne();
+        uniform.Caller = (VisjectExecutor::Node*)caller;
+        uniform.Box = box;
+        uniform.Value = value;
+        uniform.Type = type;
+        uniform.Source = source;
+        return result;
+    }
+
+    Register AddConstant(const Value& value)
+    {
+        return AddUniform(nullptr, nullptr, value, value.Type.Type);
+    }
+
+    Register Emit(OpCode op, int32 components, const Register& a = Register(), const Register& b = Register(), const Register& c = Register(), const Register& d = Register())
+    {
+        Register result;
+        if (_program.RegistersCount >= PARTICLE_EMITTER_PROGRAM_MAX_REGISTERS)
+            return result;
+        result.Index = _program.RegistersCount++;
+        result.Components = components;
+        auto& e = _program.Instructions.AddOne();
+        e.Op = op;
+        e.Components = (byte)components;
+        e.SrcComponents = (byte)a.Components;
+        e.UniformMask = 0;
+        e.Dst = (byte)result.Index;
+        const Register* src[4] = { &a, &b, &c, &d };
+        for (int32 i = 0; i < 4; i++)
+        {
+            e.Src[i] = src[i]->IsValid() ? (byte)src[i]->Index : 0;
+            if (src[i]->Uniform)
+                e.UniformMask |= 1 << i;
+        }
+        e.Data[0] = e.Data[1] = 0;
+        e.Ptr = nullptr;
+        return result;
+    }
+
+    Register EmitLerp(const Register& a, const Register& b, const Register& alpha)
+    {
+        const Register result = Emit(OpCode::Lerp, a.Components, a, b, alpha);
+        CHECK(result);
+        _program.Instructions.Last().Data[0] = alpha.Components;
+        return result;
+    }
+
+    Register Cast(const Register& reg, int32 components)
+    {
+        CHECK(reg);
+        if (reg.Components == components)
+            return reg;
+        if (reg.Uniform)
+            return AddUniform(nullptr, nullptr, Value::Null, GetFloatType(components), reg.Index);
+        return Emit(OpCode::Cast, components, reg);
+    }
+
+    Register LoadAttribute(ParticleEmitterGraphCPUNode* node, int32 index, int32 components)
+    {
+        Register result;
+        if (components == 0)
+            return result;
+        result = Emit(OpCode::Attribute, components);
+        CHECK(result);
+        _program.Instructions.Last().Data[0] = _context.Data->Buffer->Layout->Attributes[_context.AttributesRemappingTable[node->Attributes[index]]].Offset;
+        return result;
+    }
+
+    // Matches VisjectExecutor::tryGetValue(box, defaultValueBoxIndex, defaultValue) (use -1 to skip the node default values)
+    Register CompileInput(Node* node, int32 boxId, int32 defaultValueBoxIndex, const Value& defaultValue)
+    {
+        Box* box = node->TryGetBox(boxId);
+        if (box && box->HasConnection())
+            return CompileOutput(node, box->FirstConnection());
+        if (defaultValueBoxIndex >= 0 && node->Values.Count() > defaultValueBoxIndex)
+            return AddConstant(node->Values[defaultValueBoxIndex]);
+        return AddConstant(defaultValue);
+    }
+
+    Register CompileOutput(Node* caller, Box* box)
+    {
+        const Register* cached = _outputs.TryGet(box);
+        if (cached)
+            return *cached;
+        const auto node = box->GetParent<Node>();
+        Register result;
+        if (node->IsConstant && !node->UsesParticleData)
+        {
+            // Evaluate the type of the value that is the same for all particles (evaluated once per update)
+            const Value value = _executor.eatBox((VisjectExecutor::Node*)caller, box);
+            result = AddUniform(caller, box, Value::Null, value.Type.Type);
+        }
+        else
+        {
+            result = CompileNode(node, box);
+        }
+
+        // Random values are evaluated per usage (as in the graph interpreter)
+        if (result.IsValid() && node->IsConstant)
+            _outputs.Add(box, result);
+        return result;
+    }
+
+    Register CompileNode(ParticleEmitterGraphCPUNode* node, Box* box)
+    {
+        switch (node->GroupID)
+        {
+        case 3:
+            return CompileMath(node);
+        case 4:
+            return CompilePacking(node, box);
+        case 7:
+            return CompileTools(node);
+        case 14:
+            return CompileParticles(node);
+        default:
+            return Register();
+        }
+    }
+
+    Register CompileMath(ParticleEmitterGraphCPUNode* node)
+    {
+        OpCode op;
+        switch (node->TypeID)
+        {
+        // Add, Subtract, Multiply, Divide, Max, Min, Pow, Fmod, Atan2
+        case 1:
+        case 2:
+        case 3:
+        case 5:
+        case 21:
+        case 22:
+        case 23:
+        case 40:
+        case 41:
+        {
+            // @formatter:off
+            switch (node->TypeID)
+            {
+            case 1: op = OpCode::Add; break;
+            case 2: op = OpCode::Sub; break;
+            case 3: op = OpCode::Mul; break;
+            case 5: op = OpCode::Div; break;
+            case 21: op = OpCode::Max; break;
+            case 22: op = OpCode::Min; break;
+            case 23: op = OpCode::Pow; break;
+            case 40: op = OpCode::Mod; break;
+            default: op = OpCode::Atan2; break;
+            }
+            // @formatter:on
+            Register a = CompileInput(node, 0, 0, Value::Zero);
+            Register b = CompileInput(node, 1, 1, Value::Zero);
+            CHECK(a);
+            CHECK(b);
+            if (node->GetBox(0)->HasConnection())
+                b = Cast(b, a.Components);
+            else
+                a = Cast(a, b.Components);
+            CHECK(a);
+            CHECK(b);
+            return Emit(op, a.Components, a, b);
+        }
+        // Absolute Value, Ceil, Cosine, Floor, Round, Saturate, Sine, Sqrt, Tangent, Negate, 1 - Value, Asine, Acosine, Atan, Trunc, Frac, Degrees, Radians
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 27:
+        case 28:
+        case 33:
+        case 34:
+        case 35:
+        case 38:
+        case 39:
+        case 43:
+        case 44:
+        {
+            // @formatter:off
+            switch (node->TypeID)
+            {
+            case 7: op = OpCode::Abs; break;
+            case 8: op = OpCode::Ceil; break;
+            case 9: op = OpCode::Cos; break;
+            case 10: op = OpCode::Floor; break;
+            case 13: op = OpCode::Round; break;
+            case 14: op = OpCode::Saturate; break;
+            case 15: op = OpCode::Sin; break;
+            case 16: op = OpCode::Sqrt; break;
+            case 17: op = OpCode::Tan; break;
+            case 27: op = OpCode::Negate; break;
+            case 28: op = OpCode::OneMinus; break;
+            case 33: op = OpCode::Asin; break;
+            case 34: op = OpCode::Acos; break;
+            case 35: op = OpCode::Atan; break;
+            case 38: op = OpCode::Trunc; break;
+            case 39: op = OpCode::Frac; break;
+            case 43: op = OpCode::Degrees; break;
+            default: op = OpCode::Radians; break;
+            }
+            // @formatter:on
+            const Register a = CompileInput(node, 0, -1, Value::Zero);
+            CHECK(a);
+            return Emit(op, a.Components, a);
+        }
+        // Length
+        case 11:
+        {
+            const Register a = CompileInput(node, 0, -1, Value::Zero);
+            CHECK(a);
+            if (a.Components == 1)
+                return Register();
+            return Emit(OpCode::Length, 1, a);
+        }
+        // Normalize
+        case 12:
+        {
+            const Register a = CompileInput(node, 0, -1, Value::Zero);
+            CHECK(a);
+            return Emit(a.Components == 1 ? OpCode::Saturate : OpCode::Normalize, a.Components, a);
+        }
+        // Cross, Distance, Dot
+        case 18:
+        case 19:
+        case 20:
+        {
+            const Register a = CompileInput(node, 0, 0, Value::Zero);
+            CHECK(a);
+            if (node->TypeID == 18 ? a.Components != 3 : a.Components == 1)
+                return Register();
+            const Register b = Cast(CompileInput(node, 1, 1, Value::Zero), a.Components);
+            CHECK(b);
+            if (node->TypeID == 18)
+                return Emit(OpCode::Cross, 3, a, b);
+            return Emit(node->TypeID == 19 ? OpCode::Distance : OpCode::Dot, 1, a, b);
+        }
+        // Clamp, Mad
+        case 24:
+        case 31:
+        {
+            const Register a = CompileInput(node, 0, -1, Value::Zero);
+            CHECK(a);
+            const Register b = Cast(CompileInput(node, 1, 0, node->TypeID == 24 ? Value::Zero : Value::One), a.Components);
+            const Register c = Cast(CompileInput(node, 2, 1, node->TypeID == 24 ? Value::One : Value::Zero), a.Components);
+            CHECK(b);
+            CHECK(c);
+            return Emit(node->TypeID == 24 ? OpCode::Clamp : OpCode::Mad, a.Components, a, b, c);
+        }
+        // Lerp
+        case 25:
+        {
+            const Register a = CompileInput(node, 0, 0, Value::Zero);
+            CHECK(a);
+            const Register b = Cast(CompileInput(node, 1, 1, Value::One), a.Components);
+            const Register alpha = Cast(CompileInput(node, 2, 2, Value::Zero), 1);
+            CHECK(b);
+            CHECK(alpha);
+            return EmitLerp(a, b, alpha);
+        }
+        // Bias and Scale
+        case 36:
+        {
+            const Register a = Cast(CompileInput(node, 0, -1, Value::Zero), 3);
+            CHECK(a);
+            const Register bias = AddConstant(Value(Float3(node->Values[0].AsFloat)));
+            const Register scale = AddConstant(Value(Float3(node->Values[1].AsFloat)));
+            CHECK(bias);
+            CHECK(scale);
+            const Register result = Emit(OpCode::Add, 3, a, bias);
+            CHECK(result);
+            return Emit(OpCode::Mul, 3, result, scale);
+        }
+        default:
+            return Register();
+        }
+    }
+
+    Register CompilePacking(ParticleEmitterGraphCPUNode* node, Box* box)
+    {
+        switch (node->TypeID)
+        {
+        // Pack
+        case 20:
+        case 21:
+        case 22:
+        {
+            const int32 components = node->TypeID - 18;
+            Register src[4];
+            for (int32 i = 0; i < components; i++)
+            {
+                src[i] = Cast(CompileInput(node, i + 1, i, Value::Zero), 1);
+                CHECK(src[i]);
+            }
+            return Emit(OpCode::Pack, components, src[0], src[1], src[2], src[3]);
+        }
+        // Unpack
+        case 30:
+        case 31:
+        case 32:
+        {
+            const int32 components = node->TypeID - 28;
+            const int32 component = box->ID - 1;
+            if (component < 0 || component >= components)
+                return Register();
+            const Register a = Cast(CompileInput(node, 0, -1, Value::Zero), components);
+            CHECK(a);
+            const Register result = Emit(OpCode::Component, 1, a);
+            CHECK(result);
+            _program.Instructions.Last().Data[0] = component;
+            return result;
+        }
+        default:
+            return Register();
+        }
+    }
+
+    Register CompileTools(ParticleEmitterGraphCPUNode* node)
+    {
+        switch (node->TypeID)
+        {
+        // Color Gradient
+        case 10:
+        {
+            const int32 count = (int32)node->Values[0];
+            if (count < 2)
+                return Register();
+            const Register time = Cast(CompileInput(node, 0, -1, Value::Zero), 1);
+            CHECK(time);
+            const Register result = Emit(OpCode::Gradient, 4, time);
+            CHECK(result);
+            auto& e = _program.Instructions.Last();
+            e.Data[0] = _program.Data.Count();
+            e.Data[1] = count;
+            for (int32 i = 0; i < count; i++)
+            {
+                const Color color = (Color)node->Values[i * 2 + 2];
+                _program.Data.Add((float)node->Values[i * 2 + 1]);
+                _program.Data.Add(color.Raw, 4);
+            }
+            return result;
+        }
+        // Curve
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        {
+            const auto graph = _executor.GetCurrentGraph();
+            const int32 curveIndex = node->Data.Curve.CurveIndex;
+            const Register time = Cast(CompileInput(node, 0, -1, Value::Zero), 1);
+            CHECK(time);
+            const int32 components = node->TypeID - 11;
+            const Register result = Emit(OpCode::Curve, components, time);
+            CHECK(result);
+            auto& e = _program.Instructions.Last();
+            switch (components)
+            {
+            case 1:
+                e.Ptr = &graph->FloatCurves[curveIndex];
+                break;
+            case 2:
+                e.Ptr = &graph->Float2Curves[curveIndex];
+                break;
+            case 3:
+                e.Ptr = &graph->Float3Curves[curveIndex];
+                break;
+            default:
+                e.Ptr = &graph->Float4Curves[curveIndex];
+                break;
+            }
+            return result;
+        }
+        default:
+            return Register();
+        }
+    }
+
+    Register CompileParticles(ParticleEmitterGraphCPUNode* node)
+    {
+        switch (node->TypeID)
+        {
+        // Particle Attribute
+        case 100:
+            return LoadAttribute(node, 0, GetComponents((ParticleAttribute::ValueTypes)node->Attributes[1]));
+        // Particle Lifetime, Age, Mass, Radius
+        case 102:
+        case 103:
+        case 107:
+        case 111:
+            return LoadAttribute(node, 0, 1);
+        // Particle Sprite Size
+        case 106:
+            return LoadAttribute(node, 0, 2);
+        // Particle Position, Velocity, Rotation, Angular Velocity, Scale
+        case 101:
+        case 105:
+        case 108:
+        case 109:
+        case 112:
+            return LoadAttribute(node, 0, 3);
+        // Particle Color
+        case 104:
+            return LoadAttribute(node, 0, 4);
+        // Particle Normalized Age
+        case 110:
+        {
+            const Register result = Emit(OpCode::NormalizedAge, 1);
+            CHECK(result);
+            const auto& attributes = _context.Data->Buffer->Layout->Attributes;
+            auto& e = _program.Instructions.Last();
+            e.Data[0] = attributes[_context.AttributesRemappingTable[node->Attributes[0]]].Offset;
+            e.Data[1] = attributes[_context.AttributesRemappingTable[node->Attributes[1]]].Offset;
+            return result;
+        }
+        // Random
+        case 208:
+        case 209:
+        case 210:
+        case 211:
+            return Emit(OpCode::Random, node->TypeID - 207);
+        // Random Range
+        case 213:
+        case 214:
+        case 215:
+        case 216:
+        {
+            const int32 components = node->TypeID - 212;
+            const Register a = Cast(CompileInput(node, 1, 0, Value::Zero), components);
+            const Register b = Cast(CompileInput(node, 2, 1, Value::Zero), components);
+            CHECK(a);
+            CHECK(b);
+            const Register alpha = Emit(OpCode::Random, components);
+            CHECK(alpha);
+            return EmitLerp(a, b, alpha);
+        }
+        // Particle Position (world space)
+        case 212:
+            if (_context.Emitter->SimulationSpace != ParticlesSimulationSpace::World)
+                return Register();
+            return LoadAttribute(node, 0, 3);
+        default:
+            return Register();
+        }
+    }
+
+#undef CHECK
+};
+
+const ParticleEmitterGraphCPUProgram* ParticleEmitterGraphCPUExecutor::GetProgram(ParticleEmitterGraphCPUNode* node, Box* box, int32 defaultValueBoxIndex, int32 components)
+{
+    ScopeLock lock(_graph._programsLocker);
+    if (!node->ProgramCompiled)
+    {
+        node->ProgramCompiled = true;
+        auto& context = *Context.Get();
+        if (context.GraphStack.Count() != 1 || components < 1 || components > 4)
+            return nullptr;
+        auto program = New<Program>();
+        ParticleEmitterGraphCPUProgramCompiler compiler(*this, context, *program);
+        if (compiler.Compile(node, box, defaultValueBoxIndex, components))
+        {
+            Delete(program);
+        }
+        else
+        {
+            _graph._programs.Add(program);
+            node->Program = program;
+        }
+    }
+    return node->Program;
+}
+
+void ParticleEmitterGraphCPUExecutor::InitProgram(const ParticleEmitterGraphCPUProgram& program)
+{
+    auto& context = *Context.Get();
+    const int32 uniformsCount = program.Uniforms.Count();
+    context.ProgramRegisters.Resize(uniformsCount + program.RegistersCount * BATCH_SIZE, false);
+    Float4* uniforms = context.ProgramRegisters.Get();
+    for (int32 i = 0; i < uniformsCount; i++)
+    {
+        const auto& uniform = program.Uniforms[i];
+        const int32 components = GetComponents(uniform.Type);
+        if (uniform.Source != -1)
+        {
+            uniforms[i] = CastValue(uniforms[uniform.Source], GetComponents(program.Uniforms[uniform.Source].Type), components);
+            continue;
+        }
+        const Value value = (uniform.Box ? eatBox(uniform.Caller, uniform.Box) : uniform.Value).Cast(VariantType(uniform.Type));
+        uniforms[i] = Float4::Zero;
+        Platform::MemoryCopy(&uniforms[i], value.AsData, components * sizeof(float));
+    }
+}
+
+const Float4* ParticleEmitterGraphCPUExecutor::ExecuteProgram(const ParticleEmitterGraphCPUProgram& program, int32 particlesStart, int32 particlesCount)
+{
+    auto& context = *Context.Get();
+    const int32 count = particlesCount;
+    const int32 stride = context.Data->Buffer->Stride;
+    const byte* start = context.Data->Buffer->GetParticleCPU(particlesStart);
+    Float4* uniforms = context.ProgramRegisters.Get();
+    Float4* registers = uniforms + program.Uniforms.Count();
+    ASSERT_LOW_LAYER(count <= BATCH_SIZE);
+    for (const auto& e : program.Instructions)
+    {
+        Float4* dst = registers + e.Dst * BATCH_SIZE;
+#define SRC(index) (e.UniformMask & (1 << index) ? uniforms + e.Src[index] : registers + e.Src[index] * BATCH_SIZE)
+#define SRC_STRIDE(index) (e.UniformMask & (1 << index) ? 0 : 1)
+#define UNARY(op) Unary(dst, SRC(0), SRC_STRIDE(0), e.Components, count, [](float a) { return op; })
+#define BINARY(op) Binary(dst, SRC(0), SRC_STRIDE(0), SRC(1), SRC_STRIDE(1), e.Components, count, [](float a, float b) { return op; })
+#define TERNARY(op) Ternary(dst, SRC(0), SRC_STRIDE(0), SRC(1), SRC_STRIDE(1), SRC(2), SRC_STRIDE(2), e.Components, count, [](float a, float b, float c) { return op; })
+        switch (e.Op)
+        {
+        case OpCode::Attribute:
+        {
+            const byte* ptr = start + e.Data[0];
+            const int32 size = e.Components * sizeof(float);
+            for (int32 i = 0; i < count; i++)
+            {
+                dst[i] = Float4::Zero;
+                Platform::MemoryCopy(&dst[i], ptr, size);
+                ptr += stride;
+            }
+            break;
+        }
+        case OpCode::NormalizedAge:
+        {
+            const byte* agePtr = start + e.Data[0];
+            const byte* lifetimePtr = start + e.Data[1];
+            for (int32 i = 0; i < count; i++)
+            {
+                dst[i].X = *(const float*)agePtr / Math::Max(*(const float*)lifetimePtr, ZeroTolerance);
+                agePtr += stride;
+                lifetimePtr += stride;
+            }
+            break;
+        }
+        case OpCode::Random:
+            for (int32 i = 0; i < count; i++)
+            {
+                for (int32 c = 0; c < e.Components; c++)
+                    dst[i].Raw[c] = Random::Rand();
+            }
+            break;
+        case OpCode::Cast:
+        {
+            const Float4* a = SRC(0);
+            const int32 aStride = SRC_STRIDE(0);
+            for (int32 i = 0; i < count; i++)
+                dst[i] = CastValue(a[i * aStride], e.SrcComponents, e.Components);
+            break;
+        }
+        case OpCode::Component:
+        {
+            const Float4* a = SRC(0);
+            const int32 aStride = SRC_STRIDE(0);
+            for (int32 i = 0; i < count; i++)
+                dst[i].X = a[i * aStride].Raw[e.Data[0]];
+            break;
+        }
+        case OpCode::Pack:
+            for (int32 c = 0; c < e.Components; c++)
+            {
+                const Float4* a = SRC(c);
+                const int32 aStride = SRC_STRIDE(c);
+                for (int32 i = 0; i < count; i++)
+                    dst[i].Raw[c] = a[i * aStride].X;
+            }
+            break;
+        case OpCode::Add:
+            BINARY(a + b);
+            break;
+        case OpCode::Sub:
+            BINARY(a - b);
+            break;
+        case OpCode::Mul:
+            BINARY(a * b);
+            break;
+        case OpCode::Div:
+            BINARY(a / b);
+            break;
+        case OpCode::Max:
+            BINARY(Math::Max(a, b));
+            break;
+        case OpCode::Min:
+            BINARY(Math::Min(a, b));
+            break;
+        case OpCode::Pow:
+            BINARY(Math::Pow(a, b));
+            break;
+        case OpCode::Mod:
+            BINARY(Math::Mod(a, b));
+            break;
+        case OpCode::Atan2:
+            BINARY(Math::Atan2(a, b));
+            break;
+        case OpCode::Abs:
+            UNARY(Math::Abs(a));
+            break;
+        case OpCode::Ceil:
+            UNARY(Math::Ceil(a));
+            break;
+        case OpCode::Cos:
+            UNARY(Math::Cos(a));
+            break;
+        case OpCode::Floor:
+            UNARY(Math::Floor(a));
+            break;
+        case OpCode::Round:
+            UNARY(Math::Round(a));
+            break;
+        case OpCode::Saturate:
+            UNARY(Math::Saturate(a));
+            break;
+        case OpCode::Sin:
+            UNARY(Math::Sin(a));
+            break;
+        case OpCode::Sqrt:
+            UNARY(Math::Sqrt(a));
+            break;
+        case OpCode::Tan:
+            UNARY(Math::Tan(a));
+            break;
+        case OpCode::Negate:
+            UNARY(-a);
+            break;
+        case OpCode::OneMinus:
+            UNARY(1 - a);
+            break;
+        case OpCode::Asin:
+            UNARY(Math::Asin(a));
+            break;
+        case OpCode::Acos:
+            UNARY(Math::Acos(a));
+            break;
+        case OpCode::Atan:
+            UNARY(Math::Atan(a));
+            break;
+        case OpCode::Trunc:
+            UNARY(Math::Trunc(a));
+            break;
+        case OpCode::Frac:
+            Unary(dst, SRC(0), SRC_STRIDE(0), e.Components, count, [](float a)
+            {
+                float tmp;
+                return Math::ModF(a, &tmp);
+            });
+            break;
+        case OpCode::Degrees:
+            UNARY(a * RadiansToDegrees);
+            break;
+        case OpCode::Radians:
+            UNARY(a * DegreesToRadians);
+            break;
+        case OpCode::Length:
+        {
+            const Float4* a = SRC(0);
+            const int32 aStride = SRC_STRIDE(0);
+            if (e.SrcComponents == 2)
+            {
+                for (int32 i = 0; i < count; i++)
+                    dst[i].X = Float2(a[i * aStride]).Length();
+            }
+            else
+            {
+                for (int32 i = 0; i < count; i++)
+                    dst[i].X = Float3(a[i * aStride]).Length();
+            }
+            break;
+        }
+        case OpCode::Normalize:
+        {
+            const Float4* a = SRC(0);
+            const int32 aStride = SRC_STRIDE(0);
+            if (e.SrcComponents == 2)
+            {
+                for (int32 i = 0; i < count; i++)
+                    dst[i] = Float4(Float2::Normalize(Float2(a[i * aStride])), 0.0f, 0.0f);
+            }
+            else
+            {
+                for (int32 i = 0; i < count; i++)
+                    dst[i] = Float4(Float3::Normalize(Float3(a[i * aStride])), 0.0f);
+            }
+            break;
+        }
+        case OpCode::Dot:
+        case OpCode::Distance:
+        {
+            const Float4* a = SRC(0);
+            const Float4* b = SRC(1);
+            const int32 aStride = SRC_STRIDE(0);
+            const int32 bStride = SRC_STRIDE(1);
+            const bool distance = e.Op == OpCode::Distance;
+            if (e.SrcComponents == 2)
+            {
+                for (int32 i = 0; i < count; i++)
+                {
+                    const Float2 va(a[i * aStride]), vb(b[i * bStride]);
+                    dst[i].X = distance ? Float2::Distance(va, vb) : Float2::Dot(va, vb);
+                }
+            }
+            else
+            {
+                for (int32 i = 0; i < count; i++)
+                {
+                    const Float3 va(a[i * aStride]), vb(b[i * bStride]);
+                    dst[i].X = distance ? Float3::Distance(va, vb) : Float3::Dot(va, vb);
+                }
+            }
+            break;
+        }
+        case OpCode::Cross:
+        {
+            const Float4* a = SRC(0);
+            const Float4* b = SRC(1);
+            const int32 aStride = SRC_STRIDE(0);
+            const int32 bStride = SRC_STRIDE(1);
+            for (int32 i = 0; i < count; i++)
+                dst[i] = Float4(Float3::Cross(Float3(a[i * aStride]), Float3(b[i * bStride])), 0.0f);
+            break;
+        }
+        case OpCode::Clamp:
+            TERNARY(Math::Clamp(a, b, c));
+            break;
+        case OpCode::Mad:
+            TERNARY((a * b) + c);
+            break;
+        case OpCode::Lerp:
+        {
+            const Float4* a = SRC(0);
+            const Float4* b = SRC(1);
+            const Float4* alpha = SRC(2);
+            const int32 aStride = SRC_STRIDE(0);
+            const int32 bStride = SRC_STRIDE(1);
+            const int32 alphaStride = SRC_STRIDE(2);
+            const bool alphaScalar = e.Data[0] == 1;
+            for (int32 i = 0; i < count; i++)
+            {
+                const Float4& va = a[i * aStride];
+                const Float4& vb = b[i * bStride];
+                const Float4& vt = alpha[i * alphaStride];
+                for (int32 c = 0; c < e.Components; c++)
+                    dst[i].Raw[c] = Math::Lerp(va.Raw[c], vb.Raw[c], vt.Raw[alphaScalar ? 0 : c]);
+            }
+            break;
+        }
+        case OpCode::Gradient:
+        {
+            const Float4* time = SRC(0);
+            const int32 timeStride = SRC_STRIDE(0);
+            const float* stops = program.Data.Get() + e.Data[0];
+            for (int32 i = 0; i < count; i++)
+                dst[i] = SampleGradient(stops, e.Data[1], time[i * timeStride].X);
+            break;
+        }
+        case OpCode::Curve:
+        {
+            const Float4* time = SRC(0);
+            const int32 timeStride = SRC_STRIDE(0);
+            switch (e.Components)
+            {
+#define SAMPLE_CURVE(components, type) \
+            case components: \
+                for (int32 i = 0; i < count; i++) \
+                    ((const BezierCurve<type>*)e.Ptr)->Evaluate(*(type*)&dst[i], time[i * timeStride].X, false); \
+                break
+            SAMPLE_CURVE(1, float);
+            SAMPLE_CURVE(2, Float2);
+            SAMPLE_CURVE(3, Float3);
+            SAMPLE_CURVE(4, Float4);
+#undef SAMPLE_CURVE
+            }
+            break;
+        }
+        }
+#undef SRC
+#undef SRC_STRIDE
+#undef UNARY
+#undef BINARY
+#undef TERNARY
+    }
+    return registers + program.Result * BATCH_SIZE;
+}
@@ -5,8 +5,10 @@
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Particles/ParticleEffect.h"
+#include "Engine/Particles/ParticleKernels.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 ThreadLocal<ParticleEmitterGraphCPUContext*> ParticleEmitterGraphCPUExecutor::Context;
 
@@ -38,6 +40,8 @@ void ParticleEmitterGraphCPU::CreateDefault()
 
 bool ParticleEmitterGraphCPU::Load(ReadStream* stream, bool loadMeta)
 {
+    _canUpdateAsync = true;
+    ClearPrograms();
     if (Base::Load(stream, loadMeta))
         return true;
 
@@ -107,6 +111,36 @@ void ParticleEmitterGraphCPU::InitializeNode(Node* node)
         node->CustomDataOffset = CustomDataSize;
         CustomDataSize += sizeof(float);
         break;
+    // Particle Attribute (by index)
+    case GRAPH_NODE_MAKE_TYPE(14, 303):
+    // Function
+    case GRAPH_NODE_MAKE_TYPE(14, 300):
+        // Graph can access other particles data (or it's unknown for the function) so don't update particles in parallel
+        _canUpdateAsync = false;
+        break;
+    }
+}
+
+void ParticleEmitterGraphCPU::Clear()
+{
+    ClearPrograms();
+
+    Base::Clear();
+}
+
+ParticleEmitterGraphCPU::~ParticleEmitterGraphCPU()
+{
+    ClearPrograms();
+}
+
+void ParticleEmitterGraphCPU::ClearPrograms()
+{
+    ScopeLock lock(_programsLocker);
+    _programs.ClearDelete();
+    for (auto& node : Nodes)
+    {
+        node.Program = nullptr;
+        node.ProgramCompiled = false;
     }
 }
 
@@ -431,12 +465,33 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
     auto& cpu = data.Buffer->CPU;
 
     // Update particles
+    const bool async = cpu.Count >= PARTICLE_EMITTER_ASYNC_UPDATE_MIN_PARTICLES && _graph._canUpdateAsync && JobSystem::GetThreadsCount() > 1;
     if (cpu.Count > 0)
     {
         PROFILE_CPU_NAMED("Update");
-        for (int32 i = 0; i < _graph.UpdateModules.Count(); i++)
+        const auto& modules = _graph.UpdateModules;
+        for (int32 i = 0; i < modules.Count();)
         {
-            ProcessModule(_graph.UpdateModules[i], 0, cpu.Count);
+            // Find the modules that can process the particles independently (eg. kill modules remove particles so they need to process the whole buffer)
+            int32 asyncEnd = i;
+            while (async && asyncEnd < modules.Count() && CanProcessModuleAsync(modules[asyncEnd]))
+                asyncEnd++;
+            if (asyncEnd - i != 0)
+            {
+                // Update particles in chunks (each job runs all modules for its range)
+                JobSystem::ParallelFor(0, cpu.Count, PARTICLE_EMITTER_ASYNC_UPDATE_CHUNK_SIZE, [this, emitter, effect, &data, dt, i, asyncEnd](int32 start, int32 end)
+                {
+                    Init(emitter, effect, data, dt);
+                    for (int32 j = i; j < asyncEnd; j++)
+                        ProcessModule(_graph.UpdateModules[j], start, end);
+                });
+                i = asyncEnd;
+            }
+            else
+            {
+                ProcessModule(modules[i], 0, cpu.Count);
+                i++;
+            }
         }
     }
 
@@ -482,11 +537,17 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
         PROFILE_CPU_NAMED("Euler Integration");
         byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
         byte* velocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
+        const int32 stride = data.Buffer->Stride;
+        if (async)
         {
-            *((Float3*)positionPtr) += *((Float3*)velocityPtr) * dt;
-            positionPtr += data.Buffer->Stride;
-            velocityPtr += data.Buffer->Stride;
+            JobSystem::ParallelFor(0, cpu.Count, PARTICLE_EMITTER_ASYNC_UPDATE_CHUNK_SIZE, [positionPtr, velocityPtr, stride, dt](int32 start, int32 end)
+            {
+                ParticleKernels::MulAdd(positionPtr + start * stride, velocityPtr + start * stride, stride, dt, end - start);
+            });
+        }
+        else
+        {
+            ParticleKernels::MulAdd(positionPtr, velocityPtr, stride, dt, cpu.Count);
         }
     }
 
@@ -496,12 +557,7 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
         PROFILE_CPU_NAMED("Angular Euler Integration");
         byte* rotationPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrRotation].Offset;
         byte* angularVelocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAngularVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
-        {
-            *((Float3*)rotationPtr) += *((Float3*)angularVelocityPtr) * dt;
-            rotationPtr += data.Buffer->Stride;
-            angularVelocityPtr += data.Buffer->Stride;
-        }
+        ParticleKernels::MulAdd(rotationPtr, angularVelocityPtr, data.Buffer->Stride, dt, cpu.Count);
     }
 
     // Spawn particles
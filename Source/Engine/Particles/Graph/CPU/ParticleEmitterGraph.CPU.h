@@ -7,6 +7,8 @@
 #include "Engine/Particles/ParticlesData.h"
 #include "Engine/Visject/VisjectGraph.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Physics/Types.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Threading/ThreadLocal.h"
 
 struct RenderContext;
@@ -15,6 +17,8 @@ class ParticleEmitterGraphCPU;
 class ParticleEmitterGraphCPUBase;
 class ParticleEmitterGraphCPUNode;
 class ParticleEmitterGraphCPUExecutor;
+class ParticleEmitterGraphCPUProgramCompiler;
+struct ParticleEmitterGraphCPUProgram;
 
 // The root node type identifier
 #define PARTICLE_EMITTER_ROOT_NODE_TYPE GRAPH_NODE_MAKE_TYPE(14, 1)
@@ -30,6 +34,18 @@ class ParticleEmitterGraphCPUExecutor;
 
 #define PARTICLE_EMITTER_MAX_CALL_STACK 100
 
+// The minimum amount of CPU particles to update them in parallel (particles range split into chunks processed by the Job System)
+#define PARTICLE_EMITTER_ASYNC_UPDATE_MIN_PARTICLES 8192
+
+// The amount of CPU particles in a single chunk of the parallel update
+#define PARTICLE_EMITTER_ASYNC_UPDATE_CHUNK_SIZE 2048
+
+// The amount of CPU particles evaluated at once by the compiled graph programs
+#define PARTICLE_EMITTER_PROGRAM_BATCH_SIZE 64
+
+// The maximum amount of registers used by a single compiled graph program
+#define PARTICLE_EMITTER_PROGRAM_MAX_REGISTERS 64
+
 class ParticleEmitterGraphCPUBox : public VisjectGraphBox
 {
 };
@@ -48,6 +64,16 @@ class ParticleEmitterGraphCPUNode : public ParticleEmitterGraphNode<VisjectGraph
         int32 RibbonOrderOffset;
     };
 
+    /// <summary>
+    /// The compiled program of the module input evaluated per-particle (null if not compiled or graph cannot be compiled). Valid only if ProgramCompiled is set.
+    /// </summary>
+    ParticleEmitterGraphCPUProgram* Program = nullptr;
+
+    /// <summary>
+    /// True if the module input program has been compiled (or failed to compile).
+    /// </summary>
+    bool ProgramCompiled = false;
+
     /// <summary>
     /// True if this node uses the per-particle data resolve instead of optimized whole-collection fetch.
     /// </summary>
@@ -74,6 +100,9 @@ class ParticleEmitterGraphCPU : public ParticleEmitterGraph<VisjectGraph<Particl
     };
 
     Array<byte> _defaultParticleData;
+    bool _canUpdateAsync = true;
+    CriticalSection _programsLocker;
+    Array<ParticleEmitterGraphCPUProgram*> _programs;
 
 public:
     // Size of the custom pre-node data buffer used for state tracking (eg. position on spiral arc progression).
@@ -100,10 +129,106 @@ class ParticleEmitterGraphCPU : public ParticleEmitterGraph<VisjectGraph<Particl
         return _attrAge != -1 ? Layout.Attributes[_attrAge].Offset : -1;
     }
 
+    /// <summary>
+    /// Finalizes an instance of the <see cref="ParticleEmitterGraphCPU"/> class.
+    /// </summary>
+    ~ParticleEmitterGraphCPU();
+
+private:
+    void ClearPrograms();
+
 public:
     // [ParticleEmitterGraph]
     bool Load(ReadStream* stream, bool loadMeta) override;
     void InitializeNode(Node* node) override;
+    void Clear() override;
+};
+
+/// <summary>
+/// The compiled particle graph expression evaluated for a batch of particles at once. Graph nodes are flattened into the list of instructions that operate on the typed (1-4 float components) registers holding the values for all particles in the batch (per-particle graph interpretation is skipped).
+/// </summary>
+/// <remarks>The sub-graphs that are the same for all particles are evaluated once per module update (as uniform registers). Only the float-typed subset of the nodes is supported, the other graphs are processed by the interpreter.</remarks>
+struct ParticleEmitterGraphCPUProgram
+{
+    enum class OpCode : byte
+    {
+        Attribute,
+        NormalizedAge,
+        Random,
+        Cast,
+        Component,
+        Pack,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Max,
+        Min,
+        Pow,
+        Mod,
+        Atan2,
+        Abs,
+        Ceil,
+        Cos,
+        Floor,
+        Round,
+        Saturate,
+        Sin,
+        Sqrt,
+        Tan,
+        Negate,
+        OneMinus,
+        Asin,
+        Acos,
+        Atan,
+        Trunc,
+        Frac,
+        Degrees,
+        Radians,
+        Length,
+        Normalize,
+        Dot,
+        Cross,
+        Distance,
+        Clamp,
+        Lerp,
+        Mad,
+        Gradient,
+        Curve,
+    };
+
+    struct Instruction
+    {
+        OpCode Op;
+        // The result components count.
+        byte Components;
+        // The first source components count.
+        byte SrcComponents;
+        // The bit mask of the sources that are uniform registers (the same value for all particles).
+        byte UniformMask;
+        byte Dst;
+        byte Src[4];
+        int32 Data[2];
+        const void* Ptr;
+    };
+
+    struct Uniform
+    {
+        // The graph box to evaluate (output box of the node) or null to use the constant value.
+        VisjectExecutor::Node* Caller;
+        VisjectExecutor::Box* Box;
+        Variant Value;
+        // The uniform value type (float type).
+        VariantType::Types Type;
+        // The index of the other uniform to cast to this type (or -1 if unused).
+        int32 Source;
+    };
+
+    Array<Instruction> Instructions;
+    Array<Uniform> Uniforms;
+    Array<float> Data;
+    int32 RegistersCount = 0;
+    byte Result = 0;
 };
 
 /// <summary>
@@ -122,6 +247,9 @@ struct ParticleEmitterGraphCPUContext
     byte AttributesRemappingTable[PARTICLE_ATTRIBUTES_MAX_COUNT]; // Maps node attribute indices to the current particle layout (used to support accessing particle data from function graph which has different layout).
     int32 CallStackSize = 0;
     VisjectExecutor::Node* CallStack[PARTICLE_EMITTER_MAX_CALL_STACK];
+    Array<Float4> ProgramRegisters; // The registers storage of the compiled graph program (uniforms followed by the varying registers for the particles batch).
+    Array<RayCastQuery> CollisionQueries; // The batched scene collision queries of the particles (one per particle).
+    Array<RayCastHit> CollisionHits; // The results of the batched scene collision queries.
 };
 
 /// <summary>
@@ -129,6 +257,7 @@ struct ParticleEmitterGraphCPUContext
 /// </summary>
 class ParticleEmitterGraphCPUExecutor : public VisjectExecutor
 {
+    friend ParticleEmitterGraphCPUProgramCompiler;
 private:
     ParticleEmitterGraphCPU& _graph;
 
@@ -195,6 +324,14 @@ class ParticleEmitterGraphCPUExecutor : public VisjectExecutor
 
     int32 ProcessSpawnModule(int32 index);
     void ProcessModule(ParticleEmitterGraphCPUNode* node, int32 particlesStart, int32 particlesEnd);
+    bool CanProcessModuleAsync(const ParticleEmitterGraphCPUNode* node) const;
+
+    // Gets the compiled program that evaluates the module input per-particle (as the given float type), returns null if the graph cannot be compiled and needs to be interpreted
+    const ParticleEmitterGraphCPUProgram* GetProgram(ParticleEmitterGraphCPUNode* node, Box* box, int32 defaultValueBoxIndex, int32 components);
+    // Evaluates the program uniforms (call once before executing the program for the particles)
+    void InitProgram(const ParticleEmitterGraphCPUProgram& program);
+    // Executes the program for the particles batch (up to PARTICLE_EMITTER_PROGRAM_BATCH_SIZE particles), returns the pointer to the results for each particle
+    const Float4* ExecuteProgram(const ParticleEmitterGraphCPUProgram& program, int32 particlesStart, int32 particlesCount);
 
     FORCE_INLINE Value GetValue(Box* box, int32 defaultValueBoxIndex)
     {
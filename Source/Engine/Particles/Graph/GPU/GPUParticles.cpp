@@ -129,13 +129,12 @@ void GPUParticles::CopyParticlesCount(GPUContext* context, ParticleEmitter* emit
     }
 }
 
-void GPUParticles::Execute(GPUContext* context, ParticleEmitter* emitter, ParticleEffect* effect, int32 emitterIndex, ParticleEmitterInstance& data)
+bool GPUParticles::Prepare(GPUContext* context, ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data)
 {
     ASSERT(emitter->Graph.Version == data.Version);
     ASSERT(emitter->Graph.Version == data.Buffer->Version);
     uint32 counterDefaultValue = 0;
     const uint32 counterOffset = data.Buffer->GPU.ParticleCounterOffset;
-    const bool hasCB = _cbData.HasItems();
 
     // Clear buffers if need to
     if (data.Buffer->GPU.PendingClear)
@@ -155,10 +154,19 @@ void GPUParticles::Execute(GPUContext* context, ParticleEmitter* emitter, Partic
     }
 
     // Skip if can
-    SceneRenderTask* viewTask = effect->GetRenderTask();
     const int32 threads = data.Buffer->GPU.ParticlesCountMax + data.GPU.SpawnCount;
-    if (data.GPU.DeltaTime <= 0.0f || threads == 0 || !_mainCS)
+    return data.GPU.DeltaTime <= 0.0f || threads == 0 || !_mainCS;
+}
+
+void GPUParticles::Execute(GPUContext* context, ParticleEmitter* emitter, ParticleEffect* effect, int32 emitterIndex, ParticleEmitterInstance& data, GPUBuffer* dispatchArgs, uint32 dispatchArgsOffset)
+{
+    if (Prepare(context, emitter, effect, data))
         return;
+    uint32 counterDefaultValue = 0;
+    const uint32 counterOffset = data.Buffer->GPU.ParticleCounterOffset;
+    const bool hasCB = _cbData.HasItems();
+    SceneRenderTask* viewTask = effect->GetRenderTask();
+    const int32 threads = data.Buffer->GPU.ParticlesCountMax + data.GPU.SpawnCount;
 
     // Clear destination buffer counter
     context->UpdateBuffer(data.Buffer->GPU.BufferSecondary, &counterDefaultValue, sizeof(counterDefaultValue), counterOffset);
@@ -261,8 +269,16 @@ void GPUParticles::Execute(GPUContext* context, ParticleEmitter* emitter, Partic
     context->BindUA(0, data.Buffer->GPU.BufferSecondary->View());
 
     // Invoke Compute shader
-    const int32 threadGroupSize = 1024;
-    context->Dispatch(_mainCS, Math::Min(Math::DivideAndRoundUp(threads, threadGroupSize), GPU_MAX_CS_DISPATCH_THREAD_GROUPS), 1, 1);
+    if (dispatchArgs)
+    {
+        // Threads groups count is based on the actual particles count (generated on a GPU)
+        context->DispatchIndirect(_mainCS, dispatchArgs, dispatchArgsOffset);
+    }
+    else
+    {
+        const int32 threadGroupSize = 1024;
+        context->Dispatch(_mainCS, Math::Min(Math::DivideAndRoundUp(threads, threadGroupSize), GPU_MAX_CS_DISPATCH_THREAD_GROUPS), 1, 1);
+    }
 
     // Copy custom data
     for (int32 i = 0; i < CustomDataSize; i += 4)
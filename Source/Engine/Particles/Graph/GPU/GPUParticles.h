@@ -79,6 +79,16 @@ class GPUParticles
     /// <param name="dstOffset">The destination buffer offset from start (in bytes) to copy the counter (uint32).</param>
     void CopyParticlesCount(GPUContext* context, ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, GPUBuffer* dstBuffer, uint32 dstOffset);
 
+    /// <summary>
+    /// Prepares the GPU particles simulation update (clears the particles data if need to). Called before Execute.
+    /// </summary>
+    /// <param name="context">The GPU context that supports Compute.</param>
+    /// <param name="emitter">The owning emitter.</param>
+    /// <param name="effect">The instance effect.</param>
+    /// <param name="data">The instance data.</param>
+    /// <returns>True if the simulation update can be skipped, otherwise false.</returns>
+    bool Prepare(GPUContext* context, ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data);
+
     /// <summary>
     /// Performs the GPU particles simulation update using the graphics device.
     /// </summary>
@@ -87,7 +97,9 @@ class GPUParticles
     /// <param name="effect">The instance effect.</param>
     /// <param name="emitterIndex">The index of the emitter in the particle system.</param>
     /// <param name="data">The instance data.</param>
-    void Execute(GPUContext* context, ParticleEmitter* emitter, ParticleEffect* effect, int32 emitterIndex, ParticleEmitterInstance& data);
+    /// <param name="dispatchArgs">The indirect dispatch arguments buffer with the simulation threads groups count (limited by the current particles count). Optional, if null the dispatch size is estimated on a CPU.</param>
+    /// <param name="dispatchArgsOffset">The indirect dispatch arguments offset (in bytes) in the buffer.</param>
+    void Execute(GPUContext* context, ParticleEmitter* emitter, ParticleEffect* effect, int32 emitterIndex, ParticleEmitterInstance& data, GPUBuffer* dispatchArgs = nullptr, uint32 dispatchArgsOffset = 0);
 };
 
 #endif
@@ -460,6 +460,23 @@ void ParticleEffect::Update()
     if (!UpdateWhenOffscreen && _lastMinDstSqr >= MAX_Real)
         return;
 
+    // Calculate the simulation LOD based on the distance to the closest view since the last update
+    Instance.ViewDistance = _lastMinDstSqr < MAX_Real ? (float)Math::Sqrt(_lastMinDstSqr) : MAX_float;
+    Instance.LOD = 0;
+    float lodDistance = Particles::LODDistance * LODDistanceScale;
+    if (lodDistance > 0.0f)
+    {
+        while (Instance.LOD < PARTICLE_EFFECT_MAX_LOD && Instance.ViewDistance >= lodDistance)
+        {
+            Instance.LOD++;
+            lodDistance *= 2.0f;
+        }
+
+        // Throttle the update rate of the far effects (simulation uses time since the last update)
+        if (Engine::UpdateCount - _lastUpdateFrame < (1ull << Instance.LOD))
+            return;
+    }
+
     if (UpdateMode == SimulationUpdateMode::FixedTimestep)
     {
         // Check if last simulation update was past enough to kick a new on
@@ -648,6 +665,7 @@ void ParticleEffect::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(IsLooping);
     SERIALIZE(PlayOnStart);
     SERIALIZE(UpdateWhenOffscreen);
+    SERIALIZE(LODDistanceScale);
     SERIALIZE(DrawModes);
     SERIALIZE(SortOrder);
 }
@@ -749,6 +767,7 @@ void ParticleEffect::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(IsLooping);
     DESERIALIZE(PlayOnStart);
     DESERIALIZE(UpdateWhenOffscreen);
+    DESERIALIZE(LODDistanceScale);
     DESERIALIZE(DrawModes);
     DESERIALIZE(SortOrder);
 
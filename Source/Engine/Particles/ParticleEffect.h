@@ -248,6 +248,12 @@ class FLAXENGINE_API ParticleEffect : public Actor
     API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(true), EditorOrder(70)")
     bool UpdateWhenOffscreen = true;
 
+    /// <summary>
+    /// The scale of the particles LOD distance (see Particles::LODDistance). Higher values keep the full simulation quality at larger distances (eg. for the important gameplay effects). Use 0 to always simulate the effect at the full quality.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(1.0f), EditorOrder(71), Limit(0)")
+    float LODDistanceScale = 1.0f;
+
     /// <summary>
     /// The draw passes to use for rendering this object.
     /// </summary>
@@ -334,6 +340,14 @@ class FLAXENGINE_API ParticleEffect : public Actor
     /// </summary>
     API_PROPERTY() int32 GetParticlesCount() const;
 
+    /// <summary>
+    /// Gets the current simulation LOD level of the effect (0 is the full quality).
+    /// </summary>
+    API_PROPERTY() int32 GetLOD() const
+    {
+        return Instance.LOD;
+    }
+
     /// <summary>
     /// Gets whether or not the particle effect is playing.
     /// </summary>
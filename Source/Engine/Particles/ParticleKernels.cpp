@@ -0,0 +1,156 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ParticleKernels.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Platform/Platform.h"
+
+namespace
+{
+#if USE_SIMD_MATH
+    // Float3 attributes are processed as 4-component vectors, the fourth component is the data after the attribute (restored after the store)
+    FORCE_INLINE SimdVector4 LoadFloat3(const byte* ptr)
+    {
+        return SIMD::LoadUnaligned(ptr);
+    }
+
+    FORCE_INLINE void StoreFloat3(byte* ptr, SimdVector4 value)
+    {
+        const uint32 next = *(const uint32*)(ptr + sizeof(Float3));
+        SIMD::StoreUnaligned(ptr, value);
+        *(uint32*)(ptr + sizeof(Float3)) = next;
+    }
+#endif
+
+    template<typename T>
+    FORCE_INLINE void SetValue(byte* dst, int32 stride, const void* value, int32 count)
+    {
+        const T v = *(const T*)value;
+        for (int32 i = 0; i < count; i++)
+        {
+            *(T*)dst = v;
+            dst += stride;
+        }
+    }
+}
+
+void ParticleKernels::Add(byte* dst, int32 stride, float value, int32 count)
+{
+    for (int32 i = 0; i < count; i++)
+    {
+        *(float*)dst += value;
+        dst += stride;
+    }
+}
+
+void ParticleKernels::Add(byte* dst, int32 stride, const Float3& value, int32 count)
+{
+#if USE_SIMD_MATH
+    const SimdVector4 v = SIMD::Load(value.X, value.Y, value.Z, 0.0f);
+    for (int32 i = 0; i < count; i++)
+    {
+        StoreFloat3(dst, SIMD::Add(LoadFloat3(dst), v));
+        dst += stride;
+    }
+#else
+    for (int32 i = 0; i < count; i++)
+    {
+        *(Float3*)dst += value;
+        dst += stride;
+    }
+#endif
+}
+
+void ParticleKernels::MulAdd(byte* dst, const byte* src, int32 stride, float scale, int32 count)
+{
+#if USE_SIMD_MATH
+    const SimdVector4 s = SIMD::Splat(scale);
+    for (int32 i = 0; i < count; i++)
+    {
+        StoreFloat3(dst, SIMD::MulAdd(LoadFloat3(src), s, LoadFloat3(dst)));
+        dst += stride;
+        src += stride;
+    }
+#else
+    for (int32 i = 0; i < count; i++)
+    {
+        *(Float3*)dst += *(const Float3*)src * scale;
+        dst += stride;
+        src += stride;
+    }
+#endif
+}
+
+void ParticleKernels::LinearDrag(byte* velocity, const byte* mass, const byte* spriteSize, int32 stride, float drag, int32 count)
+{
+    int32 i = 0;
+#if USE_SIMD_MATH
+    // Calculate the velocity scale for 4 particles at once (single division)
+    const SimdVector4 dragV = SIMD::Splat(drag);
+    const SimdVector4 one = SIMD::Splat(1.0f);
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+    const SimdVector4 minMass = SIMD::Splat(ZeroTolerance);
+    alignas(16) float scales[4];
+    for (; i + 4 <= count; i += 4)
+    {
+        SimdVector4 particleDrag = dragV;
+        if (spriteSize)
+        {
+            const Float2& s0 = *(const Float2*)spriteSize;
+            const Float2& s1 = *(const Float2*)(spriteSize + stride);
+            const Float2& s2 = *(const Float2*)(spriteSize + stride * 2);
+            const Float2& s3 = *(const Float2*)(spriteSize + stride * 3);
+            particleDrag = SIMD::Mul(particleDrag, SIMD::Load(s0.MulValues(), s1.MulValues(), s2.MulValues(), s3.MulValues()));
+            spriteSize += stride * 4;
+        }
+        const SimdVector4 masses = SIMD::Load(*(const float*)mass, *(const float*)(mass + stride), *(const float*)(mass + stride * 2), *(const float*)(mass + stride * 3));
+        SIMD::Store(scales, SIMD::Max(zero, SIMD::Sub(one, SIMD::Div(particleDrag, SIMD::Max(masses, minMass)))));
+        mass += stride * 4;
+        for (int32 j = 0; j < 4; j++)
+        {
+            StoreFloat3(velocity, SIMD::Mul(LoadFloat3(velocity), SIMD::Splat(scales[j])));
+            velocity += stride;
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        float particleDrag = drag;
+        if (spriteSize)
+        {
+            particleDrag *= ((const Float2*)spriteSize)->MulValues();
+            spriteSize += stride;
+        }
+        *(Float3*)velocity *= Math::Max(0.0f, 1.0f - particleDrag / Math::Max(*(const float*)mass, ZeroTolerance));
+        velocity += stride;
+        mass += stride;
+    }
+}
+
+void ParticleKernels::Set(byte* dst, int32 stride, const void* value, int32 size, int32 count)
+{
+    // Use typed stores for the common attribute sizes (instead of memory copy per particle)
+    switch (size)
+    {
+    case sizeof(float):
+        SetValue<uint32>(dst, stride, value, count);
+        break;
+    case sizeof(Float2):
+        SetValue<uint64>(dst, stride, value, count);
+        break;
+    case sizeof(Float3):
+        SetValue<Float3>(dst, stride, value, count);
+        break;
+    case sizeof(Float4):
+        SetValue<Float4>(dst, stride, value, count);
+        break;
+    default:
+        for (int32 i = 0; i < count; i++)
+        {
+            Platform::MemoryCopy(dst, value, size);
+            dst += stride;
+        }
+        break;
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Math/Vector3.h"
+
+/// <summary>
+/// The CPU particles processing utility library. Batched kernels that update a single attribute (or a few attributes) of a range of particles at once (using SIMD when available) for the common emitter modules with uniform inputs.
+/// </summary>
+/// <remarks>Attributes pointers point to the attribute data of the first particle to process. Particles data is interleaved (stride is the particle data size) and the buffer has to be padded with PARTICLE_CPU_BUFFER_PADDING.</remarks>
+class FLAXENGINE_API ParticleKernels
+{
+public:
+    /// <summary>
+    /// Adds the value to the float attribute: dst += value.
+    /// </summary>
+    /// <param name="dst">The attribute data.</param>
+    /// <param name="stride">The particles data stride.</param>
+    /// <param name="value">The value to add.</param>
+    /// <param name="count">The amount of particles to process.</param>
+    static void Add(byte* dst, int32 stride, float value, int32 count);
+
+    /// <summary>
+    /// Adds the value to the Float3 attribute: dst += value (eg. gravity force).
+    /// </summary>
+    /// <param name="dst">The attribute data.</param>
+    /// <param name="stride">The particles data stride.</param>
+    /// <param name="value">The value to add.</param>
+    /// <param name="count">The amount of particles to process.</param>
+    static void Add(byte* dst, int32 stride, const Float3& value, int32 count);
+
+    /// <summary>
+    /// Adds the scaled Float3 attribute to the other Float3 attribute: dst += src * scale (eg. Euler integration of the velocity).
+    /// </summary>
+    /// <param name="dst">The destination attribute data.</param>
+    /// <param name="src">The source attribute data.</param>
+    /// <param name="stride">The particles data stride.</param>
+    /// <param name="scale">The source value scale.</param>
+    /// <param name="count">The amount of particles to process.</param>
+    static void MulAdd(byte* dst, const byte* src, int32 stride, float scale, int32 count);
+
+    /// <summary>
+    /// Applies the linear drag to the velocity: velocity *= max(0, 1 - drag / max(mass, eps)), where drag is optionally scaled by the sprite size area.
+    /// </summary>
+    /// <param name="velocity">The velocity attribute data (Float3).</param>
+    /// <param name="mass">The mass attribute data (float).</param>
+    /// <param name="spriteSize">The sprite size attribute data (Float2). Optional, can be null.</param>
+    /// <param name="stride">The particles data stride.</param>
+    /// <param name="drag">The drag value (already scaled by the delta time).</param>
+    /// <param name="count">The amount of particles to process.</param>
+    static void LinearDrag(byte* velocity, const byte* mass, const byte* spriteSize, int32 stride, float drag, int32 count);
+
+    /// <summary>
+    /// Sets the attribute value for all particles.
+    /// </summary>
+    /// <param name="dst">The attribute data.</param>
+    /// <param name="stride">The particles data stride.</param>
+    /// <param name="value">The value data.</param>
+    /// <param name="size">The value size (in bytes).</param>
+    /// <param name="count">The amount of particles to process.</param>
+    static void Set(byte* dst, int32 stride, const void* value, int32 size, int32 count);
+};
@@ -27,6 +27,7 @@ public override void Setup(BuildOptions options)
 
         options.PrivateDependencies.Add("Utilities");
         options.PrivateDependencies.Add("Graphics");
+        options.PrivateDependencies.Add("Physics");
 
         options.SourcePaths.Clear();
         options.SourceFiles.AddRange(Directory.GetFiles(FolderPath, "*.*", SearchOption.TopDirectoryOnly));
@@ -15,6 +15,7 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Threading/TaskGraph.h"
@@ -96,14 +97,29 @@ struct EmitterCache
     ParticleBuffer* Buffer;
 };
 
+#if COMPILE_WITH_GPU_PARTICLES
+
+struct GPUEmitterUpdate
+{
+    ParticleEffect* Effect;
+    ParticleEmitter* Emitter;
+    ParticleEmitterInstance* Data;
+    int32 EmitterIndex;
+};
+
+#endif
+
 namespace ParticleManagerImpl
 {
     CriticalSection PoolLocker;
     Dictionary<ParticleEmitter*, Array<EmitterCache>> Pool;
     Array<ParticleEffect*> UpdateList;
+    Array<ParticleEffect*> SignificanceList;
 #if COMPILE_WITH_GPU_PARTICLES
     CriticalSection GpuUpdateListLocker;
     Array<ParticleEffect*> GpuUpdateList;
+    Array<GPUEmitterUpdate> GpuEmittersList;
+    Array<Int4> GpuEmittersTable;
     RenderTask* GpuRenderTask = nullptr;
 #endif
 }
@@ -113,6 +129,10 @@ using namespace ParticleManagerImpl;
 TaskGraphSystem* Particles::System = nullptr;
 bool Particles::EnableParticleBufferPooling = true;
 float Particles::ParticleBufferRecycleTimeout = 10.0f;
+float Particles::LODDistance = 0.0f;
+float Particles::LODSpawnRateScale = 0.5f;
+int32 Particles::MaxCPUParticles = 0;
+int32 Particles::MaxGPUParticles = 0;
 
 SpriteParticleRenderer SpriteRenderer;
 
@@ -271,7 +291,7 @@ void DrawEmitterCPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
 
             // Sort keys with indices
             {
-                Sorting::RadixSort(sortedKeys, sortedIndices, ParticlesDrawCPU::SortingKeys[1].Get(), ParticlesDrawCPU::SortingIndices.Get(), listSize);
+                Sorting::RadixSortParallel(sortedKeys, sortedIndices, ParticlesDrawCPU::SortingKeys[1].Get(), ParticlesDrawCPU::SortingIndices.Get(), listSize);
             }
 
             // Upload CPU particles indices
@@ -579,9 +599,18 @@ GPU_CB_STRUCT(GPUParticlesSortingData {
     Matrix PositionTransform;
     });
 
+GPU_CB_STRUCT(GPUParticlesDispatchArgsData {
+    uint32 EmittersCount;
+    Float3 Dummy0;
+    });
+
 AssetReference<Shader> GPUParticlesSorting;
 GPUConstantBuffer* GPUParticlesSortingCB;
 GPUShaderProgramCS* GPUParticlesSortingCS[3];
+GPUConstantBuffer* GPUParticlesDispatchArgsCB;
+GPUShaderProgramCS* GPUParticlesDispatchArgsCS;
+GPUBuffer* GPUParticlesEmittersBuffer = nullptr;
+GPUBuffer* GPUParticlesDispatchArgsBuffer = nullptr;
 
 #if COMPILE_WITH_DEV_ENV
 
@@ -589,13 +618,44 @@ void OnShaderReloading(Asset* obj)
 {
     GPUParticlesSortingCB = nullptr;
     Platform::MemoryClear(GPUParticlesSortingCS, sizeof(GPUParticlesSortingCS));
+    GPUParticlesDispatchArgsCB = nullptr;
+    GPUParticlesDispatchArgsCS = nullptr;
 }
 
 #endif
 
+bool InitGPUParticlesSorting()
+{
+    if (GPUParticlesSorting == nullptr)
+    {
+        // TODO: preload shader if platform supports GPU particles
+        GPUParticlesSorting = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GPUParticlesSorting"));
+        if (GPUParticlesSorting == nullptr || GPUParticlesSorting->WaitForLoaded())
+            return true;
+#if COMPILE_WITH_DEV_ENV
+        GPUParticlesSorting.Get()->OnReloading.Bind<OnShaderReloading>();
+#endif
+    }
+    if (!GPUParticlesSortingCB)
+    {
+        const auto shader = GPUParticlesSorting->GetShader();
+        const StringAnsiView CS_Sort("CS_Sort");
+        GPUParticlesSortingCS[0] = shader->GetCS(CS_Sort, 0);
+        GPUParticlesSortingCS[1] = shader->GetCS(CS_Sort, 1);
+        GPUParticlesSortingCS[2] = shader->GetCS(CS_Sort, 2);
+        GPUParticlesSortingCB = shader->GetCB(0);
+        ASSERT(GPUParticlesSortingCB);
+        GPUParticlesDispatchArgsCS = shader->GetCS("CS_DispatchArgs");
+        GPUParticlesDispatchArgsCB = shader->GetCB(1);
+    }
+    return false;
+}
+
 void CleanupGPUParticlesSorting()
 {
     GPUParticlesSorting = nullptr;
+    SAFE_DELETE_GPU_RESOURCE(GPUParticlesEmittersBuffer);
+    SAFE_DELETE_GPU_RESOURCE(GPUParticlesDispatchArgsBuffer);
 }
 
 void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCall& drawCall, DrawPass drawModes, StaticFlags staticFlags, ParticleEmitterInstance& emitterData, const RenderModulesIndices& renderModulesIndices, int8 sortOrder)
@@ -609,26 +669,8 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
         PROFILE_GPU_CPU_NAMED("Sort Particles");
 
         // Prepare pipeline
-        if (GPUParticlesSorting == nullptr)
-        {
-            // TODO: preload shader if platform supports GPU particles
-            GPUParticlesSorting = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GPUParticlesSorting"));
-            if (GPUParticlesSorting == nullptr || GPUParticlesSorting->WaitForLoaded())
-                return;
-#if COMPILE_WITH_DEV_ENV
-            GPUParticlesSorting.Get()->OnReloading.Bind<OnShaderReloading>();
-#endif
-        }
-        if (!GPUParticlesSortingCB)
-        {
-            const auto shader = GPUParticlesSorting->GetShader();
-            const StringAnsiView CS_Sort("CS_Sort");
-            GPUParticlesSortingCS[0] = shader->GetCS(CS_Sort, 0);
-            GPUParticlesSortingCS[1] = shader->GetCS(CS_Sort, 1);
-            GPUParticlesSortingCS[2] = shader->GetCS(CS_Sort, 2);
-            GPUParticlesSortingCB = shader->GetCB(0);
-            ASSERT(GPUParticlesSortingCB);
-        }
+        if (InitGPUParticlesSorting())
+            return;
 
         // Prepare sorting data
         if (!buffer->GPU.SortedIndices)
@@ -705,9 +747,16 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             context->BindCB(0, GPUParticlesSortingCB);
             context->BindSR(0, buffer->GPU.Buffer->View());
             context->BindUA(0, buffer->GPU.SortingKeysBuffer->View());
-            // TODO: optimize it by using DispatchIndirect with shared invoke args generated after particles update
-            const int32 threadGroupSize = 1024;
-            context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
+            if (buffer->GPU.DispatchArgsBuffer && buffer->GPU.DispatchArgsFrame == Engine::FrameCount)
+            {
+                // Use the shared invoke args generated before particles update (limited by the particles count)
+                context->DispatchIndirect(GPUParticlesSortingCS[permutationIndex], buffer->GPU.DispatchArgsBuffer, buffer->GPU.DispatchArgsOffset);
+            }
+            else
+            {
+                const int32 threadGroupSize = 1024;
+                context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
+            }
 
             // Perform sorting
             BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, sortAscending, buffer->GPU.SortedIndices);
@@ -1056,6 +1105,8 @@ void UpdateGPU(RenderTask* task, GPUContext* context)
 
     PROFILE_GPU("GPU Particles");
 
+    // Collect emitters to update
+    GpuEmittersList.Clear();
     for (ParticleEffect* effect : GpuUpdateList)
     {
         auto& instance = effect->Instance;
@@ -1077,11 +1128,75 @@ void UpdateGPU(RenderTask* task, GPUContext* context)
             if (!data.Buffer)
                 continue;
             ASSERT(emitter->Capacity != 0 && emitter->Graph.Layout.Size != 0);
+            if (emitter->GPU.Prepare(context, emitter, effect, data))
+                continue;
+            GpuEmittersList.Add({ effect, emitter, &data, emitterIndex });
+        }
+    }
 
-            // TODO: use async context for particles to update them on compute during GBuffer rendering
-            emitter->GPU.Execute(context, emitter, effect, emitterIndex, data);
+    // Generate the indirect dispatch arguments for all emitters at once (threads count is based on the actual particles count on a GPU rather than the conservative CPU estimation)
+    GPUBuffer* dispatchArgs = nullptr;
+    if (GpuEmittersList.HasItems() && !InitGPUParticlesSorting() && GPUParticlesDispatchArgsCS && GPUParticlesDispatchArgsCB)
+    {
+        const int32 emittersCount = GpuEmittersList.Count();
+        if (!GPUParticlesEmittersBuffer)
+        {
+            GPUParticlesEmittersBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleEmittersBuffer"));
+            GPUParticlesDispatchArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleDispatchArgsBuffer"));
+        }
+        bool failed = false;
+        if (GPUParticlesEmittersBuffer->GetSize() < emittersCount * sizeof(Int4))
+        {
+            const int32 capacity = Math::RoundUpToPowerOf2(Math::Max(emittersCount, 64));
+            failed |= GPUParticlesEmittersBuffer->Init(GPUBufferDescription::Raw(capacity * sizeof(Int4), GPUBufferFlags::ShaderResource));
+            failed |= GPUParticlesDispatchArgsBuffer->Init(GPUBufferDescription::Raw(capacity * sizeof(GPUDispatchIndirectArgs), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess));
+        }
+        if (!failed)
+        {
+            PROFILE_GPU("Dispatch Args");
+
+            // Upload emitters table (particles counter is copied from the particles buffer)
+            GpuEmittersTable.Resize(emittersCount);
+            for (int32 i = 0; i < emittersCount; i++)
+            {
+                const ParticleEmitterInstance& data = *GpuEmittersList.Get()[i].Data;
+                GpuEmittersTable.Get()[i] = Int4(0, data.GPU.SpawnCount, data.Buffer->Capacity, 0);
+            }
+            context->UpdateBuffer(GPUParticlesEmittersBuffer, GpuEmittersTable.Get(), emittersCount * sizeof(Int4));
+            for (int32 i = 0; i < emittersCount; i++)
+            {
+                const ParticleBuffer* buffer = GpuEmittersList.Get()[i].Data->Buffer;
+                context->CopyBuffer(GPUParticlesEmittersBuffer, buffer->GPU.Buffer, sizeof(uint32), i * sizeof(Int4), buffer->GPU.ParticleCounterOffset);
+            }
+
+            // Generate arguments
+            GPUParticlesDispatchArgsData data;
+            data.EmittersCount = emittersCount;
+            context->UpdateCB(GPUParticlesDispatchArgsCB, &data);
+            context->BindCB(1, GPUParticlesDispatchArgsCB);
+            context->BindSR(1, GPUParticlesEmittersBuffer->View());
+            context->BindUA(1, GPUParticlesDispatchArgsBuffer->View());
+            context->Dispatch(GPUParticlesDispatchArgsCS, Math::DivideAndRoundUp(emittersCount, 64), 1, 1);
+            context->ResetSR();
+            context->ResetUA();
+            dispatchArgs = GPUParticlesDispatchArgsBuffer;
         }
     }
+
+    // Update emitters
+    for (int32 i = 0; i < GpuEmittersList.Count(); i++)
+    {
+        auto& e = GpuEmittersList.Get()[i];
+        const uint32 dispatchArgsOffset = i * sizeof(GPUDispatchIndirectArgs);
+        ParticleBuffer* buffer = e.Data->Buffer;
+        buffer->GPU.DispatchArgsBuffer = dispatchArgs;
+        buffer->GPU.DispatchArgsOffset = dispatchArgsOffset;
+        buffer->GPU.DispatchArgsFrame = Engine::FrameCount;
+
+        // TODO: use async context for particles to update them on compute during GBuffer rendering
+        e.Emitter->GPU.Execute(context, e.Emitter, e.Effect, e.EmitterIndex, *e.Data, dispatchArgs, dispatchArgsOffset);
+    }
+    GpuEmittersList.Clear();
     GpuUpdateList.Clear();
 
     context->ResetSR();
@@ -1201,6 +1316,7 @@ bool ParticleManagerService::Init()
 void ParticleManagerService::Dispose()
 {
     UpdateList.Clear();
+    SignificanceList.Clear();
 #if COMPILE_WITH_GPU_PARTICLES
     GpuUpdateList.Clear();
     if (GpuRenderTask)
@@ -1237,6 +1353,7 @@ void ParticleManagerService::Dispose()
 void ParticlesSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Particles.Job");
+    PROFILE_MEM(Particles);
     auto effect = UpdateList[index];
     auto& instance = effect->Instance;
     const auto particleSystem = effect->ParticleSystem.Get();
@@ -1389,11 +1506,68 @@ void ParticlesSystem::Job(int32 index)
 #endif
 }
 
+bool SortEffectsBySignificance(ParticleEffect* const& a, ParticleEffect* const& b)
+{
+    return a->Instance.ViewDistance < b->Instance.ViewDistance;
+}
+
+void UpdateSignificance()
+{
+    // Scale the spawn rate of the far effects
+    for (ParticleEffect* effect : UpdateList)
+    {
+        auto& instance = effect->Instance;
+        const float spawnScale = instance.LOD != 0 ? Math::Pow(Particles::LODSpawnRateScale, (float)instance.LOD) : 1.0f;
+        for (auto& emitterInstance : instance.Emitters)
+            emitterInstance.SpawnScale = spawnScale;
+    }
+    if (Particles::MaxCPUParticles <= 0 && Particles::MaxGPUParticles <= 0)
+        return;
+    PROFILE_CPU_NAMED("Particles.Significance");
+
+    // Apply the particles budget to the effects sorted by their significance (the closest to the view first), less significant emitters don't spawn new particles once the budget is exceeded
+    SignificanceList = UpdateList;
+    Sorting::QuickSort(SignificanceList.Get(), SignificanceList.Count(), &SortEffectsBySignificance);
+    int32 cpuParticles = 0, gpuParticles = 0;
+    for (ParticleEffect* effect : SignificanceList)
+    {
+        auto& instance = effect->Instance;
+        const auto particleSystem = effect->ParticleSystem.Get();
+        if (!particleSystem)
+            continue;
+        for (int32 i = 0; i < instance.Emitters.Count() && i < particleSystem->Emitters.Count(); i++)
+        {
+            auto& emitterInstance = instance.Emitters[i];
+            const auto emitter = particleSystem->Emitters[i].Get();
+            if (!emitter)
+                continue;
+            if (emitter->SimulationMode == ParticlesSimulationMode::CPU)
+            {
+                if (Particles::MaxCPUParticles > 0 && cpuParticles >= Particles::MaxCPUParticles)
+                    emitterInstance.SpawnScale = 0.0f;
+                cpuParticles += emitterInstance.Buffer ? emitterInstance.Buffer->CPU.Count : 0;
+            }
+#if COMPILE_WITH_GPU_PARTICLES
+            else if (emitter->SimulationMode == ParticlesSimulationMode::GPU)
+            {
+                if (Particles::MaxGPUParticles > 0 && gpuParticles >= Particles::MaxGPUParticles)
+                    emitterInstance.SpawnScale = 0.0f;
+                gpuParticles += emitterInstance.Buffer ? emitterInstance.Buffer->GPU.ParticlesCountMax : 0;
+            }
+#endif
+        }
+    }
+    SignificanceList.Clear();
+}
+
 void ParticlesSystem::Execute(TaskGraph* graph)
 {
     if (UpdateList.Count() == 0)
         return;
 
+    // Apply the particles LOD and budgets
+    UpdateSignificance();
+
     // Setup data for async update
     const auto& tickData = Time::Update;
     DeltaTime = tickData.DeltaTime.GetTotalSeconds();
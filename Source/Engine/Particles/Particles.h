@@ -15,6 +15,9 @@ class ParticleBuffer;
 class SceneRenderTask;
 class Actor;
 
+// The maximum simulation LOD level of the particle effects
+#define PARTICLE_EFFECT_MAX_LOD 3
+
 /// <summary>
 /// The particles simulation service.
 /// </summary>
@@ -48,6 +51,27 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     /// <param name="effect">The owning actor.</param>
     static void DrawParticles(RenderContext& renderContext, ParticleEffect* effect);
 
+public:
+    /// <summary>
+    /// The distance (in world units) from the view at which the particle effects start to reduce their simulation quality (LOD 1). Each next LOD level starts at the doubled distance (effects that are not visible use the last LOD). Effects at LOD N update every 2^N frames and spawn less particles (see LODSpawnRateScale). Use 0 to disable particles LOD.
+    /// </summary>
+    API_FIELD() static float LODDistance;
+
+    /// <summary>
+    /// The particles spawn rate scale applied per LOD level (eg. 0.5 halves the amount of spawned particles on each next LOD level).
+    /// </summary>
+    API_FIELD() static float LODSpawnRateScale;
+
+    /// <summary>
+    /// The global budget for the amount of CPU particles. When exceeded, the least significant emitters (the farthest from the view) stop spawning new particles until the more significant ones fit into the budget. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 MaxCPUParticles;
+
+    /// <summary>
+    /// The global budget for the amount of GPU particles (estimated upper bound of the particles count). When exceeded, the least significant emitters (the farthest from the view) stop spawning new particles until the more significant ones fit into the budget. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 MaxGPUParticles;
+
 public:
     /// <summary>
     /// Enables or disables particle buffer pooling.
@@ -38,7 +38,7 @@ bool ParticleBuffer::Init(ParticleEmitter* emitter)
     case ParticlesSimulationMode::CPU:
     {
         CPU.Count = 0;
-        CPU.Buffer.Resize(size);
+        CPU.Buffer.Resize(size + PARTICLE_CPU_BUFFER_PADDING);
         CPU.RibbonOrder.Resize(0);
         GPU.Buffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleBuffer"));
         if (GPU.Buffer->Init(GPUBufferDescription::Raw(size, GPUBufferFlags::ShaderResource, GPUResourceUsage::Dynamic)))
@@ -66,6 +66,9 @@ bool ParticleBuffer::Init(ParticleEmitter* emitter)
         GPU.HasValidCount = false;
         GPU.ParticleCounterOffset = size;
         GPU.ParticlesCountMax = 0;
+        GPU.DispatchArgsBuffer = nullptr;
+        GPU.DispatchArgsOffset = 0;
+        GPU.DispatchArgsFrame = 0;
         break;
     }
 #endif
@@ -128,6 +131,7 @@ void ParticleBuffer::Clear()
     {
         GPU.PendingClear = true;
         GPU.HasValidCount = false;
+        GPU.DispatchArgsBuffer = nullptr;
         break;
     }
 #endif
@@ -5,6 +5,7 @@
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Memory/EngineHeap.h"
 #include "Types.h"
 
 // The maximum amount of particle attributes to use
@@ -13,6 +14,9 @@
 // The maximum amount of particle ribbon modules used per context
 #define PARTICLE_EMITTER_MAX_RIBBONS 4
 
+// The additional memory (in bytes) allocated after the CPU particles data (allows to process the last Float3 attribute as a 4-component vector, see ParticleKernels)
+#define PARTICLE_CPU_BUFFER_PADDING 16
+
 class ParticleEmitter;
 class Particles;
 class GPUBuffer;
@@ -254,9 +258,9 @@ class FLAXENGINE_API ParticleBuffer
         int32 Count;
 
         /// <summary>
-        /// The particles data buffer (CPU side).
+        /// The particles data buffer (CPU side). Buffers are pooled and reused so large ones are placed in the engine heap (if enabled).
         /// </summary>
-        Array<byte> Buffer;
+        Array<byte, EngineHeapAllocation> Buffer;
 
         /// <summary>
         /// The sorted ribbon particles indices (CPU side). Cached after system update and reused during rendering (batched for all ribbon modules).
@@ -326,6 +330,21 @@ class FLAXENGINE_API ParticleBuffer
         /// The maximum amount of particles that 'might' be in the buffer. During every simulation update we spawn a certain amount of particles and update existing ones. We can estimate limit for the current particles count to dispatch less threads for particles update.
         /// </summary>
         int32 ParticlesCountMax;
+
+        /// <summary>
+        /// The indirect dispatch arguments buffer (shared by all GPU particle emitters) with the threads groups count limited by the particles count after the last simulation update. Can be used to process the particles after the simulation (eg. sorting keys generation). Valid only if DispatchArgsFrame is the current frame.
+        /// </summary>
+        GPUBuffer* DispatchArgsBuffer = nullptr;
+
+        /// <summary>
+        /// The offset (in bytes) of the indirect dispatch arguments in DispatchArgsBuffer.
+        /// </summary>
+        uint32 DispatchArgsOffset;
+
+        /// <summary>
+        /// The frame index when DispatchArgsBuffer was generated.
+        /// </summary>
+        uint64 DispatchArgsFrame;
     } GPU;
 
 public:
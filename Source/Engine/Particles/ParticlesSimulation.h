@@ -89,6 +89,11 @@ class FLAXENGINE_API ParticleEmitterInstance
     /// </summary>
     int32 CustomSpawnCount = 0;
 
+    /// <summary>
+    /// The spawn rate scale of the emitter particles. Set by the particles significance manager (from the effect LOD and the global particles budget).
+    /// </summary>
+    float SpawnScale = 1.0f;
+
     struct
     {
         /// <summary>
@@ -158,6 +163,16 @@ class FLAXENGINE_API ParticleSystemInstance
     /// </summary>
     float LastUpdateTime = -1;
 
+    /// <summary>
+    /// The simulation LOD level (0 is the full quality). Far effects update less frequently and spawn less particles (see Particles::LODDistance).
+    /// </summary>
+    int32 LOD = 0;
+
+    /// <summary>
+    /// The distance to the closest view that has drawn the effect since the last simulation update. Value MAX_float indicates effect that is not visible.
+    /// </summary>
+    float ViewDistance = MAX_float;
+
     /// <summary>
     /// The particle system emitters data (one per emitter instance).
     /// </summary>
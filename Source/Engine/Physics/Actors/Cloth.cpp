@@ -11,6 +11,7 @@
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/Serialization.h"
+#include "Engine/Streaming/Streaming.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Level/Scene/SceneRendering.h"
 #if USE_EDITOR
@@ -746,6 +747,10 @@ bool Cloth::OnPreUpdate()
         return true;
     if (!_simulationSettings.UpdateWhenOffscreen && _simulationSettings.CullDistance > 0)
     {
+        // Include streaming sources (eg. players on a server without rendering)
+        for (const StreamingSource& source : Streaming::Sources)
+            _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, source.Position));
+
         // Cull based on distance
         bool cull = false;
         if (_lastMinDstSqr >= Math::Square(_simulationSettings.CullDistance))
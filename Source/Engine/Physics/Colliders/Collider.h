@@ -83,6 +83,18 @@ API_CLASS(Abstract) class FLAXENGINE_API Collider : public PhysicsColliderActor
     API_FIELD(Attributes="EditorOrder(2), DefaultValue(null), EditorDisplay(\"Collider\")")
     JsonAssetReference<PhysicalMaterial> Material;
 
+    /// <summary>
+    /// The minimum contact impulse magnitude required to report the collision with this collider (CollisionEnter and CollisionExit events). Use 0 to report all collisions.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(3), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Collider\")")
+    float CollisionEventsThreshold = 0.0f;
+
+    /// <summary>
+    /// If checked, only the collision start (CollisionEnter event) is reported for this collider and the collision end events are skipped.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(4), DefaultValue(false), EditorDisplay(\"Collider\")")
+    bool CollisionEventsFirstContactOnly = false;
+
 public:
     /// <summary>
     /// Computes minimum translational distance between two geometry objects.
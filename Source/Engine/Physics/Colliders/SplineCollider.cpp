@@ -273,7 +273,7 @@ void SplineCollider::GetGeometry(CollisionShape& collision)
     cookingInput.IndexData = _indexBuffer.Get();
     cookingInput.Is16bitIndexData = false;
     BytesContainer collisionData;
-    if (!CollisionCooking::CookTriangleMesh(cookingInput, collisionData))
+    if (!CollisionCooking::CookMesh(CollisionDataType::TriangleMesh, cookingInput, collisionData))
     {
         // Create triangle mesh
         if (_triangleMesh)
@@ -9,6 +9,163 @@
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Utilities/Crc.h"
+#if USE_EDITOR
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#endif
+
+// Version of the cooked collision data cache (increment it to invalidate the cache, eg. after physics backend update)
+#define COLLISION_COOKING_CACHE_VERSION 1
+
+// Maximum size (in bytes) of the cooked collision data cache kept in memory
+#define COLLISION_COOKING_CACHE_MEMORY_SIZE (64 * 1024 * 1024)
+
+namespace CollisionCookingCache
+{
+    struct FileHeader
+    {
+        uint32 Version;
+        uint64 Key;
+        int32 Size;
+    };
+
+    CriticalSection Locker;
+    Dictionary<uint64, Array<byte>> Entries;
+    int64 EntriesSize = 0;
+
+    uint64 GetKey(uint32 type, uint32 flags, const void* dataA, int32 sizeA, const void* dataB = nullptr, int32 sizeB = 0)
+    {
+        const uint32 params[] = { COLLISION_COOKING_CACHE_VERSION, type, flags, (uint32)sizeA, (uint32)sizeB };
+        const uint32 paramsHash = Crc::MemCrc32(params, sizeof(params));
+        uint32 dataHash = Crc::MemCrc32(dataA, sizeA);
+        if (sizeB != 0)
+            dataHash = Crc::MemCrc32(dataB, sizeB, dataHash);
+        return ((uint64)dataHash << 32) | paramsHash;
+    }
+
+#if USE_EDITOR
+    String GetPath(uint64 key)
+    {
+        return Globals::ProjectCacheFolder / TEXT("CollisionCache") / String::Format(TEXT("{0:016x}.bin"), key);
+    }
+#endif
+
+    void AddToMemory(uint64 key, const byte* data, int32 size)
+    {
+        if (EntriesSize + size > COLLISION_COOKING_CACHE_MEMORY_SIZE)
+        {
+            // Simple eviction policy (cache is used mostly to skip cooking the same data multiple times in a short period, eg. during level loading)
+            Entries.Clear();
+            EntriesSize = 0;
+        }
+        auto& entry = Entries[key];
+        EntriesSize += size - entry.Count();
+        entry.Set(data, size);
+    }
+
+    bool TryGet(uint64 key, BytesContainer& output)
+    {
+        ScopeLock lock(Locker);
+        const Array<byte>* entry = Entries.TryGet(key);
+        if (entry)
+        {
+            output.Copy(entry->Get(), entry->Count());
+            return true;
+        }
+#if USE_EDITOR
+        // Load from the project cache
+        Array<byte> file;
+        const String path = GetPath(key);
+        if (FileSystem::FileExists(path) && !File::ReadAllBytes(path, file) && file.Count() >= sizeof(FileHeader))
+        {
+            const FileHeader& header = *(const FileHeader*)file.Get();
+            if (header.Version == COLLISION_COOKING_CACHE_VERSION && header.Key == key && header.Size == file.Count() - (int32)sizeof(FileHeader))
+            {
+                const byte* data = file.Get() + sizeof(FileHeader);
+                output.Copy(data, header.Size);
+                AddToMemory(key, data, header.Size);
+                return true;
+            }
+        }
+#endif
+        return false;
+    }
+
+    void Add(uint64 key, const BytesContainer& data)
+    {
+        ScopeLock lock(Locker);
+        AddToMemory(key, data.Get(), data.Length());
+#if USE_EDITOR
+        // Save to the project cache
+        const String path = GetPath(key);
+        FileSystem::CreateDirectory(StringUtils::GetDirectoryName(path));
+        Array<byte> file;
+        file.Resize(sizeof(FileHeader) + data.Length());
+        FileHeader& header = *(FileHeader*)file.Get();
+        header.Version = COLLISION_COOKING_CACHE_VERSION;
+        header.Key = key;
+        header.Size = data.Length();
+        Platform::MemoryCopy(file.Get() + sizeof(FileHeader), data.Get(), data.Length());
+        File::WriteAllBytes(path, file);
+#endif
+    }
+}
+
+bool CollisionCooking::CookMesh(CollisionDataType type, CookingInput& input, BytesContainer& output)
+{
+    // Try to reuse the cooked data for the identical input
+    const int32 indexSize = input.Is16bitIndexData ? sizeof(uint16) : sizeof(uint32);
+    uint32 flags = (uint32)input.ConvexFlags | ((uint32)input.ConvexVertexLimit << 16);
+    if (input.Is16bitIndexData)
+        flags |= 1u << 31;
+    const uint64 key = CollisionCookingCache::GetKey((uint32)type, flags, input.VertexData, input.VertexCount * sizeof(Float3), input.IndexData, input.IndexCount * indexSize);
+    if (CollisionCookingCache::TryGet(key, output))
+        return false;
+
+    // Cook mesh
+    if (type == CollisionDataType::ConvexMesh)
+    {
+        if (CookConvexMesh(input, output))
+            return true;
+    }
+    else if (type == CollisionDataType::TriangleMesh)
+    {
+        if (CookTriangleMesh(input, output))
+            return true;
+    }
+    else
+    {
+        LOG(Warning, "Invalid collision data type.");
+        return true;
+    }
+
+    CollisionCookingCache::Add(key, output);
+    return false;
+}
+
+bool CollisionCooking::CookHeightField(int32 cols, int32 rows, const PhysicsBackend::HeightFieldSample* data, BytesContainer& output)
+{
+    // Try to reuse the cooked data for the identical input
+    const uint32 type = MAX_uint16;
+    const uint32 flags = ((uint32)cols << 16) | (uint32)rows;
+    const uint64 key = CollisionCookingCache::GetKey(type, flags, data, cols * rows * sizeof(PhysicsBackend::HeightFieldSample));
+    if (CollisionCookingCache::TryGet(key, output))
+        return false;
+
+    // Cook height field
+    MemoryWriteStream stream;
+    if (CookHeightField(cols, rows, data, stream))
+        return true;
+    output.Copy(stream.GetHandle(), stream.GetPosition());
+
+    CollisionCookingCache::Add(key, output);
+    return false;
+}
 
 bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::SerializedOptions& outputOptions, BytesContainer& outputData)
 {
@@ -258,21 +415,8 @@ bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::Seriali
     cookingInput.ConvexVertexLimit = convexVertexLimit;
 
     // Cook!
-    if (arg.Type == CollisionDataType::ConvexMesh)
-    {
-        if (CookConvexMesh(cookingInput, outputData))
-            return true;
-    }
-    else if (arg.Type == CollisionDataType::TriangleMesh)
-    {
-        if (CookTriangleMesh(cookingInput, outputData))
-            return true;
-    }
-    else
-    {
-        LOG(Warning, "Invalid collision data type.");
+    if (CookMesh(arg.Type, cookingInput, outputData))
         return true;
-    }
 
     // Setup options
     Platform::MemoryClear(&outputOptions, sizeof(outputOptions));
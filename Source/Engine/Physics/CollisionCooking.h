@@ -72,6 +72,25 @@ class CollisionCooking
     /// <returns>True if failed, otherwise false.</returns>
     static bool CookHeightField(int32 cols, int32 rows, const PhysicsBackend::HeightFieldSample* data, WriteStream& stream);
 
+    /// <summary>
+    /// Cooks a convex mesh or a triangle mesh (based on the collision type) from the provided mesh data. Uses the cooked data cache (based on the input data hash) to skip cooking the identical meshes multiple times. Can be called from multiple threads at once.
+    /// </summary>
+    /// <param name="type">The collision data type (convex mesh or triangle mesh).</param>
+    /// <param name="input">The input.</param>
+    /// <param name="output">The output.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool CookMesh(CollisionDataType type, CookingInput& input, BytesContainer& output);
+
+    /// <summary>
+    /// Cooks a heightfield. Uses the cooked data cache (based on the input data hash) to skip cooking the identical heightfields multiple times. Can be called from multiple threads at once.
+    /// </summary>
+    /// <param name="cols">The heightfield columns count.</param>
+    /// <param name="rows">The heightfield rows count.</param>
+    /// <param name="data">The heightfield data.</param>
+    /// <param name="output">The output.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool CookHeightField(int32 cols, int32 rows, const PhysicsBackend::HeightFieldSample* data, BytesContainer& output);
+
     /// <summary>
     /// Cooks the collision from the model and prepares the data for the <see cref="CollisionData"/> format.
     /// </summary>
@@ -21,10 +21,11 @@
 #include "Engine/Physics/Joints/SphericalJoint.h"
 #include "Engine/Physics/Joints/D6Joint.h"
 #include "Engine/Physics/Colliders/Collider.h"
-#include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Streaming/Streaming.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/PhysX/PxPhysicsAPI.h>
 #include <ThirdParty/PhysX/PxQueryFiltering.h>
 #include <ThirdParty/PhysX/extensions/PxFixedJoint.h>
@@ -44,7 +45,6 @@
 #endif
 #if WITH_CLOTH
 #include "Engine/Physics/Actors/Cloth.h"
-#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include <ThirdParty/NvCloth/Callbacks.h>
 #include <ThirdParty/NvCloth/Factory.h>
@@ -72,6 +72,9 @@
 // Temporary result buffer size
 #define PHYSX_HIT_BUFFER_SIZE 128
 
+// Maximum amount of dynamic actors to update significance (distance-based simulation reduction) per simulation step
+#define PHYSX_SIGNIFICANCE_BATCH_SIZE 1024
+
 struct ActionDataPhysX
 {
     PhysicsBackend::ActionType Type;
@@ -81,7 +84,6 @@ struct ActionDataPhysX
 struct ScenePhysX
 {
     PxScene* Scene = nullptr;
-    PxCpuDispatcher* CpuDispatcher = nullptr;
     PxControllerManager* ControllerManager = nullptr;
     void* ScratchMemory = nullptr;
     Vector3 Origin = Vector3::Zero;
@@ -92,8 +94,18 @@ struct ScenePhysX
     Array<PhysicsColliderActor*> RemoveColliders;
     Array<Joint*> RemoveJoints;
     Array<ActionDataPhysX> Actions;
+    Array<PxActor*> SignificanceActors;
+    Dictionary<PxActor*, uint32> SignificanceReducedActors;
+    uint32 SignificanceIndex = 0;
+    double SimulationStartTime = 0.0;
+    double SimulationEndTime = 0.0;
+    float SimulationTime = 0.0f;
+    float CollectTime = 0.0f;
 #if WITH_VEHICLE
     Array<WheeledVehicle*> WheelVehicles;
+    Array<PxVehicleWheels*> WheelVehiclesCache;
+    Array<PxWheelQueryResult> WheelVehiclesResultsPerWheel;
+    Array<PxVehicleWheelQueryResult> WheelVehiclesResultsPerVehicle;
     PxBatchQueryExt* WheelRaycastBatchQuery = nullptr;
     int32 WheelRaycastBatchQuerySize = 0;
 #endif
@@ -102,6 +114,8 @@ struct ScenePhysX
     Array<nv::cloth::Cloth*> ClothsList;
 #endif
 
+    void UpdateSignificance(const PhysicsSettings& settings);
+    void RestoreSignificance(PxActor* actor);
 #if WITH_VEHICLE
     void UpdateVehicles(float dt);
 #endif
@@ -134,6 +148,26 @@ class ErrorPhysX : public PxErrorCallback
     }
 };
 
+class CpuDispatcherPhysX : public PxCpuDispatcher
+{
+public:
+    void submitTask(PxBaseTask& task) override
+    {
+        // Run PhysX tasks on Job System threads to share the cores with other engine systems
+        PxBaseTask* taskPtr = &task;
+        JobSystem::Dispatch([taskPtr](int32)
+        {
+            taskPtr->run();
+            taskPtr->release();
+        });
+    }
+
+    uint32_t getWorkerCount() const override
+    {
+        return Math::Max(JobSystem::GetThreadsCount(), 1);
+    }
+};
+
 #if WITH_CLOTH
 
 class AssertPhysX : public nv::cloth::PxAssertHandler
@@ -518,6 +552,12 @@ class DynamicHitBuffer : public PxHitCallback<HitType>
         P2C(hit, hitInfo); \
 		hitInfo.Point += scenePhysX->Origin
 
+#define SCENE_QUERY_BATCH_CLEAR() for (int32 i = 0; i < queries.Length(); i++) \
+		{ \
+			results.Get()[i].Collider = nullptr; \
+			results.Get()[i].Distance = MAX_float; \
+		}
+
 #define SCENE_QUERY_COLLECT_ALL() results.Clear(); \
 		results.Resize(buffer.getNbAnyHits(), false); \
 		for (int32 i = 0; i < results.Count(); i++) \
@@ -558,6 +598,7 @@ namespace
     PxMaterial* DefaultMaterial = nullptr;
     AllocatorPhysX AllocatorCallback;
     ErrorPhysX ErrorCallback;
+    CpuDispatcherPhysX CpuDispatcher;
 #if WITH_CLOTH
     AssertPhysX AssertCallback;
     ProfilerPhysX ProfilerCallback;
@@ -579,9 +620,6 @@ namespace
 
 #if WITH_VEHICLE
     bool VehicleSDKInitialized = false;
-    Array<PxVehicleWheels*> WheelVehiclesCache;
-    Array<PxWheelQueryResult> WheelVehiclesResultsPerWheel;
-    Array<PxVehicleWheelQueryResult> WheelVehiclesResultsPerVehicle;
     PxVehicleDrivableSurfaceToTireFrictionPairs* WheelTireFrictions = nullptr;
     bool WheelTireFrictionsDirty = false;
     Array<float> WheelTireTypes;
@@ -716,6 +754,82 @@ PxFilterFlags FilterShader(
     return PxFilterFlag::eKILL;
 }
 
+void ScenePhysX::UpdateSignificance(const PhysicsSettings& settings)
+{
+    const auto& sources = Streaming::Sources;
+    const bool useSleep = settings.SleepDistance > 0.0f;
+    const bool useReducedSolver = settings.ReducedSolverDistance > 0.0f;
+    if (sources.IsEmpty() || (!useSleep && !useReducedSolver))
+    {
+        // Restore the original solver settings when feature gets disabled
+        if (SignificanceReducedActors.HasItems())
+        {
+            for (const auto& e : SignificanceReducedActors)
+                static_cast<PxRigidDynamic*>(e.Key)->setSolverIterationCounts(e.Value >> 8, e.Value & 0xff);
+            SignificanceReducedActors.Clear();
+        }
+        return;
+    }
+    PROFILE_CPU_NAMED("Physics.Significance");
+
+    // Process a batch of dynamic actors per step (round-robin)
+    const uint32 actorsCount = Scene->getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC);
+    if (SignificanceIndex >= actorsCount)
+        SignificanceIndex = 0;
+    SignificanceActors.Resize(Math::Min<uint32>(actorsCount - SignificanceIndex, PHYSX_SIGNIFICANCE_BATCH_SIZE), false);
+    const uint32 count = Scene->getActors(PxActorTypeFlag::eRIGID_DYNAMIC, SignificanceActors.Get(), SignificanceActors.Count(), SignificanceIndex);
+    SignificanceIndex += count;
+    const Real sleepDistanceSqr = useSleep ? Math::Square<Real>(settings.SleepDistance) : MAX_Real;
+    const Real reducedDistanceSqr = useReducedSolver ? Math::Square<Real>(settings.ReducedSolverDistance) : MAX_Real;
+    const Real restoreDistanceSqr = useReducedSolver ? Math::Square<Real>(settings.ReducedSolverDistance * 0.9f) : MAX_Real;
+    const PxU32 reducedPositionIters = (PxU32)Math::Clamp(settings.ReducedSolverPositionIterations, 1, 255);
+    const PxU32 reducedVelocityIters = (PxU32)Math::Clamp(settings.ReducedSolverVelocityIterations, 1, 255);
+    for (uint32 i = 0; i < count; i++)
+    {
+        auto actorPhysX = static_cast<PxRigidDynamic*>(SignificanceActors[i]);
+        if (actorPhysX->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC || actorPhysX->getActorFlags() & PxActorFlag::eDISABLE_SIMULATION)
+            continue;
+
+        // Find the distance to the closest streaming source
+        const Vector3 position = P2C(actorPhysX->getGlobalPose().p) + Origin;
+        Real minDistanceSqr = MAX_Real;
+        for (const StreamingSource& source : sources)
+            minDistanceSqr = Math::Min(minDistanceSqr, Vector3::DistanceSquared(position, source.Position));
+
+        // Reduce solver iterations for far objects (with a small hysteresis to prevent flickering)
+        uint32* reduced = SignificanceReducedActors.TryGet(actorPhysX);
+        if (minDistanceSqr >= reducedDistanceSqr)
+        {
+            if (!reduced)
+            {
+                PxU32 positionIters, velocityIters;
+                actorPhysX->getSolverIterationCounts(positionIters, velocityIters);
+                SignificanceReducedActors.Add(actorPhysX, (positionIters << 8) | velocityIters);
+                actorPhysX->setSolverIterationCounts(Math::Min(positionIters, reducedPositionIters), Math::Min(velocityIters, reducedVelocityIters));
+            }
+        }
+        else if (reduced && minDistanceSqr < restoreDistanceSqr)
+        {
+            actorPhysX->setSolverIterationCounts(*reduced >> 8, *reduced & 0xff);
+            SignificanceReducedActors.Remove(actorPhysX);
+        }
+
+        // Force sleeping for very far objects
+        if (minDistanceSqr >= sleepDistanceSqr && !actorPhysX->isSleeping())
+            actorPhysX->putToSleep();
+    }
+}
+
+void ScenePhysX::RestoreSignificance(PxActor* actor)
+{
+    uint32 reduced;
+    if (SignificanceReducedActors.TryGet(actor, reduced))
+    {
+        static_cast<PxRigidDynamic*>(actor)->setSolverIterationCounts(reduced >> 8, reduced & 0xff);
+        SignificanceReducedActors.Remove(actor);
+    }
+}
+
 #if WITH_VEHICLE
 
 void InitVehicleSDK()
@@ -729,6 +843,35 @@ void InitVehicleSDK()
     }
 }
 
+void UpdateWheelTireFrictions()
+{
+    // Update lookup table that maps wheel type into the surface friction
+    if (WheelTireFrictions && !WheelTireFrictionsDirty)
+        return;
+    WheelTireFrictionsDirty = false;
+    RELEASE_PHYSX(WheelTireFrictions);
+    Array<PxMaterial*, InlinedAllocation<8>> materials;
+    materials.Resize(Math::Min<int32>((int32)PhysX->getNbMaterials(), PxVehicleDrivableSurfaceToTireFrictionPairs::eMAX_NB_SURFACE_TYPES));
+    PxMaterial** materialsPtr = materials.Get();
+    PhysX->getMaterials(materialsPtr, materials.Count(), 0);
+    Array<PxVehicleDrivableSurfaceType, InlinedAllocation<8>> tireTypes;
+    tireTypes.Resize(materials.Count());
+    PxVehicleDrivableSurfaceType* tireTypesPtr = tireTypes.Get();
+    for (int32 i = 0; i < tireTypes.Count(); i++)
+        tireTypesPtr[i].mType = i;
+    WheelTireFrictions = PxVehicleDrivableSurfaceToTireFrictionPairs::allocate(WheelTireTypes.Count(), materials.Count());
+    WheelTireFrictions->setup(WheelTireTypes.Count(), materials.Count(), (const PxMaterial**)materialsPtr, tireTypesPtr);
+    for (int32 material = 0; material < materials.Count(); material++)
+    {
+        float friction = materialsPtr[material]->getStaticFriction();
+        for (int32 tireType = 0; tireType < WheelTireTypes.Count(); tireType++)
+        {
+            float scale = WheelTireTypes[tireType];
+            WheelTireFrictions->setTypePairFriction(material, tireType, friction * scale);
+        }
+    }
+}
+
 void ScenePhysX::UpdateVehicles(float dt)
 {
     if (WheelVehicles.IsEmpty())
@@ -1073,33 +1216,6 @@ void ScenePhysX::UpdateVehicles(float dt)
         WheelRaycastBatchQuery = PxCreateBatchQueryExt(*Scene, &WheelRaycastFilter, wheelsCount, wheelsCount, 0, 0, 0, 0);
     }
 
-    // Update lookup table that maps wheel type into the surface friction
-    if (!WheelTireFrictions || WheelTireFrictionsDirty)
-    {
-        WheelTireFrictionsDirty = false;
-        RELEASE_PHYSX(WheelTireFrictions);
-        Array<PxMaterial*, InlinedAllocation<8>> materials;
-        materials.Resize(Math::Min<int32>((int32)PhysX->getNbMaterials(), PxVehicleDrivableSurfaceToTireFrictionPairs::eMAX_NB_SURFACE_TYPES));
-        PxMaterial** materialsPtr = materials.Get();
-        PhysX->getMaterials(materialsPtr, materials.Count(), 0);
-        Array<PxVehicleDrivableSurfaceType, InlinedAllocation<8>> tireTypes;
-        tireTypes.Resize(materials.Count());
-        PxVehicleDrivableSurfaceType* tireTypesPtr = tireTypes.Get();
-        for (int32 i = 0; i < tireTypes.Count(); i++)
-            tireTypesPtr[i].mType = i;
-        WheelTireFrictions = PxVehicleDrivableSurfaceToTireFrictionPairs::allocate(WheelTireTypes.Count(), materials.Count());
-        WheelTireFrictions->setup(WheelTireTypes.Count(), materials.Count(), (const PxMaterial**)materialsPtr, tireTypesPtr);
-        for (int32 material = 0; material < materials.Count(); material++)
-        {
-            float friction = materialsPtr[material]->getStaticFriction();
-            for (int32 tireType = 0; tireType < WheelTireTypes.Count(); tireType++)
-            {
-                float scale = WheelTireTypes[tireType];
-                WheelTireFrictions->setTypePairFriction(material, tireType, friction * scale);
-            }
-        }
-    }
-
     // Setup cache for wheel states
     WheelVehiclesResultsPerVehicle.Resize(WheelVehiclesCache.Count(), false);
     WheelVehiclesResultsPerWheel.Resize(wheelsCount, false);
@@ -1118,7 +1234,7 @@ void ScenePhysX::UpdateVehicles(float dt)
     }
 
     // Update vehicles
-    if (WheelVehiclesCache.Count() != 0)
+    if (WheelVehiclesCache.Count() != 0 && WheelTireFrictions)
     {
         PxVehicleSuspensionRaycasts(WheelRaycastBatchQuery, WheelVehiclesCache.Count(), WheelVehiclesCache.Get());
         PxVehicleUpdates(dt, Scene->getGravity(), *WheelTireFrictions, WheelVehiclesCache.Count(), WheelVehiclesCache.Get(), WheelVehiclesResultsPerVehicle.Get());
@@ -1508,14 +1624,14 @@ bool CollisionCooking::CookConvexMesh(CookingInput& input, BytesContainer& outpu
         desc.flags |= PxConvexFlag::Enum::eFAST_INERTIA_COMPUTATION;
     if (EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::ShiftVertices))
         desc.flags |= PxConvexFlag::Enum::eSHIFT_VERTICES;
+    // Note: use local cooking params and the immediate cooking API so meshes can be cooked from multiple threads at once
     PxCookingParams cookingParams = cooking->getParams();
     cookingParams.suppressTriangleMeshRemapTable = EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::SuppressFaceRemapTable);
-    cooking->setParams(cookingParams);
 
     // Perform cooking
     PxDefaultMemoryOutputStream outputStream;
     PxConvexMeshCookingResult::Enum result;
-    if (!cooking->cookConvexMesh(desc, outputStream, &result))
+    if (!PxCookConvexMesh(cookingParams, desc, outputStream, &result))
     {
         LOG(Warning, "Convex Mesh cooking failed. Error code: {0}, Input vertices count: {1}", (int32)result, input.VertexCount);
         return true;
@@ -1543,14 +1659,14 @@ bool CollisionCooking::CookTriangleMesh(CookingInput& input, BytesContainer& out
     desc.triangles.stride = 3 * (input.Is16bitIndexData ? sizeof(uint16) : sizeof(uint32));
     desc.triangles.data = input.IndexData;
     desc.flags = input.Is16bitIndexData ? PxMeshFlag::e16_BIT_INDICES : (PxMeshFlag::Enum)0;
+    // Note: use local cooking params and the immediate cooking API so meshes can be cooked from multiple threads at once
     PxCookingParams cookingParams = cooking->getParams();
     cookingParams.suppressTriangleMeshRemapTable = EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::SuppressFaceRemapTable);
-    cooking->setParams(cookingParams);
 
     // Perform cooking
     PxDefaultMemoryOutputStream outputStream;
     PxTriangleMeshCookingResult::Enum result;
-    if (!cooking->cookTriangleMesh(desc, outputStream, &result))
+    if (!PxCookTriangleMesh(cookingParams, desc, outputStream, &result))
     {
         LOG(Warning, "Triangle Mesh cooking failed. Error code: {0}, Input vertices count: {1}, indices count: {2}", (int32)result, input.VertexCount, input.IndexCount);
         return true;
@@ -1577,7 +1693,7 @@ bool CollisionCooking::CookHeightField(int32 cols, int32 rows, const PhysicsBack
 
     WriteStreamPhysX outputStream;
     outputStream.Stream = &stream;
-    if (!Cooking->cookHeightField(heightFieldDesc, outputStream))
+    if (!PxCookHeightField(heightFieldDesc, outputStream))
     {
         LOG(Warning, "Height Field collision cooking failed.");
         return true;
@@ -1608,20 +1724,14 @@ PxMaterial* PhysicsBackendPhysX::GetDefaultMaterial()
 
 void PhysicsBackendPhysX::SimulationStepDone(PxScene* scene, float dt)
 {
-#if WITH_VEHICLE
-    ScenePhysX* scenePhysX = nullptr;
-    for (auto e : Physics::Scenes)
-    {
-        if (((ScenePhysX*)e->GetPhysicsScene())->Scene == scene)
-        {
-            scenePhysX = (ScenePhysX*)e->GetPhysicsScene();
-            break;
-        }
-    }
+    // Called from the job thread that finished the scene substep (scenes are simulated concurrently)
+    auto scenePhysX = (ScenePhysX*)scene->userData;
     if (!scenePhysX)
         return;
+#if WITH_VEHICLE
     scenePhysX->UpdateVehicles(dt);
 #endif
+    scenePhysX->SimulationEndTime = Platform::GetTimeSeconds();
 }
 
 bool PhysicsBackend::Init()
@@ -1708,8 +1818,6 @@ void PhysicsBackend::Shutdown()
     // Cleanup any resources
 #if WITH_VEHICLE
     RELEASE_PHYSX(WheelTireFrictions);
-    WheelVehiclesResultsPerWheel.Resize(0);
-    WheelVehiclesResultsPerVehicle.Resize(0);
 #endif
     RELEASE_PHYSX(DefaultMaterial);
 
@@ -1796,11 +1904,7 @@ void* PhysicsBackend::CreateScene(const PhysicsSettings& settings)
         break;
     }
     if (sceneDesc.cpuDispatcher == nullptr)
-    {
-        scenePhysX->CpuDispatcher = PxDefaultCpuDispatcherCreate(Math::Clamp<uint32>(Platform::GetCPUInfo().ProcessorCoreCount - 1, 1, 4));
-        CHECK_INIT(scenePhysX->CpuDispatcher, "PxDefaultCpuDispatcherCreate failed!");
-        sceneDesc.cpuDispatcher = scenePhysX->CpuDispatcher;
-    }
+        sceneDesc.cpuDispatcher = &CpuDispatcher;
     switch (settings.BroadPhaseType)
     {
     case PhysicsBroadPhaseType::SweepAndPrune:
@@ -1820,6 +1924,7 @@ void* PhysicsBackend::CreateScene(const PhysicsSettings& settings)
     // Create scene
     scenePhysX->Scene = PhysX->createScene(sceneDesc);
     CHECK_INIT(scenePhysX->Scene, "createScene failed!");
+    scenePhysX->Scene->userData = scenePhysX;
     SceneOrigins[scenePhysX->Scene] = Vector3::Zero;
 #if WITH_PVD
     auto pvdClient = scenePhysX->Scene->getScenePvdClient();
@@ -1861,7 +1966,6 @@ void PhysicsBackend::DestroyScene(void* scene)
     }
 #endif
     RELEASE_PHYSX(scenePhysX->ControllerManager);
-    SAFE_DELETE(scenePhysX->CpuDispatcher);
     Allocator::Free(scenePhysX->ScratchMemory);
     scenePhysX->Scene->release();
 
@@ -1892,7 +1996,16 @@ void PhysicsBackend::StartSimulateScene(void* scene, float dt)
         scenePhysX->Stepper.Setup(dt);
     }
 
+    // Reduce simulation of the objects far from the streaming sources
+    scenePhysX->UpdateSignificance(settings);
+#if WITH_VEHICLE
+    // Shared between the scenes so update it before the simulation (vehicles are updated on job threads)
+    if (scenePhysX->WheelVehicles.HasItems())
+        UpdateWheelTireFrictions();
+#endif
+
     // Start simulation (may not be fired due to too small delta time)
+    scenePhysX->SimulationStartTime = scenePhysX->SimulationEndTime = Platform::GetTimeSeconds();
     if (scenePhysX->Stepper.advance(scenePhysX->Scene, dt, scenePhysX->ScratchMemory, PHYSX_SCRATCH_BLOCK_SIZE) == false)
         return;
     scenePhysX->EventsCallback.Clear();
@@ -1912,6 +2025,8 @@ void PhysicsBackend::EndSimulateScene(void* scene)
         // Gather results (with waiting for the end)
         scenePhysX->Stepper.wait(scenePhysX->Scene);
     }
+    const double collectStartTime = Platform::GetTimeSeconds();
+    scenePhysX->SimulationTime = (float)((scenePhysX->SimulationEndTime - scenePhysX->SimulationStartTime) * 1000.0);
 
     {
         PROFILE_CPU_NAMED("Physics.FlushActiveTransforms");
@@ -1946,6 +2061,7 @@ void PhysicsBackend::EndSimulateScene(void* scene)
 
     // Clear delta after simulation ended
     scenePhysX->LastDeltaTime = 0.0f;
+    scenePhysX->CollectTime = (float)((Platform::GetTimeSeconds() - collectStartTime) * 1000.0);
 }
 
 Vector3 PhysicsBackend::GetSceneGravity(void* scene)
@@ -2005,16 +2121,17 @@ void PhysicsBackend::SetSceneOrigin(void* scene, const Vector3& oldOrigin, const
     scenePhysX->Scene->shiftOrigin(shift);
     scenePhysX->ControllerManager->shiftOrigin(shift);
 #if WITH_VEHICLE
-    WheelVehiclesCache.Clear();
+    auto& wheelVehiclesCache = scenePhysX->WheelVehiclesCache;
+    wheelVehiclesCache.Clear();
     for (auto wheelVehicle : scenePhysX->WheelVehicles)
     {
         if (!wheelVehicle->IsActiveInHierarchy())
             continue;
         auto drive = (PxVehicleWheels*)wheelVehicle->_vehicle;
         ASSERT(drive);
-        WheelVehiclesCache.Add(drive);
+        wheelVehiclesCache.Add(drive);
     }
-    PxVehicleShiftOrigin(shift, WheelVehiclesCache.Count(), WheelVehiclesCache.Get());
+    PxVehicleShiftOrigin(shift, wheelVehiclesCache.Count(), wheelVehiclesCache.Get());
 #endif
 #if WITH_CLOTH
     if (scenePhysX->ClothSolver)
@@ -2030,6 +2147,25 @@ void PhysicsBackend::SetSceneOrigin(void* scene, const Vector3& oldOrigin, const
     SceneOrigins[scenePhysX->Scene] = newOrigin;
 }
 
+bool PhysicsBackend::GetSceneSendCollisionEvents(void* scene)
+{
+    auto scenePhysX = (ScenePhysX*)scene;
+    return scenePhysX->EventsCallback.SendCollisions;
+}
+
+void PhysicsBackend::SetSceneSendCollisionEvents(void* scene, bool value)
+{
+    auto scenePhysX = (ScenePhysX*)scene;
+    scenePhysX->EventsCallback.SendCollisions = value;
+}
+
+void PhysicsBackend::GetSceneCollisions(void* scene, Span<Collision>& enter, Span<Collision>& exit)
+{
+    auto scenePhysX = (ScenePhysX*)scene;
+    enter = ToSpan(scenePhysX->EventsCallback.NewCollisions);
+    exit = ToSpan(scenePhysX->EventsCallback.RemovedCollisions);
+}
+
 void PhysicsBackend::AddSceneActor(void* scene, void* actor)
 {
     auto scenePhysX = (ScenePhysX*)scene;
@@ -2043,7 +2179,10 @@ void PhysicsBackend::RemoveSceneActor(void* scene, void* actor, bool immediately
     auto scenePhysX = (ScenePhysX*)scene;
     FlushLocker.Lock();
     if (immediately)
+    {
         scenePhysX->Scene->removeActor(*(PxActor*)actor);
+        scenePhysX->RestoreSignificance((PxActor*)actor);
+    }
     else
         scenePhysX->RemoveActors.Add((PxActor*)actor);
     FlushLocker.Unlock();
@@ -2079,6 +2218,8 @@ void PhysicsBackend::GetSceneStatistics(void* scene, PhysicsStatistics& result)
     result.LostPairs = px.nbLostPairs;
     result.NewTouches = px.nbNewTouches;
     result.LostTouches = px.nbLostTouches;
+    result.SimulationTime = scenePhysX->SimulationTime;
+    result.CollectTime = scenePhysX->CollectTime;
 }
 
 #endif
@@ -2110,6 +2251,24 @@ bool PhysicsBackend::RayCastAll(void* scene, const Vector3& origin, const Vector
     return true;
 }
 
+int32 PhysicsBackend::RayCastBatch(void* scene, const Span<RayCastQuery>& queries, Span<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_BATCH_CLEAR();
+    SCENE_QUERY_SETUP(true);
+    PxRaycastBuffer buffer;
+    int32 hits = 0;
+    for (int32 i = 0; i < queries.Length(); i++)
+    {
+        const RayCastQuery& query = queries.Get()[i];
+        if (!scenePhysX->Scene->raycast(C2P(query.Origin - scenePhysX->Origin), C2P(query.Direction), query.MaxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+            continue;
+        RayCastHit& hitInfo = results.Get()[i];
+        SCENE_QUERY_COLLECT_SINGLE();
+        hits++;
+    }
+    return hits;
+}
+
 bool PhysicsBackend::BoxCast(void* scene, const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_SWEEP_1();
@@ -2170,6 +2329,25 @@ bool PhysicsBackend::SphereCastAll(void* scene, const Vector3& center, const flo
     return true;
 }
 
+int32 PhysicsBackend::SphereCastBatch(void* scene, const float radius, const Span<RayCastQuery>& queries, Span<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_BATCH_CLEAR();
+    SCENE_QUERY_SETUP_SWEEP_1();
+    const PxSphereGeometry geometry(radius);
+    int32 hits = 0;
+    for (int32 i = 0; i < queries.Length(); i++)
+    {
+        const RayCastQuery& query = queries.Get()[i];
+        const PxTransform pose(C2P(query.Origin - scenePhysX->Origin));
+        if (!scenePhysX->Scene->sweep(geometry, pose, C2P(query.Direction), query.MaxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+            continue;
+        RayCastHit& hitInfo = results.Get()[i];
+        SCENE_QUERY_COLLECT_SINGLE();
+        hits++;
+    }
+    return hits;
+}
+
 bool PhysicsBackend::CapsuleCast(void* scene, const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_SWEEP_1();
@@ -2249,6 +2427,24 @@ bool PhysicsBackend::CheckSphere(void* scene, const Vector3& center, const float
     return scenePhysX->Scene->overlap(geometry, pose, buffer, filterData, &QueryFilter);
 }
 
+int32 PhysicsBackend::CheckSphereBatch(void* scene, const float radius, const Span<Vector3>& centers, Span<bool>& results, uint32 layerMask, bool hitTriggers)
+{
+    for (int32 i = 0; i < centers.Length(); i++)
+        results.Get()[i] = false;
+    SCENE_QUERY_SETUP_OVERLAP_1();
+    const PxSphereGeometry geometry(radius);
+    int32 hits = 0;
+    for (int32 i = 0; i < centers.Length(); i++)
+    {
+        const PxTransform pose(C2P(centers.Get()[i] - scenePhysX->Origin));
+        if (!scenePhysX->Scene->overlap(geometry, pose, buffer, filterData, &QueryFilter))
+            continue;
+        results.Get()[i] = true;
+        hits++;
+    }
+    return hits;
+}
+
 bool PhysicsBackend::CheckCapsule(void* scene, const Vector3& center, const float radius, const float height, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_OVERLAP_1();
@@ -4466,6 +4662,8 @@ void PhysicsBackend::FlushRequests(void* scene)
     if (scenePhysX->RemoveActors.HasItems())
     {
         scenePhysX->Scene->removeActors(scenePhysX->RemoveActors.Get(), scenePhysX->RemoveActors.Count(), true);
+        for (int32 i = 0; i < scenePhysX->RemoveActors.Count(); i++)
+            scenePhysX->RestoreSignificance(scenePhysX->RemoveActors[i]);
         scenePhysX->RemoveActors.Clear();
     }
     if (scenePhysX->RemoveColliders.HasItems())
@@ -25,6 +25,32 @@ namespace
             }
         }
     }
+
+    void ClearColliderFromCollection(const PhysicsColliderActor* collider, Array<Collision>& collection)
+    {
+        for (int32 i = 0; i < collection.Count(); i++)
+        {
+            const Collision& c = collection[i];
+            if (c.ThisActor == collider || c.OtherActor == collider)
+                collection.RemoveAt(i--);
+        }
+    }
+
+    void GetContactReportFilter(const Collision& c, float& threshold, bool& firstContactOnly)
+    {
+        threshold = 0.0f;
+        firstContactOnly = false;
+        if (const auto collider = dynamic_cast<const Collider*>(c.ThisActor))
+        {
+            threshold = collider->CollisionEventsThreshold;
+            firstContactOnly = collider->CollisionEventsFirstContactOnly;
+        }
+        if (const auto collider = dynamic_cast<const Collider*>(c.OtherActor))
+        {
+            threshold = Math::Max(threshold, collider->CollisionEventsThreshold);
+            firstContactOnly |= collider->CollisionEventsFirstContactOnly;
+        }
+    }
 }
 
 void SimulationEventCallback::Clear()
@@ -40,6 +66,8 @@ void SimulationEventCallback::Clear()
 
 void SimulationEventCallback::SendCollisionEvents()
 {
+    if (!SendCollisions)
+        return;
     for (auto& c : RemovedCollisions)
     {
         c.ThisActor->OnCollisionExit(c);
@@ -82,6 +110,13 @@ void SimulationEventCallback::OnColliderRemoved(PhysicsColliderActor* collider)
 {
     ClearColliderFromCollection(collider, NewTriggerPairs);
     ClearColliderFromCollection(collider, LostTriggerPairs);
+    ClearColliderFromCollection(collider, NewCollisions);
+    ClearColliderFromCollection(collider, RemovedCollisions);
+    for (auto i = FilteredPairs.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Item.First == collider || i->Item.Second == collider)
+            FilteredPairs.Remove(i);
+    }
 }
 
 void SimulationEventCallback::OnJointRemoved(Joint* joint)
@@ -171,13 +206,21 @@ void SimulationEventCallback::onContact(const PxContactPairHeader& pairHeader, c
             }
         }
 
+        // Apply the colliders contact report filtering
+        float threshold;
+        bool firstContactOnly;
+        GetContactReportFilter(c, threshold, firstContactOnly);
         if (pair.flags & PxContactPairFlag::eACTOR_PAIR_HAS_FIRST_TOUCH)
         {
-            NewCollisions.Add(c);
+            if (threshold > 0.0f && c.Impulse.LengthSquared() < threshold * threshold)
+                FilteredPairs.Add(CollidersPair(c.ThisActor, c.OtherActor));
+            else
+                NewCollisions.Add(c);
         }
         else if (pair.flags & PxContactPairFlag::eACTOR_PAIR_LOST_TOUCH)
         {
-            RemovedCollisions.Add(c);
+            if (!FilteredPairs.Remove(CollidersPair(c.ThisActor, c.OtherActor)) && !firstContactOnly)
+                RemovedCollisions.Add(c);
         }
     }
     //ASSERT(!j.nextItemSet());
@@ -8,6 +8,7 @@
 #include "Engine/Physics/Collisions.h"
 #include "Engine/Physics/Colliders/Collider.h"
 #include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Collections/HashSet.h"
 #include <ThirdParty/PhysX/PxSimulationEventCallback.h>
 
 /// <summary>
@@ -43,9 +44,19 @@ class SimulationEventCallback : public PxSimulationEventCallback
     /// </summary>
     Array<Joint*> BrokenJoints;
 
+    /// <summary>
+    /// The colliding pairs which collision start was filtered out (by the collider contact report settings) so the collision end is skipped too. Persistent between simulation steps.
+    /// </summary>
+    HashSet<CollidersPair> FilteredPairs;
+
+    /// <summary>
+    /// True if send collision events to the colliders (per-actor events), otherwise collisions are only accessible via the scene collisions buffers.
+    /// </summary>
+    bool SendCollisions = true;
+
 public:
     /// <summary>
-    /// Clears the data.
+    /// Clears the data (keeps the allocated memory to reuse it for the next simulation step).
     /// </summary>
     void Clear();
 
@@ -39,6 +39,8 @@ public override void Setup(BuildOptions options)
     {
         base.Setup(options);
 
+        options.PrivateDependencies.Add("Streaming");
+
         SetupPhysicsBackend(this, options);
 
         if (WithCooking)
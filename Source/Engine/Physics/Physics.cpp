@@ -9,8 +9,42 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+
+// The minimum amount of batched scene queries to split them into jobs executed in parallel
+#define PHYSICS_BATCH_QUERIES_ASYNC_MIN 256
+
+// The amount of simulation steps after which the not read asynchronous query results are released
+#define PHYSICS_ASYNC_QUERY_MAX_STEPS 8
+
+struct PhysicsSceneAsyncQuery
+{
+    enum class States
+    {
+        Pending,
+        Running,
+        Ready,
+    };
+
+    uint64 Handle;
+    States State;
+    uint32 LayerMask;
+    bool HitTriggers;
+    int32 Hits;
+    uint32 Step;
+    Array<RayCastQuery> Queries;
+    Array<RayCastHit> Results;
+
+    void Execute(void* scene)
+    {
+        Results.Resize(Queries.Count(), false);
+        Span<RayCastHit> results = ToSpan(Results);
+        Hits = PhysicsBackend::RayCastBatch(scene, ToSpan(Queries), results, LayerMask, HitTriggers);
+    }
+};
 
 PhysicsScene* Physics::DefaultScene = nullptr;
 Array<PhysicsScene*> Physics::Scenes;
@@ -33,6 +67,27 @@ class PhysicsService : public EngineService
 
 PhysicsService PhysicsServiceInstance;
 
+namespace
+{
+    template<typename QueryType, typename ResultType, typename BatchType>
+    int32 ExecuteBatch(const Span<QueryType>& queries, Span<ResultType>& results, const BatchType& batch)
+    {
+        PROFILE_CPU();
+        if (queries.Length() < PHYSICS_BATCH_QUERIES_ASYNC_MIN || JobSystem::GetThreadsCount() <= 1)
+            return batch(queries, results);
+
+        // Split large batches into jobs (scene queries are read-only so they can run concurrently)
+        int64 hits = 0;
+        JobSystem::ParallelFor(0, queries.Length(), PHYSICS_BATCH_QUERIES_ASYNC_MIN / 2, [&queries, &results, &batch, &hits](int32 start, int32 end)
+        {
+            const Span<QueryType> jobQueries(queries.Get() + start, end - start);
+            Span<ResultType> jobResults(results.Get() + start, end - start);
+            Platform::InterlockedAdd(&hits, batch(jobQueries, jobResults));
+        });
+        return (int32)hits;
+    }
+}
+
 void PhysicsSettings::Apply()
 {
     Time::_physicsMaxDeltaTime = MaxDeltaTime;
@@ -63,6 +118,10 @@ void PhysicsSettings::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(EnableSubstepping);
     DESERIALIZE(SubstepDeltaTime);
     DESERIALIZE(MaxSubsteps);
+    DESERIALIZE(SleepDistance);
+    DESERIALIZE(ReducedSolverDistance);
+    DESERIALIZE(ReducedSolverPositionIterations);
+    DESERIALIZE(ReducedSolverVelocityIterations);
     DESERIALIZE(QueriesHitTriggers);
     DESERIALIZE(SupportCookingAtRuntime);
 
@@ -189,6 +248,9 @@ void Physics::SetBounceThresholdVelocity(const float value)
 
 void Physics::Simulate(float dt)
 {
+    PROFILE_MEM(Physics);
+
+    // Start all scenes first so they are simulated concurrently on the job system (results are collected later in CollectResults)
     for (PhysicsScene* scene : Scenes)
     {
         if (scene->GetAutoSimulation())
@@ -198,6 +260,7 @@ void Physics::Simulate(float dt)
 
 void Physics::CollectResults()
 {
+    PROFILE_MEM(Physics);
     for (PhysicsScene* scene : Scenes)
     {
         if (scene->GetAutoSimulation())
@@ -213,6 +276,7 @@ bool Physics::IsDuringSimulation()
 void Physics::FlushRequests()
 {
     PROFILE_CPU_NAMED("Physics.FlushRequests");
+    PROFILE_MEM(Physics);
     for (PhysicsScene* scene : Scenes)
         PhysicsBackend::FlushRequests(scene->GetPhysicsScene());
     PhysicsBackend::FlushRequests();
@@ -251,6 +315,31 @@ bool Physics::RayCastAll(const Vector3& origin, const Vector3& direction, Array<
     return DefaultScene->RayCastAll(origin, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 Physics::RayCastBatch(const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->RayCastBatch(queries, results, layerMask, hitTriggers);
+}
+
+int32 Physics::RayCastBatch(const Span<RayCastQuery>& queries, Array<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->RayCastBatch(queries, results, layerMask, hitTriggers);
+}
+
+uint64 Physics::RayCastBatchAsync(const Span<RayCastQuery>& queries, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->RayCastBatchAsync(queries, layerMask, hitTriggers);
+}
+
+bool Physics::IsAsyncQueryReady(uint64 handle)
+{
+    return DefaultScene->IsAsyncQueryReady(handle);
+}
+
+int32 Physics::GetAsyncQueryResults(uint64 handle, Array<RayCastHit>& results)
+{
+    return DefaultScene->GetAsyncQueryResults(handle, results);
+}
+
 bool Physics::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -287,6 +376,16 @@ bool Physics::SphereCastAll(const Vector3& center, const float radius, const Vec
     return DefaultScene->SphereCastAll(center, radius, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 Physics::SphereCastBatch(const float radius, const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->SphereCastBatch(radius, queries, results, layerMask, hitTriggers);
+}
+
+int32 Physics::SphereCastBatch(const float radius, const Span<RayCastQuery>& queries, Array<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->SphereCastBatch(radius, queries, results, layerMask, hitTriggers);
+}
+
 bool Physics::CapsuleCast(const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -333,6 +432,16 @@ bool Physics::CheckSphere(const Vector3& center, const float radius, uint32 laye
     return DefaultScene->CheckSphere(center, radius, layerMask, hitTriggers);
 }
 
+int32 Physics::CheckSphereBatch(const float radius, const Span<Vector3>& centers, Span<bool> results, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->CheckSphereBatch(radius, centers, results, layerMask, hitTriggers);
+}
+
+int32 Physics::CheckSphereBatch(const float radius, const Span<Vector3>& centers, Array<bool>& results, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->CheckSphereBatch(radius, centers, results, layerMask, hitTriggers);
+}
+
 bool Physics::CheckCapsule(const Vector3& center, const float radius, const float height, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return DefaultScene->CheckCapsule(center, radius, height, rotation, layerMask, hitTriggers);
@@ -390,6 +499,9 @@ PhysicsScene::PhysicsScene(const SpawnParams& params)
 
 PhysicsScene::~PhysicsScene()
 {
+    if (_asyncQueriesJob)
+        JobSystem::Wait(_asyncQueriesJob);
+    _asyncQueries.ClearDelete();
     if (_scene)
         PhysicsBackend::DestroyScene(_scene);
 }
@@ -448,6 +560,30 @@ void PhysicsScene::SetOrigin(const Vector3& value)
     }
 }
 
+bool PhysicsScene::GetSendCollisionEvents() const
+{
+    return PhysicsBackend::GetSceneSendCollisionEvents(_scene);
+}
+
+void PhysicsScene::SetSendCollisionEvents(bool value)
+{
+    PhysicsBackend::SetSceneSendCollisionEvents(_scene, value);
+}
+
+Span<Collision> PhysicsScene::GetCollisionsEnter() const
+{
+    Span<Collision> enter, exit;
+    PhysicsBackend::GetSceneCollisions(_scene, enter, exit);
+    return enter;
+}
+
+Span<Collision> PhysicsScene::GetCollisionsExit() const
+{
+    Span<Collision> enter, exit;
+    PhysicsBackend::GetSceneCollisions(_scene, enter, exit);
+    return exit;
+}
+
 #if COMPILE_WITH_PROFILER
 
 PhysicsStatistics PhysicsScene::GetStatistics() const
@@ -472,9 +608,34 @@ bool PhysicsScene::Init(const StringView& name, const PhysicsSettings& settings)
 
 void PhysicsScene::Simulate(float dt)
 {
+    PROFILE_CPU();
     ASSERT(IsInMainThread() && !_isDuringSimulation);
     _isDuringSimulation = true;
     PhysicsBackend::StartSimulateScene(_scene, dt);
+
+    // Run pending async queries in parallel with the simulation (scene queries use the state from before the simulation step)
+    _asyncQueriesLocker.Lock();
+    Array<PhysicsSceneAsyncQuery*, InlinedAllocation<32>> pending;
+    for (PhysicsSceneAsyncQuery* query : _asyncQueries)
+    {
+        if (query->State == PhysicsSceneAsyncQuery::States::Pending)
+        {
+            query->State = PhysicsSceneAsyncQuery::States::Running;
+            pending.Add(query);
+        }
+    }
+    _asyncQueriesLocker.Unlock();
+    if (pending.HasItems())
+    {
+        PROFILE_CPU_NAMED("Physics.AsyncQueries");
+        Array<PhysicsSceneAsyncQuery*> queries(pending);
+        void* scene = _scene;
+        _asyncQueriesJob = JobSystem::Dispatch([scene, queries](int32 i)
+        {
+            PROFILE_CPU_NAMED("Physics.AsyncQuery");
+            queries[i]->Execute(scene);
+        }, queries.Count());
+    }
 }
 
 bool PhysicsScene::IsDuringSimulation() const
@@ -486,7 +647,35 @@ void PhysicsScene::CollectResults()
 {
     if (!_isDuringSimulation)
         return;
+    PROFILE_CPU();
     ASSERT(IsInMainThread());
+
+    // Finish async queries before the simulation results are applied to the scene
+    if (_asyncQueriesJob)
+    {
+        PROFILE_CPU_NAMED("Physics.AsyncQueries");
+        JobSystem::Wait(_asyncQueriesJob);
+        _asyncQueriesJob = 0;
+    }
+    _asyncQueriesLocker.Lock();
+    _asyncQueriesStep++;
+    for (int32 i = _asyncQueries.Count() - 1; i >= 0; i--)
+    {
+        PhysicsSceneAsyncQuery* query = _asyncQueries[i];
+        if (query->State == PhysicsSceneAsyncQuery::States::Running)
+        {
+            query->State = PhysicsSceneAsyncQuery::States::Ready;
+            query->Step = _asyncQueriesStep;
+        }
+        else if (query->State == PhysicsSceneAsyncQuery::States::Ready && _asyncQueriesStep - query->Step > PHYSICS_ASYNC_QUERY_MAX_STEPS)
+        {
+            // Release not used results
+            _asyncQueries.RemoveAtKeepOrder(i);
+            Delete(query);
+        }
+    }
+    _asyncQueriesLocker.Unlock();
+
     PhysicsBackend::EndSimulateScene(_scene);
     _isDuringSimulation = false;
 }
@@ -536,6 +725,84 @@ bool PhysicsScene::RayCastAll(const Vector3& origin, const Vector3& direction, A
     return PhysicsBackend::RayCastAll(_scene, origin, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::RayCastBatch(const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN(results.Length() >= queries.Length(), 0);
+    return ExecuteBatch(queries, results, [this, layerMask, hitTriggers](const Span<RayCastQuery>& q, Span<RayCastHit>& r)
+    {
+        return PhysicsBackend::RayCastBatch(_scene, q, r, layerMask, hitTriggers);
+    });
+}
+
+int32 PhysicsScene::RayCastBatch(const Span<RayCastQuery>& queries, Array<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    results.Resize(queries.Length(), false);
+    return RayCastBatch(queries, ToSpan(results), layerMask, hitTriggers);
+}
+
+uint64 PhysicsScene::RayCastBatchAsync(const Span<RayCastQuery>& queries, uint32 layerMask, bool hitTriggers)
+{
+    auto query = New<PhysicsSceneAsyncQuery>();
+    query->State = PhysicsSceneAsyncQuery::States::Pending;
+    query->LayerMask = layerMask;
+    query->HitTriggers = hitTriggers;
+    query->Hits = 0;
+    query->Step = 0;
+    query->Queries.Set(queries.Get(), queries.Length());
+    ScopeLock lock(_asyncQueriesLocker);
+    query->Handle = ++_asyncQueriesCounter;
+    _asyncQueries.Add(query);
+    return query->Handle;
+}
+
+bool PhysicsScene::IsAsyncQueryReady(uint64 handle)
+{
+    ScopeLock lock(_asyncQueriesLocker);
+    for (const PhysicsSceneAsyncQuery* query : _asyncQueries)
+    {
+        if (query->Handle == handle)
+            return query->State == PhysicsSceneAsyncQuery::States::Ready;
+    }
+    return false;
+}
+
+int32 PhysicsScene::GetAsyncQueryResults(uint64 handle, Array<RayCastHit>& results)
+{
+    PhysicsSceneAsyncQuery* query = nullptr;
+    _asyncQueriesLocker.Lock();
+    for (int32 i = 0; i < _asyncQueries.Count(); i++)
+    {
+        if (_asyncQueries[i]->Handle == handle)
+        {
+            query = _asyncQueries[i];
+            _asyncQueries.RemoveAtKeepOrder(i);
+            break;
+        }
+    }
+    _asyncQueriesLocker.Unlock();
+    if (!query)
+    {
+        results.Clear();
+        return -1;
+    }
+
+    // Ensure the query has been executed
+    if (query->State == PhysicsSceneAsyncQuery::States::Running)
+    {
+        JobSystem::Wait(_asyncQueriesJob);
+    }
+    else if (query->State == PhysicsSceneAsyncQuery::States::Pending)
+    {
+        PROFILE_CPU_NAMED("Physics.AsyncQuery");
+        query->Execute(_scene);
+    }
+
+    results = MoveTemp(query->Results);
+    const int32 hits = query->Hits;
+    Delete(query);
+    return hits;
+}
+
 bool PhysicsScene::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -572,6 +839,21 @@ bool PhysicsScene::SphereCastAll(const Vector3& center, const float radius, cons
     return PhysicsBackend::SphereCastAll(_scene, center, radius, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::SphereCastBatch(const float radius, const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN(results.Length() >= queries.Length(), 0);
+    return ExecuteBatch(queries, results, [this, radius, layerMask, hitTriggers](const Span<RayCastQuery>& q, Span<RayCastHit>& r)
+    {
+        return PhysicsBackend::SphereCastBatch(_scene, radius, q, r, layerMask, hitTriggers);
+    });
+}
+
+int32 PhysicsScene::SphereCastBatch(const float radius, const Span<RayCastQuery>& queries, Array<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    results.Resize(queries.Length(), false);
+    return SphereCastBatch(radius, queries, ToSpan(results), layerMask, hitTriggers);
+}
+
 bool PhysicsScene::CapsuleCast(const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -618,6 +900,21 @@ bool PhysicsScene::CheckSphere(const Vector3& center, const float radius, uint32
     return PhysicsBackend::CheckSphere(_scene, center, radius, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::CheckSphereBatch(const float radius, const Span<Vector3>& centers, Span<bool> results, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN(results.Length() >= centers.Length(), 0);
+    return ExecuteBatch(centers, results, [this, radius, layerMask, hitTriggers](const Span<Vector3>& q, Span<bool>& r)
+    {
+        return PhysicsBackend::CheckSphereBatch(_scene, radius, q, r, layerMask, hitTriggers);
+    });
+}
+
+int32 PhysicsScene::CheckSphereBatch(const float radius, const Span<Vector3>& centers, Array<bool>& results, uint32 layerMask, bool hitTriggers)
+{
+    results.Resize(centers.Length(), false);
+    return CheckSphereBatch(radius, centers, ToSpan(results), layerMask, hitTriggers);
+}
+
 bool PhysicsScene::CheckCapsule(const Vector3& center, const float radius, const float height, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return PhysicsBackend::CheckCapsule(_scene, center, radius, height, rotation, layerMask, hitTriggers);
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Types/Span.h"
 #include "Types.h"
 
 /// <summary>
@@ -162,6 +163,51 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool RayCastAll(const Vector3& origin, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (the query setup is shared by all rays). Used to resolve many queries at once (eg. particles collisions). Large batches are split into jobs executed in parallel.
+    /// </summary>
+    /// <param name="queries">The rays to cast.</param>
+    /// <param name="results">The result hits (the same size as queries). Collider is null and Distance is MAX_float for the rays that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of rays that hit any matching object.</returns>
+    static int32 RayCastBatch(const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (the query setup is shared by all rays). Used to resolve many queries at once with a single call (eg. from scripts).
+    /// </summary>
+    /// <param name="queries">The rays to cast.</param>
+    /// <param name="results">The result hits (resized to the queries count). Collider is null and Distance is MAX_float for the rays that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of rays that hit any matching object.</returns>
+    API_FUNCTION() static int32 RayCastBatch(const Span<RayCastQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Submits a batch of raycasts to be performed asynchronously. Queries are executed on job threads in parallel with the next physics simulation step (against the scene state from before the simulation) so gameplay doesn't need to wait for them. Use GetAsyncQueryResults to read the results (eg. next frame).
+    /// </summary>
+    /// <remarks>If the scene is not simulated (eg. game is paused) the queries are executed when reading the results. Results that are not read within a few simulation steps are released.</remarks>
+    /// <param name="queries">The rays to cast.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The query handle used to read the results. Never zero.</returns>
+    API_FUNCTION() static uint64 RayCastBatchAsync(const Span<RayCastQuery>& queries, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Checks if the results of the asynchronous query are ready to read (query has been executed).
+    /// </summary>
+    /// <param name="handle">The query handle returned by RayCastBatchAsync.</param>
+    /// <returns>True if the results are ready, otherwise false (not executed yet or invalid handle).</returns>
+    API_FUNCTION() static bool IsAsyncQueryReady(uint64 handle);
+
+    /// <summary>
+    /// Gets the results of the asynchronous query and releases it (handle becomes invalid). Executes the query (or waits for it) if the results are not ready yet.
+    /// </summary>
+    /// <param name="handle">The query handle returned by RayCastBatchAsync.</param>
+    /// <param name="results">The result hits (the same size as the submitted queries). Collider is null and Distance is MAX_float for the rays that didn't hit anything.</param>
+    /// <returns>The amount of rays that hit any matching object, or -1 if handle is invalid (eg. results have been already released).</returns>
+    API_FUNCTION() static int32 GetAsyncQueryResults(uint64 handle, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a box geometry.
     /// </summary>
@@ -241,6 +287,28 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if sphere hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool SphereCastAll(const Vector3& center, float radius, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a batch of sweep tests against objects in the scene using a sphere geometry (the query setup is shared by all sweeps). Used to resolve many queries at once (eg. particles collisions). Large batches are split into jobs executed in parallel.
+    /// </summary>
+    /// <param name="radius">The radius of the sphere (the same for all queries).</param>
+    /// <param name="queries">The sweeps to perform (origin is the sphere center).</param>
+    /// <param name="results">The result hits (the same size as queries). Collider is null and Distance is MAX_float for the sweeps that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of sweeps that hit any matching object.</returns>
+    static int32 SphereCastBatch(float radius, const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs a batch of sweep tests against objects in the scene using a sphere geometry (the query setup is shared by all sweeps). Used to resolve many queries at once with a single call (eg. from scripts).
+    /// </summary>
+    /// <param name="radius">The radius of the sphere (the same for all queries).</param>
+    /// <param name="queries">The sweeps to perform (origin is the sphere center).</param>
+    /// <param name="results">The result hits (resized to the queries count). Collider is null and Distance is MAX_float for the sweeps that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of sweeps that hit any matching object.</returns>
+    API_FUNCTION() static int32 SphereCastBatch(float radius, const Span<RayCastQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a capsule geometry.
     /// </summary>
@@ -350,6 +418,28 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if sphere overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() static bool CheckSphere(const Vector3& center, float radius, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Checks whether the given spheres overlap any other colliders in the scene (the query setup is shared by all spheres). Used to resolve many queries at once (eg. AI visibility or spawn checks). Large batches are split into jobs executed in parallel.
+    /// </summary>
+    /// <param name="radius">The radius of the spheres (the same for all queries).</param>
+    /// <param name="centers">The spheres centers.</param>
+    /// <param name="results">The results (the same size as centers). Contains true for the spheres that overlap any matching object.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of spheres that overlap any matching object.</returns>
+    static int32 CheckSphereBatch(float radius, const Span<Vector3>& centers, Span<bool> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Checks whether the given spheres overlap any other colliders in the scene (the query setup is shared by all spheres). Used to resolve many queries at once with a single call (eg. from scripts).
+    /// </summary>
+    /// <param name="radius">The radius of the spheres (the same for all queries).</param>
+    /// <param name="centers">The spheres centers.</param>
+    /// <param name="results">The results (resized to the centers count). Contains true for the spheres that overlap any matching object.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of spheres that overlap any matching object.</returns>
+    API_FUNCTION() static int32 CheckSphereBatch(float radius, const Span<Vector3>& centers, API_PARAM(Out) Array<bool, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Checks whether the given capsule overlaps with other colliders or not.
     /// </summary>
@@ -111,6 +111,21 @@ void PhysicsBackend::SetSceneOrigin(void* scene, const Vector3& oldOrigin, const
 {
 }
 
+bool PhysicsBackend::GetSceneSendCollisionEvents(void* scene)
+{
+    return true;
+}
+
+void PhysicsBackend::SetSceneSendCollisionEvents(void* scene, bool value)
+{
+}
+
+void PhysicsBackend::GetSceneCollisions(void* scene, Span<Collision>& enter, Span<Collision>& exit)
+{
+    enter = Span<Collision>();
+    exit = Span<Collision>();
+}
+
 void PhysicsBackend::AddSceneActor(void* scene, void* actor)
 {
 }
@@ -146,6 +161,16 @@ bool PhysicsBackend::RayCastAll(void* scene, const Vector3& origin, const Vector
     return false;
 }
 
+int32 PhysicsBackend::RayCastBatch(void* scene, const Span<RayCastQuery>& queries, Span<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    for (int32 i = 0; i < queries.Length(); i++)
+    {
+        results[i].Collider = nullptr;
+        results[i].Distance = MAX_float;
+    }
+    return 0;
+}
+
 bool PhysicsBackend::BoxCast(void* scene, const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -176,6 +201,16 @@ bool PhysicsBackend::SphereCastAll(void* scene, const Vector3& center, const flo
     return false;
 }
 
+int32 PhysicsBackend::SphereCastBatch(void* scene, const float radius, const Span<RayCastQuery>& queries, Span<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
+{
+    for (int32 i = 0; i < queries.Length(); i++)
+    {
+        results[i].Collider = nullptr;
+        results[i].Distance = MAX_float;
+    }
+    return 0;
+}
+
 bool PhysicsBackend::CapsuleCast(void* scene, const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -216,6 +251,13 @@ bool PhysicsBackend::CheckSphere(void* scene, const Vector3& center, const float
     return false;
 }
 
+int32 PhysicsBackend::CheckSphereBatch(void* scene, const float radius, const Span<Vector3>& centers, Span<bool>& results, uint32 layerMask, bool hitTriggers)
+{
+    for (int32 i = 0; i < centers.Length(); i++)
+        results[i] = false;
+    return 0;
+}
+
 bool PhysicsBackend::CheckCapsule(void* scene, const Vector3& center, const float radius, const float height, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -4,11 +4,16 @@
 
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Types.h"
 
 struct ActionData;
 struct RayCastHit;
+struct Collision;
+struct PhysicsSceneAsyncQuery;
 class PhysicsSettings;
 class PhysicsColliderActor;
 class Joint;
@@ -30,6 +35,11 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     bool _isDuringSimulation = false;
     Vector3 _origin = Vector3::Zero;
     void* _scene = nullptr;
+    CriticalSection _asyncQueriesLocker;
+    Array<PhysicsSceneAsyncQuery*> _asyncQueries;
+    uint64 _asyncQueriesCounter = 0;
+    uint32 _asyncQueriesStep = 0;
+    int64 _asyncQueriesJob = 0;
 
 public:
     ~PhysicsScene();
@@ -100,6 +110,26 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// </summary>
     API_PROPERTY() void SetOrigin(const Vector3& value);
 
+    /// <summary>
+    /// Gets the collision events sending feature that calls CollisionEnter and CollisionExit events on the colliders after the simulation. When disabled, collisions can be only accessed via GetCollisionsEnter and GetCollisionsExit (eg. to process dense piles of debris contacts in a batch).
+    /// </summary>
+    API_PROPERTY() bool GetSendCollisionEvents() const;
+
+    /// <summary>
+    /// Sets the collision events sending feature that calls CollisionEnter and CollisionExit events on the colliders after the simulation. When disabled, collisions can be only accessed via GetCollisionsEnter and GetCollisionsExit (eg. to process dense piles of debris contacts in a batch).
+    /// </summary>
+    API_PROPERTY() void SetSendCollisionEvents(bool value);
+
+    /// <summary>
+    /// Gets the collisions that started during the last simulation step (after contact report filtering of the colliders). Valid until the next simulation step. Each collision is reported once for the pair of colliders.
+    /// </summary>
+    API_FUNCTION() Span<Collision> GetCollisionsEnter() const;
+
+    /// <summary>
+    /// Gets the collisions that ended during the last simulation step (after contact report filtering of the colliders). Valid until the next simulation step. Each collision is reported once for the pair of colliders.
+    /// </summary>
+    API_FUNCTION() Span<Collision> GetCollisionsExit() const;
+
 #if COMPILE_WITH_PROFILER
     /// <summary>
     /// Gets the physics simulation statistics for the scene.
@@ -200,6 +230,51 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool RayCastAll(const Vector3& origin, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (the query setup is shared by all rays). Used to resolve many queries at once (eg. particles collisions). Large batches are split into jobs executed in parallel.
+    /// </summary>
+    /// <param name="queries">The rays to cast.</param>
+    /// <param name="results">The result hits (the same size as queries). Collider is null and Distance is MAX_float for the rays that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of rays that hit any matching object.</returns>
+    int32 RayCastBatch(const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (the query setup is shared by all rays). Used to resolve many queries at once with a single call (eg. from scripts).
+    /// </summary>
+    /// <param name="queries">The rays to cast.</param>
+    /// <param name="results">The result hits (resized to the queries count). Collider is null and Distance is MAX_float for the rays that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of rays that hit any matching object.</returns>
+    API_FUNCTION() int32 RayCastBatch(const Span<RayCastQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Submits a batch of raycasts to be performed asynchronously. Queries are executed on job threads in parallel with the next physics simulation step (against the scene state from before the simulation) so gameplay doesn't need to wait for them. Use GetAsyncQueryResults to read the results (eg. next frame).
+    /// </summary>
+    /// <remarks>If the scene is not simulated (eg. game is paused) the queries are executed when reading the results. Results that are not read within a few simulation steps are released.</remarks>
+    /// <param name="queries">The rays to cast.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The query handle used to read the results. Never zero.</returns>
+    API_FUNCTION() uint64 RayCastBatchAsync(const Span<RayCastQuery>& queries, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Checks if the results of the asynchronous query are ready to read (query has been executed).
+    /// </summary>
+    /// <param name="handle">The query handle returned by RayCastBatchAsync.</param>
+    /// <returns>True if the results are ready, otherwise false (not executed yet or invalid handle).</returns>
+    API_FUNCTION() bool IsAsyncQueryReady(uint64 handle);
+
+    /// <summary>
+    /// Gets the results of the asynchronous query and releases it (handle becomes invalid). Executes the query (or waits for it) if the results are not ready yet.
+    /// </summary>
+    /// <param name="handle">The query handle returned by RayCastBatchAsync.</param>
+    /// <param name="results">The result hits (the same size as the submitted queries). Collider is null and Distance is MAX_float for the rays that didn't hit anything.</param>
+    /// <returns>The amount of rays that hit any matching object, or -1 if handle is invalid (eg. results have been already released).</returns>
+    API_FUNCTION() int32 GetAsyncQueryResults(uint64 handle, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a box geometry.
     /// </summary>
@@ -279,6 +354,28 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if sphere hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool SphereCastAll(const Vector3& center, float radius, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a batch of sweep tests against objects in the scene using a sphere geometry (the query setup is shared by all sweeps). Used to resolve many queries at once (eg. particles collisions). Large batches are split into jobs executed in parallel.
+    /// </summary>
+    /// <param name="radius">The radius of the sphere (the same for all queries).</param>
+    /// <param name="queries">The sweeps to perform (origin is the sphere center).</param>
+    /// <param name="results">The result hits (the same size as queries). Collider is null and Distance is MAX_float for the sweeps that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of sweeps that hit any matching object.</returns>
+    int32 SphereCastBatch(float radius, const Span<RayCastQuery>& queries, Span<RayCastHit> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs a batch of sweep tests against objects in the scene using a sphere geometry (the query setup is shared by all sweeps). Used to resolve many queries at once with a single call (eg. from scripts).
+    /// </summary>
+    /// <param name="radius">The radius of the sphere (the same for all queries).</param>
+    /// <param name="queries">The sweeps to perform (origin is the sphere center).</param>
+    /// <param name="results">The result hits (resized to the queries count). Collider is null and Distance is MAX_float for the sweeps that didn't hit anything.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of sweeps that hit any matching object.</returns>
+    API_FUNCTION() int32 SphereCastBatch(float radius, const Span<RayCastQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a capsule geometry.
     /// </summary>
@@ -388,6 +485,28 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if sphere overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() bool CheckSphere(const Vector3& center, float radius, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Checks whether the given spheres overlap any other colliders in the scene (the query setup is shared by all spheres). Used to resolve many queries at once (eg. AI visibility or spawn checks). Large batches are split into jobs executed in parallel.
+    /// </summary>
+    /// <param name="radius">The radius of the spheres (the same for all queries).</param>
+    /// <param name="centers">The spheres centers.</param>
+    /// <param name="results">The results (the same size as centers). Contains true for the spheres that overlap any matching object.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of spheres that overlap any matching object.</returns>
+    int32 CheckSphereBatch(float radius, const Span<Vector3>& centers, Span<bool> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Checks whether the given spheres overlap any other colliders in the scene (the query setup is shared by all spheres). Used to resolve many queries at once with a single call (eg. from scripts).
+    /// </summary>
+    /// <param name="radius">The radius of the spheres (the same for all queries).</param>
+    /// <param name="centers">The spheres centers.</param>
+    /// <param name="results">The results (resized to the centers count). Contains true for the spheres that overlap any matching object.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of spheres that overlap any matching object.</returns>
+    API_FUNCTION() int32 CheckSphereBatch(float radius, const Span<Vector3>& centers, API_PARAM(Out) Array<bool, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Checks whether the given capsule overlaps with other colliders or not.
     /// </summary>
@@ -130,6 +130,30 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1020), EditorDisplay(\"Framerate\")")
     int32 MaxSubsteps = 5;
 
+    /// <summary>
+    /// The distance from the nearest streaming source (see Streaming.Sources) beyond which the dynamic rigidbodies are forced to sleep (simulation is paused until the object gets closer). Use 0 to disable it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1050), Limit(0), EditorDisplay(\"Significance\"), ValueCategory(Utils.ValueCategory.Distance)")
+    float SleepDistance = 0.0f;
+
+    /// <summary>
+    /// The distance from the nearest streaming source (see Streaming.Sources) beyond which the dynamic rigidbodies use the reduced solver iterations count. Use 0 to disable it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1051), Limit(0), EditorDisplay(\"Significance\"), ValueCategory(Utils.ValueCategory.Distance)")
+    float ReducedSolverDistance = 0.0f;
+
+    /// <summary>
+    /// The maximum solver position iterations count used by the far rigidbodies (see ReducedSolverDistance).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1052), Limit(1, 255), EditorDisplay(\"Significance\")")
+    int32 ReducedSolverPositionIterations = 1;
+
+    /// <summary>
+    /// The maximum solver velocity iterations count used by the far rigidbodies (see ReducedSolverDistance).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1053), Limit(1, 255), EditorDisplay(\"Significance\")")
+    int32 ReducedSolverVelocityIterations = 1;
+
     /// <summary>
     /// Enables support for cooking physical collision shapes geometry at runtime. Use it to enable generating runtime terrain collision or convex mesh colliders.
     /// </summary>
@@ -32,6 +32,10 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API PhysicsStatistics
     API_FIELD() uint32 NewTouches;
     // Number of lost touches during this frame.
     API_FIELD() uint32 LostTouches;
+    // Time (in milliseconds) from the simulation start to the end of the last simulation step. Scenes are simulated concurrently so it's the scene simulation latency, not the CPU time spent.
+    API_FIELD() float SimulationTime;
+    // Time (in milliseconds) spent on the main thread to collect the simulation results (transformations update, cloth and events sending).
+    API_FIELD() float CollectTime;
 
     PhysicsStatistics()
     {
@@ -174,6 +174,29 @@ API_STRUCT(NoDefault) struct RayCastHit
     API_FIELD() Float2 UV;
 };
 
+/// <summary>
+/// Raycast query descriptor used by the batched scene queries (eg. Physics::RayCastBatch).
+/// </summary>
+API_STRUCT() struct RayCastQuery
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(RayCastQuery);
+
+    /// <summary>
+    /// The origin of the ray.
+    /// </summary>
+    API_FIELD() Vector3 Origin;
+
+    /// <summary>
+    /// The normalized direction of the ray.
+    /// </summary>
+    API_FIELD() Vector3 Direction;
+
+    /// <summary>
+    /// The maximum distance the ray should check for collisions.
+    /// </summary>
+    API_FIELD() float MaxDistance = MAX_float;
+};
+
 /// <summary>
 /// Physics collision shape variant for different shapes such as box, sphere, capsule.
 /// </summary>
@@ -602,6 +602,23 @@ uint32 AndroidAssetFile::GetPosition() const
     return AAsset_seek(_asset, 0, SEEK_CUR);
 }
 
+bool AndroidAssetFile::ReadAt(void* buffer, uint32 bytesToRead, uint32 offset, uint32* bytesRead)
+{
+    // Assets don't support positioned reads
+    return FileBase::ReadAt(buffer, bytesToRead, offset, bytesRead);
+}
+
+const byte* AndroidAssetFile::Map()
+{
+    // Assets are accessed via the asset manager
+    return FileBase::Map();
+}
+
+void AndroidAssetFile::Unmap(const byte* data, uint32 size)
+{
+    FileBase::Unmap(data, size);
+}
+
 void AndroidAssetFile::SetPosition(uint32 seek)
 {
     AAsset_seek(_asset, (off_t)seek, SEEK_SET);
@@ -421,6 +421,10 @@ namespace
             if (Engine::MainWindow)
                 Engine::MainWindow->OnLostFocus();
             break;
+        case APP_CMD_LOW_MEMORY:
+            LOG(Warning, "[Android] APP_CMD_LOW_MEMORY");
+            Platform::LowMemory();
+            break;
 #if !BUILD_RELEASE
         default:
             __android_log_print(ANDROID_LOG_INFO, "Flax", "App Cmd not handled: %d", cmd);
@@ -8,6 +8,21 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
+const byte* FileBase::Map()
+{
+    return nullptr;
+}
+
+void FileBase::Unmap(const byte* data, uint32 size)
+{
+}
+
+bool FileBase::ReadAt(void* buffer, uint32 bytesToRead, uint32 offset, uint32* bytesRead)
+{
+    SetPosition(offset);
+    return Read(buffer, bytesToRead, bytesRead);
+}
+
 bool FileBase::ReadAllBytes(const StringView& path, byte* data, int32 length)
 {
     PROFILE_CPU_NAMED("File::ReadAllBytes");
@@ -84,6 +84,16 @@ class FLAXENGINE_API FileBase : public NonCopyable
     /// <returns>True if cannot read data, otherwise false.</returns>
     virtual bool Read(void* buffer, uint32 bytesToRead, uint32* bytesRead = nullptr) = 0;
 
+    /// <summary>
+    /// Reads data from a file at the given location. Uses the native positioned read (if supported by the platform) which allows to read from the same file on many threads without seeking. The file pointer position is undefined after this call.
+    /// </summary>
+    /// <param name="buffer">Output buffer to read data to it.</param>
+    /// <param name="bytesToRead">The maximum amount bytes to read.</param>
+    /// <param name="offset">The location in the file (in bytes) to read data from.</param>
+    /// <param name="bytesRead">A pointer to the variable that receives the number of bytes read.</param>
+    /// <returns>True if cannot read data, otherwise false.</returns>
+    virtual bool ReadAt(void* buffer, uint32 bytesToRead, uint32 offset, uint32* bytesRead = nullptr);
+
     /// <summary>
     /// Writes data to a file.
     /// </summary>
@@ -98,6 +108,19 @@ class FLAXENGINE_API FileBase : public NonCopyable
     /// </summary>
     virtual void Close() = 0;
 
+    /// <summary>
+    /// Maps the whole file contents into the process virtual address space (read-only). The mapping stays valid after closing the file and has to be released with Unmap.
+    /// </summary>
+    /// <returns>The pointer to the mapped file contents or null if cannot map the file (or it's not supported by the platform).</returns>
+    virtual const byte* Map();
+
+    /// <summary>
+    /// Unmaps the file contents mapped with Map.
+    /// </summary>
+    /// <param name="data">The pointer to the mapped file contents.</param>
+    /// <param name="size">The size of the mapped file contents (in bytes).</param>
+    virtual void Unmap(const byte* data, uint32 size);
+
 public:
     /// <summary>
     /// Gets size of the file (in bytes).
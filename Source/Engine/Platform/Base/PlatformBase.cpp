@@ -17,6 +17,7 @@
 #include "Engine/Core/Utilities.h"
 #if COMPILE_WITH_PROFILER
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #endif
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/CommandLine.h"
@@ -49,6 +50,7 @@ float PlatformBase::CustomDpiScale = 1.0f;
 Array<User*, FixedAllocation<8>> PlatformBase::Users;
 Delegate<User*> PlatformBase::UserAdded;
 Delegate<User*> PlatformBase::UserRemoved;
+Delegate<> PlatformBase::LowMemory;
 
 const Char* ToString(NetworkConnectionType value)
 {
@@ -205,6 +207,9 @@ void PlatformBase::OnMemoryAlloc(void* ptr, uint64 size)
     tracy::Profiler::MemAllocCallstack(ptr, (size_t)size, 12, false);
 #endif
 
+    // Track memory allocation in the memory group
+    ProfilerMemory::OnAlloc(ptr, size);
+
     // Register allocation during the current CPU event
     auto thread = ProfilerCPU::GetCurrentThread();
     if (thread != nullptr && thread->Buffer.GetCount() != 0)
@@ -226,6 +231,9 @@ void PlatformBase::OnMemoryFree(void* ptr)
     // Track memory allocation in Tracy
     tracy::Profiler::MemFree(ptr, false);
 #endif
+
+    // Track memory release in the memory group
+    ProfilerMemory::OnFree(ptr);
 }
 
 #endif
@@ -243,6 +251,23 @@ void PlatformBase::FreePages(void* ptr)
     Platform::Free(ptr);
 }
 
+uint64 PlatformBase::GetLargePageSize()
+{
+    return 0;
+}
+
+void* PlatformBase::AllocateLargePages(uint64 size)
+{
+    // Fallback to the regular pages
+    const uint64 pageSize = Platform::GetCPUInfo().PageSize;
+    return Platform::AllocatePages((size + pageSize - 1) / pageSize, pageSize);
+}
+
+void PlatformBase::FreeLargePages(void* ptr, uint64 size)
+{
+    Platform::FreePages(ptr);
+}
+
 PlatformType PlatformBase::GetPlatformType()
 {
     return PLATFORM_TYPE;
@@ -178,6 +178,17 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
         memcpy(dst, src, static_cast<size_t>(size));
     }
 
+    /// <summary>
+    /// Move memory region (source and destination regions can overlap)
+    /// </summary>
+    /// <param name="dst">Destination memory address. Must not be null, even if size is zero.</param>
+    /// <param name="src">Source memory address. Must not be null, even if size is zero.</param>
+    /// <param name="size">Size of the memory to move in bytes</param>
+    FORCE_INLINE static void MemoryMove(void* dst, const void* src, uint64 size)
+    {
+        memmove(dst, src, static_cast<size_t>(size));
+    }
+
     /// <summary>
     /// Set memory region with given value
     /// </summary>
@@ -332,6 +343,26 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
     /// <param name="ptr">The pointer to the pages to deallocate.</param>
     static void FreePages(void* ptr);
 
+    /// <summary>
+    /// Gets the size of the single large memory page (eg. 2MB) or 0 if large pages are not supported on this platform (or the process has no rights to use them).
+    /// </summary>
+    /// <returns>The large page size (in bytes).</returns>
+    static uint64 GetLargePageSize();
+
+    /// <summary>
+    /// Allocates memory block backed by the large pages (eg. Windows large pages or Linux transparent huge pages). Fallbacks to the regular pages if large pages are not available.
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes). Should be a multiple of the large page size.</param>
+    /// <returns>The pointer to the allocated pages in memory.</returns>
+    static void* AllocateLargePages(uint64 size);
+
+    /// <summary>
+    /// Frees allocated large pages memory block.
+    /// </summary>
+    /// <param name="ptr">The pointer to the pages to deallocate.</param>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    static void FreeLargePages(void* ptr, uint64 size);
+
 public:
     /// <summary>
     /// Returns the current runtime platform type. It's compile-time constant.
@@ -636,6 +667,11 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
     /// </summary>
     API_EVENT() static Delegate<User*> UserRemoved;
 
+    /// <summary>
+    /// Event called when the system is running low on memory (on platforms that support memory pressure notifications). Called on the main thread. Can be used to release caches and unload unused resources.
+    /// </summary>
+    API_EVENT() static Delegate<> LowMemory;
+
 public:
     /// <summary>
     /// Returns a value indicating whether can open a given URL in a web browser.
@@ -26,6 +26,26 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(CPUInfo);
     /// </summary>
     API_FIELD() uint32 LogicalProcessorCount;
 
+    /// <summary>
+    /// The number of processor cores (physical) of the highest performance class (eg. P-cores on hybrid CPUs). Equal to ProcessorCoreCount on CPUs with a single cores type. Zero if unknown.
+    /// </summary>
+    API_FIELD() uint32 PerformanceCoreCount;
+
+    /// <summary>
+    /// The mask of logical processors (the first 64 ones) that belong to the highest performance class cores. Zero if unknown.
+    /// </summary>
+    API_FIELD() uint64 PerformanceProcessorMask;
+
+    /// <summary>
+    /// The mask of logical processors (the first 64 ones) that the current process is allowed to run on (eg. limited by cpuset or container). Zero if unknown.
+    /// </summary>
+    API_FIELD() uint64 ProcessAffinityMask;
+
+    /// <summary>
+    /// The number of NUMA (Non-Uniform Memory Access) nodes. Zero if unknown.
+    /// </summary>
+    API_FIELD() uint32 NumaNodeCount;
+
     /// <summary>
     /// The size of processor L1 caches (in bytes).
     /// </summary>
@@ -33,6 +33,7 @@
 #include "Engine/Input/Keyboard.h"
 #include "IncludeX11.h"
 #include <sys/resource.h>
+#include <sys/mman.h>
 #include <sys/sysinfo.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -1175,6 +1176,35 @@ int parse_size(const char* str, uintmax_t* res, int* power)
     return rc;
 }
 
+// Reads the CPUs list file (eg. "0-7,16-23") into the CPUs set. Returns true if failed.
+bool ReadCpuList(const char* path, cpu_set_t& result)
+{
+    CPU_ZERO(&result);
+    FILE* file = fopen(path, "r");
+    if (!file)
+        return true;
+    bool failed = true;
+    int first, last;
+    while (fscanf(file, "%d", &first) == 1)
+    {
+        last = first;
+        int c = fgetc(file);
+        if (c == '-')
+        {
+            if (fscanf(file, "%d", &last) != 1)
+                break;
+            c = fgetc(file);
+        }
+        for (int i = Math::Max(first, 0); i <= last && i < CPU_SETSIZE; i++)
+            CPU_SET(i, &result);
+        failed = false;
+        if (c != ',')
+            break;
+    }
+    fclose(file);
+    return failed;
+}
+
 class LinuxKeyboard : public Keyboard
 {
 public:
@@ -1761,6 +1791,67 @@ bool LinuxPlatform::Is64BitPlatform()
 #endif
 }
 
+uint64 LinuxPlatform::GetLargePageSize()
+{
+    static uint64 LargePageSize = MAX_uint64;
+    if (LargePageSize == MAX_uint64)
+    {
+        // Use transparent huge pages (if not disabled in the system)
+        LargePageSize = 0;
+        char buffer[128];
+        FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+        if (file)
+        {
+            if (fgets(buffer, sizeof(buffer), file) && !strstr(buffer, "[never]"))
+            {
+                LargePageSize = 2 * 1024 * 1024;
+                FILE* sizeFile = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+                if (sizeFile)
+                {
+                    unsigned long long value;
+                    if (fscanf(sizeFile, "%llu", &value) == 1 && value != 0)
+                        LargePageSize = (uint64)value;
+                    fclose(sizeFile);
+                }
+            }
+            fclose(file);
+        }
+    }
+    return LargePageSize;
+}
+
+void* LinuxPlatform::AllocateLargePages(uint64 size)
+{
+    const uint64 largePageSize = GetLargePageSize();
+    if (largePageSize == 0)
+    {
+        const uint64 pageSize = UnixCpu.PageSize;
+        return AllocatePages((size + pageSize - 1) / pageSize, pageSize);
+    }
+
+    // Align the mapping to the huge page boundary so kernel can back it with huge pages
+    const uint64 mappedSize = size + largePageSize;
+    byte* mapped = (byte*)mmap(nullptr, (size_t)mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED)
+        return nullptr;
+    byte* ptr = (byte*)Math::AlignUp<uintptr>((uintptr)mapped, (uintptr)largePageSize);
+    if (ptr != mapped)
+        munmap(mapped, ptr - mapped);
+    const uint64 tailSize = (mapped + mappedSize) - (ptr + size);
+    if (tailSize != 0)
+        munmap(ptr + size, (size_t)tailSize);
+    madvise(ptr, (size_t)size, MADV_HUGEPAGE);
+    return ptr;
+}
+
+void LinuxPlatform::FreeLargePages(void* ptr, uint64 size)
+{
+    if (GetLargePageSize() == 0)
+        FreePages(ptr);
+    else if (ptr)
+        munmap(ptr, (size_t)size);
+}
+
 CPUInfo LinuxPlatform::GetCPUInfo()
 {
     return UnixCpu;
@@ -1809,7 +1900,18 @@ void LinuxPlatform::SetThreadPriority(ThreadPriority priority)
 
 void LinuxPlatform::SetThreadAffinityMask(uint64 affinityMask)
 {
-    // TODO: impl this
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int32 i = 0; i < 64; i++)
+    {
+        if (affinityMask & (1ull << i))
+            CPU_SET(i, &cpus);
+    }
+    const int result = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (result != 0)
+    {
+        LOG(Warning, "Failed to set thread affinity mask 0x{0:x}. Error : {1}", affinityMask, result);
+    }
 }
 
 void LinuxPlatform::Sleep(int32 milliseconds)
@@ -1940,6 +2042,7 @@ bool LinuxPlatform::Init()
         {
             int32 Core;
             int32 Package;
+            int32 Capacity;
         } cpusInfo[CPU_SETSIZE];
         Platform::MemoryClear(cpusInfo, sizeof(cpusInfo));
         int32 maxCoreId = 0;
@@ -1972,6 +2075,16 @@ bool LinuxPlatform::Init()
                     fclose(packageIdFile);
                 }
 
+                sprintf(fileNameBuffer, "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpuIdx);
+                if (FILE* capacityFile = fopen(fileNameBuffer, "r"))
+                {
+                    if (fscanf(capacityFile, "%d", &cpusInfo[cpuIdx].Capacity) != 1)
+                    {
+                        cpusInfo[cpuIdx].Capacity = 0;
+                    }
+                    fclose(capacityFile);
+                }
+
                 maxCoreId = Math::Max(maxCoreId, cpusInfo[cpuIdx].Core);
                 maxPackageId = Math::Max(maxPackageId, cpusInfo[cpuIdx].Package);
             }
@@ -2006,17 +2119,82 @@ bool LinuxPlatform::Init()
             Allocator::Free(pairs);
         }
 
+        // Find the highest performance class cores (P-cores list on Intel hybrid CPUs, the highest capacity cores on ARM big.LITTLE)
+        cpu_set_t performanceCpus;
+        if (ReadCpuList("/sys/devices/cpu_core/cpus", performanceCpus))
+        {
+            int32 maxCapacity = 0;
+            for (int32 cpuIdx = 0; cpuIdx < CPU_SETSIZE; cpuIdx++)
+            {
+                if (CPU_ISSET(cpuIdx, &cpus))
+                    maxCapacity = Math::Max(maxCapacity, cpusInfo[cpuIdx].Capacity);
+            }
+            CPU_ZERO(&performanceCpus);
+            for (int32 cpuIdx = 0; cpuIdx < CPU_SETSIZE; cpuIdx++)
+            {
+                if (CPU_ISSET(cpuIdx, &cpus) && cpusInfo[cpuIdx].Capacity == maxCapacity)
+                    CPU_SET(cpuIdx, &performanceCpus);
+            }
+        }
+        uint64 affinityMask = 0;
+        for (int32 cpuIdx = 0; cpuIdx < 64; cpuIdx++)
+        {
+            if (CPU_ISSET(cpuIdx, &cpus))
+                affinityMask |= 1ull << cpuIdx;
+        }
+        uint64 performanceMask = 0;
+        int32 performanceCpusCount = 0;
+        for (int32 cpuIdx = 0; cpuIdx < CPU_SETSIZE; cpuIdx++)
+        {
+            if (CPU_ISSET(cpuIdx, &cpus) && CPU_ISSET(cpuIdx, &performanceCpus))
+            {
+                performanceCpusCount++;
+                if (cpuIdx < 64)
+                    performanceMask |= 1ull << cpuIdx;
+            }
+        }
+        int32 performanceCoresCount = numberOfCores;
+        if (performanceCpusCount != cpuCountAvailable && performanceCpusCount != 0)
+        {
+            // Count unique physical cores within performance processors
+            byte* pairs = (byte*)Allocator::Allocate(pairsCount);
+            Platform::MemoryClear(pairs, pairsCount * sizeof(unsigned char));
+            for (int32 cpuIdx = 0; cpuIdx < CPU_SETSIZE; cpuIdx++)
+            {
+                if (CPU_ISSET(cpuIdx, &cpus) && CPU_ISSET(cpuIdx, &performanceCpus))
+                {
+                    pairs[cpusInfo[cpuIdx].Package * coresCount + cpusInfo[cpuIdx].Core] = 1;
+                }
+            }
+            performanceCoresCount = 0;
+            for (int32 i = 0; i < pairsCount; i++)
+            {
+                performanceCoresCount += pairs[i];
+            }
+            Allocator::Free(pairs);
+        }
+
         UnixCpu.ProcessorPackageCount = packagesCount;
         UnixCpu.ProcessorCoreCount = Math::Max(numberOfCores, 1);
         UnixCpu.LogicalProcessorCount = CPU_COUNT(&cpus);
+        UnixCpu.PerformanceCoreCount = Math::Max(performanceCoresCount, 1);
+        UnixCpu.PerformanceProcessorMask = performanceMask;
+        UnixCpu.ProcessAffinityMask = affinityMask;
     }
     else
     {
         UnixCpu.ProcessorPackageCount = 1;
         UnixCpu.ProcessorCoreCount = 1;
         UnixCpu.LogicalProcessorCount = 1;
+        UnixCpu.PerformanceCoreCount = 1;
+        UnixCpu.PerformanceProcessorMask = 1;
+        UnixCpu.ProcessAffinityMask = 0;
     }
 
+    // Get NUMA nodes count
+    cpu_set_t numaNodes;
+    UnixCpu.NumaNodeCount = ReadCpuList("/sys/devices/system/node/online", numaNodes) ? 1 : Math::Max(CPU_COUNT(&numaNodes), 1);
+
     // Get cache sizes
     UnixCpu.L1CacheSize = 0;
     UnixCpu.L2CacheSize = 0;
@@ -93,6 +93,9 @@ class FLAXENGINE_API LinuxPlatform : public UnixPlatform
     {
         __builtin_prefetch(static_cast<char const*>(ptr));
     }
+    static uint64 GetLargePageSize();
+    static void* AllocateLargePages(uint64 size);
+    static void FreeLargePages(void* ptr, uint64 size);
     static bool Is64BitPlatform();
     static CPUInfo GetCPUInfo();
     static int32 GetCacheLineSize();
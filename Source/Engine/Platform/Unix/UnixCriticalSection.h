@@ -5,6 +5,7 @@
 #if PLATFORM_UNIX
 
 #include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include <pthread.h>
 
 class UnixConditionVariable;
@@ -22,6 +23,9 @@ class FLAXENGINE_API UnixCriticalSection
 #if BUILD_DEBUG
     pthread_t _owningThreadId;
 #endif
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+    ProfilerLocks::LockState* _profilerState = nullptr;
+#endif
 
     UnixCriticalSection(const UnixCriticalSection&);
     UnixCriticalSection& operator=(const UnixCriticalSection&);
@@ -49,16 +53,44 @@ class FLAXENGINE_API UnixCriticalSection
     /// </summary>
     ~UnixCriticalSection()
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        ProfilerLocks::Detach(_profilerState);
+#endif
         pthread_mutex_destroy(&_mutex);
     }
 
 public:
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+    /// <summary>
+    /// Enables the lock contention tracking with a given name (see PROFILE_LOCK). Has to be called before the lock gets used by other threads.
+    /// </summary>
+    void SetProfilerName(const char* name)
+    {
+        ProfilerLocks::Detach(_profilerState);
+        _profilerState = ProfilerLocks::Attach(name);
+    }
+#endif
+
 
     /// <summary>
     /// Locks the critical section.
     /// </summary>
     NO_SANITIZE_THREAD void Lock() const
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerState)
+        {
+            ProfilerLocks::BeforeLock(_profilerState);
+            uint64 waitStart = 0;
+            if (pthread_mutex_trylock(_mutexPtr) != 0)
+            {
+                waitStart = ProfilerLocks::BeginWait();
+                pthread_mutex_lock(_mutexPtr);
+            }
+            ProfilerLocks::AfterLock(_profilerState, waitStart);
+        }
+        else
+#endif
         pthread_mutex_lock(_mutexPtr);
 #if BUILD_DEBUG
         ((UnixCriticalSection*)this)->_owningThreadId = pthread_self();
@@ -71,6 +103,14 @@ class FLAXENGINE_API UnixCriticalSection
     /// <returns>True if calling thread took ownership of the critical section.</returns>
     NO_SANITIZE_THREAD bool TryLock() const
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerState)
+        {
+            const bool acquired = pthread_mutex_trylock(_mutexPtr) == 0;
+            ProfilerLocks::AfterTryLock(_profilerState, acquired);
+            return acquired;
+        }
+#endif
         return pthread_mutex_trylock(_mutexPtr) == 0;
     }
 
@@ -83,6 +123,10 @@ class FLAXENGINE_API UnixCriticalSection
         ((UnixCriticalSection*)this)->_owningThreadId = 0;
 #endif
         pthread_mutex_unlock(_mutexPtr);
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerState)
+            ProfilerLocks::AfterUnlock(_profilerState);
+#endif
     }
 };
 
@@ -15,6 +15,7 @@
 #endif
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <cerrno>
@@ -99,6 +100,21 @@ bool UnixFile::Read(void* buffer, uint32 bytesToRead, uint32* bytesRead)
     return true;
 }
 
+bool UnixFile::ReadAt(void* buffer, uint32 bytesToRead, uint32 offset, uint32* bytesRead)
+{
+    const ssize_t tmp = pread(_handle, buffer, bytesToRead, (off_t)offset);
+    if (tmp != -1)
+    {
+        if (bytesRead)
+            *bytesRead = tmp;
+        return false;
+    }
+    if (bytesRead)
+        *bytesRead = 0;
+    LOG_UNIX_LAST_ERROR;
+    return true;
+}
+
 bool UnixFile::Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten)
 {
     const ssize_t tmp = write(_handle, buffer, bytesToWrite);
@@ -123,6 +139,26 @@ void UnixFile::Close()
     }
 }
 
+const byte* UnixFile::Map()
+{
+    const uint32 size = GetSize();
+    if (size == 0)
+        return nullptr;
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, _handle, 0);
+    if (data == MAP_FAILED)
+    {
+        LOG_UNIX_LAST_ERROR;
+        return nullptr;
+    }
+    return (const byte*)data;
+}
+
+void UnixFile::Unmap(const byte* data, uint32 size)
+{
+    if (data)
+        munmap((void*)data, size);
+}
+
 uint32 UnixFile::GetSize() const
 {
     struct stat fileInfo;
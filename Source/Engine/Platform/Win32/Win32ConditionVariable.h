@@ -46,6 +46,15 @@ class FLAXENGINE_API Win32ConditionVariable
     /// <param name="lock">The critical section locked by the current thread.</param>
     void Wait(const Win32CriticalSection& lock)
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (lock._profilerState)
+        {
+            const uint64 waitStart = ProfilerLocks::BeforeConditionWait(lock._profilerState);
+            Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, 0xFFFFFFFF);
+            ProfilerLocks::AfterConditionWait(lock._profilerState, waitStart);
+            return;
+        }
+#endif
         Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, 0xFFFFFFFF);
     }
 
@@ -57,6 +66,15 @@ class FLAXENGINE_API Win32ConditionVariable
     /// <returns>If the function succeeds, the return value is true, otherwise, if the function fails or the time-out interval elapses, the return value is false.</returns>
     bool Wait(const Win32CriticalSection& lock, const int32 timeout)
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (lock._profilerState)
+        {
+            const uint64 waitStart = ProfilerLocks::BeforeConditionWait(lock._profilerState);
+            const bool result = !!Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, timeout);
+            ProfilerLocks::AfterConditionWait(lock._profilerState, waitStart);
+            return result;
+        }
+#endif
         return !!Windows::SleepConditionVariableCS(&_cond, &lock._criticalSection, timeout);
     }
 
@@ -5,6 +5,7 @@
 #if PLATFORM_WIN32
 
 #include "WindowsMinimal.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 
 class Win32ConditionVariable;
 
@@ -17,6 +18,9 @@ class FLAXENGINE_API Win32CriticalSection
 
 private:
     mutable Windows::CRITICAL_SECTION _criticalSection;
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+    ProfilerLocks::LockState* _profilerState = nullptr;
+#endif
 
 private:
     Win32CriticalSection(const Win32CriticalSection&);
@@ -36,15 +40,43 @@ class FLAXENGINE_API Win32CriticalSection
     /// </summary>
     ~Win32CriticalSection()
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        ProfilerLocks::Detach(_profilerState);
+#endif
         Windows::DeleteCriticalSection(&_criticalSection);
     }
 
 public:
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+    /// <summary>
+    /// Enables the lock contention tracking with a given name (see PROFILE_LOCK). Has to be called before the lock gets used by other threads.
+    /// </summary>
+    void SetProfilerName(const char* name)
+    {
+        ProfilerLocks::Detach(_profilerState);
+        _profilerState = ProfilerLocks::Attach(name);
+    }
+#endif
+
     /// <summary>
     /// Locks the critical section.
     /// </summary>
     void Lock() const
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerState)
+        {
+            ProfilerLocks::BeforeLock(_profilerState);
+            uint64 waitStart = 0;
+            if (Windows::TryEnterCriticalSection(&_criticalSection) == 0)
+            {
+                waitStart = ProfilerLocks::BeginWait();
+                Windows::EnterCriticalSection(&_criticalSection);
+            }
+            ProfilerLocks::AfterLock(_profilerState, waitStart);
+            return;
+        }
+#endif
         Windows::EnterCriticalSection(&_criticalSection);
     }
 
@@ -54,6 +86,14 @@ class FLAXENGINE_API Win32CriticalSection
     /// <returns>True if calling thread took ownership of the critical section.</returns>
     bool TryLock() const
     {
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerState)
+        {
+            const bool acquired = Windows::TryEnterCriticalSection(&_criticalSection) != 0;
+            ProfilerLocks::AfterTryLock(_profilerState, acquired);
+            return acquired;
+        }
+#endif
         return Windows::TryEnterCriticalSection(&_criticalSection) != 0;
     }
 
@@ -63,6 +103,10 @@ class FLAXENGINE_API Win32CriticalSection
     void Unlock() const
     {
         Windows::LeaveCriticalSection(&_criticalSection);
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerState)
+            ProfilerLocks::AfterUnlock(_profilerState);
+#endif
     }
 };
 
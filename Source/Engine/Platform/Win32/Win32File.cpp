@@ -50,6 +50,33 @@ bool Win32File::Read(void* buffer, uint32 bytesToRead, uint32* bytesRead)
     return true;
 }
 
+bool Win32File::ReadAt(void* buffer, uint32 bytesToRead, uint32 offset, uint32* bytesRead)
+{
+    // Read from the given location (file is opened for synchronous I/O so this call blocks)
+    OVERLAPPED overlapped;
+    Platform::MemoryClear(&overlapped, sizeof(overlapped));
+    overlapped.Offset = offset;
+    DWORD tmp;
+    if (ReadFile(_handle, buffer, bytesToRead, &tmp, &overlapped))
+    {
+        if (bytesRead)
+            *bytesRead = tmp;
+        return false;
+    }
+
+    // Reading at the end of the file is not an error
+    if (GetLastError() == ERROR_HANDLE_EOF)
+    {
+        if (bytesRead)
+            *bytesRead = 0;
+        return false;
+    }
+
+    if (bytesRead)
+        *bytesRead = 0;
+    return true;
+}
+
 bool Win32File::Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten)
 {
     // Try to write data
@@ -75,6 +102,32 @@ void Win32File::Close()
     }
 }
 
+const byte* Win32File::Map()
+{
+#if PLATFORM_UWP
+    return FileBase::Map();
+#else
+    HANDLE mapping = CreateFileMappingW(_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+        return nullptr;
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    // View keeps the reference to the mapping object
+    CloseHandle(mapping);
+    return (const byte*)data;
+#endif
+}
+
+void Win32File::Unmap(const byte* data, uint32 size)
+{
+#if PLATFORM_UWP
+    FileBase::Unmap(data, size);
+#else
+    if (data)
+        UnmapViewOfFile(data);
+#endif
+}
+
 uint32 Win32File::GetSize() const
 {
     LARGE_INTEGER result;
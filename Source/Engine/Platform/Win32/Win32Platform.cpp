@@ -83,6 +83,7 @@ bool Win32Platform::Init()
     DWORD processorL2CacheSize = 0;
     DWORD processorL3CacheSize = 0;
     DWORD processorPackageCount = 0;
+    DWORD processorNumaNodeCount = 0;
     DWORD byteOffset = 0;
     PCACHE_DESCRIPTOR cache;
     while (!done)
@@ -139,16 +140,67 @@ bool Win32Platform::Init()
         case RelationProcessorPackage:
             processorPackageCount++;
             break;
+        case RelationNumaNode:
+            processorNumaNodeCount++;
+            break;
         }
         byteOffset += sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
         ptr++;
     }
     free(buffer);
 
+    // Find the highest performance class cores (eg. P-cores on hybrid CPUs)
+    DWORD performanceCoreCount = processorCoreCount;
+    uint64 performanceProcessorMask = 0;
+#if PLATFORM_WINDOWS
+    returnLength = 0;
+    GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &returnLength);
+    if (auto bufferEx = returnLength ? static_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(malloc(returnLength)) : nullptr)
+    {
+        if (GetLogicalProcessorInformationEx(RelationProcessorCore, bufferEx, &returnLength))
+        {
+            BYTE maxEfficiencyClass = 0;
+            for (DWORD offset = 0; offset < returnLength;)
+            {
+                const auto info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)((byte*)bufferEx + offset);
+                maxEfficiencyClass = Math::Max(maxEfficiencyClass, info->Processor.EfficiencyClass);
+                offset += info->Size;
+            }
+            performanceCoreCount = 0;
+            for (DWORD offset = 0; offset < returnLength;)
+            {
+                const auto info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)((byte*)bufferEx + offset);
+                if (info->Processor.EfficiencyClass == maxEfficiencyClass)
+                {
+                    performanceCoreCount++;
+                    for (WORD group = 0; group < info->Processor.GroupCount; group++)
+                    {
+                        if (info->Processor.GroupMask[group].Group == 0)
+                            performanceProcessorMask |= (uint64)info->Processor.GroupMask[group].Mask;
+                    }
+                }
+                offset += info->Size;
+            }
+        }
+        free(bufferEx);
+    }
+#endif
+    if (performanceProcessorMask == 0)
+        performanceProcessorMask = logicalProcessorCount >= 64 ? MAX_uint64 : (1ull << logicalProcessorCount) - 1;
+
+    // Get processors that this process can use
+    DWORD_PTR processAffinityMask = 0, systemAffinityMask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &processAffinityMask, &systemAffinityMask))
+        processAffinityMask = 0;
+
     // Set info about the CPU
     CpuInfo.ProcessorPackageCount = processorPackageCount;
     CpuInfo.ProcessorCoreCount = processorCoreCount;
     CpuInfo.LogicalProcessorCount = logicalProcessorCount;
+    CpuInfo.PerformanceCoreCount = performanceCoreCount;
+    CpuInfo.PerformanceProcessorMask = performanceProcessorMask;
+    CpuInfo.ProcessAffinityMask = (uint64)processAffinityMask;
+    CpuInfo.NumaNodeCount = Math::Max<DWORD>(processorNumaNodeCount, 1);
     CpuInfo.L1CacheSize = processorL1CacheSize;
     CpuInfo.L2CacheSize = processorL2CacheSize;
     CpuInfo.L3CacheSize = processorL3CacheSize;
@@ -288,6 +340,55 @@ void Win32Platform::FreePages(void* ptr)
     VirtualFree(ptr, 0, MEM_RELEASE);
 }
 
+uint64 Win32Platform::GetLargePageSize()
+{
+#if PLATFORM_UWP
+    return 0;
+#else
+    static uint64 LargePageSize = MAX_uint64;
+    if (LargePageSize == MAX_uint64)
+    {
+        // Large pages require the 'Lock pages in memory' privilege to be granted and enabled
+        LargePageSize = 0;
+        HANDLE token;
+        if (OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+        {
+            TOKEN_PRIVILEGES privileges;
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+            if (LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+                GetLastError() == ERROR_SUCCESS)
+            {
+                LargePageSize = (uint64)GetLargePageMinimum();
+            }
+            CloseHandle(token);
+        }
+    }
+    return LargePageSize;
+#endif
+}
+
+void* Win32Platform::AllocateLargePages(uint64 size)
+{
+#if !PLATFORM_UWP
+    const uint64 largePageSize = GetLargePageSize();
+    if (largePageSize != 0 && size % largePageSize == 0)
+    {
+        void* ptr = VirtualAlloc(nullptr, (SIZE_T)size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (ptr)
+            return ptr;
+    }
+#endif
+    const uint64 pageSize = GetCPUInfo().PageSize;
+    return AllocatePages((size + pageSize - 1) / pageSize, pageSize);
+}
+
+void Win32Platform::FreeLargePages(void* ptr, uint64 size)
+{
+    VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
 bool Win32Platform::Is64BitPlatform()
 {
 #ifdef PLATFORM_64BITS
@@ -375,7 +476,10 @@ void Win32Platform::SetThreadPriority(ThreadPriority priority)
 
 void Win32Platform::SetThreadAffinityMask(uint64 affinityMask)
 {
-    ::SetThreadAffinityMask(::GetCurrentThread(), (DWORD_PTR)affinityMask);
+    if (::SetThreadAffinityMask(::GetCurrentThread(), (DWORD_PTR)affinityMask) == 0)
+    {
+        LOG(Warning, "Failed to set thread affinity mask 0x{0:x}. Error : {1}", affinityMask, GetLastErrorMessage());
+    }
 }
 
 void Win32Platform::Sleep(int32 milliseconds)
@@ -62,6 +62,8 @@ namespace
 {
     String UserLocale, ComputerName, WindowsName;
     HANDLE EngineMutex = nullptr;
+    HANDLE LowMemoryNotification = nullptr;
+    bool IsLowMemory = false;
     Rectangle VirtualScreenBounds(0.0f, 0.0f, 0.0f, 0.0f);
     int32 VersionMajor = 0;
     int32 VersionMinor = 0;
@@ -683,6 +685,9 @@ bool WindowsPlatform::Init()
 
     WindowsInput::Init();
 
+    // Get notified by the system when running low on physical memory
+    LowMemoryNotification = CreateMemoryResourceNotification(LowMemoryResourceNotification);
+
     return false;
 }
 
@@ -719,6 +724,18 @@ void WindowsPlatform::Tick()
         TranslateMessage(&msg);
         DispatchMessage(&msg);
     }
+
+    // Check the memory pressure state (notify once on entering low memory state)
+    BOOL isLowMemory;
+    if (LowMemoryNotification && QueryMemoryResourceNotification(LowMemoryNotification, &isLowMemory))
+    {
+        if (isLowMemory && !IsLowMemory)
+        {
+            LOG(Warning, "System is running low on memory");
+            LowMemory();
+        }
+        IsLowMemory = isLowMemory != FALSE;
+    }
 }
 
 void WindowsPlatform::BeforeExit()
@@ -740,6 +757,12 @@ void WindowsPlatform::Exit()
     DbgHelpUnlock();
 #endif
 
+    if (LowMemoryNotification)
+    {
+        CloseHandle(LowMemoryNotification);
+        LowMemoryNotification = nullptr;
+    }
+
     // Unregister app class
     UnregisterClassW(ApplicationWindowClass, nullptr);
 
@@ -27,6 +27,8 @@ public override void Setup(BuildOptions options)
         options.PrivateDependencies.Clear();
 
         options.PublicDefinitions.Add("COMPILE_WITH_PROFILER");
+        if (EngineConfiguration.UseLocksProfiler)
+            options.PublicDefinitions.Add("COMPILE_WITH_LOCKS_PROFILER");
 
         // Tracy profiling tools
         switch (options.Platform.Target)
@@ -4,6 +4,9 @@
 
 #include "ProfilerCPU.h"
 #include "ProfilerGPU.h"
+#include "ProfilerMemory.h"
+#include "ProfilerCounters.h"
+#include "ProfilerLocks.h"
 
 #if COMPILE_WITH_PROFILER
 
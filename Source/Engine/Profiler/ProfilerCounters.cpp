@@ -0,0 +1,115 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerCounters.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Platform/StringUtils.h"
+#include "Engine/Core/Math/Math.h"
+#include <ThirdParty/tracy/tracy/Tracy.hpp>
+
+namespace
+{
+    struct Counter
+    {
+        // Value bits (stored as integer for atomic operations)
+        int64 volatile Value;
+        double FrameValue;
+        ProfilerCounters::Modes Mode;
+        char Name[ProfilerCounters::MaxNameLength];
+    };
+
+    // Counters are never removed and array is not reallocated so name pointers can be used by Tracy plots
+    Counter Counters[ProfilerCounters::MaxCounters];
+    int32 volatile CountersCount = 0;
+    CriticalSection CountersLocker;
+
+    FORCE_INLINE int64 ToBits(double value)
+    {
+        int64 result;
+        Platform::MemoryCopy(&result, &value, sizeof(result));
+        return result;
+    }
+
+    FORCE_INLINE double FromBits(int64 value)
+    {
+        double result;
+        Platform::MemoryCopy(&result, &value, sizeof(result));
+        return result;
+    }
+}
+
+int32 ProfilerCounters::Register(const char* name, Modes mode)
+{
+    ScopeLock lock(CountersLocker);
+    const int32 count = CountersCount;
+    for (int32 i = 0; i < count; i++)
+    {
+        if (StringUtils::Compare(Counters[i].Name, name, MaxNameLength - 1) == 0)
+            return i;
+    }
+    if (count == MaxCounters)
+        return -1;
+    Counter& counter = Counters[count];
+    const int32 length = Math::Min(StringUtils::Length(name), MaxNameLength - 1);
+    Platform::MemoryCopy(counter.Name, name, length);
+    counter.Name[length] = 0;
+    counter.Mode = mode;
+    counter.Value = 0;
+    counter.FrameValue = 0.0;
+    Platform::AtomicStore(&CountersCount, count + 1);
+    return count;
+}
+
+void ProfilerCounters::Set(int32 id, double value)
+{
+    if (id >= 0)
+        Platform::AtomicStore(&Counters[id].Value, ToBits(value));
+}
+
+void ProfilerCounters::Add(int32 id, double value)
+{
+    if (id < 0)
+        return;
+    int64 volatile* dst = &Counters[id].Value;
+    int64 prev = Platform::AtomicRead(dst);
+    while (true)
+    {
+        const int64 actual = Platform::InterlockedCompareExchange(dst, ToBits(FromBits(prev) + value), prev);
+        if (actual == prev)
+            break;
+        prev = actual;
+    }
+}
+
+int32 ProfilerCounters::GetCount()
+{
+    return Platform::AtomicRead(&CountersCount);
+}
+
+const char* ProfilerCounters::GetName(int32 id)
+{
+    return Counters[id].Name;
+}
+
+double ProfilerCounters::GetFrameValue(int32 id)
+{
+    return Counters[id].FrameValue;
+}
+
+void ProfilerCounters::EndFrame()
+{
+    const int32 count = GetCount();
+    for (int32 i = 0; i < count; i++)
+    {
+        Counter& counter = Counters[i];
+        if (counter.Mode == Modes::Add)
+            counter.FrameValue = FromBits(Platform::InterlockedExchange(&counter.Value, 0));
+        else
+            counter.FrameValue = FromBits(Platform::AtomicRead(&counter.Value));
+        TracyPlot(counter.Name, counter.FrameValue);
+    }
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+#if COMPILE_WITH_PROFILER
+
+/// <summary>
+/// Provides named performance counters that subsystems can publish (see PROFILE_COUNTER macro). Values are aggregated per frame, exposed via ProfilingTools, forwarded to Tracy plots and recorded in the hitch capture.
+/// </summary>
+class FLAXENGINE_API ProfilerCounters
+{
+public:
+    /// <summary>
+    /// The counter value aggregation modes.
+    /// </summary>
+    enum class Modes : uint8
+    {
+        // The last value set during the frame is used.
+        Set,
+        // The values are summed during the frame and counter is reset to zero at the frame end.
+        Add,
+    };
+
+    /// <summary>
+    /// The maximum amount of the registered counters.
+    /// </summary>
+    static constexpr int32 MaxCounters = 256;
+
+    /// <summary>
+    /// The maximum length of the counter name (including null-terminator). Longer names get truncated.
+    /// </summary>
+    static constexpr int32 MaxNameLength = 64;
+
+public:
+    /// <summary>
+    /// Registers the counter or gets the existing one with the same name.
+    /// </summary>
+    /// <param name="name">The counter name.</param>
+    /// <param name="mode">The counter values aggregation mode.</param>
+    /// <returns>The counter identifier or -1 if the counters limit has been reached.</returns>
+    static int32 Register(const char* name, Modes mode = Modes::Set);
+
+    /// <summary>
+    /// Sets the counter value. Thread-safe.
+    /// </summary>
+    static void Set(int32 id, double value);
+
+    /// <summary>
+    /// Adds the value to the counter. Thread-safe.
+    /// </summary>
+    static void Add(int32 id, double value);
+
+    /// <summary>
+    /// Gets the amount of the registered counters.
+    /// </summary>
+    static int32 GetCount();
+
+    /// <summary>
+    /// Gets the counter name.
+    /// </summary>
+    static const char* GetName(int32 id);
+
+    /// <summary>
+    /// Gets the counter value aggregated for the last frame.
+    /// </summary>
+    static double GetFrameValue(int32 id);
+
+    /// <summary>
+    /// Aggregates the counters values for the ended frame (and sends them to Tracy plots). Called by the profiling tools service once per frame.
+    /// </summary>
+    static void EndFrame();
+};
+
+// Helper macros to publish the performance counter value (name has to be a string literal, counter is registered on first use)
+#define PROFILE_COUNTER(name, value) do { static const int32 __profileCounterId = ProfilerCounters::Register(name, ProfilerCounters::Modes::Set); ProfilerCounters::Set(__profileCounterId, (double)(value)); } while (false)
+#define PROFILE_COUNTER_ADD(name, value) do { static const int32 __profileCounterId = ProfilerCounters::Register(name, ProfilerCounters::Modes::Add); ProfilerCounters::Add(__profileCounterId, (double)(value)); } while (false)
+
+#else
+
+// Empty macros for disabled profiler
+#define PROFILE_COUNTER(name, value)
+#define PROFILE_COUNTER_ADD(name, value)
+
+#endif
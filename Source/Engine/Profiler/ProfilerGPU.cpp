@@ -16,6 +16,7 @@ Array<GPUTimerQuery*> ProfilerGPU::_timerQueriesPool;
 Array<GPUTimerQuery*> ProfilerGPU::_timerQueriesFree;
 bool ProfilerGPU::Enabled = false;
 bool ProfilerGPU::EventsEnabled = false;
+bool ProfilerGPU::PipelineStatsEnabled = false;
 int32 ProfilerGPU::CurrentBuffer = 0;
 ProfilerGPU::EventBuffer ProfilerGPU::Buffers[PROFILER_GPU_EVENTS_FRAMES];
 
@@ -49,6 +50,8 @@ void ProfilerGPU::EventBuffer::TryResolve()
     {
         auto& e = _data[i];
         e.Time = e.Timer->GetResult();
+        if (!e.Timer->GetPipelineStats(e.PipelineStats))
+            e.PipelineStats = GPUPipelineStats();
         _timerQueriesFree.Add(e.Timer);
         e.Timer = nullptr;
     }
@@ -107,6 +110,7 @@ int32 ProfilerGPU::BeginEvent(const Char* name)
     e.Name = name;
     e.Stats = RenderStatsData::Counter;
     e.Timer = GetTimerQuery();
+    e.Timer->CollectPipelineStats = PipelineStatsEnabled;
     e.Timer->Begin();
     e.Depth = _depth++;
 
@@ -54,6 +54,11 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
         /// The event depth. Value 0 is used for the root events.
         /// </summary>
         API_FIELD() int32 Depth;
+
+        /// <summary>
+        /// The GPU pipeline statistics for this event. Collected only if PipelineStatsEnabled is set and graphics backend supports it (zero otherwise).
+        /// </summary>
+        API_FIELD() GPUPipelineStats PipelineStats;
     };
 
     /// <summary>
@@ -139,6 +144,11 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
     /// </summary>
     API_FIELD() static bool EventsEnabled;
 
+    /// <summary>
+    /// True if collect the GPU pipeline statistics (shader invocations, primitives) for the profiler events. Adds overhead to the GPU queries so it's disabled by default. Supported on DirectX 11 and DirectX 12.
+    /// </summary>
+    API_FIELD() static bool PipelineStatsEnabled;
+
     /// <summary>
     /// The current frame buffer to collect events.
     /// </summary>
@@ -0,0 +1,181 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ProfilerLocks.h"
+
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/StringUtils.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Memory/Memory.h"
+#ifdef TRACY_ENABLE
+#include <ThirdParty/tracy/client/TracyLock.hpp>
+#endif
+
+namespace
+{
+    struct LockEntry
+    {
+        volatile int64 Acquisitions;
+        volatile int64 Contentions;
+        volatile int64 WaitCycles;
+        volatile int64 MaxWaitCycles;
+        volatile int64 ConditionWaits;
+        volatile int64 ConditionWaitCycles;
+        char Name[64];
+#ifdef TRACY_ENABLE
+        tracy::SourceLocationData SrcLoc;
+#endif
+    };
+
+    // Entries are never removed and array is not reallocated so pointers stay valid (critical sections can be created during static initialization so use only zero-initialized data and spin lock)
+    LockEntry Entries[ProfilerLocks::MaxLocks];
+    int32 volatile EntriesCount = 0;
+    int64 volatile EntriesLock = 0;
+}
+
+struct ProfilerLocks::LockState
+{
+    LockEntry* Entry;
+#ifdef TRACY_ENABLE
+    tracy::LockableCtx Ctx;
+
+    LockState(LockEntry* entry)
+        : Entry(entry)
+        , Ctx(&entry->SrcLoc)
+    {
+    }
+#else
+    LockState(LockEntry* entry)
+        : Entry(entry)
+    {
+    }
+#endif
+};
+
+ProfilerLocks::LockState* ProfilerLocks::Attach(const char* name)
+{
+    while (Platform::InterlockedCompareExchange(&EntriesLock, 1, 0) != 0)
+        Platform::Sleep(0);
+    LockEntry* entry = nullptr;
+    const int32 count = EntriesCount;
+    for (int32 i = 0; i < count; i++)
+    {
+        if (StringUtils::Compare(Entries[i].Name, name, ARRAY_COUNT(Entries[i].Name) - 1) == 0)
+        {
+            entry = &Entries[i];
+            break;
+        }
+    }
+    if (!entry && count != MaxLocks)
+    {
+        entry = &Entries[count];
+        const int32 length = Math::Min(StringUtils::Length(name), (int32)ARRAY_COUNT(entry->Name) - 1);
+        Platform::MemoryCopy(entry->Name, name, length);
+        entry->Name[length] = 0;
+#ifdef TRACY_ENABLE
+        entry->SrcLoc = { entry->Name, "Lock", __FILE__, (uint32_t)__LINE__, 0 };
+#endif
+        Platform::AtomicStore(&EntriesCount, count + 1);
+    }
+    Platform::AtomicStore(&EntriesLock, 0);
+    return entry ? New<LockState>(entry) : nullptr;
+}
+
+void ProfilerLocks::Detach(LockState* state)
+{
+    Delete(state);
+}
+
+int32 ProfilerLocks::GetCount()
+{
+    return Platform::AtomicRead(&EntriesCount);
+}
+
+const char* ProfilerLocks::GetName(int32 index)
+{
+    return Entries[index].Name;
+}
+
+void ProfilerLocks::GetStats(int32 index, LockStats& result)
+{
+    LockEntry& entry = Entries[index];
+    result.Acquisitions = Platform::AtomicRead(&entry.Acquisitions);
+    result.Contentions = Platform::AtomicRead(&entry.Contentions);
+    result.WaitCycles = Platform::AtomicRead(&entry.WaitCycles);
+    result.MaxWaitCycles = Platform::InterlockedExchange(&entry.MaxWaitCycles, 0);
+    result.ConditionWaits = Platform::AtomicRead(&entry.ConditionWaits);
+    result.ConditionWaitCycles = Platform::AtomicRead(&entry.ConditionWaitCycles);
+}
+
+uint64 ProfilerLocks::BeginWait()
+{
+    return Platform::GetTimeCycles();
+}
+
+void ProfilerLocks::BeforeLock(LockState* state)
+{
+#ifdef TRACY_ENABLE
+    state->Ctx.BeforeLock();
+#endif
+}
+
+void ProfilerLocks::AfterLock(LockState* state, uint64 waitStart)
+{
+#ifdef TRACY_ENABLE
+    state->Ctx.AfterLock();
+#endif
+    LockEntry& entry = *state->Entry;
+    Platform::InterlockedIncrement(&entry.Acquisitions);
+    if (waitStart == 0)
+        return;
+    const int64 wait = (int64)(Platform::GetTimeCycles() - waitStart);
+    Platform::InterlockedIncrement(&entry.Contentions);
+    Platform::InterlockedAdd(&entry.WaitCycles, wait);
+    int64 max = Platform::AtomicRead(&entry.MaxWaitCycles);
+    while (wait > max)
+    {
+        const int64 actual = Platform::InterlockedCompareExchange(&entry.MaxWaitCycles, wait, max);
+        if (actual == max)
+            break;
+        max = actual;
+    }
+}
+
+void ProfilerLocks::AfterTryLock(LockState* state, bool acquired)
+{
+#ifdef TRACY_ENABLE
+    state->Ctx.AfterTryLock(acquired);
+#endif
+    if (acquired)
+        Platform::InterlockedIncrement(&state->Entry->Acquisitions);
+}
+
+void ProfilerLocks::AfterUnlock(LockState* state)
+{
+#ifdef TRACY_ENABLE
+    state->Ctx.AfterUnlock();
+#endif
+}
+
+uint64 ProfilerLocks::BeforeConditionWait(LockState* state)
+{
+#ifdef TRACY_ENABLE
+    // Condition wait releases the lock and reacquires it after waking up
+    state->Ctx.AfterUnlock();
+#endif
+    return Platform::GetTimeCycles();
+}
+
+void ProfilerLocks::AfterConditionWait(LockState* state, uint64 waitStart)
+{
+#ifdef TRACY_ENABLE
+    state->Ctx.BeforeLock();
+    state->Ctx.AfterLock();
+#endif
+    LockEntry& entry = *state->Entry;
+    Platform::InterlockedIncrement(&entry.ConditionWaits);
+    Platform::InterlockedAdd(&entry.ConditionWaitCycles, (int64)(Platform::GetTimeCycles() - waitStart));
+}
+
+#endif
@@ -0,0 +1,96 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+// Enables contention tracking for the named locks (see PROFILE_LOCK). Use -useLocksProfiler=1 build option to enable it.
+#ifndef COMPILE_WITH_LOCKS_PROFILER
+#define COMPILE_WITH_LOCKS_PROFILER 0
+#endif
+
+#if COMPILE_WITH_PROFILER && COMPILE_WITH_LOCKS_PROFILER
+
+/// <summary>
+/// Provides lock contention tracking for the critical sections that have a profiler name assigned (see PROFILE_LOCK macro). Stats are aggregated per lock name and every tracked lock is reported to Tracy as lockable.
+/// </summary>
+class FLAXENGINE_API ProfilerLocks
+{
+public:
+    /// <summary>
+    /// The maximum amount of the different lock names.
+    /// </summary>
+    static constexpr int32 MaxLocks = 256;
+
+    /// <summary>
+    /// The lock statistics (accumulated since start).
+    /// </summary>
+    struct LockStats
+    {
+        // The amount of lock acquisitions.
+        int64 Acquisitions;
+        // The amount of lock acquisitions that had to wait for the other thread to release it.
+        int64 Contentions;
+        // The time spent on waiting for the lock (in CPU cycles).
+        int64 WaitCycles;
+        // The highest time spent on a single lock wait since the last stats query (in CPU cycles).
+        int64 MaxWaitCycles;
+        // The amount of condition variable waits on this lock.
+        int64 ConditionWaits;
+        // The time spent on condition variable waits (in CPU cycles).
+        int64 ConditionWaitCycles;
+    };
+
+    /// <summary>
+    /// The tracked lock instance state.
+    /// </summary>
+    struct LockState;
+
+public:
+    /// <summary>
+    /// Starts tracking the lock with a given name.
+    /// </summary>
+    /// <param name="name">The lock name (string literal). Locks with the same name share statistics.</param>
+    /// <returns>The lock state or null if the lock names limit has been reached.</returns>
+    static LockState* Attach(const char* name);
+
+    /// <summary>
+    /// Ends the lock tracking.
+    /// </summary>
+    static void Detach(LockState* state);
+
+    /// <summary>
+    /// Gets the amount of the tracked lock names.
+    /// </summary>
+    static int32 GetCount();
+
+    /// <summary>
+    /// Gets the lock name.
+    /// </summary>
+    static const char* GetName(int32 index);
+
+    /// <summary>
+    /// Gets the lock statistics. Resets the maximum wait time.
+    /// </summary>
+    static void GetStats(int32 index, LockStats& result);
+
+public:
+    // Lock operations callbacks used by the platform critical section and condition variable implementations
+    static uint64 BeginWait();
+    static void BeforeLock(LockState* state);
+    static void AfterLock(LockState* state, uint64 waitStart);
+    static void AfterTryLock(LockState* state, bool acquired);
+    static void AfterUnlock(LockState* state);
+    static uint64 BeforeConditionWait(LockState* state);
+    static void AfterConditionWait(LockState* state, uint64 waitStart);
+};
+
+// Helper macro to enable contention tracking of the critical section with a given name (string literal)
+#define PROFILE_LOCK(lock, name) (lock).SetProfilerName(name)
+
+#else
+
+// Empty macro for disabled locks profiler
+#define PROFILE_LOCK(lock, name)
+
+#endif
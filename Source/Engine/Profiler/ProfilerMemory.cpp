@@ -0,0 +1,205 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerMemory.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Core/Math/Math.h"
+
+// The amount of separately locked allocation tables (reduces contention between threads)
+#define PROFILER_MEMORY_SHARDS 64
+
+namespace
+{
+    const Char* GroupNames[] =
+    {
+        TEXT("Default"),
+        TEXT("Engine"),
+        TEXT("Content"),
+        TEXT("Graphics"),
+        TEXT("Renderer"),
+        TEXT("Scripting"),
+        TEXT("Level"),
+        TEXT("Physics"),
+        TEXT("Animations"),
+        TEXT("Particles"),
+        TEXT("Audio"),
+        TEXT("Networking"),
+        TEXT("UI"),
+        TEXT("Navigation"),
+    };
+    static_assert(ARRAY_COUNT(GroupNames) == (int32)ProfilerMemory::Groups::MAX, "Invalid amount of memory group names.");
+
+    // Tracked allocation (null pointer for empty slot, DeletedSlot for removed one)
+    struct Allocation
+    {
+        void* Ptr;
+        uint64 Size;
+        ProfilerMemory::Groups Group;
+    };
+
+    void* const DeletedSlot = (void*)1;
+
+    // Open-addressing hash table of the tracked allocations (memory is allocated with tracking disabled)
+    struct AllocationsTable
+    {
+        CriticalSection Locker;
+        Allocation* Data = nullptr;
+        int32 Capacity = 0;
+        int32 Used = 0;
+        int32 Count = 0;
+    };
+
+    AllocationsTable Tables[PROFILER_MEMORY_SHARDS];
+    volatile int64 GroupSizes[(int32)ProfilerMemory::Groups::MAX] = {};
+    volatile int64 GroupPeaks[(int32)ProfilerMemory::Groups::MAX] = {};
+    volatile int64 GroupCounts[(int32)ProfilerMemory::Groups::MAX] = {};
+    THREADLOCAL ProfilerMemory::Groups ThreadGroup = ProfilerMemory::Groups::Default;
+    THREADLOCAL bool ThreadTracking = false;
+
+    FORCE_INLINE uint64 HashPointer(void* ptr)
+    {
+        return ((uint64)(uintptr)ptr >> 4) * 0x9E3779B97F4A7C15ull;
+    }
+
+    FORCE_INLINE int32 FindSlot(const AllocationsTable& table, void* ptr, uint64 hash)
+    {
+        const int32 mask = table.Capacity - 1;
+        int32 index = (int32)(hash >> 32) & mask;
+        while (true)
+        {
+            void* slot = table.Data[index].Ptr;
+            if (slot == ptr || slot == nullptr)
+                return index;
+            index = (index + 1) & mask;
+        }
+    }
+
+    void Rehash(AllocationsTable& table, int32 capacity)
+    {
+        Allocation* oldData = table.Data;
+        const int32 oldCapacity = table.Capacity;
+        table.Data = (Allocation*)Platform::Allocate(capacity * sizeof(Allocation), 16);
+        Platform::MemoryClear(table.Data, capacity * sizeof(Allocation));
+        table.Capacity = capacity;
+        table.Used = table.Count;
+        for (int32 i = 0; i < oldCapacity; i++)
+        {
+            const Allocation& e = oldData[i];
+            if (e.Ptr != nullptr && e.Ptr != DeletedSlot)
+                table.Data[FindSlot(table, e.Ptr, HashPointer(e.Ptr))] = e;
+        }
+        Platform::Free(oldData);
+    }
+
+    void UpdateGroup(ProfilerMemory::Groups group, int64 sizeDelta, int64 countDelta)
+    {
+        const int32 index = (int32)group;
+        const int64 size = Platform::InterlockedAdd(&GroupSizes[index], sizeDelta) + sizeDelta;
+        Platform::InterlockedAdd(&GroupCounts[index], countDelta);
+        int64 peak = Platform::AtomicRead(&GroupPeaks[index]);
+        while (size > peak)
+        {
+            const int64 prev = Platform::InterlockedCompareExchange(&GroupPeaks[index], size, peak);
+            if (prev == peak)
+                break;
+            peak = prev;
+        }
+    }
+}
+
+bool ProfilerMemory::Enabled = false;
+
+ProfilerMemory::GroupScope::GroupScope(Groups group)
+{
+    Previous = ThreadGroup;
+    ThreadGroup = group;
+}
+
+ProfilerMemory::GroupScope::~GroupScope()
+{
+    ThreadGroup = Previous;
+}
+
+ProfilerMemory::Groups ProfilerMemory::GetGroup()
+{
+    return ThreadGroup;
+}
+
+const Char* ProfilerMemory::GetGroupName(Groups group)
+{
+    return (int32)group < (int32)Groups::MAX ? GroupNames[(int32)group] : TEXT("");
+}
+
+ProfilerMemory::GroupStats ProfilerMemory::GetGroupStats(Groups group)
+{
+    const int32 index = (int32)group;
+    GroupStats stats;
+    stats.Size = Platform::AtomicRead(&GroupSizes[index]);
+    stats.Peak = Platform::AtomicRead(&GroupPeaks[index]);
+    stats.Count = Platform::AtomicRead(&GroupCounts[index]);
+    return stats;
+}
+
+void ProfilerMemory::ResetPeaks()
+{
+    for (int32 i = 0; i < (int32)Groups::MAX; i++)
+        Platform::AtomicStore(&GroupPeaks[i], Platform::AtomicRead(&GroupSizes[i]));
+}
+
+void ProfilerMemory::OnAlloc(void* ptr, uint64 size)
+{
+    if (!Enabled || ThreadTracking)
+        return;
+    ThreadTracking = true;
+    const Groups group = ThreadGroup;
+    const uint64 hash = HashPointer(ptr);
+    AllocationsTable& table = Tables[hash % PROFILER_MEMORY_SHARDS];
+    table.Locker.Lock();
+    if ((table.Used + 1) * 4 > table.Capacity * 3)
+        Rehash(table, Math::Max(table.Capacity * (table.Count * 2 > table.Capacity ? 2 : 1), 256));
+    Allocation& e = table.Data[FindSlot(table, ptr, hash)];
+    if (e.Ptr == ptr)
+    {
+        // Memory was released while tracking was disabled
+        UpdateGroup(e.Group, -(int64)e.Size, -1);
+    }
+    else
+    {
+        table.Used++;
+        table.Count++;
+    }
+    e.Ptr = ptr;
+    e.Size = size;
+    e.Group = group;
+    table.Locker.Unlock();
+    UpdateGroup(group, (int64)size, 1);
+    ThreadTracking = false;
+}
+
+void ProfilerMemory::OnFree(void* ptr)
+{
+    if (!Enabled || ThreadTracking)
+        return;
+    const uint64 hash = HashPointer(ptr);
+    AllocationsTable& table = Tables[hash % PROFILER_MEMORY_SHARDS];
+    table.Locker.Lock();
+    if (table.Count != 0)
+    {
+        Allocation& e = table.Data[FindSlot(table, ptr, hash)];
+        if (e.Ptr == ptr)
+        {
+            const Groups group = e.Group;
+            const uint64 size = e.Size;
+            e.Ptr = DeletedSlot;
+            table.Count--;
+            table.Locker.Unlock();
+            UpdateGroup(group, -(int64)size, -1);
+            return;
+        }
+    }
+    table.Locker.Unlock();
+}
+
+#endif
@@ -0,0 +1,122 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+#if COMPILE_WITH_PROFILER
+
+/// <summary>
+/// Provides native memory allocations tracking with per-subsystem groups. Each thread has its own active group that is changed via scopes (see PROFILE_MEM macro) and every allocation made via Platform::Allocate is accounted into it.
+/// </summary>
+class FLAXENGINE_API ProfilerMemory
+{
+public:
+    /// <summary>
+    /// The memory groups (tags) used to categorize allocations.
+    /// </summary>
+    enum class Groups : uint8
+    {
+        // Not categorized allocations.
+        Default,
+        // Engine core (collections, strings, services).
+        Engine,
+        // Content assets and loading.
+        Content,
+        // Graphics device and GPU resources.
+        Graphics,
+        // Rendering pipeline.
+        Renderer,
+        // Scripting and managed runtime.
+        Scripting,
+        // Scenes and actors.
+        Level,
+        // Physics simulation.
+        Physics,
+        // Animations and skinning.
+        Animations,
+        // Particles simulation.
+        Particles,
+        // Audio playback.
+        Audio,
+        // Networking and replication.
+        Networking,
+        // User interface.
+        UI,
+        // Navigation mesh and pathfinding.
+        Navigation,
+
+        MAX
+    };
+
+    /// <summary>
+    /// The memory group statistics.
+    /// </summary>
+    struct GroupStats
+    {
+        /// <summary>
+        /// The currently allocated memory (in bytes).
+        /// </summary>
+        int64 Size;
+
+        /// <summary>
+        /// The highest allocated memory (in bytes) since the tracking start.
+        /// </summary>
+        int64 Peak;
+
+        /// <summary>
+        /// The amount of the active allocations.
+        /// </summary>
+        int64 Count;
+    };
+
+    /// <summary>
+    /// Helper structure used to change the active memory group of the current thread within a scope.
+    /// </summary>
+    struct GroupScope
+    {
+        Groups Previous;
+
+        GroupScope(Groups group);
+        ~GroupScope();
+    };
+
+public:
+    /// <summary>
+    /// Checks if memory tracking is enabled. Can be enabled with '-mem' command line switch (allocations made before enabling tracking are not accounted).
+    /// </summary>
+    static bool Enabled;
+
+    /// <summary>
+    /// Gets the active memory group of the current thread.
+    /// </summary>
+    static Groups GetGroup();
+
+    /// <summary>
+    /// Gets the name of the memory group.
+    /// </summary>
+    static const Char* GetGroupName(Groups group);
+
+    /// <summary>
+    /// Gets the memory group statistics.
+    /// </summary>
+    static GroupStats GetGroupStats(Groups group);
+
+    /// <summary>
+    /// Resets the peak values of all groups to their current sizes.
+    /// </summary>
+    static void ResetPeaks();
+
+    static void OnAlloc(void* ptr, uint64 size);
+    static void OnFree(void* ptr);
+};
+
+// Helper macro to set the memory group for allocations within the current scope
+#define PROFILE_MEM(group) ProfilerMemory::GroupScope ProfileMemScope(ProfilerMemory::Groups::group)
+
+#else
+
+// Empty macros for disabled profiler
+#define PROFILE_MEM(group)
+
+#endif
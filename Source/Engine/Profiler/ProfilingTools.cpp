@@ -3,17 +3,325 @@
 #if COMPILE_WITH_PROFILER
 
 #include "ProfilingTools.h"
+#include "Engine/Core/Log.h"
 #include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Types/DateTime.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Engine/Globals.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Networking/NetworkInternal.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/ThreadPoolTask.h"
 
 ProfilingTools::MainStats ProfilingTools::Stats;
 Array<ProfilingTools::ThreadStats, InlinedAllocation<64>> ProfilingTools::EventsCPU;
 Array<ProfilerGPU::Event> ProfilingTools::EventsGPU;
 Array<ProfilingTools::NetworkEventStat> ProfilingTools::EventsNetwork;
+Array<ProfilingTools::MemoryGroupStats> ProfilingTools::MemoryGroups;
+Array<ProfilingTools::CounterStat> ProfilingTools::Counters;
+ProfilingTools::JobSystemStats ProfilingTools::Jobs;
+Array<ProfilingTools::LockStats> ProfilingTools::Locks;
+StreamingStats ProfilingTools::ContentStreaming;
+float ProfilingTools::HitchThresholdMs = 0.0f;
+float ProfilingTools::HitchHistorySeconds = 5.0f;
+
+namespace
+{
+    // Single frame of the profiler data recorded for the hitch capture
+    struct HitchFrame
+    {
+        double StartTime; // in milliseconds
+        double EndTime; // in milliseconds
+        ProfilingTools::MainStats Stats;
+        Array<ProfilingTools::ThreadStats> Threads;
+        Array<ProfilerGPU::Event> EventsGPU;
+        Array<double> Counters;
+    };
+
+    // Minimum time between the automatic hitch captures (in milliseconds) to prevent dumping every frame during a longer slowdown
+    constexpr double HitchCaptureCooldown = 10000.0;
+
+    Array<HitchFrame*> HitchFrames;
+    Array<HitchFrame*> HitchFramesPool;
+    double HitchLastFrameTime = 0.0;
+    double HitchLastCaptureTime = 0.0;
+    JobSystem::Stats JobsStatsPrev;
+
+    void UpdateJobsStats()
+    {
+        JobSystem::Stats stats;
+        JobSystem::GetStats(stats);
+        const double cyclesToMs = 1000.0 / (double)Platform::GetClockFrequency();
+        auto& dst = ProfilingTools::Jobs;
+        const auto& prev = JobsStatsPrev;
+        dst.Workers.Resize(stats.WorkersCount);
+        for (int32 i = 0; i < stats.WorkersCount; i++)
+        {
+            const auto& src = stats.Workers[i];
+            auto& worker = dst.Workers[i];
+            worker.BusyTimeMs = (float)((src.BusyCycles - prev.Workers[i].BusyCycles) * cyclesToMs);
+            worker.IdleTimeMs = (float)((src.IdleCycles - prev.Workers[i].IdleCycles) * cyclesToMs);
+            worker.JobsExecuted = (int32)(src.JobsExecuted - prev.Workers[i].JobsExecuted);
+            worker.JobsStolen = (int32)(src.JobsStolen - prev.Workers[i].JobsStolen);
+        }
+        dst.Dispatches = (int32)(stats.Dispatches - prev.Dispatches);
+        dst.JobsDispatched = (int32)(stats.JobsDispatched - prev.JobsDispatched);
+        dst.WaitTimeMs = (float)((stats.WaitCycles - prev.WaitCycles) * cyclesToMs);
+        const int64 latencyCount = stats.LatencyCount - prev.LatencyCount;
+        dst.AverageLatencyMs = latencyCount > 0 ? (float)((stats.LatencyCycles - prev.LatencyCycles) * cyclesToMs / (double)latencyCount) : 0.0f;
+        dst.MaxLatencyMs = (float)(stats.LatencyMaxCycles * cyclesToMs);
+        dst.LatencyHistogram.Resize(JobSystem::LatencyHistogramSize);
+        for (int32 i = 0; i < JobSystem::LatencyHistogramSize; i++)
+            dst.LatencyHistogram[i] = (int32)(stats.LatencyHistogram[i] - prev.LatencyHistogram[i]);
+        JobsStatsPrev = stats;
+    }
+
+#if COMPILE_WITH_LOCKS_PROFILER
+    Array<ProfilerLocks::LockStats> LocksStatsPrev;
+
+    void UpdateLocksStats()
+    {
+        const double cyclesToMs = 1000.0 / (double)Platform::GetClockFrequency();
+        auto& locks = ProfilingTools::Locks;
+        const int32 count = ProfilerLocks::GetCount();
+        for (int32 i = locks.Count(); i < count; i++)
+        {
+            locks.AddOne().Name = String(ProfilerLocks::GetName(i));
+            Platform::MemoryClear(&LocksStatsPrev.AddOne(), sizeof(ProfilerLocks::LockStats));
+        }
+        for (int32 i = 0; i < count; i++)
+        {
+            ProfilerLocks::LockStats stats;
+            ProfilerLocks::GetStats(i, stats);
+            const auto& prev = LocksStatsPrev[i];
+            auto& dst = locks[i];
+            dst.Acquisitions = (int32)(stats.Acquisitions - prev.Acquisitions);
+            dst.Contentions = (int32)(stats.Contentions - prev.Contentions);
+            dst.WaitTimeMs = (float)((stats.WaitCycles - prev.WaitCycles) * cyclesToMs);
+            dst.MaxWaitTimeMs = (float)(stats.MaxWaitCycles * cyclesToMs);
+            dst.ConditionWaits = (int32)(stats.ConditionWaits - prev.ConditionWaits);
+            dst.ConditionWaitTimeMs = (float)((stats.ConditionWaitCycles - prev.ConditionWaitCycles) * cyclesToMs);
+            LocksStatsPrev[i] = stats;
+        }
+    }
+#endif
+
+    void WriteCounter(JsonWriter& writer, const char* name, double time, float value)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name);
+        writer.JKEY("ph");
+        writer.String("C");
+        writer.JKEY("ts");
+        writer.Double(time * 1000.0);
+        writer.JKEY("pid");
+        writer.Int(0);
+        writer.JKEY("args");
+        writer.StartObject();
+        writer.JKEY("value");
+        writer.Float(value);
+        writer.EndObject();
+        writer.EndObject();
+    }
+
+    void WriteThreadName(JsonWriter& writer, int32 tid, const StringView& name)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String("thread_name");
+        writer.JKEY("ph");
+        writer.String("M");
+        writer.JKEY("pid");
+        writer.Int(0);
+        writer.JKEY("tid");
+        writer.Int(tid);
+        writer.JKEY("args");
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name.Get(), name.Length());
+        writer.EndObject();
+        writer.EndObject();
+    }
+
+    bool WriteHitchCapture(const StringView& path, const Array<HitchFrame*>& frames)
+    {
+        // Export to the Chrome Trace Event format (time in microseconds, GPU events are placed on a separate track at the frame start since timer queries don't provide the absolute time)
+        rapidjson_flax::StringBuffer buffer;
+        CompactJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        Array<String, InlinedAllocation<64>> threads;
+        Array<double, InlinedAllocation<32>> gpuCursor;
+        writer.StartObject();
+        writer.JKEY("displayTimeUnit");
+        writer.String("ms");
+        writer.JKEY("traceEvents");
+        writer.StartArray();
+        for (const HitchFrame* frame : frames)
+        {
+            // CPU
+            for (const auto& thread : frame->Threads)
+            {
+                int32 tid = threads.Find(thread.Name);
+                if (tid == -1)
+                {
+                    tid = threads.Count();
+                    threads.Add(thread.Name);
+                }
+                for (const auto& e : thread.Events)
+                {
+                    if (e.End < e.Start)
+                        continue;
+                    writer.StartObject();
+                    writer.JKEY("name");
+                    writer.String(e.Name);
+                    writer.JKEY("ph");
+                    writer.String("X");
+                    writer.JKEY("ts");
+                    writer.Double(e.Start * 1000.0);
+                    writer.JKEY("dur");
+                    writer.Double((e.End - e.Start) * 1000.0);
+                    writer.JKEY("pid");
+                    writer.Int(0);
+                    writer.JKEY("tid");
+                    writer.Int(tid + 1);
+                    writer.EndObject();
+                }
+            }
+
+            // GPU
+            gpuCursor.Clear();
+            for (const auto& e : frame->EventsGPU)
+            {
+                if (e.Depth < 0 || e.Name == nullptr)
+                    continue;
+                gpuCursor.Resize(e.Depth + 2);
+                if (e.Depth == 0 && gpuCursor[0] < frame->StartTime)
+                    gpuCursor[0] = frame->StartTime;
+                const double start = gpuCursor[e.Depth];
+                gpuCursor[e.Depth] = start + e.Time;
+                gpuCursor[e.Depth + 1] = start;
+                writer.StartObject();
+                writer.JKEY("name");
+                writer.String(e.Name);
+                writer.JKEY("ph");
+                writer.String("X");
+                writer.JKEY("ts");
+                writer.Double(start * 1000.0);
+                writer.JKEY("dur");
+                writer.Double(e.Time * 1000.0);
+                writer.JKEY("pid");
+                writer.Int(0);
+                writer.JKEY("tid");
+                writer.Int(0);
+                writer.EndObject();
+            }
+
+            // Counters
+            WriteCounter(writer, "Frame Time (ms)", frame->StartTime, (float)(frame->EndTime - frame->StartTime));
+            WriteCounter(writer, "Update (ms)", frame->StartTime, frame->Stats.UpdateTimeMs);
+            WriteCounter(writer, "Physics (ms)", frame->StartTime, frame->Stats.PhysicsTimeMs);
+            WriteCounter(writer, "Draw CPU (ms)", frame->StartTime, frame->Stats.DrawCPUTimeMs);
+            WriteCounter(writer, "Draw GPU (ms)", frame->StartTime, frame->Stats.DrawGPUTimeMs);
+            WriteCounter(writer, "Draw Calls", frame->StartTime, (float)frame->Stats.DrawStats.DrawCalls);
+            WriteCounter(writer, "CPU Memory (MB)", frame->StartTime, (float)(frame->Stats.ProcessMemory.UsedPhysicalMemory / (1024.0 * 1024.0)));
+            WriteCounter(writer, "GPU Memory (MB)", frame->StartTime, (float)(frame->Stats.MemoryGPU.Used / (1024.0 * 1024.0)));
+            for (int32 i = 0; i < frame->Counters.Count(); i++)
+                WriteCounter(writer, ProfilerCounters::GetName(i), frame->StartTime, (float)frame->Counters[i]);
+        }
+        WriteThreadName(writer, 0, TEXT("GPU"));
+        for (int32 i = 0; i < threads.Count(); i++)
+            WriteThreadName(writer, i + 1, threads[i]);
+        writer.EndArray();
+        writer.EndObject();
+
+        const String folder = StringUtils::GetDirectoryName(path);
+        if (folder.HasChars() && !FileSystem::DirectoryExists(folder) && FileSystem::CreateDirectory(folder))
+            return true;
+        return File::WriteAllBytes(path, (const byte*)buffer.GetString(), (int32)buffer.GetSize());
+    }
+
+    // Saves the hitch capture on a thread pool to not stall the game even more
+    class HitchCaptureTask : public ThreadPoolTask
+    {
+    public:
+        String Path;
+        Array<HitchFrame*> Frames;
+
+        ~HitchCaptureTask()
+        {
+            Frames.ClearDelete();
+        }
+
+    protected:
+        bool Run() override
+        {
+            if (WriteHitchCapture(Path, Frames))
+            {
+                LOG(Warning, "Failed to save hitch capture to '{0}'", Path);
+                return true;
+            }
+            LOG(Info, "Saved hitch capture to '{0}'", Path);
+            return false;
+        }
+    };
+
+    void RecordHitchFrame()
+    {
+        const double now = Platform::GetTimeSeconds() * 1000.0;
+        const double frameStart = HitchLastFrameTime > 0.0 ? HitchLastFrameTime : now;
+        const float frameTime = (float)(now - frameStart);
+        HitchLastFrameTime = now;
+
+        // Remove the events older than the history duration (reuse frames memory)
+        const double historyStart = now - Math::Max(ProfilingTools::HitchHistorySeconds, 0.0f) * 1000.0;
+        int32 expired = 0;
+        while (expired < HitchFrames.Count() && HitchFrames[expired]->EndTime < historyStart)
+            expired++;
+        for (int32 i = 0; i < expired; i++)
+        {
+            HitchFramesPool.Add(HitchFrames[0]);
+            HitchFrames.RemoveAtKeepOrder(0);
+        }
+
+        // Record the current frame
+        HitchFrame* frame = HitchFramesPool.HasItems() ? HitchFramesPool.Pop() : New<HitchFrame>();
+        frame->StartTime = frameStart;
+        frame->EndTime = now;
+        frame->Stats = ProfilingTools::Stats;
+        const auto& eventsCPU = ProfilingTools::EventsCPU;
+        frame->Threads.Resize(eventsCPU.Count());
+        for (int32 i = 0; i < eventsCPU.Count(); i++)
+        {
+            frame->Threads[i].Name = eventsCPU[i].Name;
+            frame->Threads[i].Events = eventsCPU[i].Events;
+        }
+        frame->EventsGPU = ProfilingTools::EventsGPU;
+        frame->Counters.Resize(ProfilingTools::Counters.Count(), false);
+        for (int32 i = 0; i < frame->Counters.Count(); i++)
+            frame->Counters[i] = ProfilingTools::Counters[i].Value;
+        HitchFrames.Add(frame);
+
+        // Save the history when frame took too long
+        if (frameTime >= ProfilingTools::HitchThresholdMs && now - HitchLastCaptureTime >= HitchCaptureCooldown && HitchFrames.Count() > 1)
+        {
+            HitchLastCaptureTime = now;
+            String folder = StringUtils::GetDirectoryName(Log::Logger::LogFilePath);
+            if (folder.IsEmpty())
+                folder = Globals::ProductLocalFolder / TEXT("Logs");
+            auto task = New<HitchCaptureTask>();
+            task->Path = folder / String::Format(TEXT("Hitch_{0}.json"), DateTime::Now().ToFileNameString());
+            task->Frames = MoveTemp(HitchFrames);
+            LOG(Warning, "Frame hitch detected ({0} ms). Saving profiler capture to '{1}'", Math::RoundToInt(frameTime), task->Path);
+            task->Start();
+        }
+    }
+}
 
 class ProfilingToolsService : public EngineService
 {
@@ -138,6 +446,11 @@ void ProfilingToolsService::Update()
             dst.DataSize = src.DataSize;
             dst.MessageSize = src.MessageSize;
             dst.Receivers = src.Receivers;
+            dst.Delta = src.Delta;
+            dst.Skipped = src.Skipped;
+            dst.Deferred = src.Deferred;
+            dst.ReceivedCount = src.ReceivedCount;
+            dst.ReceivedDataSize = src.ReceivedDataSize;
             const StringAnsiView& typeName = e.Key.First.GetType().Fullname;
             uint64 len = Math::Min<uint64>(typeName.Length(), ARRAY_COUNT(dst.Name) - 10);
             Platform::MemoryCopy(dst.Name, typeName.Get(), len);
@@ -159,6 +472,62 @@ void ProfilingToolsService::Update()
         NetworkInternal::ProfilerEvents.Clear();
     }
 
+    // Get the native memory groups stats
+    if (ProfilerMemory::Enabled)
+    {
+        auto& memoryGroups = ProfilingTools::MemoryGroups;
+        memoryGroups.Resize((int32)ProfilerMemory::Groups::MAX);
+        for (int32 i = 0; i < memoryGroups.Count(); i++)
+        {
+            const auto group = (ProfilerMemory::Groups)i;
+            const ProfilerMemory::GroupStats src = ProfilerMemory::GetGroupStats(group);
+            auto& dst = memoryGroups[i];
+            if (dst.Name.IsEmpty())
+                dst.Name = ProfilerMemory::GetGroupName(group);
+            dst.Size = src.Size;
+            dst.Peak = src.Peak;
+            dst.Count = src.Count;
+        }
+    }
+
+    // Get the performance counters
+    {
+        ProfilerCounters::EndFrame();
+        auto& counters = ProfilingTools::Counters;
+        const int32 count = ProfilerCounters::GetCount();
+        for (int32 i = counters.Count(); i < count; i++)
+            counters.AddOne().Name = String(ProfilerCounters::GetName(i));
+        for (int32 i = 0; i < count; i++)
+            counters[i].Value = ProfilerCounters::GetFrameValue(i);
+    }
+
+    // Get the job system stats
+    if (ProfilerCPU::Enabled)
+    {
+        UpdateJobsStats();
+#if COMPILE_WITH_LOCKS_PROFILER
+        UpdateLocksStats();
+#endif
+    }
+
+    // Get the content streaming stats
+    if (ProfilingTools::GetEnabled())
+    {
+        ProfilingTools::ContentStreaming = Streaming::GetStats();
+    }
+
+    // Record the frames history for the hitch capture
+    if (ProfilingTools::HitchThresholdMs > 0.0f && ProfilerCPU::Enabled)
+    {
+        RecordHitchFrame();
+    }
+    else if (HitchFrames.HasItems() || HitchFramesPool.HasItems())
+    {
+        HitchFrames.ClearDelete();
+        HitchFramesPool.ClearDelete();
+        HitchLastFrameTime = 0.0;
+    }
+
 #if 0
     // Print CPU events to the log
     {
@@ -213,6 +582,19 @@ void ProfilingToolsService::Dispose()
     ProfilingTools::EventsCPU.SetCapacity(0);
     ProfilingTools::EventsGPU.SetCapacity(0);
     ProfilingTools::EventsNetwork.SetCapacity(0);
+    ProfilingTools::MemoryGroups.Clear();
+    ProfilingTools::MemoryGroups.SetCapacity(0);
+    ProfilingTools::Counters.Clear();
+    ProfilingTools::Counters.SetCapacity(0);
+    ProfilingTools::Jobs = ProfilingTools::JobSystemStats();
+    ProfilingTools::Locks.Clear();
+    ProfilingTools::Locks.SetCapacity(0);
+#if COMPILE_WITH_LOCKS_PROFILER
+    LocksStatsPrev.SetCapacity(0);
+#endif
+    ProfilingTools::ContentStreaming = StreamingStats();
+    HitchFrames.ClearDelete();
+    HitchFramesPool.ClearDelete();
 }
 
 bool ProfilingTools::GetEnabled()
@@ -228,4 +610,14 @@ void ProfilingTools::SetEnabled(bool enabled)
     NetworkInternal::EnableProfiling = enabled;
 }
 
+bool ProfilingTools::SaveHitchCapture(const StringView& path)
+{
+    if (HitchFrames.IsEmpty())
+    {
+        LOG(Warning, "Missing hitch capture data. Enable profiler and set HitchThresholdMs to record it.");
+        return true;
+    }
+    return WriteHitchCapture(path, HitchFrames);
+}
+
 #endif
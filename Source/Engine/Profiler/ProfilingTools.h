@@ -8,6 +8,7 @@
 #include "Engine/Platform/MemoryStats.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Streaming/Streaming.h"
 
 /// <summary>
 /// Profiler tools for development. Allows to gather profiling data and events from the engine.
@@ -113,16 +114,186 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
         DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkEventStat);
 
         // Amount of occurrences.
-        API_FIELD() uint16 Count;
+        API_FIELD() uint32 Count;
         // Transferred data size (in bytes).
-        API_FIELD() uint16 DataSize;
+        API_FIELD() uint32 DataSize;
         // Transferred message (data+header) size (in bytes).
-        API_FIELD() uint16 MessageSize;
+        API_FIELD() uint32 MessageSize;
         // Amount of peers that will receive this message.
-        API_FIELD() uint16 Receivers;
+        API_FIELD() uint32 Receivers;
+        // Amount of peers that received delta-compressed state.
+        API_FIELD() uint32 Delta;
+        // Amount of peers that were skipped because they already had the current state.
+        API_FIELD() uint32 Skipped;
+        // Amount of peers that were deferred due to exceeded bandwidth budget.
+        API_FIELD() uint32 Deferred;
+        // Amount of received messages.
+        API_FIELD() uint32 ReceivedCount;
+        // Received data size (in bytes).
+        API_FIELD() uint32 ReceivedDataSize;
         API_FIELD(Private, NoArray) byte Name[120];
     };
 
+    /// <summary>
+    /// The native memory group stats (see ProfilerMemory).
+    /// </summary>
+    API_STRUCT(NoDefault) struct MemoryGroupStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(MemoryGroupStats);
+
+        /// <summary>
+        /// The memory group name.
+        /// </summary>
+        API_FIELD() String Name;
+
+        /// <summary>
+        /// The currently allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() int64 Size;
+
+        /// <summary>
+        /// The highest allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() int64 Peak;
+
+        /// <summary>
+        /// The amount of the active allocations.
+        /// </summary>
+        API_FIELD() int64 Count;
+    };
+
+    /// <summary>
+    /// The performance counter stats (see ProfilerCounters).
+    /// </summary>
+    API_STRUCT(NoDefault) struct CounterStat
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(CounterStat);
+
+        /// <summary>
+        /// The counter name.
+        /// </summary>
+        API_FIELD() String Name;
+
+        /// <summary>
+        /// The counter value aggregated for the last frame.
+        /// </summary>
+        API_FIELD() double Value;
+    };
+
+    /// <summary>
+    /// The job system worker thread stats.
+    /// </summary>
+    API_STRUCT(NoDefault) struct JobWorkerStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(JobWorkerStats);
+
+        /// <summary>
+        /// The time spent on executing jobs during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float BusyTimeMs;
+
+        /// <summary>
+        /// The time spent on sleeping without any jobs queued during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float IdleTimeMs;
+
+        /// <summary>
+        /// The amount of jobs executed during the last frame.
+        /// </summary>
+        API_FIELD() int32 JobsExecuted;
+
+        /// <summary>
+        /// The amount of jobs executed during the last frame that were stolen from the other threads queues.
+        /// </summary>
+        API_FIELD() int32 JobsStolen;
+    };
+
+    /// <summary>
+    /// The job system stats.
+    /// </summary>
+    API_STRUCT(NoDefault) struct JobSystemStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(JobSystemStats);
+
+        /// <summary>
+        /// The worker threads stats.
+        /// </summary>
+        API_FIELD() Array<JobWorkerStats> Workers;
+
+        /// <summary>
+        /// The amount of Dispatch calls during the last frame.
+        /// </summary>
+        API_FIELD() int32 Dispatches;
+
+        /// <summary>
+        /// The amount of jobs dispatched during the last frame (sum of all dispatches fan-out).
+        /// </summary>
+        API_FIELD() int32 JobsDispatched;
+
+        /// <summary>
+        /// The time spent by the threads on waiting for the jobs completion during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float WaitTimeMs;
+
+        /// <summary>
+        /// The average job latency from dispatch to execution start during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float AverageLatencyMs;
+
+        /// <summary>
+        /// The highest job latency from dispatch to execution start during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float MaxLatencyMs;
+
+        /// <summary>
+        /// The histogram of the jobs latency during the last frame. Bucket i counts jobs started within [2^i, 2^(i+1)) microseconds since dispatch (first and last buckets are open).
+        /// </summary>
+        API_FIELD() Array<int32> LatencyHistogram;
+    };
+
+    /// <summary>
+    /// The lock contention stats (see ProfilerLocks).
+    /// </summary>
+    API_STRUCT(NoDefault) struct LockStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(LockStats);
+
+        /// <summary>
+        /// The lock name.
+        /// </summary>
+        API_FIELD() String Name;
+
+        /// <summary>
+        /// The amount of lock acquisitions during the last frame.
+        /// </summary>
+        API_FIELD() int32 Acquisitions;
+
+        /// <summary>
+        /// The amount of lock acquisitions during the last frame that had to wait for the other thread to release it.
+        /// </summary>
+        API_FIELD() int32 Contentions;
+
+        /// <summary>
+        /// The time spent on waiting for the lock during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float WaitTimeMs;
+
+        /// <summary>
+        /// The highest time spent on a single lock wait during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float MaxWaitTimeMs;
+
+        /// <summary>
+        /// The amount of condition variable waits on the lock during the last frame.
+        /// </summary>
+        API_FIELD() int32 ConditionWaits;
+
+        /// <summary>
+        /// The time spent on condition variable waits on the lock during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float ConditionWaitTimeMs;
+    };
+
 public:
     /// <summary>
     /// Controls the engine profiler (CPU, GPU, etc.) usage.
@@ -153,6 +324,49 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
     /// The networking profiler events.
     /// </summary>
     API_FIELD(ReadOnly) static Array<NetworkEventStat> EventsNetwork;
+
+    /// <summary>
+    /// The native memory groups stats. Empty if memory tracking is disabled (use '-mem' command line switch to enable it).
+    /// </summary>
+    API_FIELD(ReadOnly) static Array<MemoryGroupStats> MemoryGroups;
+
+    /// <summary>
+    /// The performance counters published by the engine and game systems (see PROFILE_COUNTER macro). Updated every frame.
+    /// </summary>
+    API_FIELD(ReadOnly) static Array<CounterStat> Counters;
+
+    /// <summary>
+    /// The job system stats. Updated every frame when CPU profiler is enabled.
+    /// </summary>
+    API_FIELD(ReadOnly) static JobSystemStats Jobs;
+
+    /// <summary>
+    /// The named locks contention stats. Empty if locks profiler is not compiled in (use -useLocksProfiler=1 build option to enable it). Updated every frame when CPU profiler is enabled.
+    /// </summary>
+    API_FIELD(ReadOnly) static Array<LockStats> Locks;
+
+    /// <summary>
+    /// The content streaming stats (total and per-group). Updated every frame when profiler is enabled.
+    /// </summary>
+    API_FIELD(ReadOnly) static StreamingStats ContentStreaming;
+
+public:
+    /// <summary>
+    /// The frame time threshold (in milliseconds) above which the hitch capture with the recent profiler events history gets saved to the file (into the logs folder). Use 0 to disable hitch recording. Works only when profiler is enabled.
+    /// </summary>
+    API_FIELD() static float HitchThresholdMs;
+
+    /// <summary>
+    /// The duration (in seconds) of the profiler events history kept in memory for the hitch capture.
+    /// </summary>
+    API_FIELD() static float HitchHistorySeconds;
+
+    /// <summary>
+    /// Saves the recorded profiler events history (CPU, GPU and main stats) to the file in the Chrome Trace Event format (can be opened with Perfetto UI or chrome://tracing). Hitch recording has to be enabled.
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool SaveHitchCapture(const StringView& path);
 };
 
 #endif
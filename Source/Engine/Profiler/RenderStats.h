@@ -71,6 +71,44 @@ API_STRUCT() struct RenderStatsData
     }
 };
 
+/// <summary>
+/// Object that stores the GPU pipeline statistics (measured by the GPU for the range of the commands).
+/// </summary>
+API_STRUCT() struct GPUPipelineStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(GPUPipelineStats);
+
+    /// <summary>
+    /// The amount of vertices read by the input assembler.
+    /// </summary>
+    API_FIELD() uint64 InputVertices = 0;
+
+    /// <summary>
+    /// The amount of primitives read by the input assembler.
+    /// </summary>
+    API_FIELD() uint64 InputPrimitives = 0;
+
+    /// <summary>
+    /// The amount of vertex shader invocations.
+    /// </summary>
+    API_FIELD() uint64 VertexShaderInvocations = 0;
+
+    /// <summary>
+    /// The amount of primitives that were sent to the rasterizer (after clipping).
+    /// </summary>
+    API_FIELD() uint64 RasterizedPrimitives = 0;
+
+    /// <summary>
+    /// The amount of pixel shader invocations.
+    /// </summary>
+    API_FIELD() uint64 PixelShaderInvocations = 0;
+
+    /// <summary>
+    /// The amount of compute shader invocations.
+    /// </summary>
+    API_FIELD() uint64 ComputeShaderInvocations = 0;
+};
+
 #define RENDER_STAT_DISPATCH_CALL() Platform::InterlockedIncrement(&RenderStatsData::Counter.DispatchCalls)
 #define RENDER_STAT_PS_STATE_CHANGE() Platform::InterlockedIncrement(&RenderStatsData::Counter.PipelineStateChanges)
 #define RENDER_STAT_DRAW_CALL(vertices, triangles) \
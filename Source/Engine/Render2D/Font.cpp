@@ -7,6 +7,12 @@
 #include "Engine/Threading/Threading.h"
 #include "IncludeFreeType.h"
 
+// The maximum amount of the text layouts cached per font
+#define FONT_LAYOUT_CACHE_SIZE 64
+
+// The maximum length of the text to cache its layout (longer texts are processed every time)
+#define FONT_LAYOUT_CACHE_MAX_TEXT 4096
+
 Array<AssetReference<FontAsset>, HeapAllocation> Font::FallbackFonts;
 
 Font::Font(FontAsset* parentAsset, float size)
@@ -117,13 +123,82 @@ void Font::Invalidate()
         FontManager::Invalidate(i->Value);
     }
     _characters.Clear();
+    _layoutCache.Clear();
 }
 
 void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
 {
-    int32 textLength = text.Length();
+    const int32 textLength = text.Length();
     if (textLength == 0)
         return;
+    if (textLength > FONT_LAYOUT_CACHE_MAX_TEXT)
+    {
+        LayoutText(text, outputLines, layout);
+        return;
+    }
+
+    // Layout doesn't depend on the bounds location so it can be reused for the moved text
+    uint32 hash = GetHash(text);
+    CombineHash(hash, GetHash(layout.Bounds.Size.X));
+    CombineHash(hash, GetHash(layout.Bounds.Size.Y));
+    CombineHash(hash, (uint32)layout.HorizontalAlignment | (uint32)layout.VerticalAlignment << 8 | (uint32)layout.TextWrapping << 16);
+    CombineHash(hash, GetHash(layout.Scale));
+    CombineHash(hash, GetHash(layout.BaseLinesGapScale));
+    const float fontScale = FontManager::FontScale;
+
+    // Try to use the cached layout
+    {
+        ScopeLock lock(_asset->Locker);
+        for (LayoutCacheEntry& e : _layoutCache)
+        {
+            if (e.Hash == hash &&
+                e.FontScale == fontScale &&
+                e.Layout.Bounds.Size == layout.Bounds.Size &&
+                e.Layout.HorizontalAlignment == layout.HorizontalAlignment &&
+                e.Layout.VerticalAlignment == layout.VerticalAlignment &&
+                e.Layout.TextWrapping == layout.TextWrapping &&
+                e.Layout.Scale == layout.Scale &&
+                e.Layout.BaseLinesGapScale == layout.BaseLinesGapScale &&
+                e.Text == text)
+            {
+                e.LastUsed = ++_layoutCacheCounter;
+                outputLines.Add(e.Lines);
+                return;
+            }
+        }
+    }
+
+    // Process text
+    const int32 linesStart = outputLines.Count();
+    LayoutText(text, outputLines, layout);
+
+    // Cache the result (replace the least recently used entry when cache is full)
+    ScopeLock lock(_asset->Locker);
+    LayoutCacheEntry* e;
+    if (_layoutCache.Count() < FONT_LAYOUT_CACHE_SIZE)
+    {
+        e = &_layoutCache.AddOne();
+    }
+    else
+    {
+        e = _layoutCache.Get();
+        for (LayoutCacheEntry& other : _layoutCache)
+        {
+            if (other.LastUsed < e->LastUsed)
+                e = &other;
+        }
+    }
+    e->Hash = hash;
+    e->LastUsed = ++_layoutCacheCounter;
+    e->FontScale = fontScale;
+    e->Layout = layout;
+    e->Text = text;
+    e->Lines.Set(outputLines.Get() + linesStart, outputLines.Count() - linesStart);
+}
+
+void Font::LayoutText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
+{
+    int32 textLength = text.Length();
     float cursorX = 0;
     int32 kerning;
     FontLineCache tmpLine;
@@ -206,6 +206,16 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API FontCharacterEntry
     /// </summary>
     API_FIELD() Float2 UVSize;
 
+    /// <summary>
+    /// The scale of the glyph bitmap (UV size) to the character size in pixels. Used by the signed distance field fonts that share the glyph bitmaps between all the font sizes.
+    /// </summary>
+    API_FIELD() float BitmapScale;
+
+    /// <summary>
+    /// True if the glyph bitmap contains the signed distance field (see <see cref="FontFlags.SDF"/>).
+    /// </summary>
+    API_FIELD() bool IsSDF;
+
     /// <summary>
     /// The slot in texture atlas, containing the pixel data of the glyph.
     /// </summary>
@@ -232,6 +242,16 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
     friend FontAsset;
 
 private:
+    struct LayoutCacheEntry
+    {
+        uint32 Hash;
+        uint32 LastUsed;
+        float FontScale;
+        TextLayoutOptions Layout;
+        String Text;
+        Array<FontLineCache> Lines;
+    };
+
     FontAsset* _asset;
     float _size;
     int32 _height;
@@ -241,6 +261,8 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
     bool _hasKerning;
     Dictionary<Char, FontCharacterEntry> _characters;
     mutable Dictionary<uint32, int32> _kerningTable;
+    Array<LayoutCacheEntry> _layoutCache;
+    uint32 _layoutCacheCounter = 0;
 
 public:
     /// <summary>
@@ -341,6 +363,7 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
     /// <summary>
     /// Processes text to get cached lines for rendering.
     /// </summary>
+    /// <remarks>The recently processed texts layouts are cached (per font) so measuring and drawing the same text again doesn't need to perform the layout.</remarks>
     /// <param name="text">The input text.</param>
     /// <param name="layout">The layout properties.</param>
     /// <param name="outputLines">The output lines list.</param>
@@ -530,6 +553,9 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
     /// </summary>
     void FlushFaceSize() const;
 
+private:
+    void LayoutText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout);
+
 public:
     // [Object]
     String ToString() const override;
@@ -58,6 +58,9 @@ void FontAsset::unload(bool isReloading)
         _fonts.Clear();
     }
 
+    // Release shared glyphs
+    InvalidateSDF();
+
     // Unload face
     if (_face)
     {
@@ -209,6 +212,7 @@ void FontAsset::Invalidate()
     ScopeLock lock(Locker);
     for (auto font : _fonts)
         font->Invalidate();
+    InvalidateSDF();
 }
 
 uint64 FontAsset::GetMemoryUsage() const
@@ -246,3 +250,10 @@ bool FontAsset::init(AssetInitData& initData)
 
     return false;
 }
+
+void FontAsset::InvalidateSDF()
+{
+    for (auto i = _sdfCharacters.Begin(); i.IsNotEnd(); ++i)
+        FontManager::Invalidate(i->Value);
+    _sdfCharacters.Clear();
+}
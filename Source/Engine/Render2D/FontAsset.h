@@ -4,8 +4,8 @@
 
 #include "Engine/Content/BinaryAsset.h"
 #include "Engine/Content/AssetReference.h"
+#include "Font.h"
 
-class Font;
 class FontManager;
 typedef struct FT_FaceRec_* FT_Face;
 
@@ -64,6 +64,11 @@ API_ENUM(Attributes="Flags") enum class FontFlags : byte
     /// Enables slant effect, emulating italic style.
     /// </summary>
     Italic = 4,
+
+    /// <summary>
+    /// Enables rendering characters using signed distance field. Glyphs are rasterized once at the fixed size and shared between all font sizes which reduces the atlases memory and the characters rasterization when changing UI scale or the text size. Hinting option is ignored.
+    /// </summary>
+    SDF = 8,
 };
 
 DECLARE_ENUM_OPERATORS(FontFlags);
@@ -93,6 +98,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API FontAsset : public BinaryAsset
 {
     DECLARE_BINARY_ASSET_HEADER(FontAsset, 3);
     friend Font;
+    friend FontManager;
 
 private:
     FT_Face _face;
@@ -101,6 +107,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API FontAsset : public BinaryAsset
     Array<Font*, InlinedAllocation<32>> _fonts;
     AssetReference<FontAsset> _virtualBold;
     AssetReference<FontAsset> _virtualItalic;
+    Dictionary<Char, FontCharacterEntry> _sdfCharacters;
 
 public:
     /// <summary>
@@ -200,4 +207,5 @@ API_CLASS(NoSpawn) class FLAXENGINE_API FontAsset : public BinaryAsset
 
 private:
     bool Init();
+    void InvalidateSDF();
 };
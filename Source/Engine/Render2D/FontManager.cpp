@@ -9,10 +9,12 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "IncludeFreeType.h"
 #include <ThirdParty/freetype/ftsynth.h>
 #include <ThirdParty/freetype/ftbitmap.h>
 #include <ThirdParty/freetype/internal/ftdrv.h>
+#include <ThirdParty/freetype/ftmodapi.h>
 
 namespace FontManagerImpl
 {
@@ -82,6 +84,11 @@ bool FontManagerService::Init()
     }
     FT_Add_Default_Modules(Library);
 
+    // Setup signed distance field renderers
+    FT_Int sdfSpread = FONT_SDF_SPREAD;
+    FT_Property_Set(Library, "sdf", "spread", &sdfSpread);
+    FT_Property_Set(Library, "bsdf", "spread", &sdfSpread);
+
     // Log version info
     FT_Int major, minor, patch;
     FT_Library_Version(Library, &major, &minor, &patch);
@@ -112,84 +119,8 @@ FontTextureAtlas* FontManager::GetAtlas(int32 index)
     return index >= 0 && index < Atlases.Count() ? Atlases.Get()[index].Get() : nullptr;
 }
 
-bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
+bool AddGlyphToAtlas(FT_Bitmap* bitmap, FT_Face face, Char c, FontCharacterEntry& entry)
 {
-    ScopeLock lock(Locker);
-
-    const FontAsset* asset = font->GetAsset();
-    const FontOptions& options = asset->GetOptions();
-    const FT_Face face = asset->GetFTFace();
-    ASSERT(face != nullptr);
-    font->FlushFaceSize();
-
-    // Set load flags
-    uint32 glyphFlags = FT_LOAD_NO_BITMAP;
-    const bool useAA = EnumHasAnyFlags(options.Flags, FontFlags::AntiAliasing);
-    if (useAA)
-    {
-        switch (options.Hinting)
-        {
-        case FontHinting::Auto:
-            glyphFlags |= FT_LOAD_FORCE_AUTOHINT;
-            break;
-        case FontHinting::AutoLight:
-            glyphFlags |= FT_LOAD_TARGET_LIGHT;
-            break;
-        case FontHinting::Monochrome:
-            glyphFlags |= FT_LOAD_TARGET_MONO;
-            break;
-        case FontHinting::None:
-            glyphFlags |= FT_LOAD_NO_AUTOHINT | FT_LOAD_NO_HINTING;
-            break;
-        case FontHinting::Default:
-        default:
-            glyphFlags |= FT_LOAD_TARGET_NORMAL;
-            break;
-        }
-    }
-    else
-    {
-        glyphFlags |= FT_LOAD_TARGET_MONO | FT_LOAD_FORCE_AUTOHINT;
-    }
-
-    // Get the index to the glyph in the font face
-    const FT_UInt glyphIndex = FT_Get_Char_Index(face, c);
-#if !BUILD_RELEASE
-    if (glyphIndex == 0 && c >= '!')
-    {
-        LOG(Warning, "Font `{}` doesn't contain character `\\u{:x}`, consider choosing another font.", String(face->family_name), c);
-    }
-#endif
-
-    // Init the character data
-    Platform::MemoryClear(&entry, sizeof(entry));
-    entry.Character = c;
-    entry.Font = font;
-    entry.IsValid = false;
-
-    // Load the glyph
-    const FT_Error error = FT_Load_Glyph(face, glyphIndex, glyphFlags);
-    if (error)
-    {
-        LOG_FT_ERROR(error);
-        return true;
-    }
-
-    // Handle special effects
-    if (EnumHasAnyFlags(options.Flags, FontFlags::Bold))
-    {
-        FT_GlyphSlot_Embolden(face->glyph);
-    }
-    if (EnumHasAnyFlags(options.Flags, FontFlags::Italic))
-    {
-        FT_GlyphSlot_Oblique(face->glyph);
-    }
-
-    // Render glyph to the bitmap
-    FT_GlyphSlot glyph = face->glyph;
-    FT_Render_Glyph(glyph, useAA ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO);
-
-    FT_Bitmap* bitmap = &glyph->bitmap;
     FT_Bitmap tmpBitmap;
     if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY)
     {
@@ -200,14 +131,6 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     }
     ASSERT(bitmap && bitmap->pixel_mode == FT_PIXEL_MODE_GRAY);
 
-    // Fill the character data
-    entry.AdvanceX = Convert26Dot6ToRoundedPixel<int16>(glyph->advance.x);
-    entry.OffsetY = glyph->bitmap_top;
-    entry.OffsetX = glyph->bitmap_left;
-    entry.IsValid = true;
-    entry.BearingY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
-    entry.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
-
     // Allocate memory
     const int32 glyphWidth = bitmap->width;
     const int32 glyphHeight = bitmap->rows;
@@ -289,9 +212,184 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     return false;
 }
 
+bool LoadGlyph(FT_Face face, FT_UInt glyphIndex, uint32 glyphFlags, const FontOptions& options)
+{
+    // Load the glyph
+    const FT_Error error = FT_Load_Glyph(face, glyphIndex, glyphFlags);
+    if (error)
+    {
+        LOG_FT_ERROR(error);
+        return true;
+    }
+
+    // Handle special effects
+    if (EnumHasAnyFlags(options.Flags, FontFlags::Bold))
+    {
+        FT_GlyphSlot_Embolden(face->glyph);
+    }
+    if (EnumHasAnyFlags(options.Flags, FontFlags::Italic))
+    {
+        FT_GlyphSlot_Oblique(face->glyph);
+    }
+
+    return false;
+}
+
+bool RenderGlyphSDF(FT_Face face, FT_UInt glyphIndex, uint32 glyphFlags, const FontOptions& options, Char c, FontCharacterEntry& entry)
+{
+    PROFILE_CPU();
+    Platform::MemoryClear(&entry, sizeof(entry));
+    entry.Character = c;
+    entry.BitmapScale = 1.0f;
+
+    // Rasterize the glyph at the fixed size
+    FT_Error error = FT_Set_Char_Size(face, 0, ConvertPixelTo26Dot6<FT_F26Dot6>(FONT_SDF_SIZE), DefaultDPI, DefaultDPI);
+    if (error)
+    {
+        LOG_FT_ERROR(error);
+        return true;
+    }
+    FT_Set_Transform(face, nullptr, nullptr);
+    if (LoadGlyph(face, glyphIndex, glyphFlags, options))
+        return true;
+    FT_GlyphSlot glyph = face->glyph;
+    if (glyph->format == FT_GLYPH_FORMAT_OUTLINE && glyph->outline.n_points == 0)
+    {
+        // Empty glyph (eg. whitespace)
+        entry.IsValid = true;
+        entry.TextureIndex = MAX_uint8;
+        return false;
+    }
+    error = FT_Render_Glyph(glyph, FT_RENDER_MODE_SDF);
+    if (error)
+    {
+        LOG_FT_ERROR(error);
+        return true;
+    }
+
+    // Bitmap already includes the distance field spread around the glyph
+    entry.OffsetX = glyph->bitmap_left;
+    entry.OffsetY = glyph->bitmap_top;
+    entry.IsValid = true;
+    return AddGlyphToAtlas(&glyph->bitmap, face, c, entry);
+}
+
+bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
+{
+    ScopeLock lock(Locker);
+
+    FontAsset* asset = font->GetAsset();
+    const FontOptions& options = asset->GetOptions();
+    const FT_Face face = asset->GetFTFace();
+    ASSERT(face != nullptr);
+    font->FlushFaceSize();
+
+    // Set load flags
+    uint32 glyphFlags = FT_LOAD_NO_BITMAP;
+    const bool useAA = EnumHasAnyFlags(options.Flags, FontFlags::AntiAliasing);
+    const bool useSDF = EnumHasAnyFlags(options.Flags, FontFlags::SDF);
+    if (useSDF)
+    {
+        // Glyph bitmap is shared between all font sizes so it cannot be hinted for a specific pixel grid
+        glyphFlags |= FT_LOAD_NO_AUTOHINT | FT_LOAD_NO_HINTING;
+    }
+    else if (useAA)
+    {
+        switch (options.Hinting)
+        {
+        case FontHinting::Auto:
+            glyphFlags |= FT_LOAD_FORCE_AUTOHINT;
+            break;
+        case FontHinting::AutoLight:
+            glyphFlags |= FT_LOAD_TARGET_LIGHT;
+            break;
+        case FontHinting::Monochrome:
+            glyphFlags |= FT_LOAD_TARGET_MONO;
+            break;
+        case FontHinting::None:
+            glyphFlags |= FT_LOAD_NO_AUTOHINT | FT_LOAD_NO_HINTING;
+            break;
+        case FontHinting::Default:
+        default:
+            glyphFlags |= FT_LOAD_TARGET_NORMAL;
+            break;
+        }
+    }
+    else
+    {
+        glyphFlags |= FT_LOAD_TARGET_MONO | FT_LOAD_FORCE_AUTOHINT;
+    }
+
+    // Get the index to the glyph in the font face
+    const FT_UInt glyphIndex = FT_Get_Char_Index(face, c);
+#if !BUILD_RELEASE
+    if (glyphIndex == 0 && c >= '!')
+    {
+        LOG(Warning, "Font `{}` doesn't contain character `\\u{:x}`, consider choosing another font.", String(face->family_name), c);
+    }
+#endif
+
+    // Init the character data
+    Platform::MemoryClear(&entry, sizeof(entry));
+    entry.Character = c;
+    entry.Font = font;
+    entry.IsValid = false;
+    entry.BitmapScale = 1.0f;
+
+    // Load the glyph
+    if (LoadGlyph(face, glyphIndex, glyphFlags, options))
+        return true;
+    FT_GlyphSlot glyph = face->glyph;
+
+    if (useSDF)
+    {
+        // Evaluate the character metrics for the font size
+        entry.AdvanceX = Convert26Dot6ToRoundedPixel<int16>(glyph->advance.x);
+        entry.BearingY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
+        entry.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
+
+        // Use the signed distance field bitmap shared between all font sizes (rasterized once at the fixed size)
+        const FontCharacterEntry* sdfEntry = asset->_sdfCharacters.TryGet(c);
+        if (!sdfEntry)
+        {
+            FontCharacterEntry glyphEntry;
+            const bool failed = RenderGlyphSDF(face, glyphIndex, glyphFlags, options, c, glyphEntry);
+            font->FlushFaceSize();
+            if (failed)
+                return true;
+            sdfEntry = &asset->_sdfCharacters.Add(c, glyphEntry)->Value;
+        }
+        const float bitmapScale = font->GetSize() * FontScale / FONT_SDF_SIZE;
+        entry.OffsetX = (int16)Math::RoundToInt(sdfEntry->OffsetX * bitmapScale);
+        entry.OffsetY = (int16)Math::RoundToInt(sdfEntry->OffsetY * bitmapScale);
+        entry.TextureIndex = sdfEntry->TextureIndex;
+        entry.UV = sdfEntry->UV;
+        entry.UVSize = sdfEntry->UVSize;
+        entry.Slot = sdfEntry->Slot;
+        entry.BitmapScale = bitmapScale;
+        entry.IsSDF = true;
+        entry.IsValid = true;
+        return false;
+    }
+
+    // Render glyph to the bitmap
+    FT_Render_Glyph(glyph, useAA ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO);
+
+    // Fill the character data
+    entry.AdvanceX = Convert26Dot6ToRoundedPixel<int16>(glyph->advance.x);
+    entry.OffsetY = glyph->bitmap_top;
+    entry.OffsetX = glyph->bitmap_left;
+    entry.IsValid = true;
+    entry.BearingY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
+    entry.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
+
+    return AddGlyphToAtlas(&glyph->bitmap, face, c, entry);
+}
+
 void FontManager::Invalidate(FontCharacterEntry& entry)
 {
-    if (entry.TextureIndex == MAX_uint8)
+    // Skip empty glyphs and the ones using the shared SDF bitmap (owned by the font asset)
+    if (entry.TextureIndex == MAX_uint8 || entry.IsSDF)
         return;
     auto atlas = Atlases[entry.TextureIndex];
     atlas->Invalidate(entry.Slot);
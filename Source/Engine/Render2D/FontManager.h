@@ -10,6 +10,12 @@ class FontTextureAtlas;
 struct FontCharacterEntry;
 typedef struct FT_LibraryRec_* FT_Library;
 
+// The size (in pixels) of the glyphs rasterized for the signed distance field fonts (shared between all the font sizes)
+#define FONT_SDF_SIZE 48
+
+// The distance field spread (in pixels) around the signed distance field font glyphs (must match GUI shader)
+#define FONT_SDF_SPREAD 6
+
 /// <summary>
 /// Fonts management and character atlases management utility service.
 /// </summary>
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "Render2D.h"
+#include "Render2DCommandList.h"
 #include "Font.h"
 #include "FontManager.h"
 #include "FontTextureAtlas.h"
@@ -46,6 +47,9 @@
 
 #define RENDER2D_BLUR_MAX_SAMPLES 64
 
+// The maximum amount of textures that can be used by a single merged batch of draw calls (must match GUI shader)
+#define RENDER2D_BATCH_MAX_TEXTURES 8
+
 // The format for the blur effect temporary buffer
 #define PS_Blur_Format PixelFormat::R8G8B8A8_UNorm
 
@@ -72,12 +76,14 @@ enum class DrawCallType : byte
     FillTexture,
     FillTexturePoint,
     DrawChar,
+    DrawCharSDF,
     DrawCharMaterial,
     Custom,
     Material,
     Blur,
     ClipScissors,
     LineAA,
+    Batch,
 
     MAX
 };
@@ -137,9 +143,21 @@ struct Render2DDrawCall
             float Width;
             float Height;
         } AsClipScissors;
+
+        struct
+        {
+            int32 Index;
+        } AsBatch;
     };
 };
 
+// Textures set used by the merged draw calls batch (colored, textured and font geometry drawn with a single pipeline state)
+struct Render2DBatch
+{
+    int32 TexturesCount;
+    GPUTextureView* Textures[RENDER2D_BATCH_MAX_TEXTURES];
+};
+
 struct Render2DVertex
 {
     Float2 Position;
@@ -162,6 +180,7 @@ struct CachedPSO
     GPUPipelineState* PS_Color_NoAlpha;
 
     GPUPipelineState* PS_Font;
+    GPUPipelineState* PS_FontSDF;
 
     GPUPipelineState* PS_BlurH;
     GPUPipelineState* PS_BlurV;
@@ -169,6 +188,8 @@ struct CachedPSO
 
     GPUPipelineState* PS_LineAA;
 
+    GPUPipelineState* PS_Batch;
+
     bool Init(GPUShader* shader, bool useDepth);
     void Dispose();
 };
@@ -193,6 +214,7 @@ namespace
 
     // Drawing
     Array<Render2DDrawCall> DrawCalls;
+    Array<Render2DBatch> Batches;
     Array<FontLineCache> Lines;
     Array<Float2> Lines2;
     bool IsScissorsRectEmpty;
@@ -444,6 +466,11 @@ bool CanDrawCallCallbackMaterial(const Render2DDrawCall& d1, const Render2DDrawC
     return d1.AsMaterial.Mat == d2.AsMaterial.Mat;
 }
 
+bool CanDrawCallCallbackBatch(const Render2DDrawCall& d1, const Render2DDrawCall& d2)
+{
+    return d1.AsBatch.Index == d2.AsBatch.Index;
+}
+
 // @formatter:off
 CanDrawCallCallback CanDrawCallBatch[] =
 {
@@ -453,12 +480,14 @@ CanDrawCallCallback CanDrawCallBatch[] =
     CanDrawCallCallbackTexture, // FillTexture,
     CanDrawCallCallbackTexture, // FillTexturePoint,
     CanDrawCallCallbackChar, // DrawChar,
+    CanDrawCallCallbackChar, // DrawCharSDF,
     CanDrawCallCallbackCharMaterial, // DrawCharMaterial,
     CanDrawCallCallbackFalse, // Custom,
     CanDrawCallCallbackMaterial, // Material,
     CanDrawCallCallbackFalse, // Blur,
     CanDrawCallCallbackFalse, // ClipScissors,
     CanDrawCallCallbackTrue, // LineAA,
+    CanDrawCallCallbackBatch, // Batch,
 };
 static_assert(ARRAY_COUNT(CanDrawCallBatch) == (int32)DrawCallType::MAX, "Invalid draw calls batching descriptor.");
 // @formatter:on
@@ -470,6 +499,99 @@ bool CanBatchDrawCalls(const Render2DDrawCall& d1, const Render2DDrawCall& d2)
 
 void DrawBatch(int32 startIndex, int32 count);
 
+void MergeDrawCalls()
+{
+    PROFILE_CPU();
+
+    // Convert the consecutive draw calls of the basic types into batches that use a shared pipeline state and a set of textures
+    // Geometry type and the texture slot are encoded in the vertex custom data (see PS_Batch in GUI shader)
+    auto vertices = (Render2DVertex*)VB.Data.Get();
+    const auto indices = (const uint32*)IB.Data.Get();
+    Render2DBatch* batch = nullptr;
+    for (int32 i = 0; i < DrawCalls.Count(); i++)
+    {
+        Render2DDrawCall& d = DrawCalls[i];
+        GPUTextureView* texture = nullptr;
+        int32 mode;
+        switch (d.Type)
+        {
+        case DrawCallType::FillRect:
+        case DrawCallType::FillRectNoAlpha:
+            mode = 0;
+            break;
+        case DrawCallType::FillRT:
+            mode = 1;
+            texture = d.AsRT.Ptr;
+            break;
+        case DrawCallType::FillTexture:
+            mode = 1;
+            texture = d.AsTexture.Ptr ? d.AsTexture.Ptr->View() : nullptr;
+            break;
+        case DrawCallType::DrawChar:
+            mode = 2;
+            texture = d.AsChar.Tex ? d.AsChar.Tex->View() : nullptr;
+            break;
+        case DrawCallType::DrawCharSDF:
+            mode = 3;
+            texture = d.AsChar.Tex ? d.AsChar.Tex->View() : nullptr;
+            break;
+        case DrawCallType::ClipScissors:
+            // Scissors change splits the draw but the textures set can be still shared
+            continue;
+        default:
+            batch = nullptr;
+            continue;
+        }
+
+        // Pick a texture slot within the current batch (or start a new one)
+        int32 slot = 0;
+        if (mode != 0)
+        {
+            slot = INVALID_INDEX;
+            if (batch)
+            {
+                for (int32 j = 0; j < batch->TexturesCount && slot == INVALID_INDEX; j++)
+                {
+                    if (batch->Textures[j] == texture)
+                        slot = j;
+                }
+                if (slot == INVALID_INDEX && batch->TexturesCount < RENDER2D_BATCH_MAX_TEXTURES)
+                {
+                    slot = batch->TexturesCount++;
+                    batch->Textures[slot] = texture;
+                }
+            }
+        }
+        if (!batch || slot == INVALID_INDEX)
+        {
+            batch = &Batches.AddOne();
+            batch->TexturesCount = 0;
+            slot = 0;
+            if (mode != 0)
+            {
+                batch->TexturesCount = 1;
+                batch->Textures[0] = texture;
+            }
+        }
+
+        // Patch the geometry
+        const float customData = (float)(mode * RENDER2D_BATCH_MAX_TEXTURES + slot);
+        const bool opaque = d.Type == DrawCallType::FillRectNoAlpha;
+        if (customData != 0.0f || opaque)
+        {
+            for (uint32 j = 0; j < d.CountIB; j++)
+            {
+                Render2DVertex& v = vertices[indices[d.StartIB + j]];
+                v.CustomData.X = customData;
+                if (opaque)
+                    v.Color.A = 1.0f; // Batch uses alpha blending
+            }
+        }
+        d.Type = DrawCallType::Batch;
+        d.AsBatch.Index = Batches.Count() - 1;
+    }
+}
+
 bool CachedPSO::Init(GPUShader* shader, bool useDepth)
 {
     if (Inited)
@@ -515,11 +637,21 @@ bool CachedPSO::Init(GPUShader* shader, bool useDepth)
     if (PS_Font->Init(desc))
         return true;
     //
+    desc.PS = shader->GetPS("PS_FontSDF");
+    PS_FontSDF = GPUDevice::Instance->CreatePipelineState();
+    if (PS_FontSDF->Init(desc))
+        return true;
+    //
     desc.PS = shader->GetPS("PS_LineAA");
     PS_LineAA = GPUDevice::Instance->CreatePipelineState();
     if (PS_LineAA->Init(desc))
         return true;
     //
+    desc.PS = shader->GetPS("PS_Batch");
+    PS_Batch = GPUDevice::Instance->CreatePipelineState();
+    if (PS_Batch->Init(desc))
+        return true;
+    //
     desc.VS = GPUPipelineState::Description::DefaultFullscreenTriangle.VS;
     desc.PS = shader->GetPS("PS_Blur");
     desc.BlendMode = BlendingMode::Opaque;
@@ -552,10 +684,12 @@ void CachedPSO::Dispose()
     SAFE_DELETE_GPU_RESOURCE(PS_Color);
     SAFE_DELETE_GPU_RESOURCE(PS_Color_NoAlpha);
     SAFE_DELETE_GPU_RESOURCE(PS_Font);
+    SAFE_DELETE_GPU_RESOURCE(PS_FontSDF);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurH);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurV);
     SAFE_DELETE_GPU_RESOURCE(PS_Downscale);
     SAFE_DELETE_GPU_RESOURCE(PS_LineAA);
+    SAFE_DELETE_GPU_RESOURCE(PS_Batch);
 
     Inited = false;
 }
@@ -614,6 +748,7 @@ void Render2DService::Dispose()
     TintLayersStack.Resize(0);
     ClipLayersStack.Resize(0);
     DrawCalls.Resize(0);
+    Batches.Resize(0);
     Lines.Resize(0);
     Lines2.Resize(0);
 
@@ -729,6 +864,9 @@ void Render2D::End()
         shader = GUIShader->GetShader();
     }
 
+    // Merge draw calls to reduce the amount of pipeline state and texture changes
+    MergeDrawCalls();
+
     // Flush geometry buffers
     VB.Flush(Context);
     IB.Flush(Context);
@@ -783,6 +921,7 @@ void Render2D::End()
 
     // End
     DrawCalls.Clear();
+    Batches.Clear();
     Context = nullptr;
     Output = nullptr;
 }
@@ -795,6 +934,119 @@ void Render2D::EndFrame()
     FontManager::Flush();
 }
 
+Render2DCommandList::Render2DCommandList(const SpawnParams& params)
+    : ScriptingObject(params)
+{
+}
+
+int32 Render2DCommandList::GetMemoryUsage() const
+{
+    return _drawCalls.Count() + _vertices.Count() + _indices.Count() * sizeof(uint32);
+}
+
+void Render2DCommandList::Clear()
+{
+    _isReady = false;
+    _drawCalls.Clear();
+    _vertices.Clear();
+    _indices.Clear();
+    _verticesCount = 0;
+}
+
+void Render2D::BeginRecording(Render2DCommandList* list)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(list && !list->_isRecording);
+
+    list->Clear();
+    list->_isRecording = true;
+    list->_recordDrawCalls = DrawCalls.Count();
+    list->_recordVertices = VBIndex;
+    list->_recordIndices = IBIndex;
+
+    // Cache the state that affects the generated geometry to validate it when replaying
+    const auto& mask = ClipLayersStack.Peek();
+    list->_transform = TransformCached;
+    list->_clipMask = mask.Mask;
+    list->_clipBounds = mask.Bounds;
+    list->_tint = TintLayersStack.Peek();
+    list->_features = (uint32)Features;
+    list->_scissors = IsScissorsRectEnabled;
+}
+
+void Render2D::EndRecording(Render2DCommandList* list)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(list && list->_isRecording);
+    list->_isRecording = false;
+
+    // Skip if rendering was restarted in-between
+    if (list->_recordDrawCalls > DrawCalls.Count() || list->_recordVertices > VBIndex || list->_recordIndices > IBIndex)
+        return;
+    PROFILE_CPU();
+
+    // Copy the draw calls with the geometry (indices are stored relative to the recording start)
+    const int32 drawCallsCount = DrawCalls.Count() - list->_recordDrawCalls;
+    list->_drawCalls.Set((const byte*)(DrawCalls.Get() + list->_recordDrawCalls), drawCallsCount * sizeof(Render2DDrawCall));
+    for (int32 i = 0; i < drawCallsCount; i++)
+    {
+        auto& drawCall = ((Render2DDrawCall*)list->_drawCalls.Get())[i];
+        if (drawCall.Type != DrawCallType::ClipScissors)
+            drawCall.StartIB -= list->_recordIndices;
+    }
+    list->_verticesCount = VBIndex - list->_recordVertices;
+    list->_vertices.Set(VB.Data.Get() + list->_recordVertices * sizeof(Render2DVertex), list->_verticesCount * sizeof(Render2DVertex));
+    const int32 indicesCount = IBIndex - list->_recordIndices;
+    list->_indices.Set((const uint32*)IB.Data.Get() + list->_recordIndices, indicesCount);
+    for (int32 i = 0; i < indicesCount; i++)
+        list->_indices[i] -= list->_recordVertices;
+    list->_isReady = true;
+}
+
+bool Render2D::Replay(Render2DCommandList* list)
+{
+#if USE_EDITOR
+    if (!IsRendering())
+    {
+        LOG(Error, "Calling Render2D is only valid during rendering.");
+        return true;
+    }
+#endif
+    if (!list || !list->_isReady || list->_isRecording)
+        return true;
+
+    // Geometry can be reused only if it was generated with the same state
+    const auto& mask = ClipLayersStack.Peek();
+    if (list->_transform != TransformCached ||
+        list->_clipBounds != mask.Bounds ||
+        Platform::MemoryCompare(&list->_clipMask, &mask.Mask, sizeof(RotatedRectangle)) != 0 ||
+        list->_tint != TintLayersStack.Peek() ||
+        list->_features != (uint32)Features ||
+        list->_scissors != IsScissorsRectEnabled)
+        return true;
+    PROFILE_CPU();
+
+    const int32 drawCallsStart = DrawCalls.Count();
+    const int32 drawCallsCount = list->_drawCalls.Count() / sizeof(Render2DDrawCall);
+    DrawCalls.Add((const Render2DDrawCall*)list->_drawCalls.Get(), drawCallsCount);
+    for (int32 i = drawCallsStart; i < DrawCalls.Count(); i++)
+    {
+        auto& drawCall = DrawCalls[i];
+        if (drawCall.Type != DrawCallType::ClipScissors)
+            drawCall.StartIB += IBIndex;
+    }
+    VB.Write(list->_vertices.Get(), list->_vertices.Count());
+    const int32 indicesCount = list->_indices.Count();
+    const int32 indicesStart = IB.Data.Count();
+    IB.Data.AddUninitialized(indicesCount * sizeof(uint32));
+    uint32* indices = (uint32*)(IB.Data.Get() + indicesStart);
+    for (int32 i = 0; i < indicesCount; i++)
+        indices[i] = list->_indices[i] + VBIndex;
+    VBIndex += list->_verticesCount;
+    IBIndex += indicesCount;
+    return false;
+}
+
 void Render2D::PushTransform(const Matrix3x3& transform)
 {
     RENDER2D_CHECK_RENDERING_STATE;
@@ -982,6 +1234,10 @@ void DrawBatch(int32 startIndex, int32 count)
         Context->BindSR(0, d.AsChar.Tex);
         Context->SetState(CurrentPso->PS_Font);
         break;
+    case DrawCallType::DrawCharSDF:
+        Context->BindSR(0, d.AsChar.Tex);
+        Context->SetState(CurrentPso->PS_FontSDF);
+        break;
     case DrawCallType::DrawCharMaterial:
     {
         // Apply and bind material
@@ -1131,6 +1387,14 @@ void DrawBatch(int32 startIndex, int32 count)
     case DrawCallType::LineAA:
         Context->SetState(CurrentPso->PS_LineAA);
         break;
+    case DrawCallType::Batch:
+    {
+        const Render2DBatch& batch = Batches[d.AsBatch.Index];
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, batch.Textures[i]);
+        Context->SetState(CurrentPso->PS_Batch);
+        break;
+    }
 #if !BUILD_RELEASE
     default:
         CRASH;
@@ -1228,12 +1492,14 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                 const float x = pointer.X + entry.OffsetX * scale;
                 const float y = pointer.Y + (font->GetHeight() + font->GetDescender() - entry.OffsetY) * scale;
 
-                Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                Rectangle charRect(x, y, entry.UVSize.X * entry.BitmapScale * scale, entry.UVSize.Y * entry.BitmapScale * scale);
 
                 Float2 upperLeftUV = entry.UV * invAtlasSize;
                 Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
 
                 // Add draw call
+                if (!customMaterial)
+                    drawCall.Type = entry.IsSDF ? DrawCallType::DrawCharSDF : DrawCallType::DrawChar;
                 drawCall.StartIB = IBIndex;
                 drawCall.CountIB = 6;
                 DrawCalls.Add(drawCall);
@@ -1350,13 +1616,15 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                     const float x = pointer.X + entry.OffsetX * scale;
                     const float y = pointer.Y - entry.OffsetY * scale + Math::Ceil((font->GetHeight() + font->GetDescender()) * scale);
 
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                    Rectangle charRect(x, y, entry.UVSize.X * entry.BitmapScale * scale, entry.UVSize.Y * entry.BitmapScale * scale);
                     charRect.Offset(layout.Bounds.Location);
 
                     Float2 upperLeftUV = entry.UV * invAtlasSize;
                     Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
 
                     // Add draw call
+                    if (!customMaterial)
+                        drawCall.Type = entry.IsSDF ? DrawCallType::DrawCharSDF : DrawCallType::DrawChar;
                     drawCall.StartIB = IBIndex;
                     drawCall.CountIB = 6;
                     DrawCalls.Add(drawCall);
@@ -22,6 +22,7 @@ class GPUContext;
 class RenderTask;
 class MaterialBase;
 class TextureBase;
+class Render2DCommandList;
 
 /// <summary>
 /// Rendering 2D shapes and text using Graphics Device.
@@ -124,6 +125,26 @@ API_CLASS(Static) class FLAXENGINE_API Render2D
     /// </summary>
     static void EndFrame();
 
+public:
+    /// <summary>
+    /// Begins recording of the drawing commands into the command list. All draw calls performed until the EndRecording are captured (and drawn as usual). Recordings can be nested.
+    /// </summary>
+    /// <param name="list">The command list to record into (its previous contents gets cleared).</param>
+    API_FUNCTION() static void BeginRecording(Render2DCommandList* list);
+
+    /// <summary>
+    /// Ends recording of the drawing commands into the command list.
+    /// </summary>
+    /// <param name="list">The command list that was being recorded.</param>
+    API_FUNCTION() static void EndRecording(Render2DCommandList* list);
+
+    /// <summary>
+    /// Draws the recorded command list. Replaying is valid only with the same transformation, clipping, tint and rendering features as at the recording time.
+    /// </summary>
+    /// <param name="list">The command list to draw.</param>
+    /// <returns>True if failed to replay the list (eg. not recorded or the current rendering state doesn't match the recorded one) so the contents should be drawn (and recorded) again, otherwise false.</returns>
+    API_FUNCTION() static bool Replay(Render2DCommandList* list);
+
 public:
     /// <summary>
     /// Pushes transformation layer.
@@ -0,0 +1,64 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Matrix3x3.h"
+#include "Engine/Scripting/ScriptingObject.h"
+#include "RotatedRectangle.h"
+
+/// <summary>
+/// Recorded list of Render2D drawing commands (draw calls with the generated geometry) that can be replayed later without drawing the content again. Used to cache rendering of the static UI.
+/// </summary>
+/// <remarks>
+/// The recorded commands reference the used textures, fonts atlases and materials directly so the list has to be cleared (or recorded again) when any of them gets modified or destroyed.
+/// </remarks>
+API_CLASS(Sealed) class FLAXENGINE_API Render2DCommandList : public ScriptingObject
+{
+    DECLARE_SCRIPTING_TYPE(Render2DCommandList);
+    friend class Render2D;
+
+private:
+    bool _isReady = false;
+    bool _isRecording = false;
+    bool _scissors = false;
+    uint32 _features = 0;
+    int32 _recordDrawCalls = 0;
+    uint32 _recordVertices = 0;
+    uint32 _recordIndices = 0;
+    uint32 _verticesCount = 0;
+    Matrix3x3 _transform;
+    RotatedRectangle _clipMask;
+    Rectangle _clipBounds;
+    Color _tint;
+    Array<byte> _drawCalls;
+    Array<byte> _vertices;
+    Array<uint32> _indices;
+
+public:
+    /// <summary>
+    /// Gets a value indicating whether the list contains the recorded commands that can be replayed.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsReady() const
+    {
+        return _isReady;
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the list is during recording.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsRecording() const
+    {
+        return _isRecording;
+    }
+
+    /// <summary>
+    /// Gets the size of the recorded data (in bytes).
+    /// </summary>
+    API_PROPERTY() int32 GetMemoryUsage() const;
+
+    /// <summary>
+    /// Clears the recorded commands (list has to be recorded again before replaying it).
+    /// </summary>
+    API_FUNCTION() void Clear();
+};
@@ -0,0 +1,239 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ComputeSkinningPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Models/SkinnedMesh.h"
+#include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Threading/Threading.h"
+
+// The amount of frames after which the skinned vertices that are not drawn get released
+#define COMPUTE_SKINNING_RELEASE_FRAMES 60
+
+GPU_CB_STRUCT(Data {
+    uint32 VertexCount;
+    uint32 AttributesOffset;
+    Float2 Dummy0;
+    });
+
+String ComputeSkinningPass::ToString() const
+{
+    return TEXT("ComputeSkinningPass");
+}
+
+bool ComputeSkinningPass::Init()
+{
+    // Compute shaders support is required for this implementation
+    const auto device = GPUDevice::Instance;
+    _supported = device->GetFeatureLevel() >= FeatureLevel::SM5 && device->Limits.HasCompute;
+    if (!_supported)
+        return false;
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ComputeSkinning"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<ComputeSkinningPass, &ComputeSkinningPass::OnShaderReloading>(this);
+#endif
+
+    // Skin meshes before rendering any view
+    _task = New<RenderTask>();
+    _task->Order = -10000000;
+    _task->Render.Bind<ComputeSkinningPass, &ComputeSkinningPass::OnRender>(this);
+
+    return false;
+}
+
+bool ComputeSkinningPass::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _cs = shader->GetCS("CS_Skinning");
+
+    return false;
+}
+
+void ComputeSkinningPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _locker.Lock();
+    for (SkinnedMeshDrawData* skinning : _instances)
+        Release(skinning);
+    _instances.Clear();
+    _locker.Unlock();
+    if (_task)
+    {
+        Delete(_task);
+        _task = nullptr;
+    }
+    SAFE_DELETE_GPU_RESOURCE(_output);
+    _cb = nullptr;
+    _cs = nullptr;
+    _shader = nullptr;
+}
+
+bool ComputeSkinningPass::GetVertices(SkinnedMeshDrawData* skinning, const SkinnedMesh* mesh, GPUBuffer*& positions, GPUBuffer*& attributes)
+{
+    if (!Graphics::ComputeSkinning || !_supported)
+        return false;
+    ScopeLock lock(_locker);
+
+    // Find the mesh (or add it to skin in the next frame)
+    SkinnedMeshDrawData::SkinnedVertices* vertices = nullptr;
+    for (auto& e : skinning->ComputeSkinning)
+    {
+        if (e.Mesh == mesh)
+        {
+            vertices = &e;
+            break;
+        }
+    }
+    if (!vertices)
+    {
+        if (skinning->ComputeSkinning.IsEmpty())
+            _instances.Add(skinning);
+        vertices = &skinning->ComputeSkinning.AddOne();
+        vertices->Mesh = mesh;
+        vertices->Source = nullptr;
+        vertices->Positions = nullptr;
+        vertices->Attributes = nullptr;
+        vertices->Version = 0;
+    }
+    vertices->LastFrameUsed = Engine::FrameCount;
+
+    // Use vertices only if they are up to date with the current bones
+    if (!vertices->Positions || vertices->Version != skinning->GetVersion() || vertices->Source != mesh->GetVertexBuffer())
+        return false;
+    positions = vertices->Positions;
+    attributes = vertices->Attributes;
+    return true;
+}
+
+void ComputeSkinningPass::Remove(SkinnedMeshDrawData* skinning)
+{
+    ScopeLock lock(_locker);
+    Release(skinning);
+    _instances.Remove(skinning);
+}
+
+void ComputeSkinningPass::Release(SkinnedMeshDrawData* skinning)
+{
+    for (auto& e : skinning->ComputeSkinning)
+    {
+        SAFE_DELETE_GPU_RESOURCE(e.Positions);
+        SAFE_DELETE_GPU_RESOURCE(e.Attributes);
+    }
+    skinning->ComputeSkinning.Clear();
+}
+
+void ComputeSkinningPass::OnRender(RenderTask* task, GPUContext* context)
+{
+    ScopeLock lock(_locker);
+    if (_instances.IsEmpty())
+        return;
+    if (!Graphics::ComputeSkinning)
+    {
+        // Release all vertices when the compute skinning gets disabled
+        for (SkinnedMeshDrawData* skinning : _instances)
+            Release(skinning);
+        _instances.Clear();
+        return;
+    }
+    if (checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Compute Skinning");
+
+    const uint64 frame = Engine::FrameCount;
+    for (int32 i = _instances.Count() - 1; i >= 0; i--)
+    {
+        SkinnedMeshDrawData* skinning = _instances[i];
+        for (int32 j = skinning->ComputeSkinning.Count() - 1; j >= 0; j--)
+        {
+            auto& e = skinning->ComputeSkinning[j];
+            if (frame - e.LastFrameUsed > COMPUTE_SKINNING_RELEASE_FRAMES)
+            {
+                // Release vertices that are not drawn anymore
+                SAFE_DELETE_GPU_RESOURCE(e.Positions);
+                SAFE_DELETE_GPU_RESOURCE(e.Attributes);
+                skinning->ComputeSkinning.RemoveAt(j);
+                continue;
+            }
+            const SkinnedMesh* mesh = e.Mesh;
+            if (e.Positions && e.Version == skinning->GetVersion() && e.Source == mesh->GetVertexBuffer())
+                continue;
+            if (!skinning->IsReady() || !mesh->IsInitialized())
+                continue;
+            GPUBuffer* input = mesh->GetVertexBufferRaw(context);
+            if (!input)
+                continue;
+
+            // Prepare buffers
+            const uint32 vertexCount = (uint32)mesh->GetVertexCount();
+            const uint32 positionsSize = vertexCount * sizeof(VB0ElementType);
+            const uint32 attributesSize = vertexCount * sizeof(VB1ElementType);
+            if (!e.Positions)
+            {
+                e.Positions = GPUDevice::Instance->CreateBuffer(TEXT("ComputeSkinning.Positions"));
+                e.Attributes = GPUDevice::Instance->CreateBuffer(TEXT("ComputeSkinning.Attributes"));
+            }
+            if (e.Positions->GetSize() != positionsSize && e.Positions->Init(GPUBufferDescription::Vertex(sizeof(VB0ElementType), vertexCount)))
+                continue;
+            if (e.Attributes->GetSize() != attributesSize && e.Attributes->Init(GPUBufferDescription::Vertex(sizeof(VB1ElementType), vertexCount)))
+                continue;
+            if (!_output)
+                _output = GPUDevice::Instance->CreateBuffer(TEXT("ComputeSkinning.Output"));
+            if (_output->GetSize() < positionsSize + attributesSize && _output->Init(GPUBufferDescription::Raw(positionsSize + attributesSize, GPUBufferFlags::UnorderedAccess)))
+                continue;
+            if (skinning->IsDirty())
+            {
+                context->UpdateBuffer(skinning->BoneMatrices, skinning->Data.Get(), skinning->Data.Count());
+                skinning->OnFlush();
+            }
+
+            // Skin vertices
+            Data data;
+            data.VertexCount = vertexCount;
+            data.AttributesOffset = positionsSize;
+            context->UpdateCB(_cb, &data);
+            context->BindCB(0, _cb);
+            context->BindSR(0, input->View());
+            context->BindSR(1, skinning->BoneMatrices->View());
+            context->BindUA(0, _output->View());
+            context->Dispatch(_cs, Math::DivideAndRoundUp<uint32>(vertexCount, 64), 1, 1);
+            context->ResetUA();
+
+            // Copy the results into the vertex buffers
+            context->CopyBuffer(e.Positions, _output, positionsSize);
+            context->CopyBuffer(e.Attributes, _output, attributesSize, 0, positionsSize);
+            e.Source = mesh->GetVertexBuffer();
+            e.Version = skinning->GetVersion();
+        }
+        if (skinning->ComputeSkinning.IsEmpty())
+            _instances.RemoveAt(i);
+    }
+
+    context->ResetSR();
+    context->ResetUA();
+    context->FlushState();
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class RenderTask;
+class SkinnedMesh;
+class SkinnedMeshDrawData;
+
+/// <summary>
+/// Compute shader skinning (see Graphics::ComputeSkinning). Skins the meshes of the animated models once per frame (before rendering) into the per-instance vertex buffers in the static mesh layout that are drawn by all the rendering passes without the vertex shader skinning.
+/// </summary>
+class ComputeSkinningPass : public RendererPass<ComputeSkinningPass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _cs = nullptr;
+    GPUBuffer* _output = nullptr;
+    RenderTask* _task = nullptr;
+    bool _supported = false;
+    CriticalSection _locker;
+    Array<SkinnedMeshDrawData*> _instances;
+
+public:
+    /// <summary>
+    /// Gets the mesh vertices skinned with the current bones of the skinning data. If they are not ready, the skinning gets requested for the next frame (mesh should be drawn with the vertex shader skinning). Thread-safe.
+    /// </summary>
+    /// <param name="skinning">The skinning data.</param>
+    /// <param name="mesh">The skinned mesh.</param>
+    /// <param name="positions">The output skinned positions buffer (in VB0ElementType layout).</param>
+    /// <param name="attributes">The output skinned vertex attributes buffer (in VB1ElementType layout).</param>
+    /// <returns>True if got the skinned vertices, otherwise false.</returns>
+    bool GetVertices(SkinnedMeshDrawData* skinning, const SkinnedMesh* mesh, GPUBuffer*& positions, GPUBuffer*& attributes);
+
+    /// <summary>
+    /// Releases the skinned vertices of the skinning data (eg. when it gets destroyed).
+    /// </summary>
+    /// <param name="skinning">The skinning data.</param>
+    void Remove(SkinnedMeshDrawData* skinning);
+
+private:
+    void Release(SkinnedMeshDrawData* skinning);
+    void OnRender(RenderTask* task, GPUContext* context);
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _cs = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -2,6 +2,7 @@
 
 #include "DepthOfFieldPass.h"
 #include "RenderList.h"
+#include "ShadingRatePass.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
@@ -342,7 +343,10 @@ void DepthOfFieldPass::Render(RenderContext& renderContext, GPUTexture*& frame,
         context->SetRenderTarget(*tmp);
         context->SetViewportAndScissors((float)dofWidth, (float)dofHeight);
         context->SetState(_psDoNotGenerateBokeh);
+        const bool useVRS = ShadingRatePass::Instance()->Begin(renderContext, context, VariableRateShadingPasses::DepthOfField, dofWidth, dofHeight);
         context->DrawFullscreenTriangle();
+        if (useVRS)
+            ShadingRatePass::Instance()->End(context);
     }
     Swap(frame, tmp);
 
@@ -419,7 +423,10 @@ void DepthOfFieldPass::Render(RenderContext& renderContext, GPUTexture*& frame,
         context->SetRenderTarget(*tmp);
         context->SetViewportAndScissors((float)dofWidth, (float)dofHeight);
         context->SetState(_psBokehComposite);
+        const bool useVRS = ShadingRatePass::Instance()->Begin(renderContext, context, VariableRateShadingPasses::DepthOfField, dofWidth, dofHeight);
         context->DrawFullscreenTriangle();
+        if (useVRS)
+            ShadingRatePass::Instance()->End(context);
         context->ResetRenderTarget();
 
         RenderTargetPool::Release(bokehTarget);
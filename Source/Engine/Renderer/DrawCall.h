@@ -206,6 +206,8 @@ struct DrawCall
             float CurrentLOD;
             float ChunkSizeNextLOD;
             float TerrainChunkSizeLOD0;
+            Float2 LODMorph; // x-LOD distribution (0 if distance-based morphing is disabled), y-LOD bias
+            Float3 LODViewPosition;
             const class TerrainPatch* Patch;
         } Terrain;
 
@@ -321,6 +323,21 @@ struct GeometryDrawStateData
     /// Interpolated between 0-255 to smooth transition over several frames and reduce LOD changing artifacts.
     /// </summary>
     byte LODTransition = 255;
+
+    /// <summary>
+    /// The cached model LOD index (before LOD bias) computed for the LODView during LODFrame. Reused by other render contexts that use the same view for LOD selection (eg. shadow maps) and used as a reference for the LOD switching hysteresis.
+    /// </summary>
+    char LOD = -1;
+
+    /// <summary>
+    /// The frame index of the cached LOD.
+    /// </summary>
+    uint64 LODFrame = 0;
+
+    /// <summary>
+    /// The render view used to compute the cached LOD. Used only for comparison (might be already released).
+    /// </summary>
+    const RenderView* LODView = nullptr;
 };
 
 template<>
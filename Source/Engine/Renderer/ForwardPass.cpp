@@ -2,6 +2,7 @@
 
 #include "ForwardPass.h"
 #include "RenderList.h"
+#include "ShadingRatePass.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/Shader.h"
@@ -138,6 +139,9 @@ void ForwardPass::Render(RenderContext& renderContext, GPUTexture* input, GPUTex
         // Run forward pass
         view.Pass = DrawPass::Forward;
         context->SetRenderTarget(depthBufferHandle, output->View());
+        const bool useVRS = ShadingRatePass::Instance()->Begin(renderContext, context, VariableRateShadingPasses::Forward, output->Width(), output->Height());
         mainCache->ExecuteDrawCalls(renderContext, forwardList, input->View());
+        if (useVRS)
+            ShadingRatePass::Instance()->End(context);
     }
 }
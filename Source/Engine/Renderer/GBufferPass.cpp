@@ -2,6 +2,8 @@
 
 #include "GBufferPass.h"
 #include "RenderList.h"
+#include "ImpostorsPass.h"
+#include "TerrainVirtualTexturePass.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Editor/VertexColors.h"
 #include "Engine/Renderer/Editor/LightmapUVsDensity.h"
@@ -201,6 +203,7 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     // Draw objects that can get decals
     context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
     renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
+    TerrainVirtualTexturePass::Instance()->Draw(renderContext, context);
 
     // Draw decals
     DrawDecals(renderContext, lightBuffer->View());
@@ -208,6 +211,7 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     // Draw objects that cannot get decals
     context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
     renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBufferNoDecals);
+    ImpostorsPass::Instance()->Draw(renderContext, context);
 
     GPUTexture* nullTexture = nullptr;
     renderContext.List->RunCustomPostFxPass(context, renderContext, PostProcessEffectLocation::AfterGBufferPass, lightBuffer, nullTexture);
@@ -4,6 +4,7 @@
 #include "GlobalSurfaceAtlasPass.h"
 #include "../GlobalSignDistanceFieldPass.h"
 #include "../RenderList.h"
+#include "../Utils/GPUWorkBudget.h"
 #include "Engine/Core/Random.h"
 #include "Engine/Core/Types/Variant.h"
 #include "Engine/Core/Math/Int3.h"
@@ -85,9 +86,11 @@ class DDGICustomBuffer : public RenderBuffers::CustomBuffer
         float ProbesSpacing = 0.0f;
         Int3 ProbeScrollOffsets;
         Int3 ProbeScrollClears;
+        uint64 LastFrameUpdated = 0;
 
         void Clear()
         {
+            LastFrameUpdated = 0;
             ProbesOrigin = Float3::Zero;
             ProbeScrollOffsets = Int3::Zero;
             ProbeScrollClears = Int3::Zero;
@@ -115,6 +118,7 @@ class DDGICustomBuffer : public RenderBuffers::CustomBuffer
     GPUTexture* ProbesInstability = nullptr;
 #endif
     DynamicDiffuseGlobalIlluminationPass::BindingData Result;
+    GPUWorkBudget UpdateBudget;
 
     FORCE_INLINE void Release()
     {
@@ -138,6 +142,7 @@ class DDGICustomBuffer : public RenderBuffers::CustomBuffer
 
     ~DDGICustomBuffer()
     {
+        UpdateBudget.Release();
         Release();
     }
 };
@@ -448,9 +453,43 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
     //const uint64 cascadeFrequencies[] = { 1, 1, 1, 1 };
     //const uint64 cascadeFrequencies[] = { 10, 10, 10, 10 };
     bool cascadeSkipUpdate[4];
+    const int32 probesLimit = ddgiData.UpdateBudget.GetItemsLimit(graphicsSettings->GIUpdateBudget * 0.5f, probesCountCascade); // Split budget between DDGI and surface atlas
+    if (!clear && probesLimit != MAX_int32 && GPU_SPREAD_WORKLOAD)
+    {
+        // Pick the most outdated cascades (relative to their update frequency) that fit into the budget (at least one)
+        int32 cascadesOrder[4];
+        float cascadesPriority[4];
+        for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
+        {
+            cascadesOrder[cascadeIndex] = cascadeIndex;
+            cascadesPriority[cascadeIndex] = (float)(ddgiData.LastFrameUsed - ddgiData.Cascades[cascadeIndex].LastFrameUpdated) / (float)cascadeFrequencies[cascadeIndex];
+            cascadeSkipUpdate[cascadeIndex] = true;
+        }
+        for (int32 i = 1; i < cascadesCount; i++)
+        {
+            for (int32 j = i; j > 0 && cascadesPriority[cascadesOrder[j - 1]] < cascadesPriority[cascadesOrder[j]]; j--)
+                Swap(cascadesOrder[j - 1], cascadesOrder[j]);
+        }
+        for (int32 i = 0, probesUpdated = 0; i < cascadesCount && cascadesPriority[cascadesOrder[i]] >= 1.0f && probesUpdated + probesCountCascade <= probesLimit; i++)
+        {
+            cascadeSkipUpdate[cascadesOrder[i]] = false;
+            probesUpdated += probesCountCascade;
+        }
+    }
+    else
+    {
+        for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
+        {
+            cascadeSkipUpdate[cascadeIndex] = !clear && (ddgiData.LastFrameUsed % cascadeFrequencies[cascadeIndex]) != 0 && GPU_SPREAD_WORKLOAD;
+        }
+    }
+    int32 cascadesUpdated = 0;
     for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
     {
-        cascadeSkipUpdate[cascadeIndex] = !clear && (ddgiData.LastFrameUsed % cascadeFrequencies[cascadeIndex]) != 0 && GPU_SPREAD_WORKLOAD;
+        if (cascadeSkipUpdate[cascadeIndex])
+            continue;
+        ddgiData.Cascades[cascadeIndex].LastFrameUpdated = ddgiData.LastFrameUsed;
+        cascadesUpdated++;
     }
 
     // Compute scrolling (probes are placed around camera but are scrolling to increase stability during movement)
@@ -542,6 +581,9 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
     // Update probes
     {
         PROFILE_GPU_CPU_NAMED("Probes Update");
+        ZoneValue(cascadesUpdated);
+        if (cascadesUpdated != 0)
+            ddgiData.UpdateBudget.Begin();
         uint32 threadGroupsX;
 #if DDGI_DEBUG_STATS
         uint32 zero[4] = {};
@@ -644,6 +686,7 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
                 arg += sizeof(GPUDispatchIndirectArgs);
             }
         }
+        ddgiData.UpdateBudget.End(cascadesUpdated * probesCountCascade);
 
 #if DDGI_DEBUG_STATS
         // Update stats
@@ -6,6 +6,7 @@
 #include "../GBufferPass.h"
 #include "../RenderList.h"
 #include "../ShadowsPass.h"
+#include "../Utils/GPUWorkBudget.h"
 #include "Engine/Core/Math/Matrix3x3.h"
 #include "Engine/Core/Math/OrientedBoundingBox.h"
 #include "Engine/Core/Collections/Sorting.h"
@@ -89,6 +90,17 @@ struct GlobalSurfaceAtlasNewTile
     }
 };
 
+struct GlobalSurfaceAtlasDirtyObject
+{
+    void* ActorObject;
+    float Priority;
+
+    bool operator<(const GlobalSurfaceAtlasDirtyObject& other) const
+    {
+        return Priority > other.Priority;
+    }
+};
+
 struct GlobalSurfaceAtlasTile : RectPackNode<uint16>
 {
     Float3 ViewDirection;
@@ -117,6 +129,7 @@ struct GlobalSurfaceAtlasObject
     Float3 Position;
     float Radius;
     mutable bool Dirty;
+    mutable bool HasNewTiles; // True if any tile got inserted into atlas but not yet rasterized (contains data of the previous tile owner)
     bool UseVisibility; // TODO: merge into bit flags
     OrientedBoundingBox Bounds;
 
@@ -161,6 +174,9 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
 
     // Cached data to be reused during RasterizeActor
     Array<void*> DirtyObjectsBuffer;
+    Array<void*> DeferredObjectsBuffer; // Dirty objects with new tiles that didn't fit into the update budget (tiles get only cleared)
+    int32 DirtyObjectsLimit = MAX_int32;
+    GPUWorkBudget RasterizeBudget;
     Vector4 CullingPosDistance;
     uint64 CurrentFrame;
     Float3 ViewPosition;
@@ -210,6 +226,7 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
     {
         SAFE_DELETE_GPU_RESOURCE(ChunksBuffer);
         SAFE_DELETE_GPU_RESOURCE(CulledObjectsBuffer);
+        RasterizeBudget.Release();
         Reset();
     }
 
@@ -296,6 +313,7 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
         DistanceScaling = 0.2f; // The scale for tiles at distanceScalingEnd and further away
         // TODO: add DetailsScale param to adjust quality of scene details in Global Surface Atlas
         MinObjectRadius = 20.0f; // Skip too small objects
+        DirtyObjectsLimit = RasterizeBudget.GetItemsLimit(GraphicsSettings::Get()->GIUpdateBudget * 0.5f, 8); // Split budget between atlas and DDGI
         CullingPosDistance = Vector4(renderContext.View.Position, distance);
         AsyncRenderContext = renderContext;
         AsyncRenderContext.View.Pass = DrawPass::GlobalSurfaceAtlas;
@@ -312,15 +330,15 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
             Function<void(int32)> func;
             func.Bind<GlobalSurfaceAtlasCustomBuffer, &GlobalSurfaceAtlasCustomBuffer::DrawActorsJobSync>(this);
             const int32 jobCount = Math::Max(JobSystem::GetThreadsCount() - 1, 1); // Leave 1 thread unused to not block the main-thread (jobs will overlap with rendering)
-            AsyncDrawWaitLabels.Add(JobSystem::Dispatch(func, jobCount));
+            AsyncDrawWaitLabels.Add(JobSystem::Dispatch(func, jobCount, JobPriority::Background));
 
             // Run in async via Job System
             func.Bind<GlobalSurfaceAtlasCustomBuffer, &GlobalSurfaceAtlasCustomBuffer::DrawActorsJob>(this);
-            AsyncDrawWaitLabels.Add(JobSystem::Dispatch(func, jobCount));
+            AsyncDrawWaitLabels.Add(JobSystem::Dispatch(func, jobCount, JobPriority::Background));
 
             // Run dependant job that will process objects data in async
             func.Bind<GlobalSurfaceAtlasCustomBuffer, &GlobalSurfaceAtlasCustomBuffer::SetupJob>(this);
-            AsyncDrawWaitLabels.Add(JobSystem::Dispatch(func, ToSpan(AsyncDrawWaitLabels)));
+            AsyncDrawWaitLabels.Add(JobSystem::Dispatch(func, ToSpan(AsyncDrawWaitLabels), 1, JobPriority::Background));
         }
         else
         {
@@ -353,6 +371,7 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
             object.Position = (Float3)newObject.ActorObjectBounds.Center;
             object.Radius = (float)newObject.ActorObjectBounds.Radius;
             object.Dirty = true;
+            object.HasNewTiles = true;
             object.UseVisibility = newObject.UseVisibility;
             object.Bounds = newObject.Bounds;
         }
@@ -374,6 +393,7 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
             {
                 object.Tiles[newTile.TileIndex] = tile;
                 object.Dirty = true;
+                object.HasNewTiles = true;
             }
             else
             {
@@ -404,6 +424,7 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
     {
         PROFILE_CPU_NAMED("Write Objects");
         DirtyObjectsBuffer.Clear();
+        DeferredObjectsBuffer.Clear();
         ObjectsBuffer.Clear();
         ObjectsListBuffer.Clear();
         ObjectsListBuffer.Data.EnsureCapacity(Objects.Count() * sizeof(uint32));
@@ -413,8 +434,6 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
             if (object.Dirty)
             {
                 // Collect dirty objects
-                object.LastFrameUpdated = CurrentFrame;
-                object.LightingUpdateFrame = CurrentFrame;
                 DirtyObjectsBuffer.Add(e.Key);
             }
 
@@ -484,6 +503,38 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
                 tileData[4] = Float4(tile->ViewBoundsSize, 0.0f); // w unused
             }
         }
+
+        if (DirtyObjectsBuffer.Count() > DirtyObjectsLimit)
+        {
+            // Redraw only the most important objects within the budget and defer the rest to the next frames (they stay dirty)
+            PROFILE_CPU_NAMED("Prioritize Objects");
+            Array<GlobalSurfaceAtlasDirtyObject, RendererAllocation> priorities;
+            priorities.Resize(DirtyObjectsBuffer.Count());
+            for (int32 i = 0; i < DirtyObjectsBuffer.Count(); i++)
+            {
+                const GlobalSurfaceAtlasObject& object = Objects.At(DirtyObjectsBuffer.Get()[i]);
+                float priority = object.Radius / Math::Max(Float3::Distance(object.Position, ViewPosition), 1.0f);
+                if (object.HasNewTiles || object.LastFrameUpdated == 0)
+                    priority *= 10.0f; // New or explicitly changed objects go first
+                priorities[i] = { DirtyObjectsBuffer.Get()[i], priority };
+            }
+            Sorting::QuickSort(priorities.Get(), priorities.Count());
+            DirtyObjectsBuffer.Clear();
+            for (int32 i = 0; i < priorities.Count(); i++)
+            {
+                void* actorObject = priorities.Get()[i].ActorObject;
+                if (i < DirtyObjectsLimit)
+                    DirtyObjectsBuffer.Add(actorObject);
+                else if (Objects.At(actorObject).HasNewTiles)
+                    DeferredObjectsBuffer.Add(actorObject);
+            }
+        }
+        for (void* actorObject : DirtyObjectsBuffer)
+        {
+            auto& object = Objects.At(actorObject);
+            object.LastFrameUpdated = CurrentFrame;
+            object.LightingUpdateFrame = CurrentFrame;
+        }
     }
 
     void SetupJob(int32)
@@ -805,9 +856,10 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
         context->DrawInstanced(_vertexBuffer->Data.Count() / sizeof(AtlasTileVertex), 1);
 
     // Rasterize world geometry material properties into Global Surface Atlas
-    if (surfaceAtlasData.DirtyObjectsBuffer.Count() != 0)
+    if (surfaceAtlasData.DirtyObjectsBuffer.Count() != 0 || surfaceAtlasData.DeferredObjectsBuffer.Count() != 0)
     {
         PROFILE_GPU_CPU_NAMED("Rasterize Tiles");
+        surfaceAtlasData.RasterizeBudget.Begin();
 
         RenderContext renderContextTiles = renderContext;
         renderContextTiles.List = RenderList::GetFromPool();
@@ -841,19 +893,22 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
             {
                 // Per-tile clear (with a single draw call)
                 _vertexBuffer->Clear();
-                _vertexBuffer->Data.EnsureCapacity(surfaceAtlasData.DirtyObjectsBuffer.Count() * 6 * sizeof(AtlasTileVertex));
-                for (void* actorObject : surfaceAtlasData.DirtyObjectsBuffer)
+                _vertexBuffer->Data.EnsureCapacity((surfaceAtlasData.DirtyObjectsBuffer.Count() + surfaceAtlasData.DeferredObjectsBuffer.Count()) * 6 * sizeof(AtlasTileVertex));
+                for (auto* objectsBuffer : { &surfaceAtlasData.DirtyObjectsBuffer, &surfaceAtlasData.DeferredObjectsBuffer })
                 {
-                    const GlobalSurfaceAtlasObject* objectPtr = surfaceAtlasData.Objects.TryGet(actorObject);
-                    if (!objectPtr)
-                        continue;
-                    const GlobalSurfaceAtlasObject& object = *objectPtr;
-                    for (int32 tileIndex = 0; tileIndex < 6; tileIndex++)
+                    for (void* actorObject : *objectsBuffer)
                     {
-                        auto* tile = object.Tiles[tileIndex];
-                        if (!tile)
+                        const GlobalSurfaceAtlasObject* objectPtr = surfaceAtlasData.Objects.TryGet(actorObject);
+                        if (!objectPtr)
                             continue;
-                        VB_WRITE_TILE_POS_ONLY(tile);
+                        const GlobalSurfaceAtlasObject& object = *objectPtr;
+                        for (int32 tileIndex = 0; tileIndex < 6; tileIndex++)
+                        {
+                            auto* tile = object.Tiles[tileIndex];
+                            if (!tile)
+                                continue;
+                            VB_WRITE_TILE_POS_ONLY(tile);
+                        }
                     }
                 }
                 context->SetState(_psClear);
@@ -861,7 +916,6 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
                 VB_DRAW();
             }
         }
-        // TODO: limit dirty objects count on a first frame (eg. collect overflown objects to be redirty next frame)
         auto& drawCallsListGBuffer = renderContextTiles.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer];
         auto& drawCallsListGBufferNoDecals = renderContextTiles.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals];
         drawCallsListGBuffer.CanUseInstancing = false;
@@ -874,6 +928,7 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
                 continue;
             const GlobalSurfaceAtlasObject& object = *objectPtr;
             object.Dirty = false;
+            object.HasNewTiles = false;
 
             // Clear draw calls list
             renderContextTiles.List->DrawCalls.Clear();
@@ -924,7 +979,9 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
             }
         }
         ZoneValue(tilesDrawn);
+        ZoneValue(surfaceAtlasData.DeferredObjectsBuffer.Count());
         context->ResetRenderTarget();
+        surfaceAtlasData.RasterizeBudget.End(surfaceAtlasData.DirtyObjectsBuffer.Count());
         RenderList::ReturnToPool(renderContextTiles.List);
     }
 
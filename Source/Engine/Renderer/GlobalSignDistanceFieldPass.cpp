@@ -78,6 +78,8 @@ GPU_CB_STRUCT(ModelsRasterizeData {
     uint32 MipCoordScale;
     uint32 MipTexOffsetX;
     uint32 MipMipOffsetX;
+    Int3 ScrollOffset;
+    int32 Padding11;
     });
 
 struct RasterizeChunk
@@ -148,6 +150,7 @@ struct CascadeData
     Vector3 OriginMax;
     HashSet<RasterizeChunkKey> NonEmptyChunks;
     HashSet<RasterizeChunkKey> StaticChunks;
+    Int3 ScrollOffset = Int3::Zero; // Offset (in voxels) to scroll the cascade data by before rasterization (when cascade center moves by a few chunks).
 
     // Cache
     Dictionary<RasterizeChunkKey, RasterizeChunk> Chunks;
@@ -158,6 +161,43 @@ struct CascadeData
     HashSet<GPUTexture*> PendingSDFTextures;
     HashSet<ScriptingTypeHandle> PendingObjectTypes;
 
+    static void ScrollChunks(HashSet<RasterizeChunkKey>& chunks, const Int3& chunkDelta, const Int3& min, const Int3& max)
+    {
+        // Move chunk keys into the new cascade location and remove the ones outside the valid range
+        HashSet<RasterizeChunkKey> result;
+        result.EnsureCapacity(chunks.Count());
+        for (const auto& e : chunks)
+        {
+            RasterizeChunkKey key = e.Item;
+            key.Coord -= chunkDelta;
+            if (key.Coord.X < min.X || key.Coord.Y < min.Y || key.Coord.Z < min.Z || key.Coord.X >= max.X || key.Coord.Y >= max.Y || key.Coord.Z >= max.Z)
+                continue;
+            key.Hash = key.Layer * (RasterizeChunkKeyHashResolution * RasterizeChunkKeyHashResolution * RasterizeChunkKeyHashResolution) + key.Coord.Z * (RasterizeChunkKeyHashResolution * RasterizeChunkKeyHashResolution) + key.Coord.Y * RasterizeChunkKeyHashResolution + key.Coord.X;
+            result.Add(key);
+        }
+        chunks.Swap(result);
+    }
+
+    bool Scroll(const Int3& chunkDelta, int32 chunksCount)
+    {
+        if (Math::Abs(chunkDelta.X) >= chunksCount - 1 || Math::Abs(chunkDelta.Y) >= chunksCount - 1 || Math::Abs(chunkDelta.Z) >= chunksCount - 1)
+            return true;
+        ScrollOffset = chunkDelta * GLOBAL_SDF_RASTERIZE_CHUNK_SIZE;
+
+        // Texture data gets scrolled so all non-empty chunks that remain inside the cascade are still valid
+        ScrollChunks(NonEmptyChunks, chunkDelta, Int3::Zero, Int3(chunksCount));
+
+        // Static chunks next to the newly exposed area need to be redrawn to include the distance to objects that entered the cascade
+        Int3 staticMin, staticMax;
+        for (int32 i = 0; i < 3; i++)
+        {
+            staticMin.Raw[i] = chunkDelta.Raw[i] < 0 ? 1 - chunkDelta.Raw[i] : 0;
+            staticMax.Raw[i] = chunkDelta.Raw[i] > 0 ? chunksCount - chunkDelta.Raw[i] - 1 : chunksCount;
+        }
+        ScrollChunks(StaticChunks, chunkDelta, staticMin, staticMax);
+        return false;
+    }
+
     void OnSceneRenderingDirty(const BoundingBox& objectBounds)
     {
         if (StaticChunks.IsEmpty() || !Bounds.Intersects(objectBounds))
@@ -201,11 +241,18 @@ class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer,
     HashSet<ScriptingTypeHandle> ObjectTypes;
     HashSet<GPUTexture*> SDFTextures;
     GlobalSignDistanceFieldPass::BindingData Result;
+    uint64 AsyncComputeSyncPoint = 0;
 
     // Async objects drawing cache
     Array<int64, FixedAllocation<1>> AsyncDrawWaitLabels;
     RenderContext AsyncRenderContext;
 
+    GlobalSignDistanceFieldCustomBuffer()
+    {
+        // Only static objects are cached in the static chunks
+        StaticActorsOnly = true;
+    }
+
     ~GlobalSignDistanceFieldCustomBuffer()
     {
         WaitForDrawing();
@@ -338,10 +385,15 @@ class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer,
             cascade.PendingSDFTextures.Clear();
 
             // Check if cascade center has been moved
+            cascade.ScrollOffset = Int3::Zero;
             if (!(useCache && Float3::NearEqual(cascade.Position, center, cascadeVoxelSize)))
             {
-                // TODO: optimize for moving camera (use chunkCoords scrolling)
-                cascade.StaticChunks.Clear();
+                // Scroll the cascade contents for a moving camera (center is snapped to the chunks grid) and redraw only the chunks that entered the cascade
+                const Int3 chunkDelta(Float3::Round((center - cascade.Position) / cascadeChunkSize));
+                if (!useCache || !Math::NearEqual(cascade.VoxelSize, cascadeVoxelSize) || cascade.Scroll(chunkDelta, rasterizeChunks))
+                {
+                    cascade.StaticChunks.Clear();
+                }
             }
 
             // Setup cascade info
@@ -437,15 +489,19 @@ void GlobalSignDistanceFieldCustomBuffer::DrawCascadeActors(const CascadeData& c
     // TODO: add scene detail scale factor to PostFx settings (eg. to increase or decrease scene details and quality)
     const float minObjectRadius = Math::Max(20.0f, cascade.VoxelSize * 2.0f); // Skip too small objects for this cascade
     int32 actorsDrawn = 0;
+    Array<int32> keys;
     SceneRendering::DrawCategory drawCategories[] = { SceneRendering::SceneDraw, SceneRendering::SceneDrawAsync };
     for (auto* scene : AsyncRenderContext.List->Scenes)
     {
         for (SceneRendering::DrawCategory drawCategory : drawCategories)
         {
             auto& list = scene->Actors[drawCategory];
-            for (const auto& e : list)
+            keys.Clear();
+            scene->QueryActors(drawCategory, cullingBounds, keys);
+            for (const int32 key : keys)
             {
-                if (e.Bounds.Radius >= minObjectRadius && viewMask & e.LayerMask && CollisionsHelper::BoxIntersectsSphere(cullingBounds, e.Bounds))
+                const auto& e = list.Get()[key];
+                if (e.Bounds.Radius >= minObjectRadius && viewMask & e.LayerMask)
                 {
                     //PROFILE_CPU_ACTOR(e.Actor);
                     e.Actor->Draw(AsyncRenderContext);
@@ -627,6 +683,7 @@ bool GlobalSignDistanceFieldPass::setupResources()
     _csRasterizeHeightfield = shader->GetCS("CS_RasterizeHeightfield");
     _csClearChunk = shader->GetCS("CS_ClearChunk");
     _csGenerateMip = shader->GetCS("CS_GenerateMip");
+    _csScrollCascade = shader->GetCS("CS_ScrollCascade");
 
     // Init buffer
     if (!_objectsBuffer)
@@ -655,6 +712,7 @@ void GlobalSignDistanceFieldPass::OnShaderReloading(Asset* obj)
     _csRasterizeHeightfield = nullptr;
     _csClearChunk = nullptr;
     _csGenerateMip = nullptr;
+    _csScrollCascade = nullptr;
     _cb0 = nullptr;
     _cb1 = nullptr;
     invalidateResources();
@@ -691,12 +749,33 @@ bool GlobalSignDistanceFieldPass::Get(const RenderBuffers* buffers, BindingData&
     auto* sdfData = buffers ? buffers->FindCustomBuffer<GlobalSignDistanceFieldCustomBuffer>(TEXT("GlobalSignDistanceField")) : nullptr;
     if (sdfData && sdfData->LastFrameUsed + 1 >= Engine::FrameCount) // Allow to use SDF from the previous frame (eg. particles in Editor using the Editor viewport in Game viewport - Game render task runs first)
     {
+        GPUDevice::Instance->WaitForAsyncCompute(sdfData->AsyncComputeSyncPoint, false);
         result = sdfData->Result;
         return false;
     }
     return true;
 }
 
+bool GlobalSignDistanceFieldPass::RenderAsync(RenderContext& renderContext, GPUContext* context)
+{
+    BindingData bindingData;
+    GPUContext* asyncContext = Graphics::AsyncCompute && !checkIfSkipPass() ? GPUDevice::Instance->GetAsyncComputeContext() : nullptr;
+    if (!asyncContext)
+        return Render(renderContext, context, bindingData);
+    const bool failed = Render(renderContext, asyncContext, bindingData);
+    const uint64 syncPoint = GPUDevice::Instance->SubmitAsyncCompute();
+    if (!failed)
+        renderContext.Buffers->GetCustomBuffer<GlobalSignDistanceFieldCustomBuffer>(TEXT("GlobalSignDistanceField"))->AsyncComputeSyncPoint = syncPoint;
+    return failed;
+}
+
+void GlobalSignDistanceFieldPass::WaitForAsyncCompute(const RenderBuffers* buffers, bool submit)
+{
+    auto* sdfData = buffers ? buffers->FindCustomBuffer<GlobalSignDistanceFieldCustomBuffer>(TEXT("GlobalSignDistanceField")) : nullptr;
+    if (sdfData && sdfData->AsyncComputeSyncPoint != 0)
+        GPUDevice::Instance->WaitForAsyncCompute(sdfData->AsyncComputeSyncPoint, submit);
+}
+
 bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContext* context, BindingData& result)
 {
     // Skip if not supported
@@ -710,10 +789,12 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
     const auto currentFrame = Engine::FrameCount;
     if (sdfData.LastFrameUsed == currentFrame)
     {
+        GPUDevice::Instance->WaitForAsyncCompute(sdfData.AsyncComputeSyncPoint, false);
         result = sdfData.Result;
         return false;
     }
     sdfData.LastFrameUsed = currentFrame;
+    sdfData.AsyncComputeSyncPoint = 0;
     PROFILE_GPU_CPU("Global SDF");
 
     // Setup options
@@ -779,6 +860,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         {
             cascade.NonEmptyChunks.Clear();
             cascade.StaticChunks.Clear();
+            cascade.ScrollOffset = Int3::Zero;
         }
         context->ClearUA(sdfData.Texture, Float4::One);
         context->ClearUA(sdfData.TextureMip, Float4::One);
@@ -833,6 +915,43 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         context->BindCB(1, _cb1);
         constexpr int32 chunkDispatchGroups = GLOBAL_SDF_RASTERIZE_CHUNK_SIZE / GLOBAL_SDF_RASTERIZE_GROUP_SIZE;
         int32 chunkDispatches = 0;
+        if (cascade.ScrollOffset != Int3::Zero)
+        {
+            PROFILE_GPU_CPU_NAMED("Scroll");
+            auto desc = GPUTextureDescription::New3D(resolution, resolution, resolution, GLOBAL_SDF_FORMAT, GPUTextureFlags::ShaderResource | GPUTextureFlags::UnorderedAccess, 1);
+            GPUTexture* tmpCascade = RenderTargetPool::Get(desc);
+            if (!tmpCascade)
+                return true;
+            RENDER_TARGET_POOL_SET_NAME(tmpCascade, "GlobalSDF.Scroll");
+            const int32 scrollDispatchGroups = Math::DivideAndRoundUp(resolution, GLOBAL_SDF_RASTERIZE_GROUP_SIZE);
+
+            // Tex -> Tmp (with scroll)
+            context->ResetUA();
+            data.ScrollOffset = cascade.ScrollOffset;
+            data.MipTexOffsetX = cascadeIndex * resolution;
+            data.MipMipOffsetX = 0;
+            context->UpdateCB(_cb1, &data);
+            context->BindSR(0, textureView);
+            context->BindUA(0, tmpCascade->ViewVolume());
+            context->Dispatch(_csScrollCascade, scrollDispatchGroups, scrollDispatchGroups, scrollDispatchGroups);
+
+            // Tmp -> Tex
+            context->ResetUA();
+            context->ResetSR();
+            data.ScrollOffset = Int3::Zero;
+            data.MipTexOffsetX = 0;
+            data.MipMipOffsetX = cascadeIndex * resolution;
+            context->UpdateCB(_cb1, &data);
+            context->BindSR(0, tmpCascade->ViewVolume());
+            context->BindUA(0, textureView);
+            context->Dispatch(_csScrollCascade, scrollDispatchGroups, scrollDispatchGroups, scrollDispatchGroups);
+            context->ResetUA();
+            context->ResetSR();
+            context->BindUA(0, textureView);
+            RenderTargetPool::Release(tmpCascade);
+            cascade.ScrollOffset = Int3::Zero;
+            chunkDispatches++;
+        }
         if (!reset)
         {
             PROFILE_GPU_CPU_NAMED("Clear Chunks");
@@ -39,6 +39,7 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     GPUShaderProgramCS* _csRasterizeHeightfield = nullptr;
     GPUShaderProgramCS* _csClearChunk = nullptr;
     GPUShaderProgramCS* _csGenerateMip = nullptr;
+    GPUShaderProgramCS* _csScrollCascade = nullptr;
     GPUConstantBuffer* _cb0 = nullptr;
     GPUConstantBuffer* _cb1 = nullptr;
     class DynamicStructuredBuffer* _objectsBuffer = nullptr;
@@ -67,6 +68,21 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     /// <returns>True if failed to render (platform doesn't support it, out of video memory, disabled feature or effect is not ready), otherwise false.</returns>
     bool Render(RenderContext& renderContext, GPUContext* context, BindingData& result);
 
+    /// <summary>
+    /// Renders the Global SDF on the async compute queue (if supported and enabled in Graphics Settings), otherwise on the given context. Results are synchronized with the main context before the first use via Get/Render or WaitForAsyncCompute.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context (main).</param>
+    /// <returns>True if failed to render (platform doesn't support it, out of video memory, disabled feature or effect is not ready), otherwise false.</returns>
+    bool RenderAsync(RenderContext& renderContext, GPUContext* context);
+
+    /// <summary>
+    /// Makes the main context wait for the Global SDF rendered on the async compute queue.
+    /// </summary>
+    /// <param name="buffers">The rendering context buffers.</param>
+    /// <param name="submit">True if submit the main context commands recorded so far to overlap them with the async work (use only between the rendering passes).</param>
+    void WaitForAsyncCompute(const RenderBuffers* buffers, bool submit);
+
     /// <summary>
     /// Renders the debug view.
     /// </summary>
@@ -0,0 +1,355 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ImpostorsPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+
+// The amount of frames along each side of the impostor atlas (frames cover the whole sphere of directions using octahedral mapping)
+#define IMPOSTOR_FRAMES 8
+
+// The resolution of a single impostor frame (in pixels)
+#define IMPOSTOR_FRAME_RESOLUTION 128
+
+// The maximum amount of impostors to bake in a single frame
+#define IMPOSTOR_BAKES_PER_FRAME 1
+
+GPU_CB_STRUCT(Data {
+    Matrix ViewProjectionMatrix;
+    Float3 ViewPos;
+    float IsOrtho;
+    Float3 ViewDir;
+    uint32 InstanceOffset;
+    float FramesCount;
+    float FrameTexelSize;
+    Float2 Dummy0;
+    });
+
+struct ImpostorInstance
+{
+    Float4 PositionRadius;
+    Float4 Orientation;
+};
+
+namespace
+{
+    // Gets the direction vector from octahedral coordinates (in range [-1; 1]), matches GetOctahedralDirection from Octahedral.hlsl
+    Float3 GetOctahedralDirection(const Float2& coords)
+    {
+        Float3 direction(coords.X, coords.Y, 1.0f - Math::Abs(coords.X) - Math::Abs(coords.Y));
+        if (direction.Z < 0.0f)
+        {
+            const float x = (1.0f - Math::Abs(direction.Y)) * (direction.X >= 0.0f ? 1.0f : -1.0f);
+            const float y = (1.0f - Math::Abs(direction.X)) * (direction.Y >= 0.0f ? 1.0f : -1.0f);
+            direction.X = x;
+            direction.Y = y;
+        }
+        return Float3::Normalize(direction);
+    }
+
+    bool CanBake(Model* model)
+    {
+        if (!model->IsLoaded() || !model->CanBeRendered())
+            return false;
+        for (const MaterialSlot& slot : model->MaterialSlots)
+        {
+            if (slot.Material && !slot.Material->IsReady())
+                return false;
+        }
+        return true;
+    }
+}
+
+ImpostorsPass::ImpostorsPass()
+    : _instances(0, sizeof(ImpostorInstance), false, TEXT("Impostors.Instances"))
+{
+}
+
+const ModelImpostor* ImpostorsPass::GetImpostor(Model* model)
+{
+    ScopeLock lock(_locker);
+    ModelImpostor* impostor;
+    if (_impostors.TryGet(model, impostor))
+        return impostor->IsReady ? impostor : nullptr;
+
+    // Queue the bake
+    impostor = New<ModelImpostor>();
+    _impostors.Add(model, impostor);
+    _bakeQueue.Add(model);
+    model->OnUnloaded.Bind<ImpostorsPass, &ImpostorsPass::OnModelUnloaded>(this);
+    return nullptr;
+}
+
+void ImpostorsPass::Bake(GPUContext* context)
+{
+    if (_lastBakeFrame == Engine::FrameCount)
+        return;
+    _lastBakeFrame = Engine::FrameCount;
+    ScopeLock lock(_locker);
+    int32 bakedCount = 0;
+    for (int32 i = 0; i < _bakeQueue.Count() && bakedCount < IMPOSTOR_BAKES_PER_FRAME; i++)
+    {
+        // Wait for the model and its materials to be ready
+        Model* model = _bakeQueue[i];
+        if (!CanBake(model))
+            continue;
+        _bakeQueue.RemoveAtKeepOrder(i--);
+        ModelImpostor* impostor = _impostors[model];
+        if (BakeImpostor(context, model, impostor))
+        {
+            LOG(Warning, "Failed to bake impostor for model {0}.", model->ToString());
+            continue;
+        }
+        impostor->IsReady = true;
+        bakedCount++;
+    }
+}
+
+bool ImpostorsPass::BakeImpostor(GPUContext* context, Model* model, ModelImpostor* impostor)
+{
+    PROFILE_GPU_CPU("Bake Impostor");
+
+    // Allocate atlas
+    const int32 resolution = IMPOSTOR_FRAMES * IMPOSTOR_FRAME_RESOLUTION;
+    const PixelFormat formats[3] = { GBUFFER0_FORMAT, GBUFFER1_FORMAT, GBUFFER2_FORMAT };
+    for (int32 i = 0; i < ARRAY_COUNT(impostor->Atlas); i++)
+    {
+        if (!impostor->Atlas[i])
+            impostor->Atlas[i] = GPUDevice::Instance->CreateTexture(TEXT("Impostor.Atlas"));
+        if (impostor->Atlas[i]->Init(GPUTextureDescription::New2D(resolution, resolution, formats[i], GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget)))
+            return true;
+    }
+    auto tempDesc = GPUTextureDescription::New2D(resolution, resolution, PixelFormat::R11G11B10_Float, GPUTextureFlags::RenderTarget);
+    auto lightBuffer = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(lightBuffer, "Impostor.Light");
+    tempDesc.Format = GBUFFER3_FORMAT;
+    auto gBuffer3 = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(gBuffer3, "Impostor.GBuffer3");
+    tempDesc.Format = PixelFormat::D24_UNorm_S8_UInt;
+    tempDesc.Flags = GPUTextureFlags::DepthStencil;
+    auto depthBuffer = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(depthBuffer, "Impostor.Depth");
+
+    // Collect model draw calls (highest resident LOD, model space, default materials)
+    const int32 lodIndex = model->HighestResidentLODIndex();
+    const BoundingBox box = model->GetBox(lodIndex);
+    BoundingSphere::FromBox(box, impostor->Bounds);
+    const Float3 center = box.GetCenter();
+    const float radius = Math::Max((float)impostor->Bounds.Radius, ZeroTolerance);
+    RenderContext renderContext;
+    renderContext.List = RenderList::GetFromPool();
+    renderContext.View.Pass = DrawPass::GBuffer;
+    renderContext.View.IsOfflinePass = true;
+    renderContext.View.IsSingleFrame = true;
+    for (const Mesh& mesh : model->LODs[lodIndex].Meshes)
+    {
+        MaterialBase* material = model->MaterialSlots[mesh.GetMaterialSlotIndex()].Material.Get();
+        if (!material)
+            material = GPUDevice::Instance->GetDefaultMaterial();
+        mesh.Draw(renderContext, material, Matrix::Identity, StaticFlags::None, false, DrawPass::GBuffer);
+    }
+    renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBuffer);
+    renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBufferNoDecals);
+
+    // Draw frames from the directions around the model
+    GPUTextureView* targetBuffers[5] =
+    {
+        lightBuffer->View(),
+        impostor->Atlas[0]->View(),
+        impostor->Atlas[1]->View(),
+        impostor->Atlas[2]->View(),
+        gBuffer3->View(),
+    };
+    for (GPUTextureView* target : targetBuffers)
+        context->Clear(target, Color::Transparent);
+    context->ClearDepth(depthBuffer->View());
+    context->SetRenderTarget(depthBuffer->View(), ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+    Matrix view, projection;
+    Matrix::Ortho(radius * 2.0f, radius * 2.0f, radius * 0.5f, radius * 3.5f, projection);
+    for (int32 y = 0; y < IMPOSTOR_FRAMES; y++)
+    {
+        for (int32 x = 0; x < IMPOSTOR_FRAMES; x++)
+        {
+            const Float2 coords = Float2(((float)x + 0.5f) / IMPOSTOR_FRAMES, ((float)y + 0.5f) / IMPOSTOR_FRAMES) * 2.0f - 1.0f;
+            const Float3 direction = GetOctahedralDirection(coords);
+            const Float3 up = Math::Abs(direction.Y) > 0.99f ? Float3::UnitZ : Float3::UnitY;
+            const Float3 position = center + direction * (radius * 2.0f);
+            Matrix::LookAt(position, center, up, view);
+            RenderView& frameView = renderContext.View;
+            frameView.Position = position;
+            frameView.Direction = -direction;
+            frameView.Near = radius * 0.5f;
+            frameView.Far = radius * 3.5f;
+            frameView.SetUp(view, projection);
+            frameView.PrevView = frameView.View;
+            frameView.PrevProjection = frameView.Projection;
+            frameView.PrevViewProjection = frameView.ViewProjection();
+            frameView.PrepareCache(renderContext, (float)IMPOSTOR_FRAME_RESOLUTION, (float)IMPOSTOR_FRAME_RESOLUTION, Float2::Zero);
+            context->SetViewportAndScissors(Viewport((float)(x * IMPOSTOR_FRAME_RESOLUTION), (float)(y * IMPOSTOR_FRAME_RESOLUTION), (float)IMPOSTOR_FRAME_RESOLUTION, (float)IMPOSTOR_FRAME_RESOLUTION));
+            renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
+            renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBufferNoDecals);
+        }
+    }
+    context->ResetRenderTarget();
+
+    // Cleanup
+    RenderList::ReturnToPool(renderContext.List);
+    RenderTargetPool::Release(lightBuffer);
+    RenderTargetPool::Release(gBuffer3);
+    RenderTargetPool::Release(depthBuffer);
+    return false;
+}
+
+void ImpostorsPass::Draw(const RenderContext& renderContext, GPUContext* context)
+{
+    auto& impostors = renderContext.List->Impostors;
+    if (impostors.Count() == 0 || checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Impostors");
+
+    // Group instances by impostor and upload them
+    Sorting::QuickSort(impostors.Get(), impostors.Count());
+    _instances.Clear();
+    auto* instances = _instances.WriteReserve<ImpostorInstance>(impostors.Count());
+    for (int32 i = 0; i < impostors.Count(); i++)
+    {
+        const ImpostorDrawCall& e = impostors.Get()[i];
+        instances[i].PositionRadius = Float4(e.Position, e.Radius);
+        instances[i].Orientation = Float4(e.Orientation.X, e.Orientation.Y, e.Orientation.Z, e.Orientation.W);
+    }
+    _instances.Flush(context);
+
+    // Draw all instances of each impostor with a single instanced quads batch
+    const RenderView& view = renderContext.View;
+    Data data;
+    Matrix::Transpose(view.Frustum.GetMatrix(), data.ViewProjectionMatrix);
+    data.ViewPos = view.Position;
+    data.IsOrtho = view.IsOrthographicProjection() ? 1.0f : 0.0f;
+    data.ViewDir = view.Direction;
+    data.FramesCount = (float)IMPOSTOR_FRAMES;
+    data.FrameTexelSize = 0.5f / (float)IMPOSTOR_FRAME_RESOLUTION;
+    context->SetState(view.Pass == DrawPass::Depth ? _psDepth : _psGBuffer);
+    context->BindSR(0, _instances.GetBuffer()->View());
+    for (int32 start = 0; start < impostors.Count();)
+    {
+        const ModelImpostor* impostor = impostors.Get()[start].Impostor;
+        int32 end = start + 1;
+        while (end < impostors.Count() && impostors.Get()[end].Impostor == impostor)
+            end++;
+        data.InstanceOffset = start;
+        context->UpdateCB(_cb, &data);
+        context->BindCB(0, _cb);
+        for (int32 i = 0; i < ARRAY_COUNT(impostor->Atlas); i++)
+            context->BindSR(i + 1, impostor->Atlas[i]);
+        context->DrawInstanced(6, end - start);
+        start = end;
+    }
+    context->ResetSR();
+}
+
+void ImpostorsPass::OnModelUnloaded(Asset* asset)
+{
+    ScopeLock lock(_locker);
+    Model* model = (Model*)asset;
+    model->OnUnloaded.Unbind<ImpostorsPass, &ImpostorsPass::OnModelUnloaded>(this);
+    ModelImpostor* impostor;
+    if (_impostors.TryGet(model, impostor))
+    {
+        for (GPUTexture*& atlas : impostor->Atlas)
+            SAFE_DELETE_GPU_RESOURCE(atlas);
+        Delete(impostor);
+        _impostors.Remove(model);
+    }
+    _bakeQueue.Remove(model);
+}
+
+String ImpostorsPass::ToString() const
+{
+    return TEXT("ImpostorsPass");
+}
+
+bool ImpostorsPass::Init()
+{
+    // Create pipeline states
+    _psGBuffer = GPUDevice::Instance->CreatePipelineState();
+    _psDepth = GPUDevice::Instance->CreatePipelineState();
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/Impostor"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<ImpostorsPass, &ImpostorsPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool ImpostorsPass::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Create pipeline states
+    auto psDesc = GPUPipelineState::Description::Default;
+    psDesc.VS = shader->GetVS("VS");
+    psDesc.CullMode = CullMode::TwoSided;
+    if (!_psGBuffer->IsValid())
+    {
+        psDesc.PS = shader->GetPS("PS_GBuffer");
+        if (_psGBuffer->Init(psDesc))
+            return true;
+    }
+    if (!_psDepth->IsValid())
+    {
+        psDesc.PS = shader->GetPS("PS_Depth");
+        if (_psDepth->Init(psDesc))
+            return true;
+    }
+
+    return false;
+}
+
+void ImpostorsPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    for (auto& e : _impostors)
+    {
+        e.Key->OnUnloaded.Unbind<ImpostorsPass, &ImpostorsPass::OnModelUnloaded>(this);
+        for (GPUTexture*& atlas : e.Value->Atlas)
+            SAFE_DELETE_GPU_RESOURCE(atlas);
+        Delete(e.Value);
+    }
+    _impostors.Clear();
+    _bakeQueue.Clear();
+    _instances.Dispose();
+    SAFE_DELETE_GPU_RESOURCE(_psGBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_psDepth);
+    _cb = nullptr;
+    _shader = nullptr;
+}
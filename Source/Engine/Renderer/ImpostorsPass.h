@@ -0,0 +1,94 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class Model;
+
+/// <summary>
+/// The model impostor (octahedral billboard) with the model surface baked into the atlas of frames captured from the directions around the model.
+/// </summary>
+struct ModelImpostor
+{
+    /// <summary>
+    /// The atlas textures with the GBuffer data of the model surface (color, normal with shading model and the material properties).
+    /// </summary>
+    GPUTexture* Atlas[3] = {};
+
+    /// <summary>
+    /// The model local-space bounds captured by the impostor frames.
+    /// </summary>
+    BoundingSphere Bounds;
+
+    /// <summary>
+    /// True if impostor has been baked and can be drawn.
+    /// </summary>
+    bool IsReady = false;
+};
+
+/// <summary>
+/// Impostors rendering service. Bakes the impostors atlases of the models on the GPU (on the first use, cached until model gets unloaded) and draws the billboards added to the render list as a single instanced quads batch per impostor.
+/// </summary>
+class ImpostorsPass : public RendererPass<ImpostorsPass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUPipelineState* _psGBuffer = nullptr;
+    GPUPipelineState* _psDepth = nullptr;
+    DynamicStructuredBuffer _instances;
+    CriticalSection _locker;
+    Dictionary<Model*, ModelImpostor*> _impostors;
+    Array<Model*> _bakeQueue;
+    uint64 _lastBakeFrame = 0;
+
+public:
+    ImpostorsPass();
+
+    /// <summary>
+    /// Gets the impostor of the model. Queues the impostor bake if it's used for the first time. Safe to call from the async drawing jobs.
+    /// </summary>
+    /// <param name="model">The model.</param>
+    /// <returns>The impostor or null if it's not ready yet (model meshes should be drawn instead).</returns>
+    const ModelImpostor* GetImpostor(Model* model);
+
+    /// <summary>
+    /// Bakes the queued impostors (limited amount per frame).
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    void Bake(GPUContext* context);
+
+    /// <summary>
+    /// Draws the impostors added to the render list. Uses the GBuffer or depth-only output depending on the view pass (render targets have to be already bound).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Draw(const RenderContext& renderContext, GPUContext* context);
+
+private:
+    bool BakeImpostor(GPUContext* context, Model* model, ModelImpostor* impostor);
+    void OnModelUnloaded(Asset* asset);
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _psGBuffer->ReleaseGPU();
+        _psDepth->ReleaseGPU();
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
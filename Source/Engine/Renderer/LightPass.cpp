@@ -3,6 +3,7 @@
 #include "LightPass.h"
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
+#include "Utils/LightClusters.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTools.h"
@@ -20,6 +21,7 @@ GPU_CB_STRUCT(PerLight {
 
 GPU_CB_STRUCT(PerFrame {
     ShaderGBufferData GBuffer;
+    Float4 LightClustersParams;
     });
 
 String LightPass::ToString() const
@@ -31,6 +33,7 @@ bool LightPass::Init()
 {
     // Create pipeline states
     _psLightDir.CreatePipelineStates();
+    _psLightClustered.CreatePipelineStates();
     _psLightPoint.CreatePipelineStates();
     _psLightPointInside.CreatePipelineStates();
     _psLightSpot.CreatePipelineStates();
@@ -88,6 +91,14 @@ bool LightPass::setupResources()
         if (_psLightDir.Create(psDesc, shader, "PS_Directional"))
             return true;
     }
+    if (!_psLightClustered.IsValid() && shader->HasShader("PS_Clustered"))
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.BlendMode = BlendingMode::Add;
+        psDesc.BlendMode.RenderTargetWriteMask = BlendingMode::ColorWrite::RGB;
+        if (_psLightClustered.Create(psDesc, shader, "PS_Clustered"))
+            return true;
+    }
     if (!_psLightPoint.IsValid())
     {
         psDesc = GPUPipelineState::Description::DefaultNoDepth;
@@ -145,6 +156,7 @@ void LightPass::Dispose()
 
     // Cleanup
     _psLightDir.Delete();
+    _psLightClustered.Delete();
     _psLightPoint.Delete();
     _psLightPointInside.Delete();
     _psLightSpot.Delete();
@@ -241,7 +253,9 @@ void LightPass::RenderLights(RenderContextBatch& renderContextBatch, GPUTextureV
     context->SetRenderTarget(depthBufferRTV, lightBuffer);
 
     // Set per frame data
+    const LightClustersData* clusters = _psLightClustered.IsValid() ? mainCache->LightClusters : nullptr;
     GBufferPass::SetInputs(renderContext.View, perFrame.GBuffer);
+    perFrame.LightClustersParams = clusters ? clusters->Params : Float4::Zero;
     auto cb0 = lightShader->GetCB(0);
     auto cb1 = lightShader->GetCB(1);
     context->UpdateCB(cb1, &perFrame);
@@ -263,11 +277,26 @@ void LightPass::RenderLights(RenderContextBatch& renderContextBatch, GPUTextureV
     } \
     auto shadowMaskView = shadowMask->View()
 
+    // Render all unshadowed local lights at once
+    if (clusters && clusters->Params.Z > 0.0f)
+    {
+        PROFILE_GPU_CPU_NAMED("Clustered Lights");
+        context->BindSR(8, clusters->Lights);
+        context->BindSR(9, clusters->Grid);
+        context->BindCB(1, cb1);
+        context->SetState(_psLightClustered.Get(disableSpecular));
+        context->DrawFullscreenTriangle();
+        context->UnBindSR(8);
+        context->UnBindSR(9);
+    }
+
     // Render all point lights
     for (int32 lightIndex = 0; lightIndex < mainCache->PointLights.Count(); lightIndex++)
     {
-        PROFILE_GPU_CPU_NAMED("Point Light");
         auto& light = mainCache->PointLights[lightIndex];
+        if (clusters && LightClusters::IsDeferredClustered(light))
+            continue; // Rendered with clustered lights
+        PROFILE_GPU_CPU_NAMED("Point Light");
         bool useIES = light.IESTexture != nullptr;
 
         // Calculate world view projection matrix for the light sphere
@@ -309,8 +338,10 @@ void LightPass::RenderLights(RenderContextBatch& renderContextBatch, GPUTextureV
     // Render all spot lights
     for (int32 lightIndex = 0; lightIndex < mainCache->SpotLights.Count(); lightIndex++)
     {
-        PROFILE_GPU_CPU_NAMED("Spot Light");
         auto& light = mainCache->SpotLights[lightIndex];
+        if (clusters && LightClusters::IsDeferredClustered(light))
+            continue; // Rendered with clustered lights
+        PROFILE_GPU_CPU_NAMED("Spot Light");
         bool useIES = light.IESTexture != nullptr;
 
         // Calculate world view projection matrix for the light sphere
@@ -16,6 +16,7 @@ class LightPass : public RendererPass<LightPass>
 private:
     AssetReference<Shader> _shader;
     GPUPipelineStatePermutationsPs<2> _psLightDir;
+    GPUPipelineStatePermutationsPs<2> _psLightClustered;
     GPUPipelineStatePermutationsPs<4> _psLightPoint;
     GPUPipelineStatePermutationsPs<4> _psLightPointInside;
     GPUPipelineStatePermutationsPs<4> _psLightSpot;
@@ -44,6 +45,7 @@ class LightPass : public RendererPass<LightPass>
     void OnShaderReloading(Asset* obj)
     {
         _psLightDir.Release();
+        _psLightClustered.Release();
         _psLightPoint.Release();
         _psLightPointInside.Release();
         _psLightSpot.Release();
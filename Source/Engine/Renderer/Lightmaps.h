@@ -32,6 +32,11 @@ struct SavedLightmapInfo
     /// Lightmap 2 texture ID
     /// </summary>
     Guid Lightmap2;
+
+    /// <summary>
+    /// Hash of the baking inputs (geometry, lights and settings) that affected this lightmap during the last bake. Zero if unknown.
+    /// </summary>
+    uint32 BakeHash;
 };
 
 /// <summary>
@@ -155,6 +160,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(LightmapSettings);
     API_FIELD(Attributes="EditorOrder(60), Limit(0, 100, 0.1f)")
     int32 Quality = 10;
 
+    /// <summary>
+    /// Enable/disable incremental baking that reuses the previously baked lightmaps when geometry and lights affecting them didn't change. Disable to force full rebuild.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(70)")
+    bool IncrementalBaking = true;
+
 public:
 
     // [ISerializable]
@@ -4,6 +4,7 @@
 #include "GBufferPass.h"
 #include "Renderer.h"
 #include "RenderList.h"
+#include "ShadingRatePass.h"
 #include "Engine/Core/Config/GraphicsSettings.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Content.h"
@@ -375,7 +376,10 @@ void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GP
     data.Input2SizeInv = Float2(1.0f / (float)renderContext.Buffers->DepthBuffer->Width(), 1.0f / (float)renderContext.Buffers->DepthBuffer->Height());
     context->UpdateCB(cb, &data);
     context->SetState(_psMotionBlur);
+    const bool useVRS = ShadingRatePass::Instance()->Begin(renderContext, context, VariableRateShadingPasses::MotionBlur, screenWidth, screenHeight);
     context->DrawFullscreenTriangle();
+    if (useVRS)
+        ShadingRatePass::Instance()->End(context);
 
     // Cleanup
     RenderTargetPool::Release(vMaxNeighborBuffer);
@@ -23,6 +23,7 @@
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Engine/Engine.h"
+#include "Utils/GPUWorkBudget.h"
 
 /// <summary>
 /// Custom task called after downloading probe texture data to save it.
@@ -91,6 +92,10 @@ namespace ProbesRendererImpl
     GPUTexture* _tmpFace = nullptr;
     GPUTexture* _skySHIrradianceMap = nullptr;
     uint64 _updateFrameNumber = 0;
+    int32 _workStep = 0;
+    float _customCullingNear = -1;
+    GPUWorkBudget _facesBudget;
+    GPUWorkBudget _filterBudget;
 
     FORCE_INLINE bool isUpdateSynced()
     {
@@ -116,6 +121,8 @@ ProbesRendererService ProbesRendererServiceInstance;
 
 TimeSpan ProbesRenderer::ProbesUpdatedBreak(0, 0, 0, 0, 500);
 TimeSpan ProbesRenderer::ProbesReleaseDataTime(0, 0, 0, 60);
+float ProbesRenderer::RealtimeUpdateBudget = 2.0f;
+int32 ProbesRenderer::CaptureLODBias = 0;
 Delegate<const ProbesRenderer::Entry&> ProbesRenderer::OnRegisterBake;
 Delegate<const ProbesRenderer::Entry&> ProbesRenderer::OnFinishBake;
 
@@ -309,6 +316,8 @@ void ProbesRenderer::Release()
     SAFE_DELETE_GPU_RESOURCE(_probe);
     SAFE_DELETE_GPU_RESOURCE(_tmpFace);
     SAFE_DELETE_GPU_RESOURCE(_skySHIrradianceMap);
+    _facesBudget.Release();
+    _filterBudget.Release();
 
     _isReady = false;
 }
@@ -352,17 +361,33 @@ void ProbesRendererService::Update()
     }
     else if (_current.Type == ProbesRenderer::EntryType::Invalid)
     {
+        // Pick the probe to update (baked probes go first in order, then real-time probes by the distance and visibility to the main view and the waiting time)
         int32 firstValidEntryIndex = -1;
+        float bestScore = MAX_float;
         auto dt = (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+        const RenderView* mainView = MainRenderTask::Instance ? &MainRenderTask::Instance->View : nullptr;
         for (int32 i = 0; i < _probesToBake.Count(); i++)
         {
             auto& e = _probesToBake[i];
             e.Timeout -= dt;
-            if (e.Timeout <= 0)
+            if (e.Timeout > 0)
+                continue;
+            if (e.UseTextureData() || !mainView || !e.Actor)
             {
                 firstValidEntryIndex = i;
                 break;
             }
+            const auto probe = e.Actor.As<EnvironmentProbe>();
+            const BoundingSphere sphere(probe->GetPosition() - mainView->Origin, probe->GetScaledRadius());
+            float score = Math::Max((float)Vector3::Distance(sphere.Center, mainView->Position) - (float)sphere.Radius, 0.0f);
+            if (!mainView->Frustum.Intersects(sphere))
+                score *= 4.0f;
+            score /= 1.0f - e.Timeout;
+            if (score < bestScore)
+            {
+                bestScore = score;
+                firstValidEntryIndex = i;
+            }
         }
 
         // Check if need to update probe
@@ -425,6 +450,7 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
             // Probe has been unlinked (or deleted)
             _task->Enabled = false;
             _updateFrameNumber = 0;
+            _workStep = 0;
             _current.Type = EntryType::Invalid;
             return;
         }
@@ -439,11 +465,15 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
     PROFILE_GPU("Render Probe");
 
     // Init
-    float customCullingNear = -1;
     const int32 probeResolution = _current.GetResolution();
     const PixelFormat probeFormat = _current.GetFormat();
-    if (_current.Type == EntryType::EnvProbe)
+    if (_workStep != 0)
     {
+        // Continue the update from the previous frame
+    }
+    else if (_current.Type == EntryType::EnvProbe)
+    {
+        _customCullingNear = -1;
         auto envProbe = (EnvironmentProbe*)_current.Actor.Get();
         Vector3 position = envProbe->GetPosition();
         float radius = envProbe->GetScaledRadius();
@@ -465,64 +495,91 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
         Vector3 position = skyLight->GetPosition();
         float nearPlane = 10.0f;
         float farPlane = Math::Max(nearPlane + 1000.0f, skyLight->SkyDistanceThreshold * 2.0f);
-        customCullingNear = skyLight->SkyDistanceThreshold;
+        _customCullingNear = skyLight->SkyDistanceThreshold;
 
         // Setup view
         LargeWorlds::UpdateOrigin(_task->View.Origin, position);
         _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
     }
+    _task->View.ModelLODBias = CaptureLODBias;
     _task->CameraCut();
 
     // Resize buffers
-    bool resizeFailed = _output->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _probe->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _tmpFace->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _task->Resize(probeResolution, probeResolution);
-    if (resizeFailed)
-        LOG(Error, "Failed to resize probe");
-
-    // Disable actor during baking (it cannot influence own results)
-    const bool isActorActive = _current.Actor->GetIsActive();
-    _current.Actor->SetIsActive(false);
-
-    // Render scene for all faces
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+    if (_workStep == 0)
     {
-        _task->View.SetFace(faceIndex);
+        bool resizeFailed = _output->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _probe->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _tmpFace->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _task->Resize(probeResolution, probeResolution);
+        if (resizeFailed)
+            LOG(Error, "Failed to resize probe");
+    }
 
-        // Handle custom frustum for the culling (used to skip objects near the camera)
-        if (customCullingNear > 0)
-        {
-            Matrix p;
-            Matrix::PerspectiveFov(PI_OVER_2, 1.0f, customCullingNear, _task->View.Far, p);
-            _task->View.CullingFrustum.SetMatrix(_task->View.View, p);
-        }
+    // Pick the update steps to perform within this frame (6 faces rendering and then filtering of each lower mip level)
+    const int32 mipLevels = _probe->MipLevels();
+    const int32 stepsCount = 6 + mipLevels - 1;
+    int32 stepsEnd = stepsCount;
+    if (!_current.UseTextureData() && RealtimeUpdateBudget > 0.0f)
+    {
+        if (_workStep < 6)
+            stepsEnd = 6 - Math::Max(6 - _workStep - _facesBudget.GetItemsLimit(RealtimeUpdateBudget), 0);
+        else
+            stepsEnd = stepsCount - Math::Max(stepsCount - _workStep - _filterBudget.GetItemsLimit(RealtimeUpdateBudget), 0);
+    }
+
+    // Render scene for the faces
+    const int32 facesEnd = Math::Min(stepsEnd, 6);
+    if (_workStep < facesEnd)
+    {
+        _facesBudget.Begin();
 
-        // Render frame
-        Renderer::Render(_task);
-        context->ClearState();
-        _task->CameraCut();
+        // Disable actor during baking (it cannot influence own results)
+        const bool isActorActive = _current.Actor->GetIsActive();
+        _current.Actor->SetIsActive(false);
 
-        // Copy frame to cube face
+        for (int32 faceIndex = _workStep; faceIndex < facesEnd; faceIndex++)
         {
-            PROFILE_GPU("Copy Face");
-            context->SetRenderTarget(_probe->View(faceIndex));
-            context->SetViewportAndScissors((float)probeResolution, (float)probeResolution);
-            context->Draw(_output->View());
-            context->ResetRenderTarget();
+            _task->View.SetFace(faceIndex);
+
+            // Handle custom frustum for the culling (used to skip objects near the camera)
+            if (_customCullingNear > 0)
+            {
+                Matrix p;
+                Matrix::PerspectiveFov(PI_OVER_2, 1.0f, _customCullingNear, _task->View.Far, p);
+                _task->View.CullingFrustum.SetMatrix(_task->View.View, p);
+            }
+
+            // Render frame
+            Renderer::Render(_task);
+            context->ClearState();
+            _task->CameraCut();
+
+            // Copy frame to cube face
+            {
+                PROFILE_GPU("Copy Face");
+                context->SetRenderTarget(_probe->View(faceIndex));
+                context->SetViewportAndScissors((float)probeResolution, (float)probeResolution);
+                context->Draw(_output->View());
+                context->ResetRenderTarget();
+            }
         }
-    }
 
-    // Enable actor back
-    _current.Actor->SetIsActive(isActorActive);
+        // Enable actor back
+        _current.Actor->SetIsActive(isActorActive);
+
+        _facesBudget.End(facesEnd - _workStep);
+    }
 
-    // Filter all lower mip levels
+    // Filter lower mip levels
+    const int32 mipsStart = Math::Max(_workStep, 6) - 5;
+    const int32 mipsEnd = stepsEnd - 5;
+    if (mipsStart < mipsEnd)
     {
         PROFILE_GPU("Filtering");
+        _filterBudget.Begin();
         Data data;
-        int32 mipLevels = _probe->MipLevels();
         auto cb = shader->GetCB(0);
-        for (int32 mipIndex = 1; mipIndex < mipLevels; mipIndex++)
+        for (int32 mipIndex = mipsStart; mipIndex < mipsEnd; mipIndex++)
         {
             const int32 mipSize = 1 << (mipLevels - mipIndex - 1);
             data.SourceMipIndex = (float)mipIndex - 1.0f;
@@ -548,11 +605,18 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
                 context->Draw(_tmpFace->View(0, mipIndex));
             }
         }
+        _filterBudget.End(mipsEnd - mipsStart);
     }
 
     // Cleanup
     context->ClearState();
 
+    // Continue the update in the next frame
+    _workStep = stepsEnd;
+    if (_workStep < stepsCount)
+        return;
+    _workStep = 0;
+
     // Mark as rendered
     _updateFrameNumber = Engine::FrameCount;
     _task->Enabled = false;
@@ -48,6 +48,16 @@ class ProbesRenderer
     /// </summary>
     static TimeSpan ProbesReleaseDataTime;
 
+    /// <summary>
+    /// GPU time budget (in milliseconds) per frame for the real-time probes updates. Probe update gets split into steps (cube face rendering or mip level filtering) spread over frames to fit the budget and prevent GPU spikes. Use 0 to update the whole probe within a single frame.
+    /// </summary>
+    static float RealtimeUpdateBudget;
+
+    /// <summary>
+    /// The model LOD bias applied to the scene rendering of the probes captures. Can be used to improve probes rendering performance.
+    /// </summary>
+    static int32 CaptureLODBias;
+
     int32 GetBakeQueueSize();
 
     static Delegate<const Entry&> OnRegisterBake;
@@ -2,10 +2,14 @@
 
 #include "RenderList.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Memory/EngineHeap.h"
+#include "Engine/Core/Memory/FrameAllocation.h"
 #include "Engine/Graphics/Materials/IMaterial.h"
 #include "Engine/Graphics/Materials/MaterialShader.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDeferredContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPULimits.h"
 #include "Engine/Graphics/RenderTargetPool.h"
@@ -17,6 +21,19 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Level/Actors/PostFxVolume.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Utils/InstanceCulling.h"
+#include "Utils/ObjectTable.h"
+#include "Utils/OcclusionCulling.h"
+
+// Minimum amount of instances in the pre-batched draw call to use GPU culling for it
+#define GPU_INSTANCE_CULLING_MIN_INSTANCES 64
+
+// Minimum amount of batches in the draw calls list to record it on multiple threads
+#define PARALLEL_RECORDING_MIN_BATCHES 256
+
+// Amount of batches recorded by a single job
+#define PARALLEL_RECORDING_JOB_BATCHES 128
 
 static_assert(sizeof(DrawCall) <= 288, "Too big draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Terrain), "Wrong draw call data size.");
@@ -29,6 +46,10 @@ namespace
     Array<RenderList*> FreeRenderList;
     Array<Pair<void*, uintptr>> MemPool;
     CriticalSection MemPoolLocker;
+    Array<GPUDeferredContext*> DeferredContexts;
+
+    // Materials share the constants data and the pipeline states cache between all instances so binding the same shader from multiple threads has to be synchronized
+    CriticalSection MaterialBindLocks[64];
 }
 
 void ShaderObjectData::Store(const Matrix& worldMatrix, const Matrix& prevWorldMatrix, const Rectangle& lightmapUVsArea, const Float3& geometrySize, float perInstanceRandom, float worldDeterminantSign, float lodDitherFactor)
@@ -181,7 +202,7 @@ void* RendererAllocation::Allocate(uintptr size)
     }
     MemPoolLocker.Unlock();
     if (!result)
-        result = Platform::Allocate(size, 16);
+        result = EngineHeapAllocation::Allocate(size);
     return result;
 }
 
@@ -227,9 +248,10 @@ void RenderList::CleanupCache()
     MemPoolLocker.Lock();
     FreeRenderList.ClearDelete();
     for (auto& e : MemPool)
-        Platform::Free(e.First);
+        EngineHeapAllocation::Free(e.First, e.Second);
     MemPool.Clear();
     MemPoolLocker.Unlock();
+    DeferredContexts.ClearDelete();
 }
 
 bool RenderList::BlendableSettings::operator<(const BlendableSettings& other) const
@@ -448,6 +470,13 @@ RenderList::RenderList(const SpawnParams& params)
 {
 }
 
+RenderList::~RenderList()
+{
+    SAFE_DELETE_GPU_RESOURCE(_culledInstanceBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_culledArgsBuffer);
+    SAFE_DELETE(_objectTable);
+}
+
 void RenderList::Init(RenderContext& renderContext)
 {
     renderContext.View.Frustum.GetCorners(FrustumCornersWs);
@@ -463,6 +492,8 @@ void RenderList::Clear()
     for (auto& list : DrawCallsLists)
         list.Clear();
     ShadowDepthDrawCallsList.Clear();
+    Impostors.Clear();
+    TerrainTiles.Clear();
     PointLights.Clear();
     SpotLights.Clear();
     SkyLights.Clear();
@@ -474,11 +505,15 @@ void RenderList::Clear()
     AtmosphericFog = nullptr;
     Fog = nullptr;
     PostFx.Clear();
+    Setup = RenderSetup();
     Settings = PostProcessSettings();
+    Occlusion = nullptr;
+    LightClusters = nullptr;
     Blendable.Clear();
     _instanceBuffer.Clear();
     ObjectBuffer.Clear();
     TempObjectBuffer.Clear();
+    _useObjectTable = false;
 }
 
 struct PackedSortKey
@@ -576,7 +611,7 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
     // Add draw call to proper draw lists
     DrawPass modes = drawModes & mainRenderContext.View.GetShadowsDrawPassMask(shadowsMode);
     drawModes = modes & mainRenderContext.View.Pass;
-    if (drawModes != DrawPass::None && mainRenderContext.View.CullingFrustum.Intersects(bounds))
+    if (drawModes != DrawPass::None && mainRenderContext.View.CullingFrustum.Intersects(bounds) && !(Occlusion && Occlusion->IsOccluded(bounds)))
     {
         if ((drawModes & DrawPass::Depth) != DrawPass::None)
         {
@@ -618,6 +653,15 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
 
 void RenderList::BuildObjectsBuffer()
 {
+    _useObjectTable = Setup.UsePersistentObjectsBuffer;
+    if (_useObjectTable)
+    {
+        // Update persistent objects table that uploads only the changed objects
+        if (!_objectTable)
+            _objectTable = New<ObjectTable>();
+        _objectTable->Build(DrawCalls, BatchedDrawCalls);
+        return;
+    }
     int32 count = DrawCalls.Count();
     for (const auto& e : BatchedDrawCalls)
         count += e.Instances.Count();
@@ -644,6 +688,19 @@ void RenderList::BuildObjectsBuffer()
     ZoneValue(ObjectBuffer.Data.Count() / 1024); // Objects Buffer size in kB
 }
 
+void RenderList::FlushObjectsBuffer(GPUContext* context)
+{
+    if (_useObjectTable)
+        _objectTable->Flush(context);
+    else
+        ObjectBuffer.Flush(context);
+}
+
+GPUBuffer* RenderList::GetObjectsBuffer() const
+{
+    return _useObjectTable ? _objectTable->GetBuffer() : ObjectBuffer.GetBuffer();
+}
+
 void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseDistance, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, DrawPass pass, bool stable)
 {
     PROFILE_CPU();
@@ -652,9 +709,9 @@ void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseD
     const int32 listSize = list.Indices.Count();
     ZoneValue(listSize);
 
-    // Use shared memory from renderer allocator
-    Array<uint64, RendererAllocation> SortingKeys[2];
-    Array<int32, RendererAllocation> SortingIndices;
+    // Use per-thread frame memory (sorting runs in parallel on job threads)
+    Array<uint64, FrameAllocation> SortingKeys[2];
+    Array<int32, FrameAllocation> SortingIndices;
     SortingKeys[0].Resize(listSize);
     SortingKeys[1].Resize(listSize);
     SortingIndices.Resize(listSize);
@@ -684,7 +741,7 @@ void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseD
 
     // Sort draw calls indices
     int32* resultIndices = list.Indices.Get();
-    Sorting::RadixSort(sortedKeys, resultIndices, SortingKeys[1].Get(), SortingIndices.Get(), listSize);
+    Sorting::RadixSortParallel(sortedKeys, resultIndices, SortingKeys[1].Get(), SortingIndices.Get(), listSize);
     if (resultIndices != list.Indices.Get())
         Platform::MemoryCopy(list.Indices.Get(), resultIndices, sizeof(int32) * listSize);
 
@@ -740,6 +797,17 @@ FORCE_INLINE bool CanUseInstancing(DrawPass pass)
     return pass == DrawPass::GBuffer || pass == DrawPass::Depth;
 }
 
+FORCE_INLINE uint32 GetObjectIndex(const uint32* objectIndices, int32 drawCallIndex)
+{
+    // Persistent objects table uses separate slots instead of draw call indices
+    return objectIndices ? objectIndices[drawCallIndex] : (uint32)drawCallIndex;
+}
+
+FORCE_INLINE bool CanUseGPUCulling(const BatchedDrawCall& batch)
+{
+    return batch.DrawCall.InstanceCount != 0 && (batch.Instances.Count() >= GPU_INSTANCE_CULLING_MIN_INSTANCES || batch.CullDistance > 0.0f);
+}
+
 FORCE_INLINE bool DrawsEqual(const DrawCall* a, const DrawCall* b)
 {
     return a->Geometry.IndexBuffer == b->Geometry.IndexBuffer &&
@@ -748,6 +816,171 @@ FORCE_INLINE bool DrawsEqual(const DrawCall* a, const DrawCall* b)
             Platform::MemoryCompare(a->Geometry.VertexBuffers, b->Geometry.VertexBuffers, sizeof(a->Geometry.VertexBuffers) + sizeof(a->Geometry.VertexBuffersOffsets)) == 0;
 }
 
+FORCE_INLINE void BindMaterial(IMaterial::BindParameters& bindParams, bool parallel)
+{
+    if (parallel)
+    {
+        const uintptr key = (uintptr)bindParams.DrawCall->Material->GetShader();
+        ScopeLock lock(MaterialBindLocks[(key >> 6) % ARRAY_COUNT(MaterialBindLocks)]);
+        bindParams.DrawCall->Material->Bind(bindParams);
+    }
+    else
+    {
+        bindParams.DrawCall->Material->Bind(bindParams);
+    }
+}
+
+static int32 DrawBatches(IMaterial::BindParameters& bindParams, const DrawCall* drawCallsData, const int32* listData, const uint32* objectIndices, const DrawBatch* batches, int32 batchesCount, GPUBuffer* instanceBuffer, int32 instanceBufferOffset, bool parallel)
+{
+    GPUContext* context = bindParams.GPUContext;
+    MaterialShaderDataPerDraw perDraw;
+    perDraw.DrawPadding = Float3::Zero;
+    GPUConstantBuffer* perDrawCB = IMaterial::BindParameters::PerDrawConstants;
+    constexpr int32 vbMax = ARRAY_COUNT(DrawCall::Geometry.VertexBuffers);
+    if (instanceBuffer)
+    {
+        GPUBuffer* vb[vbMax + 1];
+        uint32 vbOffsets[vbMax + 1];
+        vb[3] = instanceBuffer; // Pass object index in a vertex stream at slot 3 (used by VS in Surface.shader)
+        vbOffsets[3] = 0;
+        for (int32 i = 0; i < batchesCount; i++)
+        {
+            const DrawBatch& batch = batches[i];
+            uint32 drawCallIndex = listData[batch.StartIndex];
+            const DrawCall& drawCall = drawCallsData[drawCallIndex];
+
+            bindParams.Instanced = batch.BatchSize != 1;
+            bindParams.DrawCall = &drawCall;
+            BindMaterial(bindParams, parallel);
+
+            if (bindParams.Instanced)
+            {
+                // One or more draw calls per batch
+                const DrawCall* activeDraw = &drawCall;
+                int32 activeCount = 1;
+                for (int32 j = 1; j <= batch.BatchSize; j++)
+                {
+                    if (j != batch.BatchSize && DrawsEqual(activeDraw, drawCallsData + listData[batch.StartIndex + j]))
+                    {
+                        // Group two draw calls into active draw call
+                        activeCount++;
+                        continue;
+                    }
+
+                    // Draw whole active draw (instanced)
+                    Platform::MemoryCopy(vb, activeDraw->Geometry.VertexBuffers, sizeof(DrawCall::Geometry.VertexBuffers));
+                    Platform::MemoryCopy(vbOffsets, activeDraw->Geometry.VertexBuffersOffsets, sizeof(DrawCall::Geometry.VertexBuffersOffsets));
+                    context->BindIB(activeDraw->Geometry.IndexBuffer);
+                    context->BindVB(ToSpan(vb, ARRAY_COUNT(vb)), vbOffsets);
+                    context->DrawIndexedInstanced(activeDraw->Draw.IndicesCount, activeCount, instanceBufferOffset, 0, activeDraw->Draw.StartIndex);
+                    instanceBufferOffset += activeCount;
+
+                    // Reset active draw
+                    activeDraw = drawCallsData + listData[batch.StartIndex + j];
+                    activeCount = 1;
+                }
+            }
+            else
+            {
+                // Pass object index in constant buffer
+                perDraw.DrawObjectIndex = GetObjectIndex(objectIndices, drawCallIndex);
+                context->UpdateCB(perDrawCB, &perDraw);
+
+                // Single-draw call batch
+                context->BindIB(drawCall.Geometry.IndexBuffer);
+                context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, vbMax), drawCall.Geometry.VertexBuffersOffsets);
+                if (drawCall.InstanceCount == 0)
+                {
+                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
+                }
+                else
+                {
+                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (int32 i = 0; i < batchesCount; i++)
+        {
+            const DrawBatch& batch = batches[i];
+
+            bindParams.DrawCall = drawCallsData + listData[batch.StartIndex];
+            BindMaterial(bindParams, parallel);
+
+            for (int32 j = 0; j < batch.BatchSize; j++)
+            {
+                const int32 drawCallIndex = listData[batch.StartIndex + j];
+                perDraw.DrawObjectIndex = GetObjectIndex(objectIndices, drawCallIndex);
+                context->UpdateCB(perDrawCB, &perDraw);
+
+                const DrawCall& drawCall = drawCallsData[drawCallIndex];
+                context->BindIB(drawCall.Geometry.IndexBuffer);
+                context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, vbMax), drawCall.Geometry.VertexBuffersOffsets);
+
+                if (drawCall.InstanceCount == 0)
+                {
+                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
+                }
+                else
+                {
+                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, drawCall.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
+                }
+            }
+        }
+    }
+    return instanceBufferOffset;
+}
+
+static int32 DrawBatches(IMaterial::BindParameters& bindParams, const DrawCallsList& list, const DrawCall* drawCallsData, const uint32* objectIndices, GPUBuffer* instanceBuffer)
+{
+    const int32* listData = list.Indices.Get();
+    const DrawBatch* batchesData = list.Batches.Get();
+    const int32 batchesCount = list.Batches.Count();
+    if (!Graphics::ParallelCommandRecording || batchesCount < PARALLEL_RECORDING_MIN_BATCHES)
+        return DrawBatches(bindParams, drawCallsData, listData, objectIndices, batchesData, batchesCount, instanceBuffer, 0, false);
+    PROFILE_CPU_NAMED("Parallel Recording");
+
+    // Split batches into jobs (each one uses a separate range of the instance buffer)
+    const int32 jobsCount = Math::DivideAndRoundUp(batchesCount, PARALLEL_RECORDING_JOB_BATCHES);
+    Array<int32, RendererAllocation> jobsInstanceOffset;
+    jobsInstanceOffset.Resize(jobsCount);
+    int32 instancesCount = 0;
+    for (int32 i = 0; i < batchesCount; i++)
+    {
+        if (i % PARALLEL_RECORDING_JOB_BATCHES == 0)
+            jobsInstanceOffset[i / PARALLEL_RECORDING_JOB_BATCHES] = instancesCount;
+        if (batchesData[i].BatchSize > 1)
+            instancesCount += batchesData[i].BatchSize;
+    }
+    while (DeferredContexts.Count() < jobsCount)
+        DeferredContexts.Add(New<GPUDeferredContext>(GPUDevice::Instance));
+
+    // Record draw commands on job system threads
+    Function<void(int32)> func = [&](int32 jobIndex)
+    {
+        PROFILE_CPU_NAMED("Record Draw Calls");
+        GPUDeferredContext* context = DeferredContexts.Get()[jobIndex];
+        context->Reset();
+        IMaterial::BindParameters jobBindParams(context, bindParams.RenderContext);
+        jobBindParams.ObjectBuffer = bindParams.ObjectBuffer;
+        jobBindParams.Input = bindParams.Input;
+        jobBindParams.TimeParam = bindParams.TimeParam;
+        jobBindParams.BindViewData();
+        context->BindCB(2, IMaterial::BindParameters::PerDrawConstants);
+        const int32 start = jobIndex * PARALLEL_RECORDING_JOB_BATCHES;
+        const int32 count = Math::Min(PARALLEL_RECORDING_JOB_BATCHES, batchesCount - start);
+        DrawBatches(jobBindParams, drawCallsData, listData, objectIndices, batchesData + start, count, instanceBuffer, jobsInstanceOffset[jobIndex], true);
+    };
+    JobSystem::Execute(func, jobsCount, JobPriority::High);
+
+    // Submit commands in the original order
+    for (int32 i = 0; i < jobsCount; i++)
+        DeferredContexts.Get()[i]->Execute(bindParams.GPUContext);
+    return instancesCount;
+}
+
 void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, RenderList* drawCallsList, GPUTextureView* input)
 {
     if (list.IsEmpty())
@@ -758,14 +991,16 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     const auto* batchesData = list.Batches.Get();
     const auto context = GPUDevice::Instance->GetMainContext();
     bool useInstancing = list.CanUseInstancing && CanUseInstancing(renderContext.View.Pass) && GPUDevice::Instance->Limits.HasInstancing;
+    const bool useGPUCulling = useInstancing && Graphics::GPUInstanceCulling && InstanceCulling::Instance()->CanCull();
     TaaJitterRemoveContext taaJitterRemove(renderContext.View);
 
     // Lazy-init objects buffer (if user didn't do it)
-    if (drawCallsList->ObjectBuffer.Data.IsEmpty())
+    if (!drawCallsList->_useObjectTable && drawCallsList->ObjectBuffer.Data.IsEmpty())
     {
         drawCallsList->BuildObjectsBuffer();
-        drawCallsList->ObjectBuffer.Flush(context);
+        drawCallsList->FlushObjectsBuffer(context);
     }
+    const uint32* objectIndices = drawCallsList->_useObjectTable ? drawCallsList->_objectTable->ObjectIndices.Get() : nullptr;
 
     // Clear SR slots to prevent any resources binding issues (leftovers from the previous passes)
     context->ResetSR();
@@ -781,10 +1016,69 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             if (batch.BatchSize > 1)
                 instancesCount += batch.BatchSize;
         }
+        int32 culledInstancesCount = 0, culledBatchesCount = 0;
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             const BatchedDrawCall& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
-            instancesCount += batch.Instances.Count();
+            if (useGPUCulling && CanUseGPUCulling(batch))
+            {
+                culledInstancesCount += batch.Instances.Count();
+                culledBatchesCount++;
+            }
+            else
+                instancesCount += batch.Instances.Count();
+        }
+        if (culledBatchesCount != 0)
+        {
+            PROFILE_CPU_NAMED("Setup GPU Culling");
+
+            // Prepare output buffers
+            if (!_culledInstanceBuffer)
+            {
+                _culledInstanceBuffer = GPUDevice::Instance->CreateBuffer(TEXT("CulledInstanceBuffer"));
+                _culledArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("CulledArgsBuffer"));
+            }
+            if (_culledInstanceBuffer->GetElementsCount() < (uint32)culledInstancesCount)
+            {
+                const int32 capacity = Math::RoundUpToPowerOf2(Math::Max(culledInstancesCount, 1024));
+                _culledInstanceBuffer->Init(GPUBufferDescription::Buffer(capacity * sizeof(ShaderObjectDrawInstanceData), GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(ShaderObjectDrawInstanceData)));
+            }
+            if (_culledArgsBuffer->GetSize() < culledBatchesCount * sizeof(GPUDrawIndexedIndirectArgs))
+            {
+                const int32 capacity = Math::RoundUpToPowerOf2(Math::Max(culledBatchesCount, 64));
+                _culledArgsBuffer->Init(GPUBufferDescription::Raw(capacity * sizeof(GPUDrawIndexedIndirectArgs), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess));
+            }
+
+            // Setup draws with no instances (culling shader adds the visible ones)
+            Array<GPUDrawIndexedIndirectArgs, RendererAllocation> args;
+            Array<InstanceCulling::Batch, RendererAllocation> batches;
+            args.Resize(culledBatchesCount);
+            batches.Resize(culledBatchesCount);
+            uint32 outputOffset = 0;
+            for (int32 i = 0, j = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+            {
+                const BatchedDrawCall& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+                if (!CanUseGPUCulling(batch))
+                    continue;
+                auto& arg = args[j];
+                arg.IndicesCount = batch.DrawCall.Draw.IndicesCount;
+                arg.InstanceCount = 0;
+                arg.StartIndex = batch.DrawCall.Draw.StartIndex;
+                arg.StartVertex = 0;
+                arg.StartInstance = outputOffset;
+                auto& culledBatch = batches[j];
+                culledBatch.ObjectsStartIndex = batch.ObjectsStartIndex;
+                culledBatch.InstancesCount = batch.Instances.Count();
+                culledBatch.OutputOffset = outputOffset;
+                culledBatch.ArgsOffset = j * sizeof(GPUDrawIndexedIndirectArgs);
+                culledBatch.CullDistance = batch.CullDistance;
+                culledBatch.CullDistanceRandomRange = batch.CullDistanceRandomRange;
+                outputOffset += batch.Instances.Count();
+                j++;
+            }
+            context->UpdateBuffer(_culledArgsBuffer, args.Get(), args.Count() * sizeof(GPUDrawIndexedIndirectArgs));
+            const RenderView* lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+            InstanceCulling::Instance()->Cull(context, renderContext.View, lodView->Position, drawCallsList->GetObjectsBuffer(), _culledArgsBuffer, _culledInstanceBuffer, ToSpan(batches));
         }
         if (instancesCount != 0)
         {
@@ -793,7 +1087,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             _instanceBuffer.Data.Resize(instancesCount * sizeof(ShaderObjectDrawInstanceData));
             auto instanceData = (ShaderObjectDrawInstanceData*)_instanceBuffer.Data.Get();
 
-            // Write to instance buffer
+            // Write to instance buffer (except GPU culled draws)
             for (int32 i = 0; i < list.Batches.Count(); i++)
             {
                 const DrawBatch& batch = batchesData[i];
@@ -801,7 +1095,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 {
                     for (int32 j = 0; j < batch.BatchSize; j++)
                     {
-                        instanceData->ObjectIndex = listData[batch.StartIndex + j];
+                        instanceData->ObjectIndex = GetObjectIndex(objectIndices, listData[batch.StartIndex + j]);
                         instanceData++;
                     }
                 }
@@ -809,6 +1103,8 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
             {
                 const BatchedDrawCall& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+                if (useGPUCulling && CanUseGPUCulling(batch))
+                    continue;
                 for (int32 j = 0; j < batch.Instances.Count(); j++)
                 {
                     instanceData->ObjectIndex = batch.ObjectsStartIndex + j;
@@ -821,7 +1117,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             _instanceBuffer.Flush(context);
             ZoneValue(instancesCount);
         }
-        else
+        else if (culledBatchesCount == 0)
         {
             // No batches so no instancing
             useInstancing = false;
@@ -831,7 +1127,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     // Execute draw calls
     int32 materialBinds = list.Batches.Count();
     MaterialBase::BindParameters bindParams(context, renderContext);
-    bindParams.ObjectBuffer = drawCallsList->ObjectBuffer.GetBuffer()->View();
+    bindParams.ObjectBuffer = drawCallsList->GetObjectsBuffer()->View();
     bindParams.Input = input;
     bindParams.BindViewData();
     MaterialShaderDataPerDraw perDraw;
@@ -845,63 +1141,8 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
         uint32 vbOffsets[vbMax + 1];
         vb[3] = _instanceBuffer.GetBuffer(); // Pass object index in a vertex stream at slot 3 (used by VS in Surface.shader)
         vbOffsets[3] = 0;
-        int32 instanceBufferOffset = 0;
-        for (int32 i = 0; i < list.Batches.Count(); i++)
-        {
-            const DrawBatch& batch = batchesData[i];
-            uint32 drawCallIndex = listData[batch.StartIndex];
-            const DrawCall& drawCall = drawCallsData[drawCallIndex];
-
-            bindParams.Instanced = batch.BatchSize != 1;
-            bindParams.DrawCall = &drawCall;
-            bindParams.DrawCall->Material->Bind(bindParams);
-
-            if (bindParams.Instanced)
-            {
-                // One or more draw calls per batch
-                const DrawCall* activeDraw = &drawCall;
-                int32 activeCount = 1;
-                for (int32 j = 1; j <= batch.BatchSize; j++)
-                {
-                    if (j != batch.BatchSize && DrawsEqual(activeDraw, drawCallsData + listData[batch.StartIndex + j]))
-                    {
-                        // Group two draw calls into active draw call
-                        activeCount++;
-                        continue;
-                    }
-
-                    // Draw whole active draw (instanced)
-                    Platform::MemoryCopy(vb, activeDraw->Geometry.VertexBuffers, sizeof(DrawCall::Geometry.VertexBuffers));
-                    Platform::MemoryCopy(vbOffsets, activeDraw->Geometry.VertexBuffersOffsets, sizeof(DrawCall::Geometry.VertexBuffersOffsets));
-                    context->BindIB(activeDraw->Geometry.IndexBuffer);
-                    context->BindVB(ToSpan(vb, ARRAY_COUNT(vb)), vbOffsets);
-                    context->DrawIndexedInstanced(activeDraw->Draw.IndicesCount, activeCount, instanceBufferOffset, 0, activeDraw->Draw.StartIndex);
-                    instanceBufferOffset += activeCount;
-
-                    // Reset active draw
-                    activeDraw = drawCallsData + listData[batch.StartIndex + j];
-                    activeCount = 1;
-                }
-            }
-            else
-            {
-                // Pass object index in constant buffer
-                perDraw.DrawObjectIndex = drawCallIndex;
-                context->UpdateCB(perDrawCB, &perDraw);
-
-                // Single-draw call batch
-                context->BindIB(drawCall.Geometry.IndexBuffer);
-                context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, vbMax), drawCall.Geometry.VertexBuffersOffsets);
-                if (drawCall.InstanceCount == 0)
-                {
-                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
-                }
-                else
-                {
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
-                }
-            }
-        }
+        uint32 culledArgsOffset = 0;
+        int32 instanceBufferOffset = DrawBatches(bindParams, list, drawCallsData, objectIndices, _instanceBuffer.GetBuffer());
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             const BatchedDrawCall& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
@@ -913,10 +1154,17 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
 
             Platform::MemoryCopy(vb, drawCall.Geometry.VertexBuffers, sizeof(DrawCall::Geometry.VertexBuffers));
             Platform::MemoryCopy(vbOffsets, drawCall.Geometry.VertexBuffersOffsets, sizeof(DrawCall::Geometry.VertexBuffersOffsets));
+            const bool isGPUCulled = useGPUCulling && CanUseGPUCulling(batch);
+            vb[3] = isGPUCulled ? _culledInstanceBuffer : _instanceBuffer.GetBuffer();
             context->BindIB(drawCall.Geometry.IndexBuffer);
             context->BindVB(ToSpan(vb, vbMax + 1), vbOffsets);
 
-            if (drawCall.InstanceCount == 0)
+            if (isGPUCulled)
+            {
+                context->DrawIndexedInstancedIndirect(_culledArgsBuffer, culledArgsOffset);
+                culledArgsOffset += sizeof(GPUDrawIndexedIndirectArgs);
+            }
+            else if (drawCall.InstanceCount == 0)
             {
                 context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
             }
@@ -930,32 +1178,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     }
     else
     {
-        for (int32 i = 0; i < list.Batches.Count(); i++)
-        {
-            const DrawBatch& batch = batchesData[i];
-
-            bindParams.DrawCall = drawCallsData + listData[batch.StartIndex];
-            bindParams.DrawCall->Material->Bind(bindParams);
-
-            for (int32 j = 0; j < batch.BatchSize; j++)
-            {
-                perDraw.DrawObjectIndex = listData[batch.StartIndex + j];
-                context->UpdateCB(perDrawCB, &perDraw);
-
-                const DrawCall& drawCall = drawCallsData[perDraw.DrawObjectIndex];
-                context->BindIB(drawCall.Geometry.IndexBuffer);
-                context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, vbMax), drawCall.Geometry.VertexBuffersOffsets);
-
-                if (drawCall.InstanceCount == 0)
-                {
-                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
-                }
-                else
-                {
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, drawCall.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
-                }
-            }
-        }
+        DrawBatches(bindParams, list, drawCallsData, objectIndices, nullptr);
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             const BatchedDrawCall& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
@@ -981,10 +1204,11 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             // Draw calls list has bot been batched so execute draw calls separately
             for (int32 j = 0; j < list.Indices.Count(); j++)
             {
-                perDraw.DrawObjectIndex = listData[j];
+                const int32 drawCallIndex = listData[j];
+                perDraw.DrawObjectIndex = GetObjectIndex(objectIndices, drawCallIndex);
                 context->UpdateCB(perDrawCB, &perDraw);
 
-                const DrawCall& drawCall = drawCallsData[perDraw.DrawObjectIndex];
+                const DrawCall& drawCall = drawCallsData[drawCallIndex];
                 bindParams.DrawCall = &drawCall;
                 drawCall.Material->Bind(bindParams);
 
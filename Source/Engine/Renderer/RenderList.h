@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Math/Half.h"
+#include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Graphics/PostProcessSettings.h"
 #include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Scripting/ScriptingObject.h"
@@ -21,6 +22,11 @@ class IPostFxSettingsProvider;
 class CubeTexture;
 struct RenderContext;
 struct RenderContextBatch;
+struct OcclusionBuffer;
+struct LightClustersData;
+struct ModelImpostor;
+class GPUBuffer;
+class ObjectTable;
 
 struct RenderLightData
 {
@@ -240,9 +246,47 @@ struct BatchedDrawCall
 {
     DrawCall DrawCall;
     uint16 ObjectsStartIndex = 0; // Index of the instances start in the ObjectsBuffer (set internally).
+    float CullDistance = 0.0f; // The maximum distance of the instances to draw. If non-zero, the batch instances are always culled on GPU (see GPUInstanceCulling).
+    float CullDistanceRandomRange = 0.0f; // The per-instance cull distance randomization range (scaled by the instance random value).
     Array<struct ShaderObjectData, RendererAllocation> Instances;
 };
 
+/// <summary>
+/// Represents a single impostor billboard to draw (see ImpostorsPass).
+/// </summary>
+struct ImpostorDrawCall
+{
+    const ModelImpostor* Impostor;
+    Float3 Position; // The world-space position of the impostor bounds center (relative to the view origin).
+    float Radius; // The world-space radius of the impostor bounds.
+    Quaternion Orientation;
+
+    bool operator<(const ImpostorDrawCall& other) const
+    {
+        return (uintptr)Impostor < (uintptr)other.Impostor;
+    }
+};
+
+/// <summary>
+/// Represents a single terrain chunk to draw using the pre-blended material from the virtual texture cache (see TerrainVirtualTexturePass).
+/// </summary>
+struct TerrainTileDrawCall
+{
+    GPUBuffer* IndexBuffer;
+    GPUBuffer* VertexBuffer;
+    int32 IndicesCount;
+    int32 Tile; // The index of the tile in the virtual texture cache.
+    GPUTexture* Heightmap;
+    Matrix World;
+    Float4 HeightmapUVScaleBias;
+    Float4 NeighborLOD;
+    float CurrentLOD;
+    float ChunkSizeNextLOD;
+    float TerrainChunkSizeLOD0;
+    Float2 LODMorph;
+    Float3 LODViewPosition;
+};
+
 /// <summary>
 /// Represents a list of draw calls.
 /// </summary>
@@ -322,6 +366,16 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     DrawCallsList ShadowDepthDrawCallsList;
 
+    /// <summary>
+    /// The impostor billboards to draw (grouped into instanced batches by ImpostorsPass).
+    /// </summary>
+    RenderListBuffer<ImpostorDrawCall> Impostors;
+
+    /// <summary>
+    /// The terrain chunks to draw in GBuffer pass using the virtual texture cache (see TerrainVirtualTexturePass).
+    /// </summary>
+    RenderListBuffer<TerrainTileDrawCall> TerrainTiles;
+
     /// <summary>
     /// Light pass members - directional lights
     /// </summary>
@@ -382,6 +436,16 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     RenderSetup Setup;
 
+    /// <summary>
+    /// The occlusion culling depth from the previous frames to test the main view draw calls bounds against (see OcclusionCulling). Null if not used.
+    /// </summary>
+    const OcclusionBuffer* Occlusion = nullptr;
+
+    /// <summary>
+    /// The clustered local lights of the view (see LightClusters). Null if not used.
+    /// </summary>
+    const LightClustersData* LightClusters = nullptr;
+
     /// <summary>
     /// The post process settings.
     /// </summary>
@@ -426,8 +490,14 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
 
 private:
     DynamicVertexBuffer _instanceBuffer;
+    GPUBuffer* _culledInstanceBuffer = nullptr;
+    GPUBuffer* _culledArgsBuffer = nullptr;
+    ObjectTable* _objectTable = nullptr;
+    bool _useObjectTable = false;
 
 public:
+    ~RenderList();
+
     /// <summary>
     /// Blends the postprocessing settings into the final options.
     /// </summary>
@@ -533,6 +603,17 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     void BuildObjectsBuffer();
 
+    /// <summary>
+    /// Uploads the objects buffer data to the GPU (after BuildObjectsBuffer).
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    void FlushObjectsBuffer(GPUContext* context);
+
+    /// <summary>
+    /// Gets the GPU buffer with objects data (ShaderObjectData) for the draw calls (valid after FlushObjectsBuffer).
+    /// </summary>
+    GPUBuffer* GetObjectsBuffer() const;
+
     /// <summary>
     /// Sorts the collected draw calls list.
     /// </summary>
@@ -14,4 +14,6 @@ struct FLAXENGINE_API RenderSetup
     bool UseTemporalAAJitter = false;
     bool UseGlobalSDF = false;
     bool UseGlobalSurfaceAtlas = false;
+    bool UseOcclusionCulling = false;
+    bool UsePersistentObjectsBuffer = false;
 };
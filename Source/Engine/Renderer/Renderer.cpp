@@ -2,13 +2,16 @@
 
 #include "Renderer.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/PostProcessEffect.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "GBufferPass.h"
 #include "ForwardPass.h"
+#include "ShadingRatePass.h"
 #include "ShadowsPass.h"
 #include "LightPass.h"
 #include "ReflectionsPass.h"
@@ -28,6 +31,14 @@
 #include "GI/DynamicDiffuseGlobalIllumination.h"
 #include "Utils/MultiScaler.h"
 #include "Utils/BitonicSort.h"
+#include "Utils/InstanceCulling.h"
+#include "Utils/ObjectTable.h"
+#include "Utils/OcclusionCulling.h"
+#include "TextureFeedbackPass.h"
+#include "ImpostorsPass.h"
+#include "TerrainVirtualTexturePass.h"
+#include "ComputeSkinningPass.h"
+#include "Utils/LightClusters.h"
 #include "AntiAliasing/FXAA.h"
 #include "AntiAliasing/TAA.h"
 #include "AntiAliasing/SMAA.h"
@@ -73,6 +84,7 @@ bool RendererService::Init()
     PassList.Add(ShadowsPass::Instance());
     PassList.Add(LightPass::Instance());
     PassList.Add(ForwardPass::Instance());
+    PassList.Add(ShadingRatePass::Instance());
     PassList.Add(ReflectionsPass::Instance());
     PassList.Add(ScreenSpaceReflectionsPass::Instance());
     PassList.Add(AmbientOcclusionPass::Instance());
@@ -84,6 +96,14 @@ bool RendererService::Init()
     PassList.Add(MotionBlurPass::Instance());
     PassList.Add(MultiScaler::Instance());
     PassList.Add(BitonicSort::Instance());
+    PassList.Add(InstanceCulling::Instance());
+    PassList.Add(ObjectTablePass::Instance());
+    PassList.Add(OcclusionCulling::Instance());
+    PassList.Add(TextureFeedbackPass::Instance());
+    PassList.Add(ImpostorsPass::Instance());
+    PassList.Add(TerrainVirtualTexturePass::Instance());
+    PassList.Add(ComputeSkinningPass::Instance());
+    PassList.Add(LightClusters::Instance());
     PassList.Add(FXAA::Instance());
     PassList.Add(TAA::Instance());
     PassList.Add(SMAA::Instance());
@@ -193,6 +213,7 @@ bool Renderer::IsReady()
 void Renderer::Render(SceneRenderTask* task)
 {
     PROFILE_GPU_CPU_NAMED("Render Frame");
+    PROFILE_MEM(Renderer);
 
     // Prepare GPU context
     auto context = GPUDevice::Instance->GetMainContext();
@@ -370,6 +391,7 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         setup.UseGlobalSDF = (graphicsSettings->EnableGlobalSDF && EnumHasAnyFlags(view.Flags, ViewFlags::GlobalSDF)) ||
                 renderContext.View.Mode == ViewMode::GlobalSDF ||
                 setup.UseGlobalSurfaceAtlas;
+        setup.UsePersistentObjectsBuffer = Graphics::PersistentObjectsBuffer && !renderContext.View.IsSingleFrame;
 
         // Disable TAA jitter in debug modes
         switch (renderContext.View.Mode)
@@ -403,6 +425,8 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
             e->PreRender(context, renderContext);
     }
     renderContext.View.Prepare(renderContext);
+    OcclusionCulling::Instance()->Prepare(renderContext);
+    ImpostorsPass::Instance()->Bake(context);
 
     // Build batch of render contexts (main view and shadow projections)
     {
@@ -452,6 +476,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
 #endif
     }
 
+    // Bake terrain tiles requested by the chunks drawn in this frame
+    TerrainVirtualTexturePass::Instance()->Bake(context);
+
     // Process draw calls (sorting, objects buffer building)
     {
         PROFILE_CPU_NAMED("Process Draw Calls");
@@ -500,16 +527,16 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         // Dispatch async jobs
         Function<void(int32)> func;
         func.Bind<DrawCallsProcessor, &DrawCallsProcessor::BuildObjectsBufferJob>(&processor);
-        const int64 buildObjectsBufferJob = JobSystem::Dispatch(func, renderContextBatch.Contexts.Count());
+        const int64 buildObjectsBufferJob = JobSystem::Dispatch(func, renderContextBatch.Contexts.Count(), JobPriority::High);
         func.Bind<DrawCallsProcessor, &DrawCallsProcessor::SortDrawCallsJob>(&processor);
-        const int64 sortDrawCallsJob = JobSystem::Dispatch(func, ARRAY_COUNT(DrawCallsProcessor::MainContextSorting) + renderContextBatch.Contexts.Count());
+        const int64 sortDrawCallsJob = JobSystem::Dispatch(func, ARRAY_COUNT(DrawCallsProcessor::MainContextSorting) + renderContextBatch.Contexts.Count(), JobPriority::High);
 
         // Upload objects buffers to the GPU
         JobSystem::Wait(buildObjectsBufferJob);
         {
             PROFILE_CPU_NAMED("FlushObjectsBuffer");
             for (auto& e : renderContextBatch.Contexts)
-                e.List->ObjectBuffer.Flush(context);
+                e.List->FlushObjectsBuffer(context);
         }
 
         // Wait for async jobs to finish
@@ -539,16 +566,21 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     }
 #endif
 
-    // Global SDF rendering (can be used by materials later on)
+    // Global SDF rendering (can be used by materials later on, runs on async compute in parallel to the GBuffer and shadows)
     if (setup.UseGlobalSDF)
     {
-        GlobalSignDistanceFieldPass::BindingData bindingData;
-        GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingData);
+        GlobalSignDistanceFieldPass::Instance()->RenderAsync(renderContext, context);
     }
 
     // Fill GBuffer
     GBufferPass::Instance()->Fill(renderContext, lightBuffer);
 
+    // Build Hi-Z for the occlusion culling in the next frames
+    OcclusionCulling::Instance()->Render(renderContext, context);
+
+    // Render the textures streaming feedback for the next frames
+    TextureFeedbackPass::Instance()->Render(renderContext, context);
+
     // Debug drawing
     if (renderContext.View.Mode == ViewMode::GlobalSDF)
         GlobalSignDistanceFieldPass::Instance()->RenderDebug(renderContext, context, lightBuffer);
@@ -594,7 +626,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
 
     // Render lighting
     renderContextBatch.GetMainContext() = renderContext; // Sync render context in batch with the current value
+    LightClusters::Instance()->Build(renderContext, context);
     ShadowsPass::Instance()->RenderShadowMaps(renderContextBatch);
+    GlobalSignDistanceFieldPass::Instance()->WaitForAsyncCompute(renderContext.Buffers, true);
     LightPass::Instance()->RenderLights(renderContextBatch, *lightBuffer);
     if (EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::GI))
     {
@@ -645,6 +679,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     // Material and Custom PostFx
     renderContext.List->RunPostFxPass(context, renderContext, MaterialPostFxLocation::BeforeForwardPass, PostProcessEffectLocation::BeforeForwardPass, lightBuffer);
 
+    // Generate shading rate image for the variable rate shading in the next passes
+    ShadingRatePass::Instance()->Render(renderContext, context, lightBuffer);
+
     // Render fog
     context->ResetSR();
     if (renderContext.List->AtmosphericFog)
@@ -658,7 +695,10 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         VolumetricFogPass::Instance()->Render(renderContext);
 
         PROFILE_GPU_CPU("Fog");
+        const bool useVRS = ShadingRatePass::Instance()->Begin(renderContext, context, VariableRateShadingPasses::Fog, lightBuffer->Width(), lightBuffer->Height());
         renderContext.List->Fog->DrawFog(context, renderContext, *lightBuffer);
+        if (useVRS)
+            ShadingRatePass::Instance()->End(context);
         context->ResetSR();
     }
 
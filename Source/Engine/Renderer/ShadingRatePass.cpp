@@ -0,0 +1,167 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ShadingRatePass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+
+// Relative luminance contrast within a tile below which the coarser shading is used
+#define SHADING_RATE_CONTRAST_THRESHOLD 0.1f
+
+// Motion (in pixels per frame) within a tile above which the coarser shading is used
+#define SHADING_RATE_MOTION_THRESHOLD 8.0f
+
+GPU_CB_STRUCT(Data {
+    Float2 InputSize;
+    uint32 ImageWidth;
+    uint32 ImageHeight;
+    uint32 TileSize;
+    uint32 UseCoarseRates;
+    uint32 UseMotionVectors;
+    float ContrastThreshold;
+    float MotionThreshold;
+    Float3 Dummy0;
+    });
+
+// Custom render buffer for the shading rate image of the view.
+class ShadingRateCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* Image = nullptr;
+    int32 Width = 0;
+    int32 Height = 0;
+
+    ~ShadingRateCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(Image);
+    }
+};
+
+String ShadingRatePass::ToString() const
+{
+    return TEXT("ShadingRatePass");
+}
+
+bool ShadingRatePass::Init()
+{
+    // Shading rate image and compute shaders support is required for this implementation
+    if (!GPUDevice::Instance->Limits.HasVariableRateShadingImage || !GPUDevice::Instance->Limits.HasCompute)
+        return false;
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ShadingRate"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<ShadingRatePass, &ShadingRatePass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool ShadingRatePass::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _generateCS = shader->GetCS("CS_Generate");
+
+    return false;
+}
+
+void ShadingRatePass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _generateCS = nullptr;
+    _shader = nullptr;
+}
+
+void ShadingRatePass::Render(RenderContext& renderContext, GPUContext* context, GPUTexture* input)
+{
+    if (Graphics::VariableRateShading == VariableRateShadingPasses::None || !_shader || renderContext.View.IsOfflinePass || checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Shading Rate");
+    const GPULimits& limits = GPUDevice::Instance->Limits;
+    auto& data = *renderContext.Buffers->GetCustomBuffer<ShadingRateCustomBuffer>(TEXT("ShadingRate"));
+
+    // Allocate the shading rate image (one texel per screen tile)
+    const int32 width = input->Width(), height = input->Height();
+    const int32 tileSize = limits.ShadingRateImageTileSize;
+    const int32 imageWidth = Math::DivideAndRoundUp(width, tileSize);
+    const int32 imageHeight = Math::DivideAndRoundUp(height, tileSize);
+    if (!data.Image)
+        data.Image = GPUDevice::Instance->CreateTexture(TEXT("ShadingRate.Image"));
+    if (data.Image->Width() != imageWidth || data.Image->Height() != imageHeight)
+    {
+        const auto desc = GPUTextureDescription::New2D(imageWidth, imageHeight, PixelFormat::R8_UInt, GPUTextureFlags::ShaderResource | GPUTextureFlags::UnorderedAccess);
+        if (data.Image->Init(desc))
+        {
+            data.LastFrameUsed = 0;
+            return;
+        }
+    }
+    data.Width = width;
+    data.Height = height;
+    data.LastFrameUsed = Engine::FrameCount;
+
+    // Generate shading rates from the scene luminance contrast and motion
+    GPUTexture* motionVectors = renderContext.Buffers->MotionVectors;
+    const bool useMotionVectors = renderContext.List->Setup.UseMotionVectors && motionVectors && motionVectors->IsAllocated();
+    Data cb;
+    cb.InputSize = Float2((float)width, (float)height);
+    cb.ImageWidth = imageWidth;
+    cb.ImageHeight = imageHeight;
+    cb.TileSize = tileSize;
+    cb.UseCoarseRates = limits.HasVariableRateShadingCoarseRates ? 1 : 0;
+    cb.UseMotionVectors = useMotionVectors ? 1 : 0;
+    cb.ContrastThreshold = SHADING_RATE_CONTRAST_THRESHOLD;
+    cb.MotionThreshold = SHADING_RATE_MOTION_THRESHOLD;
+    context->ResetRenderTarget();
+    context->UpdateCB(_cb, &cb);
+    context->BindCB(0, _cb);
+    context->BindSR(0, input);
+    context->BindSR(1, useMotionVectors ? motionVectors->View() : nullptr);
+    context->BindUA(0, data.Image->View());
+    context->Dispatch(_generateCS, Math::DivideAndRoundUp(imageWidth, 8), Math::DivideAndRoundUp(imageHeight, 8), 1);
+    context->ResetUA();
+    context->ResetSR();
+}
+
+bool ShadingRatePass::Begin(RenderContext& renderContext, GPUContext* context, VariableRateShadingPasses pass, int32 width, int32 height)
+{
+    if (!EnumHasAnyFlags(Graphics::VariableRateShading, pass) || !renderContext.Buffers)
+        return false;
+    const auto data = renderContext.Buffers->FindCustomBuffer<ShadingRateCustomBuffer>(TEXT("ShadingRate"), false);
+    if (!data || data->LastFrameUsed != Engine::FrameCount || data->Width != width || data->Height != height)
+        return false;
+    context->SetShadingRate(ShadingRate::_1x1, data->Image);
+    return true;
+}
+
+void ShadingRatePass::End(GPUContext* context)
+{
+    context->SetShadingRate(ShadingRate::_1x1);
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+/// <summary>
+/// Variable rate shading support. Generates the shading rate image (one texel per screen tile) from the scene luminance contrast and motion vectors and binds it to the rendering passes that opt in for it (see Graphics::VariableRateShading).
+/// </summary>
+class ShadingRatePass : public RendererPass<ShadingRatePass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _generateCS = nullptr;
+
+public:
+    /// <summary>
+    /// Generates the shading rate image for the current frame (does nothing if variable rate shading is not used).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="input">The scene color used to evaluate the luminance contrast.</param>
+    void Render(RenderContext& renderContext, GPUContext* context, GPUTexture* input);
+
+    /// <summary>
+    /// Enables the variable rate shading with the shading rate image of the current frame for the next draw calls (if the pass uses it).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="pass">The rendering pass.</param>
+    /// <param name="width">The width of the render target (must match the shading rate image source size).</param>
+    /// <param name="height">The height of the render target (must match the shading rate image source size).</param>
+    /// <returns>True if variable rate shading has been enabled, otherwise false.</returns>
+    bool Begin(RenderContext& renderContext, GPUContext* context, VariableRateShadingPasses pass, int32 width, int32 height);
+
+    /// <summary>
+    /// Disables the variable rate shading enabled with Begin.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    void End(GPUContext* context);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _generateCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -2,6 +2,7 @@
 
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
+#include "ImpostorsPass.h"
 #include "VolumetricFogPass.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/GPUContext.h"
@@ -73,7 +74,9 @@ struct ShadowAtlasLightTile
     float FramesToUpdate; // Amount of frames (with fraction) until the next shadow update can happen
     bool SkipUpdate;
     bool HasStaticGeometry;
+    bool StaticDirty; // True if static shadow map needs to be redrawn (eg. static object inside the projection has been modified)
     Viewport CachedViewport; // The viewport used the last time to render shadow to the atlas
+    BoundingFrustum StaticFrustum; // The projection used to render static shadow map (relative to ShadowAtlasLight::StaticOrigin)
 
     void FreeDynamic(ShadowsCustomBuffer* buffer);
     void FreeStatic(ShadowsCustomBuffer* buffer);
@@ -192,6 +195,7 @@ struct ShadowAtlasLight
     bool HasStaticShadowContext;
     StaticStates StaticState;
     BoundingSphere Bounds;
+    Vector3 StaticOrigin;
     float Sharpness, Fade, NormalOffsetScale, Bias, FadeDistance, Distance, TileBorder;
     Float4 CascadeSplits;
     ShadowAtlasLightTile Tiles[SHADOWS_MAX_TILES];
@@ -374,8 +378,31 @@ class ShadowsCustomBuffer : public RenderBuffers::CustomBuffer, public ISceneRen
             if ((atlasLight.StaticState == ShadowAtlasLight::CopyStaticShadow || atlasLight.StaticState == ShadowAtlasLight::NoStaticGeometry) 
                 && atlasLight.Bounds.Intersects(bounds))
             {
-                // Invalidate static shadow
-                atlasLight.Cache.StaticValid = false;
+                if (atlasLight.StaticState == ShadowAtlasLight::NoStaticGeometry)
+                {
+                    // Invalidate static shadow
+                    atlasLight.Cache.StaticValid = false;
+                    continue;
+                }
+
+                // Invalidate only tiles that project the modified bounds (eg. a single cube face of the point light)
+                const BoundingSphere localBounds(bounds.Center - atlasLight.StaticOrigin, bounds.Radius);
+                for (int32 i = 0; i < atlasLight.TilesCount; i++)
+                {
+                    auto& tile = atlasLight.Tiles[i];
+                    if (!tile.StaticFrustum.Intersects(localBounds))
+                        continue;
+                    if (tile.StaticRectTile)
+                    {
+                        tile.StaticDirty = true;
+                        atlasLight.Cache.DynamicValid = false;
+                    }
+                    else
+                    {
+                        // Tile had no static geometry so check it again
+                        atlasLight.Cache.StaticValid = false;
+                    }
+                }
             }
         }
     }
@@ -647,6 +674,11 @@ bool ShadowsPass::SetupLight(ShadowsCustomBuffer& shadows, RenderContext& render
 
     // Update cached state (invalidate it if the light changed)
     atlasLight.ValidateCache(renderContext.View, light);
+    if (!atlasLight.Cache.StaticValid)
+    {
+        for (auto& tile : atlasLight.Tiles)
+            tile.StaticDirty = true;
+    }
 
     // Update static shadow logic
     atlasLight.HasStaticShadowContext = shadows.EnableStaticShadows && EnumHasAllFlags(light.StaticFlags, StaticFlags::Shadow);
@@ -710,9 +742,18 @@ bool ShadowsPass::SetupLight(ShadowsCustomBuffer& shadows, RenderContext& render
         }
         break;
     case ShadowAtlasLight::CopyStaticShadow:
-        // Light was modified so update the static shadows
-        if (!atlasLight.Cache.StaticValid && atlasLight.HasStaticShadowContext)
-            atlasLight.StaticState = ShadowAtlasLight::UpdateStaticShadow;
+        // Light or static objects were modified so update the static shadows
+        if (atlasLight.HasStaticShadowContext)
+        {
+            for (int32 tileIndex = 0; tileIndex < atlasLight.TilesCount; tileIndex++)
+            {
+                if (atlasLight.Tiles[tileIndex].StaticDirty)
+                {
+                    atlasLight.StaticState = ShadowAtlasLight::UpdateStaticShadow;
+                    break;
+                }
+            }
+        }
         break;
     }
     switch (atlasLight.StaticState)
@@ -1007,6 +1048,8 @@ void ShadowsPass::SetupLight(ShadowsCustomBuffer& shadows, RenderContext& render
         // Draw static geometry separately to be cached
         if (atlasLight.HasStaticShadowContext)
         {
+            atlasLight.Tiles[faceIndex].StaticFrustum = shadowContext.View.Frustum;
+            atlasLight.StaticOrigin = renderContext.View.Origin;
             auto& shadowContextStatic = renderContextBatch.Contexts[atlasLight.ContextIndex + contextIndex++];
             SetupRenderContext(renderContext, shadowContextStatic, &atlasLight, &shadowContext);
         }
@@ -1032,6 +1075,8 @@ void ShadowsPass::SetupLight(ShadowsCustomBuffer& shadows, RenderContext& render
     // Draw static geometry separately to be cached
     if (atlasLight.HasStaticShadowContext)
     {
+        atlasLight.Tiles[0].StaticFrustum = shadowContext.View.Frustum;
+        atlasLight.StaticOrigin = renderContext.View.Origin;
         auto& shadowContextStatic = renderContextBatch.Contexts[atlasLight.ContextIndex + 1];
         SetupRenderContext(renderContext, shadowContextStatic, &atlasLight, &shadowContext);
     }
@@ -1405,7 +1450,7 @@ void ShadowsPass::RenderShadowMaps(RenderContextBatch& renderContextBatch)
                     ShadowAtlasLightTile& tile = atlasLight.Tiles[tileIndex];
                     contextIndex++; // Skip dynamic context
                     auto& shadowContextStatic = renderContextBatch.Contexts[atlasLight.ContextIndex + contextIndex++];
-                    if (!shadowContextStatic.List->DrawCallsLists[(int32)DrawCallsListType::Depth].IsEmpty() || !shadowContextStatic.List->ShadowDepthDrawCallsList.IsEmpty())
+                    if (!shadowContextStatic.List->DrawCallsLists[(int32)DrawCallsListType::Depth].IsEmpty() || !shadowContextStatic.List->ShadowDepthDrawCallsList.IsEmpty() || shadowContextStatic.List->Impostors.Count() != 0)
                     {
                         tile.HasStaticGeometry = true;
                     }
@@ -1421,8 +1466,13 @@ void ShadowsPass::RenderShadowMaps(RenderContextBatch& renderContextBatch)
                 ShadowAtlasLightTile& tile = atlasLight.Tiles[tileIndex];
                 if (!tile.RectTile)
                     break;
-                if (!tile.StaticRectTile)
+                if (!tile.StaticRectTile || !tile.StaticDirty)
+                {
+                    // Keep the cached static shadow
+                    contextIndex += 2;
                     continue;
+                }
+                tile.StaticDirty = false;
                 if (!renderedAny)
                 {
                     renderedAny = true;
@@ -1446,10 +1496,11 @@ void ShadowsPass::RenderShadowMaps(RenderContextBatch& renderContextBatch)
                 // Draw objects depth
                 contextIndex++; // Skip dynamic context
                 auto& shadowContextStatic = renderContextBatch.Contexts[atlasLight.ContextIndex + contextIndex++];
-                if (!shadowContextStatic.List->DrawCallsLists[(int32)DrawCallsListType::Depth].IsEmpty() || !shadowContextStatic.List->ShadowDepthDrawCallsList.IsEmpty())
+                if (!shadowContextStatic.List->DrawCallsLists[(int32)DrawCallsListType::Depth].IsEmpty() || !shadowContextStatic.List->ShadowDepthDrawCallsList.IsEmpty() || shadowContextStatic.List->Impostors.Count() != 0)
                 {
                     shadowContextStatic.List->ExecuteDrawCalls(shadowContextStatic, DrawCallsListType::Depth);
                     shadowContextStatic.List->ExecuteDrawCalls(shadowContextStatic, shadowContextStatic.List->ShadowDepthDrawCallsList, renderContext.List, nullptr);
+                    ImpostorsPass::Instance()->Draw(shadowContextStatic, context);
                     tile.HasStaticGeometry = true;
                 }
             }
@@ -1514,16 +1565,18 @@ void ShadowsPass::RenderShadowMaps(RenderContextBatch& renderContextBatch)
             auto& shadowContext = renderContextBatch.Contexts[atlasLight.ContextIndex + contextIndex++];
             shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
             shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List, nullptr);
+            ImpostorsPass::Instance()->Draw(shadowContext, context);
             if (atlasLight.HasStaticShadowContext)
             {
                 auto& shadowContextStatic = renderContextBatch.Contexts[atlasLight.ContextIndex + contextIndex++];
-                if (!shadowContextStatic.List->DrawCallsLists[(int32)DrawCallsListType::Depth].IsEmpty() || !shadowContextStatic.List->ShadowDepthDrawCallsList.IsEmpty())
+                if (!shadowContextStatic.List->DrawCallsLists[(int32)DrawCallsListType::Depth].IsEmpty() || !shadowContextStatic.List->ShadowDepthDrawCallsList.IsEmpty() || shadowContextStatic.List->Impostors.Count() != 0)
                 {
                     if (atlasLight.StaticState != ShadowAtlasLight::CopyStaticShadow)
                     {
                         // Draw static objects directly to the shadow map
                         shadowContextStatic.List->ExecuteDrawCalls(shadowContextStatic, DrawCallsListType::Depth);
                         shadowContextStatic.List->ExecuteDrawCalls(shadowContextStatic, shadowContextStatic.List->ShadowDepthDrawCallsList, renderContext.List, nullptr);
+                        ImpostorsPass::Instance()->Draw(shadowContextStatic, context);
                     }
                     tile.HasStaticGeometry = true;
                 }
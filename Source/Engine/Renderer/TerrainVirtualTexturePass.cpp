@@ -0,0 +1,425 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "TerrainVirtualTexturePass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Terrain/Terrain.h"
+#include "Engine/Terrain/TerrainChunk.h"
+#include "Engine/Terrain/TerrainPatch.h"
+
+// The resolution of a single tile (in texels), each tile covers a single terrain chunk
+#define TERRAIN_VT_TILE_RESOLUTION 256
+
+// The amount of mip maps of the tiles (used when drawing chunks far away)
+#define TERRAIN_VT_TILE_MIPS 5
+
+// The maximum amount of tiles to bake in a single frame
+#define TERRAIN_VT_BAKES_PER_FRAME 4
+
+GPU_CB_STRUCT(Data {
+    Matrix ViewProjectionMatrix;
+    Matrix WorldMatrix;
+    Float4 HeightmapUVScaleBias;
+    Float4 NeighborLOD;
+    float CurrentLOD;
+    float ChunkSizeNextLOD;
+    float TerrainChunkSizeLOD0;
+    float TileIndex;
+    float TileTexelSize;
+    float Dummy0;
+    Float2 LODMorph;
+    Float3 LODViewPosition;
+    float Dummy1;
+    });
+
+namespace
+{
+    int32 GetHeightmapMips(const TerrainChunk* chunk)
+    {
+        const Texture* heightmap = chunk->GetPatch()->Heightmap.Get();
+        return heightmap ? heightmap->GetTexture()->ResidentMipLevels() : 0;
+    }
+}
+
+bool TerrainVirtualTexturePass::IsValid(const Tile& tile, const TerrainChunk* chunk, MaterialBase* material) const
+{
+    return tile.Chunk == chunk &&
+            tile.Material == material &&
+            tile.ParamsHash == material->Params.GetVersionHash() &&
+            tile.Version == chunk->GetPatch()->GetVirtualTextureVersion() &&
+            tile.HeightmapMips == GetHeightmapMips(chunk) &&
+            tile.ChunkTransform == chunk->GetTransform();
+}
+
+int32 TerrainVirtualTexturePass::GetTile(TerrainChunk* chunk, MaterialBase* material, int32 lod)
+{
+    if (Graphics::TerrainVirtualTextureTiles <= 0)
+        return -1;
+    ScopeLock lock(_locker);
+    int32 tileIndex;
+    if (_chunkToTile.TryGet(chunk, tileIndex))
+    {
+        Tile& tile = _tiles[tileIndex];
+        if (tile.IsReady && IsValid(tile, chunk, material))
+        {
+            tile.LastUsedFrame = Engine::FrameCount;
+            return tileIndex;
+        }
+    }
+
+    // Queue the bake
+    auto& request = _requests.AddOne();
+    request.Chunk = chunk;
+    request.Material = material;
+    request.LOD = lod;
+    return -1;
+}
+
+void TerrainVirtualTexturePass::Bake(GPUContext* context)
+{
+    ScopeLock lock(_locker);
+    if (_requests.IsEmpty())
+        return;
+    if (_bakeFrame != Engine::FrameCount)
+    {
+        _bakeFrame = Engine::FrameCount;
+        _bakeCount = 0;
+    }
+    if (_bakeCount >= TERRAIN_VT_BAKES_PER_FRAME || checkIfSkipPass())
+    {
+        // Chunks will request tiles again when drawn
+        _requests.Clear();
+        return;
+    }
+    PROFILE_GPU_CPU("Terrain Virtual Texture");
+
+    // Allocate cache
+    const int32 tilesCount = Graphics::TerrainVirtualTextureTiles;
+    if (_tiles.Count() != tilesCount)
+    {
+        const PixelFormat formats[3] = { GBUFFER0_FORMAT, GBUFFER1_FORMAT, GBUFFER2_FORMAT };
+        const auto desc = GPUTextureDescription::New2D(TERRAIN_VT_TILE_RESOLUTION, TERRAIN_VT_TILE_RESOLUTION, TERRAIN_VT_TILE_MIPS, PixelFormat::Unknown, GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget | GPUTextureFlags::PerMipViews | GPUTextureFlags::PerSliceViews, tilesCount);
+        for (int32 i = 0; i < ARRAY_COUNT(_cache); i++)
+        {
+            if (!_cache[i])
+                _cache[i] = GPUDevice::Instance->CreateTexture(TEXT("TerrainVirtualTexture.Cache"));
+            auto cacheDesc = desc;
+            cacheDesc.Format = formats[i];
+            if (_cache[i]->Init(cacheDesc))
+            {
+                LOG(Error, "Failed to create terrain virtual texture cache.");
+                _requests.Clear();
+                return;
+            }
+        }
+        for (const Tile& tile : _tiles)
+        {
+            if (tile.Material)
+                tile.Material->OnUnloaded.Unbind<TerrainVirtualTexturePass, &TerrainVirtualTexturePass::OnMaterialUnloaded>(this);
+        }
+        _tiles.Resize(tilesCount);
+        for (Tile& tile : _tiles)
+        {
+            tile.Chunk = nullptr;
+            tile.Material = nullptr;
+            tile.LastUsedFrame = 0;
+            tile.IsReady = false;
+        }
+        _chunkToTile.Clear();
+    }
+
+    // Bake the most important tiles (requests are collected from the chunks drawn by this frame so they are still valid)
+    Sorting::QuickSort(_requests.Get(), _requests.Count());
+    for (int32 i = 0; i < _requests.Count() && _bakeCount < TERRAIN_VT_BAKES_PER_FRAME; i++)
+    {
+        const Request& request = _requests[i];
+        if (!request.Material->IsReady())
+            continue;
+
+        // Reuse the chunk tile (if outdated) or the least recently used one that is not drawn by this frame
+        int32 tileIndex;
+        if (_chunkToTile.TryGet(request.Chunk, tileIndex))
+        {
+            if (IsValid(_tiles[tileIndex], request.Chunk, request.Material))
+                continue; // Already baked (duplicated request from other view)
+        }
+        else
+        {
+            tileIndex = -1;
+            uint64 lastUsedFrame = Engine::FrameCount;
+            for (int32 j = 0; j < _tiles.Count(); j++)
+            {
+                if (_tiles[j].LastUsedFrame < lastUsedFrame)
+                {
+                    lastUsedFrame = _tiles[j].LastUsedFrame;
+                    tileIndex = j;
+                    if (!_tiles[j].Chunk)
+                        break;
+                }
+            }
+            if (tileIndex == -1)
+                break; // Whole cache is in use
+            if (_tiles[tileIndex].Chunk)
+                _chunkToTile.Remove(_tiles[tileIndex].Chunk);
+            _chunkToTile.Add(request.Chunk, tileIndex);
+        }
+        BakeTile(context, tileIndex, request);
+        _bakeCount++;
+    }
+    _requests.Clear();
+}
+
+void TerrainVirtualTexturePass::BakeTile(GPUContext* context, int32 tileIndex, const Request& request)
+{
+    const TerrainChunk* chunk = request.Chunk;
+    Tile& tile = _tiles[tileIndex];
+    if (tile.Material != request.Material)
+    {
+        // Track material reloads to drop outdated tiles
+        MaterialBase* prevMaterial = tile.Material;
+        tile.Material = nullptr;
+        bool isPrevMaterialUsed = false, isMaterialUsed = false;
+        for (const Tile& e : _tiles)
+        {
+            isPrevMaterialUsed |= prevMaterial && e.Material == prevMaterial;
+            isMaterialUsed |= e.Material == request.Material;
+        }
+        if (prevMaterial && !isPrevMaterialUsed)
+            prevMaterial->OnUnloaded.Unbind<TerrainVirtualTexturePass, &TerrainVirtualTexturePass::OnMaterialUnloaded>(this);
+        if (!isMaterialUsed)
+            request.Material->OnUnloaded.Bind<TerrainVirtualTexturePass, &TerrainVirtualTexturePass::OnMaterialUnloaded>(this);
+    }
+    tile.Chunk = chunk;
+    tile.Material = request.Material;
+    tile.ParamsHash = request.Material->Params.GetVersionHash();
+    tile.Version = chunk->GetPatch()->GetVirtualTextureVersion();
+    tile.HeightmapMips = GetHeightmapMips(chunk);
+    tile.ChunkTransform = chunk->GetTransform();
+    tile.LastUsedFrame = Engine::FrameCount;
+    tile.IsReady = true;
+
+    // Allocate temporary buffers
+    auto tempDesc = GPUTextureDescription::New2D(TERRAIN_VT_TILE_RESOLUTION, TERRAIN_VT_TILE_RESOLUTION, PixelFormat::R11G11B10_Float, GPUTextureFlags::RenderTarget);
+    auto lightBuffer = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(lightBuffer, "TerrainVirtualTexture.Light");
+    tempDesc.Format = GBUFFER3_FORMAT;
+    auto gBuffer3 = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(gBuffer3, "TerrainVirtualTexture.GBuffer3");
+    tempDesc.Format = PixelFormat::D24_UNorm_S8_UInt;
+    tempDesc.Flags = GPUTextureFlags::DepthStencil;
+    auto depthBuffer = RenderTargetPool::Get(tempDesc);
+    RENDER_TARGET_POOL_SET_NAME(depthBuffer, "TerrainVirtualTexture.Depth");
+
+    // Setup the top-down orthographic view of the chunk (matches the tile UVs used by the shader)
+    const Transform& transform = chunk->GetTransform();
+    const float chunkSize = (float)chunk->GetPatch()->GetTerrain()->GetChunkSize() * TERRAIN_UNITS_PER_VERTEX;
+    const BoundingBox& bounds = chunk->GetBounds();
+    const Vector3 center = bounds.GetCenter();
+    const float radius = Math::Max((float)bounds.GetSize().Length() * 0.5f, 1.0f);
+    const Float3 up = transform.GetUp();
+    const Vector3 position = center + up * (radius * 2.0f);
+    Matrix view, projection;
+    Matrix::LookAt(position, center, transform.GetForward(), view);
+    Matrix::Ortho(chunkSize * transform.Scale.X, chunkSize * transform.Scale.Z, radius * 0.5f, radius * 3.5f, projection);
+    RenderContext renderContext;
+    renderContext.List = RenderList::GetFromPool();
+    RenderView& tileView = renderContext.View;
+    tileView.Pass = DrawPass::GBuffer;
+    tileView.IsOfflinePass = true;
+    tileView.IsSingleFrame = true;
+    tileView.Position = position;
+    tileView.Direction = -up;
+    tileView.Near = radius * 0.5f;
+    tileView.Far = radius * 3.5f;
+    tileView.SetUp(view, projection);
+    tileView.PrevView = tileView.View;
+    tileView.PrevProjection = tileView.Projection;
+    tileView.PrevViewProjection = tileView.ViewProjection();
+    tileView.PrepareCache(renderContext, (float)TERRAIN_VT_TILE_RESOLUTION, (float)TERRAIN_VT_TILE_RESOLUTION, Float2::Zero);
+
+    // Draw chunk material
+    const int32 lod = chunk->GetPatch()->Heightmap->StreamingTexture()->TotalMipLevels() - tile.HeightmapMips;
+    chunk->Draw(renderContext, request.Material, lod);
+    renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBuffer);
+    renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBufferNoDecals);
+    GPUTextureView* targetBuffers[5] =
+    {
+        lightBuffer->View(),
+        _cache[0]->View(tileIndex, 0),
+        _cache[1]->View(tileIndex, 0),
+        _cache[2]->View(tileIndex, 0),
+        gBuffer3->View(),
+    };
+    for (GPUTextureView* target : targetBuffers)
+        context->Clear(target, Color::Transparent);
+    context->ClearDepth(depthBuffer->View());
+    context->SetRenderTarget(depthBuffer->View(), ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+    context->SetViewportAndScissors((float)TERRAIN_VT_TILE_RESOLUTION, (float)TERRAIN_VT_TILE_RESOLUTION);
+    renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
+    renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBufferNoDecals);
+    context->ResetRenderTarget();
+
+    // Generate mip maps of the tile
+    context->SetState(_psDownsample);
+    for (int32 mipIndex = 1; mipIndex < TERRAIN_VT_TILE_MIPS; mipIndex++)
+    {
+        const float mipResolution = (float)(TERRAIN_VT_TILE_RESOLUTION >> mipIndex);
+        context->SetViewportAndScissors(mipResolution, mipResolution);
+        for (GPUTexture* cache : _cache)
+        {
+            context->SetRenderTarget(cache->View(tileIndex, mipIndex));
+            context->BindSR(4, cache->View(tileIndex, mipIndex - 1));
+            context->DrawFullscreenTriangle();
+            context->UnBindSR(4);
+        }
+    }
+    context->ResetRenderTarget();
+
+    // Cleanup
+    RenderList::ReturnToPool(renderContext.List);
+    RenderTargetPool::Release(lightBuffer);
+    RenderTargetPool::Release(gBuffer3);
+    RenderTargetPool::Release(depthBuffer);
+}
+
+void TerrainVirtualTexturePass::Draw(const RenderContext& renderContext, GPUContext* context)
+{
+    auto& tiles = renderContext.List->TerrainTiles;
+    if (tiles.Count() == 0 || checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Terrain Virtual Texture");
+
+    Data data;
+    Matrix::Transpose(renderContext.View.Frustum.GetMatrix(), data.ViewProjectionMatrix);
+    data.TileTexelSize = 0.5f / (float)TERRAIN_VT_TILE_RESOLUTION;
+    context->SetState(_psDraw);
+    for (int32 i = 0; i < ARRAY_COUNT(_cache); i++)
+        context->BindSR(i + 1, _cache[i]);
+    for (int32 i = 0; i < tiles.Count(); i++)
+    {
+        const TerrainTileDrawCall& e = tiles.Get()[i];
+        Matrix::Transpose(e.World, data.WorldMatrix);
+        data.HeightmapUVScaleBias = e.HeightmapUVScaleBias;
+        data.NeighborLOD = e.NeighborLOD;
+        data.CurrentLOD = e.CurrentLOD;
+        data.ChunkSizeNextLOD = e.ChunkSizeNextLOD;
+        data.TerrainChunkSizeLOD0 = e.TerrainChunkSizeLOD0;
+        data.LODMorph = e.LODMorph;
+        data.LODViewPosition = e.LODViewPosition;
+        data.TileIndex = (float)e.Tile;
+        context->UpdateCB(_cb, &data);
+        context->BindCB(0, _cb);
+        context->BindSR(0, e.Heightmap);
+        context->BindIB(e.IndexBuffer);
+        context->BindVB(ToSpan(&e.VertexBuffer, 1));
+        context->DrawIndexed(e.IndicesCount);
+    }
+    context->ResetSR();
+}
+
+void TerrainVirtualTexturePass::OnMaterialUnloaded(Asset* asset)
+{
+    ScopeLock lock(_locker);
+    MaterialBase* material = (MaterialBase*)asset;
+    material->OnUnloaded.Unbind<TerrainVirtualTexturePass, &TerrainVirtualTexturePass::OnMaterialUnloaded>(this);
+    for (Tile& tile : _tiles)
+    {
+        if (tile.Material == material)
+        {
+            tile.Material = nullptr;
+            tile.IsReady = false;
+        }
+    }
+}
+
+String TerrainVirtualTexturePass::ToString() const
+{
+    return TEXT("TerrainVirtualTexturePass");
+}
+
+bool TerrainVirtualTexturePass::Init()
+{
+    // Create pipeline states
+    _psDraw = GPUDevice::Instance->CreatePipelineState();
+    _psDownsample = GPUDevice::Instance->CreatePipelineState();
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/TerrainVirtualTexture"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<TerrainVirtualTexturePass, &TerrainVirtualTexturePass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool TerrainVirtualTexturePass::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Create pipeline states
+    if (!_psDraw->IsValid())
+    {
+        auto psDesc = GPUPipelineState::Description::Default;
+        psDesc.VS = shader->GetVS("VS");
+        psDesc.PS = shader->GetPS("PS_Draw");
+        if (_psDraw->Init(psDesc))
+            return true;
+    }
+    if (!_psDownsample->IsValid())
+    {
+        auto psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.PS = shader->GetPS("PS_Downsample");
+        if (_psDownsample->Init(psDesc))
+            return true;
+    }
+
+    return false;
+}
+
+void TerrainVirtualTexturePass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    for (const Tile& tile : _tiles)
+    {
+        if (tile.Material)
+            tile.Material->OnUnloaded.Unbind<TerrainVirtualTexturePass, &TerrainVirtualTexturePass::OnMaterialUnloaded>(this);
+    }
+    _tiles.Clear();
+    _chunkToTile.Clear();
+    _requests.Clear();
+    for (GPUTexture*& cache : _cache)
+        SAFE_DELETE_GPU_RESOURCE(cache);
+    SAFE_DELETE_GPU_RESOURCE(_psDraw);
+    SAFE_DELETE_GPU_RESOURCE(_psDownsample);
+    _cb = nullptr;
+    _shader = nullptr;
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class TerrainChunk;
+class MaterialBase;
+
+/// <summary>
+/// Terrain virtual texture rendering service. Bakes the terrain chunks materials (albedo, normal and material properties) on demand into the tiles cache and draws the distant chunks into GBuffer with a single tile lookup instead of evaluating all of the material layers.
+/// </summary>
+class TerrainVirtualTexturePass : public RendererPass<TerrainVirtualTexturePass>
+{
+private:
+    struct Tile
+    {
+        const TerrainChunk* Chunk;
+        MaterialBase* Material;
+        int32 ParamsHash;
+        uint32 Version;
+        int32 HeightmapMips;
+        Transform ChunkTransform;
+        uint64 LastUsedFrame;
+        bool IsReady;
+    };
+
+    struct Request
+    {
+        TerrainChunk* Chunk;
+        MaterialBase* Material;
+        int32 LOD;
+
+        bool operator<(const Request& other) const
+        {
+            // Bake the closest chunks first
+            return LOD < other.LOD;
+        }
+    };
+
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUPipelineState* _psDraw = nullptr;
+    GPUPipelineState* _psDownsample = nullptr;
+    GPUTexture* _cache[3] = {};
+    CriticalSection _locker;
+    Array<Tile> _tiles;
+    Dictionary<const TerrainChunk*, int32> _chunkToTile;
+    Array<Request> _requests;
+    uint64 _bakeFrame = 0;
+    int32 _bakeCount = 0;
+
+public:
+    /// <summary>
+    /// Gets the virtual texture tile of the terrain chunk. Queues the tile bake if it's missing or outdated. Safe to call from the async drawing jobs.
+    /// </summary>
+    /// <param name="chunk">The terrain chunk.</param>
+    /// <param name="material">The chunk material.</param>
+    /// <param name="lod">The chunk LOD index (used to prioritize bakes).</param>
+    /// <returns>The tile index or -1 if it's not ready yet (chunk material should be drawn instead).</returns>
+    int32 GetTile(TerrainChunk* chunk, MaterialBase* material, int32 lod);
+
+    /// <summary>
+    /// Bakes the tiles requested by the chunks drawn since the last call (limited amount per frame).
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    void Bake(GPUContext* context);
+
+    /// <summary>
+    /// Draws the terrain chunks added to the render list using the cache tiles (GBuffer render targets have to be already bound).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Draw(const RenderContext& renderContext, GPUContext* context);
+
+private:
+    bool IsValid(const Tile& tile, const TerrainChunk* chunk, MaterialBase* material) const;
+    void BakeTile(GPUContext* context, int32 tileIndex, const Request& request);
+    void OnMaterialUnloaded(Asset* asset);
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _psDraw->ReleaseGPU();
+        _psDownsample->ReleaseGPU();
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,273 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "TextureFeedbackPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Async/GPUSyncPoint.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Textures/TextureData.h"
+
+// The maximum resolution of the feedback buffer (along the longer side of the view)
+#define TEXTURE_FEEDBACK_RESOLUTION 256
+
+// The amount of readback textures (GPU is a few frames behind CPU)
+#define TEXTURE_FEEDBACK_FRAMES (GPU_ASYNC_LATENCY + 1)
+
+// The interval (in frames) between the feedback updates (streaming reacts with a delay anyway)
+#define TEXTURE_FEEDBACK_INTERVAL 4
+
+// The maximum amount of draw calls recorded in a single feedback (draw index is packed into 16 bits)
+#define TEXTURE_FEEDBACK_MAX_DRAWS 4096
+
+GPU_CB_STRUCT(Data {
+    Matrix ViewProjectionMatrix;
+    Matrix WorldMatrix;
+    uint32 DrawIndex;
+    float ResolutionScale;
+    Float2 Dummy0;
+    });
+
+// Custom render buffer for the view textures streaming feedback.
+class TextureFeedbackCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    struct Frame
+    {
+        GPUTexture* Staging = nullptr;
+        uint64 FrameIndex = 0;
+        Array<Guid> Materials;
+    };
+
+    GPUTexture* Feedback = nullptr;
+    GPUTexture* Depth = nullptr;
+    Frame Frames[TEXTURE_FEEDBACK_FRAMES];
+    uint64 RenderFrameIndex = 0;
+
+    ~TextureFeedbackCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(Feedback);
+        SAFE_DELETE_GPU_RESOURCE(Depth);
+        for (Frame& frame : Frames)
+            SAFE_DELETE_GPU_RESOURCE(frame.Staging);
+    }
+};
+
+namespace
+{
+    void ReportFeedback(TextureFeedbackCustomBuffer::Frame& frame)
+    {
+        PROFILE_CPU();
+        TextureMipData mip;
+        if (frame.Materials.IsEmpty() || frame.Staging->GetData(0, 0, mip))
+            return;
+
+        // Find the highest resolution required by each draw (occluded draws still keep the lowest mips)
+        Array<int32> resolutions;
+        resolutions.Resize(frame.Materials.Count());
+        resolutions.SetAll(1);
+        const int32 width = frame.Staging->Width(), height = frame.Staging->Height();
+        for (int32 y = 0; y < height; y++)
+        {
+            for (int32 x = 0; x < width; x++)
+            {
+                const uint32 value = mip.Get<uint32>(x, y);
+                const int32 drawIndex = (int32)(value >> 16) - 1;
+                if (drawIndex >= 0 && drawIndex < resolutions.Count())
+                    resolutions[drawIndex] = Math::Max(resolutions[drawIndex], (int32)(value & 0xffff));
+            }
+        }
+
+        // Report to the materials used by the draws
+        Dictionary<Guid, int32> materials;
+        for (int32 i = 0; i < resolutions.Count(); i++)
+        {
+            int32& resolution = materials[frame.Materials[i]];
+            resolution = Math::Max(resolution, resolutions[i]);
+        }
+        for (const auto& e : materials)
+        {
+            Asset* asset = Content::GetAsset(e.Key);
+            if (asset && asset->Is<MaterialBase>() && asset->IsLoaded())
+                ((MaterialBase*)asset)->ReportTexturesResolution(e.Value);
+        }
+    }
+}
+
+String TextureFeedbackPass::ToString() const
+{
+    return TEXT("TextureFeedbackPass");
+}
+
+bool TextureFeedbackPass::Init()
+{
+    // Create pipeline state
+    _psFeedback = GPUDevice::Instance->CreatePipelineState();
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/TextureFeedback"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<TextureFeedbackPass, &TextureFeedbackPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool TextureFeedbackPass::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Create pipeline state
+    if (!_psFeedback->IsValid())
+    {
+        auto psDesc = GPUPipelineState::Description::Default;
+        psDesc.VS = shader->GetVS("VS");
+        psDesc.PS = shader->GetPS("PS");
+        psDesc.CullMode = CullMode::TwoSided;
+        if (_psFeedback->Init(psDesc))
+            return true;
+    }
+
+    return false;
+}
+
+void TextureFeedbackPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_psFeedback);
+    _cb = nullptr;
+    _shader = nullptr;
+}
+
+bool TextureFeedbackPass::IsActive() const
+{
+    return Graphics::TextureStreamingFeedback && _shader && _shader->IsLoaded();
+}
+
+void TextureFeedbackPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    const RenderView& view = renderContext.View;
+    if (!Graphics::TextureStreamingFeedback || !_shader || view.IsOfflinePass || view.IsSingleFrame || EnumHasNoneFlags(view.Pass, DrawPass::GBuffer) || checkIfSkipPass())
+        return;
+    auto& data = *renderContext.Buffers->GetCustomBuffer<TextureFeedbackCustomBuffer>(TEXT("TextureFeedback"));
+    data.LastFrameUsed = Engine::FrameCount;
+
+    // Report the latest feedback that GPU has finished with (accept staging readback delay)
+    TextureFeedbackCustomBuffer::Frame* ready = nullptr;
+    for (auto& frame : data.Frames)
+    {
+        if (frame.FrameIndex != 0 && Engine::FrameCount - frame.FrameIndex >= GPU_ASYNC_LATENCY && (!ready || frame.FrameIndex > ready->FrameIndex))
+            ready = &frame;
+    }
+    if (ready)
+    {
+        ReportFeedback(*ready);
+        const uint64 readyFrameIndex = ready->FrameIndex;
+        for (auto& frame : data.Frames)
+        {
+            if (frame.FrameIndex <= readyFrameIndex)
+                frame.FrameIndex = 0;
+        }
+    }
+    if (data.RenderFrameIndex != 0 && Engine::FrameCount - data.RenderFrameIndex < TEXTURE_FEEDBACK_INTERVAL)
+        return;
+    PROFILE_GPU_CPU("Texture Feedback");
+
+    // Pick a free readback texture (or the oldest one)
+    TextureFeedbackCustomBuffer::Frame* frame = &data.Frames[0];
+    for (auto& e : data.Frames)
+    {
+        if (e.FrameIndex < frame->FrameIndex)
+            frame = &e;
+    }
+
+    // Allocate the feedback buffers (low-resolution version of the view)
+    const float scale = Math::Min((float)TEXTURE_FEEDBACK_RESOLUTION / Math::Max(view.ScreenSize.X, view.ScreenSize.Y), 1.0f);
+    const int32 width = Math::Clamp(Math::CeilToInt(view.ScreenSize.X * scale), 1, TEXTURE_FEEDBACK_RESOLUTION);
+    const int32 height = Math::Clamp(Math::CeilToInt(view.ScreenSize.Y * scale), 1, TEXTURE_FEEDBACK_RESOLUTION);
+    if (!data.Feedback)
+    {
+        data.Feedback = GPUDevice::Instance->CreateTexture(TEXT("TextureFeedback.Feedback"));
+        data.Depth = GPUDevice::Instance->CreateTexture(TEXT("TextureFeedback.Depth"));
+    }
+    const auto desc = GPUTextureDescription::New2D(width, height, PixelFormat::R32_UInt, GPUTextureFlags::RenderTarget);
+    if (data.Feedback->Width() != width || data.Feedback->Height() != height)
+    {
+        if (data.Feedback->Init(desc) ||
+            data.Depth->Init(GPUTextureDescription::New2D(width, height, PixelFormat::D24_UNorm_S8_UInt, GPUTextureFlags::DepthStencil)))
+        {
+            data.LastFrameUsed = 0;
+            return;
+        }
+    }
+    if (!frame->Staging)
+        frame->Staging = GPUDevice::Instance->CreateTexture(TEXT("TextureFeedback.Staging"));
+    if (frame->Staging->Width() != width || frame->Staging->Height() != height)
+    {
+        if (frame->Staging->Init(desc.ToStagingReadback()))
+            return;
+    }
+
+    // Draw the opaque surfaces with the draw index and the required texture resolution
+    context->Clear(data.Feedback->View(), Color::Transparent);
+    context->ClearDepth(data.Depth->View());
+    context->SetRenderTarget(data.Depth->View(), data.Feedback->View());
+    context->SetViewportAndScissors((float)width, (float)height);
+    context->SetState(_psFeedback);
+    Data cb;
+    Matrix::Transpose(view.Frustum.GetMatrix(), cb.ViewProjectionMatrix);
+    cb.ResolutionScale = 1.0f / scale;
+    frame->Materials.Clear();
+    const auto& drawCalls = renderContext.List->DrawCalls;
+    for (const DrawCallsListType listType : { DrawCallsListType::GBuffer, DrawCallsListType::GBufferNoDecals })
+    {
+        for (const int32 index : renderContext.List->DrawCallsLists[(int32)listType].Indices)
+        {
+            const DrawCall& drawCall = drawCalls[index];
+            const MaterialBase* material = drawCall.Material ? drawCall.Material->GetMaterialAsset() : nullptr;
+            if (!material || drawCall.Material->GetInfo().Domain != MaterialDomain::Surface || drawCall.Surface.Skinning || drawCall.InstanceCount != 1)
+                continue;
+            if (frame->Materials.Count() >= TEXTURE_FEEDBACK_MAX_DRAWS)
+                break;
+            cb.DrawIndex = frame->Materials.Count();
+            frame->Materials.Add(material->GetID());
+            Matrix::Transpose(drawCall.World, cb.WorldMatrix);
+            context->UpdateCB(_cb, &cb);
+            context->BindCB(0, _cb);
+            context->BindIB(drawCall.Geometry.IndexBuffer);
+            context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, 2), drawCall.Geometry.VertexBuffersOffsets);
+            context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, 1, 0, 0, drawCall.Draw.StartIndex);
+        }
+    }
+    context->ResetRenderTarget();
+
+    // Copy feedback for the readback in the next frames
+    context->CopyTexture(frame->Staging, 0, 0, 0, 0, data.Feedback, 0);
+    frame->FrameIndex = Engine::FrameCount;
+    data.RenderFrameIndex = Engine::FrameCount;
+}
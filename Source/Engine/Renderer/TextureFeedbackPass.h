@@ -0,0 +1,46 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+/// <summary>
+/// GPU feedback for the textures streaming (see Graphics::TextureStreamingFeedback). Periodically renders the main view meshes into a low-resolution buffer with the draw index and the texture resolution required by each visible pixel, reads it back a few frames later and reports the results to the streamed textures used by the drawn materials.
+/// </summary>
+class TextureFeedbackPass : public RendererPass<TextureFeedbackPass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUPipelineState* _psFeedback = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if the textures streaming uses the GPU feedback (otherwise meshes report the required resolution estimated on CPU).
+    /// </summary>
+    bool IsActive() const;
+
+    /// <summary>
+    /// Processes the feedback read back from the previous frames and renders the new one (does nothing if feedback is not used or not needed this frame).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _psFeedback->ReleaseGPU();
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
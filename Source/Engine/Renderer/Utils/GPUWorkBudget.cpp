@@ -0,0 +1,64 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "GPUWorkBudget.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUTimerQuery.h"
+
+GPUWorkBudget::~GPUWorkBudget()
+{
+    Release();
+}
+
+int32 GPUWorkBudget::GetItemsLimit(float budget, int32 minItems) const
+{
+    if (budget <= 0.0f || _itemCost <= ZeroTolerance)
+        return MAX_int32;
+    const float items = budget / _itemCost;
+    return items >= (float)MAX_int32 ? MAX_int32 : Math::Max((int32)items, minItems);
+}
+
+void GPUWorkBudget::Begin()
+{
+    // Gather results from the previous frames
+    for (Sample& sample : _samples)
+    {
+        if (sample.Items != 0 && sample.Timer->HasResult())
+        {
+            const float cost = sample.Timer->GetResult() / (float)sample.Items;
+            _itemCost = _itemCost > 0.0f ? Math::Lerp(_itemCost, cost, 0.2f) : cost;
+            sample.Items = 0;
+        }
+    }
+
+    // Skip measurement if all timers are still in-flight
+    Sample& sample = _samples[_current];
+    _measuring = sample.Items == 0;
+    if (!_measuring)
+        return;
+    if (!sample.Timer)
+        sample.Timer = GPUDevice::Instance->CreateTimerQuery();
+    sample.Timer->Begin();
+}
+
+void GPUWorkBudget::End(int32 items)
+{
+    if (!_measuring)
+        return;
+    _measuring = false;
+    Sample& sample = _samples[_current];
+    sample.Timer->End();
+    sample.Items = items;
+    _current = (_current + 1) % GPU_WORK_BUDGET_LATENCY;
+}
+
+void GPUWorkBudget::Release()
+{
+    for (Sample& sample : _samples)
+    {
+        SAFE_DELETE_GPU_RESOURCE(sample.Timer);
+        sample.Items = 0;
+    }
+    _measuring = false;
+    _itemCost = 0.0f;
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+class GPUTimerQuery;
+
+// The maximum amount of frames in-flight to measure
+#define GPU_WORK_BUDGET_LATENCY 4
+
+/// <summary>
+/// Helper for the GPU work amortized over frames to fit within the time budget. Measures the GPU time of the work items processed in a frame with the timer queries (results come with a few frames latency) to estimate the cost of a single item.
+/// </summary>
+class FLAXENGINE_API GPUWorkBudget
+{
+private:
+    struct Sample
+    {
+        GPUTimerQuery* Timer = nullptr;
+        int32 Items = 0;
+    };
+
+    Sample _samples[GPU_WORK_BUDGET_LATENCY];
+    int32 _current = 0;
+    bool _measuring = false;
+    float _itemCost = 0.0f;
+
+public:
+    ~GPUWorkBudget();
+
+public:
+    /// <summary>
+    /// Gets the estimated GPU time of a single work item (in milliseconds). Returns 0 if not measured yet.
+    /// </summary>
+    FORCE_INLINE float GetItemCost() const
+    {
+        return _itemCost;
+    }
+
+    /// <summary>
+    /// Gets the amount of work items that fit into the budget.
+    /// </summary>
+    /// <param name="budget">The GPU time budget (in milliseconds). Use 0 to disable limit.</param>
+    /// <param name="minItems">The minimum amount of items to process (prevents starvation).</param>
+    /// <returns>The items limit, MAX_int32 if budget is disabled or the cost is not measured yet.</returns>
+    int32 GetItemsLimit(float budget, int32 minItems = 1) const;
+
+    /// <summary>
+    /// Begins the work measurement. Call on the main context before the work commands.
+    /// </summary>
+    void Begin();
+
+    /// <summary>
+    /// Ends the work measurement.
+    /// </summary>
+    /// <param name="items">The amount of work items processed since Begin.</param>
+    void End(int32 items);
+
+    /// <summary>
+    /// Releases the timer queries.
+    /// </summary>
+    void Release();
+};
@@ -0,0 +1,116 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "InstanceCulling.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+#define INSTANCE_CULLING_GROUP_SIZE 64
+
+GPU_CB_STRUCT(Data {
+    Float4 FrustumPlanes[6];
+    uint32 ObjectsStartIndex;
+    uint32 InstancesCount;
+    uint32 OutputOffset;
+    uint32 ArgsOffset;
+    Float3 CullingPosition;
+    float CullDistance;
+    float CullDistanceRandomRange;
+    Float3 Padding;
+    });
+
+String InstanceCulling::ToString() const
+{
+    return TEXT("InstanceCulling");
+}
+
+bool InstanceCulling::Init()
+{
+    // Draw indirect and compute shaders support is required for this implementation
+    const auto& limits = GPUDevice::Instance->Limits;
+    if (!limits.HasDrawIndirect || !limits.HasCompute)
+        return false;
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/InstanceCulling"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<InstanceCulling, &InstanceCulling::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool InstanceCulling::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _cullCS = shader->GetCS("CS_CullInstances");
+
+    return false;
+}
+
+void InstanceCulling::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _cullCS = nullptr;
+    _shader = nullptr;
+}
+
+bool InstanceCulling::CanCull()
+{
+    return _shader && !checkIfSkipPass();
+}
+
+void InstanceCulling::Cull(GPUContext* context, const RenderView& view, const Float3& cullingPosition, GPUBuffer* objectsBuffer, GPUBuffer* argsBuffer, GPUBuffer* instancesBuffer, const Span<Batch>& batches)
+{
+    ASSERT(context && objectsBuffer && argsBuffer && instancesBuffer);
+    PROFILE_GPU_CPU("Instance Culling");
+
+    Data data;
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = view.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4(Float3(plane.Normal), (float)plane.D);
+    }
+    data.CullingPosition = cullingPosition;
+    data.Padding = Float3::Zero;
+    context->BindSR(0, objectsBuffer->View());
+    context->BindUA(0, argsBuffer->View());
+    context->BindUA(1, instancesBuffer->View());
+    for (const Batch& batch : batches)
+    {
+        data.ObjectsStartIndex = batch.ObjectsStartIndex;
+        data.InstancesCount = batch.InstancesCount;
+        data.OutputOffset = batch.OutputOffset;
+        data.ArgsOffset = batch.ArgsOffset;
+        data.CullDistance = batch.CullDistance;
+        data.CullDistanceRandomRange = batch.CullDistanceRandomRange;
+        context->UpdateCB(_cb, &data);
+        context->BindCB(0, _cb);
+        context->Dispatch(_cullCS, Math::DivideAndRoundUp<uint32>(batch.InstancesCount, INSTANCE_CULLING_GROUP_SIZE), 1, 1);
+    }
+    context->ResetUA();
+    context->ResetSR();
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+#include "Engine/Core/Types/Span.h"
+
+/// <summary>
+/// GPU-driven culling of the instanced draws. Compute shader tests every instance against the view frustum and writes the visible ones into the instances buffer and the draw indirect arguments, so the instanced batches are submitted with a single indirect draw without per-instance work on CPU.
+/// </summary>
+class InstanceCulling : public RendererPass<InstanceCulling>
+{
+public:
+    /// <summary>
+    /// The instanced draw to cull.
+    /// </summary>
+    struct Batch
+    {
+        // The index of the first instance object in the objects buffer.
+        uint32 ObjectsStartIndex;
+        // The amount of instances.
+        uint32 InstancesCount;
+        // The index of the first instance in the output instances buffer (the same value has to be set as StartInstance in draw arguments).
+        uint32 OutputOffset;
+        // The offset (in bytes) of the draw arguments (GPUDrawIndexedIndirectArgs) in the arguments buffer.
+        uint32 ArgsOffset;
+        // The maximum distance from the culling position to draw the instances at. Use 0 to disable distance culling.
+        float CullDistance;
+        // The cull distance range randomized per instance (scaled by the per-instance random value).
+        float CullDistanceRandomRange;
+    };
+
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _cullCS = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if GPU culling can be used (device supports it and shader is ready).
+    /// </summary>
+    bool CanCull();
+
+    /// <summary>
+    /// Culls the instanced draws. Arguments buffer must be prepared with zero InstanceCount for each batch.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="view">The render view to cull against.</param>
+    /// <param name="cullingPosition">The position used for the instances distance culling (relative to the view origin).</param>
+    /// <param name="objectsBuffer">The objects data buffer (see ShaderObjectData).</param>
+    /// <param name="argsBuffer">The output draw indirect arguments buffer (raw UAV with argument flag).</param>
+    /// <param name="instancesBuffer">The output instances buffer (R32_UInt UAV bound later as instance vertex buffer).</param>
+    /// <param name="batches">The instanced draws to cull.</param>
+    void Cull(GPUContext* context, const RenderView& view, const Float3& cullingPosition, GPUBuffer* objectsBuffer, GPUBuffer* argsBuffer, GPUBuffer* instancesBuffer, const Span<Batch>& batches);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _cullCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,182 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "LightClusters.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Renderer/RenderList.h"
+
+// The clusters grid size and the maximum amount of lights per cluster (must match LightClusters.hlsl)
+#define LIGHT_CLUSTERS_SIZE_X 16
+#define LIGHT_CLUSTERS_SIZE_Y 8
+#define LIGHT_CLUSTERS_SIZE_Z 24
+#define LIGHT_CLUSTERS_MAX_LIGHTS 31
+#define LIGHT_CLUSTERS_COUNT (LIGHT_CLUSTERS_SIZE_X * LIGHT_CLUSTERS_SIZE_Y * LIGHT_CLUSTERS_SIZE_Z)
+#define LIGHT_CLUSTERS_STRIDE (LIGHT_CLUSTERS_MAX_LIGHTS + 1)
+
+GPU_CB_STRUCT(Data {
+    Float2 ProjectionScale;
+    Float2 DepthParams;
+    uint32 LightsCount;
+    uint32 IsOrthographic;
+    Float2 Dummy0;
+    });
+
+// Custom render buffer for the view light clusters.
+class LightClustersCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    DynamicStructuredBuffer Lights;
+    DynamicTypedBuffer LightsBounds;
+    GPUBuffer* Grid = nullptr;
+    LightClustersData Data;
+
+    LightClustersCustomBuffer()
+        : Lights(64 * sizeof(ShaderLightData), sizeof(ShaderLightData), false, TEXT("LightClusters.Lights"))
+        , LightsBounds(64 * sizeof(Float4), PixelFormat::R32G32B32A32_Float, false, TEXT("LightClusters.LightsBounds"))
+    {
+    }
+
+    ~LightClustersCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(Grid);
+    }
+};
+
+bool LightClusters::IsDeferredClustered(const RenderLocalLightData& light)
+{
+    return !light.HasShadow && light.IESTexture == nullptr;
+}
+
+String LightClusters::ToString() const
+{
+    return TEXT("LightClusters");
+}
+
+bool LightClusters::Init()
+{
+    // Compute shaders support is required for this implementation
+    if (!GPUDevice::Instance->Limits.HasCompute)
+        return false;
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/LightClusters"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<LightClusters, &LightClusters::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool LightClusters::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _buildCS = shader->GetCS("CS_BuildClusters");
+
+    return false;
+}
+
+void LightClusters::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _buildCS = nullptr;
+    _shader = nullptr;
+}
+
+void LightClusters::Build(RenderContext& renderContext, GPUContext* context)
+{
+    RenderList* list = renderContext.List;
+    list->LightClusters = nullptr;
+    const int32 lightsCount = list->PointLights.Count() + list->SpotLights.Count();
+    if (!Graphics::ClusteredLighting || lightsCount == 0 || !_shader || checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Light Clusters");
+    const RenderView& view = renderContext.View;
+    auto& data = *renderContext.Buffers->GetCustomBuffer<LightClustersCustomBuffer>(TEXT("LightClusters"));
+    data.LastFrameUsed = Engine::FrameCount;
+    if (!data.Grid)
+    {
+        data.Grid = GPUDevice::Instance->CreateBuffer(TEXT("LightClusters.Grid"));
+        if (data.Grid->Init(GPUBufferDescription::Buffer(LIGHT_CLUSTERS_COUNT * LIGHT_CLUSTERS_STRIDE * sizeof(uint32), GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(uint32))))
+        {
+            SAFE_DELETE_GPU_RESOURCE(data.Grid);
+            return;
+        }
+    }
+
+    // Write lights (the ones rendered by the clustered deferred lighting go first)
+    data.Lights.Clear();
+    data.LightsBounds.Clear();
+    auto lights = data.Lights.WriteReserve<ShaderLightData>(lightsCount);
+    auto bounds = data.LightsBounds.WriteReserve<Float4>(lightsCount);
+    int32 count = 0, deferredCount = 0;
+    for (int32 pass = 0; pass < 2; pass++)
+    {
+        const bool deferred = pass == 0;
+        for (const RenderPointLightData& light : list->PointLights)
+        {
+            if (IsDeferredClustered(light) != deferred)
+                continue;
+            light.SetShaderData(lights[count], false);
+            bounds[count++] = Float4(Float3::Transform(light.Position, view.View), light.Radius);
+        }
+        for (const RenderSpotLightData& light : list->SpotLights)
+        {
+            if (IsDeferredClustered(light) != deferred)
+                continue;
+            light.SetShaderData(lights[count], false);
+            bounds[count++] = Float4(Float3::Transform(light.Position, view.View), light.Radius);
+        }
+        if (deferred)
+            deferredCount = count;
+    }
+    data.Lights.Flush(context);
+    data.LightsBounds.Flush(context);
+
+    // Build clusters
+    const float depthSlicesScale = (float)LIGHT_CLUSTERS_SIZE_Z / Math::Log2(view.Far / view.Near);
+    Data cb;
+    cb.ProjectionScale = Float2(view.Projection.M11, view.Projection.M22);
+    cb.DepthParams = Float2(depthSlicesScale, -Math::Log2(view.Near) * depthSlicesScale);
+    cb.LightsCount = lightsCount;
+    cb.IsOrthographic = view.IsOrthographicProjection() ? 1 : 0;
+    context->UpdateCB(_cb, &cb);
+    context->BindCB(0, _cb);
+    context->BindSR(0, data.LightsBounds.GetBuffer()->View());
+    context->BindUA(0, data.Grid->View());
+    context->Dispatch(_buildCS, LIGHT_CLUSTERS_SIZE_X / 4, LIGHT_CLUSTERS_SIZE_Y / 4, LIGHT_CLUSTERS_SIZE_Z / 4);
+    context->ResetUA();
+    context->ResetSR();
+
+    data.Data.Lights = data.Lights.GetBuffer()->View();
+    data.Data.Grid = data.Grid->View();
+    data.Data.Params = Float4(cb.DepthParams.X, cb.DepthParams.Y, (float)deferredCount, (float)lightsCount);
+    list->LightClusters = &data.Data;
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+#include "Engine/Core/Math/Vector4.h"
+
+struct RenderLocalLightData;
+
+/// <summary>
+/// The clustered lights data of the view (valid during the frame rendering).
+/// </summary>
+struct LightClustersData
+{
+    // The lights buffer (structured buffer with ShaderLightData, point lights first).
+    GPUBufferView* Lights;
+    // The clusters grid buffer (see LIGHT_CLUSTERS_STRIDE in LightClusters.hlsl).
+    GPUBufferView* Grid;
+    // The clusters params: xy - depth slices scale and bias, z - amount of lights rendered by the clustered deferred lighting (placed first in the lights buffer), w - amount of lights.
+    Float4 Params;
+};
+
+/// <summary>
+/// Clustered lights culling. Splits the view frustum into froxels (screen tiles with exponential depth slices) and builds the list of local lights affecting each of them in a compute shader. Clusters are used by the deferred lighting to render all unshadowed local lights in a single fullscreen pass and by the forward shading materials to get all local lights (instead of a few nearest ones).
+/// </summary>
+class LightClusters : public RendererPass<LightClusters>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _buildCS = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if the local light can be rendered by the clustered deferred lighting (otherwise it has to be rendered separately, eg. with the shadow).
+    /// </summary>
+    /// <param name="light">The light.</param>
+    /// <returns>True if light is clustered in the deferred lighting, otherwise false.</returns>
+    static bool IsDeferredClustered(const RenderLocalLightData& light);
+
+    /// <summary>
+    /// Builds the light clusters for the view local lights and assigns them to the render list (does nothing if clustered lighting is disabled).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Build(RenderContext& renderContext, GPUContext* context);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _buildCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
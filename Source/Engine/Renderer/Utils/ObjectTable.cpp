@@ -0,0 +1,223 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ObjectTable.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Utilities/Crc.h"
+
+// The amount of builds after which the slot not used by any draw call is freed
+#define OBJECT_TABLE_MAX_AGE 4
+
+#define OBJECT_TABLE_GROUP_SIZE 64
+
+GPU_CB_STRUCT(Data {
+    uint32 ObjectsCount;
+    Float3 Dummy0;
+    });
+
+ObjectTable::ObjectTable()
+    : _uploadObjects(0, PixelFormat::R32G32B32A32_Float, false, TEXT("ObjectTable.UploadObjects"))
+    , _uploadIndices(0, PixelFormat::R32_UInt, false, TEXT("ObjectTable.UploadIndices"))
+{
+}
+
+ObjectTable::~ObjectTable()
+{
+    SAFE_DELETE_GPU_RESOURCE(_buffer);
+}
+
+void ObjectTable::Build(const RenderListBuffer<DrawCall>& drawCalls, RenderListBuffer<BatchedDrawCall>& batchedDrawCalls)
+{
+    PROFILE_CPU();
+    _frame++;
+    _dirtySlots.Clear();
+
+    // Find the slot of each draw call object (allocate a new one if object data has changed)
+    const int32 drawCallsCount = drawCalls.Count();
+    const DrawCall* drawCallsData = drawCalls.Get();
+    ObjectIndices.Resize(drawCallsCount, false);
+    _slotsData.Resize(_slotsCount, false);
+    for (int32 i = 0; i < drawCallsCount; i++)
+    {
+        ShaderObjectData data;
+        data.Store(drawCallsData[i]);
+        const uint32 hash = Crc::MemCrc32(&data, sizeof(data));
+        int32 slot;
+        const int32* slotPtr = _slotsLookup.TryGet(hash);
+        if (slotPtr && Platform::MemoryCompare(&_slotsData.Get()[*slotPtr], &data, sizeof(data)) == 0)
+        {
+            slot = *slotPtr;
+        }
+        else
+        {
+            if (_freeSlots.HasItems())
+            {
+                slot = _freeSlots.Pop();
+            }
+            else
+            {
+                slot = _slotsCount++;
+                _slotsData.AddUninitialized();
+                _slotsFrame.Add(0);
+                _slotsHash.Add(0);
+            }
+            _slotsData.Get()[slot] = data;
+            _slotsHash.Get()[slot] = hash;
+            if (!slotPtr)
+                _slotsLookup.Add(hash, slot); // Hash collision with the other object uses slot that cannot be found by lookup (freed after some time)
+            _dirtySlots.Add(slot);
+        }
+        _slotsFrame.Get()[slot] = _frame;
+        ObjectIndices.Get()[i] = slot;
+    }
+
+    // Free unused slots
+    for (int32 slot = 0; slot < _slotsCount; slot++)
+    {
+        uint64& slotFrame = _slotsFrame.Get()[slot];
+        if (slotFrame != 0 && slotFrame + OBJECT_TABLE_MAX_AGE < _frame)
+        {
+            slotFrame = 0;
+            const uint32 hash = _slotsHash.Get()[slot];
+            const int32* slotPtr = _slotsLookup.TryGet(hash);
+            if (slotPtr && *slotPtr == slot)
+                _slotsLookup.Remove(hash);
+            _freeSlots.Add(slot);
+        }
+    }
+
+    // Place batched instances after the persistent slots (always uploaded)
+    int32 startIndex = _slotsCount;
+    for (auto& batch : batchedDrawCalls)
+    {
+        batch.ObjectsStartIndex = startIndex;
+        _slotsData.Add(batch.Instances.Get(), batch.Instances.Count());
+        for (int32 i = 0; i < batch.Instances.Count(); i++)
+            _dirtySlots.Add(startIndex + i);
+        startIndex += batch.Instances.Count();
+    }
+
+    // Prepare upload data
+    _uploadObjects.Clear();
+    _uploadIndices.Clear();
+    if (_dirtySlots.HasItems())
+    {
+        _uploadObjects.Data.Resize(_dirtySlots.Count() * sizeof(ShaderObjectData));
+        auto* dst = (ShaderObjectData*)_uploadObjects.Data.Get();
+        for (const uint32 slot : _dirtySlots)
+            *dst++ = _slotsData.Get()[slot];
+        _uploadIndices.Write(_dirtySlots.Get(), _dirtySlots.Count() * sizeof(uint32));
+    }
+    ZoneValue(_dirtySlots.Count());
+}
+
+void ObjectTable::Flush(GPUContext* context)
+{
+    const int32 count = _slotsData.Count();
+    if (count == 0)
+        return;
+    PROFILE_CPU();
+
+    // Ensure the table capacity (recreated buffer needs the whole table data)
+    bool uploadAll = false;
+    if (!_buffer)
+        _buffer = GPUDevice::Instance->CreateBuffer(TEXT("ObjectTable"));
+    if (_buffer->GetSize() < count * sizeof(ShaderObjectData))
+    {
+        const int32 capacity = Math::RoundUpToPowerOf2(Math::Max(count, 1024));
+        if (_buffer->Init(GPUBufferDescription::Buffer(capacity * sizeof(ShaderObjectData), GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32G32B32A32_Float, nullptr, sizeof(Float4))))
+            return;
+        uploadAll = true;
+    }
+
+    if (uploadAll || !ObjectTablePass::Instance()->CanScatter())
+    {
+        context->UpdateBuffer(_buffer, _slotsData.Get(), count * sizeof(ShaderObjectData));
+    }
+    else if (_dirtySlots.HasItems())
+    {
+        _uploadObjects.Flush(context);
+        _uploadIndices.Flush(context);
+        ObjectTablePass::Instance()->Scatter(context, _buffer, _uploadObjects.GetBuffer(), _uploadIndices.GetBuffer(), _dirtySlots.Count());
+    }
+    _dirtySlots.Clear();
+}
+
+String ObjectTablePass::ToString() const
+{
+    return TEXT("ObjectTablePass");
+}
+
+bool ObjectTablePass::Init()
+{
+    // Compute shaders support is required for this implementation
+    if (!GPUDevice::Instance->Limits.HasCompute)
+        return false;
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ObjectTable"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<ObjectTablePass, &ObjectTablePass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool ObjectTablePass::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _scatterCS = shader->GetCS("CS_Scatter");
+
+    return false;
+}
+
+void ObjectTablePass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _scatterCS = nullptr;
+    _shader = nullptr;
+}
+
+bool ObjectTablePass::CanScatter()
+{
+    return _shader && !checkIfSkipPass();
+}
+
+void ObjectTablePass::Scatter(GPUContext* context, GPUBuffer* objects, GPUBuffer* uploadObjects, GPUBuffer* uploadIndices, uint32 count)
+{
+    ASSERT(context && objects && uploadObjects && uploadIndices);
+    PROFILE_GPU_CPU("Objects Scatter");
+    Data data;
+    data.ObjectsCount = count;
+    context->UpdateCB(_cb, &data);
+    context->BindCB(0, _cb);
+    context->BindSR(0, uploadObjects->View());
+    context->BindSR(1, uploadIndices->View());
+    context->BindUA(0, objects->View());
+    context->Dispatch(_scatterCS, Math::DivideAndRoundUp<uint32>(count * 8, OBJECT_TABLE_GROUP_SIZE), 1, 1);
+    context->ResetUA();
+    context->ResetSR();
+}
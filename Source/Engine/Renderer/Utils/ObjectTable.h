@@ -0,0 +1,102 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+#include "../RenderList.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+
+/// <summary>
+/// Persistent objects buffer with stable slots for the draw calls objects data (ShaderObjectData) that is kept on GPU between frames. Slots are addressed by the object data content so objects that didn't change since the previous frames (eg. static geometry) keep using their slot and are not uploaded again. Only new entries are uploaded and written into the table with a scatter compute pass.
+/// </summary>
+class FLAXENGINE_API ObjectTable
+{
+private:
+    Dictionary<uint32, int32> _slotsLookup;
+    Array<ShaderObjectData> _slotsData;
+    Array<uint64> _slotsFrame;
+    Array<uint32> _slotsHash;
+    Array<int32> _freeSlots;
+    Array<uint32> _dirtySlots;
+    int32 _slotsCount = 0;
+    uint64 _frame = 0;
+    DynamicTypedBuffer _uploadObjects;
+    DynamicTypedBuffer _uploadIndices;
+    GPUBuffer* _buffer = nullptr;
+
+public:
+    ObjectTable();
+    ~ObjectTable();
+
+public:
+    /// <summary>
+    /// The object slot index of each draw call (from the last Build).
+    /// </summary>
+    Array<uint32> ObjectIndices;
+
+    /// <summary>
+    /// Gets the GPU buffer with objects (valid after Flush).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetBuffer() const
+    {
+        return _buffer;
+    }
+
+    /// <summary>
+    /// Assigns the slots to the draw calls objects and collects the entries to upload. Batched draw calls instances are placed after the persistent slots (updates ObjectsStartIndex). Can be executed in async.
+    /// </summary>
+    /// <param name="drawCalls">The draw calls.</param>
+    /// <param name="batchedDrawCalls">The batched draw calls.</param>
+    void Build(const RenderListBuffer<DrawCall>& drawCalls, RenderListBuffer<BatchedDrawCall>& batchedDrawCalls);
+
+    /// <summary>
+    /// Uploads the new objects data into the GPU buffer.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    void Flush(GPUContext* context);
+};
+
+/// <summary>
+/// Scatter upload for the persistent objects table (see ObjectTable).
+/// </summary>
+class ObjectTablePass : public RendererPass<ObjectTablePass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _scatterCS = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if scatter upload can be used (device supports it and shader is ready).
+    /// </summary>
+    bool CanScatter();
+
+    /// <summary>
+    /// Writes the uploaded objects into their slots in the objects buffer.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="objects">The output objects buffer (typed UAV).</param>
+    /// <param name="uploadObjects">The uploaded objects data.</param>
+    /// <param name="uploadIndices">The uploaded objects slots (R32_UInt).</param>
+    /// <param name="count">The amount of the uploaded objects.</param>
+    void Scatter(GPUContext* context, GPUBuffer* objects, GPUBuffer* uploadObjects, GPUBuffer* uploadIndices, uint32 count);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _scatterCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,308 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "OcclusionCulling.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Async/GPUSyncPoint.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Renderer/RenderList.h"
+
+// The maximum resolution of the Hi-Z (along the longer side of the view)
+#define OCCLUSION_CULLING_RESOLUTION 256
+
+// The amount of readback buffers (GPU is a few frames behind CPU)
+#define OCCLUSION_CULLING_FRAMES (GPU_ASYNC_LATENCY + 1)
+
+// The maximum age (in frames) of the Hi-Z to use for culling (older depth is too different from the current view)
+#define OCCLUSION_CULLING_MAX_AGE 8
+
+GPU_CB_STRUCT(Data {
+    uint32 DepthWidth;
+    uint32 DepthHeight;
+    uint32 HiZWidth;
+    uint32 HiZHeight;
+    Float2 TileSize;
+    Float2 Dummy0;
+    });
+
+// Custom render buffer for the view occlusion culling (Hi-Z readback).
+class OcclusionCullingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    struct Frame
+    {
+        GPUBuffer* Staging = nullptr;
+        uint64 FrameIndex = 0;
+        Matrix ViewProjection;
+        Vector3 Origin;
+        int32 Width = 0;
+        int32 Height = 0;
+    };
+
+    GPUBuffer* HiZ = nullptr;
+    Frame Frames[OCCLUSION_CULLING_FRAMES];
+    uint64 BufferFrameIndex = 0;
+    OcclusionBuffer Buffer;
+
+    ~OcclusionCullingCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(HiZ);
+        for (Frame& frame : Frames)
+            SAFE_DELETE_GPU_RESOURCE(frame.Staging);
+    }
+};
+
+bool OcclusionBuffer::IsOccluded(const BoundingSphere& bounds) const
+{
+    // Project bounds box into the captured view
+    const Float3 center = bounds.Center - Origin;
+    const float radius = (float)bounds.Radius;
+    Float3 min(MAX_float), max(MIN_float);
+    for (int32 i = 0; i < 8; i++)
+    {
+        const Float3 corner(center.X + (i & 1 ? radius : -radius), center.Y + (i & 2 ? radius : -radius), center.Z + (i & 4 ? radius : -radius));
+        Float4 position;
+        Float3::Transform(corner, ViewProjection, position);
+        if (position.W <= ZeroTolerance)
+            return false; // Crosses the near plane
+        const Float3 ndc = Float3(position) / position.W;
+        min = Float3::Min(min, ndc);
+        max = Float3::Max(max, ndc);
+    }
+    if (min.X < -1.0f || max.X > 1.0f || min.Y < -1.0f || max.Y > 1.0f)
+        return false; // Not fully inside the captured view (no depth data)
+
+    // Find the depth mip where bounds cover at most 2x2 texels
+    const Mip* mip = Mips.Get();
+    int32 x0 = Math::Clamp((int32)((min.X * 0.5f + 0.5f) * (float)mip->Width), 0, mip->Width - 1);
+    int32 x1 = Math::Clamp((int32)((max.X * 0.5f + 0.5f) * (float)mip->Width), 0, mip->Width - 1);
+    int32 y0 = Math::Clamp((int32)((0.5f - max.Y * 0.5f) * (float)mip->Height), 0, mip->Height - 1);
+    int32 y1 = Math::Clamp((int32)((0.5f - min.Y * 0.5f) * (float)mip->Height), 0, mip->Height - 1);
+    const Mip* mipLast = mip + Mips.Count() - 1;
+    while ((x1 - x0 > 1 || y1 - y0 > 1) && mip != mipLast)
+    {
+        x0 >>= 1;
+        x1 >>= 1;
+        y0 >>= 1;
+        y1 >>= 1;
+        mip++;
+    }
+
+    // Bounds are visible if their nearest point is in front of the farthest depth of any covered texel
+    const float* depth = Depth.Get() + mip->Offset;
+    for (int32 y = y0; y <= y1; y++)
+    {
+        for (int32 x = x0; x <= x1; x++)
+        {
+            if (min.Z <= depth[y * mip->Width + x])
+                return false;
+        }
+    }
+    return true;
+}
+
+String OcclusionCulling::ToString() const
+{
+    return TEXT("OcclusionCulling");
+}
+
+bool OcclusionCulling::Init()
+{
+    // Compute shaders support is required for this implementation
+    if (!GPUDevice::Instance->Limits.HasCompute)
+        return false;
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/OcclusionCulling"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<OcclusionCulling, &OcclusionCulling::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool OcclusionCulling::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _buildCS = shader->GetCS("CS_BuildHiZ");
+
+    return false;
+}
+
+void OcclusionCulling::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _cb = nullptr;
+    _buildCS = nullptr;
+    _shader = nullptr;
+}
+
+void OcclusionCulling::Prepare(RenderContext& renderContext)
+{
+    const RenderView& view = renderContext.View;
+    RenderList* list = renderContext.List;
+    list->Occlusion = nullptr;
+    list->Setup.UseOcclusionCulling = view.IsOcclusionCullingEnabled &&
+            !view.IsOfflinePass &&
+            !view.IsSingleFrame &&
+            !view.IsCullingDisabled &&
+            _shader &&
+            !checkIfSkipPass();
+    if (!list->Setup.UseOcclusionCulling)
+        return;
+    PROFILE_CPU();
+    auto& data = *renderContext.Buffers->GetCustomBuffer<OcclusionCullingCustomBuffer>(TEXT("OcclusionCulling"));
+    data.LastFrameUsed = Engine::FrameCount;
+    if (renderContext.Task && renderContext.Task->IsCameraCut)
+    {
+        // Discard the depth from the previous frames
+        for (auto& frame : data.Frames)
+            frame.FrameIndex = 0;
+        data.BufferFrameIndex = 0;
+        return;
+    }
+
+    // Get the latest depth that GPU has finished with (accept staging readback delay)
+    OcclusionCullingCustomBuffer::Frame* ready = nullptr;
+    for (auto& frame : data.Frames)
+    {
+        if (frame.FrameIndex != 0 && Engine::FrameCount - frame.FrameIndex >= GPU_ASYNC_LATENCY && (!ready || frame.FrameIndex > ready->FrameIndex))
+            ready = &frame;
+    }
+    if (ready)
+    {
+        const float* mapped = (const float*)ready->Staging->Map(GPUResourceMapMode::Read);
+        if (mapped)
+        {
+            // Build the depth pyramid (each texel contains the farthest depth of the higher mip texels it covers)
+            OcclusionBuffer& buffer = data.Buffer;
+            buffer.ViewProjection = ready->ViewProjection;
+            buffer.Origin = ready->Origin;
+            buffer.Mips.Clear();
+            int32 size = 0;
+            for (int32 width = ready->Width, height = ready->Height;; width = Math::Max((width + 1) / 2, 1), height = Math::Max((height + 1) / 2, 1))
+            {
+                buffer.Mips.Add({ size, width, height });
+                size += width * height;
+                if (width == 1 && height == 1)
+                    break;
+            }
+            buffer.Depth.Resize(size, false);
+            Platform::MemoryCopy(buffer.Depth.Get(), mapped, ready->Width * ready->Height * sizeof(float));
+            ready->Staging->Unmap();
+            for (int32 mipIndex = 1; mipIndex < buffer.Mips.Count(); mipIndex++)
+            {
+                const OcclusionBuffer::Mip& src = buffer.Mips[mipIndex - 1];
+                const OcclusionBuffer::Mip& dst = buffer.Mips[mipIndex];
+                const float* srcDepth = buffer.Depth.Get() + src.Offset;
+                float* dstDepth = buffer.Depth.Get() + dst.Offset;
+                for (int32 y = 0; y < dst.Height; y++)
+                {
+                    const int32 y0 = y * 2 * src.Width, y1 = Math::Min(y * 2 + 1, src.Height - 1) * src.Width;
+                    for (int32 x = 0; x < dst.Width; x++)
+                    {
+                        const int32 x0 = x * 2, x1 = Math::Min(x * 2 + 1, src.Width - 1);
+                        dstDepth[y * dst.Width + x] = Math::Max(Math::Max(srcDepth[y0 + x0], srcDepth[y0 + x1]), Math::Max(srcDepth[y1 + x0], srcDepth[y1 + x1]));
+                    }
+                }
+            }
+            data.BufferFrameIndex = ready->FrameIndex;
+        }
+
+        // Free the older frames too
+        const uint64 readyFrameIndex = ready->FrameIndex;
+        for (auto& frame : data.Frames)
+        {
+            if (frame.FrameIndex <= readyFrameIndex)
+                frame.FrameIndex = 0;
+        }
+    }
+    if (data.BufferFrameIndex != 0 && Engine::FrameCount - data.BufferFrameIndex <= OCCLUSION_CULLING_MAX_AGE)
+        list->Occlusion = &data.Buffer;
+}
+
+void OcclusionCulling::Render(RenderContext& renderContext, GPUContext* context)
+{
+    if (!renderContext.List->Setup.UseOcclusionCulling || checkIfSkipPass())
+        return;
+    PROFILE_GPU_CPU("Occlusion Culling");
+    const RenderView& view = renderContext.View;
+    auto& data = *renderContext.Buffers->GetCustomBuffer<OcclusionCullingCustomBuffer>(TEXT("OcclusionCulling"));
+    data.LastFrameUsed = Engine::FrameCount;
+
+    // Pick a free readback buffer (or the oldest one)
+    OcclusionCullingCustomBuffer::Frame* frame = &data.Frames[0];
+    for (auto& e : data.Frames)
+    {
+        if (e.FrameIndex < frame->FrameIndex)
+            frame = &e;
+    }
+    const uint32 maxSize = OCCLUSION_CULLING_RESOLUTION * OCCLUSION_CULLING_RESOLUTION * sizeof(float);
+    if (!data.HiZ)
+    {
+        data.HiZ = GPUDevice::Instance->CreateBuffer(TEXT("OcclusionCulling.HiZ"));
+        if (data.HiZ->Init(GPUBufferDescription::Buffer(maxSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_Float, nullptr, sizeof(float))))
+            return;
+    }
+    if (!frame->Staging)
+    {
+        frame->Staging = GPUDevice::Instance->CreateBuffer(TEXT("OcclusionCulling.Staging"));
+        if (frame->Staging->Init(GPUBufferDescription::Buffer(maxSize, GPUBufferFlags::None, PixelFormat::R32_Float, nullptr, sizeof(float), GPUResourceUsage::StagingReadback)))
+            return;
+    }
+
+    // Build Hi-Z from the scene depth
+    GPUTexture* depthBuffer = renderContext.Buffers->DepthBuffer;
+    const int32 depthWidth = depthBuffer->Width(), depthHeight = depthBuffer->Height();
+    const float scale = Math::Min((float)OCCLUSION_CULLING_RESOLUTION / (float)Math::Max(depthWidth, depthHeight), 1.0f);
+    const int32 width = Math::Clamp(Math::CeilToInt((float)depthWidth * scale), 1, OCCLUSION_CULLING_RESOLUTION);
+    const int32 height = Math::Clamp(Math::CeilToInt((float)depthHeight * scale), 1, OCCLUSION_CULLING_RESOLUTION);
+    Data cb;
+    cb.DepthWidth = depthWidth;
+    cb.DepthHeight = depthHeight;
+    cb.HiZWidth = width;
+    cb.HiZHeight = height;
+    cb.TileSize = Float2((float)depthWidth / (float)width, (float)depthHeight / (float)height);
+    context->ResetRenderTarget();
+    context->UpdateCB(_cb, &cb);
+    context->BindCB(0, _cb);
+    context->BindSR(0, depthBuffer);
+    context->BindUA(0, data.HiZ->View());
+    context->Dispatch(_buildCS, width, height, 1);
+    context->ResetUA();
+    context->ResetSR();
+
+    // Copy Hi-Z for the readback in the next frames
+    context->CopyBuffer(frame->Staging, data.HiZ, width * height * sizeof(float));
+    frame->FrameIndex = Engine::FrameCount;
+    frame->ViewProjection = view.ViewProjection();
+    frame->Origin = view.Origin;
+    frame->Width = width;
+    frame->Height = height;
+}
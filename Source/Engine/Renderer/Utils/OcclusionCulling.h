@@ -0,0 +1,80 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// The CPU copy of the view hierarchical depth (Hi-Z) rendered by the GPU in one of the previous frames. Used to test objects bounds occlusion before drawing them.
+/// </summary>
+struct FLAXENGINE_API OcclusionBuffer
+{
+    struct Mip
+    {
+        int32 Offset;
+        int32 Width;
+        int32 Height;
+    };
+
+    // The view-projection matrix used to render the depth (relative to the Origin).
+    Matrix ViewProjection;
+    // The view origin used to render the depth.
+    Vector3 Origin;
+    // The depth pyramid mips (the first one, with the highest resolution come from the GPU).
+    Array<Mip, FixedAllocation<16>> Mips;
+    // The farthest depth of each texel (all mips, row by row).
+    Array<float> Depth;
+
+    /// <summary>
+    /// Checks if the bounds are fully hidden behind the captured depth. Bounds that are not fully inside the captured view are considered as visible.
+    /// </summary>
+    /// <param name="bounds">The world-space bounds to test.</param>
+    /// <returns>True if bounds are occluded, otherwise false.</returns>
+    bool IsOccluded(const BoundingSphere& bounds) const;
+};
+
+/// <summary>
+/// Occlusion culling based on the depth buffer from the previous frames. Builds a low-resolution Hi-Z from the scene depth on GPU, reads it back a few frames later and tests actors and draw calls bounds against it (reprojected into the view that rendered the depth) to skip drawing fully occluded geometry.
+/// </summary>
+class OcclusionCulling : public RendererPass<OcclusionCulling>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUConstantBuffer* _cb = nullptr;
+    GPUShaderProgramCS* _buildCS = nullptr;
+
+public:
+    /// <summary>
+    /// Setups the occlusion culling for the view rendering. Gets the latest Hi-Z that has been read back from GPU and assigns it to the render list to be used when collecting draw calls.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    void Prepare(RenderContext& renderContext);
+
+    /// <summary>
+    /// Builds the Hi-Z from the current scene depth and copies it into the readback buffer for the next frames (does nothing if occlusion culling is not used by the view).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _buildCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
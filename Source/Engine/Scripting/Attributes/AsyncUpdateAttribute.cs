@@ -0,0 +1,20 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System;
+
+namespace FlaxEngine
+{
+    /// <summary>
+    /// Makes a script OnUpdate execute in parallel with the other async scripts on job system threads (after the regular scripts update and before the late update). Use it only for scripts which update is thread-safe (eg. modifies only its own state or its actor transform).
+    /// </summary>
+    [AttributeUsage(AttributeTargets.Class)]
+    public sealed class AsyncUpdateAttribute : Attribute
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AsyncUpdateAttribute"/> class.
+        /// </summary>
+        public AsyncUpdateAttribute()
+        {
+        }
+    }
+}
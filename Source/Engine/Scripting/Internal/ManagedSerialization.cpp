@@ -3,6 +3,7 @@
 #include "ManagedSerialization.h"
 #if USE_CSHARP
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Cache.h"
 #include "Engine/Serialization/Json.h"
 #include "Engine/Serialization/JsonWriter.h"
 #include "Engine/Scripting/ManagedCLR/MException.h"
@@ -87,11 +88,11 @@ void ManagedSerialization::Deserialize(ISerializable::DeserializeStream& stream,
         return;
 
     // Get serialized data
-    rapidjson_flax::StringBuffer buffer;
-    rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(buffer);
+    auto buffer = Cache::JsonBuffer.Get();
+    rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(*buffer.Value);
     stream.Accept(writer);
 
-    Deserialize(StringAnsiView(buffer.GetString(), (int32)buffer.GetSize()), object);
+    Deserialize(StringAnsiView(buffer->GetString(), (int32)buffer->GetSize()), object);
 }
 
 void ManagedSerialization::Deserialize(const StringAnsiView& data, MObject* object)
@@ -42,6 +42,7 @@ void StdTypesContainer::Clear()
 
     ManagedArrayClass = nullptr;
 
+    AsyncUpdateAttribute = nullptr;
 #if USE_EDITOR
     ExecuteInEditModeAttribute = nullptr;
 #endif
@@ -92,6 +93,7 @@ bool StdTypesContainer::Gather()
 
     GET_CLASS(FlaxEngine, ManagedArrayClass, "FlaxEngine.Interop.ManagedArray");
 
+    GET_CLASS(FlaxEngine, AsyncUpdateAttribute, "FlaxEngine.AsyncUpdateAttribute");
 #if USE_EDITOR
     GET_CLASS(FlaxEngine, ExecuteInEditModeAttribute, "FlaxEngine.ExecuteInEditModeAttribute");
 #endif
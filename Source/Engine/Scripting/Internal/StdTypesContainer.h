@@ -47,6 +47,7 @@ class FLAXENGINE_API StdTypesContainer : public Singleton<StdTypesContainer>
 
     MClass* ManagedArrayClass;
 
+    MClass* AsyncUpdateAttribute;
 #if USE_EDITOR
     MClass* ExecuteInEditModeAttribute;
 #endif
@@ -558,7 +558,7 @@ Variant MUtils::UnboxVariant(MObject* value)
             const ScriptingType& type = typeHandle.GetType();
             Variant v;
             v.Type = MoveTemp(VariantType(VariantType::Structure, fullname));
-            v.AsBlob.Data = Allocator::Allocate(type.Size);
+            v.AsBlob.Data = Variant::AllocateBlob(type.Size);
             v.AsBlob.Length = type.Size;
             type.Struct.Ctor(v.AsBlob.Data);
             type.Struct.Unbox(v.AsBlob.Data, value);
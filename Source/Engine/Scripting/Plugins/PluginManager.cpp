@@ -136,6 +136,8 @@ class PluginManagerService : public EngineService
     PluginManagerService()
         : EngineService(TEXT("Plugin Manager"), 100)
     {
+        // Plugins code can use any of the engine systems
+        Dependencies.Add(TEXT("Audio"));
     }
 
     bool Init() override;
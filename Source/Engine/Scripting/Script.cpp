@@ -2,9 +2,10 @@
 
 #include "Script.h"
 #include "Engine/Core/Log.h"
-#if USE_EDITOR
 #include "Internal/StdTypesContainer.h"
 #include "ManagedCLR/MClass.h"
+#include "BinaryModule.h"
+#if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
 #include "Scripting.h"
@@ -27,10 +28,14 @@ Script::Script(const SpawnParams& params)
     , _tickUpdate(false)
     , _tickLateUpdate(false)
     , _tickLateFixedUpdate(false)
+    , _tickUpdateAsync(false)
+    , _tickManaged(false)
     , _wasAwakeCalled(false)
     , _wasStartCalled(false)
     , _wasEnableCalled(false)
 {
+    const auto asyncUpdateAttribute = StdTypesContainer::Instance()->AsyncUpdateAttribute;
+    _tickUpdateAsync = asyncUpdateAttribute && GetClass()->HasAttribute(asyncUpdateAttribute);
 #if USE_EDITOR
     _executeInEditor = GetClass()->HasAttribute(StdTypesContainer::Instance()->ExecuteInEditModeAttribute);
 #endif
@@ -43,6 +48,7 @@ void Script::SetEnabled(bool value)
     {
         // Change state
         _enabled = value;
+        MarkDirty();
 
         // Call event for the script
         if (_parent == nullptr || (_parent->IsDuringPlay() && _parent->IsActiveInHierarchy()))
@@ -99,6 +105,7 @@ void Script::SetParent(Actor* value, bool canBreakPrefabLink)
     // Set value
     const auto previous = _parent;
     _parent = value;
+    MarkDirty();
 
     // Link to the new one
     if (_parent)
@@ -175,6 +182,9 @@ void Script::SetupType()
 {
     // Enable tick functions based on the method overriden in C# or Visual Script
     ScriptingTypeHandle typeHandle = GetTypeHandle();
+#if !COMPILE_WITHOUT_CSHARP
+    _tickManaged = typeHandle.GetType().Script.Spawn == &ManagedBinaryModule::ManagedObjectSpawn;
+#endif
     while (typeHandle != Script::TypeInitializer)
     {
         auto& type = typeHandle.GetType();
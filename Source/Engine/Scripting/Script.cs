@@ -1,5 +1,8 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
+using System;
+using System.Runtime.InteropServices;
+
 namespace FlaxEngine
 {
     partial class Script
@@ -42,5 +45,53 @@ public Transform LocalTransform
             get => Actor.LocalTransform;
             set => Actor.LocalTransform = value;
         }
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct ManagedDirectCall
+        {
+            public IntPtr Object;
+            public int ScriptVTableIndex;
+        }
+
+        /// <summary>
+        /// Calls the tick method of the scripts in a batch (single call from the native code for many scripts). Matches SceneTicking::TickData::CallScripts.
+        /// </summary>
+        internal static unsafe void Internal_TickScripts(Script[] scripts, int count, int scriptVTableIndex, IntPtr directCall)
+        {
+            // Mark the method as called directly so the base method call goes to the native implementation instead of calling the override again (see Scripting::IsManagedDirectCall)
+            var call = (ManagedDirectCall*)directCall;
+            call->ScriptVTableIndex = scriptVTableIndex;
+            for (int i = 0; i < count; i++)
+            {
+                var script = scripts[i];
+                call->Object = script.__unmanagedPtr;
+                try
+                {
+                    switch (scriptVTableIndex)
+                    {
+                    case 8:
+                        script.OnUpdate();
+                        break;
+                    case 9:
+                        script.OnLateUpdate();
+                        break;
+                    case 10:
+                        script.OnFixedUpdate();
+                        break;
+                    case 11:
+                        script.OnLateFixedUpdate();
+                        break;
+                    }
+                }
+                catch (Exception ex)
+                {
+                    Debug.LogException(ex, script);
+                }
+            }
+            call->Object = IntPtr.Zero;
+
+            // Release references to the scripts
+            Array.Clear(scripts, 0, count);
+        }
     }
 }
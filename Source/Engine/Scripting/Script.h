@@ -20,6 +20,10 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
     uint16 _tickUpdate : 1;
     uint16 _tickLateUpdate : 1;
     uint16 _tickLateFixedUpdate : 1;
+    // Script OnUpdate is thread-safe and can be called in parallel with the other async scripts (see AsyncUpdateAttribute)
+    uint16 _tickUpdateAsync : 1;
+    // Script type is implemented in C# so its tick methods can be called in batches by the managed code (see SceneTicking)
+    uint16 _tickManaged : 1;
     uint16 _wasAwakeCalled : 1;
     uint16 _wasStartCalled : 1;
     uint16 _wasEnableCalled : 1;
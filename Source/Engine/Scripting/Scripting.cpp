@@ -23,6 +23,7 @@
 #include "Internal/StdTypesContainer.h"
 #include "Engine/Core/LogContext.h"
 #include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Core/Types/Stopwatch.h"
 #include "Engine/Content/Asset.h"
@@ -32,7 +33,10 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Serialization/JsonTools.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 
 extern void registerFlaxEngineInternalCalls();
 
@@ -58,7 +62,6 @@ namespace
 {
     MDomain* _rootDomain = nullptr;
     MDomain* _scriptsDomain = nullptr;
-    CriticalSection _objectsLocker;
 #define USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING 0
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     struct ScriptingObjectData
@@ -82,22 +85,60 @@ namespace
         {
             return Ptr;
         }
+    };
 
-        explicit operator ScriptingObject*()
-        {
-            return Ptr;
-        }
+    FORCE_INLINE ScriptingObject* GetObjectPtr(const ScriptingObjectData& data)
+    {
+        return data.Ptr;
+    }
+#else
+    typedef ScriptingObject* ScriptingObjectData;
+
+    FORCE_INLINE ScriptingObject* GetObjectPtr(ScriptingObjectData data)
+    {
+        return data;
+    }
+#endif
+
+    // Objects registry is split into shards (by the object ID) with a separate lock each so the objects creation and lookups from different threads (eg. async scene loading or jobs) rarely contend
+#define SCRIPTING_OBJECTS_SHARDS_BITS 5
+#define SCRIPTING_OBJECTS_SHARDS (1 << SCRIPTING_OBJECTS_SHARDS_BITS)
+    struct ObjectsShard
+    {
+        CriticalSection Locker;
+        FlatDictionary<Guid, ScriptingObjectData> Objects;
 
-        operator ScriptingObject*() const
+        ObjectsShard()
+            : Objects(1024 * 16 / SCRIPTING_OBJECTS_SHARDS)
         {
-            return Ptr;
+            PROFILE_LOCK(Locker, "Scripting Objects");
         }
     };
 
-    Dictionary<Guid, ScriptingObjectData> _objectsDictionary(1024 * 16);
-#else
-    Dictionary<Guid, ScriptingObject*> _objectsDictionary(1024 * 16);
-#endif
+    ObjectsShard _objectsShards[SCRIPTING_OBJECTS_SHARDS];
+    THREADLOCAL Scripting::ManagedDirectCall ManagedDirectCallData = { nullptr, -1 };
+
+    FORCE_INLINE int32 GetObjectsShardIndex(const Guid& id)
+    {
+        // Shard dictionary remixes the hash (fmix32) before picking a bucket, so all objects in a shard still spread over its buckets whatever bits are used here.
+        // Take the upper bits of the raw hash anyway so shards don't correlate with the low bits used to pick buckets by the other (non-mixing) hash containers keyed by the object ID.
+        return (int32)(GetHash(id) >> (32 - SCRIPTING_OBJECTS_SHARDS_BITS));
+    }
+
+    FORCE_INLINE ObjectsShard& GetObjectsShard(const Guid& id)
+    {
+        return _objectsShards[GetObjectsShardIndex(id)];
+    }
+
+    ScriptingObject* FindRegisteredObject(const Guid& id)
+    {
+        ObjectsShard& shard = GetObjectsShard(id);
+        ScriptingObjectData data = ScriptingObjectData();
+        shard.Locker.Lock();
+        shard.Objects.TryGet(id, data);
+        shard.Locker.Unlock();
+        return GetObjectPtr(data);
+    }
     bool _isEngineAssemblyLoaded = false;
     bool _hasGameModulesLoaded = false;
     MMethod* _method_Update = nullptr;
@@ -109,6 +150,89 @@ namespace
     Dictionary<StringAnsi, BinaryModule*, InlinedAllocation<64>> _nonNativeModules;
 #if USE_EDITOR
     bool LastBinariesLoadTriggeredCompilation = false;
+    Dictionary<StringAnsi, uint32> _binaryModulesHashes;
+
+    uint32 GetBinaryModuleHash(const String& nativePath, const String& managedPath)
+    {
+        // Hash the binaries contents since the file names change between hot-reloads (C# assemblies are compiled in deterministic mode)
+        uint32 hash = 0;
+        Array<byte> data;
+        if (nativePath.HasChars() && !File::ReadAllBytes(nativePath, data))
+            hash = Crc::MemCrc32(data.Get(), data.Count(), hash);
+        if (managedPath.HasChars() && !File::ReadAllBytes(managedPath, data))
+            hash = Crc::MemCrc32(data.Get(), data.Count(), hash);
+        return hash;
+    }
+
+    bool HasBinaryModulesChanged(const String& path, const String& projectFolderPath, int32& modulesCount)
+    {
+        Array<byte> fileData;
+        if (File::ReadAllBytes(path, fileData))
+            return true;
+        rapidjson_flax::Document document;
+        document.Parse((char*)fileData.Get(), fileData.Count());
+        if (document.HasParseError())
+            return true;
+
+        // Check all references
+        auto referencesMember = document.FindMember("References");
+        if (referencesMember != document.MemberEnd() && referencesMember->value.IsArray())
+        {
+            auto& referencesArray = referencesMember->value;
+            for (rapidjson::SizeType i = 0; i < referencesArray.Size(); i++)
+            {
+                auto& reference = referencesArray[i];
+                String referenceProjectPath = JsonTools::GetString(reference, "ProjectPath", String::Empty);
+                if (referenceProjectPath == TEXT("$(EnginePath)/Flax.flaxproj"))
+                    continue; // Skip reference to engine
+                String referencePath = JsonTools::GetString(reference, "Path", String::Empty);
+                if (referenceProjectPath.IsEmpty() || referencePath.IsEmpty())
+                    return true;
+                Scripting::ProcessBuildInfoPath(referenceProjectPath, projectFolderPath);
+                Scripting::ProcessBuildInfoPath(referencePath, projectFolderPath);
+                if (HasBinaryModulesChanged(referencePath, StringUtils::GetDirectoryName(referenceProjectPath), modulesCount))
+                    return true;
+            }
+        }
+
+        // Check all binary modules
+        auto binaryModulesMember = document.FindMember("BinaryModules");
+        if (binaryModulesMember != document.MemberEnd() && binaryModulesMember->value.IsArray())
+        {
+            auto& binaryModulesArray = binaryModulesMember->value;
+            for (rapidjson::SizeType i = 0; i < binaryModulesArray.Size(); i++)
+            {
+                auto& binaryModule = binaryModulesArray[i];
+                const auto nameMember = binaryModule.FindMember("Name");
+                if (nameMember == binaryModule.MemberEnd())
+                    return true;
+                StringAnsi nameAnsi(nameMember->value.GetString(), nameMember->value.GetStringLength());
+                String nativePath = JsonTools::GetString(binaryModule, "NativePath", String::Empty);
+                String managedPath = JsonTools::GetString(binaryModule, "ManagedPath", String::Empty);
+                Scripting::ProcessBuildInfoPath(nativePath, projectFolderPath);
+                Scripting::ProcessBuildInfoPath(managedPath, projectFolderPath);
+                uint32 hash;
+                if (!_binaryModulesHashes.TryGet(nameAnsi, hash) || hash != GetBinaryModuleHash(nativePath, managedPath))
+                    return true;
+                modulesCount++;
+            }
+        }
+
+        return false;
+    }
+
+    bool HasGameModulesChanged()
+    {
+        PROFILE_CPU();
+        const Char *target, *platform, *architecture, *configuration;
+        ScriptsBuilder::GetBinariesConfiguration(target, platform, architecture, configuration);
+        if (StringUtils::Length(target) == 0)
+            return true;
+        const String targetBuildInfo = Globals::ProjectFolder / TEXT("Binaries") / target / platform / architecture / configuration / target + TEXT(".Build.json");
+        ScopeLock lock(BinaryModule::Locker);
+        int32 modulesCount = 0;
+        return HasBinaryModulesChanged(targetBuildInfo, Globals::ProjectFolder, modulesCount) || modulesCount != _binaryModulesHashes.Count();
+    }
 #endif
 
     void ReleaseObjects(bool gameOnly)
@@ -122,19 +246,22 @@ namespace
 
         // Destroy objects from game assemblies (eg. not released objects that might crash if persist in memory after reload)
         const auto flaxModule = GetBinaryModuleFlaxEngine();
-        _objectsLocker.Lock();
-        for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+        for (ObjectsShard& shard : _objectsShards)
         {
-            auto obj = i->Value;
-            if (gameOnly && obj->GetTypeHandle().Module == flaxModule)
-                continue;
+            shard.Locker.Lock();
+            for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+            {
+                auto obj = i->Value;
+                if (gameOnly && obj->GetTypeHandle().Module == flaxModule)
+                    continue;
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-            LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
+                LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
 #endif
-            obj->OnScriptingDispose();
+                obj->OnScriptingDispose();
+            }
+            shard.Locker.Unlock();
         }
-        _objectsLocker.Unlock();
 
         // Release assets sourced from game assemblies
         Array<Asset*> assets = Content::GetAssets();
@@ -238,6 +365,7 @@ bool ScriptingService::Init()
 void ScriptingService::Update()
 {
     PROFILE_CPU_NAMED("Scripting::Update");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(Update);
 
 #ifdef USE_NETCORE
@@ -252,30 +380,35 @@ void ScriptingService::Update()
 void ScriptingService::LateUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(LateUpdate);
 }
 
 void ScriptingService::FixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::FixedUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(FixedUpdate);
 }
 
 void ScriptingService::LateFixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateFixedUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(LateFixedUpdate);
 }
 
 void ScriptingService::Draw()
 {
     PROFILE_CPU_NAMED("Scripting::Draw");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(Draw);
 }
 
 void ScriptingService::BeforeExit()
 {
     PROFILE_CPU_NAMED("Scripting::BeforeExit");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(Exit);
 }
 
@@ -470,6 +603,10 @@ bool Scripting::LoadBinaryModules(const String& path, const String& projectFolde
             }
 #endif
 
+#if USE_EDITOR
+            // Cache binaries state to skip scripts reload if they don't change
+            _binaryModulesHashes[nameAnsi] = GetBinaryModuleHash(nativePath, managedPath);
+#endif
             BinaryModuleLoaded(module);
         }
     }
@@ -629,6 +766,9 @@ void Scripting::Release()
         }
         _nonNativeModules.ClearDelete();
         _hasGameModulesLoaded = false;
+#if USE_EDITOR
+        _binaryModulesHashes.Clear();
+#endif
     }
 
     // Cleanup
@@ -657,6 +797,13 @@ void Scripting::Release()
 
 void Scripting::Reload(bool canTriggerSceneReload)
 {
+    // Skip the whole reload (including scenes) if game binaries are the same as loaded ones (eg. rebuild without any effective code changes)
+    if (_hasGameModulesLoaded && !HasGameModulesChanged())
+    {
+        LOG(Info, "Skipping user scripts reload (binaries are up to date)");
+        return;
+    }
+
     // By default we allow to call it only from the main thread and when no scene is loaded.
     // Otherwise call scene manager to perform clear scripts reload.
     // It will call this method back on main thread without scenes loaded, see SceneActionType::ReloadScripts.
@@ -708,6 +855,7 @@ void Scripting::Reload(bool canTriggerSceneReload)
     modules.Clear();
     _nonNativeModules.ClearDelete();
     _hasGameModulesLoaded = false;
+    _binaryModulesHashes.Clear();
 
     // Release and create a new assembly load context for user assemblies
     MCore::ReloadScriptingAssemblyLoadContext();
@@ -731,9 +879,13 @@ void Scripting::Reload(bool canTriggerSceneReload)
 Array<ScriptingObject*, HeapAllocation> Scripting::GetObjects()
 {
     Array<ScriptingObject*> objects;
-    _objectsLocker.Lock();
-    _objectsDictionary.GetValues(objects);
-    _objectsLocker.Unlock();
+    for (ObjectsShard& shard : _objectsShards)
+    {
+        shard.Locker.Lock();
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+            objects.Add(GetObjectPtr(i->Value));
+        shard.Locker.Unlock();
+    }
     return objects;
 }
 
@@ -870,18 +1022,7 @@ ScriptingObject* Scripting::FindObject(Guid id, const MClass* type)
     }
 
     // Try to find it
-#if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-    ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
-    auto result = data.Ptr;
-#else
-    ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
-#endif
+    ScriptingObject* result = FindRegisteredObject(id);
     if (result)
     {
         // Check type
@@ -926,18 +1067,7 @@ ScriptingObject* Scripting::TryFindObject(Guid id, const MClass* type)
     }
 
     // Try to find it
-#if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-    ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
-    auto result = data.Ptr;
-#else
-    ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
-#endif
+    ScriptingObject* result = FindRegisteredObject(id);
 
     // Check type
     if (result && type && !result->Is(type))
@@ -952,12 +1082,15 @@ ScriptingObject* Scripting::TryFindObject(const MClass* type)
 {
     if (type == nullptr)
         return nullptr;
-    ScopeLock lock(_objectsLocker);
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (ObjectsShard& shard : _objectsShards)
     {
-        const auto obj = i->Value;
-        if (obj->GetClass() == type)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            ScriptingObject* obj = GetObjectPtr(i->Value);
+            if (obj->GetClass() == type)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -970,13 +1103,15 @@ ScriptingObject* Scripting::FindObject(const MObject* managedInstance)
 
     // TODO: optimize it by reading the unmanagedPtr or _internalId from managed Object property
 
-    ScopeLock lock(_objectsLocker);
-
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (ObjectsShard& shard : _objectsShards)
     {
-        const auto obj = i->Value;
-        if (obj->GetManagedInstance() == managedInstance)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            ScriptingObject* obj = GetObjectPtr(i->Value);
+            if (obj->GetManagedInstance() == managedInstance)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -986,20 +1121,23 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     PROFILE_CPU();
     ASSERT(obj);
 
-    // Validate if object still exists
-    _objectsLocker.Lock();
-    if (_objectsDictionary.ContainsValue(obj))
+    // Validate if object still exists (object memory cannot be accessed before so search by the pointer in all shards)
+    for (ObjectsShard& shard : _objectsShards)
     {
+        ScopeLock lock(shard.Locker);
+        bool contains = false;
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd() && !contains; ++i)
+            contains = GetObjectPtr(i->Value) == obj;
+        if (contains)
+        {
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-        LOG(Info, "[OnManagedInstanceDeleted] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
+            LOG(Info, "[OnManagedInstanceDeleted] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-        obj->OnManagedInstanceDeleted();
-    }
-    else
-    {
-        //LOG(Warning, "Object finalization called for already removed object (address={0:x})", (uint64)obj);
+            obj->OnManagedInstanceDeleted();
+            return;
+        }
     }
-    _objectsLocker.Unlock();
+    //LOG(Warning, "Object finalization called for already removed object (address={0:x})", (uint64)obj);
 }
 
 bool Scripting::HasGameModulesLoaded()
@@ -1024,20 +1162,26 @@ bool Scripting::IsTypeFromGameScripts(const MClass* type)
     return binaryModule && binaryModule != GetBinaryModuleCorlib() && binaryModule != GetBinaryModuleFlaxEngine();
 }
 
+Scripting::ManagedDirectCall* Scripting::GetManagedDirectCall()
+{
+    return &ManagedDirectCallData;
+}
+
+bool Scripting::IsManagedDirectCall(const void* obj, int32 scriptVTableIndex)
+{
+    const ManagedDirectCall& call = ManagedDirectCallData;
+    return call.Object == obj && call.ScriptVTableIndex == scriptVTableIndex;
+}
+
 void Scripting::RegisterObject(ScriptingObject* obj)
 {
     const Guid id = obj->GetID();
-    ScopeLock lock(_objectsLocker);
+    ObjectsShard& shard = GetObjectsShard(id);
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!_objectsDictionary.ContainsValue(obj));
 #if ENABLE_ASSERTION
-#if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData other;
-    if (_objectsDictionary.TryGet(id, other))
-#else
-    ScriptingObject* other;
-    if (_objectsDictionary.TryGet(id, other))
-#endif
+    if (shard.Objects.TryGet(id, other))
     {
         // Something went wrong...
         LOG(Error, "Objects registry already contains object with ID={0} (type '{3}')! Trying to register object {1} (type '{2}').", id, obj->ToString(), String(obj->GetClass()->GetFullName()), String(other->GetClass()->GetFullName()));
@@ -1047,33 +1191,42 @@ void Scripting::RegisterObject(ScriptingObject* obj)
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[RegisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary[id] = obj;
+    shard.Objects[id] = obj;
 }
 
 void Scripting::UnregisterObject(ScriptingObject* obj)
 {
-    ScopeLock lock(_objectsLocker);
-
-    //ASSERT(!obj->_id.IsValid() || _objectsDictionary.ContainsValue(obj));
+    const Guid id = obj->GetID();
+    ObjectsShard& shard = GetObjectsShard(id);
+    ScopeLock lock(shard.Locker);
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[UnregisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary.Remove(obj->GetID());
+    shard.Objects.Remove(id);
 }
 
 void Scripting::OnObjectIdChanged(ScriptingObject* obj, const Guid& oldId)
 {
-    ScopeLock lock(_objectsLocker);
-
     ASSERT(obj && oldId.IsValid());
-    ASSERT(obj->GetID() != oldId);
-    ASSERT(_objectsDictionary.ContainsKey(oldId));
-    //ASSERT(_objectsDictionary.ContainsValue(obj));
-    ASSERT(!_objectsDictionary.ContainsKey(obj->GetID()));
-
-    _objectsDictionary.Remove(oldId);
-    _objectsDictionary.Add(obj->GetID(), obj);
+    const Guid id = obj->GetID();
+    ASSERT(id != oldId);
+
+    // Lock both shards (in the same order to prevent deadlocks)
+    const int32 oldShardIndex = GetObjectsShardIndex(oldId);
+    const int32 newShardIndex = GetObjectsShardIndex(id);
+    ObjectsShard& oldShard = _objectsShards[oldShardIndex];
+    ObjectsShard& newShard = _objectsShards[newShardIndex];
+    _objectsShards[Math::Min(oldShardIndex, newShardIndex)].Locker.Lock();
+    _objectsShards[Math::Max(oldShardIndex, newShardIndex)].Locker.Lock();
+
+    ASSERT(oldShard.Objects.ContainsKey(oldId));
+    ASSERT(!newShard.Objects.ContainsKey(id));
+    oldShard.Objects.Remove(oldId);
+    newShard.Objects.Add(id, obj);
+
+    _objectsShards[Math::Max(oldShardIndex, newShardIndex)].Locker.Unlock();
+    _objectsShards[Math::Min(oldShardIndex, newShardIndex)].Locker.Unlock();
 }
 
 bool initFlaxEngine()
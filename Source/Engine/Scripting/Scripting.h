@@ -211,6 +211,30 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Scripting);
     /// <param name="obj">The unmanaged object pointer that was related to the managed object.</param>
     static void OnManagedInstanceDeleted(ScriptingObject* obj);
 
+    /// <summary>
+    /// The state of the virtual method called directly by the managed code (eg. batched scripts update) that skips the native wrapper of the scripting override.
+    /// </summary>
+    struct ManagedDirectCall
+    {
+        // The unmanaged pointer of the object which method is called.
+        void* Object;
+        // The index of the method in the scripting type vtable.
+        int32 ScriptVTableIndex;
+    };
+
+    /// <summary>
+    /// Gets the state of the virtual method called directly by the managed code on the current thread.
+    /// </summary>
+    static ManagedDirectCall* GetManagedDirectCall();
+
+    /// <summary>
+    /// Checks if the given virtual method is called directly by the managed code on the current thread. Used by the generated wrappers of the scripting overrides to call the native base method (instead of calling the override again) when scripting invokes the base implementation.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <param name="scriptVTableIndex">The index of the method in the scripting type vtable.</param>
+    /// <returns>True if method is called directly by the managed code, otherwise false.</returns>
+    static bool IsManagedDirectCall(const void* obj, int32 scriptVTableIndex);
+
 public:
 
     /// <summary>
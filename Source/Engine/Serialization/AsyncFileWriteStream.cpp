@@ -0,0 +1,168 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "AsyncFileWriteStream.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Threading/ThreadSpawner.h"
+
+AsyncFileWriteStream* AsyncFileWriteStream::Open(const StringView& path)
+{
+    auto file = File::Open(path, FileMode::CreateAlways, FileAccess::Write, FileShare::Read);
+    if (file == nullptr)
+    {
+        LOG(Warning, "Cannot open file '{0}'", path);
+        return nullptr;
+    }
+    return New<AsyncFileWriteStream>(file);
+}
+
+AsyncFileWriteStream::AsyncFileWriteStream(File* file, uint32 bufferSize)
+    : _file(file)
+    , _bufferSize(Math::Max<uint32>(bufferSize, FILESTREAM_BUFFER_SIZE))
+{
+    ASSERT_LOW_LAYER(_file);
+    _buffer.EnsureCapacity(_bufferSize);
+    _writeBuffer.EnsureCapacity(_bufferSize);
+    Function<int32()> f;
+    f.Bind<AsyncFileWriteStream, &AsyncFileWriteStream::Run>(this);
+    _thread = ThreadSpawner::Start(f, TEXT("Async File Writer"), ThreadPriority::BelowNormal);
+}
+
+AsyncFileWriteStream::~AsyncFileWriteStream()
+{
+    // Ensure to be file flushed, closed and deleted
+    Close();
+    Delete(_file);
+}
+
+bool AsyncFileWriteStream::IsWriting()
+{
+    ScopeLock lock(_locker);
+    return _isWriting || _buffer.HasItems();
+}
+
+void AsyncFileWriteStream::Wait()
+{
+    ScopeLock lock(_locker);
+    while (_isWriting || _buffer.HasItems())
+    {
+        if (!_isWriting)
+            Kick();
+        if (_thread)
+            _writtenSignal.Wait(_locker);
+    }
+}
+
+void AsyncFileWriteStream::Kick()
+{
+    // Pass the buffered data to the I/O thread (lock has to be taken and no write can be in progress)
+    _buffer.Swap(_writeBuffer);
+    _isWriting = true;
+    _flushPending = false;
+    if (_thread)
+    {
+        _writeSignal.NotifyOne();
+    }
+    else
+    {
+        // Fallback to the synchronous write if thread is missing
+        uint32 bytesWritten;
+        _hasError |= _file->Write(_writeBuffer.Get(), _writeBuffer.Count(), &bytesWritten) != 0;
+        _writeBuffer.Clear();
+        _isWriting = false;
+    }
+}
+
+int32 AsyncFileWriteStream::Run()
+{
+    _locker.Lock();
+    while (true)
+    {
+        while (!_isWriting && !_exit)
+            _writeSignal.Wait(_locker);
+        if (!_isWriting)
+            break;
+
+        // Write data without holding the lock so the next buffer can be filled in the meantime
+        _locker.Unlock();
+        uint32 bytesWritten;
+        const bool failed = _file->Write(_writeBuffer.Get(), _writeBuffer.Count(), &bytesWritten) != 0;
+        _locker.Lock();
+        _hasError |= failed;
+        _writeBuffer.Clear();
+        _isWriting = false;
+
+        // Write data flushed during the previous write
+        if (_flushPending && _buffer.HasItems())
+            Kick();
+        _writtenSignal.NotifyAll();
+    }
+    _locker.Unlock();
+    return 0;
+}
+
+void AsyncFileWriteStream::Flush()
+{
+    ScopeLock lock(_locker);
+    if (_buffer.IsEmpty())
+        return;
+    if (_isWriting)
+        _flushPending = true;
+    else
+        Kick();
+}
+
+void AsyncFileWriteStream::Close()
+{
+    if (_thread)
+    {
+        Wait();
+        _locker.Lock();
+        _exit = true;
+        _writeSignal.NotifyOne();
+        _locker.Unlock();
+        _thread->Join();
+        Delete(_thread);
+        _thread = nullptr;
+    }
+    else
+    {
+        Wait();
+    }
+    _file->Close();
+}
+
+uint32 AsyncFileWriteStream::GetLength()
+{
+    Wait();
+    return _file->GetSize();
+}
+
+uint32 AsyncFileWriteStream::GetPosition()
+{
+    ScopeLock lock(_locker);
+    return _position;
+}
+
+void AsyncFileWriteStream::SetPosition(uint32 seek)
+{
+    Wait();
+    ScopeLock lock(_locker);
+    _file->SetPosition(seek);
+    _position = seek;
+}
+
+void AsyncFileWriteStream::WriteBytes(const void* data, uint32 bytes)
+{
+    ScopeLock lock(_locker);
+    _buffer.Add((const byte*)data, (int32)bytes);
+    _position += bytes;
+    if ((uint32)_buffer.Count() >= _bufferSize)
+    {
+        // Wait for the previous write to finish (the other buffer is in use)
+        while (_isWriting)
+            _writtenSignal.Wait(_locker);
+        Kick();
+    }
+}
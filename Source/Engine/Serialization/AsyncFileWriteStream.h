@@ -0,0 +1,89 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Platform/Types.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Core/Collections/Array.h"
+#include "WriteStream.h"
+
+/// <summary>
+/// Implementation of the stream that writes to the file on a background thread. Data is collected into the buffer on the calling thread and written to the file by the I/O thread (double-buffered) so the caller doesn't wait for the disk.
+/// </summary>
+/// <remarks>
+/// Flush only starts writing the buffered data. Use Wait to ensure all data has been written to the file. Writing is thread-safe.
+/// </remarks>
+/// <seealso cref="WriteStream" />
+class FLAXENGINE_API AsyncFileWriteStream : public WriteStream
+{
+private:
+    File* _file;
+    Thread* _thread = nullptr;
+    CriticalSection _locker;
+    ConditionVariable _writeSignal;
+    ConditionVariable _writtenSignal;
+    Array<byte> _buffer;
+    Array<byte> _writeBuffer;
+    uint32 _bufferSize;
+    uint32 _position = 0;
+    bool _isWriting = false;
+    bool _flushPending = false;
+    bool _exit = false;
+
+public:
+    NON_COPYABLE(AsyncFileWriteStream);
+
+    /// <summary>
+    /// Init
+    /// </summary>
+    /// <param name="file">File to write</param>
+    /// <param name="bufferSize">The size of the buffer (in bytes). Data is sent to the I/O thread when buffer is full or on flush.</param>
+    AsyncFileWriteStream(File* file, uint32 bufferSize = 64 * 1024);
+
+    /// <summary>
+    /// Destructor
+    /// </summary>
+    ~AsyncFileWriteStream();
+
+public:
+    /// <summary>
+    /// Gets the file handle.
+    /// </summary>
+    /// <returns>File</returns>
+    FORCE_INLINE const File* GetFile() const
+    {
+        return _file;
+    }
+
+    /// <summary>
+    /// Determines whether any written data is still waiting to be stored in the file.
+    /// </summary>
+    bool IsWriting();
+
+    /// <summary>
+    /// Flushes the buffered data and waits until all of it has been written to the file.
+    /// </summary>
+    void Wait();
+
+public:
+    /// <summary>
+    /// Open file to write data to it
+    /// </summary>
+    /// <param name="path">Path to the file</param>
+    /// <returns>Created file writer stream or null if cannot perform it</returns>
+    static AsyncFileWriteStream* Open(const StringView& path);
+
+private:
+    void Kick();
+    int32 Run();
+
+public:
+    // [WriteStream]
+    void Flush() final override;
+    void Close() final override;
+    uint32 GetLength() override;
+    uint32 GetPosition() override;
+    void SetPosition(uint32 seek) override;
+    void WriteBytes(const void* data, uint32 bytes) override;
+};
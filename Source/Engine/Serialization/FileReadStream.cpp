@@ -22,6 +22,21 @@ void FileReadStream::Unlink()
     _file = nullptr;
 }
 
+bool FileReadStream::ReadBytesAt(void* data, uint32 bytes, uint32 offset)
+{
+#if USE_FILE_POS
+    const uint32 filePosition = _filePosition;
+#else
+    const uint32 filePosition = _file->GetPosition();
+#endif
+    uint32 bytesRead;
+    const bool failed = _file->ReadAt(data, bytes, offset, &bytesRead) || bytesRead != bytes;
+
+    // Restore the native file position used by the buffered reads
+    _file->SetPosition(filePosition);
+    return failed;
+}
+
 FileReadStream::FileReadStream(File* file)
     : _file(file)
     , _virtualPosInBuffer(0)
@@ -46,6 +46,15 @@ class FLAXENGINE_API FileReadStream : public ReadStream
     /// </summary>
     void Unlink();
 
+    /// <summary>
+    /// Reads the data from the given location in the file directly to the output buffer (without using the stream buffer and without changing the stream position).
+    /// </summary>
+    /// <param name="data">The output buffer.</param>
+    /// <param name="bytes">The amount of bytes to read.</param>
+    /// <param name="offset">The location in the file (in bytes) to read data from.</param>
+    /// <returns>True if cannot read data, otherwise false.</returns>
+    bool ReadBytesAt(void* data, uint32 bytes, uint32 offset);
+
 public:
     /// <summary>
     /// Open file to write data to it
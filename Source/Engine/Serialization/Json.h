@@ -5,7 +5,11 @@
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
 
-// TODO: config RAPIDJSON_SSE2 for rapidjson
+#if PLATFORM_SIMD_SSE4_2
+#define RAPIDJSON_SSE42
+#elif PLATFORM_SIMD_SSE2
+#define RAPIDJSON_SSE2
+#endif
 #define RAPIDJSON_ERROR_CHARTYPE Char
 #define RAPIDJSON_ERROR_STRING(x) TEXT(x)
 #define RAPIDJSON_ASSERT(x) ASSERT(x)
@@ -0,0 +1,370 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "JsonBinary.h"
+#include "Json.h"
+#include "WriteStream.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// Encoded value types
+enum class JsonBinaryTag : byte
+{
+    Null,
+    False,
+    True,
+    // Signed integer (zigzag-encoded variable length)
+    Int,
+    // Unsigned integer larger than max int64 (8 bytes)
+    Uint64,
+    // Floating-point number exactly representable with single-precision (4 bytes)
+    Float,
+    // Floating-point number (8 bytes)
+    Double,
+    // String (variable length size and text), added to the strings table
+    String,
+    // String from the strings table (variable length index)
+    StringRef,
+    // Lower-case hexadecimal 32-character string (eg. object ID) stored as 16 bytes
+    Guid,
+    // Object (variable length members count, then the key and value of every member)
+    Object,
+    // Array (variable length items count, then the items)
+    Array,
+};
+
+namespace
+{
+    FORCE_INLINE int32 HexToInt(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        return -1;
+    }
+
+    struct JsonBinaryWriter
+    {
+        WriteStream& Stream;
+        Dictionary<StringAnsiView, int32> Strings;
+
+        JsonBinaryWriter(WriteStream& stream)
+            : Stream(stream)
+        {
+        }
+
+        void WriteVarUint(uint64 value)
+        {
+            byte data[10];
+            int32 count = 0;
+            while (value >= 0x80)
+            {
+                data[count++] = (byte)(value | 0x80);
+                value >>= 7;
+            }
+            data[count++] = (byte)value;
+            Stream.WriteBytes(data, count);
+        }
+
+        void WriteTag(JsonBinaryTag tag)
+        {
+            Stream.WriteByte((byte)tag);
+        }
+
+        void WriteString(const char* str, int32 length)
+        {
+            const StringAnsiView view(str, length);
+            int32 index;
+            if (Strings.TryGet(view, index))
+            {
+                WriteTag(JsonBinaryTag::StringRef);
+                WriteVarUint(index);
+                return;
+            }
+            if (length == 32)
+            {
+                byte guid[16];
+                bool isGuid = true;
+                for (int32 i = 0; i < 16 && isGuid; i++)
+                {
+                    const int32 high = HexToInt(str[i * 2]);
+                    const int32 low = HexToInt(str[i * 2 + 1]);
+                    isGuid = high != -1 && low != -1;
+                    guid[i] = (byte)((high << 4) | low);
+                }
+                if (isGuid)
+                {
+                    WriteTag(JsonBinaryTag::Guid);
+                    Stream.WriteBytes(guid, sizeof(guid));
+                    return;
+                }
+            }
+            Strings.Add(view, Strings.Count());
+            WriteTag(JsonBinaryTag::String);
+            WriteVarUint(length);
+            Stream.WriteBytes(str, length);
+        }
+
+        void WriteValue(const rapidjson_flax::Value& value)
+        {
+            switch (value.GetType())
+            {
+            case rapidjson::kNullType:
+                WriteTag(JsonBinaryTag::Null);
+                break;
+            case rapidjson::kFalseType:
+                WriteTag(JsonBinaryTag::False);
+                break;
+            case rapidjson::kTrueType:
+                WriteTag(JsonBinaryTag::True);
+                break;
+            case rapidjson::kObjectType:
+                WriteTag(JsonBinaryTag::Object);
+                WriteVarUint(value.MemberCount());
+                for (auto i = value.MemberBegin(); i != value.MemberEnd(); ++i)
+                {
+                    WriteString(i->name.GetString(), (int32)i->name.GetStringLength());
+                    WriteValue(i->value);
+                }
+                break;
+            case rapidjson::kArrayType:
+                WriteTag(JsonBinaryTag::Array);
+                WriteVarUint(value.Size());
+                for (auto i = value.Begin(); i != value.End(); ++i)
+                    WriteValue(*i);
+                break;
+            case rapidjson::kStringType:
+                WriteString(value.GetString(), (int32)value.GetStringLength());
+                break;
+            case rapidjson::kNumberType:
+                if (value.IsDouble())
+                {
+                    const double d = value.GetDouble();
+                    const float f = (float)d;
+                    if ((double)f == d)
+                    {
+                        WriteTag(JsonBinaryTag::Float);
+                        Stream.WriteBytes(&f, sizeof(f));
+                    }
+                    else
+                    {
+                        WriteTag(JsonBinaryTag::Double);
+                        Stream.WriteBytes(&d, sizeof(d));
+                    }
+                }
+                else if (value.IsInt64())
+                {
+                    const int64 i = value.GetInt64();
+                    WriteTag(JsonBinaryTag::Int);
+                    WriteVarUint(((uint64)i << 1) ^ (uint64)(i >> 63));
+                }
+                else
+                {
+                    const uint64 u = value.GetUint64();
+                    WriteTag(JsonBinaryTag::Uint64);
+                    Stream.WriteBytes(&u, sizeof(u));
+                }
+                break;
+            }
+        }
+    };
+
+    // Generator of the document SAX events from the encoded data
+    struct JsonBinaryReader
+    {
+        const byte* Position;
+        const byte* End;
+        Array<StringAnsiView> Strings;
+        bool Failed = true;
+
+        bool ReadVarUint(uint64& value)
+        {
+            value = 0;
+            for (int32 shift = 0; shift < 64 && Position < End; shift += 7)
+            {
+                const byte b = *Position++;
+                value |= (uint64)(b & 0x7f) << shift;
+                if ((b & 0x80) == 0)
+                    return false;
+            }
+            return true;
+        }
+
+        template<typename T>
+        bool ReadRaw(T& value)
+        {
+            if (End - Position < (int32)sizeof(T))
+                return true;
+            Platform::MemoryCopy(&value, Position, sizeof(T));
+            Position += sizeof(T);
+            return false;
+        }
+
+        bool ReadString(JsonBinaryTag tag, StringAnsiView& result, char* guidBuffer)
+        {
+            uint64 value;
+            switch (tag)
+            {
+            case JsonBinaryTag::String:
+                if (ReadVarUint(value) || (uint64)(End - Position) < value)
+                    return true;
+                result = StringAnsiView((const char*)Position, (int32)value);
+                Position += value;
+                Strings.Add(result);
+                return false;
+            case JsonBinaryTag::StringRef:
+                if (ReadVarUint(value) || value >= (uint64)Strings.Count())
+                    return true;
+                result = Strings[(int32)value];
+                return false;
+            case JsonBinaryTag::Guid:
+            {
+                if (End - Position < 16)
+                    return true;
+                const char* digits = "0123456789abcdef";
+                for (int32 i = 0; i < 16; i++)
+                {
+                    guidBuffer[i * 2] = digits[Position[i] >> 4];
+                    guidBuffer[i * 2 + 1] = digits[Position[i] & 0xf];
+                }
+                Position += 16;
+                result = StringAnsiView(guidBuffer, 32);
+                return false;
+            }
+            default:
+                return true;
+            }
+        }
+
+        bool ReadValue(rapidjson_flax::Document& handler)
+        {
+            if (Position >= End)
+                return true;
+            const JsonBinaryTag tag = (JsonBinaryTag)*Position++;
+            char guidBuffer[32];
+            StringAnsiView str;
+            uint64 count;
+            switch (tag)
+            {
+            case JsonBinaryTag::Null:
+                handler.Null();
+                return false;
+            case JsonBinaryTag::False:
+                handler.Bool(false);
+                return false;
+            case JsonBinaryTag::True:
+                handler.Bool(true);
+                return false;
+            case JsonBinaryTag::Int:
+            {
+                uint64 value;
+                if (ReadVarUint(value))
+                    return true;
+                handler.Int64((int64)(value >> 1) ^ -(int64)(value & 1));
+                return false;
+            }
+            case JsonBinaryTag::Uint64:
+            {
+                uint64 value;
+                if (ReadRaw(value))
+                    return true;
+                handler.Uint64(value);
+                return false;
+            }
+            case JsonBinaryTag::Float:
+            {
+                float value;
+                if (ReadRaw(value))
+                    return true;
+                handler.Double(value);
+                return false;
+            }
+            case JsonBinaryTag::Double:
+            {
+                double value;
+                if (ReadRaw(value))
+                    return true;
+                handler.Double(value);
+                return false;
+            }
+            case JsonBinaryTag::String:
+            case JsonBinaryTag::StringRef:
+            case JsonBinaryTag::Guid:
+                if (ReadString(tag, str, guidBuffer))
+                    return true;
+                handler.String(str.Get(), str.Length(), true);
+                return false;
+            case JsonBinaryTag::Object:
+                if (ReadVarUint(count) || count > (uint64)(End - Position))
+                    return true;
+                handler.StartObject();
+                for (uint64 i = 0; i < count; i++)
+                {
+                    if (Position >= End || ReadString((JsonBinaryTag)*Position++, str, guidBuffer))
+                        return true;
+                    handler.Key(str.Get(), str.Length(), true);
+                    if (ReadValue(handler))
+                        return true;
+                }
+                handler.EndObject((rapidjson::SizeType)count);
+                return false;
+            case JsonBinaryTag::Array:
+                if (ReadVarUint(count) || count > (uint64)(End - Position))
+                    return true;
+                handler.StartArray();
+                for (uint64 i = 0; i < count; i++)
+                {
+                    if (ReadValue(handler))
+                        return true;
+                }
+                handler.EndArray((rapidjson::SizeType)count);
+                return false;
+            default:
+                return true;
+            }
+        }
+
+        bool operator()(rapidjson_flax::Document& handler)
+        {
+            Failed = ReadValue(handler) || Position != End;
+            return !Failed;
+        }
+    };
+}
+
+bool JsonBinary::IsBinary(const void* data, int32 length)
+{
+    uint32 magic;
+    if (length < (int32)sizeof(magic))
+        return false;
+    Platform::MemoryCopy(&magic, data, sizeof(magic));
+    return magic == Magic;
+}
+
+void JsonBinary::Write(const rapidjson_flax::Value& value, WriteStream& stream)
+{
+    PROFILE_CPU();
+    stream.WriteUint32(Magic);
+    stream.WriteUint32(Version);
+    JsonBinaryWriter writer(stream);
+    writer.WriteValue(value);
+}
+
+bool JsonBinary::Read(const void* data, int32 length, rapidjson_flax::Document& document)
+{
+    PROFILE_CPU();
+    uint32 version;
+    if (!IsBinary(data, length) || length < 8)
+        return true;
+    Platform::MemoryCopy(&version, (const byte*)data + 4, sizeof(version));
+    if (version != Version)
+        return true;
+    JsonBinaryReader reader;
+    reader.Position = (const byte*)data + 8;
+    reader.End = (const byte*)data + length;
+    document.Populate(reader);
+    return reader.Failed;
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "JsonFwd.h"
+
+class WriteStream;
+
+/// <summary>
+/// Compact binary encoding of the JSON document (used by the cooked scenes and prefabs). Numbers are stored in binary, object keys and repeated strings are stored only once and object identifiers (Guid strings) take 16 bytes. Decoding builds the JSON document without any text parsing.
+/// </summary>
+class FLAXENGINE_API JsonBinary
+{
+public:
+    /// <summary>
+    /// The magic code at the beginning of the encoded data. Its first byte is not a valid start of JSON text.
+    /// </summary>
+    static constexpr uint32 Magic = 0x424A5846; // 'FXJB'
+
+    /// <summary>
+    /// The current encoding version.
+    /// </summary>
+    static constexpr uint32 Version = 1;
+
+public:
+    /// <summary>
+    /// Checks if the given data is binary-encoded JSON (otherwise it's JSON text).
+    /// </summary>
+    /// <param name="data">The data.</param>
+    /// <param name="length">The data length (in bytes).</param>
+    /// <returns>True if data is the binary-encoded JSON, otherwise false.</returns>
+    static bool IsBinary(const void* data, int32 length);
+
+    /// <summary>
+    /// Encodes the JSON value into the binary format.
+    /// </summary>
+    /// <param name="value">The value to write (eg. document).</param>
+    /// <param name="stream">The output stream.</param>
+    static void Write(const rapidjson_flax::Value& value, WriteStream& stream);
+
+    /// <summary>
+    /// Decodes the binary-encoded JSON into the document.
+    /// </summary>
+    /// <param name="data">The encoded data.</param>
+    /// <param name="length">The data length (in bytes).</param>
+    /// <param name="document">The output document.</param>
+    /// <returns>True if failed (eg. data is corrupted), otherwise false.</returns>
+    static bool Read(const void* data, int32 length, rapidjson_flax::Document& document);
+};
@@ -2,9 +2,12 @@
 
 #include "JsonTools.h"
 #include "ISerializable.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Types/CommonValue.h"
 #include "Engine/Core/Types/DateTime.h"
+#include "Engine/Debug/Exceptions/JsonParseException.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 #include "Engine/Utilities/Encryption.h"
@@ -81,6 +84,34 @@ void JsonTools::ChangeIds(Document& doc, const Dictionary<Guid, Guid>& mapping)
     ::ChangeIds(doc, doc, mapping);
 }
 
+bool JsonTools::ParseDocument(Document& document, const char* json, int32 length)
+{
+    PROFILE_CPU_NAMED("Json.Parse");
+#ifdef RAPIDJSON_SIMD
+    if (length > 0 && json[length - 1] == 0)
+    {
+        document.Parse(json);
+    }
+    else
+    {
+        // SIMD parsing works only with in-memory strings (aligned loads never cross the page so it can read up to the null-terminator)
+        ::Array<char> text;
+        text.Resize(length + 1);
+        Platform::MemoryCopy(text.Get(), json, length);
+        text[length] = 0;
+        document.Parse(text.Get());
+    }
+#else
+    document.Parse(json, length);
+#endif
+    if (document.HasParseError())
+    {
+        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+        return true;
+    }
+    return false;
+}
+
 Float2 JsonTools::GetFloat2(const Value& value)
 {
     Float2 result;
@@ -46,6 +46,15 @@ class FLAXENGINE_API JsonTools
 
     static void ChangeIds(Document& doc, const Dictionary<Guid, Guid, HeapAllocation>& mapping);
 
+    /// <summary>
+    /// Parses the JSON text into the document. Uses the SIMD-accelerated code path of the parser (whitespace skipping and strings scanning) which requires the null-terminated text, thus the data is copied if needed.
+    /// </summary>
+    /// <param name="document">The output document.</param>
+    /// <param name="json">The JSON text.</param>
+    /// <param name="length">The JSON text length (in bytes).</param>
+    /// <returns>True if failed to parse the data (error gets logged), otherwise false.</returns>
+    static bool ParseDocument(Document& document, const char* json, int32 length);
+
 public:
     FORCE_INLINE static Vector2 GetVector2(const Value& value)
     {
@@ -131,6 +140,12 @@ class FLAXENGINE_API JsonTools
         return member != node.MemberEnd() && member->value.IsInt() ? member->value.GetInt() : defaultValue;
     }
 
+    FORCE_INLINE static uint32 GetUint(const Value& node, const char* name, const uint32 defaultValue)
+    {
+        auto member = node.FindMember(name);
+        return member != node.MemberEnd() && member->value.IsUint() ? member->value.GetUint() : defaultValue;
+    }
+
     template<class T>
     FORCE_INLINE static T GetEnum(const Value& node, const char* name, const T defaultValue)
     {
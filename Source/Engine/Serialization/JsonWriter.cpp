@@ -1,12 +1,14 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "JsonWriter.h"
+#include "JsonWriters.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/CommonValue.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Core/Math/Color.h"
 #include "Engine/Core/Math/Plane.h"
 #include "Engine/Core/Types/DateTime.h"
+#include "Engine/Debug/Exceptions/JsonParseException.h"
 #include "Engine/Level/Prefabs/Prefab.h"
 #include "Engine/Level/SceneObject.h"
 #include "Engine/Utilities/Encryption.h"
@@ -503,3 +505,105 @@ void JsonWriter::SceneObject(::SceneObject* obj)
 
     EndObject();
 }
+
+DocumentJsonWriter::DocumentJsonWriter(rapidjson_flax::Document& document)
+    : _document(document)
+{
+}
+
+rapidjson_flax::Value& DocumentJsonWriter::AddValue()
+{
+    if (_stack.IsEmpty())
+        return _document;
+    rapidjson_flax::Value& parent = *_stack.Last();
+    if (parent.IsArray())
+    {
+        parent.PushBack(rapidjson_flax::Value(), _document.GetAllocator());
+        return parent[parent.Size() - 1];
+    }
+    parent.AddMember(_key, rapidjson_flax::Value(), _document.GetAllocator());
+    return (parent.MemberEnd() - 1)->value;
+}
+
+void DocumentJsonWriter::Key(const char* str, int32 length)
+{
+    _key.SetString(str, static_cast<rapidjson::SizeType>(length), _document.GetAllocator());
+}
+
+void DocumentJsonWriter::String(const char* str, int32 length)
+{
+    AddValue().SetString(str, static_cast<rapidjson::SizeType>(length), _document.GetAllocator());
+}
+
+void DocumentJsonWriter::RawValue(const char* json, int32 length)
+{
+    // Parse raw json (eg. managed script data) using the same allocator so the value can be moved into the document
+    rapidjson_flax::Document raw(&_document.GetAllocator());
+    raw.Parse(json, length);
+    rapidjson_flax::Value& value = AddValue();
+    if (raw.HasParseError())
+    {
+        Log::JsonParseException(raw.GetParseError(), raw.GetErrorOffset());
+        return;
+    }
+    value.Swap(raw);
+}
+
+void DocumentJsonWriter::Bool(bool d)
+{
+    AddValue().SetBool(d);
+}
+
+void DocumentJsonWriter::Int(int32 d)
+{
+    AddValue().SetInt(d);
+}
+
+void DocumentJsonWriter::Int64(int64 d)
+{
+    AddValue().SetInt64(d);
+}
+
+void DocumentJsonWriter::Uint(uint32 d)
+{
+    AddValue().SetUint(d);
+}
+
+void DocumentJsonWriter::Uint64(uint64 d)
+{
+    AddValue().SetUint64(d);
+}
+
+void DocumentJsonWriter::Float(float d)
+{
+    AddValue().SetDouble(d);
+}
+
+void DocumentJsonWriter::Double(double d)
+{
+    AddValue().SetDouble(d);
+}
+
+void DocumentJsonWriter::StartObject()
+{
+    rapidjson_flax::Value& value = AddValue();
+    value.SetObject();
+    _stack.Add(&value);
+}
+
+void DocumentJsonWriter::EndObject()
+{
+    _stack.RemoveLast();
+}
+
+void DocumentJsonWriter::StartArray()
+{
+    rapidjson_flax::Value& value = AddValue();
+    value.SetArray();
+    _stack.Add(&value);
+}
+
+void DocumentJsonWriter::EndArray(int32 count)
+{
+    _stack.RemoveLast();
+}
@@ -4,6 +4,7 @@
 
 #include "Json.h"
 #include "JsonWriter.h"
+#include "Engine/Core/Collections/Array.h"
 
 template<typename WriterType>
 class JsonWriterBase : public JsonWriter
@@ -175,3 +176,41 @@ class FLAXENGINE_API PrettyJsonWriterImpl : public rapidjson_flax::PrettyWriter<
 /// Json writer creating prettify text.
 /// </summary>
 typedef JsonWriterBase<PrettyJsonWriterImpl> PrettyJsonWriter;
+
+/// <summary>
+/// Json writer building the document directly (without generating text). Used with JsonBinary to skip text encoding and parsing when data doesn't need to be human-readable (eg. duplicating objects).
+/// </summary>
+class FLAXENGINE_API DocumentJsonWriter : public JsonWriter
+{
+private:
+    rapidjson_flax::Document& _document;
+    rapidjson_flax::Value _key;
+    ::Array<rapidjson_flax::Value*, InlinedAllocation<32>> _stack;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="DocumentJsonWriter"/> class.
+    /// </summary>
+    /// <param name="document">The output document.</param>
+    DocumentJsonWriter(rapidjson_flax::Document& document);
+
+private:
+    rapidjson_flax::Value& AddValue();
+
+public:
+    // [JsonWriter]
+    void Key(const char* str, int32 length) override;
+    void String(const char* str, int32 length) override;
+    void RawValue(const char* json, int32 length) override;
+    void Bool(bool d) override;
+    void Int(int32 d) override;
+    void Int64(int64 d) override;
+    void Uint(uint32 d) override;
+    void Uint64(uint64 d) override;
+    void Float(float d) override;
+    void Double(double d) override;
+    void StartObject() override;
+    void EndObject() override;
+    void StartArray() override;
+    void EndArray(int32 count = 0) override;
+};
@@ -326,8 +326,8 @@ void ReadStream::Read(Variant& data)
         const int32 dataLength = length * sizeof(Char) + 2;
         if (data.AsBlob.Length != dataLength)
         {
-            Allocator::Free(data.AsBlob.Data);
-            data.AsBlob.Data = dataLength > 0 ? Allocator::Allocate(dataLength) : nullptr;
+            Variant::FreeBlob(data.AsBlob.Data, data.AsBlob.Length);
+            data.AsBlob.Data = Variant::AllocateBlob(dataLength);
             data.AsBlob.Length = dataLength;
         }
         Char* ptr = (Char*)data.AsBlob.Data;
@@ -482,8 +482,8 @@ void ReadStream::Read(Variant& data)
         const int32 dataLength = length + 1;
         if (data.AsBlob.Length != dataLength)
         {
-            Allocator::Free(data.AsBlob.Data);
-            data.AsBlob.Data = dataLength > 0 ? Allocator::Allocate(dataLength) : nullptr;
+            Variant::FreeBlob(data.AsBlob.Data, data.AsBlob.Length);
+            data.AsBlob.Data = Variant::AllocateBlob(dataLength);
             data.AsBlob.Length = dataLength;
         }
         char* ptr = (char*)data.AsBlob.Data;
@@ -935,14 +935,14 @@ void WriteStream::WriteJson(ISerializable* obj, const void* otherObj)
     WriteInt32(FLAXENGINE_VERSION_BUILD);
     if (obj)
     {
-        rapidjson_flax::StringBuffer buffer;
-        CompactJsonWriter writer(buffer);
+        auto buffer = Cache::JsonBuffer.Get();
+        CompactJsonWriter writer(*buffer.Value);
         writer.StartObject();
         obj->Serialize(writer, otherObj);
         writer.EndObject();
 
-        WriteInt32((int32)buffer.GetSize());
-        WriteBytes((byte*)buffer.GetString(), (int32)buffer.GetSize());
+        WriteInt32((int32)buffer->GetSize());
+        WriteBytes((byte*)buffer->GetString(), (int32)buffer->GetSize());
     }
     else
         WriteInt32(0);
@@ -1091,12 +1091,12 @@ Array<byte> JsonSerializer::SaveToBytes(ISerializable* obj)
     Array<byte> result;
     if (obj)
     {
-        rapidjson_flax::StringBuffer buffer;
-        CompactJsonWriter writer(buffer);
+        auto buffer = Cache::JsonBuffer.Get();
+        CompactJsonWriter writer(*buffer.Value);
         writer.StartObject();
         obj->Serialize(writer, nullptr);
         writer.EndObject();
-        result.Set((byte*)buffer.GetString(), (int32)buffer.GetSize());
+        result.Set((byte*)buffer->GetString(), (int32)buffer->GetSize());
     }
     return result;
 }
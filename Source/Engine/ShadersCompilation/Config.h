@@ -58,6 +58,11 @@ struct FLAXENGINE_API ShaderCompilationOptions
     /// </summary>
     bool TreatWarningsAsErrors = false;
 
+    /// <summary>
+    /// Enables compiling shader functions in parallel (using Job System threads). Each thread uses a separate compiler instance.
+    /// </summary>
+    bool Parallel = true;
+
     /// <summary>
     /// Custom macros for the shader compilation
     /// </summary>
@@ -368,6 +368,11 @@ bool ShaderCompilerDX::CompileShader(ShaderFunctionMeta& meta, WritePermutationD
         {
             D3D12_SHADER_INPUT_BIND_DESC resDesc;
             shaderReflection->GetResourceBindingDesc(i, &resDesc);
+            if (resDesc.Space != 0)
+            {
+                // Bindless resources tables are bound by the device (see Bindless.hlsl)
+                continue;
+            }
             switch (resDesc.Type)
             {
                 // Sampler
@@ -428,6 +433,7 @@ bool ShaderCompilerDX::OnCompileBegin()
         return true;
 
     _globalMacros.Add({ "DIRECTX", "1" });
+    _globalMacros.Add({ "BINDLESS_RESOURCES", "1" });
 
     return false;
 }
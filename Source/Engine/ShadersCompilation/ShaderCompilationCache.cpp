@@ -0,0 +1,194 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_SHADER_COMPILER && USE_EDITOR
+
+#include "ShaderCompilationCache.h"
+#include "ShadersCompilation.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Utilities/Crc.h"
+#include "FlaxEngine.Gen.h"
+
+// Increment to invalidate the cache entries (eg. when changing the entry format)
+#define SHADER_COMPILATION_CACHE_VERSION 1
+
+namespace
+{
+    struct ContentHash
+    {
+        uint64 Fnv = 14695981039346656037ull;
+        uint32 Crc = 0;
+        uint32 Length = 0;
+
+        void Add(const void* data, int32 length)
+        {
+            const byte* bytes = (const byte*)data;
+            for (int32 i = 0; i < length; i++)
+                Fnv = (Fnv ^ bytes[i]) * 1099511628211ull;
+            Crc = Crc::MemCrc32(data, length, Crc);
+            Length += length;
+        }
+
+        template<typename T>
+        void AddValue(const T& value)
+        {
+            Add(&value, sizeof(T));
+        }
+
+        void AddText(const char* text)
+        {
+            // Include null-terminator to separate texts
+            if (text)
+                Add(text, StringUtils::Length(text) + 1);
+            else
+                AddValue((char)0);
+        }
+
+        Guid ToGuid() const
+        {
+            return Guid((uint32)Fnv, (uint32)(Fnv >> 32), Crc, Length);
+        }
+    };
+
+    String GetCacheFolder()
+    {
+        if (CommandLine::Options.ShaderCache.HasValue() && CommandLine::Options.ShaderCache.GetValue().HasChars())
+            return CommandLine::Options.ShaderCache.GetValue();
+        return Globals::ProjectCacheFolder / TEXT("Shaders/Shared");
+    }
+
+    Guid GetFileHash(const String& path)
+    {
+        Array<byte> data;
+        if (File::ReadAllBytes(path, data))
+            return Guid::Empty;
+        ContentHash hash;
+        hash.Add(data.Get(), data.Count());
+        return hash.ToGuid();
+    }
+}
+
+bool ShaderCompilationCache::CanUse(const ShaderCompilationOptions& options)
+{
+    // Debug data is exported during compilation so skip cache for it
+    return !options.GenerateDebugData && options.Output && options.Output->GetPosition() == 0;
+}
+
+Guid ShaderCompilationCache::GetKey(const ShaderCompilationOptions& options)
+{
+    ContentHash hash;
+    hash.AddValue(SHADER_COMPILATION_CACHE_VERSION);
+    hash.AddValue(GPU_SHADER_CACHE_VERSION);
+    hash.AddValue(FLAXENGINE_VERSION_BUILD);
+    hash.AddValue(options.Profile);
+    hash.AddValue(options.NoOptimize);
+    hash.AddValue(options.TreatWarningsAsErrors);
+    for (const ShaderMacro& macro : options.Macros)
+    {
+        hash.AddText(macro.Name);
+        hash.AddText(macro.Definition);
+    }
+    hash.Add(options.Source, options.SourceLength);
+    return hash.ToGuid();
+}
+
+bool ShaderCompilationCache::TryGet(const ShaderCompilationOptions& options, const Guid& key)
+{
+    PROFILE_CPU();
+    const String path = GetCacheFolder() / key.ToString(Guid::FormatType::N);
+    Array<byte> data;
+    if (!FileSystem::FileExists(path) || File::ReadAllBytes(path, data) || data.Count() < (int32)sizeof(int32) * 2)
+        return false;
+    MemoryReadStream stream(data.Get(), data.Count());
+
+    // Read entry format version
+    int32 version;
+    stream.ReadInt32(&version);
+    if (version != SHADER_COMPILATION_CACHE_VERSION)
+        return false;
+
+    // Validate included files contents
+    int32 includesCount;
+    stream.ReadInt32(&includesCount);
+    Array<String> includes;
+    includes.Resize(includesCount);
+    for (int32 i = 0; i < includesCount; i++)
+    {
+        stream.ReadString(&includes[i], 11);
+        Guid hash;
+        stream.Read(hash);
+        if (GetFileHash(ShadersCompilation::ResolveShaderPath(includes[i])) != hash)
+            return false;
+    }
+
+    // Validate shader cache data
+    int32 size;
+    stream.ReadInt32(&size);
+    if (size < (int32)sizeof(int32) * 2 || stream.GetPosition() + size > (uint32)data.Count())
+        return false;
+    const byte* cache = stream.GetPositionHandle();
+    const int32 additionalDataStart = *(const int32*)(cache + sizeof(int32));
+    if (*(const int32*)cache != GPU_SHADER_CACHE_VERSION || additionalDataStart > size)
+        return false;
+
+    // [Output] Compiled shader data
+    MemoryWriteStream* output = options.Output;
+    output->WriteBytes(cache, additionalDataStart);
+
+    // [Output] Includes (with local files modification dates)
+    output->WriteInt32(includesCount);
+    for (const String& include : includes)
+    {
+        output->WriteString(include, 11);
+        const auto date = FileSystem::GetFileLastEditTime(ShadersCompilation::ResolveShaderPath(include));
+        output->Write(date);
+    }
+
+    return true;
+}
+
+void ShaderCompilationCache::Store(const ShaderCompilationOptions& options, const Guid& key)
+{
+    PROFILE_CPU();
+    MemoryWriteStream* output = options.Output;
+    const int32 size = (int32)output->GetPosition();
+    Array<String> includes;
+    ShadersCompilation::ExtractShaderIncludes(output->GetHandle(), size, includes);
+
+    MemoryWriteStream stream(size + 1024);
+    stream.WriteInt32(SHADER_COMPILATION_CACHE_VERSION);
+    stream.WriteInt32(includes.Count());
+    for (const String& include : includes)
+    {
+        stream.WriteString(ShadersCompilation::CompactShaderPath(include), 11);
+        const Guid hash = GetFileHash(include);
+        stream.Write(hash);
+    }
+    stream.WriteInt32(size);
+    stream.WriteBytes(output->GetHandle(), size);
+
+    // Write to the temporary file first so other processes won't read partially written entry
+    const String folder = GetCacheFolder();
+    if (!FileSystem::DirectoryExists(folder) && FileSystem::CreateDirectory(folder))
+    {
+        LOG(Warning, "Cannot create shader compilation cache directory '{0}'", folder);
+        return;
+    }
+    const String path = folder / key.ToString(Guid::FormatType::N);
+    const String tmpPath = path + TEXT(".") + Guid::New().ToString(Guid::FormatType::N) + TEXT(".tmp");
+    if (File::WriteAllBytes(tmpPath, stream.GetHandle(), (int32)stream.GetPosition()) || FileSystem::MoveFile(path, tmpPath, true))
+    {
+        LOG(Warning, "Failed to save shader compilation cache entry '{0}'", path);
+        FileSystem::DeleteFile(tmpPath);
+    }
+}
+
+#endif
@@ -0,0 +1,46 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_SHADER_COMPILER && USE_EDITOR
+
+#include "Config.h"
+
+/// <summary>
+/// Content-addressed cache of the compiled shaders that can be shared between projects, branches and machines (eg. when placed on a network drive via -shadercache command line argument).
+/// Entries are keyed by the hash of the shader source code, macros, compilation options, shader profile and engine version. Included source files are validated by their contents hash.
+/// </summary>
+class ShaderCompilationCache
+{
+public:
+    /// <summary>
+    /// Checks if the cache can be used for the given compilation.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    /// <returns>True if can use cache, otherwise false.</returns>
+    static bool CanUse(const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Calculates the cache entry key for the given compilation.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    /// <returns>The key.</returns>
+    static Guid GetKey(const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Tries to load the compiled shader from the cache into the compilation output stream.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    /// <param name="key">The cache entry key.</param>
+    /// <returns>True if found a valid entry and written it to the output, otherwise false.</returns>
+    static bool TryGet(const ShaderCompilationOptions& options, const Guid& key);
+
+    /// <summary>
+    /// Stores the compiled shader (from the compilation output stream) in the cache.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    /// <param name="key">The cache entry key.</param>
+    static void Store(const ShaderCompilationOptions& options, const Guid& key);
+};
+
+#endif
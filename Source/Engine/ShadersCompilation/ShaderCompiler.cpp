@@ -12,6 +12,7 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Utilities/StringConverter.h"
@@ -29,28 +30,23 @@ namespace IncludedFiles
     Dictionary<String, File*> Files;
 }
 
-bool ShaderCompiler::Compile(ShaderCompilationContext* context)
+struct ShaderCompiler::ParallelCompilation
 {
-    // Clear cache
-    _globalMacros.Clear();
-    _macros.Clear();
-    _constantBuffers.Clear();
-    _globalMacros.EnsureCapacity(32);
-    _macros.EnsureCapacity(32);
-    _context = context;
+    const Array<ShaderFunction, InlinedAllocation<32>>* Functions;
+    Array<MemoryWriteStream*, InlinedAllocation<32>> Outputs;
+    CriticalSection Locker;
+    int64 NextFunction = 0;
+    int64 Failed = 0;
+};
 
+bool ShaderCompiler::Compile(ShaderCompilationContext* context)
+{
     // Prepare
     auto output = context->Output;
     auto meta = context->Meta;
     const int32 shadersCount = meta->GetShadersCount();
-    if (OnCompileBegin())
+    if (Prepare(context))
         return true;
-    _globalMacros.Add({ nullptr, nullptr });
-
-    // Setup constant buffers cache
-    _constantBuffers.EnsureCapacity(meta->CB.Count(), false);
-    for (int32 i = 0; i < meta->CB.Count(); i++)
-        _constantBuffers.Add({ meta->CB[i].Slot, false, 0 });
 
     // [Output] Version number
     output->WriteInt32(GPU_SHADER_CACHE_VERSION);
@@ -161,97 +157,169 @@ void ShaderCompiler::DisposeIncludedFilesCache()
     IncludedFiles::Files.ClearDelete();
 }
 
-bool ShaderCompiler::CompileShaders()
+bool ShaderCompiler::Prepare(ShaderCompilationContext* context)
 {
-    auto meta = _context->Meta;
+    // Clear cache
+    _globalMacros.Clear();
+    _macros.Clear();
+    _constantBuffers.Clear();
+    _globalMacros.EnsureCapacity(32);
+    _macros.EnsureCapacity(32);
+    _context = context;
+
+    if (OnCompileBegin())
+        return true;
+    _globalMacros.Add({ nullptr, nullptr });
+
+    // Setup constant buffers cache
+    auto meta = context->Meta;
+    _constantBuffers.EnsureCapacity(meta->CB.Count(), false);
+    for (int32 i = 0; i < meta->CB.Count(); i++)
+        _constantBuffers.Add({ meta->CB[i].Slot, false, 0 });
+
+    return false;
+}
+
 #if BUILD_DEBUG
 #define PROFILE_COMPILE_SHADER(s) ZoneTransientN(___tracy_scoped_zone, s.Name.Get(), true);
 #else
 #define PROFILE_COMPILE_SHADER(s)
 #endif
 
-    // Generate vertex shaders cache
+bool ShaderCompiler::CompileShaders()
+{
+    auto meta = _context->Meta;
+
+    // Gather shader functions in the order of the output data
+    Array<ShaderFunction, InlinedAllocation<32>> functions;
     for (int32 i = 0; i < meta->VS.Count(); i++)
     {
-        auto& shader = meta->VS[i];
-        ASSERT(shader.GetStage() == ShaderStage::Vertex && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader, &WriteCustomDataVS))
-        {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
-        }
+        ASSERT(meta->VS[i].GetStage() == ShaderStage::Vertex && (meta->VS[i].Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
+        functions.Add({ &meta->VS[i], &WriteCustomDataVS });
     }
-
-    // Generate hull shaders cache
     for (int32 i = 0; i < meta->HS.Count(); i++)
     {
-        auto& shader = meta->HS[i];
-        ASSERT(shader.GetStage() == ShaderStage::Hull && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader, &WriteCustomDataHS))
-        {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
-        }
+        ASSERT(meta->HS[i].GetStage() == ShaderStage::Hull && (meta->HS[i].Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
+        functions.Add({ &meta->HS[i], &WriteCustomDataHS });
     }
-
-    // Generate domain shaders cache
     for (int32 i = 0; i < meta->DS.Count(); i++)
     {
-        auto& shader = meta->DS[i];
-        ASSERT(shader.GetStage() == ShaderStage::Domain && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
-        {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
-        }
+        ASSERT(meta->DS[i].GetStage() == ShaderStage::Domain && (meta->DS[i].Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
+        functions.Add({ &meta->DS[i], nullptr });
     }
-
-    // Generate geometry shaders cache
     for (int32 i = 0; i < meta->GS.Count(); i++)
     {
-        auto& shader = meta->GS[i];
-        ASSERT(shader.GetStage() == ShaderStage::Geometry && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
+        ASSERT(meta->GS[i].GetStage() == ShaderStage::Geometry && (meta->GS[i].Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
+        functions.Add({ &meta->GS[i], nullptr });
+    }
+    for (int32 i = 0; i < meta->PS.Count(); i++)
+    {
+        ASSERT(meta->PS[i].GetStage() == ShaderStage::Pixel && (meta->PS[i].Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
+        functions.Add({ &meta->PS[i], nullptr });
+    }
+    for (int32 i = 0; i < meta->CS.Count(); i++)
+    {
+        ASSERT(meta->CS[i].GetStage() == ShaderStage::Compute && (meta->CS[i].Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
+        functions.Add({ &meta->CS[i], nullptr });
+    }
+
+    // Compile functions on multiple threads if there is more than one
+    if (_context->Options->Parallel && functions.Count() > 1 && JobSystem::GetThreadsCount() > 1)
+        return CompileShadersParallel(functions);
+
+    // Generate shaders cache
+    for (const ShaderFunction& function : functions)
+    {
+        PROFILE_COMPILE_SHADER((*function.Meta));
+        if (CompileShader(*function.Meta, function.CustomDataWrite))
         {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
+            LOG(Error, "Failed to compile \'{0}\'", String(function.Meta->Name));
             return true;
         }
     }
+    return false;
+}
 
-    // Generate pixel shaders cache
-    for (int32 i = 0; i < meta->PS.Count(); i++)
+bool ShaderCompiler::CompileShadersParallel(const Array<ShaderFunction, InlinedAllocation<32>>& functions)
+{
+    PROFILE_CPU();
+    ParallelCompilation data;
+    data.Functions = &functions;
+    data.Outputs.Resize(functions.Count());
+    Platform::MemoryClear(data.Outputs.Get(), data.Outputs.Count() * sizeof(MemoryWriteStream*));
+
+    // Each job uses a separate compiler (from the pool) and picks the next function to compile into a temporary stream
+    const int32 jobCount = Math::Min(functions.Count(), JobSystem::GetThreadsCount());
+    JobSystem::Execute([this, &data](int32)
+    {
+        CompileShadersJob(&data);
+    }, jobCount);
+
+    // [Output] Compiled functions (in the same order as sequential compilation)
+    const bool failed = Platform::AtomicRead(&data.Failed) != 0;
+    for (MemoryWriteStream* stream : data.Outputs)
+    {
+        if (stream && !failed)
+            _context->Output->WriteBytes(stream->GetHandle(), stream->GetPosition());
+        Delete(stream);
+    }
+    return failed;
+}
+
+void ShaderCompiler::CompileShadersJob(ParallelCompilation* data)
+{
+    ShaderCompiler* compiler = ShadersCompilation::RequestCompiler(_profile);
+    if (compiler == nullptr)
     {
-        auto& shader = meta->PS[i];
-        ASSERT(shader.GetStage() == ShaderStage::Pixel && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
+        Platform::InterlockedIncrement(&data->Failed);
+        return;
+    }
+    ShaderCompilationContext context(_context->Options, _context->Meta);
+    if (compiler->Prepare(&context))
+    {
+        Platform::InterlockedIncrement(&data->Failed);
+        ShadersCompilation::FreeCompiler(compiler);
+        return;
+    }
+    const int32 count = data->Functions->Count();
+    while (Platform::AtomicRead(&data->Failed) == 0)
+    {
+        const int32 index = (int32)Platform::InterlockedIncrement(&data->NextFunction) - 1;
+        if (index >= count)
+            break;
+        const ShaderFunction& function = data->Functions->At(index);
+        PROFILE_COMPILE_SHADER((*function.Meta));
+        auto output = New<MemoryWriteStream>(64 * 1024);
+        data->Outputs[index] = output;
+        context.Output = output;
+        if (compiler->CompileShader(*function.Meta, function.CustomDataWrite))
         {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
+            LOG(Error, "Failed to compile \'{0}\'", String(function.Meta->Name));
+            Platform::InterlockedIncrement(&data->Failed);
         }
     }
 
-    // Generate compute shaders cache
-    for (int32 i = 0; i < meta->CS.Count(); i++)
+    // Merge used constant buffers and included files
+    data->Locker.Lock();
+    for (int32 i = 0; i < _constantBuffers.Count(); i++)
     {
-        auto& shader = meta->CS[i];
-        ASSERT(shader.GetStage() == ShaderStage::Compute && (shader.Flags & ShaderFlags::Hidden) == (ShaderFlags)0);
-        PROFILE_COMPILE_SHADER(shader);
-        if (CompileShader(shader))
+        const ShaderResourceBuffer& cb = compiler->_constantBuffers[i];
+        if (cb.IsUsed)
         {
-            LOG(Error, "Failed to compile \'{0}\'", String(shader.Name));
-            return true;
+            _constantBuffers[i].IsUsed = true;
+            _constantBuffers[i].Size = Math::Max(_constantBuffers[i].Size, cb.Size);
         }
     }
+    for (const auto& include : context.Includes)
+        _context->Includes.Add(include.Item);
+    data->Locker.Unlock();
 
-#undef PROFILE_COMPILE_SHADER
-    return false;
+    compiler->_context = nullptr;
+    ShadersCompilation::FreeCompiler(compiler);
 }
 
+#undef PROFILE_COMPILE_SHADER
+
 bool ShaderCompiler::OnCompileBegin()
 {
     // Setup global macros
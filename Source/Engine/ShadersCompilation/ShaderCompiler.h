@@ -88,9 +88,20 @@ class ShaderCompiler
 
     typedef bool (*WritePermutationData)(ShaderCompilationContext*, ShaderFunctionMeta&, int32, const Array<ShaderMacro>&);
 
+    struct ShaderFunction
+    {
+        ShaderFunctionMeta* Meta;
+        WritePermutationData CustomDataWrite;
+    };
+
+    struct ParallelCompilation;
+
     virtual bool CompileShader(ShaderFunctionMeta& meta, WritePermutationData customDataWrite = nullptr) = 0;
 
+    bool Prepare(ShaderCompilationContext* context);
     bool CompileShaders();
+    bool CompileShadersParallel(const Array<ShaderFunction, InlinedAllocation<32>>& functions);
+    void CompileShadersJob(ParallelCompilation* data);
 
     virtual bool OnCompileBegin();
     virtual bool OnCompileEnd();
@@ -32,6 +32,7 @@
 #include "Engine/Engine/Globals.h"
 #include "Editor/Editor.h"
 #include "Editor/ProjectInfo.h"
+#include "ShaderCompilationCache.h"
 #endif
 #if COMPILE_WITH_D3D_SHADER_COMPILER
 #include "DirectX/ShaderCompilerD3D.h"
@@ -146,6 +147,22 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
         options.SourceLength--;
 
     const DateTime startTime = DateTime::NowUTC();
+
+#if USE_EDITOR
+    // Try to reuse shader compiled before (by any project or machine using the same cache)
+    const bool useCache = ShaderCompilationCache::CanUse(options);
+    Guid cacheKey;
+    if (useCache)
+    {
+        cacheKey = ShaderCompilationCache::GetKey(options);
+        if (ShaderCompilationCache::TryGet(options, cacheKey))
+        {
+            LOG(Info, "Shader compilation '{0}' loaded from cache (profile: {1})", options.TargetName, ::ToString(options.Profile));
+            return false;
+        }
+    }
+#endif
+
     const FeatureLevel featureLevel = RenderTools::GetFeatureLevel(options.Profile);
 
     // Process shader source to collect metadata
@@ -203,6 +220,10 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
     else
     {
         // Success
+#if USE_EDITOR
+        if (useCache)
+            ShaderCompilationCache::Store(options, cacheKey);
+#endif
         const DateTime endTime = DateTime::NowUTC();
         LOG(Info, "Shader compilation '{0}' succeed in {1} ms (profile: {2})", options.TargetName, Math::CeilToInt(static_cast<float>((endTime - startTime).GetTotalMilliseconds())), ::ToString(options.Profile));
     }
@@ -48,6 +48,7 @@ class FLAXENGINE_API ShadersCompilation
     static String CompactShaderPath(StringView path);
 
 private:
+    friend ShaderCompiler;
 
     static ShaderCompiler* CreateCompiler(ShaderProfile profile);
     static ShaderCompiler* RequestCompiler(ShaderProfile profile);
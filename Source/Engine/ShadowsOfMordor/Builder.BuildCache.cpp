@@ -32,6 +32,7 @@ ShadowsOfMordor::Builder::SceneBuildCache::SceneBuildCache()
     : Scene(nullptr)
     , TempLightmapData(nullptr)
     , LightmapsCount(0)
+    , ReusedLightmapsCount(0)
     , HemispheresCount(0)
     , MergedHemispheresCount(0)
     , ImportLightmapIndex(0)
@@ -96,6 +97,8 @@ void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmaps()
     {
         // Cache data
         auto& lightmapEntry = Lightmaps[lightmapIndex];
+        if (lightmapEntry.Reuse)
+            continue;
         auto lightmap = Scene->LightmapsData.GetLightmap(lightmapIndex);
         ASSERT(lightmap);
         lightmap->GetTextures(lightmaps);
@@ -155,6 +158,9 @@ void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmaps()
             lightmap->UpdateTexture(result, textureIndex);
         }
 
+        // Mark lightmap as up-to-date with the baking inputs only after the last bounce
+        lightmap->SetBakeHash(Builder->_giBounceRunningIndex == Builder->_bounceCount - 1 ? lightmapEntry.BakeHash : 0);
+
 #if DEBUG_EXPORT_LIGHTMAPS_PREVIEW
         // Temporary save lightmaps (after last bounce)
         if (Builder->_giBounceRunningIndex == Builder->_bounceCount - 1)
@@ -13,8 +13,9 @@
 
 bool ShadowsOfMordor::Builder::sortCharts(const LightmapUVsChart& a, const LightmapUVsChart& b)
 {
-    // Sort by area
-    return (b.Width * b.Height) < (a.Width * a.Height);
+    // Sort by area (use entry index for charts of the same size to keep packing stable between bakes)
+    const int32 areaA = a.Width * a.Height, areaB = b.Width * b.Height;
+    return areaB < areaA || (areaA == areaB && a.EntryIndex < b.EntryIndex);
 }
 
 void ShadowsOfMordor::Builder::generateCharts()
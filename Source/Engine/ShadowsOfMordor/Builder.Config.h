@@ -37,8 +37,10 @@ namespace ShadowsOfMordor
 // Adjustable configuration
 #define LIGHTMAP_SCALE_MAX 1000000.0f
 #define HEMISPHERES_RENDERING_TARGET_FPS 24
+#define HEMISPHERES_RENDERING_TARGET_FPS_HEADLESS 4
 #define HEMISPHERES_PER_JOB_MIN 10
 #define HEMISPHERES_PER_JOB_MAX 1000
+#define HEMISPHERES_PER_JOB_MAX_HEADLESS 20000
 #define HEMISPHERES_PER_GPU_FLUSH 15
 #define HEMISPHERES_FOV 120.0f
 #define HEMISPHERES_NEAR_PLANE 0.1f
@@ -47,6 +49,7 @@ namespace ShadowsOfMordor
 #define HEMISPHERES_BAKE_STATE_SAVE 1
 #define HEMISPHERES_BAKE_STATE_SAVE_DELAY 300
 #define CACHE_ENTRIES_PER_JOB 10
+#define INCREMENTAL_BAKING_INFLUENCE_DISTANCE 2000.0f
 #define CACHE_POSITIONS_FORMAT HEMISPHERES_FORMAT_R32G32B32A32
 #define CACHE_NORMALS_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
 
@@ -60,8 +60,8 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
             }
             for (_workerActiveSceneIndex = firstScene + 1; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
             {
-                // Skip scenes without any lightmaps
-                if (_scenes[_workerActiveSceneIndex]->Lightmaps.IsEmpty())
+                // Skip scenes without any lightmaps to bake
+                if (!_scenes[_workerActiveSceneIndex]->HasLightmapsToBake())
                     continue;
 
                 // Clear hemispheres target
@@ -108,8 +108,8 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
             // Render bounce for every scene separately
             for (_workerActiveSceneIndex = firstScene; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
             {
-                // Skip scenes without any lightmaps
-                if (_scenes[_workerActiveSceneIndex]->Lightmaps.IsEmpty())
+                // Skip scenes without any lightmaps to bake
+                if (!_scenes[_workerActiveSceneIndex]->HasLightmapsToBake())
                     continue;
 
                 // Clear hemispheres target
@@ -168,11 +168,17 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         RUN_STEP(updateEntries);
     }
 
+    // Detect lightmaps that didn't change since the last bake (incremental baking)
+    RUN_STEP(updateBakeHashes);
+
     // TODO: if settings require wait for asset dependencies to all materials and models be loaded (maybe only for higher quality profiles)
 
     // Generate hemispheres cache and prepare for baking
     for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
     {
+        if (!_scenes[_workerActiveSceneIndex]->HasLightmapsToBake())
+            continue;
+
         // Wait for lightmaps to be fully loaded
         if (_scenes[_workerActiveSceneIndex]->WaitForLightmaps())
         {
@@ -215,6 +221,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     int32 mergedHemispheresCount = 0;
     int32 bounceCount = 0;
     int32 lightmapsCount = 0;
+    int32 reusedLightmapsCount = 0;
     int32 entriesCount = 0;
     for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
     {
@@ -222,6 +229,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         hemispheresCount += scene.HemispheresCount;
         mergedHemispheresCount += scene.MergedHemispheresCount;
         lightmapsCount += scene.Lightmaps.Count();
+        reusedLightmapsCount += scene.ReusedLightmapsCount;
         entriesCount += scene.Entries.Count();
         bounceCount = Math::Max(bounceCount, scene.GetSettings().BounceCount);
 
@@ -232,6 +240,15 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
             lightmap.Entries.Resize(0);
     }
     _bounceCount = bounceCount;
+    if (reusedLightmapsCount != 0)
+    {
+        LOG(Info, "Reusing {0} of {1} lightmap(s) baked previously", reusedLightmapsCount, lightmapsCount);
+        if (reusedLightmapsCount == lightmapsCount)
+        {
+            LOG(Info, "Lightmaps are up to date");
+            return false;
+        }
+    }
     LOG(Info, "Rendering {0} hemispheres in {1} bounce(s) (merged: {2})", hemispheresCount, bounceCount, mergedHemispheresCount);
     if (bounceCount <= 0 || hemispheresCount <= 0)
     {
@@ -263,8 +280,8 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         // Render bounce for every scene separately
         for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
         {
-            // Skip scenes without any lightmaps
-            if (_scenes[_workerActiveSceneIndex]->Lightmaps.IsEmpty())
+            // Skip scenes without any lightmaps to bake
+            if (!_scenes[_workerActiveSceneIndex]->HasLightmapsToBake())
                 continue;
 
             // Clear hemispheres target
@@ -5,12 +5,55 @@
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Level/Actors/BoxBrush.h"
 #include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Level/Actors/PointLight.h"
+#include "Engine/Level/Actors/SpotLight.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Terrain/Terrain.h"
 #include "Engine/Terrain/TerrainPatch.h"
 #include "Engine/Foliage/Foliage.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Utilities/Crc.h"
+
+namespace
+{
+    struct BakeInfluence
+    {
+        BoundingBox Box;
+        uint32 Hash;
+    };
+
+    struct BakeHashesData
+    {
+        rapidjson_flax::StringBuffer Buffer;
+        Array<BakeInfluence> Local;
+        uint32 GlobalHash = 0;
+    };
+
+    bool hashBakeInputsTree(Actor* actor, BakeHashesData* data)
+    {
+        if (!actor->GetIsActive())
+            return false;
+        if (!actor->HasStaticFlag(StaticFlags::Lightmap) || actor->Is<Scene>())
+            return true;
+
+        // Hash the whole actor state (includes assets, properties and lightmap entries) and its world placement
+        data->Buffer.Clear();
+        CompactJsonWriter writer(data->Buffer);
+        writer.SceneObject(actor);
+        uint32 hash = Crc::MemCrc32(data->Buffer.GetString(), (int32)data->Buffer.GetSize());
+        const Transform transform = actor->GetTransform();
+        hash = Crc::MemCrc32(&transform, sizeof(transform), hash);
+
+        // Geometry and local lights affect only the nearby lightmaps, other objects (eg. directional light or sky) affect all of them
+        if (actor->Is<StaticModel>() || actor->Is<Terrain>() || actor->Is<Foliage>() || actor->Is<PointLight>() || actor->Is<SpotLight>())
+            data->Local.Add({ actor->GetBox(), hash });
+        else
+            data->GlobalHash = Crc::MemCrc32(&hash, sizeof(hash), data->GlobalHash);
+        return true;
+    }
+}
 
 bool canUseMaterialWithLightmap(MaterialBase* material, ShadowsOfMordor::Builder::SceneBuildCache* scene)
 {
@@ -264,3 +307,60 @@ void ShadowsOfMordor::Builder::updateEntries()
     scene->EntriesLocker.Unlock();
     reportProgress(BuildProgressStep::UpdateEntries, 1.0f);
 }
+
+void ShadowsOfMordor::Builder::updateBakeHashes()
+{
+    ScopeLock lock(Level::ScenesLock);
+
+    // Gather all objects that contribute to the baked lighting (from all scenes)
+    BakeHashesData data;
+    Function<bool(Actor*, BakeHashesData*)> hashBakeInputs = &hashBakeInputsTree;
+    for (auto scene : _scenes)
+        scene->Scene->TreeExecute(hashBakeInputs, &data);
+
+    // Compute hash of inputs affecting each lightmap and reuse lightmaps that haven't changed since the last bake
+    for (auto scene : _scenes)
+    {
+        ScopeLock entriesLock(scene->EntriesLocker);
+        auto& settings = scene->GetSettings();
+        data.Buffer.Clear();
+        CompactJsonWriter writer(data.Buffer);
+        writer.Object((ISerializable*)&settings, nullptr);
+        const uint32 sceneHash = Crc::MemCrc32(data.Buffer.GetString(), (int32)data.Buffer.GetSize(), data.GlobalHash);
+        scene->ReusedLightmapsCount = 0;
+        for (int32 lightmapIndex = 0; lightmapIndex < scene->Lightmaps.Count(); lightmapIndex++)
+        {
+            auto& lightmapEntry = scene->Lightmaps[lightmapIndex];
+            uint32 hash = Crc::MemCrc32(&lightmapIndex, sizeof(lightmapIndex), sceneHash);
+
+            // Include charts placement and bounds of the lightmap geometry
+            BoundingBox bounds = BoundingBox::Empty;
+            for (int32 i = 0; i < lightmapEntry.Entries.Count(); i++)
+            {
+                const auto& e = scene->Entries[lightmapEntry.Entries[i]];
+                const auto& chart = scene->Charts[e.ChartIndex];
+                hash = Crc::MemCrc32(&chart.Result, sizeof(chart.Result), hash);
+                hash = Crc::MemCrc32(&e.Box, sizeof(e.Box), hash);
+                if (i == 0)
+                    bounds = e.Box;
+                else
+                    BoundingBox::Merge(bounds, e.Box, bounds);
+            }
+
+            // Include objects around the lightmap geometry that contribute to its lighting (direct and bounced)
+            bounds.Minimum -= Vector3(INCREMENTAL_BAKING_INFLUENCE_DISTANCE);
+            bounds.Maximum += Vector3(INCREMENTAL_BAKING_INFLUENCE_DISTANCE);
+            for (const auto& influence : data.Local)
+            {
+                if (bounds.Intersects(influence.Box))
+                    hash = Crc::MemCrc32(&influence.Hash, sizeof(influence.Hash), hash);
+            }
+
+            lightmapEntry.BakeHash = hash;
+            const auto lightmap = scene->Scene->LightmapsData.GetLightmap(lightmapIndex);
+            lightmapEntry.Reuse = settings.IncrementalBaking && lightmap && lightmap->GetBakeHash() == hash && lightmapEntry.Entries.HasItems();
+            if (lightmapEntry.Reuse)
+                scene->ReusedLightmapsCount++;
+        }
+    }
+}
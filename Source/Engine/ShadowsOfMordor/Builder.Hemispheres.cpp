@@ -73,6 +73,8 @@ void ShadowsOfMordor::Builder::generateHemispheres()
         // Prepare
         auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
         lightmapEntry.Hemispheres.Clear();
+        if (lightmapEntry.Reuse)
+            continue;
         lightmapEntry.Hemispheres.EnsureCapacity(Math::Square(atlasSize / 2));
         Float3 position, normal;
 
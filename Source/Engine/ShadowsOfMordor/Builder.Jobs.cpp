@@ -53,7 +53,7 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         uint32 cleanerSize = 0;
         for (int32 i = 0; i < scene->Lightmaps.Count(); i++)
         {
-            auto lightmap = scene->Scene->LightmapsData.GetLightmap(_workerStagePosition0);
+            auto lightmap = scene->Scene->LightmapsData.GetLightmap(i);
             GPUTexture* textures[NUM_SH_TARGETS];
             lightmap->GetTextures(textures);
             for (int32 textureIndex = 0; textureIndex < NUM_SH_TARGETS; textureIndex++)
@@ -64,6 +64,8 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
 
         for (; _workerStagePosition0 < scene->Lightmaps.Count(); _workerStagePosition0++)
         {
+            if (scene->Lightmaps[_workerStagePosition0].Reuse)
+                continue;
             auto lightmap = scene->Scene->LightmapsData.GetLightmap(_workerStagePosition0);
             GPUTexture* textures[NUM_SH_TARGETS];
             lightmap->GetTextures(textures);
@@ -282,11 +284,9 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         // Before hemispheres rendering we have to clear target lightmap data
         // Later we use blur shader to interpolate empty texels (so empty texels should be pure black)
 
-        ASSERT(scene->Lightmaps.Count() > _workerStagePosition0);
-        auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
-
         // All black everything!
-        context->ClearUA(lightmapEntry.LightmapData, Float4::Zero);
+        for (; _workerStagePosition0 < scene->Lightmaps.Count(); _workerStagePosition0++)
+            context->ClearUA(scene->Lightmaps[_workerStagePosition0].LightmapData, Float4::Zero);
 
         _wasStageDone = true;
         break;
@@ -294,15 +294,8 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
     case RenderHemispheres:
     {
         auto now = DateTime::Now();
-        auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
 
 #if HEMISPHERES_BAKE_STATE_SAVE
-        if (lightmapEntry.LightmapDataInit.HasItems())
-        {
-            context->UpdateBuffer(lightmapEntry.LightmapData, lightmapEntry.LightmapDataInit.Get(), lightmapEntry.LightmapDataInit.Count());
-            lightmapEntry.LightmapDataInit.Resize(0);
-        }
-
         // Every few minutes save the baking state to restore it in case of GPU driver crash
         if (now - _lastStateSaveTime >= TimeSpan::FromSeconds(HEMISPHERES_BAKE_STATE_SAVE_DELAY))
         {
@@ -314,20 +307,23 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         PROFILE_GPU_CPU_NAMED("RenderHemispheres");
 
         // Dynamically adjust hemispheres to render per-job to minimize the bake speed but without GPU hangs
+        // Headless bakes (eg. on build servers) don't need to keep the editor responsive so use much larger GPU batches per frame
         if (now - _hemispheresPerJobUpdateTime >= TimeSpan::FromSeconds(1.0))
         {
             _hemispheresPerJobUpdateTime = now;
+            const bool headless = Engine::IsHeadless();
+            const int32 targetFps = headless ? HEMISPHERES_RENDERING_TARGET_FPS_HEADLESS : HEMISPHERES_RENDERING_TARGET_FPS;
             const int32 fps = Engine::GetFramesPerSecond();
             int32 hemispheresPerJob = _hemispheresPerJob;
-            if (fps > HEMISPHERES_RENDERING_TARGET_FPS * 5)
+            if (fps > targetFps * 5)
                 hemispheresPerJob *= 4;
-            else if (fps > HEMISPHERES_RENDERING_TARGET_FPS * 3)
+            else if (fps > targetFps * 3)
                 hemispheresPerJob *= 2;
-            else if (fps > (int32)(HEMISPHERES_RENDERING_TARGET_FPS * 1.5f))
+            else if (fps > (int32)(targetFps * 1.5f))
                 hemispheresPerJob = Math::RoundToInt((float)hemispheresPerJob * 1.1f);
-            else if (fps < (int32)(HEMISPHERES_RENDERING_TARGET_FPS * 0.8f))
+            else if (fps < (int32)(targetFps * 0.8f))
                 hemispheresPerJob = Math::RoundToInt((float)hemispheresPerJob * 0.9f);
-            hemispheresPerJob = Math::Clamp(hemispheresPerJob, HEMISPHERES_PER_JOB_MIN, HEMISPHERES_PER_JOB_MAX);
+            hemispheresPerJob = Math::Clamp(hemispheresPerJob, HEMISPHERES_PER_JOB_MIN, headless ? HEMISPHERES_PER_JOB_MAX_HEADLESS : HEMISPHERES_PER_JOB_MAX);
             if (hemispheresPerJob != _hemispheresPerJob)
             {
                 LOG(Info, "Changing GI baking hemispheres count per job from {0} to {1}", _hemispheresPerJob, hemispheresPerJob);
@@ -347,89 +343,102 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         ProfilerGPU::EventsEnabled = false;
 #endif
 
-        // Render hemispheres
-        for (; _workerStagePosition1 < lightmapEntry.Hemispheres.Count(); _workerStagePosition1++)
+        // Render hemispheres (continue with the next lightmaps when the current one gets finished to use the whole job budget)
+        for (; _workerStagePosition0 < scene->Lightmaps.Count() && hemispheresToRenderLeft != 0; _workerStagePosition0++, _workerStagePosition1 = 0)
         {
-            if (hemispheresToRenderLeft == 0)
-                break;
-            hemispheresToRenderLeft--;
-            auto& hemisphere = lightmapEntry.Hemispheres[_workerStagePosition1];
-
-            // Create tangent frame
-            Float3 tangent;
-            Float3 c1 = Float3::Cross(hemisphere.Normal, Float3(0.0, 0.0, 1.0));
-            Float3 c2 = Float3::Cross(hemisphere.Normal, Float3(0.0, 1.0, 0.0));
-            tangent = c1.Length() > c2.Length() ? c1 : c2;
-            tangent = Float3::Normalize(tangent);
-            const Float3 binormal = Float3::Cross(tangent, hemisphere.Normal);
-
-            // Setup view
-            const Vector3 pos = hemisphere.Position + hemisphere.Normal * 0.001f;
-            Matrix::LookAt(pos, pos + hemisphere.Normal, tangent, view);
-            _task->View.SetUp(view, projection);
-            _task->View.Position = pos;
-            _task->View.Direction = hemisphere.Normal;
-
-            // Render hemisphere
-            // TODO: maybe render geometry backfaces in postLightPass to set the pure black? - to remove light leaking
-            IsRunningRadiancePass = true;
-            EnableLightmapsUsage = _giBounceRunningIndex != 0;
-            //
-            Renderer::Render(_task);
-            context->ClearState();
-            //
-            IsRunningRadiancePass = false;
-            EnableLightmapsUsage = true;
-            auto radianceMap = _output->View();
+            auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+#if HEMISPHERES_BAKE_STATE_SAVE
+            if (lightmapEntry.LightmapDataInit.HasItems())
+            {
+                context->UpdateBuffer(lightmapEntry.LightmapData, lightmapEntry.LightmapDataInit.Get(), lightmapEntry.LightmapDataInit.Count());
+                lightmapEntry.LightmapDataInit.Resize(0);
+            }
+#endif
+            for (; _workerStagePosition1 < lightmapEntry.Hemispheres.Count(); _workerStagePosition1++)
+            {
+                if (hemispheresToRenderLeft == 0)
+                    break;
+                hemispheresToRenderLeft--;
+                auto& hemisphere = lightmapEntry.Hemispheres[_workerStagePosition1];
+
+                // Create tangent frame
+                Float3 tangent;
+                Float3 c1 = Float3::Cross(hemisphere.Normal, Float3(0.0, 0.0, 1.0));
+                Float3 c2 = Float3::Cross(hemisphere.Normal, Float3(0.0, 1.0, 0.0));
+                tangent = c1.Length() > c2.Length() ? c1 : c2;
+                tangent = Float3::Normalize(tangent);
+                const Float3 binormal = Float3::Cross(tangent, hemisphere.Normal);
+
+                // Setup view
+                const Vector3 pos = hemisphere.Position + hemisphere.Normal * 0.001f;
+                Matrix::LookAt(pos, pos + hemisphere.Normal, tangent, view);
+                _task->View.SetUp(view, projection);
+                _task->View.Position = pos;
+                _task->View.Direction = hemisphere.Normal;
+
+                // Render hemisphere
+                // TODO: maybe render geometry backfaces in postLightPass to set the pure black? - to remove light leaking
+                IsRunningRadiancePass = true;
+                EnableLightmapsUsage = _giBounceRunningIndex != 0;
+                //
+                Renderer::Render(_task);
+                context->ClearState();
+                //
+                IsRunningRadiancePass = false;
+                EnableLightmapsUsage = true;
+                auto radianceMap = _output->View();
 
 #if DEBUG_EXPORT_HEMISPHERES_PREVIEW
-            addDebugHemisphere(context, radianceMap);
+                addDebugHemisphere(context, radianceMap);
 #endif
 
-            // Setup shader data
-            Matrix worldToTangent;
-            worldToTangent.SetRow1(Float4(tangent, 0.0f));
-            worldToTangent.SetRow2(Float4(binormal, 0.0f));
-            worldToTangent.SetRow3(Float4(hemisphere.Normal, 0.0f));
-            worldToTangent.SetRow4(Float4(0.0f, 0.0f, 0.0f, 1.0f));
-            worldToTangent.Invert();
-            //
-            Matrix viewToWorld; // viewToWorld is inverted view, since view is worldToView
-            Matrix::Invert(view, viewToWorld);
-            viewToWorld.SetRow4(Float4(0.0f, 0.0f, 0.0f, 1.0f)); // reset translation row
-            Matrix viewToTangent;
-            Matrix::Multiply(viewToWorld, worldToTangent, viewToTangent);
-            Matrix::Transpose(viewToTangent, shaderData.ToTangentSpace);
-            shaderData.FinalWeight = _hemisphereTexelsTotalWeight;
-            shaderData.AtlasSize = atlasSize;
-            shaderData.TexelAddress = (hemisphere.TexelY * atlasSize + hemisphere.TexelX) * NUM_SH_TARGETS;
-
-            // Calculate per pixel irradiance using compute shaders
-            auto cb = _shader->GetShader()->GetCB(0);
-            context->UpdateCB(cb, &shaderData);
-            context->BindCB(0, cb);
-            context->BindUA(0, _irradianceReduction->View());
-            context->BindSR(0, radianceMap);
-            context->Dispatch(_shader->GetShader()->GetCS("CS_Integrate"), 1, HEMISPHERES_RESOLUTION, 1);
-            context->ResetUA();
-            context->ResetSR();
-
-            // Downscale H-basis to 1x1 and copy results to lightmap data buffer
-            context->BindUA(0, lightmapEntry.LightmapData->View());
-            context->BindSR(0, _irradianceReduction->View());
-            // TODO: cache shader handle
-            context->Dispatch(_shader->GetShader()->GetCS("CS_Reduction"), 1, NUM_SH_TARGETS, 1);
-
-            // Unbind slots now to make rendering backend live easier
-            context->ResetSR();
-            context->ResetUA();
-
-            // Keep GPU busy
-            if (hemispheresToRenderBeforeSyncLeft-- < 0)
-            {
-                hemispheresToRenderBeforeSyncLeft = HEMISPHERES_PER_GPU_FLUSH;
-                context->Flush();
+                // Setup shader data
+                Matrix worldToTangent;
+                worldToTangent.SetRow1(Float4(tangent, 0.0f));
+                worldToTangent.SetRow2(Float4(binormal, 0.0f));
+                worldToTangent.SetRow3(Float4(hemisphere.Normal, 0.0f));
+                worldToTangent.SetRow4(Float4(0.0f, 0.0f, 0.0f, 1.0f));
+                worldToTangent.Invert();
+                //
+                Matrix viewToWorld; // viewToWorld is inverted view, since view is worldToView
+                Matrix::Invert(view, viewToWorld);
+                viewToWorld.SetRow4(Float4(0.0f, 0.0f, 0.0f, 1.0f)); // reset translation row
+                Matrix viewToTangent;
+                Matrix::Multiply(viewToWorld, worldToTangent, viewToTangent);
+                Matrix::Transpose(viewToTangent, shaderData.ToTangentSpace);
+                shaderData.FinalWeight = _hemisphereTexelsTotalWeight;
+                shaderData.AtlasSize = atlasSize;
+                shaderData.TexelAddress = (hemisphere.TexelY * atlasSize + hemisphere.TexelX) * NUM_SH_TARGETS;
+
+                // Calculate per pixel irradiance using compute shaders
+                auto cb = _shader->GetShader()->GetCB(0);
+                context->UpdateCB(cb, &shaderData);
+                context->BindCB(0, cb);
+                context->BindUA(0, _irradianceReduction->View());
+                context->BindSR(0, radianceMap);
+                context->Dispatch(_shader->GetShader()->GetCS("CS_Integrate"), 1, HEMISPHERES_RESOLUTION, 1);
+                context->ResetUA();
+                context->ResetSR();
+
+                // Downscale H-basis to 1x1 and copy results to lightmap data buffer
+                context->BindUA(0, lightmapEntry.LightmapData->View());
+                context->BindSR(0, _irradianceReduction->View());
+                // TODO: cache shader handle
+                context->Dispatch(_shader->GetShader()->GetCS("CS_Reduction"), 1, NUM_SH_TARGETS, 1);
+
+                // Unbind slots now to make rendering backend live easier
+                context->ResetSR();
+                context->ResetUA();
+
+                // Keep GPU busy
+                if (hemispheresToRenderBeforeSyncLeft-- < 0)
+                {
+                    hemispheresToRenderBeforeSyncLeft = HEMISPHERES_PER_GPU_FLUSH;
+                    context->Flush();
+                }
             }
+            if (_workerStagePosition1 < lightmapEntry.Hemispheres.Count())
+                break;
         }
 #if COMPILE_WITH_PROFILER
         ProfilerGPU::Enabled = gpuProfilerEnabled;
@@ -437,23 +446,15 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
 #endif
 
         // Report progress
-        float hemispheresProgress = static_cast<float>(_workerStagePosition1) / Math::Max(lightmapEntry.Hemispheres.Count(), 1);
+        float hemispheresProgress = _workerStagePosition0 < scene->Lightmaps.Count() ? static_cast<float>(_workerStagePosition1) / Math::Max(scene->Lightmaps[_workerStagePosition0].Hemispheres.Count(), 1) : 0.0f;
         float lightmapsProgress = static_cast<float>(_workerStagePosition0 + hemispheresProgress) / scene->Lightmaps.Count();
         float bouncesProgress = static_cast<float>(_giBounceRunningIndex) / _bounceCount;
         reportProgress(BuildProgressStep::RenderHemispheres, lightmapsProgress / _bounceCount + bouncesProgress);
 
-        // Check if work has been finished
-        if (hemispheresProgress >= 1.0f)
+        // Check if it's stage end
+        if (_workerStagePosition0 >= scene->Lightmaps.Count())
         {
-            // Move to another lightmap
-            _workerStagePosition0++;
-            _workerStagePosition1 = 0;
-
-            // Check if it's stage end
-            if (_workerStagePosition0 == scene->Lightmaps.Count())
-            {
-                _wasStageDone = true;
-            }
+            _wasStageDone = true;
         }
         break;
     }
@@ -463,6 +464,15 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
 
         // Let's blur generated lightmaps to reduce amount of black artifacts and holes
 
+        // Skip lightmaps reused from the previous bake
+        while (_workerStagePosition0 < scene->Lightmaps.Count() && scene->Lightmaps[_workerStagePosition0].Reuse)
+            _workerStagePosition0++;
+        if (_workerStagePosition0 >= scene->Lightmaps.Count())
+        {
+            _wasStageDone = true;
+            break;
+        }
+
         // Prepare
         auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
         ShaderData shaderData;
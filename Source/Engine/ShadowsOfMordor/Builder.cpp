@@ -190,7 +190,7 @@ bool ShadowsOfMordor::Builder::RestoreState()
     auto stream = FileReadStream::Open(path);
     int32 version;
     stream->ReadInt32(&version);
-    if (version != 1)
+    if (version != 2)
     {
         LOG(Error, "Invalid version.");
         Delete(stream);
@@ -233,7 +233,7 @@ void ShadowsOfMordor::Builder::saveState()
     }
 
     // Format version
-    stream->WriteInt32(1);
+    stream->WriteInt32(2);
 
     // Scenes ids
     stream->WriteInt32(_scenes.Count());
@@ -253,6 +253,7 @@ void ShadowsOfMordor::Builder::saveState()
     {
         auto& scene = _scenes[sceneIndex];
         stream->WriteInt32(scene->LightmapsCount);
+        stream->WriteInt32(scene->ReusedLightmapsCount);
         stream->WriteInt32(scene->HemispheresCount);
         stream->WriteInt32(scene->MergedHemispheresCount);
 
@@ -262,6 +263,8 @@ void ShadowsOfMordor::Builder::saveState()
         for (int32 lightmapIndex = 0; lightmapIndex < scene->LightmapsCount; lightmapIndex++)
         {
             auto& lightmap = scene->Lightmaps[lightmapIndex];
+            stream->WriteBool(lightmap.Reuse);
+            stream->WriteUint32(lightmap.BakeHash);
 
             // Hemispheres
             stream->WriteInt32(lightmap.Hemispheres.Count());
@@ -308,7 +311,7 @@ bool ShadowsOfMordor::Builder::loadState()
     auto stream = FileReadStream::Open(path);
     int32 version;
     stream->ReadInt32(&version);
-    if (version != 1)
+    if (version != 2)
     {
         LOG(Error, "Invalid version.");
         Delete(stream);
@@ -352,6 +355,7 @@ bool ShadowsOfMordor::Builder::loadState()
     {
         auto& scene = _scenes[sceneIndex];
         stream->ReadInt32(&scene->LightmapsCount);
+        stream->ReadInt32(&scene->ReusedLightmapsCount);
         stream->ReadInt32(&scene->HemispheresCount);
         stream->ReadInt32(&scene->MergedHemispheresCount);
 
@@ -362,6 +366,8 @@ bool ShadowsOfMordor::Builder::loadState()
         {
             auto& lightmap = scene->Lightmaps[lightmapIndex];
             lightmap.Init(&scene->GetSettings());
+            lightmap.Reuse = stream->ReadBool();
+            stream->ReadUint32(&lightmap.BakeHash);
 
             // Hemispheres
             int32 hemispheresCount;
@@ -121,6 +121,10 @@ namespace ShadowsOfMordor
             Array<int32> Entries;
             Array<HemisphereData> Hemispheres;
             GPUBuffer* LightmapData = nullptr;
+            // Hash of the baking inputs that affect this lightmap (geometry and lights around its charts)
+            uint32 BakeHash = 0;
+            // True if baking inputs didn't change since the last bake so the existing lightmap textures are reused (incremental baking)
+            bool Reuse = false;
 #if HEMISPHERES_BAKE_STATE_SAVE
             // Restored data for the lightmap from the loaded state (copied to the LightmapData on first hemispheres render job)
             Array<byte> LightmapDataInit;
@@ -152,6 +156,7 @@ namespace ShadowsOfMordor
 
             // Stats
             int32 LightmapsCount;
+            int32 ReusedLightmapsCount;
             int32 HemispheresCount;
             int32 MergedHemispheresCount;
 
@@ -170,6 +175,14 @@ namespace ShadowsOfMordor
             /// <returns>Settings</returns>
             const LightmapSettings& GetSettings() const;
 
+            /// <summary>
+            /// Determines whether scene has any lightmaps to render (excluding the ones reused from the previous bake).
+            /// </summary>
+            bool HasLightmapsToBake() const
+            {
+                return Lightmaps.Count() > ReusedLightmapsCount;
+            }
+
         public:
 
             /// <summary>
@@ -327,6 +340,7 @@ namespace ShadowsOfMordor
         void packCharts();
         void updateLightmaps();
         void updateEntries();
+        void updateBakeHashes();
         void generateHemispheres();
 
 #if DEBUG_EXPORT_LIGHTMAPS_PREVIEW
@@ -50,4 +50,36 @@ class FLAXENGINE_API IStreamingHandler
     {
         return currentResidency != targetResidency;
     }
+
+    /// <summary>
+    /// Calculates the streaming priority of the given resource (higher values are updated first and evicted last when running out of the memory budget).
+    /// </summary>
+    /// <param name="resource">The resource.</param>
+    /// <param name="currentTime">The current platform time (seconds).</param>
+    /// <returns>The priority (0-1).</returns>
+    virtual float CalculatePriority(StreamableResource* resource, double currentTime)
+    {
+        return 1.0f;
+    }
+
+    /// <summary>
+    /// Calculates the GPU memory used by the given resource at the specified residency level. Used to enforce the streaming memory budgets.
+    /// </summary>
+    /// <param name="resource">The resource.</param>
+    /// <param name="residency">The residency level.</param>
+    /// <returns>The memory size (in bytes), zero if resource is not limited by the memory budget.</returns>
+    virtual uint64 CalculateMemoryUsage(StreamableResource* resource, int32 residency)
+    {
+        return 0;
+    }
+
+    /// <summary>
+    /// Gets the index of the texture group that the given resource memory budget is accounted to.
+    /// </summary>
+    /// <param name="resource">The resource.</param>
+    /// <returns>The texture group index, or -1 if not used.</returns>
+    virtual int32 GetTextureGroup(StreamableResource* resource)
+    {
+        return -1;
+    }
 };
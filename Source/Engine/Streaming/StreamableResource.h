@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Delegate.h"
 #include "Engine/Core/Collections/SamplesBuffer.h"
+#include "Engine/Core/Collections/HandlePool.h"
 
 class StreamingGroup;
 class Task;
@@ -17,6 +18,7 @@ class FLAXENGINE_API StreamableResource
 
     StreamingGroup* _group;
     bool _isDynamic, _isStreaming;
+    PoolHandle _streamingHandle;
     float _streamingQuality;
 
     StreamableResource(StreamingGroup* group);
@@ -113,6 +115,11 @@ class FLAXENGINE_API StreamableResource
         double LastUpdateTime = 0.0;
         double TargetResidencyChangeTime = 0;
         int32 TargetResidency = 0;
+        int32 WantedResidency = 0;
+        int32 LastResidency = 0;
+        int32 BudgetResidency = MAX_int32;
+        float Priority = 0.0f;
+        mutable double PrefetchTime = -1.0;
         bool Error = false;
         SamplesBuffer<float, 5> QualitySamples;
     };
@@ -128,6 +135,20 @@ class FLAXENGINE_API StreamableResource
     /// Requests the streaming update for this resource during next streaming manager update.
     /// </summary>
     void RequestStreamingUpdate();
+
+    /// <summary>
+    /// Requests this resource to be streamed in as if it was used (eg. it's going to be visible soon).
+    /// </summary>
+    /// <param name="endTime">The time (see Platform::GetTimeSeconds) until which the resource stays prefetched.</param>
+    void Prefetch(double endTime) const;
+
+    /// <summary>
+    /// Checks if this resource is prefetched at the given time.
+    /// </summary>
+    FORCE_INLINE bool IsPrefetched(double currentTime) const
+    {
+        return Streaming.PrefetchTime >= currentTime;
+    }
     
     /// <summary>
     /// Stops the streaming (eg. on streaming fail).
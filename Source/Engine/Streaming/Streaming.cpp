@@ -6,21 +6,70 @@
 #include "StreamingSettings.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/TaskGraph.h"
 #include "Engine/Threading/Task.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/Textures/GPUSampler.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/ModelInstanceActor.h"
 #include "Engine/Serialization/Serialization.h"
 
+// The interval (in seconds) between the content prefetching updates around the streaming sources
+#define STREAMING_PREFETCH_INTERVAL 0.25
+
+// The time (in seconds) the content stays prefetched after leaving the streaming sources area (longer than the update interval)
+#define STREAMING_PREFETCH_DURATION 1.0
+
 namespace StreamingManagerImpl
 {
-    int32 LastUpdateResourcesIndex = 0;
+    struct ResourceEntry
+    {
+        StreamableResource* Resource;
+        float Priority;
+    };
+
+    struct PrefetchAreaEntry
+    {
+        BoundingSphere Area;
+        double EndTime;
+    };
+
     CriticalSection ResourcesLock;
-    Array<StreamableResource*> Resources;
+    HandlePool<StreamableResource*> Resources;
     Array<GPUSampler*, InlinedAllocation<32>> TextureGroupSamplers;
     GPUSampler* FallbackSampler = nullptr;
+
+    // Memory pressure control (scales down the quality of the dynamic resources when GPU memory usage gets close to the budget)
+    float QualityScale = 1.0f;
+    double LastMemoryCheckTime = 0.0;
+
+    // Memory budgets control (limits the residency of the lowest priority resources to fit into the budgets)
+    double LastBudgetCheckTime = 0.0;
+    uint64 MemoryUsage = 0;
+    int32 BudgetLimitedCount = 0;
+
+    // Priority heap of the resources to update and the budget solver data (reused between updates)
+    Array<ResourceEntry> PendingUpdates;
+    Array<ResourceEntry> BudgetEntries;
+
+    // Predictive streaming (prefetching the content used around the streaming sources)
+    double LastPrefetchTime = 0.0;
+    Array<PrefetchAreaEntry> PrefetchAreas;
+
+    // Statistics of the data streamed in and evicted (swapped every second to provide the rates)
+    struct GroupCounters
+    {
+        uint64 StreamedBytes = 0;
+        int32 Evictions = 0;
+    };
+
+    double LastCountersTime = 0.0;
+    GroupCounters TypeCounters[StreamingGroup::Type_Count], LastTypeCounters[StreamingGroup::Type_Count];
+    Array<GroupCounters, InlinedAllocation<32>> TextureGroupCounters, LastTextureGroupCounters;
 }
 
 using namespace StreamingManagerImpl;
@@ -34,6 +83,7 @@ class StreamingService : public EngineService
     }
 
     bool Init() override;
+    void Update() override;
     void BeforeExit() override;
 };
 
@@ -52,9 +102,12 @@ namespace
 StreamingService StreamingServiceInstance;
 
 Array<TextureGroup, InlinedAllocation<32>> Streaming::TextureGroups;
+int32 Streaming::MemoryBudget = 0;
+Array<StreamingSource> Streaming::Sources;
 
 void StreamingSettings::Apply()
 {
+    Streaming::MemoryBudget = MemoryBudget;
     Streaming::TextureGroups = TextureGroups;
     SAFE_DELETE_GPU_RESOURCES(TextureGroupSamplers);
     TextureGroupSamplers.Resize(TextureGroups.Count(), false);
@@ -62,6 +115,7 @@ void StreamingSettings::Apply()
 
 void StreamingSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
 {
+    DESERIALIZE(MemoryBudget);
     DESERIALIZE(TextureGroups);
 }
 
@@ -84,6 +138,12 @@ void StreamableResource::RequestStreamingUpdate()
     Streaming.LastUpdateTime = 0.0;
 }
 
+void StreamableResource::Prefetch(double endTime) const
+{
+    if (Streaming.PrefetchTime < endTime)
+        Streaming.PrefetchTime = endTime;
+}
+
 void StreamableResource::ResetStreaming(bool error)
 {
     Streaming.Error = error;
@@ -98,7 +158,7 @@ void StreamableResource::StartStreaming(bool isDynamic)
     {
         _isStreaming = true;
         ResourcesLock.Lock();
-        Resources.Add(this);
+        _streamingHandle = Resources.Add(this);
         ResourcesLock.Unlock();
     }
 }
@@ -108,7 +168,7 @@ void StreamableResource::StopStreaming()
     if (_isStreaming)
     {
         ResourcesLock.Lock();
-        Resources.Remove(this);
+        Resources.RemoveAndReset(_streamingHandle);
         ResourcesLock.Unlock();
         Streaming = StreamingCache();
         _isStreaming = false;
@@ -128,7 +188,7 @@ void UpdateResource(StreamableResource* resource, double currentTime)
     if (resource->IsDynamic())
     {
         targetQuality = handler->CalculateTargetQuality(resource, currentTime);
-        targetQuality = Math::Saturate(targetQuality);
+        targetQuality = Math::Saturate(targetQuality) * QualityScale;
     }
 
     // Update quality smoothing
@@ -141,6 +201,8 @@ void UpdateResource(StreamableResource* resource, double currentTime)
     auto currentResidency = resource->GetCurrentResidency();
     auto allocatedResidency = resource->GetAllocatedResidency();
     auto targetResidency = handler->CalculateResidency(resource, targetQuality);
+    resource->Streaming.WantedResidency = targetResidency;
+    targetResidency = Math::Min(targetResidency, resource->Streaming.BudgetResidency);
     ASSERT(allocatedResidency >= currentResidency && allocatedResidency >= 0);
     resource->Streaming.LastUpdateTime = currentTime;
 
@@ -191,17 +253,198 @@ void UpdateResource(StreamableResource* resource, double currentTime)
 
         // TODO: deallocate or decrease memory usage after timeout? (timeout should be smaller on low mem)
     }
+}
+
+void TrackResidencyChange(StreamableResource* resource, int32 prevResidency, int32 residency)
+{
+    const auto group = resource->GetGroup();
+    const auto handler = group->GetHandler();
+    const int32 textureGroup = handler->GetTextureGroup(resource);
+    GroupCounters& typeCounters = TypeCounters[(int32)group->GetType()];
+    GroupCounters* textureGroupCounters = textureGroup >= 0 && textureGroup < TextureGroupCounters.Count() ? &TextureGroupCounters[textureGroup] : nullptr;
+    if (residency > prevResidency)
+    {
+        const uint64 prevMemory = handler->CalculateMemoryUsage(resource, prevResidency);
+        const uint64 memory = handler->CalculateMemoryUsage(resource, residency);
+        const uint64 streamed = memory > prevMemory ? memory - prevMemory : 0;
+        typeCounters.StreamedBytes += streamed;
+        if (textureGroupCounters)
+            textureGroupCounters->StreamedBytes += streamed;
+    }
+    else
+    {
+        typeCounters.Evictions++;
+        if (textureGroupCounters)
+            textureGroupCounters->Evictions++;
+    }
+}
+
+void UpdateCounters(double currentTime)
+{
+    if (TextureGroupCounters.Count() != Streaming::TextureGroups.Count())
+    {
+        TextureGroupCounters.Clear();
+        TextureGroupCounters.Resize(Streaming::TextureGroups.Count());
+        LastTextureGroupCounters.Clear();
+        LastTextureGroupCounters.Resize(Streaming::TextureGroups.Count());
+    }
+    if (currentTime - LastCountersTime < 1.0)
+        return;
+    LastCountersTime = currentTime;
+    for (int32 i = 0; i < StreamingGroup::Type_Count; i++)
+    {
+        LastTypeCounters[i] = TypeCounters[i];
+        TypeCounters[i] = GroupCounters();
+    }
+    for (int32 i = 0; i < TextureGroupCounters.Count(); i++)
+    {
+        LastTextureGroupCounters[i] = TextureGroupCounters[i];
+        TextureGroupCounters[i] = GroupCounters();
+    }
+}
+
+void UpdateQualityScale(double currentTime)
+{
+    if (currentTime - LastMemoryCheckTime < 0.5)
+        return;
+    LastMemoryCheckTime = currentTime;
+    const GPUMemoryStats memory = GPUDevice::Instance->GetMemoryStats();
+    if (memory.Budget == 0)
+    {
+        QualityScale = 1.0f;
+        return;
+    }
+
+    // Decrease quality of the dynamic resources when running out of the memory budget and restore it back slowly (hysteresis to prevent streaming in and out constantly)
+    const double usage = (double)memory.Usage / (double)memory.Budget;
+    if (usage > 0.95)
+        QualityScale = Math::Max(QualityScale - 0.05f, 0.25f);
+    else if (usage < 0.85)
+        QualityScale = Math::Min(QualityScale + 0.02f, 1.0f);
+}
+
+bool SortResourceEntries(const ResourceEntry& a, const ResourceEntry& b)
+{
+    return a.Priority > b.Priority;
+}
+
+void HeapSiftDown(ResourceEntry* heap, int32 count, int32 index)
+{
+    while (true)
+    {
+        const int32 left = index * 2 + 1;
+        const int32 right = left + 1;
+        int32 largest = index;
+        if (left < count && heap[left].Priority > heap[largest].Priority)
+            largest = left;
+        if (right < count && heap[right].Priority > heap[largest].Priority)
+            largest = right;
+        if (largest == index)
+            break;
+        Swap(heap[index], heap[largest]);
+        index = largest;
+    }
+}
+
+void SetBudgetResidency(StreamableResource* resource, int32 residency)
+{
+    if (resource->Streaming.BudgetResidency != residency)
+    {
+        resource->Streaming.BudgetResidency = residency;
+        resource->RequestStreamingUpdate();
+    }
+}
+
+void UpdateBudgets(double currentTime)
+{
+    if (currentTime - LastBudgetCheckTime < 0.5)
+        return;
+    LastBudgetCheckTime = currentTime;
+    PROFILE_CPU_NAMED("Streaming.Budgets");
+    const uint64 megabyte = 1024 * 1024;
+    const uint64 globalBudget = (uint64)Math::Max(Streaming::MemoryBudget, 0) * megabyte;
+    const int32 groupsCount = Streaming::TextureGroups.Count();
+    Array<uint64, InlinedAllocation<32>> groupBudgets, groupUsage;
+    groupBudgets.Resize(groupsCount);
+    groupUsage.Resize(groupsCount);
+    for (int32 i = 0; i < groupsCount; i++)
+    {
+        groupBudgets[i] = (uint64)Math::Max(Streaming::TextureGroups[i].MemoryBudget, 0) * megabyte;
+        groupUsage[i] = 0;
+    }
 
-    // low memory case:
-    // if we are on budget and cannot load everything we have to:
-    // decrease global resources quality scale (per resources group)
-    // decrease asset deallocate timeout
+    // Gather the current memory usage and the memory wanted by the resources
+    uint64 usage = 0, wantedUsage = 0;
+    BudgetEntries.Clear();
+    for (int32 i = 0; i < Resources.Count(); i++)
+    {
+        const auto resource = Resources[i];
+        const auto handler = resource->GetGroup()->GetHandler();
+        usage += handler->CalculateMemoryUsage(resource, resource->GetAllocatedResidency());
+        const uint64 wanted = handler->CalculateMemoryUsage(resource, resource->Streaming.WantedResidency);
+        if (wanted == 0)
+        {
+            SetBudgetResidency(resource, MAX_int32);
+            continue;
+        }
+        wantedUsage += wanted;
+        const int32 group = handler->GetTextureGroup(resource);
+        if (group >= 0 && group < groupsCount)
+            groupUsage[group] += wanted;
+        BudgetEntries.Add({ resource, resource->Streaming.Priority });
+    }
+    MemoryUsage = usage;
 
-    // low mem detecting:
-    // for low mem we have to get whole memory budget for a group and then
-    // subtract immutable resources mem usage (like render targets or non dynamic resources)
-    // so we get amount of memory we can distribute and we can detect if we are out of the limit
-    // low mem should be updated once per a few frames
+    // Check if all resources fit into the budgets
+    bool overBudget = globalBudget != 0 && wantedUsage > globalBudget;
+    for (int32 i = 0; i < groupsCount; i++)
+        overBudget |= groupBudgets[i] != 0 && groupUsage[i] > groupBudgets[i];
+    if (!overBudget)
+    {
+        for (const ResourceEntry& e : BudgetEntries)
+            SetBudgetResidency(e.Resource, MAX_int32);
+        BudgetLimitedCount = 0;
+        return;
+    }
+
+    // Grant the wanted residency to the highest priority resources first so the lowest priority ones get evicted
+    Sorting::QuickSort(BudgetEntries.Get(), BudgetEntries.Count(), &SortResourceEntries);
+    uint64 used = 0;
+    for (int32 i = 0; i < groupsCount; i++)
+        groupUsage[i] = 0;
+    int32 limitedCount = 0;
+    for (const ResourceEntry& e : BudgetEntries)
+    {
+        const auto resource = e.Resource;
+        const auto handler = resource->GetGroup()->GetHandler();
+        const int32 group = handler->GetTextureGroup(resource);
+        const uint64 groupBudget = group >= 0 && group < groupsCount ? groupBudgets[group] : 0;
+        const uint64 groupUsed = groupBudget != 0 ? groupUsage[group] : 0;
+
+        // Keep the lowest quality residency (eg. minimum mips count from the texture group)
+        const int32 wantedResidency = resource->Streaming.WantedResidency;
+        const int32 minResidency = Math::Min(handler->CalculateResidency(resource, ZeroTolerance * 2.0f), wantedResidency);
+        int32 residency = wantedResidency;
+        uint64 memory = handler->CalculateMemoryUsage(resource, residency);
+        while (residency > minResidency && ((globalBudget != 0 && used + memory > globalBudget) || (groupBudget != 0 && groupUsed + memory > groupBudget)))
+        {
+            residency--;
+            memory = handler->CalculateMemoryUsage(resource, residency);
+        }
+        used += memory;
+        if (groupBudget != 0)
+            groupUsage[group] += memory;
+        if (residency < wantedResidency)
+        {
+            SetBudgetResidency(resource, residency);
+            limitedCount++;
+        }
+        else
+        {
+            SetBudgetResidency(resource, MAX_int32);
+        }
+    }
+    BudgetLimitedCount = limitedCount;
 }
 
 bool StreamingService::Init()
@@ -211,8 +454,70 @@ bool StreamingService::Init()
     return false;
 }
 
+void StreamingService::Update()
+{
+    const double currentTime = Platform::GetTimeSeconds();
+    if (currentTime - LastPrefetchTime < STREAMING_PREFETCH_INTERVAL)
+        return;
+    LastPrefetchTime = currentTime;
+    for (int32 i = PrefetchAreas.Count() - 1; i >= 0; i--)
+    {
+        if (PrefetchAreas[i].EndTime < currentTime)
+            PrefetchAreas.RemoveAt(i);
+    }
+    if (Streaming::Sources.IsEmpty() && PrefetchAreas.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("Streaming.Prefetch");
+
+    // Gather the areas to prefetch (streaming sources are sampled along the predicted path)
+    Array<BoundingSphere, InlinedAllocation<32>> areas;
+    for (const StreamingSource& source : Streaming::Sources)
+    {
+        const Real radius = (Real)Math::Max(source.Radius, 1.0f);
+        const Vector3 path = source.Velocity * source.Lookahead;
+        const int32 steps = Math::Min(Math::CeilToInt((float)(path.Length() / radius)), 16);
+        areas.Add(BoundingSphere(source.Position, radius));
+        for (int32 step = 1; step <= steps; step++)
+            areas.Add(BoundingSphere(source.Position + path * ((Real)step / (Real)steps), radius));
+    }
+    for (const PrefetchAreaEntry& e : PrefetchAreas)
+        areas.Add(e.Area);
+
+    // Prefetch the content used by the models within the areas
+    const double endTime = currentTime + STREAMING_PREFETCH_DURATION;
+    Array<int32> keys;
+    SceneRendering::DrawCategory drawCategories[] = { SceneRendering::SceneDraw, SceneRendering::SceneDrawAsync };
+    ScopeLock lock(Level::ScenesLock);
+    for (Scene* scene : Level::Scenes)
+    {
+        SceneRendering& rendering = scene->Rendering;
+        ScopeLock renderingLock(rendering.Locker);
+        for (SceneRendering::DrawCategory drawCategory : drawCategories)
+        {
+            const auto& list = rendering.Actors[drawCategory];
+            for (const BoundingSphere& area : areas)
+            {
+                keys.Clear();
+                rendering.QueryActors(drawCategory, BoundingBox::FromSphere(area), keys);
+                for (const int32 key : keys)
+                {
+                    const auto& e = list.Get()[key];
+                    const auto modelActor = ScriptingObject::Cast<ModelInstanceActor>(e.Actor);
+                    if (modelActor && e.Bounds.Intersects(area))
+                        modelActor->PrefetchStreaming(endTime);
+                }
+            }
+        }
+    }
+}
+
 void StreamingService::BeforeExit()
 {
+    PendingUpdates.Resize(0);
+    PrefetchAreas.Resize(0);
+    TextureGroupCounters.Resize(0);
+    LastTextureGroupCounters.Resize(0);
+    BudgetEntries.Resize(0);
     SAFE_DELETE_GPU_RESOURCE(FallbackSampler);
     SAFE_DELETE_GPU_RESOURCES(TextureGroupSamplers);
     TextureGroupSamplers.Resize(0);
@@ -230,31 +535,53 @@ void StreamingSystem::Job(int32 index)
     // Start update
     ScopeLock lock(ResourcesLock);
     const int32 resourcesCount = Resources.Count();
-    int32 resourcesUpdates = Math::Min(MaxResourcesPerUpdate, resourcesCount);
     const double currentTime = Platform::GetTimeSeconds();
+    UpdateQualityScale(currentTime);
+    UpdateCounters(currentTime);
 
-    // Update high priority queue and then rest of the resources
-    // Note: resources in the update queue are updated always, while others only between specified intervals
-    int32 resourcesChecks = resourcesCount;
-    while (resourcesUpdates > 0 && resourcesChecks-- > 0)
+    // Score all resources and queue the ones that can be updated (updated only between specified intervals)
+    PendingUpdates.Clear();
+    for (int32 i = 0; i < resourcesCount; i++)
     {
-        // Move forward
-        LastUpdateResourcesIndex++;
-        if (LastUpdateResourcesIndex >= resourcesCount)
-            LastUpdateResourcesIndex = 0;
-
-        // Peek resource
-        const auto resource = Resources[LastUpdateResourcesIndex];
-
-        // Try to update it
+        const auto resource = Resources[i];
+        const int32 residency = resource->GetCurrentResidency();
+        if (residency != resource->Streaming.LastResidency)
+        {
+            TrackResidencyChange(resource, resource->Streaming.LastResidency, residency);
+            resource->Streaming.LastResidency = residency;
+        }
+        float priority = resource->GetGroup()->GetHandler()->CalculatePriority(resource, currentTime);
+        if (resource->IsPrefetched(currentTime))
+        {
+            // Prefetched resources are going to be used soon
+            priority = Math::Max(priority, 1.0f);
+        }
+        resource->Streaming.Priority = priority;
         if (currentTime - resource->Streaming.LastUpdateTime >= ResourceUpdatesInterval && resource->CanBeUpdated())
         {
-            UpdateResource(resource, currentTime);
-            resourcesUpdates--;
+            // Pending residency changes go first
+            const bool isPending = resource->Streaming.TargetResidency != residency;
+            PendingUpdates.Add({ resource, isPending ? priority + 1.0f : priority });
         }
     }
 
-    // TODO: add StreamingManager stats, update time per frame, updates per frame, etc.
+    // Enforce the memory budgets
+    UpdateBudgets(currentTime);
+
+    // Update the most important resources first
+    ResourceEntry* heap = PendingUpdates.Get();
+    int32 heapCount = PendingUpdates.Count();
+    for (int32 i = heapCount / 2 - 1; i >= 0; i--)
+        HeapSiftDown(heap, heapCount, i);
+    int32 resourcesUpdates = Math::Min(MaxResourcesPerUpdate, heapCount);
+    while (resourcesUpdates-- > 0)
+    {
+        const auto resource = heap[0].Resource;
+        heap[0] = heap[--heapCount];
+        HeapSiftDown(heap, heapCount, 0);
+        UpdateResource(resource, currentTime);
+    }
+
 }
 
 void StreamingSystem::Execute(TaskGraph* graph)
@@ -268,15 +595,55 @@ void StreamingSystem::Execute(TaskGraph* graph)
     graph->DispatchJob(job, 1);
 }
 
+void AddResourceStats(StreamingGroupStats& group, uint64 residentMemory, uint64 targetMemory, int32 streamingTasks)
+{
+    group.ResourcesCount++;
+    group.ResidentMemory += residentMemory;
+    group.TargetMemory += targetMemory;
+    group.StreamingTasksCount += streamingTasks;
+}
+
 StreamingStats Streaming::GetStats()
 {
     StreamingStats stats;
     ResourcesLock.Lock();
     stats.ResourcesCount = Resources.Count();
+    stats.QualityScale = QualityScale;
+    stats.MemoryUsage = MemoryUsage;
+    stats.BudgetLimitedResourcesCount = BudgetLimitedCount;
+    stats.Groups.Resize(StreamingGroup::Type_Count);
+    for (int32 i = 0; i < StreamingGroup::Type_Count; i++)
+    {
+        StreamingGroupStats& group = stats.Groups[i];
+        group.Name = StreamingGroup::ToString((StreamingGroup::Type)i);
+        group.StreamedBytesPerSecond = LastTypeCounters[i].StreamedBytes;
+        group.EvictionsPerSecond = LastTypeCounters[i].Evictions;
+    }
+    stats.TextureGroups.Resize(TextureGroups.Count());
+    for (int32 i = 0; i < TextureGroups.Count(); i++)
+    {
+        StreamingGroupStats& group = stats.TextureGroups[i];
+        group.Name = TextureGroups[i].Name;
+        if (i < LastTextureGroupCounters.Count())
+        {
+            group.StreamedBytesPerSecond = LastTextureGroupCounters[i].StreamedBytes;
+            group.EvictionsPerSecond = LastTextureGroupCounters[i].Evictions;
+        }
+    }
     for (auto e : Resources)
     {
-        if (e->Streaming.TargetResidency > e->GetCurrentResidency())
+        const int32 currentResidency = e->GetCurrentResidency();
+        const int32 targetResidency = e->Streaming.TargetResidency;
+        if (targetResidency > currentResidency)
             stats.StreamingResourcesCount++;
+        const auto handler = e->GetGroup()->GetHandler();
+        const uint64 residentMemory = handler->CalculateMemoryUsage(e, currentResidency);
+        const uint64 targetMemory = handler->CalculateMemoryUsage(e, targetResidency);
+        const int32 streamingTasks = e->CanBeUpdated() ? 0 : 1;
+        AddResourceStats(stats.Groups[(int32)e->GetGroup()->GetType()], residentMemory, targetMemory, streamingTasks);
+        const int32 textureGroup = handler->GetTextureGroup(e);
+        if (textureGroup >= 0 && textureGroup < stats.TextureGroups.Count())
+            AddResourceStats(stats.TextureGroups[textureGroup], residentMemory, targetMemory, streamingTasks);
     }
     ResourcesLock.Unlock();
     return stats;
@@ -291,6 +658,12 @@ void Streaming::RequestStreamingUpdate()
     ResourcesLock.Unlock();
 }
 
+void Streaming::PrefetchArea(const BoundingSphere& area, float duration)
+{
+    PrefetchAreas.Add({ area, Platform::GetTimeSeconds() + Math::Max(duration, 0.0f) });
+    LastPrefetchTime = 0.0;
+}
+
 GPUSampler* Streaming::GetTextureGroupSampler(int32 index)
 {
     GPUSampler* sampler = nullptr;
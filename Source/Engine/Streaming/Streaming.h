@@ -3,11 +3,32 @@
 #pragma once
 
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/BoundingSphere.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "TextureGroup.h"
 
 class GPUSampler;
 
+// Streaming group statistics container.
+API_STRUCT(NoDefault) struct FLAXENGINE_API StreamingGroupStats
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingGroupStats);
+    // The group name (resources type or the texture group name).
+    API_FIELD() String Name;
+    // Amount of active streamable resources in the group.
+    API_FIELD() int32 ResourcesCount = 0;
+    // Amount of resources that have streaming tasks in flight.
+    API_FIELD() int32 StreamingTasksCount = 0;
+    // The estimated GPU memory used by the resident data of the resources (in bytes).
+    API_FIELD() uint64 ResidentMemory = 0;
+    // The estimated GPU memory used by the resources at their target residency (in bytes).
+    API_FIELD() uint64 TargetMemory = 0;
+    // The amount of data streamed in during the last second (in bytes).
+    API_FIELD() uint64 StreamedBytesPerSecond = 0;
+    // Amount of residency decreases (eg. texture mips or model LODs eviction) during the last second.
+    API_FIELD() int32 EvictionsPerSecond = 0;
+};
+
 // Streaming service statistics container.
 API_STRUCT(NoDefault) struct FLAXENGINE_API StreamingStats
 {
@@ -16,6 +37,44 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingStats);
     API_FIELD() int32 ResourcesCount = 0;
     // Amount of resources that are during streaming in (target residency is higher that the current). Zero if all resources are streamed in.
     API_FIELD() int32 StreamingResourcesCount = 0;
+    // The quality scale applied to the dynamic resources due to the GPU memory pressure (1 if memory usage is within the budget).
+    API_FIELD() float QualityScale = 1.0f;
+    // The estimated GPU memory used by the streamed resources (in bytes).
+    API_FIELD() uint64 MemoryUsage = 0;
+    // Amount of resources that have residency limited by the streaming memory budgets.
+    API_FIELD() int32 BudgetLimitedResourcesCount = 0;
+    // The statistics per resources type (see StreamingGroup::Type).
+    API_FIELD() Array<StreamingGroupStats> Groups;
+    // The statistics per texture group (see Streaming::TextureGroups).
+    API_FIELD() Array<StreamingGroupStats> TextureGroups;
+};
+
+/// <summary>
+/// The location that drives the predictive content streaming (eg. player camera). The content used by the objects around the location predicted from the velocity gets streamed in before it becomes visible.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API StreamingSource
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingSource);
+
+    /// <summary>
+    /// The source location (eg. camera position).
+    /// </summary>
+    API_FIELD() Vector3 Position = Vector3::Zero;
+
+    /// <summary>
+    /// The source velocity (in units per second) used to predict the future location.
+    /// </summary>
+    API_FIELD() Vector3 Velocity = Vector3::Zero;
+
+    /// <summary>
+    /// The time (in seconds) to look ahead along the velocity.
+    /// </summary>
+    API_FIELD() float Lookahead = 2.0f;
+
+    /// <summary>
+    /// The radius around the predicted path within which the content gets prefetched.
+    /// </summary>
+    API_FIELD() float Radius = 5000.0f;
 };
 
 /// <summary>
@@ -30,6 +89,16 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FIELD() static Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// The GPU memory budget (in megabytes) for all the streamed resources. When exceeded, the lowest priority resources get their residency decreased first. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 MemoryBudget;
+
+    /// <summary>
+    /// The streaming sources used to prefetch the content along the predicted path (eg. fast moving camera). Can be updated by the gameplay every frame.
+    /// </summary>
+    API_FIELD() static Array<StreamingSource> Sources;
+
     /// <summary>
     /// Gets streaming statistics.
     /// </summary>
@@ -40,6 +109,13 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FUNCTION() static void RequestStreamingUpdate();
 
+    /// <summary>
+    /// Requests the content used by the objects within the given area to be streamed in for a given time (eg. before the cutscene camera cut or the teleport).
+    /// </summary>
+    /// <param name="area">The area to prefetch.</param>
+    /// <param name="duration">The time (in seconds) to keep the area prefetched.</param>
+    API_FUNCTION() static void PrefetchArea(API_PARAM(Ref) const BoundingSphere& area, float duration = 5.0f);
+
     /// <summary>
     /// Gets the texture sampler for a given texture group. Sampler objects is managed and cached by streaming service. Returned value is always valid (uses fallback object).
     /// </summary>
@@ -5,6 +5,7 @@
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Graphics/Textures/StreamingTexture.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Audio/AudioClip.h"
@@ -23,13 +24,32 @@ float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resou
         const TextureGroup& group = Streaming::TextureGroups[header.TextureGroup];
         result = group.Quality;
 
-        // Drop quality if invisible
+        // Drop quality if invisible (and not prefetched to be visible soon)
         const double lastRenderTime = texture.GetTexture()->LastRenderTime;
-        if (lastRenderTime < 0 || group.TimeToInvisible <= (float)(currentTime - lastRenderTime))
+        if ((lastRenderTime < 0 || group.TimeToInvisible <= (float)(currentTime - lastRenderTime)) && !texture.IsPrefetched(currentTime))
         {
             result *= group.QualityIfInvisible;
         }
     }
+
+    // Limit quality to the resolution required by the geometry rendered since the last update (skip mips that are too detailed to be visible)
+    int32 requiredResolution = Platform::AtomicRead(&texture._requiredResolution);
+    while (requiredResolution != 0)
+    {
+        const int32 prev = Platform::InterlockedCompareExchange(&texture._requiredResolution, 0, requiredResolution);
+        if (prev == requiredResolution)
+            break;
+        requiredResolution = prev;
+    }
+    const int32 totalMipLevels = texture.TotalMipLevels();
+    const int32 size = Math::Max(texture.TotalWidth(), texture.TotalHeight());
+    if (requiredResolution > 0 && requiredResolution < size && totalMipLevels > 0)
+    {
+        // Skip the top mips that are larger than the required resolution
+        const int32 skipMips = Math::FloorToInt(Math::Log2((float)size / (float)requiredResolution));
+        const int32 mipLevels = Math::Max(totalMipLevels - skipMips, 1);
+        result *= (float)mipLevels / (float)totalMipLevels;
+    }
     return result;
 }
 
@@ -93,6 +113,39 @@ int32 TexturesStreamingHandler::CalculateRequestedResidency(StreamableResource*
     return residency;
 }
 
+float TexturesStreamingHandler::CalculatePriority(StreamableResource* resource, double currentTime)
+{
+    ASSERT(resource);
+    auto& texture = *(StreamingTexture*)resource;
+
+    // Recently rendered textures go first
+    const double lastRenderTime = texture.GetTexture()->LastRenderTime;
+    if (lastRenderTime < 0)
+        return 0.0f;
+    return 1.0f / (1.0f + (float)Math::Max(currentTime - lastRenderTime, 0.0));
+}
+
+uint64 TexturesStreamingHandler::CalculateMemoryUsage(StreamableResource* resource, int32 residency)
+{
+    ASSERT(resource);
+    auto& texture = *(StreamingTexture*)resource;
+    const TextureHeader& header = *texture.GetHeader();
+    if (residency <= 0 || !texture.IsInitialized())
+        return 0;
+    residency = Math::Min(residency, header.MipLevels);
+    const int32 mipIndex = header.MipLevels - residency;
+    const int32 width = Math::Max(header.Width >> mipIndex, 1);
+    const int32 height = Math::Max(header.Height >> mipIndex, 1);
+    return RenderTools::CalculateTextureMemoryUsage(header.Format, width, height, residency) * texture.TotalArraySize();
+}
+
+int32 TexturesStreamingHandler::GetTextureGroup(StreamableResource* resource)
+{
+    ASSERT(resource);
+    auto& texture = *(StreamingTexture*)resource;
+    return texture.GetHeader()->TextureGroup;
+}
+
 float ModelsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, double currentTime)
 {
     // TODO: calculate a proper quality levels for models based on render time and streaming enable/disable options
@@ -194,15 +247,23 @@ int32 AudioStreamingHandler::CalculateResidency(StreamableResource* resource, fl
         const auto src = Audio::Sources[sourceIndex];
         if (src->Clip == clip && src->GetState() != AudioSource::States::Stopped)
         {
-            // Stream the current and the next chunk if could be used in a while
+            // Stream the current chunk and the next chunks that will be used within the lookahead time
             const int32 chunk = src->_streamingFirstChunk;
             ASSERT(Math::IsInRange(chunk, 0, chunksCount));
             chunksMask[chunk] = true;
-            
-            const float StreamingDstSec = 2.0f; // TODO: make it configurable via StreamingSettings
-            if (chunk + 1 < chunksCount && src->GetTime() + StreamingDstSec >= clip->GetBufferStartTime(src->_streamingFirstChunk))
+            const float lookaheadTime = src->GetTime() + AudioClip::StreamingLookahead;
+            for (int32 nextChunk = chunk + 1; nextChunk < chunksCount && lookaheadTime >= clip->GetBufferStartTime(nextChunk); nextChunk++)
+            {
+                chunksMask[nextChunk] = true;
+            }
+            if (src->GetIsLooping() && lookaheadTime >= clip->GetLength())
             {
-                chunksMask[chunk + 1] = true;
+                // Prefetch the clip start for the looped playback
+                const float loopedTime = lookaheadTime - clip->GetLength();
+                for (int32 nextChunk = 0; nextChunk < chunk && loopedTime >= clip->GetBufferStartTime(nextChunk); nextChunk++)
+                {
+                    chunksMask[nextChunk] = true;
+                }
             }
         }
     }
@@ -14,6 +14,9 @@ class FLAXENGINE_API TexturesStreamingHandler : public IStreamingHandler
     float CalculateTargetQuality(StreamableResource* resource, double currentTime) override;
     int32 CalculateResidency(StreamableResource* resource, float quality) override;
     int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
+    float CalculatePriority(StreamableResource* resource, double currentTime) override;
+    uint64 CalculateMemoryUsage(StreamableResource* resource, int32 residency) override;
+    int32 GetTextureGroup(StreamableResource* resource) override;
 };
 
 /// <summary>
@@ -13,6 +13,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
 DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingSettings);
 public:
 
+    /// <summary>
+    /// The GPU memory budget (in megabytes) for all the streamed resources. When exceeded, the lowest priority resources get their residency decreased first. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(0), EditorDisplay(\"General\")")
+    int32 MemoryBudget = 0;
+
     /// <summary>
     /// Textures streaming configuration (per-group).
     /// </summary>
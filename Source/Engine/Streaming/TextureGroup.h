@@ -71,6 +71,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroup);
     API_FIELD(Attributes="EditorOrder(50), Limit(-14, 14)")
     int32 MipLevelsBias = 0;
 
+    /// <summary>
+    /// The GPU memory budget (in megabytes) for the streamed textures in this group. When exceeded, the lowest priority textures (not rendered for the longest time) get their mips evicted first. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(55), Limit(0)")
+    int32 MemoryBudget = 0;
+
 #if USE_EDITOR
     /// <summary>
     /// The per-platform maximum amount of mip levels for textures in this group. Can be used to strip textures quality when cooking the game for a target platform.
@@ -13,20 +13,28 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Streaming/Streaming.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
+#if USE_EDITOR
+#include "Editor/Editor.h"
+#endif
 
 Terrain::Terrain(const SpawnParams& params)
     : PhysicsColliderActor(params)
     , _lodBias(0)
     , _forcedLod(-1)
     , _collisionLod(-1)
+    , _virtualTextureLod(2)
     , _lodCount(0)
     , _chunkSize(0)
     , _scaleInLightmap(0.1f)
     , _lodDistribution(0.6f)
+    , _collisionStreamingDistance(0.0f)
     , _boundsExtent(Vector3::Zero)
     , _cachedScale(1.0f)
 {
@@ -99,6 +107,12 @@ void Terrain::RemoveLightmap()
     }
 }
 
+void Terrain::InvalidateVirtualTexture()
+{
+    for (TerrainPatch* patch : _patches)
+        patch->InvalidateVirtualTexture();
+}
+
 bool Terrain::RayCast(const Vector3& origin, const Vector3& direction, float& resultHitDistance, float maxDistance) const
 {
     float minDistance = MAX_float;
@@ -286,6 +300,78 @@ void Terrain::SetCollisionLOD(int32 value)
 #endif
 }
 
+void Terrain::SetCollisionStreamingDistance(float value)
+{
+    _collisionStreamingDistance = Math::Max(value, 0.0f);
+    if (_collisionStreamingDistance <= 0.0f && IsDuringPlay())
+    {
+        // Restore collision of all patches
+        for (int32 i = 0; i < _patches.Count(); i++)
+        {
+            const auto patch = _patches[i];
+            if (!patch->HasCollision())
+                patch->CreateCollision();
+        }
+    }
+}
+
+void Terrain::UpdateCollisionStreaming()
+{
+    UpdateCollisionStreaming(TERRAIN_COLLISION_STREAMING_BUDGET);
+}
+
+void Terrain::UpdateCollisionStreaming(int32 budget)
+{
+    if (_collisionStreamingDistance <= 0.0f)
+        return;
+#if USE_EDITOR
+    if (!Editor::IsPlayMode)
+        return; // Keep collision of all patches for the editing tools
+#endif
+    PROFILE_CPU();
+
+    // Get streaming sources (current and predicted locations)
+    Array<Vector3, InlinedAllocation<16>> sources;
+    for (const StreamingSource& source : Streaming::Sources)
+    {
+        sources.Add(source.Position);
+        if (!source.Velocity.IsZero())
+            sources.Add(source.Position + source.Velocity * source.Lookahead);
+    }
+    if (sources.IsEmpty())
+    {
+        const Camera* camera = Camera::GetMainCamera();
+        if (!camera)
+            return;
+        sources.Add(camera->GetPosition());
+    }
+
+    // Create collision of the nearby patches (limited amount per update to spread the hitches) and release the distant ones (with a distance margin to prevent flickering)
+    const Real createDistance = (Real)_collisionStreamingDistance;
+    const Real destroyDistance = createDistance * 1.25f;
+    for (int32 i = 0; i < _patches.Count(); i++)
+    {
+        const auto patch = _patches[i];
+        Real distance = MAX_Real;
+        for (const Vector3& source : sources)
+            distance = Math::Min(distance, CollisionsHelper::DistanceBoxPoint(patch->_bounds, source));
+        if (patch->HasCollision())
+        {
+            if (distance > destroyDistance)
+                patch->DestroyCollision();
+        }
+        else if (distance <= createDistance && budget > 0)
+        {
+            // Skip patches that wait for the height field data to be loaded (asset loading is async)
+            const auto heightfield = patch->_heightfield.Get();
+            if (!heightfield || !heightfield->IsLoaded())
+                continue;
+            patch->CreateCollision();
+            budget--;
+        }
+    }
+}
+
 void Terrain::SetPhysicalMaterials(const Array<JsonAssetReference<PhysicalMaterial>, FixedAllocation<8>>& value)
 {
     _physicalMaterials = value;
@@ -698,9 +784,11 @@ void Terrain::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(LODBias, _lodBias);
     SERIALIZE_MEMBER(ForcedLOD, _forcedLod);
     SERIALIZE_MEMBER(LODDistribution, _lodDistribution);
+    SERIALIZE_MEMBER(VirtualTextureLOD, _virtualTextureLod);
     SERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     SERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
     SERIALIZE_MEMBER(CollisionLOD, _collisionLod);
+    SERIALIZE_MEMBER(CollisionStreamingDistance, _collisionStreamingDistance);
     SERIALIZE_MEMBER(PhysicalMaterials, _physicalMaterials);
     SERIALIZE(Material);
     SERIALIZE(DrawModes);
@@ -710,6 +798,9 @@ void Terrain::Serialize(SerializeStream& stream, const void* otherObj)
 
     if (_patches.HasItems())
     {
+#if TERRAIN_UPDATING
+        TerrainPatch::CookHeightDataForSave(ToSpan(_patches));
+#endif
         stream.JKEY("Patches");
         stream.StartArray();
         for (int32 patchIndex = 0; patchIndex < _patches.Count(); patchIndex++)
@@ -745,9 +836,16 @@ void Terrain::Deserialize(DeserializeStream& stream, ISerializeModifier* modifie
         SetCollisionLOD(member->value.GetInt());
     }
 
+    member = stream.FindMember("VirtualTextureLOD");
+    if (member != stream.MemberEnd() && member->value.IsInt())
+    {
+        SetVirtualTextureLOD(member->value.GetInt());
+    }
+
     DESERIALIZE_MEMBER(LODDistribution, _lodDistribution);
     DESERIALIZE_MEMBER(ScaleInLightmap, _scaleInLightmap);
     DESERIALIZE_MEMBER(BoundsExtent, _boundsExtent);
+    DESERIALIZE_MEMBER(CollisionStreamingDistance, _collisionStreamingDistance);
     DESERIALIZE_MEMBER(PhysicalMaterials, _physicalMaterials);
     DESERIALIZE(Material);
     DESERIALIZE(DrawModes);
@@ -834,6 +932,7 @@ RigidBody* Terrain::GetAttachedRigidBody() const
 void Terrain::OnEnable()
 {
     GetScene()->Navigation.Actors.Add(this);
+    GetScene()->Ticking.Update.AddTick<Terrain, &Terrain::UpdateCollisionStreaming>(this);
     GetSceneRendering()->AddActor(this, _sceneRenderingKey);
 #if TERRAIN_USE_PHYSICS_DEBUG
     GetSceneRendering()->AddPhysicsDebug<Terrain, &Terrain::DrawPhysicsDebug>(this);
@@ -855,6 +954,7 @@ void Terrain::OnEnable()
 void Terrain::OnDisable()
 {
     GetScene()->Navigation.Actors.Remove(this);
+    GetScene()->Ticking.Update.RemoveTick(this);
     GetSceneRendering()->RemoveActor(this, _sceneRenderingKey);
 #if TERRAIN_USE_PHYSICS_DEBUG
     GetSceneRendering()->RemovePhysicsDebug<Terrain, &Terrain::DrawPhysicsDebug>(this);
@@ -936,12 +1036,24 @@ void Terrain::BeginPlay(SceneBeginData* data)
 {
     CacheNeighbors();
     _cachedScale = _transform.Scale;
-    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    bool streamCollision = _collisionStreamingDistance > 0.0f;
+#if USE_EDITOR
+    streamCollision &= Editor::IsPlayMode;
+#endif
+    if (streamCollision)
     {
-        const auto patch = _patches[pathIndex];
-        if (!patch->HasCollision())
+        // Create collision only for the patches near the streaming sources
+        UpdateCollisionStreaming(MAX_int32);
+    }
+    else
+    {
+        for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
         {
-            patch->CreateCollision();
+            const auto patch = _patches[pathIndex];
+            if (!patch->HasCollision())
+            {
+                patch->CreateCollision();
+            }
         }
     }
     UpdateLayerBits();
@@ -32,6 +32,9 @@ struct RenderView;
 // Terrain splatmaps amount limit. Each splatmap can hold up to 4 layer weights.
 #define TERRAIN_MAX_SPLATMAPS_COUNT 2
 
+// Maximum amount of terrain patches that can have collision created during a single streaming update (per terrain)
+#define TERRAIN_COLLISION_STREAMING_BUDGET 2
+
 /// <summary>
 /// Represents a single terrain object.
 /// </summary>
@@ -64,11 +67,13 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     char _lodBias;
     char _forcedLod;
     char _collisionLod;
+    char _virtualTextureLod;
     byte _lodCount;
     uint16 _chunkSize;
     int32 _sceneRenderingKey = -1;
     float _scaleInLightmap;
     float _lodDistribution;
+    float _collisionStreamingDistance;
     Vector3 _boundsExtent;
     Float3 _cachedScale;
     Array<TerrainPatch*, InlinedAllocation<64>> _patches;
@@ -142,6 +147,23 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     /// </summary>
     API_PROPERTY() void SetLODDistribution(float value);
 
+    /// <summary>
+    /// Gets the terrain chunks Level Of Detail index from which chunks are drawn using the virtual texture cache with the pre-blended material (if enabled in Graphics Settings). Value -1 disables this feature.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(75), DefaultValue(2), Limit(-1, 100, 0.1f), EditorDisplay(\"Terrain\", \"Virtual Texture LOD\")")
+    FORCE_INLINE int32 GetVirtualTextureLOD() const
+    {
+        return static_cast<int32>(_virtualTextureLod);
+    }
+
+    /// <summary>
+    /// Sets the terrain chunks Level Of Detail index from which chunks are drawn using the virtual texture cache with the pre-blended material (if enabled in Graphics Settings). Value -1 disables this feature.
+    /// </summary>
+    API_PROPERTY() void SetVirtualTextureLOD(int32 value)
+    {
+        _virtualTextureLod = static_cast<char>(Math::Clamp(value, -1, TERRAIN_MAX_LODS));
+    }
+
     /// <summary>
     /// Gets the terrain scale in lightmap (applied to all the chunks). Use value higher than 1 to increase baked lighting resolution.
     /// </summary>
@@ -184,6 +206,20 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     /// </summary>
     API_PROPERTY() void SetCollisionLOD(int32 value);
 
+    /// <summary>
+    /// Gets the distance from the streaming sources (or the main camera) within which the terrain patches have collision created. Patches further away release their physics height fields. Use 0 to keep collision of all patches.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(510), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Collision\", \"Collision Streaming Distance\")")
+    FORCE_INLINE float GetCollisionStreamingDistance() const
+    {
+        return _collisionStreamingDistance;
+    }
+
+    /// <summary>
+    /// Sets the distance from the streaming sources (or the main camera) within which the terrain patches have collision created. Patches further away release their physics height fields. Use 0 to keep collision of all patches.
+    /// </summary>
+    API_PROPERTY() void SetCollisionStreamingDistance(float value);
+
     /// <summary>
     /// Gets the list with physical materials used to define the terrain collider physical properties - each for terrain layer (layer index matches index in this array).
     /// </summary>
@@ -398,6 +434,11 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     /// </summary>
     void RemoveLightmap();
 
+    /// <summary>
+    /// Invalidates the terrain virtual texture cache (chunks will bake their materials again when used). Call it after modifying the terrain material parameters at runtime.
+    /// </summary>
+    API_FUNCTION() void InvalidateVirtualTexture();
+
 public:
     /// <summary>
     /// Performs a raycast against this terrain collision shape. Returns the hit chunk.
@@ -445,6 +486,8 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     void DrawPhysicsDebug(RenderView& view);
 #endif
     bool DrawSetup(RenderContext& renderContext);
+    void UpdateCollisionStreaming();
+    void UpdateCollisionStreaming(int32 budget);
     void DrawImpl(RenderContext& renderContext, HashSet<TerrainChunk*, class RendererAllocation>& drawnChunks);
 
 public:
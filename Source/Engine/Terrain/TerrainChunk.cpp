@@ -9,6 +9,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/TerrainVirtualTexturePass.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Core/Math/OrientedBoundingBox.h"
 #include "Engine/Level/Scene/Scene.h"
@@ -110,6 +111,10 @@ void TerrainChunk::Draw(const RenderContext& renderContext) const
     drawCall.Terrain.NeighborLOD.Y = (float)Math::Clamp<int32>(_neighbors[1]->_cachedDrawLOD, lod, minLod);
     drawCall.Terrain.NeighborLOD.Z = (float)Math::Clamp<int32>(_neighbors[2]->_cachedDrawLOD, lod, minLod);
     drawCall.Terrain.NeighborLOD.W = (float)Math::Clamp<int32>(_neighbors[3]->_cachedDrawLOD, lod, minLod);
+    const auto lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+    const bool useDistanceMorph = _patch->_terrain->_forcedLod < 0 && lod + 1 < _patch->Heightmap->StreamingTexture()->TotalMipLevels();
+    drawCall.Terrain.LODMorph = useDistanceMorph ? Float2(_patch->_terrain->_lodDistribution, (float)_patch->_terrain->_lodBias) : Float2::Zero;
+    drawCall.Terrain.LODViewPosition = lodView->Position + (lodView->Origin - renderContext.View.Origin);
     const auto scene = _patch->_terrain->GetScene();
     const auto flags = _patch->_terrain->_staticFlags;
     if ((flags & StaticFlags::Lightmap) != StaticFlags::None && scene)
@@ -136,11 +141,48 @@ void TerrainChunk::Draw(const RenderContext& renderContext) const
     //drawCall.TerrainData.HeightmapUVScaleBias.W += halfTexelOffset;
 
     // Submit draw call
-    const DrawPass drawModes = _patch->_terrain->DrawModes & renderContext.View.Pass & drawCall.Material->GetDrawModes();
+    DrawPass drawModes = _patch->_terrain->DrawModes & renderContext.View.Pass & drawCall.Material->GetDrawModes();
+    const int32 virtualTextureLod = _patch->_terrain->_virtualTextureLod;
+    if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer) && virtualTextureLod != -1 && lod >= virtualTextureLod && CanUseVirtualTexture(renderContext, drawCall))
+    {
+        // Draw the pre-blended material from the virtual texture cache
+        const int32 tile = TerrainVirtualTexturePass::Instance()->GetTile(const_cast<TerrainChunk*>(this), (MaterialBase*)_cachedDrawMaterial, lod);
+        if (tile != -1)
+        {
+            TerrainTileDrawCall tileDrawCall;
+            tileDrawCall.IndexBuffer = drawCall.Geometry.IndexBuffer;
+            tileDrawCall.VertexBuffer = drawCall.Geometry.VertexBuffers[0];
+            tileDrawCall.IndicesCount = drawCall.Draw.IndicesCount;
+            tileDrawCall.Tile = tile;
+            tileDrawCall.Heightmap = _patch->Heightmap->GetTexture();
+            tileDrawCall.World = drawCall.World;
+            tileDrawCall.HeightmapUVScaleBias = drawCall.Terrain.HeightmapUVScaleBias;
+            tileDrawCall.NeighborLOD = drawCall.Terrain.NeighborLOD;
+            tileDrawCall.CurrentLOD = drawCall.Terrain.CurrentLOD;
+            tileDrawCall.ChunkSizeNextLOD = drawCall.Terrain.ChunkSizeNextLOD;
+            tileDrawCall.TerrainChunkSizeLOD0 = drawCall.Terrain.TerrainChunkSizeLOD0;
+            tileDrawCall.LODMorph = drawCall.Terrain.LODMorph;
+            tileDrawCall.LODViewPosition = drawCall.Terrain.LODViewPosition;
+            renderContext.List->TerrainTiles.Add(tileDrawCall);
+            drawModes &= ~DrawPass::GBuffer;
+        }
+    }
     if (drawModes != DrawPass::None)
         renderContext.List->AddDrawCall(renderContext, drawModes, flags, drawCall, true);
 }
 
+bool TerrainChunk::CanUseVirtualTexture(const RenderContext& renderContext, const DrawCall& drawCall) const
+{
+    // Virtual texture tile contains only the lit surface properties baked in the world-space
+    const MaterialInfo& info = drawCall.Material->GetInfo();
+    return renderContext.View.Mode == ViewMode::Default &&
+            drawCall.Terrain.Lightmap == nullptr &&
+            drawCall.WorldDeterminantSign > 0.0f &&
+            info.ShadingModel == MaterialShadingModel::Lit &&
+            EnumHasNoneFlags(info.UsageFlags, MaterialUsageFlags::UseEmissive | MaterialUsageFlags::UsePositionOffset | MaterialUsageFlags::UseDisplacement) &&
+            info.TessellationMode == TessellationMethod::None;
+}
+
 void TerrainChunk::Draw(const RenderContext& renderContext, MaterialBase* material, int32 lodIndex) const
 {
     if (_patch->Heightmap == nullptr || !_patch->Heightmap->IsLoaded())
@@ -171,6 +213,8 @@ void TerrainChunk::Draw(const RenderContext& renderContext, MaterialBase* materi
     drawCall.Terrain.NeighborLOD.Y = (float)lod;
     drawCall.Terrain.NeighborLOD.Z = (float)lod;
     drawCall.Terrain.NeighborLOD.W = (float)lod;
+    drawCall.Terrain.LODMorph = Float2::Zero;
+    drawCall.Terrain.LODViewPosition = renderContext.View.Position;
     const auto scene = _patch->_terrain->GetScene();
     const auto flags = _patch->_terrain->_staticFlags;
     if ((flags & StaticFlags::Lightmap) != StaticFlags::None && scene)
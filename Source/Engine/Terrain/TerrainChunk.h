@@ -39,6 +39,7 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainChunk : public ScriptingO
     IMaterial* _cachedDrawMaterial = nullptr;
 
     void Init(TerrainPatch* patch, uint16 x, uint16 z);
+    bool CanUseVirtualTexture(const RenderContext& renderContext, const struct DrawCall& drawCall) const;
 
 public:
     /// <summary>
@@ -14,6 +14,7 @@
 #include "Engine/Level/Level.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #if TERRAIN_EDITING
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
@@ -59,6 +60,11 @@ struct TerrainCollisionDataHeader
     float ScaleXZ;
 };
 
+namespace
+{
+    uint32 VirtualTextureVersion = 0;
+}
+
 TerrainPatch::TerrainPatch(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -78,6 +84,7 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
     _offset = Float3(_x * size, 0.0f, _z * size);
     _yOffset = 0.0f;
     _yHeight = 1.0f;
+    _virtualTextureVersion = ++VirtualTextureVersion;
     for (int32 i = 0; i < Terrain::ChunksCount; i++)
     {
         Chunks[i].Init(this, i % Terrain::Terrain::ChunksCountEdge, i / Terrain::Terrain::ChunksCountEdge);
@@ -132,6 +139,11 @@ void TerrainPatch::RemoveLightmap()
     }
 }
 
+void TerrainPatch::InvalidateVirtualTexture()
+{
+    _virtualTextureVersion = ++VirtualTextureVersion;
+}
+
 void TerrainPatch::UpdateBounds()
 {
     PROFILE_CPU();
@@ -667,7 +679,9 @@ bool CookCollision(TerrainDataUpdateInfo& info, TextureBase::InitData* initData,
     const int32 heightFieldChunkSize = ((info.ChunkSize + 1) >> collisionLOD) - 1;
     const int32 heightFieldSize = heightFieldChunkSize * Terrain::ChunksCountEdge + 1;
     const int32 heightFieldLength = heightFieldSize * heightFieldSize;
-    GET_TERRAIN_SCRATCH_BUFFER(heightFieldData, heightFieldLength, PhysicsBackend::HeightFieldSample);
+    Array<PhysicsBackend::HeightFieldSample> heightFieldSamples; // Not using the shared scratch buffer to support cooking patches in parallel
+    heightFieldSamples.Resize(heightFieldLength, false);
+    PhysicsBackend::HeightFieldSample* heightFieldData = heightFieldSamples.Get();
     PhysicsBackend::HeightFieldSample sample;
     Platform::MemoryClear(&sample, sizeof(PhysicsBackend::HeightFieldSample));
     Platform::MemoryClear(heightFieldData, sizeof(PhysicsBackend::HeightFieldSample) * heightFieldLength);
@@ -703,19 +717,19 @@ bool CookCollision(TerrainDataUpdateInfo& info, TextureBase::InitData* initData,
         }
     }
 
-    // Cook height field
-    MemoryWriteStream outputStream;
-    if (CollisionCooking::CookHeightField(heightFieldSize, heightFieldSize, heightFieldData, outputStream))
+    // Cook height field (reuses the cooked data if heightfield didn't change)
+    BytesContainer cookedData;
+    if (CollisionCooking::CookHeightField(heightFieldSize, heightFieldSize, heightFieldData, cookedData))
         return true;
 
     // Write results
-    collisionData->Resize(sizeof(TerrainCollisionDataHeader) + outputStream.GetPosition(), false);
+    collisionData->Resize(sizeof(TerrainCollisionDataHeader) + cookedData.Length(), false);
     const auto header = (TerrainCollisionDataHeader*)collisionData->Get();
     header->CheckOldMagicNumber = MAX_int32;
     header->Version = TerrainCollisionDataHeader::CurrentVersion;
     header->LOD = collisionLOD;
     header->ScaleXZ = (float)info.HeightmapSize / heightFieldSize;
-    Platform::MemoryCopy(collisionData->Get() + sizeof(TerrainCollisionDataHeader), outputStream.GetHandle(), outputStream.GetPosition());
+    Platform::MemoryCopy(collisionData->Get() + sizeof(TerrainCollisionDataHeader), cookedData.Get(), cookedData.Length());
 
     return false;
 
@@ -815,6 +829,7 @@ bool ModifyCollision(TerrainDataUpdateInfo& info, TextureBase::InitData* initDat
 bool TerrainPatch::SetupHeightMap(int32 heightMapLength, const float* heightMap, const byte* holesMask, bool forceUseVirtualStorage)
 {
     PROFILE_CPU_NAMED("Terrain.Setup");
+    InvalidateVirtualTexture();
     if (heightMap == nullptr)
     {
         LOG(Warning, "Cannot create terrain without a heightmap specified.");
@@ -1026,6 +1041,7 @@ bool TerrainPatch::SetupHeightMap(int32 heightMapLength, const float* heightMap,
 bool TerrainPatch::SetupSplatMap(int32 index, int32 splatMapLength, const Color32* splatMap, bool forceUseVirtualStorage)
 {
     PROFILE_CPU_NAMED("Terrain.SetupSplatMap");
+    InvalidateVirtualTexture();
     CHECK_RETURN(index >= 0 && index < TERRAIN_MAX_SPLATMAPS_COUNT, true);
     if (splatMap == nullptr)
     {
@@ -1372,6 +1388,8 @@ void TerrainPatch::CacheSplatData()
 
 bool TerrainPatch::ModifyHeightMap(const float* samples, const Int2& modifiedOffset, const Int2& modifiedSize)
 {
+    InvalidateVirtualTexture();
+
     // Validate input samples range
     TerrainDataUpdateInfo info(this);
     if (samples == nullptr)
@@ -1466,6 +1484,8 @@ bool TerrainPatch::ModifyHeightMap(const float* samples, const Int2& modifiedOff
 
 bool TerrainPatch::ModifyHolesMask(const byte* samples, const Int2& modifiedOffset, const Int2& modifiedSize)
 {
+    InvalidateVirtualTexture();
+
     // Validate input samples range
     TerrainDataUpdateInfo info(this, _yOffset, _yHeight);
     if (samples == nullptr)
@@ -1532,6 +1552,7 @@ bool TerrainPatch::ModifyHolesMask(const byte* samples, const Int2& modifiedOffs
 bool TerrainPatch::ModifySplatMap(int32 index, const Color32* samples, const Int2& modifiedOffset, const Int2& modifiedSize)
 {
     ASSERT(index >= 0 && index < TERRAIN_MAX_SPLATMAPS_COUNT);
+    InvalidateVirtualTexture();
 
     // Ensure that terrain has a valid heightmap
     if (Heightmap == nullptr)
@@ -1842,16 +1863,54 @@ bool TerrainPatch::UpdateHeightData(TerrainDataUpdateInfo& info, const Int2& mod
     return false;
 }
 
+bool TerrainPatch::CanSaveHeightData() const
+{
+#if USE_EDITOR
+    return _wasHeightModified &&
+           Heightmap != nullptr &&
+           _heightfield != nullptr &&
+           !Heightmap->IsVirtual() &&
+           !_heightfield->IsVirtual() &&
+           _dataHeightmap != nullptr;
+#else
+    return false;
+#endif
+}
+
+void TerrainPatch::CookHeightDataForSave(const Span<TerrainPatch*>& patches)
+{
+#if USE_EDITOR && COMPILE_WITH_PHYSICS_COOKING
+    // Find modified patches that will cook collision on save
+    Array<TerrainPatch*> modified;
+    Array<TerrainDataUpdateInfo> infos;
+    for (TerrainPatch* patch : patches)
+    {
+        if (!patch->CanSaveHeightData())
+            continue;
+        modified.Add(patch);
+        infos.Add(TerrainDataUpdateInfo(patch, patch->_yOffset, patch->_yHeight));
+        infos.Last().GetSplatMaps();
+    }
+    if (modified.Count() < 2)
+        return;
+    PROFILE_CPU_NAMED("Terrain.CookCollisions");
+
+    // Cook collision of all patches in parallel (cooked data is cached so patches saving skips cooking the identical heightfields)
+    const Function<void(int32)> job = [&modified, &infos](int32 index)
+    {
+        const TerrainPatch* patch = modified[index];
+        Array<byte> collisionData;
+        CookCollision(infos[index], patch->_dataHeightmap, patch->_terrain->_collisionLod, &collisionData);
+    };
+    JobSystem::Execute(job, modified.Count());
+#endif
+}
+
 void TerrainPatch::SaveHeightData()
 {
 #if USE_EDITOR
     // Skip if was not modified or cannot be saved
-    if (!_wasHeightModified ||
-        Heightmap == nullptr ||
-        _heightfield == nullptr ||
-        Heightmap->IsVirtual() ||
-        _heightfield->IsVirtual() ||
-        _dataHeightmap == nullptr)
+    if (!CanSaveHeightData())
     {
         return;
     }
@@ -2594,6 +2653,7 @@ void TerrainPatch::Deserialize(DeserializeStream& stream, ISerializeModifier* mo
     DESERIALIZE_MEMBER(Splatmap1, Splatmap[1]);
     static_assert(ARRAY_COUNT(Splatmap) == 2, "Please update the code above to match the maximum terrain splatmaps amount.");
     DESERIALIZE_MEMBER(Heightfield, _heightfield);
+    InvalidateVirtualTexture();
 
     // Update offset (x or/and z may be modified)
     const float size = _terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX * Terrain::ChunksCountEdge;
@@ -34,6 +34,7 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     void* _physicsHeightField;
     CriticalSection _collisionLocker;
     float _collisionScaleXZ;
+    uint32 _virtualTextureVersion;
 #if TERRAIN_UPDATING
     Array<float> _cachedHeightMap;
     Array<byte> _cachedHolesMask;
@@ -193,6 +194,19 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     /// </summary>
     void RemoveLightmap();
 
+    /// <summary>
+    /// Gets the version of the patch data used by the terrain virtual texture cache. Changes every time the patch heightmap or splatmaps get modified.
+    /// </summary>
+    FORCE_INLINE uint32 GetVirtualTextureVersion() const
+    {
+        return _virtualTextureVersion;
+    }
+
+    /// <summary>
+    /// Invalidates the terrain virtual texture cache tiles of the patch chunks (they will be baked again when used).
+    /// </summary>
+    void InvalidateVirtualTexture();
+
     /// <summary>
     /// Updates the cached bounds of the patch and child chunks.
     /// </summary>
@@ -302,6 +316,8 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
 private:
     bool UpdateHeightData(struct TerrainDataUpdateInfo& info, const Int2& modifiedOffset, const Int2& modifiedSize, bool wasHeightRangeChanged, bool wasHeightChanged);
     void SaveHeightData();
+    bool CanSaveHeightData() const;
+    static void CookHeightDataForSave(const Span<TerrainPatch*>& patches);
     void CacheHeightData();
     void SaveSplatData();
     void SaveSplatData(int32 index);
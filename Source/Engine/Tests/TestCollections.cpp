@@ -5,6 +5,9 @@
 #include "Engine/Core/Collections/BitArray.h"
 #include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Core/Collections/FlatHashSet.h"
+#include "Engine/Core/Collections/HandlePool.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 const bool TestBits[] = { true, false, true, false };
@@ -74,6 +77,38 @@ TEST_CASE("Array")
         a1 = testData;
         CHECK(a1 == testData);
     }
+
+    SECTION("Test Relocation")
+    {
+        static_assert(TIsTriviallyRelocatable<Array<uint32>>::Value, "Heap-allocated array should be relocatable.");
+        static_assert(!TIsTriviallyRelocatable<Array<uint32, InlinedAllocation<8>>>::Value, "Inlined array should not be relocatable.");
+        Array<Array<uint32>> a1;
+        Array<Array<uint32, InlinedAllocation<8>>> a2;
+        for (int32 i = 0; i < 100; i++)
+        {
+            a1.Add(testData);
+            a2.Add(Array<uint32, InlinedAllocation<8>>(testData));
+        }
+        a1.Insert(10, Array<uint32>());
+        a2.Insert(10, Array<uint32, InlinedAllocation<8>>());
+        a1.RemoveAtKeepOrder(10);
+        a2.RemoveAtKeepOrder(10);
+        a1.RemoveAtKeepOrder(0);
+        a2.RemoveAtKeepOrder(0);
+        CHECK(a1.Count() == 99);
+        CHECK(a2.Count() == 99);
+        for (int32 i = 0; i < a1.Count(); i++)
+        {
+            CHECK(a1[i] == testData);
+            CHECK(a2[i] == testData);
+        }
+
+        Dictionary<int32, Array<uint32>> d1;
+        for (int32 i = 0; i < 100; i++)
+            d1.Add(i, testData);
+        for (int32 i = 0; i < 100; i++)
+            CHECK(d1[i] == testData);
+    }
 }
 
 TEST_CASE("BitArray")
@@ -347,3 +382,260 @@ TEST_CASE("Dictionary")
         CHECK(a1.Capacity() <= DICTIONARY_DEFAULT_CAPACITY);
     }
 }
+
+TEST_CASE("FlatDictionary")
+{
+    SECTION("Test Allocators")
+    {
+        FlatDictionary<int32, int32> a1;
+        FlatDictionary<int32, int32, InlinedAllocation<16>> a2;
+        FlatDictionary<int32, int32, FixedAllocation<16>> a3;
+        for (int32 i = 0; i < 7; i++)
+        {
+            a1.Add(i, i);
+            a2.Add(i, i);
+            a3.Add(i, i);
+        }
+        CHECK(a1.Count() == 7);
+        CHECK(a2.Count() == 7);
+        CHECK(a3.Count() == 7);
+        for (int32 i = 0; i < 7; i++)
+        {
+            CHECK(a1.ContainsKey(i));
+            CHECK(a2.ContainsKey(i));
+            CHECK(a3.ContainsKey(i));
+            CHECK(a1.ContainsValue(i));
+            CHECK(a2.ContainsValue(i));
+            CHECK(a3.ContainsValue(i));
+        }
+    }
+
+    SECTION("Test Resizing")
+    {
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i, i);
+        CHECK(a1.Count() == 4000);
+        int32 capacity = a1.Capacity();
+        for (int32 i = 0; i < 4000; i++)
+        {
+            CHECK(a1.ContainsKey(i));
+            CHECK(a1.At(i) == i);
+        }
+        a1.Clear();
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i, i);
+        CHECK(a1.Count() == 4000);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 4000; i++)
+            CHECK(a1.Remove(i));
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i, i);
+        CHECK(a1.Count() == 4000);
+        CHECK(a1.Capacity() == capacity);
+    }
+
+    SECTION("Test Add/Remove")
+    {
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 4000; i++)
+        {
+            a1.Add(i, i);
+            a1.Remove(i);
+        }
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() == FlatHashTable::MinCapacity);
+        for (int32 i = 1; i <= 10; i++)
+            a1.Add(-i, -i);
+        for (int32 i = 0; i < 4000; i++)
+        {
+            a1.Add(i, i);
+            a1.Remove(i);
+        }
+        CHECK(a1.Count() == 10);
+        CHECK(a1.Capacity() <= FlatHashTable::MinCapacity * 2);
+        for (int32 i = 1; i <= 10; i++)
+            CHECK(a1.At(-i) == -i);
+    }
+
+    SECTION("Test Tombstones")
+    {
+        // Keep the table full enough to leave tombstones on removal and check that lookups still work after reinserting
+        FlatDictionary<int32, int32> a1;
+        RandomStream rand(101);
+        for (int32 i = 0; i < 1000; i++)
+            a1.Add(i, i);
+        const int32 capacity = a1.Capacity();
+        for (int32 iteration = 0; iteration < 10000; iteration++)
+        {
+            const int32 key = rand.RandRange(0, 999);
+            CHECK(a1.Remove(key));
+            CHECK(!a1.ContainsKey(key));
+            a1.Add(key, iteration);
+            CHECK(a1.At(key) == iteration);
+        }
+        CHECK(a1.Count() == 1000);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 1000; i++)
+            CHECK(a1.ContainsKey(i));
+    }
+
+    SECTION("Test Remove While Iterating")
+    {
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 100; i++)
+            a1.Add(i, i);
+        for (auto i = a1.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Key % 2 == 0)
+                a1.Remove(i);
+        }
+        CHECK(a1.Count() == 50);
+        int32 count = 0;
+        for (auto& e : a1)
+        {
+            CHECK(e.Key % 2 == 1);
+            count++;
+        }
+        CHECK(count == 50);
+    }
+
+    SECTION("Test Hash Mixing")
+    {
+        // Keys that differ only in the high bits need to land in different groups
+        constexpr int32 groups = 64;
+        bool used[groups] = {};
+        for (uint32 i = 0; i < 256; i++)
+        {
+            const uint32 hash = FlatHashTable::MixHash(i << 24);
+            used[hash & (groups - 1)] = true;
+        }
+        int32 usedCount = 0;
+        for (bool e : used)
+            usedCount += e ? 1 : 0;
+        CHECK(usedCount > groups / 2);
+
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 1000; i++)
+            a1.Add(i << 20, i);
+        CHECK(a1.Count() == 1000);
+        for (int32 i = 0; i < 1000; i++)
+            CHECK(a1.At(i << 20) == i);
+    }
+
+    SECTION("Test Move/Copy")
+    {
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 100; i++)
+            a1.Add(i, i * 2);
+        FlatDictionary<int32, int32> a2(a1);
+        CHECK(a2.Count() == 100);
+        FlatDictionary<int32, int32> a3(MoveTemp(a1));
+        CHECK(a1.Count() == 0);
+        CHECK(a3.Count() == 100);
+        for (int32 i = 0; i < 100; i++)
+        {
+            CHECK(a2.At(i) == i * 2);
+            CHECK(a3.At(i) == i * 2);
+        }
+    }
+}
+
+TEST_CASE("FlatHashSet")
+{
+    SECTION("Test Allocators")
+    {
+        FlatHashSet<int32> a1;
+        FlatHashSet<int32, InlinedAllocation<16>> a2;
+        FlatHashSet<int32, FixedAllocation<16>> a3;
+        for (int32 i = 0; i < 7; i++)
+        {
+            CHECK(a1.Add(i));
+            CHECK(a2.Add(i));
+            CHECK(a3.Add(i));
+        }
+        CHECK(!a1.Add(0));
+        CHECK(a1.Count() == 7);
+        CHECK(a2.Count() == 7);
+        CHECK(a3.Count() == 7);
+        for (int32 i = 0; i < 7; i++)
+        {
+            CHECK(a1.Contains(i));
+            CHECK(a2.Contains(i));
+            CHECK(a3.Contains(i));
+        }
+    }
+
+    SECTION("Test Add/Remove")
+    {
+        FlatHashSet<int32> a1;
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i);
+        CHECK(a1.Count() == 4000);
+        for (int32 i = 0; i < 4000; i += 2)
+            CHECK(a1.Remove(i));
+        CHECK(a1.Count() == 2000);
+        for (int32 i = 0; i < 4000; i++)
+            CHECK(a1.Contains(i) == (i % 2 == 1));
+        for (int32 i = 0; i < 4000; i += 2)
+            CHECK(a1.Add(i));
+        CHECK(a1.Count() == 4000);
+        CHECK(a1.Find(123).IsNotEnd());
+        CHECK(a1.Find(4000).IsEnd());
+    }
+}
+
+TEST_CASE("HandlePool")
+{
+    SECTION("Test Add/Remove")
+    {
+        HandlePool<int32> a1;
+        Array<PoolHandle> handles;
+        for (int32 i = 0; i < 100; i++)
+            handles.Add(a1.Add(i));
+        CHECK(a1.Count() == 100);
+        for (int32 i = 0; i < 100; i += 2)
+            CHECK(!a1.Remove(handles[i]));
+        CHECK(a1.Count() == 50);
+        for (int32 i = 0; i < 100; i++)
+        {
+            const int32* item = a1.TryGet(handles[i]);
+            if (i % 2 == 0)
+                CHECK(item == nullptr);
+            else
+                CHECK((item && *item == i));
+        }
+
+        // Outdated handles should not point to the reused slots
+        CHECK(a1.Remove(handles[0]));
+        const PoolHandle h = a1.Add(1000);
+        CHECK(h.Index == handles[98].Index);
+        CHECK(!a1.Contains(handles[98]));
+        CHECK(a1.Contains(h));
+        CHECK(*a1.TryGet(h) == 1000);
+
+        int32 sum = 0;
+        for (int32 e : a1)
+            sum += e;
+        CHECK(sum == 2500 + 1000);
+    }
+
+    SECTION("Test Clear")
+    {
+        HandlePool<int32> a1;
+        PoolHandle h1 = a1.Add(1);
+        PoolHandle h2 = a1.Add(2);
+        a1.Clear();
+        CHECK(a1.IsEmpty());
+        CHECK(!a1.Contains(h1));
+        CHECK(a1.RemoveAndReset(h2));
+        CHECK(!h2.IsValid());
+        h1 = a1.Add(3);
+        CHECK(a1.Count() == 1);
+        CHECK(*a1.TryGet(h1) == 3);
+    }
+}
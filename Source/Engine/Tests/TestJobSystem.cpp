@@ -0,0 +1,239 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/TaskGraph.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    volatile int64 Counter = 0;
+
+    void IncrementJob(int32 index)
+    {
+        Platform::InterlockedIncrement(&Counter);
+    }
+
+    void EmptyJob(int32 index)
+    {
+    }
+
+    // Prints a single benchmark result in a machine-readable format (CSV line with a fixed prefix)
+    void ReportBenchmark(const Char* name, int32 jobCount, int32 iterations, double time)
+    {
+        const double nsPerOp = time * 1000000000.0 / ((double)iterations * Math::Max(jobCount, 1));
+        LOG(Info, "BENCHMARK,{0},{1},{2},{3},{4},{5}", name, JobSystem::GetThreadsCount(), jobCount, iterations, time * 1000.0, nsPerOp);
+    }
+
+    class TestSystem : public TaskGraphSystem
+    {
+    public:
+        int32 JobCount = 1;
+
+        void Execute(TaskGraph* graph) override
+        {
+            Function<void(int32)> job;
+            job.Bind<IncrementJob>();
+            graph->DispatchJob(job, JobCount);
+        }
+    };
+}
+
+TEST_CASE("JobSystem")
+{
+    SECTION("Execute")
+    {
+        Counter = 0;
+        JobSystem::Execute(IncrementJob, 100);
+        CHECK(Platform::AtomicRead(&Counter) == 100);
+    }
+
+    SECTION("Dispatch Wait")
+    {
+        Counter = 0;
+        const int64 label1 = JobSystem::Dispatch(IncrementJob, 10);
+        const int64 label2 = JobSystem::Dispatch(IncrementJob, 20, JobPriority::High);
+        JobSystem::Wait(label2);
+        JobSystem::Wait(label1);
+        CHECK(Platform::AtomicRead(&Counter) == 30);
+    }
+
+    SECTION("Dependencies")
+    {
+        Counter = 0;
+        int64 results[3] = {};
+        const int64 label1 = JobSystem::Dispatch([&](int32)
+        {
+            results[0] = Platform::InterlockedIncrement(&Counter);
+        });
+        const int64 label2 = JobSystem::Dispatch([&](int32)
+        {
+            results[1] = Platform::InterlockedIncrement(&Counter);
+        }, Span<int64>(&label1, 1));
+        const int64 label3 = JobSystem::Dispatch([&](int32)
+        {
+            results[2] = Platform::InterlockedIncrement(&Counter);
+        }, Span<int64>(&label2, 1));
+        JobSystem::Wait(label3);
+        CHECK(results[0] == 1);
+        CHECK(results[1] == 2);
+        CHECK(results[2] == 3);
+    }
+
+    SECTION("Nested Dispatch")
+    {
+        Counter = 0;
+        JobSystem::Execute([](int32)
+        {
+            const int64 label = JobSystem::Dispatch(IncrementJob, 4);
+            JobSystem::Wait(label);
+        }, 8);
+        CHECK(Platform::AtomicRead(&Counter) == 32);
+    }
+
+    SECTION("ParallelFor")
+    {
+        Array<int32> data;
+        data.Resize(1000);
+        data.SetAll(0);
+        JobSystem::ParallelFor(0, data.Count(), 0, [&](int32 start, int32 end)
+        {
+            for (int32 i = start; i < end; i++)
+                data[i]++;
+        });
+        int32 sum = 0;
+        for (int32 i = 0; i < data.Count(); i++)
+            sum += data[i];
+        CHECK(sum == data.Count());
+    }
+
+    SECTION("TaskGraph")
+    {
+        Counter = 0;
+        auto graph = New<TaskGraph>();
+        auto system1 = New<TestSystem>();
+        auto system2 = New<TestSystem>();
+        system1->JobCount = 10;
+        system2->JobCount = 5;
+        system2->AddDependency(system1);
+        graph->AddSystem(system1);
+        graph->AddSystem(system2);
+        graph->Execute();
+        CHECK(Platform::AtomicRead(&Counter) == 15);
+        Delete(graph);
+        Delete(system1);
+        Delete(system2);
+    }
+}
+
+// Scheduler performance benchmarks (hidden by default, run with '[benchmark]' tag).
+// Results are printed to the log as: BENCHMARK,<name>,<threads>,<jobs>,<iterations>,<total ms>,<ns per job>
+TEST_CASE("JobSystem Benchmark", "[.][benchmark]")
+{
+    const int32 iterations = 1000;
+    const int32 threadsCount = JobSystem::GetThreadsCount();
+    Array<int32, InlinedAllocation<16>> jobCounts;
+    for (int32 jobCount = 1; jobCount < threadsCount; jobCount *= 2)
+        jobCounts.Add(jobCount);
+    jobCounts.Add(threadsCount);
+    jobCounts.Add(threadsCount * 16);
+
+    SECTION("Dispatch Overhead")
+    {
+        for (int32 jobCount : jobCounts)
+        {
+            JobSystem::SetJobStartingOnDispatch(false);
+            const double startTime = Platform::GetTimeSeconds();
+            for (int32 i = 0; i < iterations; i++)
+                JobSystem::Dispatch(EmptyJob, jobCount);
+            const double time = Platform::GetTimeSeconds() - startTime;
+            JobSystem::SetJobStartingOnDispatch(true);
+            JobSystem::Wait();
+            ReportBenchmark(TEXT("DispatchOverhead"), jobCount, iterations, time);
+        }
+    }
+
+    SECTION("Empty Job Throughput")
+    {
+        for (int32 jobCount : jobCounts)
+        {
+            const double startTime = Platform::GetTimeSeconds();
+            for (int32 i = 0; i < iterations; i++)
+                JobSystem::Dispatch(EmptyJob, jobCount);
+            JobSystem::Wait();
+            const double time = Platform::GetTimeSeconds() - startTime;
+            ReportBenchmark(TEXT("EmptyJobThroughput"), jobCount, iterations, time);
+        }
+    }
+
+    SECTION("Wait Latency")
+    {
+        for (int32 jobCount : jobCounts)
+        {
+            const double startTime = Platform::GetTimeSeconds();
+            for (int32 i = 0; i < iterations; i++)
+                JobSystem::Execute(EmptyJob, jobCount);
+            const double time = Platform::GetTimeSeconds() - startTime;
+            ReportBenchmark(TEXT("WaitLatency"), jobCount, iterations, time);
+        }
+    }
+
+    SECTION("Nested Dispatch")
+    {
+        for (int32 jobCount : jobCounts)
+        {
+            const double startTime = Platform::GetTimeSeconds();
+            for (int32 i = 0; i < iterations / 10; i++)
+            {
+                JobSystem::Execute([](int32)
+                {
+                    JobSystem::Execute(EmptyJob, 4);
+                }, jobCount);
+            }
+            const double time = Platform::GetTimeSeconds() - startTime;
+            ReportBenchmark(TEXT("NestedDispatch"), jobCount, iterations / 10, time);
+        }
+    }
+
+    SECTION("Dependency Chain")
+    {
+        for (int32 jobCount : jobCounts)
+        {
+            const double startTime = Platform::GetTimeSeconds();
+            int64 label = JobSystem::Dispatch(EmptyJob, jobCount);
+            for (int32 i = 1; i < iterations; i++)
+                label = JobSystem::Dispatch(EmptyJob, Span<int64>(&label, 1), jobCount);
+            JobSystem::Wait(label);
+            const double time = Platform::GetTimeSeconds() - startTime;
+            ReportBenchmark(TEXT("DependencyChain"), jobCount, iterations, time);
+        }
+    }
+
+    SECTION("TaskGraph")
+    {
+        for (int32 jobCount : jobCounts)
+        {
+            auto graph = New<TaskGraph>();
+            Array<TestSystem*> systems;
+            for (int32 i = 0; i < 16; i++)
+            {
+                auto system = New<TestSystem>();
+                system->JobCount = jobCount;
+                if (i % 4 != 0)
+                    system->AddDependency(systems.Last());
+                systems.Add(system);
+                graph->AddSystem(system);
+            }
+            const double startTime = Platform::GetTimeSeconds();
+            for (int32 i = 0; i < iterations / 10; i++)
+                graph->Execute();
+            const double time = Platform::GetTimeSeconds() - startTime;
+            ReportBenchmark(TEXT("TaskGraph"), jobCount * systems.Count(), iterations / 10, time);
+            Delete(graph);
+            systems.ClearDelete();
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Serialization/Json.h"
+#include "Engine/Serialization/JsonBinary.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    StringAnsi ToJson(const rapidjson_flax::Value& value)
+    {
+        rapidjson_flax::StringBuffer buffer;
+        rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(buffer);
+        value.Accept(writer);
+        return StringAnsi(buffer.GetString(), (int32)buffer.GetSize());
+    }
+}
+
+TEST_CASE("JsonBinary")
+{
+    const char* json = R"({"ID":"4a2c6b9e41cf5d9a0b3c7d6e8f901234","TypeName":"FlaxEngine.SceneAsset","EngineBuild":6605,"Data":[)"
+        R"({"ID":"0f1e2d3c4b5a69788796a5b4c3d2e1f0","TypeName":"FlaxEngine.EmptyActor","Name":"Actor","IsActive":true,"Tag":null,)"
+        R"("Transform":{"Translation":{"X":1.5,"Y":-200.0,"Z":0.1},"Scale":{"X":1.0,"Y":1.0,"Z":1.0}},"Layer":-3,"Big":18446744073709551615,"Int64":-9007199254740993},)"
+        R"({"ID":"0F1E2D3C4B5A69788796A5B4C3D2E1F0","TypeName":"FlaxEngine.EmptyActor","Name":"Actor","ParentID":"0f1e2d3c4b5a69788796a5b4c3d2e1f0","Items":[[],{},"",0]}]})";
+    rapidjson_flax::Document source;
+    source.Parse(json);
+    REQUIRE(!source.HasParseError());
+    MemoryWriteStream stream;
+    JsonBinary::Write(source, stream);
+    CHECK(JsonBinary::IsBinary(stream.GetHandle(), stream.GetPosition()));
+    CHECK(!JsonBinary::IsBinary(json, StringUtils::Length(json)));
+    CHECK(stream.GetPosition() < StringUtils::Length(json));
+
+    SECTION("Test Round Trip")
+    {
+        rapidjson_flax::Document document;
+        REQUIRE(!JsonBinary::Read(stream.GetHandle(), stream.GetPosition(), document));
+        CHECK(ToJson(document) == ToJson(source));
+        CHECK(document["EngineBuild"].IsInt());
+        CHECK(document["Data"][0]["Transform"]["Translation"]["Y"].IsDouble());
+        CHECK(document["Data"][0]["Big"].GetUint64() == 18446744073709551615ull);
+    }
+
+    SECTION("Test Corrupted Data")
+    {
+        rapidjson_flax::Document document;
+        CHECK(JsonBinary::Read(stream.GetHandle(), stream.GetPosition() - 1, document));
+        CHECK(JsonBinary::Read(stream.GetHandle(), 6, document));
+        CHECK(JsonBinary::Read(json, StringUtils::Length(json), document));
+    }
+}
+
+TEST_CASE("DocumentJsonWriter")
+{
+    rapidjson_flax::Document document;
+    DocumentJsonWriter documentWriter(document);
+    JsonWriter& writer = documentWriter;
+    writer.StartObject();
+    writer.JKEY("Name");
+    writer.String("Actor");
+    writer.JKEY("Layer");
+    writer.Int(-3);
+    writer.JKEY("Items");
+    writer.StartArray();
+    writer.Bool(true);
+    writer.RawValue("{\"X\":1.5}", 9);
+    writer.StartObject();
+    writer.EndObject();
+    writer.EndArray();
+    writer.EndObject();
+    CHECK(ToJson(document) == R"({"Name":"Actor","Layer":-3,"Items":[true,{"X":1.5},{}]})");
+}
@@ -5,8 +5,53 @@
 #include "Engine/Core/Types/StringView.h"
 #include "Engine/Level/LargeWorlds.h"
 #include "Engine/Level/Tags.h"
+#include "Engine/Level/Actors/EmptyActor.h"
+#include "Engine/Physics/Actors/RigidBody.h"
+#include "Engine/Physics/Colliders/BoxCollider.h"
 #include <ThirdParty/catch2/catch.hpp>
 
+namespace
+{
+    // Order in which the transform change notifications finished (after the base method)
+    Array<Actor*> TransformChangedOrder;
+
+    class TestBoxCollider : public BoxCollider
+    {
+    public:
+        TestBoxCollider()
+            : BoxCollider(SpawnParams(Guid::New(), BoxCollider::TypeInitializer))
+        {
+        }
+
+    protected:
+        void OnTransformChanged() override
+        {
+            BoxCollider::OnTransformChanged();
+            TransformChangedOrder.Add(this);
+        }
+    };
+
+    class TestRigidBody : public RigidBody
+    {
+    public:
+        TestRigidBody()
+            : RigidBody(SpawnParams(Guid::New(), RigidBody::TypeInitializer))
+        {
+        }
+
+        Actor* TrackedCollider = nullptr;
+        BoundingBox ColliderBox;
+
+    protected:
+        void OnTransformChanged() override
+        {
+            RigidBody::OnTransformChanged();
+            ColliderBox = TrackedCollider->GetBox();
+            TransformChangedOrder.Add(this);
+        }
+    };
+}
+
 TEST_CASE("LargeWorlds")
 {
     SECTION("UpdateOrigin")
@@ -68,3 +113,36 @@ TEST_CASE("Tags")
         Tags::List = prevTags;
     }
 }
+
+TEST_CASE("Actor")
+{
+    SECTION("Transform Changed Order")
+    {
+        // Root -> RigidBody -> (Empty -> Collider A, Collider B)
+        auto root = New<EmptyActor>();
+        auto rigidBody = New<TestRigidBody>();
+        auto empty = New<EmptyActor>();
+        auto colliderA = New<TestBoxCollider>();
+        auto colliderB = New<TestBoxCollider>();
+        rigidBody->SetParent(root);
+        empty->SetParent(rigidBody);
+        colliderA->SetParent(empty);
+        colliderB->SetParent(rigidBody);
+        colliderA->SetLocalPosition(Vector3(0, 100, 0));
+        rigidBody->TrackedCollider = colliderA;
+
+        // Parent override has to continue after its whole subtree got updated
+        TransformChangedOrder.Clear();
+        root->SetPosition(Vector3(1000, 0, 0));
+        REQUIRE(TransformChangedOrder.Count() == 3);
+        CHECK(TransformChangedOrder[0] == colliderA);
+        CHECK(TransformChangedOrder[1] == colliderB);
+        CHECK(TransformChangedOrder[2] == rigidBody);
+        CHECK(colliderA->GetPosition() == Vector3(1000, 100, 0));
+        CHECK(rigidBody->ColliderBox == colliderA->GetBox());
+        CHECK(rigidBody->ColliderBox.Contains(Vector3(1000, 100, 0)) == ContainmentType::Contains);
+
+        // Cleanup
+        root->DeleteObject();
+    }
+}
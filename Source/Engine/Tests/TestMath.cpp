@@ -1,5 +1,8 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Core/Math/Matrix.h"
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Core/Math/Vector3.h"
@@ -7,6 +10,8 @@
 #include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Core/Math/Transform.h"
 #include "Engine/Core/RandomStream.h"
+#include "Engine/Animations/PoseBlending.h"
+#include "Engine/Graphics/Models/SkeletonData.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 static Quaternion RotationX(float angle)
@@ -68,6 +73,86 @@ TEST_CASE("FloatR11G11B10")
     }
 }
 
+TEST_CASE("Matrix")
+{
+    SECTION("Test Multiply")
+    {
+        RandomStream rand(10);
+        Matrix a, b;
+        for (int32 i = 0; i < 16; i++)
+        {
+            a.Raw[i] = rand.GetFraction() * 10.0f - 5.0f;
+            b.Raw[i] = rand.GetFraction() * 10.0f - 5.0f;
+        }
+        Matrix expected;
+        for (int32 row = 0; row < 4; row++)
+        {
+            for (int32 column = 0; column < 4; column++)
+            {
+                float sum = 0.0f;
+                for (int32 i = 0; i < 4; i++)
+                    sum += a.Values[row][i] * b.Values[i][column];
+                expected.Values[row][column] = sum;
+            }
+        }
+        Matrix result;
+        Matrix::Multiply(a, b, result);
+        CHECK(expected == result);
+
+        // Result aliasing with inputs
+        Matrix c = a;
+        Matrix::Multiply(c, b, c);
+        CHECK(expected == c);
+        c = b;
+        Matrix::Multiply(a, c, c);
+        CHECK(expected == c);
+
+        Float4 v;
+        Float3::Transform(Float3(1, 2, 3), a, v);
+        CHECK(Float4::NearEqual(Float4(a.M11 + 2 * a.M21 + 3 * a.M31 + a.M41, a.M12 + 2 * a.M22 + 3 * a.M32 + a.M42, a.M13 + 2 * a.M23 + 3 * a.M33 + a.M43, a.M14 + 2 * a.M24 + 3 * a.M34 + a.M44), v));
+    }
+}
+
+TEST_CASE("BoundingFrustum")
+{
+    SECTION("Test Batched Intersects")
+    {
+        Matrix view, projection, viewProjection;
+        Matrix::LookAt(Float3(0, 0, -50), Float3::Zero, Float3::Up, view);
+        Matrix::PerspectiveFov(PI / 3.0f, 1.0f, 0.1f, 100.0f, projection);
+        Matrix::Multiply(view, projection, viewProjection);
+        const BoundingFrustum frustum(viewProjection);
+
+        constexpr int32 count = 70;
+        RandomStream rand(10);
+        float x[count], y[count], z[count], r[count];
+        float minX[count], minY[count], minZ[count], maxX[count], maxY[count], maxZ[count];
+        for (int32 i = 0; i < count; i++)
+        {
+            x[i] = rand.GetFraction() * 200.0f - 100.0f;
+            y[i] = rand.GetFraction() * 200.0f - 100.0f;
+            z[i] = rand.GetFraction() * 200.0f - 100.0f;
+            r[i] = rand.GetFraction() * 10.0f;
+            minX[i] = x[i] - r[i];
+            minY[i] = y[i] - r[i];
+            minZ[i] = z[i] - r[i];
+            maxX[i] = x[i] + r[i];
+            maxY[i] = y[i] + r[i];
+            maxZ[i] = z[i] + r[i];
+        }
+        uint32 spheresVisibility[(count + 31) / 32], boxesVisibility[(count + 31) / 32];
+        frustum.Intersects(x, y, z, r, count, spheresVisibility);
+        frustum.Intersects(minX, minY, minZ, maxX, maxY, maxZ, count, boxesVisibility);
+        for (int32 i = 0; i < count; i++)
+        {
+            const bool sphereVisible = (spheresVisibility[i / 32] & (1u << (i % 32))) != 0;
+            const bool boxVisible = (boxesVisibility[i / 32] & (1u << (i % 32))) != 0;
+            CHECK(sphereVisible == frustum.Intersects(BoundingSphere(Vector3(x[i], y[i], z[i]), r[i])));
+            CHECK(boxVisible == frustum.Intersects(BoundingBox(Vector3(minX[i], minY[i], minZ[i]), Vector3(maxX[i], maxY[i], maxZ[i]))));
+        }
+    }
+}
+
 TEST_CASE("Quaternion")
 {
     SECTION("Test Euler")
@@ -84,6 +169,12 @@ TEST_CASE("Quaternion")
         for (int i = 0; i < 9; i++)
             q *= delta;
         CHECK(Quaternion::NearEqual(Quaternion::Euler(0, 90, 0), q, 0.00001f));
+
+        const Quaternion a(0.1f, 0.7f, -0.3f, 0.6f);
+        const Quaternion b(-0.5f, 0.2f, 0.4f, 0.75f);
+        Quaternion c;
+        Quaternion::Multiply(a, b, c);
+        CHECK(Quaternion::NearEqual(Quaternion(0.115f, 0.755f, 0.385f, 0.48f), c, 0.00001f));
     }
 }
 
@@ -226,3 +317,42 @@ TEST_CASE("Transform")
         }
     }
 }
+
+TEST_CASE("PoseBlending")
+{
+    SECTION("Test Lerp")
+    {
+        RandomStream rand(10);
+        Transform a[10], b[10], result[10];
+        for (int32 i = 0; i < 10; i++)
+        {
+            a[i] = Transform(rand.GetVector3(), Quaternion::Euler((float)i * 10, 0, (float)i), rand.GetVector3() * 10.0f);
+            b[i] = Transform(rand.GetVector3(), Quaternion::Euler((float)i, 1, 22), rand.GetVector3() * 0.3f);
+        }
+        for (float alpha : { 0.0f, 0.3f, 1.0f })
+        {
+            PoseBlending::Lerp(a, b, alpha, result, 10);
+            for (int32 i = 0; i < 10; i++)
+                CHECK(Transform::NearEqual(Transform::Lerp(a[i], b[i], alpha), result[i], 0.00001f));
+        }
+    }
+    SECTION("Test Local To Model")
+    {
+        RandomStream rand(10);
+        SkeletonNode skeleton[10];
+        Transform nodes[10], expected[10];
+        Matrix matrices[10];
+        for (int32 i = 0; i < 10; i++)
+        {
+            skeleton[i].ParentIndex = i - 1 - i % 2;
+            nodes[i] = Transform(rand.GetVector3(), Quaternion::Euler((float)i * 10, 0, (float)i), Float3::One);
+            expected[i] = skeleton[i].ParentIndex != -1 ? expected[skeleton[i].ParentIndex].LocalToWorld(nodes[i]) : nodes[i];
+        }
+        PoseBlending::LocalToModel(nodes, skeleton, 10, matrices);
+        for (int32 i = 0; i < 10; i++)
+        {
+            CHECK(Transform::NearEqual(expected[i], nodes[i], 0.0001f));
+            CHECK(Vector3::NearEqual(expected[i].Translation, matrices[i].GetTranslation(), 0.0001f));
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Networking/NetworkInternal.h"
+#include "Engine/Core/RandomStream.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    bool TestDeltaRoundTrip(const Array<byte>& state, const Array<byte>& baseline)
+    {
+        Array<byte> delta, decoded;
+        const bool same = NetworkInternal::EncodeDelta(state.Get(), baseline.Get(), (uint32)state.Count(), delta);
+        if (same != (state == baseline) || (same && delta.HasItems()))
+            return false;
+        if (NetworkInternal::DecodeDelta(delta.Get(), (uint32)delta.Count(), baseline.Get(), (uint32)baseline.Count(), decoded))
+            return false;
+        return decoded == state;
+    }
+
+    bool TestDeltaCorrupted(std::initializer_list<byte> data, const Array<byte>& baseline)
+    {
+        Array<byte> decoded;
+        return NetworkInternal::DecodeDelta(data.begin(), (uint32)data.size(), baseline.Get(), (uint32)baseline.Count(), decoded);
+    }
+}
+
+TEST_CASE("NetworkReplicator")
+{
+    SECTION("Test Delta Round Trip")
+    {
+        RandomStream rand(77);
+        Array<byte> baseline;
+        baseline.Resize(300);
+        for (byte& e : baseline)
+            e = (byte)rand.RandRange(0, 255);
+
+        // Identical state
+        Array<byte> state = baseline;
+        CHECK(TestDeltaRoundTrip(state, baseline));
+
+        // First and last byte edits
+        state[0] ^= 0xff;
+        CHECK(TestDeltaRoundTrip(state, baseline));
+        state = baseline;
+        state.Last() ^= 0x01;
+        CHECK(TestDeltaRoundTrip(state, baseline));
+        state[0] ^= 0x10;
+        CHECK(TestDeltaRoundTrip(state, baseline));
+
+        // Sparse changes (including runs of unchanged bytes shorter than the literal split threshold)
+        state = baseline;
+        for (int32 i = 5; i < state.Count(); i += 37)
+            state[i] ^= 0x5a;
+        state[101] ^= 1;
+        state[103] ^= 1;
+        CHECK(TestDeltaRoundTrip(state, baseline));
+
+        // Random changes
+        for (int32 iteration = 0; iteration < 100; iteration++)
+        {
+            state = baseline;
+            const int32 changes = rand.RandRange(0, 40);
+            for (int32 i = 0; i < changes; i++)
+                state[rand.RandRange(0, state.Count() - 1)] = (byte)rand.RandRange(0, 255);
+            CHECK(TestDeltaRoundTrip(state, baseline));
+        }
+
+        // Fully different state
+        for (int32 i = 0; i < state.Count(); i++)
+            state[i] = ~baseline[i];
+        CHECK(TestDeltaRoundTrip(state, baseline));
+
+        // Single byte state
+        Array<byte> small, smallBaseline;
+        small.Add(1);
+        smallBaseline.Add(1);
+        CHECK(TestDeltaRoundTrip(small, smallBaseline));
+        small[0] = 2;
+        CHECK(TestDeltaRoundTrip(small, smallBaseline));
+    }
+
+    SECTION("Test Delta Corrupted")
+    {
+        Array<byte> baseline;
+        baseline.Resize(16);
+        for (int32 i = 0; i < baseline.Count(); i++)
+            baseline[i] = (byte)i;
+
+        // Valid data for reference (2 unchanged bytes, 1 changed byte, 13 unchanged bytes)
+        CHECK(!TestDeltaCorrupted({ 2, 1, 0xff, 13 }, baseline));
+
+        // Truncated varint
+        CHECK(TestDeltaCorrupted({ 0x80 }, baseline));
+        CHECK(TestDeltaCorrupted({ 2, 0x81 }, baseline));
+        CHECK(TestDeltaCorrupted({ 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 }, baseline));
+
+        // Unchanged run past the end
+        CHECK(TestDeltaCorrupted({ 17 }, baseline));
+
+        // Literal run past the end of the state or the data
+        CHECK(TestDeltaCorrupted({ 2, 15, 0xff }, baseline));
+        CHECK(TestDeltaCorrupted({ 2, 3, 0xff }, baseline));
+
+        // Missing tail
+        CHECK(TestDeltaCorrupted({ 2, 1, 0xff }, baseline));
+
+        // Trailing bytes
+        CHECK(TestDeltaCorrupted({ 2, 1, 0xff, 13, 0 }, baseline));
+        CHECK(TestDeltaCorrupted({ 16, 0 }, baseline));
+    }
+}
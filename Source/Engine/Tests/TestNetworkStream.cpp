@@ -0,0 +1,207 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Networking/NetworkStream.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/RandomStream.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    // Prepares the reading stream from the data written so far
+    void BeginRead(NetworkStream* writer, NetworkStream* reader)
+    {
+        reader->Initialize(writer->GetBuffer(), writer->GetPosition());
+    }
+}
+
+TEST_CASE("NetworkStream")
+{
+    NetworkStream* writer = New<NetworkStream>();
+    NetworkStream* reader = New<NetworkStream>();
+
+    SECTION("Test Bits")
+    {
+        writer->Initialize();
+        writer->WriteBits(5, 3);
+        writer->WriteBit(true);
+        writer->WriteBits(0x1234, 13);
+        writer->WriteBits(MAX_uint32, 32);
+        writer->WriteBits(0xffffffff, 0);
+        writer->WriteBits(0xff, 4); // Only the lowest bits are written
+        writer->WriteBit(false);
+        CHECK(writer->GetPosition() == 7);
+        BeginRead(writer, reader);
+        CHECK(reader->ReadBits(3) == 5);
+        CHECK(reader->ReadBit() == true);
+        CHECK(reader->ReadBits(13) == 0x1234);
+        CHECK(reader->ReadBits(32) == MAX_uint32);
+        CHECK(reader->ReadBits(0) == 0);
+        CHECK(reader->ReadBits(4) == 0xf);
+        CHECK(reader->ReadBit() == false);
+        CHECK(reader->GetPosition() == 7);
+    }
+
+    SECTION("Test Mixed Bits and Bytes")
+    {
+        // Byte-level writes align the stream to the next byte
+        writer->Initialize();
+        writer->WriteBits(3, 2);
+        writer->WriteByte(0xab);
+        CHECK(writer->GetPosition() == 2);
+        writer->WriteBit(true);
+        writer->WriteInt32(-123456);
+        CHECK(writer->GetPosition() == 7);
+        writer->WriteBits(6, 3);
+        writer->WriteVarUInt32(300); // Unaligned varint
+        writer->WriteBits(1, 1);
+        writer->WriteUint16(0xbeef);
+        BeginRead(writer, reader);
+        CHECK(reader->ReadBits(2) == 3);
+        CHECK(reader->ReadByte() == 0xab);
+        CHECK(reader->GetPosition() == 2);
+        CHECK(reader->ReadBit() == true);
+        int32 i32;
+        reader->ReadInt32(&i32);
+        CHECK(i32 == -123456);
+        CHECK(reader->GetPosition() == 7);
+        CHECK(reader->ReadBits(3) == 6);
+        CHECK(reader->ReadVarUInt32() == 300);
+        CHECK(reader->ReadBits(1) == 1);
+        uint16 u16;
+        reader->ReadUint16(&u16);
+        CHECK(u16 == 0xbeef);
+        CHECK(reader->GetPosition() == writer->GetPosition());
+    }
+
+    SECTION("Test VarInt")
+    {
+        const uint32 unsignedValues[] = { 0, 1, 127, 128, 16383, 16384, MAX_uint32 - 1, MAX_uint32 };
+        const int32 signedValues[] = { 0, -1, 1, -64, 64, MIN_int32, MIN_int32 + 1, MAX_int32, MAX_int32 - 1 };
+        writer->Initialize();
+        for (uint32 e : unsignedValues)
+            writer->WriteVarUInt32(e);
+        for (int32 e : signedValues)
+            writer->WriteVarInt32(e);
+        BeginRead(writer, reader);
+        for (uint32 e : unsignedValues)
+            CHECK(reader->ReadVarUInt32() == e);
+        for (int32 e : signedValues)
+            CHECK(reader->ReadVarInt32() == e);
+        CHECK(reader->GetPosition() == writer->GetPosition());
+
+        // Small values use less space
+        writer->Initialize();
+        writer->WriteVarInt32(0);
+        writer->WriteVarInt32(-1);
+        writer->WriteVarInt32(63);
+        CHECK(writer->GetPosition() == 3);
+        writer->Initialize();
+        writer->WriteVarUInt32(MAX_uint32);
+        CHECK(writer->GetPosition() == 5);
+        writer->Initialize();
+        writer->WriteVarInt32(MIN_int32);
+        CHECK(writer->GetPosition() == 5);
+    }
+
+    SECTION("Test IntRanged")
+    {
+        writer->Initialize();
+        writer->WriteIntRanged(7, 7, 7); // No bits for single value range
+        CHECK(writer->GetPosition() == 0);
+        writer->WriteIntRanged(MIN_int32, MIN_int32, MAX_int32);
+        writer->WriteIntRanged(MAX_int32, MIN_int32, MAX_int32);
+        writer->WriteIntRanged(0, MIN_int32, MAX_int32);
+        writer->WriteIntRanged(-1, MIN_int32, MAX_int32);
+        CHECK(writer->GetPosition() == 16);
+        writer->WriteIntRanged(5, -10, 10);
+        writer->WriteIntRanged(100, -10, 10); // Clamped
+        writer->WriteIntRanged(-100, -10, 10); // Clamped
+        writer->WriteIntRanged(3, 0, 3);
+        BeginRead(writer, reader);
+        CHECK(reader->ReadIntRanged(7, 7) == 7);
+        CHECK(reader->GetPosition() == 0);
+        CHECK(reader->ReadIntRanged(MIN_int32, MAX_int32) == MIN_int32);
+        CHECK(reader->ReadIntRanged(MIN_int32, MAX_int32) == MAX_int32);
+        CHECK(reader->ReadIntRanged(MIN_int32, MAX_int32) == 0);
+        CHECK(reader->ReadIntRanged(MIN_int32, MAX_int32) == -1);
+        CHECK(reader->ReadIntRanged(-10, 10) == 5);
+        CHECK(reader->ReadIntRanged(-10, 10) == 10);
+        CHECK(reader->ReadIntRanged(-10, 10) == -10);
+        CHECK(reader->ReadIntRanged(0, 3) == 3);
+        CHECK(reader->GetPosition() == writer->GetPosition());
+    }
+
+    SECTION("Test Float Quantized")
+    {
+        RandomStream rand(123);
+        constexpr float min = -50.0f, max = 150.0f;
+        for (int32 bits = 1; bits <= 24; bits++)
+        {
+            const float maxError = (max - min) / (float)((1u << bits) - 1) * 0.5f + 0.0001f;
+            float values[16];
+            values[0] = min;
+            values[1] = max;
+            values[2] = min - 10.0f; // Clamped
+            values[3] = max + 10.0f; // Clamped
+            for (int32 i = 4; i < ARRAY_COUNT(values); i++)
+                values[i] = rand.RandRange(min, max);
+            writer->Initialize();
+            for (float e : values)
+                writer->WriteFloatQuantized(e, min, max, bits);
+            BeginRead(writer, reader);
+            for (float e : values)
+            {
+                const float value = reader->ReadFloatQuantized(min, max, bits);
+                CHECK(Math::Abs(value - Math::Clamp(e, min, max)) <= maxError);
+            }
+        }
+
+        writer->Initialize();
+        writer->WriteFloatPrecision(123.456f, 0.01f);
+        writer->WriteFloatPrecision(-0.004f, 0.01f);
+        writer->WriteFloat3Precision(Float3(1.0f, -2.25f, 1000.0f), 0.1f);
+        BeginRead(writer, reader);
+        CHECK(Math::Abs(reader->ReadFloatPrecision(0.01f) - 123.456f) <= 0.005f + 0.0001f);
+        CHECK(Math::Abs(reader->ReadFloatPrecision(0.01f) + 0.004f) <= 0.005f + 0.0001f);
+        const Float3 v = reader->ReadFloat3Precision(0.1f);
+        CHECK(Float3::NearEqual(v, Float3(1.0f, -2.25f, 1000.0f), 0.05f + 0.001f));
+    }
+
+    SECTION("Test Quaternion Quantized")
+    {
+        RandomStream rand(321);
+        Quaternion rotations[32];
+        rotations[0] = Quaternion::Identity;
+        rotations[1] = Quaternion(0.0f, 0.0f, 0.0f, -1.0f);
+        rotations[2] = Quaternion(0.5f, 0.5f, 0.5f, 0.5f); // All components equal
+        rotations[3] = Quaternion(0.0f, 0.707107f, 0.0f, 0.707107f);
+        for (int32 i = 4; i < ARRAY_COUNT(rotations); i++)
+            rotations[i] = Quaternion::Euler(rand.RandRange(0.0f, 360.0f), rand.RandRange(0.0f, 360.0f), rand.RandRange(0.0f, 360.0f));
+        for (int32 bits : { 6, 10, 16 })
+        {
+            // Quantization step of a single component (component error is at most half of it)
+            const float step = 2.0f * 0.707107f / (float)((1u << bits) - 1);
+            const float minDot = 1.0f - 4.0f * step * step - 0.0001f;
+            writer->Initialize();
+            for (const Quaternion& q : rotations)
+            {
+                writer->WriteQuaternionQuantized(q, bits);
+                writer->WriteQuaternionQuantized(Quaternion(-q.X, -q.Y, -q.Z, -q.W), bits);
+            }
+            CHECK(writer->GetPosition() == (uint32)((ARRAY_COUNT(rotations) * 2 * (2 + 3 * bits) + 7) / 8));
+            BeginRead(writer, reader);
+            for (const Quaternion& q : rotations)
+            {
+                // q and -q represent the same rotation, encoding is the same for both
+                const Quaternion a = reader->ReadQuaternionQuantized(bits);
+                const Quaternion b = reader->ReadQuaternionQuantized(bits);
+                CHECK(a.IsNormalized());
+                CHECK(Math::Abs(Quaternion::Dot(a, q)) >= minDot);
+                CHECK(a == b);
+            }
+        }
+    }
+
+    Delete(reader);
+    Delete(writer);
+}
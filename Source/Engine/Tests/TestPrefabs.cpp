@@ -557,4 +557,56 @@ TEST_CASE("Prefabs")
         Content::DeleteAsset(prefabNested1);
         Content::DeleteAsset(prefabBase);
     }
+    SECTION("Test Pooled Prefab Instances")
+    {
+        // Create Prefab with a child and enable pooling
+        AssetReference<Prefab> prefab = Content::CreateVirtualAsset<Prefab>();
+        REQUIRE(prefab);
+        auto prefabInit = prefab->Init(Prefab::TypeName,
+                                       "["
+                                       "{"
+                                       "\"ID\": \"7b2f0e4d4c6a9a1e5d3b8c0f1a2e4d6b\","
+                                       "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                       "\"Name\": \"Root\""
+                                       "},"
+                                       "{"
+                                       "\"ID\": \"2c9d1a7e4f0b3e6a8d5c7b1e9f3a0c42\","
+                                       "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                       "\"ParentID\": \"7b2f0e4d4c6a9a1e5d3b8c0f1a2e4d6b\","
+                                       "\"Name\": \"Child\""
+                                       "}"
+                                       "]");
+        REQUIRE(!prefabInit);
+        prefab->SetPoolCapacity(1);
+
+        // Spawn, modify and despawn the instance
+        ScriptingObjectReference<Actor> instance = PrefabManager::SpawnPrefab(prefab);
+        REQUIRE(instance);
+        REQUIRE(instance->GetChildrenCount() == 1);
+        const Guid instanceId = instance->GetID();
+        const Guid childId = instance->Children[0]->GetID();
+        instance->SetName(String(TEXT("Modified")));
+        instance->Children[0]->SetName(String(TEXT("Modified")));
+        PrefabManager::DespawnPrefab(instance);
+        REQUIRE(prefab->GetPooledCount() == 1);
+
+        // Verify if the next spawn reuses the pooled objects with the prefab defaults restored
+        instance = PrefabManager::SpawnPrefab(prefab);
+        REQUIRE(instance);
+        REQUIRE(prefab->GetPooledCount() == 0);
+        REQUIRE(instance->GetID() == instanceId);
+        REQUIRE(instance->GetName() == TEXT("Root"));
+        REQUIRE(instance->GetChildrenCount() == 1);
+        REQUIRE(instance->Children[0]->GetID() == childId);
+        REQUIRE(instance->Children[0]->GetName() == TEXT("Child"));
+
+        // Verify if instance with added objects is not pooled
+        auto extra = New<EmptyActor>();
+        extra->SetParent(instance);
+        PrefabManager::DespawnPrefab(instance);
+        REQUIRE(prefab->GetPooledCount() == 0);
+
+        // Cleanup
+        Content::DeleteAsset(prefab);
+    }
 }
@@ -0,0 +1,119 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Level/Scene/SceneRenderingBVH.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    BoundingFrustum GetFrustum(const Float3& position, const Float3& target)
+    {
+        Matrix view, projection;
+        Matrix::LookAt(position, target, Float3::Up, view);
+        Matrix::PerspectiveFov(PI_OVER_2, 1.0f, 10.0f, 5000.0f, projection);
+        BoundingFrustum frustum;
+        frustum.SetMatrix(view, projection);
+        return frustum;
+    }
+
+    // Checks if tree query returned exactly all visible objects
+    bool CheckQuery(const SceneRenderingBVH& tree, const Array<BoundingSphere>& objects, const Array<int32>& leaves, const BoundingFrustum* frustums, int32 frustumsCount)
+    {
+        Array<int32> result;
+        tree.Query(frustums, frustumsCount, Vector3::Zero, result);
+        Array<bool> found;
+        found.Resize(objects.Count());
+        found.SetAll(false);
+        for (int32 key : result)
+        {
+            if (found[key] || leaves[key] == -1)
+                return false;
+            found[key] = true;
+        }
+        for (int32 i = 0; i < objects.Count(); i++)
+        {
+            bool visible = false;
+            for (int32 j = 0; j < frustumsCount; j++)
+                visible |= frustums[j].Intersects(objects[i]);
+            if (leaves[i] != -1 && visible != found[i])
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_CASE("SceneRenderingBVH")
+{
+    RandomStream rand(101);
+    Array<BoundingSphere> objects;
+    Array<int32> leaves;
+    SceneRenderingBVH tree;
+    tree.SetMargin(0.2f);
+    for (int32 i = 0; i < 2000; i++)
+    {
+        objects.Add(BoundingSphere(Vector3(rand.GetFraction() * 10000 - 5000, rand.GetFraction() * 1000, rand.GetFraction() * 10000 - 5000), rand.GetFraction() * 100 + 1));
+        leaves.Add(tree.Add(objects.Last(), i));
+    }
+    CHECK(tree.Count() == 2000);
+    CHECK(tree.GetHeight() < 40);
+
+    BoundingFrustum frustums[2] =
+    {
+        GetFrustum(Float3(0, 500, 0), Float3(1000, 500, 0)),
+        GetFrustum(Float3(-2000, 500, 2000), Float3(-2000, 0, 0)),
+    };
+    CHECK(CheckQuery(tree, objects, leaves, frustums, 1));
+    CHECK(CheckQuery(tree, objects, leaves, frustums, 2));
+
+    SECTION("Test Box Query")
+    {
+        const BoundingBox box(Vector3(-1000, 0, -1000), Vector3(1000, 200, 500));
+        Array<int32> result;
+        tree.Query(box, result);
+        int32 expected = 0;
+        for (int32 i = 0; i < objects.Count(); i++)
+        {
+            if (CollisionsHelper::BoxIntersectsSphere(box, objects[i]))
+            {
+                expected++;
+                CHECK(result.Contains(i));
+            }
+        }
+        CHECK(result.Count() == expected);
+    }
+
+    SECTION("Test Update/Remove")
+    {
+        for (int32 i = 0; i < objects.Count(); i += 3)
+        {
+            objects[i].Center += Vector3(rand.GetFraction() * 500, 0, rand.GetFraction() * 500);
+            tree.Update(leaves[i], objects[i]);
+        }
+        for (int32 i = 1; i < objects.Count(); i += 3)
+        {
+            tree.Remove(leaves[i]);
+            leaves[i] = -1;
+        }
+        CHECK(tree.Count() == 1333);
+        CHECK(CheckQuery(tree, objects, leaves, frustums, 2));
+        for (int32 i = 1; i < objects.Count(); i += 3)
+            leaves[i] = tree.Add(objects[i], i);
+        CHECK(tree.Count() == 2000);
+        CHECK(CheckQuery(tree, objects, leaves, frustums, 2));
+    }
+
+    SECTION("Test Clear")
+    {
+        tree.Clear();
+        CHECK(tree.Count() == 0);
+        CHECK(tree.GetHeight() == 0);
+        Array<int32> result;
+        tree.Query(frustums, 2, Vector3::Zero, result);
+        CHECK(result.IsEmpty());
+    }
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    void GenerateKeys(Array<uint64>& keys, Array<int32>& values, int32 count, uint64 mask)
+    {
+        uint64 seed = 0x9E3779B97F4A7C15ull;
+        keys.Resize(count);
+        values.Resize(count);
+        for (int32 i = 0; i < count; i++)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            keys[i] = seed & mask;
+            values[i] = i;
+        }
+    }
+
+    bool IsSorted(const uint64* keys, const int32* values, const Array<uint64>& sourceKeys, int32 count, bool stable)
+    {
+        for (int32 i = 0; i < count; i++)
+        {
+            if (sourceKeys[values[i]] != keys[i])
+                return false;
+            if (i != 0 && (keys[i - 1] > keys[i] || (stable && keys[i - 1] == keys[i] && values[i - 1] > values[i])))
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_CASE("Sorting")
+{
+    SECTION("Radix Sort")
+    {
+        for (int32 count : { 0, 1, 10, 1000, 100000 })
+        {
+            for (uint64 mask : { MAX_uint64, 0xffull, 0xffff0000ull })
+            {
+                Array<uint64> keys, tmpKeys;
+                Array<int32> values, tmpValues;
+                GenerateKeys(keys, values, count, mask);
+                Array<uint64> sourceKeys(keys);
+                tmpKeys.Resize(count);
+                tmpValues.Resize(count);
+                uint64* resultKeys = keys.Get();
+                int32* resultValues = values.Get();
+                Sorting::RadixSort(resultKeys, resultValues, tmpKeys.Get(), tmpValues.Get(), count);
+                CHECK(IsSorted(resultKeys, resultValues, sourceKeys, count, true));
+            }
+        }
+    }
+
+    SECTION("Radix Sort Parallel")
+    {
+        for (int32 count : { 10, 100000, 300000 })
+        {
+            for (uint64 mask : { MAX_uint64, 0xffull, 0xffff0000ull })
+            {
+                Array<uint64> keys, tmpKeys;
+                Array<int32> values, tmpValues;
+                GenerateKeys(keys, values, count, mask);
+                Array<uint64> sourceKeys(keys);
+                tmpKeys.Resize(count);
+                tmpValues.Resize(count);
+                uint64* resultKeys = keys.Get();
+                int32* resultValues = values.Get();
+                Sorting::RadixSortParallel(resultKeys, resultValues, tmpKeys.Get(), tmpValues.Get(), count);
+                CHECK(IsSorted(resultKeys, resultValues, sourceKeys, count, true));
+            }
+        }
+    }
+
+    SECTION("Radix Sort Unstable")
+    {
+        for (int32 count : { 0, 1, 10, 1000, 100000 })
+        {
+            for (uint64 mask : { MAX_uint64, 0xffull, 0xffff0000ull })
+            {
+                Array<uint64> keys;
+                Array<int32> values;
+                GenerateKeys(keys, values, count, mask);
+                Array<uint64> sourceKeys(keys);
+                Sorting::RadixSortUnstable(keys.Get(), values.Get(), count);
+                CHECK(IsSorted(keys.Get(), values.Get(), sourceKeys, count, false));
+            }
+        }
+    }
+}
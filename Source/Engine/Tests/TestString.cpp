@@ -380,3 +380,72 @@ TEST_CASE("String Compare")
         }
     }
 }
+
+TEST_CASE("String Inline Storage")
+{
+    SECTION("Container size")
+    {
+        // Inline storage shares the memory with the heap data pointer and length
+        CHECK(sizeof(String) == sizeof(Char*) + sizeof(int32) * 2);
+        CHECK(sizeof(StringAnsi) == sizeof(char*) + sizeof(int32) * 2);
+    }
+
+    SECTION("Short and long texts")
+    {
+        String str(TEXT("abc"));
+        str += TEXT("def");
+        CHECK(str == String(TEXT("abcdef")));
+        str += TEXT(" and a text that doesn't fit into inline storage");
+        CHECK(str == String(TEXT("abcdef and a text that doesn't fit into inline storage")));
+        str = TEXT("xyz");
+        CHECK(str == String(TEXT("xyz")));
+        str.Set(*str + 1, 2);
+        CHECK(str == String(TEXT("yz")));
+        str.Append(str);
+        CHECK(str == String(TEXT("yzyz")));
+        str.Resize(2);
+        CHECK(str == String(TEXT("yz")));
+        str.Resize(40);
+        str.Resize(1);
+        CHECK(str == String(TEXT("y")));
+        str.Clear();
+        CHECK(str.IsEmpty());
+        CHECK(*str == nullptr);
+
+        StringAnsi ansi("abc");
+        ansi += " and a text that doesn't fit into inline storage";
+        CHECK(ansi == StringAnsi("abc and a text that doesn't fit into inline storage"));
+        ansi = "xyz";
+        ansi += 'w';
+        CHECK(ansi == StringAnsi("xyzw"));
+        ansi.Set(TEXT("utf16"), 5);
+        CHECK(ansi == StringAnsi("utf16"));
+    }
+
+    SECTION("Move")
+    {
+        String a(TEXT("short"));
+        String b(MoveTemp(a));
+        CHECK(a.IsEmpty());
+        CHECK(*a == nullptr);
+        CHECK(b == String(TEXT("short")));
+        a = MoveTemp(b);
+        CHECK(b.IsEmpty());
+        CHECK(a == String(TEXT("short")));
+        StringAnsi c("ansi");
+        StringAnsi d(MoveTemp(c));
+        CHECK(c.IsEmpty());
+        CHECK(d == StringAnsi("ansi"));
+    }
+
+    SECTION("Insert/Remove")
+    {
+        String str(TEXT("ab"));
+        str.Insert(1, String(TEXT("XY")));
+        CHECK(str == String(TEXT("aXYb")));
+        str.Remove(0, 2);
+        CHECK(str == String(TEXT("Yb")));
+        CHECK(str.Replace(TEXT("Y"), TEXT("longer replacement text")) == 1);
+        CHECK(str == String(TEXT("longer replacement textb")));
+    }
+}
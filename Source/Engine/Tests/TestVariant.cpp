@@ -0,0 +1,100 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/Platform.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    // Prints a single benchmark result in a machine-readable format (CSV line with a fixed prefix)
+    void ReportBenchmark(const Char* name, int32 iterations, double time)
+    {
+        LOG(Info, "BENCHMARK,{0},{1},{2},{3}", name, iterations, time * 1000.0, time * 1000000000.0 / iterations);
+    }
+}
+
+TEST_CASE("Variant")
+{
+    SECTION("Boxed Values")
+    {
+        Variant a(Matrix::Identity);
+        Variant b(Transform::Identity);
+        Variant c(Double4(1.0, 2.0, 3.0, 4.0));
+        Variant d(TEXT("Hello"));
+        CHECK(a.AsMatrix() == Matrix::Identity);
+        CHECK(b.AsTransform() == Transform::Identity);
+        CHECK(c.AsDouble4() == Double4(1.0, 2.0, 3.0, 4.0));
+        CHECK(d.ToString() == TEXT("Hello"));
+
+        // Copy between different sizes
+        Variant e = d;
+        e = Variant(TEXT("Hello World, this string is longer than the pooled blocks limit of the Variant blobs allocator"));
+        CHECK(d.ToString() == TEXT("Hello"));
+        e = d;
+        CHECK(e == d);
+        e = a;
+        CHECK(e.AsMatrix() == Matrix::Identity);
+        e = Variant(TEXT(""));
+        CHECK(e.ToString().IsEmpty());
+    }
+
+    SECTION("Blob Pool")
+    {
+        // Allocate more blocks than a single thread caches to cover returning memory to the shared pool
+        Array<Variant> values;
+        for (int32 i = 0; i < 1000; i++)
+            values.Add(Variant(Double4((double)i)));
+        for (int32 i = 0; i < values.Count(); i++)
+            CHECK(values[i].AsDouble4() == Double4((double)i));
+        values.Clear();
+        for (int32 i = 0; i < 1000; i++)
+            values.Add(Variant(String::Format(TEXT("Value {0}"), i)));
+        for (int32 i = 0; i < values.Count(); i++)
+            CHECK(values[i].ToString() == String::Format(TEXT("Value {0}"), i));
+    }
+}
+
+// Variant performance benchmarks (hidden by default, run with '[benchmark]' tag).
+// Results are printed to the log as: BENCHMARK,<name>,<iterations>,<total ms>,<ns per op>
+TEST_CASE("Variant Benchmark", "[.][benchmark]")
+{
+    const int32 iterations = 1000000;
+
+    SECTION("Matrix")
+    {
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < iterations; i++)
+        {
+            Variant v(Matrix::Identity);
+            Variant copy = v;
+        }
+        ReportBenchmark(TEXT("VariantMatrix"), iterations, Platform::GetTimeSeconds() - startTime);
+    }
+
+    SECTION("Short String")
+    {
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < iterations; i++)
+        {
+            Variant v(TEXT("Speed"));
+            Variant copy = v;
+        }
+        ReportBenchmark(TEXT("VariantShortString"), iterations, Platform::GetTimeSeconds() - startTime);
+    }
+
+    SECTION("Float4")
+    {
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < iterations; i++)
+        {
+            Variant v(Float4::One);
+            Variant copy = v;
+        }
+        ReportBenchmark(TEXT("VariantFloat4"), iterations, Platform::GetTimeSeconds() - startTime);
+    }
+}
@@ -22,6 +22,16 @@ class ConcurrentTaskQueue : public ConcurrentQueue<T*>
         ConcurrentQueue<T*>::enqueue(item);
     }
 
+    /// <summary>
+    /// Adds multiple items to the collection at once (thread-safe). Faster than adding items one by one.
+    /// </summary>
+    /// <param name="items">Items to add.</param>
+    /// <param name="count">The amount of items to add.</param>
+    FORCE_INLINE void AddBatch(T* const* items, int32 count)
+    {
+        ConcurrentQueue<T*>::enqueue_bulk(items, (std::size_t)count);
+    }
+
     /// <summary>
     /// Cancels all the tasks from the queue and removes them.
     /// </summary>
@@ -6,27 +6,26 @@
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Core/Types/Span.h"
-#include "Engine/Core/Types/Pair.h"
-#include "Engine/Core/Memory/SimpleHeapAllocation.h"
-#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Utilities.h"
 #include "Engine/Core/Collections/RingBuffer.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerCounters.h"
 #if USE_CSHARP
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #endif
 
 #define JOB_SYSTEM_ENABLED 1
+#define JOB_SYSTEM_STATS (COMPILE_WITH_PROFILER && JOB_SYSTEM_ENABLED)
 
 #if JOB_SYSTEM_ENABLED
 
-// Local allocator for job system memory that uses internal pooling and assumes that JobsLocker is taken (write access owned by the calling thread).
-class JobSystemAllocation : public SimpleHeapAllocation<JobSystemAllocation>
-{
-public:
-    static void* Allocate(uintptr size);
-    static void Free(void* ptr, uintptr size);
-};
+// The maximum amount of job dispatches in-flight (contexts are stored in a fixed slots array indexed by the label bits).
+#define JOB_SYSTEM_CONTEXTS_BITS 12
+#define JOB_SYSTEM_CONTEXTS_COUNT (1 << JOB_SYSTEM_CONTEXTS_BITS)
+
+// The capacity of the per-thread lock-free jobs deque (overflow goes to the locked inbox queue).
+#define JOB_SYSTEM_DEQUE_SIZE 256
 
 class JobSystemService : public EngineService
 {
@@ -41,10 +40,16 @@ class JobSystemService : public EngineService
     void Dispose() override;
 };
 
+struct JobContext;
+
 struct JobData
 {
     int32 Index;
     int64 JobKey;
+    JobContext* Context;
+#if JOB_SYSTEM_STATS
+    uint64 DispatchCycles; // Zero if not measured
+#endif
 };
 
 template<>
@@ -53,24 +58,106 @@ struct TIsPODType<JobData>
     enum { Value = true };
 };
 
-struct JobContext
+// Dispatch context stored in a fixed slot. Label identifies the dispatch that is using the slot (acts as a generation counter since labels are unique), zero if the dispatch has been completed.
+struct alignas(PLATFORM_CACHE_LINE_SIZE) JobContext
 {
+    volatile int64 Used;
+    volatile int64 Label;
     volatile int64 JobsLeft;
-    int32 DependenciesLeft;
+    volatile int64 DependenciesLeft;
+    int32 JobsCount;
+    JobPriority Priority;
     Function<void(int32)> Job;
-    Array<int64, JobSystemAllocation> Dependants;
+    CriticalSection DependantsLocker; // Guards only the dependants list of this context (when adding dependency vs completing the dispatch)
+    Array<int64, InlinedAllocation<8>> Dependants;
 };
 
-template<>
-struct TIsPODType<JobContext>
+// Chase-Lev work-stealing deque. Owning thread pushes and pops jobs at the bottom (LIFO, without locking), other threads steal from the top with CAS (FIFO).
+struct JobDeque
 {
-    enum { Value = false };
+    alignas(PLATFORM_CACHE_LINE_SIZE) volatile int64 Top = 0;
+    alignas(PLATFORM_CACHE_LINE_SIZE) volatile int64 Bottom = 0;
+    JobData Items[JOB_SYSTEM_DEQUE_SIZE];
+
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return Platform::AtomicRead(&Bottom) <= Platform::AtomicRead(&Top);
+    }
+
+    // Owner-only.
+    bool Push(const JobData& data)
+    {
+        const int64 b = Platform::AtomicRead(&Bottom);
+        const int64 t = Platform::AtomicRead(&Top);
+        if (b - t >= JOB_SYSTEM_DEQUE_SIZE)
+            return false;
+        Items[b & (JOB_SYSTEM_DEQUE_SIZE - 1)] = data;
+        Platform::MemoryBarrier();
+        Platform::AtomicStore(&Bottom, b + 1);
+        return true;
+    }
+
+    // Owner-only.
+    FORCE_INLINE bool PeekBottom(JobData& data) const
+    {
+        const int64 b = Platform::AtomicRead(&Bottom) - 1;
+        if (b < Platform::AtomicRead(&Top))
+            return false;
+        data = Items[b & (JOB_SYSTEM_DEQUE_SIZE - 1)];
+        return true;
+    }
+
+    // Owner-only.
+    bool Pop(JobData& data)
+    {
+        const int64 b = Platform::AtomicRead(&Bottom) - 1;
+        Platform::InterlockedExchange(&Bottom, b); // Full barrier before reading top
+        const int64 t = Platform::AtomicRead(&Top);
+        if (t > b)
+        {
+            // Empty
+            Platform::AtomicStore(&Bottom, b + 1);
+            return false;
+        }
+        data = Items[b & (JOB_SYSTEM_DEQUE_SIZE - 1)];
+        if (t != b)
+            return true;
+
+        // Last item so race against thieves
+        const bool result = Platform::InterlockedCompareExchange(&Top, t + 1, t) == t;
+        Platform::AtomicStore(&Bottom, b + 1);
+        return result;
+    }
+
+    // Any thread. Steals the top job if it passes the check (returns false if empty, rejected or lost the race with other thread).
+    template<typename CheckFunc>
+    bool Steal(JobData& data, CheckFunc check)
+    {
+        const int64 t = Platform::AtomicRead(&Top);
+        Platform::MemoryBarrier();
+        const int64 b = Platform::AtomicRead(&Bottom);
+        if (t >= b)
+            return false;
+        data = Items[t & (JOB_SYSTEM_DEQUE_SIZE - 1)];
+        if (!check(data))
+            return false;
+        return Platform::InterlockedCompareExchange(&Top, t + 1, t) == t;
+    }
+};
+
+// Per-thread jobs queue (separate lists for each priority). Owning thread pushes and pops its own work from the deque, other threads steal from it when they run out of jobs. Jobs dispatched from the other threads go to the locked inbox.
+struct alignas(PLATFORM_CACHE_LINE_SIZE) JobQueue
+{
+    JobDeque Deques[(int32)JobPriority::MAX];
+    CriticalSection InboxLocker;
+    RingBuffer<JobData> Inbox[(int32)JobPriority::MAX];
 };
 
 class JobSystemThread : public IRunnable
 {
 public:
     uint64 Index;
+    uint64 AffinityMask;
 
 public:
     // [IRunnable]
@@ -90,50 +177,113 @@ class JobSystemThread : public IRunnable
 namespace
 {
     JobSystemService JobSystemInstance;
-    Array<Pair<void*, uintptr>> MemPool;
     Thread* Threads[PLATFORM_THREADS_LIMIT / 2] = {};
+    JobQueue Queues[PLATFORM_THREADS_LIMIT / 2];
+    THREADLOCAL int32 ThreadQueueIndex = -1;
     int32 ThreadsCount = 0;
     bool JobStartingOnDispatch = true;
     volatile int64 ExitFlag = 0;
     volatile int64 JobLabel = 0;
-    Dictionary<int64, JobContext, JobSystemAllocation> JobContexts;
+    volatile int64 JobsQueued = 0;
+    volatile int64 DispatchQueueIndex = 0;
+    volatile int64 ContextsCursor = 0;
+    volatile int64 ContextsActive = 0;
+    JobContext Contexts[JOB_SYSTEM_CONTEXTS_COUNT];
     ConditionVariable JobsSignal;
     CriticalSection JobsMutex;
     ConditionVariable WaitSignal;
     CriticalSection WaitMutex;
-    CriticalSection JobsLocker;
-    RingBuffer<JobData> Jobs;
+#if JOB_SYSTEM_STATS
+    // Per-worker counters (written only by the owning thread)
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) WorkerCounters
+    {
+        volatile int64 BusyCycles;
+        volatile int64 IdleCycles;
+        volatile int64 JobsExecuted;
+        volatile int64 JobsStolen;
+    };
+
+    WorkerCounters Workers[PLATFORM_THREADS_LIMIT / 2];
+    volatile int64 StatsDispatches = 0;
+    volatile int64 StatsJobsDispatched = 0;
+    volatile int64 StatsWaitCycles = 0;
+    volatile int64 StatsLatencyCycles = 0;
+    volatile int64 StatsLatencyCount = 0;
+    volatile int64 StatsLatencyMaxCycles = 0;
+    volatile int64 StatsLatencyHistogram[JobSystem::LatencyHistogramSize] = {};
+    uint64 StatsCyclesPerMicrosecond = 1;
+#endif
 }
 
-void* JobSystemAllocation::Allocate(uintptr size)
+#if JOB_SYSTEM_STATS
+
+FORCE_INLINE void AddWorkerStat(volatile int64& dst, int64 value)
 {
-    void* result = nullptr;
-    for (int32 i = 0; i < MemPool.Count(); i++)
+    Platform::AtomicStore(&dst, Platform::AtomicRead(&dst) + value);
+}
+
+void RecordJobLatency(uint64 dispatchCycles)
+{
+    const int64 latency = (int64)(Platform::GetTimeCycles() - dispatchCycles);
+    Platform::InterlockedAdd(&StatsLatencyCycles, latency);
+    Platform::InterlockedIncrement(&StatsLatencyCount);
+    const uint64 us = (uint64)latency / StatsCyclesPerMicrosecond;
+    const int32 bucket = us > 1 ? Math::Min((int32)Math::FloorLog2((uint32)Math::Min<uint64>(us, MAX_uint32)), JobSystem::LatencyHistogramSize - 1) : 0;
+    Platform::InterlockedIncrement(&StatsLatencyHistogram[bucket]);
+    int64 max = Platform::AtomicRead(&StatsLatencyMaxCycles);
+    while (latency > max)
     {
-        if (MemPool.Get()[i].Second == size)
-        {
-            result = MemPool.Get()[i].First;
-            MemPool.RemoveAt(i);
+        const int64 actual = Platform::InterlockedCompareExchange(&StatsLatencyMaxCycles, latency, max);
+        if (actual == max)
             break;
-        }
+        max = actual;
     }
-    if (!result)
-        result = Platform::Allocate(size, 16);
-    return result;
 }
 
-void JobSystemAllocation::Free(void* ptr, uintptr size)
-{
-    MemPool.Add({ ptr, size });
-}
+#endif
 
 bool JobSystemService::Init()
 {
-    ThreadsCount = Math::Min<int32>(Platform::GetCPUInfo().LogicalProcessorCount, ARRAY_COUNT(Threads));
+    const CPUInfo cpuInfo = Platform::GetCPUInfo();
+
+    // Use processors that this process is allowed to run on (eg. limited by cpuset or container)
+    uint64 allMask = cpuInfo.ProcessAffinityMask;
+    if (allMask == 0)
+        allMask = cpuInfo.LogicalProcessorCount >= 64 ? MAX_uint64 : (1ull << cpuInfo.LogicalProcessorCount) - 1;
+    const int32 allMaskCount = Utilities::CountBits((uint32)allMask) + Utilities::CountBits((uint32)(allMask >> 32));
+    int32 processorsAvailable = cpuInfo.LogicalProcessorCount;
+    if (cpuInfo.LogicalProcessorCount <= 64)
+        processorsAvailable = Math::Min(processorsAvailable, allMaskCount);
+    ThreadsCount = Math::Clamp<int32>(processorsAvailable, 1, ARRAY_COUNT(Threads));
+#if JOB_SYSTEM_STATS
+    StatsCyclesPerMicrosecond = Math::Max<uint64>(Platform::GetClockFrequency() / 1000000, 1);
+#endif
+
+    // Pin threads to logical processors only if affinity mask can describe the whole CPU (max 64 processors on a single NUMA node), otherwise let OS scheduler to place them
+    const bool useAffinity = cpuInfo.LogicalProcessorCount <= 64 && cpuInfo.NumaNodeCount <= 1;
+    int32 processors[64];
+    int32 processorsCount = 0;
+    if (useAffinity)
+    {
+        // Use performance cores first (eg. on hybrid CPUs), then the rest
+        const uint64 performanceMask = cpuInfo.PerformanceProcessorMask & allMask ? cpuInfo.PerformanceProcessorMask & allMask : allMask;
+        for (int32 i = 0; i < 64; i++)
+        {
+            if (performanceMask & (1ull << i))
+                processors[processorsCount++] = i;
+        }
+        for (int32 i = 0; i < 64; i++)
+        {
+            if (allMask & ~performanceMask & (1ull << i))
+                processors[processorsCount++] = i;
+        }
+    }
+
     for (int32 i = 0; i < ThreadsCount; i++)
     {
         auto runnable = New<JobSystemThread>();
         runnable->Index = (uint64)i;
+        runnable->AffinityMask = i < processorsCount ? 1ull << processors[i] : 0;
         auto thread = Thread::Create(runnable, String::Format(TEXT("Job System {0}"), i), ThreadPriority::AboveNormal);
         if (thread == nullptr)
             return true;
@@ -164,34 +314,265 @@ void JobSystemService::Dispose()
         }
     }
 
-    JobContexts.SetCapacity(0);
-    Jobs.Release();
-    for (auto& e : MemPool)
-        Platform::Free(e.First);
-    MemPool.Clear();
+    for (auto& context : Contexts)
+    {
+        context.Job.Unbind();
+        context.Dependants.SetCapacity(0);
+    }
+    for (auto& queue : Queues)
+    {
+        for (auto& items : queue.Inbox)
+            items.Release();
+    }
+}
+
+FORCE_INLINE JobContext* GetContext(int64 label)
+{
+    JobContext* context = &Contexts[label & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+    return Platform::AtomicRead(&context->Label) == label ? context : nullptr;
+}
+
+// Finds a free context slot and creates a new label for it.
+JobContext* AllocateContext(int64& label)
+{
+    JobContext* context;
+    while (true)
+    {
+        const int64 start = Platform::InterlockedIncrement(&ContextsCursor);
+        int32 i = 0;
+        for (; i < JOB_SYSTEM_CONTEXTS_COUNT; i++)
+        {
+            context = &Contexts[(start + i) & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+            if (Platform::AtomicRead(&context->Used) == 0 && Platform::InterlockedCompareExchange(&context->Used, 1, 0) == 0)
+                break;
+        }
+        if (i != JOB_SYSTEM_CONTEXTS_COUNT)
+            break;
+
+        // All slots are in use so wait for any dispatch to end
+        Platform::Sleep(0);
+    }
+
+    // Label is unique and increasing with each dispatch (upper bits), lower bits point to the context slot
+    const int64 slot = context - Contexts;
+    label = (Platform::InterlockedIncrement(&JobLabel) << JOB_SYSTEM_CONTEXTS_BITS) | slot;
+    Platform::InterlockedIncrement(&ContextsActive);
+    return context;
+}
+
+// Pushes the job executions into the queues. Worker threads push the work into their own deque (picked by other threads via stealing), other threads spread it across the inboxes of all threads.
+void EnqueueJob(JobContext* context, int64 jobKey, int32 jobCount)
+{
+    JobData data;
+    data.JobKey = jobKey;
+    data.Context = context;
+#if JOB_SYSTEM_STATS
+    data.DispatchCycles = ProfilerCPU::Enabled ? Platform::GetTimeCycles() : 0;
+    if (data.DispatchCycles != 0)
+    {
+        Platform::InterlockedIncrement(&StatsDispatches);
+        Platform::InterlockedAdd(&StatsJobsDispatched, jobCount);
+    }
+#endif
+    const int32 priority = (int32)context->Priority;
+    PROFILE_COUNTER_ADD("Jobs Enqueued", jobCount);
+    const int32 queueIndex = ThreadQueueIndex;
+    if (queueIndex >= 0)
+    {
+        // Push in the reverse order so the owner executes jobs from the first one (stealing threads pick the last ones)
+        JobQueue& queue = Queues[queueIndex];
+        JobDeque& deque = queue.Deques[priority];
+        Platform::InterlockedAdd(&JobsQueued, jobCount);
+        data.Index = jobCount - 1;
+        while (data.Index >= 0 && deque.Push(data))
+            data.Index--;
+        if (data.Index >= 0)
+        {
+            // Deque is full so use the inbox
+            queue.InboxLocker.Lock();
+            for (; data.Index >= 0; data.Index--)
+                queue.Inbox[priority].PushBack(data);
+            queue.InboxLocker.Unlock();
+        }
+        return;
+    }
+    const int32 startQueue = (int32)(Platform::InterlockedIncrement(&DispatchQueueIndex) % ThreadsCount);
+    const int32 queuesCount = Math::Min(jobCount, ThreadsCount);
+    Platform::InterlockedAdd(&JobsQueued, jobCount);
+    for (int32 i = 0; i < queuesCount; i++)
+    {
+        JobQueue& queue = Queues[(startQueue + i) % ThreadsCount];
+        const int32 start = jobCount * i / queuesCount;
+        const int32 end = jobCount * (i + 1) / queuesCount;
+        queue.InboxLocker.Lock();
+        for (data.Index = start; data.Index < end; data.Index++)
+            queue.Inbox[priority].PushBack(data);
+        queue.InboxLocker.Unlock();
+    }
+}
+
+// Picks the job from the front of the inbox queue if it passes the check (skips the queue if it's busy).
+template<typename CheckFunc>
+bool PopInboxJob(JobQueue& queue, int32 priority, JobData& data, CheckFunc check)
+{
+    if (!queue.InboxLocker.TryLock())
+        return false;
+    auto& items = queue.Inbox[priority];
+    if (items.Count() != 0 && check(items.PeekFront()))
+    {
+        data = items.PeekFront();
+        items.PopFront();
+        queue.InboxLocker.Unlock();
+        return true;
+    }
+    queue.InboxLocker.Unlock();
+    return false;
+}
+
+FORCE_INLINE bool AnyJob(const JobData&)
+{
+    return true;
+}
+
+bool DequeueJob(int32 queueIndex, JobData& data)
+{
+    if (Platform::AtomicRead(&JobsQueued) <= 0)
+        return false;
+
+    // Higher priority jobs are picked first from all threads
+    for (int32 priority = 0; priority < (int32)JobPriority::MAX; priority++)
+    {
+        // Try own queue first
+        if (queueIndex >= 0)
+        {
+            JobQueue& queue = Queues[queueIndex];
+            if (queue.Deques[priority].Pop(data) || PopInboxJob(queue, priority, data, AnyJob))
+            {
+                Platform::InterlockedDecrement(&JobsQueued);
+                return true;
+            }
+        }
+
+        // Steal from other threads
+        for (int32 i = 1; i <= ThreadsCount; i++)
+        {
+            JobQueue& queue = Queues[(queueIndex + i + ThreadsCount) % ThreadsCount];
+            if (queue.Deques[priority].Steal(data, AnyJob) || PopInboxJob(queue, priority, data, AnyJob))
+            {
+#if JOB_SYSTEM_STATS
+                if (queueIndex >= 0 && i != ThreadsCount && ProfilerCPU::Enabled)
+                    AddWorkerStat(Workers[queueIndex].JobsStolen, 1);
+#endif
+                Platform::InterlockedDecrement(&JobsQueued);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Tries to pick a job that can be executed by the thread waiting for the given label. Prefers the awaited jobs, then any jobs dispatched before it (eg. its dependencies) that are not less important than the awaited ones.
+bool DequeueJobForWait(int64 label, JobPriority labelPriority, JobData& data)
+{
+    if (Platform::AtomicRead(&JobsQueued) <= 0)
+        return false;
+    const int32 ownQueueIndex = ThreadQueueIndex;
+    const int32 queueIndex = Math::Max(ownQueueIndex, 0);
+    const auto isAwaited = [label](const JobData& e) { return e.JobKey == label; };
+    const auto isBefore = [label](const JobData& e) { return e.JobKey <= label; };
+
+    // Own deque (when waiting inside a job)
+    if (ownQueueIndex >= 0)
+    {
+        for (int32 priority = 0; priority <= (int32)labelPriority; priority++)
+        {
+            JobDeque& deque = Queues[ownQueueIndex].Deques[priority];
+            if (deque.PeekBottom(data) && isBefore(data) && deque.Pop(data))
+            {
+                Platform::InterlockedDecrement(&JobsQueued);
+                return true;
+            }
+        }
+    }
+
+    // Awaited jobs
+    for (int32 i = 0; i < ThreadsCount; i++)
+    {
+        JobQueue& queue = Queues[(queueIndex + i) % ThreadsCount];
+        if ((queue.Deques[(int32)labelPriority].Steal(data, isAwaited) || PopInboxJob(queue, (int32)labelPriority, data, isAwaited)))
+        {
+            Platform::InterlockedDecrement(&JobsQueued);
+            return true;
+        }
+    }
+
+    // Jobs dispatched before the awaited ones
+    for (int32 priority = 0; priority <= (int32)labelPriority; priority++)
+    {
+        for (int32 i = 0; i < ThreadsCount; i++)
+        {
+            JobQueue& queue = Queues[(queueIndex + i) % ThreadsCount];
+            if (queue.Deques[priority].Steal(data, isBefore) || PopInboxJob(queue, priority, data, isBefore))
+            {
+                Platform::InterlockedDecrement(&JobsQueued);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ExecuteJob(const JobData& data)
+{
+    // Run job
+    JobContext* context = data.Context;
+#if JOB_SYSTEM_STATS
+    if (data.DispatchCycles != 0)
+        RecordJobLatency(data.DispatchCycles);
+#endif
+    context->Job(data.Index);
+
+    // Move forward with the job queue (only the last job execution completes the dispatch)
+    if (Platform::InterlockedDecrement(&context->JobsLeft) <= 0)
+    {
+        // Mark as done (no more dependants can be added after that)
+        context->DependantsLocker.Lock();
+        Platform::AtomicStore(&context->Label, 0);
+        context->DependantsLocker.Unlock();
+
+        // Update any dependant jobs (they can't complete before this one so their contexts are valid)
+        for (int64 dependant : context->Dependants)
+        {
+            JobContext* dependantContext = &Contexts[dependant & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+            if (Platform::InterlockedDecrement(&dependantContext->DependenciesLeft) <= 0)
+            {
+                // Dispatch dependency when it's ready
+                EnqueueJob(dependantContext, dependant, dependantContext->JobsCount);
+                JobsSignal.NotifyAll();
+            }
+        }
+
+        // Release context slot
+        context->Job.Unbind();
+        context->Dependants.Clear();
+        Platform::InterlockedDecrement(&ContextsActive);
+        Platform::AtomicStore(&context->Used, 0);
+        WaitSignal.NotifyAll();
+    }
 }
 
 int32 JobSystemThread::Run()
 {
-    Platform::SetThreadAffinityMask(1ull << Index);
+    if (AffinityMask)
+        Platform::SetThreadAffinityMask(AffinityMask);
+    ThreadQueueIndex = (int32)Index;
 
     JobData data;
-    Function<void(int32)> job;
     bool attachCSharpThread = true;
     while (Platform::AtomicRead(&ExitFlag) == 0)
     {
         // Try to get a job
-        JobsLocker.Lock();
-        if (Jobs.Count() != 0)
-        {
-            data = Jobs.PeekFront();
-            Jobs.PopFront();
-            const JobContext& context = ((const Dictionary<int64, JobContext>&)JobContexts).At(data.JobKey);
-            job = context.Job;
-        }
-        JobsLocker.Unlock();
-
-        if (job.IsBinded())
+        if (DequeueJob((int32)Index, data))
         {
 #if USE_CSHARP
             // Ensure to have C# thread attached to this thead (late init due to MCore being initialized after Job System)
@@ -202,45 +583,33 @@ int32 JobSystemThread::Run()
             }
 #endif
 
-            // Run job
-            job(data.Index);
-
-            // Move forward with the job queue
-            bool notifyWaiting = false;
-            JobsLocker.Lock();
-            JobContext& context = JobContexts.At(data.JobKey);
-            if (Platform::InterlockedDecrement(&context.JobsLeft) <= 0)
+#if JOB_SYSTEM_STATS
+            if (ProfilerCPU::Enabled)
             {
-                // Update any dependant jobs
-                for (int64 dependant : context.Dependants)
-                {
-                    JobContext& dependantContext = JobContexts.At(dependant);
-                    if (--dependantContext.DependenciesLeft <= 0)
-                    {
-                        // Dispatch dependency when it's ready
-                        JobData dependantData;
-                        dependantData.JobKey = dependant;
-                        for (dependantData.Index = 0; dependantData.Index < dependantContext.JobsLeft; dependantData.Index++)
-                            Jobs.PushBack(dependantData);
-                    }
-                }
-
-                // Remove completed context
-                JobContexts.Remove(data.JobKey);
-                notifyWaiting = true;
+                const uint64 start = Platform::GetTimeCycles();
+                ExecuteJob(data);
+                auto& stats = Workers[Index];
+                AddWorkerStat(stats.BusyCycles, (int64)(Platform::GetTimeCycles() - start));
+                AddWorkerStat(stats.JobsExecuted, 1);
+                continue;
             }
-            JobsLocker.Unlock();
-            if (notifyWaiting)
-                WaitSignal.NotifyAll();
-
-            job.Unbind();
+#endif
+            ExecuteJob(data);
         }
-        else
+        else if (Platform::AtomicRead(&JobsQueued) <= 0)
         {
             // Wait for signal
+#if JOB_SYSTEM_STATS
+            const uint64 start = ProfilerCPU::Enabled ? Platform::GetTimeCycles() : 0;
+#endif
             JobsMutex.Lock();
-            JobsSignal.Wait(JobsMutex);
+            if (Platform::AtomicRead(&JobsQueued) <= 0 && Platform::AtomicRead(&ExitFlag) == 0)
+                JobsSignal.Wait(JobsMutex);
             JobsMutex.Unlock();
+#if JOB_SYSTEM_STATS
+            if (start != 0)
+                AddWorkerStat(Workers[Index].IdleCycles, (int64)(Platform::GetTimeCycles() - start));
+#endif
         }
     }
     return 0;
@@ -248,14 +617,13 @@ int32 JobSystemThread::Run()
 
 #endif
 
-void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
+void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount, JobPriority priority)
 {
 #if JOB_SYSTEM_ENABLED
-    // TODO: disable async if called on job thread? or maybe Wait should handle waiting in job thread to do the processing?
     if (jobCount > 1)
     {
         // Async
-        const int64 jobWaitHandle = Dispatch(job, jobCount);
+        const int64 jobWaitHandle = Dispatch(job, jobCount, priority);
         Wait(jobWaitHandle);
     }
     else
@@ -267,27 +635,62 @@ void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
     }
 }
 
-int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
+void JobSystem::ParallelFor(int32 begin, int32 end, int32 grainSize, const Function<void(int32, int32)>& job)
 {
-    if (jobCount <= 0)
-        return 0;
-    PROFILE_CPU();
+    const int32 count = end - begin;
+    if (count <= 0)
+        return;
 #if JOB_SYSTEM_ENABLED
-    const auto label = Platform::InterlockedAdd(&JobLabel, (int64)jobCount) + jobCount;
+    if (grainSize <= 0)
+    {
+        // Split into a few chunks per thread to balance uneven workloads
+        grainSize = Math::Max(count / Math::Max(ThreadsCount * 4, 1), 1);
+    }
+    const int32 chunksCount = (count + grainSize - 1) / grainSize;
+    if (chunksCount > 1 && ThreadsCount > 1)
+    {
+        PROFILE_CPU();
 
-    JobData data;
-    data.JobKey = label;
+        // Each job execution claims the next chunk of the range until it's all processed
+        volatile int64 next = begin;
+        const Function<void(int32)> rangeJob = [&next, end, grainSize, &job](int32)
+        {
+            while (true)
+            {
+                const int64 chunkStart = Platform::InterlockedAdd(&next, grainSize);
+                if (chunkStart >= end)
+                    break;
+                job((int32)chunkStart, (int32)Math::Min<int64>(chunkStart + grainSize, end));
+            }
+        };
+        const int64 label = Dispatch(rangeJob, Math::Min(chunksCount - 1, ThreadsCount));
 
-    JobContext context;
-    context.Job = job;
-    context.JobsLeft = jobCount;
-    context.DependenciesLeft = 0;
+        // Process chunks on the calling thread too
+        rangeJob(0);
+        Wait(label);
+        return;
+    }
+#endif
+    job(begin, end);
+}
 
-    JobsLocker.Lock();
-    JobContexts.Add(label, MoveTemp(context));
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.PushBack(data);
-    JobsLocker.Unlock();
+int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount, JobPriority priority)
+{
+    if (jobCount <= 0)
+        return 0;
+    PROFILE_CPU();
+#if JOB_SYSTEM_ENABLED
+    int64 label;
+    JobContext* context = AllocateContext(label);
+    context->Job = job;
+    context->JobsLeft = jobCount;
+    context->JobsCount = jobCount;
+    context->Priority = priority;
+    context->DependenciesLeft = 0;
+    Platform::AtomicStore(&context->Label, label);
+
+    // Queue jobs after registering context (so job thread can complete it right away)
+    EnqueueJob(context, label, jobCount);
 
     if (JobStartingOnDispatch)
     {
@@ -305,46 +708,45 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
 #endif
 }
 
-int64 JobSystem::Dispatch(const Function<void(int32)>& job, Span<int64> dependencies, int32 jobCount)
+int64 JobSystem::Dispatch(const Function<void(int32)>& job, Span<int64> dependencies, int32 jobCount, JobPriority priority)
 {
     if (jobCount <= 0)
         return 0;
     PROFILE_CPU();
 #if JOB_SYSTEM_ENABLED
-    const auto label = Platform::InterlockedAdd(&JobLabel, (int64)jobCount) + jobCount;
-
-    JobData data;
-    data.JobKey = label;
-
-    JobContext context;
-    context.Job = job;
-    context.JobsLeft = jobCount;
-    context.DependenciesLeft = 0;
-
-    JobsLocker.Lock();
+    int64 label;
+    JobContext* context = AllocateContext(label);
+    context->Job = job;
+    context->JobsLeft = jobCount;
+    context->JobsCount = jobCount;
+    context->Priority = priority;
+    context->DependenciesLeft = 1; // Prevent dispatching from the completed dependencies before all of them are registered
+    Platform::AtomicStore(&context->Label, label);
     for (int64 dependency : dependencies)
     {
-        if (JobContext* dependencyContext = JobContexts.TryGet(dependency))
+        JobContext* dependencyContext = &Contexts[dependency & (JOB_SYSTEM_CONTEXTS_COUNT - 1)];
+        if (dependency <= 0 || Platform::AtomicRead(&dependencyContext->Label) != dependency)
+            continue;
+        dependencyContext->DependantsLocker.Lock();
+        if (Platform::AtomicRead(&dependencyContext->Label) == dependency)
         {
-            context.DependenciesLeft++;
+            Platform::InterlockedIncrement(&context->DependenciesLeft);
             dependencyContext->Dependants.Add(label);
         }
+        dependencyContext->DependantsLocker.Unlock();
     }
-    JobContexts.Add(label, MoveTemp(context));
-    if (context.DependenciesLeft == 0)
+    const bool dispatchNow = Platform::InterlockedDecrement(&context->DependenciesLeft) <= 0;
+    if (dispatchNow)
     {
         // No dependencies left to complete so dispatch now
-        for (data.Index = 0; data.Index < jobCount; data.Index++)
-            Jobs.PushBack(data);
-    }
-    JobsLocker.Unlock();
-
-    if (context.DependenciesLeft == 0 && JobStartingOnDispatch)
-    {
-        if (jobCount == 1)
-            JobsSignal.NotifyOne();
-        else
-            JobsSignal.NotifyAll();
+        EnqueueJob(context, label, jobCount);
+        if (JobStartingOnDispatch)
+        {
+            if (jobCount == 1)
+                JobsSignal.NotifyOne();
+            else
+                JobsSignal.NotifyAll();
+        }
     }
 
     return label;
@@ -358,19 +760,20 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, Span<int64> dependen
 void JobSystem::Wait()
 {
 #if JOB_SYSTEM_ENABLED
-    JobsLocker.Lock();
-    int32 numJobs = JobContexts.Count();
-    JobsLocker.Unlock();
-
-    while (numJobs > 0)
+    JobData data;
+    while (Platform::AtomicRead(&ContextsActive) > 0)
     {
-        WaitMutex.Lock();
-        WaitSignal.Wait(WaitMutex, 1);
-        WaitMutex.Unlock();
-
-        JobsLocker.Lock();
-        numJobs = JobContexts.Count();
-        JobsLocker.Unlock();
+        // Help with executing jobs on this thread
+        if (DequeueJob(ThreadQueueIndex, data))
+        {
+            ExecuteJob(data);
+        }
+        else
+        {
+            WaitMutex.Lock();
+            WaitSignal.Wait(WaitMutex, 1);
+            WaitMutex.Unlock();
+        }
     }
 #endif
 }
@@ -380,20 +783,33 @@ void JobSystem::Wait(int64 label)
 #if JOB_SYSTEM_ENABLED
     PROFILE_CPU();
 
+    JobData data;
     while (Platform::AtomicRead(&ExitFlag) == 0)
     {
-        JobsLocker.Lock();
-        const JobContext* context = JobContexts.TryGet(label);
-        JobsLocker.Unlock();
-
-        // Skip if context has been already executed (last job removes it)
+        // Skip if context has been already executed (last job releases it)
+        const JobContext* context = label > 0 ? GetContext(label) : nullptr;
         if (!context)
             break;
+        const JobPriority priority = context->Priority;
+
+        // Execute awaited jobs on this thread instead of idle waiting (also prevents deadlocks when waiting from within a job)
+        if (DequeueJobForWait(label, priority, data))
+        {
+            ExecuteJob(data);
+            continue;
+        }
 
         // Wait on signal until input label is not yet done
+#if JOB_SYSTEM_STATS
+        const uint64 start = ProfilerCPU::Enabled ? Platform::GetTimeCycles() : 0;
+#endif
         WaitMutex.Lock();
         WaitSignal.Wait(WaitMutex, 1);
         WaitMutex.Unlock();
+#if JOB_SYSTEM_STATS
+        if (start != 0)
+            Platform::InterlockedAdd(&StatsWaitCycles, (int64)(Platform::GetTimeCycles() - start));
+#endif
 
         // Wake up any thread to prevent stalling in highly multi-threaded environment
         JobsSignal.NotifyOne();
@@ -407,9 +823,7 @@ void JobSystem::SetJobStartingOnDispatch(bool value)
     JobStartingOnDispatch = value;
     if (value)
     {
-        JobsLocker.Lock();
-        const int32 count = Jobs.Count();
-        JobsLocker.Unlock();
+        const int64 count = Platform::AtomicRead(&JobsQueued);
         if (count == 1)
             JobsSignal.NotifyOne();
         else if (count != 0)
@@ -426,3 +840,32 @@ int32 JobSystem::GetThreadsCount()
     return 0;
 #endif
 }
+
+#if COMPILE_WITH_PROFILER
+
+void JobSystem::GetStats(Stats& result)
+{
+    Platform::MemoryClear(&result, sizeof(Stats));
+#if JOB_SYSTEM_STATS
+    result.WorkersCount = ThreadsCount;
+    for (int32 i = 0; i < ThreadsCount; i++)
+    {
+        const auto& src = Workers[i];
+        auto& dst = result.Workers[i];
+        dst.BusyCycles = Platform::AtomicRead(&src.BusyCycles);
+        dst.IdleCycles = Platform::AtomicRead(&src.IdleCycles);
+        dst.JobsExecuted = Platform::AtomicRead(&src.JobsExecuted);
+        dst.JobsStolen = Platform::AtomicRead(&src.JobsStolen);
+    }
+    result.Dispatches = Platform::AtomicRead(&StatsDispatches);
+    result.JobsDispatched = Platform::AtomicRead(&StatsJobsDispatched);
+    result.WaitCycles = Platform::AtomicRead(&StatsWaitCycles);
+    result.LatencyCycles = Platform::AtomicRead(&StatsLatencyCycles);
+    result.LatencyCount = Platform::AtomicRead(&StatsLatencyCount);
+    result.LatencyMaxCycles = Platform::InterlockedExchange(&StatsLatencyMaxCycles, 0);
+    for (int32 i = 0; i < LatencyHistogramSize; i++)
+        result.LatencyHistogram[i] = Platform::AtomicRead(&StatsLatencyHistogram[i]);
+#endif
+}
+
+#endif
@@ -7,6 +7,30 @@
 template<typename T>
 class Span;
 
+/// <summary>
+/// The jobs execution priority. Job threads pick up the queued jobs with higher priority first.
+/// </summary>
+API_ENUM() enum class JobPriority
+{
+    /// <summary>
+    /// The frame-critical work (eg. scene rendering or draw calls sorting).
+    /// </summary>
+    High = 0,
+
+    /// <summary>
+    /// The default priority.
+    /// </summary>
+    Normal = 1,
+
+    /// <summary>
+    /// The long-running or bulk work that can be delayed (eg. asynchronous rendering updates or asset processing).
+    /// </summary>
+    Background = 2,
+
+    API_ENUM(Attributes="HideInEditor")
+    MAX
+};
+
 /// <summary>
 /// Lightweight multi-threaded jobs execution scheduler. Uses a pool of threads and supports work-stealing concept.
 /// </summary>
@@ -19,15 +43,26 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// </summary>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
-    API_FUNCTION() static void Execute(const Function<void(int32)>& job, int32 jobCount = 1);
+    /// <param name="priority">The job execution priority.</param>
+    API_FUNCTION() static void Execute(const Function<void(int32)>& job, int32 jobCount = 1, JobPriority priority = JobPriority::Normal);
+
+    /// <summary>
+    /// Executes the job over the range of indices split into chunks processed in parallel (utility to call dispatch and wait for the end). Chunks are claimed dynamically so threads that finish early process the rest of the range.
+    /// </summary>
+    /// <param name="begin">The range start index (inclusive).</param>
+    /// <param name="end">The range end index (exclusive).</param>
+    /// <param name="grainSize">The minimum amount of indices processed by a single job call. Use 0 to pick chunk size automatically based on the job threads count.</param>
+    /// <param name="job">The job. Arguments are the start (inclusive) and end (exclusive) indices of the chunk to process.</param>
+    static void ParallelFor(int32 begin, int32 end, int32 grainSize, const Function<void(int32, int32)>& job);
 
     /// <summary>
     /// Dispatches the job for the execution.
     /// </summary>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
+    /// <param name="priority">The job execution priority.</param>
     /// <returns>The label identifying this dispatch. Can be used to wait for the execution end.</returns>
-    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1);
+    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1, JobPriority priority = JobPriority::Normal);
 
     /// <summary>
     /// Dispatches the job for the execution after all of dependant jobs will complete.
@@ -35,8 +70,9 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="dependencies">The list of dependant jobs that need to complete in order to start executing this job.</param>
     /// <param name="jobCount">The job executions count.</param>
+    /// <param name="priority">The job execution priority.</param>
     /// <returns>The label identifying this dispatch. Can be used to wait for the execution end.</returns>
-    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, Span<int64> dependencies, int32 jobCount = 1);
+    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, Span<int64> dependencies, int32 jobCount = 1, JobPriority priority = JobPriority::Normal);
 
     /// <summary>
     /// Waits for all dispatched jobs to finish.
@@ -46,6 +82,7 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// <summary>
     /// Waits for all dispatched jobs until a given label to finish (i.e. waits for a Dispatch that returned that label).
     /// </summary>
+    /// <remarks>The calling thread executes the awaited jobs (and jobs dispatched before them) while waiting, so it's safe to wait from within a job.</remarks>
     /// <param name="label">The label.</param>
     API_FUNCTION() static void Wait(int64 label);
 
@@ -58,4 +95,55 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// Gets the amount of job system threads.
     /// </summary>
     API_PROPERTY() static int32 GetThreadsCount();
+
+#if COMPILE_WITH_PROFILER
+public:
+    /// <summary>
+    /// The size of the jobs latency histogram. Bucket i counts jobs started within [2^i, 2^(i+1)) microseconds since dispatch (first and last buckets are open).
+    /// </summary>
+    static constexpr int32 LatencyHistogramSize = 16;
+
+    /// <summary>
+    /// The job system worker thread statistics (accumulated since start).
+    /// </summary>
+    struct WorkerStats
+    {
+        // The time spent on executing jobs (in CPU cycles).
+        int64 BusyCycles;
+        // The time spent on sleeping when there were no jobs queued (in CPU cycles).
+        int64 IdleCycles;
+        // The amount of executed jobs.
+        int64 JobsExecuted;
+        // The amount of executed jobs taken from the other threads queues.
+        int64 JobsStolen;
+    };
+
+    /// <summary>
+    /// The job system statistics (accumulated since start). Collected only when CPU profiler is enabled.
+    /// </summary>
+    struct Stats
+    {
+        int32 WorkersCount;
+        WorkerStats Workers[PLATFORM_THREADS_LIMIT / 2];
+        // The amount of Dispatch calls.
+        int64 Dispatches;
+        // The amount of jobs dispatched (fan-out of all Dispatch calls).
+        int64 JobsDispatched;
+        // The time spent by threads on waiting for the jobs completion in Wait (in CPU cycles).
+        int64 WaitCycles;
+        // The sum of the jobs latency from dispatch to execution start (in CPU cycles).
+        int64 LatencyCycles;
+        // The amount of jobs with measured latency.
+        int64 LatencyCount;
+        // The highest job latency since the last stats query (in CPU cycles).
+        int64 LatencyMaxCycles;
+        // The jobs latency histogram (see LatencyHistogramSize).
+        int64 LatencyHistogram[LatencyHistogramSize];
+    };
+
+    /// <summary>
+    /// Gets the job system statistics. Resets the maximum latency.
+    /// </summary>
+    static void GetStats(Stats& result);
+#endif
 };
@@ -22,7 +22,10 @@ TaskGraphSystem::~TaskGraphSystem()
 {
     // Cleanup any outstanding dependencies
     for (auto* e : _reverseDependencies)
+    {
         e->_dependencies.Remove(this);
+        e->_jobDependencies.Remove(this);
+    }
 }
 
 void TaskGraphSystem::AddDependency(TaskGraphSystem* system)
@@ -43,6 +46,24 @@ void TaskGraphSystem::RemoveDependency(TaskGraphSystem* system)
     _dependencies.Remove(system);
 }
 
+void TaskGraphSystem::AddJobDependency(TaskGraphSystem* system)
+{
+    CHECK(system);
+    if (_jobDependencies.Contains(system))
+        return;
+    system->_reverseDependencies.Add(this);
+    _jobDependencies.Add(system);
+}
+
+void TaskGraphSystem::RemoveJobDependency(TaskGraphSystem* system)
+{
+    CHECK(system);
+    if (!_jobDependencies.Contains(system))
+        return;
+    system->_reverseDependencies.Remove(this);
+    _jobDependencies.Remove(system);
+}
+
 void TaskGraphSystem::PreExecute(TaskGraph* graph)
 {
 }
@@ -80,32 +101,53 @@ void TaskGraph::Execute()
     PROFILE_CPU();
 
     for (auto system : _systems)
+    {
+        system->_labels.Clear();
         system->PreExecute(this);
+    }
 
     _queue.Clear();
     _remaining.Clear();
     _remaining.Add(_systems);
 
+    Array<TaskGraphSystem*, InlinedAllocation<64>> ready;
     while (_remaining.HasItems())
     {
-        // Find systems without dependencies or with already executed dependencies
-        for (int32 i = _remaining.Count() - 1; i >= 0; i--)
+        while (true)
         {
-            auto e = _remaining[i];
-            bool hasReadyDependencies = true;
-            for (auto d : e->_dependencies)
+            // Find systems without dependencies or with already executed dependencies (systems that depend only on jobs of the other systems can run right after them)
+            ready.Clear();
+            for (int32 i = _remaining.Count() - 1; i >= 0; i--)
             {
-                if (_remaining.Contains(d))
+                auto e = _remaining[i];
+                bool hasReadyDependencies = true;
+                for (auto d : e->_dependencies)
                 {
-                    hasReadyDependencies = false;
-                    break;
+                    if (_remaining.Contains(d) || _queue.Contains(d))
+                    {
+                        hasReadyDependencies = false;
+                        break;
+                    }
                 }
+                for (auto d : e->_jobDependencies)
+                {
+                    if (!hasReadyDependencies || _remaining.Contains(d))
+                    {
+                        hasReadyDependencies = false;
+                        break;
+                    }
+                }
+                if (hasReadyDependencies)
+                    ready.Add(e);
             }
-            if (hasReadyDependencies)
-            {
-                _queue.Add(e);
-                _remaining.RemoveAt(i);
-            }
+            if (ready.IsEmpty())
+                break;
+
+            // Append to the queue in order (after any systems they depend on)
+            for (auto e : ready)
+                _remaining.Remove(e);
+            Sorting::QuickSort(ready.Get(), ready.Count(), &SortTaskGraphSystem);
+            _queue.Add(ready);
         }
 
         // End if no systems left
@@ -113,7 +155,6 @@ void TaskGraph::Execute()
             break;
 
         // Execute in order
-        Sorting::QuickSort(_queue.Get(), _queue.Count(), &SortTaskGraphSystem);
         JobSystem::SetJobStartingOnDispatch(false);
         _labels.Clear();
         for (int32 i = 0; i < _queue.Count(); i++)
@@ -134,9 +175,26 @@ void TaskGraph::Execute()
         system->PostExecute(this);
 }
 
-void TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount)
+int64 TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount, JobPriority priority)
+{
+    ASSERT(_currentSystem);
+    const int64 label = JobSystem::Dispatch(job, jobCount, priority);
+    _currentSystem->_labels.Add(label);
+    _labels.Add(label);
+    return label;
+}
+
+int64 TaskGraph::DispatchJob(const Function<void(int32)>& job, Span<int64> dependencies, int32 jobCount, JobPriority priority)
 {
     ASSERT(_currentSystem);
-    const int64 label = JobSystem::Dispatch(job, jobCount);
+    const int64 label = JobSystem::Dispatch(job, dependencies, jobCount, priority);
+    _currentSystem->_labels.Add(label);
     _labels.Add(label);
+    return label;
+}
+
+Span<int64> TaskGraph::GetJobLabels(TaskGraphSystem* system) const
+{
+    CHECK_RETURN(system, Span<int64>());
+    return ToSpan(system->_labels);
 }
@@ -4,6 +4,8 @@
 
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
+#include "JobSystem.h"
 
 class TaskGraph;
 
@@ -16,7 +18,9 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
     friend TaskGraph;
 private:
     Array<TaskGraphSystem*, InlinedAllocation<16>> _dependencies;
+    Array<TaskGraphSystem*, InlinedAllocation<16>> _jobDependencies;
     Array<TaskGraphSystem*, InlinedAllocation<16>> _reverseDependencies;
+    Array<int64, InlinedAllocation<16>> _labels;
 
 public:
     /// <summary>
@@ -39,6 +43,18 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
     /// <param name="system">The system to not depend on anymore.</param>
     API_FUNCTION() void RemoveDependency(TaskGraphSystem* system);
 
+    /// <summary>
+    /// Adds the dependency on the jobs of the system. This system will be executed right after the given system (without waiting for its jobs to finish) and should use TaskGraph::GetJobLabels with TaskGraph::DispatchJob to make its jobs depend on the given system's jobs.
+    /// </summary>
+    /// <param name="system">The system to depend on.</param>
+    API_FUNCTION() void AddJobDependency(TaskGraphSystem* system);
+
+    /// <summary>
+    /// Removes the dependency on the jobs of the system.
+    /// </summary>
+    /// <param name="system">The system to not depend on anymore.</param>
+    API_FUNCTION() void RemoveJobDependency(TaskGraphSystem* system);
+
     /// <summary>
     /// Called before executing any systems of the graph. Can be used to initialize data (synchronous).
     /// </summary>
@@ -100,5 +116,25 @@ DECLARE_SCRIPTING_TYPE(TaskGraph);
     /// <remarks>Call only from system's Execute method to properly schedule job.</remarks>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
-    API_FUNCTION() void DispatchJob(const Function<void(int32)>& job, int32 jobCount = 1);
+    /// <param name="priority">The job execution priority.</param>
+    /// <returns>The label identifying this dispatch. Can be used as a dependency for other jobs.</returns>
+    API_FUNCTION() int64 DispatchJob(const Function<void(int32)>& job, int32 jobCount = 1, JobPriority priority = JobPriority::Normal);
+
+    /// <summary>
+    /// Dispatches the job for the execution after all of dependant jobs will complete.
+    /// </summary>
+    /// <remarks>Call only from system's Execute method to properly schedule job.</remarks>
+    /// <param name="job">The job. Argument is an index of the job execution.</param>
+    /// <param name="dependencies">The list of dependant jobs that need to complete in order to start executing this job (eg. labels from GetJobLabels).</param>
+    /// <param name="jobCount">The job executions count.</param>
+    /// <param name="priority">The job execution priority.</param>
+    /// <returns>The label identifying this dispatch. Can be used as a dependency for other jobs.</returns>
+    API_FUNCTION() int64 DispatchJob(const Function<void(int32)>& job, Span<int64> dependencies, int32 jobCount = 1, JobPriority priority = JobPriority::Normal);
+
+    /// <summary>
+    /// Gets the labels of the jobs dispatched by the given system during the current graph execution.
+    /// </summary>
+    /// <param name="system">The system that already has been executed.</param>
+    /// <returns>The list of job labels.</returns>
+    API_FUNCTION() Span<int64> GetJobLabels(TaskGraphSystem* system) const;
 };
@@ -5,6 +5,7 @@
 #include "Threading.h"
 #include "ThreadPoolTask.h"
 #include "ConcurrentTaskQueue.h"
+#include "JobSystem.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Types/String.h"
@@ -15,6 +16,9 @@
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/Thread.h"
 
+// The amount of idle iterations the worker spins (and yields) looking for a new task before going to sleep
+#define THREAD_POOL_SPIN_COUNT 64
+
 FLAXENGINE_API bool IsInMainThread()
 {
     return Globals::MainThreadID == Platform::GetCurrentThreadID();
@@ -27,8 +31,27 @@ namespace ThreadPoolImpl
     ConcurrentTaskQueue<ThreadPoolTask> Jobs; // Hello Steve!
     ConditionVariable JobsSignal;
     CriticalSection JobsMutex;
+    volatile int64 SleepingThreads = 0;
+    THREADLOCAL Array<ThreadPoolTask*, InlinedAllocation<64>>* BatchTasks = nullptr;
+
+    void WakeUp(int32 count)
+    {
+        // Ensure that tasks added to the queue are visible before checking the sleeping threads (paired with worker going to sleep)
+        Platform::MemoryBarrier();
+        const int64 sleeping = Platform::AtomicRead(&SleepingThreads);
+        if (sleeping == 0)
+            return;
+        JobsMutex.Lock();
+        if (count == 1)
+            JobsSignal.NotifyOne();
+        else
+            JobsSignal.NotifyAll();
+        JobsMutex.Unlock();
+    }
 }
 
+bool ThreadPool::UseJobSystem = false;
+
 String ThreadPoolTask::ToString() const
 {
     return String::Format(TEXT("Thread Pool Task ({0})"), (int32)GetState());
@@ -36,8 +59,36 @@ String ThreadPoolTask::ToString() const
 
 void ThreadPoolTask::Enqueue()
 {
+    if (ThreadPool::UseJobSystem)
+    {
+        JobSystem::Dispatch([this](int32)
+        {
+            Execute();
+        }, 1, JobPriority::Background);
+        return;
+    }
+    if (ThreadPoolImpl::BatchTasks)
+    {
+        // Defer enqueue until the whole batch gets started
+        ThreadPoolImpl::BatchTasks->Add(this);
+        return;
+    }
     ThreadPoolImpl::Jobs.Add(this);
-    ThreadPoolImpl::JobsSignal.NotifyOne();
+    ThreadPoolImpl::WakeUp(1);
+}
+
+void ThreadPool::StartBatch(Span<ThreadPoolTask*> tasks)
+{
+    Array<ThreadPoolTask*, InlinedAllocation<64>> batch;
+    ThreadPoolImpl::BatchTasks = &batch;
+    for (int32 i = 0; i < tasks.Length(); i++)
+        tasks[i]->Start();
+    ThreadPoolImpl::BatchTasks = nullptr;
+    if (batch.HasItems())
+    {
+        ThreadPoolImpl::Jobs.AddBatch(batch.Get(), batch.Count());
+        ThreadPoolImpl::WakeUp(batch.Count());
+    }
 }
 
 class ThreadPoolService : public EngineService
@@ -84,14 +135,18 @@ void ThreadPoolService::BeforeExit()
 {
     // Set exit flag and wake up threads
     Platform::AtomicStore(&ThreadPoolImpl::ExitFlag, 1);
+    ThreadPoolImpl::JobsMutex.Lock();
     ThreadPoolImpl::JobsSignal.NotifyAll();
+    ThreadPoolImpl::JobsMutex.Unlock();
 }
 
 void ThreadPoolService::Dispose()
 {
     // Set exit flag and wake up threads
     Platform::AtomicStore(&ThreadPoolImpl::ExitFlag, 1);
+    ThreadPoolImpl::JobsMutex.Lock();
     ThreadPoolImpl::JobsSignal.NotifyAll();
+    ThreadPoolImpl::JobsMutex.Unlock();
 
     // Wait some time
     Platform::Sleep(10);
@@ -107,20 +162,33 @@ void ThreadPoolService::Dispose()
 int32 ThreadPool::ThreadProc()
 {
     ThreadPoolTask* task;
+    int32 spinCount = 0;
 
     // Work until end
     while (Platform::AtomicRead(&ThreadPoolImpl::ExitFlag) == 0)
     {
-        // Try to get a job
+        // Try to get a job (single task at once so tasks waiting on each other are not stuck behind the one that is being executed)
         if (ThreadPoolImpl::Jobs.try_dequeue(task))
         {
             task->Execute();
+            spinCount = 0;
+        }
+        else if (spinCount < THREAD_POOL_SPIN_COUNT)
+        {
+            // Spin for a while to reduce latency of the tasks that come in bursts
+            spinCount++;
+            Platform::Sleep(0);
         }
         else
         {
+            // Go to sleep until a new task arrives
             ThreadPoolImpl::JobsMutex.Lock();
-            ThreadPoolImpl::JobsSignal.Wait(ThreadPoolImpl::JobsMutex);
+            Platform::InterlockedIncrement(&ThreadPoolImpl::SleepingThreads);
+            if (ThreadPoolImpl::Jobs.Count() == 0 && Platform::AtomicRead(&ThreadPoolImpl::ExitFlag) == 0)
+                ThreadPoolImpl::JobsSignal.Wait(ThreadPoolImpl::JobsMutex);
+            Platform::InterlockedDecrement(&ThreadPoolImpl::SleepingThreads);
             ThreadPoolImpl::JobsMutex.Unlock();
+            spinCount = 0;
         }
     }
 
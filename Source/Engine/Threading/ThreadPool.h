@@ -3,14 +3,30 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/Span.h"
+
+class ThreadPoolTask;
 
 /// <summary>
 /// Main engine thread pool for threaded tasks system.
 /// </summary>
-class ThreadPool
+class FLAXENGINE_API ThreadPool
 {
     friend class ThreadPoolTask;
     friend class ThreadPoolService;
+public:
+
+    /// <summary>
+    /// If enabled, the thread pool tasks will be executed on Job System threads with background priority instead of using the dedicated thread pool workers. Can be used to reduce the amount of threads in the system when both schedulers compete for the CPU.
+    /// </summary>
+    static bool UseJobSystem;
+
+    /// <summary>
+    /// Starts multiple tasks at once. Tasks are added to the queue in a single batch and only the required amount of the sleeping workers gets woken up which reduces wake-up overhead when spawning many tasks.
+    /// </summary>
+    /// <param name="tasks">The tasks to start.</param>
+    static void StartBatch(Span<ThreadPoolTask*> tasks);
+
 private:
 
     static int32 ThreadProc();
@@ -12,6 +12,8 @@
 #include "Engine/Tools/TextureTool/TextureTool.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
 
 #define OPEN_FBX_CONVERT_SPACE 1
 #if BUILD_DEBUG
@@ -116,6 +118,14 @@ struct OpenFbxImporterData
     Array<int> TriangulateIndicesCache;
     Array<int> TriangulateEarIndicesCache;
 
+    // Meshes with the geometry post-processing (index buffer, tangents, optimization) deferred to be done in parallel after extracting all meshes
+    struct PendingMesh
+    {
+        MeshData* Mesh;
+        bool GenerateTangents;
+    };
+    Array<PendingMesh> PendingMeshes;
+
     OpenFbxImporterData(const String& path, const ModelTool::Options& options, ofbx::IScene* scene)
         : Scene(scene)
         , ScenePtr(scene)
@@ -994,6 +1004,40 @@ bool ProcessMesh(ModelData& result, OpenFbxImporterData& data, const ofbx::Mesh*
         }
     }
 
+    // Build index buffer and tangents later (in parallel for all meshes)
+    auto& pending = data.PendingMeshes.AddOne();
+    pending.Mesh = &mesh;
+    pending.GenerateTangents = (data.Options.CalculateTangents || !tangents.values) && mesh.UVs.HasItems();
+
+    // Apply FBX Mesh geometry transformation
+    /*const Matrix geometryTransform = ToMatrix(aMesh->getGeometricMatrix());
+    if (!geometryTransform.IsIdentity())
+    {
+        mesh.TransformBuffer(geometryTransform);
+    }*/
+
+    // Get local transform for origin shifting translation
+    auto translation = ToMatrix(aMesh->getGlobalTransform()).GetTranslation();
+    auto scale = data.GlobalSettings.UnitScaleFactor;
+    if (data.GlobalSettings.CoordAxis == ofbx::CoordSystem_RightHanded)
+        mesh.OriginTranslation = scale * Vector3(translation.X, translation.Y, -translation.Z);
+    else
+        mesh.OriginTranslation = scale * Vector3(translation.X, translation.Y, translation.Z);
+
+    auto rot = aMesh->getLocalRotation();
+    auto quat = Quaternion::Euler(-(float)rot.x, -(float)rot.y, -(float)rot.z);
+    mesh.OriginOrientation = quat;
+
+    auto scaling = aMesh->getLocalScaling();
+    mesh.Scaling = Vector3(scale * (float)scaling.x, scale * (float)scaling.y, scale * (float)scaling.z);
+    return false;
+}
+
+bool ProcessMeshGeometry(const OpenFbxImporterData& data, MeshData& mesh, bool generateTangents, String& errorMsg)
+{
+    PROFILE_CPU();
+    ZoneText(*mesh.Name, mesh.Name.Length());
+
     // Build solid index buffer (remove duplicated vertices)
     mesh.BuildIndexBuffer();
 
@@ -1004,7 +1048,7 @@ bool ProcessMesh(ModelData& result, OpenFbxImporterData& data, const ofbx::Mesh*
             Swap(mesh.Indices.Get()[i], mesh.Indices.Get()[i + 2]);
     }
 
-    if ((data.Options.CalculateTangents || !tangents.values) && mesh.UVs.HasItems())
+    if (generateTangents)
     {
         if (mesh.GenerateTangents(data.Options.SmoothingTangentsAngle))
         {
@@ -1018,30 +1062,31 @@ bool ProcessMesh(ModelData& result, OpenFbxImporterData& data, const ofbx::Mesh*
         mesh.ImproveCacheLocality();
     }
 
-    // Apply FBX Mesh geometry transformation
-    /*const Matrix geometryTransform = ToMatrix(aMesh->getGeometricMatrix());
-    if (!geometryTransform.IsIdentity())
-    {
-        mesh.TransformBuffer(geometryTransform);
-    }*/
-
-    // Get local transform for origin shifting translation
-    auto translation = ToMatrix(aMesh->getGlobalTransform()).GetTranslation();
-    auto scale = data.GlobalSettings.UnitScaleFactor;
-    if (data.GlobalSettings.CoordAxis == ofbx::CoordSystem_RightHanded)
-        mesh.OriginTranslation = scale * Vector3(translation.X, translation.Y, -translation.Z);
-    else
-        mesh.OriginTranslation = scale * Vector3(translation.X, translation.Y, translation.Z);
-
-    auto rot = aMesh->getLocalRotation();
-    auto quat = Quaternion::Euler(-(float)rot.x, -(float)rot.y, -(float)rot.z);
-    mesh.OriginOrientation = quat;
-
-    auto scaling = aMesh->getLocalScaling();
-    mesh.Scaling = Vector3(scale * (float)scaling.x, scale * (float)scaling.y, scale * (float)scaling.z);
     return false;
 }
 
+bool ProcessMeshesGeometry(OpenFbxImporterData& data, String& errorMsg)
+{
+    // Meshes are independent so process them on job system (each job allocates only the temporary data of a single mesh)
+    PROFILE_CPU();
+    bool failed = false;
+    CriticalSection errorLocker;
+    Function<void(int32)> job = [&data, &failed, &errorLocker, &errorMsg](int32 i)
+    {
+        const auto& pending = data.PendingMeshes[i];
+        String meshError;
+        if (ProcessMeshGeometry(data, *pending.Mesh, pending.GenerateTangents, meshError))
+        {
+            ScopeLock lock(errorLocker);
+            failed = true;
+            errorMsg = meshError;
+        }
+    };
+    JobSystem::Execute(job, data.PendingMeshes.Count(), JobPriority::Background);
+    data.PendingMeshes.Clear();
+    return failed;
+}
+
 bool ImportMesh(ModelData& result, OpenFbxImporterData& data, const ofbx::Mesh* aMesh, String& errorMsg, int partitionIndex)
 {
     PROFILE_CPU();
@@ -1433,6 +1478,8 @@ bool ModelTool::ImportDataOpenFBX(const String& path, ModelData& data, Options&
             if (ImportMesh(meshIndex, data, context, errorMsg))
                 return true;
         }
+        if (ProcessMeshesGeometry(context, errorMsg))
+            return true;
     }
 
     // Import skeleton
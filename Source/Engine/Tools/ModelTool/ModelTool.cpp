@@ -85,7 +85,7 @@ class GPUModelSDFTask : public GPUTask
     int32 _lodIndex;
     Int3 _resolution;
     ModelBase::SDFData* _sdf;
-    GPUBuffer *_sdfSrc, *_sdfDst;
+    GPUBuffer *_sdfSrc, *_sdfDst, *_sdfSeeds;
     GPUTexture* _sdfResult;
     Float3 _xyzToLocalMul, _xyzToLocalAdd;
 
@@ -101,8 +101,25 @@ class GPUModelSDFTask : public GPUTask
         float WorldUnitsPerVoxel;
         Float3 VoxelToPosAdd;
         uint32 ThreadGroupsX;
+        uint32 JumpStep;
+        uint32 TriangleThreadsX;
+        Float2 Dummy0;
         });
 
+    Int3 GetTriangleGroups(Data& data) const
+    {
+        // Dispatch in 1D and fallback to 2D for meshes with a large amount of triangles
+        Int3 groups(Math::CeilToInt((float)data.TriangleCount / ThreadGroupSize), 1, 1);
+        if (groups.X > GPU_MAX_CS_DISPATCH_THREAD_GROUPS)
+        {
+            const int32 count = groups.X;
+            groups.X = Math::CeilToInt(Math::Sqrt((float)count));
+            groups.Y = Math::CeilToInt((float)count / groups.X);
+        }
+        data.TriangleThreadsX = groups.X * ThreadGroupSize;
+        return groups;
+    }
+
 public:
     GPUModelSDFTask(ConditionVariable& signal, Model* inputModel, ModelData* modelData, int32 lodIndex, const Int3& resolution, ModelBase::SDFData* sdf, GPUTexture* sdfResult, const Float3& xyzToLocalMul, const Float3& xyzToLocalAdd)
         : GPUTask(Type::Custom)
@@ -115,6 +132,7 @@ class GPUModelSDFTask : public GPUTask
         , _sdf(sdf)
         , _sdfSrc(GPUBuffer::New())
         , _sdfDst(GPUBuffer::New())
+        , _sdfSeeds(GPUBuffer::New())
         , _sdfResult(sdfResult)
         , _xyzToLocalMul(xyzToLocalMul)
         , _xyzToLocalAdd(xyzToLocalAdd)
@@ -122,6 +140,7 @@ class GPUModelSDFTask : public GPUTask
 #if GPU_ENABLE_RESOURCE_NAMING
         _sdfSrc->SetName(TEXT("SDFSrc"));
         _sdfDst->SetName(TEXT("SDFDst"));
+        _sdfSeeds->SetName(TEXT("SDFSeeds"));
 #endif
     }
 
@@ -129,6 +148,7 @@ class GPUModelSDFTask : public GPUTask
     {
         SAFE_DELETE_GPU_RESOURCE(_sdfSrc);
         SAFE_DELETE_GPU_RESOURCE(_sdfDst);
+        SAFE_DELETE_GPU_RESOURCE(_sdfSeeds);
     }
 
     Result run(GPUTasksContext* tasksContext) override
@@ -143,7 +163,7 @@ class GPUModelSDFTask : public GPUTask
         const uint32 resolutionSize = _resolution.X * _resolution.Y * _resolution.Z;
         auto desc = GPUBufferDescription::Typed(resolutionSize, PixelFormat::R32_UInt, true);
         // TODO: use transient texture (single frame)
-        if (_sdfSrc->Init(desc) || _sdfDst->Init(desc))
+        if (_sdfSrc->Init(desc) || _sdfDst->Init(desc) || _sdfSeeds->Init(desc))
             return Result::Failed;
         auto cb = shader->GetCB(0);
         Data data;
@@ -153,6 +173,8 @@ class GPUModelSDFTask : public GPUTask
         data.WorldUnitsPerVoxel = _sdf->WorldUnitsPerVoxel;
         data.VoxelToPosMul = _xyzToLocalMul;
         data.VoxelToPosAdd = _xyzToLocalAdd;
+        data.JumpStep = 0;
+        data.TriangleThreadsX = 0;
 
         // Dispatch in 1D and fallback to 2D when using large resolution
         Int3 threadGroups(Math::CeilToInt((float)resolutionSize / ThreadGroupSize), 1, 1);
@@ -192,13 +214,7 @@ class GPUModelSDFTask : public GPUTask
                 data.Index16bit = mesh.Use16BitIndexBuffer() ? 1 : 0;
                 data.VertexStride = vb->GetStride();
                 data.TriangleCount = mesh.GetTriangleCount();
-                const uint32 groups = Math::CeilToInt((float)data.TriangleCount / ThreadGroupSize);
-                if (groups > GPU_MAX_CS_DISPATCH_THREAD_GROUPS)
-                {
-                    // TODO: support larger meshes via 2D dispatch
-                    LOG(Error, "Not supported mesh with {} triangles.", data.TriangleCount);
-                    continue;
-                }
+                const Int3 triangleGroups = GetTriangleGroups(data);
                 context->UpdateCB(cb, &data);
                 if (!EnumHasAllFlags(vb->GetDescription().Flags, GPUBufferFlags::RawBuffer | GPUBufferFlags::ShaderResource))
                 {
@@ -232,7 +248,7 @@ class GPUModelSDFTask : public GPUTask
                 }
                 context->BindSR(0, vb->View());
                 context->BindSR(1, ib->View());
-                context->Dispatch(shader->GetCS("CS_RasterizeTriangle"), groups, 1, 1);
+                context->Dispatch(shader->GetCS("CS_RasterizeTriangle"), triangleGroups.X, triangleGroups.Y, 1);
             }
             SAFE_DELETE_GPU_RESOURCE(vbTemp);
             SAFE_DELETE_GPU_RESOURCE(ibTemp);
@@ -262,13 +278,7 @@ class GPUModelSDFTask : public GPUTask
                 data.Index16bit = 0;
                 data.VertexStride = sizeof(Float3);
                 data.TriangleCount = mesh->Indices.Count() / 3;
-                const uint32 groups = Math::CeilToInt((float)data.TriangleCount / ThreadGroupSize);
-                if (groups > GPU_MAX_CS_DISPATCH_THREAD_GROUPS)
-                {
-                    // TODO: support larger meshes via 2D dispatch
-                    LOG(Error, "Not supported mesh with {} triangles.", data.TriangleCount);
-                    continue;
-                }
+                const Int3 triangleGroups = GetTriangleGroups(data);
                 context->UpdateCB(cb, &data);
                 desc = GPUBufferDescription::Raw(mesh->Positions.Count() * sizeof(Float3), GPUBufferFlags::ShaderResource);
                 desc.InitData = mesh->Positions.Get();
@@ -280,7 +290,7 @@ class GPUModelSDFTask : public GPUTask
                 ib->Init(desc);
                 context->BindSR(0, vb->View());
                 context->BindSR(1, ib->View());
-                context->Dispatch(shader->GetCS("CS_RasterizeTriangle"), groups, 1, 1);
+                context->Dispatch(shader->GetCS("CS_RasterizeTriangle"), triangleGroups.X, triangleGroups.Y, 1);
             }
             SAFE_DELETE_GPU_RESOURCE(vb);
             SAFE_DELETE_GPU_RESOURCE(ib);
@@ -289,23 +299,40 @@ class GPUModelSDFTask : public GPUTask
         // Convert SDF volume data back to floats
         context->Dispatch(shader->GetCS("CS_Resolve"), threadGroups.X, threadGroups.Y, threadGroups.Z);
 
-        // Run linear flood-fill loop to populate all voxels with valid distances (spreads the initial values from triangles rasterization)
+        // Run jump flood to populate all voxels with valid distances (spreads the closest voxels from triangles rasterization in log2(resolution) steps)
         {
-            PROFILE_GPU_CPU_NAMED("FloodFill");
-            auto csFloodFill = shader->GetCS("CS_FloodFill");
-            const int32 floodFillIterations = Math::Max(_resolution.MaxValue() / 2 + 1, 8);
-            for (int32 floodFill = 0; floodFill < floodFillIterations; floodFill++)
+            PROFILE_GPU_CPU_NAMED("JumpFlood");
+            context->ResetUA();
+            context->BindSR(0, _sdfSrc->View());
+            context->BindUA(0, _sdfDst->View());
+            context->Dispatch(shader->GetCS("CS_JumpFloodInit"), threadGroups.X, threadGroups.Y, threadGroups.Z);
+            auto csJumpFlood = shader->GetCS("CS_JumpFlood");
+            GPUBuffer** seedsSrc = &_sdfDst;
+            GPUBuffer** seedsDst = &_sdfSeeds;
+            for (int32 step = Math::RoundUpToPowerOf2(_resolution.MaxValue()) / 2; step >= 1; step /= 2)
             {
-                context->ResetUA();
-                context->BindUA(0, _sdfDst->View());
-                context->BindSR(0, _sdfSrc->View());
-                context->Dispatch(csFloodFill, threadGroups.X, threadGroups.Y, threadGroups.Z);
-                Swap(_sdfSrc, _sdfDst);
+                // Additional final pass with a single voxel step fixes most of the jump flood errors
+                for (int32 pass = 0; pass < (step == 1 ? 2 : 1); pass++)
+                {
+                    data.JumpStep = step;
+                    context->UpdateCB(cb, &data);
+                    context->ResetUA();
+                    context->BindSR(1, (*seedsSrc)->View());
+                    context->BindUA(0, (*seedsDst)->View());
+                    context->Dispatch(csJumpFlood, threadGroups.X, threadGroups.Y, threadGroups.Z);
+                    Swap(seedsSrc, seedsDst);
+                }
             }
+            context->ResetUA();
+            context->BindSR(1, (*seedsSrc)->View());
+            context->BindUA(0, (*seedsDst)->View());
+            context->Dispatch(shader->GetCS("CS_JumpFloodResolve"), threadGroups.X, threadGroups.Y, threadGroups.Z);
+            Swap(_sdfSrc, *seedsDst);
         }
 
         // Encode SDF values into output storage
         context->ResetUA();
+        context->ResetSR();
         context->BindSR(0, _sdfSrc->View());
         // TODO: update GPU SDF texture within this task to skip additional CPU->GPU copy
         auto sdfTextureDesc = GPUTextureDescription::New3D(_resolution.X, _resolution.Y, _resolution.Z, PixelFormat::R16_UNorm, GPUTextureFlags::UnorderedAccess | GPUTextureFlags::RenderTarget);
@@ -556,7 +583,7 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
                 }
             }
         };
-        JobSystem::Execute(sdfJob, resolution.Z);
+        JobSystem::Execute(sdfJob, resolution.Z, JobPriority::Background);
     }
 
     // Cache SDF data on a CPU
@@ -620,7 +647,7 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
                 }
             }
         };
-        JobSystem::Execute(mipJob, resolutionMip.Z);
+        JobSystem::Execute(mipJob, resolutionMip.Z, JobPriority::Background);
 
         // Cache SDF data on a CPU
         if (outputStream)
@@ -687,6 +714,7 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(SamplingRate);
     SERIALIZE(SkipEmptyCurves);
     SERIALIZE(OptimizeKeyframes);
+    SERIALIZE(KeyframesReductionError);
     SERIALIZE(ImportScaleTracks);
     SERIALIZE(RootMotion);
     SERIALIZE(RootMotionFlags);
@@ -705,6 +733,7 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(SkipExistingMaterialsOnReimport);
     SERIALIZE(GenerateSDF);
     SERIALIZE(SDFResolution);
+    SERIALIZE(GenerateMeshlets);
     SERIALIZE(SplitObjects);
     SERIALIZE(ObjectIndex);
     SERIALIZE(SubAssetFolder);
@@ -738,6 +767,7 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(SamplingRate);
     DESERIALIZE(SkipEmptyCurves);
     DESERIALIZE(OptimizeKeyframes);
+    DESERIALIZE(KeyframesReductionError);
     DESERIALIZE(ImportScaleTracks);
     DESERIALIZE(RootMotion);
     DESERIALIZE(RootMotionFlags);
@@ -756,6 +786,7 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(SkipExistingMaterialsOnReimport);
     DESERIALIZE(GenerateSDF);
     DESERIALIZE(SDFResolution);
+    DESERIALIZE(GenerateMeshlets);
     DESERIALIZE(SplitObjects);
     DESERIALIZE(ObjectIndex);
     DESERIALIZE(SubAssetFolder);
@@ -1042,6 +1073,86 @@ void OptimizeCurve(LinearCurve<T>& curve)
     }
 }
 
+// The maximum amount of keyframes removed in a row by the error-bounded reduction (limits the reduction cost on the long tracks)
+#define KEYFRAMES_REDUCTION_MAX_SPAN 256
+
+// The minimum distance to the child nodes used to measure the rotation and scale errors (eg. for the leaf nodes)
+#define KEYFRAMES_REDUCTION_MIN_EXTENT 10.0f
+
+FORCE_INLINE float GetKeyframeError(const Float3& a, const Float3& b, float scale)
+{
+    return Float3::Distance(a, b) * scale;
+}
+
+FORCE_INLINE float GetKeyframeError(const Quaternion& a, const Quaternion& b, float scale)
+{
+    // Rotation by the angle moves the child nodes by the arc length
+    const float dot = Math::Min(Math::Abs(Quaternion::Dot(a, b)), 1.0f);
+    return 2.0f * Math::Acos(dot) * scale;
+}
+
+template<typename T>
+void ReduceCurve(LinearCurve<T>& curve, float maxError, float errorScale)
+{
+    auto& keyframes = curve.GetKeyframes();
+    const int32 keyCount = keyframes.Count();
+    if (keyCount < 3)
+        return;
+    typename LinearCurve<T>::KeyFrameCollection newKeyframes(keyCount);
+
+    // Remove the keyframes that can be interpolated from the last kept keyframe and the next one within the error
+    int32 anchor = 0;
+    newKeyframes.Add(keyframes[0]);
+    for (int32 i = 2; i < keyCount; i++)
+    {
+        const auto& a = keyframes[anchor];
+        const auto& b = keyframes[i];
+        const float length = b.Time - a.Time;
+        bool valid = i - anchor <= KEYFRAMES_REDUCTION_MAX_SPAN && length > ZeroTolerance;
+        for (int32 j = anchor + 1; j < i && valid; j++)
+        {
+            T value;
+            AnimationUtils::Interpolate(a.Value, b.Value, (keyframes[j].Time - a.Time) / length, value);
+            valid = GetKeyframeError(value, keyframes[j].Value, errorScale) <= maxError;
+        }
+        if (!valid)
+        {
+            anchor = i - 1;
+            newKeyframes.Add(keyframes[anchor]);
+        }
+    }
+    newKeyframes.Add(keyframes[keyCount - 1]);
+
+    // Collapse the constant tracks into a single keyframe
+    if (newKeyframes.Count() == 2 && GetKeyframeError(newKeyframes[0].Value, newKeyframes[1].Value, errorScale) <= maxError)
+        newKeyframes.RemoveAt(1);
+
+    if (keyCount != newKeyframes.Count())
+        curve.SetKeyframes(newKeyframes);
+}
+
+void CalculateNodesExtents(const SkeletonData& skeleton, Array<float>& extents)
+{
+    // Calculate the distance from each node to its farthest child node in the bind pose (rotation and scale errors of the node get scaled by it)
+    const int32 nodesCount = skeleton.Nodes.Count();
+    Array<Vector3> positions;
+    positions.Resize(nodesCount);
+    for (int32 nodeIndex = 0; nodeIndex < nodesCount; nodeIndex++)
+    {
+        Transform transform = skeleton.Nodes[nodeIndex].LocalTransform;
+        for (int32 parentIndex = skeleton.Nodes[nodeIndex].ParentIndex; parentIndex != -1; parentIndex = skeleton.Nodes[parentIndex].ParentIndex)
+            transform = skeleton.Nodes[parentIndex].LocalTransform.LocalToWorld(transform);
+        positions[nodeIndex] = transform.Translation;
+    }
+    extents.Resize(nodesCount);
+    extents.SetAll(KEYFRAMES_REDUCTION_MIN_EXTENT);
+    for (int32 nodeIndex = 0; nodeIndex < nodesCount; nodeIndex++)
+    {
+        for (int32 parentIndex = skeleton.Nodes[nodeIndex].ParentIndex; parentIndex != -1; parentIndex = skeleton.Nodes[parentIndex].ParentIndex)
+            extents[parentIndex] = Math::Max(extents[parentIndex], (float)Vector3::Distance(positions[nodeIndex], positions[parentIndex]));
+    }
+}
+
 void* MeshOptAllocate(size_t size)
 {
     return Allocator::Allocate(size);
@@ -1052,6 +1163,59 @@ void MeshOptDeallocate(void* ptr)
     Allocator::Free(ptr);
 }
 
+bool ModelTool::GenerateMeshlets(const MeshData& mesh, MeshletsData& result)
+{
+    PROFILE_CPU();
+    result.Meshlets.Clear();
+    result.Vertices.Clear();
+    result.Triangles.Clear();
+    const int32 indexCount = mesh.Indices.Count();
+    const int32 vertexCount = mesh.Positions.Count();
+    if (indexCount < 3 || vertexCount == 0)
+        return true;
+
+    // Limits match the common mesh shaders hardware (64 vertices and 124 triangles fit into the primitive output limits)
+    constexpr size_t maxVertices = 64;
+    constexpr size_t maxTriangles = 124;
+    constexpr float coneWeight = 0.25f;
+    meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+    const size_t maxMeshlets = meshopt_buildMeshletsBound(indexCount, maxVertices, maxTriangles);
+    Array<meshopt_Meshlet> meshlets;
+    meshlets.Resize((int32)maxMeshlets);
+    result.Vertices.Resize((int32)(maxMeshlets * maxVertices));
+    result.Triangles.Resize((int32)(maxMeshlets * maxTriangles * 3));
+    const float* positions = (const float*)mesh.Positions.Get();
+    const int32 meshletsCount = (int32)meshopt_buildMeshlets(meshlets.Get(), result.Vertices.Get(), result.Triangles.Get(), mesh.Indices.Get(), indexCount, positions, vertexCount, sizeof(Float3), maxVertices, maxTriangles, coneWeight);
+    if (meshletsCount <= 0)
+    {
+        result.Vertices.Clear();
+        result.Triangles.Clear();
+        return true;
+    }
+
+    // Trim the data and compute the meshlets bounds
+    const meshopt_Meshlet& last = meshlets[meshletsCount - 1];
+    result.Vertices.Resize((int32)(last.vertex_offset + last.vertex_count));
+    result.Triangles.Resize((int32)(last.triangle_offset + last.triangle_count * 3));
+    result.Meshlets.Resize(meshletsCount);
+    for (int32 i = 0; i < meshletsCount; i++)
+    {
+        const meshopt_Meshlet& src = meshlets[i];
+        const meshopt_Bounds bounds = meshopt_computeMeshletBounds(&result.Vertices[src.vertex_offset], &result.Triangles[src.triangle_offset], src.triangle_count, positions, vertexCount, sizeof(Float3));
+        Meshlet& dst = result.Meshlets[i];
+        dst.VertexOffset = src.vertex_offset;
+        dst.TriangleOffset = src.triangle_offset;
+        dst.VertexCount = src.vertex_count;
+        dst.TriangleCount = src.triangle_count;
+        dst.Center = Float3(bounds.center);
+        dst.Radius = bounds.radius;
+        dst.ConeApex = Float3(bounds.cone_apex);
+        dst.ConeAxis = Float3(bounds.cone_axis);
+        dst.ConeCutoff = bounds.cone_cutoff;
+    }
+    return false;
+}
+
 void TrySetupMaterialParameter(MaterialInstance* instance, Span<const Char*> paramNames, const Variant& value, MaterialParameterType type)
 {
     for (const Char* name : paramNames)
@@ -1864,10 +2028,23 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
             if (options.OptimizeKeyframes)
             {
                 const int32 before = animation.GetKeyframesCount();
+                Array<float> nodesExtents;
+                if (options.KeyframesReductionError > 0.0f)
+                    CalculateNodesExtents(data.Skeleton, nodesExtents);
                 for (int32 i = 0; i < animation.Channels.Count(); i++)
                 {
                     auto& anim = animation.Channels[i];
 
+                    // Remove keyframes within the error bounds
+                    if (options.KeyframesReductionError > 0.0f)
+                    {
+                        const int32 nodeIndex = data.Skeleton.FindNode(anim.NodeName);
+                        const float extent = nodeIndex != -1 ? nodesExtents[nodeIndex] : KEYFRAMES_REDUCTION_MIN_EXTENT;
+                        ReduceCurve(anim.Position, options.KeyframesReductionError, 1.0f);
+                        ReduceCurve(anim.Rotation, options.KeyframesReductionError, extent);
+                        ReduceCurve(anim.Scale, options.KeyframesReductionError, extent);
+                    }
+
                     // Optimize keyframes
                     OptimizeCurve(anim.Position);
                     OptimizeCurve(anim.Rotation);
@@ -1976,17 +2153,21 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
             baseLodTriangleCount += mesh->Indices.Count() / 3;
             baseLodVertexCount += mesh->Positions.Count();
         }
-        Array<unsigned int> indices;
+        int64 generatedLodCounter = 0;
         for (int32 lodIndex = Math::Clamp(baseLOD + 1, 1, lodCount - 1); lodIndex < lodCount; lodIndex++)
         {
             auto& dstLod = data.LODs[lodIndex];
             const auto& srcLod = data.LODs[lodIndex - 1];
 
-            int32 lodTriangleCount = 0, lodVertexCount = 0;
+            // Each LOD is simplified from the previous one but the meshes within a single LOD are independent so process them on job system
+            int64 lodTriangleCounter = 0, lodVertexCounter = 0;
             dstLod.Meshes.Resize(srcLod.Meshes.Count());
             for (int32 meshIndex = 0; meshIndex < dstLod.Meshes.Count(); meshIndex++)
+                dstLod.Meshes[meshIndex] = New<MeshData>();
+            Function<void(int32)> lodJob = [&dstLod, &srcLod, &options, triangleReduction, &lodTriangleCounter, &lodVertexCounter, &generatedLodCounter](int32 meshIndex)
             {
-                auto& dstMesh = dstLod.Meshes[meshIndex] = New<MeshData>();
+                PROFILE_CPU_NAMED("GenerateLOD");
+                auto& dstMesh = dstLod.Meshes[meshIndex];
                 const auto& srcMesh = srcLod.Meshes[meshIndex];
 
                 // Setup mesh
@@ -1999,8 +2180,8 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
                 int32 srcMeshVertexCount = srcMesh->Positions.Count();
                 int32 dstMeshIndexCountTarget = int32(srcMeshIndexCount * triangleReduction) / 3 * 3;
                 if (dstMeshIndexCountTarget < 3 || dstMeshIndexCountTarget >= srcMeshIndexCount)
-                    continue;
-                indices.Clear();
+                    return;
+                Array<unsigned int> indices;
                 indices.Resize(srcMeshIndexCount);
                 int32 dstMeshIndexCount = {};
                 if (options.SloppyOptimization)
@@ -2008,7 +2189,7 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
                 else
                     dstMeshIndexCount = (int32)meshopt_simplify(indices.Get(), srcMesh->Indices.Get(), srcMeshIndexCount, (const float*)srcMesh->Positions.Get(), srcMeshVertexCount, sizeof(Float3), dstMeshIndexCountTarget, options.LODTargetError);
                 if (dstMeshIndexCount <= 0 || dstMeshIndexCount > indices.Count())
-                    continue;
+                    return;
                 indices.Resize(dstMeshIndexCount);
 
                 // Generate simplified vertex buffer remapping table (use only vertices from LOD index buffer)
@@ -2071,10 +2252,12 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
                 meshopt_optimizeVertexCache(dstMesh->Indices.Get(), dstMesh->Indices.Get(), dstMeshIndexCount, dstMeshVertexCount);
                 meshopt_optimizeOverdraw(dstMesh->Indices.Get(), dstMesh->Indices.Get(), dstMeshIndexCount, (const float*)dstMesh->Positions.Get(), dstMeshVertexCount, sizeof(Float3), 1.05f);
 
-                lodTriangleCount += dstMeshIndexCount / 3;
-                lodVertexCount += dstMeshVertexCount;
-                generatedLod++;
-            }
+                Platform::InterlockedAdd(&lodTriangleCounter, dstMeshIndexCount / 3);
+                Platform::InterlockedAdd(&lodVertexCounter, dstMeshVertexCount);
+                Platform::InterlockedIncrement(&generatedLodCounter);
+            };
+            JobSystem::Execute(lodJob, dstLod.Meshes.Count(), JobPriority::Background);
+            const int32 lodTriangleCount = (int32)lodTriangleCounter, lodVertexCount = (int32)lodVertexCounter;
 
             // Remove empty meshes (no LOD was generated for them)
             for (int32 i = dstLod.Meshes.Count() - 1; i >= 0; i--)
@@ -2099,6 +2282,7 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
             else
                 break;
         }
+        generatedLod = (int32)generatedLodCounter;
         if (generatedLod)
         {
             auto lodEndTime = DateTime::NowUTC();
@@ -101,6 +101,13 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
     static bool GenerateModelSDF(class Model* inputModel, class ModelData* modelData, float resolutionScale, int32 lodIndex, ModelBase::SDFData* outputSDF, class MemoryWriteStream* outputStream, const StringView& assetName, float backfacesThreshold = 0.6f, bool useGPU = true);
 
 #if USE_EDITOR
+    /// <summary>
+    /// Splits the mesh geometry into meshlets (clusters of triangles) and computes their culling bounds. Uses the meshoptimizer library.
+    /// </summary>
+    /// <param name="mesh">The mesh data (with index buffer).</param>
+    /// <param name="result">The output meshlets data.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool GenerateMeshlets(const MeshData& mesh, struct MeshletsData& result);
 
 public:
     /// <summary>
@@ -239,6 +246,9 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // The imported animation channels will be optimized to remove redundant keyframes.
         API_FIELD(Attributes="EditorOrder(1050), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation))")
         bool OptimizeKeyframes = true;
+        // The maximum error (in units, measured in the skeleton space at the node and its child nodes) allowed when removing the animation keyframes that can be interpolated from the neighbours. Use 0 to remove only the redundant keyframes.
+        API_FIELD(Attributes="EditorOrder(1051), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowKeyframesReduction)), Limit(0, 10, 0.001f)")
+        float KeyframesReductionError = 0.1f;
         // If checked, the importer will import scale animation tracks (otherwise scale animation will be ignored).
         API_FIELD(Attributes="EditorOrder(1055), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation))")
         bool ImportScaleTracks = false;
@@ -303,6 +313,12 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         API_FIELD(Attributes="EditorOrder(1510), EditorDisplay(\"SDF\"), VisibleIf(nameof(ShowModel)), Limit(0.0001f, 100.0f)")
         float SDFResolution = 1.0f;
 
+    public: // Meshlets
+
+        // If checked, enables generation of meshlets (clusters of up to 124 triangles with bounding spheres and normal cones) for every mesh. Can be used by the renderer for the per-cluster culling of the high-poly meshes.
+        API_FIELD(Attributes="EditorOrder(1600), EditorDisplay(\"Meshlets\"), VisibleIf(nameof(ShowModel))")
+        bool GenerateMeshlets = false;
+
     public: // Splitting
 
         // If checked, the imported mesh/animations are split into separate assets. Used if ObjectIndex is set to -1.
@@ -83,6 +83,16 @@ namespace
         }
     }
 
+    DirectX::TEX_COMPRESS_FLAGS GetCompressFlags()
+    {
+        DirectX::TEX_COMPRESS_FLAGS flags = DirectX::TEX_COMPRESS_DEFAULT | DirectX::TEX_COMPRESS_PARALLEL;
+#if USE_EDITOR
+        if (TextureTool::CompressionQuality == TextureCompressionQuality::Fast)
+            flags |= DirectX::TEX_COMPRESS_BC7_QUICK;
+#endif
+        return flags;
+    }
+
     HRESULT Compress(const DirectX::Image* srcImages, size_t nimages, const DirectX::TexMetadata& metadata, DXGI_FORMAT format, DirectX::TEX_COMPRESS_FLAGS compress, float threshold, DirectX::ScratchImage& cImages)
     {
 #if USE_EDITOR
@@ -942,7 +952,7 @@ bool TextureTool::ImportTextureDirectXTex(ImageType type, const StringView& path
         auto& tmpImg = GET_TMP_IMG();
 
         if (DirectX::IsCompressed(targetDxgiFormat))
-            result = ::Compress(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), targetDxgiFormat, DirectX::TEX_COMPRESS_DEFAULT | DirectX::TEX_COMPRESS_PARALLEL, alphaThreshold, tmpImg);
+            result = ::Compress(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), targetDxgiFormat, GetCompressFlags(), alphaThreshold, tmpImg);
         else
             result = DirectX::Convert(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), targetDxgiFormat, DirectX::TEX_FILTER_DEFAULT, alphaThreshold, tmpImg);
         if (FAILED(result))
@@ -1078,7 +1088,7 @@ bool TextureTool::ConvertDirectXTex(TextureData& dst, const TextureData& src, co
     DirectX::ScratchImage* outImage = &dstImage;
     if (DirectX::IsCompressed(dstFormatDxgi))
     {
-        result = ::Compress(inImage->GetImages(), inImage->GetImageCount(), inImage->GetMetadata(), dstFormatDxgi, DirectX::TEX_COMPRESS_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, dstImage);
+        result = ::Compress(inImage->GetImages(), inImage->GetImageCount(), inImage->GetMetadata(), dstFormatDxgi, GetCompressFlags(), DirectX::TEX_THRESHOLD_DEFAULT, dstImage);
         if (FAILED(result))
         {
             LOG(Warning, "Cannot compress image. Error: {0:x}", static_cast<uint32>(result));
@@ -23,6 +23,8 @@ namespace
 {
     Dictionary<String, bool> TexturesHasAlphaCache;
 }
+
+TextureCompressionQuality TextureTool::CompressionQuality = TextureCompressionQuality::High;
 #endif
 
 String TextureTool::Options::ToString() const
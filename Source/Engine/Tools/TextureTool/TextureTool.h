@@ -11,6 +11,19 @@
 
 class JsonWriter;
 
+/// <summary>
+/// The quality preset of the texture block compression (eg. BC formats) done on CPU.
+/// </summary>
+API_ENUM(Namespace="FlaxEngine.Tools") enum class TextureCompressionQuality
+{
+    // The fastest compression with the lower quality. Useful for quick iterations and CI builds.
+    Fast,
+    // The balanced compression speed and quality.
+    Normal,
+    // The best quality compression (slowest).
+    High,
+};
+
 /// <summary>
 /// Textures importing, processing and exporting utilities.
 /// </summary>
@@ -128,6 +141,11 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API TextureTool
     /// <param name="path">The file path.</param>
     /// <returns>True if has alpha channel, otherwise false.</returns>
     static bool HasAlpha(const StringView& path);
+
+    /// <summary>
+    /// The quality preset of the texture compression used by import and cooking. Compression is performed in parallel on job system.
+    /// </summary>
+    API_FIELD() static TextureCompressionQuality CompressionQuality;
 #endif
 
     /// <summary>
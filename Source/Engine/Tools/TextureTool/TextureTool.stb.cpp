@@ -12,6 +12,8 @@
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Utilities/AnsiPathTempFile.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 #define STBI_ASSERT(x) ASSERT(x)
 #define STBI_MALLOC(sz) Allocator::Allocate(sz)
@@ -646,12 +648,39 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
             break;
         }
         bool isDstSRGB = PixelFormatExtensions::IsSRGB(dstFormat);
+        switch (dstFormat)
+        {
+        case PixelFormat::BC1_UNorm:
+        case PixelFormat::BC1_UNorm_sRGB:
+        case PixelFormat::BC3_UNorm:
+        case PixelFormat::BC3_UNorm_sRGB:
+        case PixelFormat::BC4_UNorm:
+        case PixelFormat::BC5_UNorm:
+        case PixelFormat::BC7_UNorm:
+        case PixelFormat::BC7_UNorm_sRGB:
+            break;
+        default:
+            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
+            return true;
+        }
 
-        // bc7enc init
+        // Setup compression quality
+        const TextureCompressionQuality quality = TextureTool::CompressionQuality;
+        const int32 stbMode = quality == TextureCompressionQuality::Fast ? STB_DXT_NORMAL : STB_DXT_HIGHQUAL;
         bc7enc16_compress_block_params params;
         if (dstFormat == PixelFormat::BC7_UNorm || dstFormat == PixelFormat::BC7_UNorm_sRGB)
         {
             bc7enc16_compress_block_params_init(&params);
+            switch (quality)
+            {
+            case TextureCompressionQuality::Fast:
+                params.m_max_partitions_mode1 = 16;
+                params.m_try_least_squares = BC7ENC16_FALSE;
+                break;
+            case TextureCompressionQuality::High:
+                params.m_uber_level = 1;
+                break;
+            }
             bc7enc16_compress_block_init();
         }
 
@@ -679,56 +708,58 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
                 dstMip.Lines = blocksHeight;
                 dstMip.Data.Allocate(dstMip.DepthPitch);
 
-                // Compress texture
-                for (int32 yBlock = 0; yBlock < blocksHeight; yBlock++)
+                // Compress texture (blocks are independent so rows of blocks are processed in parallel)
+                Function<void(int32, int32)> compressJob = [&](int32 yBlockStart, int32 yBlockEnd)
                 {
-                    for (int32 xBlock = 0; xBlock < blocksWidth; xBlock++)
+                    PROFILE_CPU_NAMED("CompressBlocks");
+                    for (int32 yBlock = yBlockStart; yBlock < yBlockEnd; yBlock++)
                     {
-                        // Sample source texture 4x4 block
-                        Color32 srcBlock[16];
-                        for (int32 y = 0; y < 4; y++)
+                        for (int32 xBlock = 0; xBlock < blocksWidth; xBlock++)
                         {
-                            for (int32 x = 0; x < 4; x++)
+                            // Sample source texture 4x4 block
+                            Color32 srcBlock[16];
+                            for (int32 y = 0; y < 4; y++)
                             {
-                                Color color = TextureTool::SamplePoint(sampler, xBlock * 4 + x, yBlock * 4 + y, srcMip.Data.Get(), srcMip.RowPitch);
-                                if (isDstSRGB)
-                                    color = Color::LinearToSrgb(color);
-                                srcBlock[y * 4 + x] = Color32(color);
+                                for (int32 x = 0; x < 4; x++)
+                                {
+                                    Color color = TextureTool::SamplePoint(sampler, xBlock * 4 + x, yBlock * 4 + y, srcMip.Data.Get(), srcMip.RowPitch);
+                                    if (isDstSRGB)
+                                        color = Color::LinearToSrgb(color);
+                                    srcBlock[y * 4 + x] = Color32(color);
+                                }
                             }
-                        }
 
-                        // Compress block
-                        byte* dstBlock = dstMip.Data.Get() + (yBlock * blocksWidth + xBlock) * bytesPerBlock;
-                        switch (dstFormat)
-                        {
-                        case PixelFormat::BC1_UNorm:
-                        case PixelFormat::BC1_UNorm_sRGB:
-                            stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 0, STB_DXT_HIGHQUAL);
-                            break;
-                        case PixelFormat::BC3_UNorm:
-                        case PixelFormat::BC3_UNorm_sRGB:
-                            stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 1, STB_DXT_HIGHQUAL);
-                            break;
-                        case PixelFormat::BC4_UNorm:
-                            for (int32 i = 1; i < 16; i++)
-                                ((byte*)&srcBlock)[i] = srcBlock[i].R;
-                            stb_compress_bc4_block(dstBlock, (byte*)&srcBlock);
-                            break;
-                        case PixelFormat::BC5_UNorm:
-                            for (int32 i = 0; i < 16; i++)
-                                ((uint16*)&srcBlock)[i] = srcBlock[i].R << 8 | srcBlock[i].G;
-                            stb_compress_bc5_block(dstBlock, (byte*)&srcBlock);
-                            break;
-                        case PixelFormat::BC7_UNorm:
-                        case PixelFormat::BC7_UNorm_sRGB:
-                            bc7enc16_compress_block(dstBlock, &srcBlock, &params);
-                            break;
-                        default:
-                            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
-                            return true;
+                            // Compress block
+                            byte* dstBlock = dstMip.Data.Get() + (yBlock * blocksWidth + xBlock) * bytesPerBlock;
+                            switch (dstFormat)
+                            {
+                            case PixelFormat::BC1_UNorm:
+                            case PixelFormat::BC1_UNorm_sRGB:
+                                stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 0, stbMode);
+                                break;
+                            case PixelFormat::BC3_UNorm:
+                            case PixelFormat::BC3_UNorm_sRGB:
+                                stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 1, stbMode);
+                                break;
+                            case PixelFormat::BC4_UNorm:
+                                for (int32 i = 1; i < 16; i++)
+                                    ((byte*)&srcBlock)[i] = srcBlock[i].R;
+                                stb_compress_bc4_block(dstBlock, (byte*)&srcBlock);
+                                break;
+                            case PixelFormat::BC5_UNorm:
+                                for (int32 i = 0; i < 16; i++)
+                                    ((uint16*)&srcBlock)[i] = srcBlock[i].R << 8 | srcBlock[i].G;
+                                stb_compress_bc5_block(dstBlock, (byte*)&srcBlock);
+                                break;
+                            case PixelFormat::BC7_UNorm:
+                            case PixelFormat::BC7_UNorm_sRGB:
+                                bc7enc16_compress_block(dstBlock, &srcBlock, &params);
+                                break;
+                            }
                         }
                     }
-                }
+                };
+                JobSystem::ParallelFor(0, blocksHeight, Math::Max(1024 / blocksWidth, 1), compressJob);
             }
         }
     }
@@ -69,6 +69,7 @@ public CheckBoxState State
                 if (_state != value)
                 {
                     _state = value;
+                    InvalidateDraw();
 
                     StateChanged?.Invoke(this);
                 }
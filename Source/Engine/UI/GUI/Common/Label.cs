@@ -59,6 +59,7 @@ public LocalizedString Text
             set
             {
                 _text = value;
+                InvalidateDraw();
                 if (_autoWidth || _autoHeight || _autoFitText)
                 {
                     _textSize = Float2.Zero;
@@ -120,6 +120,7 @@ public float Value
 
                 // Update
                 UpdateThumb();
+                InvalidateDraw();
                 ValueChanged?.Invoke();
             }
         }
@@ -29,8 +29,16 @@ public class ContainerControl : Control
         [NoSerialize]
         protected bool _isLayoutLocked;
 
+        /// <summary>
+        /// The cached rendering invalidation flag (see <see cref="CacheRendering"/>).
+        /// </summary>
+        [NoSerialize]
+        internal bool _isDrawDirty = true;
+
         private bool _clipChildren = true;
         private bool _cullChildren = true;
+        private bool _cacheRendering;
+        private Render2DCommandList _renderingCache;
 
         /// <summary>
         /// Initializes a new instance of the <see cref="ContainerControl"/> class.
@@ -115,6 +123,25 @@ public bool CullChildren
             set => _cullChildren = value;
         }
 
+        /// <summary>
+        /// Gets or sets a value indicating whether cache the rendering of the control and its children. Recorded drawing commands are replayed until any of the contained controls gets invalidated (eg. via layout, transform, visibility or <see cref="Control.InvalidateDraw"/>) which makes static UI panels almost free to draw.
+        /// </summary>
+        /// <remarks>The cache is not used when the control contains focus, is under the mouse/touch or drag and drop, so the interactive parts stay up to date. Custom controls that change their visuals in other ways should call <see cref="Control.InvalidateDraw"/>.</remarks>
+        [EditorOrder(550), Tooltip("If checked, control will cache its rendering and draw it again only when its contents get modified. Improves performance of the static UI.")]
+        public bool CacheRendering
+        {
+            get => _cacheRendering;
+            set
+            {
+                if (_cacheRendering == value)
+                    return;
+                _cacheRendering = value;
+                _isDrawDirty = true;
+                if (!value)
+                    Object.Destroy(ref _renderingCache);
+            }
+        }
+
         /// <summary>
         /// Locks all child controls layout and itself.
         /// </summary>
@@ -420,6 +447,8 @@ public virtual void OnChildResized(Control control)
         [NoAnimate]
         public virtual void OnChildrenChanged()
         {
+            InvalidateDraw();
+
             // Check if control isn't during disposing state
             if (!IsDisposing)
             {
@@ -741,6 +770,7 @@ public override void OnDestroy()
                 _children[i].OnDestroy();
             }
             _children.Clear();
+            Object.Destroy(ref _renderingCache);
         }
 
         /// <inheritdoc />
@@ -792,6 +822,27 @@ public override void ClearState()
         /// Draw the control and the children.
         /// </summary>
         public override void Draw()
+        {
+            if (_cacheRendering && !_containsFocus && !IsMouseOver && !IsTouchOver && !IsDragOver)
+            {
+                // Replay the cached drawing commands or record them again when contents were modified (or the rendering state changed)
+                if (_renderingCache == null)
+                    _renderingCache = new Render2DCommandList();
+                else if (!_isDrawDirty && !Render2D.Replay(_renderingCache))
+                    return;
+                Render2D.BeginRecording(_renderingCache);
+                DrawContents();
+                Render2D.EndRecording(_renderingCache);
+                _isDrawDirty = false;
+                return;
+            }
+
+            // Interactive contents are drawn as-is so the cache has to be recorded again later
+            _isDrawDirty = true;
+            DrawContents();
+        }
+
+        private void DrawContents()
         {
             DrawSelf();
 
@@ -861,6 +912,7 @@ protected virtual void DrawChildren()
         /// <inheritdoc />
         public override void PerformLayout(bool force = false)
         {
+            InvalidateDraw();
             if (_isLayoutLocked && !force)
                 return;
 
@@ -172,7 +172,11 @@ public int IndexInParent
         public Color BackgroundColor
         {
             get => _backgroundColor;
-            set => _backgroundColor = value;
+            set
+            {
+                _backgroundColor = value;
+                InvalidateDraw();
+            }
         }
 
         /// <summary>
@@ -185,6 +189,7 @@ public IBrush BackgroundBrush
             set
             {
                 _backgroundBrush = value;
+                InvalidateDraw();
 
 #if FLAX_EDITOR
                 // Auto-reset background color so brush is visible as it uses it for tint
@@ -238,6 +243,7 @@ public bool Enabled
                     _isEnabled = value;
                     if (!_isEnabled)
                         ClearState();
+                    InvalidateDraw();
                 }
             }
         }
@@ -271,6 +277,7 @@ public bool Visible
                     _isVisible = value;
                     if (!_isVisible)
                         ClearState();
+                    InvalidateDraw();
 
                     OnVisibleChanged();
                     _parent?.PerformLayout();
@@ -456,6 +463,20 @@ public virtual void PerformLayout(bool force = false)
         {
         }
 
+        /// <summary>
+        /// Invalidates the cached rendering of the parent controls (see <see cref="ContainerControl.CacheRendering"/>). Should be called when control visuals get modified outside the layout or input events (eg. text or color change from the game code).
+        /// </summary>
+        [NoAnimate]
+        public void InvalidateDraw()
+        {
+            var container = this as ContainerControl ?? _parent;
+            while (container != null)
+            {
+                container._isDrawDirty = true;
+                container = container.Parent;
+            }
+        }
+
         /// <summary>
         /// Called to clear UI state. For example, removes mouse over state or drag and drop when control gets disabled or hidden (including hierarchy).
         /// </summary>
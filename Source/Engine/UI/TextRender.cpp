@@ -256,7 +256,7 @@ void TextRender::UpdateLayout()
                     const float x = pointer.X + (float)entry.OffsetX * scale;
                     const float y = pointer.Y + (float)(font->GetHeight() + font->GetDescender() - entry.OffsetY) * scale;
 
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                    Rectangle charRect(x, y, entry.UVSize.X * entry.BitmapScale * scale, entry.UVSize.Y * entry.BitmapScale * scale);
                     charRect.Offset(_layoutOptions.Bounds.Location);
 
                     Float2 upperLeftUV = entry.UV * invAtlasSize;
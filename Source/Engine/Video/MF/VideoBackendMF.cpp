@@ -8,6 +8,10 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Audio/Types.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Platform/CriticalSection.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
@@ -23,6 +27,14 @@ typedef enum _MFVideoSphericalFormat { } MFVideoSphericalFormat;
 #include <mfapi.h>
 #include <mfidl.h>
 #include <mfreadwrite.h>
+#if PLATFORM_WINDOWS && WINVER >= _WIN32_WINNT_WIN8
+// Hardware decoding directly into D3D11 textures (DXVA) to skip frame data copies on CPU
+#define VIDEO_API_MF_DXVA 1
+#include <d3d11.h>
+#include <d3d10.h>
+#else
+#define VIDEO_API_MF_DXVA 0
+#endif
 
 #define VIDEO_API_MF_ERROR(api, err) LOG(Warning, "[VideoBackendMF] {} failed with error 0x{:x}", TEXT(#api), (uint64)err)
 
@@ -33,12 +45,52 @@ struct VideoPlayerMF
     uint8 Playing : 1;
     uint8 FirstFrame : 1;
     uint8 Seek : 1;
+    uint8 IsDXVA : 1;
     TimeSpan Time;
+    // The latest decoded video sample with the frame in the GPU memory (DXVA only)
+    IMFSample* FrameSample;
 };
 
 namespace MF
 {
     Array<VideoBackendPlayer*> Players;
+#if VIDEO_API_MF_DXVA
+    IMFDXGIDeviceManager* DeviceManager = nullptr;
+    CriticalSection FrameSampleLocker;
+
+    bool InitDeviceManager()
+    {
+        if (DeviceManager)
+            return false;
+        if (!GPUDevice::Instance || GPUDevice::Instance->GetRendererType() != RendererType::DirectX11)
+            return true;
+        auto device = (ID3D11Device*)GPUDevice::Instance->GetNativePtr();
+
+        // Decoder uses the device from its own threads
+        ID3D10Multithread* multithread = nullptr;
+        if (SUCCEEDED(device->QueryInterface(IID_PPV_ARGS(&multithread))))
+        {
+            multithread->SetMultithreadProtected(TRUE);
+            multithread->Release();
+        }
+
+        UINT resetToken = 0;
+        HRESULT hr = MFCreateDXGIDeviceManager(&resetToken, &DeviceManager);
+        if (FAILED(hr))
+        {
+            VIDEO_API_MF_ERROR(MFCreateDXGIDeviceManager, hr);
+            return true;
+        }
+        hr = DeviceManager->ResetDevice(device, resetToken);
+        if (FAILED(hr))
+        {
+            VIDEO_API_MF_ERROR(ResetDevice, hr);
+            SAFE_RELEASE(DeviceManager);
+            return true;
+        }
+        return false;
+    }
+#endif
 
     bool Configure(VideoBackendPlayer& player, VideoPlayerMF& playerMF, DWORD streamIndex)
     {
@@ -97,7 +149,29 @@ namespace MF
             {
                 player.FrameRate = (float)HI32(fpsValue) / (float)LO32(fpsValue);
             }
-            if (subtype == MFVideoFormat_RGB32)
+            if (playerMF.IsDXVA && subtype != MFVideoFormat_ARGB32)
+            {
+                // Convert decoded frames into BGRA texture on GPU with video processor
+                IMFMediaType* customType = nullptr;
+                hr = MFCreateMediaType(&customType);
+                if (FAILED(hr))
+                {
+                    VIDEO_API_MF_ERROR(MFCreateMediaType, hr);
+                    goto END;
+                }
+                customType->SetGUID(MF_MT_MAJOR_TYPE, majorType);
+                customType->SetGUID(MF_MT_SUBTYPE, MFVideoFormat_ARGB32);
+                MFSetAttributeSize(customType, MF_MT_FRAME_SIZE, width, height);
+                hr = playerMF.SourceReader->SetCurrentMediaType(streamIndex, nullptr, customType);
+                customType->Release();
+                if (FAILED(hr))
+                {
+                    VIDEO_API_MF_ERROR(SetCurrentMediaType, hr);
+                    goto END;
+                }
+                player.Format = PixelFormat::B8G8R8A8_UNorm;
+            }
+            else if (subtype == MFVideoFormat_RGB32)
                 player.Format = PixelFormat::B8G8R8X8_UNorm;
             else if (subtype == MFVideoFormat_ARGB32)
                 player.Format = PixelFormat::B8G8R8A8_UNorm;
@@ -257,6 +331,21 @@ namespace MF
             {
                 PROFILE_CPU_NAMED("ProcessSample");
 
+#if VIDEO_API_MF_DXVA
+                if (isVideo && playerMF.IsDXVA)
+                {
+                    // Keep the sample with decoded texture to copy it on GPU later
+                    FrameSampleLocker.Lock();
+                    if (playerMF.FrameSample)
+                        playerMF.FrameSample->Release();
+                    playerMF.FrameSample = sample;
+                    sample->AddRef();
+                    FrameSampleLocker.Unlock();
+                    player.UpdateVideoFrame(frameTime, franeDuration);
+                    goto PROCESS_SAMPLE_DONE;
+                }
+#endif
+
                 // Lock sample buffer memory (try to use 2D buffer for more direct memory access)
                 IMFMediaBuffer* buffer = nullptr;
                 IMF2DBuffer* buffer2D = nullptr;
@@ -337,6 +426,9 @@ namespace MF
             PROCESS_SAMPLE_END:
                 buffer->Release();
             }
+#if VIDEO_API_MF_DXVA
+        PROCESS_SAMPLE_DONE:
+#endif
             if (sample)
                 sample->Release();
             if (isGoodSample)
@@ -456,14 +548,26 @@ bool VideoBackendMF::Player_Create(const VideoBackendPlayerInfo& info, VideoBack
 
     // Load media
     IMFAttributes* attributes = nullptr;
-    HRESULT hr = MFCreateAttributes(&attributes, 1);
+    HRESULT hr = MFCreateAttributes(&attributes, 3);
     if (FAILED(hr))
     {
         VIDEO_API_MF_ERROR(MFCreateAttributes, hr);
         return true;
     }
     attributes->SetUINT32(MF_READWRITE_ENABLE_HARDWARE_TRANSFORMS, 1);
-    attributes->SetUINT32(MF_SOURCE_READER_ENABLE_VIDEO_PROCESSING, 1);
+#if VIDEO_API_MF_DXVA
+    if (!MF::InitDeviceManager())
+    {
+        // Decode video into GPU textures
+        attributes->SetUnknown(MF_SOURCE_READER_D3D_MANAGER, MF::DeviceManager);
+        attributes->SetUINT32(MF_SOURCE_READER_ENABLE_ADVANCED_VIDEO_PROCESSING, 1);
+        playerMF.IsDXVA = 1;
+    }
+    else
+#endif
+    {
+        attributes->SetUINT32(MF_SOURCE_READER_ENABLE_VIDEO_PROCESSING, 1);
+    }
     IMFSourceReader* sourceReader = nullptr;
     hr = MFCreateSourceReaderFromURL(*info.Url, attributes, &sourceReader);
     attributes->Release();
@@ -503,6 +607,11 @@ void VideoBackendMF::Player_Destroy(VideoBackendPlayer& player)
     PROFILE_CPU();
     player.ReleaseResources();
     auto& playerMF = player.GetBackendState<VideoPlayerMF>();
+#if VIDEO_API_MF_DXVA
+    MF::FrameSampleLocker.Lock();
+    SAFE_RELEASE(playerMF.FrameSample);
+    MF::FrameSampleLocker.Unlock();
+#endif
     playerMF.SourceReader->Release();
     MF::Players.Remove(&player);
     player = VideoBackendPlayer();
@@ -562,6 +671,51 @@ TimeSpan VideoBackendMF::Player_GetTime(const VideoBackendPlayer& player)
     return playerMF.Time;
 }
 
+bool VideoBackendMF::Player_CopyFrame(VideoBackendPlayer& player, GPUContext* context)
+{
+#if VIDEO_API_MF_DXVA
+    PROFILE_CPU();
+    auto& playerMF = player.GetBackendState<VideoPlayerMF>();
+    ScopeLock lock(MF::FrameSampleLocker);
+    IMFSample* sample = playerMF.FrameSample;
+    if (!sample)
+        return false;
+    playerMF.FrameSample = nullptr;
+    bool result = true;
+    IMFMediaBuffer* buffer = nullptr;
+    IMFDXGIBuffer* bufferDXGI = nullptr;
+    ID3D11Texture2D* texture = nullptr;
+    UINT subresource = 0;
+    HRESULT hr = sample->GetBufferByIndex(0, &buffer);
+    if (SUCCEEDED(hr))
+        hr = buffer->QueryInterface(IID_PPV_ARGS(&bufferDXGI));
+    if (SUCCEEDED(hr))
+        hr = bufferDXGI->GetResource(IID_PPV_ARGS(&texture));
+    if (SUCCEEDED(hr))
+        hr = bufferDXGI->GetSubresourceIndex(&subresource);
+    if (SUCCEEDED(hr))
+    {
+        // Copy the visible area of the decoded frame (decoder surfaces can be bigger due to macroblocks alignment)
+        auto contextDX11 = (ID3D11DeviceContext*)context->GetNativePtr();
+        auto frameDX11 = (ID3D11Resource*)player.Frame->GetNativePtr();
+        D3D11_BOX box = { 0, 0, 0, (UINT)player.Width, (UINT)player.Height, 1 };
+        contextDX11->CopySubresourceRegion(frameDX11, 0, 0, 0, 0, texture, subresource, &box);
+        result = false;
+    }
+    else
+    {
+        VIDEO_API_MF_ERROR(IMFDXGIBuffer, hr);
+    }
+    SAFE_RELEASE(texture);
+    SAFE_RELEASE(bufferDXGI);
+    SAFE_RELEASE(buffer);
+    sample->Release();
+    return result;
+#else
+    return true;
+#endif
+}
+
 const Char* VideoBackendMF::Base_Name()
 {
     return TEXT("Media Foundation");
@@ -603,6 +757,9 @@ void VideoBackendMF::Base_Dispose()
     PROFILE_CPU();
 
     // Shutdown
+#if VIDEO_API_MF_DXVA
+    SAFE_RELEASE(MF::DeviceManager);
+#endif
     MFShutdown();
 }
 
@@ -21,6 +21,7 @@ class VideoBackendMF : public VideoBackend
     void Player_Stop(VideoBackendPlayer& player) override;
     void Player_Seek(VideoBackendPlayer& player, TimeSpan time) override;
     TimeSpan Player_GetTime(const VideoBackendPlayer& player) override;
+    bool Player_CopyFrame(VideoBackendPlayer& player, GPUContext* context) override;
     const Char* Base_Name() override;
     bool Base_Init() override;
     void Base_Update(TaskGraph* graph) override;
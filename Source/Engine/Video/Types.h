@@ -17,6 +17,7 @@ struct VideoBackendPlayerInfo;
 class GPUTexture;
 class GPUBuffer;
 class GPUPipelineState;
+class GPUContext;
 
 /// <summary>
 /// Video player instance created by backend.
@@ -40,8 +41,13 @@ struct VideoBackendPlayer
     float AudioPan;
     float AudioMinDistance;
     float AudioAttenuation;
+    float Priority;
+    float FrameUpdateInterval;
+    double LastFrameUpdateTime;
+    double LastVisibleTime;
     uint8 IsAudioSpatial : 1;
     uint8 IsAudioPlayPending : 1;
+    uint8 IsVideoFrameNative : 1;
     TimeSpan Duration;
     TimeSpan VideoFrameTime, VideoFrameDuration;
     TimeSpan AudioBufferTime, AudioBufferDuration;
@@ -80,6 +86,7 @@ struct VideoBackendPlayer
     void StopAudio();
     void InitVideoFrame();
     void UpdateVideoFrame(Span<byte> data, TimeSpan time, TimeSpan duration);
+    void UpdateVideoFrame(TimeSpan time, TimeSpan duration);
     void UpdateAudioBuffer(Span<byte> data, TimeSpan time, TimeSpan duration);
     void Tick();
     void ReleaseResources();
@@ -19,6 +19,8 @@
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Scripting/Enums.h"
 #include "Engine/Threading/TaskGraph.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Core/Collections/Sorting.h"
 #if VIDEO_API_MF
 #include "MF/VideoBackendMF.h"
 #endif
@@ -38,6 +40,106 @@
 #include "Platforms/Switch/Engine/Video/VideoBackendSwitch.h"
 #endif
 
+// Time after the last usage of the video frame in rendering after which the player is considered not visible (in seconds)
+#define VIDEO_HIDDEN_TIMEOUT 1.0
+// Video frame update rate for players that are not visible
+#define VIDEO_HIDDEN_FRAME_RATE 1.0f
+// Video frame update rate for players that didn't fit into the upload budget
+#define VIDEO_THROTTLED_FRAME_RATE 5.0f
+// Maximum amount of released video frame buffers kept for reuse by other players
+#define VIDEO_FRAMES_POOL_SIZE 4
+
+namespace
+{
+    // Pool of frame buffers released by the players (eg. when video screens get recreated)
+    CriticalSection FramesPoolLocker;
+    BytesContainer FramesPoolMemory[VIDEO_FRAMES_POOL_SIZE];
+    GPUBuffer* FramesPoolUploads[VIDEO_FRAMES_POOL_SIZE] = {};
+
+    void AcquireFrameMemory(BytesContainer& memory, int32 size)
+    {
+        ScopeLock lock(FramesPoolLocker);
+        for (auto& e : FramesPoolMemory)
+        {
+            if (e.Length() >= size && e.Length() <= size * 2)
+            {
+                memory.Swap(e);
+                e.Release();
+                return;
+            }
+        }
+        memory.Allocate(size);
+    }
+
+    void ReleaseFrameMemory(BytesContainer& memory)
+    {
+        if (memory.IsInvalid())
+            return;
+        ScopeLock lock(FramesPoolLocker);
+        for (auto& e : FramesPoolMemory)
+        {
+            if (e.IsInvalid())
+            {
+                e.Swap(memory);
+                break;
+            }
+        }
+        memory.Release();
+    }
+
+    GPUBuffer* AcquireFrameUpload(const GPUBufferDescription& desc)
+    {
+        ScopeLock lock(FramesPoolLocker);
+        for (auto& e : FramesPoolUploads)
+        {
+            if (e && e->GetDescription() == desc)
+            {
+                auto result = e;
+                e = nullptr;
+                return result;
+            }
+        }
+        return GPUDevice::Instance->CreateBuffer(TEXT("VideoFrameUpload"));
+    }
+
+    void ReleaseFrameUpload(GPUBuffer*& buffer)
+    {
+        if (!buffer)
+            return;
+        ScopeLock lock(FramesPoolLocker);
+        for (auto& e : FramesPoolUploads)
+        {
+            if (!e && buffer->IsAllocated())
+            {
+                e = buffer;
+                buffer = nullptr;
+                return;
+            }
+        }
+        SAFE_DELETE_GPU_RESOURCE(buffer);
+    }
+
+    void ReleaseFramesPool()
+    {
+        ScopeLock lock(FramesPoolLocker);
+        for (auto& e : FramesPoolMemory)
+            e.Release();
+        for (auto& e : FramesPoolUploads)
+            SAFE_DELETE_GPU_RESOURCE(e);
+    }
+
+    struct PlayerPriority
+    {
+        VideoBackendPlayer* Player;
+        float Priority;
+
+        bool operator<(const PlayerPriority& other) const
+        {
+            return Priority > other.Priority;
+        }
+    };
+}
+
 /// <summary>
 /// Video frame upload task to the GPU.
 /// </summary>
@@ -64,7 +166,7 @@ class GPUUploadVideoFrameTask : public GPUTask
     // [GPUTask]
     Result run(GPUTasksContext* context) override
     {
-        if (!_player || _player->VideoFrameMemory.IsInvalid())
+        if (!_player || (_player->VideoFrameMemory.IsInvalid() && !_player->IsVideoFrameNative))
             return Result::MissingResources;
         GPUTexture* frame = _player->Frame;
         if (!frame->IsAllocated())
@@ -72,12 +174,18 @@ class GPUUploadVideoFrameTask : public GPUTask
         PROFILE_CPU();
         ZoneText(_player->DebugUrl, _player->DebugUrlLen);
 
-        if (PixelFormatExtensions::IsVideo(_player->Format))
+        if (_player->IsVideoFrameNative)
+        {
+            // Decoded frame is already in the GPU memory so just copy it
+            if (_player->Backend->Player_CopyFrame(*_player, context->GPU))
+                return Result::Failed;
+        }
+        else if (PixelFormatExtensions::IsVideo(_player->Format))
         {
             // Allocate compressed frame uploading texture
-            if (!_player->FrameUpload)
-                _player->FrameUpload = GPUDevice::Instance->CreateBuffer(TEXT("VideoFrameUpload"));
             auto desc = GPUBufferDescription::Buffer(_player->VideoFrameMemory.Length(), GPUBufferFlags::ShaderResource, PixelFormat::R32_UInt, nullptr, 4, GPUResourceUsage::Dynamic);
+            if (!_player->FrameUpload)
+                _player->FrameUpload = AcquireFrameUpload(desc);
             // TODO: add support for Transient textures (single frame data upload)
             if (_player->FrameUpload->GetDescription() != desc)
             {
@@ -153,9 +261,14 @@ class VideoService : public EngineService
     VideoService()
         : EngineService(TEXT("Video"), -40)
     {
+        // Initialize on the first video playback
+        InitDeferred = true;
     }
 
     VideoBackend* Backends[4] = {};
+    CriticalSection PlayersLocker;
+    Array<VideoBackendPlayer*> Players;
+    Array<PlayerPriority> PlayersPriority;
 
     void InitBackend(int32 index, VideoBackend* backend)
     {
@@ -167,17 +280,64 @@ class VideoService : public EngineService
         Backends[index] = backend;
     }
 
+    void UpdateScheduling();
     bool Init() override;
     void Dispose() override;
 };
 
 VideoService VideoServiceInstance;
 TaskGraphSystem* Video::System = nullptr;
+float Video::FrameUploadBudget = 1024.0f;
+
+void VideoService::UpdateScheduling()
+{
+    PROFILE_CPU();
+    ScopeLock lock(PlayersLocker);
+    if (Players.IsEmpty())
+        return;
+    const double now = Platform::GetTimeSeconds();
+
+    // Sort players by priority (visible first)
+    PlayersPriority.Clear();
+    for (VideoBackendPlayer* player : Players)
+    {
+        if (player->Frame && player->Frame->LastRenderTime > player->LastVisibleTime)
+            player->LastVisibleTime = player->Frame->LastRenderTime;
+        const bool isVisible = now - player->LastVisibleTime < VIDEO_HIDDEN_TIMEOUT;
+        if (isVisible)
+            PlayersPriority.Add({ player, player->Priority + 1.0f });
+        else
+            player->FrameUpdateInterval = 1.0f / VIDEO_HIDDEN_FRAME_RATE;
+    }
+    Sorting::QuickSort(PlayersPriority);
+
+    // Update frames at full rate for the players that fit into the upload budget
+    double budgetLeft = Video::FrameUploadBudget > 0.0f ? Video::FrameUploadBudget * (1024.0 * 1024.0) : MAX_double;
+    for (const PlayerPriority& e : PlayersPriority)
+    {
+        VideoBackendPlayer* player = e.Player;
+        uint32 rowPitch, slicePitch;
+        RenderTools::ComputePitch(player->Format, player->VideoFrameWidth, player->VideoFrameHeight, rowPitch, slicePitch);
+        const double cost = (double)slicePitch * Math::Max(player->FrameRate, 1.0f);
+        if (cost <= budgetLeft || &e == PlayersPriority.Get())
+        {
+            budgetLeft -= cost;
+            player->FrameUpdateInterval = 0.0f;
+        }
+        else
+        {
+            player->FrameUpdateInterval = 1.0f / VIDEO_THROTTLED_FRAME_RATE;
+        }
+    }
+}
 
 void VideoSystem::Execute(TaskGraph* graph)
 {
     PROFILE_CPU_NAMED("Video.Update");
 
+    // Distribute frames upload budget across players
+    VideoServiceInstance.UpdateScheduling();
+
     // Update backends
     for (VideoBackend*& backend : VideoServiceInstance.Backends)
     {
@@ -208,10 +368,14 @@ void VideoService::Dispose()
     }
 
     SAFE_DELETE(Video::System);
+    ReleaseFramesPool();
 }
 
 bool Video::CreatePlayerBackend(const VideoBackendPlayerInfo& info, VideoBackendPlayer& player)
 {
+    if (VideoServiceInstance.EnsureInitialized())
+        return true;
+
     // Pick the first backend to support the player info
     int32 index = 0;
     VideoBackend* backend;
@@ -252,7 +416,10 @@ void VideoBackendPlayer::Created(const VideoBackendPlayerInfo& info)
     DebugUrl = (Char*)Allocator::Allocate(DebugUrlLen * sizeof(Char) + 2);
     Platform::MemoryCopy(DebugUrl, *info.Url, DebugUrlLen * 2 + 2);
 #endif
+    LastVisibleTime = Platform::GetTimeSeconds();
     Updated(info);
+    ScopeLock lock(VideoServiceInstance.PlayersLocker);
+    VideoServiceInstance.Players.Add(this);
 }
 
 void VideoBackendPlayer::Updated(const VideoBackendPlayerInfo& info)
@@ -262,6 +429,7 @@ void VideoBackendPlayer::Updated(const VideoBackendPlayerInfo& info)
     AudioPan = info.Pan;
     AudioMinDistance = info.MinDistance;
     AudioAttenuation = info.Attenuation;
+    Priority = info.Priority;
     Transform = info.Transform;
     if (AudioSource)
     {
@@ -315,6 +483,12 @@ void VideoBackendPlayer::UpdateVideoFrame(Span<byte> data, TimeSpan time, TimeSp
     if (!GPUDevice::Instance || GPUDevice::Instance->GetRendererType() == RendererType::Null)
         return;
 
+    // Skip frame update if player got throttled by the scheduler (eg. when video is not visible)
+    const double now = Platform::GetTimeSeconds();
+    if (FramesCount != 0 && now - LastFrameUpdateTime < FrameUpdateInterval)
+        return;
+    LastFrameUpdateTime = now;
+
     // Ensure that sampled frame data matches the target texture size
     uint32 rowPitch, slicePitch;
     RenderTools::ComputePitch(Format, VideoFrameWidth, VideoFrameHeight, rowPitch, slicePitch);
@@ -327,7 +501,8 @@ void VideoBackendPlayer::UpdateVideoFrame(Span<byte> data, TimeSpan time, TimeSp
     // Copy frame into buffer for video frames uploading
     if (VideoFrameMemory.Length() < (int32)slicePitch)
     {
-        VideoFrameMemory.Allocate(slicePitch);
+        ReleaseFrameMemory(VideoFrameMemory);
+        AcquireFrameMemory(VideoFrameMemory, (int32)slicePitch);
         if (VideoFrameMemory.IsInvalid())
         {
             OUT_OF_MEMORY;
@@ -335,6 +510,7 @@ void VideoBackendPlayer::UpdateVideoFrame(Span<byte> data, TimeSpan time, TimeSp
         }
     }
     Platform::MemoryCopy(VideoFrameMemory.Get(), data.Get(), slicePitch);
+    IsVideoFrameNative = 0;
 
     // Update output frame texture
     InitVideoFrame();
@@ -358,6 +534,40 @@ void VideoBackendPlayer::UpdateVideoFrame(Span<byte> data, TimeSpan time, TimeSp
     }
 }
 
+void VideoBackendPlayer::UpdateVideoFrame(TimeSpan time, TimeSpan duration)
+{
+    PROFILE_CPU();
+    ZoneText(DebugUrl, DebugUrlLen);
+    VideoFrameTime = time;
+    VideoFrameDuration = duration;
+    if (!GPUDevice::Instance || GPUDevice::Instance->GetRendererType() == RendererType::Null)
+        return;
+    const double now = Platform::GetTimeSeconds();
+    if (FramesCount != 0 && now - LastFrameUpdateTime < FrameUpdateInterval)
+        return;
+    LastFrameUpdateTime = now;
+    IsVideoFrameNative = 1;
+
+    // Update output frame texture (backend copies the decoded frame in Player_CopyFrame)
+    InitVideoFrame();
+    auto desc = GPUTextureDescription::New2D(Width, Height, Format, GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget);
+    if (Frame->GetDescription() != desc)
+    {
+        if (Frame->Init(desc))
+        {
+            LOG(Error, "Failed to allocate video frame texture");
+            return;
+        }
+    }
+
+    // Start texture upload task (if not already - only one is needed to copy the latest frame)
+    if (!UploadVideoFrameTask)
+    {
+        UploadVideoFrameTask = New<GPUUploadVideoFrameTask>(this);
+        UploadVideoFrameTask->Start();
+    }
+}
+
 void VideoBackendPlayer::UpdateAudioBuffer(Span<byte> data, TimeSpan time, TimeSpan duration)
 {
     PROFILE_CPU();
@@ -437,9 +647,13 @@ void VideoBackendPlayer::ReleaseResources()
     }
     if (UploadVideoFrameTask)
         UploadVideoFrameTask->Cancel();
-    VideoFrameMemory.Release();
+    {
+        ScopeLock lock(VideoServiceInstance.PlayersLocker);
+        VideoServiceInstance.Players.Remove(this);
+    }
+    ReleaseFrameMemory(VideoFrameMemory);
     SAFE_DELETE_GPU_RESOURCE(Frame);
-    SAFE_DELETE_GPU_RESOURCE(FrameUpload);
+    ReleaseFrameUpload(FrameUpload);
 #ifdef TRACY_ENABLE
     Allocator::Free(DebugUrl);
 #endif
@@ -11,5 +11,11 @@ class Video
 {
 public:
     static class TaskGraphSystem* System;
+
+    /// <summary>
+    /// The budget for video frames uploads to the GPU (in megabytes per second) shared by all the playing videos. Visible players with the highest priority use it first, the remaining ones update frames at a lower rate. Use 0 to disable the limit.
+    /// </summary>
+    static float FrameUploadBudget;
+
     static bool CreatePlayerBackend(const VideoBackendPlayerInfo& info, VideoBackendPlayer& player);
 };
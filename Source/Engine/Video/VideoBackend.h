@@ -18,6 +18,7 @@ struct VideoBackendPlayerInfo
     float Pan;
     float MinDistance;
     float Attenuation;
+    float Priority;
     const Transform* Transform;
 };
 
@@ -41,6 +42,12 @@ class VideoBackend
     virtual void Player_Seek(VideoBackendPlayer& player, TimeSpan time) = 0;
     virtual TimeSpan Player_GetTime(const VideoBackendPlayer& player) = 0;
 
+    // Copies the latest decoded frame that stays in the GPU memory into the player Frame texture (for backends that use UpdateVideoFrame without data). Returns true if failed.
+    virtual bool Player_CopyFrame(VideoBackendPlayer& player, GPUContext* context)
+    {
+        return true;
+    }
+
     // Base
     virtual const Char* Base_Name() = 0;
     virtual bool Base_Init() = 0;
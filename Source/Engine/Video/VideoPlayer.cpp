@@ -75,6 +75,15 @@ void VideoPlayer::SetAudioAttenuation(float value)
     UpdateInfo();
 }
 
+void VideoPlayer::SetPriority(float value)
+{
+    value = Math::Max(0.0f, value);
+    if (Math::NearEqual(_priority, value))
+        return;
+    _priority = value;
+    UpdateInfo();
+}
+
 void VideoPlayer::Play()
 {
     auto state = _state;
@@ -188,6 +197,7 @@ void VideoPlayer::GetInfo(VideoBackendPlayerInfo& info) const
     info.Pan = _pan;
     info.MinDistance = _minDistance;
     info.Attenuation = _attenuation;
+    info.Priority = _priority;
     info.Transform = &_transform;
 }
 
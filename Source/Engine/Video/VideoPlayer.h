@@ -42,7 +42,7 @@ class FLAXENGINE_API VideoPlayer : public Actor
     VideoBackendPlayer _player;
     States _state = States::Stopped;
     bool _loop = false, _isSpatial = false;
-    float _volume = 1.0f, _pan = 0.0f, _minDistance = 1000.0f, _attenuation = 1.0f;
+    float _volume = 1.0f, _pan = 0.0f, _minDistance = 1000.0f, _attenuation = 1.0f, _priority = 1.0f;
 
 public:
     ~VideoPlayer();
@@ -149,6 +149,20 @@ class FLAXENGINE_API VideoPlayer : public Actor
     /// </summary>
     API_PROPERTY() void SetAudioAttenuation(float value);
 
+    /// <summary>
+    /// Gets the video frames update priority. Players with higher priority get their frames updated first when the video frames upload budget is exceeded (eg. many video screens playing at once). Can be adjusted by the game based on the video screen size.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(200), DefaultValue(1.0f), Limit(0, float.MaxValue, 0.01f), EditorDisplay(\"Video Player\")")
+    FORCE_INLINE float GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets the video frames update priority. Players with higher priority get their frames updated first when the video frames upload budget is exceeded (eg. many video screens playing at once). Can be adjusted by the game based on the video screen size.
+    /// </summary>
+    API_PROPERTY() void SetPriority(float value);
+
 public:
     /// <summary>
     /// Starts playing the currently assigned video Url.
@@ -75,6 +75,13 @@ class VisjectGraphNode : public GraphNode<BoxType>
                 BinaryModule* Module;
                 bool IsStatic;
             } GetSetField;
+
+            struct
+            {
+                Variant* Value;
+                byte BoxID;
+                bool Failed;
+            } Folding;
         };
     };
 
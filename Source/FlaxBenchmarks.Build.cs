@@ -0,0 +1,66 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System;
+using System.Linq;
+using Flax.Build;
+using Flax.Build.NativeCpp;
+
+/// <summary>
+/// Target that builds standalone, native micro-benchmarks.
+/// </summary>
+public class FlaxBenchmarksTarget : FlaxEditor
+{
+    /// <inheritdoc />
+    public override void Init()
+    {
+        base.Init();
+
+        // Initialize
+        OutputName = "FlaxBenchmarks";
+        ConfigurationName = "Benchmarks";
+        IsPreBuilt = false;
+        UseSymbolsExports = true;
+        Platforms = new[]
+        {
+            TargetPlatform.Windows,
+            TargetPlatform.Linux,
+            TargetPlatform.Mac,
+        };
+        Architectures = new[]
+        {
+            TargetArchitecture.x64,
+        };
+        Configurations = new[]
+        {
+            TargetConfiguration.Development,
+            TargetConfiguration.Release,
+        };
+        GlobalDefinitions.Add("FLAX_BENCHMARKS");
+        Win32ResourceFile = null;
+
+        Modules.Add("Benchmarks");
+    }
+
+    /// <inheritdoc />
+    public override void SetupTargetEnvironment(BuildOptions options)
+    {
+        base.SetupTargetEnvironment(options);
+
+        // Setup C# scripts environment
+        options.ScriptingAPI.IgnoreMissingDocumentationWarnings = true;
+        options.ScriptingAPI.Defines.Add("FLAX_BENCHMARKS");
+
+        // Produce console program
+        options.LinkEnv.LinkAsConsoleProgram = true;
+    }
+
+    /// <inheritdoc />
+    public override Target SelectReferencedTarget(ProjectInfo project, Target[] projectTargets)
+    {
+        var testTargetName = "FlaxNativeTests"; // Benchmarks run within the same project as native tests
+        var result = projectTargets.FirstOrDefault(x => x.Name == testTargetName);
+        if (result == null)
+            throw new Exception(string.Format("Invalid or missing test target {0} specified in project {1} (referenced by project {2}).", testTargetName, project.Name, Project.Name));
+        return result;
+    }
+}
@@ -0,0 +1,24 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#ifndef __BINDLESS__
+#define __BINDLESS__
+
+// Bindless resources access via global descriptors tables indexed with GPUResourceView::GetBindlessIndex (passed eg. in a constant buffer or objects buffer).
+// Available only if BINDLESS_RESOURCES is defined by the shader compiler and GPULimits::HasBindlessResources is true at runtime (shader code using it should not be executed otherwise).
+// Tables alias the same descriptors so the index has to be used with the array matching the view type. Buffers need to be raw (see GPUBufferFlags::RawBuffer).
+#if BINDLESS_RESOURCES
+
+Texture2D BindlessTextures2D[] : register(t0, space1);
+Texture3D BindlessTextures3D[] : register(t0, space2);
+TextureCube BindlessTexturesCube[] : register(t0, space3);
+ByteAddressBuffer BindlessBuffers[] : register(t0, space4);
+
+// Index can differ between draw lanes (eg. per-object index) so use non-uniform access always
+#define BINDLESS_TEXTURE2D(index) BindlessTextures2D[NonUniformResourceIndex(index)]
+#define BINDLESS_TEXTURE3D(index) BindlessTextures3D[NonUniformResourceIndex(index)]
+#define BINDLESS_TEXTURECUBE(index) BindlessTexturesCube[NonUniformResourceIndex(index)]
+#define BINDLESS_BUFFER(index) BindlessBuffers[NonUniformResourceIndex(index)]
+
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+META_CB_BEGIN(0, Data)
+uint VertexCount;
+uint AttributesOffset;
+float2 Dummy0;
+META_CB_END
+
+// Skinned mesh vertices (see VB0SkinnedElementType, 36 bytes per vertex) and the bones transformations (3 x float4 per bone)
+ByteAddressBuffer Vertices : register(t0);
+Buffer<float4> BoneMatrices : register(t1);
+
+// Output skinned positions (see VB0ElementType) followed by the vertex attributes (see VB1ElementType)
+RWByteAddressBuffer Output : register(u0);
+
+float3x4 GetBoneMatrix(uint index)
+{
+	float4 a = BoneMatrices[index * 3];
+	float4 b = BoneMatrices[index * 3 + 1];
+	float4 c = BoneMatrices[index * 3 + 2];
+	return float3x4(a, b, c);
+}
+
+float3 UnpackNormal(uint value)
+{
+	return float3(value & 1023, (value >> 10) & 1023, (value >> 20) & 1023) / 1023.0f * 2.0f - 1.0f;
+}
+
+uint PackNormal(float3 value, uint source)
+{
+	uint3 v = (uint3)(saturate(value * 0.5f + 0.5f) * 1023.0f + 0.5f);
+	return v.x | (v.y << 10) | (v.z << 20) | (source & 0xC0000000); // Keep the source W component (bitangent sign)
+}
+
+// Skins the mesh vertices (one thread per vertex), matches the vertex shader skinning in the Surface material
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_Skinning(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= VertexCount)
+		return;
+
+	// Load vertex
+	uint address = index * 36;
+	uint4 data0 = Vertices.Load4(address); // Position, TexCoord
+	uint4 data1 = Vertices.Load4(address + 16); // Normal, Tangent, BlendIndices, BlendWeights.xy
+	uint data2 = Vertices.Load(address + 32); // BlendWeights.zw
+	uint4 blendIndices = uint4(data1.z & 0xff, (data1.z >> 8) & 0xff, (data1.z >> 16) & 0xff, data1.z >> 24);
+	float4 blendWeights = float4(f16tof32(data1.w), f16tof32(data1.w >> 16), f16tof32(data2), f16tof32(data2 >> 16));
+
+	// Blend bones
+	float weightsSum = blendWeights.x + blendWeights.y + blendWeights.z + blendWeights.w;
+	float mainWeight = blendWeights.x + (1.0f - weightsSum); // Re-normalize to account for 16-bit weights encoding errors
+	float3x4 boneMatrix = mainWeight * GetBoneMatrix(blendIndices.x);
+	boneMatrix += blendWeights.y * GetBoneMatrix(blendIndices.y);
+	boneMatrix += blendWeights.z * GetBoneMatrix(blendIndices.z);
+	boneMatrix += blendWeights.w * GetBoneMatrix(blendIndices.w);
+
+	// Skin vertex
+	float3 position = mul(boneMatrix, float4(asfloat(data0.xyz), 1));
+	float3 normal = normalize(mul(boneMatrix, float4(UnpackNormal(data1.x), 0)));
+	float3 tangent = normalize(mul(boneMatrix, float4(UnpackNormal(data1.y), 0)));
+
+	// Store vertex (without lightmap UVs)
+	Output.Store3(index * 12, asuint(position));
+	Output.Store4(AttributesOffset + index * 16, uint4(data0.w, PackNormal(normal, data1.x), PackNormal(tangent, data1.y), 0));
+}
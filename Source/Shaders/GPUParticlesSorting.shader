@@ -85,3 +85,34 @@ void CS_Sort(uint3 dispatchThreadId : SV_DispatchThreadID)
 	item.Value = index;
 	SortingKeys[index] = item;
 }
+
+#ifdef _CS_DispatchArgs
+
+META_CB_BEGIN(1, DispatchArgsData)
+uint EmittersCount;
+uint3 DispatchArgsDataPadding;
+META_CB_END
+
+// Emitters table (per emitter: particles counter, particles to spawn, particles capacity, unused)
+ByteAddressBuffer Emitters : register(t1);
+
+// Output indirect dispatch arguments buffer (per emitter: threads groups count)
+RWByteAddressBuffer DispatchArgs : register(u1);
+
+// Indirect dispatch arguments generation shader (for GPU particles simulation and sorting keys generation)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_DispatchArgs(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= EmittersCount)
+		return;
+
+	// Particles count after the simulation is never larger than the current count plus the spawned particles
+	uint4 emitter = Emitters.Load4(index * 16);
+	uint particlesCount = min(min(emitter.x, emitter.z) + emitter.y, emitter.z);
+	uint groups = min((particlesCount + 1023) / 1024, 65535);
+	DispatchArgs.Store3(index * 12, uint3(groups, 1, 1));
+}
+
+#endif
@@ -21,6 +21,31 @@ float4 WeightAndOffsets[MAX_SAMPLES / 2];
 META_CB_END
 
 Texture2D Image : register(t0);
+Texture2D Image1 : register(t1);
+Texture2D Image2 : register(t2);
+Texture2D Image3 : register(t3);
+Texture2D Image4 : register(t4);
+Texture2D Image5 : register(t5);
+Texture2D Image6 : register(t6);
+Texture2D Image7 : register(t7);
+
+// The maximum amount of textures used by the merged draw calls batch (must match C++ code)
+#define BATCH_MAX_TEXTURES 8
+
+// The distance field spread (in pixels) of the signed distance field fonts glyphs (must match FONT_SDF_SPREAD in C++ code)
+#define FONT_SDF_SPREAD 6
+
+// Converts the signed distance field font sample into the character coverage (anti-aliased over a single screen pixel)
+float GetFontSDFCoverage(float value, float2 imageSize, float2 uvDDX, float2 uvDDY)
+{
+	// Distance to the glyph outline (in atlas texels)
+	float distance = (value * 255.0f - 128.0f) * (FONT_SDF_SPREAD / 128.0f);
+
+	// Amount of atlas texels covered by a single screen pixel
+	float texelsPerPixel = max(length(float2(length(uvDDX * imageSize), length(uvDDY * imageSize))) * 0.70710678f, 0.0001f);
+
+	return saturate(distance / texelsPerPixel + 0.5f);
+}
 
 META_VS(true, FEATURE_LEVEL_ES2)
 META_VS_IN_ELEMENT(POSITION, 0, R32G32_FLOAT,       0, ALIGN, PER_VERTEX, 0, true)
@@ -101,6 +126,105 @@ float4 PS_Font(VS2PS input) : SV_Target0
 	return color;
 }
 
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_FontSDF(VS2PS input) : SV_Target0
+{
+	PerformClipping(input);
+
+	float2 imageSize;
+	Image.GetDimensions(imageSize.x, imageSize.y);
+	float4 color = input.Color;
+	color.a *= GetFontSDFCoverage(Image.Sample(SamplerLinearClamp, input.TexCoord).r, imageSize, ddx(input.TexCoord), ddy(input.TexCoord));
+	return color;
+}
+
+float4 SampleBatchImage(uint slot, float2 uv, float2 uvDDX, float2 uvDDY)
+{
+	// Use explicit gradients since the texture is selected with a per-vertex value
+	switch (slot)
+	{
+	case 1:
+		return Image1.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	case 2:
+		return Image2.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	case 3:
+		return Image3.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	case 4:
+		return Image4.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	case 5:
+		return Image5.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	case 6:
+		return Image6.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	case 7:
+		return Image7.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	default:
+		return Image.SampleGrad(SamplerLinearClamp, uv, uvDDX, uvDDY);
+	}
+}
+
+float2 GetBatchImageSize(uint slot)
+{
+	float2 size;
+	switch (slot)
+	{
+	case 1:
+		Image1.GetDimensions(size.x, size.y);
+		break;
+	case 2:
+		Image2.GetDimensions(size.x, size.y);
+		break;
+	case 3:
+		Image3.GetDimensions(size.x, size.y);
+		break;
+	case 4:
+		Image4.GetDimensions(size.x, size.y);
+		break;
+	case 5:
+		Image5.GetDimensions(size.x, size.y);
+		break;
+	case 6:
+		Image6.GetDimensions(size.x, size.y);
+		break;
+	case 7:
+		Image7.GetDimensions(size.x, size.y);
+		break;
+	default:
+		Image.GetDimensions(size.x, size.y);
+		break;
+	}
+	return size;
+}
+
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_Batch(VS2PS input) : SV_Target0
+{
+	PerformClipping(input);
+
+	// Custom data contains geometry type and the texture slot (see MergeDrawCalls in Render2D.cpp)
+	uint data = (uint)(input.CustomData.x + 0.5f);
+	uint type = data / BATCH_MAX_TEXTURES;
+	uint slot = data % BATCH_MAX_TEXTURES;
+	float2 uvDDX = ddx(input.TexCoord);
+	float2 uvDDY = ddy(input.TexCoord);
+	float4 color = input.Color;
+	if (type == 1)
+	{
+		// Image
+		color *= SampleBatchImage(slot, input.TexCoord, uvDDX, uvDDY);
+	}
+	else if (type == 2)
+	{
+		// Font
+		color.a *= SampleBatchImage(slot, input.TexCoord, uvDDX, uvDDY).r;
+	}
+	else if (type == 3)
+	{
+		// Signed distance field font
+		color.a *= GetFontSDFCoverage(SampleBatchImage(slot, input.TexCoord, uvDDX, uvDDY).r, GetBatchImageSize(slot), uvDDX, uvDDY);
+	}
+	return color;
+}
+
 float4 GetSample(float weight, float offset, float2 uv)
 {
 #if BLUR_V
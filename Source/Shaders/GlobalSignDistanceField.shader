@@ -50,6 +50,8 @@ uint MipTexResolution;
 uint MipCoordScale;
 uint MipTexOffsetX;
 uint MipMipOffsetX;
+int3 ScrollOffset;
+int Padding21;
 META_CB_END
 
 float CombineDistanceToSDF(float sdf, float distanceToSDF)
@@ -230,6 +232,32 @@ void CS_ClearChunk(uint3 DispatchThreadId : SV_DispatchThreadID)
 
 #endif
 
+#if defined(_CS_ScrollCascade)
+
+RWTexture3D<snorm float> GlobalSDFDst : register(u0);
+Texture3D<snorm float> GlobalSDFSrc : register(t0);
+
+// Compute shader for moving Global SDF cascade contents by the voxels offset (MipTexOffsetX/MipMipOffsetX are used as source/destination X offsets)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(GLOBAL_SDF_RASTERIZE_GROUP_SIZE, GLOBAL_SDF_RASTERIZE_GROUP_SIZE, GLOBAL_SDF_RASTERIZE_GROUP_SIZE)]
+void CS_ScrollCascade(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	if (any(DispatchThreadId >= (uint)CascadeResolution))
+		return;
+	int3 srcCoord = (int3)DispatchThreadId + ScrollOffset;
+	float result = 1.0f; // Empty space (chunks that entered the cascade get rasterized later)
+	if (all(srcCoord >= 0) && all(srcCoord < CascadeResolution))
+	{
+		srcCoord.x += MipTexOffsetX;
+		result = GlobalSDFSrc[srcCoord].r;
+	}
+	uint3 dstCoord = DispatchThreadId;
+	dstCoord.x += MipMipOffsetX;
+	GlobalSDFDst[dstCoord] = result;
+}
+
+#endif
+
 #if defined(_CS_GenerateMip)
 
 RWTexture3D<snorm float> GlobalSDFMip : register(u0);
@@ -0,0 +1,99 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/Octahedral.hlsl"
+#include "./Flax/GBufferCommon.hlsl"
+
+META_CB_BEGIN(0, Data)
+float4x4 ViewProjectionMatrix;
+float3 ViewPos;
+float IsOrtho;
+float3 ViewDir;
+uint InstanceOffset;
+float FramesCount;
+float FrameTexelSize;
+float2 Dummy0;
+META_CB_END
+
+struct ImpostorInstance
+{
+	float4 PositionRadius;
+	float4 Orientation;
+};
+
+StructuredBuffer<ImpostorInstance> Instances : register(t0);
+Texture2D Atlas0 : register(t1);
+Texture2D Atlas1 : register(t2);
+Texture2D Atlas2 : register(t3);
+
+struct VertexOutput
+{
+	float4 Position : SV_Position;
+	float2 TexCoord : TEXCOORD0;
+	nointerpolation float4 Orientation : TEXCOORD1;
+};
+
+// Gets the view basis of the impostor frame (matches the bake camera that used Matrix::LookAt towards the model center)
+void GetFrameBasis(float3 direction, out float3 xAxis, out float3 yAxis)
+{
+	float3 up = abs(direction.y) > 0.99f ? float3(0, 0, 1) : float3(0, 1, 0);
+	float3 zAxis = -direction;
+	xAxis = normalize(cross(up, zAxis));
+	yAxis = cross(zAxis, xAxis);
+}
+
+// Vertex Shader, expands the instance into a quad aligned with the baked frame that is the closest to the view direction
+META_VS(true, FEATURE_LEVEL_SM5)
+VertexOutput VS(uint vertexID : SV_VertexID, uint instanceID : SV_InstanceID)
+{
+	ImpostorInstance instance = Instances[InstanceOffset + instanceID];
+	float3 position = instance.PositionRadius.xyz;
+	float radius = instance.PositionRadius.w;
+	float4 orientation = instance.Orientation;
+	float4 orientationInv = orientation * float4(-1, -1, -1, 1);
+
+	// Pick the frame from the octahedral atlas
+	float3 toView = IsOrtho > 0.0f ? -ViewDir : normalize(ViewPos - position);
+	float2 octahedral = GetOctahedralCoords(QuatRotateVector(orientationInv, toView));
+	float2 frame = clamp(floor((octahedral * 0.5f + 0.5f) * FramesCount), 0, FramesCount - 1);
+	float3 frameDirection = GetOctahedralDirection(((frame + 0.5f) / FramesCount) * 2.0f - 1.0f);
+	float3 xAxis, yAxis;
+	GetFrameBasis(frameDirection, xAxis, yAxis);
+
+	// Expand the quad (2 triangles)
+	const float2 corners[6] = { float2(-1, 1), float2(1, 1), float2(-1, -1), float2(-1, -1), float2(1, 1), float2(1, -1) };
+	float2 corner = corners[vertexID];
+	float3 worldPosition = position + QuatRotateVector(orientation, (xAxis * corner.x + yAxis * corner.y) * radius);
+
+	VertexOutput output;
+	output.Position = mul(float4(worldPosition, 1), ViewProjectionMatrix);
+	float2 frameUV = clamp(float2(corner.x, -corner.y) * 0.5f + 0.5f, FrameTexelSize, 1.0f - FrameTexelSize);
+	output.TexCoord = (frame + frameUV) / FramesCount;
+	output.Orientation = orientation;
+	return output;
+}
+
+// Pixel Shader, writes the baked surface into the GBuffer
+META_PS(true, FEATURE_LEVEL_SM5)
+void PS_GBuffer(VertexOutput input, out float4 Light : SV_Target0, out float4 RT0 : SV_Target1, out float4 RT1 : SV_Target2, out float4 RT2 : SV_Target3, out float4 RT3 : SV_Target4)
+{
+	float4 gBuffer1 = Atlas1.SampleLevel(SamplerLinearClamp, input.TexCoord, 0);
+	clip(gBuffer1.a - 0.5f / 3.0f);
+
+	// Transform the baked normal (model space) into the world space
+	float3 normal = QuatRotateVector(input.Orientation, DecodeNormal(gBuffer1.rgb));
+
+	Light = float4(0, 0, 0, 0);
+	RT0 = Atlas0.SampleLevel(SamplerLinearClamp, input.TexCoord, 0);
+	RT1 = float4(EncodeNormal(normal), gBuffer1.a);
+	RT2 = Atlas2.SampleLevel(SamplerLinearClamp, input.TexCoord, 0);
+	RT3 = float4(0, 0, 0, 0);
+}
+
+// Pixel Shader, clips the empty frame pixels for the depth-only rendering
+META_PS(true, FEATURE_LEVEL_SM5)
+void PS_Depth(VertexOutput input)
+{
+	float4 gBuffer1 = Atlas1.SampleLevel(SamplerLinearClamp, input.TexCoord, 0);
+	clip(gBuffer1.a - 0.5f / 3.0f);
+}
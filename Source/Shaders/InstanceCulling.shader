@@ -0,0 +1,59 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+META_CB_BEGIN(0, Data)
+float4 FrustumPlanes[6];
+uint ObjectsStartIndex;
+uint InstancesCount;
+uint OutputOffset;
+uint ArgsOffset;
+float3 CullingPosition;
+float CullDistance;
+float CullDistanceRandomRange;
+float3 Padding;
+META_CB_END
+
+// Objects data (see ShaderObjectData::Store)
+Buffer<float4> ObjectsBuffer : register(t0);
+
+// Output indirect draw arguments (GPUDrawIndexedIndirectArgs at ArgsOffset address) and instances (object indices)
+RWByteAddressBuffer IndirectArgsBuffer : register(u0);
+RWBuffer<uint> InstancesBuffer : register(u1);
+
+// Culls the instances against the view frustum (and cull distance) and appends the visible ones to the instanced draw
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_CullInstances(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint instanceIndex = dispatchThreadId.x;
+	if (instanceIndex >= InstancesCount)
+		return;
+	uint objectIndex = ObjectsStartIndex + instanceIndex;
+
+	// Use bounding sphere around the object origin that covers the geometry size (scaled by the world matrix)
+	float4 vector0 = ObjectsBuffer.Load(objectIndex * 8 + 0);
+	float4 vector1 = ObjectsBuffer.Load(objectIndex * 8 + 1);
+	float4 vector2 = ObjectsBuffer.Load(objectIndex * 8 + 2);
+	float4 vector6 = ObjectsBuffer.Load(objectIndex * 8 + 6);
+	float3 position = float3(vector0.w, vector1.w, vector2.w);
+	float scaleSq = max(max(dot(vector0.xyz, vector0.xyz), dot(vector1.xyz, vector1.xyz)), dot(vector2.xyz, vector2.xyz));
+	float radius = length(vector6.xyz) * sqrt(scaleSq);
+
+	// Frustum test
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		if (dot(FrustumPlanes[i].xyz, position) + FrustumPlanes[i].w < -radius)
+			return;
+	}
+
+	// Distance test (randomized per instance)
+	if (CullDistance > 0.0f && distance(CullingPosition, position) - radius > CullDistance + CullDistanceRandomRange * vector6.w)
+		return;
+
+	// Add instance to the draw (InstanceCount is the second argument)
+	uint index;
+	IndirectArgsBuffer.InterlockedAdd(ArgsOffset + 4, 1, index);
+	InstancesBuffer[OutputOffset + index] = objectIndex;
+}
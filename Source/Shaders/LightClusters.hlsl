@@ -0,0 +1,40 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#ifndef __LIGHT_CLUSTERS__
+#define __LIGHT_CLUSTERS__
+
+// The clusters grid size (screen tiles and exponential depth slices) and the maximum amount of lights per cluster (must match LightClusters.cpp)
+#define LIGHT_CLUSTERS_SIZE_X 16
+#define LIGHT_CLUSTERS_SIZE_Y 8
+#define LIGHT_CLUSTERS_SIZE_Z 24
+#define LIGHT_CLUSTERS_MAX_LIGHTS 31
+
+// Clusters grid layout: for each cluster the lights count followed by the light indices
+#define LIGHT_CLUSTERS_STRIDE (LIGHT_CLUSTERS_MAX_LIGHTS + 1)
+
+// Calculates the index of the cluster that contains the given screen position (depthParams are depth slices scale and bias)
+uint GetLightClusterIndex(float2 uv, float viewDepth, float2 depthParams)
+{
+    uint3 cluster;
+    cluster.xy = min((uint2)(saturate(uv) * float2(LIGHT_CLUSTERS_SIZE_X, LIGHT_CLUSTERS_SIZE_Y)), uint2(LIGHT_CLUSTERS_SIZE_X - 1, LIGHT_CLUSTERS_SIZE_Y - 1));
+    cluster.z = (uint)clamp(log2(max(viewDepth, 0.0001f)) * depthParams.x + depthParams.y, 0, LIGHT_CLUSTERS_SIZE_Z - 1);
+    return (cluster.z * LIGHT_CLUSTERS_SIZE_Y + cluster.y) * LIGHT_CLUSTERS_SIZE_X + cluster.x;
+}
+
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+
+// Gets the amount of lights in the cluster
+uint GetLightClusterLightsCount(Buffer<uint> grid, uint clusterIndex)
+{
+    return grid[clusterIndex * LIGHT_CLUSTERS_STRIDE];
+}
+
+// Gets the index of the light in the cluster (in lights buffer)
+uint GetLightClusterLight(Buffer<uint> grid, uint clusterIndex, uint i)
+{
+    return grid[clusterIndex * LIGHT_CLUSTERS_STRIDE + 1 + i];
+}
+
+#endif
+
+#endif
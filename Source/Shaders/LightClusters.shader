@@ -0,0 +1,68 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/LightClusters.hlsl"
+
+META_CB_BEGIN(0, Data)
+float2 ProjectionScale;
+float2 DepthParams;
+uint LightsCount;
+uint IsOrthographic;
+float2 Dummy0;
+META_CB_END
+
+// Lights view-space bounding spheres (xyz - position, w - radius)
+Buffer<float4> LightsBounds : register(t0);
+
+// Output clusters grid (see LIGHT_CLUSTERS_STRIDE)
+RWBuffer<uint> ClustersGrid : register(u0);
+
+// Calculates the view-space position of the point on the screen at the given depth
+float2 GetClusterViewPos(float2 ndc, float depth)
+{
+	return ndc * (IsOrthographic ? 1.0f : depth) / ProjectionScale;
+}
+
+// Builds the list of lights that intersect the cluster
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(4, 4, 4)]
+void CS_BuildClusters(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint3 cluster = dispatchThreadId;
+	if (any(cluster >= uint3(LIGHT_CLUSTERS_SIZE_X, LIGHT_CLUSTERS_SIZE_Y, LIGHT_CLUSTERS_SIZE_Z)))
+		return;
+	uint clusterIndex = (cluster.z * LIGHT_CLUSTERS_SIZE_Y + cluster.y) * LIGHT_CLUSTERS_SIZE_X + cluster.x;
+
+	// Calculate the cluster view-space bounds (depth slices are distributed exponentially)
+	float2 uvMin = (float2)cluster.xy / float2(LIGHT_CLUSTERS_SIZE_X, LIGHT_CLUSTERS_SIZE_Y);
+	float2 uvMax = (float2)(cluster.xy + 1) / float2(LIGHT_CLUSTERS_SIZE_X, LIGHT_CLUSTERS_SIZE_Y);
+	float2 ndcMin = float2(uvMin.x * 2.0f - 1.0f, 1.0f - uvMax.y * 2.0f);
+	float2 ndcMax = float2(uvMax.x * 2.0f - 1.0f, 1.0f - uvMin.y * 2.0f);
+	float depthMin = exp2(((float)cluster.z - DepthParams.y) / DepthParams.x);
+	float depthMax = exp2(((float)cluster.z + 1.0f - DepthParams.y) / DepthParams.x);
+	if (cluster.z == 0)
+		depthMin = 0.0f;
+	float2 p0 = GetClusterViewPos(ndcMin, depthMin);
+	float2 p1 = GetClusterViewPos(ndcMax, depthMin);
+	float2 p2 = GetClusterViewPos(ndcMin, depthMax);
+	float2 p3 = GetClusterViewPos(ndcMax, depthMax);
+	float3 boundsMin = float3(min(min(p0, p1), min(p2, p3)), depthMin);
+	float3 boundsMax = float3(max(max(p0, p1), max(p2, p3)), depthMax);
+	if (cluster.z == LIGHT_CLUSTERS_SIZE_Z - 1)
+		boundsMax.z = 1e20f;
+
+	// Find the intersecting lights (sphere vs box)
+	uint count = 0;
+	LOOP
+	for (uint lightIndex = 0; lightIndex < LightsCount && count < LIGHT_CLUSTERS_MAX_LIGHTS; lightIndex++)
+	{
+		float4 bounds = LightsBounds[lightIndex];
+		float3 closest = clamp(bounds.xyz, boundsMin, boundsMax) - bounds.xyz;
+		if (dot(closest, closest) <= bounds.w * bounds.w)
+		{
+			ClustersGrid[clusterIndex * LIGHT_CLUSTERS_STRIDE + 1 + count] = lightIndex;
+			count++;
+		}
+	}
+	ClustersGrid[clusterIndex * LIGHT_CLUSTERS_STRIDE] = count;
+}
@@ -8,6 +8,7 @@
 #include "./Flax/IESProfile.hlsl"
 #include "./Flax/GBuffer.hlsl"
 #include "./Flax/Lighting.hlsl"
+#include "./Flax/LightClusters.hlsl"
 
 // Per light data
 META_CB_BEGIN(0, PerLight)
@@ -18,6 +19,7 @@ META_CB_END
 // Per frame data
 META_CB_BEGIN(1, PerFrame)
 GBufferData GBuffer;
+float4 LightClustersParams;
 META_CB_END
 
 DECLARE_GBUFFERDATA_ACCESS(GBuffer)
@@ -26,6 +28,10 @@ DECLARE_GBUFFERDATA_ACCESS(GBuffer)
 Texture2D Shadow : register(t5);
 Texture2D IESTexture : register(t6);
 TextureCube CubeImage : register(t7);
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+StructuredBuffer<LightData> ClusterLights : register(t8);
+Buffer<uint> ClusterGrid : register(t9);
+#endif
 
 // Vertex Shader for models rendering
 META_VS(true, FEATURE_LEVEL_ES2)
@@ -151,6 +157,47 @@ void PS_Spot(Model_VS2PS input, out float4 output : SV_Target0)
 #endif
 }
 
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+
+// Pixel shader for clustered local lights rendering (lights without shadow and IES profile)
+META_PS(true, FEATURE_LEVEL_SM5)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=0)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=1)
+void PS_Clustered(Quad_VS2PS input, out float4 output : SV_Target0)
+{
+	output = 0;
+
+	// Sample GBuffer
+	GBufferData gBufferData = GetGBufferData();
+	GBufferSample gBuffer = SampleGBuffer(gBufferData, input.TexCoord);
+
+	// Check if cannot shadow pixel
+	BRANCH
+	if (gBuffer.ShadingModel == SHADING_MODEL_UNLIT)
+	{
+		discard;
+		return;
+	}
+
+	// Calculate lighting from all lights in the cluster (deferred ones are placed first in the lights buffer)
+	uint clusterIndex = GetLightClusterIndex(input.TexCoord, gBuffer.ViewPos.z, LightClustersParams.xy);
+	uint lightsCount = GetLightClusterLightsCount(ClusterGrid, clusterIndex);
+	uint deferredLightsCount = (uint)LightClustersParams.z;
+	float4 shadowMask = 1;
+	LOOP
+	for (uint i = 0; i < lightsCount; i++)
+	{
+		uint lightIndex = GetLightClusterLight(ClusterGrid, clusterIndex, i);
+		if (lightIndex >= deferredLightsCount)
+			break;
+		LightData light = ClusterLights[lightIndex];
+		bool isSpotLight = light.SpotAngles.x > -2.0f;
+		output += GetLighting(gBufferData.ViewPos, light, gBuffer, shadowMask, true, isSpotLight);
+	}
+}
+
+#endif
+
 // Pixel shader for sky light rendering
 META_PS(true, FEATURE_LEVEL_ES2)
 float4 PS_Sky(Model_VS2PS input) : SV_Target0
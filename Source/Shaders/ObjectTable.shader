@@ -0,0 +1,27 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+META_CB_BEGIN(0, Data)
+uint ObjectsCount;
+float3 Dummy0;
+META_CB_END
+
+// Uploaded objects data (see ShaderObjectData::Store) and their slots in the table
+Buffer<float4> UploadObjects : register(t0);
+Buffer<uint> UploadIndices : register(t1);
+
+// Output objects table
+RWBuffer<float4> Objects : register(u0);
+
+// Writes the uploaded objects into their slots in the objects table (one thread per object data element)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(64, 1, 1)]
+void CS_Scatter(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= ObjectsCount * 8)
+		return;
+	uint slot = UploadIndices[index / 8];
+	Objects[slot * 8 + index % 8] = UploadObjects[index];
+}
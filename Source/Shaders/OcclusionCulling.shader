@@ -0,0 +1,45 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+META_CB_BEGIN(0, Data)
+uint2 DepthSize;
+uint2 HiZSize;
+float2 TileSize;
+float2 Dummy0;
+META_CB_END
+
+Texture2D<float> Depth : register(t0);
+
+// Output Hi-Z (farthest depth of each tile, row by row)
+RWBuffer<float> HiZBuffer : register(u0);
+
+groupshared float DepthCache[64];
+
+// Builds the Hi-Z texel with the farthest scene depth within the depth buffer tile (one thread group per output texel)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(8, 8, 1)]
+void CS_BuildHiZ(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID, uint groupIndex : SV_GroupIndex)
+{
+	uint2 start = (uint2)floor(groupId.xy * TileSize);
+	uint2 end = min((uint2)ceil((groupId.xy + 1) * TileSize), DepthSize);
+	float depth = 0;
+	for (uint y = start.y + groupThreadId.y; y < end.y; y += 8)
+	{
+		for (uint x = start.x + groupThreadId.x; x < end.x; x += 8)
+			depth = max(depth, Depth.Load(int3(x, y, 0)));
+	}
+	DepthCache[groupIndex] = depth;
+	GroupMemoryBarrierWithGroupSync();
+
+	// Reduce tile depth
+	UNROLL
+	for (uint s = 32; s > 0; s >>= 1)
+	{
+		if (groupIndex < s)
+			DepthCache[groupIndex] = max(DepthCache[groupIndex], DepthCache[groupIndex + s]);
+		GroupMemoryBarrierWithGroupSync();
+	}
+	if (groupIndex == 0)
+		HiZBuffer[groupId.y * HiZSize.x + groupId.x] = DepthCache[0];
+}
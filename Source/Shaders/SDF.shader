@@ -6,6 +6,7 @@
 #include "./Flax/ThirdParty/TressFX/TressFXSDF.hlsl"
 
 #define THREAD_GROUP_SIZE 64
+#define INVALID_SEED 0xffffffff
 
 META_CB_BEGIN(0, Data)
 int3 Resolution;
@@ -18,6 +19,9 @@ float3 VoxelToPosMul;
 float WorldUnitsPerVoxel;
 float3 VoxelToPosAdd;
 uint ThreadGroupsX;
+uint JumpStep;
+uint TriangleThreadsX;
+float2 Dummy0;
 META_CB_END
 
 RWBuffer<uint> SDF : register(u0);
@@ -108,7 +112,7 @@ META_CS(true, FEATURE_LEVEL_SM5)
 [numthreads(THREAD_GROUP_SIZE, 1, 1)]
 void CS_RasterizeTriangle(uint3 DispatchThreadId : SV_DispatchThreadID)
 {
-    uint triangleIndex = DispatchThreadId.x;
+    uint triangleIndex = DispatchThreadId.x + DispatchThreadId.y * TriangleThreadsX;
     if (triangleIndex >= TriangleCount)
         return;
 
@@ -152,7 +156,7 @@ void CS_RasterizeTriangle(uint3 DispatchThreadId : SV_DispatchThreadID)
 
 #endif
 
-#if defined(_CS_FloodFill) || defined(_CS_Encode)
+#if defined(_CS_JumpFloodInit) || defined(_CS_JumpFlood) || defined(_CS_JumpFloodResolve) || defined(_CS_Encode)
 
 Buffer<uint> InSDF : register(t0);
 
@@ -161,70 +165,105 @@ float GetVoxel(int voxelIndex)
     return asfloat(InSDF[voxelIndex]);
 }
 
-float GetVoxel(int3 coord)
+#endif
+
+#if defined(_CS_JumpFlood) || defined(_CS_JumpFloodResolve)
+
+Buffer<uint> InSeeds : register(t1);
+
+// Gets the distance to the surface via the seed voxel (upper bound of the true distance)
+float GetSeedDistance(float3 voxelPos, uint seed)
 {
-    coord = ClampVoxelCoord(coord);
-    int voxelIndex = GetVoxelIndex(coord);
-    return GetVoxel(voxelIndex);
+    return length(voxelPos - GetVoxelPos(GetVoxelCoord(seed))) + abs(GetVoxel(seed));
 }
 
-float CombineSDF(float sdf, int3 nearbyCoord, float nearbyDistance)
+#endif
+
+#ifdef _CS_JumpFloodInit
+
+// Initializes the jump flood seeds with voxels that got distance from the triangles rasterization.
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_JumpFloodInit(uint3 GroupId : SV_GroupID, uint GroupIndex : SV_GroupIndex)
 {
-    // Sample nearby voxel
-    float sdfNearby = GetVoxel(nearbyCoord);
+    uint voxelIndex = GetVoxelIndex(GroupId, GroupIndex);
+    if (voxelIndex >= ResolutionSize)
+        return;
+    float sdf = GetVoxel(voxelIndex);
+    SDF[voxelIndex] = abs(sdf) <= MaxDistance ? voxelIndex : INVALID_SEED;
+}
 
-    // Include distance to that nearby voxel
-    if (sdfNearby < 0.0f)
-        nearbyDistance *= -1;
-    sdfNearby += nearbyDistance;
+#endif
 
-    if (sdfNearby > MaxDistance)
-    {
-        // Ignore if nearby sample is invalid (see CS_Init)
-    }
-    else if (sdf > MaxDistance)
-    {
-        // Use nearby sample if current one is invalid (see CS_Init)
-        sdf = sdfNearby;
-    }
-    else
+#ifdef _CS_JumpFlood
+
+// Propagates the closest seeds to the voxels using a single jump flood step (samples 26 nearby voxels at JumpStep distance).
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_JumpFlood(uint3 GroupId : SV_GroupID, uint GroupIndex : SV_GroupIndex)
+{
+    uint voxelIndex = GetVoxelIndex(GroupId, GroupIndex);
+    if (voxelIndex >= ResolutionSize)
+        return;
+    int3 voxelCoord = GetVoxelCoord(voxelIndex);
+    float3 voxelPos = GetVoxelPos(voxelCoord);
+    uint seed = InSeeds[voxelIndex];
+    float distance = seed != INVALID_SEED ? GetSeedDistance(voxelPos, seed) : MaxDistance * 10.0f;
+    for (int z = -1; z <= 1; z++)
     {
-        // Use distance closer to 0
-        sdf = sdf >= 0 ? min(sdf, sdfNearby) : max(sdf, sdfNearby);
+        for (int y = -1; y <= 1; y++)
+        {
+            for (int x = -1; x <= 1; x++)
+            {
+                int3 nearbyCoord = voxelCoord + int3(x, y, z) * (int)JumpStep;
+                if (any(nearbyCoord < 0) || any(nearbyCoord >= Resolution))
+                    continue;
+                uint nearbySeed = InSeeds[GetVoxelIndex(nearbyCoord)];
+                if (nearbySeed == INVALID_SEED || nearbySeed == seed)
+                    continue;
+                float nearbyDistance = GetSeedDistance(voxelPos, nearbySeed);
+                if (nearbyDistance < distance)
+                {
+                    distance = nearbyDistance;
+                    seed = nearbySeed;
+                }
+            }
+        }
     }
-
-    return sdf;
+    SDF[voxelIndex] = seed;
 }
 
-// Fills the voxels with minimum distances to the triangles.
+#endif
+
+#ifdef _CS_JumpFloodResolve
+
+// Converts the closest seeds into the distances (sign of the seed is used, it's the closest voxel at the surface).
 META_CS(true, FEATURE_LEVEL_SM5)
 [numthreads(THREAD_GROUP_SIZE, 1, 1)]
-void CS_FloodFill(uint3 GroupId : SV_GroupID, uint GroupIndex : SV_GroupIndex)
+void CS_JumpFloodResolve(uint3 GroupId : SV_GroupID, uint GroupIndex : SV_GroupIndex)
 {
     uint voxelIndex = GetVoxelIndex(GroupId, GroupIndex);
     if (voxelIndex >= ResolutionSize)
         return;
-    float sdf = GetVoxel(voxelIndex);
-
-    // Skip if the distance is already so small that we know that triangle is nearby
-    if (abs(sdf) > WorldUnitsPerVoxel * 1.2f)
+    uint seed = InSeeds[voxelIndex];
+    float sdf = MaxDistance * 10.0f;
+    if (seed == voxelIndex)
     {
-        int3 voxelCoord = GetVoxelCoord(voxelIndex);
-        int3 offset = int3(-1, 0, 1);
-
-        // Sample nearby voxels
-        float nearbyDistance = WorldUnitsPerVoxel;
-        sdf = CombineSDF(sdf, voxelCoord + offset.zyy, nearbyDistance);
-        sdf = CombineSDF(sdf, voxelCoord + offset.yzy, nearbyDistance);
-        sdf = CombineSDF(sdf, voxelCoord + offset.yyz, nearbyDistance);
-        sdf = CombineSDF(sdf, voxelCoord + offset.xyy, nearbyDistance);
-        sdf = CombineSDF(sdf, voxelCoord + offset.yxy, nearbyDistance);
-        sdf = CombineSDF(sdf, voxelCoord + offset.yyx, nearbyDistance);
+        sdf = GetVoxel(voxelIndex);
+    }
+    else if (seed != INVALID_SEED)
+    {
+        sdf = GetSeedDistance(GetVoxelPos(GetVoxelCoord(voxelIndex)), seed);
+        if (GetVoxel(seed) < 0.0f)
+            sdf = -sdf;
     }
-
     SDF[voxelIndex] = asuint(sdf);
 }
 
+#endif
+
+#ifdef _CS_Encode
+
 RWTexture3D<half> SDFtex : register(u1);
 
 // Encodes SDF values into the packed format with normalized distances.
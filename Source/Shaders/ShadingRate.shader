@@ -0,0 +1,71 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Shading rates (log2 of width in bits 2-3 and log2 of height in bits 0-1)
+#define SHADING_RATE_1X1 0x0
+#define SHADING_RATE_2X2 0x5
+#define SHADING_RATE_4X4 0xA
+
+// Amount of samples (along each axis) to evaluate per tile
+#define SAMPLES_PER_TILE 4
+
+META_CB_BEGIN(0, Data)
+float2 InputSize;
+uint2 ImageSize;
+uint TileSize;
+uint UseCoarseRates;
+uint UseMotionVectors;
+float ContrastThreshold;
+float MotionThreshold;
+float3 Dummy0;
+META_CB_END
+
+Texture2D Input : register(t0);
+Texture2D MotionVectors : register(t1);
+
+RWTexture2D<uint> ShadingRateImage : register(u0);
+
+// Generates the shading rate image from the scene luminance contrast and motion (one thread per screen tile)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(8, 8, 1)]
+void CS_Generate(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint2 tile = dispatchThreadId.xy;
+	if (any(tile >= ImageSize))
+		return;
+
+	// Sample the tile luminance range and the fastest motion
+	float tileSize = (float)TileSize;
+	float2 tileStart = tile * tileSize;
+	float luminanceMin = 100000.0f;
+	float luminanceMax = 0;
+	float motion = 0;
+	UNROLL
+	for (uint y = 0; y < SAMPLES_PER_TILE; y++)
+	{
+		UNROLL
+		for (uint x = 0; x < SAMPLES_PER_TILE; x++)
+		{
+			float2 pixel = min(tileStart + (float2(x, y) + 0.5f) * (tileSize / SAMPLES_PER_TILE), InputSize - 1);
+			float luminance = Luminance(Input.Load(int3(pixel, 0)).rgb);
+			luminanceMin = min(luminanceMin, luminance);
+			luminanceMax = max(luminanceMax, luminance);
+			BRANCH
+			if (UseMotionVectors)
+			{
+				float2 velocity = MotionVectors.SampleLevel(SamplerPointClamp, (pixel + 0.5f) / InputSize, 0).xy * InputSize;
+				motion = max(motion, length(velocity));
+			}
+		}
+	}
+
+	// Use coarser shading in flat or fast moving areas (relative contrast handles HDR input)
+	float contrast = (luminanceMax - luminanceMin) / max(luminanceMax, 0.0001f);
+	uint rate = SHADING_RATE_1X1;
+	if (contrast < ContrastThreshold || motion > MotionThreshold)
+		rate = SHADING_RATE_2X2;
+	if (UseCoarseRates && (contrast < ContrastThreshold * 0.25f || motion > MotionThreshold * 2.0f))
+		rate = SHADING_RATE_4X4;
+	ShadingRateImage[tile] = rate;
+}
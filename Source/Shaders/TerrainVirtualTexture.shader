@@ -0,0 +1,148 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/GBufferCommon.hlsl"
+
+META_CB_BEGIN(0, Data)
+float4x4 ViewProjectionMatrix;
+float4x4 WorldMatrix;
+float4 HeightmapUVScaleBias;
+float4 NeighborLOD;
+float CurrentLOD;
+float ChunkSizeNextLOD;
+float TerrainChunkSizeLOD0;
+float TileIndex;
+float TileTexelSize;
+float Dummy0;
+float2 LODMorph;
+float3 LODViewPosition;
+float Dummy1;
+META_CB_END
+
+Texture2D Heightmap : register(t0);
+Texture2DArray Cache0 : register(t1);
+Texture2DArray Cache1 : register(t2);
+Texture2DArray Cache2 : register(t3);
+
+// Must match structure defined in TerrainManager.cpp
+struct TerrainVertexInput
+{
+	float2 TexCoord : TEXCOORD0;
+	float4 Morph : TEXCOORD1;
+};
+
+struct VertexOutput
+{
+	float4 Position : SV_Position;
+	float2 TileUV : TEXCOORD0;
+};
+
+// Calculates LOD value (with fractional part for blending), matches the terrain material template
+float CalcLOD(float2 xy, float4 morph, out float edgeWeight)
+{
+	// Use LOD value based on Barycentric coordinates to morph to the lower LOD near chunk edges
+	float4 lodCalculated = morph * CurrentLOD + NeighborLOD * (float4(1, 1, 1, 1) - morph);
+
+	// Pick a quadrant (top, left, right or bottom)
+	float lod;
+	if ((xy.x + xy.y) > 1)
+	{
+		if (xy.x < xy.y)
+		{
+			lod = lodCalculated.w;
+			edgeWeight = morph.w;
+		}
+		else
+		{
+			lod = lodCalculated.z;
+			edgeWeight = morph.z;
+		}
+	}
+	else
+	{
+		if (xy.x < xy.y)
+		{
+			lod = lodCalculated.y;
+			edgeWeight = morph.y;
+		}
+		else
+		{
+			lod = lodCalculated.x;
+			edgeWeight = morph.x;
+		}
+	}
+	return lod;
+}
+
+// Calculates the distance-based morphing into the next LOD, matches the terrain material template
+float CalcDistanceMorph(float3 worldPosition)
+{
+	if (LODMorph.x <= 0.0f)
+		return 0.0f;
+	float distance = length(worldPosition - LODViewPosition);
+	float lod = pow(distance / TerrainChunkSizeLOD0, LODMorph.x) + LODMorph.y;
+	return saturate((lod - CurrentLOD - 0.5f) / 0.5f);
+}
+
+// Vertex Shader, matches the terrain material template geometry (heightmap sampling with the smooth LOD transition)
+META_VS(true, FEATURE_LEVEL_SM5)
+META_VS_IN_ELEMENT(TEXCOORD, 0, R32G32_FLOAT,   0, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(TEXCOORD, 1, R8G8B8A8_UNORM, 0, ALIGN, PER_VERTEX, 0, true)
+VertexOutput VS(TerrainVertexInput input)
+{
+	// Calculate terrain LOD for this chunk
+	float edgeWeight;
+	float lodCalculated = CalcLOD(input.TexCoord, input.Morph, edgeWeight);
+	float morphAlpha = lodCalculated - CurrentLOD;
+
+	// Sample heightmap
+	float2 heightmapUVs = input.TexCoord * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
+	float4 heightmapValueThisLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVs, CurrentLOD);
+	float heightThisLOD = (float)((int)(heightmapValueThisLOD.x * 255.0) + ((int)(heightmapValueThisLOD.y * 255) << 8)) / 65535.0;
+	float3 positionThisLOD = mul(float4(input.TexCoord.x * TerrainChunkSizeLOD0, heightThisLOD, input.TexCoord.y * TerrainChunkSizeLOD0, 1), WorldMatrix).xyz;
+	morphAlpha = max(morphAlpha, CalcDistanceMorph(positionThisLOD) * edgeWeight);
+	float2 nextLODPos = round(input.TexCoord * ChunkSizeNextLOD) / ChunkSizeNextLOD;
+	float2 heightmapUVsNextLOD = nextLODPos * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
+	float4 heightmapValueNextLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVsNextLOD, CurrentLOD + 1);
+	float4 heightmapValue = lerp(heightmapValueThisLOD, heightmapValueNextLOD, morphAlpha);
+	float height = (float)((int)(heightmapValue.x * 255.0) + ((int)(heightmapValue.y * 255) << 8)) / 65535.0;
+
+	// Construct vertex position
+	float2 positionXZ = lerp(input.TexCoord, nextLODPos, morphAlpha) * TerrainChunkSizeLOD0;
+	float3 position = float3(positionXZ.x, height, positionXZ.y);
+	float3 worldPosition = mul(float4(position, 1), WorldMatrix).xyz;
+
+	VertexOutput output;
+	output.Position = mul(float4(worldPosition, 1), ViewProjectionMatrix);
+
+	// Tile is baked with a top-down view of the chunk (see TerrainVirtualTexturePass::BakeTile)
+	float2 tileUV = positionXZ / TerrainChunkSizeLOD0;
+	output.TileUV = clamp(float2(tileUV.x, 1.0f - tileUV.y), TileTexelSize, 1.0f - TileTexelSize);
+	return output;
+}
+
+// Pixel Shader, writes the pre-blended terrain material from the cache tile into the GBuffer
+META_PS(true, FEATURE_LEVEL_SM5)
+void PS_Draw(VertexOutput input, out float4 Light : SV_Target0, out float4 RT0 : SV_Target1, out float4 RT1 : SV_Target2, out float4 RT2 : SV_Target3, out float4 RT3 : SV_Target4)
+{
+	float3 uv = float3(input.TileUV, TileIndex);
+	float4 gBuffer1 = Cache1.Sample(SamplerLinearClamp, uv);
+
+	// Skip terrain holes
+	clip(gBuffer1.a - 0.5f / 3.0f);
+
+	Light = float4(0, 0, 0, 0);
+	RT0 = Cache0.Sample(SamplerLinearClamp, uv);
+	RT1 = float4(EncodeNormal(DecodeNormal(gBuffer1.rgb)), SHADING_MODEL_LIT * (1.0 / 3.0));
+	RT2 = Cache2.Sample(SamplerLinearClamp, uv);
+	RT3 = float4(0, 0, 0, 0);
+}
+
+Texture2DArray Source : register(t4);
+
+// Pixel Shader, downsamples the tile to generate its mip maps
+META_PS(true, FEATURE_LEVEL_SM5)
+float4 PS_Downsample(Quad_VS2PS input) : SV_Target
+{
+	return Source.SampleLevel(SamplerLinearClamp, float3(input.TexCoord, 0), 0);
+}
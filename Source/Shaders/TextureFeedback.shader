@@ -0,0 +1,52 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+META_CB_BEGIN(0, Data)
+float4x4 ViewProjectionMatrix;
+float4x4 WorldMatrix;
+uint DrawIndex;
+float ResolutionScale;
+float2 Dummy0;
+META_CB_END
+
+struct VertexInput
+{
+	float3 Position : POSITION;
+	float2 TexCoord : TEXCOORD0;
+	float4 Normal : NORMAL;
+	float4 Tangent : TANGENT;
+	float2 LightmapUV : TEXCOORD1;
+};
+
+struct VertexOutput
+{
+	float4 Position : SV_Position;
+	float2 TexCoord : TEXCOORD0;
+};
+
+META_VS(true, FEATURE_LEVEL_ES3)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(TEXCOORD, 0, R16G16_FLOAT,      1, 0,     PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(NORMAL,   0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(TANGENT,  0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(TEXCOORD, 1, R16G16_FLOAT,      1, ALIGN, PER_VERTEX, 0, true)
+VertexOutput VS(VertexInput input)
+{
+	VertexOutput output;
+	float3 worldPosition = mul(float4(input.Position.xyz, 1), WorldMatrix).xyz;
+	output.Position = mul(float4(worldPosition, 1), ViewProjectionMatrix);
+	output.TexCoord = input.TexCoord;
+	return output;
+}
+
+// Outputs the draw index (high 16 bits) and the texture resolution needed to sample the pixel without minification (low 16 bits)
+META_PS(true, FEATURE_LEVEL_ES3)
+uint PS(VertexOutput input) : SV_Target0
+{
+	float2 dx = ddx(input.TexCoord);
+	float2 dy = ddy(input.TexCoord);
+	float uvPerPixel = max(max(length(dx), length(dy)), 0.000001f);
+	uint resolution = (uint)clamp(ResolutionScale / uvPerPixel, 1.0f, 65535.0f);
+	return ((DrawIndex + 1) << 16) | resolution;
+}
@@ -198,6 +198,15 @@ struct dtCrowdAgentDebugInfo
 	dtObstacleAvoidanceDebugData* vod;
 };
 
+/// Callback used to execute the crowd update work in parallel.
+/// Must call @p func for every index in [0, @p count) (possibly concurrently) and return once all calls are done.
+///  @param[in]		context		The user context passed to dtCrowd::setParallelUpdate.
+///  @param[in]		func		The work function to call.
+///  @param[in]		data		The work data to pass to @p func.
+///  @param[in]		count		The amount of work items.
+/// @ingroup crowd
+typedef void (*dtCrowdParallelForFunc)(void* context, void (*func)(void* data, int index), void* data, int count);
+
 /// Provides local steering behaviors for a group of agents. 
 /// @ingroup crowd
 class dtCrowd
@@ -227,6 +236,14 @@ class dtCrowd
 
 	dtNavMeshQuery* m_navquery;
 
+	int m_maxWorkers;
+	int m_minAgentsPerWorker;
+	dtNavMeshQuery** m_workerNavqueries;
+	dtObstacleAvoidanceQuery** m_workerObstacleQueries;
+	int* m_workerVelocitySampleCounts;
+	dtCrowdParallelForFunc m_parallelFor;
+	void* m_parallelForContext;
+
 	void updateTopologyOptimization(dtCrowdAgent** agents, const int nagents, const float dt);
 	void updateMoveRequest(const float dt);
 	void checkPathValidity(dtCrowdAgent** agents, const int nagents, const float dt);
@@ -236,6 +253,11 @@ class dtCrowd
 	bool requestMoveTargetReplan(const int idx, dtPolyRef ref, const float* pos);
 
 	void purge();
+	void purgeWorkers();
+
+	void updateStage(const int stage, dtCrowdAgent** agents, const int nagents, const float dt, dtCrowdAgentDebugInfo* debug);
+	void updateStageRange(const int stage, dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int worker, const float dt, dtCrowdAgentDebugInfo* debug);
+	static void updateStageJob(void* data, int index);
 	
 public:
 	dtCrowd();
@@ -258,6 +280,17 @@ class dtCrowd
 	///							[Limits:  0 <= value < #DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS]
 	/// @return The requested configuration.
 	const dtObstacleAvoidanceParams* getObstacleAvoidanceParams(const int idx) const;
+
+	/// Enables the parallel update of the agents. Per-agent stages (boundary, corners, steering, velocity planning, integration,
+	/// collisions and movement) are split into contiguous agent ranges executed via @p func with a barrier between the stages,
+	/// so the results match the serial update. Each worker uses own navmesh and obstacle avoidance queries.
+	/// Must be called after init (re-initialization resets it).
+	///  @param[in]		maxWorkers			The maximum amount of workers to split the update into. Use 1 or less to disable the parallel update.
+	///  @param[in]		minAgentsPerWorker	The minimum amount of active agents per worker (small crowds are updated serially).
+	///  @param[in]		func				The parallel execution callback.
+	///  @param[in]		context				The user context passed to @p func.
+	/// @return True if the parallel update has been set up.
+	bool setParallelUpdate(const int maxWorkers, const int minAgentsPerWorker, dtCrowdParallelForFunc func, void* context);
 	
 	/// Gets the specified agent from the pool.
 	///	 @param[in]		idx		The agent index. [Limits: 0 <= value < #getAgentCount()]
@@ -1474,7 +1474,8 @@ private static void GenerateCppManagedWrapperFunction(BuildData buildData, Strin
             contents.AppendLine("            managedTypeHandle = managedTypePtr->GetBaseType();");
             contents.AppendLine("            managedTypePtr = &managedTypeHandle.GetType();");
             contents.AppendLine("        }");
-            contents.AppendLine("        if (WrapperCallInstance == object)");
+            CppIncludeFiles.Add("Engine/Scripting/Scripting.h");
+            contents.AppendLine($"        if (WrapperCallInstance == object || Scripting::IsManagedDirectCall(object, {scriptVTableOffset}))");
             contents.AppendLine("        {");
             GenerateCppVirtualWrapperCallBaseMethod(buildData, contents, classInfo, functionInfo, "managedTypePtr->Script.ScriptVTableBase", scriptVTableOffset);
             contents.AppendLine("        }");
@@ -63,6 +63,7 @@ private struct DotnetContext
         internal const string NetworkReplicated = "NetworkReplicated";
         internal const string NetworkReplicatedAttribute = "FlaxEngine.NetworkReplicatedAttribute";
         internal const string NetworkRpc = "NetworkRpc";
+        private const string NetworkThreadSafe = "ThreadSafe";
         private const string Thunk1 = "INetworkSerializable_Serialize";
         private const string Thunk2 = "INetworkSerializable_Deserialize";
 
@@ -180,7 +181,26 @@ private void OnGenerateCppTypeInternals(Builder.BuildData buildData, ApiTypeInfo
 
             if (useReplication)
             {
-                typeInfo.SetTag(NetworkReplicated, string.Empty);
+                // Serializer that reads only fields (no property getters nor base type serializer) can be invoked from multiple threads
+                var threadSafe = true;
+                if (properties != null)
+                {
+                    foreach (var propertyInfo in properties)
+                    {
+                        if (propertyInfo.GetTag(NetworkReplicated) != null)
+                        {
+                            threadSafe = false;
+                            break;
+                        }
+                    }
+                }
+                if (typeInfo is ClassStructInfo classStructInfo && classStructInfo.BaseType != null)
+                {
+                    var baseTypeName = classStructInfo.BaseType.NativeName;
+                    if (baseTypeName != "ScriptingObject" && baseTypeName != "Script" && baseTypeName != "Actor")
+                        threadSafe = false;
+                }
+                typeInfo.SetTag(NetworkReplicated, threadSafe ? NetworkThreadSafe : string.Empty);
 
                 // Generate C++ wrapper functions to serialize/deserialize type
                 BindingsGenerator.CppIncludeFiles.Add("Engine/Networking/NetworkReplicator.h");
@@ -461,7 +481,8 @@ private void OnGenerateCppTypeInitRuntime(Builder.BuildData buildData, ApiTypeIn
             if (replicatedTag != null)
             {
                 // Register generated serializer functions
-                contents.AppendLine($"        NetworkReplicator::AddSerializer(ScriptingTypeHandle({typeNameNative}::TypeInitializer), {typeNameInternal}Internal::INetworkSerializable_Serialize, {typeNameInternal}Internal::INetworkSerializable_Deserialize);");
+                var threadSafe = replicatedTag == NetworkThreadSafe ? "true" : "false";
+                contents.AppendLine($"        NetworkReplicator::AddSerializer(ScriptingTypeHandle({typeNameNative}::TypeInitializer), {typeNameInternal}Internal::INetworkSerializable_Serialize, {typeNameInternal}Internal::INetworkSerializable_Deserialize, nullptr, nullptr, {threadSafe});");
             }
 
             if (rpcTag != null)
@@ -276,6 +276,12 @@ public static partial class EngineConfiguration
         [CommandLine("useDotNet", "1 to enable .NET support in build, 0 to enable Mono support in build")]
         public static bool UseDotNet = true;
 
+        /// <summary>
+        /// True if lock contention tracking should be enabled for the named locks (adds overhead to every operation on such locks).
+        /// </summary>
+        [CommandLine("useLocksProfiler", "1 to enable lock contention tracking for the named locks in build (COMPILE_WITH_LOCKS_PROFILER=1)")]
+        public static bool UseLocksProfiler = false;
+
         public static bool WithCSharp(NativeCpp.BuildOptions options)
         {
             return UseCSharp || options.Target.IsEditor;